@@ -43,7 +43,12 @@
 #include "cuda_runtime_api.h"
 #endif
 
-#define ARIEL_MAX_PAYLOAD_SIZE 64
+/* Space for records in an ARIEL_PERFORM_BATCH command, sized so the batch
+ * is no larger than the largest other command and an ArielCommand fits in
+ * a 64 byte cache line (without CUDA) */
+#define ARIEL_BATCH_BYTES 40
+/* Largest encoded record: op byte, 5 byte size and 10 byte address delta */
+#define ARIEL_BATCH_MAX_RECORD 16
 
 namespace SST {
 namespace ArielComponent {
@@ -68,8 +73,59 @@ enum ArielShmemCmd_t {
     ARIEL_ISSUE_RTL = 150,
     ARIEL_FLUSHLINE_INSTRUCTION = 154,
     ARIEL_FENCE_INSTRUCTION = 155,
+    ARIEL_PERFORM_BATCH = 160,
 };
 
+/*
+ * Records packed into an ARIEL_PERFORM_BATCH command.  Each record starts
+ * with a byte holding the op in the low 3 bits:
+ *  - START: instClass in the high 5 bits, followed by a varint simdElemCount
+ *  - READ/WRITE: size in the high 5 bits (0 if it doesn't fit, in which case
+ *    a varint size follows), then a zigzag varint of the address minus the
+ *    previous address in the batch
+ *  - END/NOOP: nothing else
+ * Writes in a batch carry no payload, so batching is only used when write
+ * payload tracing is off.
+ */
+enum ArielBatchOp_t {
+    ARIEL_BATCH_START = 0,
+    ARIEL_BATCH_READ = 1,
+    ARIEL_BATCH_WRITE = 2,
+    ARIEL_BATCH_END = 3,
+    ARIEL_BATCH_NOOP = 4,
+};
+
+static inline uint32_t arielBatchPutVarint(uint8_t* buf, uint64_t value) {
+    uint32_t len = 0;
+    while (value >= 0x80) {
+        buf[len++] = (uint8_t) (value | 0x80);
+        value >>= 7;
+    }
+    buf[len++] = (uint8_t) value;
+    return len;
+}
+
+static inline uint32_t arielBatchGetVarint(const uint8_t* buf, uint64_t* value) {
+    uint32_t len = 0;
+    uint32_t shift = 0;
+    uint64_t result = 0;
+    while (buf[len] & 0x80) {
+        result |= ((uint64_t) (buf[len++] & 0x7f)) << shift;
+        shift += 7;
+    }
+    result |= ((uint64_t) buf[len++]) << shift;
+    *value = result;
+    return len;
+}
+
+static inline uint64_t arielBatchZigZag(int64_t value) {
+    return ((uint64_t) value << 1) ^ (uint64_t) (value >> 63);
+}
+
+static inline int64_t arielBatchUnZigZag(uint64_t value) {
+    return (int64_t) (value >> 1) ^ -((int64_t) (value & 1));
+}
+
 #ifdef HAVE_CUDA
 struct CudaArguments {
     union {
@@ -139,7 +195,6 @@ struct ArielCommand {
             uint64_t addr;
             uint32_t instClass;
             uint32_t simdElemCount;
-            uint8_t  payload[ARIEL_MAX_PAYLOAD_SIZE];
         } inst;
         struct {
             uint64_t vaddr;
@@ -175,6 +230,11 @@ struct ArielCommand {
         struct {
             uint64_t vaddr;
         } flushline;
+        struct {
+            uint32_t count;
+            uint32_t bytes;
+            uint8_t  data[ARIEL_BATCH_BYTES];
+        } batch;
         struct {
             void* inp_ptr;
             void* ctrl_ptr;
@@ -268,6 +328,56 @@ public:
 
 };
 
+/*
+ * Write payloads travel on a separate tunnel, created only when payload
+ * tracing is on, so address-only runs don't carry them.  For each
+ * instruction the frontend sends the bytes written by its stores, in
+ * order, packed into chunks, and then the instruction's commands.  The
+ * core consumes inst.size bytes of the stream for each write it reads;
+ * the last chunk of an instruction may be partly filled.
+ */
+#define ARIEL_PAYLOAD_CHUNK_BYTES 60
+/* Chunks buffered per core, which bounds the payload of one instruction */
+#define ARIEL_PAYLOAD_QUEUE_LEN 256
+
+struct ArielPayloadSharedData {
+    size_t numCores;
+    volatile uint32_t child_attached;
+    uint8_t __pad[ 256 - sizeof(uint32_t) - sizeof(size_t)];
+};
+
+struct ArielPayloadChunk {
+    uint32_t bytes;
+    uint8_t  data[ARIEL_PAYLOAD_CHUNK_BYTES];
+};
+
+class ArielPayloadTunnel : public SST::Core::Interprocess::TunnelDef<ArielPayloadSharedData, ArielPayloadChunk>
+{
+public:
+    /**
+     * Create a new payload tunnel
+     */
+    ArielPayloadTunnel(size_t numCores, size_t bufferSize, uint32_t expectedChildren = 1) :
+        SST::Core::Interprocess::TunnelDef<ArielPayloadSharedData, ArielPayloadChunk>(numCores, bufferSize, expectedChildren) { }
+
+    /**
+     * Attach to an existing payload tunnel (Created in another process)
+     */
+    ArielPayloadTunnel(void* sPtr) :
+        SST::Core::Interprocess::TunnelDef<ArielPayloadSharedData, ArielPayloadChunk>(sPtr) { }
+
+    virtual uint32_t initialize(void* sPtr) {
+        uint32_t childnum = SST::Core::Interprocess::TunnelDef<ArielPayloadSharedData, ArielPayloadChunk>::initialize(sPtr);
+        if (isMaster()) {
+            sharedData->numCores = getNumBuffers();
+            sharedData->child_attached = 0;
+        } else {
+            sharedData->child_attached++;
+        }
+        return childnum;
+    }
+};
+
 #ifdef HAVE_CUDA
 struct GpuSharedData {
     size_t numCores;
@@ -0,0 +1,433 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include <sst_config.h>
+
+#include "arielcmdtrace.h"
+
+#include <fcntl.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "zlib.h"
+
+using namespace SST::ArielComponent;
+
+static const char ARIEL_CMDTRACE_MAGIC[8] = { 'A', 'R', 'L', 'C', 'M', 'D', 'T', 'R' };
+static const size_t ARIEL_CMDTRACE_HEADER_SIZE = 32;
+static const size_t ARIEL_CMDTRACE_INDEX_OFFSET = 24;
+static const size_t ARIEL_CMDTRACE_CHUNK_HEADER_SIZE = 16;
+// Amount of encoded records per core before they are compressed and written
+static const size_t ARIEL_CMDTRACE_CHUNK_BYTES = 256 * 1024;
+
+static void putVarint(std::vector<uint8_t>& buf, uint64_t value) {
+    uint8_t tmp[10];
+    const uint32_t len = arielBatchPutVarint(tmp, value);
+    buf.insert(buf.end(), tmp, tmp + len);
+}
+
+static void putAddr(std::vector<uint8_t>& buf, uint64_t addr, uint64_t& lastAddr) {
+    putVarint(buf, arielBatchZigZag((int64_t) (addr - lastAddr)));
+    lastAddr = addr;
+}
+
+static void put32(uint8_t* buf, uint32_t value) {
+    memcpy(buf, &value, sizeof(value));
+}
+
+static uint32_t get32(const uint8_t* buf) {
+    uint32_t value;
+    memcpy(&value, buf, sizeof(value));
+    return value;
+}
+
+static uint64_t get64(const uint8_t* buf) {
+    uint64_t value;
+    memcpy(&value, buf, sizeof(value));
+    return value;
+}
+
+ArielCommandTraceWriter::ArielCommandTraceWriter(const std::string& tracePath, uint32_t cores, bool withPayloads, Output* out) :
+    output(out), path(tracePath), payloads(withPayloads) {
+
+    file = fopen(path.c_str(), "wb");
+    if (NULL == file) {
+        output->fatal(CALL_INFO, -1, "Error: unable to open command trace '%s' for writing\n", path.c_str());
+    }
+
+    streams.resize(cores);
+    for (uint32_t i = 0; i < cores; i++) {
+        streams[i].commands = 0;
+        streams[i].lastAddr = 0;
+        streams[i].totalCommands = 0;
+        streams[i].raw.reserve(ARIEL_CMDTRACE_CHUNK_BYTES + 256);
+    }
+
+    uint8_t header[ARIEL_CMDTRACE_HEADER_SIZE];
+    memset(header, 0, sizeof(header));
+    memcpy(header, ARIEL_CMDTRACE_MAGIC, sizeof(ARIEL_CMDTRACE_MAGIC));
+    put32(&header[8], ARIEL_CMDTRACE_VERSION);
+    put32(&header[12], cores);
+    put32(&header[16], payloads ? ARIEL_CMDTRACE_PAYLOADS : 0);
+    fwrite(header, 1, sizeof(header), file);
+}
+
+ArielCommandTraceWriter::~ArielCommandTraceWriter() {
+    close();
+}
+
+void ArielCommandTraceWriter::record(uint32_t core, const ArielCommand& ac, const uint8_t* payload) {
+    std::lock_guard<std::mutex> guard(lock);
+
+    CoreStream& stream = streams[core];
+    std::vector<uint8_t>& buf = stream.raw;
+
+    buf.push_back((uint8_t) ac.command);
+
+    switch (ac.command) {
+        case ARIEL_START_INSTRUCTION:
+            putVarint(buf, ac.inst.instClass);
+            putVarint(buf, ac.inst.simdElemCount);
+            break;
+
+        case ARIEL_PERFORM_READ:
+            putVarint(buf, ac.inst.size);
+            putAddr(buf, ac.inst.addr, stream.lastAddr);
+            break;
+
+        case ARIEL_PERFORM_WRITE:
+            putVarint(buf, ac.inst.size);
+            putAddr(buf, ac.inst.addr, stream.lastAddr);
+            if (payloads) {
+                buf.insert(buf.end(), &payload[0], &payload[ac.inst.size]);
+            }
+            break;
+
+        case ARIEL_PERFORM_BATCH:
+            putVarint(buf, ac.batch.count);
+            putVarint(buf, ac.batch.bytes);
+            buf.insert(buf.end(), &ac.batch.data[0], &ac.batch.data[ac.batch.bytes]);
+            break;
+
+        case ARIEL_FLUSHLINE_INSTRUCTION:
+            putAddr(buf, ac.flushline.vaddr, stream.lastAddr);
+            break;
+
+        case ARIEL_ISSUE_TLM_MAP:
+            putAddr(buf, ac.mlm_map.vaddr, stream.lastAddr);
+            putVarint(buf, ac.mlm_map.alloc_len);
+            putVarint(buf, ac.mlm_map.alloc_level);
+            putVarint(buf, ac.instPtr);
+            break;
+
+        case ARIEL_ISSUE_TLM_MMAP:
+            putAddr(buf, ac.mlm_mmap.vaddr, stream.lastAddr);
+            putVarint(buf, ac.mlm_mmap.alloc_len);
+            putVarint(buf, ac.mlm_mmap.alloc_level);
+            putVarint(buf, ac.mlm_mmap.fileID);
+            putVarint(buf, ac.instPtr);
+            break;
+
+        case ARIEL_ISSUE_TLM_FREE:
+            putAddr(buf, ac.mlm_free.vaddr, stream.lastAddr);
+            break;
+
+        case ARIEL_SWITCH_POOL:
+            putVarint(buf, ac.switchPool.pool);
+            break;
+
+        case ARIEL_END_INSTRUCTION:
+        case ARIEL_NOOP:
+        case ARIEL_FENCE_INSTRUCTION:
+        case ARIEL_OUTPUT_STATS:
+        case ARIEL_PERFORM_EXIT:
+            break;
+
+        default:
+            // RTL and CUDA commands point into the application's memory
+            output->fatal(CALL_INFO, -1, "Error: Ariel command (%d) on core %" PRIu32 " cannot be recorded in a command trace.\n",
+                    (int) ac.command, core);
+            break;
+    }
+
+    stream.commands++;
+    if (buf.size() >= ARIEL_CMDTRACE_CHUNK_BYTES) {
+        writeChunk(core);
+    }
+}
+
+void ArielCommandTraceWriter::writeChunk(uint32_t core) {
+    CoreStream& stream = streams[core];
+
+    uLongf zipBytes = compressBound(stream.raw.size());
+    zipBuffer.resize(ARIEL_CMDTRACE_CHUNK_HEADER_SIZE + zipBytes);
+    if (Z_OK != compress2(&zipBuffer[ARIEL_CMDTRACE_CHUNK_HEADER_SIZE], &zipBytes, &stream.raw[0], stream.raw.size(), Z_DEFAULT_COMPRESSION)) {
+        output->fatal(CALL_INFO, -1, "Error: unable to compress a chunk of command trace '%s'\n", path.c_str());
+    }
+
+    put32(&zipBuffer[0], core);
+    put32(&zipBuffer[4], stream.commands);
+    put32(&zipBuffer[8], (uint32_t) stream.raw.size());
+    put32(&zipBuffer[12], (uint32_t) zipBytes);
+
+    stream.index.push_back((uint64_t) ftell(file));
+    stream.index.push_back(stream.totalCommands);
+    if (1 != fwrite(&zipBuffer[0], ARIEL_CMDTRACE_CHUNK_HEADER_SIZE + zipBytes, 1, file)) {
+        output->fatal(CALL_INFO, -1, "Error: unable to write to command trace '%s'\n", path.c_str());
+    }
+
+    stream.totalCommands += stream.commands;
+    stream.commands = 0;
+    stream.lastAddr = 0;
+    stream.raw.clear();
+}
+
+void ArielCommandTraceWriter::close() {
+    std::lock_guard<std::mutex> guard(lock);
+
+    if (NULL == file) return;
+
+    for (uint32_t i = 0; i < streams.size(); i++) {
+        if (!streams[i].raw.empty()) writeChunk(i);
+    }
+
+    const uint64_t indexOffset = (uint64_t) ftell(file);
+    for (uint32_t i = 0; i < streams.size(); i++) {
+        const uint64_t chunks = streams[i].index.size() / 2;
+        fwrite(&chunks, sizeof(chunks), 1, file);
+        if (chunks > 0) {
+            fwrite(&streams[i].index[0], sizeof(uint64_t), streams[i].index.size(), file);
+        }
+    }
+
+    fseek(file, ARIEL_CMDTRACE_INDEX_OFFSET, SEEK_SET);
+    fwrite(&indexOffset, sizeof(indexOffset), 1, file);
+    fclose(file);
+    file = NULL;
+}
+
+ArielCommandTraceReader::ArielCommandTraceReader(const std::string& tracePath, Output* out) :
+    output(out), path(tracePath), map(NULL), mapSize(0) {
+
+    int fd = open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        output->fatal(CALL_INFO, -1, "Error: unable to open command trace '%s'\n", path.c_str());
+    }
+
+    struct stat info;
+    if (fstat(fd, &info) != 0 || (size_t) info.st_size < ARIEL_CMDTRACE_HEADER_SIZE) {
+        output->fatal(CALL_INFO, -1, "Error: command trace '%s' is too short to be a trace\n", path.c_str());
+    }
+    mapSize = info.st_size;
+
+    void* region = mmap(NULL, mapSize, PROT_READ, MAP_PRIVATE, fd, 0);
+    ::close(fd);
+    if (MAP_FAILED == region) {
+        output->fatal(CALL_INFO, -1, "Error: unable to map command trace '%s'\n", path.c_str());
+    }
+    map = (const uint8_t*) region;
+
+    if (memcmp(map, ARIEL_CMDTRACE_MAGIC, sizeof(ARIEL_CMDTRACE_MAGIC)) != 0) {
+        output->fatal(CALL_INFO, -1, "Error: '%s' is not an Ariel command trace\n", path.c_str());
+    }
+    if (get32(&map[8]) != ARIEL_CMDTRACE_VERSION) {
+        output->fatal(CALL_INFO, -1, "Error: command trace '%s' has version %" PRIu32 ", expected %d\n",
+                path.c_str(), get32(&map[8]), ARIEL_CMDTRACE_VERSION);
+    }
+    cores = get32(&map[12]);
+    payloads = (get32(&map[16]) & ARIEL_CMDTRACE_PAYLOADS) != 0;
+
+    uint64_t offset = get64(&map[ARIEL_CMDTRACE_INDEX_OFFSET]);
+    if (offset == 0) {
+        output->fatal(CALL_INFO, -1, "Error: command trace '%s' has no index, the recording run did not finish\n", path.c_str());
+    }
+
+    cursors.resize(cores);
+    for (uint32_t i = 0; i < cores; i++) {
+        if (offset + sizeof(uint64_t) > mapSize) {
+            output->fatal(CALL_INFO, -1, "Error: index of command trace '%s' is truncated\n", path.c_str());
+        }
+        const uint64_t chunks = get64(&map[offset]);
+        offset += sizeof(uint64_t);
+        if (offset + chunks * 2 * sizeof(uint64_t) > mapSize) {
+            output->fatal(CALL_INFO, -1, "Error: index of command trace '%s' is truncated\n", path.c_str());
+        }
+
+        CoreCursor& cursor = cursors[i];
+        cursor.index.resize(chunks * 2);
+        for (uint64_t j = 0; j < chunks * 2; j++) {
+            cursor.index[j] = get64(&map[offset]);
+            offset += sizeof(uint64_t);
+        }
+        cursor.nextChunk = 0;
+        cursor.pos = 0;
+        cursor.lastAddr = 0;
+        cursor.payload = NULL;
+    }
+}
+
+ArielCommandTraceReader::~ArielCommandTraceReader() {
+    if (NULL != map) {
+        munmap((void*) map, mapSize);
+    }
+}
+
+uint64_t ArielCommandTraceReader::getCommandCount(uint32_t core) const {
+    const std::vector<uint64_t>& index = cursors[core].index;
+    if (index.empty()) return 0;
+
+    // First command of the last chunk plus the commands in it
+    return index[index.size() - 1] + get32(&map[index[index.size() - 2] + 4]);
+}
+
+bool ArielCommandTraceReader::loadChunk(uint32_t core) {
+    CoreCursor& cursor = cursors[core];
+    if (cursor.nextChunk * 2 >= cursor.index.size()) return false;
+
+    const uint64_t offset = cursor.index[cursor.nextChunk * 2];
+    cursor.nextChunk++;
+
+    if (offset + ARIEL_CMDTRACE_CHUNK_HEADER_SIZE > mapSize) {
+        output->fatal(CALL_INFO, -1, "Error: chunk at offset %" PRIu64 " of command trace '%s' is truncated\n", offset, path.c_str());
+    }
+    const uint8_t* chunk = &map[offset];
+    const uint32_t rawBytes = get32(&chunk[8]);
+    const uint32_t zipBytes = get32(&chunk[12]);
+    if (get32(&chunk[0]) != core || offset + ARIEL_CMDTRACE_CHUNK_HEADER_SIZE + zipBytes > mapSize) {
+        output->fatal(CALL_INFO, -1, "Error: chunk at offset %" PRIu64 " of command trace '%s' is corrupt\n", offset, path.c_str());
+    }
+
+    cursor.raw.resize(rawBytes);
+    uLongf outBytes = rawBytes;
+    if (Z_OK != uncompress(&cursor.raw[0], &outBytes, &chunk[ARIEL_CMDTRACE_CHUNK_HEADER_SIZE], zipBytes) || outBytes != rawBytes) {
+        output->fatal(CALL_INFO, -1, "Error: unable to decompress the chunk at offset %" PRIu64 " of command trace '%s'\n", offset, path.c_str());
+    }
+    cursor.pos = 0;
+    cursor.lastAddr = 0;
+    return true;
+}
+
+bool ArielCommandTraceReader::read(uint32_t core, ArielCommand* ac) {
+    if (core >= cores) return false;
+
+    CoreCursor& cursor = cursors[core];
+    if (cursor.pos >= cursor.raw.size()) {
+        if (!loadChunk(core)) return false;
+    }
+
+    const uint8_t* buf = &cursor.raw[0];
+    size_t& pos = cursor.pos;
+    uint64_t value;
+
+    memset(ac, 0, sizeof(ArielCommand));
+    ac->command = (ArielShmemCmd_t) buf[pos++];
+
+    // Records are only decoded from chunks the writer produced, so a bad
+    // command byte means the file is corrupt
+    switch (ac->command) {
+        case ARIEL_START_INSTRUCTION:
+            pos += arielBatchGetVarint(&buf[pos], &value);
+            ac->inst.instClass = (uint32_t) value;
+            pos += arielBatchGetVarint(&buf[pos], &value);
+            ac->inst.simdElemCount = (uint32_t) value;
+            break;
+
+        case ARIEL_PERFORM_READ:
+        case ARIEL_PERFORM_WRITE:
+            pos += arielBatchGetVarint(&buf[pos], &value);
+            ac->inst.size = (uint32_t) value;
+            pos += arielBatchGetVarint(&buf[pos], &value);
+            cursor.lastAddr += (uint64_t) arielBatchUnZigZag(value);
+            ac->inst.addr = cursor.lastAddr;
+            if (ac->command == ARIEL_PERFORM_WRITE && payloads) {
+                if (pos + ac->inst.size > cursor.raw.size()) {
+                    output->fatal(CALL_INFO, -1, "Error: command trace '%s' is corrupt (write payload of %" PRIu32 " bytes)\n", path.c_str(), ac->inst.size);
+                }
+                cursor.payload = &buf[pos];
+                pos += ac->inst.size;
+            }
+            break;
+
+        case ARIEL_PERFORM_BATCH:
+            pos += arielBatchGetVarint(&buf[pos], &value);
+            ac->batch.count = (uint32_t) value;
+            pos += arielBatchGetVarint(&buf[pos], &value);
+            ac->batch.bytes = (uint32_t) value;
+            if (ac->batch.bytes > ARIEL_BATCH_BYTES) {
+                output->fatal(CALL_INFO, -1, "Error: command trace '%s' is corrupt (batch of %" PRIu32 " bytes)\n", path.c_str(), ac->batch.bytes);
+            }
+            memcpy(&ac->batch.data[0], &buf[pos], ac->batch.bytes);
+            pos += ac->batch.bytes;
+            break;
+
+        case ARIEL_FLUSHLINE_INSTRUCTION:
+            pos += arielBatchGetVarint(&buf[pos], &value);
+            cursor.lastAddr += (uint64_t) arielBatchUnZigZag(value);
+            ac->flushline.vaddr = cursor.lastAddr;
+            break;
+
+        case ARIEL_ISSUE_TLM_MAP:
+            pos += arielBatchGetVarint(&buf[pos], &value);
+            cursor.lastAddr += (uint64_t) arielBatchUnZigZag(value);
+            ac->mlm_map.vaddr = cursor.lastAddr;
+            pos += arielBatchGetVarint(&buf[pos], &ac->mlm_map.alloc_len);
+            pos += arielBatchGetVarint(&buf[pos], &value);
+            ac->mlm_map.alloc_level = (uint32_t) value;
+            pos += arielBatchGetVarint(&buf[pos], &ac->instPtr);
+            break;
+
+        case ARIEL_ISSUE_TLM_MMAP:
+            pos += arielBatchGetVarint(&buf[pos], &value);
+            cursor.lastAddr += (uint64_t) arielBatchUnZigZag(value);
+            ac->mlm_mmap.vaddr = cursor.lastAddr;
+            pos += arielBatchGetVarint(&buf[pos], &ac->mlm_mmap.alloc_len);
+            pos += arielBatchGetVarint(&buf[pos], &value);
+            ac->mlm_mmap.alloc_level = (uint32_t) value;
+            pos += arielBatchGetVarint(&buf[pos], &value);
+            ac->mlm_mmap.fileID = (uint32_t) value;
+            pos += arielBatchGetVarint(&buf[pos], &ac->instPtr);
+            break;
+
+        case ARIEL_ISSUE_TLM_FREE:
+            pos += arielBatchGetVarint(&buf[pos], &value);
+            cursor.lastAddr += (uint64_t) arielBatchUnZigZag(value);
+            ac->mlm_free.vaddr = cursor.lastAddr;
+            break;
+
+        case ARIEL_SWITCH_POOL:
+            pos += arielBatchGetVarint(&buf[pos], &value);
+            ac->switchPool.pool = (uint32_t) value;
+            break;
+
+        case ARIEL_END_INSTRUCTION:
+        case ARIEL_NOOP:
+        case ARIEL_FENCE_INSTRUCTION:
+        case ARIEL_OUTPUT_STATS:
+        case ARIEL_PERFORM_EXIT:
+            break;
+
+        default:
+            output->fatal(CALL_INFO, -1, "Error: command trace '%s' is corrupt (unknown command %d on core %" PRIu32 ")\n",
+                    path.c_str(), (int) ac->command, core);
+            break;
+    }
+
+    if (pos > cursor.raw.size()) {
+        output->fatal(CALL_INFO, -1, "Error: command trace '%s' is corrupt (record overruns its chunk on core %" PRIu32 ")\n", path.c_str(), core);
+    }
+    return true;
+}
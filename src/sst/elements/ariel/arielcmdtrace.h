@@ -0,0 +1,126 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_ARIEL_COMMAND_TRACE
+#define _H_ARIEL_COMMAND_TRACE
+
+#include <sst/core/output.h>
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include <mutex>
+#include <string>
+#include <vector>
+
+#include "ariel_shmem.h"
+
+namespace SST {
+namespace ArielComponent {
+
+/*
+ * Traces of the commands each core reads from the tunnel, so a run can be
+ * replayed (ariel.frontend.replay) without launching the application.
+ *
+ * The file starts with a header:
+ *   char     magic[8]     "ARLCMDTR"
+ *   uint32_t version
+ *   uint32_t cores
+ *   uint32_t flags        ARIEL_CMDTRACE_PAYLOADS if writes carry data
+ *   uint32_t reserved
+ *   uint64_t indexOffset  written when the trace is closed
+ * followed by chunks of zlib-compressed records for one core:
+ *   uint32_t core, uint32_t commands, uint32_t rawBytes, uint32_t zipBytes
+ * Each record is the command byte and its varint fields, with addresses
+ * stored as zigzag deltas from the last address in the chunk, so every
+ * chunk decodes on its own.  With ARIEL_CMDTRACE_PAYLOADS, each write
+ * record is followed by its inst.size payload bytes.  The index at indexOffset lists each core's
+ * chunks: uint64_t count, then count pairs of (file offset, first command).
+ */
+#define ARIEL_CMDTRACE_VERSION 2
+#define ARIEL_CMDTRACE_PAYLOADS 0x1
+
+class ArielCommandTraceWriter {
+    public:
+        ArielCommandTraceWriter(const std::string& path, uint32_t cores, bool payloads, Output* out);
+        ~ArielCommandTraceWriter();
+
+        /* Append a command read by core, safe to call from several threads.
+         * payload holds the data of a write if payloads are recorded. */
+        void record(uint32_t core, const ArielCommand& ac, const uint8_t* payload);
+        /* Write out the remaining chunks and the index */
+        void close();
+
+    private:
+        struct CoreStream {
+            std::vector<uint8_t> raw;
+            uint32_t commands;
+            uint64_t lastAddr;
+            uint64_t totalCommands;
+            std::vector<uint64_t> index;    // (offset, first command) pairs
+        };
+
+        void writeChunk(uint32_t core);
+
+        Output* output;
+        std::string path;
+        FILE* file;
+        bool payloads;
+        std::vector<CoreStream> streams;
+        std::vector<uint8_t> zipBuffer;
+        std::mutex lock;
+};
+
+class ArielCommandTraceReader {
+    public:
+        ArielCommandTraceReader(const std::string& path, Output* out);
+        ~ArielCommandTraceReader();
+
+        /* Return the next command for core, false once its commands run out */
+        bool read(uint32_t core, ArielCommand* ac);
+        /* Payload of the last write read for core, valid until the next read */
+        const uint8_t* getPayload(uint32_t core) const { return cursors[core].payload; }
+
+        bool hasPayloads() const { return payloads; }
+
+        uint32_t getCoreCount() const { return cores; }
+        uint64_t getCommandCount(uint32_t core) const;
+
+    private:
+        struct CoreCursor {
+            std::vector<uint64_t> index;
+            size_t nextChunk;
+            std::vector<uint8_t> raw;
+            size_t pos;
+            uint64_t lastAddr;
+            const uint8_t* payload;
+        };
+
+        bool loadChunk(uint32_t core);
+
+        Output* output;
+        std::string path;
+        const uint8_t* map;
+        size_t mapSize;
+        uint32_t cores;
+        bool payloads;
+        std::vector<CoreCursor> cursors;
+};
+
+}
+}
+
+#endif
@@ -56,9 +56,52 @@ ArielCore::ArielCore(ComponentId_t id, ArielTunnel *tunnel,
     maxIssuePerCycle = maxIssuePerCyc;
     maxQLength = maxQLen;
     cacheLineSize = cacheLineSz;
-    memmgr = memMgr;
+    memmgr = NULL;
+    memmgrLock = NULL;
+    commandReplay = NULL;
+    commandRecorder = NULL;
+    payloadTunnel = NULL;
+    payloadChunk.bytes = 0;
+    payloadChunkPos = 0;
 
     writePayloads = params.find<int>("writepayloadtrace") == 0 ? false : true;
+
+    coalesceEntries = params.find<uint32_t>("coalesce_entries", 0);
+    coalesceCycles = params.find<uint64_t>("coalesce_cycles", 0);
+
+    sample_period = params.find<uint64_t>("sample_period", 0);
+    sample_detail = params.find<uint64_t>("sample_detail", 0);
+    fastForwardIssuePerCycle = params.find<uint32_t>("sample_ffwd_issue", 64);
+    std::string ffwdMode = params.find<std::string>("sample_fastforward", "skip");
+
+    if(sample_period != 0) {
+        if(sample_detail == 0 || sample_detail > sample_period) {
+            output->fatal(CALL_INFO, -1, "Error: sample_detail must be between 1 and sample_period (%" PRIu64 "), got %" PRIu64 ".\n",
+                sample_period, sample_detail);
+        }
+
+        if(ffwdMode == "skip") {
+            sample_warm_caches = false;
+        } else if(ffwdMode == "warm") {
+            sample_warm_caches = true;
+        } else {
+            output->fatal(CALL_INFO, -1, "Error: unknown sample_fastforward mode '%s', must be 'skip' or 'warm'.\n", ffwdMode.c_str());
+        }
+
+        if(fastForwardIssuePerCycle == 0) {
+            output->fatal(CALL_INFO, -1, "Error: sample_ffwd_issue must be at least 1.\n");
+        }
+    } else {
+        sample_warm_caches = false;
+    }
+
+    // With sampling on, execution starts in the fast-forwarded part of the period
+    inDetailWindow = (sample_period == 0);
+    windowStartCycle = 0;
+    windowStartInst = 0;
+    sampledCycles = 0;
+    sampledInsts = 0;
+    sampleWindows = 0;
     coreQ = new std::queue<ArielEvent*>();
     pendingTransactions = new std::unordered_map<StandardMem::Request::id_t, StandardMem::Request*>();
     pending_transaction_count = 0;
@@ -85,12 +128,18 @@ ArielCore::ArielCore(ComponentId_t id, ArielTunnel *tunnel,
     statWriteRequestSizes = registerStatistic<uint64_t>( "write_request_sizes", subID );
     statSplitReadRequests = registerStatistic<uint64_t>( "split_read_requests", subID );
     statSplitWriteRequests = registerStatistic<uint64_t>( "split_write_requests", subID );
+    statCoalescedReads = registerStatistic<uint64_t>( "coalesced_read_requests", subID );
+    statCoalescedWrites = registerStatistic<uint64_t>( "coalesced_write_requests", subID );
     statFlushRequests = registerStatistic<uint64_t>( "flush_requests", subID);
     statFenceRequests = registerStatistic<uint64_t>( "fence_requests", subID);
     statNoopCount     = registerStatistic<uint64_t>( "no_ops", subID );
     statInstructionCount = registerStatistic<uint64_t>( "instruction_count", subID );
     statCycles = registerStatistic<uint64_t>( "cycles", subID );
     statActiveCycles = registerStatistic<uint64_t>( "active_cycles", subID );
+    statFastForwardInsts = registerStatistic<uint64_t>( "ffwd_instructions", subID );
+    statSampleWindowCycles = registerStatistic<uint64_t>( "sample_window_cycles", subID );
+    statSampleWindowInsts = registerStatistic<uint64_t>( "sample_window_instructions", subID );
+    statEstimatedCycles = registerStatistic<uint64_t>( "estimated_cycles", subID );
 
     statFPSPIns = registerStatistic<uint64_t>("fp_sp_ins", subID);
     statFPDPIns = registerStatistic<uint64_t>("fp_dp_ins", subID);
@@ -104,9 +153,16 @@ ArielCore::ArielCore(ComponentId_t id, ArielTunnel *tunnel,
     statFPSPOps = registerStatistic<uint64_t>("fp_sp_ops", subID);
     statFPDPOps = registerStatistic<uint64_t>("fp_dp_ops", subID);
 
+    if(params.find<int>("host_profile", 0) != 0) {
+        profileTick.enable(registerStatistic<uint64_t>("host_ns_clock", subID), registerStatistic<uint64_t>("host_events_clock", subID));
+    }
+
     free(subID);
 
-    memmgr->registerInterruptHandler(coreID, new ArielMemoryManager::InterruptHandler<ArielCore>(this, &ArielCore::handleInterrupt));
+    // Cores in a core group get the leader's memory manager during init
+    if(NULL != memMgr) {
+        setMemoryManager(memMgr, NULL);
+    }
     stdMemHandlers = new StdMemHandler(this, output);
 
     std::string traceGenName = params.find<std::string>("tracegen", "");
@@ -140,6 +196,43 @@ ArielCore::~ArielCore() {
     delete stdMemHandlers;
 }
 
+void ArielCore::setTunnel(ArielTunnel* newTunnel) {
+    tunnel = newTunnel;
+}
+
+void ArielCore::setPayloadTunnel(ArielPayloadTunnel* newPayloadTunnel) {
+    payloadTunnel = newPayloadTunnel;
+}
+
+void ArielCore::setCommandTrace(ArielCommandTraceReader* replay, ArielCommandTraceWriter* recorder) {
+#ifdef HAVE_LIBZ
+    commandReplay = replay;
+    commandRecorder = recorder;
+#else
+    if(NULL != replay || NULL != recorder) {
+        output->fatal(CALL_INFO, -1, "Error: command traces require Ariel to be built with libz.\n");
+    }
+#endif
+}
+
+void ArielCore::setMemoryManager(ArielMemoryManager* newMemMgr, std::mutex* lock) {
+    memmgr = newMemMgr;
+    memmgrLock = lock;
+    memmgr->registerInterruptHandler(coreID, new ArielMemoryManager::InterruptHandler<ArielCore>(this, &ArielCore::handleInterrupt));
+}
+
+std::unique_lock<std::mutex> ArielCore::lockMemoryManager() {
+    if(NULL == memmgrLock) {
+        return std::unique_lock<std::mutex>();
+    }
+    return std::unique_lock<std::mutex>(*memmgrLock);
+}
+
+uint64_t ArielCore::translateAddress(uint64_t virtAddr) {
+    std::unique_lock<std::mutex> lock = lockMemoryManager();
+    return memmgr->translateAddress(virtAddr);
+}
+
 void ArielCore::setCacheLink(StandardMem* newLink) {
     cacheLink = newLink;
 }
@@ -258,6 +351,102 @@ void ArielCore::commitFlushEvent(const uint64_t address,
     }
 }
 
+// Memory operations (after line splitting) go through here so they can be coalesced.  Each open entry is a
+// request to a single line; later operations to the same line merge into the newest entry for that line if it
+// is the same kind (and, for writes, touches or overlaps it).  Entries issue in the order they were opened, once
+// they are coalesce_cycles old, when the window is full, or when a fence, flush or exit needs them drained.
+void ArielCore::issueRead(const uint64_t address, const uint64_t virtAddress, const uint32_t length) {
+#ifdef HAVE_CUDA
+    if(isGpuEx()) {
+        commitReadEvent(address, virtAddress, length);
+        return;
+    }
+#endif
+    if(coalesceEntries == 0 || length == 0) {
+        commitReadEvent(address, virtAddress, length);
+    } else {
+        coalesceRequest(true, address, virtAddress, length, NULL);
+    }
+}
+
+void ArielCore::issueWrite(const uint64_t address, const uint64_t virtAddress, const uint32_t length, const uint8_t* payload) {
+#ifdef HAVE_CUDA
+    if(isGpuEx()) {
+        commitWriteEvent(address, virtAddress, length, payload);
+        return;
+    }
+#endif
+    if(coalesceEntries == 0 || length == 0) {
+        commitWriteEvent(address, virtAddress, length, payload);
+    } else {
+        coalesceRequest(false, address, virtAddress, length, payload);
+    }
+}
+
+void ArielCore::coalesceRequest(const bool isRead, const uint64_t address, const uint64_t virtAddress,
+        const uint32_t length, const uint8_t* payload) {
+    const uint64_t line = address - (address % cacheLineSize);
+    const uint64_t end = address + length;
+    const uint64_t virtOffset = virtAddress - address;
+
+    for(std::deque<CoalesceEntry>::reverse_iterator it = coalesceQueue.rbegin(); it != coalesceQueue.rend(); it++) {
+        if(it->line != line) continue;
+
+        // Only the newest entry for a line may grow, or accesses to the line would be reordered
+        if(it->isRead != isRead || it->virtOffset != virtOffset) break;
+        if(!isRead && (end < it->start || it->end < address)) break;
+
+        if(!isRead && writePayloads) {
+            memcpy(&it->payload[address - line], payload, length);
+        }
+        it->start = std::min(it->start, address);
+        it->end = std::max(it->end, end);
+
+        if(isRead) {
+            statCoalescedReads->addData(1);
+        } else {
+            statCoalescedWrites->addData(1);
+        }
+        return;
+    }
+
+    if(coalesceQueue.size() >= coalesceEntries) {
+        issueCoalesced(1);
+    }
+
+    coalesceQueue.push_back(CoalesceEntry());
+    CoalesceEntry& entry = coalesceQueue.back();
+    entry.isRead = isRead;
+    entry.line = line;
+    entry.start = address;
+    entry.end = end;
+    entry.virtOffset = virtOffset;
+    entry.cycle = currentCycles;
+    if(!isRead && writePayloads) {
+        entry.payload.resize(cacheLineSize);
+        memcpy(&entry.payload[address - line], payload, length);
+    }
+}
+
+void ArielCore::issueCoalesced(size_t count) {
+    for(; count > 0 && !coalesceQueue.empty(); count--) {
+        CoalesceEntry& entry = coalesceQueue.front();
+        const uint32_t length = (uint32_t) (entry.end - entry.start);
+
+        if(entry.isRead) {
+            commitReadEvent(entry.start, entry.start + entry.virtOffset, length);
+        } else {
+            commitWriteEvent(entry.start, entry.start + entry.virtOffset, length,
+                    writePayloads ? &entry.payload[entry.start - entry.line] : NULL);
+        }
+        coalesceQueue.pop_front();
+    }
+}
+
+void ArielCore::drainCoalesced() {
+    issueCoalesced(coalesceQueue.size());
+}
+
 void ArielCore::handleEvent(StandardMem::Request* event) {
     ARIEL_CORE_VERBOSE(4, output->verbose(CALL_INFO, 4, 0, "Core %" PRIu32 " handling a memory event.\n", coreID));
     StandardMem::Request::id_t mev_id = event->getID();
@@ -309,13 +498,10 @@ void ArielCore::handleEvent(StandardMem::Request* event) {
                     setPageAckTransfer(0);
                     free(getDataAddress());
 
-                    // Send an ACK to get fesimple to continue
+                    // fesimple queues every page of the copy without waiting for
+                    // an ACK, so the next page is normally already in the tunnel
                     uint8_t *data;
-                    GpuCommand gc;
                     GpuDataCommand gd;
-                    gc.API_Return.name = GPU_MEMCPY_RET;
-                    output->verbose(CALL_INFO, 16, 0, "CUDA: Ariel sent ACK\n");
-                    tunnelR->writeMessage(coreID, gc);
                     bool avail = false;
 
                     // Wait for new page from fesimple
@@ -336,10 +522,10 @@ void ArielCore::handleEvent(StandardMem::Request* event) {
                         output->verbose(CALL_INFO, 16, 0, "\n");
                     }
 
-                    // Updated Page related variables, remove from tunnel, point to new data
+                    // Updated Page related variables, point to new data. Do not clear
+                    // the tunnel, it holds the pages after this one
                     setPageTransfer(gd.count);
                     setRemainingPageTransfer(gd.count);
-                    tunnelD->clearBuffer(coreID);
                     setDataAddress(data);
                 }
             }
@@ -402,11 +588,11 @@ void ArielCore::handleEvent(StandardMem::Request* event) {
                     output->verbose(CALL_INFO, 16, 0, "CUDA: Ariel sent ACK\n");
                     tunnelR->writeMessage(coreID, gc);
                 } else {
-                    // Larger data, and must be sent back in chunks
+                    // Larger data, and must be sent back in chunks. The pages are
+                    // queued back to back, fesimple drains them as they arrive
                     size_t remainder = getTotalTransfer() % (1<<12);
                     size_t pages = getTotalTransfer() - remainder;
                     uint64_t offset = 0;
-                    bool avail = false;
 
                     // Sending if there are full pages or small trailing data
                     while((pages != 0) || (remainder != 0)){
@@ -436,14 +622,6 @@ void ArielCore::handleEvent(StandardMem::Request* event) {
                             tunnelD->writeMessage(coreID, gd);
                             remainder = 0;
                         }
-
-                        // Wait for fesimple to ACK it got a page back
-                        do {
-                            avail = tunnelR->readMessageNB(coreID, &gc);
-                        } while (!avail);
-                        output->verbose(CALL_INFO, 16, 0, "CUDA: fesimple sent page ACK\n");
-                        tunnelR->clearBuffer(coreID);
-                        avail = false;
                     }
                     // Sent all data, allow fesimple to proceed
                     //gc.API_Return.name = GPU_MEMCPY_RET;
@@ -547,11 +725,67 @@ bool ArielCore::handleInterrupt(ArielMemoryManager::InterruptAction action) {
 }
 
 void ArielCore::finishCore() {
+    profileTick.report();
+
     // Close the trace file if we did in fact open it.
     if(enableTracing && traceGen) {
         delete traceGen;
         traceGen = NULL;
     }
+
+    if(sample_period != 0) {
+        // Count a detailed window that was cut short by the end of the run
+        if(inDetailWindow && inst_count > windowStartInst) {
+            sampledCycles += currentCycles - windowStartCycle;
+            sampledInsts += inst_count - windowStartInst;
+            sampleWindows++;
+        }
+
+        if(sampledInsts > 0) {
+            // Extrapolate the CPI of the detailed windows to the whole run
+            const double cpi = (double) sampledCycles / (double) sampledInsts;
+            const uint64_t estimate = (uint64_t) (cpi * (double) inst_count);
+            statEstimatedCycles->addData(estimate);
+
+            output->verbose(CALL_INFO, 1, 0, "Core %" PRIu32 " sampled %" PRIu64 " instructions in %" PRIu64 " windows, CPI=%f, estimated %" PRIu64 " cycles for %" PRIu64 " instructions\n",
+                coreID, sampledInsts, sampleWindows, cpi, estimate, inst_count);
+        } else {
+            output->verbose(CALL_INFO, 1, 0, "Core %" PRIu32 " did not complete a detailed sample window, no cycle estimate available\n", coreID);
+        }
+    }
+}
+
+void ArielCore::updateSampleWindow() {
+    const bool detail = (inst_count % sample_period) >= (sample_period - sample_detail);
+
+    if(detail == inDetailWindow) {
+        return;
+    }
+
+    if(detail) {
+        windowStartCycle = currentCycles;
+        windowStartInst = inst_count;
+    } else {
+        const uint64_t cycles = currentCycles - windowStartCycle;
+        const uint64_t insts = inst_count - windowStartInst;
+
+        statSampleWindowCycles->addData(cycles);
+        statSampleWindowInsts->addData(insts);
+        sampledCycles += cycles;
+        sampledInsts += insts;
+        sampleWindows++;
+    }
+
+    inDetailWindow = detail;
+}
+
+void ArielCore::fastForwardAccess(uint64_t addr) {
+    // Translating keeps page allocation in the same order as a full run,
+    // so detailed windows see the same physical addresses
+    translateAddress(addr);
+    statInstructionCount->addData(1);
+    statFastForwardInsts->addData(1);
+    inst_count++;
 }
 
 void ArielCore::halt(){
@@ -579,7 +813,7 @@ void ArielCore::setPhysicalAddresses(SST::Event *ev){
     uint64_t addr_offset;
     uint64_t current_transfer;
     current_transfer = (getRemainingTransfer() > 64) ? 64 : getRemainingTransfer();
-    phy_addr = memmgr->translateAddress(getCurrentAddress());
+    phy_addr = translateAddress(getCurrentAddress());
     addr_offset = phy_addr % ((uint64_t) cacheLineSize);
     if((addr_offset + current_transfer <= cacheLineSize)){
         physicalAddresses.push_back(phy_addr);
@@ -589,7 +823,7 @@ void ArielCore::setPhysicalAddresses(SST::Event *ev){
         uint64_t rightAddr = (getCurrentAddress() + ((uint64_t) cacheLineSize)) - addr_offset;
         uint64_t rightSize = current_transfer - leftSize;
         uint64_t physLeftAddr = phy_addr;
-        uint64_t physRightAddr = memmgr->translateAddress(rightAddr);
+        uint64_t physRightAddr = translateAddress(rightAddr);
         physicalAddresses.push_back(physLeftAddr);
     }
 }
@@ -660,6 +894,7 @@ void ArielCore::unfence()
 
 void ArielCore::handleSwitchPoolEvent(ArielSwitchPoolEvent* aSPE) {
     ARIEL_CORE_VERBOSE(2, output->verbose(CALL_INFO, 2, 0, "Core: %" PRIu32 " set default memory pool to: %" PRIu32 "\n", coreID, aSPE->getPool()));
+    std::unique_lock<std::mutex> lock = lockMemoryManager();
     memmgr->setDefaultPool(aSPE->getPool());
 }
 
@@ -834,6 +1069,168 @@ bool ArielCore::hasDrainCompleted() const {
         return false;
 }
 
+void ArielCore::recordInstructionClass(uint32_t instClass, uint32_t simdElemCount) {
+    if(ARIEL_INST_SP_FP == instClass) {
+            statFPSPIns->addData(1);
+
+            if(simdElemCount > 1) {
+                statFPSPSIMDIns->addData(1);
+            } else {
+                statFPSPScalarIns->addData(1);
+            }
+
+            if(simdElemCount < 32)
+                statFPSPOps->addData(simdElemCount);
+    } else if(ARIEL_INST_DP_FP == instClass) {
+            statFPDPIns->addData(1);
+
+            if(simdElemCount > 1) {
+                statFPDPSIMDIns->addData(1);
+            } else {
+                statFPDPScalarIns->addData(1);
+            }
+
+            if(simdElemCount < 16)
+                statFPDPOps->addData(simdElemCount);
+    }
+}
+
+void ArielCore::processBatch(const ArielCommand& ac) {
+    const uint8_t* data = ac.batch.data;
+    uint32_t pos = 0;
+    uint64_t addr = 0;
+
+    // Records are decoded in the order they were written, so an instruction
+    // may start in one batch and finish in the next
+    for(uint32_t i = 0; i < ac.batch.count; ++i) {
+        if(pos >= ac.batch.bytes) {
+            output->fatal(CALL_INFO, -1, "Error: Ariel batch on core %" PRIu32 " ended after %" PRIu32 " of %" PRIu32 " records.\n",
+                coreID, i, ac.batch.count);
+        }
+
+        const uint8_t op = data[pos] & 0x7;
+        const uint8_t field = data[pos] >> 3;
+        pos++;
+
+        switch(op) {
+            case ARIEL_BATCH_START:
+                {
+                    uint64_t simdElemCount;
+                    pos += arielBatchGetVarint(&data[pos], &simdElemCount);
+                    recordInstructionClass(field, (uint32_t) simdElemCount);
+                }
+                break;
+
+            case ARIEL_BATCH_READ:
+            case ARIEL_BATCH_WRITE:
+                {
+                    uint64_t size = field;
+                    if(0 == size) {
+                        pos += arielBatchGetVarint(&data[pos], &size);
+                    }
+
+                    uint64_t delta;
+                    pos += arielBatchGetVarint(&data[pos], &delta);
+                    addr += (uint64_t) arielBatchUnZigZag(delta);
+
+                    if(ARIEL_BATCH_READ == op) {
+                        createReadEvent(addr, (uint32_t) size);
+                    } else {
+                        createWriteEvent(addr, (uint32_t) size, NULL);
+                    }
+                }
+                break;
+
+            case ARIEL_BATCH_END:
+                break;
+
+            case ARIEL_BATCH_NOOP:
+                createNoOpEvent();
+                break;
+
+            default:
+                output->fatal(CALL_INFO, -1, "Error: Ariel did not understand batch record op (%d) on core %" PRIu32 ".\n",
+                    (int) op, coreID);
+                break;
+        }
+    }
+}
+
+bool ArielCore::readCommandNB(ArielCommand* ac) {
+#ifdef HAVE_LIBZ
+    if(NULL != commandReplay) {
+        if(!commandReplay->read(coreID, ac)) {
+            return false;
+        }
+    } else
+#endif
+    if(!tunnel->readMessageNB(coreID, ac)) {
+        return false;
+    }
+
+    if(writePayloads && ARIEL_PERFORM_WRITE == ac->command) {
+        readPayload(ac->inst.size);
+    }
+
+#ifdef HAVE_LIBZ
+    if(NULL != commandRecorder) {
+        commandRecorder->record(coreID, *ac, commandPayload.data());
+    }
+#endif
+    return true;
+}
+
+ArielCommand ArielCore::readCommand() {
+    ArielCommand ac;
+
+#ifdef HAVE_LIBZ
+    if(NULL != commandReplay) {
+        if(!commandReplay->read(coreID, &ac)) {
+            output->fatal(CALL_INFO, -1, "Error: command trace for core %" PRIu32 " ends in the middle of an instruction.\n", coreID);
+        }
+    } else
+#endif
+    ac = tunnel->readMessage(coreID);
+
+    if(writePayloads && ARIEL_PERFORM_WRITE == ac.command) {
+        readPayload(ac.inst.size);
+    }
+
+#ifdef HAVE_LIBZ
+    if(NULL != commandRecorder) {
+        commandRecorder->record(coreID, ac, commandPayload.data());
+    }
+#endif
+    return ac;
+}
+
+/* Take the payload of the write just read from the trace or the payload tunnel */
+void ArielCore::readPayload(uint32_t length) {
+    commandPayload.resize(length);
+
+#ifdef HAVE_LIBZ
+    if(NULL != commandReplay) {
+        memcpy(commandPayload.data(), commandReplay->getPayload(coreID), length);
+        return;
+    }
+#endif
+
+    uint32_t copied = 0;
+    while(copied < length) {
+        // The frontend sends an instruction's payload before its commands
+        if(payloadChunkPos == payloadChunk.bytes) {
+            payloadChunk = payloadTunnel->readMessage(coreID);
+            payloadChunkPos = 0;
+            continue;
+        }
+
+        const uint32_t count = std::min(length - copied, payloadChunk.bytes - payloadChunkPos);
+        memcpy(&commandPayload[copied], &payloadChunk.data[payloadChunkPos], count);
+        copied += count;
+        payloadChunkPos += count;
+    }
+}
+
 bool ArielCore::refillQueue() {
     ARIEL_CORE_VERBOSE(16, output->verbose(CALL_INFO, 16, 0, "Refilling event queue for core %" PRIu32 "...\n", coreID));
 
@@ -842,7 +1239,7 @@ bool ArielCore::refillQueue() {
                             coreID, (uint32_t) coreQ->size(), (uint32_t) maxQLength));
 
         ArielCommand ac;
-        const bool avail = tunnel->readMessageNB(coreID, &ac);
+        const bool avail = readCommandNB(&ac);
 
         if ( !avail ) {
                 ARIEL_CORE_VERBOSE(32, output->verbose(CALL_INFO, 32, 0, "Tunnel claims no data on core: %" PRIu32 "\n", coreID));
@@ -859,32 +1256,10 @@ bool ArielCore::refillQueue() {
                 break;
 
             case ARIEL_START_INSTRUCTION:
-                if(ARIEL_INST_SP_FP == ac.inst.instClass) {
-                        statFPSPIns->addData(1);
-
-                        if(ac.inst.simdElemCount > 1) {
-                            statFPSPSIMDIns->addData(1);
-                        } else {
-                            statFPSPScalarIns->addData(1);
-                        }
-
-                        if(ac.inst.simdElemCount < 32)
-                            statFPSPOps->addData(ac.inst.simdElemCount);
-                } else if(ARIEL_INST_DP_FP == ac.inst.instClass) {
-                        statFPDPIns->addData(1);
-
-                        if(ac.inst.simdElemCount > 1) {
-                            statFPDPSIMDIns->addData(1);
-                        } else {
-                            statFPDPScalarIns->addData(1);
-                        }
-
-                        if(ac.inst.simdElemCount < 16)
-                            statFPDPOps->addData(ac.inst.simdElemCount);
-                }
+                recordInstructionClass(ac.inst.instClass, ac.inst.simdElemCount);
 
                 while(ac.command != ARIEL_END_INSTRUCTION) {
-                        ac = tunnel->readMessage(coreID);
+                        ac = readCommand();
 
                         switch(ac.command) {
                             case ARIEL_PERFORM_READ:
@@ -892,7 +1267,7 @@ bool ArielCore::refillQueue() {
                                     break;
 
                             case ARIEL_PERFORM_WRITE:
-                                    createWriteEvent(ac.inst.addr, ac.inst.size, &ac.inst.payload[0]);
+                                    createWriteEvent(ac.inst.addr, ac.inst.size, writePayloads ? commandPayload.data() : NULL);
                                     break;
 
                             case ARIEL_END_INSTRUCTION:
@@ -910,6 +1285,10 @@ bool ArielCore::refillQueue() {
 
                 break;
 
+            case ARIEL_PERFORM_BATCH:
+                processBatch(ac);
+                break;
+
             case ARIEL_NOOP:
                 createNoOpEvent();
                 break;
@@ -965,6 +1344,7 @@ bool ArielCore::refillQueue() {
 void ArielCore::handleFreeEvent(ArielFreeEvent* rFE) {
     ARIEL_CORE_VERBOSE(4, output->verbose(CALL_INFO, 4, 0, "Core %" PRIu32 " processing a free event (for virtual address=%" PRIu64 ")\n", coreID, rFE->getVirtualAddress()));
 
+    std::unique_lock<std::mutex> lock = lockMemoryManager();
     memmgr->freeMalloc(rFE->getVirtualAddress());
 }
 
@@ -985,7 +1365,7 @@ void ArielCore::handleReadRequest(ArielReadEvent* rEv) {
     // There is a chance that the non-alignment causes an undetected bug if an access spans multiple malloc regions that are contiguous in VA space but non-contiguous in PA space.
     // However, a single access spanning multiple malloc'd regions shouldn't happen...
     // Addresses mapped via first touch are always line/page aligned
-    const uint64_t physAddr = memmgr->translateAddress(readAddress);
+    const uint64_t physAddr = translateAddress(readAddress);
     const uint64_t addr_offset  = physAddr % ((uint64_t) cacheLineSize);
 
     if((addr_offset + readLength) <= cacheLineSize) {
@@ -997,7 +1377,7 @@ void ArielCore::handleReadRequest(ArielReadEvent* rEv) {
         ARIEL_CORE_VERBOSE(4, output->verbose(CALL_INFO, 4, 0, "Core %" PRIu32 " issuing read, VAddr=%" PRIu64 ", Size=%" PRIu64 ", PhysAddr=%" PRIu64 "\n",
                             coreID, readAddress, readLength, physAddr));
 
-        commitReadEvent(physAddr, readAddress, (uint32_t) readLength);
+        issueRead(physAddr, readAddress, (uint32_t) readLength);
     } else {
         ARIEL_CORE_VERBOSE(4, output->verbose(CALL_INFO, 4, 0, "Core %" PRIu32 " generating a split read request: Addr=%" PRIu64 " Length=%" PRIu64 "\n",
                             coreID, readAddress, readLength));
@@ -1010,7 +1390,7 @@ void ArielCore::handleReadRequest(ArielReadEvent* rEv) {
         const uint64_t rightSize = readLength - leftSize;
 
         const uint64_t physLeftAddr = physAddr;
-        const uint64_t physRightAddr = memmgr->translateAddress(rightAddr);
+        const uint64_t physRightAddr = translateAddress(rightAddr);
 
         ARIEL_CORE_VERBOSE(4, output->verbose(CALL_INFO, 4, 0, "Core %" PRIu32 " issuing split-address read, LeftVAddr=%" PRIu64 ", RightVAddr=%" PRIu64 ", LeftSize=%" PRIu64 ", RightSize=%" PRIu64 ", LeftPhysAddr=%" PRIu64 ", RightPhysAddr=%" PRIu64 "\n",
                             coreID, leftAddr, rightAddr, leftSize, rightSize, physLeftAddr, physRightAddr));
@@ -1032,8 +1412,8 @@ void ArielCore::handleReadRequest(ArielReadEvent* rEv) {
                 }*/
         }
 
-        commitReadEvent(physLeftAddr, leftAddr, (uint32_t) leftSize);
-        commitReadEvent(physRightAddr, rightAddr, (uint32_t) rightSize);
+        issueRead(physLeftAddr, leftAddr, (uint32_t) leftSize);
+        issueRead(physRightAddr, rightAddr, (uint32_t) rightSize);
 
         statSplitReadRequests->addData(1);
     }
@@ -1046,6 +1426,29 @@ void ArielCore::handleWriteRequest(ArielWriteEvent* wEv) {
     ARIEL_CORE_VERBOSE(4, output->verbose(CALL_INFO, 4, 0, "Core %" PRIu32 " processing a write event...\n", coreID));
 
     const uint64_t writeAddress = wEv->getAddress();
+
+    // When payloads are traced, writes wider than a line (wide vector stores,
+    // xsave) are written line by line instead of trimmed so no data is lost
+    if( writePayloads && wEv->getLength() > cacheLineSize ) {
+        const uint64_t fullLength = wEv->getLength();
+        const uint8_t* payloadPtr = wEv->getPayload();
+
+        ARIEL_CORE_VERBOSE(4, output->verbose(CALL_INFO, 4, 0, "Core %" PRIu32 " generating a multi-line write request: Addr=%" PRIu64 " Length=%" PRIu64 "\n",
+                            coreID, writeAddress, fullLength));
+
+        for( uint64_t offset = 0; offset < fullLength; ) {
+            const uint64_t physAddr = translateAddress(writeAddress + offset);
+            const uint64_t size = std::min(fullLength - offset, cacheLineSize - (physAddr % cacheLineSize));
+            issueWrite(physAddr, writeAddress + offset, (uint32_t) size, &payloadPtr[offset]);
+            offset += size;
+        }
+
+        statSplitWriteRequests->addData(1);
+        statWriteRequests->addData(1);
+        statWriteRequestSizes->addData(fullLength);
+        return;
+    }
+
     const uint64_t writeLength  = std::min((uint64_t) wEv->getLength(), cacheLineSize); // Trim to cacheline size (occurs rarely for instructions such as xsave and fxsave)
 
     // No longer neccessary due to trimming above
@@ -1056,7 +1459,7 @@ void ArielCore::handleWriteRequest(ArielWriteEvent* wEv) {
     }*/
 
     // See note in handleReadRequest() on alignment issues
-    const uint64_t physAddr = memmgr->translateAddress(writeAddress);
+    const uint64_t physAddr = translateAddress(writeAddress);
     const uint64_t addr_offset  = physAddr % ((uint64_t) cacheLineSize);
 
     // We do not need to perform a split operation
@@ -1077,9 +1480,9 @@ void ArielCore::handleWriteRequest(ArielWriteEvent* wEv) {
 
         if( writePayloads ) {
             uint8_t* payloadPtr = wEv->getPayload();
-            commitWriteEvent(physAddr, writeAddress, (uint32_t) writeLength, payloadPtr);
+            issueWrite(physAddr, writeAddress, (uint32_t) writeLength, payloadPtr);
         } else {
-            commitWriteEvent(physAddr, writeAddress, (uint32_t) writeLength, NULL);
+            issueWrite(physAddr, writeAddress, (uint32_t) writeLength, NULL);
         }
     } else {
         ARIEL_CORE_VERBOSE(4, output->verbose(CALL_INFO, 4, 0, "Core %" PRIu32 " generating a split write request: Addr=%" PRIu64 " Length=%" PRIu64 "\n",
@@ -1093,7 +1496,7 @@ void ArielCore::handleWriteRequest(ArielWriteEvent* wEv) {
         const uint64_t rightSize = writeLength - leftSize;
 
         const uint64_t physLeftAddr = physAddr;
-        const uint64_t physRightAddr = memmgr->translateAddress(rightAddr);
+        const uint64_t physRightAddr = translateAddress(rightAddr);
 
         ARIEL_CORE_VERBOSE(4, output->verbose(CALL_INFO, 4, 0, "Core %" PRIu32 " issuing split-address write, LeftVAddr=%" PRIu64 ", RightVAddr=%" PRIu64 ", LeftSize=%" PRIu64 ", RightSize=%" PRIu64 ", LeftPhysAddr=%" PRIu64 ", RightPhysAddr=%" PRIu64 "\n",
                             coreID, leftAddr, rightAddr, leftSize, rightSize, physLeftAddr, physRightAddr));
@@ -1117,11 +1520,11 @@ void ArielCore::handleWriteRequest(ArielWriteEvent* wEv) {
 
         if( writePayloads ) {
             uint8_t* payloadPtr = wEv->getPayload();
-            commitWriteEvent(physLeftAddr, leftAddr, (uint32_t) leftSize, payloadPtr);
-            commitWriteEvent(physRightAddr, rightAddr, (uint32_t) rightSize, &payloadPtr[leftSize]);
+            issueWrite(physLeftAddr, leftAddr, (uint32_t) leftSize, payloadPtr);
+            issueWrite(physRightAddr, rightAddr, (uint32_t) rightSize, &payloadPtr[leftSize]);
         } else {
-            commitWriteEvent(physLeftAddr, leftAddr, (uint32_t) leftSize, NULL);
-            commitWriteEvent(physRightAddr, rightAddr, (uint32_t) rightSize, NULL);
+            issueWrite(physLeftAddr, leftAddr, (uint32_t) leftSize, NULL);
+            issueWrite(physRightAddr, rightAddr, (uint32_t) rightSize, NULL);
         }
         statSplitWriteRequests->addData(1);
     }
@@ -1133,6 +1536,7 @@ void ArielCore::handleWriteRequest(ArielWriteEvent* wEv) {
 
 
 void ArielCore::handleMmapEvent(ArielMmapEvent* aEv) {
+    std::unique_lock<std::mutex> lock = lockMemoryManager();
     memmgr->allocateMMAP(aEv->getAllocationLength(), aEv->getAllocationLevel(), aEv->getVirtualAddress(),
             aEv->getInstructionPointer(), aEv->getFileID(), coreID);
 }
@@ -1141,6 +1545,7 @@ void ArielCore::handleAllocationEvent(ArielAllocateEvent* aEv) {
     output->verbose(CALL_INFO, 2, 0, "Handling a memory allocation event, vAddr=%" PRIu64 ", length=%" PRIu64 ", at level=%" PRIu32 " with malloc ID=%" PRIu64 "\n",
                 aEv->getVirtualAddress(), aEv->getAllocationLength(), aEv->getAllocationLevel(), aEv->getInstructionPointer());
 
+    std::unique_lock<std::mutex> lock = lockMemoryManager();
     memmgr->allocateMalloc(aEv->getAllocationLength(), aEv->getAllocationLevel(), aEv->getVirtualAddress(), aEv->getInstructionPointer(), coreID);
 }
 
@@ -1148,7 +1553,8 @@ void ArielCore::handleFlushEvent(ArielFlushEvent *flEv) {
     const uint64_t virtualAddress = (uint64_t) flEv->getVirtualAddress();
     const uint64_t readLength = (uint64_t) flEv->getLength();
 
-    const uint64_t physAddr = memmgr->translateAddress(virtualAddress);
+    const uint64_t physAddr = translateAddress(virtualAddress);
+    drainCoalesced();
     commitFlushEvent(physAddr, virtualAddress, (uint32_t) readLength);
 }
 
@@ -1156,6 +1562,7 @@ void ArielCore::handleFenceEvent(ArielFenceEvent *fEv) {
     /*  Todo: Should we treat this like the Flush event, and require that the Fence
     *  be put into a transaction queue?  */
     // Possibility A:
+    drainCoalesced();
     fence();
     // Possibility B:
     // commitFenceEvent();
@@ -1163,8 +1570,10 @@ void ArielCore::handleFenceEvent(ArielFenceEvent *fEv) {
 }
 
 void ArielCore::handleRtlEvent(ArielRtlEvent* RtlEv) {
-    
+    drainCoalesced();
+
     RtlEv->set_cachelinesize(cacheLineSize);
+    std::unique_lock<std::mutex> lock = lockMemoryManager();
     memmgr->get_page_info(RtlEv->RtlData.pageTable, RtlEv->RtlData.freePages, RtlEv->RtlData.pageSize);
     memmgr->get_tlb_info(RtlEv->RtlData.translationCache, RtlEv->RtlData.translationCacheEntries, RtlEv->RtlData.translationEnabled);
     RtlLink->send(RtlEv);
@@ -1213,7 +1622,6 @@ void ArielCore::handleGpuEvent(ArielGpuEvent* gEv){
                         size_t page_transfer = (getTotalTransfer() <= (1<<12)) ? getTotalTransfer() : (1<<12);
                         data = (uint8_t *) malloc(sizeof(uint8_t) * page_transfer);
                         memcpy(data, gd.page_4k, page_transfer);
-                        tunnelD->clearBuffer(coreID);
 
                         setPageTransfer(page_transfer);
                         setRemainingPageTransfer(page_transfer);
@@ -1443,8 +1851,14 @@ bool ArielCore::processNextEvent() {
         case READ_ADDRESS:
                 ARIEL_CORE_VERBOSE(8, output->verbose(CALL_INFO, 8, 0, "Core %" PRIu32 " next event is READ_ADDRESS\n", coreID));
 
+                if(isFastForwarding() && !sample_warm_caches) {
+                    fastForwardAccess(dynamic_cast<ArielReadEvent*>(nextEvent)->getAddress());
+                    removeEvent = true;
+                    break;
+                }
+
                 //  if(pendingTransactions->size() < maxPendingTransactions) {
-                if(pending_transaction_count < maxPendingTransactions) {
+                if(pending_transaction_count + coalesceQueue.size() < maxPendingTransactions) {
                     ARIEL_CORE_VERBOSE(16, output->verbose(CALL_INFO, 16, 0, "Found a read event, fewer pending transactions than permitted so will process...\n"));
                     statInstructionCount->addData(1);
                     inst_count++;
@@ -1459,8 +1873,14 @@ bool ArielCore::processNextEvent() {
         case WRITE_ADDRESS:
                 ARIEL_CORE_VERBOSE(8, output->verbose(CALL_INFO, 8, 0, "Core %" PRIu32 " next event is WRITE_ADDRESS\n", coreID));
 
+                if(isFastForwarding() && !sample_warm_caches) {
+                    fastForwardAccess(dynamic_cast<ArielWriteEvent*>(nextEvent)->getAddress());
+                    removeEvent = true;
+                    break;
+                }
+
                 //  if(pendingTransactions->size() < maxPendingTransactions) {
-                if(pending_transaction_count < maxPendingTransactions) {
+                if(pending_transaction_count + coalesceQueue.size() < maxPendingTransactions) {
                     ARIEL_CORE_VERBOSE(16, output->verbose(CALL_INFO, 16, 0, "Found a write event, fewer pending transactions than permitted so will process...\n"));
                     statInstructionCount->addData(1);
                     inst_count++;
@@ -1509,13 +1929,14 @@ bool ArielCore::processNextEvent() {
         case CORE_EXIT:
                 ARIEL_CORE_VERBOSE(8, output->verbose(CALL_INFO, 8, 0, "Core %" PRIu32 " next event is CORE_EXIT\n", coreID));
                 isHalted = true;
+                drainCoalesced();
                 std::cout << "CORE ID: " << coreID << " PROCESSED AN EXIT EVENT" << std::endl;
                 output->verbose(CALL_INFO, 2, 0, "Core %" PRIu32 " has called exit.\n", coreID);
                 return true;
 
         case FLUSH:
                 ARIEL_CORE_VERBOSE(8, output->verbose(CALL_INFO, 8, 0, "Core %" PRIu32 " next event is a FLUSH\n", coreID));
-                if(pending_transaction_count < maxPendingTransactions) {
+                if(pending_transaction_count + coalesceQueue.size() < maxPendingTransactions) {
                     ARIEL_CORE_VERBOSE(16, output->verbose(CALL_INFO, 16, 0, "Found a FLUSH event, fewer pending transactions than permitted so will process..\n"));
                     statInstructionCount->addData(1);
                     inst_count++;
@@ -1555,6 +1976,10 @@ bool ArielCore::processNextEvent() {
                 break;
     }
 
+    if(sample_period != 0) {
+        updateSampleWindow();
+    }
+
     // If the event has actually been processed this cycle then remove it from the queue
     if(removeEvent) {
         ARIEL_CORE_VERBOSE(8, output->verbose(CALL_INFO, 8, 0, "Removing event from pending queue, there are %" PRIu32 " events in the queue before deletion.\n",
@@ -1574,6 +1999,8 @@ bool ArielCore::processNextEvent() {
 bool started=false;
 
 void ArielCore::tick() {
+    SST::HostProf::ScopedHandlerTimer profileTimer(profileTick);
+
     // todo: if the core is fenced, increment the current cycle counter
 
     if(!isHalted) {
@@ -1581,7 +2008,7 @@ void ArielCore::tick() {
         updateCycle = false;
 
         if(!isStalled) {
-                for(uint32_t i = 0; i < maxIssuePerCycle; ++i) {
+                for(uint32_t i = 0; i < (isFastForwarding() ? fastForwardIssuePerCycle : maxIssuePerCycle); ++i) {
                     bool didProcess = processNextEvent();
 
                     // If we didnt process anything in the call or we have halted then
@@ -1595,6 +2022,11 @@ void ArielCore::tick() {
                 }
         }
 
+        // Issue coalesced requests once they have waited out the window
+        while(!coalesceQueue.empty() && (currentCycles - coalesceQueue.front().cycle) >= coalesceCycles) {
+            issueCoalesced(1);
+        }
+
         currentCycles++;
         statCycles->addData(1);
 
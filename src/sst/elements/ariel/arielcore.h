@@ -32,8 +32,10 @@
 #include <poll.h>
 
 #include <string>
+#include <deque>
 #include <queue>
 #include <unordered_map>
+#include <mutex>
 
 #include "arielmemmgr.h"
 #include "arielevent.h"
@@ -49,8 +51,11 @@
 #include "arielrtlev.h"
 #include "tb_header.h"
 
+#include "sst/elements/hostprof/hostProfile.h"
+
 #include "ariel_shmem.h"
 #include "arieltracegen.h"
+#include "arielcmdtrace.h"
 
 #ifdef HAVE_CUDA
 #include "arielgpuev.h"
@@ -137,6 +142,12 @@ class ArielCore : public ComponentExtension {
       }
 
         void setCacheLink(StandardMem* newCacheLink);
+        void setTunnel(ArielTunnel* newTunnel);
+        void setPayloadTunnel(ArielPayloadTunnel* newPayloadTunnel);
+        // Read commands from a recorded trace instead of the tunnel, and/or record the commands read
+        void setCommandTrace(ArielCommandTraceReader* replay, ArielCommandTraceWriter* recorder);
+        // lock is held around memory manager calls if it is shared with other threads
+        void setMemoryManager(ArielMemoryManager* newMemMgr, std::mutex* lock);
         void createRtlEvent(void*, void*, void*, size_t, size_t, size_t);
         void setRtlLink(Link* rtllink);
 
@@ -184,6 +195,8 @@ class ArielCore : public ComponentExtension {
         void commitReadEvent(const uint64_t address, const uint64_t virtAddr, const uint32_t length);
         void commitWriteEvent(const uint64_t address, const uint64_t virtAddr, const uint32_t length, const uint8_t* payload);
         void commitFlushEvent(const uint64_t address, const uint64_t virtAddr, const uint32_t length);
+        void issueRead(const uint64_t address, const uint64_t virtAddr, const uint32_t length);
+        void issueWrite(const uint64_t address, const uint64_t virtAddr, const uint32_t length, const uint8_t* payload);
 
         // Setting the max number of instructions to be simulated
         void setMaxInsts(uint64_t i){max_insts=i;}
@@ -194,6 +207,19 @@ class ArielCore : public ComponentExtension {
     private:
         bool processNextEvent();
         bool refillQueue();
+        bool readCommandNB(ArielCommand* ac);
+        ArielCommand readCommand();
+        void readPayload(uint32_t length);
+        uint64_t translateAddress(uint64_t virtAddr);
+        std::unique_lock<std::mutex> lockMemoryManager();
+        void recordInstructionClass(uint32_t instClass, uint32_t simdElemCount);
+        void updateSampleWindow();
+        void fastForwardAccess(uint64_t addr);
+        bool isFastForwarding() const { return (sample_period != 0) && !inDetailWindow; }
+        void processBatch(const ArielCommand& ac);
+        void coalesceRequest(const bool isRead, const uint64_t address, const uint64_t virtAddr, const uint32_t length, const uint8_t* payload);
+        void issueCoalesced(size_t count);
+        void drainCoalesced();
         bool writePayloads;
         uint32_t coreID;
         uint32_t maxPendingTransactions;
@@ -224,6 +250,8 @@ class ArielCore : public ComponentExtension {
 
         StandardMem* cacheLink;
         ArielTunnel *tunnel;
+        ArielCommandTraceReader* commandReplay;
+        ArielCommandTraceWriter* commandRecorder;
         StdMemHandler* stdMemHandlers;
         Link* RtlLink;
 
@@ -235,11 +263,31 @@ class ArielCore : public ComponentExtension {
 #endif
 
         std::unordered_map<StandardMem::Request::id_t, StandardMem::Request*>* pendingTransactions;
+        // Write payloads, read alongside write commands when writePayloads is set
+        ArielPayloadTunnel* payloadTunnel;
+        ArielPayloadChunk payloadChunk;
+        uint32_t payloadChunkPos;
+        std::vector<uint8_t> commandPayload;    // Payload of the last write read
+
+        // A memory request to one line that later requests can still be merged into
+        struct CoalesceEntry {
+            bool isRead;
+            uint64_t line;
+            uint64_t start;         // Physical range [start, end) within the line
+            uint64_t end;
+            uint64_t virtOffset;    // Virtual address minus physical address
+            uint64_t cycle;         // Cycle the entry was opened
+            std::vector<uint8_t> payload;   // Whole line, only used for writes with payloads
+        };
+        std::deque<CoalesceEntry> coalesceQueue;
+        uint32_t coalesceEntries;
+        uint64_t coalesceCycles;
         uint32_t maxIssuePerCycle;
         uint32_t maxQLength;
         uint64_t cacheLineSize;
         void* rtl_inp_ptr = nullptr;
         ArielMemoryManager* memmgr;
+        std::mutex* memmgrLock;
         const uint32_t verbosity;
         const uint32_t perform_checks;
         bool enableTracing;
@@ -253,6 +301,19 @@ class ArielCore : public ComponentExtension {
         // This indicates the max number of instructions before halting the simulation
         uint64_t max_insts;
 
+        // Sampled simulation: the last sample_detail instructions of every
+        // sample_period are simulated in detail, the rest are fast-forwarded
+        uint64_t sample_period;
+        uint64_t sample_detail;
+        bool sample_warm_caches;
+        uint32_t fastForwardIssuePerCycle;
+        bool inDetailWindow;
+        uint64_t windowStartCycle;
+        uint64_t windowStartInst;
+        uint64_t sampledCycles;
+        uint64_t sampledInsts;
+        uint64_t sampleWindows;
+
         ArielTraceGenerator* traceGen;
 
         Statistic<uint64_t>* statReadRequests;
@@ -263,10 +324,17 @@ class ArielCore : public ComponentExtension {
         Statistic<uint64_t>* statWriteRequestSizes;
         Statistic<uint64_t>* statSplitReadRequests;
         Statistic<uint64_t>* statSplitWriteRequests;
+        Statistic<uint64_t>* statCoalescedReads;
+        Statistic<uint64_t>* statCoalescedWrites;
         Statistic<uint64_t>* statNoopCount;
         Statistic<uint64_t>* statInstructionCount;
         Statistic<uint64_t>* statCycles;
         Statistic<uint64_t>* statActiveCycles;
+        Statistic<uint64_t>* statFastForwardInsts;
+        Statistic<uint64_t>* statSampleWindowCycles;
+        Statistic<uint64_t>* statSampleWindowInsts;
+        Statistic<uint64_t>* statEstimatedCycles;
+        SST::HostProf::HandlerProfile profileTick;
 
         Statistic<uint64_t>* statFPDPIns;
         Statistic<uint64_t>* statFPDPSIMDIns;
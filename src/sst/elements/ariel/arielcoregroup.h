@@ -0,0 +1,81 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_ARIEL_CORE_GROUP
+#define _H_ARIEL_CORE_GROUP
+
+#include <stdint.h>
+
+#include <atomic>
+#include <map>
+#include <mutex>
+#include <string>
+
+#include "arielmemmgr.h"
+#include "ariel_shmem.h"
+
+namespace SST {
+namespace ArielComponent {
+
+class ArielCommandTraceReader;
+class ArielCommandTraceWriter;
+
+/*
+ * State shared by the ArielCPU components that split the cores of one
+ * traced application between them.  The leader (the component simulating
+ * core 0) launches the frontend and owns the memory manager; the others
+ * find it here by group name during init.  Components can sit on
+ * different threads of a rank, so memory manager calls go through
+ * memmgrLock and the end of the run is signalled through halted.
+ */
+class ArielCoreGroup {
+    public:
+        ArielCoreGroup() : tunnel(NULL), payloadTunnel(NULL), replay(NULL), recorder(NULL), memmgr(NULL), halted(false) {}
+
+        ArielTunnel* tunnel;
+        ArielPayloadTunnel* payloadTunnel;
+        ArielCommandTraceReader* replay;
+        ArielCommandTraceWriter* recorder;
+        ArielMemoryManager* memmgr;
+        std::mutex memmgrLock;
+        std::atomic<bool> halted;
+
+        bool hasLeader() const { return memmgr != NULL; }
+
+        /* Returns the group with this name, creating it on first use */
+        static ArielCoreGroup* get(const std::string& name) {
+            std::lock_guard<std::mutex> guard(registryLock());
+            ArielCoreGroup*& group = registry()[name];
+            if (group == NULL) group = new ArielCoreGroup();
+            return group;
+        }
+
+    private:
+        static std::map<std::string, ArielCoreGroup*>& registry() {
+            static std::map<std::string, ArielCoreGroup*> groups;
+            return groups;
+        }
+
+        static std::mutex& registryLock() {
+            static std::mutex lock;
+            return lock;
+        }
+};
+
+}
+}
+
+#endif
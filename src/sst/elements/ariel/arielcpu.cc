@@ -28,6 +28,10 @@
 
 using namespace SST::ArielComponent;
 
+static double secondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
 ArielCPU::ArielCPU(ComponentId_t id, Params& params) :
             Component(id) {
 
@@ -38,6 +42,26 @@ ArielCPU::ArielCPU(ComponentId_t id, Params& params) :
 
     core_count = (uint32_t) params.find<uint32_t>("corecount", 1);
 
+    // Core groups split one application's cores over several components
+    std::string groupName = params.find<std::string>("core_group", "");
+    uint32_t firstCore = 0;
+    uint32_t totalCores = core_count;
+    group = NULL;
+    groupLeader = true;
+    if (groupName != "") {
+        group = ArielCoreGroup::get(groupName);
+        firstCore = params.find<uint32_t>("core_group_first", 0);
+        totalCores = params.find<uint32_t>("core_group_total", core_count);
+        groupLeader = (firstCore == 0);
+
+        if (firstCore + core_count > totalCores) {
+            output->fatal(CALL_INFO, -1, "%s, Error: cores %" PRIu32 " to %" PRIu32 " are outside core group '%s', which has %" PRIu32 " cores (core_group_total)\n",
+                    getName().c_str(), firstCore, firstCore + core_count - 1, groupName.c_str(), totalCores);
+        }
+        output->verbose(CALL_INFO, 1, 0, "Simulating cores %" PRIu32 " to %" PRIu32 " of core group '%s'%s\n",
+                firstCore, firstCore + core_count - 1, groupName.c_str(), groupLeader ? " (leader)" : "");
+    }
+
     uint64_t max_insts = (uint64_t) params.find<uint64_t>("max_insts", 0);
 
     output->verbose(CALL_INFO, 1, 0, "Configuring for %" PRIu32 " cores...\n", core_count);
@@ -115,8 +139,14 @@ ArielCPU::ArielCPU(ComponentId_t id, Params& params) :
     free(level_buffer);
 /** End memory manager subcomponent parameter translation */
 
+    reportStartupTime = params.find<bool>("report_startup_time", false);
+    std::chrono::steady_clock::time_point phaseStart = std::chrono::steady_clock::now();
+
     std::string memorymanager = params.find<std::string>("memmgr", "ariel.MemoryManagerSimple");
-    if (NULL != (memmgr = loadUserSubComponent<ArielMemoryManager>("memmgr"))) {
+    if (!groupLeader) {
+        // Translations are shared by all the cores, so use the leader's memory manager
+        memmgr = NULL;
+    } else if (NULL != (memmgr = loadUserSubComponent<ArielMemoryManager>("memmgr"))) {
         output->verbose(CALL_INFO, 1, 0, "Loaded memory manager: %s\n", memmgr->getName().c_str());
     } else {
         // Warn about memory levels and the selected memory manager if needed
@@ -139,6 +169,9 @@ ArielCPU::ArielCPU(ComponentId_t id, Params& params) :
     uint64_t cacheLineSize       = (uint64_t) params.find<uint32_t>("cachelinesize", 64);
 
     int gpu_e = (uint32_t) params.find<uint32_t>("gpu_enabled", 0);
+    if (group && gpu_e == 1) {
+        output->fatal(CALL_INFO, -1, "%s, Error: gpu_enabled is not supported with core_group\n", getName().c_str());
+    }
 
 #ifdef HAVE_CUDA
     if(gpu_e == 1)
@@ -149,23 +182,72 @@ ArielCPU::ArielCPU(ComponentId_t id, Params& params) :
 
     /////////////////////////////////////////////////////////////////////////////////////
 
-    frontend = loadUserSubComponent<ArielFrontend>("frontend", ComponentInfo::SHARE_NONE, core_count, maxCoreQueueLen, memmgr->getDefaultPool());
-    if (!frontend) {
-        // ariel.frontend.pin points to pin3
-        frontend = loadAnonymousSubComponent<ArielFrontend>("ariel.frontend.pin", "frontend", 0, ComponentInfo::INSERT_STATS | ComponentInfo::SHARE_STATS,
-                params, core_count, maxCoreQueueLen, memmgr->getDefaultPool());
-    }
-    if (!frontend)
-        output->fatal(CALL_INFO, -1, "%s, Error: Loading frontend subcomponent failed. If Ariel was not built with Pin, user must supply a custom frontend in the input file.\n", getName().c_str());
+    startupMemmgrTime = secondsSince(phaseStart);
+    phaseStart = std::chrono::steady_clock::now();
+
+    // Only the group leader runs the application, sized for every core in the group
+    frontend = NULL;
+    tunnel = NULL;
+    payloadTunnel = NULL;
+    commandReplay = NULL;
+    commandRecorder = NULL;
+#ifdef HAVE_CUDA
+    tunnelR = NULL;
+    tunnelD = NULL;
+#endif
+    if (groupLeader) {
+        frontend = loadUserSubComponent<ArielFrontend>("frontend", ComponentInfo::SHARE_NONE, totalCores, maxCoreQueueLen, memmgr->getDefaultPool());
+        if (!frontend) {
+            // ariel.frontend.pin points to pin3
+            frontend = loadAnonymousSubComponent<ArielFrontend>("ariel.frontend.pin", "frontend", 0, ComponentInfo::INSERT_STATS | ComponentInfo::SHARE_STATS,
+                    params, totalCores, maxCoreQueueLen, memmgr->getDefaultPool());
+        }
+        if (!frontend)
+            output->fatal(CALL_INFO, -1, "%s, Error: Loading frontend subcomponent failed. If Ariel was not built with Pin, user must supply a custom frontend in the input file.\n", getName().c_str());
 
-    tunnel = frontend->getTunnel();
+        tunnel = frontend->getTunnel();
+        payloadTunnel = frontend->getPayloadTunnel();
+        commandReplay = frontend->getCommandTrace();
 #ifdef HAVE_CUDA
-    tunnelR = frontend->getReturnTunnel();
-    tunnelD = frontend->getDataTunnel();
+        tunnelR = frontend->getReturnTunnel();
+        tunnelD = frontend->getDataTunnel();
 #endif
 
+        std::string recordPath = params.find<std::string>("tunnel_record", "");
+        if (recordPath != "") {
+#ifdef HAVE_LIBZ
+            output->verbose(CALL_INFO, 1, 0, "Recording the commands read by each core to %s\n", recordPath.c_str());
+            commandRecorder = new ArielCommandTraceWriter(recordPath, totalCores, params.find<int>("writepayloadtrace", 0) != 0, output);
+#else
+            output->fatal(CALL_INFO, -1, "%s, Error: tunnel_record requires Ariel to be built with libz\n", getName().c_str());
+#endif
+        }
+
+        if (params.find<int>("writepayloadtrace", 0) != 0) {
+#ifdef HAVE_LIBZ
+            const bool replayPayloads = commandReplay && commandReplay->hasPayloads();
+#else
+            const bool replayPayloads = false;
+#endif
+            if (!payloadTunnel && !replayPayloads) {
+                output->fatal(CALL_INFO, -1, "%s, Error: writepayloadtrace is set but the frontend does not provide write payloads\n", getName().c_str());
+            }
+        }
+
+        if (group) {
+            group->tunnel = tunnel;
+            group->payloadTunnel = payloadTunnel;
+            group->replay = commandReplay;
+            group->recorder = commandRecorder;
+            group->memmgr = memmgr;
+        }
+    }
+
     /////////////////////////////////////////////////////////////////////////////////////
 
+    startupFrontendTime = secondsSince(phaseStart);
+    phaseStart = std::chrono::steady_clock::now();
+
     std::string cpu_clock = params.find<std::string>("clock", "1GHz");
     output->verbose(CALL_INFO, 1, 0, "Registering ArielCPU clock at %s\n", cpu_clock.c_str());
 
@@ -183,11 +265,21 @@ ArielCPU::ArielCPU(ComponentId_t id, Params& params) :
 #ifdef HAVE_CUDA
                  tunnelR, tunnelD,
 #endif
-                 i, maxPendingTransCore, output, maxIssuesPerCycle, maxCoreQueueLen,
-                 cacheLineSize, memmgr, perform_checks, params));
+                 firstCore + i, maxPendingTransCore, output, maxIssuesPerCycle, maxCoreQueueLen,
+                 cacheLineSize, group ? NULL : memmgr, perform_checks, params));
 
         // Set max number of instructions
         cpu_cores[i]->setMaxInsts(max_insts);
+
+        if (group && groupLeader) {
+            cpu_cores[i]->setMemoryManager(memmgr, &group->memmgrLock);
+        }
+        if (payloadTunnel) {
+            cpu_cores[i]->setPayloadTunnel(payloadTunnel);
+        }
+        if (commandReplay || commandRecorder) {
+            cpu_cores[i]->setCommandTrace(commandReplay, commandRecorder);
+        }
     }
 
     // Find all the components loaded into the "memory" slot
@@ -244,13 +336,51 @@ ArielCPU::ArielCPU(ComponentId_t id, Params& params) :
 
     stopTicking = true;
 
+    startupCoreTime = secondsSince(phaseStart);
+
     output->verbose(CALL_INFO, 1, 0, "Completed initialization of the Ariel CPU.\n");
     fflush(stdout);
 }
 
 void ArielCPU::init(unsigned int phase)
 {
-    frontend->init(phase);
+    if (phase == 0 && !groupLeader) {
+        // Every component has been constructed, so the leader has published the tunnel
+        if (!group->hasLeader()) {
+            output->fatal(CALL_INFO, -1, "%s, Error: core group has no leader (a component with core_group_first=0) on this rank\n", getName().c_str());
+        }
+        tunnel = group->tunnel;
+        payloadTunnel = group->payloadTunnel;
+        commandReplay = group->replay;
+        commandRecorder = group->recorder;
+        memmgr = group->memmgr;
+        for (uint32_t i = 0; i < core_count; i++) {
+            cpu_cores[i]->setTunnel(tunnel);
+            cpu_cores[i]->setPayloadTunnel(payloadTunnel);
+            cpu_cores[i]->setMemoryManager(memmgr, &group->memmgrLock);
+            if (commandReplay || commandRecorder) {
+                cpu_cores[i]->setCommandTrace(commandReplay, commandRecorder);
+            }
+        }
+    }
+
+    std::chrono::steady_clock::time_point phaseStart = std::chrono::steady_clock::now();
+
+    if (frontend) frontend->init(phase);
+
+    if (phase == 0) {
+        const double launchTime = secondsSince(phaseStart);
+        phaseStart = std::chrono::steady_clock::now();
+
+        // The memory manager may have built its page pools while the application launched
+        if (groupLeader && memmgr) memmgr->completeSetup();
+        const double pageSetupTime = secondsSince(phaseStart);
+
+        if (reportStartupTime) {
+            output->output("%s startup times: memory manager %.3fs, frontend %.3fs, cores %.3fs, launch/attach %.3fs, page setup wait %.3fs\n",
+                    getName().c_str(), startupMemmgrTime, startupFrontendTime, startupCoreTime, launchTime, pageSetupTime);
+        }
+    }
 
     for (uint32_t i = 0; i < core_count; i++) {
         cpu_to_cache_links[i]->init(phase);
@@ -269,16 +399,23 @@ void ArielCPU::finish() {
         cpu_cores[i]->printCoreStatistics();
     }
 
-    memmgr->printStats();
-    frontend->finish();
+    if (groupLeader) {
+        memmgr->printStats();
+        frontend->finish();
+#ifdef HAVE_LIBZ
+        if (commandRecorder) commandRecorder->close();
+#endif
+    }
 }
 
 bool ArielCPU::tick( SST::Cycle_t cycle) {
     stopTicking = false;
     output->verbose(CALL_INFO, 16, 0, "Main processor tick, will issue to individual cores...\n");
 
-    tunnel->updateTime(getCurrentSimTimeNano());
-    tunnel->incrementCycles();
+    if (groupLeader && tunnel) {
+        tunnel->updateTime(getCurrentSimTimeNano());
+        tunnel->incrementCycles();
+    }
 
     // Keep ticking unless one of the cores says it is time to stop.
     for(uint32_t i = 0; i < core_count; ++i) {
@@ -290,6 +427,15 @@ bool ArielCPU::tick( SST::Cycle_t cycle) {
         }
     }
 
+    // Only core 0 sees the application exit, so the leader tells the rest of the group
+    if (group) {
+        if (stopTicking) {
+            group->halted = true;
+        } else if (group->halted) {
+            stopTicking = true;
+        }
+    }
+
     // Its time to end, that's all folks
     if(stopTicking) {
         primaryComponentOKToEndSim();
@@ -306,5 +452,8 @@ void ArielCPU::emergencyShutdown() {
         cpu_cores[i]->finishCore();
     }
 
-    frontend->emergencyShutdown();
+    if (frontend) frontend->emergencyShutdown();
+#ifdef HAVE_LIBZ
+    if (groupLeader && commandRecorder) commandRecorder->close();
+#endif
 }
@@ -24,6 +24,7 @@
 #include <stdint.h>
 #include <unistd.h>
 
+#include <chrono>
 #include <string>
 #include <map>
 
@@ -31,6 +32,7 @@
 #include "arielcore.h"
 #include "arielfrontend.h"
 #include "ariel_shmem.h"
+#include "arielcoregroup.h"
 
 namespace SST {
 namespace ArielComponent {
@@ -47,6 +49,9 @@ class ArielCPU : public SST::Component {
         {"verbose", "Verbosity for debugging. Increased numbers for increased verbosity.", "0"},
         {"profilefunctions", "Profile functions for Ariel execution, 0 = none, >0 = enable", "0" },
         {"corecount", "Number of CPU cores to emulate", "1"},
+        {"core_group", "Name of a core group to simulate part of. The application's cores are split across the components in a group, which can then be placed on different threads. Empty to simulate every core here", ""},
+        {"core_group_first", "Index of this component's first core within its core group. The component with index 0 is the leader, which launches the application and owns the memory manager", "0"},
+        {"core_group_total", "Total number of cores in the core group, set on the leader", "corecount"},
         {"checkaddresses", "Verify that addresses are valid with respect to cache lines", "0"},
         {"maxissuepercycle", "Maximum number of requests to issue per cycle, per core", "1"},
         {"maxcorequeue", "Maximum queue depth per core", "64"},
@@ -67,6 +72,9 @@ class ArielCPU : public SST::Component {
         {"mpilauncher", "Specify a launcher to be used for MPI executables in conjuction with <launcher>", STRINGIZE(MPILAUNCHER_EXECUTABLE)},
         {"mpiranks", "Number of ranks to be launched by <mpilauncher>. Only <mpitracerank> will be traced by <launcher>.", "1" },
         {"mpitracerank", "Rank to be traced by <launcher>.", "0" },
+        {"mpitraceranks", "Comma separated list of all ranks to trace, each by its own ArielCPU which may live on another SST rank. Every one of them sets the same list and its own entry as <mpitracerank>. The first rank in the list runs <mpilauncher>. Empty traces only <mpitracerank>.", "" },
+        {"mpirendezvous", "Directory shared by all ArielCPUs of <mpitraceranks> through which they hand their PIN command to the one running <mpilauncher>.", "ariel-mpi" },
+        {"mpidilation", "Let untraced ranks run only 1/<mpidilation> of the time so they keep pace with the ranks under PIN. 1 runs them natively.", "1" },
         {"envparamcount", "Number of environment parameters to supply to the Ariel executable, default=-1 (use SST environment)", "-1"},
         {"envparamname%(envparamcount)d", "Sets the environment parameter name", ""},
         {"envparamval%(envparamcount)d", "Sets the environment parameter value", ""},
@@ -80,8 +88,18 @@ class ArielCPU : public SST::Component {
         {"clock", "Clock rate at which events are generated and processed", "1GHz"},
         {"tracegen", "Select the trace generator for Ariel (which records traced memory operations", ""},
         {"memmgr", "Memory manager to use for address translation", "ariel.MemoryManagerSimple"},
-        {"writepayloadtrace", "Trace write payloads and put real memory contents into the memory system", "0"},
+        {"writepayloadtrace", "Trace write payloads and put real memory contents into the memory system. Payloads are sent on a separate tunnel and cover the whole store", "0"},
+        {"tunnel_record", "Record the commands each core reads from the frontend to this file, so the run can be replayed with ariel.frontend.replay. Requires libz", ""},
+        {"report_startup_time", "Print the wall clock time spent in each startup phase (memory manager, frontend, cores, application launch, page setup)", "0"},
+        {"tunnelbatching", "Pack instruction records into batched tunnel messages to reduce tunnel traffic (pin3 frontend). Ignored if writepayloadtrace is set", "0"},
         {"instrument_instructions", "turn on or off instruction instrumentation in fesimple", "1"},
+        {"coalesce_entries", "Number of line requests per core held open so later reads/writes to the same line can be merged into them. 0 disables coalescing", "0"},
+        {"coalesce_cycles", "Number of cycles a coalescing entry stays open before it is issued (entries are also issued when the window is full and at fences)", "0"},
+        {"sample_period", "Enable sampled simulation with windows every sample_period instructions per core. 0 simulates every instruction in detail", "0"},
+        {"sample_detail", "Number of instructions at the end of each sample period to simulate in detail", "0"},
+        {"sample_fastforward", "How to handle memory operations outside the detailed windows: 'skip' only translates addresses, 'warm' still sends them to the memory system to keep the caches warm", "skip"},
+        {"host_profile", "Measure the host time each core spends in its clock tick and report it in the host_* statistics", "0"},
+        {"sample_ffwd_issue", "Maximum number of events to process per cycle, per core, outside the detailed windows", "64"},
         {"gpu_enabled", "If enabled, gpu links will be set up", "0"})
 
     SST_ELI_DOCUMENT_PORTS( {"cache_link_%(corecount)d", "Each core's link to its cache", {}},
@@ -96,6 +114,8 @@ class ArielCPU : public SST::Component {
         { "write_request_sizes",  "Statistic for size of write requests", "bytes", 1},
         { "split_read_requests",  "Statistic counts number of split read requests (requests which come from multiple lines)", "requests", 1},
         { "split_write_requests", "Statistic counts number of split write requests (requests which are split over multiple lines)", "requests", 1},
+        { "coalesced_read_requests",  "Statistic counts line read requests merged into an earlier request to the same line", "requests", 1},
+        { "coalesced_write_requests", "Statistic counts line write requests merged into an earlier request to the same line", "requests", 1},
         { "no_ops",               "Statistic counts instructions which do not execute a memory operation", "instructions", 1},
 	    { "flush_requests",       "Statistic counts instructions which perform flushes", "requests", 1},
 	    { "fence_requests",       "Statistic counts instructions which perform fences", "requests", 1},
@@ -110,7 +130,13 @@ class ArielCPU : public SST::Component {
         { "fp_sp_scalar_ins",     "Statistic for counting SP-FP Non-SIMD instructons", "instructions", 1 },
         { "fp_sp_ops",            "Statistic for counting SP-FP operations (inst * SIMD width)", "instructions", 1 },
         { "cycles",               "Statistic for counting cycles of the Ariel core.", "cycles", 1 },
-        { "active_cycles",        "Statistic for counting active cycles (cycles not idle) of the Ariel core.", "cycles", 1 })
+        { "active_cycles",        "Statistic for counting active cycles (cycles not idle) of the Ariel core.", "cycles", 1 },
+        { "ffwd_instructions",    "Statistic for counting memory instructions skipped outside the detailed sample windows", "instructions", 1 },
+        { "sample_window_cycles", "Cycles taken by each detailed sample window", "cycles", 1 },
+        { "sample_window_instructions", "Instructions in each detailed sample window", "instructions", 1 },
+        { "estimated_cycles",     "Cycles for the whole run, extrapolated from the CPI of the detailed sample windows", "cycles", 1 },
+        { "host_ns_clock",        "With host_profile, host nanoseconds spent in the core's clock tick", "ns", 1 },
+        { "host_events_clock",    "With host_profile, number of clock ticks of the core", "count", 1 })
 
     SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
             {"memmgr", "Memory manager to translate virtual addresses to physical, handle malloc/free, etc.", "SST::ArielComponent::ArielMemoryManager"},
@@ -139,8 +165,21 @@ class ArielCPU : public SST::Component {
 
         ArielFrontend* frontend;
         ArielTunnel* tunnel;
+        ArielPayloadTunnel* payloadTunnel;
         bool stopTicking;
 
+        ArielCoreGroup* group;
+        bool groupLeader;
+
+        ArielCommandTraceReader* commandReplay;
+        ArielCommandTraceWriter* commandRecorder;
+
+        // Wall clock seconds spent in each constructor phase
+        bool reportStartupTime;
+        double startupMemmgrTime;
+        double startupFrontendTime;
+        double startupCoreTime;
+
 #ifdef HAVE_CUDA
         GpuReturnTunnel* tunnelR;
         GpuDataTunnel* tunnelD;
@@ -30,6 +30,8 @@
 namespace SST {
 namespace ArielComponent {
 
+class ArielCommandTraceReader;
+
 #define STRINGIZE(input) #input
 
 /** ArielFrontend is a generic interface for
@@ -48,6 +50,12 @@ public:
 
     virtual ArielTunnel* getTunnel() = 0;
 
+    /** Frontends that replay a recorded command trace return it here, and may return no tunnel */
+    virtual ArielCommandTraceReader* getCommandTrace() { return nullptr; }
+
+    /** Tunnel carrying write payloads, if the frontend traces them */
+    virtual ArielPayloadTunnel* getPayloadTunnel() { return nullptr; }
+
 #ifdef HAVE_CUDA
     virtual GpuDataTunnel* getDataTunnel() { return nullptr; }
     virtual GpuReturnTunnel* getReturnTunnel() { return nullptr; }
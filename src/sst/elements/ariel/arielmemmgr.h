@@ -86,6 +86,9 @@ class ArielMemoryManager : public SubComponent {
         /** Print statistics: TODO move statistics to Statistics API */
         virtual void printStats() {};
 
+        /** Finish any setup started in the background during construction, called before the first translation */
+        virtual void completeSetup() { }
+
         class InterruptHandlerBase {
             public:
                 virtual bool operator()(InterruptAction) = 0;
@@ -22,10 +22,13 @@
 
 #include <stdint.h>
 #include <deque>
+#include <functional>
+#include <thread>
 #include <vector>
 #include <unordered_map>
 
 #include "arielmemmgr.h"
+#include "arielpagetable.h"
 
 using namespace SST;
 using namespace SST::RNG;
@@ -47,7 +50,8 @@ class ArielMemoryManagerCache : public ArielMemoryManager{
     #define ARIEL_ELI_MEMMGR_CACHE_PARAMS {"verbose", "Verbosity for debugging. Increased numbers for increased verbosity.", "0"},\
         {"vtop_translate",  "Set to yes to perform virt-phys translation (TLB) or no to disable", "yes"},\
         {"pagemappolicy",   "Select the page mapping policy for Ariel [LINEAR|RANDOMIZED]", "LINEAR"},\
-        {"translatecacheentries", "Keep a translation cache of this many entries to improve emulated core performance", "4096"}
+        {"translatecacheentries", "Keep a translation cache of this many entries to improve emulated core performance", "4096"},\
+        {"background_setup", "Build free page pools and populate page tables on background threads while the frontend starts", "1"}
 
     #define ARIEL_ELI_MEMMGR_CACHE_STATS { "tlb_hits", "Hits in the simple Ariel TLB", "hits", 2 },\
         { "tlb_evicts",           "Number of evictions in the simple Ariel TLB", "evictions", 2 },\
@@ -82,16 +86,27 @@ class ArielMemoryManagerCache : public ArielMemoryManager{
             output->fatal(CALL_INFO, -8, "Ariel memory manager - unknown page mapping policy \"%s\"\n", mappingPolicy.c_str());
             }
 
-            // Set up translation cache
-            translationCache = new std::unordered_map<uint64_t, uint64_t>();
+            // Set up translation cache, subclasses call translationCache.init() once their page sizes are known
             translationCacheEntries = (uint32_t) params.find<uint32_t>("translatecacheentries", 4096);
 
+            backgroundSetup = params.find<bool>("background_setup", true);
+
             /* Statistics used by all memory managers; managers may also have their own */
         } // End constructor
 
         ~ArielMemoryManagerCache() {};
+
+        void completeSetup() override {
+            for (size_t i = 0; i < setupThreads.size(); i++) {
+                setupThreads[i].join();
+            }
+            setupThreads.clear();
+        }
         void get_tlb_info(std::unordered_map<uint64_t, uint64_t>* translationcache, uint32_t& translationcacheentries, bool& translationenabled) {
-            memcpy((void*)translationcache, (void*)translationCache, sizeof(*translationCache));
+            translationcache->clear();
+            translationCache.forEach([translationcache](uint64_t virtBase, uint64_t physBase) {
+                (*translationcache)[virtBase] = physBase;
+            });
             translationcacheentries = translationCacheEntries;
             translationenabled = translationEnabled;
 
@@ -106,11 +121,24 @@ class ArielMemoryManagerCache : public ArielMemoryManager{
         Statistic<uint64_t>* statTranslationShootdown;
         Statistic<uint64_t>* statPageAllocationCount;
 
-        std::unordered_map<uint64_t, uint64_t>* translationCache;
+        ArielTranslationCache translationCache;
         uint32_t translationCacheEntries;
         bool translationEnabled;
         ArielPageMappingPolicy mapPolicy;
 
+        /* Run part of the constructor's work on its own thread if background setup is enabled.
+         * Tasks must not share state with each other or with the rest of the constructor. */
+        void deferSetup(const std::function<void()>& task) {
+            if (backgroundSetup) {
+                setupThreads.push_back(std::thread(task));
+            } else {
+                task();
+            }
+        }
+
+        bool backgroundSetup;
+        std::vector<std::thread> setupThreads;
+
         void mapPagesLinear(uint64_t pageCount, uint64_t pageSize, uint64_t startAddr, std::deque<uint64_t>* freePagePool) {
             output->verbose(CALL_INFO, 2, 0, "Page mapping policy is LINEAR map...\n");
             uint64_t nextMemoryAddress = startAddr;
@@ -153,10 +181,14 @@ class ArielMemoryManagerCache : public ArielMemoryManager{
             }
         }
 
-        void populatePageTable(std::string popFilePath, std::unordered_map<uint64_t, uint64_t> * pageTable, std::deque<uint64_t>* freePagePool, uint64_t pageSize) {
+        void populatePageTable(std::string popFilePath, ArielPageTable* pageTable, std::deque<uint64_t>* freePagePool, uint64_t pageSize) {
             FILE * popFile = fopen(popFilePath.c_str(), "rt");
             uint64_t pinAddr = 0;
 
+            if (NULL == popFile) {
+                output->fatal(CALL_INFO, -1, "Unable to open page populate file %s\n", popFilePath.c_str());
+            }
+
             while( ! feof(popFile) ) {
                 if (EOF == fscanf(popFile, "%" PRIu64 "\n", &pinAddr)) {
                     break;
@@ -177,21 +209,29 @@ class ArielMemoryManagerCache : public ArielMemoryManager{
                 output->verbose(CALL_INFO, 4, 0, "Pinning address %" PRIu64 " (physical=%" PRIu64 "\n",
                             pinAddr, freePhysical);
 
-                pageTable->insert( std::pair<uint64_t, uint64_t>( pinAddr, freePhysical ) );
+                pageTable->insert( pinAddr, freePhysical );
             }
 
             fclose(popFile);
         }
 
-        void cacheTranslation(uint64_t virtualA, uint64_t physicalA) {
-            // Remove the oldest entry if we do not have enough slots TODO is begin() really the oldest...?
-            if(translationCache->size() == translationCacheEntries) {
-            statTranslationCacheEvict->addData(1);
-            translationCache->erase(translationCache->begin());
+        /* Cache the translation of [virtualBase, virtualLimit) to physicalBase, which contains virtualA */
+        void cacheTranslation(uint64_t virtualA, uint64_t virtualBase, uint64_t virtualLimit, uint64_t physicalBase) {
+            if (translationCache.insert(virtualA, virtualBase, virtualLimit, physicalBase)) {
+                statTranslationCacheEvict->addData(1);
             }
+        }
 
-            // Insert the translated entry into the cache
-            translationCache->insert(std::pair<uint64_t, uint64_t>(virtualA, physicalA));
+        /* Drop cached translations overlapping [virtualBase, virtualLimit), needed whenever a mapping is
+         * removed or shadowed.  Unless precise is set (no cached range spans more than one granule) the
+         * whole cache is flushed */
+        void shootdownTranslations(uint64_t virtualBase, uint64_t virtualLimit, bool precise) {
+            statTranslationShootdown->addData(1);
+            if (precise) {
+                translationCache.invalidate(virtualBase, virtualLimit);
+            } else {
+                translationCache.flush();
+            }
         }
 
 };
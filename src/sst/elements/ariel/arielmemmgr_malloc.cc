@@ -16,6 +16,8 @@
 #include <sst_config.h>
 #include <stdio.h>
 
+#include <algorithm>
+
 #include "arielmemmgr_malloc.h"
 
 using namespace SST::ArielComponent;
@@ -33,10 +35,9 @@ ArielMemoryManagerMalloc::ArielMemoryManagerMalloc(ComponentId_t id, Params& par
 
     // PageAllocation and PageTable structures
     pageAllocations = (std::unordered_map<uint64_t, uint64_t>**) malloc(sizeof(std::unordered_map<uint64_t, uint64_t>*) * memoryLevels);
-    pageTables = (std::unordered_map<uint64_t, uint64_t>**) malloc(sizeof(std::unordered_map<uint64_t, uint64_t>*) * memoryLevels);
+    pageTables = (ArielPageTable**) malloc(sizeof(ArielPageTable*) * memoryLevels);
     for (uint32_t i = 0; i <memoryLevels; ++i) {
         pageAllocations[i] = new std::unordered_map<uint64_t, uint64_t>();
-        pageTables[i] = new std::unordered_map<uint64_t, uint64_t>();
     }
 
     // Initialize data structures
@@ -48,31 +49,36 @@ ArielMemoryManagerMalloc::ArielMemoryManagerMalloc(ComponentId_t id, Params& par
         snprintf(level_buffer, level_buffer_size, "pagesize%" PRIu32, i);
         pageSizes[i] = (uint64_t) params.find<uint64_t>(level_buffer, 4096);
         output->verbose(CALL_INFO, 2, 0, "Level %" PRIu32 " page size is %" PRIu64 "\n", i, pageSizes[i]);
+        pageTables[i] = new ArielPageTable(pageSizes[i]);
 
         // Page count
         snprintf(level_buffer, level_buffer_size, "pagecount%" PRIu32, i);
         uint64_t pageCount = (uint64_t) params.find<uint64_t>(level_buffer, 131072);
         output->verbose(CALL_INFO, 2, 0, "Level %" PRIu32 " page count is %" PRIu64 "\n", i, pageCount);
 
-        // Configure page pool
+        // Configure page pool and populate page table if needed.  Levels are
+        // independent, so each one is built by its own task, completed by
+        // completeSetup() before the first translation
         freePages[i] = new std::deque<uint64_t>();
 
-        if (ArielPageMappingPolicy::LINEAR == mapPolicy) {
-            mapPagesLinear(pageCount, pageSizes[i], nextMemoryAddress, freePages[i]);
-        } else {
-            mapPagesRandom(pageCount, pageSizes[i], nextMemoryAddress, freePages[i]);
-        }
-        nextMemoryAddress += pageCount * pageSizes[i];
-
-        output->verbose(CALL_INFO, 2, 0, "Level %" PRIu32 " usable (free) page queue contains %" PRIu32 " entries\n", i, (uint32_t) freePages[i]->size());
-
-        // Populate page table if needed
         snprintf(level_buffer, level_buffer_size, "page_populate_%" PRIu32, i);
         std::string popFilePath = params.find<std::string>(level_buffer, "");
-        if (popFilePath != "") {
-            output->verbose(CALL_INFO, 1, 0, "Populating page tables for level %" PRIu32 " from %s...\n", i, popFilePath.c_str());
-            populatePageTable(popFilePath, pageTables[i], freePages[i], pageSizes[i]);
-        }
+
+        deferSetup([this, i, pageCount, nextMemoryAddress, popFilePath]() {
+            if (ArielPageMappingPolicy::LINEAR == mapPolicy) {
+                mapPagesLinear(pageCount, pageSizes[i], nextMemoryAddress, freePages[i]);
+            } else {
+                mapPagesRandom(pageCount, pageSizes[i], nextMemoryAddress, freePages[i]);
+            }
+
+            output->verbose(CALL_INFO, 2, 0, "Level %" PRIu32 " usable (free) page queue contains %" PRIu32 " entries\n", i, (uint32_t) freePages[i]->size());
+
+            if (popFilePath != "") {
+                output->verbose(CALL_INFO, 1, 0, "Populating page tables for level %" PRIu32 " from %s...\n", i, popFilePath.c_str());
+                populatePageTable(popFilePath, pageTables[i], freePages[i], pageSizes[i]);
+            }
+        });
+        nextMemoryAddress += pageCount * pageSizes[i];
 
         /* Register statistics per pool */
         snprintf(level_buffer, level_buffer_size, "mempool_%" PRIu32, i);
@@ -82,9 +88,21 @@ ArielMemoryManagerMalloc::ArielMemoryManagerMalloc(ComponentId_t id, Params& par
     }
 
     free(level_buffer);
+
+    // The translation cache can only invalidate a range precisely if every
+    // cached translation fits in one of its granules
+    uint64_t minPageSize = pageSizes[0];
+    uniformPageSize = true;
+    for (uint32_t i = 1; i < memoryLevels; ++i) {
+        minPageSize = std::min(minPageSize, pageSizes[i]);
+        if (pageSizes[i] != pageSizes[0]) uniformPageSize = false;
+    }
+    translationCache.init(translationCacheEntries, minPageSize);
 }
 
 ArielMemoryManagerMalloc::~ArielMemoryManagerMalloc() {
+    // Setup tasks use this class's members
+    completeSetup();
 }
 
 
@@ -148,7 +166,7 @@ void ArielMemoryManagerMalloc::allocate(const uint64_t size, const uint32_t leve
         const uint64_t nextPhysPage = freePages[level]->front();
         freePages[level]->pop_front();
 
-        pageTables[level]->insert( std::pair<uint64_t, uint64_t>(nextVirtPage, nextPhysPage) );
+        pageTables[level]->insert(nextVirtPage, nextPhysPage);
 
         output->verbose(CALL_INFO, 4, 0, "Allocating memory page, physical page=%" PRIu64 ", virtual page=%" PRIu64 "\n",
                 nextPhysPage, nextVirtPage);
@@ -177,16 +195,11 @@ bool ArielMemoryManagerMalloc::allocateMalloc(const uint64_t size, const uint32_
     output->verbose(CALL_INFO, 4, 0, "Allocate malloc received. VA: %" PRIu64 ". Size: %" PRIu64 ". Level: %" PRIu32 ".\n", virtualAddress, size, level);
 
     // Check whether a malloc mapping already exists (i.e., we missed a free)
-    std::map<uint64_t, uint64_t>::iterator it = mallocTranslations.upper_bound(virtualAddress);
-    if (it == mallocTranslations.begin()) it = mallocTranslations.end();
-    else if (!mallocTranslations.empty()) it--;
-
-    if (it != mallocTranslations.end() && it->first <= virtualAddress) {
-        uint64_t primaryAddr = mallocPrimaryVAMap.find(it->first)->second;
-        if (virtualAddress < primaryAddr + (mallocInformation.find(primaryAddr)->second).size) {
-            output->verbose(CALL_INFO, 4, 0, "Found conflicting malloc, freeing address %" PRIu64 "\n", primaryAddr);
-            freeMalloc(primaryAddr);
-        }
+    MallocMap::iterator it = findMalloc(virtualAddress);
+    if (it != mallocRegions.end()) {
+        const uint64_t primaryAddr = it->first;
+        output->verbose(CALL_INFO, 4, 0, "Found conflicting malloc, freeing address %" PRIu64 "\n", primaryAddr);
+        freeMalloc(primaryAddr);
     }
 
     // Allocate new page(s). Round malloc to nearest whole page TODO fix so we can map partial pages -> needs a local VA->Ariel_VA mapping
@@ -200,24 +213,18 @@ bool ArielMemoryManagerMalloc::allocateMalloc(const uint64_t size, const uint32_
     }
 
     // Allocate the pages
-    std::unordered_set<uint64_t>* virtualPages = new std::unordered_set<uint64_t>;
-    uint64_t nextVirtPage = virtualAddress;
-    uint64_t firstPhysAddr, lastPhysAddr;
-    firstPhysAddr = freePages[level]->front();
+    mallocInfo& info = mallocRegions.insert(std::make_pair(virtualAddress, mallocInfo(size, level))).first->second;
+    info.physPages.reserve(pageCount);
     for (uint64_t i = 0; i != pageCount; i++) {
-        uint64_t nextPhysPage = freePages[level]->front();
-        mallocTranslations.insert(std::make_pair(nextVirtPage, nextPhysPage));
-        mallocPrimaryVAMap.insert(std::make_pair(nextVirtPage, virtualAddress));
+        info.physPages.push_back(freePages[level]->front());
         freePages[level]->pop_front();
-        virtualPages->insert(nextVirtPage);
-        nextVirtPage += pageSizes[level];
-        lastPhysAddr = nextPhysPage;
     }
 
-    output->verbose(CALL_INFO, 4, 0, "Malloc mapped %" PRIu64 " to [%" PRIu64 ", %" PRIu64 "] (%" PRIu64 " pages).\n", virtualAddress, firstPhysAddr, lastPhysAddr, pageCount);
+    output->verbose(CALL_INFO, 4, 0, "Malloc mapped %" PRIu64 " to [%" PRIu64 ", %" PRIu64 "] (%" PRIu64 " pages).\n", virtualAddress,
+        pageCount ? info.physPages.front() : 0, pageCount ? info.physPages.back() : 0, pageCount);
 
-    // Record malloc
-    mallocInformation.insert(std::make_pair(virtualAddress, mallocInfo(size, level, virtualPages)));
+    // Cached demand page translations may cover part of the new region
+    shootdownTranslations(virtualAddress, virtualAddress + size, uniformPageSize);
 
     statBytesAlloc[level]->addData(size);
     return true;
@@ -227,23 +234,31 @@ bool ArielMemoryManagerMalloc::allocateMalloc(const uint64_t size, const uint32_
 void ArielMemoryManagerMalloc::freeMalloc(const uint64_t virtualAddress) {
     output->verbose(CALL_INFO, 4, 0, "Freeing %" PRIu64 "\n", virtualAddress);
 
-    // Lookup VA in mallocInformation
-    std::map<uint64_t, mallocInfo>::iterator it = mallocInformation.find(virtualAddress);
-    if (it == mallocInformation.end()) return;
+    // Lookup VA in mallocRegions
+    MallocMap::iterator it = mallocRegions.find(virtualAddress);
+    if (it == mallocRegions.end()) return;
 
     statBytesFree[it->second.level]->addData(it->second.size);
 
-    // Free each VA in mallocInformation from mallocTranslations & mallocPrimaryVAMap TODO fix so that mapping stays but address is available for future mallocs
-    std::unordered_set<uint64_t>* myKeys = (it->second.VAKeys);
-    for (std::unordered_set<uint64_t>::iterator vaIt = myKeys->begin(); vaIt != myKeys->end(); vaIt++) {
-        mallocPrimaryVAMap.erase(*vaIt);
-        freePages[(it->second).level]->push_front(mallocTranslations.find(*vaIt)->second);
-        mallocTranslations.erase(*vaIt);
+    // Return each page to the free pool TODO fix so that mapping stays but address is available for future mallocs
+    const std::vector<uint64_t>& physPages = it->second.physPages;
+    for (std::vector<uint64_t>::const_reverse_iterator page = physPages.rbegin(); page != physPages.rend(); page++) {
+        freePages[it->second.level]->push_front(*page);
     }
 
-    // Remove mallocInformation entry
-    delete myKeys;
-    mallocInformation.erase(virtualAddress);
+    shootdownTranslations(virtualAddress, virtualAddress + it->second.size, uniformPageSize);
+
+    // Remove malloc entry
+    mallocRegions.erase(it);
+}
+
+ArielMemoryManagerMalloc::MallocMap::iterator ArielMemoryManagerMalloc::findMalloc(const uint64_t virtAddr) {
+    MallocMap::iterator it = mallocRegions.upper_bound(virtAddr);
+    if (it == mallocRegions.begin()) return mallocRegions.end();
+    it--;
+
+    if (virtAddr < it->first + it->second.size) return it;
+    return mallocRegions.end();
 }
 
 
@@ -257,62 +272,60 @@ uint64_t ArielMemoryManagerMalloc::translateAddress(uint64_t virtAddr) {
     statTranslationQueries->addData(1);
 
     uint64_t physAddr = (uint64_t) -1;
-    bool found = false;
 
     output->verbose(CALL_INFO, 4, 0, "Page Table: translate virtual address %" PRIu64 "\n", virtAddr);
 
     // Check the translation cache otherwise carry on
-    auto checkCache = translationCache->find(virtAddr);
-    if(checkCache != translationCache->end()) {
+    if(translationCache.lookup(virtAddr, physAddr)) {
         statTranslationCacheHits->addData(1);
-        return checkCache->second;
+        return physAddr;
     }
 
     // Check malloc mappings
-    if (!mallocTranslations.empty()) {
-        std::map<uint64_t, uint64_t>::iterator it = mallocTranslations.upper_bound(virtAddr);
-        if (it == mallocTranslations.begin()) it = mallocTranslations.end();
-        else it--;
-
-        if (it != mallocTranslations.end() && (it->first <= virtAddr)) {
-            uint64_t primaryAddr = mallocPrimaryVAMap.find(it->first)->second;
-            if (virtAddr < (primaryAddr + (mallocInformation.find(primaryAddr)->second).size)) {
-                uint64_t offset = virtAddr - it->first;
-                physAddr = offset + it->second;
-                found = true;
-            }
-        }
+    MallocMap::iterator region = findMalloc(virtAddr);
+    if (region != mallocRegions.end()) {
+        const uint64_t pageSize = pageSizes[region->second.level];
+        const uint64_t pageIndex = (virtAddr - region->first) / pageSize;
+        const uint64_t virtPage = region->first + pageIndex * pageSize;
+        const uint64_t physPage = region->second.physPages[pageIndex];
+
+        physAddr = physPage + (virtAddr - virtPage);
+        cacheTranslation(virtAddr, virtPage, std::min(virtPage + pageSize, region->first + region->second.size), physPage);
+        return physAddr;
     }
 
     // We will have to search every memory level to find where the address lies
     for(uint32_t i = 0; i < memoryLevels; ++i) {
-        if (!found) {
-        std::unordered_map<uint64_t, uint64_t>::iterator page_itr;
-        const uint64_t pageSize = pageSizes[i];
-            const uint64_t page_offset = virtAddr % pageSize;
-        const uint64_t page_start = virtAddr - page_offset;
-
-        page_itr = pageTables[i]->find(page_start);
-
-            if (page_itr != pageTables[i]->end()) {
-                // Located
-            physAddr = page_itr->second + page_offset;
-
-                output->verbose(CALL_INFO, 4, 0, "Page table hit: virtual address=%" PRIu64 " hit in level: %" PRIu32 ", virtual page start=%" PRIu64 ", virtual end=%" PRIu64 ", translates to phys page start=%" PRIu64 " translates to: phys address: %" PRIu64 " (offset added to phys start=%" PRIu64 ")\n",
-                    virtAddr, i, page_itr->first, page_itr->first + pageSize, page_itr->second, physAddr, page_offset);
+        const uint64_t physPage = pageTables[i]->lookup(virtAddr);
+
+        if (physPage != ArielPageTable::INVALID) {
+            // Located
+            const uint64_t pageSize = pageSizes[i];
+            const uint64_t page_start = pageTables[i]->pageStart(virtAddr);
+            const uint64_t page_offset = virtAddr - page_start;
+            physAddr = physPage + page_offset;
+
+            output->verbose(CALL_INFO, 4, 0, "Page table hit: virtual address=%" PRIu64 " hit in level: %" PRIu32 ", virtual page start=%" PRIu64 ", virtual end=%" PRIu64 ", translates to phys page start=%" PRIu64 " translates to: phys address: %" PRIu64 " (offset added to phys start=%" PRIu64 ")\n",
+                virtAddr, i, page_start, page_start + pageSize, physPage, physAddr, page_offset);
+
+            // Malloc regions take priority, so only cache the part of the
+            // page between the regions on either side of this address
+            uint64_t base = page_start;
+            uint64_t limit = page_start + pageSize;
+            MallocMap::iterator next = mallocRegions.upper_bound(virtAddr);
+            if (next != mallocRegions.end()) limit = std::min(limit, next->first);
+            if (next != mallocRegions.begin()) {
+                MallocMap::iterator prev = next;
+                prev--;
+                base = std::max(base, prev->first + prev->second.size);
+            }
 
-            found = true;
-            break;
-        }
-        } else {
-            break;
+            cacheTranslation(virtAddr, base, limit, physPage + (base - page_start));
+            return physAddr;
         }
     }
 
-    if(found) {
-        cacheTranslation(virtAddr, physAddr);
-        return physAddr;
-    } else {
+    {
         output->verbose(CALL_INFO, 4, 0, "Page table miss for virtual address: %" PRIu64 "\n", virtAddr);
 
         // We did not find the address in memory, that means we should allocate it one from our default pool
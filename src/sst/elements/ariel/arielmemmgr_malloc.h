@@ -79,13 +79,17 @@ class ArielMemoryManagerMalloc : public ArielMemoryManagerCache {
         struct mallocInfo {
             uint64_t size;
             uint32_t level;
-            std::unordered_set<uint64_t>* VAKeys;
-            mallocInfo(uint64_t size, uint32_t level, std::unordered_set<uint64_t>* VAKeys) : size(size), level(level), VAKeys(VAKeys) {};
+            std::vector<uint64_t> physPages;    // Physical page for each page of the malloc, in VA order
+            mallocInfo(uint64_t size, uint32_t level) : size(size), level(level) {};
         };
 
-        std::map<uint64_t, uint64_t> mallocPrimaryVAMap;    // Map VA of each PA to the primary VA of the malloc -> used to find the mallocInfo
-        std::map<uint64_t, uint64_t> mallocTranslations;    // Map VA to PA for mallocs -> primary lookup
-        std::map<uint64_t, mallocInfo> mallocInformation;   // Map mallocID to information about the malloc -> use for frees/allocs
+        // Malloc regions don't overlap, so keying them by their start VA
+        // finds the region holding an address with one upper_bound()
+        typedef std::map<uint64_t, mallocInfo> MallocMap;
+        MallocMap mallocRegions;
+
+        MallocMap::iterator findMalloc(const uint64_t virtAddr);
+        bool uniformPageSize;
 
         uint32_t defaultLevel;
         uint32_t memoryLevels;
@@ -93,7 +97,7 @@ class ArielMemoryManagerMalloc : public ArielMemoryManagerCache {
 
         std::deque<uint64_t>** freePages;
         std::unordered_map<uint64_t, uint64_t>** pageAllocations;
-        std::unordered_map<uint64_t, uint64_t>** pageTables;
+        ArielPageTable** pageTables;
 
         std::vector<Statistic<uint64_t>* > statBytesAlloc;
         std::vector<Statistic<uint64_t>* > statBytesFree;
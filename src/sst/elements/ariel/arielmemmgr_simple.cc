@@ -21,31 +21,38 @@
 using namespace SST::ArielComponent;
 
 ArielMemoryManagerSimple::ArielMemoryManagerSimple(ComponentId_t id, Params& params) :
-            ArielMemoryManagerCache(id, params) {
+            ArielMemoryManagerCache(id, params),
+            pageSize(params.find<uint64_t>("pagesize0", 4096)),
+            pageTable(pageSize) {
 
-    pageSize = (uint64_t) params.find<uint64_t>("pagesize0", 4096);
     output->verbose(CALL_INFO, 2, 0, "Page size is %" PRIu64 "\n", pageSize);
+    translationCache.init(translationCacheEntries, pageSize);
 
     uint64_t pageCount = (uint64_t) params.find<uint64_t>("pagecount0", 131072);
     output->verbose(CALL_INFO, 2, 0, "Page count is %" PRIu64 "\n", pageCount);
 
-    if (mapPolicy == ArielPageMappingPolicy::LINEAR) {
-        mapPagesLinear(pageCount, pageSize, 0, &freePages);
-    } else {
-        mapPagesRandom(pageCount, pageSize, 0, &freePages);
-    }
+    std::string popFilePath = params.find<std::string>("page_populate_0", "");
 
-    output->verbose(CALL_INFO, 2, 0, "Usable (free) page queue contains %" PRIu32 " entries\n", (uint32_t) freePages.size());
+    // Completed by completeSetup() before the first translation
+    deferSetup([this, pageCount, popFilePath]() {
+        if (mapPolicy == ArielPageMappingPolicy::LINEAR) {
+            mapPagesLinear(pageCount, pageSize, 0, &freePages);
+        } else {
+            mapPagesRandom(pageCount, pageSize, 0, &freePages);
+        }
 
-    std::string popFilePath = params.find<std::string>("page_populate_0", "");
-    if (popFilePath != "") {
-        output->verbose(CALL_INFO, 1, 0, "Populating page table from %s...\n", popFilePath.c_str());
-        populatePageTable(popFilePath, &pageTable, &freePages, pageSize);
-    }
+        output->verbose(CALL_INFO, 2, 0, "Usable (free) page queue contains %" PRIu32 " entries\n", (uint32_t) freePages.size());
 
+        if (popFilePath != "") {
+            output->verbose(CALL_INFO, 1, 0, "Populating page table from %s...\n", popFilePath.c_str());
+            populatePageTable(popFilePath, &pageTable, &freePages, pageSize);
+        }
+    });
 }
 
 ArielMemoryManagerSimple::~ArielMemoryManagerSimple() {
+    // Setup tasks use this class's members
+    completeSetup();
 }
 
 
@@ -77,7 +84,7 @@ void ArielMemoryManagerSimple::allocate(const uint64_t size, const uint32_t leve
         const uint64_t nextPhysPage = freePages.front();
         freePages.pop_front();
 
-        pageTable.insert( std::pair<uint64_t, uint64_t>(nextVirtPage, nextPhysPage) );
+        pageTable.insert(nextVirtPage, nextPhysPage);
 
         output->verbose(CALL_INFO, 4, 0, "Allocating memory page, physical page=%" PRIu64 ", virtual page=%" PRIu64 "\n",
                 nextPhysPage, nextVirtPage);
@@ -106,26 +113,24 @@ uint64_t ArielMemoryManagerSimple::translateAddress(uint64_t virtAddr) {
     output->verbose(CALL_INFO, 4, 0, "Page Table: translate virtual address %" PRIu64 "\n", virtAddr);
 
     // Check the translation cache otherwise carry on
-    auto checkCache = translationCache->find(virtAddr);
-    if(checkCache != translationCache->end()) {
+    uint64_t physAddr;
+    if(translationCache.lookup(virtAddr, physAddr)) {
         statTranslationCacheHits->addData(1);
-        return checkCache->second;
+        return physAddr;
     }
 
-    std::unordered_map<uint64_t, uint64_t>::iterator page_itr;
-    const uint64_t page_offset = virtAddr % pageSize;
-    const uint64_t page_start = virtAddr - page_offset;
-
-    page_itr = pageTable.find(page_start);
+    const uint64_t page_start = pageTable.pageStart(virtAddr);
+    const uint64_t page_offset = virtAddr - page_start;
+    const uint64_t physPage = pageTable.lookup(virtAddr);
 
-    if(page_itr != pageTable.end()) {
+    if(physPage != ArielPageTable::INVALID) {
         // Located
-        uint64_t physAddr = page_itr->second + page_offset;
+        physAddr = physPage + page_offset;
 
         output->verbose(CALL_INFO, 4, 0, "Page table hit: virtual address=%" PRIu64 " hit, virtual page start=%" PRIu64 ", virtual end=%" PRIu64 ", translates to phys page start=%" PRIu64 " translates to: phys address: %" PRIu64 " (offset added to phys start=%" PRIu64 ")\n",
-                virtAddr, page_itr->first, page_itr->first + pageSize, page_itr->second, physAddr, page_offset);
+                virtAddr, page_start, page_start + pageSize, physPage, physAddr, page_offset);
 
-        cacheTranslation(virtAddr, physAddr);
+        cacheTranslation(virtAddr, page_start, page_start + pageSize, physPage);
         return physAddr;
 
     } else {
@@ -169,18 +174,21 @@ void ArielMemoryManagerSimple::printTable() {
     	output->output("---------------------------------------------------------------------\n");
 	output->verbose(CALL_INFO, 16, 0, "Page Table Map:\n");
 
-	for( auto table_itr : pageTable ) {
+	pageTable.forEach([this](uint64_t virtPage, uint64_t physPage) {
 		output->verbose(CALL_INFO, 16, 0, "-> VA: %15" PRIu64 " -> PA: %15" PRIu64 "\n",
-			table_itr.first, table_itr.second);
-	}
+			virtPage, physPage);
+	});
 
     	output->output("---------------------------------------------------------------------\n");
 
 }
 
 void ArielMemoryManagerSimple::get_page_info(std::unordered_map<uint64_t, uint64_t>* pagetable, std::deque<uint64_t>* freepages, uint64_t& pagesize) {
-    memcpy((void*)pagetable, (void*)(&pageTable), sizeof(pageTable));
-    memcpy((void*)freepages, (void*)(&freePages), sizeof(freePages)); 
+    pagetable->clear();
+    pageTable.forEach([pagetable](uint64_t virtPage, uint64_t physPage) {
+        (*pagetable)[virtPage] = physPage;
+    });
+    *freepages = freePages;
     pagesize = pageSize;
 
     return;
@@ -67,7 +67,7 @@ class ArielMemoryManagerSimple : public ArielMemoryManagerCache {
         uint64_t pageSize;
         std::deque<uint64_t> freePages;
 
-        std::unordered_map<uint64_t, uint64_t> pageTable;
+        ArielPageTable pageTable;
 };
 
 }
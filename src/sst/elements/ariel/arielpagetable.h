@@ -0,0 +1,254 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+#ifndef _H_ARIEL_PAGE_TABLE
+#define _H_ARIEL_PAGE_TABLE
+
+#include <stdint.h>
+#include <string.h>
+#include <vector>
+
+namespace SST {
+namespace ArielComponent {
+
+/*
+ * Radix page table from virtual page start to physical page start.
+ * Virtual page numbers are split into four 13 bit indices; interior
+ * and leaf arrays are only allocated for the parts of the address
+ * space that are used, so a lookup is four dependent loads.
+ */
+class ArielPageTable {
+
+    public:
+        static const uint64_t INVALID = ~((uint64_t) 0);
+
+        ArielPageTable(uint64_t pageSize) : pageSize(pageSize), entries(0) {
+            pageShift = 0;
+            while ( (((uint64_t) 1) << pageShift) < pageSize ) pageShift++;
+            // Non power of two page sizes fall back to division
+            if ( (((uint64_t) 1) << pageShift) != pageSize ) pageShift = -1;
+            memset(root, 0, sizeof(root));
+        }
+
+        ~ArielPageTable() {
+            for ( int i = 0; i < FANOUT; ++i ) {
+                if ( root[i] == NULL ) continue;
+                for ( int j = 0; j < FANOUT; ++j ) {
+                    Node* mid = root[i]->child[j];
+                    if ( mid == NULL ) continue;
+                    for ( int k = 0; k < FANOUT; ++k ) delete mid->leaf[k];
+                    delete mid;
+                }
+                delete root[i];
+            }
+        }
+
+        /* Physical page start for the page holding virtAddr, or INVALID */
+        inline uint64_t lookup(uint64_t virtAddr) const {
+            const uint64_t vpn = pageNumber(virtAddr);
+            const Top* top = root[index(vpn, 3)];
+            if ( top == NULL ) return INVALID;
+            const Node* mid = top->child[index(vpn, 2)];
+            if ( mid == NULL ) return INVALID;
+            const Leaf* leaf = mid->leaf[index(vpn, 1)];
+            if ( leaf == NULL ) return INVALID;
+            return leaf->phys[index(vpn, 0)];
+        }
+
+        /* Map the page starting at virtPage, keeping any existing mapping */
+        bool insert(uint64_t virtPage, uint64_t physPage) {
+            uint64_t& slot = getSlot(pageNumber(virtPage));
+            if ( slot != INVALID ) return false;
+            slot = physPage;
+            entries++;
+            return true;
+        }
+
+        bool erase(uint64_t virtPage) {
+            if ( lookup(virtPage) == INVALID ) return false;
+            getSlot(pageNumber(virtPage)) = INVALID;
+            entries--;
+            return true;
+        }
+
+        size_t size() const { return entries; }
+
+        uint64_t getPageSize() const { return pageSize; }
+
+        uint64_t pageStart(uint64_t virtAddr) const {
+            return pageShift >= 0 ? (virtAddr >> pageShift) << pageShift : virtAddr - (virtAddr % pageSize);
+        }
+
+        /* Call f(virtPage, physPage) for every mapping, in virtual address order */
+        template <typename F>
+        void forEach(F f) const {
+            for ( int i = 0; i < FANOUT; ++i ) {
+                if ( root[i] == NULL ) continue;
+                for ( int j = 0; j < FANOUT; ++j ) {
+                    const Node* mid = root[i]->child[j];
+                    if ( mid == NULL ) continue;
+                    for ( int k = 0; k < FANOUT; ++k ) {
+                        const Leaf* leaf = mid->leaf[k];
+                        if ( leaf == NULL ) continue;
+                        for ( int l = 0; l < FANOUT; ++l ) {
+                            if ( leaf->phys[l] == INVALID ) continue;
+                            const uint64_t vpn = ((((((uint64_t) i << BITS) | j) << BITS) | k) << BITS) | l;
+                            f(vpn * pageSize, leaf->phys[l]);
+                        }
+                    }
+                }
+            }
+        }
+
+    private:
+        static const int BITS = 13;
+        static const int FANOUT = 1 << BITS;
+
+        struct Leaf {
+            uint64_t phys[FANOUT];
+            Leaf() { for ( int i = 0; i < FANOUT; ++i ) phys[i] = INVALID; }
+        };
+        struct Node {
+            Leaf* leaf[FANOUT];
+            Node() { memset(leaf, 0, sizeof(leaf)); }
+        };
+        struct Top {
+            Node* child[FANOUT];
+            Top() { memset(child, 0, sizeof(child)); }
+        };
+        // Page numbers are assumed to fit in 4 * BITS bits, which covers
+        // the full 64 bit address space for pages of 4KB or more
+        typedef Top* Root[FANOUT];
+
+        inline uint64_t pageNumber(uint64_t virtAddr) const {
+            return pageShift >= 0 ? virtAddr >> pageShift : virtAddr / pageSize;
+        }
+
+        static inline int index(uint64_t vpn, int level) {
+            return (vpn >> (level * BITS)) & (FANOUT - 1);
+        }
+
+        uint64_t& getSlot(uint64_t vpn) {
+            Top*& top = root[index(vpn, 3)];
+            if ( top == NULL ) top = new Top();
+            Node*& mid = top->child[index(vpn, 2)];
+            if ( mid == NULL ) mid = new Node();
+            Leaf*& leaf = mid->leaf[index(vpn, 1)];
+            if ( leaf == NULL ) leaf = new Leaf();
+            return leaf->phys[index(vpn, 0)];
+        }
+
+        uint64_t pageSize;
+        int pageShift;
+        size_t entries;
+        Root root;
+};
+
+/*
+ * Direct mapped software TLB in front of the page tables.  Each entry
+ * covers [base, limit) of the virtual address space, which is a whole
+ * page for demand mappings but may be part of a page for a malloc
+ * region.  Entries are indexed by the virtual address at a fixed
+ * granularity (the smallest page size in use).
+ */
+class ArielTranslationCache {
+
+    public:
+        ArielTranslationCache() : shift(12), mask(0) {}
+
+        void init(uint32_t numEntries, uint64_t granularity) {
+            uint32_t size = 1;
+            while ( size < numEntries ) size <<= 1;
+            mask = size - 1;
+
+            shift = 0;
+            while ( (((uint64_t) 2) << shift) <= granularity ) shift++;
+
+            Entry invalid = { 0, 0, 0 };
+            entries.assign(numEntries == 0 ? 0 : size, invalid);
+        }
+
+        /* Returns true and sets physAddr if virtAddr hits */
+        inline bool lookup(uint64_t virtAddr, uint64_t& physAddr) const {
+            if ( entries.empty() ) return false;
+            const Entry& e = entries[(virtAddr >> shift) & mask];
+            if ( virtAddr - e.base < e.limit - e.base ) {
+                physAddr = e.phys + (virtAddr - e.base);
+                return true;
+            }
+            return false;
+        }
+
+        /* Cache [base, limit) -> phys for virtAddr, returns true if a valid entry was evicted */
+        bool insert(uint64_t virtAddr, uint64_t base, uint64_t limit, uint64_t phys) {
+            if ( entries.empty() ) return false;
+            Entry& e = entries[(virtAddr >> shift) & mask];
+            const bool evict = e.limit > e.base;
+            e.base = base;
+            e.limit = limit;
+            e.phys = phys;
+            return evict;
+        }
+
+        /* Drop the entries overlapping [base, limit).  Only finds them all if
+         * no entry spans more than one granule, callers flush() otherwise */
+        void invalidate(uint64_t base, uint64_t limit) {
+            if ( entries.empty() || limit <= base ) return;
+            if ( ((limit - base) >> shift) >= entries.size() ) {
+                flush();
+                return;
+            }
+            for ( uint64_t g = base >> shift; g <= ((limit - 1) >> shift); ++g ) {
+                Entry& e = entries[g & mask];
+                if ( e.base < limit && base < e.limit ) {
+                    e.base = 0;
+                    e.limit = 0;
+                }
+            }
+        }
+
+        void flush() {
+            for ( size_t i = 0; i < entries.size(); ++i ) {
+                entries[i].base = 0;
+                entries[i].limit = 0;
+            }
+        }
+
+        uint32_t capacity() const { return entries.size(); }
+
+        /* Call f(virtBase, physBase) for every valid entry */
+        template <typename F>
+        void forEach(F f) const {
+            for ( size_t i = 0; i < entries.size(); ++i ) {
+                if ( entries[i].limit > entries[i].base ) f(entries[i].base, entries[i].phys);
+            }
+        }
+
+    private:
+        // Invalid entries have limit <= base
+        struct Entry {
+            uint64_t base;
+            uint64_t limit;
+            uint64_t phys;
+        };
+
+        std::vector<Entry> entries;
+        int shift;
+        uint64_t mask;
+};
+
+}
+}
+
+#endif
@@ -28,12 +28,15 @@ class ArielWriteEvent : public ArielEvent {
 
     public:
         ArielWriteEvent(uint64_t wAddr, uint32_t length, const uint8_t* payloadData) :
-                writeAddress(wAddr), writeLength(length) {
+                writeAddress(wAddr), writeLength(length), payload(NULL) {
 
-                payload = new uint8_t[length];
+                // Writes without a payload don't carry a buffer
+                if( NULL != payloadData ) {
+                        payload = new uint8_t[length];
 
-                for( int i = 0; i < length; ++i ) {
-                	payload[i] = payloadData[i];
+                        for( int i = 0; i < length; ++i ) {
+                        	payload[i] = payloadData[i];
+                        }
                 }
         }
 
@@ -74,6 +74,8 @@ KNOB<UINT32> StartupMode            (KNOB_MODE_WRITEONCE, "pintool", "s", "1", "
 // Instrumentation control
 KNOB<UINT32> InstrumentInstructions (KNOB_MODE_WRITEONCE, "pintool", "E", "1", "Enable instruction instrumentation");
 KNOB<UINT32> PerformWriteTrace      (KNOB_MODE_WRITEONCE, "pintool", "w", "0", "Perform write tracing (i.e copy values directly into SST memory operations) (0 = disabled, 1 = enabled)");
+KNOB<string> SSTPayloadPipe         (KNOB_MODE_WRITEONCE, "pintool", "y", "",  "Named pipe for write payloads, required with write tracing");
+KNOB<UINT32> TunnelBatching         (KNOB_MODE_WRITEONCE, "pintool", "b", "0", "Pack instruction records into batched tunnel messages, ignored with write tracing (0 = disabled, 1 = enabled)");
 KNOB<UINT32> TrapFunctionProfile    (KNOB_MODE_WRITEONCE, "pintool", "t", "0", "Function profiling level (0 = disabled, 1 = enabled)");
 // Memory/malloc/etc. tracking
 KNOB<UINT32> InterceptMemAllocations(KNOB_MODE_WRITEONCE, "pintool", "m", "1", "Should intercept multi-level memory allocations, mallocs, and frees, 1 = start enabled, 0 = start disabled");
@@ -102,6 +104,17 @@ PIN_LOCK mainLock;
 // Instrumentation control
 UINT32 instrument_instructions;
 bool writeTrace;
+SST::Core::Interprocess::MMAPChild_Pin3<ArielPayloadTunnel> * payloadTunnelmgr;
+ArielPayloadTunnel *payloadTunnel = NULL;
+std::vector<ArielPayloadChunk> payloadChunks; // Per-thread payload chunk being filled
+struct PendingWrite {
+    ADDRINT* addr;
+    UINT32 size;
+};
+std::vector< std::vector<PendingWrite> > pendingWrites; // Per-thread writes waiting for their data
+bool batchTunnel;
+std::vector<ArielCommand> batchCommands;  // Per-thread batch being filled
+std::vector<uint64_t> batchLastAddr;      // Per-thread last address in the batch
 UINT32 funcProfileLevel;
 typedef struct {
     int64_t insExecuted;
@@ -293,18 +306,88 @@ VOID InstrumentTrace (TRACE trace, VOID* args)
 /******************** END SHADOW STACK **************************/
 /****************************************************************/
 
+/* Send the thread's pending batch, if it has any records */
+VOID FlushBatch(UINT32 thr)
+{
+    ArielCommand& ac = batchCommands[thr];
+
+    if (ac.batch.count > 0) {
+        tunnel->writeMessage(thr, ac);
+        ac.batch.count = 0;
+        ac.batch.bytes = 0;
+        batchLastAddr[thr] = 0;
+    }
+}
+
+/* All other commands flush the batch first so the core sees them in order */
+VOID WriteTunnelCommand(UINT32 thr, const ArielCommand& ac)
+{
+    if (batchTunnel && thr < core_count) {
+        FlushBatch(thr);
+    }
+
+    tunnel->writeMessage(thr, ac);
+}
+
+/* Return space for one record in the thread's batch, sending the batch if full */
+inline uint8_t* ReserveBatchRecord(UINT32 thr)
+{
+    ArielCommand& ac = batchCommands[thr];
+
+    if (ac.batch.bytes + ARIEL_BATCH_MAX_RECORD > ARIEL_BATCH_BYTES) {
+        FlushBatch(thr);
+    }
+
+    ac.batch.count++;
+    return &ac.batch.data[ac.batch.bytes];
+}
+
+inline VOID BatchMarker(UINT32 thr, uint8_t op)
+{
+    uint8_t* rec = ReserveBatchRecord(thr);
+    rec[0] = op;
+    batchCommands[thr].batch.bytes++;
+}
+
+inline VOID BatchAccess(UINT32 thr, uint8_t op, uint64_t addr, UINT32 size)
+{
+    uint8_t* rec = ReserveBatchRecord(thr);
+    uint32_t len = 1;
+
+    if (size > 0 && size < 32) {
+        rec[0] = op | (uint8_t) (size << 3);
+    } else {
+        rec[0] = op;
+        len += arielBatchPutVarint(&rec[len], size);
+    }
+
+    len += arielBatchPutVarint(&rec[len], arielBatchZigZag((int64_t) (addr - batchLastAddr[thr])));
+    batchLastAddr[thr] = addr;
+    batchCommands[thr].batch.bytes += len;
+}
+
 VOID Fini(INT32 code, VOID* v)
 {
     if(SSTVerbosity.Value() > 0) {
         std::cout << "SSTARIEL: Execution completed, shutting down." << std::endl;
     }
 
+    // Other threads have exited, send what they left in their batches
+    if (batchTunnel) {
+        for (UINT32 i = 0; i < core_count; i++) {
+            FlushBatch(i);
+        }
+    }
+
     ArielCommand ac;
     ac.command = ARIEL_PERFORM_EXIT;
     ac.instPtr = (uint64_t) 0;
-    tunnel->writeMessage(0, ac);
+    WriteTunnelCommand(0, ac);
 
     delete tunnelmgr;
+    if (writeTrace) {
+        delete payloadTunnelmgr;
+    }
 #ifdef HAVE_CUDA
     delete tunnelRmgr;
     delete tunnelDmgr;
@@ -350,7 +433,7 @@ VOID WriteFlushInstructionMarker(UINT32 thr, ADDRINT ip, ADDRINT vaddr)
     ac.instPtr = (uint64_t) ip;
     ac.flushline.vaddr = (uint32_t) vaddr;
 
-    tunnel->writeMessage(thr, ac);
+    WriteTunnelCommand(thr, ac);
 }
 
 VOID WriteFenceInstructionMarker(UINT32 thr, ADDRINT ip)
@@ -359,7 +442,7 @@ VOID WriteFenceInstructionMarker(UINT32 thr, ADDRINT ip)
     ac.command = ARIEL_FENCE_INSTRUCTION;
     ac.instPtr = (uint64_t) ip;
 
-    tunnel->writeMessage(thr, ac);
+    WriteTunnelCommand(thr, ac);
 }
 
 VOID WriteInstructionRead(ADDRINT* address, UINT32 readSize, THREADID thr, ADDRINT ip,
@@ -368,6 +451,11 @@ VOID WriteInstructionRead(ADDRINT* address, UINT32 readSize, THREADID thr, ADDRI
 
     const uint64_t addr64 = (uint64_t) address;
 
+    if (batchTunnel) {
+        BatchAccess(thr, ARIEL_BATCH_READ, addr64, readSize);
+        return;
+    }
+
     ArielCommand ac;
 
     ac.command = ARIEL_PERFORM_READ;
@@ -377,7 +465,40 @@ VOID WriteInstructionRead(ADDRINT* address, UINT32 readSize, THREADID thr, ADDRI
     ac.inst.instClass = instClass;
     ac.inst.simdElemCount = simdOpWidth;
 
-    tunnel->writeMessage(thr, ac);
+    WriteTunnelCommand(thr, ac);
+}
+
+/* Send the thread's partly filled payload chunk */
+VOID FlushPayload(UINT32 thr)
+{
+    ArielPayloadChunk& chunk = payloadChunks[thr];
+
+    if (chunk.bytes > 0) {
+        payloadTunnel->writeMessage(thr, chunk);
+        chunk.bytes = 0;
+    }
+}
+
+/* Copy the bytes at address into the thread's payload stream */
+VOID AppendPayload(UINT32 thr, ADDRINT* address, UINT32 size)
+{
+    ArielPayloadChunk& chunk = payloadChunks[thr];
+    const uint8_t* src = (const uint8_t*) address;
+
+    while (size > 0) {
+        const UINT32 count = ARIEL_MIN(size, (UINT32) ARIEL_PAYLOAD_CHUNK_BYTES - chunk.bytes);
+        // Unreadable bytes, which the store would have faulted on, stay zero
+        const size_t copied = PIN_SafeCopy(&chunk.data[chunk.bytes], src, count);
+        memset(&chunk.data[chunk.bytes + copied], 0, count - copied);
+
+        chunk.bytes += count;
+        src += count;
+        size -= count;
+
+        if (chunk.bytes == ARIEL_PAYLOAD_CHUNK_BYTES) {
+            FlushPayload(thr);
+        }
+    }
 }
 
 VOID WriteInstructionWrite(ADDRINT* address, UINT32 writeSize, THREADID thr, ADDRINT ip,
@@ -385,6 +506,12 @@ VOID WriteInstructionWrite(ADDRINT* address, UINT32 writeSize, THREADID thr, ADD
 {
 
     const uint64_t addr64 = (uint64_t) address;
+
+    if (batchTunnel) {
+        BatchAccess(thr, ARIEL_BATCH_WRITE, addr64, writeSize);
+        return;
+    }
+
     ArielCommand ac;
 
     ac.command = ARIEL_PERFORM_WRITE;
@@ -394,40 +521,51 @@ VOID WriteInstructionWrite(ADDRINT* address, UINT32 writeSize, THREADID thr, ADD
     ac.inst.instClass = instClass;
     ac.inst.simdElemCount = simdOpWidth;
 
+    // The payload has to be in the payload tunnel before the core reads the write
     if( writeTrace ) {
-//      if( writeSize > ARIEL_MAX_PAYLOAD_SIZE ) {
-//          fprintf(stderr, "Error: Payload exceeds maximum size (%d > %d)\n",
-//              writeSize, ARIEL_MAX_PAYLOAD_SIZE);
-//          exit(-1);
-//      }
-        PIN_SafeCopy( &ac.inst.payload[0], address, ARIEL_MIN( writeSize, (UINT32) ARIEL_MAX_PAYLOAD_SIZE ) );
+        AppendPayload(thr, address, writeSize);
+        FlushPayload(thr);
     }
-/*
-    printf("CU Instruction %p ",address);
-    for(int i = 0; i < ARIEL_MIN(writeSize, ARIEL_MAX_PAYLOAD_SIZE); i++){
-        printf("%d ", ac.inst.payload[i]);
-    }
-    printf("\n");
-*/
-    tunnel->writeMessage(thr, ac);
+
+    WriteTunnelCommand(thr, ac);
 }
 
+VOID WritePendingWrites(THREADID thr, ADDRINT ip, UINT32 instClass, UINT32 simdOpWidth);
+
 VOID WriteStartInstructionMarker(UINT32 thr, ADDRINT ip, UINT32 instClass, UINT32 simdOpWidth)
 {
+    // Iterations of a REP instruction may start before the writes of the
+    // previous one were sent
+    if (writeTrace && !pendingWrites[thr].empty()) {
+        WritePendingWrites(thr, ip, instClass, simdOpWidth);
+    }
+
+    if (batchTunnel) {
+        uint8_t* rec = ReserveBatchRecord(thr);
+        rec[0] = ARIEL_BATCH_START | (uint8_t) (instClass << 3);
+        batchCommands[thr].batch.bytes += 1 + arielBatchPutVarint(&rec[1], simdOpWidth);
+        return;
+    }
+
     ArielCommand ac;
     ac.command = ARIEL_START_INSTRUCTION;
     ac.instPtr = (uint64_t) ip;
     ac.inst.simdElemCount = simdOpWidth;
     ac.inst.instClass = instClass;
-    tunnel->writeMessage(thr, ac);
+    WriteTunnelCommand(thr, ac);
 }
 
 VOID WriteEndInstructionMarker(UINT32 thr, ADDRINT ip)
 {
+    if (batchTunnel) {
+        BatchMarker(thr, ARIEL_BATCH_END);
+        return;
+    }
+
     ArielCommand ac;
     ac.command = ARIEL_END_INSTRUCTION;
     ac.instPtr = (uint64_t) ip;
-    tunnel->writeMessage(thr, ac);
+    WriteTunnelCommand(thr, ac);
 }
 
 VOID WriteInstructionReadWrite(THREADID thr, ADDRINT* readAddr, UINT32 readSize,
@@ -465,10 +603,15 @@ VOID WriteNoOp(THREADID thr, ADDRINT ip)
 {
     if(enable_output) {
         if(thr < core_count) {
+            if (batchTunnel) {
+                BatchMarker(thr, ARIEL_BATCH_NOOP);
+                return;
+            }
+
             ArielCommand ac;
             ac.command = ARIEL_NOOP;
             ac.instPtr = (uint64_t) ip;
-            tunnel->writeMessage(thr, ac);
+            WriteTunnelCommand(thr, ac);
         }
     }
 }
@@ -489,6 +632,88 @@ VOID WriteInstructionWriteOnly(THREADID thr, ADDRINT* writeAddr, UINT32 writeSiz
 
 }
 
+/* With write tracing, stores are only sent once the instruction has executed
+ * so their payload holds the new data; this notes the store beforehand */
+VOID WriteInstructionWriteDeferred(THREADID thr, ADDRINT* writeAddr, UINT32 writeSize, ADDRINT ip,
+            UINT32 instClass, UINT32 simdOpWidth, BOOL first)
+{
+
+    if(enable_output) {
+        if(thr < core_count) {
+            if (first)
+                WriteStartInstructionMarker(thr, ip, instClass, simdOpWidth);
+            PendingWrite write = { writeAddr, writeSize };
+            pendingWrites[thr].push_back(write);
+        }
+    }
+
+}
+
+/* Send the deferred stores of an instruction that has executed and end it */
+VOID WritePendingWrites(THREADID thr, ADDRINT ip, UINT32 instClass, UINT32 simdOpWidth)
+{
+    if(thr >= core_count || pendingWrites[thr].empty()) {
+        return;
+    }
+
+    std::vector<PendingWrite>& writes = pendingWrites[thr];
+
+    for (size_t i = 0; i < writes.size(); i++) {
+        AppendPayload(thr, writes[i].addr, writes[i].size);
+    }
+    FlushPayload(thr);
+
+    for (size_t i = 0; i < writes.size(); i++) {
+        ArielCommand ac;
+        ac.command = ARIEL_PERFORM_WRITE;
+        ac.instPtr = (uint64_t) ip;
+        ac.inst.addr = (uint64_t) writes[i].addr;
+        ac.inst.size = writes[i].size;
+        ac.inst.instClass = instClass;
+        ac.inst.simdElemCount = simdOpWidth;
+        WriteTunnelCommand(thr, ac);
+    }
+
+    writes.clear();
+    WriteEndInstructionMarker(thr, ip);
+}
+
+/* Gathers and scatters access one element per active mask bit, which are
+ * sent as separate reads and writes of the instruction */
+VOID WriteInstructionElements(THREADID thr, PIN_MULTI_MEM_ACCESS_INFO* accesses, ADDRINT ip,
+            UINT32 instClass, UINT32 simdOpWidth, BOOL deferWrites)
+{
+
+    if(enable_output) {
+        if(thr < core_count) {
+            WriteStartInstructionMarker(thr, ip, instClass, simdOpWidth);
+
+            for (UINT32 i = 0; i < accesses->numberOfMemops; i++) {
+                const PIN_MEM_ACCESS_INFO& element = accesses->memop[i];
+                if (!element.maskOn) {
+                    continue;
+                }
+
+                ADDRINT* addr = (ADDRINT*) element.memoryAddress;
+                if (element.memopType == PIN_MEMOP_LOAD) {
+                    WriteInstructionRead(addr, element.bytesAccessed, thr, ip, instClass, simdOpWidth);
+                } else if (deferWrites) {
+                    PendingWrite write = { addr, (UINT32) element.bytesAccessed };
+                    pendingWrites[thr].push_back(write);
+                } else {
+                    WriteInstructionWrite(addr, element.bytesAccessed, thr, ip, instClass, simdOpWidth);
+                }
+            }
+
+            // Deferred writes end the instruction once they are sent
+            if (!deferWrites || pendingWrites[thr].empty()) {
+                WriteEndInstructionMarker(thr, ip);
+            }
+        }
+    }
+
+}
+
 VOID IncrementFunctionRecord(VOID* funcRecord)
 {
     ArielFunctionRecord* arielFuncRec = (ArielFunctionRecord*) funcRecord;
@@ -560,10 +785,53 @@ VOID InstrumentInstruction(INS ins, VOID *v)
         }
     }
    
-    UINT32 operands = INS_MemoryOperandCount(ins);
+    // With write tracing, stores are sent after the instruction executes so
+    // their payload holds the stored data.  Instructions that can't be
+    // instrumented afterwards send the memory contents seen before them.
+    const BOOL deferWrites = writeTrace && INS_IsMemoryWrite(ins) &&
+            (INS_IsValidForIpointAfter(ins) || INS_IsValidForIpointTakenBranch(ins));
+
+    if (deferWrites) {
+        if (INS_IsValidForIpointAfter(ins)) {
+            INS_InsertPredicatedCall(ins, IPOINT_AFTER, (AFUNPTR)
+                    WritePendingWrites,
+                    IARG_THREAD_ID,
+                    IARG_INST_PTR,
+                    IARG_UINT32, instClass,
+                    IARG_UINT32, simdOpWidth,
+                    IARG_END);
+        }
+        if (INS_IsValidForIpointTakenBranch(ins)) {
+            INS_InsertPredicatedCall(ins, IPOINT_TAKEN_BRANCH, (AFUNPTR)
+                    WritePendingWrites,
+                    IARG_THREAD_ID,
+                    IARG_INST_PTR,
+                    IARG_UINT32, instClass,
+                    IARG_UINT32, simdOpWidth,
+                    IARG_END);
+        }
+    }
+
+    // The memory operands of gathers and scatters don't have a single
+    // effective address
+    UINT32 operands = INS_HasScatteredMemoryAccess(ins) ? 0 : INS_MemoryOperandCount(ins);
+
+    if (INS_HasScatteredMemoryAccess(ins)) {
+        INS_InsertPredicatedCall(ins, IPOINT_BEFORE, (AFUNPTR)
+                WriteInstructionElements,
+                IARG_THREAD_ID,
+                IARG_MULTI_MEMORYACCESS_EA,
+                IARG_INST_PTR,
+                IARG_UINT32, instClass,
+                IARG_UINT32, simdOpWidth,
+                IARG_BOOL, deferWrites,
+                IARG_END);
+    }
+
     for (UINT32 op = 0; op < operands; op++) {
         BOOL first = (op == 0);
-        BOOL last = (op == (operands - 1));
+        // Deferred writes end the instruction once they are sent
+        BOOL last = (op == (operands - 1)) && !deferWrites;
         
         if (INS_MemoryOperandIsRead(ins, op)) {
             INS_InsertPredicatedCall(ins, IPOINT_BEFORE, (AFUNPTR)
@@ -576,6 +844,16 @@ VOID InstrumentInstruction(INS ins, VOID *v)
                     IARG_BOOL, first,
                     IARG_BOOL, last,
                     IARG_END);
+        } else if (deferWrites) {
+            INS_InsertPredicatedCall(ins, IPOINT_BEFORE, (AFUNPTR)
+                    WriteInstructionWriteDeferred,
+                    IARG_THREAD_ID,
+                    IARG_MEMORYWRITE_EA, IARG_UINT32, INS_MemoryOperandSize(ins, op),
+                    IARG_INST_PTR,
+                    IARG_UINT32, instClass,
+                    IARG_UINT32, simdOpWidth,
+                    IARG_BOOL, first,
+                    IARG_END);
         } else {
             INS_InsertPredicatedCall(ins, IPOINT_BEFORE, (AFUNPTR)
                     WriteInstructionWriteOnly,
@@ -591,7 +869,7 @@ VOID InstrumentInstruction(INS ins, VOID *v)
         }
     }
 
-    if (operands == 0) {
+    if (operands == 0 && !INS_HasScatteredMemoryAccess(ins)) {
         INS_InsertPredicatedCall(ins, IPOINT_BEFORE, (AFUNPTR)
                 WriteNoOp,
                 IARG_THREAD_ID,
@@ -805,7 +1083,7 @@ void mapped_ariel_output_stats()
     ArielCommand ac;
     ac.command = ARIEL_OUTPUT_STATS;
     ac.instPtr = (uint64_t) 0;
-    tunnel->writeMessage(thr, ac);
+    WriteTunnelCommand(thr, ac);
 }
 
 // same effect as mapped_ariel_output_stats(), but it also sends a user-defined reference number back
@@ -815,7 +1093,7 @@ void mapped_ariel_output_stats_buoy(uint64_t marker)
     ArielCommand ac;
     ac.command = ARIEL_OUTPUT_STATS;
     ac.instPtr = (uint64_t) marker; //user the instruction pointer slot to send the marker number
-    tunnel->writeMessage(thr, ac);
+    WriteTunnelCommand(thr, ac);
 }
 
 void mapped_ariel_flushline(void *virtualAddress)
@@ -881,7 +1159,7 @@ int ariel_mlm_memcpy(void* dest, void* source, size_t size) {
     ac.dma_start.dest = ariel_dest;
     ac.dma_start.len = length;
 
-    tunnel->writeMessage(thr, ac);
+    WriteTunnelCommand(thr, ac);
 
 #ifdef ARIEL_DEBUG
     fprintf(stderr, "Done with ariel memcpy.\n");
@@ -909,7 +1187,7 @@ void ariel_mlm_set_pool(int new_pool)
     ArielCommand ac;
     ac.command = ARIEL_SWITCH_POOL;
     ac.switchPool.pool = newDefaultPool;
-    tunnel->writeMessage(thr, ac);
+    WriteTunnelCommand(thr, ac);
 
     // Keep track of the default pool
     default_pool = (UINT32) new_pool;
@@ -961,7 +1239,7 @@ void* ariel_mmap_mlm(int fileID, size_t size, int level)
     std::cout<<"File ID at FESIMPLE IS : "<<ac.mlm_mmap.fileID<<std::endl;
     std::cout<<"After ******"<<std::endl;
 
-    tunnel->writeMessage(thr, ac);
+    WriteTunnelCommand(thr, ac);
 
 #ifdef ARIEL_DEBUG
     fprintf(stderr, "%u: Ariel mmap_mlm call allocates data at address: 0x%llx\n",
@@ -1016,7 +1294,7 @@ void* ariel_mlm_malloc(size_t size, int level) {
         ac.mlm_map.alloc_level = allocationLevel;
     }
 
-    tunnel->writeMessage(thr, ac);
+    WriteTunnelCommand(thr, ac);
 
 #ifdef ARIEL_DEBUG
     fprintf(stderr, "%u: Ariel mlm_malloc call allocates data at address: 0x%llx\n",
@@ -1061,7 +1339,7 @@ void ariel_mlm_free(void* ptr)
         ArielCommand ac;
         ac.command = ARIEL_ISSUE_TLM_FREE;
         ac.mlm_free.vaddr = virtAddr;
-        tunnel->writeMessage(thr, ac);
+        WriteTunnelCommand(thr, ac);
 
     } else {
         fprintf(stderr, "ARIEL: Call to free in Ariel did not find a matching local allocation, this memory will be leaked.\n");
@@ -1113,14 +1391,14 @@ VOID ariel_postmalloc_instrument(ADDRINT allocLocation)
                 if (toFast[thr].count == 0) {
                     toFast[thr].valid = false;
                 }
-                tunnel->writeMessage(thr, ac);
+                WriteTunnelCommand(thr, ac);
             }
         } else if (shouldOverride) {
             ac.mlm_map.alloc_level = overridePool;
-            tunnel->writeMessage(thr, ac);
+            WriteTunnelCommand(thr, ac);
         } else if (InterceptMemAllocations.Value()) {
             ac.mlm_map.alloc_level = allocationLevel;
-            tunnel->writeMessage(thr, ac);
+            WriteTunnelCommand(thr, ac);
         }
 
         /*printf("ARIEL: Created a malloc of size: %" PRIu64 " in Ariel\n",
@@ -1147,7 +1425,7 @@ __host__ cudaError_t CUDARTAPI cudaMalloc(void **devPtr, size_t size){
     ac.API.name = GPU_MALLOC;
     ac.API.CA.cuda_malloc.dev_ptr = devPtr;
     ac.API.CA.cuda_malloc.size = size;
-    tunnel->writeMessage(thr, ac);
+    WriteTunnelCommand(thr, ac);
 
     GpuCommand gc;
     bool avail = false;
@@ -1177,7 +1455,7 @@ void** CUDARTAPI __cudaRegisterFatBinary(void *fatCubin) {
     ArielCommand ac;
     ac.command = ARIEL_ISSUE_CUDA;
     ac.API.name = GPU_REG_FAT_BINARY;
-    tunnel->writeMessage(thr, ac);
+    WriteTunnelCommand(thr, ac);
 
     GpuCommand gc;
     bool avail=false;
@@ -1218,7 +1496,7 @@ void CUDARTAPI __cudaRegisterFunction(
     ac.API.CA.register_function.fat_cubin_handle = (unsigned)(unsigned long long)fatCubinHandle;
     ac.API.CA.register_function.host_fun = reinterpret_cast<uint64_t>(hostFun);
     strncpy(ac.API.CA.register_function.device_fun, deviceFun, 512);
-    tunnel->writeMessage(thr, ac);
+    WriteTunnelCommand(thr, ac);
 
     GpuCommand gc;
     bool avail=false;
@@ -1242,7 +1520,6 @@ __host__ cudaError_t CUDARTAPI cudaMemcpy(void *dst, const void *src, size_t cou
 
     //TunnelD supports 4k byte transfers
     size_t max_page_size = 1<<12;
-    uint8_t payload[max_page_size];
     size_t bytes_copied = 0;
     bool avail=false;
 
@@ -1283,52 +1560,29 @@ __host__ cudaError_t CUDARTAPI cudaMemcpy(void *dst, const void *src, size_t cou
     ac.API.CA.cuda_memcpy.src = (uint64_t) src;
     ac.API.CA.cuda_memcpy.count = count;
     ac.API.CA.cuda_memcpy.kind = final_kind;
-    tunnel->writeMessage(thr, ac);
+    WriteTunnelCommand(thr, ac);
 
     if(final_kind == cudaMemcpyHostToDevice) {
-        if(count <= max_page_size){
-            // Single transfer (<=4k)
-            bytes_copied = PIN_SafeCopy(&payload, static_cast<const uint8_t*>(src), count);
-            memcpy(gd.page_4k, payload, count);
-            gd.count = count;
+        // Queue every 4k page back to back, writeMessage only blocks when the
+        // tunnel is full, then wait for the single ACK once Ariel has written
+        // all of the data to memory
+        uint64_t offset = 0;
+        do {
+            gd.count = ((count - offset) > max_page_size) ? max_page_size : (count - offset);
+            bytes_copied = PIN_SafeCopy(gd.page_4k, static_cast<const uint8_t*>(src)+offset, gd.count);
+            offset = offset + gd.count;
             tunnelD->writeMessage(thr, gd);
-            do {
-                avail = tunnelR->readMessageNB(thr, &gc);
-            } while (!avail);
-        }else {
-            // Multiple transfers (>4k)
-            size_t remainder = count % (1<<12);
-            size_t pages = count - remainder;
-            uint64_t offset = 0;
-            while((pages != 0) || (remainder != 0)){
-                if(pages != 0){
-                    // Transfer 4k page
-                    bytes_copied = PIN_SafeCopy(&payload, static_cast<const uint8_t*>(src)+offset, 1<<12);
-                    memcpy(gd.page_4k, payload, 1<<12);
-                    gd.count = (1<<12);
-                    pages = pages - (1<<12);
-                    offset = offset + (1<<12);
-                }else {
-                    // Transfer any remaining data smaller than 4k
-                    bytes_copied = PIN_SafeCopy(&payload, static_cast<const uint8_t*>(src)+offset, remainder);
-                    memcpy(gd.page_4k, payload, remainder);
-                    gd.count = remainder;
-                    remainder = 0;
-                }
-                tunnelD->writeMessage(thr, gd);
-                do {
-                    avail = tunnelR->readMessageNB(thr, &gc);
-                } while (!avail);
+        } while(offset < count);
 
-                // Clear flags and buffers for next page transfer
-                avail = false;
-                tunnelR->clearBuffer(thr);
-            }
+        do {
+            avail = tunnelR->readMessageNB(thr, &gc);
+        } while (!avail);
+        avail = false;
+        tunnelR->clearBuffer(thr);
 #ifdef ARIEL_DEBUG
-            printf("CUDA Transferred all Data\n");
-            fflush(stdout);
+        printf("CUDA Transferred all Data\n");
+        fflush(stdout);
 #endif
-        }
     } else if(final_kind==cudaMemcpyDeviceToHost) {
         if(count <= max_page_size){
             do {
@@ -1364,9 +1618,8 @@ __host__ cudaError_t CUDARTAPI cudaMemcpy(void *dst, const void *src, size_t cou
                     memcpy(data+offset, gd.page_4k, remainder);
                     remainder = 0;
                 }
-                tunnelD->clearBuffer(thr);
-                tunnelR->writeMessage(thr, gc);
-                // Clear flags and buffers for next page transfer
+                // Ariel queues the pages back to back, the following ones may
+                // already be in the tunnel so it must not be cleared
                 avail = false;
             }
             bytes_copied = PIN_SafeCopy((uint8_t*)dst, data, count);
@@ -1412,7 +1665,7 @@ __host__ cudaError_t CUDARTAPI cudaConfigureCall(dim3 gridDim, dim3 blockDim, si
     ac.API.CA.cfg_call.bdz = blockDim.z;
     ac.API.CA.cfg_call.sharedMem = sharedMem;
     ac.API.CA.cfg_call.stream = stream;
-    tunnel->writeMessage(thr, ac);
+    WriteTunnelCommand(thr, ac);
 
     GpuCommand gc;
     bool avail=false;
@@ -1460,7 +1713,7 @@ __host__ cudaError_t CUDARTAPI cudaSetupArgument(const void *arg, size_t size, s
     ac.API.CA.set_arg.offset = offset;
     ac.command = ARIEL_ISSUE_CUDA;
     ac.API.name = GPU_SET_ARG;
-    tunnel->writeMessage(thr, ac);
+    WriteTunnelCommand(thr, ac);
 
     GpuCommand gc;
     bool avail=false;
@@ -1485,7 +1738,7 @@ __host__ cudaError_t CUDARTAPI cudaLaunch(const void *func){
     ac.command = ARIEL_ISSUE_CUDA;
     ac.API.name = GPU_LAUNCH;
     ac.API.CA.cuda_launch.func = reinterpret_cast<uint64_t>(func);
-    tunnel->writeMessage(thr, ac);
+    WriteTunnelCommand(thr, ac);
 
     GpuCommand gc;
     bool avail=false;
@@ -1509,7 +1762,7 @@ __host__ cudaError_t CUDARTAPI cudaFree(void *devPtr){
     ac.command = ARIEL_ISSUE_CUDA;
     ac.API.name = GPU_FREE;
     ac.API.CA.free_address = (uint64_t)devPtr;
-    tunnel->writeMessage(thr, ac);
+    WriteTunnelCommand(thr, ac);
 
     GpuCommand gc;
     bool avail=false;
@@ -1532,7 +1785,7 @@ __host__ __cudart_builtin__ cudaError_t CUDARTAPI cudaGetLastError(void){
     ArielCommand ac;
     ac.command = ARIEL_ISSUE_CUDA;
     ac.API.name = GPU_GET_LAST_ERROR;
-    tunnel->writeMessage(thr, ac);
+    WriteTunnelCommand(thr, ac);
     GpuCommand gc;
 
     bool avail=false;
@@ -1571,7 +1824,7 @@ void CUDARTAPI __cudaRegisterVar(
     ac.API.CA.register_var.size = size;
     ac.API.CA.register_var.constant = constant;
     ac.API.CA.register_var.global = global;
-    tunnel->writeMessage(thr, ac);
+    WriteTunnelCommand(thr, ac);
 
     GpuCommand gc;
     bool avail=false;
@@ -1607,7 +1860,7 @@ __host__ cudaError_t CUDARTAPI __maxActiveBlock(
     ac.API.CA.max_active_block.blockSize = blockSize;
     ac.API.CA.max_active_block.dynamicSMemSize = dynamicSMemSize;
     ac.API.CA.max_active_block.flags = flags;
-    tunnel->writeMessage(thr, ac);
+    WriteTunnelCommand(thr, ac);
 
     GpuCommand gc;
     bool avail=false;
@@ -1635,7 +1888,7 @@ VOID ariel_postfree_instrument(ADDRINT allocLocation)
     ArielCommand ac;
     ac.command = ARIEL_ISSUE_TLM_FREE;
     ac.mlm_free.vaddr = virtAddr;
-    tunnel->writeMessage(thr, ac);
+    WriteTunnelCommand(thr, ac);
 }
 
 void mapped_ariel_malloc_flag_fortran(int* mallocLocId, int* count, int* level)
@@ -1682,7 +1935,7 @@ void ariel_start_RTL_sim(RTL_shmem_info* rtl_shmem) {
 
     THREADID thr = PIN_ThreadId();
     const uint32_t thrID = (uint32_t) thr;
-    tunnel->writeMessage(thrID, acRtl);
+    WriteTunnelCommand(thrID, acRtl);
     #ifdef ARIEL_DEBUG
     fprintf(stderr, "\nMessage to add RTL Event into Ariel Event Queue successfully delivered via ArielTunnel");
     #endif
@@ -1703,7 +1956,7 @@ void ariel_update_RTL_signals(RTL_shmem_info* rtl_shmem) {
 
     THREADID thr = PIN_ThreadId();
     const uint32_t thrID = (uint32_t) thr;
-    tunnel->writeMessage(thrID, acRtl);
+    WriteTunnelCommand(thrID, acRtl);
     #ifdef ARIEL_DEBUG
     fprintf(stderr, "\nMessage to add RTL Event into Ariel Event Queue to update RTL signals successfully delivered via ArielTunnel");
     #endif
@@ -2000,11 +2253,47 @@ int main(int argc, char *argv[])
     }
 
     core_count = MaxCoreCount.Value();
+
+    if( writeTrace ) {
+        if( SSTPayloadPipe.Value() == "" ) {
+            fprintf(stderr, "ARIEL-SST: Write tracing requires a payload pipe (-y)\n");
+            exit(-1);
+        }
+
+        payloadChunks.resize(core_count);
+        pendingWrites.resize(core_count);
+        for (UINT32 i = 0; i < core_count; i++) {
+            payloadChunks[i].bytes = 0;
+        }
+    }
     instrument_instructions = InstrumentInstructions.Value();
 
+    // Batched writes carry no payload
+    batchTunnel = (TunnelBatching.Value() > 0) && !writeTrace;
+
+    if (batchTunnel) {
+        if (SSTVerbosity.Value() > 0) {
+            printf("SSTARIEL: Batching instruction records sent to the simulator.\n");
+        }
+
+        batchCommands.resize(core_count);
+        batchLastAddr.resize(core_count, 0);
+
+        for (UINT32 i = 0; i < core_count; i++) {
+            batchCommands[i].command = ARIEL_PERFORM_BATCH;
+            batchCommands[i].instPtr = 0;
+            batchCommands[i].batch.count = 0;
+            batchCommands[i].batch.bytes = 0;
+        }
+    }
+
 // Pin version specific tunnel attach
     tunnelmgr = new SST::Core::Interprocess::MMAPChild_Pin3<ArielTunnel>(SSTNamedPipe.Value());
     tunnel = tunnelmgr->getTunnel();
+    if( writeTrace ) {
+        payloadTunnelmgr = new SST::Core::Interprocess::MMAPChild_Pin3<ArielPayloadTunnel>(SSTPayloadPipe.Value());
+        payloadTunnel = payloadTunnelmgr->getTunnel();
+    }
 #ifdef HAVE_CUDA
     tunnelRmgr = new SST::Core::Interprocess::MMAPChild_Pin3<GpuReturnTunnel>(SSTNamedPipe2.Value());
     tunnelDmgr = new SST::Core::Interprocess::MMAPChild_Pin3<GpuDataTunnel>(SSTNamedPipe3.Value());
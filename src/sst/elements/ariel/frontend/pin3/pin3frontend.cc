@@ -34,6 +34,10 @@
 #include <time.h>
 
 #include <string.h>
+#include <errno.h>
+
+#include <algorithm>
+#include <sstream>
 
 #define ARIEL_INNER_STRINGIZE(input) #input
 #define ARIEL_STRINGIZE(input) ARIEL_INNER_STRINGIZE(input)
@@ -67,8 +71,12 @@ Pin3Frontend::Pin3Frontend(ComponentId_t id, Params& params, uint32_t cores, uin
 
     free(tool_path);
 
+    // Attaching to a running process skips launching and initializing the application
+    const int attach_pid = params.find<int>("attachpid", 0);
+    attachPid = attach_pid;
+
     std::string executable = params.find<std::string>("executable", "");
-    if("" == executable) {
+    if("" == executable && 0 == attach_pid) {
         output->fatal(CALL_INFO, -1, "The input deck did not specify an executable to be run against PIN\n");
     }
 
@@ -110,6 +118,17 @@ Pin3Frontend::Pin3Frontend(ComponentId_t id, Params& params, uint32_t cores, uin
     tunnel = tunnelmgr->getTunnel();
     output->verbose(CALL_INFO, 1, 0, "Base pipe name: %s\n", shmem_region_name.c_str());
 
+    const bool writePayloads = params.find<int>("writepayloadtrace", 0) != 0;
+    std::string payload_region_name = "";
+    payloadTunnelmgr = NULL;
+    payloadTunnel = NULL;
+    if (writePayloads) {
+        payloadTunnelmgr = new SST::Core::Interprocess::MMAPParent<ArielPayloadTunnel>(id, core_count, ARIEL_PAYLOAD_QUEUE_LEN);
+        payload_region_name = payloadTunnelmgr->getRegionName();
+        payloadTunnel = payloadTunnelmgr->getTunnel();
+        output->verbose(CALL_INFO, 1, 0, "Payload pipe name: %s\n", payload_region_name.c_str());
+    }
+
 #ifdef HAVE_CUDA
     tunnelRmgr = new SST::Core::Interprocess::MMAPParent<GpuReturnTunnel>(id, core_count, maxCoreQueueLen);
     tunnelDmgr = new SST::Core::Interprocess::MMAPParent<GpuDataTunnel>(id, core_count, maxCoreQueueLen);
@@ -125,10 +144,20 @@ Pin3Frontend::Pin3Frontend(ComponentId_t id, Params& params, uint32_t cores, uin
 
     // MPI Launcher options
     mpimode = params.find<int>("mpimode", 0);
+    mpileader = true;
+    mpidilation = 1.0;
     if (mpimode) {
         mpilauncher = params.find<std::string>("mpilauncher",  ARIEL_STRINGIZE(MPILAUNCHER_EXECUTABLE));
         mpiranks = params.find<int>("mpiranks", 1);
         mpitracerank = params.find<int>("mpitracerank", 0);
+        mpirendezvous = params.find<std::string>("mpirendezvous", "ariel-mpi");
+        mpidilation = params.find<double>("mpidilation", 1.0);
+
+        std::stringstream traceranks(params.find<std::string>("mpitraceranks", ""));
+        std::string rank;
+        while (std::getline(traceranks, rank, ',')) {
+            mpitraceset.push_back(std::stoi(rank));
+        }
     }
 
     // MPI Launcher error checking
@@ -142,12 +171,32 @@ Pin3Frontend::Pin3Frontend(ComponentId_t id, Params& params, uint32_t cores, uin
 #ifdef HAVE_CUDA
         output->fatal(CALL_INFO, -1, "Using an MPI launcher and CUDA is not supported.\n");
 #endif
+        if (attach_pid != 0) {
+            output->fatal(CALL_INFO, -1, "Using an MPI launcher and attaching to a running process (attachpid) is not supported.\n");
+        }
         if (mpiranks < 1) {
             output->fatal(CALL_INFO, -1, "You must specify a positive number for `mpiranks` when using an MPI launhcer. Got %d.\n", mpiranks);
         }
         if (mpitracerank < 0 || mpitracerank >= mpiranks) {
             output->fatal(CALL_INFO, -1, "The value of `mpitracerank` must be in [0,mpiranks) Got %d.\n", mpitracerank);
         }
+        for (size_t i = 0; i < mpitraceset.size(); i++) {
+            if (mpitraceset[i] < 0 || mpitraceset[i] >= mpiranks) {
+                output->fatal(CALL_INFO, -1, "The ranks in `mpitraceranks` must be in [0,mpiranks) Got %d.\n", mpitraceset[i]);
+            }
+            if (std::count(mpitraceset.begin(), mpitraceset.end(), mpitraceset[i]) > 1) {
+                output->fatal(CALL_INFO, -1, "Rank %d is listed more than once in `mpitraceranks`.\n", mpitraceset[i]);
+            }
+        }
+        if (!mpitraceset.empty()) {
+            if (std::find(mpitraceset.begin(), mpitraceset.end(), mpitracerank) == mpitraceset.end()) {
+                output->fatal(CALL_INFO, -1, "`mpitraceranks` must contain `mpitracerank` (%d).\n", mpitracerank);
+            }
+            mpileader = mpitraceset[0] == mpitracerank;
+        }
+        if (mpidilation < 1.0) {
+            output->fatal(CALL_INFO, -1, "The value of `mpidilation` must be at least 1. Got %f.\n", mpidilation);
+        }
 
     }
 
@@ -155,25 +204,33 @@ Pin3Frontend::Pin3Frontend(ComponentId_t id, Params& params, uint32_t cores, uin
         output->verbose(CALL_INFO, 1, 0, "Ariel-MPI: MPI launcher: %s\n", mpilauncher.c_str());
         output->verbose(CALL_INFO, 1, 0, "Ariel-MPI: MPI ranks: %d\n", mpiranks);
         output->verbose(CALL_INFO, 1, 0, "Ariel-MPI: MPI trace rank: %d\n", mpitracerank);
+        if (!mpitraceset.empty()) {
+            output->verbose(CALL_INFO, 1, 0, "Ariel-MPI: Tracing %zu ranks, %s\n", mpitraceset.size(),
+                    mpileader ? "launching MPI" : "handing PIN command to the launching rank");
+        }
     }
 
 
     appLauncher = params.find<std::string>("launcher", PINTOOL_EXECUTABLE);
 
     const uint32_t launch_param_count = (uint32_t) params.find<uint32_t>("launchparamcount", 0);
-    const uint32_t pin_arg_count = 37 + launch_param_count;
+    const uint32_t pin_arg_count = 43 + launch_param_count;
 
     uint32_t mpi_args = 0;
-    if (mpimode == 1) {
+    if (mpimode == 1 && mpileader) {
         // We need one argument for the launcher, one for the number of ranks,
-        // and one for the rank to trace
-        mpi_args = 3;
+        // and one for the rank to trace, three for each other traced rank
+        // and two for the dilation
+        mpi_args = 5;
+        if (!mpitraceset.empty()) {
+            mpi_args += 3 * (mpitraceset.size() - 1);
+        }
     }
 
     execute_args = (char**) malloc(sizeof(char*) * (mpi_args + pin_arg_count + app_argc));
     uint32_t arg = 0; // Track current arg
 
-    if (mpimode == 1) {
+    if (mpimode == 1 && mpileader) {
         // Prepend mpilauncher to execute_args
         output->verbose(CALL_INFO, 1, 0, "Processing mpilauncher arguments...\n");
         std::string mpiranks_str = std::to_string(mpiranks);
@@ -193,6 +250,22 @@ Pin3Frontend::Pin3Frontend(ComponentId_t id, Params& params, uint32_t cores, uin
         execute_args[arg] = (char*) malloc(mpitracerank_str_size);
         snprintf(execute_args[arg], mpitracerank_str_size, "%s", mpitracerank_str.c_str());
         arg++;
+
+        // The other traced ranks hand their pin command over in a file
+        for (size_t i = 1; i < mpitraceset.size(); i++) {
+            std::string rank_str = std::to_string(mpitraceset[i]);
+            std::string file = rendezvousFile(mpitraceset[i]);
+            execute_args[arg++] = const_cast<char*>("-T");
+            execute_args[arg] = (char*) malloc(sizeof(char) * (rank_str.size() + 1));
+            strcpy(execute_args[arg++], rank_str.c_str());
+            execute_args[arg] = (char*) malloc(sizeof(char) * (file.size() + 1));
+            strcpy(execute_args[arg++], file.c_str());
+        }
+
+        std::string dilation_str = std::to_string(mpidilation);
+        execute_args[arg++] = const_cast<char*>("-D");
+        execute_args[arg] = (char*) malloc(sizeof(char) * (dilation_str.size() + 1));
+        strcpy(execute_args[arg++], dilation_str.c_str());
     }
 
     const uint32_t profileFunctions = (uint32_t) params.find<uint32_t>("profilefunctions", 0);
@@ -216,6 +289,13 @@ Pin3Frontend::Pin3Frontend(ComponentId_t id, Params& params, uint32_t cores, uin
     execute_args[arg++] = const_cast<char*>("child");
 #endif
 
+    if (attach_pid != 0) {
+        output->verbose(CALL_INFO, 1, 0, "Attaching PIN to running process %d\n", attach_pid);
+        execute_args[arg++] = const_cast<char*>("-pid");
+        execute_args[arg++] = (char*) malloc(sizeof(char) * 16);
+        snprintf(execute_args[arg-1], sizeof(char) * 16, "%d", attach_pid);
+    }
+
     execute_args[arg++] = const_cast<char*>("-follow_execv");
 
     size_t param_name_buffer_size = sizeof(char) * 512;
@@ -242,12 +322,23 @@ Pin3Frontend::Pin3Frontend(ComponentId_t id, Params& params, uint32_t cores, uin
     strcpy(execute_args[arg-1], ariel_tool.c_str());
     execute_args[arg++] = const_cast<char*>("-w");
 
-    if( params.find<int>("writepayloadtrace") == 0 ) {
+    if( !writePayloads ) {
         execute_args[arg++] = const_cast<char*>("0");
     } else {
         execute_args[arg++] = const_cast<char*>("1");
+        execute_args[arg++] = const_cast<char*>("-y");
+        execute_args[arg++] = (char*) malloc(sizeof(char) * (payload_region_name.length() + 1));
+        strcpy(execute_args[arg-1], payload_region_name.c_str());
     }
     
+    execute_args[arg++] = const_cast<char*>("-b");
+
+    if( params.find<int>("tunnelbatching", 0) == 0 ) {
+        execute_args[arg++] = const_cast<char*>("0");
+    } else {
+        execute_args[arg++] = const_cast<char*>("1");
+    }
+
     size_t buff8size = sizeof(char)*8;
 
     execute_args[arg++] = const_cast<char*>("-E");
@@ -290,9 +381,14 @@ Pin3Frontend::Pin3Frontend(ComponentId_t id, Params& params, uint32_t cores, uin
     execute_args[arg++] = const_cast<char*>("-d");
     execute_args[arg++] = (char*) malloc(buff8size);
     snprintf(execute_args[arg-1], buff8size, "%" PRIu32, defMemPool);
-    execute_args[arg++] = const_cast<char*>("--");
-    execute_args[arg++] = (char*) malloc(sizeof(char) * (executable.size() + 1));
-    strcpy(execute_args[arg-1], executable.c_str());
+    if (attach_pid == 0) {
+        execute_args[arg++] = const_cast<char*>("--");
+        execute_args[arg++] = (char*) malloc(sizeof(char) * (executable.size() + 1));
+        strcpy(execute_args[arg-1], executable.c_str());
+    } else {
+        // The running process already has its arguments
+        app_argc = 0;
+    }
     char* argv_buffer = (char*) malloc(sizeof(char) * 256);
     for(uint32_t aa = 0; aa < app_argc ; ++aa) {
         snprintf(argv_buffer, sizeof(char)*256, "apparg%" PRIu32, aa);
@@ -348,7 +444,10 @@ void Pin3Frontend::init(unsigned int phase)
         // Init the child_pid = 0, this prevents problems in emergencyShutdown()
         // if forkPINChild() calls fatal (i.e. the child_pid would not be set)
         child_pid = 0;
-        if (mpimode == 1) {
+        if (mpimode == 1 && !mpileader) {
+            // The leading ArielCPU's MPI launcher runs our pin command
+            writeRendezvousFile();
+        } else if (mpimode == 1) {
             // Ariel will fork the MPI launcher which will itself fork pin
             child_pid = forkPINChild(mpilauncher.c_str(), execute_args, execute_env, redirect_info);
         } else {
@@ -368,12 +467,59 @@ void Pin3Frontend::finish() {
     if (child_pid != 0) {
         kill(child_pid, SIGTERM);
     }
+    // PIN's launcher exits once it has attached, so signal the traced process itself
+    if (attachPid != 0 && child_pid != 0) {
+        kill(attachPid, SIGTERM);
+    }
+    // The launcher removes the file once it has read it
+    if (mpimode == 1 && !mpileader) {
+        unlink(rendezvousFile(mpitracerank).c_str());
+    }
+}
+
+std::string Pin3Frontend::rendezvousFile(int rank) {
+    return mpirendezvous + "/rank" + std::to_string(rank) + ".pin";
+}
+
+void Pin3Frontend::writeRendezvousFile() {
+    if(isSimulationRunModeInit())
+        return;
+
+    if (mkdir(mpirendezvous.c_str(), 0755) != 0 && errno != EEXIST) {
+        output->fatal(CALL_INFO, -1, "Unable to create MPI rendezvous directory %s: %s\n",
+                mpirendezvous.c_str(), strerror(errno));
+    }
+
+    // Write under another name first so the launcher never reads half a command
+    std::string file = rendezvousFile(mpitracerank);
+    std::string tmp = file + ".tmp";
+    FILE* out = fopen(tmp.c_str(), "w");
+    if (out == NULL) {
+        output->fatal(CALL_INFO, -1, "Unable to write MPI rendezvous file %s: %s\n",
+                tmp.c_str(), strerror(errno));
+    }
+    for (int i = 0; execute_args[i] != NULL; i++) {
+        fprintf(out, "%s%s", i ? " " : "", execute_args[i]);
+    }
+    fprintf(out, "\n");
+    fclose(out);
+
+    if (rename(tmp.c_str(), file.c_str()) != 0) {
+        output->fatal(CALL_INFO, -1, "Unable to rename MPI rendezvous file to %s: %s\n",
+                file.c_str(), strerror(errno));
+    }
+    output->verbose(CALL_INFO, 1, 0, "Ariel-MPI: PIN command for rank %d written to %s\n",
+            mpitracerank, file.c_str());
 }
 
 ArielTunnel* Pin3Frontend::getTunnel() {
     return tunnel;
 }
 
+ArielPayloadTunnel* Pin3Frontend::getPayloadTunnel() {
+    return payloadTunnel;
+}
+
 #ifdef HAVE_CUDA
 GpuReturnTunnel* Pin3Frontend::getReturnTunnel() {
     return tunnelR;
@@ -554,6 +700,7 @@ int Pin3Frontend::forkPINChild(const char* app, char** args, std::map<std::strin
 Pin3Frontend::~Pin3Frontend() {
     // Everything loaded by calls to the core are deleted by the core (subcomponents, component extension, etc.)
     delete tunnelmgr;
+    delete payloadTunnelmgr;
 #ifdef HAVE_CUDA
     delete tunnelRmgr;
     delete tunnelDmgr;
@@ -565,8 +712,13 @@ void Pin3Frontend::emergencyShutdown() {
     if (child_pid != 0) {
         kill(child_pid, SIGKILL);
     }
+    if (attachPid != 0 && child_pid != 0) {
+        kill(attachPid, SIGKILL);
+    }
 
     delete tunnelmgr; // Clean up tmp file
+    delete payloadTunnelmgr;
+    payloadTunnelmgr = NULL;
 #ifdef HAVE_CUDA
     delete tunnelRmgr;
     delete tunnelDmgr;
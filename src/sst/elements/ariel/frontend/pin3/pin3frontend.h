@@ -26,6 +26,7 @@
 
 #include <string>
 #include <map>
+#include <vector>
 
 #include "arielfrontend.h"
 #include "ariel_shmem.h"
@@ -57,6 +58,7 @@ class Pin3Frontend : public ArielFrontend {
         {"arieltool", "Path to the Ariel PIN-tool shared library", ""},
         {"launcher", "Specify the launcher to be used for instrumentation, default is path to PIN", STRINGIZE(PINTOOL_EXECUTABLE)},
         {"executable", "Executable to trace", ""},
+        {"attachpid", "Attach PIN to this already running process instead of launching executable, so its initialization is not repeated for every simulation. The process must not be traced yet and is killed when the simulation ends early", "0"},
         {"appstdin", "Specify a file to use for the program's stdin", ""},
         {"appstdout", "Specify a file to use for the program's stdout", ""},
         {"appstdoutappend", "If appstdout is set, set this to 1 to append the file intead of overwriting", "0"},
@@ -68,6 +70,9 @@ class Pin3Frontend : public ArielFrontend {
         {"mpilauncher", "Specify a launcher to be used for MPI executables in conjuction with <launcher>", STRINGIZE(MPILAUNCHER_EXECUTABLE)},
         {"mpiranks", "Number of ranks to be launched by <mpilauncher>. Only <mpitracerank> will be traced by <launcher>.", "1" },
         {"mpitracerank", "Rank to be traced by <launcher>.", "0" },
+        {"mpitraceranks", "Comma separated list of all ranks to trace, each by its own ArielCPU which may live on another SST rank. Every one of them sets the same list and its own entry as <mpitracerank>. The first rank in the list runs <mpilauncher>. Empty traces only <mpitracerank>.", "" },
+        {"mpirendezvous", "Directory shared by all ArielCPUs of <mpitraceranks> through which they hand their PIN command to the one running <mpilauncher>.", "ariel-mpi" },
+        {"mpidilation", "Let untraced ranks run only 1/<mpidilation> of the time so they keep pace with the ranks under PIN. 1 runs them natively.", "1" },
         {"envparamcount", "Number of environment parameters to supply to the Ariel executable, default=-1 (use SST environment)", "-1"},
         {"envparamname%(envparamcount)d", "Sets the environment parameter name", ""},
         {"envparamval%(envparamcount)d", "Sets the environment parameter value", ""},
@@ -79,6 +84,7 @@ class Pin3Frontend : public ArielFrontend {
         {"mallocmapfile", "File with valid 'ariel_malloc_flag' ids", ""},
         {"tracePrefix", "Prefix when tracing is enable", ""},
         {"writepayloadtrace", "Trace write payloads and put real memory contents into the memory system", "0"},
+        {"tunnelbatching", "Pack instruction records into batched tunnel messages to reduce tunnel traffic. Ignored if writepayloadtrace is set. 0 = disabled, 1 = enabled", "0"},
         {"instrument_instructions", "turn on or off instruction instrumentation in fesimple", "1"})
 
         /* Ariel class */
@@ -89,6 +95,7 @@ class Pin3Frontend : public ArielFrontend {
         virtual void setup() {}
         virtual void finish();
         virtual ArielTunnel* getTunnel();
+        virtual ArielPayloadTunnel* getPayloadTunnel();
 
 #ifdef HAVE_CUDA
         virtual GpuReturnTunnel* getReturnTunnel();
@@ -99,15 +106,23 @@ class Pin3Frontend : public ArielFrontend {
 
         int forkPINChild(const char* app, char** args, std::map<std::string, std::string>& app_env, redirect_info_t redirect_info);
 
+        std::string rendezvousFile(int rank);
+        void writeRendezvousFile();
+
         SST::Output* output;
 
         pid_t child_pid;
+        pid_t attachPid;
 
         uint32_t core_count;
         SST::Core::Interprocess::MMAPParent<ArielTunnel>* tunnelmgr;
 
         ArielTunnel* tunnel;
 
+        // Only created when write payloads are traced
+        SST::Core::Interprocess::MMAPParent<ArielPayloadTunnel>* payloadTunnelmgr;
+        ArielPayloadTunnel* payloadTunnel;
+
 #ifdef HAVE_CUDA
         SST::Core::Interprocess::MMAPParent<GpuReturnTunnel>* tunnelRmgr;
         SST::Core::Interprocess::MMAPParent<GpuDataTunnel>* tunnelDmgr;
@@ -125,6 +140,12 @@ class Pin3Frontend : public ArielFrontend {
         int mpitracerank;
         bool use_mpilauncher;
 
+        // Multi-rank tracing, only the leader runs the MPI launcher
+        std::vector<int> mpitraceset;
+        std::string mpirendezvous;
+        double mpidilation;
+        bool mpileader;
+
 
         char **execute_args;
         std::map<std::string, std::string> execute_env;
@@ -0,0 +1,47 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include <sst_config.h>
+
+#include "replayfrontend.h"
+
+using namespace SST::ArielComponent;
+
+ReplayFrontend::ReplayFrontend(ComponentId_t id, Params& params, uint32_t cores, uint32_t qSize, uint32_t memPool) :
+        ArielFrontend(id, params, cores, qSize, memPool) {
+
+    int verbosity = params.find<int>("verbose", 0);
+    output = new SST::Output("ReplayFrontend[@f:@l:@p] ", verbosity, 0, SST::Output::STDOUT);
+
+    std::string tracePath = params.find<std::string>("trace", "");
+    if (tracePath == "") {
+        output->fatal(CALL_INFO, -1, "Error: ariel.frontend.replay requires the 'trace' parameter\n");
+    }
+
+    reader = new ArielCommandTraceReader(tracePath, output);
+    if (reader->getCoreCount() > cores) {
+        output->fatal(CALL_INFO, -1, "Error: command trace '%s' was recorded with %" PRIu32 " cores, but only %" PRIu32 " are configured\n",
+                tracePath.c_str(), reader->getCoreCount(), cores);
+    }
+
+    for (uint32_t i = 0; i < reader->getCoreCount(); i++) {
+        output->verbose(CALL_INFO, 1, 0, "Replaying %" PRIu64 " commands for core %" PRIu32 " from %s\n",
+                reader->getCommandCount(i), i, tracePath.c_str());
+    }
+}
+
+ReplayFrontend::~ReplayFrontend() {
+    delete reader;
+}
@@ -0,0 +1,63 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_REPLAY_FRONTEND
+#define _H_REPLAY_FRONTEND
+
+#include <sst/core/sst_config.h>
+#include <sst/core/component.h>
+#include <sst/core/params.h>
+
+#include <stdint.h>
+
+#include <string>
+
+#include "arielfrontend.h"
+#include "arielcmdtrace.h"
+
+namespace SST {
+namespace ArielComponent {
+
+/** Frontend that replays a command trace recorded with ArielCPU's
+ * tunnel_record parameter instead of running the application.  Cores
+ * read their commands straight from the mapped trace, so there is no
+ * tunnel and replays are deterministic.
+ */
+class ReplayFrontend : public ArielFrontend {
+    public:
+
+    /* SST ELI */
+    SST_ELI_REGISTER_SUBCOMPONENT(ReplayFrontend, "ariel", "frontend.replay", SST_ELI_ELEMENT_VERSION(1,0,0), "Ariel frontend that replays a recorded command trace", SST::ArielComponent::ArielFrontend)
+
+    SST_ELI_DOCUMENT_PARAMS(
+        {"verbose", "Verbosity for debugging. Increased numbers for increased verbosity.", "0"},
+        {"trace", "Command trace to replay, as written by ArielCPU's tunnel_record parameter", ""})
+
+        ReplayFrontend(ComponentId_t id, Params& params, uint32_t cores, uint32_t qSize, uint32_t memPool);
+        ~ReplayFrontend();
+
+        virtual void init(unsigned int phase) { }
+        virtual ArielTunnel* getTunnel() { return NULL; }
+        virtual ArielCommandTraceReader* getCommandTrace() { return reader; }
+
+    private:
+        SST::Output* output;
+        ArielCommandTraceReader* reader;
+};
+
+}
+}
+
+#endif
@@ -383,21 +383,6 @@ VOID WriteInstructionWrite(ADDRINT* address, UINT32 writeSize, THREADID thr, ADD
     ac.inst.instClass = instClass;
     ac.inst.simdElemCount = simdOpWidth;
 
-    if( writeTrace ) {
-//      if( writeSize > ARIEL_MAX_PAYLOAD_SIZE ) {
-//          fprintf(stderr, "Error: Payload exceeds maximum size (%d > %d)\n",
-//              writeSize, ARIEL_MAX_PAYLOAD_SIZE);
-//          exit(-1);
-//      }
-        PIN_SafeCopy( &ac.inst.payload[0], address, ARIEL_MIN( writeSize, ARIEL_MAX_PAYLOAD_SIZE ) );
-    }
-/*
-    printf("CU Instruction %p ",address);
-    for(int i = 0; i < ARIEL_MIN(writeSize, ARIEL_MAX_PAYLOAD_SIZE); i++){
-        printf("%d ", ac.inst.payload[i]);
-    }
-    printf("\n");
-*/
     tunnel->writeMessage(thr, ac);
 }
 
@@ -1144,7 +1129,6 @@ __host__ cudaError_t CUDARTAPI cudaMemcpy(void *dst, const void *src, size_t cou
 
     //TunnelD supports 4k byte transfers
     size_t max_page_size = 1<<12;
-    uint8_t payload[max_page_size];
     size_t bytes_copied = 0;
     bool avail=false;
 
@@ -1188,49 +1172,26 @@ __host__ cudaError_t CUDARTAPI cudaMemcpy(void *dst, const void *src, size_t cou
     tunnel->writeMessage(thr, ac);
 
     if(final_kind == cudaMemcpyHostToDevice) {
-        if(count <= max_page_size){
-            // Single transfer (<=4k)
-            bytes_copied = PIN_SafeCopy(&payload, static_cast<const uint8_t*>(src), count);
-            memcpy(gd.page_4k, payload, count);
-            gd.count = count;
+        // Queue every 4k page back to back, writeMessage only blocks when the
+        // tunnel is full, then wait for the single ACK once Ariel has written
+        // all of the data to memory
+        uint64_t offset = 0;
+        do {
+            gd.count = ((count - offset) > max_page_size) ? max_page_size : (count - offset);
+            bytes_copied = PIN_SafeCopy(gd.page_4k, static_cast<const uint8_t*>(src)+offset, gd.count);
+            offset = offset + gd.count;
             tunnelD->writeMessage(thr, gd);
-            do {
-                avail = tunnelR->readMessageNB(thr, &gc);
-            } while (!avail);
-        }else {
-            // Multiple transfers (>4k)
-            size_t remainder = count % (1<<12);
-            size_t pages = count - remainder;
-            uint64_t offset = 0;
-            while((pages != 0) || (remainder != 0)){
-                if(pages != 0){
-                    // Transfer 4k page
-                    bytes_copied = PIN_SafeCopy(&payload, static_cast<const uint8_t*>(src)+offset, 1<<12);
-                    memcpy(gd.page_4k, payload, 1<<12);
-                    gd.count = (1<<12);
-                    pages = pages - (1<<12);
-                    offset = offset + (1<<12);
-                }else {
-                    // Transfer any remaining data smaller than 4k
-                    bytes_copied = PIN_SafeCopy(&payload, static_cast<const uint8_t*>(src)+offset, remainder);
-                    memcpy(gd.page_4k, payload, remainder);
-                    gd.count = remainder;
-                    remainder = 0;
-                }
-                tunnelD->writeMessage(thr, gd);
-                do {
-                    avail = tunnelR->readMessageNB(thr, &gc);
-                } while (!avail);
+        } while(offset < count);
 
-                // Clear flags and buffers for next page transfer
-                avail = false;
-                tunnelR->clearBuffer(thr);
-            }
+        do {
+            avail = tunnelR->readMessageNB(thr, &gc);
+        } while (!avail);
+        avail = false;
+        tunnelR->clearBuffer(thr);
 #ifdef ARIEL_DEBUG
-            printf("CUDA Transferred all Data\n");
-            fflush(stdout);
+        printf("CUDA Transferred all Data\n");
+        fflush(stdout);
 #endif
-        }
     } else if(final_kind==cudaMemcpyDeviceToHost) {
         if(count <= max_page_size){
             do {
@@ -1266,9 +1227,8 @@ __host__ cudaError_t CUDARTAPI cudaMemcpy(void *dst, const void *src, size_t cou
                     memcpy(data+offset, gd.page_4k, remainder);
                     remainder = 0;
                 }
-                tunnelD->clearBuffer(thr);
-                tunnelR->writeMessage(thr, gc);
-                // Clear flags and buffers for next page transfer
+                // Ariel queues the pages back to back, the following ones may
+                // already be in the tunnel so it must not be cleared
                 avail = false;
             }
             bytes_copied = PIN_SafeCopy((uint8_t*)dst, data, count);
@@ -1811,10 +1771,10 @@ int main(int argc, char *argv[])
         writeTrace = true;
     }
 
+    // Write payloads are sent on a separate tunnel that only the Pin 3 tool attaches to
     if( writeTrace ) {
-        if( SSTVerbosity.Value() > 0 ) {
-            printf("SSTARIEL: Performing write tracing (this is an expensive operation.)\n");
-        }
+        fprintf(stderr, "ARIEL-SST: Write tracing is not supported by this tool, use the Pin 3 tool\n");
+        exit(-1);
     }
 
     core_count = MaxCoreCount.Value();
@@ -11,6 +11,9 @@
 #include <cassert>
 #include <cerrno>
 #include <csignal>
+#include <fstream>
+#include <map>
+#include <vector>
 #include <sys/wait.h>
 
 /*
@@ -21,6 +24,13 @@
  *  will run there. If multiple ranks are found, a single rank
  *  will run on the node with SST, and the remaining
  *  ranks will be distributed on the other nodes.
+ *
+ *  More ranks can be traced with -T <rank> <file>. Each file holds
+ *  the pin command line of another ArielCPU, written there through
+ *  its rendezvous directory, and is removed once read. With
+ *  -D <factor>, untraced ranks are launched through
+ *  `mpilauncher --dilate <factor>` which lets them run only
+ *  1/<factor> of the time.
  */
 
 int pid = 0; // global so we can use it in the signal handler
@@ -30,19 +40,72 @@ void signalHandler(int signum) {
     std::cout << "Caught signal " << signum << ", exiting gracefully." << std::endl;
     if (pid != 0) {
         kill(pid, signum);
+        // A dilated child may be stopped and would not see the signal
+        kill(pid, SIGCONT);
     }
     exit(0);
 }
 
+// Run a program, alternately stopping and continuing it so it only
+// gets 1/factor of the wall clock time
+int dilate(double factor, char* argv[]) {
+    const useconds_t run_slice = 10000;
+    const useconds_t stop_slice = (useconds_t) (run_slice * (factor - 1.0));
+
+    pid = fork();
+    if (pid == -1) {
+        printf("mpilauncher.cc: fork error: %d, %s\n", errno, strerror(errno));
+        exit(-1);
+    } else if (pid == 0) {
+        execvp(argv[0], argv);
+        printf("Error: mpilauncher.cc: execvp error: %d, %s\n", errno, strerror(errno));
+        exit(1);
+    }
+
+    int status = 0;
+    while (true) {
+        usleep(run_slice);
+        if (waitpid(pid, &status, WNOHANG) == pid) break;
+        if (stop_slice > 0) {
+            kill(pid, SIGSTOP);
+            usleep(stop_slice);
+            kill(pid, SIGCONT);
+        }
+    }
+    return WIFEXITED(status) ? WEXITSTATUS(status) : 1;
+}
+
+// Wait for another ArielCPU to hand over its pin command line
+std::string readPinFile(const std::string& file) {
+    const int max_wait_s = 600;
+    for (int waited = 0; access(file.c_str(), R_OK) != 0; waited++) {
+        if (waited == max_wait_s * 10) {
+            printf("Error: mpilauncher.cc: timed out waiting for %s\n", file.c_str());
+            exit(1);
+        }
+        usleep(100000);
+    }
+    std::ifstream in(file);
+    std::string cmd;
+    std::getline(in, cmd);
+    unlink(file.c_str());
+    return cmd;
+}
+
 int main(int argc, char *argv[]) {
 
+    signal(SIGTERM, signalHandler);
+
+    if (argc >= 4 && std::string(argv[1]).compare("--dilate") == 0) {
+        return dilate(atof(argv[2]), &argv[3]);
+    }
+
     if (argc < 4 || std::string(argv[1]).compare("-H") == 0) {
-        std::cout << "Usage: " << argv[0] << " <nprocs> <tracerank> <pin-binary> [pin args] -- <program-binary> [program args]\n";
+        std::cout << "Usage: " << argv[0] << " <nprocs> <tracerank> [-T <rank> <pin-file>]... [-D <factor>] <pin-binary> [pin args] -- <program-binary> [program args]\n";
+        std::cout << "       " << argv[0] << " --dilate <factor> <program-binary> [program args]\n";
         exit(1);
     }
 
-    signal(SIGTERM, signalHandler);
-
     std::array<char, 128> buffer;
 
     // Get node that SST is running on.
@@ -68,12 +131,30 @@ int main(int argc, char *argv[]) {
         exit(1);
     }
 
-    // In order to trace the appropriate rank, determine how many
-    // should launch before the traced rank, and how many should launch after
-    int ranks_before = tracerank;
-    int ranks_after = procs - tracerank - 1;
-    if (ranks_after < 0) {
-        ranks_after = 0;
+    // Other traced ranks and the dilation of untraced ones
+    std::map<int, std::string> pinfiles;
+    double dilation = 1.0;
+    int first = 3;
+    while (first + 1 < argc) {
+        std::string opt = argv[first];
+        if (opt == "-T" && first + 2 < argc) {
+            int rank = atoi(argv[first+1]);
+            if (rank < 0 || rank >= procs || rank == tracerank || pinfiles.count(rank)) {
+                printf("Error: %s: -T rank %d is out of range or traced twice\n", argv[0], rank);
+                exit(1);
+            }
+            pinfiles[rank] = argv[first+2];
+            first += 3;
+        } else if (opt == "-D") {
+            dilation = atof(argv[first+1]);
+            if (dilation < 1.0) {
+                printf("Error: %s: -D <factor> must be at least 1\n", argv[0]);
+                exit(1);
+            }
+            first += 2;
+        } else {
+            break;
+        }
     }
 
     // `pinstring` will contain the command to launch pin and all of its arguments
@@ -82,7 +163,7 @@ int main(int argc, char *argv[]) {
     std::string binary = "";
     bool getbinary = false;
     std::string arg;
-    for (int i = 3; i < argc; i++) {
+    for (int i = first; i < argc; i++) {
         arg = argv[i];
 
         // Pin string
@@ -99,33 +180,44 @@ int main(int argc, char *argv[]) {
             getbinary = true;
     }
 
-    // Build the mpirun command
-    std::string mpicmd = "mpirun --oversubscribe";
+    // Every traced rank runs its own pin command
+    std::map<int, std::string> traced;
+    traced[tracerank] = pinstring;
+    for (auto& pf : pinfiles) {
+        traced[pf.first] = readPinFile(pf.second);
+    }
 
-    if (ranks_before > 0) {
-        mpicmd += " -H ";
-        mpicmd += host;
-        mpicmd += " -np ";
-        mpicmd += std::to_string(ranks_before);
-        mpicmd += " ";
-        mpicmd += binary;
-        mpicmd += " : ";
+    std::string untraced = binary;
+    if (dilation > 1.0) {
+        untraced = std::string(argv[0]) + " --dilate " + std::to_string(dilation) + " " + binary;
     }
 
-    mpicmd += " -H ";
-    mpicmd += host;
-    mpicmd += " -np ";
-    mpicmd += std::to_string(1);
-    mpicmd += " ";
-    mpicmd += pinstring;
+    // Build the mpirun command, one app context per traced rank
+    // and one for each run of untraced ranks in between
+    std::vector<std::pair<int, std::string>> contexts;
+    int next = 0;
+    for (auto& t : traced) {
+        if (t.first > next) {
+            contexts.push_back(std::make_pair(t.first - next, untraced));
+        }
+        contexts.push_back(std::make_pair(1, t.second));
+        next = t.first + 1;
+    }
+    if (procs > next) {
+        contexts.push_back(std::make_pair(procs - next, untraced));
+    }
 
-    if (ranks_after > 0) {
-        mpicmd += " : -H ";
+    std::string mpicmd = "mpirun --oversubscribe";
+    for (size_t i = 0; i < contexts.size(); i++) {
+        if (i > 0) {
+            mpicmd += " :";
+        }
+        mpicmd += " -H ";
         mpicmd += host;
         mpicmd += " -np ";
-        mpicmd += std::to_string(ranks_after);
+        mpicmd += std::to_string(contexts[i].first);
         mpicmd += " ";
-        mpicmd += binary;
+        mpicmd += contexts[i].second;
     }
 
     int use_system = 0;
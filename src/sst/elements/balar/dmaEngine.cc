@@ -64,6 +64,23 @@ DMAEngine::DMAEngine(ComponentId_t id, Params &params) : SST::Component(id) {
     // Set MMIO address for dma Engine
     iface->setMemoryMappedAddressRegion(mmio_addr, mmio_size);
 
+    // Functional copy and analytical link model
+    functional = params.find<bool>("functional", false);
+    functional_chunk_size = params.find<uint32_t>("functional_chunk_size", 64);
+    if (functional_chunk_size == 0) {
+        out.fatal(CALL_INFO, -1, "%s, Error - Invalid param: functional_chunk_size. Must be > 0\n", getName().c_str());
+    }
+    link_latency_ns = params.find<UnitAlgebra>("link_latency", "1us").getValue().toDouble() * 1e9;
+    UnitAlgebra link_bw = params.find<UnitAlgebra>("link_bandwidth", "16GB/s");
+    if (!link_bw.hasUnits("B/s") || link_bw.getValue().toDouble() <= 0) {
+        out.fatal(CALL_INFO, -1, "%s, Error - Invalid param: link_bandwidth. Must have units of B/s and be > 0. "
+                "(SI prefixes ok). You specified '%s'\n", getName().c_str(), link_bw.toString().c_str());
+    }
+    link_bandwidth_Bpns = link_bw.getValue().toDouble() / 1e9;
+    link_contention = params.find<double>("link_contention", 1.0);
+    outstanding = 0;
+    done_time = 0;
+
     // Initialize handlers
     handlers = new DMAHandlers(this, &out);
     
@@ -89,7 +106,10 @@ void DMAEngine::setup() {
  * @return false 
  */
 bool DMAEngine::tick(SST::Cycle_t x) {
-    if (dma_ctrl_regs.status == DMA_BUSY) {
+    if (dma_ctrl_regs.status == DMA_BUSY && functional) {
+        issueFunctional();
+        return false;
+    } else if (dma_ctrl_regs.status == DMA_BUSY) {
         // Perform DMA copy
 
         // Make a request
@@ -150,6 +170,11 @@ bool DMAEngine::tick(SST::Cycle_t x) {
         // The DONE flag will be marked in writeresp handler if the data size is 0
         return false;
     } else if (dma_ctrl_regs.status == DMA_DONE) {
+        // The link model can take longer than the memory did
+        if (functional && getCurrentSimTimeNano() < done_time) {
+            return false;
+        }
+
         // Reset error flag and send back response
         dma_ctrl_regs.status = DMA_FREE;
         dma_ctrl_regs.errflag = DMA_OK;
@@ -167,6 +192,45 @@ bool DMAEngine::tick(SST::Cycle_t x) {
     }
 }
 
+/**
+ * @brief Issue a whole copy at once in chunk sized requests and set
+ *        the time it is done by the link model. The data still moves
+ *        through memory so the SST memspace stays coherent, but with a
+ *        line per request instead of transfer_size per cycle
+ */
+void DMAEngine::issueFunctional() {
+    size_t bytes = dma_ctrl_regs.data_size;
+
+    while (dma_ctrl_regs.data_size > 0) {
+        Addr addr = dma_ctrl_regs.sst_mem_addr;
+        size_t size = functional_chunk_size - (addr % functional_chunk_size);
+        if (size > dma_ctrl_regs.data_size) {
+            size = dma_ctrl_regs.data_size;
+        }
+
+        StandardMem::Request* req;
+        if (dma_ctrl_regs.dir == SIM_TO_SST) {
+            std::vector<uint8_t> data(dma_ctrl_regs.simulator_mem_addr, dma_ctrl_regs.simulator_mem_addr + size);
+            req = new StandardMem::Write(addr, size, data, false);
+        } else if (dma_ctrl_regs.dir == SST_TO_SIM) {
+            req = new StandardMem::Read(addr, size);
+            pending_reads[req->getID()] = dma_ctrl_regs.simulator_mem_addr;
+        } else {
+            out.fatal(CALL_INFO, -1, "%s: invalid DMA copy direction!\n", this->getName().c_str());
+        }
+
+        dma_ctrl_regs.data_size -= size;
+        dma_ctrl_regs.sst_mem_addr += size;
+        dma_ctrl_regs.simulator_mem_addr += size;
+        outstanding++;
+        iface->send(req);
+    }
+
+    double transfer_ns = link_latency_ns + (bytes / link_bandwidth_Bpns) * link_contention;
+    done_time = getCurrentSimTimeNano() + (SimTime_t) transfer_ns;
+    dma_ctrl_regs.status = outstanding ? DMA_WAITING_DONE : DMA_DONE;
+}
+
 void DMAEngine::handleEvent(StandardMem::Request* req) {
     req->handle(handlers);
 }
@@ -209,7 +273,7 @@ void DMAEngine::DMAHandlers::handle(StandardMem::Write* write) {
         // Write the control status register
         DMAEngineControlRegisters* reg_ptr = decode_balar_packet<DMAEngineControlRegisters>(&(write->data)); 
         
-        if (reg_ptr->data_size % reg_ptr->transfer_size != 0) {
+        if (!dma->functional && reg_ptr->data_size % reg_ptr->transfer_size != 0) {
             out->fatal(CALL_INFO, -1, "%s: invalid DMA config!\n", dma->getName().c_str());
         }
         
@@ -233,6 +297,21 @@ void DMAEngine::DMAHandlers::handle(StandardMem::Write* write) {
  * @param read 
  */
 void DMAEngine::DMAHandlers::handle(StandardMem::ReadResp* resp) {
+    if (dma->functional) {
+        auto it = dma->pending_reads.find(resp->getID());
+        if (it == dma->pending_reads.end()) {
+            out->fatal(CALL_INFO, -1, "%s: read response for an unknown request!\n", dma->getName().c_str());
+        }
+        std::copy(resp->data.begin(), resp->data.end(), it->second);
+        dma->pending_reads.erase(it);
+
+        if (--dma->outstanding == 0) {
+            dma->dma_ctrl_regs.status = DMA_DONE;
+        }
+        delete resp;
+        return;
+    }
+
     // Find the simulator buffer pointer value by offset
     // of the sst mem space addr
     size_t offset = (dma->dma_ctrl_regs.sst_mem_addr - (resp->pAddr));
@@ -260,6 +339,14 @@ void DMAEngine::DMAHandlers::handle(StandardMem::ReadResp* resp) {
  * @param write 
  */
 void DMAEngine::DMAHandlers::handle(StandardMem::WriteResp* resp) {
+    if (dma->functional) {
+        if (--dma->outstanding == 0) {
+            dma->dma_ctrl_regs.status = DMA_DONE;
+        }
+        delete resp;
+        return;
+    }
+
     // Check if this is the last copy
     // Assuming the requests sent to memory are completed in order
     if (resp->pAddr == dma->dma_ctrl_regs.sst_mem_addr && 
@@ -32,6 +32,9 @@
 #include <sst/core/component.h>
 #include <sst/core/interfaces/stdMem.h>
 
+#include <algorithm>
+#include <unordered_map>
+
 #include "sst/elements/memHierarchy/util.h"
 #include "sst/elements/memHierarchy/memTypes.h"
 
@@ -55,6 +58,11 @@ public:
         {"clock",                   "(UnitAlgebra/string) Clock frequency", "1GHz"},
         {"mmio_addr",               "(uint) Starting addr mapped to the device", "0"},
         {"mmio_size",               "(uint) Size of the MMIO memory range (Bytes)", "512"},
+        {"functional",              "(bool) Issue a copy all at once in functional_chunk_size requests and time it with the link model below, instead of one transfer_size request per cycle", "false"},
+        {"functional_chunk_size",   "(uint) Bytes per request in functional mode, requests do not cross a multiple of this, use the cache line size", "64"},
+        {"link_latency",            "(UnitAlgebra/string) Functional mode, fixed latency of a copy", "1us"},
+        {"link_bandwidth",          "(UnitAlgebra/string) Functional mode, bandwidth of the PCIe/NVLink link", "16GB/s"},
+        {"link_contention",         "(float) Functional mode, factor applied to the transfer time for a shared link", "1.0"},
     )
     SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS( 
         {"iface", "Interface into interconnect", "SST::Interfaces::StandardMem"},
@@ -159,6 +167,22 @@ private:
     /* Save pending transfer and notify host once finishes */
     StandardMem::Write* pending_transfer;
 
+    /* Functional mode, see `functional` param */
+    bool functional;
+    uint32_t functional_chunk_size;
+    double link_latency_ns;
+    double link_bandwidth_Bpns;
+    double link_contention;
+
+    // Requests still in memory, DONE is not reported before done_time (ns)
+    uint64_t outstanding;
+    SimTime_t done_time;
+
+    // Simulator buffer pointers for in flight reads
+    std::unordered_map<StandardMem::Request::id_t, uint8_t*> pending_reads;
+
+    void issueFunctional();
+
 
     /* Debug -triggered by output.fatal() and/or SIGUSR2 */
     virtual void emergencyShutdown() {};
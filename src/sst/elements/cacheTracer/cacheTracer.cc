@@ -15,6 +15,7 @@
 
 #include "sst_config.h"
 #include <cmath>
+#include <cstring>
 
 #include "cacheTracer.h"
 
@@ -50,6 +51,8 @@ cacheTracer::cacheTracer( ComponentId_t id, Params& params ): Component( id ) {
     registerClock( frequency, new Clock::Handler<cacheTracer>(this, &cacheTracer::clock) );
     out->debug(CALL_INFO, 1, 0, "Clock registered\n");
 
+    traceFile = NULL;
+    traceWriter = NULL;
     string tracePrefix = params.find<std::string>("tracePrefix", "");
     if("" == tracePrefix){
         out->debug(CALL_INFO, 1, 0, "Tracing Not Enabled.\n");
@@ -59,9 +62,24 @@ cacheTracer::cacheTracer( ComponentId_t id, Params& params ): Component( id ) {
         char* traceFilePath = (char*) malloc( sizeof(char) * (tracePrefix.size()+ 20) );
         snprintf(traceFilePath, (tracePrefix.size()+ 20), "%s", tracePrefix.c_str());
         out->output("Writing trace to file: %s\n", traceFilePath);
-        traceFile = fopen(traceFilePath, "wt");
+        string traceFormat = params.find<std::string>("traceFormat", "text");
+        if (traceFormat == "binary") {
+            traceFile = fopen(traceFilePath, "wb");
+        } else if (traceFormat == "text") {
+            traceFile = fopen(traceFilePath, "wt");
+        } else {
+            out->fatal(CALL_INFO, -1, "Invalid param: traceFormat - must be 'text' or 'binary'. You specified '%s'.\n", traceFormat.c_str());
+        }
+        if (traceFile == NULL) {
+            out->fatal(CALL_INFO, -1, "Unable to open trace file '%s'.\n", traceFilePath);
+        }
         free(traceFilePath);
         writeTrace = true;
+        if (traceFormat == "binary") {
+            size_t blockRecords = params.find<size_t>("traceBlockRecords", 65536);
+            int compression = params.find<int>("traceCompression", 1);
+            traceWriter = new TraceWriter(traceFile, blockRecords, compression);
+        }
     }
 
     string statsPrefix = params.find<std::string>("statsPrefix", "");
@@ -130,23 +148,13 @@ bool cacheTracer::clock(Cycle_t current){
 
         // Append address info into Histogram
         pageNum = addr/pageSize;
-        if(pageNum >= AddrHist.size()) {
-             AddrHist.resize(pageNum + 100);
-        }
         AddrHist[pageNum]+=1;
         // For this request, record its ID & current_time to calculate access-latency when response arrives in nanoseconds intervals
         //InFlightReqQueue[me->getID()] = timestamp;
         InFlightReqQueue[me->getID()] = nanoseconds;
 
-        if(writeDebug_8 & writeTrace){
-             fprintf(traceFile,"NB: Addr: 0x%" PRIu64, addr);
-             fprintf(traceFile, " timestamp: %" PRIu64, timestamp);
-             fprintf(traceFile, " Cmd: %u", me->getCmd());
-             fprintf(traceFile, " ID: %" PRIu64 "-%d", me->getID().first, me->getID().second);
-             fprintf(traceFile, " ResponseID: %" PRIu64 "-%d", me->getResponseToID().first, me->getResponseToID().second);
-             //fprintf(traceFile, " @%" PRIu64, picoseconds);
-             fprintf(traceFile, " @%" PRIu64 " ns", nanoseconds);
-             fprintf(traceFile, "\n");
+        if (writeTrace) {
+            TraceEvent(me, false, nanoseconds);
         }
 
         // Send the request to south-bus
@@ -171,25 +179,16 @@ bool cacheTracer::clock(Cycle_t current){
         AddrHist[pageNum]+= 1;
         */
 
-        if(InFlightReqQueue.find(me->getResponseToID()) != InFlightReqQueue.end()){
-           //accessLatency = timestamp - InFlightReqQueue[me->getResponseToID()];
-           accessLatency = nanoseconds - (InFlightReqQueue[me->getResponseToID()]);
-           if(accessLatency >= AccessLatencyDist.size()) {
-               AccessLatencyDist.resize(accessLatency+100);
-           }
+        map<MemEvent::id_type,uint64_t>::iterator inFlight = InFlightReqQueue.find(me->getResponseToID());
+        if(inFlight != InFlightReqQueue.end()){
+           //accessLatency = timestamp - inFlight->second;
+           accessLatency = nanoseconds - inFlight->second;
            AccessLatencyDist[accessLatency] += 1;
-           InFlightReqQueue.erase(me->getResponseToID());
+           InFlightReqQueue.erase(inFlight);
         }
 
-        if(writeDebug_8 & writeTrace){
-             fprintf(traceFile,"SB: Addr: 0x%" PRIu64, me->getAddr());
-             fprintf(traceFile, " timestamp: %" PRIu64, timestamp);
-             fprintf(traceFile, " Cmd: %u", me->getCmd());
-             fprintf(traceFile, " ID: %" PRIu64 "-%d", me->getID().first, me->getID().second);
-             fprintf(traceFile, " ResponseID: %" PRIu64 "-%d", me->getResponseToID().first, me->getResponseToID().second);
-             //fprintf(traceFile, " @%" PRIu64, picoseconds);
-             fprintf(traceFile, " @%" PRIu64 " ns", nanoseconds);
-             fprintf(traceFile, "\n");
+        if (writeTrace) {
+            TraceEvent(me, true, nanoseconds);
         }
 
        // Send the request to north-bus
@@ -209,10 +208,36 @@ void cacheTracer::finish(){
         }
     } // if stats()
     if(writeTrace){
+       if (traceWriter) {
+           traceWriter->close();
+           delete traceWriter;
+           traceWriter = NULL;
+       }
        fclose(traceFile);
     }
 } // finish()
 
+void cacheTracer::TraceEvent(MemEvent* me, bool fromSouth, uint64_t nanoseconds){
+    if (traceWriter) {
+        TraceRecord record;
+        memset(&record, 0, sizeof(record));
+        record.addr = me->getAddr();
+        record.timestamp = timestamp;
+        record.nanoseconds = nanoseconds;
+        record.id = me->getID().first;
+        record.idSrc = me->getID().second;
+        record.responseToId = me->getResponseToID().first;
+        record.responseToIdSrc = me->getResponseToID().second;
+        record.direction = fromSouth ? 1 : 0;
+        record.cmd = (uint8_t)me->getCmd();
+        traceWriter->write(record);
+    } else if (writeDebug_8) {
+        fprintf(traceFile, "%s: Addr: 0x%" PRIu64 " timestamp: %" PRIu64 " Cmd: %u ID: %" PRIu64 "-%d ResponseID: %" PRIu64 "-%d @%" PRIu64 " ns\n",
+                fromSouth ? "SB" : "NB", me->getAddr(), timestamp, me->getCmd(), me->getID().first, me->getID().second,
+                me->getResponseToID().first, me->getResponseToID().second, nanoseconds);
+    }
+}
+
 
 void cacheTracer::FinalStats(FILE *fp, unsigned int numBins){
     // print stats
@@ -228,16 +253,15 @@ void cacheTracer::FinalStats(FILE *fp, unsigned int numBins){
     PrintAccessLatencyDistribution(fp, numBins);
 }
 
-void cacheTracer::PrintAddrHistogram(FILE *fp, vector<SST::MemHierarchy::Addr> bucketList){
+void cacheTracer::PrintAddrHistogram(FILE *fp, const map<SST::MemHierarchy::Addr, uint64_t>& bucketList){
     unsigned int count = 0;
     fprintf(fp, "Address Histogram:\n");
     fprintf(fp, "-----------------------------------------------------------------\n");
     fprintf(fp, "Address_Range: Count\n");
-    for (unsigned int i=0; i<bucketList.size(); i++){
-        if(bucketList.at(i) > 0){
-            fprintf(fp, "- [%u-%u]: %" PRIu64 "\n", (i*pageSize),(((i+1)*pageSize)-1), bucketList.at(i));
-            count += bucketList.at(i);
-        }
+    for (map<SST::MemHierarchy::Addr, uint64_t>::const_iterator it = bucketList.begin(); it != bucketList.end(); it++){
+        unsigned int i = it->first;
+        fprintf(fp, "- [%u-%u]: %" PRIu64 "\n", (i*pageSize),(((i+1)*pageSize)-1), it->second);
+        count += it->second;
     }
     fprintf(fp, "-----------------------------------------------------------------\n");
     fprintf(fp, "- Total_Events_Address: %u\n", count);
@@ -249,20 +273,13 @@ void cacheTracer::PrintAccessLatencyDistribution(FILE* fp, unsigned int numBins)
     unsigned int count = 0;
     unsigned int minLat = 0;
     unsigned int maxLat = 0;
-    bool minSet = false;
-    for (unsigned int i=0; i<AccessLatencyDist.size(); i++){
-        if (AccessLatencyDist[i] > 0) {
-            if(!minSet) {
-               minLat = i;
-               maxLat = i;
-               minSet = true;
-            }
-            if (i > maxLat){
-               maxLat = i;
-            }
-            count += AccessLatencyDist[i];
-        }
-    } // for()
+    if (!AccessLatencyDist.empty()) {
+        minLat = AccessLatencyDist.begin()->first;
+        maxLat = AccessLatencyDist.rbegin()->first;
+    }
+    for (map<unsigned int, unsigned int>::iterator it = AccessLatencyDist.begin(); it != AccessLatencyDist.end(); it++){
+        count += it->second;
+    }
 
     fprintf(fp, "Access Latency Distribution (ns):\n");
     fprintf(fp, "-----------------------------------------------------------------\n");
@@ -281,11 +298,12 @@ void cacheTracer::PrintAccessLatencyDistribution(FILE* fp, unsigned int numBins)
         float steps = (float) maxLat/numBins;
         unsigned int step = (unsigned int) ceil(steps);
         //fprintf(fp, "steps = %f\t step = %u\n", steps, step);
-        for (unsigned int i=0; i<AccessLatencyDist.size(); i++){
-            if(AccessLatencyDist[i] > 0) {
-                unsigned int binNum = i/step;
-                latencyHist[binNum] += AccessLatencyDist[i];
+        for (map<unsigned int, unsigned int>::iterator it = AccessLatencyDist.begin(); it != AccessLatencyDist.end(); it++){
+            unsigned int binNum = it->first/step;
+            if (binNum >= latencyHist.size()) {
+                latencyHist.resize(binNum + 1);  // maxLat is a multiple of numBins
             }
+            latencyHist[binNum] += it->second;
         }
         for (unsigned int i=0; i<latencyHist.size(); i++) {
             fprintf(fp, "- [%d-%d]: %d\n", i*step, (i+1)*step-1, latencyHist[i]);
@@ -33,6 +33,8 @@
 #include <fstream>
 #include <map>
 
+#include "traceWriter.h"
+
 using namespace std;
 using namespace SST;
 using namespace SST::MemHierarchy;
@@ -63,7 +65,10 @@ public:
     	{ "debug", "Print debug statements with increasing verbosity [0-10]", "0" },
     	{ "statistics", "0-No-stats, 1-print-stats", "0" },
     	{ "pageSize", "Page Size (bytes), used for selecting number of bins for address histogram ", "4096" },
-    	{"accessLatencyBins", "Number of bins for access latency histogram" "10" }
+    	{"accessLatencyBins", "Number of bins for access latency histogram" "10" },
+    	{ "traceFormat", "Format of the trace written to tracePrefix: 'text' (requires debug >= 8) or 'binary' (block-compressed records, see README)", "text" },
+    	{ "traceBlockRecords", "For binary traces, number of events per block", "65536" },
+    	{ "traceCompression", "For binary traces, zlib compression level for each block, 0 disables compression. Ignored if SST was built without libz.", "1" }
     )
 
     SST_ELI_DOCUMENT_PORTS(
@@ -75,11 +80,13 @@ private:
     // Functions
     bool clock(SST::Cycle_t);
     void FinalStats(FILE*, unsigned int);
-    void PrintAddrHistogram(FILE*, vector<SST::MemHierarchy::Addr>);
+    void PrintAddrHistogram(FILE*, const map<SST::MemHierarchy::Addr, uint64_t>&);
     void PrintAccessLatencyDistribution(FILE*, unsigned int);
+    void TraceEvent(MemEvent*, bool, uint64_t);
 
     Output* out;
     FILE* traceFile;
+    TraceWriter* traceWriter;   // Binary trace, NULL for text
     FILE* statsFile;
 
     // Links
@@ -100,8 +107,10 @@ private:
     unsigned int sbCount;
     uint64_t timestamp;
 
-    vector<SST::MemHierarchy::Addr>AddrHist;   // Address Histogram
-    vector<unsigned int> AccessLatencyDist;
+    // Histograms only hold bins that have been hit, so memory is bounded by the
+    // number of distinct pages and latencies rather than the largest of either
+    map<SST::MemHierarchy::Addr, uint64_t> AddrHist;   // Page -> count
+    map<unsigned int, unsigned int> AccessLatencyDist;  // Latency (ns) -> count
 
     map<MemEvent::id_type,uint64_t>InFlightReqQueue;
 
@@ -0,0 +1,115 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+
+#include "traceWriter.h"
+
+#ifdef HAVE_LIBZ
+#include <zlib.h>
+#endif
+
+using namespace SST::CACHETRACER;
+
+TraceWriter::TraceWriter(FILE* file, size_t recordsPerBlock, int compressionLevel) :
+    file_(file), recordsPerBlock_(recordsPerBlock ? recordsPerBlock : 1), compressionLevel_(compressionLevel),
+    closed_(false), done_(false) {
+
+    const char magic[8] = { 'S', 'S', 'T', 'C', 'T', 'R', 'C', '1' };
+    uint32_t recordSize = sizeof(TraceRecord);
+    fwrite(magic, 1, sizeof(magic), file_);
+    fwrite(&recordSize, sizeof(recordSize), 1, file_);
+
+    current_.reserve(recordsPerBlock_);
+    thread_ = std::thread(&TraceWriter::run, this);
+}
+
+TraceWriter::~TraceWriter() {
+    close();
+}
+
+void TraceWriter::close() {
+    if (closed_)
+        return;
+    closed_ = true;
+    if (!current_.empty())
+        submit();
+    {
+        std::lock_guard<std::mutex> lock(mutex_);
+        done_ = true;
+    }
+    cv_.notify_all();
+    thread_.join();
+}
+
+/* Hand the current block to the writer thread and start a new one */
+void TraceWriter::submit() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    cv_.wait(lock, [this] { return full_.size() < maxPendingBlocks; });
+    full_.push_back(std::vector<TraceRecord>());
+    full_.back().swap(current_);
+    if (!free_.empty()) {
+        current_.swap(free_.back());
+        free_.pop_back();
+    }
+    lock.unlock();
+    cv_.notify_all();
+    current_.clear();
+    current_.reserve(recordsPerBlock_);
+}
+
+void TraceWriter::run() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    while (true) {
+        cv_.wait(lock, [this] { return done_ || !full_.empty(); });
+        if (full_.empty())
+            return; // done_ and nothing left to write
+
+        std::vector<TraceRecord> block;
+        block.swap(full_.front());
+        full_.pop_front();
+        lock.unlock();
+        cv_.notify_all();
+
+        writeBlock(block);
+
+        lock.lock();
+        free_.push_back(std::vector<TraceRecord>());
+        free_.back().swap(block);
+    }
+}
+
+void TraceWriter::writeBlock(std::vector<TraceRecord>& block) {
+    uint32_t header[3];
+    header[0] = block.size();
+    header[1] = 0;
+    header[2] = block.size() * sizeof(TraceRecord);
+    const unsigned char* payload = reinterpret_cast<const unsigned char*>(block.data());
+
+#ifdef HAVE_LIBZ
+    if (compressionLevel_ != 0) {
+        uLongf size = compressBound(header[2]);
+        compressed_.resize(size);
+        if (compress2(compressed_.data(), &size, payload, header[2], compressionLevel_) == Z_OK && size < header[2]) {
+            header[1] = 1;
+            header[2] = size;
+            payload = compressed_.data();
+        }
+    }
+#endif
+
+    fwrite(header, sizeof(header), 1, file_);
+    fwrite(payload, 1, header[2], file_);
+}
@@ -0,0 +1,96 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _CACHETRACER_TRACEWRITER_H
+#define _CACHETRACER_TRACEWRITER_H
+
+#include <stdint.h>
+#include <stdio.h>
+
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+namespace SST{
+namespace CACHETRACER {
+
+/*
+ * One event in a binary trace, written in host byte order
+ */
+struct TraceRecord {
+    uint64_t addr;
+    uint64_t timestamp;         // cacheTracer clock cycles
+    uint64_t nanoseconds;
+    uint64_t id;
+    uint64_t responseToId;
+    uint32_t idSrc;
+    uint32_t responseToIdSrc;
+    uint8_t  direction;         // 0: northBus to southBus, 1: southBus to northBus
+    uint8_t  cmd;
+    uint8_t  pad[6];
+};
+
+/*
+ * Writes TraceRecords to a file in blocks, compressing and writing each full block
+ * on a background thread so the simulation only pays for copying the record.
+ *
+ * File layout: an 8-byte magic "SSTCTRC1", a uint32 record size, then blocks. Each block
+ * is a uint32 record count, a uint32 flag (1 if zlib-compressed), a uint32 payload size
+ * in bytes, and the payload. Blocks are compressed only when SST is built with libz.
+ */
+class TraceWriter {
+public:
+    TraceWriter(FILE* file, size_t recordsPerBlock, int compressionLevel);
+    ~TraceWriter();
+
+    void write(const TraceRecord& record) {
+        current_.push_back(record);
+        if (current_.size() == recordsPerBlock_)
+            submit();
+    }
+
+    /* Write out all buffered records and stop the writer thread */
+    void close();
+
+private:
+    void submit();
+    void run();
+    void writeBlock(std::vector<TraceRecord>& block);
+
+    FILE* file_;
+    size_t recordsPerBlock_;
+    int compressionLevel_;
+    bool closed_;
+
+    std::vector<TraceRecord> current_;
+    std::vector<unsigned char> compressed_;
+
+    // Shared with the writer thread
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::deque<std::vector<TraceRecord>> full_;     // Blocks waiting to be written
+    std::vector<std::vector<TraceRecord>> free_;    // Written blocks, reused by submit()
+    bool done_;
+    std::thread thread_;
+
+    static const size_t maxPendingBlocks = 4;       // Stall the simulation rather than buffer without bound
+};
+
+} // namespace CACHETRACER
+} // namespace SST
+
+#endif //_CACHETRACER_TRACEWRITER_H
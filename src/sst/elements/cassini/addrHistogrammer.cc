@@ -38,6 +38,49 @@ AddrHistogrammer::AddrHistogrammer(ComponentId_t id, Params& params) : CacheList
     rdHisto = registerStatistic<Addr>("histogram_reads");
     wrHisto = registerStatistic<Addr>("histogram_writes");
 
+    sketch = NULL;
+    sketchOut = NULL;
+    epochCount = 0;
+
+    uint32_t sketchWidth = params.find<uint32_t>("sketch_width", 0);
+    if (sketchWidth > 0) {
+        sketch = new AddrSketch(sketchWidth, params.find<uint32_t>("sketch_depth", 4),
+                                params.find<uint32_t>("heavy_hitters", 16));
+
+        UnitAlgebra bin_u(params.find<std::string>("sketch_bin", "4KiB"));
+        sketchBin = bin_u.getRoundedValue();
+        if (sketchBin == 0) sketchBin = 1;
+        sketchEpoch = params.find<uint64_t>("sketch_epoch", 0);
+
+        std::string outFile = params.find<std::string>("sketch_output", "");
+        if (outFile == "") {
+            sketchOut = new Output("", 0, 0, Output::STDOUT);
+        } else {
+            sketchOut = new Output("", 0, 0, Output::FILE, outFile);
+        }
+    }
+}
+
+AddrHistogrammer::~AddrHistogrammer() {
+    delete sketch;
+    delete sketchOut;
+}
+
+void AddrHistogrammer::dumpSketch() {
+    std::vector<std::pair<uint64_t, uint64_t> > hitters = sketch->heavyHitters();
+
+    sketchOut->output("AddrHistogrammer %s epoch %" PRIu64 ": %" PRIu64 " misses, %" PRIu64 " byte bins\n",
+        getName().c_str(), epochCount, sketch->total(), sketchBin);
+    for (size_t i = 0; i < hitters.size(); i++) {
+        sketchOut->output("  0x%" PRIx64 " %" PRIu64 "\n", hitters[i].first * sketchBin, hitters[i].second);
+    }
+
+    sketch->clear();
+    epochCount++;
+}
+
+void AddrHistogrammer::printStats(Output &out) {
+    if (sketch && (sketch->total() > 0 || epochCount == 0)) dumpSketch();
 }
 
 
@@ -56,6 +99,11 @@ void AddrHistogrammer::notifyAccess(const CacheListenerNotification& notify) {
 
     if(notifyType == EVICT || notifyResType != MISS || vaddr >= cutoff) return;
 
+    if (sketch && (notifyType == READ || notifyType == WRITE)) {
+        sketch->add(vaddr / sketchBin);
+        if (sketchEpoch && sketch->total() == sketchEpoch) dumpSketch();
+    }
+
     // // Remove the offset within a bin
     // Addr baseAddr = vaddr & binMask;
     switch (notifyType) {
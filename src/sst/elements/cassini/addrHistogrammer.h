@@ -26,6 +26,7 @@
 #include <sst/elements/memHierarchy/memEvent.h>
 #include <sst/elements/memHierarchy/cacheListener.h>
 
+#include "addrSketch.h"
 
 using namespace SST;
 using namespace SST::MemHierarchy;
@@ -37,10 +38,11 @@ namespace Cassini {
 class AddrHistogrammer : public SST::MemHierarchy::CacheListener {
 public:
     AddrHistogrammer(ComponentId_t, Params& params);
-    ~AddrHistogrammer() {};
+    ~AddrHistogrammer();
 
     void notifyAccess(const CacheListenerNotification& notify);
     void registerResponseCallback(Event::HandlerBase *handler);
+    void printStats(Output &out);
 
     SST_ELI_REGISTER_SUBCOMPONENT(
         AddrHistogrammer,
@@ -53,7 +55,13 @@ public:
 
     SST_ELI_DOCUMENT_PARAMS(
                             { "addr_cutoff", "Addresses above this cutoff won't be recorded", "1TB" },
-                            { "virtual_addr", "Record virtual addresses (1) or physical (0)", 0}
+                            { "virtual_addr", "Record virtual addresses (1) or physical (0)", 0},
+                            { "sketch_width", "Counters per row of a count-min sketch of the misses per bin, 0 for no sketch. The sketch uses fixed memory so it can stay on for long runs", "0" },
+                            { "sketch_depth", "Rows in the count-min sketch", "4" },
+                            { "sketch_bin", "Size of the address bins the sketch counts", "4KiB" },
+                            { "heavy_hitters", "Number of most missed bins the sketch reports", "16" },
+                            { "sketch_epoch", "Report the sketch and start it over after this many misses, 0 to report once at the end", "0" },
+                            { "sketch_output", "File to write the sketch reports to, empty for STDOUT", "" }
     )
 
     SST_ELI_DOCUMENT_STATISTICS(
@@ -69,6 +77,14 @@ private:
                 //  heap and the stack.
     Statistic<Addr>* rdHisto;
     Statistic<Addr>* wrHisto;
+
+    void dumpSketch();
+
+    AddrSketch* sketch;
+    Output* sketchOut;
+    Addr sketchBin;
+    uint64_t sketchEpoch;
+    uint64_t epochCount;
 };
 
 }
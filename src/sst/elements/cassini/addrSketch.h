@@ -0,0 +1,125 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_SST_CASSINI_ADDR_SKETCH
+#define _H_SST_CASSINI_ADDR_SKETCH
+
+#include <stdint.h>
+
+#include <algorithm>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace SST {
+namespace Cassini {
+
+/*
+ * Access counts per address bin in fixed memory, for runs too long to keep
+ * a counter for every bin. A count-min sketch (depth rows of width
+ * counters) gives an estimate that is never below the true count, and the
+ * topCount bins with the largest estimates are kept as the heavy hitters.
+ */
+class AddrSketch {
+public:
+    AddrSketch(uint32_t width, uint32_t depth, uint32_t topCount) :
+        depth(depth ? depth : 1), topCount(topCount), accesses(0), topMin(0), topMinKey(0) {
+        widthBits = 0;
+        while ((1u << widthBits) < width) widthBits++;
+        counters.resize(this->depth << widthBits, 0);
+    }
+
+    uint64_t total() const { return accesses; }
+
+    void add(uint64_t key) {
+        uint64_t count = UINT64_MAX;
+        for (uint32_t row = 0; row < depth; row++) {
+            uint64_t& counter = counters[slot(row, key)];
+            counter++;
+            count = std::min(count, counter);
+        }
+        accesses++;
+
+        if (topCount == 0) return;
+
+        auto entry = top.find(key);
+        if (entry != top.end()) {
+            entry->second = count;
+            if (key == topMinKey) findTopMin();
+        } else if (top.size() < topCount) {
+            top.insert(std::make_pair(key, count));
+            findTopMin();
+        } else if (count > topMin) {
+            top.erase(topMinKey);
+            top.insert(std::make_pair(key, count));
+            findTopMin();
+        }
+    }
+
+    uint64_t estimate(uint64_t key) const {
+        uint64_t count = UINT64_MAX;
+        for (uint32_t row = 0; row < depth; row++) {
+            count = std::min(count, counters[slot(row, key)]);
+        }
+        return count;
+    }
+
+    // The heavy hitters, largest estimate first
+    std::vector<std::pair<uint64_t, uint64_t> > heavyHitters() const {
+        std::vector<std::pair<uint64_t, uint64_t> > hitters(top.begin(), top.end());
+        std::sort(hitters.begin(), hitters.end(),
+            [](const std::pair<uint64_t, uint64_t>& a, const std::pair<uint64_t, uint64_t>& b) {
+                return (a.second != b.second) ? (a.second > b.second) : (a.first < b.first);
+            });
+        return hitters;
+    }
+
+    void clear() {
+        std::fill(counters.begin(), counters.end(), 0);
+        top.clear();
+        accesses = 0;
+        topMin = 0;
+    }
+
+private:
+    size_t slot(uint32_t row, uint64_t key) const {
+        uint64_t hash = (key ^ (0x632be59bd9b4e019ULL * (row + 1))) * 0x9e3779b97f4a7c15ULL;
+        return ((size_t) row << widthBits) + (widthBits ? (size_t) (hash >> (64 - widthBits)) : 0);
+    }
+
+    void findTopMin() {
+        topMin = UINT64_MAX;
+        for (auto entry = top.begin(); entry != top.end(); ++entry) {
+            if (entry->second < topMin) {
+                topMin = entry->second;
+                topMinKey = entry->first;
+            }
+        }
+    }
+
+    uint32_t widthBits;
+    uint32_t depth;
+    uint32_t topCount;
+    uint64_t accesses;
+    std::vector<uint64_t> counters;
+    std::unordered_map<uint64_t, uint64_t> top;
+    uint64_t topMin;     // smallest estimate in top
+    uint64_t topMinKey;
+};
+
+} //namespace Cassini
+} //namespace SST
+
+#endif
@@ -0,0 +1,202 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include "sst_config.h"
+#include "bestoffsetprefetch.h"
+
+#include <vector>
+#include "stdlib.h"
+
+#include "sst/core/params.h"
+
+using namespace SST;
+using namespace SST::Cassini;
+
+void BestOffsetPrefetcher::notifyAccess(const CacheListenerNotification& notify) {
+    handleAccess(notify);
+}
+
+void BestOffsetPrefetcher::notifyAccessBatch(const CacheListenerNotification* notify, size_t count) {
+    for (size_t i = 0; i < count; i++)
+        handleAccess(notify[i]);
+}
+
+void BestOffsetPrefetcher::handleAccess(const CacheListenerNotification& notify) {
+    const NotifyAccessType notifyType = notify.getAccessType();
+
+    if (notifyType != READ && notifyType != WRITE)
+        return;
+
+    const uint64_t line = notify.getPhysicalAddress() / blockSize;
+
+    learn(line);
+    dispatchPrefetch(line);
+}
+
+uint32_t BestOffsetPrefetcher::rrIndex(uint64_t line) const {
+    return (uint32_t) ((line * 0x9e3779b97f4a7c15ULL) >> 32) & rrMask;
+}
+
+// Each access tests one offset: the offset would have covered this access if the line that
+// far behind it was accessed recently. Offsets are tested round robin, and a learning phase
+// ends when one of them reaches score_max or after round_max rounds. The offset with the
+// best score is used for the next phase, unless its score is too low to be worth prefetching.
+//
+// The paper fills the recent requests table when prefetched lines arrive, which accounts for
+// the prefetch latency. The listener does not see fills, so the accessed line goes in instead.
+void BestOffsetPrefetcher::learn(uint64_t line) {
+    const uint32_t offset = offsets[nextOffset];
+    bool phaseDone = false;
+
+    if (line >= offset && rrTable[rrIndex(line - offset)] == line - offset) {
+        scores[nextOffset]++;
+        phaseDone = (scores[nextOffset] >= scoreMax);
+    }
+
+    rrTable[rrIndex(line)] = line;
+
+    nextOffset++;
+    if (nextOffset == offsets.size()) {
+        nextOffset = 0;
+        round++;
+        phaseDone |= (round >= roundMax);
+    }
+
+    if (phaseDone) {
+        uint32_t best = 0;
+        for (uint32_t i = 1; i < scores.size(); i++) {
+            if (scores[i] > scores[best]) best = i;
+        }
+
+        bestOffset = (scores[best] > badScore) ? offsets[best] : 0;
+        output->verbose(CALL_INFO, 2, 0, "Learning phase complete, best offset=%" PRIu32 " score=%" PRIu32 ", prefetching is %s\n",
+            offsets[best], scores[best], (bestOffset == 0) ? "off" : "on");
+
+        scores.assign(scores.size(), 0);
+        nextOffset = 0;
+        round = 0;
+        statLearningPhases->addData(1);
+    }
+}
+
+void BestOffsetPrefetcher::dispatchPrefetch(uint64_t line) {
+    if (bestOffset == 0)
+        return;
+
+    const Addr targetAddress = line * blockSize;
+    const Addr prefetchAddress = (line + bestOffset) * blockSize;
+
+    statPrefetchOpportunities->addData(1);
+
+    if (!overrunPageBoundary && (targetAddress / pageSize) != (prefetchAddress / pageSize)) {
+        output->verbose(CALL_INFO, 2, 0, "Cancel prefetch issue, request exceeds physical page limit\n");
+        statPrefetchIssueCanceledByPageBoundary->addData(1);
+        return;
+    }
+
+    if (prefetchHistory->contains(prefetchAddress)) {
+        output->verbose(CALL_INFO, 2, 0, "Prefetch canceled - same cache line is found in the recent prefetch history.\n");
+        statPrefetchIssueCanceledByHistory->addData(1);
+        return;
+    }
+
+    output->verbose(CALL_INFO, 2, 0, "Issue prefetch, target address: %" PRIx64 ", prefetch address: %" PRIx64 " (offset=%" PRIu32 ")\n",
+        targetAddress, prefetchAddress, bestOffset);
+
+    statPrefetchEventsIssued->addData(1);
+    prefetchHistory->insert(prefetchAddress);
+
+    // Cycle over each registered call back and notify them that we want to issue a prefetch request
+    for (std::vector<Event::HandlerBase*>::iterator callbackItr = registeredCallbacks.begin(); callbackItr != registeredCallbacks.end(); callbackItr++) {
+        // Create a new read request, we cannot issue a write because the data will get
+        // overwritten and corrupt memory (even if we really do want to do a write)
+        MemEvent* newEv = new MemEvent(getName(), prefetchAddress, prefetchAddress, Command::GetS);
+        newEv->setSize(blockSize);
+        newEv->setPrefetchFlag(true);
+
+        (*(*callbackItr))(newEv);
+    }
+}
+
+
+BestOffsetPrefetcher::BestOffsetPrefetcher(ComponentId_t id, Params& params) : CacheListener(id, params) {
+    requireLibrary("memHierarchy");
+
+    int verbosity = params.find<int>("verbose", 0);
+
+    char* new_prefix = (char*) malloc(sizeof(char) * 128);
+    snprintf(new_prefix, sizeof(char)*128, "BestOffsetPrefetcher[%s | @f:@p:@l] ", getName().c_str());
+    output = new Output(new_prefix, verbosity, 0, Output::STDOUT);
+    free(new_prefix);
+
+    blockSize = params.find<uint64_t>("cache_line_size", 64);
+    pageSize = params.find<uint64_t>("page_size", 4096);
+    prefetchHistory = new PrefetchHistory(params.find<uint32_t>("history", 16));
+
+    uint32_t overrunPB = params.find<uint32_t>("overrun_page_boundaries", 0);
+    overrunPageBoundary = (overrunPB == 0) ? false : true;
+
+    scoreMax = params.find<uint32_t>("score_max", 31);
+    roundMax = params.find<uint32_t>("round_max", 100);
+    badScore = params.find<uint32_t>("bad_score", 1);
+
+    // The offsets of the paper, the numbers with only 2, 3 and 5 as prime factors
+    const uint32_t maxOffset = params.find<uint32_t>("max_offset", 64);
+    for (uint32_t i = 1; i <= maxOffset; i++) {
+        uint32_t n = i;
+        while (n % 2 == 0) n /= 2;
+        while (n % 3 == 0) n /= 3;
+        while (n % 5 == 0) n /= 5;
+        if (n == 1) offsets.push_back(i);
+    }
+    if (offsets.empty())
+        output->fatal(CALL_INFO, -1, "BestOffsetPrefetcher: max_offset must be at least 1\n");
+    scores.resize(offsets.size(), 0);
+
+    uint32_t rrEntries = 1;
+    while (rrEntries < params.find<uint32_t>("rr_entries", 256)) rrEntries <<= 1;
+    rrTable.resize(rrEntries, ~((uint64_t) 0));
+    rrMask = rrEntries - 1;
+
+    nextOffset = 0;
+    round = 0;
+    bestOffset = 1;  // start as a next line prefetcher until the first phase completes
+
+    output->verbose(CALL_INFO, 1, 0, "BestOffsetPrefetcher created, cache line: %" PRIu64 ", page size: %" PRIu64 ", %" PRIu32 " offsets\n",
+        blockSize, pageSize, (uint32_t) offsets.size());
+
+    statPrefetchOpportunities = registerStatistic<uint64_t>("prefetch_opportunities");
+    statPrefetchEventsIssued = registerStatistic<uint64_t>("prefetches_issued");
+    statPrefetchIssueCanceledByPageBoundary = registerStatistic<uint64_t>("prefetches_canceled_by_page_boundary");
+    statPrefetchIssueCanceledByHistory = registerStatistic<uint64_t>("prefetches_canceled_by_history");
+    statLearningPhases = registerStatistic<uint64_t>("learning_phases");
+}
+
+BestOffsetPrefetcher::~BestOffsetPrefetcher() {
+    delete prefetchHistory;
+    delete output;
+}
+
+void BestOffsetPrefetcher::registerResponseCallback(Event::HandlerBase* handler) {
+    registeredCallbacks.push_back(handler);
+}
+
+void BestOffsetPrefetcher::printStats(Output &out) {
+}
+
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////
+/// P. Michaud. 2016. Best-offset hardware prefetching. In Proceedings of the 2016 IEEE International
+/// Symposium on High Performance Computer Architecture (HPCA '16). 469-480. DOI=10.1109/HPCA.2016.7446087
+/////////////////////////////////////////////////////////////////////////////////////////////////////////////
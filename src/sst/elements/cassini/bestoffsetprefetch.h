@@ -0,0 +1,116 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_SST_BEST_OFFSET_PREFETCH
+#define _H_SST_BEST_OFFSET_PREFETCH
+
+#include <vector>
+
+#include <sst/core/event.h>
+#include <sst/core/sst_types.h>
+#include <sst/core/component.h>
+#include <sst/core/link.h>
+#include <sst/core/timeConverter.h>
+#include <sst/elements/memHierarchy/memEvent.h>
+#include <sst/elements/memHierarchy/cacheListener.h>
+
+#include <sst/core/output.h>
+
+#include "prefetchHistory.h"
+
+using namespace SST;
+using namespace SST::MemHierarchy;
+using namespace std;
+
+namespace SST {
+namespace Cassini {
+
+class BestOffsetPrefetcher : public SST::MemHierarchy::CacheListener {
+public:
+    BestOffsetPrefetcher(ComponentId_t id, Params& params);
+    ~BestOffsetPrefetcher();
+
+    void notifyAccess(const CacheListenerNotification& notify);
+    void notifyAccessBatch(const CacheListenerNotification* notify, size_t count);
+    void registerResponseCallback(Event::HandlerBase *handler);
+    void printStats(Output &out);
+
+    SST_ELI_REGISTER_SUBCOMPONENT(
+        BestOffsetPrefetcher,
+            "cassini",
+            "BestOffsetPrefetcher",
+            SST_ELI_ELEMENT_VERSION(1,0,0),
+            "Best-Offset Prefetcher [Michaud 2016]",
+            SST::MemHierarchy::CacheListener
+    )
+
+    SST_ELI_DOCUMENT_PARAMS(
+        { "verbose", "Controls the verbosity of the Cassini component", "0" },
+        { "cache_line_size", "Size of the cache line the prefetcher is attached to", "64" },
+        { "history", "Number of issued prefetches to remember, a prefetch for a line in the history is dropped", "16" },
+        { "page_size", "Page size for this controller", "4096" },
+        { "overrun_page_boundaries", "Allow prefetcher to run over page boundaries, 0 is no, 1 is yes", "0" },
+        { "max_offset", "Largest offset, in cache lines, to consider. Offsets tried are the numbers up to this with no prime factor above 5", "64" },
+        { "rr_entries", "Number of entries in the recent requests table, rounded up to a power of two", "256" },
+        { "score_max", "Score that ends a learning phase early", "31" },
+        { "round_max", "Number of rounds over the offsets in one learning phase", "100" },
+        { "bad_score", "Prefetching is turned off while the best offset scores this or less", "1" }
+    )
+
+    SST_ELI_DOCUMENT_STATISTICS(
+        { "prefetches_issued", "Number of prefetch requests issued", "prefetches", 1 },
+        { "prefetches_canceled_by_page_boundary",
+                "Prefetches which would not be executed because they span over a page boundary.", "prefetches", 1 },
+        { "prefetches_canceled_by_history",
+                "Prefetches which did not get issued because of a prefetch history in the table", "prefetches", 1 },
+        { "prefetch_opportunities", "Count of opportunities to prefetch", "prefetches", 1 },
+        { "learning_phases", "Number of completed learning phases", "phases", 1 }
+    )
+
+private:
+    inline void handleAccess(const CacheListenerNotification& notify);
+    void learn(uint64_t line);
+    void dispatchPrefetch(uint64_t line);
+    uint32_t rrIndex(uint64_t line) const;
+
+    Output* output;
+    std::vector<Event::HandlerBase*> registeredCallbacks;
+    PrefetchHistory* prefetchHistory;
+    uint64_t blockSize;
+    uint64_t pageSize;
+    bool overrunPageBoundary;
+
+    std::vector<uint32_t> offsets;    // candidate offsets in lines
+    std::vector<uint32_t> scores;     // one per offset, for the current learning phase
+    std::vector<uint64_t> rrTable;    // recently accessed lines, direct mapped, ~0 is empty
+    uint32_t rrMask;
+    uint32_t nextOffset;              // offset the next access tests
+    uint32_t round;
+    uint32_t scoreMax;
+    uint32_t roundMax;
+    uint32_t badScore;
+    uint32_t bestOffset;              // 0 while prefetching is off
+
+    Statistic<uint64_t>* statPrefetchOpportunities;
+    Statistic<uint64_t>* statPrefetchEventsIssued;
+    Statistic<uint64_t>* statPrefetchIssueCanceledByPageBoundary;
+    Statistic<uint64_t>* statPrefetchIssueCanceledByHistory;
+    Statistic<uint64_t>* statLearningPhases;
+};
+
+} //namespace Cassini
+} //namespace SST
+
+#endif
@@ -54,6 +54,9 @@ cacheLineTrack::cacheLineTrack(ComponentId_t id, Params& params) : CacheListener
     UnitAlgebra cutoff_u(cutoff_s);
     cutoff = cutoff_u.getRoundedValue();
 
+    sampleRate = params.find<uint32_t>("sample_rate", 1);
+    if (sampleRate == 0) sampleRate = 1;
+
     rdHisto = registerStatistic<Addr>("hist_reads_log2");
     wrHisto = registerStatistic<Addr>("hist_writes_log2");
     useHisto = registerStatistic<unsigned int>("hist_word_accesses");
@@ -72,6 +75,9 @@ void cacheLineTrack::notifyAccess(const CacheListenerNotification& notify) {
     // if get a MISS notification, do we get a HIT later?
     if(addr >= cutoff) return;
 
+    // only the lines in the sample are tracked, the hash spreads the sample over the address space
+    if (sampleRate > 1 && (((cacheAddr >> 6) * 0x9e3779b97f4a7c15ULL) >> 32) % sampleRate != 0) return;
+
     // size
 
     switch (notifyType) {
@@ -63,7 +63,8 @@ public:
     )
 
     SST_ELI_DOCUMENT_PARAMS(
-                            { "addr_cutoff", "Addresses above this cutoff won't be recorded", "1TB" }
+                            { "addr_cutoff", "Addresses above this cutoff won't be recorded", "1TB" },
+                            { "sample_rate", "Track one in this many cache lines, picked by a hash of the line address so a tracked line is always tracked. The histograms then describe the sample and the tracking memory shrinks by the same factor", "1" }
     )
 
     SST_ELI_DOCUMENT_STATISTICS(
@@ -82,6 +83,7 @@ private:
     Addr cutoff; // Don't bin addresses above the cutoff. Helps avoid creating
                 //  histogram entries for the vast address range between the
                 //  heap and the stack.
+    uint32_t sampleRate;
     Statistic<Addr>* rdHisto;
     Statistic<Addr>* wrHisto;
     Statistic<unsigned int>* useHisto;
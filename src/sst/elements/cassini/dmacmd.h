@@ -20,11 +20,35 @@
 #include <sst/core/event.h>
 #include <sst/core/component.h>
 
+#include <vector>
+
 namespace SST {
 namespace Cassini {
 
 typedef std::pair<uint64_t, uint64_t> DMACommandID;
 
+/*
+ * One contiguous piece of a DMA transfer
+ */
+class DMADescriptor {
+public:
+	DMADescriptor() : destAddr(0), srcAddr(0), length(0) {}
+	DMADescriptor(const uint64_t dst, const uint64_t src, const uint64_t size) :
+		destAddr(dst), srcAddr(src), length(size) {}
+
+	uint64_t destAddr;
+	uint64_t srcAddr;
+	uint64_t length;
+};
+
+/*
+ * A DMA command is a chain of descriptors copied in order on one of the
+ * engine's channels. Commands on different channels proceed independently;
+ * on one channel a command starts issuing as soon as the previous one has
+ * issued all of its reads, unless it is a fence, which waits for every earlier
+ * command on the channel to complete. Completions are returned in command order
+ * per channel by sending the command back on the link it arrived on.
+ */
 class DMACommand : public Event {
 
 public:
@@ -32,25 +56,64 @@ public:
 		const uint64_t dst,
 		const uint64_t src,
 		const uint64_t size) :
-		Event(),
-		destAddr(dst), srcAddr(src), length(size) {
+		Event(), channel(0), fence(false) {
 
 		cmdID = std::make_pair(nextCmdID++, reqComp->getId());
 		returnLinkID = 0;
+		descriptors.push_back(DMADescriptor(dst, src, size));
+	}
+
+	/* Append a descriptor to make a scatter-gather chain */
+	void addDescriptor(const uint64_t dst, const uint64_t src, const uint64_t size) {
+		descriptors.push_back(DMADescriptor(dst, src, size));
 	}
 
-	uint64_t getSrcAddr() const { return srcAddr; }
-	uint64_t getDestAddr() const { return destAddr; }
-	uint64_t getLength() const { return length; }
+	uint64_t getSrcAddr() const { return descriptors.front().srcAddr; }
+	uint64_t getDestAddr() const { return descriptors.front().destAddr; }
+	uint64_t getLength() const {
+		uint64_t total = 0;
+		for(size_t i = 0; i < descriptors.size(); ++i) {
+			total += descriptors[i].length;
+		}
+		return total;
+	}
+	const std::vector<DMADescriptor>& getDescriptors() const { return descriptors; }
 	DMACommandID getCommandID() const { return cmdID; }
 	void setCommandID(DMACommandID newID) { cmdID = newID; }
 
+	uint32_t getChannel() const { return channel; }
+	void setChannel(const uint32_t chan) { channel = chan; }
+	bool isFence() const { return fence; }
+	void setFence(const bool isFence) { fence = isFence; }
+
+	uint32_t getReturnLinkID() const { return returnLinkID; }
+	void setReturnLinkID(const uint32_t linkID) { returnLinkID = linkID; }
+
+	void serialize_order(SST::Core::Serialization::serializer &ser) override {
+		Event::serialize_order(ser);
+		ser & cmdID;
+		ser & returnLinkID;
+		ser & channel;
+		ser & fence;
+		uint64_t count = descriptors.size();
+		ser & count;
+		descriptors.resize(count);
+		for(size_t i = 0; i < descriptors.size(); ++i) {
+			ser & descriptors[i].destAddr;
+			ser & descriptors[i].srcAddr;
+			ser & descriptors[i].length;
+		}
+	}
+
+	ImplementSerializable(SST::Cassini::DMACommand);
+
 protected:
 	static uint64_t nextCmdID;
 	DMACommandID cmdID;
-	const uint64_t destAddr;
-	const uint64_t srcAddr;
-	const uint64_t length;
+	uint32_t returnLinkID;
+	uint32_t channel;
+	bool fence;
+	std::vector<DMADescriptor> descriptors;
 
 	DMACommand() {} // For serialization
 };
@@ -13,7 +13,6 @@
 // information, see the LICENSE file in the top level directory of the
 // distribution.
 
-
 #include <sst_config.h>
 
 #include <sst/core/output.h>
@@ -25,9 +24,12 @@
 #include <dmamemop.h>
 
 using namespace SST;
+using namespace SST::Cassini;
 using namespace SST::Interfaces;
 using namespace SST::Statistics;
 
+uint64_t DMACommand::nextCmdID = 0;
+
 DMAEngine::DMAEngine(SST::ComponentId_t id, SST::Params& params) :
 	Component(id) {
 
@@ -37,17 +39,39 @@ DMAEngine::DMAEngine(SST::ComponentId_t id, SST::Params& params) :
 	maxInFlight   = params.find<uint32_t>("max_ops_in_flight", 32);
 	opsInFlight = 0;
 
+	if(0 == maxInFlight) {
+		output->fatal(CALL_INFO, -1, "max_ops_in_flight must be at least 1\n");
+	}
+
+	const uint32_t channelCount = params.find<uint32_t>("channels", 1);
+	if(0 == channelCount) {
+		output->fatal(CALL_INFO, -1, "channels must be at least 1\n");
+	}
+	channels.resize(channelCount);
+	nextChannel = 0;
+
+	maxPerChannel = params.find<uint32_t>("max_ops_per_channel", 0);
+	if(0 == maxPerChannel) {
+		maxPerChannel = maxInFlight;
+	}
+
+	issuePerCycle = params.find<uint32_t>("issue_per_cycle", 1);
+	if(0 == issuePerCycle) {
+		output->fatal(CALL_INFO, -1, "issue_per_cycle must be at least 1\n");
+	}
+
 	cacheLineSize = params.find<uint64_t>("cache_line_size", 64);
 
-	std::string memInterfaceName = params.find<std::string>("memoryinterface", "memHierarchy.memInterface");
-	output->verbose(CALL_INFO, 2, 0, "Memory interface to be loaded: %s\n", memInterfaceName.c_str());
+	std::string clockFreq = params.find<std::string>("clock", "1GHz");
+	clockHandler = new Clock::Handler<DMAEngine>(this, &DMAEngine::clockTick);
+	clockTC = registerClock(clockFreq, clockHandler);
+	clockOn = true;
 
-	Params interfaceParams = params.find_prefix_params("memoryinterfaceparams.");
-	cache_link = dynamic_cast<SimpleMem*>( loadModuleWithComponent(interfaceName,
-                this, interfaceParams) );
+	cache_link = loadUserSubComponent<StandardMem>("memory", ComponentInfo::SHARE_NONE, clockTC,
+		new StandardMem::Handler<DMAEngine>(this, &DMAEngine::handleMemorySystemEvent));
 
 	if(NULL == cache_link) {
-		output->fatal(CALL_INFO, -1, "Error loading memory interface module (%s)\n", memInterfaceName.c_str());
+		output->fatal(CALL_INFO, -1, "Error loading memory interface, check that the 'memory' slot is filled in the input\n");
 	} else {
 		output->verbose(CALL_INFO, 2, 0, "Memory interface loaded successfully.\n");
 	}
@@ -56,11 +80,12 @@ DMAEngine::DMAEngine(SST::ComponentId_t id, SST::Params& params) :
 
 	output->verbose(CALL_INFO, 2, 0, "Loading CPU links (total of %" PRIu32 " links requested).\n", cpuLinkCount);
 	char* linkNameBuffer = (char*) malloc(sizeof(char) * 256);
-	cpuSideLinks = (SST::Link*) malloc(sizeof(SST::Link) * cpuLinkCount);
+	cpuSideLinks.resize(cpuLinkCount, NULL);
 
 	for(uint32_t i = 0; i < cpuLinkCount; ++i) {
 		snprintf(linkNameBuffer, sizeof(char)*256, "cpu_link_%" PRIu32, i);
-		cpuSideLinks[i] = configureLink(linkNameBuffer);
+		cpuSideLinks[i] = configureLink(linkNameBuffer,
+			new Event::Handler<DMAEngine, uint32_t>(this, &DMAEngine::handleDMACommandIssue, i));
 
 		if(NULL == cpuSideLinks[i]) {
 			output->fatal(CALL_INFO, -1, "Unable to configure DMA-to-CPU link %" PRIu32 "\n", i);
@@ -71,132 +96,214 @@ DMAEngine::DMAEngine(SST::ComponentId_t id, SST::Params& params) :
 
 	free(linkNameBuffer);
 
+	statCommandsCompleted = registerStatistic<uint64_t>("commands_completed");
+	statBytesCopied       = registerStatistic<uint64_t>("bytes_copied");
+	statCommandLatency    = registerStatistic<uint64_t>("command_latency");
+	statOpsInFlight       = registerStatistic<uint64_t>("ops_in_flight");
+
 	output->verbose(CALL_INFO, 1, 0, "=======================================================\n");
 	output->verbose(CALL_INFO, 1, 0, "DMA Engine Configuration: (%s)\n", getName().c_str());
 	output->verbose(CALL_INFO, 1, 0, "\n");
 	output->verbose(CALL_INFO, 1, 0, "Maximum memory ops in flight:   %" PRIu32 "\n", maxInFlight);
+	output->verbose(CALL_INFO, 1, 0, "Channels:                       %" PRIu32 "\n", channelCount);
+	output->verbose(CALL_INFO, 1, 0, "Maximum ops per channel:        %" PRIu32 "\n", maxPerChannel);
+	output->verbose(CALL_INFO, 1, 0, "Reads issued per cycle:         %" PRIu32 "\n", issuePerCycle);
 	output->verbose(CALL_INFO, 1, 0, "Cache Line Size (bytes):        %" PRIu64 "\n", cacheLineSize);
 	output->verbose(CALL_INFO, 1, 0, "CPU Links:                      %" PRIu32 "\n", cpuLinkCount);
 }
 
 DMAEngine::~DMAEngine() {
 	delete output;
-	free(cpuSideLinks);
 }
 
 void DMAEngine::init(unsigned int phase) {
+	cache_link->init(phase);
+}
 
+void DMAEngine::setup() {
+	cache_link->setup();
 }
 
 void DMAEngine::finish() {
+	cache_link->finish();
+}
 
+bool DMAEngine::isIdle() const {
+	for(size_t i = 0; i < channels.size(); ++i) {
+		if(!channels[i].active.empty() || !channels[i].waiting.empty()) {
+			return false;
+		}
+	}
+	return true;
 }
 
-void DMAEngine::issueNextCommand() {
-	if(NULL != currentState) {
-		if(currentState->issueCompleted() && pendingReadReqs->size() == 0) {
-			// Return to the CPU links so they know this is done
+bool DMAEngine::clockTick(SST::Cycle_t cycle) {
+	statOpsInFlight->addData(opsInFlight);
+
+	// Visit the channels round-robin so that one busy channel cannot take
+	// every issue slot
+	uint32_t issued = 0;
+	uint32_t idleVisits = 0;
+	while(issued < issuePerCycle && idleVisits < channels.size()) {
+		DMAChannel& chan = channels[nextChannel];
+		nextChannel = (nextChannel + 1) % channels.size();
+
+		if(issueNextReadOperation(chan)) {
+			issued++;
+			idleVisits = 0;
 		} else {
-			// Operation is still pending, cannot issue the next command
-			// until this one completed.
-			return;
+			idleVisits++;
 		}
 	}
 
-	if(cmdQ->size() > 0) {
-		// Create a new DMA engine state record
-		DMACommand* nextCmd = cmdQ->pop_front();
-		DMAEngineState* newState = new DMAEngineState(nextCmd);
-		currentState = newState;
+	for(size_t i = 0; i < channels.size(); ++i) {
+		retireCompleted(channels[i]);
+	}
 
-		// Now create the initial read requests
-		uint64_t startAddr = nextCmd->getSrcAddr();
+	// Turn the clock off until the next command arrives
+	if(isIdle()) {
+		clockOn = false;
+		return true;
+	}
 
-		// Check if we have aligned start
-		uint64_t alignDiff = startAddr % cacheLineSize;
+	return false;
+}
 
-		if(alignDiff > 0) {
-			// Check to see if the DMA request is for a short byte
-			// transfer, this would be horribly inefficient but we do
-			// want to be functionally correct
-			alignDiff = std::min(alignDiff, nextCmd->getCommandLength());
-		} else {
-			// Ensure we do not over transfer, start with one cache line
-			alignDiff = std::min(cacheLineSize, nextCmd->getCommandLength());
+bool DMAEngine::issueNextReadOperation(DMAChannel& chan) {
+	if(opsInFlight >= maxInFlight || chan.opsInFlight >= maxPerChannel) {
+		return false;
+	}
+
+	// Only the newest started command can still have reads to issue, once
+	// it has issued them all the next command may start unless it is a fence
+	if(chan.active.empty() || chan.active.back()->allReadsIssued()) {
+		if(chan.waiting.empty()) {
+			return false;
 		}
 
-		// Issue read into the memory system
-		SimpleMem::Request* alignRead = new SimpleMem::Request(SimpleMem::Request::Read,
-			nextCmd->getSrcAddr(), alignDiff);
-		pendingRequests->insert( std::pair<SimpleMem::Request::id_t, DMAMemoryOperation*>(
-			alignRead->getId(), new DMAMemoryOperation(0, alignDiff)) );
+		DMACommand* nextCmd = chan.waiting.front();
+		if(nextCmd->isFence() && !chan.active.empty()) {
+			return false;
+		}
 
-		currentState->addIssuedBytes(alignDiff);
-		opsInFlight++;
+		chan.waiting.pop_front();
+		chan.active.push_back(new DMAEngineState(nextCmd, getCurrentSimTimeNano()));
 
-		// Keep issuing until we can't do any more
-		while(issueNextReadOperation());
+		if(chan.active.back()->allReadsIssued()) {
+			// Nothing to copy
+			return false;
+		}
 	}
+
+	DMAEngineState* state = chan.active.back();
+
+	uint64_t srcAddr = 0;
+	uint64_t destAddr = 0;
+	uint64_t length = 0;
+	state->nextChunk(cacheLineSize, srcAddr, destAddr, length);
+
+	StandardMem::Request* nextReq = new StandardMem::Read(srcAddr, length);
+	pendingReqs.insert(std::make_pair(nextReq->getID(), new DMAMemoryOperation(state, destAddr, length)));
+
+	output->verbose(CALL_INFO, 8, 0, "Issue read: src=%" PRIu64 ", len=%" PRIu64 " for dest=%" PRIu64 "\n",
+		srcAddr, length, destAddr);
+
+	state->opIssued();
+	chan.opsInFlight++;
+	opsInFlight++;
+
+	cache_link->send(nextReq);
+	return true;
 }
 
-bool DMAEngine::issueNextReadOperation() {
-	if( ! currentState->allReadsIssued() ) {
-		if(opsInFlight < maxInFlight) {
-			uint64_t nextReqLength = std::min(cacheLineSize,
-                                              (currentState->getCommandLength() - currentState->getIssuedBytes()));
+void DMAEngine::issueWriteRequest(DMAMemoryOperation* op, std::vector<uint8_t>& payload) {
+	op->startWrite();
 
-			SimpleMem::Request* nextReq = new SimpleMem::Request(SimpleMem::Request::Read,
-				currentState->getSrcAddr() + currentState->getIssuedBytes(),
-				nextReqLength);
-			pendingRequests->insert(std::pair<SimpleMem::Request::id_t, DMAMemoryOperation*>(
-				nextReq->getId(), new DMAMemoryOperation(0, nextReqLength)) );
+	StandardMem::Request* writeReq = new StandardMem::Write(op->getDestAddr(), op->getLength(), payload);
+	pendingReqs.insert(std::make_pair(writeReq->getID(), op));
 
-			currentState->addIssuedBytes(nextReqLength);
-			opsInFlight++;
+	output->verbose(CALL_INFO, 8, 0, "Issue write: dest=%" PRIu64 ", len=%" PRIu64 "\n",
+		op->getDestAddr(), op->getLength());
 
-			// We did issue, so return true to let caller know
-			return true;
-		} else {
-			return false;
-		}
-	} else {
-		return false;
+	cache_link->send(writeReq);
+}
+
+void DMAEngine::retireCompleted(DMAChannel& chan) {
+	while(!chan.active.empty() && chan.active.front()->isComplete()) {
+		DMAEngineState* state = chan.active.front();
+		chan.active.pop_front();
+
+		DMACommand* cmd = state->getDMACommand();
+
+		output->verbose(CALL_INFO, 4, 0, "Completed DMACommand: ID=(%" PRIu64 ", %" PRIu64 "), Len=%" PRIu64 " bytes\n",
+			cmd->getCommandID().first, cmd->getCommandID().second, cmd->getLength());
+
+		statCommandsCompleted->addData(1);
+		statCommandLatency->addData(getCurrentSimTimeNano() - state->getStartTime());
+
+		// Return to the CPU link so it knows this is done
+		cpuSideLinks[cmd->getReturnLinkID()]->send(cmd);
+		delete state;
 	}
 }
 
-void DMAEngine::handleDMACommandIssue(SST::Event* ev) {
+void DMAEngine::handleDMACommandIssue(SST::Event* ev, uint32_t linkID) {
 	DMACommand* dmaEv = dynamic_cast<DMACommand*>(ev);
 
 	if(NULL == dmaEv) {
 		output->fatal(CALL_INFO, -1, "DMA Engine recv event which did not cast to DMACommand.\n");
 	}
 
-	output->verbose(CALL_INFO, 4, 0, "Recv DMACommand: ID=(%" PRIu64 ", %" PRIu64 "), Src=%" PRIu64 ", Dest=%" PRIu64 ", Len=%" PRIu64 " bytes\n",
-		dmaEv->getCommandID().first, dmaEv->getCommand().second,
-		dmaEv->getSrcAddr(), dmaEv->getDestAddr(), dmaEv->getLength());
-	output->verbose(CALL_INFO, 4, 0, "Enqueuing DMA command in pending queue, current queue length is: %" PRIu32 "\n",
-		(uint32_t) cmdQ->size());
+	dmaEv->setReturnLinkID(linkID);
+	DMAChannel& chan = channels[dmaEv->getChannel() % channels.size()];
 
-	cmdQ->push_back(dmaEv);
-}
+	output->verbose(CALL_INFO, 4, 0, "Recv DMACommand: ID=(%" PRIu64 ", %" PRIu64 "), Src=%" PRIu64 ", Dest=%" PRIu64 ", Len=%" PRIu64 " bytes, Descriptors=%zu, Channel=%" PRIu32 "%s\n",
+		dmaEv->getCommandID().first, dmaEv->getCommandID().second,
+		dmaEv->getSrcAddr(), dmaEv->getDestAddr(), dmaEv->getLength(),
+		dmaEv->getDescriptors().size(), dmaEv->getChannel(), dmaEv->isFence() ? ", fence" : "");
+	output->verbose(CALL_INFO, 4, 0, "Enqueuing DMA command in pending queue, current queue length is: %" PRIu32 "\n",
+		(uint32_t) chan.waiting.size());
 
-void DMAEngine::issueWriteRequest(const uint64_t writeAddr,
-	const uint64_t length, char* payload) {
+	chan.waiting.push_back(dmaEv);
 
+	if(!clockOn) {
+		reregisterClock(clockTC, clockHandler);
+		clockOn = true;
+	}
 }
 
-void DMAEngine::handleMemorySystemEvent(Interfaces::SimpleMem::Request* ev) {
+void DMAEngine::handleMemorySystemEvent(StandardMem::Request* ev) {
 
-	std::map<SimpleMem::Request::id_t, DMAMemoryOperation*>::iterator findEv;
-	findEv = pendingReadReqs.find(ev->getId());
+	std::unordered_map<StandardMem::Request::id_t, DMAMemoryOperation*>::iterator findEv;
+	findEv = pendingReqs.find(ev->getID());
 
-	if(findEv == pendingReadReqs.end()) {
+	if(findEv == pendingReqs.end()) {
 		output->fatal(CALL_INFO, -1, "Recv event but unable to find ID in table.\n");
 	}
 
-	DMAOperation* completedOp = findEv->second;
-	issueWriteRequest(currentState->getDestAddr() + completedOp->getByteOffset(),
-		completedOp->getLength(), NULL);
-}
+	DMAMemoryOperation* completedOp = findEv->second;
+	pendingReqs.erase(findEv);
 
+	if(completedOp->isRead()) {
+		StandardMem::ReadResp* resp = dynamic_cast<StandardMem::ReadResp*>(ev);
+		if(NULL == resp) {
+			output->fatal(CALL_INFO, -1, "Recv response to a DMA read which is not a read response.\n");
+		}
+
+		// The operation stays in flight until its write is acknowledged
+		issueWriteRequest(completedOp, resp->data);
+	} else {
+		DMAEngineState* state = completedOp->getState();
+		DMAChannel& chan = channels[state->getDMACommand()->getChannel() % channels.size()];
+
+		statBytesCopied->addData(completedOp->getLength());
+
+		state->opCompleted();
+		chan.opsInFlight--;
+		opsInFlight--;
+		delete completedOp;
+	}
+
+	delete ev;
+}
 
@@ -19,7 +19,9 @@
 
 #include <sst/core/component.h>
 #include <sst/core/output.h>
+#include <sst/core/interfaces/stdMem.h>
 #include <deque>
+#include <unordered_map>
 
 #include <dmacmd.h>
 #include <dmastate.h>
@@ -35,34 +37,88 @@ namespace Cassini {
 class DMAEngine : public SST::Component {
 
 public:
+	SST_ELI_REGISTER_COMPONENT(DMAEngine, "cassini", "DMAEngine", SST_ELI_ELEMENT_VERSION(1,0,0),
+		"Multi-channel DMA engine that copies descriptor chains through the memory system", COMPONENT_CATEGORY_PROCESSOR)
+
+	SST_ELI_DOCUMENT_PARAMS(
+		{ "verbose",             "Sets the verbosity of output", "0" },
+		{ "clock",               "Clock frequency of the engine", "1GHz" },
+		{ "cache_line_size",     "Size of a cache line, memory operations never cross one", "64" },
+		{ "max_ops_in_flight",   "Maximum memory operations in flight across all channels", "32" },
+		{ "channels",            "Number of independent DMA channels, a command's channel is taken modulo this", "1" },
+		{ "max_ops_per_channel", "Maximum memory operations in flight for one channel, 0 means max_ops_in_flight", "0" },
+		{ "issue_per_cycle",     "Maximum reads the engine issues each cycle, shared round-robin by the channels", "1" },
+		{ "cpu_link_count",      "Number of links to CPUs that issue DMA commands", "1" }
+	)
+
+	SST_ELI_DOCUMENT_PORTS(
+		{ "cpu_link_%(cpu_link_count)d", "Link to a CPU, DMA commands arrive and are returned when complete", { "Cassini.DMACommand" } }
+	)
+
+	SST_ELI_DOCUMENT_STATISTICS(
+		{ "commands_completed", "Number of DMA commands completed",                       "commands", 1 },
+		{ "bytes_copied",       "Number of bytes copied",                                 "bytes",    1 },
+		{ "command_latency",    "Time from a command arriving to its completion",         "ns",       1 },
+		{ "ops_in_flight",      "Memory operations in flight each cycle the engine is busy", "ops",   2 }
+	)
+
+	SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
+		{ "memory", "Interface to the memory system", "SST::Interfaces::StandardMem" }
+	)
+
 	DMAEngine(SST::ComponentId_t id, SST::Params& params);
 	~DMAEngine();
 
 	void init(unsigned int phase);
+	void setup();
 	void finish();
-	void handleDMACommandIssue(SST::Event* ev);
-	void handleMemorySystemEvent(Interfaces::SimpleMem::Request* ev);
+	void handleDMACommandIssue(SST::Event* ev, uint32_t linkID);
+	void handleMemorySystemEvent(StandardMem::Request* ev);
 
 private:
 	DMAEngine(); 			// Serialization only, no implement
 	DMAEngine(const DMAEngine&);	// Serialization only, no implement
 	void operator=(const DMAEngine&); // Serialization only, no implement
 
-	void issueNextCommand();
+	/* Commands of one channel: those started, oldest first, and those waiting to start */
+	class DMAChannel {
+	public:
+		DMAChannel() : opsInFlight(0) {}
+		std::deque<DMAEngineState*> active;
+		std::deque<DMACommand*> waiting;
+		uint32_t opsInFlight;
+	};
+
+	bool clockTick(SST::Cycle_t cycle);
+	bool issueNextReadOperation(DMAChannel& chan);
+	void issueWriteRequest(DMAMemoryOperation* op, std::vector<uint8_t>& payload);
+	void retireCompleted(DMAChannel& chan);
+	bool isIdle() const;
 
 	uint64_t cacheLineSize;
 	uint32_t maxInFlight;
+	uint32_t maxPerChannel;
+	uint32_t issuePerCycle;
 	uint32_t opsInFlight;
 	uint32_t cpuLinkCount;
+	uint32_t nextChannel;
+
+	std::vector<SST::Link*> cpuSideLinks;
+	StandardMem* cache_link;
+
+	std::unordered_map<StandardMem::Request::id_t, DMAMemoryOperation*> pendingReqs;
+
+	std::vector<DMAChannel> channels;
 
-	SST::Link* cpuSideLinks;
-	SimpleMem* cache_link;
+	TimeConverter* clockTC;
+	Clock::HandlerBase* clockHandler;
+	bool clockOn;
 
-	std::vector<SimpleMem::Request::id_t> pendingWriteReqs;
-	std::map<SimpleMem::Request::id_t, DMAMemoryOperation*> pendingReadReqs;
+	Statistic<uint64_t>* statCommandsCompleted;
+	Statistic<uint64_t>* statBytesCopied;
+	Statistic<uint64_t>* statCommandLatency;
+	Statistic<uint64_t>* statOpsInFlight;
 
-	std::deque<DMACommand*> cmdQ;
-	DMAEngineState* currentState;
 	Output* output;
 
 };
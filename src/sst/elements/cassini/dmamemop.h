@@ -16,30 +16,36 @@
 #ifndef _H_SST_CASSINI_DMA_MEMORY_OPERATION
 #define _H_SST_CASSINI_DMA_MEMORY_OPERATION
 
+#include <dmastate.h>
+
 namespace SST {
 namespace Cassini {
 
+/*
+ * A memory request in flight for a DMA command: the read of one chunk,
+ * then the write of the same chunk to its destination once the data returns
+ */
 class DMAMemoryOperation {
 
 public:
-	DMAMemoryOperation(const uint64_t byteOffset,
-		const uint64_t len,
-		const bool isReadOperation) :
-		offset(byteOffset), length(len), isRead(isReadOperation) {}
-	DMAMemoryOperation(const uint64_t byteOffset,
+	DMAMemoryOperation(DMAEngineState* cmdState,
+		const uint64_t dst,
 		const uint64_t len) :
-		offset(byteOffset), length(len), isRead(true) {}
+		state(cmdState), destAddr(dst), length(len), writing(false) {}
 
 	~DMAMemoryOperation() {}
-	uint64_t getByteOffset() const { return offset; }
+	DMAEngineState* getState() const { return state; }
+	uint64_t getDestAddr() const { return destAddr; }
 	uint64_t getLength() const { return length; }
-	bool isRead() const { return isRead; }
-	bool isWrite() const { return isWrite; }
+	bool isRead() const { return !writing; }
+	bool isWrite() const { return writing; }
+	void startWrite() { writing = true; }
 
 private:
-	const uint64_t offset;
+	DMAEngineState* state;
+	const uint64_t destAddr;
 	const uint64_t length;
-	const bool isRead;
+	bool writing;
 
 };
 
@@ -17,64 +17,104 @@
 #ifndef _H_SST_CASSINI_DMA_STATE
 #define _H_SST_CASSINI_DMA_STATE
 
+#include <algorithm>
+
 #include <dmacmd.h>
 
 namespace SST {
 namespace Cassini {
 
+/*
+ * Progress of one DMA command: where the next read comes from in its
+ * descriptor chain and how many of its memory operations are still in flight
+ */
 class DMAEngineState {
 public:
-        DMAEngineState(DMACommand* cmd) :
-                origCmd(cmd) {
-
-                issuedBytes = 0;
-                completedIssue = false;
-        }
+	DMAEngineState(DMACommand* cmd, const SimTime_t start) :
+		origCmd(cmd), startTime(start) {
+
+		descIndex = 0;
+		descOffset = 0;
+		issuedBytes = 0;
+		opsOutstanding = 0;
+		skipEmpty();
+	}
 
 	~DMAEngineState() {
 
 	}
 
-        bool issueCompleted() const {
-                return completedIssue;
-        }
-
 	bool allReadsIssued() const {
-		return (issuedBytes == getCommandLength());
+		return descIndex >= origCmd->getDescriptors().size();
 	}
 
-        uint64_t getIssuedBytes() const {
-                return issuedBytes;
-        }
+	bool isComplete() const {
+		return allReadsIssued() && (0 == opsOutstanding);
+	}
 
-        void setIssuedBytes(const uint64_t isBytes) {
-                issuedBytes = isBytes;
-        }
+	/*
+	 * Take the next chunk to read. A chunk never crosses a cache line at
+	 * either its source or its destination.
+	 */
+	bool nextChunk(const uint64_t lineSize, uint64_t& src, uint64_t& dst, uint64_t& len) {
+		if(allReadsIssued()) {
+			return false;
+		}
+
+		const DMADescriptor& desc = origCmd->getDescriptors()[descIndex];
+		src = desc.srcAddr + descOffset;
+		dst = desc.destAddr + descOffset;
+		len = std::min(desc.length - descOffset,
+			std::min(lineSize - (src % lineSize), lineSize - (dst % lineSize)));
+
+		descOffset += len;
+		issuedBytes += len;
+		if(descOffset == desc.length) {
+			descIndex++;
+			descOffset = 0;
+			skipEmpty();
+		}
+		return true;
+	}
 
-        void addIssuedBytes(const uint64_t addTo) {
-                issuedBytes += addTo;
-        }
+	uint64_t getIssuedBytes() const {
+		return issuedBytes;
+	}
 
-        uint64_t getCommandLength() const {
-                return cmd->getLength();
-        }
+	void opIssued() {
+		opsOutstanding++;
+	}
 
-        uint64_t getSrcAddr() const {
-                return cmd->getSrcAddr();
-        }
+	void opCompleted() {
+		opsOutstanding--;
+	}
 
-        uint64_t getDestAddr() const {
-                return cmd->getDestAddr();
-        }
+	uint64_t getCommandLength() const {
+		return origCmd->getLength();
+	}
 
-        const DMACommand* getDMACommand() {
-                return origCmd;
-        }
+	SimTime_t getStartTime() const {
+		return startTime;
+	}
+
+	DMACommand* getDMACommand() {
+		return origCmd;
+	}
 
 private:
-        const DMACommand* origCmd;
-        uint64_t issuedBytes;
-        bool completedIssue;
+	void skipEmpty() {
+		while(descIndex < origCmd->getDescriptors().size() &&
+			0 == origCmd->getDescriptors()[descIndex].length) {
+			descIndex++;
+		}
+	}
+
+	DMACommand* origCmd;
+	SimTime_t startTime;
+	size_t descIndex;
+	uint64_t descOffset;
+	uint64_t issuedBytes;
+	uint32_t opsOutstanding;
 };
 
 }
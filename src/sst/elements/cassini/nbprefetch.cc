@@ -39,6 +39,15 @@ NextBlockPrefetcher::NextBlockPrefetcher(ComponentId_t id, Params& params) : Cac
 NextBlockPrefetcher::~NextBlockPrefetcher() {}
 
 void NextBlockPrefetcher::notifyAccess(const CacheListenerNotification& notify) {
+    handleAccess(notify);
+}
+
+void NextBlockPrefetcher::notifyAccessBatch(const CacheListenerNotification* notify, size_t count) {
+    for (size_t i = 0; i < count; i++)
+        handleAccess(notify[i]);
+}
+
+void NextBlockPrefetcher::handleAccess(const CacheListenerNotification& notify) {
     const NotifyAccessType notifyType = notify.getAccessType();
     const NotifyResultType notifyResType = notify.getResultType();
     const Addr addr = notify.getPhysicalAddress();
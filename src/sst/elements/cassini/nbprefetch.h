@@ -40,6 +40,7 @@ public:
     ~NextBlockPrefetcher();
 
     void notifyAccess(const CacheListenerNotification& notify);
+    void notifyAccessBatch(const CacheListenerNotification* notify, size_t count);
     void registerResponseCallback(Event::HandlerBase *handler);
     void printStats(Output& out);
 
@@ -63,6 +64,7 @@ public:
     )
 
 private:
+    inline void handleAccess(const CacheListenerNotification& notify);
     std::vector<Event::HandlerBase*> registeredCallbacks;
     uint64_t blockSize;
 
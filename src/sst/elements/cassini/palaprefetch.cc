@@ -28,6 +28,17 @@ using namespace SST;
 using namespace SST::Cassini;
 
 void PalaPrefetcher::notifyAccess(const CacheListenerNotification& notify)
+{
+    handleAccess(notify);
+}
+
+void PalaPrefetcher::notifyAccessBatch(const CacheListenerNotification* notify, size_t count)
+{
+    for (size_t i = 0; i < count; i++)
+        handleAccess(notify[i]);
+}
+
+void PalaPrefetcher::handleAccess(const CacheListenerNotification& notify)
 {
     const NotifyAccessType notifyType = notify.getAccessType();
 
@@ -39,75 +50,64 @@ void PalaPrefetcher::notifyAccess(const CacheListenerNotification& notify)
 
     // Insert address into the history table using the tag as the index
     uint64_t tag = addr >> (addressSize - tagSize);
-    StrideFilter filterEntry;
-    filterEntry.lastAddress = addr;
-    filterEntry.stride = blockSize;
-    filterEntry.lastStride = 0;
-    filterEntry.state = P_INVALID;
+    TableEntry tableEntry;
+    tableEntry.filter.lastAddress = addr;
+    tableEntry.filter.stride = blockSize;
+    tableEntry.filter.lastStride = 0;
+    tableEntry.filter.state = P_INVALID;
 
     // If the value is already present, then we need to check its state information
     // and update the values in the table. If the stride values match for two addresses
     // in a row, then we update the stride value in the table. Otherwise, the value
     // remains unchanged.
     int32_t tempStride = 0;
-    std::pair < std::unordered_map< uint64_t, StrideFilter >::iterator, bool >  retVal;
-    retVal = recentAddrList->insert ( std::pair< uint64_t, StrideFilter >(tag, filterEntry) );
+    std::pair < std::unordered_map< uint64_t, TableEntry >::iterator, bool >  retVal;
+    retVal = recentAddrList.insert ( std::make_pair(tag, tableEntry) );
     if( retVal.second == false )
     {
-        tempStride = int32_t( addr - (*recentAddrList)[tag].lastAddress );
-        if( (*recentAddrList)[tag].state == P_INVALID )
+        StrideFilter& filter = retVal.first->second.filter;
+        tempStride = int32_t( addr - filter.lastAddress );
+        if( filter.state == P_INVALID )
         {
-            if( (*recentAddrList)[tag].lastStride == tempStride )
+            if( filter.lastStride == tempStride )
             {
-                (*recentAddrList)[tag].state = P_PENDING;
+                filter.state = P_PENDING;
             }
         }
-        else if( (*recentAddrList)[tag].state == P_PENDING )
+        else if( filter.state == P_PENDING )
         {
-            if( (*recentAddrList)[tag].lastStride == tempStride )
+            if( filter.lastStride == tempStride )
             {
-                (*recentAddrList)[tag].state = P_VALID;
-                (*recentAddrList)[tag].stride = tempStride;
+                filter.state = P_VALID;
+                filter.stride = tempStride;
             }
 
         }
         else
         {
-            if( (*recentAddrList)[tag].lastStride != tempStride )
+            if( filter.lastStride != tempStride )
             {
-                (*recentAddrList)[tag].state = P_PENDING;
+                filter.state = P_PENDING;
             }
         }
 
-        (*recentAddrList)[tag].lastStride = tempStride;
-        (*recentAddrList)[tag].lastAddress = addr;
+        filter.lastStride = tempStride;
+        filter.lastAddress = addr;
 
-        // Insert a reference to the new element at the front of the queue
-        // and remove any other references to the element. Requires traversal
-        // of the list (max n - 1), but need to keep it lru.
-        if( recentAddrListQueue->front() != retVal.first )
-        {
-            for( it = recentAddrListQueue->begin(); it != recentAddrListQueue->end(); it++ )
-            {
-                if( *it == retVal.first )
-                {
-                    recentAddrListQueue->erase(it);
-                    recentAddrListQueue->push_front(retVal.first);
-                    break;
-                }
-            }
-        }
+        // Move the element to the front of the queue to keep it lru
+        recentAddrListQueue.splice(recentAddrListQueue.begin(), recentAddrListQueue, retVal.first->second.lru);
     }
     else
     {
         // Insert a reference to the new element at the front of the queue
-        recentAddrListQueue->push_front(retVal.first);
+        recentAddrListQueue.push_front(tag);
+        retVal.first->second.lru = recentAddrListQueue.begin();
     }
 
-    if( recentAddrList->size() >= recentAddrListCount )
+    if( recentAddrList.size() >= recentAddrListCount )
     {
-        recentAddrList->erase(recentAddrListQueue->back());
-        recentAddrListQueue->pop_back();
+        recentAddrList.erase(recentAddrListQueue.back());
+        recentAddrListQueue.pop_back();
     }
 
     recheckCountdown = (recheckCountdown + 1) % strideDetectionRange;
@@ -124,7 +124,8 @@ void PalaPrefetcher::DispatchRequest(Addr targetAddress)
     MemEvent* ev = NULL;
 
     uint64_t tag = targetAddress >> (addressSize - tagSize);
-    int32_t stride = (*recentAddrList)[tag].stride;
+    std::unordered_map< uint64_t, TableEntry >::iterator entry = recentAddrList.find(tag);
+    int32_t stride = (entry == recentAddrList.end()) ? 0 : entry->second.filter.stride;
 
     Addr targetPrefetchAddress = targetAddress + (strideReach * stride);
     targetPrefetchAddress = targetPrefetchAddress - (targetPrefetchAddress % blockSize);
@@ -183,27 +184,14 @@ void PalaPrefetcher::DispatchRequest(Addr targetAddress)
         output->verbose(CALL_INFO, 2, 0, "Checking prefetch history for cache line at base %" PRIx64 ", valid prefetch history entries=%" PRIu32 "\n", prefetchCacheLineBase,
                         currentHistCount);
 
-        for(uint32_t i = 0; i < currentHistCount; ++i)
-        {
-            if(prefetchHistory->at(i) == prefetchCacheLineBase)
-            {
-                inHistory = true;
-                break;
-            }
-        }
+        inHistory = prefetchHistory->contains(prefetchCacheLineBase);
 
         if(! inHistory)
         {
             statPrefetchEventsIssued->addData(1);
 
-            // Remove the oldest cache line
-            if(currentHistCount == prefetchHistoryCount)
-            {
-                    prefetchHistory->pop_front();
-            }
-
-            // Put the cache line at the back of the queue
-            prefetchHistory->push_back(prefetchCacheLineBase);
+            // Put the cache line in the history, replacing the oldest one when it is full
+            prefetchHistory->insert(prefetchCacheLineBase);
 
             assert((ev->getAddr() % blockSize) == 0);
 
@@ -248,7 +236,7 @@ PalaPrefetcher::PalaPrefetcher(ComponentId_t id, Params& params) : CacheListener
     addressSize = params.find<uint64_t>("addr_size", 64);
 
     prefetchHistoryCount = params.find<uint32_t>("history", 16);
-    prefetchHistory = new std::deque<uint64_t>();
+    prefetchHistory = new PrefetchHistory(prefetchHistoryCount);
 
     strideReach = params.find<uint32_t>("reach", 2);
     strideDetectionRange = params.find<uint64_t>("detect_range", 4);
@@ -259,8 +247,6 @@ PalaPrefetcher::PalaPrefetcher(ComponentId_t id, Params& params) : CacheListener
     overrunPageBoundary = (overrunPB == 0) ? false : true;
 
     nextRecentAddressIndex = 0;
-    recentAddrList = new std::unordered_map< uint64_t, StrideFilter >;
-    recentAddrListQueue = new std::deque< std::unordered_map< uint64_t, StrideFilter >::iterator >;
 
     output->verbose(CALL_INFO, 1, 0, "PalaPrefetcher created, cache line: %" PRIu64 ", page size: %" PRIu64 "\n",
             blockSize, pageSize);
@@ -277,8 +263,6 @@ PalaPrefetcher::PalaPrefetcher(ComponentId_t id, Params& params) : CacheListener
 PalaPrefetcher::~PalaPrefetcher()
 {
     delete prefetchHistory;
-    delete recentAddrList;
-    delete recentAddrListQueue;
 }
 
 void PalaPrefetcher::registerResponseCallback(Event::HandlerBase* handler)
@@ -20,6 +20,7 @@
 #include <unordered_map>
 #include <vector>
 #include <deque>
+#include <list>
 
 #include <sst/core/event.h>
 #include <sst/core/sst_types.h>
@@ -31,6 +32,8 @@
 
 #include <sst/core/output.h>
 
+#include "prefetchHistory.h"
+
 using namespace SST;
 using namespace SST::MemHierarchy;
 using namespace std;
@@ -56,6 +59,7 @@ public:
     ~PalaPrefetcher();
 
     void notifyAccess(const CacheListenerNotification& notify);
+    void notifyAccessBatch(const CacheListenerNotification* notify, size_t count);
     void registerResponseCallback(Event::HandlerBase *handler);
     void printStats(Output &out);
 
@@ -90,13 +94,19 @@ public:
 
 private:
     void     DispatchRequest(Addr targetAddress);
+    inline void handleAccess(const CacheListenerNotification& notify);
+
+    /* Table entry and its position in the LRU list, so updating recency needs no search */
+    struct TableEntry {
+        StrideFilter filter;
+        std::list<uint64_t>::iterator lru;
+    };
 
     Output* output;
     std::vector<Event::HandlerBase*> registeredCallbacks;
-    std::deque<uint64_t>* prefetchHistory;
-    std::unordered_map< uint64_t, StrideFilter >* recentAddrList;
-    std::deque< std::unordered_map< uint64_t, StrideFilter >::iterator >* recentAddrListQueue;
-    std::deque< std::unordered_map< uint64_t, StrideFilter >::iterator >::iterator it;
+    PrefetchHistory* prefetchHistory;
+    std::unordered_map< uint64_t, TableEntry > recentAddrList;
+    std::list< uint64_t > recentAddrListQueue;    // Tags, most recently used first
 
     uint64_t pageSize;
     uint64_t blockSize;
@@ -0,0 +1,68 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_SST_CASSINI_PREFETCH_HISTORY
+#define _H_SST_CASSINI_PREFETCH_HISTORY
+
+#include <stdint.h>
+
+#include <unordered_set>
+#include <vector>
+
+namespace SST {
+namespace Cassini {
+
+/*
+ * The cache lines a prefetcher issued most recently, oldest replaced first.
+ * A prefetch for a line still in the history is dropped. The lines sit in a
+ * ring for the replacement order and in a hash set for the lookup, so a
+ * check costs the same for any history length.
+ */
+class PrefetchHistory {
+public:
+    PrefetchHistory(uint32_t count) : lines(count), next(0), valid(0) {}
+
+    uint32_t size() const { return valid; }
+
+    bool contains(uint64_t line) const {
+        return present.find(line) != present.end();
+    }
+
+    // Record a line that is not in the history, replacing the oldest when full
+    void insert(uint64_t line) {
+        if (lines.empty()) return;
+
+        if (valid == lines.size()) {
+            present.erase(lines[next]);
+        } else {
+            valid++;
+        }
+
+        lines[next] = line;
+        present.insert(line);
+        next = (next + 1) % lines.size();
+    }
+
+private:
+    std::vector<uint64_t> lines;
+    std::unordered_set<uint64_t> present;
+    uint32_t next;  // slot of the oldest line once the ring is full
+    uint32_t valid;
+};
+
+} //namespace Cassini
+} //namespace SST
+
+#endif
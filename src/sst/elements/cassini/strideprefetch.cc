@@ -28,6 +28,15 @@ using namespace SST;
 using namespace SST::Cassini;
 
 void StridePrefetcher::notifyAccess(const CacheListenerNotification& notify) {
+    handleAccess(notify);
+}
+
+void StridePrefetcher::notifyAccessBatch(const CacheListenerNotification* notify, size_t count) {
+    for (size_t i = 0; i < count; i++)
+        handleAccess(notify[i]);
+}
+
+void StridePrefetcher::handleAccess(const CacheListenerNotification& notify) {
     const NotifyAccessType notifyType = notify.getAccessType();
     const NotifyResultType notifyResType = notify.getResultType();
     const Addr addr = notify.getPhysicalAddress();
@@ -133,23 +142,13 @@ void StridePrefetcher::DetectStride() {
         output->verbose(CALL_INFO, 2, 0, "Checking prefetch history for cache line at base %" PRIx64 ", valid prefetch history entries=%" PRIu32 "\n", prefetchCacheLineBase,
             currentHistCount);
 
-        for(uint32_t i = 0; i < currentHistCount; ++i) {
-            if(prefetchHistory->at(i) == prefetchCacheLineBase) {
-                    inHistory = true;
-                    break;
-            }
-        }
+        inHistory = prefetchHistory->contains(prefetchCacheLineBase);
 
         if(! inHistory) {
             statPrefetchEventsIssued->addData(1);
 
-            // Remove the oldest cache line
-            if(currentHistCount == prefetchHistoryCount) {
-                    prefetchHistory->pop_front();
-            }
-
-            // Put the cache line at the back of the queue
-            prefetchHistory->push_back(prefetchCacheLineBase);
+            // Put the cache line in the history, replacing the oldest one when it is full
+            prefetchHistory->insert(prefetchCacheLineBase);
 
             assert((ev->getAddr() % blockSize) == 0);
 
@@ -188,7 +187,7 @@ StridePrefetcher::StridePrefetcher(ComponentId_t id, Params& params) : CacheList
     blockSize = params.find<uint64_t>("cache_line_size", 64);
 
     prefetchHistoryCount = params.find<uint32_t>("history", 16);
-    prefetchHistory = new std::deque<uint64_t>();
+    prefetchHistory = new PrefetchHistory(prefetchHistoryCount);
 
     strideReach = params.find<uint32_t>("reach", 2);
     strideDetectionRange = params.find<uint64_t>("detect_range", 4);
@@ -219,6 +218,7 @@ StridePrefetcher::StridePrefetcher(ComponentId_t id, Params& params) : CacheList
 
 StridePrefetcher::~StridePrefetcher() {
     free(recentAddrList);
+    delete prefetchHistory;
 }
 
 void StridePrefetcher::registerResponseCallback(Event::HandlerBase* handler) {
@@ -29,6 +29,8 @@
 
 #include <sst/core/output.h>
 
+#include "prefetchHistory.h"
+
 using namespace SST;
 using namespace SST::MemHierarchy;
 using namespace std;
@@ -42,6 +44,7 @@ public:
     ~StridePrefetcher();
 
     void notifyAccess(const CacheListenerNotification& notify);
+    void notifyAccessBatch(const CacheListenerNotification* notify, size_t count);
     void registerResponseCallback(Event::HandlerBase *handler);
     void printStats(Output &out);
 
@@ -75,9 +78,10 @@ public:
     )
 
 private:
+    inline void handleAccess(const CacheListenerNotification& notify);
     Output* output;
     std::vector<Event::HandlerBase*> registeredCallbacks;
-    std::deque<uint64_t>* prefetchHistory;
+    PrefetchHistory* prefetchHistory;
     uint32_t prefetchHistoryCount;
     uint64_t blockSize;
     bool overrunPageBoundary;
@@ -35,6 +35,10 @@
 #include <cmath>
 #include <regex>
 
+#ifdef __BMI2__
+#include <immintrin.h>
+#endif
+
 #include "c_AddressHasher.hpp"
 
 using namespace std;
@@ -267,132 +271,119 @@ void c_AddressHasher::build(Params &params) {
     }
   } // else found in map
 
+  compileFields();
+  parseXorMap(params.find<string>("strAddressXorMap", ""));
+
 } // c_AddressHasher(SST::Params)
 
+static const char* k_fieldNames[] = { "C", "c", "R", "B", "b", "r", "l", "h" };
 
-void c_AddressHasher::fillHashedAddress(c_HashedAddress *x_hashAddr, const ulong x_address) {
-  ulong l_cur=0;
-  ulong l_cnt=0;
-
-  //channel
-  auto l_bitPos = m_bitPositions.find("C");
-  if(l_bitPos == m_bitPositions.end()) { // not found
-    x_hashAddr->setChannel(0);
-  } else {
-    l_cur=0;
-    for(l_cnt=0;l_cnt<l_bitPos->second.size();l_cnt++) {
-      ulong l_val = l_bitPos->second[l_cnt];
-      ulong l_tmp = (((ulong)1 << l_val) & x_address) >> (l_val - l_cnt);
+void c_AddressHasher::compileFields() {
+  for(int ii = 0; ii < k_numFields; ii++) {
+    c_FieldMap &l_field = m_fields[ii];
+    l_field = c_FieldMap();
 
-      l_cur |= l_tmp;
+    auto l_bitPos = m_bitPositions.find(k_fieldNames[ii]);
+    if(l_bitPos == m_bitPositions.end() || l_bitPos->second.empty()) {
+      continue;
     }
-    x_hashAddr->setChannel(l_cur);
-  }
 
-  //pseudo channel
-   l_bitPos = m_bitPositions.find("c");
-  if(l_bitPos == m_bitPositions.end()) { // not found
-    x_hashAddr->setPChannel(0);
-  } else {
-    l_cur=0;
-    for(l_cnt=0;l_cnt<l_bitPos->second.size();l_cnt++) {
-      ulong l_val = l_bitPos->second[l_cnt];
-      ulong l_tmp = (((ulong)1 << l_val) & x_address) >> (l_val - l_cnt);
+    const vector<uint> &l_pos = l_bitPos->second;
+    for(unsigned l_cnt = 0; l_cnt < l_pos.size(); l_cnt++) {
+      if(l_pos[l_cnt] >= 64 || (l_cnt > 0 && l_pos[l_cnt] <= l_pos[l_cnt - 1])) {
+        output->fatal(CALL_INFO, -1, "%s, Error!: address map bits of field %s are not in ascending order below bit 64\n",
+                getName().c_str(), k_fieldNames[ii]);
+      }
+      l_field.mask |= (ulong)1 << l_pos[l_cnt];
 
-      l_cur |= l_tmp;
+      if(l_cnt > 0 && l_pos[l_cnt] == l_pos[l_cnt - 1] + 1) {
+        l_field.runs.back().bits = (l_field.runs.back().bits << 1) | 1;
+      } else {
+        l_field.runs.push_back(c_FieldMap::Run{l_pos[l_cnt], 1, l_cnt});
+      }
     }
-    x_hashAddr->setPChannel(l_cur);
-  }
-
-  //rank
-  l_bitPos = m_bitPositions.find("R");
-  if(l_bitPos == m_bitPositions.end()) { // not found
-    x_hashAddr->setRank(0);
-  } else {
-    l_cur=0;
-    for(l_cnt=0;l_cnt<l_bitPos->second.size();l_cnt++) {
-      ulong l_val = l_bitPos->second[l_cnt];
-      ulong l_tmp = (((ulong)1 << l_val) & x_address) >> (l_val - l_cnt);
 
-      l_cur |= l_tmp;
-    }
-    x_hashAddr->setRank(l_cur);
+    l_field.contiguous = (l_field.runs.size() == 1);
+    l_field.shift = l_pos[0];
   }
+}
 
-  //bankGroup
-  l_bitPos = m_bitPositions.find("B");
-  if(l_bitPos == m_bitPositions.end()) { // not found
-    x_hashAddr->setBankGroup(0);
-  } else {
-    l_cur=0;
-    for(l_cnt=0;l_cnt<l_bitPos->second.size();l_cnt++) {
-      ulong l_val = l_bitPos->second[l_cnt];
-      ulong l_tmp = (((ulong)1 << l_val) & x_address) >> (l_val - l_cnt);
-
-      l_cur |= l_tmp;
+// XOR hashes are "<field><field bit>:<address bit>[:<address bit>...]", separated by spaces
+void c_AddressHasher::parseXorMap(const std::string& x_xorMap) {
+  std::istringstream l_in(x_xorMap);
+  std::string l_entry;
+  while(l_in >> l_entry) {
+    int l_fieldIdx = -1;
+    for(int ii = 0; ii < k_numFields; ii++) {
+      if(l_entry[0] == k_fieldNames[ii][0]) {
+        l_fieldIdx = ii;
+      }
     }
-    x_hashAddr->setBankGroup(l_cur);
-  }
 
-  //bank
-  l_bitPos = m_bitPositions.find("b");
-  if(l_bitPos == m_bitPositions.end()) { // not found
-    x_hashAddr->setBank(0);
-  } else {
-    l_cur=0;
-    for(l_cnt=0;l_cnt<l_bitPos->second.size();l_cnt++) {
-      ulong l_val = l_bitPos->second[l_cnt];
-      ulong l_tmp = (((ulong)1 << l_val) & x_address) >> (l_val - l_cnt);
+    std::vector<unsigned long> l_nums;
+    std::istringstream l_numIn(l_entry.substr(1));
+    std::string l_num;
+    while(std::getline(l_numIn, l_num, ':')) {
+      if(l_num.empty() || l_num.find_first_not_of("0123456789") != std::string::npos) {
+        l_nums.clear();
+        break;
+      }
+      l_nums.push_back(std::stoul(l_num));
+    }
 
-      l_cur |= l_tmp;
+    if(l_fieldIdx < 0 || l_nums.size() < 2) {
+      output->fatal(CALL_INFO, -1, "%s, Error!: cannot parse '%s' in strAddressXorMap\n", getName().c_str(), l_entry.c_str());
     }
-    x_hashAddr->setBank(l_cur);
-  }
 
-  //row
-  l_bitPos = m_bitPositions.find("r");
-  if(l_bitPos == m_bitPositions.end()) { // not found
-    x_hashAddr->setRow(0);
-  } else {
-    l_cur=0;
-    for(l_cnt=0;l_cnt<l_bitPos->second.size();l_cnt++) {
-      ulong l_val = l_bitPos->second[l_cnt];
-      ulong l_tmp = (((ulong)1 << l_val) & x_address) >> (l_val - l_cnt);
+    c_FieldMap &l_field = m_fields[l_fieldIdx];
+    unsigned l_fieldBits = m_structureSizes.count(k_fieldNames[l_fieldIdx]) ? m_structureSizes[k_fieldNames[l_fieldIdx]] : 0;
+    if(l_nums[0] >= l_fieldBits) {
+      output->fatal(CALL_INFO, -1, "%s, Error!: '%s' in strAddressXorMap hashes bit %lu of field %s, which has %u bits\n",
+              getName().c_str(), l_entry.c_str(), l_nums[0], k_fieldNames[l_fieldIdx], l_fieldBits);
+    }
 
-      l_cur |= l_tmp;
+    ulong l_mask = 0;
+    for(unsigned ii = 1; ii < l_nums.size(); ii++) {
+      if(l_nums[ii] >= 64) {
+        output->fatal(CALL_INFO, -1, "%s, Error!: '%s' in strAddressXorMap uses an address bit above 63\n", getName().c_str(), l_entry.c_str());
+      }
+      l_mask |= (ulong)1 << l_nums[ii];
     }
-    x_hashAddr->setRow(l_cur);
+    l_field.xorBits.push_back(std::make_pair((unsigned)l_nums[0], l_mask));
   }
+}
 
-  //col
-  l_bitPos = m_bitPositions.find("l");
-  if(l_bitPos == m_bitPositions.end()) { // not found
-    x_hashAddr->setCol(0);
+inline ulong c_AddressHasher::extractField(const c_FieldMap& x_field, const ulong x_address) const {
+  ulong l_cur;
+  if(x_field.contiguous) {
+    l_cur = (x_address & x_field.mask) >> x_field.shift;
   } else {
-    l_cur=0;
-    for(l_cnt=0;l_cnt<l_bitPos->second.size();l_cnt++) {
-      ulong l_val = l_bitPos->second[l_cnt];
-      ulong l_tmp = (((ulong)1 << l_val) & x_address) >> (l_val - l_cnt);
+#ifdef __BMI2__
+    l_cur = _pext_u64(x_address, x_field.mask);
+#else
+    l_cur = 0;
+    for(const c_FieldMap::Run &l_run : x_field.runs) {
+      l_cur |= ((x_address >> l_run.srcShift) & l_run.bits) << l_run.dstShift;
+    }
+#endif
+  }
 
-      l_cur |= l_tmp;
-    }
-    x_hashAddr->setCol(l_cur);
+  for(const std::pair<unsigned, ulong> &l_xor : x_field.xorBits) {
+    l_cur ^= (ulong)__builtin_parityl(x_address & l_xor.second) << l_xor.first;
   }
+  return l_cur;
+}
 
-  //cacheline
-  l_bitPos = m_bitPositions.find("h");
-  if(l_bitPos == m_bitPositions.end()) { // not found
-    x_hashAddr->setCacheline(0);
-  } else {
-    l_cur=0;
-    for(l_cnt=0;l_cnt<l_bitPos->second.size();l_cnt++) {
-      ulong l_val = l_bitPos->second[l_cnt];
-      ulong l_tmp = (((ulong)1 << l_val) & x_address) >> (l_val - l_cnt);
 
-      l_cur |= l_tmp;
-    }
-    x_hashAddr->setCacheline(l_cur);
-  }
+void c_AddressHasher::fillHashedAddress(c_HashedAddress *x_hashAddr, const ulong x_address) {
+  x_hashAddr->setChannel(extractField(m_fields[k_fieldChannel], x_address));
+  x_hashAddr->setPChannel(extractField(m_fields[k_fieldPChannel], x_address));
+  x_hashAddr->setRank(extractField(m_fields[k_fieldRank], x_address));
+  x_hashAddr->setBankGroup(extractField(m_fields[k_fieldBankGroup], x_address));
+  x_hashAddr->setBank(extractField(m_fields[k_fieldBank], x_address));
+  x_hashAddr->setRow(extractField(m_fields[k_fieldRow], x_address));
+  x_hashAddr->setCol(extractField(m_fields[k_fieldCol], x_address));
+  x_hashAddr->setCacheline(extractField(m_fields[k_fieldCacheline], x_address));
 
   unsigned l_bankId =
     x_hashAddr->getBank()
@@ -37,6 +37,7 @@
 
 #include <memory>
 #include <map>
+#include <vector>
 
 // local includes
 //#include "c_BankCommand.hpp"
@@ -70,6 +71,7 @@ namespace SST {
             SST_ELI_DOCUMENT_PARAMS(
                 {"numBytesPerTransaction", "Number of bytes retrieved for every transaction", "1"},
                 {"strAddressMapStr","String defining the address mapping scheme","_r_l_b_R_B_h_"},
+                {"strAddressXorMap","Space separated XOR hashes applied on top of the address map. Each is a field, the field bit and the address bits XORed into it, e.g. 'b0:13:17 b1:14:18' XORs address bits 13 and 17 into bank bit 0","" },
             )
 
             SST_ELI_DOCUMENT_PORTS(
@@ -113,6 +115,24 @@ namespace SST {
             std::map<std::string, std::vector<uint> > m_bitPositions;
             std::map<std::string, uint> m_structureSizes;  // Used for checking that params agree
 
+            // The address map compiled into a mask per field. A field's address bits go to
+            // consecutive field bits in ascending order, which is a bit gather (PEXT) of the mask
+            enum { k_fieldChannel, k_fieldPChannel, k_fieldRank, k_fieldBankGroup, k_fieldBank,
+                   k_fieldRow, k_fieldCol, k_fieldCacheline, k_numFields };
+            struct c_FieldMap {
+                ulong mask = 0;
+                bool contiguous = true;  // a single run of bits, extracted by shift and mask
+                unsigned shift = 0;
+                struct Run { unsigned srcShift; ulong bits; unsigned dstShift; };
+                std::vector<Run> runs;   // portable gather, one entry per run of consecutive bits
+                std::vector<std::pair<unsigned, ulong> > xorBits; // field bit, address bits XORed into it
+            };
+            c_FieldMap m_fields[k_numFields];
+
+            void compileFields();
+            void parseXorMap(const std::string& x_xorMap);
+            inline ulong extractField(const c_FieldMap& x_field, const ulong x_address) const;
+
             // regex replacement stuff
             void parsePattern(std::string *x_inStr, std::pair<std::string, uint> *x_outPair);
 
@@ -26,6 +26,7 @@
 // WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
 // See the License for the specific language governing permissions and
 // limitations under the License.
+#include <algorithm>
 #include <memory>
 #include <assert.h>
 
@@ -150,10 +151,26 @@ void c_BankInfo::clockTic(SimTime_t x_cycle) {
     if (0 < m_autoPrechargeTimer)
         --m_autoPrechargeTimer;
 
-    m_bankState->clockTic(this, x_cycle);
+    if (!m_bankState->isPassive())
+        m_bankState->clockTic(this, x_cycle);
 
 }
 
+void c_BankInfo::skipIdleCycles(SimTime_t x_cycles, SimTime_t x_cycle) {
+    m_autoPrechargeTimer -= std::min(m_autoPrechargeTimer, x_cycles);
+
+    // without a pending command a state only counts its timer down, and no
+    // state timer starts above nCCD_L, so later tics change nothing
+    SimTime_t l_stateTics = x_cycles;
+    if (nullptr != m_bankParams)
+        l_stateTics = std::min(l_stateTics, (SimTime_t) m_bankParams->at("nCCD_L"));
+    else
+        l_stateTics = std::min(l_stateTics, (SimTime_t) 2);
+
+    for (SimTime_t l_i = 1; l_i <= l_stateTics; ++l_i)
+        m_bankState->clockTic(this, x_cycle + l_i);
+}
+
 std::list<e_BankCommandType> c_BankInfo::getAllowedCommands() {
     return m_bankState->getAllowedCommands();
 }
@@ -57,6 +57,9 @@ public:
 
     void clockTic(SimTime_t x_cycle);
 
+    // advance the bank by x_cycles tics at once, only valid while no command is pending
+    void skipIdleCycles(SimTime_t x_cycles, SimTime_t x_cycle);
+
     std::list<e_BankCommandType> getAllowedCommands();
 
     bool isCommandAllowed(c_BankCommand* x_cmdPtr, SimTime_t x_simCycle);
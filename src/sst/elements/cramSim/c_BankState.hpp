@@ -32,9 +32,13 @@
 #include <sst/core/sst_types.h>
 
 // C++ includes
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <list>
 #include <map>
+#include <new>
+#include <vector>
 
 // CramSim includes
 //#include "c_BankCommand.hpp"
@@ -57,9 +61,32 @@ enum class e_BankState {
 
 class c_BankState {
 public:
+    c_BankState() :
+        m_bankParams(nullptr), m_currentState(e_BankState::NONE), m_allowedCommands(0), m_passive(false) {
+    }
+
     virtual ~c_BankState() {
     }
 
+    // A state is created on every transition and deleted on the next one, so
+    // recycle the storage of each state size instead of going to the heap.
+    static void* operator new(std::size_t x_size) {
+        std::vector<void*> *l_free = freeList(x_size);
+        if (nullptr == l_free || l_free->empty())
+            return ::operator new(x_size);
+        void *l_ptr = l_free->back();
+        l_free->pop_back();
+        return l_ptr;
+    }
+
+    static void operator delete(void* x_ptr, std::size_t x_size) {
+        std::vector<void*> *l_free = freeList(x_size);
+        if (nullptr == l_free)
+            ::operator delete(x_ptr);
+        else
+            l_free->push_back(x_ptr);
+    }
+
     virtual void handleCommand(c_BankInfo* x_bank, c_BankCommand* x_bankCommandPtr, SimTime_t x_cycle) = 0;
 
     virtual void clockTic(c_BankInfo* x_bank, SimTime_t x_cycle) = 0;
@@ -67,7 +94,13 @@ public:
     virtual void enter(c_BankInfo* x_bank, c_BankState* x_prevState,
             c_BankCommand* x_cmdPtr, SimTime_t x_cycle) = 0;
 
-    virtual std::list<e_BankCommandType> getAllowedCommands() = 0;
+    std::list<e_BankCommandType> getAllowedCommands() {
+        std::list<e_BankCommandType> l_cmds;
+        for (unsigned l_i = 0; l_i < 32; ++l_i)
+            if (m_allowedCommands & (1u << l_i))
+                l_cmds.push_back(static_cast<e_BankCommandType>(l_i));
+        return l_cmds;
+    }
 
     virtual bool isCommandAllowed(c_BankCommand* x_cmdPtr,
             c_BankInfo* x_bankPtr) = 0;
@@ -76,11 +109,37 @@ public:
         return m_currentState;
     }
 
+    // true while clockTic would change nothing, so the bank need not be ticked
+    bool isPassive() const {
+        return m_passive;
+    }
+
 //private:
 protected:
+    void clearAllowedCommands() {
+        m_allowedCommands = 0;
+    }
+    void allowCommand(e_BankCommandType x_cmd) {
+        m_allowedCommands |= (1u << static_cast<unsigned>(x_cmd));
+    }
+    bool isAllowedCommand(e_BankCommandType x_cmd) const {
+        return (m_allowedCommands & (1u << static_cast<unsigned>(x_cmd))) != 0;
+    }
+
     std::map<std::string, unsigned>* m_bankParams;
 
     e_BankState m_currentState;
+    uint32_t m_allowedCommands; // bit per e_BankCommandType
+    bool m_passive;
+
+private:
+    static const std::size_t k_freeListBuckets = 64; // 8 byte buckets
+
+    static std::vector<void*>* freeList(std::size_t x_size) {
+        static thread_local std::vector<void*> l_freeLists[k_freeListBuckets];
+        std::size_t l_bucket = (x_size + 7) / 8;
+        return (l_bucket < k_freeListBuckets) ? &l_freeLists[l_bucket] : nullptr;
+    }
 
 };
 }
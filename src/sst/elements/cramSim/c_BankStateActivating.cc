@@ -48,7 +48,7 @@ c_BankStateActivating::c_BankStateActivating(std::map<std::string, unsigned>* x_
     m_timer = 0;
     m_currentState = e_BankState::ACTNG;
     m_bankParams = x_bankParams;
-    m_allowedCommands.clear();
+    clearAllowedCommands();
 }
 
 c_BankStateActivating::~c_BankStateActivating() {
@@ -89,7 +89,7 @@ void c_BankStateActivating::enter(c_BankInfo* x_bank,
     m_prevCommandPtr = x_cmdPtr;
     m_receivedCommandPtr = nullptr;
     m_timer = 0; //TODO: Ask Michael Healey about the timing here
-    m_allowedCommands.clear();
+    clearAllowedCommands();
     // this state should not have any allowed bank commands
     // this is a transitory state
 
@@ -98,22 +98,11 @@ void c_BankStateActivating::enter(c_BankInfo* x_bank,
         delete x_prevState;
 }
 
-std::list<e_BankCommandType> c_BankStateActivating::getAllowedCommands() {
-    return (m_allowedCommands);
-}
-
 
 bool c_BankStateActivating::isCommandAllowed(c_BankCommand* x_cmdPtr,
         c_BankInfo* x_bankPtr) {
 
     // Cmd must be of an allowed type and BankState cannot already be processing another cmd
-    for (std::list<e_BankCommandType>::iterator l_iter =
-            m_allowedCommands.begin(); l_iter != m_allowedCommands.end(); ++l_iter) {
-
-        if (x_cmdPtr->getCommandMnemonic() == *l_iter && m_receivedCommandPtr
-                == nullptr)
-            return true;
-    }
-    return false;
+    return isAllowedCommand(x_cmdPtr->getCommandMnemonic()) && m_receivedCommandPtr == nullptr;
 
 }
@@ -58,8 +58,6 @@ public:
 
     virtual void enter(c_BankInfo* x_bank, c_BankState* x_prevState,
             c_BankCommand* x_cmdPtr, SimTime_t x_cycle);
-    virtual std::list<e_BankCommandType> getAllowedCommands();
-
     virtual bool isCommandAllowed(c_BankCommand* x_cmdPtr,
             c_BankInfo* x_bankPtr);
 
@@ -68,7 +66,6 @@ private:
 
     c_BankCommand* m_prevCommandPtr;
     c_BankCommand* m_receivedCommandPtr;
-    std::list<e_BankCommandType> m_allowedCommands;
 
 };
 }
@@ -56,7 +56,7 @@ c_BankStateActive::c_BankStateActive(
 
     m_currentState = e_BankState::ACTIVE;
     m_bankParams = x_bankParams;
-    m_allowedCommands.clear();
+    clearAllowedCommands();
 }
 
 c_BankStateActive::~c_BankStateActive() {
@@ -72,6 +72,7 @@ void c_BankStateActive::handleCommand(c_BankInfo* x_bank,
 
     if (nullptr == m_receivedCommandPtr) {
         m_receivedCommandPtr = x_bankCommandPtr;
+        m_passive = false;
 
 
         m_nextStatePtr = nullptr;
@@ -110,13 +111,17 @@ void c_BankStateActive::clockTic(c_BankInfo* x_bank, SimTime_t x_cycle) {
 
     if (0 < m_timer) {
         --m_timer;
+        // the row stays open until a command arrives
+        if (0 == m_timer && nullptr == m_receivedCommandPtr)
+            m_passive = true;
     } else {
         if (m_receivedCommandPtr) {
 
             if ((nullptr != m_nextStatePtr)
                     && (m_receivedCommandPtr != nullptr))
                 m_nextStatePtr->enter(x_bank, this, m_receivedCommandPtr, x_cycle);
-        }
+        } else
+            m_passive = true;
     }
 }
 
@@ -141,29 +146,30 @@ void c_BankStateActive::enter(c_BankInfo* x_bank, c_BankState* x_prevState,
 
 
     m_timer = m_bankParams->at("nCCD_L") - 2;
+    m_passive = false;
 
-    m_allowedCommands.clear();
-    m_allowedCommands.push_back(e_BankCommandType::READ);
+    clearAllowedCommands();
+    allowCommand(e_BankCommandType::READ);
     x_bank->setNextCommandCycle(e_BankCommandType::READ,
             std::max(x_bank->getNextCommandCycle(e_BankCommandType::READ),
                  l_time + m_bankParams->at("nRCD") - 2));
 
-    m_allowedCommands.push_back(e_BankCommandType::READA);
+    allowCommand(e_BankCommandType::READA);
     x_bank->setNextCommandCycle(e_BankCommandType::READA,
             std::max(x_bank->getNextCommandCycle(e_BankCommandType::READA),
                  l_time + m_bankParams->at("nRCD") - 2));
 
-    m_allowedCommands.push_back(e_BankCommandType::WRITE);
+    allowCommand(e_BankCommandType::WRITE);
     x_bank->setNextCommandCycle(e_BankCommandType::WRITE,
             std::max(x_bank->getNextCommandCycle(e_BankCommandType::WRITE),
                  l_time + m_bankParams->at("nRCD") - 2));
 
-    m_allowedCommands.push_back(e_BankCommandType::WRITEA);
+    allowCommand(e_BankCommandType::WRITEA);
     x_bank->setNextCommandCycle(e_BankCommandType::WRITEA,
             std::max(x_bank->getNextCommandCycle(e_BankCommandType::WRITEA),
                  l_time + m_bankParams->at("nRCD") - 2));
 
-    m_allowedCommands.push_back(e_BankCommandType::PRE);
+    allowCommand(e_BankCommandType::PRE);
     x_bank->setNextCommandCycle(e_BankCommandType::PRE,
                     (std::max(x_bank->getNextCommandCycle(e_BankCommandType::PRE),
                           std::max(
@@ -182,22 +188,10 @@ void c_BankStateActive::enter(c_BankInfo* x_bank, c_BankState* x_prevState,
         delete x_prevState;
 }
 
-std::list<e_BankCommandType> c_BankStateActive::getAllowedCommands() {
-    return (m_allowedCommands);
-}
-
 bool c_BankStateActive::isCommandAllowed(c_BankCommand* x_cmdPtr,
         c_BankInfo* x_bankPtr) {
 
 // Cmd must be of an allowed type and BankState cannot already be processing another cmd
-    for (std::list<e_BankCommandType>::iterator l_iter =
-            m_allowedCommands.begin(); l_iter != m_allowedCommands.end();
-            ++l_iter) {
-
-        if (x_cmdPtr->getCommandMnemonic() == *l_iter
-                && m_receivedCommandPtr == nullptr)
-            return true;
-    }
-    return false;
+    return isAllowedCommand(x_cmdPtr->getCommandMnemonic()) && m_receivedCommandPtr == nullptr;
 
 }
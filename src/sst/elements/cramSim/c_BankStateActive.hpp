@@ -56,14 +56,11 @@ public:
 
     virtual void enter(c_BankInfo* x_bank, c_BankState* x_prevState, c_BankCommand* x_cmdPtr, SimTime_t x_simCycle);
 
-    virtual std::list<e_BankCommandType> getAllowedCommands();
-
     virtual bool isCommandAllowed(c_BankCommand* x_cmdPtr,
             c_BankInfo* x_bankPtr);
 
 private:
 
-    std::list<e_BankCommandType> m_allowedCommands;
     c_BankCommand* m_receivedCommandPtr; //<! pointer to command received after entering this state
     c_BankCommand* m_prevCommandPtr;
     c_BankState* m_nextStatePtr;
@@ -77,15 +77,12 @@ void c_BankStateIdle::handleCommand(c_BankInfo* x_bank, c_BankCommand* x_bankCom
     if (nullptr == m_receivedCommandPtr) {
         m_timer = 1;
         m_receivedCommandPtr = x_bankCommandPtr;
-        m_allowedCommands.clear();
+        m_passive = false;
+        clearAllowedCommands();
     }
 }
 
 // returns the list of allowed commands in this state
-std::list<e_BankCommandType> c_BankStateIdle::getAllowedCommands() {
-    return (m_allowedCommands);
-}
-
 // call this function every clock cycle
 void c_BankStateIdle::clockTic(c_BankInfo* x_bank, SimTime_t x_cycle) {
 
@@ -134,13 +131,15 @@ void c_BankStateIdle::enter(c_BankInfo* x_bank, c_BankState* x_prevState,
     m_prevCommandPtr = x_cmdPtr;
 
     m_receivedCommandPtr = nullptr;
+    // without a command the timer means nothing, handleCommand restarts it
+    m_passive = true;
 
     SimTime_t l_time = x_cycle;
 
-    m_allowedCommands.clear();
-    m_allowedCommands.push_back(e_BankCommandType::ACT);
-    m_allowedCommands.push_back(e_BankCommandType::REF);
-    m_allowedCommands.push_back(e_BankCommandType::PRE);
+    clearAllowedCommands();
+    allowCommand(e_BankCommandType::ACT);
+    allowCommand(e_BankCommandType::REF);
+    allowCommand(e_BankCommandType::PRE);
 
     x_bank->setNextCommandCycle(e_BankCommandType::ACT,
             std::max(x_bank->getNextCommandCycle(e_BankCommandType::ACT),
@@ -164,14 +163,6 @@ bool c_BankStateIdle::isCommandAllowed(c_BankCommand* x_cmdPtr,
         c_BankInfo* x_bankPtr) {
 
 // Cmd must be of an allowed type and BankState cannot already be processing another cmd
-    for (std::list<e_BankCommandType>::iterator l_iter =
-            m_allowedCommands.begin(); l_iter != m_allowedCommands.end();
-            ++l_iter) {
-
-        if (x_cmdPtr->getCommandMnemonic() == *l_iter
-                && m_receivedCommandPtr == nullptr)
-            return true;
-    }
-    return false;
+    return isAllowedCommand(x_cmdPtr->getCommandMnemonic()) && m_receivedCommandPtr == nullptr;
 
 }
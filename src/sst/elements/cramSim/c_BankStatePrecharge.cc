@@ -87,7 +87,7 @@ void c_BankStatePrecharge::enter(c_BankInfo* x_bank, c_BankState* x_prevState,
     m_prevCommandPtr = x_cmdPtr;
     m_receivedCommandPtr = nullptr;
     m_timer = m_bankParams->at("nRP") - 2; // MBH it takes 2 cycles from the time PRE is issued for m_timer to start counting down
-    m_allowedCommands.clear();
+    clearAllowedCommands();
 
 
 // this state should not have any allowed bank commands
@@ -99,22 +99,10 @@ void c_BankStatePrecharge::enter(c_BankInfo* x_bank, c_BankState* x_prevState,
 
 }
 
-std::list<e_BankCommandType> c_BankStatePrecharge::getAllowedCommands() {
-    return (m_allowedCommands);
-}
-
 bool c_BankStatePrecharge::isCommandAllowed(c_BankCommand* x_cmdPtr,
         c_BankInfo* x_bankPtr) {
 
 // Cmd must be of an allowed type and BankState cannot already be processing another cmd
-    for (std::list<e_BankCommandType>::iterator l_iter =
-            m_allowedCommands.begin(); l_iter != m_allowedCommands.end();
-            ++l_iter) {
-
-        if (x_cmdPtr->getCommandMnemonic() == *l_iter
-                && m_receivedCommandPtr == nullptr)
-            return true;
-    }
-    return false;
+    return isAllowedCommand(x_cmdPtr->getCommandMnemonic()) && m_receivedCommandPtr == nullptr;
 
 }
@@ -57,8 +57,6 @@ public:
     virtual void enter(c_BankInfo* x_bank,
             c_BankState* x_prevState, c_BankCommand* x_cmdPtr, SimTime_t x_cycle);
 
-    virtual std::list<e_BankCommandType> getAllowedCommands();
-
     virtual bool isCommandAllowed(c_BankCommand* x_cmdPtr,
             c_BankInfo* x_bankPtr);
 
@@ -66,7 +64,6 @@ private:
     SimTime_t m_timer; //<! counts down to 0. when 0, changes state to IDLE automatically. is reset to ?? at state entry.
     c_BankCommand* m_receivedCommandPtr; //<! pointer to a received command
     c_BankCommand* m_prevCommandPtr;
-    std::list<e_BankCommandType> m_allowedCommands;
 
 };
 
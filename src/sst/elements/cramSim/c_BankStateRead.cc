@@ -201,35 +201,35 @@ void c_BankStateRead::enter(c_BankInfo* x_bank, c_BankState* x_prevState,
 
     SimTime_t l_time = x_cycle;
 
-    m_allowedCommands.clear();
-    m_allowedCommands.push_back(e_BankCommandType::READ);
+    clearAllowedCommands();
+    allowCommand(e_BankCommandType::READ);
     x_bank->setNextCommandCycle(e_BankCommandType::READ,
             (std::max(x_bank->getNextCommandCycle(e_BankCommandType::READ),
                     x_bank->getLastCommandCycle(e_BankCommandType::READ)
                             + m_bankParams->at("nCCD_L"))));
 
-    m_allowedCommands.push_back(e_BankCommandType::READA);
+    allowCommand(e_BankCommandType::READA);
     x_bank->setNextCommandCycle(e_BankCommandType::READA,
             (std::max(x_bank->getNextCommandCycle(e_BankCommandType::READA),
                     x_bank->getLastCommandCycle(e_BankCommandType::READ)
                             + m_bankParams->at("nCCD_L"))));
 
 //  FIXME: below for write going to the same row as the previous WRITE command
-    m_allowedCommands.push_back(e_BankCommandType::WRITE);
+    allowCommand(e_BankCommandType::WRITE);
     x_bank->setNextCommandCycle(e_BankCommandType::WRITE,
             (std::max(x_bank->getNextCommandCycle(e_BankCommandType::WRITE),
                     x_bank->getLastCommandCycle(e_BankCommandType::READ)
                             + m_bankParams->at("nCWL") + m_bankParams->at("nBL")
                             + m_bankParams->at("nWTR"))));
 
-    m_allowedCommands.push_back(e_BankCommandType::WRITEA);
+    allowCommand(e_BankCommandType::WRITEA);
     x_bank->setNextCommandCycle(e_BankCommandType::WRITEA,
             (std::max(x_bank->getNextCommandCycle(e_BankCommandType::WRITEA),
                     x_bank->getLastCommandCycle(e_BankCommandType::READ)
                             + m_bankParams->at("nCWL") + m_bankParams->at("nBL")
                             + m_bankParams->at("nWTR"))));
 
-    m_allowedCommands.push_back(e_BankCommandType::PRE);
+    allowCommand(e_BankCommandType::PRE);
     x_bank->setNextCommandCycle(e_BankCommandType::PRE,
             (std::max(x_bank->getNextCommandCycle(e_BankCommandType::PRE),
                     std::max(
@@ -248,22 +248,10 @@ void c_BankStateRead::enter(c_BankInfo* x_bank, c_BankState* x_prevState,
 
 }
 
-std::list<e_BankCommandType> c_BankStateRead::getAllowedCommands() {
-    return (m_allowedCommands);
-}
-
 bool c_BankStateRead::isCommandAllowed(c_BankCommand* x_cmdPtr,
         c_BankInfo* x_bankPtr) {
 
 // Cmd must be of an allowed type and BankState cannot already be processing another cmd
-    for (std::list<e_BankCommandType>::iterator l_iter =
-            m_allowedCommands.begin(); l_iter != m_allowedCommands.end();
-            ++l_iter) {
-
-        if (x_cmdPtr->getCommandMnemonic() == *l_iter
-                && m_receivedCommandPtr == nullptr)
-            return true;
-    }
-    return false;
+    return isAllowedCommand(x_cmdPtr->getCommandMnemonic()) && m_receivedCommandPtr == nullptr;
 
 }
@@ -51,7 +51,7 @@ c_BankStateReadA::c_BankStateReadA(
     m_timerExit = 0;
     m_currentState = e_BankState::READA;
     m_bankParams = x_bankParams;
-    m_allowedCommands.clear();
+    clearAllowedCommands();
 }
 
 c_BankStateReadA::~c_BankStateReadA() {
@@ -131,7 +131,7 @@ void c_BankStateReadA::enter(c_BankInfo* x_bank, c_BankState* x_prevState,
     x_bank->setLastCommandCycle(e_BankCommandType::READA,l_time);
 
 
-    m_allowedCommands.clear();
+    clearAllowedCommands();
     x_bank->setNextCommandCycle(e_BankCommandType::READ,
             (std::max(x_bank->getNextCommandCycle(e_BankCommandType::READ),
                     x_bank->getLastCommandCycle(e_BankCommandType::READ)
@@ -169,10 +169,6 @@ void c_BankStateReadA::enter(c_BankInfo* x_bank, c_BankState* x_prevState,
 
 }
 
-std::list<e_BankCommandType> c_BankStateReadA::getAllowedCommands() {
-    return (m_allowedCommands);
-}
-
 bool c_BankStateReadA::isCommandAllowed(c_BankCommand* x_cmdPtr,
         c_BankInfo* x_bankPtr) {
     return false;
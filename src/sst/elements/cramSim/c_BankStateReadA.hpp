@@ -56,8 +56,6 @@ public:
     virtual void enter(c_BankInfo* x_bank, c_BankState* x_prevState,
             c_BankCommand* x_cmdPtr, SimTime_t x_cycle);
 
-    virtual std::list<e_BankCommandType> getAllowedCommands();
-
     virtual bool isCommandAllowed(c_BankCommand* x_cmdPtr,
             c_BankInfo* x_bankPtr);
 
@@ -65,7 +63,6 @@ public:
 private:
     SimTime_t m_timerEnter; //<! counts down to 0. when 0, changes state to ACTIVE automatically. is reset to ?? at state entry.
     SimTime_t m_timerExit; //<! counts down to 0 and models the exit to PRE time
-    std::list<e_BankCommandType> m_allowedCommands;
     c_BankCommand* m_prevCommandPtr;
     c_BankState* m_nextStatePtr;
 };
@@ -49,7 +49,7 @@ c_BankStateRefresh::c_BankStateRefresh(
         // Simulation::getSimulation()->getSimulationOutput().output("Entered %s\n", __PRETTY_FUNCTION);
     m_bankParams = x_bankParams;
     m_currentState = e_BankState::REF;
-    m_allowedCommands.clear();
+    clearAllowedCommands();
 }
 
 c_BankStateRefresh::~c_BankStateRefresh() {
@@ -66,10 +66,6 @@ void c_BankStateRefresh::handleCommand(c_BankInfo* x_bank,
 }
 
 // returns the list of allowed commands in this state
-std::list<e_BankCommandType> c_BankStateRefresh::getAllowedCommands() {
-    return (m_allowedCommands);
-}
-
 // call this function every clock cycle
 void c_BankStateRefresh::clockTic(c_BankInfo* x_bank, SimTime_t x_cycle) {
     if (0 < m_timer) {
@@ -98,7 +94,7 @@ void c_BankStateRefresh::enter(c_BankInfo* x_bank, c_BankState* x_prevState,
     m_receivedCommandPtr = nullptr;
     m_timer = m_bankParams->at("nRFC")-2;
 
-    m_allowedCommands.clear();
+    clearAllowedCommands();
     // this state should not have any allowed bank commands
     // this is a transitory state
     SimTime_t l_time = x_cycle;
@@ -55,15 +55,12 @@ public:
 
     virtual void clockTic(c_BankInfo* x_bank, SimTime_t x_cycle);
     virtual void enter(c_BankInfo* x_bank, c_BankState* x_prevState, c_BankCommand* x_cmdPtr, SimTime_t x_cycle);
-    virtual std::list<e_BankCommandType> getAllowedCommands();
-
     virtual bool isCommandAllowed(c_BankCommand* x_cmdPtr,
             c_BankInfo* x_bankPtr);
 
 private:
 
 
-    std::list<e_BankCommandType> m_allowedCommands;
     c_BankCommand* m_receivedCommandPtr;
     c_BankCommand* m_prevCommandPtr;
     SimTime_t m_timer;
@@ -57,8 +57,6 @@ public:
     virtual void enter(c_BankInfo* x_bank,
             c_BankState* x_prevState, c_BankCommand* x_cmdPtr,SimTime_t x_cycle);
 
-    virtual std::list<e_BankCommandType> getAllowedCommands();
-
     virtual bool isCommandAllowed(c_BankCommand* x_cmdPtr,
             c_BankInfo* x_bankPtr);
 
@@ -66,7 +64,6 @@ private:
     SimTime_t m_timer; // counts down to 0
     SimTime_t m_timerExit; // counts down to 0 during state exit
 
-    std::list<e_BankCommandType> m_allowedCommands;
     c_BankCommand* m_receivedCommandPtr;
     c_BankCommand* m_prevCommandPtr;
     c_BankState* m_nextStatePtr;
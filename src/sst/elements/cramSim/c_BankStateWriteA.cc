@@ -49,7 +49,7 @@ c_BankStateWriteA::c_BankStateWriteA(
     m_timerExit = 0;
     m_currentState = e_BankState::WRITEA;
     m_bankParams = x_bankParams;
-    m_allowedCommands.clear();
+    clearAllowedCommands();
 }
 
 c_BankStateWriteA::~c_BankStateWriteA() {
@@ -121,7 +121,7 @@ void c_BankStateWriteA::enter(c_BankInfo* x_bank, c_BankState* x_prevState,
 
     x_bank->setLastCommandCycle(e_BankCommandType::WRITEA,l_time);
 
-    m_allowedCommands.clear();
+    clearAllowedCommands();
     x_bank->setNextCommandCycle(e_BankCommandType::READ,
             std::max(x_bank->getNextCommandCycle(e_BankCommandType::READ),
                     x_bank->getLastCommandCycle(e_BankCommandType::WRITE))
@@ -162,10 +162,6 @@ void c_BankStateWriteA::enter(c_BankInfo* x_bank, c_BankState* x_prevState,
 
 }
 
-std::list<e_BankCommandType> c_BankStateWriteA::getAllowedCommands() {
-    return (m_allowedCommands);
-}
-
 bool c_BankStateWriteA::isCommandAllowed(c_BankCommand* x_cmdPtr,
         c_BankInfo* x_bankPtr) {
 
@@ -133,6 +133,28 @@ void c_CmdScheduler::run(SimTime_t simCycle){
 }
 
 
+bool c_CmdScheduler::isIdle(){
+    for (auto &l_channelQueues : m_cmdQueues)
+        for (auto &l_cmdQueue : l_channelQueues)
+            if (!l_cmdQueue.empty())
+                return false;
+    return true;
+}
+
+
+// the round robin index moves on every cycle, busy or not
+void c_CmdScheduler::skipIdleCycles(SimTime_t x_cycles){
+    for(unsigned l_ch=0;l_ch<m_numChannels;l_ch++) {
+        uint64_t l_idx = m_nextCmdQIdx.at(l_ch);
+        if(m_schedulingPolicy==e_SchedulingPolicy::BANK)
+            l_idx = (l_idx + x_cycles % m_numBanksPerChannel) % m_numBanksPerChannel;
+        else if(m_schedulingPolicy==e_SchedulingPolicy::RANK)
+            l_idx = (l_idx + (x_cycles % (m_numBanksPerChannel-1)) * m_numBanksPerRank) % (m_numBanksPerChannel-1);
+        m_nextCmdQIdx.at(l_ch) = l_idx;
+    }
+}
+
+
 bool c_CmdScheduler::push(c_BankCommand* x_cmd) {
     unsigned l_ch=x_cmd->getHashedAddress()->getChannel();
     unsigned l_bank=x_cmd->getHashedAddress()->getBankId() % m_numBanksPerChannel;
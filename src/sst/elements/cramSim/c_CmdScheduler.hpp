@@ -72,6 +72,8 @@ namespace SST{
             void run(SimTime_t simCycle);
             bool push(c_BankCommand* x_cmd);
             unsigned getToken(const c_HashedAddress &x_addr);
+            bool isIdle();
+            void skipIdleCycles(SimTime_t x_cycles);
 
 
         private:
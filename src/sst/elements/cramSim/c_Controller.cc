@@ -27,6 +27,8 @@
 
 #include "sst_config.h"
 
+#include <limits>
+
 #include "c_Controller.hpp"
 #include "c_TxnReqEvent.hpp"
 #include "c_TxnResEvent.hpp"
@@ -119,12 +121,16 @@ c_Controller::c_Controller(ComponentId_t id, Params &params) :
     // get configured clock frequency
     k_controllerClockFreqStr = (std::string)params.find<std::string>("strControllerClockFrequency", "1GHz", l_found);
 
+    k_enableIdleSkip = (uint32_t)params.find<uint32_t>("boolEnableIdleSkip", 0);
+
     //configure SST link
     configure_link();
 
     //set our clock
-    registerClock(k_controllerClockFreqStr,
-                  new Clock::Handler<c_Controller>(this, &c_Controller::clockTic));
+    m_clockHandler = new Clock::Handler<c_Controller>(this, &c_Controller::clockTic);
+    m_clockTC = registerClock(k_controllerClockFreqStr, m_clockHandler);
+    m_clockOn = true;
+    m_lastActiveCycle = 0;
 
 
 
@@ -147,6 +153,12 @@ void c_Controller::configure_link() {
     m_memLink = configureLink("memLink",
                                        new Event::Handler<c_Controller>(this,
                                                                         &c_Controller::handleInDeviceResPtrEvent));
+
+    // wakes the controller for a refresh while its clock is off
+    m_idleWakeLink = nullptr;
+    if (k_enableIdleSkip)
+        m_idleWakeLink = configureSelfLink("idleWakeLink", k_controllerClockFreqStr,
+                                           new Event::Handler<c_Controller>(this, &c_Controller::handleIdleWake));
 }
 
 
@@ -219,11 +231,69 @@ bool c_Controller::clockTic(SST::Cycle_t clock) {
     // 6. run device driver
     m_deviceDriver->run();
 
+    m_lastActiveCycle = clock;
+
+    if (k_enableIdleSkip && isIdle()) {
+        turnClockOff(clock);
+        return true;
+    }
 
     return false;
 }
 
 
+// true when every queue is empty and the banks have settled, so that the
+// following cycles only count down timers
+bool c_Controller::isIdle() {
+    return m_ReqQ.empty() && m_ResQ.empty()
+           && m_txnScheduler->isIdle() && m_txnConverter->isIdle()
+           && m_cmdScheduler->isIdle() && m_deviceDriver->isIdle()
+           && m_deviceDriver->getCyclesToRefresh() >= 2;
+}
+
+
+void c_Controller::turnClockOff(SST::Cycle_t x_cycle) {
+    m_clockOn = false;
+
+    // wake up in time for the next refresh
+    SimTime_t l_cyclesToRefresh = m_deviceDriver->getCyclesToRefresh();
+    if (l_cyclesToRefresh != std::numeric_limits<SimTime_t>::max())
+        m_idleWakeLink->send(l_cyclesToRefresh - 1, nullptr);
+
+    #ifdef __SST_DEBUG_OUTPUT__
+    debug->verbose(CALL_INFO, 1, 0, "Cycle:%" PRIu64 " controller idle, clock off\n", m_simCycle);
+    #endif
+}
+
+
+// bring every subcomponent up to date with the cycles the clock was off
+void c_Controller::turnClockOn() {
+    if (m_clockOn)
+        return;
+
+    SST::Cycle_t l_nextCycle = reregisterClock(m_clockTC, m_clockHandler);
+    SimTime_t l_skipped = (l_nextCycle - 1) - m_lastActiveCycle;
+
+    m_txnScheduler->skipIdleCycles(l_skipped);
+    m_txnConverter->skipIdleCycles(l_skipped, m_simCycle);
+    m_cmdScheduler->skipIdleCycles(l_skipped);
+    m_deviceDriver->skipIdleCycles(l_skipped);
+
+    m_simCycle += l_skipped;
+    m_lastActiveCycle += l_skipped;
+    m_clockOn = true;
+
+    #ifdef __SST_DEBUG_OUTPUT__
+    debug->verbose(CALL_INFO, 1, 0, "Cycle:%" PRIu64 " controller clock on after %" PRIu64 " idle cycles\n", m_simCycle, l_skipped);
+    #endif
+}
+
+
+void c_Controller::handleIdleWake(SST::Event *ev) {
+    turnClockOn();
+}
+
+
 void c_Controller::sendCommand(c_BankCommand* cmd)
 {
      c_CmdReqEvent *l_cmdReqEventPtr = new c_CmdReqEvent();
@@ -271,6 +341,8 @@ void c_Controller::handleIncomingTransaction(SST::Event *ev){
     if (l_txnReqEventPtr) {
         c_Transaction* newTxn=l_txnReqEventPtr->m_payload;
 
+        turnClockOn();
+
         #ifdef __SST_DEBUG_OUTPUT__
         newTxn->print(debug,"[c_Controller.handleIncommingTransaction]",m_simCycle);
         #endif
@@ -289,6 +361,8 @@ void c_Controller::handleIncomingTransaction(SST::Event *ev){
 void c_Controller::handleInDeviceResPtrEvent(SST::Event *ev){
     c_CmdResEvent* l_cmdResEventPtr = dynamic_cast<c_CmdResEvent*>(ev);
     if (l_cmdResEventPtr) {
+        turnClockOn();
+
         ulong l_resSeqNum = l_cmdResEventPtr->m_payload->getSeqNum();
         // need to find which txn matches the command seq number in the txnResQ
         c_Transaction* l_txnRes = nullptr;
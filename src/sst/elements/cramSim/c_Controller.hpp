@@ -65,7 +65,8 @@ namespace SST {
 
             SST_ELI_DOCUMENT_PARAMS(
                 {"verbose", "Output verbosity", "0"},
-                {"strControllerClockFrequency", "Controller clock frequency, with units", "1GHz" }
+                {"strControllerClockFrequency", "Controller clock frequency, with units", "1GHz" },
+                {"boolEnableIdleSkip", "Stop the controller clock while no transaction is outstanding and skip the idle cycles on the next arrival or refresh", "0" }
             )
 
             SST_ELI_DOCUMENT_PORTS(
@@ -103,6 +104,10 @@ namespace SST {
 
 
             void sendResponse();
+            bool isIdle();
+            void turnClockOn();
+            void turnClockOff(SST::Cycle_t x_cycle);
+            void handleIdleWake(SST::Event *ev);
             void sendRequest();
             void configure_link();
             // Transaction Generator <-> Controller Handlers
@@ -128,10 +133,18 @@ namespace SST {
 
             // params for system configuration
             int k_enableQuickResponse;
+            bool k_enableIdleSkip;
 
             // clock frequency
             std::string k_controllerClockFreqStr;
 
+            // clock state for idle cycle skipping
+            SST::TimeConverter *m_clockTC;
+            Clock::HandlerBase *m_clockHandler;
+            bool m_clockOn;
+            SST::Cycle_t m_lastActiveCycle;
+            SST::Link *m_idleWakeLink;
+
             // Transaction Generator <-> Controller Links
             SST::Link *m_txngenLink;
             // Controller <-> Memory device Links
@@ -33,6 +33,7 @@
 #include <vector>
 #include <list>
 #include <algorithm>
+#include <limits>
 #include <assert.h>
 
 // CramSim includes
@@ -460,9 +461,8 @@ void c_DeviceDriver::update(SimTime_t simCycle) {
     }
     //update ACTFAWTracker info
     for (int l_rankNum = 0; l_rankNum < m_numRanks; l_rankNum++) {
-        m_cmdACTFAWtrackers[l_rankNum].push_back(
+        pushACTFAWTracker(l_rankNum,
                 m_isACTIssued[l_rankNum] ? static_cast<unsigned>(1) : static_cast<unsigned>(0));
-        m_cmdACTFAWtrackers[l_rankNum].pop_front();
     }
 
     // do the member var setup up before calling any req sending policy function
@@ -479,6 +479,84 @@ void c_DeviceDriver::update(SimTime_t simCycle) {
 
 
 
+/*!
+ * The device is idle when no command is queued, in flight or waiting on a
+ * refresh, and every bank has settled in the IDLE or ACTIVE state.
+ * @return
+ */
+bool c_DeviceDriver::isIdle() {
+
+    if (!m_inputQ.empty() || !m_outputQ.empty())
+        return false;
+
+    for (auto &l_refreshCmdQ : m_refreshCmdQ)
+        if (!l_refreshCmdQ.empty())
+            return false;
+
+    for (auto &l_bank : m_banks) {
+        e_BankState l_state = l_bank->getCurrentState();
+        if (l_state != e_BankState::IDLE && l_state != e_BankState::ACTIVE)
+            return false;
+    }
+
+    return true;
+}
+
+/*!
+ * @return number of cycles that can pass before a rank starts a refresh
+ */
+SimTime_t c_DeviceDriver::getCyclesToRefresh() {
+
+    SimTime_t l_cycles = std::numeric_limits<SimTime_t>::max();
+
+    if (k_useRefresh)
+        for (auto &l_count : m_currentREFICount)
+            l_cycles = std::min(l_cycles, (SimTime_t) l_count);
+
+    return l_cycles;
+}
+
+/*!
+ * Advance an idle device by x_cycles as if update() and run() had been called
+ * for each of them. x_cycles must not exceed getCyclesToRefresh().
+ * @param x_cycles
+ */
+void c_DeviceDriver::skipIdleCycles(SimTime_t x_cycles) {
+
+    if (x_cycles == 0)
+        return;
+
+    assert(x_cycles <= getCyclesToRefresh());
+
+    for (auto &l_bank : m_banks)
+        l_bank->skipIdleCycles(x_cycles, m_simCycle);
+
+    // the first skipped cycle records the ACTs of the last active one, the rest record none
+    for (int l_rankNum = 0; l_rankNum < m_numRanks; l_rankNum++) {
+        pushACTFAWTracker(l_rankNum,
+                m_isACTIssued[l_rankNum] ? static_cast<unsigned>(1) : static_cast<unsigned>(0));
+
+        SimTime_t l_zeros = std::min(x_cycles - 1, (SimTime_t) m_cmdACTFAWtrackers[l_rankNum].size());
+        for (SimTime_t l_i = 0; l_i < l_zeros; l_i++)
+            pushACTFAWTracker(l_rankNum, 0);
+    }
+
+    if (k_useRefresh)
+        for (auto &l_count : m_currentREFICount)
+            l_count -= x_cycles;
+
+    m_simCycle += x_cycles;
+
+    // a command holds the bus for at most two releases
+    releaseCommandBus();
+    releaseCommandBus();
+
+    m_inflightWrites.clear();
+    m_blockBank.assign(m_numBanks, false);
+    m_isACTIssued.assign(m_numRanks, false);
+}
+
+
 /*!
  * check bank and bus status
  * @param x_bankCommandPtr
@@ -879,11 +957,29 @@ void c_DeviceDriver::initACTFAWTracker()
     m_cmdACTFAWtrackers.clear();
     for(int i=0; i<m_numRanks;i++)
     {
-        std::list<unsigned> l_cmdACTFAWTracker;
-        l_cmdACTFAWTracker.clear();
-        l_cmdACTFAWTracker.resize(m_bankParams.at("nFAW")-1, 0);
+        std::vector<unsigned> l_cmdACTFAWTracker(m_bankParams.at("nFAW")-1, 0);
         m_cmdACTFAWtrackers.push_back(l_cmdACTFAWTracker);
     }
+    m_cmdACTFAWtrackerHead.assign(m_numRanks, 0);
+    m_numACTIssuedInFAW.assign(m_numRanks, 0);
+}
+
+/*!
+ * Record whether the last cycle issued an ACT, dropping the oldest cycle
+ * @param x_rankid
+ * @param x_issued
+ */
+void c_DeviceDriver::pushACTFAWTracker(unsigned x_rankid, unsigned x_issued)
+{
+    std::vector<unsigned> &l_tracker = m_cmdACTFAWtrackers[x_rankid];
+    if (l_tracker.empty())
+        return;
+
+    unsigned &l_head = m_cmdACTFAWtrackerHead[x_rankid];
+    m_numACTIssuedInFAW[x_rankid] -= l_tracker[l_head];
+    m_numACTIssuedInFAW[x_rankid] += x_issued;
+    l_tracker[l_head] = x_issued;
+    l_head = (l_head + 1 == l_tracker.size()) ? 0 : l_head + 1;
 }
 
 /*!
@@ -914,11 +1010,8 @@ unsigned c_DeviceDriver::getNumIssuedACTinFAW(unsigned x_rankid) {
     assert(x_rankid<m_numRanks);
 
     // get count of ACT cmds issued in the FAW
-    unsigned l_cmdACTIssuedInFAW = 0;
     assert(m_cmdACTFAWtrackers[x_rankid].size() == m_bankParams.at("nFAW")-1);
-    for(auto& l_issued : m_cmdACTFAWtrackers[x_rankid])
-        l_cmdACTIssuedInFAW += l_issued;
-    return l_cmdACTIssuedInFAW;
+    return m_numACTIssuedInFAW[x_rankid];
 }
 
 /*!
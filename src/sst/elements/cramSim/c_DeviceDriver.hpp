@@ -137,6 +137,11 @@ public:
     virtual c_BankInfo* getBankInfo(unsigned x_bankId);
     void update(SimTime_t simCycle);
 
+    // idle cycle skipping, see c_Controller
+    bool isIdle();
+    SimTime_t getCyclesToRefresh();
+    void skipIdleCycles(SimTime_t x_cycles);
+
     unsigned getNumChannel(){return k_numChannels;}
     unsigned getNumPChPerChannel(){return k_numPChannelsPerChannel;}
     unsigned getNumRanksPerChannel(){return k_numRanksPerChannel;}
@@ -162,6 +167,7 @@ private:
     void releaseCommandBus();
 
     void initACTFAWTracker();
+    void pushACTFAWTracker(unsigned x_rankid, unsigned x_issued);
     void initRefresh();
     unsigned getNumIssuedACTinFAW(unsigned x_rankid);
     void createRefreshCmds(unsigned x_rank);
@@ -184,7 +190,9 @@ private:
     e_BankCommandType m_lastDataCmdType;
     unsigned m_lastChannel;
     unsigned m_lastPseudoChannel;
-    std::vector<std::list<unsigned>> m_cmdACTFAWtrackers; // FIXME: change this to a circular buffer for speed. Could also implement as shift register.
+    std::vector<std::vector<unsigned>> m_cmdACTFAWtrackers; // per-rank circular buffer, 1 for each of the last nFAW-1 cycles that issued an ACT
+    std::vector<unsigned> m_cmdACTFAWtrackerHead;           // oldest entry of each tracker
+    std::vector<unsigned> m_numACTIssuedInFAW;              // running sum of each tracker
     std::vector<bool> m_isACTIssued;
     bool m_issuedACT;
 
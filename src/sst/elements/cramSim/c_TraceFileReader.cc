@@ -20,6 +20,11 @@
 #include <assert.h>
 #include <iostream>
 #include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 
 #include <sst/core/stringize.h>
 
@@ -32,7 +37,9 @@
 using namespace SST;
 using namespace CramSim;
 
-c_TraceFileReader::c_TraceFileReader(SST::ComponentId_t x_id, SST::Params& x_params):c_TxnGenBase(x_id,x_params)
+c_TraceFileReader::c_TraceFileReader(SST::ComponentId_t x_id, SST::Params& x_params):c_TxnGenBase(x_id,x_params),
+    m_traceFileStream(NULL), m_binaryRecords(NULL), m_binaryNumRecords(0), m_binaryNext(0), m_binaryRelative(false),
+    m_binaryMap(NULL), m_binaryMapSize(0)
 {
     // trace file param
     bool l_found=false;
@@ -47,12 +54,6 @@ c_TraceFileReader::c_TraceFileReader(SST::ComponentId_t x_id, SST::Params& x_par
     {
         output->output("TraceFileReader: tracefile name is %s\n", m_traceFileName.c_str());
     }
-    m_traceFileStream = new std::ifstream(m_traceFileName, std::ifstream::in);
-    if(!(*m_traceFileStream))
-    {
-        output->fatal(CALL_INFO, -1, "Unable to open trace file %s Aborting!\n", m_traceFileName.c_str());
-    }
-
     // get trace file type
     std::string l_traceFileType= x_params.find<std::string>("traceFileType", "DEFAULT", l_found);
     if (!l_found)
@@ -67,23 +68,119 @@ c_TraceFileReader::c_TraceFileReader(SST::ComponentId_t x_id, SST::Params& x_par
     {
         m_traceType=e_TracefileType ::USIMM;
     }
+    else if(l_traceFileType=="BINARY")
+    {
+        m_traceType=e_TracefileType::BINARY;
+    }
     else
     {
         output->fatal(CALL_INFO, -1, "TraceFileReader: trace file type error!!\n");
     }
 
+    if(m_traceType==e_TracefileType::BINARY)
+    {
+        openBinaryTrace();
+    }
+    else
+    {
+        m_traceFileStream = new std::ifstream(m_traceFileName, std::ifstream::in);
+        if(!(*m_traceFileStream))
+        {
+            output->fatal(CALL_INFO, -1, "Unable to open trace file %s Aborting!\n", m_traceFileName.c_str());
+        }
+    }
+
     // tell the simulator not to end without us
     registerAsPrimaryComponent();
     primaryComponentDoNotEndSim();
 
 }
 
+c_TraceFileReader::~c_TraceFileReader()
+{
+    if(m_binaryMap)
+        munmap(m_binaryMap, m_binaryMapSize);
+    delete m_traceFileStream;
+}
+
+
+void c_TraceFileReader::openBinaryTrace()
+{
+    int l_fd = open(m_traceFileName.c_str(), O_RDONLY);
+    if(l_fd < 0)
+    {
+        output->fatal(CALL_INFO, -1, "Unable to open trace file %s Aborting!\n", m_traceFileName.c_str());
+    }
+
+    struct stat l_stat;
+    if(fstat(l_fd, &l_stat) != 0 || (size_t)l_stat.st_size < sizeof(c_BinaryTraceHeader))
+    {
+        output->fatal(CALL_INFO, -1, "TraceFileReader: %s is too short to be a binary trace\n", m_traceFileName.c_str());
+    }
+
+    m_binaryMapSize = l_stat.st_size;
+    m_binaryMap = mmap(NULL, m_binaryMapSize, PROT_READ, MAP_PRIVATE, l_fd, 0);
+    close(l_fd);
+    if(m_binaryMap == MAP_FAILED)
+    {
+        output->fatal(CALL_INFO, -1, "TraceFileReader: unable to map trace file %s\n", m_traceFileName.c_str());
+    }
+    // the trace is read front to back once, let the kernel read ahead and drop pages behind us
+    madvise(m_binaryMap, m_binaryMapSize, MADV_SEQUENTIAL);
+
+    const c_BinaryTraceHeader* l_header = (const c_BinaryTraceHeader*)m_binaryMap;
+    if(memcmp(l_header->magic, "CRAMTRC1", sizeof(l_header->magic)) != 0 || l_header->version != 1)
+    {
+        output->fatal(CALL_INFO, -1, "TraceFileReader: %s is not a version 1 binary trace\n", m_traceFileName.c_str());
+    }
+    if((m_binaryMapSize - sizeof(c_BinaryTraceHeader)) % sizeof(c_BinaryTraceRecord) != 0)
+    {
+        output->fatal(CALL_INFO, -1, "TraceFileReader: %s ends in a partial record\n", m_traceFileName.c_str());
+    }
+
+    m_binaryRelative = l_header->flags & k_binaryRelative;
+    m_binaryRecords = (const c_BinaryTraceRecord*)(l_header + 1);
+    m_binaryNumRecords = (m_binaryMapSize - sizeof(c_BinaryTraceHeader)) / sizeof(c_BinaryTraceRecord);
+    output->output("TraceFileReader: %zu binary trace records\n", m_binaryNumRecords);
+}
+
+
+bool c_TraceFileReader::readBinaryTxn(e_TransactionType& x_txnType, ulong& x_txnAddress, unsigned& x_txnInterval)
+{
+    if(m_binaryNext == m_binaryNumRecords)
+        return false;
+
+    const c_BinaryTraceRecord& l_record = m_binaryRecords[m_binaryNext++];
+    x_txnAddress = l_record.address;
+    x_txnType = (l_record.flags & k_binaryWrite) ? e_TransactionType::WRITE : e_TransactionType::READ;
+    x_txnInterval = m_binaryRelative ? m_simCycle + l_record.cycle : l_record.cycle;
+    return true;
+}
+
 
 void c_TraceFileReader::createTxn()
 {
 // check if txn can fit inside Req q
     while(m_txnReqQ.size()<k_numTxnPerCycle)
     {
+        if(m_traceType==e_TracefileType::BINARY)
+        {
+            e_TransactionType l_txnType;
+            ulong l_txnAddress;
+            unsigned l_txnInterval;
+            if(!readBinaryTxn(l_txnType, l_txnAddress, l_txnInterval))
+            {
+                primaryComponentOKToEndSim();
+                output->output("TraceFileReader: Ran out of txn's to read\n");
+                break;
+            }
+
+            c_Transaction* l_txn = new c_Transaction(m_seqNum, l_txnType, l_txnAddress, 1);
+            m_txnReqQ.push_back(std::make_pair(l_txn, l_txnInterval));
+            m_seqNum++;
+            continue;
+        }
+
         std::string l_line;
         if (std::getline(*m_traceFileStream, l_line)) {
             char_delimiter sep(" ");
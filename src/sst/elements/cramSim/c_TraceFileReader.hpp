@@ -50,7 +50,7 @@ namespace SST {
                 {"maxOutstandingReqs", "Maximum number of the outstanding requests", NULL},
                 {"numTxnPerCycle", "The number of transactions generated per cycle", NULL},
                 {"traceFile", "Location of trace file to read", NULL},
-                {"traceFileType", "Trace file type (DEFAULT or USIMM)",NULL},
+                {"traceFileType", "Trace file type (DEFAULT, USIMM or BINARY). BINARY traces are written by traces/trace2bin.pl",NULL},
             )
 
             SST_ELI_DOCUMENT_PORTS(
@@ -69,18 +69,44 @@ namespace SST {
             )
 
             c_TraceFileReader(SST::ComponentId_t x_id, SST::Params& x_params);
-            ~c_TraceFileReader(){}
+            ~c_TraceFileReader();
         private:
             enum e_TracefileType{
                 DEFAULT,   //DRAMsim2 type
-                USIMM
+                USIMM,
+                BINARY
             };
+
+            // BINARY trace layout: a header, then one record per transaction
+            struct c_BinaryTraceHeader {
+                char     magic[8];  // "CRAMTRC1"
+                uint32_t version;
+                uint32_t flags;     // k_binaryRelative: cycles are deltas (USIMM) instead of absolute (DRAMSim2)
+            };
+            struct c_BinaryTraceRecord {
+                uint64_t address;
+                uint32_t cycle;
+                uint32_t flags;     // k_binaryWrite
+            };
+            static const uint32_t k_binaryRelative = 0x1;
+            static const uint32_t k_binaryWrite = 0x1;
+
             virtual void createTxn();
+            void openBinaryTrace();
+            bool readBinaryTxn(e_TransactionType& x_txnType, ulong& x_txnAddress, unsigned& x_txnInterval);
 
             //params for internal microarcitecture
             std::string m_traceFileName;
             std::ifstream *m_traceFileStream;
 
+            // BINARY traces are mapped and walked in place
+            const c_BinaryTraceRecord* m_binaryRecords;
+            size_t m_binaryNumRecords;
+            size_t m_binaryNext;
+            bool m_binaryRelative;
+            void* m_binaryMap;
+            size_t m_binaryMapSize;
+
             e_TracefileType m_traceType;
         };
     }
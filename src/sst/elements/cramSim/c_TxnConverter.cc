@@ -162,6 +162,18 @@ void c_TxnConverter::run(SimTime_t simCycle){
 
 
 
+void c_TxnConverter::skipIdleCycles(SimTime_t x_cycles, SimTime_t x_simCycle){
+
+    //For psuedo open page policy, open rows keep counting towards bankCloseTime
+    if(k_bankPolicy==2) {
+        for (auto &it:m_bankInfo)
+            if(it->isRowOpen())
+                it->skipIdleCycles(x_cycles, x_simCycle);
+    }
+}
+
+
+
 void c_TxnConverter::push(c_Transaction* newTxn) {
 
     // make sure the internal req q has at least one empty entry
@@ -95,6 +95,8 @@ public:
     void run(SimTime_t simCycle);
     void push(c_Transaction* newTxn); // receive txns from txnGen into req q
     c_BankInfo* getBankInfo(unsigned x_bankId);
+    bool isIdle() {return m_inputQ.empty();}
+    void skipIdleCycles(SimTime_t x_cycles, SimTime_t x_simCycle);
 
 private:
 
@@ -80,12 +80,21 @@ c_TxnDispatcher::c_TxnDispatcher(ComponentId_t x_id, Params &params):Component(x
             }
         }
     }
+    if(k_numLanes>1 && (m_laneIdxEnd - m_laneIdxStart) < 63 &&
+       ((uint64_t) 1 << (m_laneIdxEnd - m_laneIdxStart + 1)) > k_numLanes) {
+        output->fatal(CALL_INFO, -1, "laneIdxPos %s selects more than %u lanes\n", l_laneIdxString.c_str(), k_numLanes);
+    }
+
     std::string l_clockFreqStr = (std::string)params.find<std::string>("ClockFreq", "1GHz", l_found);
 
+    // With forwarding on arrival the link latencies alone time the lanes, so
+    // the dispatcher never ticks and each lane can sit on its own thread
+    k_forwardOnArrival = (uint32_t) params.find<uint32_t>("boolForwardOnArrival", 0);
 
     //set our clock
-    registerClock(l_clockFreqStr,
-                  new Clock::Handler<c_TxnDispatcher>(this, &c_TxnDispatcher::clockTic));
+    if(!k_forwardOnArrival)
+        registerClock(l_clockFreqStr,
+                      new Clock::Handler<c_TxnDispatcher>(this, &c_TxnDispatcher::clockTic));
 
 
     //---- configure link ----//
@@ -139,18 +148,26 @@ void c_TxnDispatcher::handleTxnGenEvent(SST::Event *ev)
 {
     //get a lane index
     c_TxnReqEvent* l_newReq=dynamic_cast<c_TxnReqEvent*>(ev);
-    m_reqQ.push_back(l_newReq);
 
     #ifdef __SST_DEBUG_OUTPUT__
     l_newReq->m_payload->print(&dbg,"[c_TxnDispatcher.handleTxnGenEvent]",m_simCycle);
     #endif
+
+    if(k_forwardOnArrival)
+        sendRequest(l_newReq);
+    else
+        m_reqQ.push_back(l_newReq);
 }
 
 
 void c_TxnDispatcher::handleCtrlEvent(SST::Event *ev)
 {
     c_TxnResEvent* l_newRes=dynamic_cast<c_TxnResEvent*>(ev);
-    m_resQ.push_back(l_newRes);
+
+    if(k_forwardOnArrival)
+        sendResponse(l_newRes);
+    else
+        m_resQ.push_back(l_newRes);
 }
 
 
@@ -53,7 +53,10 @@ namespace SST{
 
             SST_ELI_DOCUMENT_PARAMS(
                 {"numLanes", "Total number of lanes", NULL},
-                {"laneIdxPosition", "Bit posiiton of the lane index in the address.. [End:Start]", NULL},
+                {"laneIdxPos", "Bit posiiton of the lane index in the address.. [End:Start]", "13:12"},
+                {"ClockFreq", "Dispatcher clock frequency, with units", "1GHz"},
+                {"boolForwardOnArrival", "Forward each transaction as it arrives instead of on the next clock tick, so the dispatcher needs no clock. "
+                                         "Use this when every lane is its own controller partitioned across threads or ranks", "0"},
             )
 
             SST_ELI_DOCUMENT_PORTS(
@@ -88,6 +91,7 @@ namespace SST{
              uint64_t m_laneIdxMask;
 
              uint32_t k_numLanes;
+             bool k_forwardOnArrival;
              Output dbg;
              Output* output;
          };
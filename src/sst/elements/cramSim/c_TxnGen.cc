@@ -197,8 +197,8 @@ void c_TxnGenBase::handleResEvent(SST::Event* ev) {
         uint64_t l_seqnum=l_txn->getSeqNum();
 
 
-        assert(m_outstandingReqs.find(l_seqnum)!=m_outstandingReqs.end());
-        SimTime_t l_latency=l_currentCycle-m_outstandingReqs[l_seqnum];
+        assert(m_outstandingReqs.contains(l_seqnum));
+        SimTime_t l_latency=l_currentCycle-m_outstandingReqs.birth(l_seqnum);
 
         if(l_txn->isRead())
             s_readTxnsLatency->addData(l_latency);
@@ -208,7 +208,7 @@ void c_TxnGenBase::handleResEvent(SST::Event* ev) {
         s_txnsLatency->addData(l_latency);
 
 #ifdef __SST_DEBUG_OUTPUT__
-        debug->verbose(CALL_INFO,1,0,"[cycle:%lld] addr: 0x%lx isRead:%d seqNum:%lld birthTime:%lld latency:%lld \n",l_currentCycle,l_txn->getAddress(),l_txn->isRead(), l_seqnum,m_outstandingReqs[l_seqnum],l_latency);
+        debug->verbose(CALL_INFO,1,0,"[cycle:%lld] addr: 0x%lx isRead:%d seqNum:%lld birthTime:%lld latency:%lld \n",l_currentCycle,l_txn->getAddress(),l_txn->isRead(), l_seqnum,m_outstandingReqs.birth(l_seqnum),l_latency);
 #endif
 
 
@@ -268,7 +268,7 @@ bool c_TxnGenBase::sendRequest()
         debug->verbose(CALL_INFO,1,0,"[cycle:%lld] addr: 0x%lx isRead:%d seqNum:%lu\n",l_cycle,l_txn->getAddress(),l_txn->isRead(),l_txn->getSeqNum());
     #endif
 
-        m_outstandingReqs.insert(std::pair<uint64_t, uint64_t>(l_txn->getSeqNum(),l_cycle));
+        m_outstandingReqs.insert(l_txn->getSeqNum(),l_cycle);
         return true;
     }
     else
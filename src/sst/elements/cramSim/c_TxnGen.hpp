@@ -18,7 +18,9 @@
 #define _TXNGEN_H
 
 #include <stdint.h>
+#include <assert.h>
 #include <queue>
+#include <vector>
 
 //SST includes
 #include <sst/core/component.h>
@@ -29,6 +31,72 @@
 
 namespace SST {
     namespace CramSim {
+
+        // Birth times of the outstanding transactions, by sequence number.
+        // Transactions are sent in increasing sequence order, so they occupy a
+        // window of sequence numbers that starts at the oldest one still
+        // outstanding; the window is a ring that grows to the widest one seen.
+        class c_OutstandingRing {
+        public:
+            c_OutstandingRing() : m_slots(64, k_done), m_head(0), m_base(0), m_span(0), m_count(0) {}
+
+            void insert(uint64_t x_seqNum, uint64_t x_birth) {
+                if (0 == m_span) {
+                    m_base = x_seqNum;
+                }
+                uint32_t l_off = offset(x_seqNum);
+                assert(l_off >= m_span);
+                while (l_off >= m_slots.size()) {
+                    grow();
+                }
+                slot(l_off) = x_birth;
+                m_span = l_off + 1;
+                m_count++;
+            }
+
+            bool contains(uint64_t x_seqNum) const {
+                uint32_t l_off = offset(x_seqNum);
+                return l_off < m_span && m_slots[(m_head + l_off) & (m_slots.size() - 1)] != k_done;
+            }
+
+            uint64_t birth(uint64_t x_seqNum) const {
+                return m_slots[(m_head + offset(x_seqNum)) & (m_slots.size() - 1)];
+            }
+
+            void erase(uint64_t x_seqNum) {
+                slot(offset(x_seqNum)) = k_done;
+                m_count--;
+                while (m_span > 0 && m_slots[m_head] == k_done) {
+                    m_head = (m_head + 1) & (m_slots.size() - 1);
+                    m_base++;
+                    m_span--;
+                }
+            }
+
+            size_t size() const { return m_count; }
+
+        private:
+            static const uint64_t k_done = ~(uint64_t)0;
+
+            // sequence numbers are 32 bit and may wrap
+            uint32_t offset(uint64_t x_seqNum) const { return (uint32_t)(x_seqNum - m_base); }
+            uint64_t& slot(uint32_t x_off) { return m_slots[(m_head + x_off) & (m_slots.size() - 1)]; }
+
+            void grow() {
+                std::vector<uint64_t> l_slots(2 * m_slots.size(), k_done);
+                for (uint32_t l_off = 0; l_off < m_span; l_off++) {
+                    l_slots[l_off] = slot(l_off);
+                }
+                m_slots.swap(l_slots);
+                m_head = 0;
+            }
+
+            std::vector<uint64_t> m_slots;
+            size_t m_head;
+            uint64_t m_base;
+            uint32_t m_span;
+            size_t m_count;
+        };
         class c_TxnGenBase: public SST::Component {
 
         public:
@@ -53,7 +121,7 @@ namespace SST {
             //internal microarchitecture
             std::deque<std::pair<c_Transaction*, uint64_t>> m_txnReqQ;
             std::deque<c_Transaction*> m_txnResQ;
-            std::map<uint64_t, uint64_t> m_outstandingReqs; //(txn_id, birth time)
+            c_OutstandingRing m_outstandingReqs; //(txn_id, birth time)
             uint32_t m_numOutstandingReqs;
             uint64_t m_numTxns;
             uint32_t m_seqNum;
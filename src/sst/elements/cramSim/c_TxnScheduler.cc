@@ -227,6 +227,24 @@ void c_TxnScheduler::popTxn(TxnQueue &x_txnQ, c_Transaction* x_Txn)
     x_txnQ.remove(x_Txn);
 }
 
+bool c_TxnScheduler::isIdle()
+{
+    for (int l_channelID = 0; l_channelID < m_numChannels; l_channelID++) {
+        if (!m_txnQ[l_channelID].empty() || !m_txnReadQ[l_channelID].empty() || !m_txnWriteQ[l_channelID].empty())
+            return false;
+    }
+    return true;
+}
+
+
+void c_TxnScheduler::skipIdleCycles(SimTime_t x_cycles)
+{
+    // an idle cycle with read-first scheduling finds no reads and flushes writes
+    if (x_cycles > 0 && k_isReadFirstScheduling && m_numChannels > 0)
+        m_flushWriteQueue = true;
+}
+
+
 bool c_TxnScheduler::push(c_Transaction* newTxn)
 {
     int l_channelId=newTxn->getHashedAddress().getChannel();
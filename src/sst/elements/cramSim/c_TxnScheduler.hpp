@@ -80,6 +80,8 @@ namespace SST {
             virtual void run(SimTime_t simCycle);
             virtual bool push(c_Transaction* newTxn);
             virtual bool isHit(c_Transaction* newTxn);
+            virtual bool isIdle();
+            virtual void skipIdleCycles(SimTime_t x_cycles);
 
 
         private:
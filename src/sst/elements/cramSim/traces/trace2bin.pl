@@ -0,0 +1,67 @@
+#!/usr/bin/perl -w
+#
+# This script converts a text trace into the BINARY trace format read by
+# c_TraceFileReader (traceFileType=BINARY)
+#
+# Usage: trace2bin.pl <DEFAULT|DRAMSIM2|USIMM> <input trace> <output trace>
+#
+# DEFAULT (DRAMSim2) lines are "<address> <READ|WRITE|...> <cycle>" where the
+# cycle is absolute; USIMM lines are "<delta> <R|W> <address> [pc]" where the
+# delta is added to the cycle the line is read at. They are parsed the same
+# way c_TraceFileReader parses them.
+#
+# The binary trace is a 16 byte header (magic "CRAMTRC1", uint32 version 1,
+# uint32 flags with bit 0 set for USIMM timing) followed by one 16 byte
+# record per transaction (uint64 address, uint32 cycle, uint32 flags with
+# bit 0 set for writes), all little endian.
+
+use strict;
+
+die "Usage: $0 <DEFAULT|DRAMSIM2|USIMM> <input trace> <output trace>\n" unless @ARGV == 3;
+my ($type, $inFile, $outFile) = @ARGV;
+
+my $usimm;
+if ($type eq "DEFAULT" || $type eq "DRAMSIM2") {
+    $usimm = 0;
+} elsif ($type eq "USIMM") {
+    $usimm = 1;
+} else {
+    die "Unknown trace type $type\n";
+}
+
+# strtoul(x, NULL, 0)
+sub toNum {
+    my $str = shift;
+    return hex($str) if $str =~ /^0[xX]/;
+    return oct($str) if $str =~ /^0[0-7]+$/;
+    return $str =~ /^(\d+)/ ? $1 : 0;
+}
+
+open(IN, $inFile) || die "Couldn't open input trace $inFile: $!";
+open(OUT, ">", $outFile) || die "Couldn't open output trace $outFile: $!";
+binmode(OUT);
+
+print OUT pack("a8 V V", "CRAMTRC1", 1, $usimm);
+
+my $numRecords = 0;
+while (my $line = <IN>) {
+    chomp $line;
+    my @tok = grep { $_ ne "" } split(/ /, $line);
+    next unless @tok;
+
+    my ($addr, $write, $cycle);
+    if ($usimm) {
+        die "Bad USIMM line: $line\n" unless @tok >= 3 && @tok <= 4;
+        ($cycle, $write, $addr) = (toNum($tok[0]), ($tok[1] =~ /W/ ? 1 : 0), toNum($tok[2]));
+    } else {
+        die "Bad DRAMSim2 line: $line\n" unless @tok == 3;
+        ($addr, $write, $cycle) = (toNum($tok[0]), ($tok[1] =~ /WR/ ? 1 : 0), toNum($tok[2]));
+    }
+
+    print OUT pack("Q< V V", $addr, $cycle, $write ? 1 : 0);
+    $numRecords++;
+}
+
+close(IN);
+close(OUT);
+print "Wrote $numRecords records to $outFile\n";
@@ -30,15 +30,7 @@ public:
                 EmberComputeDistribution* dist) :
         EmberEvent(output),
         m_nanoSecondDelay( nanoSecondDelay ),
-        m_computeDistrib(dist),
-        m_calcFunc(NULL)
-    {}
-
-	EmberComputeEvent( Output* output, std::function<uint64_t()> func,
-                EmberComputeDistribution* dist) :
-        EmberEvent(output),
-        m_computeDistrib(dist),
-        m_calcFunc(func)
+        m_computeDistrib(dist)
     {}
 
 	~EmberComputeEvent() {}
@@ -49,11 +41,7 @@ public:
 
         EmberEvent::issue( time );
 
-        if ( m_calcFunc ) {
-            m_completeDelayNS = (double) m_calcFunc();
-        } else {
-            m_completeDelayNS = (double) m_nanoSecondDelay;
-        }
+        m_completeDelayNS = (double) m_nanoSecondDelay;
         m_completeDelayNS *= m_computeDistrib->sample(time);
 
         m_output->debug(CALL_INFO, 2, EVENT_MASK, "Adjust time by noise "
@@ -63,8 +51,26 @@ public:
 protected:
 	uint64_t m_nanoSecondDelay;
     EmberComputeDistribution* m_computeDistrib;
-    std::function<uint64_t()> m_calcFunc;
+};
 
+// A compute whose delay is only known when it issues. Most computes have a
+// fixed delay, so only these carry the function and the fixed ones stay small.
+class EmberComputeFuncEvent : public EmberComputeEvent {
+
+public:
+	EmberComputeFuncEvent( Output* output, std::function<uint64_t()> func,
+                EmberComputeDistribution* dist) :
+        EmberComputeEvent(output, 0, dist),
+        m_calcFunc(func)
+    {}
+
+    void issue( uint64_t time, FOO* functor ) {
+        m_nanoSecondDelay = m_calcFunc();
+        EmberComputeEvent::issue( time, functor );
+    }
+
+private:
+    std::function<uint64_t()> m_calcFunc;
 };
 
 }
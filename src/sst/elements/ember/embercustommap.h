@@ -20,6 +20,9 @@
 #include "embermap.h"
 
 #include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
 #include <sstream>
 #include <string>
 #include <vector>
@@ -51,7 +54,9 @@ public:
                 mapFile  = params.find<std::string>("mapFile", "mapFile.txt");
                 //std::cout << "EmberCustommap: mapFile: " << mapFile.c_str() << std::endl;
                 if(jobId.compare("-1")){
-                        readMapFile(mapFile);
+                        table = getTable(mapFile, jobId);
+                } else {
+                        table = std::make_shared<const Table>();
                 }
         }
 	~EmberCustomRankMap() {}
@@ -59,12 +64,52 @@ public:
         // NetworkSim: added variables to construct the custom map
         std::string jobId;
         std::string mapFile;
-        std::map<int, int> CustomMap; //custom task mapping
-        std::map<int, int> InvCustomMap; //inverse of the custom task mapping
         // end->NetworkSim
 
+        // The custom task number of a linear rank, 0 if the map has none
+        int32_t customRank(const int32_t linearRank) const {
+                return lookup(table->map, linearRank);
+        }
+
+        // The linear rank of a custom task number, 0 if the map has none
+        int32_t linearRank(const int32_t customRank) const {
+                return lookup(table->inverse, customRank);
+        }
+
+private:
+        // The custom task mapping of a job and its inverse, indexed by task
+        // number. Every rank of a job reads the same file, so the ranks in a
+        // process share one table instead of each holding a whole job's map.
+        struct Table {
+                std::vector<int32_t> map;
+                std::vector<int32_t> inverse;
+        };
+
+        std::shared_ptr<const Table> table;
+
+        static int32_t lookup(const std::vector<int32_t>& v, const int32_t index) {
+                return (index >= 0 && (size_t) index < v.size()) ? v[index] : 0;
+        }
+
+        static std::shared_ptr<const Table> getTable(const std::string& fileName, const std::string& jobId) {
+                static std::mutex lock;
+                static std::map<std::string, std::weak_ptr<const Table> > tables;
+
+                std::lock_guard<std::mutex> guard(lock);
+
+                std::weak_ptr<const Table>& entry = tables[fileName + ":" + jobId];
+                std::shared_ptr<const Table> found = entry.lock();
+                if(!found){
+                        found = readMapFile(fileName, jobId);
+                        entry = found;
+                }
+                return found;
+        }
+
         //NetworkSim: function that reads the custom mapping of the job with _mapjobId
-        void readMapFile(std::string fileName) {
+        static std::shared_ptr<const Table> readMapFile(const std::string& fileName, const std::string& jobId) {
+
+                std::shared_ptr<Table> table = std::make_shared<Table>();
 
                 std::ifstream input;
                 input.open( fileName.c_str() );
@@ -79,7 +124,6 @@ public:
                 std::string startIdentifier = "[JOB " + jobId + " START]";
                 std::string endIdentifier = "[JOB " + jobId + " END]";
                 bool inDesiredRegion = false;
-                int taskNum = 0;
 
                 while (!input.eof()) {
                         getline(input, line);
@@ -100,9 +144,14 @@ public:
 
                                 is >> nextStr;
                                 while(!nextStr.empty()){
-                                        CustomMap[taskNum] = std::stoi(nextStr);
-                                        InvCustomMap[std::stoi(nextStr)] = taskNum;
-                                        taskNum++;
+                                        int32_t task = std::stoi(nextStr);
+                                        int32_t taskNum = table->map.size();
+                                        table->map.push_back(task);
+                                        if(task >= 0){
+                                                if((size_t) task >= table->inverse.size())
+                                                        table->inverse.resize(task + 1, 0);
+                                                table->inverse[task] = taskNum;
+                                        }
                                         if(!(is >> nextStr)){
                                                 break;
                                         }
@@ -111,20 +160,18 @@ public:
                 }
                 input.close();
 
-                /*
-                for(std::map<int, int>::iterator it = CustomMap.begin(); it != CustomMap.end(); it++){
-                        std::cout << "linearMapRankNum: " << it->first << " customMapRankNum: " << it->second << std::endl;
-                }
-                */
+                return table;
         }
 
+public:
+
 	void setEnvironment(const uint32_t rank, const uint32_t worldSize) {};
 	uint32_t mapRank(const uint32_t input) { return input; }
 
 	void getPosition(const int32_t rank, const int32_t px, const int32_t py, const int32_t pz,
                 int32_t* myX, int32_t* myY, int32_t* myZ) {
 
-                int32_t customRank = (int32_t) InvCustomMap[rank];
+                int32_t customRank = linearRank(rank);
 
                 //std::cout << "rank: " << rank << " customRank: " << customRank << std::endl;
 
@@ -164,9 +211,9 @@ public:
                 	return -1;
         	} else {
                 	linearMapRank = (posZ * (peX * peY)) + (posY * peX) + posX;
-                        //std::cout << "linearMapTaskNum: " << linearMapRank << " customMapTaskNum: " << CustomMap[linearMapRank] << std::endl;
+                        //std::cout << "linearMapTaskNum: " << linearMapRank << " customMapTaskNum: " << customRank(linearMapRank) << std::endl;
                         //return (posZ * (peX * peY)) + (posY * peX) + posX;
-                        return (int32_t) CustomMap[linearMapRank];
+                        return customRank(linearMapRank);
         	}
 	}
 
@@ -17,6 +17,8 @@
 #ifndef _H_EMBER_DETAILED_COMPUTE_EVENT
 #define _H_EMBER_DETAILED_COMPUTE_EVENT
 
+#include <map>
+
 #include "emberevent.h"
 #include "sst/elements/thornhill/detailedCompute.h"
 
@@ -29,12 +31,16 @@ public:
 	EmberDetailedComputeEvent( Output* output,
                         Thornhill::DetailedCompute& api,
                         std::string& name,
-                        Params& params, std::function<int()> fini ) :
+                        Params& params, std::function<int()> fini,
+                        std::map< std::string, uint64_t >* times = NULL,
+                        std::string signature = "" ) :
         EmberEvent(output),
         m_api(api),
         m_name(name),
         m_params(params),
-        m_fini(fini)
+        m_fini(fini),
+        m_times(times),
+        m_signature(signature)
     {
         m_state = IssueFunctor;
     }
@@ -57,11 +63,51 @@ public:
         m_api.start( tmp, foo, m_fini );
     }
 
+    bool complete( uint64_t time, int retval = 0 ) {
+        if ( m_times ) {
+            (*m_times)[ m_signature ] = time - m_issueTime;
+        }
+        return EmberEvent::complete( time, retval );
+    }
+
 protected:
     Thornhill::DetailedCompute&  m_api;
     std::string     m_name;
     Params          m_params;
     std::function<int()> m_fini;
+    std::map< std::string, uint64_t >* m_times;
+    std::string     m_signature;
+};
+
+// A phase the detailed model already ran with the same parameters, it takes
+// as long as that run did without running the model again
+class EmberMemoizedComputeEvent : public EmberEvent {
+
+public:
+	EmberMemoizedComputeEvent( Output* output, uint64_t nanoSecondDelay,
+                        std::function<int()> fini ) :
+        EmberEvent(output),
+        m_fini(fini)
+    {
+        m_completeDelayNS = nanoSecondDelay;
+    }
+
+    std::string getName() { return "DetailedCompute"; }
+
+    void issue( uint64_t time, FOO* functor ) {
+        EmberEvent::issue( time );
+        m_output->debug(CALL_INFO, 2, EVENT_MASK, "reuse %" PRIu64 " ns\n", m_completeDelayNS );
+    }
+
+    bool complete( uint64_t time, int retval = 0 ) {
+        if ( m_fini ) {
+            m_fini();
+        }
+        return EmberEvent::complete( time, retval );
+    }
+
+protected:
+    std::function<int()> m_fini;
 };
 
 }
@@ -29,6 +29,7 @@ using namespace SST::Hermes;
 
 EmberEngine::EmberEngine(SST::ComponentId_t id, SST::Params& params) :
     Component( id ),
+	m_completeFunctor( this, &EmberEngine::completeFunctor ),
 	currentMotif(0),
 	m_motifDone(false),
 	m_detailedCompute(NULL)
@@ -99,6 +100,11 @@ EmberEngine::EmberEngine(SST::ComponentId_t id, SST::Params& params) :
 
 	// Create a time converter for our compute events
 	nanoTimeConverter = getTimeConverter("1ns");
+
+    if ( params.find<int>( "host_profile", 0 ) ) {
+        m_profileEvent.enable( registerStatistic<uint64_t>( "host_ns_event" ),
+                registerStatistic<uint64_t>( "host_events_event" ) );
+    }
 }
 
 EmberEngine::~EmberEngine() {
@@ -220,6 +226,8 @@ void EmberEngine::finish() {
     }
 
 	m_os->finish();
+
+    m_profileEvent.report();
 }
 
 void EmberEngine::setup() {
@@ -308,6 +316,8 @@ bool EmberEngine::completeFunctor( int retval, EmberEvent* ev )
 
 void EmberEngine::handleEvent(Event* ev) {
 
+    SST::HostProf::ScopedHandlerTimer profileTimer( m_profileEvent );
+
 	// Cast out the event we are processing and then hand off to whatever
 	// handlers we have created
 	EmberEvent* eEv = static_cast<EmberEvent*>(ev);
@@ -324,9 +334,8 @@ void EmberEngine::handleEvent(Event* ev) {
         break;
 
       case EmberEvent::IssueFunctor:
-        eEv->issue( getCurrentSimTimeNano(),
-                new ArgStatic_Functor< EmberEngine, int, EmberEvent*, bool >(
-                            this, &EmberEngine::completeFunctor, eEv ) );
+        m_completeFunctor.setArg( eEv );
+        eEv->issue( getCurrentSimTimeNano(), &m_completeFunctor );
         break;
 
       case EmberEvent::IssueCallback:
@@ -352,7 +361,8 @@ void EmberEngine::handleEvent(Event* ev) {
 }
 
 EmberEngine::EmberEngine() :
-    Component(-1)
+    Component(-1),
+    m_completeFunctor( this, &EmberEngine::completeFunctor )
 {
     // for serialization only
 }
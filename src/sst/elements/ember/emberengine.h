@@ -26,6 +26,7 @@
 #include <sst/core/timeConverter.h>
 
 #include <sst/elements/hermes/hermes.h>
+#include <sst/elements/hostprof/hostProfile.h>
 
 #include "embermotiflog.h"
 #include "embergen.h"
@@ -54,6 +55,7 @@ public:
         { "motif_count", "Sets the number of motifs which will be run in this simulation, default is 1", "1"},
         { "rankmapper", "Sets the rank mapping SST module to load to rank translations, default is linear mapping", "ember.LinearMap" },
         { "mapFile", "Sets the name of the input file for custom map", "mapFile.txt" },
+        { "host_profile", "Measure the host time spent handling motif events and report it in the host_* statistics", "0" },
 
         { "motif%(motif_count)d", "Sets the event generator or motif for the engine", "ember.EmberPingPongGenerator" },
     )
@@ -64,6 +66,11 @@ public:
 		distribParams.*
 	*/
 
+    SST_ELI_DOCUMENT_STATISTICS(
+        { "host_ns_event", "With host_profile, host nanoseconds spent handling motif events", "ns", 1 },
+        { "host_events_event", "With host_profile, number of motif events handled", "count", 1 },
+    )
+
     SST_ELI_DOCUMENT_PORTS(
         {"detailed%(num_vNics)d", "Port connected to the detailed model", {}},
         {"nic", "Port connected to the nic", {}},
@@ -121,6 +128,12 @@ private:
     }
     bool completeFunctor( int retval, EmberEvent* ev );
 
+    // Only one event is outstanding at a time, so every IssueFunctor event
+    // gets this one functor rather than a new one
+    ArgStaticReuse_Functor< EmberEngine, int, EmberEvent* > m_completeFunctor;
+
+    SST::HostProf::HandlerProfile m_profileEvent;
+
 	Hermes::OS*	m_os;
 
     struct ApiInfo {
@@ -21,6 +21,7 @@
 #include <sst/core/statapi/statbase.h>
 #include <sst/elements/hermes/msgapi.h>
 #include <sst/elements/hermes/shmemapi.h>
+#include <sst/elements/pool/objectPool.h>
 
 namespace SST {
 namespace Ember {
@@ -61,6 +62,9 @@ public:
         m_state(Issue), m_output(NULL), m_evStat(NULL), m_completeDelayNS(0), m_retvalPtr(NULL) {}
 	~EmberEvent() {}
 
+    // Motifs create an event per operation, all of them share one pool
+    SST_ELEMENT_POOL_OPERATORS(SST::Ember::EmberEvent)
+
 	virtual std::string getName() { return "?????"; };
 
     State state() { return m_state; }
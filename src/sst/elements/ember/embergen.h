@@ -17,7 +17,10 @@
 #ifndef _H_EMBER_GENERATOR
 #define _H_EMBER_GENERATOR
 
+#include <map>
 #include <queue>
+#include <set>
+#include <sstream>
 
 #include <sst/core/output.h>
 #include <sst/core/module.h>
@@ -61,6 +64,7 @@ class EmberGenerator : public SubComponent {
         { "_jobId", "used internally", "-1"},
         { "_enginePtr", "used internally", "-1"},
 		{ "distribModule", "Sets the distribution SST module for compute modeling, default is a constant distribution of mean 1", "1.0"},
+		{ "detailedComputeMemoize", "Run the detailed compute model once per distinct phase and reuse its time for identical phases", "0"},
 	)
 
     EmberGenerator( ComponentId_t id, Params& params ) : SubComponent(id) { assert(0); }
@@ -144,6 +148,10 @@ class EmberGenerator : public SubComponent {
     bool                    m_primary;
     EmberComputeDistribution*           m_computeDistrib;
     uint64_t m_curVirtAddr;
+
+    // detailed compute times by phase signature, see enQ_detailedCompute()
+    bool                                m_memoizeDetailed;
+    std::map< std::string, uint64_t >   m_detailedTimes;
 };
 
 void EmberGenerator::enQ_getTime( Queue& q, uint64_t* time ) {
@@ -157,14 +165,34 @@ void EmberGenerator::enQ_compute( Queue& q, uint64_t delay )
 
 void EmberGenerator::enQ_compute( Queue& q, std::function<uint64_t()> func )
 {
-    q.push( new EmberComputeEvent( &getOutput(), func, m_computeDistrib ) );
+    q.push( new EmberComputeFuncEvent( &getOutput(), func, m_computeDistrib ) );
 }
 
 void EmberGenerator::enQ_detailedCompute( Queue& q, std::string name,
         Params& params, std::function<int()> fini = NULL )
 {
     assert( m_detailedCompute );
-    q.push( new EmberDetailedComputeEvent( &getOutput(), *m_detailedCompute, name, params, fini ) );
+
+    if ( ! m_memoizeDetailed ) {
+        q.push( new EmberDetailedComputeEvent( &getOutput(), *m_detailedCompute, name, params, fini ) );
+        return;
+    }
+
+    // a phase is the model name and every one of its parameters
+    std::ostringstream signature;
+    signature << name;
+    std::set<std::string> keys = params.getKeys();
+    for ( std::set<std::string>::iterator iter = keys.begin(); iter != keys.end(); ++iter ) {
+        signature << ";" << *iter << "=" << params.find<std::string>( *iter );
+    }
+
+    std::map< std::string, uint64_t >::iterator found = m_detailedTimes.find( signature.str() );
+    if ( found != m_detailedTimes.end() ) {
+        q.push( new EmberMemoizedComputeEvent( &getOutput(), found->second, fini ) );
+    } else {
+        q.push( new EmberDetailedComputeEvent( &getOutput(), *m_detailedCompute, name, params, fini,
+                                                &m_detailedTimes, signature.str() ) );
+    }
 }
 
 void EmberGenerator::enQ_memAlloc( Queue& q, Hermes::MemAddr* addr, size_t length )
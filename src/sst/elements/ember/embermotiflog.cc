@@ -105,7 +105,6 @@ void EmberMotifLog::logMotifEnd(const std::string& name, const int motifNum) {
 
         // File format:  job rank motifnum motif_name start_time end_time
 		fprintf(logFile, "%d %d %d %s %s %s\n", jobID, rank, motifNum, nameChar, startTimeChar, endTime.c_str());
-		fflush(logFile);
 
 	}
 }
@@ -24,8 +24,14 @@ namespace Ember {
 
 class EmberMotifLogRecord {
 	public:
-		EmberMotifLogRecord(const char* filePath) {
+		EmberMotifLogRecord(const char* filePath) : motifCount(0) {
 			loggerFile = fopen(filePath, "wt");
+			// Records are only flushed when the buffer fills and when the
+			// last log using the file closes it. Every rank writes a record
+			// per motif, so a flush per record made the log the bottleneck.
+			if(NULL != loggerFile) {
+				setvbuf(loggerFile, NULL, _IOFBF, 1 << 20);
+			}
 		}
 
 		~EmberMotifLogRecord() {
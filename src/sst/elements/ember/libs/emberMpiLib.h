@@ -39,6 +39,8 @@
 #include "mpi/emberrecvev.h"
 #include "mpi/emberisendev.h"
 #include "mpi/emberirecvev.h"
+#include "mpi/embersendvev.h"
+#include "mpi/emberrecvvev.h"
 #include "mpi/emberwaitallev.h"
 #include "mpi/emberwaitanyev.h"
 #include "mpi/emberwaitev.h"
@@ -198,6 +200,26 @@ class EmberMpiLib : public EmberLib {
 		q.push( new EmberIRecvEvent( api(), m_output, m_Stats[Irecv], payload, count, dtype, source, tag, group, req ) );
 	}
 
+	// One event posts an isend per descriptor, req must hold msgs.size() requests
+    void sendv( Queue& q, std::vector<MessageDesc>& msgs, Communicator group, MessageRequest req[] ) {
+        if (!req) abort_output.fatal(CALL_INFO, -1, "sendv requires nonnull MessageRequest array\n");
+
+    	q.push( new EmberSendvEvent( api(), m_output, m_Stats[Isend], msgs, group, req ) );
+
+		if ( m_spyplotMode > EMBER_SPYPLOT_NONE ) {
+			for ( size_t i = 0; i < msgs.size(); i++ ) {
+				updateSpyplot( msgs[i].rank, api().sizeofDataType( msgs[i].dtype ) );
+			}
+		}
+	}
+
+	// One event posts an irecv per descriptor, req must hold msgs.size() requests
+    void recvv( Queue& q, std::vector<MessageDesc>& msgs, Communicator group, MessageRequest req[] ) {
+        if (!req) abort_output.fatal(CALL_INFO, -1, "recvv requires nonnull MessageRequest array\n");
+
+		q.push( new EmberRecvvEvent( api(), m_output, m_Stats[Irecv], msgs, group, req ) );
+	}
+
     void cancel( Queue& q, MessageRequest req ) {
 		q.push( new EmberCancelEvent( api(), m_output, m_Stats[Waitall], req ) );
 	}
@@ -36,6 +36,7 @@
 #include "shmem/emberShmemMallocEv.h"
 #include "shmem/emberShmemFreeEv.h"
 #include "shmem/emberShmemPutEv.h"
+#include "shmem/emberShmemPutBatchEv.h"
 #include "shmem/emberShmemPutVEv.h"
 #include "shmem/emberShmemGetEv.h"
 #include "shmem/emberShmemGetVEv.h"
@@ -44,6 +45,7 @@
 #include "shmem/emberShmemSwapEv.h"
 #include "shmem/emberShmemFaddEv.h"
 #include "shmem/emberShmemAddEv.h"
+#include "shmem/emberShmemAddBatchEv.h"
 
 #include "shmem/emberFamGet_Ev.h"
 #include "shmem/emberFamPut_Ev.h"
@@ -344,6 +346,25 @@ class EmberShmemLib : public EmberLib {
 		q.push( new EmberPutShmemEvent( api(), m_output,  dest.getSimVAddr(), src.getSimVAddr(), length, pe, false ) );
 	}
 
+	// One event for all the puts, they complete like put_nbi
+	void put_nbi_batch( Queue& q, std::vector<Hermes::Shmem::PutDesc>& ops ) {
+		q.push( new EmberPutBatchShmemEvent( api(), m_output, ops ) );
+	}
+
+	// Strided put of nelems elements of elsize bytes, strides are in
+	// elements as for shmem_iput, completes like put_nbi
+	void iput_nbi( Queue& q, Hermes::MemAddr dest, Hermes::MemAddr src, ptrdiff_t dst, ptrdiff_t sst,
+			size_t nelems, size_t elsize, int pe ) {
+		std::vector<Hermes::Shmem::PutDesc> ops( nelems );
+		for ( size_t i = 0; i < nelems; i++ ) {
+			ops[i].dest = dest.getSimVAddr() + i * dst * elsize;
+			ops[i].src = src.getSimVAddr() + i * sst * elsize;
+			ops[i].nelems = elsize;
+			ops[i].pe = pe;
+		}
+		put_nbi_batch( q, ops );
+	}
+
 	template <class TYPE>
 	void putv( Queue& q, Hermes::MemAddr addr, TYPE value, int pe ) {
 		q.push( new EmberPutvShmemEvent( api(), m_output,  addr.getSimVAddr(), Hermes::Value( (TYPE) value ), pe ) );
@@ -365,6 +386,11 @@ class EmberShmemLib : public EmberLib {
 					addr.getSimVAddr(), Hermes::Value(value), pe ) );
 	}
 
+	// One event for all the adds
+	void add_batch( Queue& q, std::vector<Hermes::Shmem::AddDesc>& ops ) {
+		q.push( new EmberAddBatchShmemEvent( api(), m_output, ops ) );
+	}
+
 	template <class TYPE>
 	void fadd( Queue& q, TYPE* result, Hermes::MemAddr addr, TYPE* value,  int pe ) {
 		q.push( new EmberFaddShmemEvent( api(), m_output,
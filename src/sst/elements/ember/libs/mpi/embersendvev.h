@@ -0,0 +1,57 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_EMBER_SENDV_EVENT
+#define _H_EMBER_SENDV_EVENT
+
+#include "emberMPIEvent.h"
+
+namespace SST {
+namespace Ember {
+
+class EmberSendvEvent : public EmberMPIEvent {
+
+public:
+	EmberSendvEvent( MP::Interface& api, Output* output,
+                    EmberEventTimeStatistic* stat,
+            std::vector<MP::MessageDesc>& msgs, Communicator group,
+            MessageRequest req[] ) :
+        EmberMPIEvent( api, output, stat ),
+        m_msgs(msgs),
+        m_group(group),
+        m_req(req)
+    {}
+
+	~EmberSendvEvent() {}
+
+    std::string getName() { return "Sendv"; }
+
+    void issue( uint64_t time, FOO* functor ) {
+
+        EmberEvent::issue( time );
+
+        m_api.sendv( m_msgs, m_group, m_req, functor );
+    }
+
+protected:
+    std::vector<MP::MessageDesc> m_msgs;
+    Communicator    m_group;
+    MessageRequest* m_req;
+};
+
+}
+}
+
+#endif
@@ -0,0 +1,49 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_EMBER_SHMEM_ADD_BATCH_EVENT
+#define _H_EMBER_SHMEM_ADD_BATCH_EVENT
+
+#include "emberShmemEvent.h"
+
+namespace SST {
+namespace Ember {
+
+class EmberAddBatchShmemEvent : public EmberShmemEvent {
+
+public:
+	EmberAddBatchShmemEvent( Shmem::Interface& api, Output* output,
+            std::vector<Hermes::Shmem::AddDesc>& ops,
+            EmberEventTimeStatistic* stat = NULL ) :
+            EmberShmemEvent( api, output, stat ), m_ops(ops) {}
+	~EmberAddBatchShmemEvent() {}
+
+    std::string getName() { return "AddBatch"; }
+
+    void issue( uint64_t time, Shmem::Callback callback ) {
+
+        EmberEvent::issue( time );
+        m_api.add_batch( m_ops, callback );
+    }
+
+private:
+    std::vector<Hermes::Shmem::AddDesc> m_ops;
+};
+
+}
+}
+
+#endif
@@ -33,6 +33,8 @@ namespace Ember {
 #define enQ_recv mpi().recv
 #define enQ_isend mpi().isend
 #define enQ_irecv mpi().irecv
+#define enQ_sendv mpi().sendv
+#define enQ_recvv mpi().recvv
 #define enQ_cancel mpi().cancel
 #define enQ_sendrecv mpi().sendrecv
 
@@ -26,6 +26,7 @@ using namespace SST::Ember;
 using namespace SST::Hermes::MP;
 
 static std::map<uint32_t, int32_t>  blockToNodeMap;
+static bool                         blockToNodeMapComplete = false;
 
 Ember3DAMRGenerator::Ember3DAMRGenerator(SST::ComponentId_t id, Params& params) :
 	EmberMessagePassingGenerator(id, params, "3DAMR")
@@ -57,6 +58,8 @@ Ember3DAMRGenerator::Ember3DAMRGenerator(SST::ComponentId_t id, Params& params)
         	meshType = 1;
     	}
 
+	meshFile = NULL;
+
 	printMaps = params.find<std::string>("arg.printmap", "no") == "yes";
 	if(printMaps) {
 		out->verbose(CALL_INFO, 16, 0, "Configured to print rank to block maps\n");
@@ -85,9 +88,14 @@ void Ember3DAMRGenerator::loadBlocks() {
     if(2 == meshType) {
         amrFile = new EmberAMRBinaryFile(blockFilePath, out);
 
-	if(blockToNodeMap.empty()) {
+	// With an owner table the wire up looks up only the blocks it needs,
+	// the full map is built only to print it or for older mesh files
+	if(!blockToNodeMapComplete && (printMaps || !amrFile->hasOwnerTable())) {
 		amrFile->populateGlobalBlocks(&blockToNodeMap);
+		blockToNodeMapComplete = true;
 	}
+
+	meshFile = amrFile;
     } else {
 //        amrFile = new EmberAMRTextFile(blockFilePath, out);
 	out->fatal(CALL_INFO, -1, "Binary mesh files are the only type currently supported, use sst-meshconvert\n");
@@ -204,7 +212,7 @@ void Ember3DAMRGenerator::loadBlocks() {
 			const uint32_t commToBlock = calcBlockID((blockXPos / 2) + 1,
 				blockYPos / 2, blockZPos / 2, blockXUp);
 
-			std::map<uint32_t, int32_t>::iterator blockNode = blockToNodeMap.find(commToBlock);
+			std::map<uint32_t, int32_t>::iterator blockNode = findBlockNode(commToBlock);
 
 			if(blockNode == blockToNodeMap.end() && isBlockLocal(commToBlock)) {
 				if( ! isBlockLocal(commToBlock) ) {
@@ -222,10 +230,10 @@ void Ember3DAMRGenerator::loadBlocks() {
 			const uint32_t x3 = calcBlockID(blockXPos * 2 + 2, blockYPos * 2,     blockZPos * 2 + 1, blockXUp);
 			const uint32_t x4 = calcBlockID(blockXPos * 2 + 2, blockYPos * 2 + 1, blockZPos * 2 + 1, blockXUp);
 
-			std::map<uint32_t, int32_t>::iterator blockNodeX1 = blockToNodeMap.find(x1);
-			std::map<uint32_t, int32_t>::iterator blockNodeX2 = blockToNodeMap.find(x2);
-			std::map<uint32_t, int32_t>::iterator blockNodeX3 = blockToNodeMap.find(x3);
-			std::map<uint32_t, int32_t>::iterator blockNodeX4 = blockToNodeMap.find(x4);
+			std::map<uint32_t, int32_t>::iterator blockNodeX1 = findBlockNode(x1);
+			std::map<uint32_t, int32_t>::iterator blockNodeX2 = findBlockNode(x2);
+			std::map<uint32_t, int32_t>::iterator blockNodeX3 = findBlockNode(x3);
+			std::map<uint32_t, int32_t>::iterator blockNodeX4 = findBlockNode(x4);
 
 			int32_t rankX1 = blockNodeX1->second;
 			int32_t rankX2 = blockNodeX2->second;
@@ -275,7 +283,7 @@ void Ember3DAMRGenerator::loadBlocks() {
 			const uint32_t blockNextToMe = calcBlockID(blockXPos + 1,
 				blockYPos, blockZPos, blockXUp);
 
-			std::map<uint32_t, int32_t>::iterator blockNextToMeNode = blockToNodeMap.find(blockNextToMe);
+			std::map<uint32_t, int32_t>::iterator blockNextToMeNode = findBlockNode(blockNextToMe);
 
 			if(blockNextToMeNode == blockToNodeMap.end()) {
 				if( ! isBlockLocal(blockNextToMe) ) {
@@ -309,7 +317,7 @@ void Ember3DAMRGenerator::loadBlocks() {
 			const uint32_t commToBlock = calcBlockID((blockXPos / 2) - 1,
 				blockYPos / 2, blockZPos / 2, blockXDown);
 
-			std::map<uint32_t, int32_t>::iterator blockNode = blockToNodeMap.find(commToBlock);
+			std::map<uint32_t, int32_t>::iterator blockNode = findBlockNode(commToBlock);
 
 			if(blockNode == blockToNodeMap.end() && isBlockLocal(commToBlock)) {
 				if( ! isBlockLocal(commToBlock) ) {
@@ -333,10 +341,10 @@ void Ember3DAMRGenerator::loadBlocks() {
 			const uint32_t x3 = calcBlockID(blockXPos * 2 - 1, blockYPos * 2,     blockZPos * 2 + 1, blockXDown);
 			const uint32_t x4 = calcBlockID(blockXPos * 2 - 1, blockYPos * 2 + 1, blockZPos * 2 + 1, blockXDown);
 
-			std::map<uint32_t, int32_t>::iterator blockNodeX1 = blockToNodeMap.find(x1);
-			std::map<uint32_t, int32_t>::iterator blockNodeX2 = blockToNodeMap.find(x2);
-			std::map<uint32_t, int32_t>::iterator blockNodeX3 = blockToNodeMap.find(x3);
-			std::map<uint32_t, int32_t>::iterator blockNodeX4 = blockToNodeMap.find(x4);
+			std::map<uint32_t, int32_t>::iterator blockNodeX1 = findBlockNode(x1);
+			std::map<uint32_t, int32_t>::iterator blockNodeX2 = findBlockNode(x2);
+			std::map<uint32_t, int32_t>::iterator blockNodeX3 = findBlockNode(x3);
+			std::map<uint32_t, int32_t>::iterator blockNodeX4 = findBlockNode(x4);
 
 			int32_t rankX1 = blockNodeX1->second;
 			int32_t rankX2 = blockNodeX2->second;
@@ -386,7 +394,7 @@ void Ember3DAMRGenerator::loadBlocks() {
 			const uint32_t blockNextToMe = calcBlockID(blockXPos - 1,
 				blockYPos, blockZPos, blockXDown);
 
-			std::map<uint32_t, int32_t>::iterator blockNextToMeNode = blockToNodeMap.find(blockNextToMe);
+			std::map<uint32_t, int32_t>::iterator blockNextToMeNode = findBlockNode(blockNextToMe);
 
 			if(blockNextToMeNode == blockToNodeMap.end()) {
 				if( ! isBlockLocal(blockNextToMe) ) {
@@ -410,7 +418,7 @@ void Ember3DAMRGenerator::loadBlocks() {
             const uint32_t commToBlock = calcBlockID((blockXPos / 2),
                                                      (blockYPos / 2) + 1, blockZPos / 2, blockYUp);
 
-            std::map<uint32_t, int32_t>::iterator blockNode = blockToNodeMap.find(commToBlock);
+            std::map<uint32_t, int32_t>::iterator blockNode = findBlockNode(commToBlock);
 
             if(blockNode == blockToNodeMap.end() && isBlockLocal(commToBlock)) {
                 if( ! isBlockLocal(commToBlock) ) {
@@ -429,10 +437,10 @@ void Ember3DAMRGenerator::loadBlocks() {
             const uint32_t y3 = calcBlockID(blockXPos * 2,     blockYPos * 2 + 2, blockZPos * 2 + 1, blockYUp);
             const uint32_t y4 = calcBlockID(blockXPos * 2 + 1, blockYPos * 2 + 2, blockZPos * 2 + 1, blockYUp);
 
-            std::map<uint32_t, int32_t>::iterator blockNodeY1 = blockToNodeMap.find(y1);
-            std::map<uint32_t, int32_t>::iterator blockNodeY2 = blockToNodeMap.find(y2);
-            std::map<uint32_t, int32_t>::iterator blockNodeY3 = blockToNodeMap.find(y3);
-            std::map<uint32_t, int32_t>::iterator blockNodeY4 = blockToNodeMap.find(y4);
+            std::map<uint32_t, int32_t>::iterator blockNodeY1 = findBlockNode(y1);
+            std::map<uint32_t, int32_t>::iterator blockNodeY2 = findBlockNode(y2);
+            std::map<uint32_t, int32_t>::iterator blockNodeY3 = findBlockNode(y3);
+            std::map<uint32_t, int32_t>::iterator blockNodeY4 = findBlockNode(y4);
 
 			int32_t rankY1 = blockNodeY1->second;
 			int32_t rankY2 = blockNodeY2->second;
@@ -481,7 +489,7 @@ void Ember3DAMRGenerator::loadBlocks() {
             // Same level
             const uint32_t blockNextToMe = calcBlockID(blockXPos,
                                                        blockYPos + 1, blockZPos, blockYUp);
-            std::map<uint32_t, int32_t>::iterator blockNextToMeNode = blockToNodeMap.find(blockNextToMe);
+            std::map<uint32_t, int32_t>::iterator blockNextToMeNode = findBlockNode(blockNextToMe);
 
             if(blockNextToMeNode == blockToNodeMap.end()) {
                 if( ! isBlockLocal(blockNextToMe) ) {
@@ -507,7 +515,7 @@ void Ember3DAMRGenerator::loadBlocks() {
             const uint32_t commToBlock = calcBlockID((blockXPos / 2),
                                                      (blockYPos / 2) - 1, blockZPos / 2, blockYDown);
 
-            std::map<uint32_t, int32_t>::iterator blockNode = blockToNodeMap.find(commToBlock);
+            std::map<uint32_t, int32_t>::iterator blockNode = findBlockNode(commToBlock);
 
             if(blockNode == blockToNodeMap.end() && isBlockLocal(commToBlock)) {
                 if( ! isBlockLocal(commToBlock) ) {
@@ -526,10 +534,10 @@ void Ember3DAMRGenerator::loadBlocks() {
             const uint32_t y3 = calcBlockID(blockXPos * 2,     blockYPos * 2 - 1, blockZPos * 2 + 1, blockYDown);
             const uint32_t y4 = calcBlockID(blockXPos * 2 + 1, blockYPos * 2 - 1, blockZPos * 2 + 1, blockYDown);
 
-            std::map<uint32_t, int32_t>::iterator blockNodeY1 = blockToNodeMap.find(y1);
-            std::map<uint32_t, int32_t>::iterator blockNodeY2 = blockToNodeMap.find(y2);
-            std::map<uint32_t, int32_t>::iterator blockNodeY3 = blockToNodeMap.find(y3);
-            std::map<uint32_t, int32_t>::iterator blockNodeY4 = blockToNodeMap.find(y4);
+            std::map<uint32_t, int32_t>::iterator blockNodeY1 = findBlockNode(y1);
+            std::map<uint32_t, int32_t>::iterator blockNodeY2 = findBlockNode(y2);
+            std::map<uint32_t, int32_t>::iterator blockNodeY3 = findBlockNode(y3);
+            std::map<uint32_t, int32_t>::iterator blockNodeY4 = findBlockNode(y4);
 
 			int32_t rankY1 = blockNodeY1->second;
 			int32_t rankY2 = blockNodeY2->second;
@@ -578,7 +586,7 @@ void Ember3DAMRGenerator::loadBlocks() {
             const uint32_t blockNextToMe = calcBlockID(blockXPos,
                                                        blockYPos - 1, blockZPos, blockYDown);
 
-            std::map<uint32_t, int32_t>::iterator blockNextToMeNode = blockToNodeMap.find(blockNextToMe);
+            std::map<uint32_t, int32_t>::iterator blockNextToMeNode = findBlockNode(blockNextToMe);
 
             if(blockNextToMeNode == blockToNodeMap.end()) {
                 if( ! isBlockLocal(blockNextToMe) ) {
@@ -603,7 +611,7 @@ void Ember3DAMRGenerator::loadBlocks() {
             const uint32_t commToBlock = calcBlockID((blockXPos / 2),
                                                      (blockYPos / 2), (blockZPos / 2) + 1, blockZUp);
 
-            std::map<uint32_t, int32_t>::iterator blockNode = blockToNodeMap.find(commToBlock);
+            std::map<uint32_t, int32_t>::iterator blockNode = findBlockNode(commToBlock);
 
             if(blockNode == blockToNodeMap.end() && isBlockLocal(commToBlock)) {
                 if( ! isBlockLocal(commToBlock) ) {
@@ -622,10 +630,10 @@ void Ember3DAMRGenerator::loadBlocks() {
             const uint32_t z3 = calcBlockID(blockXPos * 2,     blockYPos * 2 + 1, blockZPos * 2 + 2, blockZUp);
             const uint32_t z4 = calcBlockID(blockXPos * 2 + 1, blockYPos * 2 + 1, blockZPos * 2 + 2, blockZUp);
 
-            std::map<uint32_t, int32_t>::iterator blockNodeZ1 = blockToNodeMap.find(z1);
-            std::map<uint32_t, int32_t>::iterator blockNodeZ2 = blockToNodeMap.find(z2);
-            std::map<uint32_t, int32_t>::iterator blockNodeZ3 = blockToNodeMap.find(z3);
-            std::map<uint32_t, int32_t>::iterator blockNodeZ4 = blockToNodeMap.find(z4);
+            std::map<uint32_t, int32_t>::iterator blockNodeZ1 = findBlockNode(z1);
+            std::map<uint32_t, int32_t>::iterator blockNodeZ2 = findBlockNode(z2);
+            std::map<uint32_t, int32_t>::iterator blockNodeZ3 = findBlockNode(z3);
+            std::map<uint32_t, int32_t>::iterator blockNodeZ4 = findBlockNode(z4);
 
 			int32_t rankZ1 = blockNodeZ1->second;
 			int32_t rankZ2 = blockNodeZ2->second;
@@ -673,7 +681,7 @@ void Ember3DAMRGenerator::loadBlocks() {
             // Same level
             const uint32_t blockNextToMe = calcBlockID(blockXPos,
                                                        blockYPos, blockZPos + 1, blockZUp);
-            std::map<uint32_t, int32_t>::iterator blockNextToMeNode = blockToNodeMap.find(blockNextToMe);
+            std::map<uint32_t, int32_t>::iterator blockNextToMeNode = findBlockNode(blockNextToMe);
 
             if(blockNextToMeNode == blockToNodeMap.end()) {
                 if( ! isBlockLocal(blockNextToMe) ) {
@@ -697,7 +705,7 @@ void Ember3DAMRGenerator::loadBlocks() {
             const uint32_t commToBlock = calcBlockID((blockXPos / 2),
                                                      (blockYPos / 2), (blockZPos / 2) - 1, blockZDown);
 
-            std::map<uint32_t, int32_t>::iterator blockNode = blockToNodeMap.find(commToBlock);
+            std::map<uint32_t, int32_t>::iterator blockNode = findBlockNode(commToBlock);
 
             if(blockNode == blockToNodeMap.end() && isBlockLocal(commToBlock)) {
                 if( ! isBlockLocal(commToBlock) ) {
@@ -715,10 +723,10 @@ void Ember3DAMRGenerator::loadBlocks() {
             const uint32_t z3 = calcBlockID(blockXPos * 2,     blockYPos * 2 + 1, blockZPos * 2 - 1, blockZDown);
             const uint32_t z4 = calcBlockID(blockXPos * 2 + 1, blockYPos * 2 + 1, blockZPos * 2 - 1, blockZDown);
 
-            std::map<uint32_t, int32_t>::iterator blockNodeZ1 = blockToNodeMap.find(z1);
-            std::map<uint32_t, int32_t>::iterator blockNodeZ2 = blockToNodeMap.find(z2);
-            std::map<uint32_t, int32_t>::iterator blockNodeZ3 = blockToNodeMap.find(z3);
-            std::map<uint32_t, int32_t>::iterator blockNodeZ4 = blockToNodeMap.find(z4);
+            std::map<uint32_t, int32_t>::iterator blockNodeZ1 = findBlockNode(z1);
+            std::map<uint32_t, int32_t>::iterator blockNodeZ2 = findBlockNode(z2);
+            std::map<uint32_t, int32_t>::iterator blockNodeZ3 = findBlockNode(z3);
+            std::map<uint32_t, int32_t>::iterator blockNodeZ4 = findBlockNode(z4);
 
 			int32_t rankZ1 = blockNodeZ1->second;
 			int32_t rankZ2 = blockNodeZ2->second;
@@ -766,7 +774,7 @@ void Ember3DAMRGenerator::loadBlocks() {
             // Same level
             const uint32_t blockNextToMe = calcBlockID(blockXPos,
                                                        blockYPos, blockZPos - 1, blockZDown);
-            std::map<uint32_t, int32_t>::iterator blockNextToMeNode = blockToNodeMap.find(blockNextToMe);
+            std::map<uint32_t, int32_t>::iterator blockNextToMeNode = findBlockNode(blockNextToMe);
 
             if(blockNextToMeNode == blockToNodeMap.end()) {
                 if( ! isBlockLocal(blockNextToMe) ) {
@@ -792,9 +800,24 @@ void Ember3DAMRGenerator::loadBlocks() {
 
         out->verbose(CALL_INFO, 2, 0, "Blocks on rank %" PRIu32 " count is: %" PRIu32 "\n", (uint32_t) rank(), (uint32_t) localBlocks.size());
 
+	meshFile = NULL;
 	delete amrFile;
 }
 
+std::map<uint32_t, int32_t>::iterator Ember3DAMRGenerator::findBlockNode(const uint32_t blockID) {
+	std::map<uint32_t, int32_t>::iterator blockNode = blockToNodeMap.find(blockID);
+
+	if(blockNode == blockToNodeMap.end() && NULL != meshFile && meshFile->hasOwnerTable()) {
+		const int32_t owner = meshFile->findBlockOwner(blockID);
+
+		if(owner >= 0) {
+			blockNode = blockToNodeMap.insert(std::pair<uint32_t, int32_t>(blockID, owner)).first;
+		}
+	}
+
+	return blockNode;
+}
+
 void Ember3DAMRGenerator::configure()
 {
 	out->verbose(CALL_INFO, 2, 0, "Configuring AMR motif...\n");
@@ -29,6 +29,8 @@ using namespace SST;
 namespace SST {
 namespace Ember {
 
+class EmberAMRBinaryFile;
+
 class Ember3DAMRGenerator : public EmberMessagePassingGenerator {
 
 public:
@@ -98,6 +100,7 @@ public:
 
 private:
 	void printBlockMap();
+	std::map<uint32_t, int32_t>::iterator findBlockNode(const uint32_t blockID);
 
         std::vector<Ember3DAMRBlock*> localBlocks;
 	MessageRequest*   requests;
@@ -106,6 +109,7 @@ private:
 	void* blockMessageBuffer;
 
 //        static std::map<uint32_t, int32_t>  blockToNodeMap;
+	EmberAMRBinaryFile* meshFile;
         char* blockFilePath;
 
 	Output* out;
@@ -20,14 +20,17 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
 #include "ember3damrfile.h"
 #include "ember3damrblock.h"
 
-// To clean up warnings on not using return results on freads() below
-#if ((__GNUC__ > 4) || (__GNUC__ == 4 && __GNUC_MINOR__ >= 6))
-#pragma GCC diagnostic push
-#pragma GCC diagnostic ignored "-Wunused-result"
-#endif
+// Trailer written by sst-meshconvert after the rank sections: a u64 offset
+// to a table of (block ID, rank) pairs sorted by block ID, then this magic.
+// Meshes without it are still read, ranks just scan every section instead.
+#define EMBER_AMR_OWNER_TABLE_MAGIC 0x4f524d41
 
 namespace SST {
     namespace Ember {
@@ -38,29 +41,49 @@ namespace SST {
             EmberAMRBinaryFile(char* amrPath, Output* out) :
                 EmberAMRFile(amrPath, out) {
 
-                amrFile = fopen(amrFilePath, "rb");
+                amrFile = NULL;
+                filePos = 0;
+                ownerTableOffset = 0;
+
+                // The mesh is mapped rather than read so a rank only touches
+                // the pages holding its own section and the owners it asks for
+                meshFD = open(amrFilePath, O_RDONLY);
 
-                if(NULL == amrFile) {
+                if(meshFD < 0) {
                     output->fatal(CALL_INFO, -1, "Unable to open file: %s\n", amrPath);
                 }
 
+                struct stat meshStat;
+                if(fstat(meshFD, &meshStat) != 0 || meshStat.st_size == 0) {
+                    output->fatal(CALL_INFO, -1, "Unable to determine size of mesh file: %s\n", amrPath);
+                }
+
+                meshSize = (uint64_t) meshStat.st_size;
+                void* mapping = mmap(NULL, meshSize, PROT_READ, MAP_PRIVATE, meshFD, 0);
+
+                if(MAP_FAILED == mapping) {
+                    output->fatal(CALL_INFO, -1, "Unable to map mesh file: %s\n", amrPath);
+                }
+
+                meshData = (const uint8_t*) mapping;
+
                 rankCount = 0;
-                fread(&rankCount, sizeof(rankCount), 1, amrFile);
+                readValue(&rankCount);
 
                     uint32_t meshBlockCount = 0;
-                    fread(&meshBlockCount, sizeof(meshBlockCount), 1, amrFile);
+                    readValue(&meshBlockCount);
 
                     uint8_t meshMaxRefineLevel = 0;
-                    fread(&meshMaxRefineLevel, sizeof(meshMaxRefineLevel), 1, amrFile);
+                    readValue(&meshMaxRefineLevel);
 
                     uint32_t meshBlocksX = 0;
-                    fread(&meshBlocksX, sizeof(meshBlocksX), 1, amrFile);
+                    readValue(&meshBlocksX);
 
                     uint32_t meshBlocksY = 0;
-                    fread(&meshBlocksY, sizeof(meshBlocksY), 1, amrFile);
+                    readValue(&meshBlocksY);
 
                     uint32_t meshBlocksZ = 0;
-                    fread(&meshBlocksZ, sizeof(meshBlocksZ), 1, amrFile);
+                    readValue(&meshBlocksZ);
 
                     blocksX = (int) meshBlocksX;
                     blocksY = (int) meshBlocksY;
@@ -72,21 +95,37 @@ namespace SST {
                     out->verbose(CALL_INFO, 8, 0, "Read mesh header info: blocks=%" PRIu32 ", max-lev: %" PRIu32 " bkX=%" PRIu32 ", blkY=%" PRIu32 ", blkZ=%" PRIu32 "\n",
                              totalBlockCount, maxRefinementLevel, blocksX, blocksY, blocksZ);
 
-		    rankIndexOffset = ftell(amrFile);
+		    rankIndexOffset = filePos;
 
 		    const uint64_t meshStartIndex = rankIndexOffset + (rankCount * sizeof(uint64_t));
 
+		    locateOwnerTable();
+
 		    out->verbose(CALL_INFO, 8, 0, "Set mesh file seek to: %" PRIu64 "\n", meshStartIndex);
-		    fseek(amrFile, (long)(meshStartIndex), SEEK_SET);
+		    filePos = meshStartIndex;
 
             }
 
             ~EmberAMRBinaryFile() {
-        	fclose(amrFile);
+		munmap((void*) meshData, meshSize);
+		close(meshFD);
             }
 
 	    void populateGlobalBlocks(std::map<uint32_t, int32_t>* globalBlockMap) {
-		fseek(amrFile, rankIndexOffset + (rankCount * sizeof(uint64_t)), SEEK_SET);
+		if(hasOwnerTable()) {
+			// Already sorted by block ID, so every insert lands at the end
+			for(uint32_t i = 0; i < (uint32_t) totalBlockCount; ++i) {
+				uint32_t blockID;
+				int32_t  owner;
+
+				readOwnerEntry(i, &blockID, &owner);
+				globalBlockMap->insert(globalBlockMap->end(), std::pair<uint32_t, int32_t>(blockID, owner));
+			}
+
+			return;
+		}
+
+		filePos = rankIndexOffset + (rankCount * sizeof(uint64_t));
 
 		for(uint32_t i = 0; i < rankCount; ++i) {
 			uint32_t blocksOnNode = 0;
@@ -122,20 +161,22 @@ namespace SST {
 		output->verbose(CALL_INFO, 16, 0, "Seek file offet: Base=%" PRIu64 ", Rank=%" PRIu32 ", Offset=%" PRIu64 ", File Seek=%" PRIu64 "\n",
 			rankIndexOffset, rank, (uint64_t)(rank * sizeof(uint64_t)), seekOffset);
 
-		fseek(amrFile, seekOffset, SEEK_SET);
+		filePos = seekOffset;
 
 		uint64_t rankBlocksIndex = 0;
-		fread(&rankBlocksIndex, sizeof(rankBlocksIndex), 1, amrFile);
+		readValue(&rankBlocksIndex);
 
 		output->verbose(CALL_INFO, 16, 0, "Rank Offset: %" PRIu64 ", seeking in file...\n", rankBlocksIndex);
 
-		fseek(amrFile, rankBlocksIndex, SEEK_SET);
+		filePos = rankBlocksIndex;
 
 		uint32_t blocksOnNode = 0;
 		readNodeMeshLine(&blocksOnNode);
 
 		output->verbose(CALL_INFO, 16, 0, "Rank has %" PRIu32 " blocks on the the node.\n", blocksOnNode);
 
+		localBlocks->reserve(localBlocks->size() + blocksOnNode);
+
 		uint32_t blockID;
                        	uint32_t refineLevel;
                        	int32_t  xDown;
@@ -159,64 +200,129 @@ namespace SST {
 		}
 	    }
 
+	    bool hasOwnerTable() const {
+		return ownerTableOffset != 0;
+	    }
+
+	    // Binary search of the owner table, -1 if the block is not in the mesh
+	    int32_t findBlockOwner(const uint32_t blockID) {
+		if(!hasOwnerTable()) {
+			return -1;
+		}
+
+		uint32_t low  = 0;
+		uint32_t high = (uint32_t) totalBlockCount;
+
+		while(low < high) {
+			const uint32_t mid = low + ((high - low) / 2);
+			uint32_t midID;
+			int32_t  midOwner;
+
+			readOwnerEntry(mid, &midID, &midOwner);
+
+			if(midID == blockID) {
+				return midOwner;
+			} else if(midID < blockID) {
+				low = mid + 1;
+			} else {
+				high = mid;
+			}
+		}
+
+		return -1;
+	    }
+
             void readNodeMeshLine(uint32_t* blockCount) {
-                fread(blockCount, sizeof(uint32_t), 1, amrFile);
+                readValue(blockCount);
             }
 
 	    void locateRankEntries(uint32_t rank) {
-		fseek(amrFile, (long) (rankIndexOffset + (rank * sizeof(uint64_t))), SEEK_SET);
+		filePos = rankIndexOffset + (rank * sizeof(uint64_t));
 
 		uint64_t rankStart = 0;
-		fread(&rankStart, sizeof(rankStart), 1, amrFile);
+		readValue(&rankStart);
 
-		fseek(amrFile, (long) (rankStart), SEEK_SET);
+		filePos = rankStart;
 	    }
 
             void readNextMeshLine(uint32_t* blockID, uint32_t* refineLev,
                                   int32_t* xDown, int32_t* xUp,
                                   int32_t* yDown, int32_t* yUp,
                                   int32_t* zDown, int32_t* zUp) {
-                int8_t temp = 0;
 
-                fread(blockID, sizeof(uint32_t), 1, amrFile);
+                readValue(blockID);
 
-		fread(&temp, sizeof(temp), 1, amrFile);
-		*refineLev = (uint32_t) temp;
+		const int8_t* fields = (const int8_t*) readBytes(7);
 
-                fread(&temp, sizeof(temp), 1, amrFile);
-                *xDown = (int32_t) temp;
+		*refineLev = (uint32_t) fields[0];
+                *xDown     = (int32_t)  fields[1];
+                *xUp       = (int32_t)  fields[2];
+                *yDown     = (int32_t)  fields[3];
+                *yUp       = (int32_t)  fields[4];
+                *zDown     = (int32_t)  fields[5];
+                *zUp       = (int32_t)  fields[6];
+            }
 
-                fread(&temp, sizeof(temp), 1, amrFile);
-                *xUp = (int32_t) temp;
+	    virtual bool isBinary() {
+		return true;
+	    }
 
-                fread(&temp, sizeof(temp), 1, amrFile);
-                *yDown = (int32_t) temp;
+        private:
+	    const uint8_t* readBytes(const uint64_t count) {
+		if(filePos + count > meshSize) {
+			output->fatal(CALL_INFO, -1, "Read past the end of mesh file %s (offset %" PRIu64 ", size %" PRIu64 ")\n",
+				amrFilePath, filePos, meshSize);
+		}
 
-                fread(&temp, sizeof(temp), 1, amrFile);
-                *yUp = (int32_t) temp;
+		const uint8_t* bytes = meshData + filePos;
+		filePos += count;
+		return bytes;
+	    }
 
-                fread(&temp, sizeof(temp), 1, amrFile);
-                *zDown = (int32_t) temp;
+	    template<typename T>
+	    void readValue(T* value) {
+		memcpy(value, readBytes(sizeof(T)), sizeof(T));
+	    }
 
-                fread(&temp, sizeof(temp), 1, amrFile);
-                *zUp = (int32_t) temp;
-            }
+	    void readOwnerEntry(const uint32_t index, uint32_t* blockID, int32_t* owner) {
+		const uint8_t* entry = meshData + ownerTableOffset + ((uint64_t) index * 2 * sizeof(uint32_t));
 
-	    virtual bool isBinary() {
-		return true;
+		memcpy(blockID, entry, sizeof(uint32_t));
+		memcpy(owner, entry + sizeof(uint32_t), sizeof(int32_t));
+	    }
+
+	    void locateOwnerTable() {
+		const uint64_t trailerSize = sizeof(uint64_t) + sizeof(uint32_t);
+		const uint64_t tableSize   = (uint64_t) totalBlockCount * 2 * sizeof(uint32_t);
+
+		if(meshSize < trailerSize) {
+			return;
+		}
+
+		uint64_t tableOffset = 0;
+		uint32_t magic = 0;
+
+		memcpy(&tableOffset, meshData + meshSize - trailerSize, sizeof(tableOffset));
+		memcpy(&magic, meshData + meshSize - sizeof(magic), sizeof(magic));
+
+		if(magic == EMBER_AMR_OWNER_TABLE_MAGIC && tableOffset > rankIndexOffset &&
+			tableOffset + tableSize + trailerSize == meshSize) {
+
+			output->verbose(CALL_INFO, 8, 0, "Mesh file has a block owner table at: %" PRIu64 "\n", tableOffset);
+			ownerTableOffset = tableOffset;
+		}
 	    }
 
-        private:
             uint32_t rankCount;
 	    uint64_t rankIndexOffset;
-            FILE* amrFile;
+	    uint64_t ownerTableOffset;
+	    uint64_t filePos;
+	    uint64_t meshSize;
+	    const uint8_t* meshData;
+	    int meshFD;
         };
 
     }
 }
 
-#if ((__GNUC__ > 4) || (__GNUC__ == 4 && __GNUC_MINOR__ >= 6))
-#pragma GCC diagnostic pop
-#endif
-
 #endif
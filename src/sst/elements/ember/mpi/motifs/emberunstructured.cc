@@ -83,12 +83,12 @@ void EmberUnstructuredGenerator::configure()
         CommMap = new std::vector<std::map<int,int> >(size());
 		int srcTask, destTask;
 		for(unsigned int i = 0; i < CommMap->size(); i++){
-	        srcTask = cm->CustomMap[i];
+	        srcTask = cm->customRank(i);
 	        //if(0 == rank())
 	        	//std::cout << "Rank(" << i << ") is in fact Rank(" << srcTask << ")"<< std::endl;
 
 	        for(std::map<int, int>::iterator it = rawCommMap->at(i).begin(); it != rawCommMap->at(i).end(); it++){
-	        	destTask = cm->CustomMap[it->first];
+	        	destTask = cm->customRank(it->first);
 	        	CommMap->at(srcTask)[destTask] = 1; //1 could be changed to the weight (it->second) in the future
 	        	//if(0 == rank())
 	        		//std::cout << srcTask << " communicates with " << destTask << std::endl;
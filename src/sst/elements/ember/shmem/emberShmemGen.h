@@ -28,8 +28,11 @@
 #define enQ_get shmem().get
 #define enQ_getv shmem().getv
 #define enQ_put_nbi shmem().put_nbi
+#define enQ_put_nbi_batch shmem().put_nbi_batch
+#define enQ_iput_nbi shmem().iput_nbi
 #define enQ_get_nbi shmem().get_nbi
 #define enQ_add shmem().add
+#define enQ_add_batch shmem().add_batch
 #define enQ_fadd shmem().fadd
 #define enQ_swap shmem().swap
 #define enQ_cswap shmem().cswap
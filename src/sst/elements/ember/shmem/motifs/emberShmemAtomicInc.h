@@ -46,6 +46,7 @@ public:
 		m_iterations = params.find<int>("arg.iterations", 1);
 		m_opStr = params.find<std::string>("arg.op", "add");
 		m_hotMult = params.find<int>("arg.hotMult", 4);
+		m_batch = params.find<int>("arg.batch", 1);
         if ( m_opStr.compare("add") == 0 ) {
             m_op = Add;
         } else if ( m_opStr.compare("fadd") == 0 ) {
@@ -94,6 +95,9 @@ public:
                 printf("\titerations: %d\n", m_iterations );
                 printf("\touterLoop: %d\n", m_outLoop );
                 printf("\toperation: %s\n", m_opStr.c_str() );
+                if ( m_batch > 1 ) {
+                    printf("\tbatch: %d\n", m_batch );
+                }
             }
 
 			if ( m_backed ) {
@@ -124,7 +128,19 @@ public:
             	enQ_fadd( evQ, &m_result, addr, &m_one, dest );
                 break;
               case Add:
-                enQ_add( evQ, addr, &m_one, dest );
+                if ( m_batch > 1 ) {
+                    Hermes::Shmem::AddDesc desc;
+                    desc.dest = addr.getSimVAddr();
+                    desc.value = Hermes::Value( &m_one );
+                    desc.pe = dest;
+                    m_addBatch.push_back( desc );
+                    if ( m_addBatch.size() == (size_t) m_batch || m_phase + 1 == m_iterations * m_updates ) {
+                        enQ_add_batch( evQ, m_addBatch );
+                        m_addBatch.clear();
+                    }
+                } else {
+                    enQ_add( evQ, addr, &m_one, dest );
+                }
                 break;
               case Putv:
                 enQ_putv( evQ, addr, &m_one, dest );
@@ -260,6 +276,8 @@ public:
     int m_node_num;
     int m_num_nodes;
     int m_hotMult;
+    int m_batch;
+    std::vector<Hermes::Shmem::AddDesc> m_addBatch;
 };
 
 template < class TYPE, int VAL >
@@ -346,6 +364,7 @@ public:
         { "arg.outLoop","Sets the number of outer loops","1"},
         { "arg.numNodes","Sets the number of nodes","-1"},
         { "arg.randAddr","Use a random address for the SHMEM op","1"},
+        { "arg.batch","Issue this many add updates as one batched SHMEM event","1"},
     )
 public:
 	EmberShmemAtomicIncIntGenerator(SST::ComponentId_t id, Params& params) :
@@ -57,3 +57,7 @@
 #define SIRIUS_MPI_MIN 17
 
 #define SIRIUS_MPI_REQUEST_NULL UINT64_MAX
+
+// A version 2 trace starts with this word, which is never a call ID, and
+// encodes each timestamp as a LEB128 count of nanoseconds since the last one
+#define SIRIUS_TRACE_V2_MAGIC 0x32535253
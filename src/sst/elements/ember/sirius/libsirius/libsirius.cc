@@ -18,8 +18,13 @@
 #include <cstdio>
 #include <cstdlib>
 #include <cstdint>
+#include <cstring>
+#include <cinttypes>
 
 #include <map>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
 
 #include "sirius/siriusglobals.h"
 
@@ -34,6 +39,28 @@ double load_library;
 FILE* trace_dump;
 std::map<MPI_Comm, uint32_t> commPtrMap;
 
+// Records are appended to the active buffer by the calling thread with no
+// locking, the trace is one ordered stream per rank so there is a single
+// producer. A full buffer is swapped with the idle one and written by the
+// flush thread, so the application only waits if that write falls behind.
+// SIRIUS_ASYNC_FLUSH=0 writes full buffers from the calling thread instead.
+size_t trace_buffer_size = 4 * 1024 * 1024;
+char*  trace_active;
+size_t trace_active_used;
+char*  trace_flush;
+size_t trace_flush_used;
+bool   trace_flush_pending;
+bool   trace_flush_exit;
+bool   trace_async_flush = true;
+std::mutex trace_flush_lock;
+std::condition_variable trace_flush_cond;
+std::thread* trace_flush_thread;
+
+// SIRIUS_TRACE_FORMAT=2 writes timestamps as deltas, see siriusglobals.h
+int trace_format = 1;
+uint64_t load_library_ns;
+uint64_t prev_time_ns;
+
 #ifdef __MACH__
 clock_serv_t the_clock;
 #endif
@@ -54,6 +81,18 @@ inline double get_time() {
 	return dbl_now;
 }
 
+inline uint64_t get_time_ns() {
+	#ifdef __MACH__
+		mach_timespec_t now;
+		clock_get_time(the_clock, &now);
+	#else
+		struct timespec now;
+		clock_gettime(CLOCK_MONOTONIC, &now);
+	#endif
+
+	return ((uint64_t) now.tv_sec * 1000000000ULL) + (uint64_t) now.tv_nsec;
+}
+
 __attribute__((constructor)) void init_sirius() {
 	// Do special clock initialization if we are on a Mac
 #ifdef __MACH__
@@ -63,27 +102,148 @@ __attribute__((constructor)) void init_sirius() {
 	sirius_rank = 0;
 	sirius_npes = 1;
 	load_library = get_time();
+	load_library_ns = get_time_ns();
 }
 
 __attribute__((destructor))  void fini_sirius() {
 
 }
 
+void flushTraceLoop() {
+	std::unique_lock<std::mutex> lock(trace_flush_lock);
+
+	while(true) {
+		trace_flush_cond.wait(lock, [] { return trace_flush_pending || trace_flush_exit; });
+
+		if(trace_flush_pending) {
+			lock.unlock();
+			fwrite(trace_flush, 1, trace_flush_used, trace_dump);
+			lock.lock();
+
+			trace_flush_pending = false;
+			trace_flush_cond.notify_all();
+		} else {
+			break;
+		}
+	}
+}
+
+void openTraceBuffers() {
+	char* checkBufferEnv = getenv("SIRIUS_BUFFER_SIZE");
+	if(NULL != checkBufferEnv && atol(checkBufferEnv) > 0) {
+		trace_buffer_size = (size_t) atol(checkBufferEnv);
+	}
+
+	char* checkAsyncEnv = getenv("SIRIUS_ASYNC_FLUSH");
+	if(NULL != checkAsyncEnv) {
+		trace_async_flush = (0 != atoi(checkAsyncEnv));
+	}
+
+	trace_active = (char*) malloc(trace_buffer_size);
+	trace_active_used = 0;
+	trace_flush = (char*) malloc(trace_buffer_size);
+	trace_flush_used = 0;
+	trace_flush_pending = false;
+	trace_flush_exit = false;
+
+	if(NULL == trace_active || NULL == trace_flush) {
+		fprintf(stderr, "Error: unable to allocate SIRIUS trace buffers of %" PRIu64 " bytes.\n",
+			(uint64_t) trace_buffer_size);
+		PMPI_Abort(MPI_COMM_WORLD, 8);
+	}
+
+	if(trace_async_flush) {
+		trace_flush_thread = new std::thread(flushTraceLoop);
+	}
+}
+
+void swapTraceBuffers() {
+	if(! trace_async_flush) {
+		fwrite(trace_active, 1, trace_active_used, trace_dump);
+		trace_active_used = 0;
+		return;
+	}
+
+	std::unique_lock<std::mutex> lock(trace_flush_lock);
+	trace_flush_cond.wait(lock, [] { return ! trace_flush_pending; });
+
+	std::swap(trace_active, trace_flush);
+	trace_flush_used = trace_active_used;
+	trace_active_used = 0;
+
+	trace_flush_pending = true;
+	trace_flush_cond.notify_all();
+}
+
+void closeTraceBuffers() {
+	if(trace_active_used > 0) {
+		swapTraceBuffers();
+	}
+
+	if(trace_async_flush) {
+		{
+			std::lock_guard<std::mutex> lock(trace_flush_lock);
+			trace_flush_exit = true;
+			trace_flush_cond.notify_all();
+		}
+
+		trace_flush_thread->join();
+		delete trace_flush_thread;
+		trace_flush_thread = NULL;
+	}
+
+	free(trace_active);
+	free(trace_flush);
+	trace_active = NULL;
+	trace_flush = NULL;
+}
+
+inline void appendTrace(const void* value, const size_t len) {
+	if(trace_active_used + len > trace_buffer_size) {
+		swapTraceBuffers();
+	}
+
+	memcpy(trace_active + trace_active_used, value, len);
+	trace_active_used += len;
+}
+
 void printTime() {
-	double dbl_now = get_time();
-	fwrite(&dbl_now, 1, sizeof(double), trace_dump);
+	if(2 == trace_format) {
+		const uint64_t ns_now = get_time_ns() - load_library_ns;
+		uint64_t delta = (ns_now > prev_time_ns) ? (ns_now - prev_time_ns) : 0;
+		prev_time_ns += delta;
+
+		uint8_t encoded[10];
+		size_t encoded_len = 0;
+
+		do {
+			encoded[encoded_len] = (uint8_t) (delta & 0x7F);
+			delta >>= 7;
+
+			if(delta != 0) {
+				encoded[encoded_len] |= 0x80;
+			}
+
+			encoded_len++;
+		} while(delta != 0);
+
+		appendTrace(encoded, encoded_len);
+	} else {
+		double dbl_now = get_time();
+		appendTrace(&dbl_now, sizeof(double));
+	}
 }
 
 void printUINT32(uint32_t value) {
-	fwrite(&value, 1, sizeof(uint32_t), trace_dump);
+	appendTrace(&value, sizeof(uint32_t));
 }
 
 void printUINT64(uint64_t value) {
-	fwrite(&value, 1, sizeof(uint64_t), trace_dump);
+	appendTrace(&value, sizeof(uint64_t));
 }
 
 void printINT32(int32_t value) {
-	fwrite(&value, 1, sizeof(int32_t), trace_dump);
+	appendTrace(&value, sizeof(int32_t));
 }
 
 void printMPIOp(MPI_Op op) {
@@ -198,6 +358,20 @@ extern "C" int MPI_Init(int* argc, char** argv[]) {
 
 	trace_dump = fopen(buffer, "wb");
 
+	if(NULL == trace_dump) {
+		fprintf(stderr, "Error: unable to open SIRIUS trace file: %s\n", buffer);
+		PMPI_Abort(MPI_COMM_WORLD, 8);
+	}
+
+	openTraceBuffers();
+
+	char* checkFormatEnv = getenv("SIRIUS_TRACE_FORMAT");
+	if(NULL != checkFormatEnv && 2 == atoi(checkFormatEnv)) {
+		trace_format = 2;
+		prev_time_ns = 0;
+		printUINT32((uint32_t) SIRIUS_TRACE_V2_MAGIC);
+	}
+
 	printUINT32((uint32_t) SIRIUS_MPI_INIT);
 	printTime();
 
@@ -302,6 +476,7 @@ extern "C" int MPI_Finalize() {
 	printTime();
 	printINT32((int32_t) result);
 
+	closeTraceBuffers();
 	fclose(trace_dump);
 
 	return result;
@@ -87,6 +87,10 @@ class EmberEP( EndPoint ):
             #print (nodeID,  "use detailed")
             built = self.detailedModel.build( nodeID, self.numCores )
 
+        # a local heap is shared by the node's cores directly, with no
+        # MemoryHeap component or links
+        localHeap = int(self.driverParams.get("hermesParams.memoryHeapLink.local", 0))
+
         memory = None
         if built:
             if self.nicParams["useSimpleMemoryModel"] == 0 :
@@ -104,9 +108,10 @@ class EmberEP( EndPoint ):
                 memIF.addParam("port","detailed")
                 memIF.addLink( self.detailedModel.getNicLink( ), "detailed", "1ps" )
 
-            memory = sst.Component("memory" + str(nodeID), "thornhill.MemoryHeap")
-            memory.addParam( "nid", nodeID )
-            #memory.addParam( "verboseLevel", 1 )
+            if not localHeap:
+                memory = sst.Component("memory" + str(nodeID), "thornhill.MemoryHeap")
+                memory.addParam( "nid", nodeID )
+                #memory.addParam( "verboseLevel", 1 )
 
         loopBackName = "loopBack" + str(nodeID//self.nicsPerNode)        
         if nodeID % self.nicsPerNode == 0:
@@ -212,10 +217,13 @@ class EmberEP( EndPoint ):
             loopLink.connect( (process,'loop','1ns' ),(loopBack,'nic'+str(nodeID%self.nicsPerNode)+'core'+str(x),'1ns'))
 
             if built:
-                memoryLink = sst.Link( "memory" + str(nodeID) + "core" + str(x) + "_Link"  )
-                memoryLink.setNoCut()
-
                 ml = os.setSubComponent( "memoryHeap", "thornhill.MemoryHeapLink" )
-                memoryLink.connect( (memory,"detailed" + str(x), "0 ns" ),(ml,"memoryHeap", "0 ps"))
+                if localHeap:
+                    ml.addParam( "local", 1 )
+                    ml.addParam( "nid", nodeID )
+                else:
+                    memoryLink = sst.Link( "memory" + str(nodeID) + "core" + str(x) + "_Link"  )
+                    memoryLink.setNoCut()
+                    memoryLink.connect( (memory,"detailed" + str(x), "0 ns" ),(ml,"memoryHeap", "0 ps"))
 
         return retval
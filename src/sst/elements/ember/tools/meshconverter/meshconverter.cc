@@ -19,12 +19,19 @@
 #include <string.h>
 #include <inttypes.h>
 #include <map>
+#include <vector>
+#include <algorithm>
+
+// Must match EMBER_AMR_OWNER_TABLE_MAGIC in ember3damrbinaryfile.h
+#define MESH_OWNER_TABLE_MAGIC 0x4f524d41
 
 void usage() {
 	printf("Usage: meshconverter <number ranks> <file in> <file out>\n");
 	printf("<no ranks>       Is the number of ranks represented by the mesh\n");
 	printf("<file in>        Is the input mesh definition in text\n");
 	printf("<file out>       Is the output mesh definition to be written in binary\n");
+	printf("\nThe output is followed by a table of block owners sorted by block ID, so a\n");
+	printf("rank can find the owners of its neighbours without reading every rank's blocks.\n");
 	exit(-1);
 }
 
@@ -139,6 +146,9 @@ int main(int argc, char* argv[]) {
 	int8_t  blockZDown = 0;
 	int8_t  blockZUp = 0;
 
+	std::vector< std::pair<uint32_t, uint32_t> > blockOwners;
+	blockOwners.reserve(blockCount);
+
 	for(uint32_t i = 0; i < rankCount; i++) {
 		printf("Processing rank %" PRIu32 "...\n", i);
 
@@ -165,6 +175,8 @@ int main(int argc, char* argv[]) {
 				&blockZDown,
 				&blockZUp);
 
+			blockOwners.push_back(std::pair<uint32_t, uint32_t>(nextBlockID, i));
+
 			fwrite(&nextBlockID, sizeof(nextBlockID), 1, outMesh);
 			nextFileIndex += sizeof(nextBlockID);
 
@@ -184,6 +196,34 @@ int main(int argc, char* argv[]) {
 		}
 	}
 
+	std::sort(blockOwners.begin(), blockOwners.end());
+
+	for(size_t i = 1; i < blockOwners.size(); i++) {
+		if(blockOwners[i].first == blockOwners[i - 1].first) {
+			fprintf(stderr, "Block %" PRIu32 " is listed on rank %" PRIu32 " and rank %" PRIu32 "\n",
+				blockOwners[i].first, blockOwners[i - 1].second, blockOwners[i].second);
+			exit(-1);
+		}
+	}
+
+	if(blockOwners.size() != blockCount) {
+		fprintf(stderr, "Mesh header gives %" PRIu32 " blocks but %" PRIu64 " were read, not writing an owner table\n",
+			blockCount, (uint64_t) blockOwners.size());
+	} else {
+		const uint64_t ownerTableIndex = nextFileIndex;
+		const uint32_t ownerTableMagic = MESH_OWNER_TABLE_MAGIC;
+
+		printf("Generating block owner table at index: %" PRIu64 "\n", ownerTableIndex);
+
+		for(size_t i = 0; i < blockOwners.size(); i++) {
+			fwrite(&blockOwners[i].first, sizeof(uint32_t), 1, outMesh);
+			fwrite(&blockOwners[i].second, sizeof(uint32_t), 1, outMesh);
+		}
+
+		fwrite(&ownerTableIndex, sizeof(ownerTableIndex), 1, outMesh);
+		fwrite(&ownerTableMagic, sizeof(ownerTableMagic), 1, outMesh);
+	}
+
 	fclose(inMesh);
 	fclose(outMesh);
 
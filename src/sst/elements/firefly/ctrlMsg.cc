@@ -94,7 +94,7 @@ void API::initMsgPassing() {
 	m_processQueuesState->enterInit((m_memHeapLink));
 }
 
-static size_t calcLength( std::vector<IoVec>& ioVec )
+static size_t calcLength( IoVecList& ioVec )
 {
     size_t len = 0;
     for ( size_t i = 0; i < ioVec.size(); i++ ) {
@@ -103,7 +103,7 @@ static size_t calcLength( std::vector<IoVec>& ioVec )
     return len;
 }
 
-void API::sendv_common( std::vector<IoVec>& ioVec,
+void API::sendv_common( IoVecList& ioVec,
     MP::PayloadDataType dtype, MP::RankID dest, uint32_t tag,
     MP::Communicator group, CommReq* commReq, int vn )
 {
@@ -125,7 +125,7 @@ void API::sendv_common( std::vector<IoVec>& ioVec,
 
 void API::send( const Hermes::MemAddr& addr, size_t len, nid_t dest, uint64_t tag, int vn )
 {
-    std::vector<IoVec> ioVec(1);
+    IoVecList ioVec(1);
     ioVec[0].addr = addr;
     ioVec[0].len = len;
 
@@ -136,7 +136,7 @@ void API::send( const Hermes::MemAddr& addr, size_t len, nid_t dest, uint64_t ta
 void API::send( const Hermes::MemAddr& addr, size_t len, MP::RankID dest, uint64_t tag,
                         MP::Communicator grp, int vn )
 {
-    std::vector<IoVec> ioVec(1);
+    IoVecList ioVec(1);
     ioVec[0].addr = addr;
     ioVec[0].len = len;
 
@@ -151,7 +151,7 @@ void API::isend( void* ptr, size_t len, nid_t dest, uint64_t tag, MP::Communicat
 
 void API::isend( const Hermes::MemAddr& addr, size_t len, nid_t dest, uint64_t tag, CommReq* req, int vn)
 {
-    std::vector<IoVec> ioVec(1);
+    IoVecList ioVec(1);
     ioVec[0].addr = addr;
     ioVec[0].len = len;
 
@@ -162,7 +162,7 @@ void API::isend( const Hermes::MemAddr& addr, size_t len, nid_t dest, uint64_t t
 void API::isend( const Hermes::MemAddr& addr, size_t len, nid_t dest, uint64_t tag,
 				MP::Communicator group, CommReq* req, int vn )
 {
-    std::vector<IoVec> ioVec(1);
+    IoVecList ioVec(1);
     ioVec[0].addr = addr;
     ioVec[0].len = len;
 
@@ -170,17 +170,17 @@ void API::isend( const Hermes::MemAddr& addr, size_t len, nid_t dest, uint64_t t
     sendv_common( ioVec, MP::CHAR, dest, tag, group, req, vn );
 }
 
-void API::sendv(std::vector<IoVec>& ioVec, nid_t dest, uint64_t tag, int vn )
+void API::sendv(IoVecList& ioVec, nid_t dest, uint64_t tag, int vn )
 {
     sendv_common( ioVec, MP::CHAR, dest, tag, MP::GroupWorld, NULL, vn );
 }
 
-void API::isendv(std::vector<IoVec>& ioVec, nid_t dest, uint64_t tag, MP::Communicator group, CommReq* req, int vn )
+void API::isendv(IoVecList& ioVec, nid_t dest, uint64_t tag, MP::Communicator group, CommReq* req, int vn )
 {
     sendv_common( ioVec, MP::CHAR, dest, tag, group, req, vn );
 }
 
-void API::recvv_common( std::vector<IoVec>& ioVec,
+void API::recvv_common( IoVecList& ioVec,
     MP::PayloadDataType dtype, MP::RankID src, uint32_t tag,
     MP::Communicator group, CommReq* commReq )
 {
@@ -202,7 +202,7 @@ void API::recvv_common( std::vector<IoVec>& ioVec,
 
 void API::recv( const Hermes::MemAddr& addr, size_t len, nid_t src, uint64_t tag )
 {
-    std::vector<IoVec> ioVec(1);
+    IoVecList ioVec(1);
     ioVec[0].addr = addr;
     ioVec[0].len = len;
     recvv_common( ioVec, MP::CHAR, src, tag, MP::GroupWorld, NULL );
@@ -217,7 +217,7 @@ void API::recv( void* ptr, size_t len, nid_t src, uint64_t tag, MP::Communicator
 void API::recv( const Hermes::MemAddr& addr, size_t len, nid_t src, uint64_t tag,
 			MP::Communicator group)
 {
-    std::vector<IoVec> ioVec(1);
+    IoVecList ioVec(1);
     ioVec[0].addr = addr;
     ioVec[0].len = len;
     recvv_common( ioVec, MP::CHAR, src, tag, group, NULL );
@@ -226,7 +226,7 @@ void API::recv( const Hermes::MemAddr& addr, size_t len, nid_t src, uint64_t tag
 
 void API::irecv( const Hermes::MemAddr& addr, size_t len, nid_t src, uint64_t tag, CommReq* req )
 {
-    std::vector<IoVec> ioVec(1);
+    IoVecList ioVec(1);
     ioVec[0].addr = addr;
     ioVec[0].len = len;
 
@@ -237,20 +237,20 @@ void API::irecv( const Hermes::MemAddr& addr, size_t len, nid_t src, uint64_t ta
 void API::irecv( const Hermes::MemAddr& addr, size_t len, MP::RankID src, uint64_t tag,
                                     MP::Communicator grp, CommReq* req )
 {
-    std::vector<IoVec> ioVec(1);
+    IoVecList ioVec(1);
     ioVec[0].addr = addr;
     ioVec[0].len = len;
     assert(req);
     recvv_common( ioVec, MP::CHAR, src, tag, grp, req );
 }
 
-void API::irecvv(std::vector<IoVec>& ioVec, nid_t src, uint64_t tag,
+void API::irecvv(IoVecList& ioVec, nid_t src, uint64_t tag,
                             CommReq* req  )
 {
     recvv_common( ioVec, MP::CHAR, src, tag, MP::GroupWorld, req );
 }
 
-void API::irecvv(std::vector<IoVec>& ioVec, nid_t src, uint64_t tag,
+void API::irecvv(IoVecList& ioVec, nid_t src, uint64_t tag,
                             MP::Communicator grp, CommReq* req  )
 {
     recvv_common( ioVec, MP::CHAR, src, tag, grp, req );
@@ -93,16 +93,16 @@ class API : public ProtocolAPI {
     void isend( const Hermes::MemAddr&, size_t len, nid_t dest, uint64_t tag,
 							MP::Communicator, CommReq*, int vn = 0 );
     void isend( void*, size_t len, nid_t dest, uint64_t tag, MP::Communicator, CommReq*, int vn = 0 );
-    void sendv( std::vector<IoVec>&, nid_t dest, uint64_t tag, int vn = 0 );
-    void isendv( std::vector<IoVec>&, nid_t dest, uint64_t tag, MP::Communicator, CommReq*, int vn = 0 );
+    void sendv( IoVecList&, nid_t dest, uint64_t tag, int vn = 0 );
+    void isendv( IoVecList&, nid_t dest, uint64_t tag, MP::Communicator, CommReq*, int vn = 0 );
     void recv( const Hermes::MemAddr&, size_t len, nid_t src, uint64_t tag );
     void recv( const Hermes::MemAddr&, size_t len, nid_t src, uint64_t tag, MP::Communicator grp );
     void recv( void*, size_t len, nid_t src, uint64_t tag, MP::Communicator grp );
     void irecv( const Hermes::MemAddr&, size_t len, nid_t src, uint64_t tag, CommReq* );
     void irecv( const Hermes::MemAddr&, size_t len, MP::RankID src, uint64_t tag,
                 MP::Communicator grp, CommReq* );
-    void irecvv( std::vector<IoVec>&, nid_t src, uint64_t tag, CommReq* );
-    void irecvv( std::vector<IoVec>&, nid_t src, uint64_t tag, MP::Communicator grp, CommReq* );
+    void irecvv( IoVecList&, nid_t src, uint64_t tag, CommReq* );
+    void irecvv( IoVecList&, nid_t src, uint64_t tag, MP::Communicator grp, CommReq* );
     void wait( CommReq* );
     void waitAll( std::vector<CommReq*>& );
     void waitAll( std::vector<CommReq>& );
@@ -134,10 +134,10 @@ class API : public ProtocolAPI {
                 MP::MessageResponse* resp[] );
 
   private:
-    void sendv_common( std::vector<IoVec>& ioVec,
+    void sendv_common( IoVecList& ioVec,
             MP::PayloadDataType dtype, MP::RankID dest, uint32_t tag,
             MP::Communicator group, CommReq* commReq, int vn = 0 );
-    void recvv_common( std::vector<IoVec>& ioVec,
+    void recvv_common( IoVecList& ioVec,
     MP::PayloadDataType dtype, MP::RankID src, uint32_t tag,
     MP::Communicator group, CommReq* commReq );
 
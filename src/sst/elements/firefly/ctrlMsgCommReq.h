@@ -46,7 +46,7 @@ class _CommReq : public MP::MessageRequestBase {
 
     enum Type { Recv, Send, Isend, Irecv };
 
-    _CommReq( Type type, std::vector<IoVec>& _ioVec,
+    _CommReq( Type type, IoVecList& _ioVec,
         unsigned int dtypeSize, MP::RankID rank, uint32_t tag,
         MP::Communicator group, int vn ) :
         m_type( type ),
@@ -116,7 +116,7 @@ class _CommReq : public MP::MessageRequestBase {
 
     MatchHdr& hdr() { return m_hdr; }
 
-    std::vector<IoVec>& ioVec() {
+    IoVecList& ioVec() {
         assert( ! m_ioVec.empty() );
         return m_ioVec;
     }
@@ -176,7 +176,7 @@ class _CommReq : public MP::MessageRequestBase {
 
     MatchHdr            m_hdr;
     Type                m_type;
-    std::vector<IoVec>  m_ioVec;
+    IoVecList  m_ioVec;
     MP::MessageResponse* m_resp;
     bool                m_done;
     MP::RankID      m_destRank;
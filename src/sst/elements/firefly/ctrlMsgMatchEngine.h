@@ -0,0 +1,232 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef COMPONENTS_FIREFLY_CTRLMSGMATCHENGINE_H
+#define COMPONENTS_FIREFLY_CTRLMSGMATCHENGINE_H
+
+#include <stdint.h>
+#include <algorithm>
+#include <deque>
+#include <unordered_map>
+#include <vector>
+
+#include "ctrlMsg.h"
+#include "ctrlMsgCommReq.h"
+
+namespace SST {
+namespace Firefly {
+namespace CtrlMsg {
+
+// The posted receive queue. Receives for an exact (group, rank, tag) sit in
+// a bin for that key, receives with a wildcard rank or tag sit in one list.
+// A message matches the oldest receive it can across its bin and the
+// wildcard list, which is the receive a scan of a single list in post order
+// would find, so MPI ordering is kept.
+//
+// A Fenwick tree over the post order counts the receives ahead of the match,
+// which is what the single list scan cost, so a linear search can still be
+// charged in simulated time without doing it on the host.
+class PostedRecvQueue {
+
+    struct Entry {
+        Entry( uint64_t seq, _CommReq* req ) : seq( seq ), req( req ) {}
+        uint64_t    seq;
+        _CommReq*   req;
+    };
+
+    struct Key {
+        Key( MP::Communicator group, MP::RankID rank, uint64_t tag ) :
+            group( group ), rank( rank ), tag( tag ) {}
+        bool operator==( const Key& other ) const {
+            return group == other.group && rank == other.rank && tag == other.tag;
+        }
+        MP::Communicator    group;
+        MP::RankID          rank;
+        uint64_t            tag;
+    };
+
+    struct KeyHash {
+        size_t operator()( const Key& key ) const {
+            uint64_t hash = key.tag * 0x9e3779b97f4a7c15ULL;
+            hash ^= ( (uint64_t) key.rank << 32 | key.group ) + 0x632be59bd9b4e019ULL + ( hash << 6 ) + ( hash >> 2 );
+            return hash;
+        }
+    };
+
+    typedef std::deque< Entry > Bin;
+
+  public:
+    PostedRecvQueue() : m_nextSeq( 0 ), m_size( 0 ), m_tree( MinTreeSize + 1, 0 ) {}
+
+    size_t size() const { return m_size; }
+    bool empty() const { return 0 == m_size; }
+
+    void push_back( _CommReq* req ) {
+        if ( m_nextSeq + 1 == m_tree.size() ) {
+            renumber();
+        }
+
+        Entry entry( m_nextSeq++, req );
+        if ( isWild( req ) ) {
+            m_wild.push_back( entry );
+        } else {
+            m_bins[ Key( req->hdr().group, req->hdr().rank, req->hdr().tag ) ].push_back( entry );
+        }
+
+        treeAdd( entry.seq, 1 );
+        ++m_size;
+    }
+
+    // Remove and return the oldest receive 'matches' accepts for hdr, NULL
+    // if there is none. position is the place of the match in post order,
+    // or the number of receives when nothing matches; examined is the
+    // number of receives the match engine looked at.
+    template< class Match >
+    _CommReq* match( MatchHdr& hdr, Match matches, int& position, int& examined ) {
+        Bin* bestBin = NULL;
+        Bin::iterator best;
+
+        examined = 0;
+
+        auto bin = m_bins.find( Key( hdr.group, hdr.rank, hdr.tag ) );
+        if ( bin != m_bins.end() ) {
+            for ( Bin::iterator iter = bin->second.begin(); iter != bin->second.end(); ++iter ) {
+                ++examined;
+                if ( matches( hdr, iter->req ) ) {
+                    bestBin = &bin->second;
+                    best = iter;
+                    break;
+                }
+            }
+        }
+
+        // only a wildcard receive posted before the bin's match can take the message
+        for ( Bin::iterator iter = m_wild.begin(); iter != m_wild.end(); ++iter ) {
+            if ( bestBin && iter->seq > best->seq ) {
+                break;
+            }
+            ++examined;
+            if ( matches( hdr, iter->req ) ) {
+                bestBin = &m_wild;
+                best = iter;
+                break;
+            }
+        }
+
+        if ( NULL == bestBin ) {
+            position = m_size;
+            return NULL;
+        }
+
+        _CommReq* req = best->req;
+        position = treeCount( best->seq );
+        erase( bestBin, best );
+
+        if ( bestBin != &m_wild && bestBin->empty() ) {
+            m_bins.erase( bin );
+        }
+
+        return req;
+    }
+
+    // Remove a receive wherever it is, false if it is not posted
+    bool remove( MP::MessageRequest req ) {
+        for ( Bin::iterator iter = m_wild.begin(); iter != m_wild.end(); ++iter ) {
+            if ( iter->req == req ) {
+                erase( &m_wild, iter );
+                return true;
+            }
+        }
+
+        for ( auto bin = m_bins.begin(); bin != m_bins.end(); ++bin ) {
+            for ( Bin::iterator iter = bin->second.begin(); iter != bin->second.end(); ++iter ) {
+                if ( iter->req == req ) {
+                    erase( &bin->second, iter );
+                    if ( bin->second.empty() ) {
+                        m_bins.erase( bin );
+                    }
+                    return true;
+                }
+            }
+        }
+
+        return false;
+    }
+
+  private:
+    static const size_t MinTreeSize = 1024;
+
+    static bool isWild( _CommReq* req ) {
+        return AnyTag == req->hdr().tag || MP::AnySrc == req->hdr().rank || req->ignore();
+    }
+
+    void erase( Bin* bin, Bin::iterator iter ) {
+        treeAdd( iter->seq, -1 );
+        bin->erase( iter );
+        --m_size;
+    }
+
+    void treeAdd( uint64_t seq, int delta ) {
+        for ( size_t i = seq + 1; i < m_tree.size(); i += i & -i ) {
+            m_tree[i] += delta;
+        }
+    }
+
+    // receives posted at or before seq that are still posted
+    int treeCount( uint64_t seq ) const {
+        int count = 0;
+        for ( size_t i = seq + 1; i > 0; i -= i & -i ) {
+            count += m_tree[i];
+        }
+        return count;
+    }
+
+    // The sequence numbers ran out, number the posted receives from zero
+    // again in the same order and size the tree for twice as many
+    void renumber() {
+        std::vector< Entry* > entries;
+        entries.reserve( m_size );
+        for ( Bin::iterator iter = m_wild.begin(); iter != m_wild.end(); ++iter ) {
+            entries.push_back( &*iter );
+        }
+        for ( auto bin = m_bins.begin(); bin != m_bins.end(); ++bin ) {
+            for ( Bin::iterator iter = bin->second.begin(); iter != bin->second.end(); ++iter ) {
+                entries.push_back( &*iter );
+            }
+        }
+
+        std::sort( entries.begin(), entries.end(),
+            []( const Entry* a, const Entry* b ) { return a->seq < b->seq; } );
+
+        m_tree.assign( std::max( MinTreeSize, 2 * ( m_size + 1 ) ) + 1, 0 );
+        for ( m_nextSeq = 0; m_nextSeq < entries.size(); ++m_nextSeq ) {
+            entries[m_nextSeq]->seq = m_nextSeq;
+            treeAdd( m_nextSeq, 1 );
+        }
+    }
+
+    uint64_t    m_nextSeq;
+    size_t      m_size;
+
+    std::unordered_map< Key, Bin, KeyHash > m_bins;
+    Bin                                     m_wild;
+    std::vector< int >                      m_tree;
+};
+
+}
+}
+}
+
+#endif
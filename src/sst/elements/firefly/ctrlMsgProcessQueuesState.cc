@@ -50,6 +50,24 @@ ProcessQueuesState::ProcessQueuesState( ComponentId_t id, Params& params ) :
 
     m_dbg.init("", level, mask, Output::STDOUT );
 
+    std::string matchCost = params.find<std::string>("pqs.matchCost","linear");
+    if ( matchCost == "linear" ) {
+        m_hashedMatchCost = false;
+    } else if ( matchCost == "hashed" ) {
+        m_hashedMatchCost = true;
+    } else {
+        m_dbg.fatal(CALL_INFO,-1,"unknown pqs.matchCost %s, must be linear or hashed\n", matchCost.c_str() );
+    }
+
+    std::string payloadMode = params.find<std::string>("pqs.payloadMode","data");
+    if ( payloadMode == "data" ) {
+        m_timingPayload = false;
+    } else if ( payloadMode == "timing" ) {
+        m_timingPayload = true;
+    } else {
+        m_dbg.fatal(CALL_INFO,-1,"unknown pqs.payloadMode %s, must be data or timing\n", payloadMode.c_str() );
+    }
+
     m_statPstdRcv = registerStatistic<uint64_t>("posted_receive_list");
     m_statRcvdMsg = registerStatistic<uint64_t>("received_msg_list");
 
@@ -200,7 +218,7 @@ void ProcessQueuesState::processSend_2( _CommReq* req )
         hdrVec.addr.setBacking( &req->hdr() );
     }
 
-    std::vector<IoVec> vec;
+    IoVecList vec;
     vec.insert( vec.begin(), hdrVec );
 
     nid_t nid = calcNid( req, req->getDestRank() );
@@ -211,7 +229,7 @@ void ProcessQueuesState::processSend_2( _CommReq* req )
 			size_t len = req->ioVec()[i].len;
 			MemAddr& addr =	req->ioVec()[i].addr;
 			void* backing = NULL;
-			if ( addr.getBacking() ) {
+			if ( addr.getBacking() && ! m_timingPayload ) {
 				backing = malloc( len );
 				memcpy( backing, addr.getBacking(), len );
 			}
@@ -229,7 +247,7 @@ void ProcessQueuesState::processSend_2( _CommReq* req )
 
         info->req = req;
 
-        std::vector<IoVec> hdrVec;
+        IoVecList hdrVec;
         hdrVec.resize(1);
         hdrVec[0].len = sizeof( info->hdr );
         hdrVec[0].addr.setSimVAddr( m_simVAddrs->alloc( hdrVec[0].len ) );
@@ -244,7 +262,12 @@ void ProcessQueuesState::processSend_2( _CommReq* req )
         );
 
         m_nic->dmaRecv( nid, req->hdr().key, hdrVec, callback );
-        m_nic->regMem( nid, req->hdr().key, req->ioVec(), NULL );
+        if ( m_timingPayload ) {
+            IoVecList vec = timingIoVec( req->ioVec() );
+            m_nic->regMem( nid, req->hdr().key, vec, NULL );
+        } else {
+            m_nic->regMem( nid, req->hdr().key, req->ioVec(), NULL );
+        }
         vn = m_rendezvousVN;
     }
 
@@ -269,7 +292,7 @@ void ProcessQueuesState::processSendLoop( _CommReq* req )
     hdrVec.addr.setSimVAddr( 1 ); //m_simVAddrs->alloc( hdrVec.len );
     hdrVec.addr.setBacking( &req->hdr() );
 
-    std::vector<IoVec> vec;
+    IoVecList vec;
     vec.insert( vec.begin(), hdrVec );
     vec.insert( vec.begin() + 1, req->ioVec().begin(),
                                         req->ioVec().end() );
@@ -408,15 +431,9 @@ void ProcessQueuesState::processMakeProgress( Stack* stack )
 
 void ProcessQueuesState::enterCancel( MP::MessageRequest req, uint64_t exitDelay ) {
 
-    std::deque< _CommReq* >:: iterator iter = m_pstdRcvQ.begin();
-    for ( ; iter != m_pstdRcvQ.end(); ++iter ) {
-
-		if ( *iter == req ) {
-    		dbg().debug(CALL_INFO,2,DBG_MSK_PQS_Q,"found req=%p\n",*iter);
-			delete( *iter );
-        	m_pstdRcvQ.erase(iter);
-			break;
-		}
+    if ( m_pstdRcvQ.remove( req ) ) {
+    	dbg().debug(CALL_INFO,2,DBG_MSK_PQS_Q,"found req=%p\n",req);
+		delete( req );
     }
     enterMakeProgress(m_exitDelay);
 }
@@ -627,6 +644,11 @@ void ProcessQueuesState::processShortList_1( Stack* stack )
 
     int count = 0;
     if ( m_intStack.empty() ) {
+        if ( m_hashedMatchCost ) {
+            // a hashed match engine goes straight to the message, don't walk the queue to it
+            _CommReq* req = m_pstdRcvPreQ.front();
+            ctx->seek( [&]( Msg* msg ) { return checkMatchHdr( msg->hdr(), req->hdr(), req->ignore() ); } );
+        }
         ctx->req = searchPostedRecv( m_pstdRcvPreQ, ctx->hdr(), count );
     } else {
         ctx->req = searchPostedRecv( m_pstdRcvQ, ctx->hdr(), count );
@@ -673,9 +695,14 @@ void ProcessQueuesState::processShortList_3( Stack* stack )
 
     size_t length = ctx->hdr().count * ctx->hdr().dtypeSize;
 
-    if ( length <= shortMsgLength() ||
-                            dynamic_cast<LoopReq*>( ctx->msg() ) )
-    {
+    LoopReq* loopReq = dynamic_cast<LoopReq*>( ctx->msg() );
+    if ( loopReq && loopReq->copied ) {
+        dbg().debug(CALL_INFO,2,DBG_MSK_PQS_Q,"copyIoVec() loop message, copy time charged by the loopBack\n");
+
+        copyIoVec( req->ioVec(), ctx->ioVec(), length );
+        processShortList_4( stack );
+
+    } else if ( length <= shortMsgLength() || loopReq ) {
         dbg().debug(CALL_INFO,2,DBG_MSK_PQS_Q,"copyIoVec() short|loop message\n");
 
         copyIoVec( req->ioVec(), ctx->ioVec(), length );
@@ -932,7 +959,7 @@ void ProcessQueuesState::processLongGetFini0( Stack* stack )
     *callback = std::bind(
                 &ProcessQueuesState::pioSendFiniCtrlHdr, this, hdr, hdrVec.addr.getSimVAddr() );
 
-    std::vector<IoVec> vec;
+    IoVecList vec;
     vec.insert( vec.begin(), hdrVec );
 
     dbg().debug(CALL_INFO,1,DBG_MSK_PQS_CB,"send long msg Ack to nid=%d key=%#x\n",
@@ -970,7 +997,7 @@ void ProcessQueuesState::loopHandler( int srcCore, void* key )
     runInterruptCtx();
 }
 
-void ProcessQueuesState::loopHandler( int srcCore, std::vector<IoVec>& vec, void* key )
+void ProcessQueuesState::loopHandler( int srcCore, IoVecList& vec, void* key, bool copied )
 {
 
     MatchHdr* hdr = (MatchHdr*) vec[0].addr.getBacking();
@@ -979,7 +1006,7 @@ void ProcessQueuesState::loopHandler( int srcCore, std::vector<IoVec>& vec, void
                                                     srcCore, key, vec.size(), hdr->rank);
 
     ++m_numRecvLooped;
-    m_recvdMsgQ[m_recvdMsgQpos].push_back( new LoopReq( srcCore, vec, key ) );
+    m_recvdMsgQ[m_recvdMsgQpos].push_back( new LoopReq( srcCore, vec, key, copied ) );
     m_statRcvdMsg->addData( m_recvdMsgQ.size() );
 
     runInterruptCtx();
@@ -1007,6 +1034,23 @@ _CommReq* ProcessQueuesState::searchPostedRecv( std::deque< _CommReq* >& pstd, M
     return req;
 }
 
+_CommReq* ProcessQueuesState::searchPostedRecv( PostedRecvQueue& pstd, MatchHdr& hdr, int& count )
+{
+    dbg().debug(CALL_INFO,2,DBG_MSK_PQS_Q,"posted size %lu\n",pstd.size());
+
+    int position;
+    int examined;
+    _CommReq* req = pstd.match( hdr,
+        [this]( MatchHdr& hdr, _CommReq* req ) { return checkMatchHdr( hdr, req->hdr(), req->ignore() ); },
+        position, examined );
+
+    // the simulated cost follows pqs.matchCost, not the work done here to find the match
+    count += m_hashedMatchCost ? 1 + examined : position;
+    dbg().debug(CALL_INFO,2,DBG_MSK_PQS_Q,"req=%p position=%d examined=%d\n",req,position,examined);
+
+    return req;
+}
+
 bool ProcessQueuesState::checkMatchHdr( MatchHdr& hdr, MatchHdr& wantHdr,
                                     uint64_t ignore )
 {
@@ -1042,14 +1086,29 @@ bool ProcessQueuesState::checkMatchHdr( MatchHdr& hdr, MatchHdr& wantHdr,
     return true;
 }
 
+IoVecList ProcessQueuesState::timingIoVec( IoVecList& ioVec )
+{
+    IoVecList vec;
+    for ( unsigned int i = 0; i < ioVec.size(); i++ ) {
+        vec.push_back( IoVec( MemAddr( ioVec[i].addr.getSimVAddr(), NULL ), ioVec[i].len ) );
+    }
+    return vec;
+}
+
 void ProcessQueuesState::copyIoVec(
-                std::vector<IoVec>& dst, std::vector<IoVec>& src, size_t len )
+                IoVecList& dst, IoVecList& src, size_t len )
 {
     dbg().debug(CALL_INFO,2,DBG_MSK_PQS_Q,"dst.size()=%lu src.size()=%lu wantLen=%lu\n",
                                     dst.size(), src.size(), len );
 
     size_t copied = 0;
     size_t rV = 0,rP =0;
+
+    // without payload bytes there is nothing to move, the copy was already charged
+    if ( m_timingPayload ) {
+        return;
+    }
+
     for ( unsigned int i=0; i < src.size() && copied < len; i++ )
     {
         assert( rV < dst.size() );
@@ -1095,7 +1154,7 @@ void ProcessQueuesState::postShortRecvBuffer( )
     m_nic->dmaRecv( -1, ShortMsgQ, buf->ioVec, callback );
 }
 
-void ProcessQueuesState::loopSendReq( std::vector<IoVec>& vec, int core, void* key )
+void ProcessQueuesState::loopSendReq( IoVecList& vec, int core, void* key )
 {
     m_dbg.debug(CALL_INFO,2,DBG_MSK_PQS_LOOP,"dest core=%d key=%p\n",core,key);
 
@@ -1117,7 +1176,7 @@ void ProcessQueuesState::loopHandler( Event* ev )
     if ( event->vec.empty() ) {
         loopHandler(event->core, event->key );
     } else {
-        loopHandler(event->core, event->vec, event->key);
+        loopHandler(event->core, event->vec, event->key, event->copied);
     }
     delete ev;
 }
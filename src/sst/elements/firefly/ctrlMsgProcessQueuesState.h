@@ -27,6 +27,7 @@
 #include "loopBack.h"
 
 #include "ctrlMsgCommReq.h"
+#include "ctrlMsgMatchEngine.h"
 #include "ctrlMsgWaitReq.h"
 
 #define DBG_MSK_PQS_APP_SIDE 1 << 0
@@ -74,6 +75,8 @@ class ProcessQueuesState : public SubComponent
         {"pqs.maxUnexpectedMsg","Sets the maximum unexpected messages","32" },
         {"pqs.maxPostedShortBuffers","Sets the maximum posted short buffers","512" },
         {"pqs.minPostedShortBuffers","Sets the minimum posted short buffers","5"},
+        {"pqs.matchCost","Sets the simulated cost of matching, linear charges a walk of the posted receive and unexpected message lists up to the match, hashed charges the entries a hashed match engine looks at","linear"},
+        {"pqs.payloadMode","Sets what a message carries, data moves the payload bytes, timing moves only their timing and leaves the receive buffers untouched","data"},
         {"loopBackPortName","Sets port name to use when connecting to the loopBack component","loop"},
         {"ackVN","Sets the VN to use for acks","0"},
         {"rendezvousVN","Sets the VN to use for rendezvous","0"},
@@ -122,17 +125,26 @@ class ProcessQueuesState : public SubComponent
 
     class LoopBackEvent : public LoopBackEventBase {
       public:
-        LoopBackEvent( std::vector<IoVec>& _vec, int core, void* _key ) :
-            LoopBackEventBase( core ), vec( _vec ), key( _key ), response( false )
+        LoopBackEvent( IoVecList& _vec, int core, void* _key ) :
+            LoopBackEventBase( core, payloadBytes( _vec ) ), vec( _vec ), key( _key ), response( false )
         {}
 
         LoopBackEvent( int core, void* _key ) : LoopBackEventBase( core ), key( _key ), response( true )
         {}
 
-        std::vector<IoVec>  vec;
+        IoVecList  vec;
         void*               key;
         bool                response;
 
+        // everything after the match header
+        static size_t payloadBytes( IoVecList& vec ) {
+            size_t bytes = 0;
+            for ( unsigned int i = 1; i < vec.size(); i++ ) {
+                bytes += vec[i].len;
+            }
+            return bytes;
+        }
+
         NotSerializable(LoopBackEvent)
     };
 
@@ -173,10 +185,10 @@ class ProcessQueuesState : public SubComponent
         Msg( MatchHdr* hdr ) : m_hdr( hdr ) {}
         virtual ~Msg() {}
         MatchHdr& hdr() { return *m_hdr; }
-        std::vector<IoVec>& ioVec() { return m_ioVec; }
+        IoVecList& ioVec() { return m_ioVec; }
 
       protected:
-        std::vector<IoVec> m_ioVec;
+        IoVecList m_ioVec;
 
       private:
         MatchHdr* m_hdr;
@@ -214,22 +226,23 @@ class ProcessQueuesState : public SubComponent
 		}
 
         MatchHdr                hdr;
-        std::vector<IoVec>      ioVec;
+        IoVecList      ioVec;
         std::vector<unsigned char> buf;
         HeapAddrs& 				heap;
     };
 
     struct LoopReq : public Msg {
-        LoopReq(int _srcCore, std::vector<IoVec>& _vec, void* _key ) :
+        LoopReq(int _srcCore, IoVecList& _vec, void* _key, bool _copied ) :
             Msg( (MatchHdr*)_vec[0].addr.getBacking() ),
-            srcCore( _srcCore ), vec(_vec), key( _key)
+            srcCore( _srcCore ), vec(_vec), key( _key), copied( _copied )
         {
             m_ioVec.push_back( vec[1] );
         }
 
         int srcCore;
-        std::vector<IoVec>& vec;
+        IoVecList& vec;
         void* key;
+        bool copied; // the loopBack already charged the copy
     };
 
     struct LoopResp{
@@ -285,7 +298,7 @@ class ProcessQueuesState : public SubComponent
 			m_msgQ(msgQ), m_iter( msgQ->begin() ), m_done(false) {}
 
         MatchHdr&   hdr() { return (*m_iter)->hdr(); }
-        std::vector<IoVec>& ioVec() { return (*m_iter)->ioVec(); }
+        IoVecList& ioVec() { return (*m_iter)->ioVec(); }
 
         Msg* msg() { return *m_iter; }
 
@@ -300,6 +313,13 @@ class ProcessQueuesState : public SubComponent
         void setDone( ) { m_done = true; }
         bool isDone() { return m_done || m_iter == m_msgQ->end();  }
         void incPos() { ++m_iter; }
+
+        // move to the first message pred accepts, or to the last one if none does
+        template< class Pred > void seek( Pred pred ) {
+            while ( m_iter + 1 != m_msgQ->end() && ! pred( *m_iter ) ) {
+                ++m_iter;
+            }
+        }
       private:
         bool m_done;
         std::deque<Msg*>*                       m_msgQ;
@@ -365,7 +385,8 @@ class ProcessQueuesState : public SubComponent
     void runInterruptCtx();
     void leaveInterruptCtx( Stack* );
 
-    void copyIoVec( std::vector<IoVec>& dst, std::vector<IoVec>& src, size_t);
+    void copyIoVec( IoVecList& dst, IoVecList& src, size_t);
+    IoVecList timingIoVec( IoVecList& );
 
     Output& dbg()   { return m_dbg; }
 
@@ -380,6 +401,7 @@ class ProcessQueuesState : public SubComponent
 
     bool        checkMatchHdr( MatchHdr& hdr, MatchHdr& wantHdr, uint64_t ignore );
     _CommReq*	searchPostedRecv( std::deque< _CommReq* >& pstd, MatchHdr& hdr, int& delay );
+    _CommReq*	searchPostedRecv( PostedRecvQueue& pstd, MatchHdr& hdr, int& delay );
 
     void exit( int delay = 0 ) {
         dbg().debug(CALL_INFO,2,DBG_MSK_PQS_APP_SIDE,"exit ProcessQueuesState\n");
@@ -460,9 +482,9 @@ class ProcessQueuesState : public SubComponent
         return m_stringBuf; 
     }
 
-    void loopHandler( int, std::vector<IoVec>&, void* );
+    void loopHandler( int, IoVecList&, void*, bool );
     void loopHandler( int, void* );
-    void loopSendReq( std::vector<IoVec>&, int, void* );
+    void loopSendReq( IoVecList&, int, void* );
     void loopSendResp( int, void* );
 
     Output      m_dbg;
@@ -480,7 +502,7 @@ class ProcessQueuesState : public SubComponent
     int     m_numRecvLooped;
     bool    m_missedInt;
 
-    std::deque< _CommReq* >         m_pstdRcvQ;
+    PostedRecvQueue                 m_pstdRcvQ;
     std::deque< _CommReq* >         m_pstdRcvPreQ;
     std::vector<std::deque< Msg* >> m_recvdMsgQ;
 	int m_recvdMsgQpos;
@@ -511,6 +533,8 @@ class ProcessQueuesState : public SubComponent
     int m_nicsPerNode;
     int m_rendezvousVN;
     int m_ackVN;
+    bool m_hashedMatchCost;
+    bool m_timingPayload;
 };
 
 }
@@ -66,7 +66,7 @@ void AllgatherFuncSM::handleStartEvent( SST::Event *e, Retval& retval )
 bool AllgatherFuncSM::setup( Retval& retval )
 {
 	Hermes::MemAddr addr;
-    std::vector<IoVec> ioVec;
+    IoVecList ioVec;
     int recvStartChunk;
     int src;
 
@@ -140,7 +140,7 @@ bool AllgatherFuncSM::setup( Retval& retval )
 
 void AllgatherFuncSM::handleEnterEvent( Retval& retval )
 {
-    std::vector<IoVec> ioVec;
+    IoVecList ioVec;
     m_dbg.debug(CALL_INFO,1,0,"%s\n", stateName(m_state).c_str());
 
     switch( m_state ) {
@@ -196,7 +196,7 @@ void AllgatherFuncSM::handleEnterEvent( Retval& retval )
     }
 }
 
-void AllgatherFuncSM::initIoVec( std::vector<IoVec>& ioVec,
+void AllgatherFuncSM::initIoVec( IoVecList& ioVec,
                     int startChunk, int numChunks, bool backed )
 {
     int currentChunk = startChunk;
@@ -82,7 +82,7 @@ class AllgatherFuncSM :  public FunctionSMInterface
   private:
 
     bool setup( Retval& );
-    void initIoVec(std::vector<IoVec>& ioVec, int startChunk, int numChunks, bool backed );
+    void initIoVec(IoVecList& ioVec, int startChunk, int numChunks, bool backed );
 
     std::string stateName( StateEnum i ) { return m_enumName[i]; }
 
@@ -33,6 +33,13 @@ class AllreduceFuncSM :  public CollectiveTreeFuncSM
         SST::Firefly::CollectiveTreeFuncSM
     )
 
+    SST_ELI_DOCUMENT_PARAMS(
+        {"collectiveModel","Sets how collectives are timed, messages or analytic","messages"},
+        {"collectiveAlgorithm","Sets the algorithm the analytic model times, tree, ring, recursiveDoubling or rabenseifner","tree"},
+        {"collectiveLatency","Sets the latency of one message stage in the analytic model","1us"},
+        {"collectiveBandwidth","Sets the bandwidth of one rank in the analytic model","10GB/s"},
+    )
+
   public:
     AllreduceFuncSM( SST::Params& params ) : CollectiveTreeFuncSM( params ) { }
 
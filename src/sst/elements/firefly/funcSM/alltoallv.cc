@@ -52,6 +52,22 @@ void AlltoallvFuncSM::handleStartEvent( SST::Event *e, Retval& retval )
         memcpy( recv, send, recvChunkSize(m_rank));
     }
 
+    if ( m_model.analytic() ) {
+        size_t bytes = 0;
+        for ( unsigned int rank = 0; rank < m_size; rank++ ) {
+            if ( rank != (unsigned) m_rank ) {
+                bytes += sendChunkSize( rank );
+            }
+        }
+        uint64_t delay = m_model.alltoall_ns( m_size, bytes );
+        m_dbg.debug(CALL_INFO,1,0,"analytic delay %" PRIu64 " ns\n", delay );
+
+        // PostRecv leaves once every rank is counted
+        m_count = m_size;
+        retval.setDelay( delay );
+        return;
+    }
+
     retval.setDelay( 0 );
 }
 
@@ -18,6 +18,7 @@
 
 #include "funcSM/api.h"
 #include "funcSM/event.h"
+#include "funcSM/collectiveModel.h"
 #include "info.h"
 #include "ctrlMsg.h"
 
@@ -49,6 +50,10 @@ class AlltoallvFuncSM :  public FunctionSMInterface
 	SST_ELI_DOCUMENT_PARAMS(
 		{"smallCollectiveVN","Sets the VN to use for small collectives","0"},
 		{"smallCollectiveSize","Sets the size of small collectives","0"},
+		{"collectiveModel","Sets how the alltoall is timed, messages or analytic","messages"},
+		{"collectiveAlgorithm","Sets the algorithm the analytic model times, pairwise or recursiveDoubling","pairwise"},
+		{"collectiveLatency","Sets the latency of one message stage in the analytic model","1us"},
+		{"collectiveBandwidth","Sets the bandwidth of one rank in the analytic model","10GB/s"},
 	)
   private:
 
@@ -66,7 +71,8 @@ class AlltoallvFuncSM :  public FunctionSMInterface
     AlltoallvFuncSM( SST::Params& params ) :
         FunctionSMInterface( params ),
         m_event( NULL ),
-        m_seq( 0 )
+        m_seq( 0 ),
+        m_model( params, m_dbg, "pairwise" )
     {
        m_smallCollectiveVN = params.find<int>( "smallCollectiveVN", 0);
         m_smallCollectiveSize = params.find<int>( "smallCollectiveSize", 0);
@@ -149,6 +155,7 @@ class AlltoallvFuncSM :  public FunctionSMInterface
     int m_smallCollectiveVN;
     int m_smallCollectiveSize;
 
+    CollectiveModel m_model;
 };
 
 }
@@ -0,0 +1,165 @@
+// Copyright 2013-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2013-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef COMPONENTS_FIREFLY_FUNCSM_COLLECTIVEMODEL_H
+#define COMPONENTS_FIREFLY_FUNCSM_COLLECTIVEMODEL_H
+
+#include <sst/core/output.h>
+#include <sst/core/params.h>
+#include <sst/core/unitAlgebra.h>
+
+namespace SST {
+namespace Firefly {
+
+// Analytical timing for the collectives, used in place of the point to point
+// messages when a function sets collectiveModel to "analytic". Each stage
+// costs the per message latency plus the bytes it moves at the bandwidth,
+// the stage counts and volumes are the usual ones for each algorithm.
+// Every rank leaves the collective that long after it entered, so the model
+// assumes the ranks enter together and the results are not reduced.
+class CollectiveModel {
+  public:
+    enum Algorithm { Tree, Ring, RecursiveDoubling, Rabenseifner, Pairwise };
+
+    CollectiveModel( SST::Params& params, Output& dbg, std::string defaultAlgorithm ) :
+        m_analytic( false ),
+        m_algorithm( Tree )
+    {
+        std::string model = params.find<std::string>( "collectiveModel", "messages" );
+        if ( 0 == model.compare( "analytic" ) ) {
+            m_analytic = true;
+        } else if ( model.compare( "messages" ) ) {
+            dbg.fatal(CALL_INFO,-1,"unknown collectiveModel `%s`\n", model.c_str());
+        }
+
+        std::string algorithm = params.find<std::string>( "collectiveAlgorithm", defaultAlgorithm );
+        if ( 0 == algorithm.compare( "tree" ) ) {
+            m_algorithm = Tree;
+        } else if ( 0 == algorithm.compare( "ring" ) ) {
+            m_algorithm = Ring;
+        } else if ( 0 == algorithm.compare( "recursiveDoubling" ) ) {
+            m_algorithm = RecursiveDoubling;
+        } else if ( 0 == algorithm.compare( "rabenseifner" ) ) {
+            m_algorithm = Rabenseifner;
+        } else if ( 0 == algorithm.compare( "pairwise" ) ) {
+            m_algorithm = Pairwise;
+        } else {
+            dbg.fatal(CALL_INFO,-1,"unknown collectiveAlgorithm `%s`\n", algorithm.c_str());
+        }
+
+        m_latency_ns = params.find<SST::UnitAlgebra>( "collectiveLatency",
+                                SST::UnitAlgebra( "1us" ) ).getDoubleValue() * 1.0e9;
+        double bandwidth = params.find<SST::UnitAlgebra>( "collectiveBandwidth",
+                                SST::UnitAlgebra( "10GB/s" ) ).getDoubleValue();
+        if ( bandwidth <= 0 ) {
+            dbg.fatal(CALL_INFO,-1,"collectiveBandwidth must be positive\n");
+        }
+        m_nsPerByte = 1.0e9 / bandwidth;
+    }
+
+    bool analytic() { return m_analytic; }
+
+    uint64_t allreduce_ns( int size, size_t bytes ) {
+        if ( size < 2 ) return 0;
+        double n = bytes;
+        switch ( m_algorithm ) {
+          case Ring:
+            return 2 * ( size - 1 ) * stage( n / size );
+          case RecursiveDoubling:
+            return log2Ceil( size ) * stage( n );
+          case Rabenseifner:
+            return 2 * log2Ceil( size ) * m_latency_ns +
+                        2.0 * ( size - 1 ) / size * n * m_nsPerByte;
+          default:
+            return 2 * treeDepth( size ) * stage( n );
+        }
+    }
+
+    uint64_t reduce_ns( int size, size_t bytes ) {
+        if ( size < 2 ) return 0;
+        double n = bytes;
+        switch ( m_algorithm ) {
+          case Ring:
+            // reduce-scatter then gather
+            return 2 * ( size - 1 ) * stage( n / size );
+          case RecursiveDoubling:
+            return log2Ceil( size ) * stage( n );
+          case Rabenseifner:
+            return 2 * log2Ceil( size ) * m_latency_ns +
+                        2.0 * ( size - 1 ) / size * n * m_nsPerByte;
+          default:
+            return treeDepth( size ) * stage( n );
+        }
+    }
+
+    uint64_t bcast_ns( int size, size_t bytes ) {
+        if ( size < 2 ) return 0;
+        double n = bytes;
+        switch ( m_algorithm ) {
+          case RecursiveDoubling:
+            return log2Ceil( size ) * stage( n );
+          case Ring:
+          case Rabenseifner:
+            // scatter then allgather
+            return ( log2Ceil( size ) + size - 1 ) * m_latency_ns +
+                        2.0 * ( size - 1 ) / size * n * m_nsPerByte;
+          default:
+            return treeDepth( size ) * stage( n );
+        }
+    }
+
+    // bytes is what this rank sends to the other ranks
+    uint64_t alltoall_ns( int size, size_t bytes ) {
+        if ( size < 2 ) return 0;
+        double n = bytes;
+        switch ( m_algorithm ) {
+          case RecursiveDoubling:
+            // Bruck, half the data moves in every round
+            return log2Ceil( size ) * stage( n / 2 );
+          default:
+            return ( size - 1 ) * m_latency_ns + n * m_nsPerByte;
+        }
+    }
+
+  private:
+    double stage( double bytes ) { return m_latency_ns + bytes * m_nsPerByte; }
+
+    static int log2Ceil( int size ) {
+        int steps = 0;
+        while ( ( 1 << steps ) < size ) {
+            ++steps;
+        }
+        return steps;
+    }
+
+    // levels below the root of the binary tree CollectiveTreeFuncSM uses
+    static int treeDepth( int size ) {
+        int depth = 0;
+        while ( ( 2 << depth ) <= size ) {
+            ++depth;
+        }
+        return depth;
+    }
+
+    bool        m_analytic;
+    Algorithm   m_algorithm;
+    double      m_latency_ns;
+    double      m_nsPerByte;
+};
+
+}
+}
+
+#endif
@@ -16,6 +16,8 @@
 
 #include <sst_config.h>
 
+#include <string.h>
+
 #include "funcSM/collectiveTree.h"
 #include "funcSM/collectiveOps.h"
 #include "info.h"
@@ -46,6 +48,11 @@ void CollectiveTreeFuncSM::handleStartEvent( SST::Event *e, Retval& retval )
         m_dbg.debug(CALL_INFO,1,0,"child[%d]=%d\n",i,m_yyy->calcChild(i));
     }
 
+    if ( m_model.analytic() ) {
+        startAnalytic( retval );
+        return;
+    }
+
     m_recvReqV.resize( m_yyy->numChildren() );
     m_recvReqV_ptrs.resize( m_recvReqV.size() );
     for ( unsigned i = 0; i < m_recvReqV.size(); i++ ) {
@@ -87,6 +94,37 @@ void CollectiveTreeFuncSM::handleStartEvent( SST::Event *e, Retval& retval )
     handleEnterEvent( retval );
 }
 
+void CollectiveTreeFuncSM::startAnalytic( Retval& retval )
+{
+    m_bufLen = m_event->count * m_info->sizeofDataType( m_event->dtype );
+    m_bufV.assign( m_yyy->numChildren() + 1, NULL );
+
+    uint64_t delay = 0;
+    switch ( m_event->type ) {
+      case CollectiveStartEvent::Allreduce:
+        delay = m_model.allreduce_ns( m_yyy->size(), m_bufLen );
+        break;
+      case CollectiveStartEvent::Reduce:
+        delay = m_model.reduce_ns( m_yyy->size(), m_bufLen );
+        break;
+      case CollectiveStartEvent::Bcast:
+        delay = m_model.bcast_ns( m_yyy->size(), m_bufLen );
+        break;
+    }
+
+    // nothing is reduced, the result holds this rank's own data
+    void* mydata = m_event->mydata.getBacking();
+    void* result = m_event->result.getBacking();
+    if ( m_event->type != CollectiveStartEvent::Bcast && mydata && result && mydata != result ) {
+        memcpy( result, mydata, m_bufLen );
+    }
+
+    m_dbg.debug(CALL_INFO,1,0,"analytic %s delay %" PRIu64 " ns\n", m_event->typeName(), delay );
+
+    m_state = Exit;
+    retval.setDelay( delay );
+}
+
 void CollectiveTreeFuncSM::handleEnterEvent( Retval& retval )
 {
 	Hermes::MemAddr addr;
@@ -18,6 +18,7 @@
 
 #include "funcSM/api.h"
 #include "funcSM/event.h"
+#include "funcSM/collectiveModel.h"
 #include "ctrlMsg.h"
 
 namespace SST {
@@ -139,7 +140,8 @@ private:
         FunctionSMInterface( params ),
         m_event( NULL ),
         m_seq( 0 ),
-        m_vn( 0 )
+        m_vn( 0 ),
+        m_model( params, m_dbg, "tree" )
     {
         m_smallCollectiveVN = params.find<int>( "smallCollectiveVN", 0);
         m_smallCollectiveSize = params.find<int>( "smallCollectiveSize", 0);
@@ -150,6 +152,8 @@ private:
 
   private:
 
+    void startAnalytic( Retval& );
+
     uint32_t    genTag() {
         return CtrlMsg::CollectiveTag | (m_seq & 0xffff);
     }
@@ -172,6 +176,8 @@ private:
     int m_vn;
     int m_smallCollectiveVN;
     int m_smallCollectiveSize;
+
+    CollectiveModel m_model;
 };
 
 }
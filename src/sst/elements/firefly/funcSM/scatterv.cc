@@ -233,7 +233,7 @@ bool ScattervFuncSM::dataWait( SendInfo* sInfo , RecvInfo* rInfo )
 
 bool ScattervFuncSM::dataSend( SendInfo* sInfo , RecvInfo* rInfo )
 {
-	std::vector<IoVec> ioVec;
+	IoVecList ioVec;
 
 	if ( -1 == m_tree->parent() ) {
 		int x = m_tree->calcChildTreeSize(sInfo->count);
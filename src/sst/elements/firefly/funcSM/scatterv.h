@@ -207,7 +207,7 @@ class ScattervFuncSM :  public FunctionSMInterface
 			}
 		}
 		CtrlMsg::CommReq req;
-    	std::vector<IoVec> ioVec;
+    	IoVecList ioVec;
 		char* bufPos;
 	};
 
@@ -229,10 +229,12 @@ void FunctionSM::handleToDriver( Event* e )
     assert( e );
     m_dbg.debug(CALL_INFO,3,0," returning\n");
     DriverEvent* event = static_cast<DriverEvent*>(e);
+    // the function is done before its caller hears so, the caller may
+    // start the next one from the functor
+    m_sm = NULL;
     if ( (*event->retFunc)( event->retval ) ) {
         delete event->retFunc;
     }
-    m_sm = NULL;
     delete e;
 }
 
@@ -24,7 +24,7 @@ using namespace Hermes::MP;
 
 
 HadesMP::HadesMP(ComponentId_t id, Params& params) :
-    Interface(id), m_os(NULL)
+    Interface(id), m_vecFunctor(this, &HadesMP::vecNext), m_os(NULL)
 {
 }
 
@@ -106,6 +106,62 @@ void HadesMP::irecv(const Hermes::MemAddr& target, uint32_t count, PayloadDataTy
       new RecvStartEvent(target, count, dtype, source, tag, group, req, NULL));
 }
 
+void HadesMP::sendv(std::vector<MessageDesc>& msgs, Communicator group,
+        MessageRequest req[], Functor* retFunc )
+{
+    dbg().debug(CALL_INFO,1,1,"num=%zu group=%d\n", msgs.size(), group);
+    startVec( msgs, group, req, retFunc, true );
+}
+
+void HadesMP::recvv(std::vector<MessageDesc>& msgs, Communicator group,
+        MessageRequest req[], Functor* retFunc )
+{
+    dbg().debug(CALL_INFO,1,1,"num=%zu group=%d\n", msgs.size(), group);
+    startVec( msgs, group, req, retFunc, false );
+}
+
+void HadesMP::startVec( std::vector<MessageDesc>& msgs, Communicator group,
+        MessageRequest req[], Functor* retFunc, bool send )
+{
+    if ( msgs.empty() ) {
+        dbg().fatal(CALL_INFO,-1,"%s with no messages\n", send ? "sendv" : "recvv" );
+    }
+    m_vecOp.msgs = msgs;
+    m_vecOp.group = group;
+    m_vecOp.req = req;
+    m_vecOp.retFunc = retFunc;
+    m_vecOp.send = send;
+    m_vecOp.next = 0;
+    startVecNext();
+}
+
+void HadesMP::startVecNext()
+{
+    MessageDesc& msg = m_vecOp.msgs[m_vecOp.next];
+    MessageRequest* req = &m_vecOp.req[m_vecOp.next];
+    ++m_vecOp.next;
+
+    if ( m_vecOp.send ) {
+        functionSM().start( FunctionSM::Send, &m_vecFunctor,
+            new SendStartEvent( msg.buf, msg.count, msg.dtype, msg.rank, msg.tag,
+                                m_vecOp.group, req ) );
+    } else {
+        functionSM().start( FunctionSM::Recv, &m_vecFunctor,
+            new RecvStartEvent( msg.buf, msg.count, msg.dtype, msg.rank, msg.tag,
+                                m_vecOp.group, req, NULL ) );
+    }
+}
+
+bool HadesMP::vecNext( int retval )
+{
+    if ( m_vecOp.next < m_vecOp.msgs.size() ) {
+        startVecNext();
+    } else if ( (*m_vecOp.retFunc)( retval ) ) {
+        delete m_vecOp.retFunc;
+    }
+    return false;
+}
+
 void HadesMP::allreduce(const Hermes::MemAddr& mydata,
 		const Hermes::MemAddr& result, uint32_t count,
         PayloadDataType dtype, ReductionOperation op,
@@ -93,6 +93,12 @@ class HadesMP : public MP::Interface
         MP::Communicator group, MP::MessageRequest* req,
         MP::Functor*);
 
+    virtual void sendv(std::vector<MP::MessageDesc>&, MP::Communicator group,
+        MP::MessageRequest req[], MP::Functor*);
+
+    virtual void recvv(std::vector<MP::MessageDesc>&, MP::Communicator group,
+        MP::MessageRequest req[], MP::Functor*);
+
     virtual void allreduce(const Hermes::MemAddr&,
 		const Hermes::MemAddr& result, uint32_t count,
         MP::PayloadDataType dtype, MP::ReductionOperation op,
@@ -196,6 +202,26 @@ class HadesMP : public MP::Interface
     virtual void comm_destroy( MP::Communicator, MP::Functor* );
 
   private:
+    // A sendv or recvv posts its messages one isend or irecv at a time
+    // through the function state machine, m_vecFunctor is the return of
+    // each and is owned here, so it returns false
+    struct VecOp {
+        std::vector<MP::MessageDesc> msgs;
+        MP::Communicator    group;
+        MP::MessageRequest* req;
+        MP::Functor*        retFunc;
+        bool                send;
+        size_t              next;
+    };
+
+    void startVec( std::vector<MP::MessageDesc>&, MP::Communicator,
+        MP::MessageRequest req[], MP::Functor*, bool send );
+    void startVecNext();
+    bool vecNext( int retval );
+
+    VecOp   m_vecOp;
+    Arg_Functor< HadesMP, int, bool > m_vecFunctor;
+
     Output  m_dbg;
 	Output& dbg() { return m_dbg; }
 	FunctionSM& functionSM() { return m_os->getFunctionSM(); }
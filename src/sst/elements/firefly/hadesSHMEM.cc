@@ -744,6 +744,58 @@ void HadesSHMEM::add( Add* info )
     delete info;
 }
 
+void HadesSHMEM::put_nbi_batch( std::vector<Shmem::PutDesc>& ops, Shmem::Callback callback )
+{
+	PutBatch* info = new PutBatch( ops, callback );
+
+    dbg().debug(CALL_INFO,1,SHMEM_BASE,"num=%zu\n",ops.size());
+
+	delayEnter( DO( put_nbi_batch, info ) );
+}
+
+// The puts are handed to the NIC one after the other, waiting whenever
+// its command queue is full, and the call returns once they all are
+void HadesSHMEM::put_nbi_batch( PutBatch* info )
+{
+	while ( info->next < info->ops.size() ) {
+		if ( nic().isBlocked() ) {
+			nic().setBlockedCallback( [=]() { this->put_nbi_batch( info ); } );
+			return;
+		}
+		Shmem::PutDesc& op = info->ops[info->next++];
+		if ( op.nelems ) {
+			nic().shmemPut( calcNetPE(op.pe), op.dest, op.src, op.nelems, [](){} );
+		}
+	}
+
+	delayReturn( info->callback, m_blockingReturnLat_ns );
+	delete info;
+}
+
+void HadesSHMEM::add_batch( std::vector<Shmem::AddDesc>& ops, Shmem::Callback callback )
+{
+	AddBatch* info = new AddBatch( ops, callback );
+
+    dbg().debug(CALL_INFO,1,SHMEM_BASE,"num=%zu\n",ops.size());
+
+	delayEnter( DO( add_batch, info ) );
+}
+
+void HadesSHMEM::add_batch( AddBatch* info )
+{
+	while ( info->next < info->ops.size() ) {
+		if ( nic().isBlocked() ) {
+			nic().setBlockedCallback( [=]() { this->add_batch( info ); } );
+			return;
+		}
+		Shmem::AddDesc& op = info->ops[info->next++];
+		nic().shmemAdd( calcNetPE(op.pe), op.dest, op.value );
+	}
+
+	delayReturn( info->callback );
+	delete info;
+}
+
 void HadesSHMEM::fadd(Hermes::Value& result, Hermes::Vaddr addr, Hermes::Value& value, int pe, Shmem::Callback callback)
 {
 	Fadd* info = new Fadd( result, addr, value, pe, callback );
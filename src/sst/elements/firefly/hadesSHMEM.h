@@ -402,6 +402,18 @@ class HadesSHMEM : public Shmem::Interface
 		Value value;
 	   	int pe;
 	};
+	struct PutBatch : public Base {
+		PutBatch( std::vector<Shmem::PutDesc>& ops, Shmem::Callback callback ) :
+			Base(callback), ops(ops), next(0) {}
+		std::vector<Shmem::PutDesc> ops;
+		size_t next;
+	};
+	struct AddBatch : public Base {
+		AddBatch( std::vector<Shmem::AddDesc>& ops, Shmem::Callback callback ) :
+			Base(callback), ops(ops), next(0) {}
+		std::vector<Shmem::AddDesc> ops;
+		size_t next;
+	};
 	struct Fam_Get : public Base {
 		Fam_Get( Hermes::Vaddr dest, Shmem::Fam_Descriptor rd, uint64_t offset, uint64_t nbytes,
 				bool blocking, Shmem::Callback callback ) :
@@ -479,6 +491,9 @@ class HadesSHMEM : public Shmem::Interface
     virtual void add(  Hermes::Vaddr, Hermes::Value&, int pe, Shmem::Callback);
     virtual void fadd( Hermes::Value&, Hermes::Vaddr, Hermes::Value&, int pe, Shmem::Callback);
 
+    virtual void put_nbi_batch( std::vector<Shmem::PutDesc>&, Shmem::Callback);
+    virtual void add_batch( std::vector<Shmem::AddDesc>&, Shmem::Callback);
+
 	virtual void fam_add( Shmem::Fam_Descriptor fd, uint64_t, Hermes::Value&, Shmem::Callback& );
     virtual void fam_cswap( Hermes::Value& result, Shmem::Fam_Descriptor fd, uint64_t, Hermes::Value& oldValue , Hermes::Value& newValue, Shmem::Callback);
 
@@ -541,6 +556,8 @@ class HadesSHMEM : public Shmem::Interface
 	void swap( Swap* );
 	void fadd( Fadd* );
 	void add( Add* );
+	void put_nbi_batch( PutBatch* );
+	void add_batch( AddBatch* );
 	void fam_get( Fam_Get* );
 	void fam_add( Fam_Add* );
 
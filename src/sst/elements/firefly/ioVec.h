@@ -17,6 +17,8 @@
 #define COMPONENTS_FIREFLY_IOVEC_H
 
 #include <stddef.h>
+#include <assert.h>
+#include <algorithm>
 
 #include "sst/elements/hermes/hermes.h"
 
@@ -30,6 +32,100 @@ struct IoVec {
 	Hermes::MemAddr addr;
     size_t len;
 };
+
+/*
+ * The IoVecs of a message. Nearly every message has one or two (a header
+ * and a payload), so the first few are kept inline and only longer lists
+ * go to the heap. Covers the part of the std::vector interface firefly uses.
+ */
+class IoVecList {
+  public:
+    static const size_t InlineCount = 4;
+
+    typedef IoVec* iterator;
+    typedef const IoVec* const_iterator;
+
+    IoVecList() : m_data( m_inline ), m_size( 0 ), m_capacity( InlineCount ) {}
+    explicit IoVecList( size_t n ) : IoVecList() { resize( n ); }
+    IoVecList( const IoVecList& other ) : IoVecList() { *this = other; }
+    ~IoVecList() { if ( m_data != m_inline ) delete [] m_data; }
+
+    IoVecList& operator=( const IoVecList& other ) {
+        if ( this != &other ) {
+            m_size = 0;
+            reserve( other.m_size );
+            std::copy( other.begin(), other.end(), m_data );
+            m_size = other.m_size;
+        }
+        return *this;
+    }
+
+    size_t size() const { return m_size; }
+    bool empty() const { return m_size == 0; }
+
+    IoVec& operator[]( size_t i ) { return m_data[i]; }
+    const IoVec& operator[]( size_t i ) const { return m_data[i]; }
+    IoVec& at( size_t i ) { assert( i < m_size ); return m_data[i]; }
+    const IoVec& at( size_t i ) const { assert( i < m_size ); return m_data[i]; }
+    IoVec& back() { return m_data[m_size - 1]; }
+
+    iterator begin() { return m_data; }
+    iterator end() { return m_data + m_size; }
+    const_iterator begin() const { return m_data; }
+    const_iterator end() const { return m_data + m_size; }
+
+    void clear() { m_size = 0; }
+
+    void reserve( size_t n ) {
+        if ( n <= m_capacity ) return;
+        size_t capacity = std::max( n, m_capacity * 2 );
+        IoVec* data = new IoVec[capacity];
+        std::copy( begin(), end(), data );
+        if ( m_data != m_inline ) delete [] m_data;
+        m_data = data;
+        m_capacity = capacity;
+    }
+
+    void resize( size_t n ) {
+        reserve( n );
+        for ( size_t i = m_size; i < n; i++ ) m_data[i] = IoVec();
+        m_size = n;
+    }
+
+    void push_back( const IoVec& vec ) {
+        reserve( m_size + 1 );
+        m_data[m_size++] = vec;
+    }
+
+    iterator insert( iterator pos, const IoVec& vec ) {
+        return insert( pos, &vec, &vec + 1 );
+    }
+
+    iterator insert( iterator pos, const_iterator first, const_iterator last ) {
+        size_t index = pos - m_data;
+        size_t count = last - first;
+        IoVecList tmp;
+        const_iterator src = first;
+        if ( first >= begin() && first < end() ) {
+            // inserting from ourselves, copy out before moving things
+            tmp.reserve( count );
+            std::copy( first, last, tmp.m_data );
+            src = tmp.m_data;
+        }
+        reserve( m_size + count );
+        std::copy_backward( m_data + index, m_data + m_size, m_data + m_size + count );
+        std::copy( src, src + count, m_data + index );
+        m_size += count;
+        return m_data + index;
+    }
+
+  private:
+    IoVec  m_inline[InlineCount];
+    IoVec* m_data;
+    size_t m_size;
+    size_t m_capacity;
+};
+
 }
 }
 
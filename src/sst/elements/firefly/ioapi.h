@@ -54,9 +54,9 @@ class Interface : public SST::Module {
 
     virtual NodeId getNodeId() { assert(0); };
     virtual NodeId peek() { assert(0); }
-    virtual bool sendv(NodeId dest, std::vector<IoVec>&, Entry::Functor*)
+    virtual bool sendv(NodeId dest, IoVecList&, Entry::Functor*)
                                             { assert(0); }
-    virtual bool recvv(NodeId src, std::vector<IoVec>&, Entry::Functor*)
+    virtual bool recvv(NodeId src, IoVecList&, Entry::Functor*)
                                             { assert(0); }
     virtual void wait() { assert(0);}
     virtual void setReturnLink( SST::Link* ) { assert(0); }
@@ -20,6 +20,7 @@
 #include <sst/core/link.h>
 
 #include <sstream>
+#include <algorithm>
 
 #include "loopBack.h"
 
@@ -32,6 +33,12 @@ LoopBack::LoopBack(ComponentId_t id, Params& params ) :
     int nicsPerNode = params.find<int>("nicsPerNode", 1 );
     int numCores = params.find<int>("numCores", 1 )/nicsPerNode;
 
+    m_copyBandwidth = params.find<SST::UnitAlgebra>( "copyBandwidth",
+                                SST::UnitAlgebra( "0GB/s" ) ).getDoubleValue() / 1.0e9;
+    m_copyBusyUntil_ns = 0;
+    m_statCopyWait = registerStatistic<uint64_t>("copy_wait_ns");
+    m_statCopyBytes = registerStatistic<uint64_t>("copy_bytes");
+
 	for ( int j = 0; j < nicsPerNode; j++ ) {
 		std::ostringstream nic;
 		nic <<  j;
@@ -53,5 +60,17 @@ void LoopBack::handleCoreEvent( Event* ev, int src ) {
     LoopBackEventBase* event = static_cast<LoopBackEventBase*>(ev);
     int dest = event->core;
     event->core = src;
-    m_links[dest]->send(0,ev );
+
+    // a single copy from the source core's buffer, the node's cores take turns on its memory
+    SimTime_t delay = 0;
+    if ( m_copyBandwidth > 0 && event->bytes ) {
+        double now = getCurrentSimTimeNano();
+        double start = std::max( now, m_copyBusyUntil_ns );
+        m_copyBusyUntil_ns = start + event->bytes / m_copyBandwidth;
+        delay = (SimTime_t)( m_copyBusyUntil_ns - now );
+        event->copied = true;
+        m_statCopyWait->addData( (uint64_t)( start - now ) );
+        m_statCopyBytes->addData( event->bytes );
+    }
+    m_links[dest]->send(delay,ev );
 }
@@ -24,8 +24,10 @@ namespace Firefly {
 class LoopBackEventBase : public Event {
 
   public:
-    LoopBackEventBase( int _core ) : Event(), core( _core ) {}
+    LoopBackEventBase( int _core, size_t _bytes = 0 ) : Event(), core( _core ), bytes( _bytes ), copied( false ) {}
     int core;
+    size_t bytes;   // payload the destination core copies out of the source core's memory
+    bool copied;    // set when the loopBack charged the copy on the node's memory
 
     NotSerializable(LoopBackEventBase)
 };
@@ -43,6 +45,11 @@ class LoopBack : public SST::Component  {
     SST_ELI_DOCUMENT_PARAMS(
         {"numCores","Sets the number cores to create links to", "1"},
         {"nicsPerNode","Sets the number of NICs for the node", "1"},
+        {"copyBandwidth","Memory bandwidth the node's cores share for single copy intra-node messages, 0 leaves the copy to each core's rx memcpy model", "0GB/s"},
+    )
+    SST_ELI_DOCUMENT_STATISTICS(
+        { "copy_wait_ns", "Time an intra-node message waited for the node's memory behind other copies", "ns", 1 },
+        { "copy_bytes", "Bytes copied between cores of the node", "bytes", 1 },
     )
     SST_ELI_DOCUMENT_PORTS(
         {"nic%(nicsPerNode)dcore%(num_vNics/nicsPerNode)d", "Ports connected to the network driver", {}}
@@ -54,6 +61,11 @@ class LoopBack : public SST::Component  {
 
   private:
     std::vector<Link*>          m_links;
+
+    double                      m_copyBandwidth; // bytes per ns, 0 when off
+    double                      m_copyBusyUntil_ns;
+    Statistic<uint64_t>*        m_statCopyWait;
+    Statistic<uint64_t>*        m_statCopyBytes;
 };
 
 }
@@ -13,28 +13,24 @@
 // information, see the LICENSE file in the top level directory of the
 // distribution.
 
+// Set associative LRU cache of page tags. The tags, their ages and the
+// valid bits of all the sets are in flat arrays indexed by set * assoc + way,
+// a lookup touches one contiguous run of assoc entries.
 class NWayCache {
 public:
-    NWayCache( int assoc, uint32_t nSets, int pageSize ) : m_pageShift(0), m_setShift(0), m_setMask( nSets-1 ) {
-        //printf("%s():%d assoc=%d nSets=%d pageSize=%d setMask=%#lx\n",__func__,__LINE__,assoc, nSets, pageSize,m_setMask);
-        for ( unsigned i = 0; i < nSets; i++ ) {
-            m_sets.push_back( new Cache( assoc ) );
-            m_stats.push_back( std::make_pair(0,0) );
-        }
-        //printf("%s():%d %#x\n",__func__,__LINE__,pageSize);
+    NWayCache( int assoc, uint32_t nSets, int pageSize ) : m_assoc( assoc ), m_pageShift(0), m_setShift(0), m_setMask( nSets-1 ),
+        m_tags( assoc * nSets, 0 ), m_ages( assoc * nSets, 0 ), m_valid( assoc * nSets, false ), m_clock( nSets, 0 )
+    {
+        m_stats.resize( nSets, std::make_pair(0,0) );
 
         m_pageShift = calcPow( pageSize );
         m_setShift = calcPow( nSets );
-
-        printf("%s():%d m_setMask=%" PRIx64 " m_pageShift=%d m_setShift=%d\n",__func__,__LINE__,m_setMask,m_pageShift,m_setShift);
     }
 
     bool isValid( Hermes::Vaddr addr ) {
         int set = addrToSet(addr);
-        uint64_t tag = addrToTag( addr );
-        printf("%s():%d %#" PRIx64 " set=%#x tag=%#" PRIx64 "  \n",__func__,__LINE__,addr, set, tag );
         ++m_stats[set].first;
-        bool rc = m_sets[set]->isValid( addr );
+        bool rc = findWay( set, addrToTag( addr ) ) >= 0;
         if ( rc ) {
             ++m_stats[set].second;
         }
@@ -43,20 +39,32 @@ public:
 
     void updateAge( Hermes::Vaddr addr ) {
         int set = addrToSet(addr);
-        uint64_t tag = addrToTag( addr );
-        m_sets[set]->updateAge( addr );
+        int way = findWay( set, addrToTag( addr ) );
+        assert( way >= 0 );
+        m_ages[ set * m_assoc + way ] = ++m_clock[set];
     }
 
+    // Free the least recently used way of the set addr maps to, returns the
+    // address that was there, -1 if the way was never used
     Hermes::Vaddr evict( Hermes::Vaddr addr ) {
         int set = addrToSet(addr);
-        uint64_t tag = addrToTag( addr );
-        return m_sets[set]->evict( );
+        int way = lruWay( set );
+        size_t pos = set * m_assoc + way;
+        if ( ! m_valid[pos] ) {
+            return -1;
+        }
+        m_valid[pos] = false;
+        return ( m_tags[pos] << ( m_pageShift + m_setShift ) ) | ( (uint64_t) set << m_pageShift );
     }
 
     void insert( Hermes::Vaddr addr ) {
         int set = addrToSet(addr);
         uint64_t tag = addrToTag( addr );
-        m_sets[set]->insert( addr );
+        assert( findWay( set, tag ) < 0 );
+        size_t pos = set * m_assoc + freeWay( set );
+        m_tags[pos] = tag;
+        m_valid[pos] = true;
+        m_ages[pos] = ++m_clock[set];
     }
 
     void printStats( Output& output ) {
@@ -68,12 +76,52 @@ public:
     }
 
 private:
+    int m_assoc;
     uint64_t m_setMask;
     int m_pageShift;
     int m_setShift;
-    std::vector<Cache*> m_sets;
+    std::vector<uint64_t> m_tags;
+    std::vector<uint64_t> m_ages;
+    std::vector<bool> m_valid;
+    std::vector<uint64_t> m_clock;
     std::vector<std::pair<uint64_t,uint64_t> > m_stats;
 
+    int findWay( int set, uint64_t tag ) {
+        size_t base = set * m_assoc;
+        for ( int way = 0; way < m_assoc; way++ ) {
+            if ( m_valid[base + way] && m_tags[base + way] == tag ) {
+                return way;
+            }
+        }
+        return -1;
+    }
+
+    // an unused way counts as the oldest
+    int lruWay( int set ) {
+        size_t base = set * m_assoc;
+        int lru = 0;
+        for ( int way = 0; way < m_assoc; way++ ) {
+            if ( ! m_valid[base + way] ) {
+                return way;
+            }
+            if ( m_ages[base + way] < m_ages[base + lru] ) {
+                lru = way;
+            }
+        }
+        return lru;
+    }
+
+    int freeWay( int set ) {
+        size_t base = set * m_assoc;
+        for ( int way = 0; way < m_assoc; way++ ) {
+            if ( ! m_valid[base + way] ) {
+                return way;
+            }
+        }
+        assert( 0 );
+        return 0;
+    }
+
     int calcPow( double val ) {
         int x = 0;
         while( val > 1 ) {
@@ -85,14 +133,10 @@ private:
     }
 
     int addrToSet( Hermes::Vaddr addr ) {
-        int set = (addr >> m_pageShift) & m_setMask;
-        //printf("%s():%d %#lx set=%#lx\n",__func__,__LINE__,addr,set);
-        return set;
+        return (addr >> m_pageShift) & m_setMask;
     }
 
     uint64_t addrToTag( Hermes::Vaddr addr ) {
-        int tag = (addr >> (m_pageShift + m_setShift));
-        //printf("%s():%d %#lx tag=%#lx\n",__func__,__LINE__,addr,tag);
-        return tag;
+        return addr >> (m_pageShift + m_setShift);
     }
 };
@@ -74,6 +74,7 @@ public:
 		{"useDetailedModel",    "Sets whether or not a detailed memory model is used","no"},
 		{"useBusBridge",        "Sets whether or not a bus is used between the NIC and host","yes"},
 		{"printConfig",         "Print the config","no"},
+		{"timingWheelSize",     "Sets the number of 1ns slots in the timing wheel that batches the unit callbacks, a power of 2, 0 sends an event per callback","0"},
     )
 
     SST_ELI_DOCUMENT_STATISTICS(
@@ -129,19 +130,22 @@ public:
 #include "memUnit.h"
 #include "cacheUnit.h"
 #include "detailedUnit.h"
+#include "timingWheel.h"
 
 
     class SelfEvent : public SST::Event {
       public:
-        void init( int _slot, Work* _work = NULL ) { callback = NULL;  unit = NULL; slot = _slot; work = _work; }
-        void init( Callback* _callback ) { callback= _callback; unit = NULL; work = NULL; }
-        void init( UnitBase* _unit, UnitBase* _srcUnit = NULL ) { callback = NULL; unit = _unit; srcUnit = _srcUnit; work = NULL; }
+        void init( int _slot, Work* _work = NULL ) { callback = NULL;  unit = NULL; slot = _slot; work = _work; wheel = false; }
+        void init( Callback* _callback ) { callback= _callback; unit = NULL; work = NULL; wheel = false; }
+        void init( UnitBase* _unit, UnitBase* _srcUnit = NULL ) { callback = NULL; unit = _unit; srcUnit = _srcUnit; work = NULL; wheel = false; }
+        void init() { callback = NULL; unit = NULL; work = NULL; wheel = true; }
 
 		Callback* callback;
 		UnitBase* unit;
 		UnitBase* srcUnit;
 		Work* work;
 		int slot;
+		bool wheel;
 
         NotSerializable(SelfEvent)
     };
@@ -277,6 +281,15 @@ public:
 			);
 		}
 
+		m_timingWheel = NULL;
+		int timingWheelSize = params.find<int>( "timingWheelSize", 0 );
+		if ( timingWheelSize ) {
+			if ( timingWheelSize < 0 || ( timingWheelSize & ( timingWheelSize - 1 ) ) ) {
+				m_dbg.fatal(CALL_INFO,0,"timingWheelSize must be a power of 2, requested %d\n",timingWheelSize);
+			}
+			m_timingWheel = new TimingWheel( timingWheelSize );
+		}
+
 		m_selfLink = configureSelfLink("Nic::SimpleMemoryModel", "1 ns",
         new Event::Handler<SimpleMemoryModel>(this,&SimpleMemoryModel::handleSelfEvent));
 	}
@@ -290,6 +303,9 @@ public:
         }
 		delete m_sharedTlb;
 		delete m_nicUnit;
+		if ( m_timingWheel ) {
+			delete m_timingWheel;
+		}
     }
 
 	ThingHeap<SelfEvent> m_eventHeap;
@@ -300,11 +316,26 @@ public:
 	}
 
 	void schedCallback( SimTime_t delay, Callback* callback ){
-		SelfEvent* ev = m_eventHeap.alloc( );
-		ev->init( callback );
+		SelfEvent* ev;
+		if ( m_timingWheel && delay < m_timingWheel->numSlots() ) {
+			if ( ! m_timingWheel->insert( getCurrentSimTimeNano(), delay, callback ) ) {
+				return;
+			}
+			ev = m_eventHeap.alloc( );
+			ev->init( );
+		} else {
+			ev = m_eventHeap.alloc( );
+			ev->init( callback );
+		}
 		m_selfLink->send( delay , ev );
 	}
 	void schedResume( SimTime_t delay, UnitBase* unit, UnitBase* srcUnit = NULL ){
+		if ( m_timingWheel ) {
+			Callback* callback = new Callback;
+			*callback = std::bind( &UnitBase::resume, unit, srcUnit );
+			schedCallback( delay, callback );
+			return;
+		}
 		SelfEvent* ev = m_eventHeap.alloc( );
 		ev->init( unit, srcUnit );
 		m_selfLink->send( delay , ev );
@@ -314,7 +345,10 @@ public:
 
 		SimTime_t now = getCurrentSimTimeNano();
 		SelfEvent* event = static_cast<SelfEvent*>(ev);
-		if ( event->callback ) {
+		if ( event->wheel ) {
+			m_dbg.debug(CALL_INFO,3,SM_MASK,"timing wheel\n");
+			m_timingWheel->run( now );
+		} else if ( event->callback ) {
 			m_dbg.debug(CALL_INFO,3,SM_MASK,"callback\n");
 			(*event->callback)();
 			delete event->callback;
@@ -337,7 +371,11 @@ public:
 	void addWork( int slot, Work* work ) {
 		// we send an event to ourselves to break the call chain, we will eventually call a
 		// callback provided by the caller of this function, this call back may re-enter here
-		if ( m_threads[slot]->isIdle() ) {
+		if ( m_threads[slot]->isIdle() && m_timingWheel ) {
+			Callback* callback = new Callback;
+			*callback = std::bind( &Thread::addWork, m_threads[slot], work );
+			schedCallback( 0, callback );
+		} else if ( m_threads[slot]->isIdle() ) {
 			SelfEvent* ev = m_eventHeap.alloc();
 			ev->init( slot, work );
 		    m_selfLink->send( 0 , ev );
@@ -390,6 +428,7 @@ public:
   private:
 
 	Link* m_selfLink;
+	TimingWheel* m_timingWheel;
 
 	Unit*			m_detailedUnit;
 	MuxUnit* 		m_muxUnit;
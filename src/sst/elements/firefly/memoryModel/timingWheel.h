@@ -0,0 +1,49 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+// Holds the unit callbacks due in the next numSlots ns, one slot per ns. The
+// model sends itself one event per slot that has callbacks instead of one
+// per callback, and a callback scheduled with no delay while a slot is run
+// is run in the same pass, so the chains of 0 delay hand offs between units
+// cost no events at all.
+class TimingWheel {
+  public:
+    TimingWheel( int numSlots ) : m_slots( numSlots ), m_mask( numSlots - 1 ) {}
+
+    size_t numSlots() { return m_slots.size(); }
+
+    // Add a callback due delay ns after now, true if its slot was empty and
+    // needs an event, delay must be less than numSlots()
+    bool insert( SimTime_t now, SimTime_t delay, Callback* callback ) {
+        assert( delay < m_slots.size() );
+        std::vector<Callback*>& slot = m_slots[ ( now + delay ) & m_mask ];
+        slot.push_back( callback );
+        return 1 == slot.size();
+    }
+
+    // Run the callbacks due now, including the ones they add for now
+    void run( SimTime_t now ) {
+        std::vector<Callback*>& slot = m_slots[ now & m_mask ];
+        for ( size_t i = 0; i < slot.size(); i++ ) {
+            (*slot[i])();
+            delete slot[i];
+        }
+        slot.clear();
+    }
+
+  private:
+    std::vector< std::vector<Callback*> > m_slots;
+    SimTime_t   m_mask;
+};
@@ -18,6 +18,10 @@
 #define COMPONENTS_FIREFLY_MERLINEVENT_H
 
 #include <sst/core/interfaces/simpleNetwork.h>
+#include <sst/elements/pool/objectPool.h>
+
+#include <memory>
+#include <vector>
 
 #define NUM_NODE_BITS     20
 #define NUM_PID_BITS      12
@@ -26,19 +30,25 @@
 namespace SST {
 namespace Firefly {
 
+// The payload bytes live in a buffer shared by the event and its clones, it
+// is only allocated when bytes are appended so a packet that carries no
+// data (no backing memory, or the NIC's timing payload mode) allocates
+// nothing. Appending to a shared buffer copies it first.
 class FireflyNetworkEvent : public Event {
 
+    typedef std::vector<unsigned char> Buffer;
+
   public:
 
-    FireflyNetworkEvent( ) : offset(0), bufLen(0), m_isHdr(false), m_isTail(false), m_isCtrl(false), pktOverhead(0) {
-        buf.reserve( 1000 );
-        assert( 0 == buf.size() );
+    SST_ELEMENT_POOL_OPERATORS(SST::Firefly::FireflyNetworkEvent)
+
+    FireflyNetworkEvent( ) : m_isHdr(false), m_isTail(false), m_isCtrl(false), pktOverhead(0),
+            offset(0), bufLen(0), bufReserve(1000), m_isFlow(false), flowNetLen(0), flowBW(0) {
     }
 
-    FireflyNetworkEvent( int pktOverhead, size_t reserve = 1000 ) : offset(0), bufLen(0),
-            m_isHdr(false), m_isTail(false), m_isCtrl(false), pktOverhead(pktOverhead) {
-        buf.reserve( reserve );
-        assert( 0 == buf.size() );
+    FireflyNetworkEvent( int pktOverhead, size_t reserve = 1000 ) :
+            m_isHdr(false), m_isTail(false), m_isCtrl(false), pktOverhead(pktOverhead),
+            offset(0), bufLen(0), bufReserve(reserve), m_isFlow(false), flowNetLen(0), flowBW(0) {
     }
 
     void setCtrl() { m_isCtrl = true; }
@@ -48,7 +58,16 @@ class FireflyNetworkEvent : public Event {
     bool isHdr() { return m_isHdr; }
     void setTail() { m_isTail = true; }
     bool isTail() { return m_isTail; }
-    int calcPayloadSizeInBits() { return payloadSize() * 8; }
+
+    // A flow carries a whole message in one event, the network only moves
+    // the headers already in the buffer and the rest of the payload is timed
+    // by the NIC from the flow bandwidth
+    void setFlow() { m_isFlow = true; flowNetLen = bufLen; }
+    bool isFlow() { return m_isFlow; }
+    void setFlowBW( uint64_t bytesPerSec ) { flowBW = bytesPerSec; }
+    uint64_t getFlowBW() { return flowBW; }
+
+    int calcPayloadSizeInBits() { return ( m_isFlow ? pktOverhead + flowNetLen : payloadSize() ) * 8; }
     int payloadSize() { return pktOverhead + bufSize(); }
 
     void setSrcNode( int node ) { 
@@ -81,8 +100,8 @@ class FireflyNetworkEvent : public Event {
         return ( bufLen == offset );
     }
     void* bufPtr( size_t len = 0 ) {
-        if ( offset + len < buf.size() ) {
-            return &buf[offset + len];
+        if ( buf && offset + len < buf->size() ) {
+            return &(*buf)[offset + len];
         } else {
             return NULL;
         }
@@ -96,8 +115,14 @@ class FireflyNetworkEvent : public Event {
 
     void bufAppend( const void* ptr , size_t len ) {
         if ( ptr ) {
-            buf.resize( bufLen + len);
-            memcpy( &buf[bufLen], (const char*) ptr, len );
+            if ( ! buf ) {
+                buf = std::make_shared<Buffer>();
+                buf->reserve( bufReserve );
+            } else if ( buf.use_count() > 1 ) {
+                buf = std::make_shared<Buffer>( *buf );
+            }
+            buf->resize( bufLen + len);
+            memcpy( &(*buf)[bufLen], (const char*) ptr, len );
         }
         bufLen += len;
     }
@@ -115,6 +140,11 @@ class FireflyNetworkEvent : public Event {
         m_isTail = me->m_isTail;
         m_isCtrl = me->m_isCtrl;
         offset = me->offset;
+        bufLen = me->bufLen;
+        bufReserve = me->bufReserve;
+        m_isFlow = me->m_isFlow;
+        flowNetLen = me->flowNetLen;
+        flowBW = me->flowBW;
         pktOverhead = me->pktOverhead;
     }
 
@@ -131,6 +161,11 @@ class FireflyNetworkEvent : public Event {
         m_isTail = me.m_isTail;
         m_isCtrl = me.m_isCtrl;
         offset = me.offset;
+        bufLen = me.bufLen;
+        bufReserve = me.bufReserve;
+        m_isFlow = me.m_isFlow;
+        flowNetLen = me.flowNetLen;
+        flowBW = me.flowBW;
         pktOverhead = me.pktOverhead;
     }
 
@@ -164,7 +199,12 @@ class FireflyNetworkEvent : public Event {
 
     size_t          offset;
     size_t          bufLen;
-    std::vector<unsigned char>     buf;
+    size_t          bufReserve;
+    std::shared_ptr<Buffer>     buf;
+
+    bool            m_isFlow;
+    size_t          flowNetLen;
+    uint64_t        flowBW;
 
   public:
     void serialize_order(SST::Core::Serialization::serializer &ser)  override {
@@ -172,7 +212,11 @@ class FireflyNetworkEvent : public Event {
         ser & seq;
         ser & offset;
         ser & bufLen;
-        ser & buf;
+        ser & bufReserve;
+        if ( ser.mode() == SST::Core::Serialization::serializer::UNPACK || ! buf ) {
+            buf = std::make_shared<Buffer>();
+        }
+        ser & *buf;
         ser & srcNode;
         ser & srcPid;
         ser & srcStream;
@@ -181,6 +225,9 @@ class FireflyNetworkEvent : public Event {
         ser & m_isHdr;
         ser & m_isTail;
         ser & m_isCtrl;
+        ser & m_isFlow;
+        ser & flowNetLen;
+        ser & flowBW;
     }
 
     ImplementSerializable(SST::Firefly::FireflyNetworkEvent);
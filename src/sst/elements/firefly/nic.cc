@@ -41,6 +41,7 @@ Nic::Nic(ComponentId_t id, Params &params) :
     m_memoryModel(NULL),
     m_respKey(1),
 	m_predNetIdleTime(0),
+    m_numActiveFlows(0),
     m_linkBytesPerSec(0),
 	m_detailedInterface(NULL),
     m_getHdrVN(0),
@@ -110,6 +111,14 @@ Nic::Nic(ComponentId_t id, Params &params) :
     if ( Nic::EntryBase::m_alignment == 0 ) {
         m_dbg.fatal(CALL_INFO,-1,"Error:  messageSendAlignment must be greater than 0 \n");
     }
+    std::string messageModel = params.find<std::string>( "messageModel", "packet" );
+    if ( messageModel == "packet" ) {
+        m_flowModel = false;
+    } else if ( messageModel == "flow" ) {
+        m_flowModel = true;
+    } else {
+        m_dbg.fatal(CALL_INFO,-1,"Error: unknown messageModel %s, must be packet or flow\n", messageModel.c_str() );
+    }
     int numSendMachines = params.find<int>( "numSendMachines",1);
     if ( numSendMachines < 1 ) {
         m_dbg.fatal(CALL_INFO,-1,"Error: numSendMachines must be greater than 1, requested %d\n",numSendMachines);
@@ -612,9 +621,13 @@ void Nic::feedTheNetwork( int vn )
 			m_dbg.debug(CALL_INFO,1,NIC_DBG_SEND_NETWORK,"predNetIdleTime=%" PRI_SIMTIME "\n",m_predNetIdleTime );
 			m_dbg.debug(CALL_INFO,1,NIC_DBG_SEND_NETWORK,"p1=%" PRI_SIMTIME " p2=%d\n", entry->p1(), entry->p2() );
 
-			sendPkt( x.pkt, x.dest, vn );
+			if ( x.pkt->isFlow() ) {
+				sendFlow( x.pkt, x.dest, vn, x.callback );
+			} else {
+				sendPkt( x.pkt, x.dest, vn );
 
-			x.callback();
+				x.callback();
+			}
 
 			delete &x;
 			delete entry;
@@ -623,6 +636,30 @@ void Nic::feedTheNetwork( int vn )
 	}
 }
 
+// A flow gets an even share of the link with the flows already being sent
+// and the receiver lowers that to its own share when the headers arrive, the
+// send is done once the payload would have left at that rate
+void Nic::sendFlow( FireflyNetworkEvent* ev, int dest, int vn, Callback callback )
+{
+    if ( 0 == m_linkBytesPerSec ) {
+        m_dbg.fatal(CALL_INFO,-1,"Error: messageModel flow needs the link bandwidth, the network is not initialized\n");
+    }
+
+    uint64_t share = m_linkBytesPerSec / ++m_numActiveFlows;
+    SimTime_t delay = calcFlowDelay_ns( ev->bufSize(), share );
+
+    m_dbg.debug(CALL_INFO,2,NIC_DBG_SEND_NETWORK,"flow bytes=%zu share=%" PRIu64 " activeFlows=%d delay=%" PRIu64 " ns\n",
+                    ev->bufSize(), share, m_numActiveFlows, delay );
+
+    ev->setFlowBW( share );
+    sendPkt( ev, dest, vn );
+
+    schedCallback( [=]() {
+            --m_numActiveFlows;
+            callback();
+        }, delay );
+}
+
 void Nic::sendPkt( FireflyNetworkEvent* ev, int dest, int vn )
 {
     assert( ev->bufSize() );
@@ -630,7 +667,7 @@ void Nic::sendPkt( FireflyNetworkEvent* ev, int dest, int vn )
     m_sentPkts->addData(1);
 
 
-    SimpleNetwork::Request* req = new SimpleNetwork::Request();
+    SimpleNetwork::Request* req = m_requestRecycler.get();
     req->dest = IdToNet( dest );
     req->src = IdToNet( m_myNodeId );
     req->size_in_bits = ev->calcPayloadSizeInBits();
@@ -27,6 +27,7 @@
 
 #include "sst/elements/hermes/shmemapi.h"
 #include "sst/elements/thornhill/detailedCompute.h"
+#include "sst/elements/pool/requestRecycler.h"
 #include "ioVec.h"
 #include "merlinEvent.h"
 //#include "memoryModel/trivialMemoryModel.h"
@@ -104,11 +105,15 @@ public:
         { "nicAllocationPolicy", "Allocation policy for Nic", "RoundRobin"},
         { "packetOverhead", "Sets the overhead of a network packet", "0"},
         { "packetSize", "Sets the size of the network packet in bits or bytes" },
+        { "messageModel", "Sets how messages cross the network, packet sends every packet through the network, flow sends a message as one event carrying only its headers through the network and times the payload from the link bandwidth shared evenly by the flows at the sender and at the receiver", "packet" },
 
         { "corePortName", "Port connected to the core", "core"},
 
         { "shmem.nicCmdLatency", "Latency for posting shmem command on NIC", "10"},
         { "shmem.hostCmdLatency", "Host latency for posting shmem command", "10"},
+        { "shmem.atomicCacheEntries", "Number of lines cached by the NIC atomic unit, remote atomics to a cached line skip the bus, 0 disables the cache", "0"},
+        { "shmem.atomicCacheLineSize", "Line size of the NIC atomic unit cache", "64"},
+        { "shmem.atomicLatency_ns", "Latency of a remote atomic that hits in the NIC atomic unit cache", "10"},
 
         { "FAM_memsize", "", "0"},
         { "FAM_backed", "Controls whether FAM memory is backed in the simlation", "yes"},
@@ -276,14 +281,14 @@ private:
 
     class MemRgnEntry {
       public:
-        MemRgnEntry( std::vector<IoVec>& iovec ) :
+        MemRgnEntry( IoVecList& iovec ) :
             m_iovec( iovec )
         { }
 
-        std::vector<IoVec>& iovec() { return m_iovec; }
+        IoVecList& iovec() { return m_iovec; }
 
       private:
-        std::vector<IoVec>  m_iovec;
+        IoVecList  m_iovec;
 
     };
 
@@ -415,6 +420,10 @@ public:
 		}
 		assert(0);
 	}
+	// time to move bytes at bytesPerSec, for the flow message model
+	static SimTime_t calcFlowDelay_ns( size_t bytes, uint64_t bytesPerSec ) {
+		return ( (double) bytes / (double) bytesPerSec ) * 1000000000 + 0.5;
+	}
 	SimTime_t getDelay_ns( ) {
 		SimTime_t val = m_nic2host_lat_ns - ( m_nic2host_lat_ns > 0 ? 1 : 0 );
 		return val; 
@@ -495,6 +504,8 @@ struct X {
     SST::Link*              m_selfLink;
 
     SST::Interfaces::SimpleNetwork*     m_linkControl;
+    // Requests emptied by the recv machines, reused by sendPkt()
+    SST::ElementPool::RequestRecycler   m_requestRecycler;
     SST::Interfaces::SimpleNetwork::Handler<Nic>* m_recvNotifyFunctor;
     SST::Interfaces::SimpleNetwork::Handler<Nic>* m_sendNotifyFunctor;
     LinkControlWidget* m_linkRecvWidget;
@@ -525,6 +536,7 @@ struct X {
 
     void feedTheNetwork( int vn );
     void sendPkt( FireflyNetworkEvent*, int dest, int vn );
+    void sendFlow( FireflyNetworkEvent*, int dest, int vn, Callback );
     void notifySendDone( SendMachine* mach, SendEntryBase* entry );
 
     void qSendEntry( SendEntryBase* entry );
@@ -648,6 +660,9 @@ struct X {
 	int m_tracedNode;
 	SimTime_t m_predNetIdleTime;
 
+    bool m_flowModel;
+    int  m_numActiveFlows;
+
     int m_getHdrVN;
     int m_getRespSize;
     int m_getRespLargeVN;
@@ -38,7 +38,7 @@ class EntryBase {
     virtual size_t& currentLen() { return m_currentLen; }
     static  int m_alignment;
   private:
-    virtual std::vector<IoVec>& ioVec() = 0;
+    virtual IoVecList& ioVec() = 0;
     virtual size_t& currentVec() { return m_currentVec; }
     virtual size_t& currentPos() { return m_currentPos; }
 
@@ -379,12 +379,12 @@ class NicCmdEvent : public NicCmdBaseEvent {
     int  node;
     int dst_vNic;
     int tag;
-    std::vector<IoVec> iovec;
+    IoVecList iovec;
     void* key;
     int vn;
 
     NicCmdEvent( Type _type, int _vNic, int _node, int _tag,
-            std::vector<IoVec>& _vec, void* _key, int vn = 0 ) :
+            IoVecList& _vec, void* _key, int vn = 0 ) :
         NicCmdBaseEvent(Msg),
         type( _type ),
         node( _node ),
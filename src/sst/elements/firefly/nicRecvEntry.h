@@ -41,7 +41,7 @@ class DmaRecvEntry : public RecvEntryBase {
         m_callback( src_vNic, src_node, tag, length, m_cmd->key );
     }
 
-    std::vector<IoVec>& ioVec() { return m_cmd->iovec; }
+    IoVecList& ioVec() { return m_cmd->iovec; }
     int node()  { return m_cmd->node; }
     int tag() { return m_cmd->tag; }
 
@@ -52,14 +52,14 @@ class DmaRecvEntry : public RecvEntryBase {
 
 class PutRecvEntry : public RecvEntryBase {
   public:
-    PutRecvEntry( std::vector<IoVec>* ioVec ) :
+    PutRecvEntry( IoVecList* ioVec ) :
         RecvEntryBase(), m_ioVec( *ioVec )
     { }
 
-    std::vector<IoVec>& ioVec() { return m_ioVec; }
+    IoVecList& ioVec() { return m_ioVec; }
 
   private:
-    std::vector<IoVec> m_ioVec;
+    IoVecList m_ioVec;
 };
 
 class ShmemRecvEntry : public RecvEntryBase {
@@ -84,7 +84,7 @@ class ShmemRecvEntry : public RecvEntryBase {
     void notify( int src_vNic, int src_node, int tag, size_t length ) {}
 
     size_t totalBytes( ) { return m_shmemMove->totalBytes(); }
-    std::vector<IoVec>& ioVec() { assert(0); }
+    IoVecList& ioVec() { assert(0); }
 
     bool copyIn( Output& dbg, FireflyNetworkEvent& ev, std::vector<MemOp>& vec ) {
         return m_shmemMove->copyIn( dbg, ev, vec );
@@ -106,7 +106,7 @@ class ShmemGetRespRecvEntry : public RecvEntryBase {
     }
 
     size_t totalBytes( ) { return m_shmemMove->totalBytes(); }
-    std::vector<IoVec>& ioVec() { assert(0); }
+    IoVecList& ioVec() { assert(0); }
 
     bool copyIn( Output& dbg, FireflyNetworkEvent& ev, std::vector<MemOp>& vec ) {
         return m_shmemMove->copyIn( dbg, ev, vec );
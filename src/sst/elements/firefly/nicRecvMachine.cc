@@ -81,6 +81,41 @@ void Nic::RecvMachine::processStdPkt( FireflyNetworkEvent* ev ) {
     }
 }
 
+// The headers of a flow arrived, the payload arrives at the lower of the sender's
+// share of its link and an even share of ours with the other flows arriving
+void Nic::RecvMachine::recvFlow( FireflyNetworkEvent* ev ) {
+    ProcessPairId ppi = getPPI( ev );
+    uint64_t share = m_nic.m_linkBytesPerSec / ++m_numActiveFlows;
+    uint64_t rate = ev->getFlowBW() < share ? ev->getFlowBW() : share;
+
+    SimTime_t now = m_nic.getCurrentSimTimeNano();
+    SimTime_t done = now + Nic::calcFlowDelay_ns( ev->bufSize(), rate );
+
+    auto iter = m_flowDone.find( ppi );
+    if ( iter != m_flowDone.end() && iter->second > done ) {
+        done = iter->second;
+    }
+    m_flowDone[ppi] = done;
+
+    m_dbg.debug(CALL_INFO,1,NIC_DBG_RECV_MACHINE,"flow from node=%d pid=%d for pid=%d bytes=%zu rate=%" PRIu64 " activeFlows=%d delay=%" PRIu64 " ns\n",
+                        ev->getSrcNode(), ev->getSrcPid(), ev->getDestPid(), ev->bufSize(), rate, m_numActiveFlows, done - now );
+
+    nic().schedCallback( std::bind( &Nic::RecvMachine::flowDone, this, ev ), done - now );
+}
+
+void Nic::RecvMachine::flowDone( FireflyNetworkEvent* ev ) {
+    ProcessPairId ppi = getPPI( ev );
+    --m_numActiveFlows;
+
+    if ( m_flowDone[ppi] <= m_nic.getCurrentSimTimeNano() ) {
+        m_flowDone.erase( ppi );
+    }
+
+    ++m_numActiveStreams;
+    m_dbg.debug(CALL_INFO,1,NIC_DBG_RECV_MACHINE, "flow delivered numActiveStreams=%d\n",m_numActiveStreams);
+    processPkt( ev );
+}
+
 void Nic::RecvMachine::printStatus( Output& out ) {
 #ifdef NIC_RECV_DEBUG
     if ( m_nic.m_linkControl->requestToReceive( 0 ) ) {
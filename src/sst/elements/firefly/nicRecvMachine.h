@@ -60,7 +60,8 @@ class RecvMachine {
             m_clockLat(1),
             m_clocking(false),
             m_numPendingPkts(0),
-            m_maxPendingPkts(maxPendingPkts)
+            m_maxPendingPkts(maxPendingPkts),
+            m_numActiveFlows(0)
         {
             char buffer[100];
             snprintf(buffer,100,"@t:%d:Nic::RecvMachine::@p():@l vn=%d ",nodeId,m_vn);
@@ -103,6 +104,8 @@ class RecvMachine {
 	private:
         void processPkt( FireflyNetworkEvent* ev );
         void processStdPkt( FireflyNetworkEvent* ev );
+        void recvFlow( FireflyNetworkEvent* ev );
+        void flowDone( FireflyNetworkEvent* ev );
 
         void setNotify( ) {
             m_dbg.debug(CALL_INFO,2,NIC_DBG_RECV_MACHINE, "\n");
@@ -139,7 +142,11 @@ class RecvMachine {
 				m_dbg.debug(CALL_INFO,2,NIC_DBG_RECV_MACHINE, "packet from node=%d pid=%d for pid=%d %s %s PPI=0x%" PRIx64 " stream=%d\n",
 						ev->getSrcNode(),ev->getSrcPid(),ev->getDestPid(),ev->isHdr() ? "hdr":"",ev->isTail() ? "tail":"",getPPI(ev),ev->getSrcStream());
 
-				if ( ev->isCtrl() ) {
+				if ( ev->isFlow() ) {
+					--m_numPendingPkts;
+					iter->second.pop();
+					recvFlow( ev );
+				} else if ( ev->isCtrl() ) {
 					++m_numActiveStreams;
 					m_dbg.debug(CALL_INFO,1,NIC_DBG_RECV_MACHINE, "ctrl packet numActiveStreams=%d m_numPendingPkts=%d\n",m_numActiveStreams,m_numPendingPkts-1);
 					processPkt( ev );
@@ -202,7 +209,7 @@ class RecvMachine {
                     static_cast<FireflyNetworkEvent*>(payload);
                 event->setSrcNode( m_nic.NetToId( req->src ) );
 				m_nic.m_rcvdByteCount->addData( event->payloadSize() );
-                delete req;
+                m_nic.m_requestRecycler.recycle( req );
                 if ( ! event->isCtrl() && event->isHdr() ) {
                     ++m_numMsgRcvd;
                 }
@@ -225,5 +232,9 @@ class RecvMachine {
         bool        m_clocking;
 
         std::unordered_map<ProcessPairId, std::queue<FireflyNetworkEvent*> > m_pktBuf;
+
+        int m_numActiveFlows;
+        // when the last flow between a pair of processes is delivered, flows are delivered in order
+        std::unordered_map<ProcessPairId, SimTime_t> m_flowDone;
         std::unordered_map<StreamKey, StreamBase* >  m_streamMap;
 };
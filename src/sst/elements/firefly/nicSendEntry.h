@@ -68,7 +68,7 @@ class CmdSendEntry: public SendEntryBase, public EntryBase {
         delete m_cmd;
     }
 
-    std::vector<IoVec>& ioVec() { return m_cmd->iovec; }
+    IoVecList& ioVec() { return m_cmd->iovec; }
     size_t totalBytes() { return m_hdr.len; }
     bool isDone()       { return EntryBase::isDone(); }
     void copyOut( Output& dbg, int numBytes,
@@ -137,7 +137,7 @@ class GetOrgnEntry : public MsgSendEntry {
 
   private:
     RdmaMsgHdr          m_hdr;
-    std::vector<IoVec> m_ioVec;
+    IoVecList m_ioVec;
     int                m_vn;
 };
 
@@ -156,7 +156,7 @@ class PutOrgnEntry : public MsgSendEntry, public EntryBase {
 
     ~PutOrgnEntry()             { delete m_memRgn; }
 
-    std::vector<IoVec>& ioVec() { return m_memRgn->iovec(); }
+    IoVecList& ioVec() { return m_memRgn->iovec(); }
 
     void copyOut( Output& dbg, int numBytes,
                 FireflyNetworkEvent& event, std::vector<MemOp>& vec ) {
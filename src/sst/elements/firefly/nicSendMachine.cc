@@ -59,7 +59,13 @@ void Nic::SendMachine::getPayload( SendEntryBase* entry, FireflyNetworkEvent* ev
     ev->setSrcStream( entry->streamNum() );
     if ( ! m_inQ->isFull() ) {
 	    std::vector< MemOp >* vec = new std::vector< MemOp >;
-        entry->copyOut( m_dbg, m_packetSizeInBytes, *ev, *vec );
+        if ( m_nic.m_flowModel && ! m_I_manage && entry->getOp() != MsgHdr::Shmem ) {
+            // the whole message goes in one flow event, the headers already in it are what the network moves
+            ev->setFlow();
+            entry->copyOut( m_dbg, ev->bufSize() + entry->totalBytes() + EntryBase::m_alignment, *ev, *vec );
+        } else {
+            entry->copyOut( m_dbg, m_packetSizeInBytes, *ev, *vec );
+        }
         m_dbg.debug(CALL_INFO,2,NIC_DBG_SEND_MACHINE, "enque load from host, %lu bytes\n",ev->bufSize());
         if ( entry->isDone() ) {
             ev->setTail();
@@ -742,21 +742,23 @@ void Nic::Shmem::checkWaitOps( int core, Hermes::Vaddr addr, size_t length )
 {
     m_dbg.verbosePrefix( prefix(),CALL_INFO,3,NIC_DBG_SHMEM,"core=%d addr=%" PRIx64" len=%lu\n", core, addr, length );
 
-    std::list<Op*>::iterator iter = m_pendingOps[core].begin();
+    std::vector<Op*>& ops = m_pendingOps[core];
 
-    while ( iter != m_pendingOps[core].end() ) {
+    // satisfied waits are dropped and the rest are packed down in order
+    size_t keep = 0;
+    for ( size_t i = 0; i < ops.size(); i++ ) {
 
         m_dbg.verbosePrefix( prefix(),CALL_INFO,3,NIC_DBG_SHMEM,"check op\n" );
-        Op* op = *iter;
+        Op* op = ops[i];
         if ( op->inRange( addr, length ) && op->checkOp( m_dbg, core ) ) {
 
         	m_dbg.verbosePrefix( prefix(),CALL_INFO,1,NIC_DBG_SHMEM,"op valid, notify\n");
 			m_nic.schedCallback( op->callback(), m_nic2HostDelay_ns );
             delete op;
-            iter = m_pendingOps[core].erase(iter);
         } else {
-            ++iter;
+            ops[keep++] = op;
         }
     }
+    ops.resize( keep );
 }
 
@@ -102,6 +102,14 @@ class Shmem {
 		m_pendingGets.resize( numVnics );
 		m_nicCmdLatency =    params.find<int>( "nicCmdLatency", 10 );
 		m_hostCmdLatency =   params.find<int>( "hostCmdLatency", 10 );
+
+		AtomicLine invalid = { -1, 0 };
+		m_atomicCache.resize( params.find<int>( "atomicCacheEntries", 0 ), invalid );
+		m_atomicLineSize =   params.find<int>( "atomicCacheLineSize", 64 );
+		m_atomicLatency_ns = params.find<int>( "atomicLatency_ns", 10 );
+		if ( m_atomicLineSize <= 0 ) {
+			m_dbg.fatal(CALL_INFO,-1,"shmem.atomicCacheLineSize must be greater than 0\n");
+		}
 	}
     ~Shmem() {
         m_regMem.clear();
@@ -171,6 +179,23 @@ class Shmem {
 
     void checkWaitOps( int core, Hermes::Vaddr addr, size_t length );
 
+    // The NIC atomic unit keeps the lines it last operated on, an
+    // atomic to one of them isn't sent over the bus. A miss brings the
+    // line in. The values always live in the backing store, so this
+    // only changes timing and puts don't need to invalidate it.
+    bool atomicCacheHit( int core, Hermes::Vaddr addr ) {
+        if ( m_atomicCache.empty() ) return false;
+        Hermes::Vaddr line = addr / m_atomicLineSize;
+        AtomicLine& entry = m_atomicCache[ ( line + core ) % m_atomicCache.size() ];
+        if ( entry.core == core && entry.line == line ) {
+            return true;
+        }
+        entry.core = core;
+        entry.line = line;
+        return false;
+    }
+    SimTime_t getAtomicLatency_ns() { return m_atomicLatency_ns; }
+
 private:
 	SimTime_t getNic2HostDelay_ns() { return m_nic2HostDelay_ns; }
 	SimTime_t getHost2NicDelay_ns() { return m_host2NicDelay_ns; }
@@ -211,7 +236,17 @@ private:
 	std::vector< std::pair< Hermes::Vaddr, Hermes::Value > > m_pendingGets;
     Nic& m_nic;
     Output& m_dbg;
-    std::vector< std::list<Op*> > m_pendingOps;
+    // waits in the order they were posted
+    std::vector< std::vector<Op*> > m_pendingOps;
+
+    // direct mapped, indexed by line and core
+    struct AtomicLine {
+        int core;
+        Hermes::Vaddr line;
+    };
+    std::vector< AtomicLine > m_atomicCache;
+    Hermes::Vaddr m_atomicLineSize;
+    SimTime_t m_atomicLatency_ns;
 
     std::vector<std::vector< RegionEntry > > m_regMem;
 	SimTime_t m_nic2HostDelay_ns;
@@ -90,6 +90,35 @@ void Nic::RecvMachine::ShmemStream::processOp( FireflyNetworkEvent* ev )
     }
 }
 
+// Remote atomics go to memory unless the NIC atomic unit already has
+// the line, then they only take the atomic unit latency. The callbacks
+// of the memory ops are still run, in order.
+void Nic::RecvMachine::ShmemStream::calcAtomicDelay( int pid, Hermes::Vaddr addr, std::vector< MemOp >* memOps, std::function<void()> callback )
+{
+    Nic::Shmem* shmem = m_ctx->getShmem();
+    if ( ! shmem->atomicCacheHit( pid, addr ) ) {
+        m_ctx->calcNicMemDelay( m_unit, memOps, callback );
+        return;
+    }
+
+    m_dbg.debug(CALL_INFO,1,NIC_DBG_RECV_STREAM,"core=%d addr=%#" PRIx64 " atomic cache hit\n", pid, addr );
+
+    std::vector< MemOp > ops;
+    ops.swap( *memOps );
+    delete memOps;
+    m_ctx->nic().schedCallback(
+        [=]() {
+            for ( unsigned i = 0; i < ops.size(); i++ ) {
+                if ( ops[i].callback ) {
+                    ops[i].callback();
+                }
+            }
+            callback();
+        },
+        shmem->getAtomicLatency_ns()
+    );
+}
+
 void Nic::RecvMachine::ShmemStream::processAck( ShmemMsgHdr& hdr, FireflyNetworkEvent* ev, int pid, int srcPid  )
 {
     m_ctx->nic().shmemDecPendingPuts( pid );
@@ -203,7 +232,7 @@ void Nic::RecvMachine::ShmemStream::processAdd( ShmemMsgHdr& hdr, FireflyNetwork
 	) );
 
     int srcNode = ev->getSrcNode();
-   	m_ctx->calcNicMemDelay( m_unit, memOps,
+   	calcAtomicDelay( local_pid, addr.getSimVAddr(), memOps,
 			[=]() {
 				m_dbg.debug(CALL_INFO_LAMBDA, "processAdd",1,NIC_DBG_RECV_STREAM,"send Ack to %d\n",srcNode);
 				m_sendEntry = new ShmemAckSendEntry( local_pid, m_ctx->nic().getSendStreamNum(local_pid), srcNode, dest_pid, m_ctx->nic().m_shmemAckVN );
@@ -248,7 +277,7 @@ void Nic::RecvMachine::ShmemStream::processFadd( ShmemMsgHdr& hdr, FireflyNetwor
         vn = m_ctx->nic().m_shmemGetLargeVN;
     }
     int srcNode = ev->getSrcNode();
-   	m_ctx->calcNicMemDelay( m_unit, memOps,
+   	calcAtomicDelay( local_pid, addr.getSimVAddr(), memOps,
 			[=]() {
     			m_ctx->runSend( 0, new ShmemPut2SendEntry( local_pid, m_ctx->nic().getSendStreamNum(local_pid), srcNode, dest_pid, save, hdr.respKey, vn ) );
                 m_ctx->deleteStream( this );
@@ -284,7 +313,7 @@ void Nic::RecvMachine::ShmemStream::processSwap( ShmemMsgHdr& hdr, FireflyNetwor
     }
 
     int srcNode = ev->getSrcNode();
-   	m_ctx->calcNicMemDelay( m_unit, memOps,
+   	calcAtomicDelay( local_pid, addr.getSimVAddr(), memOps,
 			[=]() {
     			m_ctx->runSend( 0, new ShmemPut2SendEntry( local_pid, m_ctx->nic().getSendStreamNum(local_pid), srcNode, dest_pid, save, hdr.respKey, vn ) );
                 m_ctx->deleteStream( this );
@@ -325,7 +354,7 @@ void Nic::RecvMachine::ShmemStream::processCswap( ShmemMsgHdr& hdr, FireflyNetwo
         vn = m_ctx->nic().m_shmemGetLargeVN;
     }
     int srcNode = ev->getSrcNode();
-   	m_ctx->calcNicMemDelay( m_unit, memOps,
+   	calcAtomicDelay( local_pid, addr.getSimVAddr(), memOps,
 		    [=]() {
     			m_ctx->runSend( 0, new ShmemPut2SendEntry( local_pid, m_ctx->nic().getSendStreamNum(local_pid), srcNode, dest_pid, save, hdr.respKey, vn ) );
                 m_ctx->deleteStream( this );
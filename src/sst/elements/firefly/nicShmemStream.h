@@ -41,6 +41,7 @@ class ShmemStream : public StreamBase {
     void processAdd( ShmemMsgHdr&, FireflyNetworkEvent*, int, int );
     void processCswap( ShmemMsgHdr&, FireflyNetworkEvent*, int, int );
     void processSwap( ShmemMsgHdr&, FireflyNetworkEvent*, int, int );
+    void calcAtomicDelay( int pid, Hermes::Vaddr addr, std::vector< MemOp >*, std::function<void()> callback );
     ShmemMsgHdr m_shmemHdr;
     bool m_blocked;
 };
@@ -169,7 +169,7 @@ void NicTester::postRecv()
     m_dbg.debug(CALL_INFO,1,0,"\n");
 
     DmaEntry* entry = new DmaEntry;
-    std::vector<IoVec> iovec(2);
+    IoVecList iovec(2);
 
     iovec[0].ptr = &entry->hdr;
     iovec[0].len = sizeof(entry->hdr);
@@ -187,7 +187,7 @@ void NicTester::postSend()
     m_dbg.debug(CALL_INFO,1,0,"\n");
 
     PioEntry* entry = new PioEntry;
-    std::vector<IoVec> iovec(2);
+    IoVecList iovec(2);
 
     iovec[0].ptr = &entry->hdr;
     iovec[0].len = sizeof(entry->hdr);
@@ -170,7 +170,8 @@ class SimpleMemoryNicConfiguration(BasicNicConfiguration):
         self._declareParamsWithUserPrefix(
             "main",
             "shmem",
-            ["nicCmdLatency", "hostCmdLatency"],
+            ["nicCmdLatency", "hostCmdLatency", "atomicCacheEntries",
+             "atomicCacheLineSize", "atomicLatency_ns"],
             "shmem."
         )
 
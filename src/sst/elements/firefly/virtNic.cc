@@ -147,28 +147,28 @@ bool VirtNic::canDmaRecv()
     return true;
 }
 
-void VirtNic::dmaRecv( int src, int tag, std::vector<IoVec>& vec, void* key )
+void VirtNic::dmaRecv( int src, int tag, IoVecList& vec, void* key )
 {
     m_dbg.debug(CALL_INFO,2,0,"src=%d\n",src);
     m_toNicLink->send(calcDelay(), new NicCmdEvent( NicCmdEvent::DmaRecv,
             calcCoreId(src), calcRealNicId(src), tag, vec, key ) );
 }
 
-void VirtNic::pioSend( int vn, int dest, int tag, std::vector<IoVec>& vec, void* key )
+void VirtNic::pioSend( int vn, int dest, int tag, IoVecList& vec, void* key )
 {
     m_dbg.debug(CALL_INFO,2,0,"dest=%d\n",dest);
     m_toNicLink->send(calcDelay(), new NicCmdEvent( NicCmdEvent::PioSend,
 			calcCoreId(dest), calcRealNicId(dest), tag, vec, key, vn ) );
 }
 
-void VirtNic::get( int node, int tag, std::vector<IoVec>& vec, void* key )
+void VirtNic::get( int node, int tag, IoVecList& vec, void* key )
 {
     m_dbg.debug(CALL_INFO,2,0,"node=%d\n",node);
     m_toNicLink->send(calcDelay(), new NicCmdEvent( NicCmdEvent::Get,
 			calcCoreId(node), calcRealNicId(node), tag, vec, key ) );
 }
 
-void VirtNic::regMem( int node, int tag, std::vector<IoVec>& vec, void* key )
+void VirtNic::regMem( int node, int tag, IoVecList& vec, void* key )
 {
     m_dbg.debug(CALL_INFO,2,0,"node=%d\n",node);
     m_toNicLink->send(calcDelay(), new NicCmdEvent( NicCmdEvent::RegMemRgn,
@@ -177,10 +177,10 @@ class VirtNic : public SST::SubComponent {
     bool canDmaSend();
     bool canDmaRecv();
 
-    void dmaRecv( int src, int tag, std::vector<IoVec>& vec, void* key );
-    void pioSend( int vn, int dest, int tag, std::vector<IoVec>& vec, void* key  );
-    void get( int node, int tag, std::vector<IoVec>& vec, void* key );
-    void regMem( int node, int tag, std::vector<IoVec>& vec, void *key );
+    void dmaRecv( int src, int tag, IoVecList& vec, void* key );
+    void pioSend( int vn, int dest, int tag, IoVecList& vec, void* key  );
+    void get( int node, int tag, IoVecList& vec, void* key );
+    void regMem( int node, int tag, IoVecList& vec, void *key );
 
     void shmemInit( Hermes::Vaddr, Callback );
     void shmemFence( Callback );
@@ -224,6 +224,7 @@ gensa::init (unsigned int phase)
     ifs.open (modelPath.c_str());
     assert(sizeof(Synapse) == 8);
     uint64_t startAddr = 0x10000;
+    int maxDelay = 0;
     while (ifs.good()) {
         getline(ifs, line);
         if (line.empty()) break;
@@ -265,10 +266,13 @@ gensa::init (unsigned int phase)
             synapse->target = target;
             synapse->weight = weight;
             synapse->delay  = delay;
+            if (synapse->delay > maxDelay) maxDelay = synapse->delay;
             memory->sendUntimedData(req);
         }
     }
 
+    NeuronLIF::setMaxDelay (maxDelay);
+
     int numNeurons = neurons.size ();
     printf("Constructed %d neurons with %d links\n", numNeurons, countLinks);
 }
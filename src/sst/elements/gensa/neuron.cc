@@ -65,28 +65,44 @@ void Neuron::deliverSpike(float str, uint when)
 // NeuronLIF -----------------------------------------------------------------
 
 SST::RNG::MarsagliaRNG NeuronLIF::rng(1,13);
+uint32_t               NeuronLIF::bufferMask = 0;
 
 NeuronLIF::NeuronLIF(float Vinit, float Vthreshold, float Vreset, float leak, float p)
 :   V          (Vinit),
     Vthreshold (Vthreshold),
     Vreset     (Vreset),
     leak       (leak),
-    p          (p)
+    p          (p),
+    lastUpdate (-1)
 {
 }
 
+void NeuronLIF::setMaxDelay(uint32_t delay)
+{
+    // Slots from the cycle after the last update through now+delay can hold input, at most delay+1 of them.
+    uint32_t size = 1;
+    while (size <= delay) size <<= 1;
+    bufferMask = size - 1;
+}
+
 void NeuronLIF::deliverSpike(float str, uint when)
 {
-    temporalBuffer[when] += str;
+    // Input for a cycle this neuron has already updated would never be read, so drop it.
+    if ((int64_t) when <= lastUpdate) return;
+    if (temporalBuffer.empty()) temporalBuffer.resize(bufferMask + 1, 0);
+    temporalBuffer[when & bufferMask] += str;
 }
 
 bool NeuronLIF::update(const uint now)
 {
     // Add inputs
-    temporalBuffer_t::iterator i = temporalBuffer.find(now);
-    if (i != temporalBuffer.end()) {
-        V += i->second;
-        temporalBuffer.erase(i);
+    lastUpdate = now;
+    if (! temporalBuffer.empty()) {
+        float & input = temporalBuffer[now & bufferMask];
+        if (input != 0) {
+            V += input;
+            input = 0;
+        }
     }
 
     // Check for spike
@@ -17,6 +17,7 @@
 #define _NEURON_H
 
 #include <map>
+#include <vector>
 #include <cstdint>
 
 #include <sst/core/interfaces/stdMem.h>  // supplies type uint
@@ -72,11 +73,17 @@ public:
     static SST::RNG::MarsagliaRNG rng;
 
     // temporal buffer
-    typedef std::map<const uint, float> temporalBuffer_t;
-    temporalBuffer_t temporalBuffer;
+    // A ring of input sums, one slot per cycle, indexed by the cycle mod its size.
+    // It is allocated on the first delivery and only needs to span the longest synapse delay,
+    // so a spike is a single add instead of a map insert.
+    static uint32_t  bufferMask;
+    std::vector<float> temporalBuffer;
+    int64_t          lastUpdate;  ///< cycle of the latest update(), -1 before the first
 
     NeuronLIF (float Vinit = 0, float Vthreshold = 1, float Vreset = 0, float leak = 1, float p = 1);
 
+    static void setMaxDelay (uint32_t delay);  ///< size the temporal buffers for spikes up to delay cycles ahead
+
     virtual void deliverSpike(float str, uint32_t when);
     virtual bool update      (const uint32_t now);
 };
@@ -95,4 +95,31 @@ class ArgStatic_Functor : public Arg_FunctorBase< TArg1, TRetval >
     virtual ~ArgStatic_Functor() {}
 };
 
+// Like ArgStatic_Functor but owned by its creator and handed out again and
+// again instead of allocated per call, setArg() sets the argument of the
+// next call and operator() returns false so the callee never deletes it
+template <class TClass, class TArg1, class TArg2 >
+class ArgStaticReuse_Functor : public Arg_FunctorBase< TArg1, bool >
+{
+  private:
+    TClass* m_obj;
+    bool ( TClass::*m_fptr )( TArg1, TArg2 );
+    TArg2 m_arg2;
+
+  public:
+    ArgStaticReuse_Functor( TClass* obj, bool ( TClass::*fptr )( TArg1, TArg2 ) ):
+        m_obj( obj ),
+        m_fptr( fptr ),
+        m_arg2()
+    { }
+
+    void setArg( TArg2 arg ) { m_arg2 = arg; }
+
+    virtual bool operator()( TArg1 arg ) {
+        (*m_obj.*m_fptr)(arg, m_arg2 );
+        return false;
+    }
+    virtual ~ArgStaticReuse_Functor() {}
+};
+
 #endif
@@ -17,6 +17,7 @@
 #define _H_HERMES_MESSAGE_INTERFACE
 
 #include <assert.h>
+#include <vector>
 
 #include "hermes.h"
 
@@ -101,6 +102,16 @@ enum Retval {
     FAILURE
 };
 
+// One message of a sendv or recvv, rank is the destination of a send and
+// the source of a receive
+struct MessageDesc {
+    Hermes::MemAddr buf;
+    uint32_t        count;
+    PayloadDataType dtype;
+    RankID          rank;
+    uint32_t        tag;
+};
+
 inline ReductionOperation Op_create( User_function func, int commute ) {
 	return new _ReductionOperation( func, commute );
 }
@@ -141,6 +152,14 @@ class Interface : public Hermes::Interface {
         RankID source, uint32_t tag, Communicator group,
         MessageRequest* req, Functor*) { assert(0); }
 
+    // Post an isend or irecv for every descriptor, req[i] is the request of
+    // msgs[i], the functor is called once when all of them are posted
+    virtual void sendv(std::vector<MessageDesc>& msgs, Communicator group,
+        MessageRequest req[], Functor*) { assert(0); }
+
+    virtual void recvv(std::vector<MessageDesc>& msgs, Communicator group,
+        MessageRequest req[], Functor*) { assert(0); }
+
     virtual void allreduce(const Hermes::MemAddr&, const Hermes::MemAddr&, uint32_t count,
         PayloadDataType dtype, ReductionOperation op,
         Communicator group, Functor*) { assert(0); }
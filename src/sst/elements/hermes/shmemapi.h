@@ -17,6 +17,7 @@
 #define _H_HERMES_SHMEM_INTERFACE
 
 #include <assert.h>
+#include <vector>
 
 #include "hermes.h"
 
@@ -50,6 +51,21 @@ static std::string WaitOpName( WaitOp op ) {
 
 typedef enum { MOVE, AND, MAX, MIN, SUM, PROD, OR, XOR } ReduOp;
 
+// One operation of put_nbi_batch()
+struct PutDesc {
+    Vaddr dest;
+    Vaddr src;
+    size_t nelems;
+    int pe;
+};
+
+// One operation of add_batch()
+struct AddDesc {
+    Vaddr dest;
+    Value value;
+    int pe;
+};
+
 class Interface : public Hermes::Interface {
     public:
 
@@ -96,6 +112,11 @@ class Interface : public Hermes::Interface {
     virtual void fadd( Value& result, Vaddr, Value&, int pe, Callback) { assert(0); }
     virtual void add( Vaddr, Value&, int pe, Callback) { assert(0); }
 
+    // Many non-blocking puts or adds in one call. They complete the same
+    // way put_nbi and add do, so quiet() waits for them
+    virtual void put_nbi_batch( std::vector<PutDesc>&, Callback) { assert(0); }
+    virtual void add_batch( std::vector<AddDesc>&, Callback) { assert(0); }
+
     virtual void fam_get( Hermes::Vaddr dest, Fam_Descriptor fd, uint64_t offset, uint64_t nbytes,
 			bool blocking, Callback &) { assert(0); }
     virtual void fam_put( Fam_Descriptor fd, uint64_t offset, Hermes::Vaddr dest, uint64_t nbytes,
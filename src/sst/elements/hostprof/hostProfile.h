@@ -0,0 +1,104 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_SST_ELEMENTS_HOSTPROF_HOST_PROFILE
+#define _H_SST_ELEMENTS_HOSTPROF_HOST_PROFILE
+
+#include <stdint.h>
+#include <chrono>
+
+#include <sst/core/statapi/statbase.h>
+
+namespace SST {
+namespace HostProf {
+
+/*
+ * Host time spent in one event or clock handler of a component.
+ *
+ * A component that supports self-profiling gives each profiled handler a
+ * HandlerProfile, reads its "host_profile" parameter, and opens a
+ * ScopedHandlerTimer at the top of the handler. While profiling is off the
+ * timer is a single predictable branch. While it is on, every call adds the
+ * host nanoseconds spent in the handler and one event to running totals,
+ * which report() hands to the component's statistics once, normally from
+ * finish(), so the statistics API is not touched per call.
+ *
+ * The statistics are per component; summing them over components of one
+ * type (e.g. with the CSV output) gives the per-type split of host time.
+ */
+class HandlerProfile {
+public:
+    HandlerProfile() : enabled_(false), ns_(0), events_(0), statNs_(nullptr), statEvents_(nullptr) { }
+
+    /* Begin profiling into the given statistics */
+    void enable(Statistic<uint64_t>* statNs, Statistic<uint64_t>* statEvents) {
+        enabled_ = true;
+        statNs_ = statNs;
+        statEvents_ = statEvents;
+    }
+
+    bool enabled() const { return enabled_; }
+
+    void record(uint64_t ns, uint64_t events = 1) {
+        ns_ += ns;
+        events_ += events;
+    }
+
+    uint64_t getHostNs() const { return ns_; }
+    uint64_t getEvents() const { return events_; }
+
+    /* Add the totals to the statistics, once at the end of the run */
+    void report() {
+        if (!enabled_) return;
+        statNs_->addData(ns_);
+        statEvents_->addData(events_);
+        ns_ = 0;
+        events_ = 0;
+    }
+
+private:
+    bool enabled_;
+    uint64_t ns_;
+    uint64_t events_;
+    Statistic<uint64_t>* statNs_;
+    Statistic<uint64_t>* statEvents_;
+};
+
+/* Times the enclosing scope into a HandlerProfile if it is enabled */
+class ScopedHandlerTimer {
+public:
+    explicit ScopedHandlerTimer(HandlerProfile& profile) : profile_(profile.enabled() ? &profile : nullptr) {
+        if (profile_) start_ = std::chrono::steady_clock::now();
+    }
+
+    ~ScopedHandlerTimer() {
+        if (profile_) {
+            std::chrono::steady_clock::duration elapsed = std::chrono::steady_clock::now() - start_;
+            profile_->record(std::chrono::duration_cast<std::chrono::nanoseconds>(elapsed).count());
+        }
+    }
+
+private:
+    ScopedHandlerTimer(const ScopedHandlerTimer&) = delete;
+    ScopedHandlerTimer& operator=(const ScopedHandlerTimer&) = delete;
+
+    HandlerProfile* profile_;
+    std::chrono::steady_clock::time_point start_;
+};
+
+} //namespace HostProf
+} //namespace SST
+
+#endif
@@ -86,6 +86,10 @@ class FabricMessage : public SST::Iris::sumi::Message {
     return flags_;
   }
 
+  void addFlags(uint64_t flags) {
+    flags_ |= flags;
+  }
+
   uint64_t immData() const {
     return imm_data_;
   }
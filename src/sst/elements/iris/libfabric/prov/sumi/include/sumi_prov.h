@@ -338,6 +338,7 @@ struct sumi_fid_ep {
 	struct sumi_fid_stx *stx_ctx;
 	struct sumi_fid_eq *eq;
   int qos;
+  size_t min_multi_recv;
 };
 
 struct sumi_fid_sep {
@@ -429,6 +430,15 @@ struct sumi_fid_cq {
   sumi_progress_queue* queue;
 };
 
+struct sumi_fid_cntr {
+  struct fid_cntr cntr_fid;
+  struct sumi_fid_domain *domain;
+  struct fi_cntr_attr attr;
+  uint64_t cnt;
+  uint64_t cnt_err;
+  sumi_progress_queue* queue;
+};
+
 struct sumi_fid_srx {
   struct fid_ep ep_fid;
   sumi_fid_domain* domain;
@@ -527,13 +537,36 @@ struct ErrorDeallocate {
   std::function<void(void*)> dealloc;
 };
 
+/**
+ * Threads blocked in fi_cntr_wait. Counters are bumped from the
+ * RecvQueue of whichever CQ the operation completes on.
+ */
+struct CounterQueue : public SST::Hg::ProgressQueue {
+  std::list<SST::Hg::Thread*> pending_threads;
+
+  CounterQueue(SST::Hg::OperatingSystem* os) :
+    SST::Hg::ProgressQueue(os)
+  {
+  }
+
+  static void add(sumi_fid_cntr* cntr, uint64_t value){
+    cntr->cnt += value;
+    CounterQueue* q = (CounterQueue*) cntr->queue;
+    if (!q->pending_threads.empty()){
+      q->unblock(q->pending_threads);
+    }
+  }
+};
+
 struct RecvQueue {
 
   struct Recv {
     uint32_t size;
     void* buf;
-    Recv(uint32_t s, void* b) :
-      size(s), buf(b)
+    uint64_t flags;
+    uint32_t min_free; //multi-recv buffers are released below this
+    Recv(uint32_t s, void* b, uint64_t f, uint32_t m) :
+      size(s), buf(b), flags(f), min_free(m)
     {
     }
   };
@@ -543,14 +576,20 @@ struct RecvQueue {
     void* buf;
     uint64_t tag;
     uint64_t tag_ignore;
-    TaggedRecv(uint32_t s, void* b, uint64_t t, uint64_t ti) :
-      size(s), buf(b), tag(t), tag_ignore(ti)
+    uint64_t flags;
+    TaggedRecv(uint32_t s, void* b, uint64_t t, uint64_t ti, uint64_t f) :
+      size(s), buf(b), tag(t), tag_ignore(ti), flags(f)
     {
     }
   };
 
   RecvQueue(SST::Hg::OperatingSystem* os) :
-    progress(os)
+    progress(os),
+    selective(false),
+    send_cntr(nullptr),
+    recv_cntr(nullptr),
+    read_cntr(nullptr),
+    write_cntr(nullptr)
   {
   }
 
@@ -565,11 +604,25 @@ struct RecvQueue {
 
   SST::Hg::SingleProgressQueue<SST::Iris::sumi::Message> progress;
 
-  void finishMatch(void* buf, uint32_t size, FabricMessage* fmsg);
+  /** Bound with FI_SELECTIVE_COMPLETION: only FI_COMPLETION ops make entries */
+  bool selective;
+
+  sumi_fid_cntr* send_cntr;
+  sumi_fid_cntr* recv_cntr;
+  sumi_fid_cntr* read_cntr;
+  sumi_fid_cntr* write_cntr;
+
+  void complete(FabricMessage* msg, sumi_fid_cntr* cntr, uint64_t flags);
+
+  void finishMatch(void* buf, uint32_t size, uint64_t flags, FabricMessage* fmsg);
+
+  /** @return Whether the multi-recv buffer has been used up */
+  bool finishMultiMatch(Recv& r, FabricMessage* fmsg);
 
   void matchTaggedRecv(FabricMessage* msg);
 
-  void postRecv(uint32_t size, void* buf, uint64_t tag, uint64_t tag_ignore, bool tagged);
+  void postRecv(uint32_t size, void* buf, uint64_t tag, uint64_t tag_ignore,
+                uint64_t flags, uint32_t min_free = 0);
 
   void incoming(SST::Iris::sumi::Message* msg);
 
@@ -231,25 +231,57 @@ extern "C" DIRECT_FN  int sumi_cq_open(struct fid_domain *domain, struct fi_cq_a
   return FI_SUCCESS;
 }
 
-void RecvQueue::finishMatch(void* buf, uint32_t size, FabricMessage *msg)
+void RecvQueue::complete(FabricMessage* msg, sumi_fid_cntr* cntr, uint64_t flags)
+{
+  if (cntr){
+    CounterQueue::add(cntr, 1);
+  }
+  if (selective && !(flags & FI_COMPLETION)){
+    //the counter is the only notification
+    delete msg;
+  } else {
+    progress.incoming(msg);
+  }
+}
+
+void RecvQueue::finishMatch(void* buf, uint32_t size, uint64_t flags, FabricMessage *msg)
 {
   //found a match
   if (size >= msg->payloadBytes()){
     if (buf && msg->localBuffer()){
       msg->matchRecv(buf);
     }
-    progress.incoming(msg);
+    complete(msg, recv_cntr, flags);
   } else {
     delete msg;
   }
 }
 
+bool RecvQueue::finishMultiMatch(Recv& r, FabricMessage *msg)
+{
+  //messages land back to back in the posted buffer
+  //until less than min_free bytes are left
+  uint32_t bytes = msg->payloadBytes();
+  void* buf = r.buf;
+  bool done = bytes > r.size || r.size - bytes < r.min_free;
+  if (done){
+    msg->addFlags(FI_MULTI_RECV);
+  } else {
+    r.size -= bytes;
+    if (r.buf){
+      r.buf = ((char*) r.buf) + bytes;
+    }
+  }
+  finishMatch(buf, done ? r.size : bytes, r.flags, msg);
+  return done;
+}
+
 void RecvQueue::matchTaggedRecv(FabricMessage* msg){
   for (auto it = tagged_recvs.begin(); it != tagged_recvs.end(); ++it){
     auto tmp = it++;
     TaggedRecv& r = *tmp;
     if (matches(msg, r.tag, r.tag_ignore)){
-      finishMatch(r.buf, r.size, msg);
+      finishMatch(r.buf, r.size, r.flags, msg);
       tagged_recvs.erase(tmp);
       return;
     }
@@ -257,29 +289,40 @@ void RecvQueue::matchTaggedRecv(FabricMessage* msg){
   unexp_tagged_recvs.push_back(msg);
 }
 
-void RecvQueue::postRecv(uint32_t size, void* buf, uint64_t tag, uint64_t tag_ignore, bool tagged){
-  if (tagged){
+void RecvQueue::postRecv(uint32_t size, void* buf, uint64_t tag, uint64_t tag_ignore,
+                         uint64_t flags, uint32_t min_free){
+  if (flags & FI_TAGGED){
     if (unexp_tagged_recvs.empty()){
-      tagged_recvs.emplace_back(size, buf, tag, tag_ignore);
+      tagged_recvs.emplace_back(size, buf, tag, tag_ignore, flags);
     } else {
       for (auto it = unexp_tagged_recvs.begin(); it != unexp_tagged_recvs.end(); ++it){
         auto tmp = it++;
         FabricMessage* msg = *tmp;
         if (matches(msg, tag, tag_ignore)){
-          finishMatch(buf, size, msg);
+          finishMatch(buf, size, flags, msg);
           return;
         }
       }
     }
     //nothing matched
-    tagged_recvs.emplace_back(size, buf, tag, tag_ignore);
+    tagged_recvs.emplace_back(size, buf, tag, tag_ignore, flags);
+  } else if (flags & FI_MULTI_RECV){
+    Recv r(size, buf, flags, min_free);
+    while (!unexp_recvs.empty()){
+      FabricMessage* msg = unexp_recvs.front();
+      unexp_recvs.pop_front();
+      if (finishMultiMatch(r, msg)){
+        return;
+      }
+    }
+    recvs.push_back(r);
   } else {
     if (unexp_recvs.empty()){
-      recvs.emplace_back(size, buf);
+      recvs.emplace_back(size, buf, flags, 0);
     } else {
       FabricMessage* msg = unexp_recvs.front();
       unexp_recvs.pop_front();;
-      finishMatch(buf, size, msg);
+      finishMatch(buf, size, flags, msg);
     }
   }
 }
@@ -294,13 +337,34 @@ void RecvQueue::incoming(SST::Iris::sumi::Message* msg){
         unexp_recvs.push_back(fmsg);
       } else {
         Recv& r = recvs.front();
-        finishMatch(r.buf, r.size, fmsg);
-        recvs.pop_front();
+        if (r.flags & FI_MULTI_RECV){
+          if (finishMultiMatch(r, fmsg)){
+            recvs.pop_front();
+          }
+        } else {
+          finishMatch(r.buf, r.size, r.flags, fmsg);
+          recvs.pop_front();
+        }
       }
     }
   } else {
     //all other messages go right through
-    progress.incoming(fmsg);
+    //only the initiator side of an operation is counted
+    sumi_fid_cntr* cntr = nullptr;
+    switch (fmsg->SST::Hg::NetworkMessage::type()){
+      case SST::Hg::NetworkMessage::payload_sent_ack:
+        cntr = send_cntr;
+        break;
+      case SST::Hg::NetworkMessage::rdma_get_payload:
+        cntr = read_cntr;
+        break;
+      case SST::Hg::NetworkMessage::rdma_put_sent_ack:
+        cntr = write_cntr;
+        break;
+      default:
+        break;
+    }
+    complete(fmsg, cntr, fmsg->flags());
   }
 }
 
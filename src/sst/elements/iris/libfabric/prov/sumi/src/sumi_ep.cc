@@ -312,7 +312,7 @@ static ssize_t sstmaci_ep_recv(struct fid_ep* ep, void* buf, size_t len, fi_addr
   }
 
   RecvQueue* rq = (RecvQueue*) ep_impl->recv_cq->queue;
-  rq->postRecv(len, buf, tag, tag_ignore, bool(flags & FI_TAGGED));
+  rq->postRecv(len, buf, tag, tag_ignore, flags, ep_impl->min_multi_recv);
 
   return 0;
 }
@@ -343,7 +343,14 @@ DIRECT_FN STATIC ssize_t sumi_ep_recvmsg(struct fid_ep *ep,
 					 const struct fi_msg *msg,
 					 uint64_t flags)
 {
-  return -FI_ENOSYS;
+  uint64_t ignore = 0;
+  if (msg->iov_count == 1){
+    return sstmaci_ep_recv(ep, msg->msg_iov[0].iov_base, msg->msg_iov[0].iov_len,
+                           msg->addr, msg->context, 0, ~ignore,
+                           flags & (FI_COMPLETION | FI_MULTI_RECV));
+  } else {
+    return -FI_ENOSYS;
+  }
 }
 
 static ssize_t sstmaci_ep_send(struct fid_ep* ep, const void* buf, size_t len,
@@ -359,10 +366,21 @@ static ssize_t sstmaci_ep_send(struct fid_ep* ep, const void* buf, size_t len,
 
   flags |= FI_SEND;
 
+  //injected sends never generate a local completion,
+  //the buffer is free as soon as the call returns
+  int local_cq = SST::Iris::sumi::Message::no_ack;
+  if (flags & FI_INJECT){
+    if (len > SUMI_INJECT_SIZE){
+      return -FI_EMSGSIZE;
+    }
+  } else {
+    local_cq = ep_impl->send_cq->id;
+  }
+
   tport->postSend<FabricMessage>(dest_rank, len, const_cast<void*>(buf),
-                                 ep_impl->send_cq->id, // rma operations go to the tx
+                                 local_cq, // rma operations go to the tx
                                  remote_cq, SST::Iris::sumi::Message::pt2pt, ep_impl->qos,
-                                 tag, FabricMessage::no_imm_data, flags, context);
+                                 tag, data, flags, context);
   return 0;
 }
 
@@ -392,13 +410,21 @@ DIRECT_FN STATIC ssize_t sumi_ep_sendmsg(struct fid_ep *ep,
 					 const struct fi_msg *msg,
 					 uint64_t flags)
 {
-  return -FI_ENOSYS;
+  if (msg->iov_count == 1){
+    uint64_t data = (flags & FI_REMOTE_CQ_DATA) ? msg->data : FabricMessage::no_imm_data;
+    return sstmaci_ep_send(ep, msg->msg_iov[0].iov_base, msg->msg_iov[0].iov_len,
+                           msg->addr, msg->context, FabricMessage::no_tag, data,
+                           flags & (FI_COMPLETION | FI_INJECT | FI_REMOTE_CQ_DATA));
+  } else {
+    return -FI_ENOSYS;
+  }
 }
 
 DIRECT_FN STATIC ssize_t sumi_ep_msg_inject(struct fid_ep *ep, const void *buf,
 					    size_t len, fi_addr_t dest_addr)
 {
-  return -FI_ENOSYS;
+  return sstmaci_ep_send(ep, buf, len, dest_addr, nullptr,
+                         FabricMessage::no_tag, FabricMessage::no_imm_data, FI_INJECT);
 }
 
 DIRECT_FN STATIC ssize_t sumi_ep_senddata(struct fid_ep *ep, const void *buf,
@@ -413,7 +439,8 @@ DIRECT_FN STATIC ssize_t
 sumi_ep_msg_injectdata(struct fid_ep *ep, const void *buf, size_t len,
 		       uint64_t data, fi_addr_t dest_addr)
 {
-  return -FI_ENOSYS;
+  return sstmaci_ep_send(ep, buf, len, dest_addr, nullptr,
+                         FabricMessage::no_tag, data, FI_INJECT | FI_REMOTE_CQ_DATA);
 }
 
 static ssize_t sstmaci_ep_read(struct fid_ep *ep, void *buf, size_t len,
@@ -566,7 +593,13 @@ DIRECT_FN STATIC ssize_t sumi_ep_trecvmsg(struct fid_ep *ep,
 					  const struct fi_msg_tagged *msg,
 					  uint64_t flags)
 {
-  return -FI_ENOSYS;
+  if (msg->iov_count == 1){
+    return sstmaci_ep_recv(ep, msg->msg_iov[0].iov_base, msg->msg_iov[0].iov_len,
+                           msg->addr, msg->context, msg->tag, msg->ignore,
+                           FI_TAGGED | (flags & FI_COMPLETION));
+  } else {
+    return -FI_ENOSYS;
+  }
 }
 
 DIRECT_FN STATIC ssize_t sumi_ep_tsend(struct fid_ep *ep, const void *buf,
@@ -596,7 +629,14 @@ DIRECT_FN STATIC ssize_t sumi_ep_tsendmsg(struct fid_ep *ep,
 					  const struct fi_msg_tagged *msg,
 					  uint64_t flags)
 {
-  return -FI_ENOSYS;
+  if (msg->iov_count == 1){
+    uint64_t data = (flags & FI_REMOTE_CQ_DATA) ? msg->data : FabricMessage::no_imm_data;
+    return sstmaci_ep_send(ep, msg->msg_iov[0].iov_base, msg->msg_iov[0].iov_len,
+                           msg->addr, msg->context, msg->tag, data,
+                           FI_TAGGED | (flags & (FI_COMPLETION | FI_INJECT | FI_REMOTE_CQ_DATA)));
+  } else {
+    return -FI_ENOSYS;
+  }
 }
 
 
@@ -613,14 +653,16 @@ DIRECT_FN STATIC ssize_t sumi_ep_tinject(struct fid_ep *ep, const void *buf,
 					 size_t len, fi_addr_t dest_addr,
 					 uint64_t tag)
 {
-  return -FI_ENOSYS;
+  return sstmaci_ep_send(ep, buf, len, dest_addr, nullptr, tag,
+                         FabricMessage::no_imm_data, FI_TAGGED | FI_INJECT);
 }
 
 DIRECT_FN STATIC ssize_t sumi_ep_tinjectdata(struct fid_ep *ep, const void *buf,
 					     size_t len, uint64_t data,
 					     fi_addr_t dest_addr, uint64_t tag)
 {
-  return -FI_ENOSYS;
+  return sstmaci_ep_send(ep, buf, len, dest_addr, nullptr, tag, data,
+                         FI_TAGGED | FI_INJECT | FI_REMOTE_CQ_DATA);
 }
 
 extern "C" DIRECT_FN  int sumi_ep_atomic_valid(struct fid_ep *ep,
@@ -760,6 +802,21 @@ extern "C" int sumi_ep_close(fid_t fid)
   return FI_SUCCESS;
 }
 
+static void sstmaci_ep_bind_cntrs(sumi_fid_ep* ep)
+{
+  //counters and CQs can be bound in either order
+  if (ep->send_cq && ep->send_cq->queue){
+    RecvQueue* rq = (RecvQueue*) ep->send_cq->queue;
+    rq->send_cntr = ep->send_cntr;
+    rq->read_cntr = ep->read_cntr;
+    rq->write_cntr = ep->write_cntr;
+  }
+  if (ep->recv_cq && ep->recv_cq->queue){
+    RecvQueue* rq = (RecvQueue*) ep->recv_cq->queue;
+    rq->recv_cntr = ep->recv_cntr;
+  }
+}
+
 extern "C" DIRECT_FN  int sumi_ep_bind(fid_t fid, struct fid *bfid, uint64_t flags)
 {
   //this can always be cast to an endpiont regardless of whether
@@ -788,11 +845,6 @@ extern "C" DIRECT_FN  int sumi_ep_bind(fid_t fid, struct fid *bfid, uint64_t fla
           return -FI_EINVAL; //can't rebind send CQ
         }
         ep->send_cq = cq;
-        if (flags & FI_SELECTIVE_COMPLETION) {
-          //for now, don't allow selective completion
-          //all messages will generate completion entries
-          return -FI_EINVAL;
-        }
       }
 
       if (flags & FI_RECV) {
@@ -800,17 +852,15 @@ extern "C" DIRECT_FN  int sumi_ep_bind(fid_t fid, struct fid *bfid, uint64_t fla
           return -FI_EINVAL;
         }
         ep->recv_cq = cq;
-
-        if (flags & FI_SELECTIVE_COMPLETION) {
-          //for now, don't allow selective completion
-          //all messages will generate completion entries
-          return -FI_EINVAL;
-        }
       }
 
       RecvQueue* rq = new RecvQueue(SST::Hg::OperatingSystem::currentOs());
+      //with selective completion only FI_COMPLETION operations make entries,
+      //everything else is reported through counters
+      rq->selective = flags & FI_SELECTIVE_COMPLETION;
       cq->queue = (sumi_progress_queue*) rq;
       tport->allocateCq(cq->id, std::bind(&RecvQueue::incoming, rq, std::placeholders::_1));
+      sstmaci_ep_bind_cntrs(ep);
       break;
     }
     case FI_CLASS_AV: {
@@ -820,8 +870,20 @@ extern "C" DIRECT_FN  int sumi_ep_bind(fid_t fid, struct fid *bfid, uint64_t fla
       }
       break;
     }
-    case FI_CLASS_CNTR: //TODO
-      return -FI_EINVAL;
+    case FI_CLASS_CNTR: {
+      sumi_fid_cntr* cntr = (sumi_fid_cntr*) bfid;
+      if (ep->domain != cntr->domain) {
+        return -FI_EINVAL;
+      }
+      if (flags & FI_SEND) ep->send_cntr = cntr;
+      if (flags & FI_RECV) ep->recv_cntr = cntr;
+      if (flags & FI_READ) ep->read_cntr = cntr;
+      if (flags & FI_WRITE) ep->write_cntr = cntr;
+      if (flags & FI_REMOTE_READ) ep->rread_cntr = cntr;
+      if (flags & FI_REMOTE_WRITE) ep->rwrite_cntr = cntr;
+      sstmaci_ep_bind_cntrs(ep);
+      break;
+    }
     case FI_CLASS_MR: //TODO
       return -FI_EINVAL;
     case FI_CLASS_SRX_CTX:
@@ -859,6 +921,7 @@ extern "C" DIRECT_FN  int sumi_ep_open(struct fid_domain *domain, struct fi_info
   if (info->rx_attr){
     ep_impl->op_flags = info->rx_attr->op_flags;
   }
+  ep_impl->min_multi_recv = SUMI_INJECT_SIZE;
 
   ep_impl->type = info->ep_attr->type;
 
@@ -907,13 +970,27 @@ extern "C" int sumi_getopt(fid_t fid, int level, int optname,
 EXTERN_C DIRECT_FN STATIC  int sumi_ep_setopt(fid_t fid, int level, int optname,
 				    const void *optval, size_t optlen)
 {
-  return -FI_ENOPROTOOPT;
+  return sumi_setopt(fid, level, optname, optval, optlen);
 }
 
 extern "C" int sumi_setopt(fid_t fid, int level, int optname,
 				    const void *optval, size_t optlen)
 {
-  return -FI_EINVAL;
+  if (level != FI_OPT_ENDPOINT || fid->fclass != FI_CLASS_EP){
+    return -FI_ENOPROTOOPT;
+  }
+
+  sumi_fid_ep* ep = (sumi_fid_ep*) fid;
+  switch (optname){
+    case FI_OPT_MIN_MULTI_RECV:
+      if (optlen != sizeof(size_t)){
+        return -FI_EINVAL;
+      }
+      ep->min_multi_recv = *(const size_t*) optval;
+      return FI_SUCCESS;
+    default:
+      return -FI_ENOPROTOOPT;
+  }
 }
 
 DIRECT_FN STATIC ssize_t sumi_ep_rx_size_left(struct fid_ep *ep)
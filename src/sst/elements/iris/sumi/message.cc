@@ -75,6 +75,7 @@ Message::tostr(class_t ty)
     enumcase(terminate);
     enumcase(no_class);
     enumcase(fake);
+    enumcase(aggregate);
   }
   sst_hg_throw_printf(SST::Hg::ValueError,
     "message::tostr: invalid message type %d", ty);
@@ -93,6 +94,49 @@ Message::serialize_order(SST::Hg::serializer &ser)
   NetworkMessage::serialize_order(ser);
 }
 
+AggregateMessage::~AggregateMessage()
+{
+  for (Message* m : msgs_) delete m;
+}
+
+std::string
+AggregateMessage::toString() const
+{
+  return SST::Hg::sprintf("aggregate of %d messages %d->%d: %s",
+            int(msgs_.size()), fromaddr(), toaddr(),
+            SST::Hg::NetworkMessage::typeStr());
+}
+
+void
+AggregateMessage::serialize_order(SST::Hg::serializer &ser)
+{
+  Message::serialize_order(ser);
+  ser & msgs_;
+}
+
+void
+AggregateMessage::add(Message* m)
+{
+  m->putOnWire();
+  msgs_.push_back(m);
+  setFlowSize(byteLength() + m->byteLength());
+  if (m->SST::Hg::NetworkMessage::needsAck()) setNeedsAck(true);
+}
+
+SST::Hg::NetworkMessage*
+AggregateMessage::cloneInjectionAck() const
+{
+  auto* cln = new AggregateMessage(*this);
+  cln->msgs_.clear();
+  for (Message* m : msgs_){
+    if (m->SST::Hg::NetworkMessage::needsAck()){
+      cln->msgs_.push_back(static_cast<Message*>(m->cloneInjectionAck()));
+    }
+  }
+  cln->convertToAck();
+  return cln;
+}
+
 static uint32_t crc32_for_byte(uint32_t r) {
   for(int j = 0; j < 8; ++j){
     r = (r & 1? 0: (uint32_t)0xEDB88320L) ^ r >> 1;
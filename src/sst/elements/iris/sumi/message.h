@@ -45,6 +45,7 @@ Questions? Contact sst-macro-help@sandia.gov
 #pragma once
 
 #include <memory>
+#include <vector>
 #include <mercury/common/util.h>
 #include <mercury/common/printable.h>
 #include <mercury/common/serializable.h>
@@ -314,5 +315,54 @@ class ProtocolMessage : public Message {
 
 };
 
+/**
+ * @class AggregateMessage
+ * Several small smsg sends to the same node carried as one network message.
+ * The server hands each one to its transport on arrival, and the injection
+ * ack of the bundle carries the injection acks of the messages that want one.
+ */
+class AggregateMessage : public Message {
+  ImplementSerializable(AggregateMessage)
+ public:
+  template <class... Args>
+  AggregateMessage(int sender, int recver, Args&&... args) :
+    Message(sender, recver, no_ack, no_ack, aggregate, std::forward<Args>(args)...)
+  {
+  }
+
+  ~AggregateMessage() override;
+
+  std::string toString() const override;
+
+  void serialize_order(SST::Hg::serializer& ser) override;
+
+  SST::Hg::NetworkMessage* cloneInjectionAck() const override;
+
+  /**
+   * Add a message to the bundle, its smsg buffer is put on the wire now
+   */
+  void add(Message* m);
+
+  const std::vector<Message*>& messages() const {
+    return msgs_;
+  }
+
+  /**
+   * @return The messages in the bundle, which no longer owns them
+   */
+  std::vector<Message*> release() {
+    std::vector<Message*> msgs;
+    msgs.swap(msgs_);
+    return msgs;
+  }
+
+ protected:
+  AggregateMessage(){} //for serialization
+
+ private:
+  std::vector<Message*> msgs_;
+
+};
+
 } // end namespace sumi
 
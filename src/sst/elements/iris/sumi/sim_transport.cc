@@ -44,6 +44,7 @@ Questions? Contact sst-macro-help@sandia.gov
 
 #include <output.h>
 #include <cstring>
+#include <iostream>
 #include <iris/sumi/transport.h>
 #include <iris/sumi/allreduce.h>
 #include <iris/sumi/reduce_scatter.h>
@@ -68,10 +69,14 @@ Questions? Contact sst-macro-help@sandia.gov
 #include <mercury/common/request.h>
 #include <mercury/operating_system/libraries/api.h>
 #include <mercury/common/errors.h>
+#include <mercury/common/events.h>
 
 //RegisterKeywords(
 //{ "lazy_watch", "whether failure notifications can be receive without active pinging" },
 //{ "eager_cutoff", "what message size in bytes to switch from eager to rendezvous" },
+//{ "collective_model", "messages (default) to simulate collectives, analytic to charge a latency/bandwidth cost" },
+//{ "collective_latency", "the per stage latency for analytic collectives" },
+//{ "collective_bandwidth", "the per rank bandwidth for analytic collectives" },
 //{ "use_put_protocol", "whether to use a put or get protocol for pt2pt sends" },
 //{ "algorithm", "the specific algorithm to use for a given collecitve" },
 //{ "comm_sync_stats", "whether to track synchronization stats for communication" },
@@ -83,6 +88,10 @@ Questions? Contact sst-macro-help@sandia.gov
 //{ "poll_delay", "the time it takes to poll for an incoming message" },
 //{ "rdma_pin_latency", "the latency for each RDMA pin information" },
 //{ "rdma_page_delay", "the per-page delay for RDMA pinning" },
+//{ "aggregate_window", "how long small smsg sends to a node are held to go out as one network message, 0 (default) disables aggregation" },
+//{ "aggregate_max_bytes", "the largest smsg send that is aggregated" },
+//{ "aggregate_max_messages", "the most sends in one aggregate, which goes out at once when full" },
+//{ "print_aggregate_stats", "whether each rank prints how many sends it aggregated at finalize" },
 //);
 
 #include <sst/core/event.h>
@@ -153,6 +162,16 @@ class SumiServer :
 
   void incomingRequest(SST::Hg::Request *req) override {
     Message* smsg = safe_cast(Message, req);
+    if (smsg->classType() == Message::aggregate){
+      auto* agg = static_cast<AggregateMessage*>(smsg);
+      output.output("SumiServer %d: incoming %s", os_->addr(), agg->toString().c_str());
+      for (Message* m : agg->release()){
+        m->takeOffWire();
+        incomingRequest(m);
+      }
+      delete agg;
+      return;
+    }
     output.output("SumiServer %d: incoming %s", os_->addr(), smsg->toString().c_str());
     SimTransport* tport = procs_[smsg->aid()][smsg->targetRank()];
     if (!tport){
@@ -225,6 +244,9 @@ SimTransport::SimTransport(SST::Params& params, SST::Hg::App* parent, SST::Compo
   default_progress_queue_(parent->os()),
   nic_ioctl_(parent->os()->nicDataIoctl()),
   qos_analysis_(nullptr),
+  aggregate_seq_(0),
+  aggregated_msgs_(0),
+  aggregate_bundles_(0),
   pragma_block_set_(false),
   pragma_timeout_(-1),
   os_(parent->os())
@@ -253,6 +275,11 @@ SimTransport::SimTransport(SST::Params& params, SST::Hg::App* parent, SST::Compo
   pin_delay_ = rdma_pin_latency_.ticks() || rdma_page_delay_.ticks();
   page_size_ = params.find<SST::UnitAlgebra>("rdma_page_size", "4096").getRoundedValue();
 
+  aggregate_window_ = TimeDelta(params.find<SST::UnitAlgebra>("aggregate_window", "0s").getValue().toDouble());
+  aggregate_max_bytes_ = params.find<SST::UnitAlgebra>("aggregate_max_bytes", "256B").getRoundedValue();
+  aggregate_max_messages_ = params.find<int>("aggregate_max_messages", 64);
+  print_aggregate_stats_ = params.find<bool>("print_aggregate_stats", false);
+
   output.output("%d", sid().app_);
   nproc_ = os_->nranks();
 
@@ -265,6 +292,7 @@ SimTransport::SimTransport(SST::Params& params, SST::Hg::App* parent, SST::Compo
   if (!engine_) engine_ = new CollectiveEngine(params, this);
 
   smp_optimize_ = params.find<bool>("smp_optimize", false);
+  default_progress_queue_.setBatchDelivery(params.find<bool>("batch_completions", false));
 }
 
 void
@@ -303,6 +331,12 @@ SimTransport::finish()
 {
   //this should really loop through and kill off all the pings
   //so none of them execute
+  if (print_aggregate_stats_ && aggregate_window_.ticks()){
+    double ratio = aggregate_bundles_ ? double(aggregated_msgs_) / aggregate_bundles_ : 0.;
+    std::cout << SST::Hg::sprintf("Rank %d aggregated %llu sends into %llu network messages, %.2f per message",
+                   rank_, (unsigned long long) aggregated_msgs_,
+                   (unsigned long long) aggregate_bundles_, ratio) << std::endl;
+  }
 }
 
 SimTransport::~SimTransport()
@@ -343,6 +377,12 @@ SimTransport::memcopyDelay(uint64_t bytes)
   //api_parent_app_->computeBlockMemcpy(bytes);
 }
 
+void
+SimTransport::blockDelay(SST::Hg::TimeDelta delay)
+{
+  SST::Hg::OperatingSystem::currentOs()->blockTimeout(delay);
+}
+
 void
 SimTransport::incomingEvent(Event * /*ev*/)
 {
@@ -405,7 +445,12 @@ SimTransport::send(Message* m)
         if (post_header_delay_.ticks()) {
           //api_parent_app_->compute(post_header_delay_);
         }
-        nic_ioctl_(m);
+        if (aggregate_window_.ticks() && m->byteLength() <= aggregate_max_bytes_
+            && m->toaddr() != m->fromaddr()){
+          aggregate(m);
+        } else {
+          nic_ioctl_(m);
+        }
       }
       break;
     case SST::Hg::NetworkMessage::posted_send:
@@ -427,6 +472,44 @@ SimTransport::send(Message* m)
   }
 }
 
+void
+SimTransport::aggregate(Message* m)
+{
+  auto key = std::make_pair(m->toaddr(), m->qos());
+  auto iter = aggregates_.find(key);
+  if (iter == aggregates_.end()){
+    auto* agg = new AggregateMessage(m->sender(), m->recver(),
+                        m->qos(), allocateFlowId(), serverLibname(), sid().app_,
+                        m->toaddr(), m->fromaddr(),
+                        0, false, nullptr, Message::smsg{});
+    uint64_t seq = aggregate_seq_++;
+    iter = aggregates_.emplace(key, PendingAggregate{agg, seq}).first;
+    scheduleDelay(aggregate_window_,
+      SST::Hg::newCallback(this, &SimTransport::flushAggregate, key.first, key.second, seq));
+  }
+
+  AggregateMessage* agg = iter->second.msg;
+  agg->add(m);
+  ++aggregated_msgs_;
+  if (int(agg->messages().size()) >= aggregate_max_messages_){
+    flushAggregate(key.first, key.second, iter->second.seq);
+  }
+}
+
+void
+SimTransport::flushAggregate(SST::Hg::NodeId node, int qos, uint64_t seq)
+{
+  auto iter = aggregates_.find(std::make_pair(node, qos));
+  //the timer of a bundle that already went out full
+  if (iter == aggregates_.end() || iter->second.seq != seq) return;
+
+  AggregateMessage* agg = iter->second.msg;
+  aggregates_.erase(iter);
+  ++aggregate_bundles_;
+  output.output("Rank %d SUMI sending %s", rank_, agg->toString().c_str());
+  nic_ioctl_(agg);
+}
+
 void
 SimTransport::smsgSendResponse(Message* m, uint64_t size, void* buffer, int local_cq, int remote_cq, int qos)
 {
@@ -536,7 +619,9 @@ CollectiveEngine::CollectiveEngine(SST::Params& params, Transport *tport) :
   global_domain_(nullptr),
   eager_cutoff_(512),
   use_put_protocol_(false),
-  system_collective_tag_(-1) //negative tags reserved for special system work
+  system_collective_tag_(-1), //negative tags reserved for special system work
+  analytic_collectives_(false),
+  collective_byte_delay_(0)
 {
   global_domain_ = new GlobalCommunicator(tport);
   eager_cutoff_ = params.find<int>("eager_cutoff", 512);
@@ -544,6 +629,15 @@ CollectiveEngine::CollectiveEngine(SST::Params& params, Transport *tport) :
   alltoall_type_ = params.find<std::string>("alltoall", "bruck");
   allgather_type_ = params.find<std::string>("allgather", "bruck");
 
+  std::string model = params.find<std::string>("collective_model", "messages");
+  if (model == "analytic"){
+    analytic_collectives_ = true;
+  } else if (model != "messages"){
+    sst_hg_abort_printf("invalid collective_model %s: must be messages or analytic", model.c_str());
+  }
+  collective_latency_ = TimeDelta(params.find<SST::UnitAlgebra>("collective_latency", "1us").getValue().toDouble());
+  collective_byte_delay_ = params.find<SST::UnitAlgebra>("collective_bandwidth", "10GB/s").getValue().inverse().toDouble();
+
   int default_qos = params.find<int>("default_qos", 0);
   rdma_get_qos_ = params.find<int>("collective_rdma_get_qos", default_qos);
   rdma_header_qos_ = params.find<int>("collective_rdma_header_qos", default_qos);
@@ -604,11 +698,68 @@ CollectiveEngine::skipCollective(Collective::type_t ty,
   return nullptr;
 }
 
+CollectiveDoneMessage*
+CollectiveEngine::analyticCollective(Collective::type_t ty,
+  int cq_id, Communicator* comm,
+  void* dst, void *src,
+  int nelems, int type_size,
+  int tag)
+{
+  if (!analytic_collectives_) return nullptr;
+
+  if (!comm) comm = global_domain_;
+  int nproc = comm->nproc();
+  int me = comm->myCommRank();
+  int stages = 0;
+  while ((1 << stages) < nproc) ++stages;
+
+  double lat = collective_latency_.sec();
+  double bytes = double(nelems) * type_size;
+  double byte_time = bytes * collective_byte_delay_;
+  double seconds = 0;
+  switch (ty){
+    case Collective::allreduce:
+      //recursive halving reduce-scatter, then recursive doubling allgather
+      seconds = 2*stages*lat + 2*byte_time*(nproc-1)/nproc;
+      tport_->memcopy(dst, src, bytes);
+      break;
+    case Collective::reduce:
+    case Collective::bcast:
+      //binomial tree, the full buffer at every stage
+      seconds = stages*(lat + byte_time);
+      if (ty == Collective::reduce) tport_->memcopy(dst, src, bytes);
+      break;
+    case Collective::alltoall:
+      //pairwise exchange, nelems goes to each rank
+      seconds = (nproc-1)*(lat + byte_time);
+      if (isNonNullBuffer(dst) && isNonNullBuffer(src)){
+        tport_->memcopy((char*)dst + me*bytes, (char*)src + me*bytes, bytes);
+      }
+      break;
+    case Collective::allgather:
+      //recursive doubling, nelems comes from each rank
+      seconds = stages*lat + (nproc-1)*byte_time;
+      if (isNonNullBuffer(dst)){
+        tport_->memcopy((char*)dst + me*bytes, src, bytes);
+      }
+      break;
+    case Collective::barrier:
+      seconds = stages*lat;
+      break;
+    default:
+      return nullptr;
+  }
+
+  tport_->blockDelay(TimeDelta(seconds));
+  return new CollectiveDoneMessage(tag, ty, comm, cq_id);
+}
+
 CollectiveDoneMessage*
 CollectiveEngine::allreduce(void* dst, void *src, int nelems, int type_size, int tag, reduce_fxn fxn,
                             int cq_id, Communicator* comm)
 {
   auto* msg = skipCollective(Collective::allreduce, cq_id, comm, dst, src, nelems, type_size, tag);
+  if (!msg) msg = analyticCollective(Collective::allreduce, cq_id, comm, dst, src, nelems, type_size, tag);
   if (msg) {
     return msg;
   }
@@ -682,6 +833,7 @@ CollectiveEngine::reduce(int root, void* dst, void *src, int nelems, int type_si
                           int cq_id, Communicator* comm)
 {
   auto* msg = skipCollective(Collective::reduce, cq_id, comm, dst, src, nelems, type_size, tag);
+  if (!msg) msg = analyticCollective(Collective::reduce, cq_id, comm, dst, src, nelems, type_size, tag);
   if (msg) return msg;
 
   if (!comm) comm = global_domain_;
@@ -694,6 +846,7 @@ CollectiveEngine::bcast(int root, void *buf, int nelems, int type_size, int tag,
                          int cq_id, Communicator* comm)
 {
   auto* msg = skipCollective(Collective::bcast, cq_id, comm, buf, buf, nelems, type_size, tag);
+  if (!msg) msg = analyticCollective(Collective::bcast, cq_id, comm, buf, buf, nelems, type_size, tag);
   if (msg) return msg;
 
   if (!comm) comm = global_domain_;
@@ -757,6 +910,7 @@ CollectiveEngine::alltoall(void *dst, void *src, int nelems, int type_size, int
                             int cq_id, Communicator* comm)
 {
   auto* msg = skipCollective(Collective::alltoall, cq_id, comm, dst, src, nelems, type_size, tag);
+  if (!msg) msg = analyticCollective(Collective::alltoall, cq_id, comm, dst, src, nelems, type_size, tag);
   if (msg) {
     return msg;
   }
@@ -832,6 +986,7 @@ CollectiveEngine::allgather(void *dst, void *src, int nelems, int type_size, int
                              int cq_id, Communicator* comm)
 {
   auto* msg = skipCollective(Collective::allgather, cq_id, comm, dst, src, nelems, type_size, tag);
+  if (!msg) msg = analyticCollective(Collective::allgather, cq_id, comm, dst, src, nelems, type_size, tag);
   if (msg) return msg;
 
   if (!comm) comm = global_domain_;
@@ -917,6 +1072,7 @@ CollectiveDoneMessage*
 CollectiveEngine::barrier(int tag, int cq_id, Communicator* comm)
 {
   auto* msg = skipCollective(Collective::barrier, cq_id, comm, 0, 0, 0, 0, tag);
+  if (!msg) msg = analyticCollective(Collective::barrier, cq_id, comm, 0, 0, 0, 0, tag);
   if (msg) return msg;
 
   if (!comm) comm = global_domain_;
@@ -75,6 +75,7 @@ Questions? Contact sst-macro-help@sandia.gov
 
 #include <unordered_map>
 #include <queue>
+#include <map>
 
 namespace SST::Iris::sumi {
 
@@ -184,6 +185,8 @@ class SimTransport : public Transport, public SST::Hg::API {
 
   void memcopyDelay(uint64_t bytes) override;
 
+  void blockDelay(SST::Hg::TimeDelta delay) override;
+
   int* nidlist() const override;
 
   void incomingEvent(SST::Event *ev);
@@ -296,6 +299,29 @@ class SimTransport : public Transport, public SST::Hg::API {
   int page_size_;
   bool pin_delay_;
 
+  /**
+   * Hold a small smsg send for the bundle to its node, which goes to the
+   * NIC when the aggregation window closes or the bundle is full
+   */
+  void aggregate(Message* m);
+
+  void flushAggregate(SST::Hg::NodeId node, int qos, uint64_t seq);
+
+  struct PendingAggregate {
+    AggregateMessage* msg;
+    uint64_t seq;
+  };
+  std::map<std::pair<SST::Hg::NodeId,int>, PendingAggregate> aggregates_;
+  uint64_t aggregate_seq_;
+
+  SST::Hg::TimeDelta aggregate_window_;
+  uint64_t aggregate_max_bytes_;
+  int aggregate_max_messages_;
+  bool print_aggregate_stats_;
+
+  uint64_t aggregated_msgs_; //small sends that went out in a bundle
+  uint64_t aggregate_bundles_; //network messages those bundles took
+
  protected:
   void registerNullHandler(std::function<void(Message*)> f){
     null_completion_notify_ = f;
@@ -213,6 +213,11 @@ class Transport {
 
   virtual void memcopyDelay(uint64_t bytes) = 0;
 
+  /**
+   * Block the calling thread for the given amount of simulated time
+   */
+  virtual void blockDelay(SST::Hg::TimeDelta delay) = 0;
+
   virtual double wallTime() const = 0;
 
   virtual SST::Hg::Timestamp now() const = 0;
@@ -526,6 +531,17 @@ class CollectiveEngine
 
   CollectiveDoneMessage* startCollective(Collective* coll);
 
+  /**
+   * With collective_model=analytic, charge the collective a closed form
+   * latency/bandwidth cost instead of exchanging messages
+   * @return The done message, nullptr if the collective must be simulated
+   */
+  CollectiveDoneMessage* analyticCollective(Collective::type_t ty,
+                        int cq_id, Communicator* comm,
+                        void* dst, void *src,
+                        int nelems, int type_size,
+                        int tag);
+
   void validateCollective(Collective::type_t ty, int tag);
 
   CollectiveDoneMessage* deliverPending(Collective* coll, int tag, Collective::type_t ty);
@@ -557,6 +573,10 @@ class CollectiveEngine
   std::string alltoall_type_;
   std::string allgather_type_;
 
+  bool analytic_collectives_;
+  SST::Hg::TimeDelta collective_latency_;
+  double collective_byte_delay_; //seconds per byte
+
   int rdma_header_qos_;
   int rdma_get_qos_;
   int smsg_qos_;
@@ -26,6 +26,7 @@
 #include <sst/core/timeConverter.h>
 #include <sst/core/unitAlgebra.h>
 #include <sst/core/interfaces/simpleNetwork.h>
+#include <sst/elements/pool/objectPool.h>
 
 using namespace SST;
 
@@ -39,6 +40,10 @@ public:
 
     inline NocEventType getType() const { return type; }
 
+    // Packets and credits are created for every packet hop, all noc
+    // events share one pool
+    SST_ELEMENT_POOL_OPERATORS(SST::Kingsley::BaseNocEvent)
+
     void serialize_order(SST::Core::Serialization::serializer &ser)  override {
         Event::serialize_order(ser);
         ser & type;
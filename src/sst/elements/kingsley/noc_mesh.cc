@@ -156,8 +156,13 @@ noc_mesh::noc_mesh(ComponentId_t cid, Params& params) :
     }
 
 
-    // Allocate space for all the input buffers
+    // Allocate space for all the input buffers.  Every packet is at
+    // least one flit, so the buffer size bounds the queue length.
     port_queues = new port_queue_t[local_port_start + local_ports];
+    for ( int i = 0; i < local_port_start + local_ports; ++i ) {
+        port_queues[i].reserve(input_buf_size / flit_size);
+    }
+    occupied_ports = 0;
     port_busy = new int[local_port_start + local_ports];
     for ( int i = 0; i < local_port_start + local_ports; ++i ) {
         port_busy[i] = 0;
@@ -170,49 +175,34 @@ noc_mesh::noc_mesh(ComponentId_t cid, Params& params) :
 }
 
 void
-noc_mesh::route(noc_mesh_event* event)
+noc_mesh::buildRouteTable()
 {
-    if ( route_y_first ) {
-        // Compute next port
-        if ( event->dest_mesh_loc.second > my_y ) {
-            event->next_port = north_port;
-        }
-        else if ( event->dest_mesh_loc.second < my_y ) {
-            event->next_port = south_port;
-        }
-        else {
-            if ( event->dest_mesh_loc.first > my_x ) {
-                event->next_port = east_port;
-            }
-            else if ( event->dest_mesh_loc.first < my_x) {
-                event->next_port = west_port;
+    route_table.resize(x_size * y_size);
+    for ( int y = 0; y < y_size; ++y ) {
+        for ( int x = 0; x < x_size; ++x ) {
+            int next_port = -1;
+            if ( route_y_first ) {
+                if ( y > my_y ) next_port = north_port;
+                else if ( y < my_y ) next_port = south_port;
+                else if ( x > my_x ) next_port = east_port;
+                else if ( x < my_x ) next_port = west_port;
             }
             else {
-                event->next_port = event->egress_port;
+                if ( x > my_x ) next_port = east_port;
+                else if ( x < my_x ) next_port = west_port;
+                else if ( y > my_y ) next_port = north_port;
+                else if ( y < my_y ) next_port = south_port;
             }
+            route_table[y * x_size + x] = next_port;
         }
     }
+}
 
-    else {
-        // Compute next port
-        if ( event->dest_mesh_loc.first > my_x ) {
-            event->next_port = east_port;
-        }
-        else if ( event->dest_mesh_loc.first < my_x) {
-            event->next_port = west_port;
-        }
-        else {
-            if ( event->dest_mesh_loc.second > my_y ) {
-                event->next_port = north_port;
-            }
-            else if ( event->dest_mesh_loc.second < my_y) {
-                event->next_port = south_port;
-            }
-            else {
-                event->next_port = event->egress_port;
-            }
-        }
-    }
+void
+noc_mesh::route(noc_mesh_event* event)
+{
+    int next_port = route_table[event->dest_mesh_loc.second * x_size + event->dest_mesh_loc.first];
+    event->next_port = next_port == -1 ? event->egress_port : next_port;
 }
 
 
@@ -226,6 +216,10 @@ noc_mesh::handle_input_r2r(Event* ev, int port)
     case BaseNocEvent::CREDIT:
     {
         credit_event* credit_ret = static_cast<credit_event*>(ev);
+        // Wake up first so the stalls while the clock was off are
+        // counted against the old credits
+        if (clock_is_off && occupied_ports)
+            clock_wakeup();
         port_credits[port] += credit_ret->credits;
         // output.output("(%d,%d): Got credit event for VN %d with %d credits\n",my_x,my_y,credit_ret->vn,credit_ret->credits);
         delete ev;
@@ -238,9 +232,10 @@ noc_mesh::handle_input_r2r(Event* ev, int port)
         route(event);
 
         // Put the event into the proper queue
-        port_queues[port].push(event);
         if (clock_is_off)
             clock_wakeup();
+        port_queues[port].push(event);
+        occupied_ports |= 1 << port;
         break;
     }
     default:
@@ -318,6 +313,8 @@ noc_mesh::handle_input_ep2r(Event* ev, int port)
     case BaseNocEvent::CREDIT:
     {
         credit_event* credit_ret = static_cast<credit_event*>(ev);
+        if (clock_is_off && occupied_ports)
+            clock_wakeup();
         port_credits[port] += credit_ret->credits;
         delete ev;
         break;
@@ -331,9 +328,10 @@ noc_mesh::handle_input_ep2r(Event* ev, int port)
         route(event);
 
         // Need to put the event into the proper queue
-        port_queues[port].push(event);
         if (clock_is_off)
             clock_wakeup();
+        port_queues[port].push(event);
+        occupied_ports |= 1 << port;
         break;
     }
     default:
@@ -360,6 +358,18 @@ void noc_mesh::clock_wakeup() {
         port_busy[i] = (port_busy[i] < cyclesOff) ? 0 : port_busy[i] - cyclesOff;
     }
 
+    // The clock only turns off with packets queued if every head is
+    // waiting on credits, so each of them stalled on every cycle we
+    // skipped.  Nothing was sent during those cycles, so the lru
+    // units are in the same order they would have been.
+    if ( cyclesOff > 0 ) {
+        for ( int i = 0; i < local_port_start + local_ports; ++i ) {
+            if ( occupied_ports & (1 << i) ) {
+                output_port_stalls[port_queues[i].front()->next_port]->addDataNTimes(cyclesOff, 1);
+            }
+        }
+    }
+
     // unsigned int local_progress = (cyclesOff * local_lru.size()) % (local_lru.size() * 2);
     // unsigned int mesh_progress = (cyclesOff * mesh_lru.size()) % (mesh_lru.size() * 2);
     // // Update lru info
@@ -419,6 +429,7 @@ noc_mesh::clock_handler(Cycle_t cycle)
 
                     // port_queues[local_port_start + i].pop();
                     port_queues[lru_port].pop();
+                    if ( port_queues[lru_port].empty() ) occupied_ports &= ~(1 << lru_port);
                     port_credits[port] -= event->encap_ev->getSizeInFlits();
                     port_busy[port] = event->encap_ev->getSizeInFlits();
                     if ( edge_status & ( 1 << port) ) {
@@ -447,13 +458,16 @@ noc_mesh::clock_handler(Cycle_t cycle)
                     // ports[local_port_start + i]->send(cr_ev);
                     ports[lru_port]->send(cr_ev);
                     lru.satisfied(true);
+                    // The next packet may be able to go next cycle
+                    if (!port_queues[lru_port].empty())
+                        keepClockOn = true;
                 }
                 else {
+                    // Only a credit return can unblock this, which
+                    // will turn the clock back on
                     output_port_stalls[port]->addData(1);
                     lru.satisfied(false);
                 }
-                if (!port_queues[lru_port].empty())
-                    keepClockOn = true;
             }
             else {
                 lru.satisfied(false);
@@ -1069,6 +1083,8 @@ noc_mesh::init(unsigned int phase)
 		delete cr_ev;
             }
         }
+        // The mesh dimensions and our location are known by now
+        buildRouteTable();
         init_state = 11;
         // Falls through on purpose
     }
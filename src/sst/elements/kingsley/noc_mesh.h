@@ -27,10 +27,11 @@
 
 #include <sst/core/statapi/stataccumulator.h>
 
-#include <queue>
+#include <vector>
 
 #include "sst/elements/kingsley/nocEvents.h"
 #include "sst/elements/kingsley/lru_unit.h"
+#include "sst/elements/kingsley/ring_queue.h"
 
 using namespace SST;
 
@@ -111,8 +112,11 @@ private:
     bool route_y_first;
 
 
-    typedef std::queue<noc_mesh_event*> port_queue_t;
+    typedef ring_queue<noc_mesh_event*> port_queue_t;
 
+    // The clock is turned off when every input queue is empty or has
+    // a head that is waiting on credits, and turned back on when a
+    // packet or credit arrives.
     Clock::Handler<noc_mesh>* my_clock_handler;
     TimeConverter* clock_tc;
     void clock_wakeup();
@@ -121,6 +125,8 @@ private:
 
     Link** ports;
     port_queue_t* port_queues;
+    // Bit for each input port with a non-empty queue
+    unsigned int occupied_ports;
     int* port_busy;
     int* port_credits;
     int local_ports;
@@ -143,6 +149,12 @@ private:
 
     void route(noc_mesh_event* event);
 
+    // Next port for each destination router, indexed by y * x_size + x.
+    // -1 means the destination is this router and the packet leaves
+    // on its egress port.
+    std::vector<int> route_table;
+    void buildRouteTable();
+
 
     Statistic<uint64_t>** send_bit_count;
     Statistic<uint64_t>** output_port_stalls;
@@ -0,0 +1,76 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef COMPONENTS_KINGSLEY_RING_QUEUE_H
+#define COMPONENTS_KINGSLEY_RING_QUEUE_H
+
+#include <stddef.h>
+
+namespace SST {
+namespace Kingsley {
+
+// FIFO backed by a power of two ring buffer.  Input queues are sized
+// from the input buffer, so the steady state does no allocation, but
+// grow if they fill.
+template <typename T>
+class ring_queue {
+public:
+    ring_queue() : data(NULL), capacity(0), head(0), count(0) {}
+    ~ring_queue() { delete [] data; }
+
+    ring_queue(const ring_queue&) = delete;
+    ring_queue& operator=(const ring_queue&) = delete;
+
+    void reserve(size_t entries) { if ( entries > capacity ) grow(entries); }
+
+    inline bool empty() const { return count == 0; }
+    inline size_t size() const { return count; }
+
+    inline T& front() { return data[head]; }
+
+    inline void push(const T& value) {
+        if ( count == capacity ) grow(count + 1);
+        data[(head + count) & (capacity - 1)] = value;
+        count++;
+    }
+
+    inline void pop() {
+        head = (head + 1) & (capacity - 1);
+        count--;
+    }
+
+private:
+    void grow(size_t entries) {
+        size_t new_capacity = capacity ? capacity : 4;
+        while ( new_capacity < entries ) new_capacity <<= 1;
+        T* new_data = new T[new_capacity];
+        for ( size_t i = 0; i < count; ++i ) new_data[i] = data[(head + i) & (capacity - 1)];
+        delete [] data;
+        data = new_data;
+        capacity = new_capacity;
+        head = 0;
+    }
+
+    T* data;
+    size_t capacity;
+    size_t head;
+    size_t count;
+};
+
+}
+}
+
+#endif // COMPONENTS_KINGSLEY_RING_QUEUE_H
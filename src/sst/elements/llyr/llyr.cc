@@ -83,7 +83,7 @@ LlyrComponent::LlyrComponent(ComponentId_t id, Params& params) :
     }
 
     //need a 'global' LS queue for reordering
-    ls_queue_ = new LSQueue();
+    ls_queue_ = new LSQueue( params.find< bool >("coalesce_loads", 0) );
     ls_entries_ = params.find< uint32_t >("ls_entries", 1);
 
     mem_handlers_ = new LlyrMemHandlers(this, ls_queue_, output_);
@@ -98,8 +98,9 @@ LlyrComponent::LlyrComponent(ComponentId_t id, Params& params) :
     uint16_t fp_div_latency = params.find< uint16_t >("fp_div_latency", 40);
     uint16_t complex_latency = params.find< uint16_t >("complex_latency_", 80);
     std::string mapping_tool_ = params.find< std::string >("mapping_tool", "");
+    std::string mapping_cache = params.find< std::string >("mapping_cache", "");
 
-    configData_ = new LlyrConfig { ls_queue_, mem_interface_, starting_addr_, mapping_tool_, verbosity, queue_depth,
+    configData_ = new LlyrConfig { ls_queue_, mem_interface_, starting_addr_, mapping_tool_, mapping_cache, verbosity, queue_depth,
                                    arith_latency, int_latency, int_div_latency, fp_latency, fp_mul_latency, fp_div_latency,
                                    complex_latency };
 
@@ -120,10 +121,12 @@ LlyrComponent::LlyrComponent(ComponentId_t id, Params& params) :
     output_->verbose(CALL_INFO, 1, 0, "Mapping application to hardware with %s\n", mapperName.c_str());
     llyr_mapper_->mapGraph(hardwareGraph_, applicationGraph_, mappedGraph_, configData_);
     mappedGraph_.printDotHardware("llyr_mapped.dot");
+    buildSchedule();
 
     //init stats
     zeroEventCycles_ = registerStatistic< uint64_t >("cycles_zero_events");
     eventCycles_ = registerStatistic< uint64_t >("cycles_events");
+    loadsCoalesced_ = registerStatistic< uint64_t >("loads_coalesced");
 
     //all done
     output_->verbose(CALL_INFO, 1, 0, "Initialization done.\n");
@@ -211,22 +214,16 @@ void LlyrComponent::setup()
 
 void LlyrComponent::finish()
 {
+    loadsCoalesced_->addData( ls_queue_->getNumCoalesced() );
 }
 
-bool LlyrComponent::tick(SST::Cycle_t currentCycle)
+// The mapped graph does not change after mapping, so the BFS order tick() used to
+// compute every cycle is computed once here into a dense array of PEs
+void LlyrComponent::buildSchedule()
 {
-    // TraceFunction trace(CALL_INFO_LONG);
-    if( clock_enabled_ == 0 ) {
-        return false;
-    }
-
-    compute_complete = 0;
-    //On each tick perform BFS on graph and compute based on operand availability
     //NOTE node0 is a dummy node to simplify the algorithm
     std::queue< uint32_t > nodeQueue;
 
-    output_->verbose(CALL_INFO, 1, 0, "Device clock tick\n");
-
     //Mark all nodes in the PE graph un-visited
     std::map< uint32_t, Vertex< ProcessingElement* > >* vertex_map_ = mappedGraph_.getVertexMap();
     typename std::map< uint32_t, Vertex< ProcessingElement* > >::iterator vertexIterator;
@@ -234,33 +231,22 @@ bool LlyrComponent::tick(SST::Cycle_t currentCycle)
         vertexIterator->second.setVisited(0);
     }
 
+    pe_schedule_.clear();
+    pe_schedule_ids_.clear();
+
     //Node 0 is a dummy node and is always the entry point
     nodeQueue.push(0);
+    vertex_map_->at(0).setVisited(1);
 
-    //BFS and do operations if values available in input queues
     while( nodeQueue.empty() == 0 ) {
         uint32_t currentNode = nodeQueue.front();
         nodeQueue.pop();
 
-        std::vector< Edge* >* adjacencyList = vertex_map_->at(currentNode).getAdjacencyList();
-
-        //set visited for bfs
-        vertex_map_->at(currentNode).setVisited(1);
-
-        //send n responses from L/S unit to destination
-        doLoadStoreOps(ls_entries_);
-
-        //Let the PE decide whether or not it can do the compute
-        vertex_map_->at(currentNode).getValue()->doCompute();
-
-        //send one item from each output queue to destination
-        vertex_map_->at(currentNode).getValue()->doSend();
-
-        compute_complete = compute_complete | vertex_map_->at(currentNode).getValue()->getPendingOp();
-        output_->verbose(CALL_INFO, 1, 0, "PE(%" PRIu32 ") pending: %" PRIu32 " status: %" PRIu32 "\n\n",
-                        currentNode, vertex_map_->at(currentNode).getValue()->getPendingOp(), compute_complete );
+        pe_schedule_.push_back(vertex_map_->at(currentNode).getValue());
+        pe_schedule_ids_.push_back(currentNode);
 
         //add the destination vertices from this node to the node queue
+        std::vector< Edge* >* adjacencyList = vertex_map_->at(currentNode).getAdjacencyList();
         for( auto it = adjacencyList->begin(); it != adjacencyList->end(); it++ ) {
             uint32_t destinationVertx = (*it)->getDestination();
             if( vertex_map_->at(destinationVertx).getVisited() == 0 ) {
@@ -270,6 +256,42 @@ bool LlyrComponent::tick(SST::Cycle_t currentCycle)
         }
     }
 
+    output_->verbose(CALL_INFO, 1, 0, "Scheduling %zu PEs each tick\n", pe_schedule_.size());
+}
+
+bool LlyrComponent::tick(SST::Cycle_t currentCycle)
+{
+    // TraceFunction trace(CALL_INFO_LONG);
+    if( clock_enabled_ == 0 ) {
+        return false;
+    }
+
+    compute_complete = 0;
+    ls_queue_->newCycle();
+
+    //On each tick visit the PEs in BFS order and compute based on operand availability
+    output_->verbose(CALL_INFO, 1, 0, "Device clock tick\n");
+
+    for( size_t i = 0; i < pe_schedule_.size(); ++i ) {
+        ProcessingElement* pe = pe_schedule_[i];
+
+        //send n responses from L/S unit to destination
+        doLoadStoreOps(ls_entries_);
+
+        //an idle PE would not compute or send, only PEs with data are fired
+        if( pe->isIdle() == 0 ) {
+            //Let the PE decide whether or not it can do the compute
+            pe->doCompute();
+
+            //send one item from each output queue to destination
+            pe->doSend();
+        }
+
+        compute_complete = compute_complete | pe->getPendingOp();
+        output_->verbose(CALL_INFO, 1, 0, "PE(%" PRIu32 ") pending: %" PRIu32 " status: %" PRIu32 "\n\n",
+                        pe_schedule_ids_[i], pe->getPendingOp(), compute_complete );
+    }
+
     // return false so we keep going
     if( compute_complete == 1 ){
         eventCycles_->addData(1);
@@ -371,19 +393,19 @@ void LlyrComponent::doLoadStoreOps( uint32_t numOps )
     output_->verbose(CALL_INFO, 10, 0, "Doing L/S ops\n");
     for(uint32_t i = 0; i < numOps; ++i ) {
         if( ls_queue_->getNumEntries() > 0 ) {
-            StandardMem::Request::id_t next = ls_queue_->getNextEntry();
+            LSEntry* next = ls_queue_->getNextEntry();
 
-            if( ls_queue_->getEntryReady(next) == 1) {
-                output_->verbose(CALL_INFO, 10, 0, "--(1)Mem Req ID %" PRIu32 "\n", uint32_t(next));
-                LlyrData data = ls_queue_->getEntryData(next);
+            if( next->getReady() == 1) {
+                output_->verbose(CALL_INFO, 10, 0, "--(1)Mem Req ID %" PRIu32 "\n", uint32_t(next->getReqId()));
+                LlyrData data = next->getData();
                 //pass the value to the appropriate PE
-                uint32_t srcPe = ls_queue_->lookupEntry( next ).first;
+                uint32_t srcPe = next->getSourcePe();
 
                 mappedGraph_.getVertex(srcPe)->getValue()->doReceive(data);
 
                 ls_queue_->removeEntry( next );
-            } else if( ls_queue_->getEntryReady(next) == 2 ){
-                output_->verbose(CALL_INFO, 10, 0, "--(2)Mem Req ID %" PRIu32 "\n", uint32_t(next));
+            } else if( next->getReady() == 2 ){
+                output_->verbose(CALL_INFO, 10, 0, "--(2)Mem Req ID %" PRIu32 "\n", uint32_t(next->getReqId()));
                 ls_queue_->removeEntry( next );
             }
         }
@@ -59,8 +59,10 @@ public:
         { "application",    "Application in affine IR", "app.in" },
         { "hardware_graph", "Hardware connectivity graph", "grid.cfg" },
         { "mapping_tool",   "External mapping tool", "" },
+        { "mapping_cache",  "Directory to keep external mapping tool solutions in, keyed by a hash of the inputs, empty to always run the tool", "" },
         { "mem_init",       "Memory initialization file", "" },
         { "ls_entries",     "Number of L/S entries to process each tick", "1" },
+        { "coalesce_loads", "Loads from different PEs to the same address in the same tick share one memory request", "0" },
         { "queue_depth",    "Number of buffer elements", "256" },
         { "arith_latency",  "Number of clock ticks for ARITH operations", "1" },
         { "int_latency",    "Number of clock ticks for INT operations", "1" },
@@ -75,6 +77,7 @@ public:
     SST_ELI_DOCUMENT_STATISTICS(
         { "cycles_zero_events",  "Number of cycles where there were no events to process, no data tokens", "cycles", 1 },
         { "cycles_events",       "Number of cycles where events needed to be processed", "cycles", 1 },
+        { "loads_coalesced",     "Number of loads that shared another PE's memory request, see coalesce_loads", "loads", 1 },
     )
 
     SST_ELI_DOCUMENT_PORTS(
@@ -143,6 +146,7 @@ private:
 
     Statistic< uint64_t >* zeroEventCycles_;
     Statistic< uint64_t >* eventCycles_;
+    Statistic< uint64_t >* loadsCoalesced_;
 
     LlyrConfig* configData_;
     LlyrGraph< opType > hardwareGraph_;
@@ -151,6 +155,11 @@ private:
 
     LlyrMapper* llyr_mapper_;
 
+    // mapped PEs in the order tick() visits them, a BFS from the dummy node 0
+    std::vector< ProcessingElement* > pe_schedule_;
+    std::vector< uint32_t > pe_schedule_ids_;
+    void buildSchedule();
+
     void constructHardwareGraph( std::string fileName );
     void constructSoftwareGraph( std::string fileName );
     void constructSoftwareGraphIR( std::ifstream& inputStream );
@@ -49,6 +49,7 @@ typedef struct alignas(uint64_t) {
     StandardMem*    mem_interface_;
     Addr            starting_addr_;
     std::string     mapping_tool_;
+    std::string     mapping_cache_;
 
     uint32_t        verbosity_;
     uint16_t        queueDepth_;
@@ -22,6 +22,8 @@
 
 #include <map>
 #include <queue>
+#include <vector>
+#include <unordered_map>
 #include <bitset>
 #include <utility>
 #include <cstdint>
@@ -38,7 +40,7 @@ class LSEntry
 {
 public:
     LSEntry(const StandardMem::Request::id_t reqId, uint32_t srcProc, uint32_t dstProc) :
-            req_id_(reqId), src_proc_(srcProc), dst_proc_(dstProc), ready_(0) {}
+            req_id_(reqId), src_proc_(srcProc), dst_proc_(dstProc), ready_(0), follower_(nullptr) {}
     ~LSEntry() {}
 
     uint32_t getSourcePe() const { return src_proc_; }
@@ -52,6 +54,8 @@ public:
     uint32_t getReady() const{ return ready_; }
 
 protected:
+    friend class LSQueue;
+
     StandardMem::Request::id_t req_id_;
 
     uint32_t src_proc_;
@@ -60,64 +64,149 @@ protected:
     uint32_t ready_;
     LlyrData data_;
 
+    // next load sharing this entry's request, see LSQueue::coalesceLoad()
+    LSEntry* follower_;
+
 private:
 
 }; // LSEntry
 
+/*
+ * In-flight memory operations, retired in issue order.
+ *
+ * Entries waiting on a response are found by request ID in an open
+ * addressed table indexed by the ID modulo its capacity, and retired
+ * entries go back to a pool for the next request. With load coalescing on,
+ * a load to an address another PE already loaded this cycle is queued
+ * behind that load's entry and takes its response instead of sending its
+ * own request; a store to the address ends sharing for the rest of the
+ * cycle so later loads see it.
+ */
 class LSQueue
 {
 public:
-    LSQueue()
+    LSQueue(bool coalesceLoads = false) : slot_count_(0), coalesce_loads_(coalesceLoads), coalesced_(0)
     {
         //setup up i/o for messages
         char prefix[256];
         sprintf(prefix, "[t=@t][LSQueue]: ");
         output_ = new SST::Output(prefix, 0, 0, Output::STDOUT);
+
+        slots_.resize(64, nullptr);
     }
 
     LSQueue(const LSQueue &copy)
     {
         output_ = copy.output_;
         memory_queue_ = copy.memory_queue_;
-        pending_ = copy.pending_;
+        slots_ = copy.slots_;
+        slot_count_ = copy.slot_count_;
+        coalesce_loads_ = copy.coalesce_loads_;
+        coalesced_ = copy.coalesced_;
     }
 
-    ~LSQueue() {}
+    ~LSQueue()
+    {
+        for( auto it = pool_.begin(); it != pool_.end(); ++it ) {
+            delete *it;
+        }
+    }
 
     uint32_t getNumEntries() const { return memory_queue_.size(); }
-    StandardMem::Request::id_t getNextEntry() const { return memory_queue_.front(); }
+    LSEntry* getNextEntry() const { return memory_queue_.front(); }
+
+    // Number of loads that shared another load's request
+    uint64_t getNumCoalesced() const { return coalesced_; }
+
+    LSEntry* allocateEntry( const StandardMem::Request::id_t reqId, uint32_t srcProc, uint32_t dstProc )
+    {
+        if( pool_.empty() ) {
+            return new LSEntry( reqId, srcProc, dstProc );
+        }
+
+        LSEntry* entry = pool_.back();
+        pool_.pop_back();
+        *entry = LSEntry( reqId, srcProc, dstProc );
+        return entry;
+    }
 
     void addEntry( LSEntry* entry )
     {
-        memory_queue_.push( entry->getReqId() );
-        pending_.emplace( entry->getReqId(), entry );
+        memory_queue_.push( entry );
+        insertSlot( entry );
+    }
+
+    // Called at the start of every cycle, loads only coalesce within one
+    void newCycle()
+    {
+        if( !cycle_loads_.empty() ) {
+            cycle_loads_.clear();
+        }
+    }
+
+    // A load to addr was sent this cycle as entry
+    void recordLoad( uint64_t addr, LSEntry* entry )
+    {
+        if( coalesce_loads_ ) {
+            cycle_loads_[addr] = entry;
+        }
+    }
+
+    // A store to addr was sent, later loads this cycle must not share an earlier load's data
+    void recordStore( uint64_t addr )
+    {
+        if( coalesce_loads_ ) {
+            cycle_loads_.erase(addr);
+        }
+    }
+
+    // If a load to addr was sent this cycle, queue this one behind it and return true
+    bool coalesceLoad( uint64_t addr, uint32_t srcProc, uint32_t dstProc )
+    {
+        if( !coalesce_loads_ ) {
+            return false;
+        }
+
+        auto load = cycle_loads_.find( addr );
+        if( load == cycle_loads_.end() ) {
+            return false;
+        }
+
+        LSEntry* primary = load->second;
+        LSEntry* entry = allocateEntry( primary->getReqId(), srcProc, dstProc );
+        entry->follower_ = primary->follower_;
+        primary->follower_ = entry;
+        memory_queue_.push( entry );
+        coalesced_ = coalesced_ + 1;
+        return true;
     }
 
     std::pair< uint32_t, uint32_t > lookupEntry( StandardMem::Request::id_t id )
     {
-        auto entry = pending_.find( id );
-        if( entry == pending_.end() ) {
+        LSEntry* entry = findSlot( id );
+        if( entry == nullptr ) {
             output_->verbose(CALL_INFO, 0, 0, "Error: response from memory could not be found.\n");
             exit(-1);
         }
 
-        return std::make_pair( entry->second->getSourcePe(), entry->second->getTargetPe() );
+        return std::make_pair( entry->getSourcePe(), entry->getTargetPe() );
     }
 
-    void removeEntry( StandardMem::Request::id_t id )
+    // Retire the entry at the head of the queue
+    void removeEntry( LSEntry* entry )
     {
         memory_queue_.pop();
-        auto entry = pending_.find( id );
-        if( entry != pending_.end() ) {
-            pending_.erase(entry);
+        if( findSlot( entry->getReqId() ) == entry ) {
+            eraseSlot( entry->getReqId() );
         }
+        pool_.push_back( entry );
     }
 
     LlyrData getEntryData( StandardMem::Request::id_t id ) const
     {
-        auto entry = pending_.find( id );
-        if( entry != pending_.end() ) {
-            return entry->second->getData();
+        LSEntry* entry = findSlot( id );
+        if( entry != nullptr ) {
+            return entry->getData();
         }
 
         return 0;
@@ -125,17 +214,16 @@ public:
 
     void setEntryData( StandardMem::Request::id_t id, LlyrData data )
     {
-        auto entry = pending_.find( id );
-        if( entry != pending_.end() ) {
-            entry->second->setData(data);
+        for( LSEntry* entry = findSlot( id ); entry != nullptr; entry = entry->follower_ ) {
+            entry->setData(data);
         }
     }
 
     uint32_t getEntryReady( StandardMem::Request::id_t id ) const
     {
-        auto entry = pending_.find( id );
-        if( entry != pending_.end() ) {
-            return entry->second->getReady();
+        LSEntry* entry = findSlot( id );
+        if( entry != nullptr ) {
+            return entry->getReady();
         }
 
         return 0;
@@ -143,9 +231,8 @@ public:
 
     void setEntryReady( StandardMem::Request::id_t id, uint32_t ready )
     {
-        auto entry = pending_.find( id );
-        if( entry != pending_.end() ) {
-            entry->second->setReady(ready);
+        for( LSEntry* entry = findSlot( id ); entry != nullptr; entry = entry->follower_ ) {
+            entry->setReady(ready);
         }
     }
 
@@ -154,8 +241,76 @@ protected:
 private:
     SST::Output* output_;
 
-    std::queue< StandardMem::Request::id_t > memory_queue_;
-    std::map< StandardMem::Request::id_t, LSEntry* > pending_;
+    std::queue< LSEntry* > memory_queue_;
+
+    // entries waiting on a response, slot is the request ID modulo the capacity, linear probing
+    std::vector< LSEntry* > slots_;
+    uint32_t slot_count_;
+
+    std::vector< LSEntry* > pool_;
+
+    bool coalesce_loads_;
+    std::unordered_map< uint64_t, LSEntry* > cycle_loads_;
+    uint64_t coalesced_;
+
+    size_t slotIndex( StandardMem::Request::id_t id ) const { return id & (slots_.size() - 1); }
+
+    LSEntry* findSlot( StandardMem::Request::id_t id ) const
+    {
+        for( size_t i = slotIndex( id ); slots_[i] != nullptr; i = (i + 1) & (slots_.size() - 1) ) {
+            if( slots_[i]->getReqId() == id ) {
+                return slots_[i];
+            }
+        }
+        return nullptr;
+    }
+
+    void insertSlot( LSEntry* entry )
+    {
+        if( (slot_count_ + 1) * 2 > slots_.size() ) {
+            std::vector< LSEntry* > old;
+            old.swap( slots_ );
+            slots_.resize( old.size() * 2, nullptr );
+            for( auto it = old.begin(); it != old.end(); ++it ) {
+                if( *it != nullptr ) {
+                    placeSlot( *it );
+                }
+            }
+        }
+        placeSlot( entry );
+        slot_count_ = slot_count_ + 1;
+    }
+
+    void placeSlot( LSEntry* entry )
+    {
+        size_t i = slotIndex( entry->getReqId() );
+        while( slots_[i] != nullptr ) {
+            i = (i + 1) & (slots_.size() - 1);
+        }
+        slots_[i] = entry;
+    }
+
+    // Remove by shifting later entries of the probe run back so lookups need no tombstones
+    void eraseSlot( StandardMem::Request::id_t id )
+    {
+        size_t mask = slots_.size() - 1;
+        size_t i = slotIndex( id );
+        while( slots_[i]->getReqId() != id ) {
+            i = (i + 1) & mask;
+        }
+
+        size_t hole = i;
+        for( size_t j = (hole + 1) & mask; slots_[j] != nullptr; j = (j + 1) & mask ) {
+            size_t home = slotIndex( slots_[j]->getReqId() );
+            // move j into the hole unless its home lies cyclically in (hole, j]
+            if( ((j - home) & mask) >= ((j - hole) & mask) ) {
+                slots_[hole] = slots_[j];
+                hole = j;
+            }
+        }
+        slots_[hole] = nullptr;
+        slot_count_ = slot_count_ - 1;
+    }
 
 }; // LSQueue
 
@@ -20,6 +20,7 @@
 #include <vector>
 #include <string>
 #include <utility>
+#include <fstream>
 #include <iostream>
 #include <filesystem>
 #include <Python.h>
@@ -66,6 +67,7 @@ public:
 private:
 
     void runMappingTool( std::string );
+    std::string mappingKey( LlyrGraph< opType >&, LlyrGraph< AppNode >&, std::string ) const;
     void getAdjacencyList( std::string, std::vector< uint32_t >* );
     void getStateList( std::string, std::vector< std::string >* );
     void printDot( std::string, LlyrGraph< ProcessingElement* >* ) const;
@@ -84,6 +86,55 @@ void PyMapper::runMappingTool(std::string mapping_tool)
     Py_Finalize();
 }
 
+// FNV-1a over the app and hardware graphs and the text of the tool, anything the solution depends on
+std::string PyMapper::mappingKey(LlyrGraph< opType >& hardwareGraph, LlyrGraph< AppNode >& appGraph,
+                                 std::string mapping_tool) const
+{
+    uint64_t hash = 0xcbf29ce484222325ULL;
+    auto mix = [&hash](const void* data, size_t size) {
+        const unsigned char* bytes = static_cast< const unsigned char* >(data);
+        for( size_t i = 0; i < size; ++i ) {
+            hash = (hash ^ bytes[i]) * 0x100000001b3ULL;
+        }
+    };
+    auto mixEdges = [&mix](std::vector< Edge* >* adjacencyList) {
+        uint32_t count = adjacencyList->size();
+        mix(&count, sizeof(count));
+        for( auto it = adjacencyList->begin(); it != adjacencyList->end(); ++it ) {
+            uint32_t destination = (*it)->getDestination();
+            mix(&destination, sizeof(destination));
+        }
+    };
+
+    std::map< uint32_t, Vertex< opType > >* hardware_vertex_map = hardwareGraph.getVertexMap();
+    for( auto it = hardware_vertex_map->begin(); it != hardware_vertex_map->end(); ++it ) {
+        uint32_t op = it->second.getValue();
+        mix(&it->first, sizeof(it->first));
+        mix(&op, sizeof(op));
+        mixEdges(it->second.getAdjacencyList());
+    }
+
+    std::map< uint32_t, Vertex< AppNode > >* app_vertex_map = appGraph.getVertexMap();
+    for( auto it = app_vertex_map->begin(); it != app_vertex_map->end(); ++it ) {
+        AppNode node = it->second.getValue();
+        uint32_t op = node.optype_;
+        mix(&it->first, sizeof(it->first));
+        mix(&op, sizeof(op));
+        for( uint32_t i = 0; i < 2; ++i ) {
+            mix(node.argument_[i].c_str(), node.argument_[i].size() + 1);
+        }
+        mixEdges(it->second.getAdjacencyList());
+    }
+
+    std::ifstream toolFile(mapping_tool, std::ios::binary);
+    std::string tool((std::istreambuf_iterator< char >(toolFile)), std::istreambuf_iterator< char >());
+    mix(tool.c_str(), tool.size());
+
+    char key[17];
+    snprintf(key, sizeof(key), "%016" PRIx64, hash);
+    return std::string(key);
+}
+
 void PyMapper::mapGraph(LlyrGraph< opType > hardwareGraph, LlyrGraph< AppNode > appGraph,
                             LlyrGraph< ProcessingElement* > &graphOut,
                             LlyrConfig* llyr_config)
@@ -107,13 +158,34 @@ void PyMapper::mapGraph(LlyrGraph< opType > hardwareGraph, LlyrGraph< AppNode >
         exit(0);
     }
 
-    // namespace filesystem_var = std::filesystem;
-    // std::cout << "Current working directory: " << filesystem_var.current_path() << std::endl;
-    runMappingTool(llyr_config->mapping_tool_);
-
 //     std::string fileName = "deepmind/strassen2x2_clay.csv";
 //     std::string fileName = "deepmind/strassen_6x7_rect_gap1.csv";
     std::string fileName = "ipdps24/generic_solution.csv";
+
+    // a sweep over the same app and hardware gets the same solution from the tool, so keep a copy
+    // of it named by a hash of the graphs and the tool and skip the tool when the copy is there
+    std::string cachedName = "";
+    if( llyr_config->mapping_cache_ != "" ) {
+        cachedName = llyr_config->mapping_cache_ + "/" + mappingKey(hardwareGraph, appGraph, llyr_config->mapping_tool_) + ".csv";
+    }
+
+    if( cachedName != "" && std::filesystem::exists(cachedName) ) {
+        output_->verbose(CALL_INFO, 1, 0, "Found cached mapping %s\n", cachedName.c_str());
+        fileName = cachedName;
+    } else {
+        // namespace filesystem_var = std::filesystem;
+        // std::cout << "Current working directory: " << filesystem_var.current_path() << std::endl;
+        runMappingTool(llyr_config->mapping_tool_);
+
+        if( cachedName != "" ) {
+            std::error_code error;
+            std::filesystem::create_directories(llyr_config->mapping_cache_, error);
+            std::filesystem::copy_file(fileName, cachedName, std::filesystem::copy_options::overwrite_existing, error);
+            if( error ) {
+                output_->verbose(CALL_INFO, 1, 0, "Could not cache mapping in %s: %s\n", cachedName.c_str(), error.message().c_str());
+            }
+        }
+    }
     output_->verbose(CALL_INFO, 1, 0, "Mapping Application Using: %s\n", fileName.c_str());
 
     std::list< HardwareNode* > node_list;
@@ -207,9 +207,6 @@ protected:
     bool doLoad(uint64_t addr)
     {
         uint32_t targetPe = 0;
-        StandardMem::Request* req = new StandardMem::Read(addr, 8);
-
-        output_->verbose(CALL_INFO, 4, 0, "Creating a load request (%" PRIu32 ") from address: %" PRIu64 "\n", uint32_t(req->getID()), addr);
 
         //find out where the load actually needs to go
         auto it = output_queue_map_.begin();
@@ -226,8 +223,19 @@ protected:
             exit(-1);
         }
 
-        LSEntry* tempEntry = new LSEntry( req->getID(), processor_id_, targetPe );
+        //another PE loaded this address this cycle, share its response
+        if( lsqueue_->coalesceLoad( addr, processor_id_, targetPe ) ) {
+            output_->verbose(CALL_INFO, 4, 0, "Coalescing a load from address: %" PRIu64 "\n", addr);
+            return 1;
+        }
+
+        StandardMem::Request* req = new StandardMem::Read(addr, 8);
+
+        output_->verbose(CALL_INFO, 4, 0, "Creating a load request (%" PRIu32 ") from address: %" PRIu64 "\n", uint32_t(req->getID()), addr);
+
+        LSEntry* tempEntry = lsqueue_->allocateEntry( req->getID(), processor_id_, targetPe );
         lsqueue_->addEntry( tempEntry );
+        lsqueue_->recordLoad( addr, tempEntry );
 
         mem_interface_->send( req );
 
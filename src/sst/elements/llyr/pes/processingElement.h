@@ -324,6 +324,33 @@ public:
 
     bool     getPendingOp() const { return pending_op_; }
 
+    // Nothing is pending and no data is queued, but the PE has an argument to
+    // wait on, so doCompute() and doSend() would not change any state this cycle
+    bool     isIdle() const
+    {
+        if( pending_op_ != 0 ) {
+            return false;
+        }
+
+        bool waits_on_input = false;
+        for( auto it = input_queues_->begin(); it != input_queues_->end(); ++it ) {
+            if( (*it)->data_queue_->size() > 0 ) {
+                return false;
+            }
+            if( (*it)->argument_ > -1 ) {
+                waits_on_input = true;
+            }
+        }
+
+        for( auto it = output_queues_->begin(); it != output_queues_->end(); ++it ) {
+            if( (*it)->data_queue_->size() > 0 ) {
+                return false;
+            }
+        }
+
+        return waits_on_input;
+    }
+
     void printInputQueue()
     {
         for( uint32_t i = 0; i < input_queues_->size(); ++i ) {
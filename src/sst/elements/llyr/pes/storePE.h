@@ -204,8 +204,9 @@ protected:
         StandardMem::Request* req = new StandardMem::Write(addr, 8, payload);
         output_->verbose(CALL_INFO, 4, 0, "Creating a store request (%" PRIu32 ") for %llu at address: %" PRIu64 "\n", uint32_t(req->getID()), newValue, addr);
 
-        LSEntry* tempEntry = new LSEntry( req->getID(), processor_id_, targetPe );
+        LSEntry* tempEntry = lsqueue_->allocateEntry( req->getID(), processor_id_, targetPe );
         lsqueue_->addEntry( tempEntry );
+        lsqueue_->recordStore( addr );
 
         mem_interface_->send( req );
 
@@ -96,6 +96,7 @@ Questions? Contact sst-macro-help@sandia.gov
 //RegisterKeywords(
 //{ "iprobe_delay", "the delay incurred each time MPI_Iprobe is called" },
 //{ "dump_comm_times", "dump communication time statistics" },
+//{ "profile_output", "the file prefix for the per rank binary MPI profile, empty (default) disables profiling" },
 //{ "otf2_dir_basename", "Enables OTF2 and combines this parameter with a timestamp to name the archive"}
 //);
 
@@ -120,6 +121,7 @@ MpiApi::MpiApi(SST::Params& params, SST::Hg::App* app,
                SST::Component* comp) :
   SST::Iris::sumi::SimTransport(params, app, comp),
   queue_(nullptr),
+  profile_(nullptr),
   next_type_id_(0),
   next_op_id_(first_custom_op_id),
   comm_factory_(app->sid(), this),
@@ -144,6 +146,11 @@ MpiApi::MpiApi(SST::Params& params, SST::Hg::App* app,
   double test_delay_s = params.find<SST::UnitAlgebra>("test_delay", "1us").getValue().toDouble();
   test_delay_us_ = test_delay_s * 1e6;
 
+  std::string profile_prefix = params.find<std::string>("profile_output", "");
+  if (!profile_prefix.empty()){
+    profile_ = new MpiProfile(app, profile_prefix);
+  }
+
 #ifdef SST_HG_OTF2_ENABLED
 #if !SST_HG_INTEGRATED_SST_CORE
   auto subname = sprockit::sprintf("App%d-Rank%d", app->sid().app_, app->sid().task_);
@@ -174,6 +181,7 @@ MpiApi::~MpiApi()
   //an unblock finishes finalize... so finalize is called while the DES thread is still inside the queue
   //the queue outlives mpi_api::finalize!
   if (queue_) delete queue_;
+  if (profile_) delete profile_;
 
   //these are often not cleaned up correctly by app
   for (auto& pair : grp_map_){
@@ -301,6 +309,7 @@ MpiApi::finalize()
   status_ = is_finalized;
 
   int rank = commWorld()->rank();
+  if (profile_) profile_->dump(rank);
   if (rank == 0) {
 //    debug_printf(sprockit::dbg::mpi_finalize,
 //      "MPI_Finalize passed on app %d", sid().app_);
@@ -592,6 +601,7 @@ MpiApi::logMessageDelay(  Iris::sumi::Message *msg,
     SST::Hg::TimeDelta sync_delay,  SST::Hg::TimeDelta
     active_delay,  SST::Hg::TimeDelta time_since_quiesce)
 {
+  if (profile_) profile_->addRecvDelay(bytes, sync_delay, active_delay);
 }
 
 void
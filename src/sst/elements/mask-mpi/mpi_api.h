@@ -65,6 +65,7 @@ Questions? Contact sst-macro-help@sandia.gov
 #include <mpi_debug.h>
 #include <mpi_queue/mpi_queue_fwd.h>
 #include <mpi_delay_stats.h>
+#include <mpi_profile.h>
 
 #include <unordered_map>
 
@@ -100,6 +101,13 @@ class MpiApi : public SST::Iris::sumi::SimTransport
     return queue_;
   }
 
+  /**
+   * @return The MPI profile, nullptr unless profile_output is set
+   */
+  MpiProfile* profile() const {
+    return profile_;
+  }
+
   /**
    * @brief crossed_comm_world_barrier
    *        Useful for statistics based on globally synchronous timings.
@@ -816,6 +824,8 @@ class MpiApi : public SST::Iris::sumi::SimTransport
 
   MpiQueue* queue_;
 
+  MpiProfile* profile_;
+
   MPI_Datatype next_type_id_;
 
   static const MPI_Op first_custom_op_id = 1000;
@@ -56,6 +56,7 @@ Questions? Contact sst-macro-help@sandia.gov
 //  FinishMPICall(fxn);
 
 #define do_coll(coll, fxn, ...) \
+  MpiProfileScope profile_scope(profile_, Call_ID_##fxn); \
   auto op = start##coll(#fxn, __VA_ARGS__); \
   waitCollective(std::move(op));
 
@@ -66,6 +67,7 @@ Questions? Contact sst-macro-help@sandia.gov
 //  FinishMPICall(fxn)
 
 #define start_coll(coll, fxn, ...) \
+  MpiProfileScope profile_scope(profile_, Call_ID_##fxn); \
   auto op = start##coll(#fxn, __VA_ARGS__); \
   addImmediateCollective(std::move(op), req);
 
@@ -142,7 +144,8 @@ MpiApi::startMpiCollective(Iris::sumi::Collective::type_t ty,
   op->packed_recv = false;
   op->packed_send = false;
 
-  if (op->sendbuf && !op->sendtype->contiguous()){
+  //null buffers carry no data, so only real buffers get packed
+  if (isNonNullBuffer(op->sendbuf) && !op->sendtype->contiguous()){
     void* newbuf = allocateTempPackBuffer(op->sendcnt, op->sendtype);
     op->sendtype->packSend(op->sendbuf, newbuf, op->sendcnt);
     op->tmp_sendbuf = newbuf;
@@ -151,7 +154,7 @@ MpiApi::startMpiCollective(Iris::sumi::Collective::type_t ty,
     op->tmp_sendbuf = op->sendbuf;
   }
 
-  if (op->recvbuf && !op->recvtype->contiguous()){
+  if (isNonNullBuffer(op->recvbuf) && !op->recvtype->contiguous()){
     void* newbuf = allocateTempPackBuffer(op->recvcnt, op->recvtype);
     op->tmp_recvbuf = newbuf;
     op->packed_recv = true;
@@ -530,6 +533,7 @@ MpiApi::barrier(MPI_Comm comm)
 #endif
 
   //StartMPICall(MPI_Barrier);
+  MpiProfileScope profile_scope(profile_, Call_ID_MPI_Barrier);
   waitCollective( startBarrier("MPI_Barrier", comm) );
   //FinishMPICall(MPI_Barrier);
 
@@ -53,7 +53,8 @@ Questions? Contact sst-macro-help@sandia.gov
 //  mpi_api_debug(sprockit::dbg::mpi, "%s(%s,%s,%s)", \
 //    #fxn, srcStr(source).c_str(), tagStr(tag).c_str(), commStr(comm).c_str());
 
-#define start_probe_call(fxn,comm,src,tag)
+#define start_probe_call(fxn,comm,src,tag) \
+  MpiProfileScope profile_scope(profile_, Call_ID_##fxn)
 
 namespace SST::MASKMPI {
 
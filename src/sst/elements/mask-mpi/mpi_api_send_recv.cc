@@ -58,8 +58,10 @@ Questions? Contact sst-macro-help@sandia.gov
 
 //#define start_Ipt2pt_call(fxn,count,type,partner,tag,comm,reqPtr) \
 //  StartMPICall(fxn)
-#define start_pt2pt_call(fxn, count, type, partner, tag, comm)
-#define start_Ipt2pt_call(fxn,count,type,partner,tag,comm,reqPtr)
+#define start_pt2pt_call(fxn, count, type, partner, tag, comm) \
+  MpiProfileScope profile_scope(profile_, Call_ID_##fxn)
+#define start_Ipt2pt_call(fxn,count,type,partner,tag,comm,reqPtr) \
+  MpiProfileScope profile_scope(profile_, Call_ID_##fxn)
 #undef FinishMPICall
 #define FinishMPICall(fxn)
 
@@ -56,6 +56,7 @@ Questions? Contact sst-macro-help@sandia.gov
 //  FinishMPICall(fxn);
 
 #define do_vcoll(coll, fxn, ...) \
+  MpiProfileScope profile_scope(profile_, Call_ID_##fxn); \
   auto op = start##coll(#fxn, __VA_ARGS__); \
   waitCollective(std::move(op));
 
@@ -66,6 +67,7 @@ Questions? Contact sst-macro-help@sandia.gov
 //  FinishMPICall(fxn)
 
 #define start_vcoll(coll, fxn, ...) \
+  MpiProfileScope profile_scope(profile_, Call_ID_##fxn); \
   auto op = start##coll(#fxn, __VA_ARGS__); \
   addImmediateCollective(std::move(op), req);
 
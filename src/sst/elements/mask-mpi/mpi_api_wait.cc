@@ -51,7 +51,8 @@ Questions? Contact sst-macro-help@sandia.gov
 #include <cassert>
 
 #undef StartMPICall
-#define StartMPICall(fxn)
+#define StartMPICall(fxn) \
+  MpiProfileScope profile_scope(profile_, Call_ID_##fxn)
 #undef FinishMPICall
 #define FinishMPICall(fxn)
 
@@ -0,0 +1,138 @@
+/**
+Copyright 2009-2024 National Technology and Engineering Solutions of Sandia,
+LLC (NTESS).  Under the terms of Contract DE-NA-0003525, the U.S. Government
+retains certain rights in this software.
+
+Sandia National Laboratories is a multimission laboratory managed and operated
+by National Technology and Engineering Solutions of Sandia, LLC., a wholly
+owned subsidiary of Honeywell International, Inc., for the U.S. Department of
+Energy's National Nuclear Security Administration under contract DE-NA0003525.
+
+Copyright (c) 2009-2024, NTESS
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, 
+are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Questions? Contact sst-macro-help@sandia.gov
+*/
+
+#include <mpi_profile.h>
+#include <mercury/operating_system/process/app.h>
+#include <mercury/common/errors.h>
+#include <mercury/common/hg_printf.h>
+
+#include <cstdio>
+
+namespace SST::MASKMPI {
+
+MpiProfile::MpiProfile(SST::Hg::App* app, const std::string& prefix) :
+  app_(app),
+  prefix_(prefix),
+  depth_(0),
+  calls_(num_calls),
+  recvs_(0),
+  recv_bytes_(0),
+  sync_ps_(0),
+  active_ps_(0)
+{
+}
+
+SST::Hg::Timestamp
+MpiProfile::now() const
+{
+  return app_->now();
+}
+
+void
+MpiProfile::exitCall(MPI_function fxn, SST::Hg::TimeDelta elapsed)
+{
+  if (--depth_ > 0) return;
+
+  Call& c = calls_[fxn];
+  ++c.count;
+  c.total_ps += psec(elapsed);
+
+  uint64_t ns = elapsed.ticks() > 0 ? uint64_t(elapsed.nsec()) : 0;
+  int bucket = 0;
+  while (ns && bucket + 1 < num_buckets){
+    ns >>= 1;
+    ++bucket;
+  }
+  ++c.hist[bucket];
+}
+
+template <class T>
+static void
+write(FILE* f, const T& t)
+{
+  ::fwrite(&t, sizeof(T), 1, f);
+}
+
+void
+MpiProfile::dump(int rank) const
+{
+  std::string fname = SST::Hg::sprintf("%s.%d.bin", prefix_.c_str(), rank);
+  FILE* f = ::fopen(fname.c_str(), "wb");
+  if (!f){
+    sst_hg_abort_printf("MpiProfile: could not open %s", fname.c_str());
+  }
+
+  ::fwrite("MPIPROF1", 1, 8, f);
+  write(f, int32_t(rank));
+
+  uint32_t ncalls = 0;
+  for (const Call& c : calls_){
+    if (c.count) ++ncalls;
+  }
+  write(f, ncalls);
+  for (int id=0; id < num_calls; ++id){
+    const Call& c = calls_[id];
+    if (!c.count) continue;
+    write(f, uint32_t(id));
+    write(f, c.count);
+    write(f, c.total_ps);
+    ::fwrite(c.hist.data(), sizeof(uint64_t), num_buckets, f);
+  }
+
+  write(f, uint32_t(peers_.size()));
+  for (auto& pair : peers_){
+    write(f, int32_t(pair.first));
+    write(f, pair.second.sends);
+    write(f, pair.second.bytes);
+  }
+
+  write(f, recvs_);
+  write(f, recv_bytes_);
+  write(f, sync_ps_);
+  write(f, active_ps_);
+
+  ::fclose(f);
+}
+
+}
@@ -0,0 +1,161 @@
+/**
+Copyright 2009-2024 National Technology and Engineering Solutions of Sandia,
+LLC (NTESS).  Under the terms of Contract DE-NA-0003525, the U.S. Government
+retains certain rights in this software.
+
+Sandia National Laboratories is a multimission laboratory managed and operated
+by National Technology and Engineering Solutions of Sandia, LLC., a wholly
+owned subsidiary of Honeywell International, Inc., for the U.S. Department of
+Energy's National Nuclear Security Administration under contract DE-NA0003525.
+
+Copyright (c) 2009-2024, NTESS
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, 
+are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Questions? Contact sst-macro-help@sandia.gov
+*/
+
+#pragma once
+
+#include <mpi_call.h>
+#include <mercury/common/timestamp.h>
+#include <mercury/operating_system/process/app_fwd.h>
+
+#include <stdint.h>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace SST::MASKMPI {
+
+/**
+ * Per rank MPI profile: the time spent in each MPI call with a log2
+ * histogram of the call times, the point-to-point bytes sent to each
+ * peer task, and the sync (waiting on a partner) vs active (moving data)
+ * time of each received message. Counting is a few adds per call, the
+ * profile is written in a compact binary form at MPI_Finalize.
+ */
+class MpiProfile {
+ public:
+  static const int num_calls = Call_ID_MPI_Win_set_errhandler + 1;
+  /** bucket i > 0 holds calls of [2^(i-1), 2^i) ns, bucket 0 calls under 1 ns */
+  static const int num_buckets = 40;
+
+  MpiProfile(SST::Hg::App* app, const std::string& prefix);
+
+  SST::Hg::Timestamp now() const;
+
+  /** Calls nest, e.g. MPI_Sendrecv waits, only the outermost call is counted */
+  void enterCall(){
+    ++depth_;
+  }
+
+  void exitCall(MPI_function fxn, SST::Hg::TimeDelta elapsed);
+
+  void addSend(int task, uint64_t bytes){
+    Peer& p = peers_[task];
+    ++p.sends;
+    p.bytes += bytes;
+  }
+
+  void addRecvDelay(uint64_t bytes, SST::Hg::TimeDelta sync_delay,
+                    SST::Hg::TimeDelta active_delay){
+    ++recvs_;
+    recv_bytes_ += bytes;
+    sync_ps_ += psec(sync_delay);
+    active_ps_ += psec(active_delay);
+  }
+
+  /**
+   * Write <prefix>.<rank>.bin, all counts little endian:
+   *   char[8] "MPIPROF1", int32 rank
+   *   uint32 ncalls, per call: uint32 id, uint64 count, uint64 total ps,
+   *                            uint64[num_buckets] histogram
+   *   uint32 npeers, per peer: int32 task, uint64 sends, uint64 bytes
+   *   uint64 recvs, uint64 recv bytes, uint64 sync ps, uint64 active ps
+   */
+  void dump(int rank) const;
+
+ private:
+  struct Call {
+    Call() : count(0), total_ps(0), hist(num_buckets, 0) {}
+    uint64_t count;
+    uint64_t total_ps;
+    std::vector<uint64_t> hist;
+  };
+
+  struct Peer {
+    Peer() : sends(0), bytes(0) {}
+    uint64_t sends;
+    uint64_t bytes;
+  };
+
+  static uint64_t psec(SST::Hg::TimeDelta t){
+    return t.ticks() > 0 ? uint64_t(t.psec()) : 0;
+  }
+
+  SST::Hg::App* app_;
+  std::string prefix_;
+  int depth_;
+
+  std::vector<Call> calls_;
+  std::unordered_map<int, Peer> peers_;
+
+  uint64_t recvs_;
+  uint64_t recv_bytes_;
+  uint64_t sync_ps_;
+  uint64_t active_ps_;
+};
+
+/**
+ * Counts the enclosing MPI call in a profile, a null profile does nothing
+ */
+class MpiProfileScope {
+ public:
+  MpiProfileScope(MpiProfile* prof, MPI_function fxn) :
+    prof_(prof), fxn_(fxn)
+  {
+    if (prof_){
+      prof_->enterCall();
+      start_ = prof_->now();
+    }
+  }
+
+  ~MpiProfileScope(){
+    if (prof_) prof_->exitCall(fxn_, prof_->now() - start_);
+  }
+
+ private:
+  MpiProfile* prof_;
+  MPI_function fxn_;
+  SST::Hg::Timestamp start_;
+};
+
+}
@@ -86,13 +86,14 @@ Eager0::incoming(MpiMessage *msg, MpiQueueRecvRequest *req)
 {
   //1 = stage, TimeDelay() = time since last quiesce
   logRecvDelay(1, SST::Hg::TimeDelta(), msg, req);
-  if (req->recv_buffer_){
+  if (isNonNullBuffer(req->recv_buffer_)){
 #if SST_HG_SANITY_CHECK
     if (!msg->smsgBuffer()){
       spkt_abort_printf("have receive buffer, but no send buffer on %s", msg->toString().c_str());
     }
 #endif
-    ::memcpy(req->recv_buffer_, msg->smsgBuffer(), msg->byteLength());
+    //a sender with a null buffer sends no payload, only its size
+    if (msg->smsgBuffer()) ::memcpy(req->recv_buffer_, msg->smsgBuffer(), msg->byteLength());
   }
   queue_->notifyProbes(msg);
   queue_->memcopy(msg->payloadBytes());
@@ -105,16 +105,18 @@ Eager1::incoming(MpiMessage *msg, MpiQueueRecvRequest* req)
 {
   //1 = stage, TimeDelay() = time since last quiesce
   logRecvDelay(1, SST::Hg::TimeDelta(), msg, req);
-  if (req->recv_buffer_){
-    char* temp_recv_buf = (char*) msg->localBuffer();
+  char* temp_recv_buf = (char*) msg->localBuffer();
+  if (isNonNullBuffer(req->recv_buffer_)){
 #if SST_HG_SANITY_CHECK
     if (!temp_recv_buf){
       spkt_abort_printf("have receiver buffer but no local buffer on %s", msg->toString().c_str());
     }
 #endif
-    ::memcpy(req->recv_buffer_, temp_recv_buf, msg->payloadBytes());
-    delete[] temp_recv_buf;
+    //a sender with a null buffer sends no payload, only its size
+    if (temp_recv_buf) ::memcpy(req->recv_buffer_, temp_recv_buf, msg->payloadBytes());
   }
+  //the payload was pulled before the recv was matched, a null recv buffer still frees it
+  if (temp_recv_buf) delete[] temp_recv_buf;
   queue_->memcopy(msg->payloadBytes());
   queue_->finalizeRecv(msg, req);
   delete msg;
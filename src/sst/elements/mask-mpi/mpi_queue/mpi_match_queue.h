@@ -0,0 +1,286 @@
+/**
+Copyright 2009-2024 National Technology and Engineering Solutions of Sandia,
+LLC (NTESS).  Under the terms of Contract DE-NA-0003525, the U.S. Government
+retains certain rights in this software.
+
+Sandia National Laboratories is a multimission laboratory managed and operated
+by National Technology and Engineering Solutions of Sandia, LLC., a wholly
+owned subsidiary of Honeywell International, Inc., for the U.S. Department of
+Energy's National Nuclear Security Administration under contract DE-NA0003525.
+
+Copyright (c) 2009-2024, NTESS
+
+All rights reserved.
+
+Redistribution and use in source and binary forms, with or without modification, 
+are permitted provided that the following conditions are met:
+
+    * Redistributions of source code must retain the above copyright
+      notice, this list of conditions and the following disclaimer.
+
+    * Redistributions in binary form must reproduce the above
+      copyright notice, this list of conditions and the following
+      disclaimer in the documentation and/or other materials provided
+      with the distribution.
+
+    * Neither the name of the copyright holder nor the names of its
+      contributors may be used to endorse or promote products derived
+      from this software without specific prior written permission.
+
+THIS SOFTWARE IS PROVIDED BY THE COPYRIGHT HOLDERS AND CONTRIBUTORS
+"AS IS" AND ANY EXPRESS OR IMPLIED WARRANTIES, INCLUDING, BUT NOT
+LIMITED TO, THE IMPLIED WARRANTIES OF MERCHANTABILITY AND FITNESS FOR
+A PARTICULAR PURPOSE ARE DISCLAIMED. IN NO EVENT SHALL THE COPYRIGHT
+OWNER OR CONTRIBUTORS BE LIABLE FOR ANY DIRECT, INDIRECT, INCIDENTAL,
+SPECIAL, EXEMPLARY, OR CONSEQUENTIAL DAMAGES (INCLUDING, BUT NOT
+LIMITED TO, PROCUREMENT OF SUBSTITUTE GOODS OR SERVICES; LOSS OF USE,
+DATA, OR PROFITS; OR BUSINESS INTERRUPTION) HOWEVER CAUSED AND ON ANY
+THEORY OF LIABILITY, WHETHER IN CONTRACT, STRICT LIABILITY, OR TORT
+(INCLUDING NEGLIGENCE OR OTHERWISE) ARISING IN ANY WAY OUT OF THE USE
+OF THIS SOFTWARE, EVEN IF ADVISED OF THE POSSIBILITY OF SUCH DAMAGE.
+
+Questions? Contact sst-macro-help@sandia.gov
+*/
+
+#include <mpi_message.h>
+#include <mpi_types.h>
+#include <mpi_queue/mpi_queue_recv_request_fwd.h>
+
+#include <deque>
+#include <list>
+#include <unordered_map>
+#include <vector>
+
+#pragma once
+
+namespace SST::MASKMPI {
+
+struct MpiMatchKey {
+  MpiMatchKey(MPI_Comm comm, int source, int tag) :
+    comm(comm), source(source), tag(tag) {}
+
+  bool operator==(const MpiMatchKey& other) const {
+    return comm == other.comm && source == other.source && tag == other.tag;
+  }
+
+  /** Whether a message with this key is accepted by a recv or probe with key q */
+  bool matchedBy(const MpiMatchKey& q) const {
+    return comm == q.comm
+        && (q.source == MPI_ANY_SOURCE || q.source == source)
+        && (q.tag == MPI_ANY_TAG || q.tag == tag);
+  }
+
+  bool wild() const {
+    return source == MPI_ANY_SOURCE || tag == MPI_ANY_TAG;
+  }
+
+  MPI_Comm comm;
+  int source;
+  int tag;
+};
+
+struct MpiMatchKeyHash {
+  size_t operator()(const MpiMatchKey& key) const {
+    uint64_t hash = uint64_t(uint32_t(key.tag)) * 0x9e3779b97f4a7c15ULL;
+    hash ^= (uint64_t(uint32_t(key.source)) << 32 | uint32_t(key.comm))
+            + 0x632be59bd9b4e019ULL + (hash << 6) + (hash >> 2);
+    return hash;
+  }
+};
+
+/**
+ * Incoming messages waiting for a recv, in arrival order. Each message is also
+ * binned by (comm, source, tag), so a recv or probe naming both its source and
+ * tag takes the oldest message in its bin without a scan. Wildcard recvs scan
+ * the arrival order, and the first message they match is always at the front
+ * of its own bin.
+ */
+class MpiUnexpectedQueue {
+  typedef std::list<MpiMessage*> arrival_list;
+  typedef std::unordered_map<MpiMatchKey,
+            std::deque<arrival_list::iterator>, MpiMatchKeyHash> bin_map;
+
+ public:
+  void push_back(MpiMessage* msg){
+    arrivals_.push_back(msg);
+    bins_[keyOf(msg)].push_back(std::prev(arrivals_.end()));
+  }
+
+  /**
+   * @return The oldest message a recv for q would match, nullptr if none
+   */
+  MpiMessage* find(const MpiMatchKey& q) const {
+    if (!q.wild()){
+      auto bin = bins_.find(q);
+      return bin == bins_.end() ? nullptr : *bin->second.front();
+    }
+    for (MpiMessage* msg : arrivals_){
+      if (keyOf(msg).matchedBy(q)) return msg;
+    }
+    return nullptr;
+  }
+
+  /**
+   * Remove a message returned by find
+   */
+  void erase(MpiMessage* msg){
+    auto bin = bins_.find(keyOf(msg));
+    arrivals_.erase(bin->second.front());
+    bin->second.pop_front();
+    if (bin->second.empty()) bins_.erase(bin);
+  }
+
+  bool empty() const {
+    return arrivals_.empty();
+  }
+
+  size_t size() const {
+    return arrivals_.size();
+  }
+
+ private:
+  static MpiMatchKey keyOf(MpiMessage* msg){
+    return MpiMatchKey(msg->comm(), msg->srcRank(), msg->tag());
+  }
+
+  arrival_list arrivals_;
+  bin_map bins_;
+};
+
+/**
+ * Posted recvs waiting for a message. Recvs naming both source and tag sit in
+ * a bin for their key, wildcard recvs sit in one list. A message takes the
+ * oldest recv it matches across its bin and the wildcard list, which is the
+ * recv a scan of a single list in post order would find.
+ */
+class MpiPostedRecvQueue {
+  struct Entry {
+    Entry(uint64_t seq, MpiMatchKey key, MpiQueueRecvRequest* req) :
+      seq(seq), key(key), req(req) {}
+    uint64_t seq;
+    MpiMatchKey key;
+    MpiQueueRecvRequest* req;
+  };
+
+  typedef std::deque<Entry> bin_t;
+
+ public:
+  MpiPostedRecvQueue() : next_seq_(0) {}
+
+  void push_back(MpiQueueRecvRequest* req, const MpiMatchKey& key){
+    Entry entry(next_seq_++, key, req);
+    if (key.wild()){
+      wild_.push_back(entry);
+    } else {
+      bins_[key].push_back(entry);
+    }
+  }
+
+  /**
+   * Remove and return the oldest recv that is not cancelled and accepts a
+   * message with key k, nullptr if there is none. Cancelled recvs found
+   * on the way are dropped.
+   */
+  template <class Cancelled>
+  MpiQueueRecvRequest* take(const MpiMatchKey& k, Cancelled cancelled){
+    MpiQueueRecvRequest* best = nullptr;
+    uint64_t best_seq = 0;
+
+    auto bin = bins_.find(k);
+    if (bin != bins_.end()){
+      auto& entries = bin->second;
+      while (!entries.empty() && cancelled(entries.front().req)){
+        entries.pop_front();
+      }
+      if (entries.empty()){
+        bins_.erase(bin);
+        bin = bins_.end();
+      } else {
+        best = entries.front().req;
+        best_seq = entries.front().seq;
+      }
+    }
+
+    //only a wildcard recv posted before the bin's match can take the message
+    for (auto it = wild_.begin(); it != wild_.end();){
+      if (best && it->seq > best_seq) break;
+      if (cancelled(it->req)){
+        it = wild_.erase(it);
+      } else if (k.matchedBy(it->key)){
+        best = it->req;
+        wild_.erase(it);
+        return best;
+      } else {
+        ++it;
+      }
+    }
+
+    if (best){
+      bin->second.pop_front();
+      if (bin->second.empty()) bins_.erase(bin);
+    }
+    return best;
+  }
+
+ private:
+  uint64_t next_seq_;
+  std::unordered_map<MpiMatchKey, bin_t, MpiMatchKeyHash> bins_;
+  bin_t wild_;
+};
+
+/**
+ * Messages from one task that arrived ahead of the next expected sequence
+ * number, in a ring indexed by sequence number
+ */
+class MpiReorderWindow {
+ public:
+  MpiReorderWindow() : slots_(16, nullptr), held_(0) {}
+
+  /**
+   * @param next The sequence number expected next, msg->seqnum() is after it
+   */
+  void hold(MpiMessage* msg, int next){
+    while (uint64_t(msg->seqnum() - next) >= slots_.size()){
+      grow();
+    }
+    slots_[msg->seqnum() & mask()] = msg;
+    ++held_;
+  }
+
+  /**
+   * @return The held message with sequence number seq, nullptr if it has not arrived
+   */
+  MpiMessage* take(int seq){
+    if (held_ == 0) return nullptr;
+    MpiMessage*& slot = slots_[seq & mask()];
+    MpiMessage* msg = slot;
+    if (msg && msg->seqnum() == seq){
+      slot = nullptr;
+      --held_;
+      return msg;
+    }
+    return nullptr;
+  }
+
+  bool empty() const {
+    return held_ == 0;
+  }
+
+ private:
+  size_t mask() const {
+    return slots_.size() - 1;
+  }
+
+  void grow(){
+    std::vector<MpiMessage*> slots(2*slots_.size(), nullptr);
+    for (MpiMessage* msg : slots_){
+      if (msg) slots[msg->seqnum() & (slots.size() - 1)] = msg;
+    }
+    slots_.swap(slots);
+  }
+
+  std::vector<MpiMessage*> slots_;
+  size_t held_;
+};
+
+}
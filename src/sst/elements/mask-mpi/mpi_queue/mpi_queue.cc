@@ -79,12 +79,6 @@ namespace SST::MASKMPI {
 
 //static sprockit::NeedDeletestatics<MpiQueue> del_statics;
 
-bool
-MpiQueue::sortbyseqnum::operator()(MpiMessage* a, MpiMessage*b) const
-{
-  return (a->seqnum() < b->seqnum());
-}
-
 MpiQueue::MpiQueue(SST::Params& params, int task_id, MpiApi* api, Iris::sumi::CollectiveEngine* engine) :
   queue_(api->parent()->os()),
   taskid_(task_id),
@@ -93,6 +87,7 @@ MpiQueue::MpiQueue(SST::Params& params, int task_id, MpiApi* api, Iris::sumi::Co
   max_vshort_msg_size_ = params.find<SST::UnitAlgebra>("max_vshort_msg_size", "512B").getRoundedValue();
   max_eager_msg_size_ = params.find<SST::UnitAlgebra>("max_eager_msg_size", "8192B").getRoundedValue();
   use_put_window_ = params.find<bool>("use_put_window", false);
+  queue_.setBatchDelivery(params.find<bool>("batch_completions", false));
 
   protocols_.resize(MpiProtocol::NUM_PROTOCOLS);
   protocols_[MpiProtocol::EAGER0] = new Eager0(params, this);
@@ -193,6 +188,7 @@ MpiQueue::send(MpiRequest *key, int count, MPI_Datatype type,
 //    prot->toString().c_str());
 
   TaskId dst_tid = comm->peerTask(dest);
+  if (api_->profile()) api_->profile()->addSend(dst_tid, bytes);
   prot->start(buffer, comm->rank(), dest, dst_tid, count, typeobj,
               tag, comm->id(), next_outbound_[dst_tid]++, key);
 
@@ -201,18 +197,16 @@ MpiQueue::send(MpiRequest *key, int count, MPI_Datatype type,
 MpiMessage*
 MpiQueue::findMatchingRecv(MpiQueueRecvRequest* req)
 {
-  for (auto it = need_recv_match_.begin(); it != need_recv_match_.end(); ++it) {
-    MpiMessage* mess = *it;
-    if (req->matches(mess)) {
+  MpiMessage* mess = need_recv_match_.find(MpiMatchKey(req->comm_, req->source_, req->tag_));
+  if (mess && req->matches(mess)) {
 //      mpi_queue_debug("matched recv tag=%s,src=%s on comm=%s to send %s",
 //        api_->tagStr(req->tag_).c_str(),
 //        api_->srcStr(req->source_).c_str(),
 //        api_->commStr(req->comm_).c_str(),
 //        mess->toString().c_str());
 
-      need_recv_match_.erase(it);
-      return mess;
-    }
+    need_recv_match_.erase(mess);
+    return mess;
   }
 //  mpi_queue_debug("could not match recv tag=%s, src=%s to any of %d sends on comm=%s",
 //    api_->tagStr(req->tag_).c_str(),
@@ -220,7 +214,7 @@ MpiQueue::findMatchingRecv(MpiQueueRecvRequest* req)
 //    need_recv_match_.size(),
 //    api_->commStr(req->comm_).c_str());
 
-  need_send_match_.push_back(req);
+  need_send_match_.push_back(req, MpiMatchKey(req->comm_, req->source_, req->tag_));
   return nullptr;
 }
 
@@ -271,13 +265,11 @@ MpiQueue::probe(MpiRequest* key, MpiComm* comm,
 
   mpi_queue_probe_request* req = new mpi_queue_probe_request(key, comm->id(), source, tag);
   // Figure out whether we already have a matching message.
-  for (auto it = need_recv_match_.begin(); it != need_recv_match_.end(); ++it) {
-    MpiMessage* mess = *it;
-    if (req->matches(mess)){
-      // We're good to go.
-      req->complete(mess);
-      return;
-    }
+  MpiMessage* mess = need_recv_match_.find(MpiMatchKey(comm->id(), source, tag));
+  if (mess){
+    // We're good to go.
+    req->complete(mess);
+    return;
   }
   // If we get here, we still need to wait for the message.
   probelist_.push_back(req);
@@ -296,14 +288,11 @@ MpiQueue::iprobe(MpiComm* comm,
 //    api_->srcStr(source).c_str(), api_->tagStr(tag).c_str(),
 //    api_->commStr(comm).c_str());
 
-  mpi_queue_probe_request req(NULL, comm->id(), source, tag);
-  for (auto it = need_recv_match_.begin(); it != need_recv_match_.end(); ++it) {
-    MpiMessage* mess = *it;
-    if (req.matches(mess)) {
-      // This is it
-      if (stat != MPI_STATUS_IGNORE) mess->buildStatus(stat);
-      return true;
-    }
+  MpiMessage* mess = need_recv_match_.find(MpiMatchKey(comm->id(), source, tag));
+  if (mess) {
+    // This is it
+    if (stat != MPI_STATUS_IGNORE) mess->buildStatus(stat);
+    return true;
   }
   return false;
 }
@@ -311,16 +300,11 @@ MpiQueue::iprobe(MpiComm* comm,
 MpiQueueRecvRequest*
 MpiQueue::findMatchingRecv(MpiMessage* message)
 {
-  auto end = need_send_match_.end();
-  for (auto it = need_send_match_.begin(); it != end;) {
-    auto* req = *it;
-    auto tmp = it++;
-    if (req->isCancelled()) {
-      need_send_match_.erase(tmp);
-    } else if (req->matches(message)) {
-      need_send_match_.erase(tmp);
-      return req;
-    }
+  auto* req = need_send_match_.take(
+        MpiMatchKey(message->comm(), message->srcRank(), message->tag()),
+        [](MpiQueueRecvRequest* req){ return req->isCancelled(); });
+  if (req && req->matches(message)) {
+    return req;
   }
   need_recv_match_.push_back(message);
   return nullptr;
@@ -369,23 +353,12 @@ MpiQueue::incomingPt2ptMessage(Iris::sumi::Message* m)
     ++next_inbound;
 
     // Handle any messages that have been freed by the arrival of this one
-    if (!held_[tid].empty()) {
-      hold_list_t::iterator it = held_[tid].begin(), end = held_[tid].end();
-      while (it != end) {
-        MpiMessage* mess = *it;
-//        mpi_queue_debug("handling out-of-order message for task %d, seqnum %d",
-//            int(tid), mess->seqnum());
-        if (mess->seqnum() <= next_inbound_[tid]) {
-          //it = held_[tid].erase(it);
-          it++;
-          handlePt2ptMessage(mess);
-          ++next_inbound;
-        } else {
-          break;
-        }
-      }
-      // Now erase all the completed messages from the held queue.
-      held_[tid].erase(held_[tid].begin(), it);
+    auto& held = held_[tid];
+    while (MpiMessage* mess = held.take(next_inbound)) {
+//      mpi_queue_debug("handling out-of-order message for task %d, seqnum %d",
+//          int(tid), mess->seqnum());
+      handlePt2ptMessage(mess);
+      ++next_inbound;
     }
   } else if (message->seqnum() < next_inbound){
     sst_hg_abort_printf("message sequence went backwards on %s from %d",
@@ -393,7 +366,7 @@ MpiQueue::incomingPt2ptMessage(Iris::sumi::Message* m)
   } else {
 //    mpi_queue_debug("message arrived out-of-order with seqnum %d, didn't match expected %d for task %d",
 //        message->seqnum(), int(next_inbound), int(tid));
-    held_[tid].insert(message);
+    held_[tid].hold(message, next_inbound);
   }
 }
 
@@ -60,6 +60,7 @@ Questions? Contact sst-macro-help@sandia.gov
 
 #include <mpi_queue/mpi_queue_recv_request_fwd.h>
 #include <mpi_queue/mpi_queue_probe_request.h>
+#include <mpi_queue/mpi_match_queue.h>
 
 #include <sst/core/params.h>
 
@@ -146,13 +147,6 @@ class MpiQueue
     return coll_cq_;
   }
 
- private:
-  struct sortbyseqnum {
-    bool operator()(MpiMessage* a, MpiMessage*b) const;
-  };
-
-  typedef std::set<MpiMessage*, sortbyseqnum> hold_list_t;
-
  private:
   /**
    * @brief incoming_pt2pt_message Message might be held up due to sequencing constraints
@@ -187,11 +181,12 @@ class MpiQueue
   std::unordered_map<TaskId, int> next_inbound_;
 
   /// Hold messages that arrived out of order.
-  std::unordered_map<TaskId, hold_list_t> held_;
+  std::unordered_map<TaskId, MpiReorderWindow> held_;
 
   /// Inbound messages waiting for a matching receive request.
-  std::list<MpiMessage*> need_recv_match_;
-  std::list<MpiQueueRecvRequest*> need_send_match_;
+  MpiUnexpectedQueue need_recv_match_;
+  /// Receive requests waiting for a matching inbound message.
+  MpiPostedRecvQueue need_send_match_;
 
   std::vector<MpiProtocol*> protocols_;
 
@@ -47,6 +47,7 @@ Questions? Contact sst-macro-help@sandia.gov
 //#include <sprockit/statics.h>
 #include <mpi_types/mpi_type.h>
 #include <mpi_types.h>
+#include <iris/sumi/null_buffer.h>
 #include <iostream>
 #include <sstream>
 #include <cstring>
@@ -369,6 +370,8 @@ MpiType::pack_action_indexed(void* packed_buf, void* unpacked_buf, bool pack) co
 void
 MpiType::packSend(void* srcbuf, void* dstbuf, int sendcnt)
 {
+  if (isNullBuffer(srcbuf) || isNullBuffer(dstbuf)) return;
+
   char* src = (char*) srcbuf;
   char* dst = (char*) dstbuf;
   int src_stride = extent_;
@@ -381,6 +384,8 @@ MpiType::packSend(void* srcbuf, void* dstbuf, int sendcnt)
 void
 MpiType::unpack_recv(void *srcbuf, void *dstbuf, int recvcnt)
 {
+  if (isNullBuffer(srcbuf) || isNullBuffer(dstbuf)) return;
+
   char* src = (char*) srcbuf;
   char* dst = (char*) dstbuf;
   int src_stride = size_;
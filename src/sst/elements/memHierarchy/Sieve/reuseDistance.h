@@ -0,0 +1,165 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+/*
+ * File:   reuseDistance.h
+ */
+
+#ifndef _SIEVE_REUSEDISTANCE_H_
+#define _SIEVE_REUSEDISTANCE_H_
+
+#include <stdint.h>
+#include <algorithm>
+#include <set>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace SST { namespace MemHierarchy {
+
+/*
+ * Online reuse distance of cache line accesses, sampled the way SHARDS does
+ * it: a line is tracked only if a hash of its address falls under a
+ * threshold, so a rate R tracks about R of the lines and every distance
+ * measured among them is scaled up by 1/R.
+ *
+ * At most maxLines lines are tracked. When one more would be added, the
+ * threshold drops to the largest hash being tracked and the lines with that
+ * hash are forgotten, so memory stays fixed however large the footprint is.
+ *
+ * The distance of an access is the number of distinct tracked lines touched
+ * since the previous access to its line. A Fenwick tree over the access
+ * sequence holds a 1 at the last access of every tracked line, so that count
+ * is a prefix sum.
+ */
+class ReuseDistanceSampler {
+public:
+    static const uint32_t HashRange = 1 << 24;
+
+    ReuseDistanceSampler(double rate, size_t maxLines) :
+        threshold_(std::min((uint64_t)HashRange, (uint64_t)(rate * HashRange))),
+        maxLines_(std::max(maxLines, (size_t)1)), nextSeq_(0), tree_(MinTreeSize + 1, 0) { }
+
+    /*
+     * Record an access to line. Returns false if the line is not sampled,
+     * otherwise sets cold if this is the first access seen to it, and
+     * distance to its scaled reuse distance if not
+     */
+    bool access(uint64_t line, bool &cold, uint64_t &distance) {
+        uint32_t hash = hashLine(line);
+        if (hash >= threshold_) return false;
+
+        if (nextSeq_ + 1 == tree_.size()) renumber();
+        uint64_t seq = nextSeq_++;
+
+        std::unordered_map<uint64_t, Entry>::iterator it = lines_.find(line);
+        if (it != lines_.end()) {
+            uint64_t between = treeCount(seq) - treeCount(it->second.seq);
+            treeAdd(it->second.seq, -1);
+            it->second.seq = seq;
+            cold = false;
+            distance = (uint64_t)(between * ((double)HashRange / threshold_));
+        } else {
+            lines_.insert(std::make_pair(line, Entry(seq, hash)));
+            byHash_.insert(std::make_pair(hash, line));
+            cold = true;
+            distance = 0;
+            if (lines_.size() > maxLines_) shrink();
+        }
+
+        // the line may have just been dropped by shrink()
+        if (hash < threshold_) treeAdd(seq, 1);
+        return true;
+    }
+
+    /* Fraction of the lines that are being sampled now */
+    double rate() const { return (double)threshold_ / HashRange; }
+
+    size_t size() const { return lines_.size(); }
+
+private:
+    static const size_t MinTreeSize = 1024;
+
+    struct Entry {
+        Entry(uint64_t seq, uint32_t hash) : seq(seq), hash(hash) { }
+        uint64_t seq;   // sequence number of the last access
+        uint32_t hash;
+    };
+
+    static uint32_t hashLine(uint64_t line) {
+        uint64_t h = line * 0x9E3779B97F4A7C15ULL;
+        h ^= h >> 29;
+        return (uint32_t)(h >> 40) & (HashRange - 1);
+    }
+
+    // Lower the threshold to the largest hash and drop every line that has it
+    void shrink() {
+        uint32_t largest = byHash_.rbegin()->first;
+        while (!byHash_.empty() && byHash_.rbegin()->first == largest) {
+            std::set<std::pair<uint32_t, uint64_t> >::iterator last = --byHash_.end();
+            std::unordered_map<uint64_t, Entry>::iterator it = lines_.find(last->second);
+            if (it->second.seq < nextSeq_ - 1) treeAdd(it->second.seq, -1);
+            lines_.erase(it);
+            byHash_.erase(last);
+        }
+        threshold_ = largest;
+    }
+
+    void treeAdd(uint64_t seq, int delta) {
+        for (size_t i = seq + 1; i < tree_.size(); i += i & -i) {
+            tree_[i] += delta;
+        }
+    }
+
+    // tracked lines last accessed at or before seq
+    uint64_t treeCount(uint64_t seq) const {
+        int64_t count = 0;
+        for (size_t i = seq + 1; i > 0; i -= i & -i) {
+            count += tree_[i];
+        }
+        return count;
+    }
+
+    // The sequence numbers ran out, number the tracked lines from zero again
+    // in the same order and size the tree for twice as many
+    void renumber() {
+        std::vector<Entry*> entries;
+        entries.reserve(lines_.size());
+        for (std::unordered_map<uint64_t, Entry>::iterator it = lines_.begin(); it != lines_.end(); it++) {
+            entries.push_back(&it->second);
+        }
+
+        std::sort(entries.begin(), entries.end(),
+            [](const Entry* a, const Entry* b) { return a->seq < b->seq; });
+
+        tree_.assign(std::max(MinTreeSize, 2 * (lines_.size() + 1)) + 1, 0);
+        for (nextSeq_ = 0; nextSeq_ < entries.size(); ++nextSeq_) {
+            entries[nextSeq_]->seq = nextSeq_;
+            treeAdd(nextSeq_, 1);
+        }
+    }
+
+    uint32_t threshold_;
+    size_t maxLines_;
+    uint64_t nextSeq_;
+
+    std::unordered_map<uint64_t, Entry> lines_;
+    std::set<std::pair<uint32_t, uint64_t> > byHash_;
+    std::vector<int> tree_;
+};
+
+}}
+
+#endif
@@ -27,7 +27,9 @@
 using namespace SST;
 using namespace SST::MemHierarchy;
 
-void Sieve::recordMiss(Addr addr, bool isRead) {
+Sieve::mallocEntry* Sieve::findAlloc(Addr addr) {
+    if (activeAllocMap.empty()) return NULL;
+
     allocMap_t::iterator allocI = activeAllocMap.lower_bound(addr);
 
     // lower_bound returns iterator to address just above or equal to addr
@@ -41,22 +43,30 @@ void Sieve::recordMiss(Addr addr, bool isRead) {
     if (allocI != activeAllocMap.end()) {
         // is it in range
         if (addr < (allocI->first +  allocI->second.size)) {
-            uint64_t allocID = allocI->second.id;
-            allocCountMap_t::iterator evI = allocMap.find(allocID);
-            if (evI == allocMap.end()) {
-                allocMap[allocID] = rwCount_t();
-                evI = allocMap.find(allocID);
-            }
-            if (isRead) {
-                evI->second.first++;
-                statReadMisses->addData(1);
-            } else {
-                evI->second.second++;
-                statWriteMisses->addData(1);
-            }
-            return;
+            return &allocI->second;
         }
     }
+    return NULL;
+}
+
+void Sieve::recordMiss(Addr addr, bool isRead) {
+    mallocEntry* alloc = findAlloc(addr);
+    if (alloc) {
+        uint64_t allocID = alloc->id;
+        allocCountMap_t::iterator evI = allocMap.find(allocID);
+        if (evI == allocMap.end()) {
+            allocMap[allocID] = rwCount_t();
+            evI = allocMap.find(allocID);
+        }
+        if (isRead) {
+            evI->second.first++;
+            statReadMisses->addData(1);
+        } else {
+            evI->second.second++;
+            statWriteMisses->addData(1);
+        }
+        return;
+    }
 
     if (isRead) {
         statUnassocReadMisses->addData(1);
@@ -67,6 +77,32 @@ void Sieve::recordMiss(Addr addr, bool isRead) {
     }
 }
 
+void Sieve::recordReuse(Addr baseAddr, Addr vAddr) {
+    bool cold;
+    uint64_t distance;
+    if (!reuse_->access(baseAddr, cold, distance)) return;
+
+    reuseHist_t* hist = &reuseUnassoc_;
+    mallocEntry* alloc = findAlloc(vAddr);
+    if (alloc) {
+        std::unordered_map<uint64_t, reuseHist_t>::iterator it = reuseHist_.find(alloc->id);
+        if (it != reuseHist_.end()) {
+            hist = &it->second;
+        } else if (reuseHist_.size() < reuseMaxSites_) {
+            hist = &(reuseHist_[alloc->id] = reuseHist_t(ReuseBuckets, 0));
+        } else {
+            hist = &reuseOther_;
+        }
+    }
+
+    size_t bucket = 0;
+    if (!cold) {
+        bucket = 1;
+        for (uint64_t d = distance + 1; d > 1 && bucket + 1 < ReuseBuckets; d >>= 1) bucket++;
+    }
+    (*hist)[bucket]++;
+}
+
 void Sieve::processAllocEvent(SST::Event* event) {
     // should only recieve AllocTrackEvent events
     AllocTrackEvent* ev = static_cast<AllocTrackEvent*>(event);
@@ -150,6 +186,8 @@ void Sieve::processEvent(SST::Event* ev, int link) {
         else statWriteHits->addData(1);
     }
 
+    if (reuse_) recordReuse(baseAddr, event->getVirtualAddress());
+
     // Debug output. Ifdef this for even better performance
 #ifdef __SST_DEBUG_OUTPUT__
     output_->debug(_L4_, "%s, Src = %s, Cmd = %s, BaseAddr = %" PRIx64 ", Addr = %" PRIx64 ", VA = %" PRIx64 ", PC = %" PRIx64 ", Size = %d: %s\n",
@@ -176,6 +214,9 @@ void Sieve::processEvent(SST::Event* ev, int link) {
     //output_->debug(_L3_,"%s, Sending Response, Addr = %" PRIx64 "\n", getName().c_str(), event->getAddr());
 
     delete ev;
+
+    if (snapshotAccesses_ && ++accessCount_ % snapshotAccesses_ == 0)
+        outputStats(-1);
 }
 
 void Sieve::init(unsigned int phase) {
@@ -235,16 +276,44 @@ void Sieve::outputStats(int marker) {
     for (vector<uint64_t>::iterator it = entriesToErase.begin(); it != entriesToErase.end(); it++) {
         allocMap.erase(*it); // remove entry from allocMap
     }
+
+    if (reuse_) {
+        output_file->output(CALL_INFO, "#Printing allocation reuse distance histograms (mallocID, first touches, then accesses at a distance of [2^i - 1, 2^(i+1) - 1) lines for i = 0, 1, ...), sample rate %f:\n", reuse_->rate());
+        for (std::unordered_map<uint64_t, reuseHist_t>::iterator i = reuseHist_.begin(); i != reuseHist_.end(); i++) {
+            std::string site = std::to_string(i->first);
+            printReuse(output_file, site.c_str(), i->second);
+        }
+        printReuse(output_file, "other", reuseOther_);
+        printReuse(output_file, "none", reuseUnassoc_);
+
+        if (resetStatsOnOutput) {
+            reuseHist_.clear();
+            reuseOther_.assign(ReuseBuckets, 0);
+            reuseUnassoc_.assign(ReuseBuckets, 0);
+        }
+    }
     // clean up
     delete output_file;
 }
 
+void Sieve::printReuse(Output* out, const char* site, const reuseHist_t &hist) {
+    size_t last = hist.size();
+    while (last > 0 && hist[last - 1] == 0) last--;
+    if (last == 0) return;
+
+    std::ostringstream line;
+    line << site;
+    for (size_t i = 0; i < last; i++) line << " " << hist[i];
+    out->output(CALL_INFO, "%s\n", line.str().c_str());
+}
+
 void Sieve::finish(){
     outputStats(-1);
 }
 
 
 Sieve::~Sieve(){
+    delete reuse_;
     delete cacheArray_;
     delete output_;
 }
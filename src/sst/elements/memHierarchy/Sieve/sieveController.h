@@ -34,6 +34,7 @@
 #include "sst/elements/memHierarchy/replacementManager.h"
 #include "sst/elements/memHierarchy/util.h"
 #include "alloctrackev.h"
+#include "reuseDistance.h"
 
 
 namespace SST { namespace MemHierarchy {
@@ -55,7 +56,11 @@ public:
             {"debug",                   "(uint) Print debug information. Options: 0[no output], 1[stdout], 2[stderr], 3[file]", "0"},
             {"debug_level",             "(uint) Debugging/verbosity level. Between 0 and 10", "0"},
             {"output_file",             "(string) Name of file to output malloc information to. Will have sequence number (and optional marker number) and .txt appended to it. E.g. sieveMallocRank-3.txt", "sieveMallocRank"},
-            {"reset_stats_at_buoy",     "(bool) Whether to reset allocation hit/miss stats when a buoy is found (i.e., when a new output file is dumped). Any value other than 0 is true." "0"} )
+            {"reset_stats_at_buoy",     "(bool) Whether to reset allocation hit/miss stats when a buoy is found (i.e., when a new output file is dumped). Any value other than 0 is true." "0"},
+            {"reuse_sample_rate",       "(float) Fraction of cache lines to sample for per-allocation reuse distance histograms, written with the allocation stats. 0 disables them.", "0"},
+            {"reuse_max_lines",         "(uint) Most sampled lines to track at once. The sample rate drops as needed to stay under this.", "8192"},
+            {"reuse_max_sites",         "(uint) Most allocation sites to keep a reuse histogram for, any more share one.", "1024"},
+            {"snapshot_accesses",       "(uint) Also write the output file every this many accesses. 0 writes it only at buoys and at the end.", "0"} )
 
     SST_ELI_DOCUMENT_PORTS(
             {"cpu_link_%(port)d", "Ports connected to the CPUs", {"memHierarchy.MemEventBase"}},
@@ -113,6 +118,25 @@ private:
 
     void recordMiss(Addr addr, bool isRead);
 
+    /** The active allocation holding addr, NULL if none */
+    mallocEntry* findAlloc(Addr addr);
+
+    /** Reuse distance histograms per allocation site: a bucket for first touches, then one per power of two of distance */
+    static const size_t ReuseBuckets = 34;
+    typedef vector<uint64_t> reuseHist_t;
+
+    void recordReuse(Addr baseAddr, Addr vAddr);
+    void printReuse(Output* out, const char* site, const reuseHist_t &hist);
+
+    ReuseDistanceSampler* reuse_;
+    std::unordered_map<uint64_t, reuseHist_t> reuseHist_;
+    reuseHist_t reuseOther_;    // sites past reuseMaxSites_
+    reuseHist_t reuseUnassoc_;  // addresses in no allocation
+    size_t reuseMaxSites_;
+
+    uint64_t snapshotAccesses_;
+    uint64_t accessCount_;
+
     /** Destructor for Sieve Component */
     ~Sieve();
 
@@ -75,6 +75,19 @@ Sieve::Sieve(ComponentId_t id, Params &params) : Component(id) {
 
     resetStatsOnOutput = params.find<bool>("reset_stats_at_buoy", 0) != 0;
 
+    /* reuse distance sampling and periodic output */
+    double reuseRate = params.find<double>("reuse_sample_rate", 0);
+    if (reuseRate < 0 || reuseRate > 1) output_->fatal(CALL_INFO, -1, "Invalid param: reuse_sample_rate - must be between 0 and 1. Got %f\n", reuseRate);
+    reuse_ = nullptr;
+    if (reuseRate > 0) {
+        reuse_ = new ReuseDistanceSampler(reuseRate, params.find<size_t>("reuse_max_lines", 8192));
+        reuseOther_.assign(ReuseBuckets, 0);
+        reuseUnassoc_.assign(ReuseBuckets, 0);
+    }
+    reuseMaxSites_ = params.find<size_t>("reuse_max_sites", 1024);
+    snapshotAccesses_ = params.find<uint64_t>("snapshot_accesses", 0);
+    accessCount_ = 0;
+
     // optional link for allocation / free tracking
     configureLinks();
 
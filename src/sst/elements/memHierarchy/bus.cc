@@ -45,8 +45,9 @@ Bus::Bus(ComponentId_t id, Params& params) : Component(id) {
 }
 
 
-void Bus::processIncomingEvent(SST::Event* ev) {
-    eventQueue_.push(ev);
+void Bus::processIncomingEvent(SST::Event* ev, int port) {
+    eventQueues_[eventQueues_.size() == 1 ? 0 : port].push(QueuedEvent(ev, port));
+    queuedEvents_++;
     if (!busOn_) {
         reregisterClock(defaultTimeBase_, clockHandler_);
         busOn_ = true;
@@ -56,7 +57,7 @@ void Bus::processIncomingEvent(SST::Event* ev) {
 
 bool Bus::clockTick(Cycle_t time) {
 
-    if (eventQueue_.empty())
+    if (queuedEvents_ == 0)
         idleCount_++;
 
     if (idleCount_ > idleMax_) {
@@ -65,18 +66,18 @@ bool Bus::clockTick(Cycle_t time) {
         return true;
     }
 
-    while (!eventQueue_.empty()) {
-        SST::Event* event = eventQueue_.front();
+    uint64_t transfers = 0;
+    while (queuedEvents_ != 0) {
+        QueuedEvent event = nextEvent();
 
         if (broadcast_)
-            broadcastEvent(event);
+            broadcastEvent(event.first, event.second);
         else
-            sendSingleEvent(event);
+            sendSingleEvent(event.first);
 
-        eventQueue_.pop();
         idleCount_ = 0;
 
-        if (!drain_ )
+        if (!drain_ && ++transfers == transfersPerCycle_)
             break;
     }
 
@@ -84,17 +85,40 @@ bool Bus::clockTick(Cycle_t time) {
 }
 
 
-void Bus::broadcastEvent(SST::Event* ev) {
+Bus::QueuedEvent Bus::nextEvent() {
+    while (eventQueues_[nextQueue_].empty())
+        nextQueue_ = (nextQueue_ + 1) % eventQueues_.size();
+
+    QueuedEvent event = eventQueues_[nextQueue_].front();
+    eventQueues_[nextQueue_].pop();
+    queuedEvents_--;
+    nextQueue_ = (nextQueue_ + 1) % eventQueues_.size();
+    return event;
+}
+
+
+void Bus::broadcastEvent(SST::Event* ev, int srcPort) {
     MemEventBase* memEvent = static_cast<MemEventBase*>(ev);
-    SST::Link* srcLink = lookupNode(memEvent->getSrc());
+
+    /* A high port that never asked for an address cannot hold it, so it has no use for the event */
+    MemEvent* filterEvent = broadcastFilter_ ? dynamic_cast<MemEvent*>(memEvent) : nullptr;
+    int dstPort = -1;
+    if (filterEvent) {
+        if (srcPort < numHighNetPorts_)
+            highPortAddrs_[srcPort].insert(filterEvent->getBaseAddr());
+        EndpointId dst = filterEvent->getDstId();
+        if (dst < portById_.size())
+            dstPort = portById_[dst];
+    }
 
     for (int i = 0; i < numHighNetPorts_; i++) {
-        if (highNetPorts_[i] == srcLink) continue;
+        if (i == srcPort) continue;
+        if (filterEvent && i != dstPort && !highPortAddrs_[i].count(filterEvent->getBaseAddr())) continue;
         highNetPorts_[i]->send(memEvent->clone());
     }
 
     for (int i = 0; i < numLowNetPorts_; i++) {
-        if (lowNetPorts_[i] == srcLink) continue;
+        if (numHighNetPorts_ + i == srcPort) continue;
         lowNetPorts_[i]->send(memEvent->clone());
     }
 
@@ -112,7 +136,7 @@ void Bus::sendSingleEvent(SST::Event* ev) {
         fflush(stdout);
     }
 #endif
-    SST::Link* dstLink = lookupNode(event->getDst());
+    SST::Link* dstLink = ports_[lookupNode(event->getDstId())];
     MemEventBase* forwardEvent = event->clone();
     dstLink->send(forwardEvent);
 
@@ -123,22 +147,23 @@ void Bus::sendSingleEvent(SST::Event* ev) {
  * Helper functions
  *---------------------------------------*/
 
-void Bus::mapNodeEntry(const std::string& name, SST::Link* link) {
-    std::map<std::string, SST::Link*>::iterator it = nameMap_.find(name);
-    if (it != nameMap_.end() ) {
-        if (it->second != link)
+void Bus::mapNodeEntry(const std::string& name, int port) {
+    EndpointId id = EndpointRegistry::intern(name);
+    if (id >= portById_.size())
+        portById_.resize(id + 1, -1);
+    if (portById_[id] != -1) {
+        if (portById_[id] != port)
             dbg_.fatal(CALL_INFO, -1, "%s, Error: Bus attempting to map node that has already been mapped\n", getName().c_str());
         return;
     }
-    nameMap_[name] = link;
+    portById_[id] = port;
 }
 
-SST::Link* Bus::lookupNode(const std::string& name) {
-    std::map<std::string, SST::Link*>::iterator it = nameMap_.find(name);
-    if (nameMap_.end() == it) {
-        dbg_.fatal(CALL_INFO, -1, "%s, Error: Bus lookup of node %s returned no mapping\n", getName().c_str(), name.c_str());
+int Bus::lookupNode(EndpointId id) {
+    if (id >= portById_.size() || portById_[id] == -1) {
+        dbg_.fatal(CALL_INFO, -1, "%s, Error: Bus lookup of node %s returned no mapping\n", getName().c_str(), EndpointRegistry::name(id).c_str());
     }
-    return it->second;
+    return portById_[id];
 }
 
 void Bus::configureLinks() {
@@ -146,7 +171,7 @@ void Bus::configureLinks() {
     std::string linkprefix = "high_network_";
     std::string linkname = linkprefix + "0";
     while (isPortConnected(linkname)) {
-        link = configureLink(linkname, new Event::Handler<Bus>(this, &Bus::processIncomingEvent));
+        link = configureLink(linkname, new Event::Handler<Bus, int>(this, &Bus::processIncomingEvent, numHighNetPorts_));
         if (!link)
             dbg_.fatal(CALL_INFO, -1, "%s, Error: unable to configure link on port '%s'\n", getName().c_str(), linkname.c_str());
         highNetPorts_.push_back(link);
@@ -157,7 +182,7 @@ void Bus::configureLinks() {
     linkprefix = "low_network_";
     linkname = linkprefix + "0";
     while (isPortConnected(linkname)) {
-        link = configureLink(linkname, "50 ps", new Event::Handler<Bus>(this, &Bus::processIncomingEvent));
+        link = configureLink(linkname, "50 ps", new Event::Handler<Bus, int>(this, &Bus::processIncomingEvent, numHighNetPorts_ + numLowNetPorts_));
         if (!link)
             dbg_.fatal(CALL_INFO, -1, "%s, Error: unable to configure link on port '%s'\n", getName().c_str(), linkname.c_str());
         lowNetPorts_.push_back(link);
@@ -167,6 +192,14 @@ void Bus::configureLinks() {
 
     if (numLowNetPorts_ < 1 || numHighNetPorts_ < 1) dbg_.fatal(CALL_INFO, -1,"couldn't find number of Ports (numPorts)\n");
 
+    ports_ = highNetPorts_;
+    ports_.insert(ports_.end(), lowNetPorts_.begin(), lowNetPorts_.end());
+    eventQueues_.resize(portQueues_ ? ports_.size() : 1);
+    queuedEvents_ = 0;
+    nextQueue_ = 0;
+    if (broadcastFilter_)
+        highPortAddrs_.resize(numHighNetPorts_);
+
 }
 
 void Bus::configureParameters(SST::Params& params) {
@@ -189,6 +222,11 @@ void Bus::configureParameters(SST::Params& params) {
     broadcast_    = params.find<bool>("broadcast", 0);
     fanout_       = params.find<bool>("fanout", 0);  /* TODO:  Fanout: Only send messages to lower level caches */
     drain_        = params.find<bool>("drain_bus", false);
+    transfersPerCycle_ = params.find<uint64_t>("transfers_per_cycle", 1);
+    portQueues_   = params.find<bool>("port_queues", false);
+    broadcastFilter_ = params.find<bool>("broadcast_filter", false);
+
+    if (transfersPerCycle_ == 0) dbg_.fatal(CALL_INFO, -1, "%s, Error: transfers_per_cycle must be at least 1\n", getName().c_str());
 
     if (busFrequency_ == "Invalid") dbg_.fatal(CALL_INFO, -1, "Bus Frequency was not specified\n");
     
@@ -214,7 +252,7 @@ void Bus::init(unsigned int phase) {
 
             if (memEvent && memEvent->getCmd() == Command::NULLCMD) {
                 dbg_.debug(_L10_, "bus %s broadcasting upper event to lower ports (%d): %s\n", getName().c_str(), numLowNetPorts_, memEvent->getVerboseString().c_str());
-                mapNodeEntry(memEvent->getSrc(), highNetPorts_[i]);
+                mapNodeEntry(memEvent->getSrc(), i);
                 for (int k = 0; k < numLowNetPorts_; k++)
                     lowNetPorts_[k]->sendUntimedData(memEvent->clone());
             } else if (memEvent) {
@@ -232,7 +270,7 @@ void Bus::init(unsigned int phase) {
             if (!memEvent) delete memEvent;
             else if (memEvent->getCmd() == Command::NULLCMD) {
                 dbg_.debug(_L10_, "bus %s broadcasting lower event to upper ports (%d): %s\n", getName().c_str(), numHighNetPorts_, memEvent->getVerboseString().c_str());
-                mapNodeEntry(memEvent->getSrc(), lowNetPorts_[i]);
+                mapNodeEntry(memEvent->getSrc(), numHighNetPorts_ + i);
                 for (int i = 0; i < numHighNetPorts_; i++) {
                     highNetPorts_[i]->sendUntimedData(memEvent->clone());
                 }
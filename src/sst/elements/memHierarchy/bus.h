@@ -18,6 +18,8 @@
 
 #include <queue>
 #include <map>
+#include <unordered_set>
+#include <vector>
 
 #include <sst/core/event.h>
 #include <sst/core/sst_types.h>
@@ -55,6 +57,9 @@ public:
             {"bus_latency_cycles",  "(uint) Bus latency in cycles", "0"},
             {"idle_max",            "(uint) Bus temporarily turns off clock after this number of idle cycles", "6"},
             {"drain_bus",           "(bool) Drain bus on every cycle", "0"},
+            {"transfers_per_cycle", "(uint) Number of events the bus moves each cycle when not draining", "1"},
+            {"port_queues",         "(bool) Queue events per input port and take them round robin instead of in one arrival order queue", "0"},
+            {"broadcast_filter",    "(bool) With broadcast, only send an event for an address to the high ports that have sent the bus a request for that address, and to its destination", "0"},
             {"debug",               "(uint) Output location for debug statements. Requires core configuration flag '--enable-debug'. --0[None], 1[STDOUT], 2[STDERR], 3[FILE]--", "0"},
             {"debug_level",         "(uint) Debugging level: 0 to 10", "0"},
             {"debug_addr",          "(comma separated uints) Address(es) to be debugged. Leave empty for all, otherwise specify one or more comma separated values. Start and end string with brackets", ""} )
@@ -74,14 +79,19 @@ public:
 
 private:
 
+    typedef std::pair<SST::Event*, int> QueuedEvent;  // (event, input port)
+
     /** Adds event to the incoming event queue.  Reregisters clock if needed */
-    void processIncomingEvent(SST::Event *ev);
+    void processIncomingEvent(SST::Event *ev, int port);
+
+    /** Remove the next event to send from the queues */
+    QueuedEvent nextEvent();
 
     /** Send event to a single destination */
     void sendSingleEvent(SST::Event *ev);
 
-    /** Broadcast event to all ports */
-    void broadcastEvent(SST::Event *ev);
+    /** Broadcast event to all ports but the one it came in on */
+    void broadcastEvent(SST::Event *ev, int srcPort);
 
     /**  Clock Handler */
     bool clockTick(Cycle_t);
@@ -90,8 +100,8 @@ private:
     void configureParameters(SST::Params&);
     void configureLinks();
 
-    void mapNodeEntry(const std::string&, SST::Link*);
-    SST::Link* lookupNode(const std::string&);
+    void mapNodeEntry(const std::string&, int port);
+    int lookupNode(EndpointId);
 
 
     Output                          dbg_;
@@ -105,6 +115,9 @@ private:
     bool                            broadcast_;
     bool                            busOn_;
     bool                            drain_;
+    bool                            portQueues_;
+    bool                            broadcastFilter_;
+    uint64_t                        transfersPerCycle_;
     Clock::Handler<Bus>*            clockHandler_;
     TimeConverter*                  defaultTimeBase_;
 
@@ -112,8 +125,14 @@ private:
     std::string                     bus_latency_cycles_;
     std::vector<SST::Link*>         highNetPorts_;
     std::vector<SST::Link*>         lowNetPorts_;
-    std::map<string,SST::Link*>     nameMap_;
-    std::queue<SST::Event*>         eventQueue_;
+    std::vector<SST::Link*>         ports_;         // high ports, then low ports
+    std::vector<int>                portById_;      // port of each endpoint, by EndpointId, -1 if not on this bus
+
+    std::vector<std::queue<QueuedEvent> > eventQueues_;  // one per input port with port_queues, else one
+    size_t                          queuedEvents_;
+    size_t                          nextQueue_;     // round robin position in eventQueues_
+
+    std::vector<std::unordered_set<Addr> > highPortAddrs_;  // broadcast_filter: addresses each high port has requested
 
 };
 
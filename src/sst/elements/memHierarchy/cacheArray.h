@@ -52,6 +52,23 @@ class CacheArray {
         vector<T*>      lines_; // The actual cache
         State* setStates;
         std::map<unsigned int, std::vector<ReplacementInfo*> > rInfo;   // Lookup a vector of replacementInfo by set ID
+
+        /* Flat layout: tags and replacement info are stored contiguously by set.
+         * Lookups compare against the tag array instead of dereferencing each line and
+         * victim selection hands the replacement policy the set's entries in place. */
+        bool            flat_;
+        vector<Addr>    tags_;      // Line address for each way, set-major
+        vector<ReplacementInfo*> setInfo_; // Replacement info for each way, set-major
+        Addr            setMask_;   // numSets_ - 1 if numSets_ is a power of two, otherwise 0
+
+        static const uint64_t CheckpointMagic = 0x4d48434143484531ULL; // "MHCACHE1"
+        static bool isCheckpointState(State state) { return state == S || state == E || state == O || state == M; }
+
+        /** Compute the set for a line address */
+        inline unsigned int getSet(Addr laddr) {
+            uint64_t h = hash_->hash(0, laddr);
+            return setMask_ ? (h & setMask_) : (h % numSets_);
+        }
     public:
 
         CacheArray(Output* dbg, unsigned int numLines, unsigned int associativity, uint32_t lineSize, ReplacementPolicy* replacementMgr, HashFunction* hash);
@@ -88,7 +105,15 @@ class CacheArray {
     /**** Configuration and output */
         void setSliceAware(Addr size, Addr step);
         void setBanked(unsigned int numBanks);
+        /** Select the storage layout. Options: 'map' (default) or 'flat' */
+        void setLayout(std::string layout);
         void printCacheArray(Output &out);
+
+    /**** Checkpointing - line types must provide checkpoint()/restore() */
+        /** Write the valid lines. Lines in a transient state are left out */
+        void checkpoint(FILE* fp);
+        /** Fill the array from a checkpoint taken of an array with the same geometry */
+        void restore(FILE* fp);
 };
 
 /************* Function definitions *****************/
@@ -120,6 +145,8 @@ CacheArray<T>::CacheArray(Output* dbg, unsigned int numLines, unsigned int assoc
     sliceStep_ = 1;
     sliceSize_ = 1;
     banks_ = 1;
+    flat_ = false;
+    setMask_ = ((numSets_ & (numSets_ - 1)) == 0) ? numSets_ - 1 : 0;
 
     for (unsigned int i = 0; i < numLines_; i++) {
         lines_[i] = new T(lineSize_, i);
@@ -159,10 +186,23 @@ Addr CacheArray<T>::toLineAddr(Addr addr) {
 template <class T>
 T* CacheArray<T>::lookup(const Addr addr, bool updateReplacement) {
     Addr laddr = toLineAddr(addr);
-    int set = hash_->hash(0, laddr) % numSets_;
+    int set = getSet(laddr);
     int setBegin = set * associativity_;
     int setEnd = setBegin + associativity_;
 
+    if (flat_) {
+        const Addr* tags = &tags_[setBegin];
+        for (unsigned int way = 0; way < associativity_; way++) {
+            if (tags[way] == addr) {
+                unsigned int i = setBegin + way;
+                if (updateReplacement)
+                    replacementMgr_->update(i, lines_[i]->getReplacementInfo());
+                return lines_[i];
+            }
+        }
+        return nullptr; // Not found
+    }
+
     for (int i = setBegin; i < setEnd; i++) {
         if (lines_[i]->getAddr() == addr) {
             if (updateReplacement)
@@ -176,9 +216,13 @@ T* CacheArray<T>::lookup(const Addr addr, bool updateReplacement) {
 template <class T>
 T * CacheArray<T>::findReplacementCandidate(Addr addr) {
     Addr laddr = toLineAddr(addr);
-    int set = hash_->hash(0, laddr) % numSets_;
+    int set = getSet(laddr);
 
-    unsigned int id = replacementMgr_->findBestCandidate(rInfo[set]);
+    unsigned int id;
+    if (flat_)
+        id = replacementMgr_->findBestCandidateInSet(&setInfo_[set * associativity_], associativity_);
+    else
+        id = replacementMgr_->findBestCandidate(rInfo[set]);
 
     return lines_[id];
 }
@@ -189,6 +233,8 @@ void CacheArray<T>::replace(Addr addr, T* candidate) {
     replacementMgr_->replaced(index);
     candidate->reset();
     candidate->setAddr(addr);
+    if (flat_)
+        tags_[index] = addr;
     replacementMgr_->update(index, lines_[index]->getReplacementInfo());
 }
 
@@ -212,6 +258,68 @@ void CacheArray<T>::setBanked(unsigned int numBanks) {
     banks_ = numBanks;
 }
 
+template <class T>
+void CacheArray<T>::setLayout(std::string layout) {
+    if (layout == "" || layout == "map") {
+        flat_ = false;
+        tags_.clear();
+        setInfo_.clear();
+        return;
+    }
+
+    if (layout != "flat")
+        dbg_->fatal(CALL_INFO, -1, "CacheArray, Error: invalid array layout '%s'. Options are 'map' or 'flat'.\n", layout.c_str());
+
+    flat_ = true;
+    tags_.resize(numLines_);
+    for (unsigned int i = 0; i < numLines_; i++)
+        tags_[i] = lines_[i]->getAddr();
+
+    setInfo_.resize(numLines_);
+    for (unsigned int i = 0; i < numLines_; i++)
+        setInfo_[i] = lines_[i]->getReplacementInfo();
+}
+
+template <class T>
+void CacheArray<T>::checkpoint(FILE* fp) {
+    uint64_t header[3] = { CheckpointMagic, numLines_, lineSize_ };
+    uint64_t count = 0;
+    for (unsigned int i = 0; i < numLines_; i++) {
+        if (isCheckpointState(lines_[i]->getState())) count++;
+    }
+    bool ok = fwrite(header, sizeof(header), 1, fp) == 1 && fwrite(&count, sizeof(count), 1, fp) == 1;
+
+    for (unsigned int i = 0; ok && i < numLines_; i++) {
+        if (!isCheckpointState(lines_[i]->getState())) continue;
+        uint64_t index = i;
+        Addr addr = lines_[i]->getAddr();
+        ok = fwrite(&index, sizeof(index), 1, fp) == 1 && fwrite(&addr, sizeof(addr), 1, fp) == 1 && lines_[i]->checkpoint(fp);
+    }
+    if (!ok)
+        dbg_->fatal(CALL_INFO, -1, "CacheArray, Error: unable to write checkpoint.\n");
+}
+
+template <class T>
+void CacheArray<T>::restore(FILE* fp) {
+    uint64_t header[3];
+    uint64_t count;
+    if (fread(header, sizeof(header), 1, fp) != 1 || header[0] != CheckpointMagic || fread(&count, sizeof(count), 1, fp) != 1)
+        dbg_->fatal(CALL_INFO, -1, "CacheArray, Error: not a cache array checkpoint.\n");
+    if (header[1] != numLines_ || header[2] != lineSize_)
+        dbg_->fatal(CALL_INFO, -1, "CacheArray, Error: checkpoint is of a cache with %" PRIu64 " lines of %" PRIu64 " bytes, this cache has %u lines of %u bytes.\n",
+                header[1], header[2], numLines_, lineSize_);
+
+    for (uint64_t n = 0; n < count; n++) {
+        uint64_t index;
+        Addr addr;
+        if (fread(&index, sizeof(index), 1, fp) != 1 || fread(&addr, sizeof(addr), 1, fp) != 1 || index >= numLines_)
+            dbg_->fatal(CALL_INFO, -1, "CacheArray, Error: checkpoint is truncated or corrupt.\n");
+        replace(addr, lines_[index]);
+        if (!lines_[index]->restore(fp))
+            dbg_->fatal(CALL_INFO, -1, "CacheArray, Error: checkpoint is truncated or corrupt.\n");
+    }
+}
+
 template <class T>
 void CacheArray<T>::printCacheArray(Output &out) {
     for (unsigned int i = 0; i < numLines_; i++) {
@@ -56,7 +56,7 @@ void Cache::handleEvent(SST::Event * ev) {
         fflush(stdout);
     }
     
-    eventBuffer_.push_back(event);
+    eventBuffer_.push_back({event, false});
 }
 
 /* 
@@ -95,7 +95,9 @@ void Cache::processPrefetchEvent(SST::Event * ev) {
 
 /* Clock handler */
 bool Cache::clockTick(Cycle_t time) {
+    SST::HostProf::ScopedHandlerTimer profileTimer(profileClock_);
     timestamp_++;
+    statClockTicksExecuted->addData(1);
 
     // Drain any outgoing messages
     bool idle = coherenceMgr_->sendOutgoingEvents();
@@ -122,55 +124,60 @@ bool Cache::clockTick(Cycle_t time) {
     // 3. Prefetch buffer   -> Drop any prefetch that can't be handled immediately
 
     int accepted = 0;
-    size_t entries = retryBuffer_.size();
 
-    std::list<MemEventBase*>::iterator it = retryBuffer_.begin();
-    while (it != retryBuffer_.end()) {
+    retryBuffer_.scan([&](MemEventBase* ev) {
         if (accepted == maxRequestsPerCycle_)
-            break;
-        if (is_debug_event((*it))) {
+            return MemEventBuffer<MemEventBase*>::Scan::Stop;
+        if (is_debug_event(ev)) {
             dbg_->debug(_L3_, "E: %-20" PRIu64 " %-20" PRIu64 " %-20s Event:Retry   (%s)\n",
-                    getCurrentSimCycle(), timestamp_, getName().c_str(), (*it)->getVerboseString().c_str());
+                    getCurrentSimCycle(), timestamp_, getName().c_str(), ev->getVerboseString().c_str());
             fflush(stdout);
         }
-        if (processEvent(*it, true)) {
+        if (processEvent(ev, true)) {
             accepted++;
             statRetryEvents->addData(1);
-            it = retryBuffer_.erase(it);
-        } else {
-            it++;
+            return MemEventBuffer<MemEventBase*>::Scan::Remove;
         }
-    }
+        return MemEventBuffer<MemEventBase*>::Scan::Keep;
+    });
 
     // Event buffer has both requests and responses
     // Deadlock will not occur because an event cannot indefinitely block another one
     // 1. An event can be accepted, in which case a later response moves up the queue
     // 2. An event can be rejected, in which case we check the next one with no penalty (doesn't block a later response)
-    it = eventBuffer_.begin();
-    while (it != eventBuffer_.end()) {
+    // Requests that were rejected because the MSHR was full are skipped until it has room again,
+    // since handling them would only reject them again
+    eventBuffer_.scan([&](BufferedEvent& entry) {
         if (accepted == maxRequestsPerCycle_)
-            break;
-        Command cmd = (*it)->getCmd();
-        if (is_debug_event((*it))) {
+            return MemEventBuffer<BufferedEvent>::Scan::Stop;
+        if (entry.mshrStall && mshrFullForRequests())
+            return MemEventBuffer<BufferedEvent>::Scan::Keep;
+        if (is_debug_event(entry.event)) {
             dbg_->debug(_L3_, "E: %-20" PRIu64 " %-20" PRIu64 " %-20s Event:New     (%s)\n",
-                    getCurrentSimCycle(), timestamp_, getName().c_str(), (*it)->getVerboseString().c_str());
+                    getCurrentSimCycle(), timestamp_, getName().c_str(), entry.event->getVerboseString().c_str());
             fflush(stdout);
         }
-        if (processEvent(*it, false)) {
+        if (processEvent(entry.event, false)) {
             accepted++;
             statRecvEvents->addData(1);
-            it = eventBuffer_.erase(it);
-        } else {
-            it++;
+            return MemEventBuffer<BufferedEvent>::Scan::Remove;
         }
-    }
+        entry.mshrStall = CommandClassArr[(int)entry.event->getCmd()] == CommandClass::Request && mshrFullForRequests();
+        return MemEventBuffer<BufferedEvent>::Scan::Keep;
+    });
     while (!prefetchBuffer_.empty()) {
         if (is_debug_event(prefetchBuffer_.front())) {
             dbg_->debug(_L3_, "E: %-20" PRIu64 " %-20" PRIu64 " %-20s Event:Pref    (%s)\n",
                     getCurrentSimCycle(), timestamp_, getName().c_str(), prefetchBuffer_.front()->getVerboseString().c_str());
             fflush(stdout);
         }
-        if (accepted != maxRequestsPerCycle_ && processEvent(prefetchBuffer_.front(), false)) {
+        if (coherenceMgr_->throttlePrefetch()) {
+            statPrefetchThrottled->addData(1);
+            coherenceMgr_->removeRequestRecord(prefetchBuffer_.front()->getID());
+            MemEventBase* ev = prefetchBuffer_.front();
+            prefetchBuffer_.pop();
+            delete ev;
+        } else if (accepted != maxRequestsPerCycle_ && processEvent(prefetchBuffer_.front(), false)) {
             accepted++;
             // Accepted prefetches are profiled in the coherence manager
 	    prefetchBuffer_.pop();
@@ -183,15 +190,19 @@ bool Cache::clockTick(Cycle_t time) {
         }
     }
 
+    coherenceMgr_->flushListenerNotifications();
+
     // Push any events that need to be retried next cycle onto the retry buffer
     std::vector<MemEventBase*>* rBuf = coherenceMgr_->getRetryBuffer();
-    std::copy( rBuf->begin(), rBuf->end(), std::back_inserter(retryBuffer_) );
+    for (std::vector<MemEventBase*>::iterator it = rBuf->begin(); it != rBuf->end(); it++)
+        retryBuffer_.push_back(*it);
     coherenceMgr_->clearRetryBuffer();
 
     idle &= coherenceMgr_->checkIdle();
 
     // Disable lower-level cache clocks if they're idle
-    if (eventBuffer_.empty() && retryBuffer_.empty() && idle) {
+    // Requests stalled on a full MSHR do not count as work since only an arriving response can unblock them
+    if (idle && retryBuffer_.empty() && eventBufferStalled()) {
         turnClockOff();
         return true;
     }
@@ -207,10 +218,25 @@ void Cache::turnClockOn() {
     coherenceMgr_->updateTimestamp(timestamp_);
     int64_t cyclesOff = timestamp_ - lastActiveClockCycle_;
     statMSHROccupancy->addDataNTimes(cyclesOff, mshr_->getSize());
+    if (cyclesOff > 0)
+        statClockTicksSkipped->addData(cyclesOff);
     //dbg_->debug(_L3_, "%s turning clock ON at cycle %" PRIu64 ", timestamp %" PRIu64 ", ns %" PRIu64 "\n", this->getName().c_str(), getCurrentSimCycle(), timestamp_, getCurrentSimTimeNano());
     clockIsOn_ = true;
 }
 
+/* Whether every event in the event buffer is a request waiting for MSHR space */
+bool Cache::eventBufferStalled() {
+    if (eventBuffer_.empty())
+        return true;
+    if (!mshrFullForRequests())
+        return false;
+    for (MemEventBuffer<BufferedEvent>::iterator it = eventBuffer_.begin(); it != eventBuffer_.end(); it++) {
+        if (!it->mshrStall)
+            return false;
+    }
+    return true;
+}
+
 void Cache::turnClockOff() {
     //dbg_->debug(_L3_, "%s turning clock OFF at cycle %" PRIu64 ", timestamp %" PRIu64 ", ns %" PRIu64 "\n", this->getName().c_str(), getCurrentSimCycle(), timestamp_, getCurrentSimTimeNano());
     clockIsOn_ = false;
@@ -261,86 +287,12 @@ bool Cache::processEvent(MemEventBase* ev, bool inMSHR) {
     bool dbgevent = is_debug_event(event);
     bool accepted = false;
 
-    switch (event->getCmd()) {
-        case Command::GetS:
-            accepted = coherenceMgr_->handleGetS(event, inMSHR);
-            break;
-        case Command::GetX:
-            accepted = coherenceMgr_->handleGetX(event, inMSHR);
-            break;
-        case Command::Write:
-            accepted = coherenceMgr_->handleWrite(event, inMSHR);
-            break;
-        case Command::GetSX:
-            accepted = coherenceMgr_->handleGetSX(event, inMSHR);
-            break;
-        case Command::FlushLine:
-            accepted = coherenceMgr_->handleFlushLine(event, inMSHR);
-            break;
-        case Command::FlushLineInv:
-            accepted = coherenceMgr_->handleFlushLineInv(event, inMSHR);
-            break;
-        case Command::GetSResp:
-            accepted = coherenceMgr_->handleGetSResp(event, inMSHR);
-            break;
-        case Command::WriteResp:
-            accepted = coherenceMgr_->handleWriteResp(event, inMSHR);
-            break;
-        case Command::GetXResp:
-            accepted = coherenceMgr_->handleGetXResp(event, inMSHR);
-            break;
-        case Command::FlushLineResp:
-            accepted = coherenceMgr_->handleFlushLineResp(event, inMSHR);
-            break;
-        case Command::PutS:
-            accepted = coherenceMgr_->handlePutS(event, inMSHR);
-            break;
-        case Command::PutX:
-            accepted = coherenceMgr_->handlePutX(event, inMSHR);
-            break;
-        case Command::PutE:
-            accepted = coherenceMgr_->handlePutE(event, inMSHR);
-            break;
-        case Command::PutM:
-            accepted = coherenceMgr_->handlePutM(event, inMSHR);
-            break;
-        case Command::FetchInv:
-            accepted = coherenceMgr_->handleFetchInv(event, inMSHR);
-            break;
-        case Command::FetchInvX:
-            accepted = coherenceMgr_->handleFetchInvX(event, inMSHR);
-            break;
-        case Command::ForceInv:
-            accepted = coherenceMgr_->handleForceInv(event, inMSHR);
-            break;
-        case Command::Inv:
-            accepted = coherenceMgr_->handleInv(event, inMSHR);
-            break;
-        case Command::Fetch:
-            accepted = coherenceMgr_->handleFetch(event, inMSHR);
-            break;
-        case Command::FetchResp:
-            accepted = coherenceMgr_->handleFetchResp(event, inMSHR);
-            break;
-        case Command::FetchXResp:
-            accepted = coherenceMgr_->handleFetchXResp(event, inMSHR);
-            break;
-        case Command::AckInv:
-            accepted = coherenceMgr_->handleAckInv(event, inMSHR);
-            break;
-        case Command::AckPut:
-            accepted = coherenceMgr_->handleAckPut(event, inMSHR);
-            break;
-        case Command::NACK:
-            accepted = coherenceMgr_->handleNACK(event, inMSHR);
-            break;
-        case Command::NULLCMD:
-            accepted = coherenceMgr_->handleNULLCMD(event, inMSHR);
-            break;
-        default:
-            out_->fatal(CALL_INFO, -1, "%s, Error: Received an unsupported command. Event: %s. Time = %" PRIu64 "ns.\n",
-                    getName().c_str(), event->getVerboseString().c_str(), getCurrentSimTimeNano());
-    }
+    CoherenceController::EventHandler handler = CoherenceController::getEventHandler(event->getCmd());
+    if (handler)
+        accepted = (coherenceMgr_->*handler)(event, inMSHR);
+    else
+        out_->fatal(CALL_INFO, -1, "%s, Error: Received an unsupported command. Event: %s. Time = %" PRIu64 "ns.\n",
+                getName().c_str(), event->getVerboseString().c_str(), getCurrentSimTimeNano());
 
     if (dbgevent)
         coherenceMgr_->printDebugInfo();
@@ -384,16 +336,16 @@ void Cache::processNoncacheable(MemEventBase* event) {
     
     if (CommandRouteByAddress[(int)event->getCmd()]) { /* These events don't have a destination already */
         if (!(event->queryFlag(MemEvent::F_NORESPONSE))) {
-            noncacheableResponseDst_.insert(std::make_pair(event->getID(), event->getSrc()));
+            noncacheableResponseDst_.insert(std::make_pair(event->getID(), event->getSrcId()));
         }
         coherenceMgr_->forwardByAddress(event);
     } else {
-        std::map<SST::Event::id_type,std::string>::iterator it = noncacheableResponseDst_.find(event->getResponseToID());
+        std::map<SST::Event::id_type,EndpointId>::iterator it = noncacheableResponseDst_.find(event->getResponseToID());
         if (it == noncacheableResponseDst_.end()) {
             out_->fatal(CALL_INFO, 01, "%s, Error: noncacheable response received does not match a request. Event: (%s). Time: %" PRIu64 "\n",
                     getName().c_str(), event->getVerboseString().c_str(), getCurrentSimTimeNano());
         }
-        event->setDst(it->second);
+        event->setDstId(it->second);
         coherenceMgr_->forwardByDestination(event);
         noncacheableResponseDst_.erase(it);
     }
@@ -528,6 +480,15 @@ void Cache::setup() {
     // Enqueue the first wakeup event to check for deadlock
     if (timeout_ != 0)
         timeoutSelfLink_->send(1, nullptr);
+
+    if (checkpoint_ == CHECKPOINT_LOAD) {
+        std::string filename = checkpointDir_ + "/" + getName();
+        FILE* fp = fopen(filename.c_str(), "rb");
+        if (!fp)
+            out_->fatal(CALL_INFO, -1, "%s, Error: unable to open checkpoint file '%s'\n", getName().c_str(), filename.c_str());
+        coherenceMgr_->restoreArray(fp);
+        fclose(fp);
+    }
 }
 
 
@@ -539,6 +500,16 @@ void Cache::finish() {
         listeners_[i]->printStats(*out_);
     linkDown_->finish();
     if (linkUp_ != linkDown_) linkUp_->finish();
+    profileClock_.report();
+
+    if (checkpoint_ == CHECKPOINT_SAVE) {
+        std::string filename = checkpointDir_ + "/" + getName();
+        FILE* fp = fopen(filename.c_str(), "wb");
+        if (!fp)
+            out_->fatal(CALL_INFO, -1, "%s, Error: unable to create checkpoint file '%s'\n", getName().c_str(), filename.c_str());
+        coherenceMgr_->checkpointArray(fp);
+        fclose(fp);
+    }
 }
 
 
@@ -35,6 +35,8 @@
 #include "sst/elements/memHierarchy/util.h"
 #include "sst/elements/memHierarchy/cacheListener.h"
 #include "sst/elements/memHierarchy/memLinkBase.h"
+#include "sst/elements/memHierarchy/memEventBuffer.h"
+#include "sst/elements/hostprof/hostProfile.h"
 
 namespace SST { namespace MemHierarchy {
 
@@ -76,6 +78,10 @@ public:
             {"prefetch_delay_cycles",   "(uint) Delay prefetches from prefetcher by this number of cycles.", "1"},
             {"max_outstanding_prefetch","(uint) Maximum number of prefetch misses that can be outstanding, additional prefetches will be dropped/NACKed. Default is 1/2 of MSHR entries.", "0.5*mshr_num_entries"},
             {"drop_prefetch_mshr_level","(uint) Drop/NACK prefetches if the number of in-use mshrs is greater than or equal to this number. Default is mshr_num_entries - 2.", "mshr_num_entries-2"},
+            {"prefetch_accuracy_window",    "(uint) Number of prefetched lines per prefetch accuracy sample. 0 disables accuracy-based throttling.", "0"},
+            {"prefetch_accuracy_threshold", "(float) Throttle prefetches while the fraction of prefetched lines that were used in the last sample is below this.", "0.25"},
+            {"prefetch_throttle_interval",  "(uint) While throttled, accept one of every this many prefetches so accuracy can recover.", "4"},
+            {"listener_batch",          "(bool) Deliver notifications to listeners and prefetchers once per cycle as a batch instead of one at a time.", "false"},
             {"num_cache_slices",        "(uint) For a distributed, shared cache, total number of cache slices", "1"},
             {"slice_id",                "(uint) For distributed, shared caches, unique ID for this cache slice", "0"},
             {"slice_allocation_policy", "(string) Policy for allocating addresses among distributed shared cache. Options: rr[round-robin]", "rr"},
@@ -90,6 +96,10 @@ public:
             {"force_noncacheable_reqs", "(bool) Used for verification purposes. All requests are considered to be 'noncacheable'. Options: 0[off], 1[on]", "false"},
             {"min_packet_size",         "(string) Number of bytes in a request/response not including payload (e.g., addr + cmd). Specify in B.", "8B"},
             {"banks",                   "(uint) Number of cache banks: One access per bank per cycle. Use '0' to simulate no bank limits (only limits on bandwidth then are max_requests_per_cycle and *_link_width", "0"},
+            {"cache_array_layout",      "(string) Storage layout for the cache array. Options: 'map' or 'flat' (contiguous tag array indexed by set, faster lookups for large caches)", "map"},
+            {"checkpoint",              "(string) Warm-state checkpointing of the cache array, use with the memory controllers' checkpoint param. 'save' writes the valid lines at the end of simulation, 'load' restores them before it starts. Every cache in the hierarchy must do the same, and the cache geometry must match. Not supported by non-inclusive caches with a directory or by directory controllers.", ""},
+            {"checkpointDir",           "(string) Directory that holds the checkpoint files, required with 'checkpoint'", ""},
+            {"host_profile",            "(bool) Measure the host time spent in the clock handler and report it in the host_* statistics. Options: 0[off], 1[on]", "false"},
             /* Old parameters - deprecated or moved */
             {"network_address",             "DEPRECATED - Now auto-detected by link control."}, // Remove 9.0
             {"network_bw",                  "MOVED - Now a member of the MemNIC subcomponent.", "80GiB/s"}, // Remove 9.0
@@ -118,8 +128,13 @@ public:
             {"TotalEventsReplayed",     "Total number of events that were initially blocked and then were replayed", "events", 1},
             {"MSHR_occupancy",          "Number of events in MSHR each cycle", "events", 1},
             {"Bank_conflicts",          "Total number of bank conflicts detected", "count", 1},
+            {"Clock_ticks_executed",    "Number of cycles the cache's clock handler ran", "cycles", 1},
+            {"Clock_ticks_skipped",     "Number of cycles the cache's clock was off because the cache was idle", "cycles", 1},
+            {"host_ns_clock",           "With host_profile, host nanoseconds spent in the clock handler", "ns", 1},
+            {"host_events_clock",       "With host_profile, number of calls to the clock handler", "count", 1},
             {"Prefetch_requests",       "Number of prefetches received from prefetcher at this cache", "events", 1},
             {"Prefetch_drops",          "Number of prefetches that were cancelled. Reasons: too many prefetches outstanding, cache can't handle prefetch this cycle, currently handling another event for the address.", "events", 1},
+            {"Prefetch_throttled",      "Number of prefetches dropped because recent prefetches were inaccurate (see prefetch_accuracy_window)", "events", 1},
             /*Event receives */
             {"GetS_recv",               "Event received: GetS", "count", 2},
             {"GetX_recv",               "Event received: GetX", "count", 2},
@@ -239,6 +254,7 @@ private:
     // Clock helpers - turn clock on & off
     void turnClockOn();
     void turnClockOff();
+    bool eventBufferStalled();
 
     // Trigger timeouts if events sit in MSHR for too long
     void timeoutWakeup(SST::Event * ev);
@@ -248,6 +264,9 @@ private:
     bool arbitrateAccess(Addr addr);
     void updateAccessStatus(Addr addr);
 
+    /* Whether the MSHR is too full to accept a new (non-forwarded) request. The last entry is reserved for forwarded requests */
+    bool mshrFullForRequests() { return mshr_->getMaxSize() > 0 && mshr_->getSize() >= mshr_->getMaxSize() - 1; }
+
     // Process coherence initialization events
     void processInitCoherenceEvent(MemEventInitCoherence* event, bool src);
 
@@ -272,6 +291,8 @@ private:
     SimTime_t           timeout_;
     uint64_t            maxOutstandingPrefetch_;
     bool                banked_;
+    std::string         checkpointDir_;
+    enum { NO_CHECKPOINT, CHECKPOINT_LOAD, CHECKPOINT_SAVE } checkpoint_;
 
     /** Clocks *****************************************************************/
     Clock::Handler<Cache>*  clockHandler_;
@@ -286,10 +307,17 @@ private:
     int                         requestsThisCycle_;
     std::vector<bool>           bankStatus_;
     std::set<Addr>              addrsThisCycle_;
-    std::list<MemEventBase*>    retryBuffer_;
-    std::list<MemEventBase*>    eventBuffer_;
+    /* New events waiting to be handled.
+     * mshrStall records that the event was rejected as a new request while the MSHR had no room for one;
+     * it is not handed back to the coherence manager until the MSHR has room again */
+    struct BufferedEvent {
+        MemEventBase* event;
+        bool mshrStall;
+    };
+    MemEventBuffer<MemEventBase*>   retryBuffer_;
+    MemEventBuffer<BufferedEvent>   eventBuffer_;
     std::queue<MemEventBase*>   prefetchBuffer_;
-    std::map<SST::Event::id_type, std::string> noncacheableResponseDst_;
+    std::map<SST::Event::id_type, EndpointId> noncacheableResponseDst_;
 
 
     /** Output and debug *******************************************************/
@@ -299,11 +327,15 @@ private:
 
     /** Statistics *************************************************************/
     Statistic<uint64_t>* statMSHROccupancy;
+    Statistic<uint64_t>* statClockTicksExecuted;
+    Statistic<uint64_t>* statClockTicksSkipped;
     Statistic<uint64_t>* statBankConflicts;
+    SST::HostProf::HandlerProfile profileClock_;
 
     // Prefetch statistics
     Statistic<uint64_t>* statPrefetchRequest;
     Statistic<uint64_t>* statPrefetchDrop;
+    Statistic<uint64_t>* statPrefetchThrottled;
 
     // Event counts
     Statistic<uint64_t>* statRecvEvents;
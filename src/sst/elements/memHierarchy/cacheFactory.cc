@@ -82,9 +82,27 @@ Cache::Cache(ComponentId_t id, Params &params) : Component(id) {
 
     createCoherenceManager(params);
 
+    /* Warm-state checkpoint */
+    checkpointDir_ = params.find<std::string>("checkpointDir", "");
+    std::string checkpoint = params.find<std::string>("checkpoint", "");
+    if (checkpoint.empty()) {
+        checkpoint_ = NO_CHECKPOINT;
+    } else if (checkpoint == "load") {
+        checkpoint_ = CHECKPOINT_LOAD;
+    } else if (checkpoint == "save") {
+        checkpoint_ = CHECKPOINT_SAVE;
+    } else {
+        out_->fatal(CALL_INFO, -1, "%s, Invalid param: checkpoint - must be 'load' or 'save'. You specified '%s'\n", getName().c_str(), checkpoint.c_str());
+    }
+    if (checkpoint_ != NO_CHECKPOINT && checkpointDir_.empty())
+        out_->fatal(CALL_INFO, -1, "%s, Param not specified: checkpointDir - required with checkpoint\n", getName().c_str());
+
     /* Register statistics */
     registerStatistics();
 
+    if (params.find<bool>("host_profile", false))
+        profileClock_.enable(registerStatistic<uint64_t>("host_ns_clock"), registerStatistic<uint64_t>("host_events_clock"));
+
 }
 
 
@@ -149,6 +167,7 @@ void Cache::createCoherenceManager(Params &params) {
     coherenceParams.insert("response_link_width", params.find<std::string>("response_link_width", "0B"));
     coherenceParams.insert("min_packet_size", params.find<std::string>("min_packet_size", "8B"));
     coherenceParams.insert("banks", params.find<std::string>("banks", "0"));
+    coherenceParams.insert("array_layout", params.find<std::string>("cache_array_layout", "map"));
     coherenceParams.insert("associativity", params.find<std::string>("associativity", "-1"));
     coherenceParams.insert("lines", params.find<std::string>("lines", "0"));
     coherenceParams.insert("replacement_policy", params.find<std::string>("replacement_policy", "lru"));
@@ -204,6 +223,9 @@ void Cache::createCoherenceManager(Params &params) {
     coherenceMgr_->setLinks(linkUp_, linkDown_);
     coherenceMgr_->setMSHR(mshr_);
     coherenceMgr_->setCacheListener(listeners_, dropPrefetchLevel, maxOutstandingPrefetch);
+    coherenceMgr_->setListenerBatching(params.find<bool>("listener_batch", false));
+    coherenceMgr_->setPrefetchThrottle(params.find<uint64_t>("prefetch_accuracy_window", 0),
+            params.find<double>("prefetch_accuracy_threshold", 0.25), params.find<uint64_t>("prefetch_throttle_interval", 4));
     coherenceMgr_->setDebug(DEBUG_ADDR);
     coherenceMgr_->setSliceAware(region_.interleaveSize, region_.interleaveStep);
     coherenceMgr_->registerClockEnableFunction(std::bind(&Cache::turnClockOn, this));
@@ -604,9 +626,11 @@ void Cache::createListeners(Params &params) {
     if (!listeners_.empty()) {
         statPrefetchRequest = registerStatistic<uint64_t>("Prefetch_requests");
         statPrefetchDrop = registerStatistic<uint64_t>("Prefetch_drops");
+        statPrefetchThrottled = registerStatistic<uint64_t>("Prefetch_throttled");
     } else {
         statPrefetchRequest = nullptr;
         statPrefetchDrop = nullptr;
+        statPrefetchThrottled = nullptr;
     }
 
     if (!listeners_.empty()) { // Have at least one prefetcher
@@ -794,4 +818,6 @@ void Cache::registerStatistics() {
 
     statMSHROccupancy               = registerStatistic<uint64_t>("MSHR_occupancy");
     statBankConflicts               = registerStatistic<uint64_t>("Bank_conflicts");
+    statClockTicksExecuted          = registerStatistic<uint64_t>("Clock_ticks_executed");
+    statClockTicksSkipped           = registerStatistic<uint64_t>("Clock_ticks_skipped");
 }
@@ -86,6 +86,15 @@ public:
 
     virtual void printStats(Output &UNUSED(out)) {}
     virtual void notifyAccess(const CacheListenerNotification& UNUSED(notify)) {}
+
+    /* Caches with 'listener_batch' enabled deliver each cycle's notifications in one call, in order */
+    virtual void notifyAccessBatch(const CacheListenerNotification* notify, size_t count) {
+        for (size_t i = 0; i < count; i++)
+            notifyAccess(notify[i]);
+    }
+
+    /* Feedback on a line brought in by a prefetch: useful if it was accessed before it was evicted or invalidated */
+    virtual void notifyPrefetchResult(Addr UNUSED(addr), bool UNUSED(useful)) {}
     virtual void registerResponseCallback(Event::HandlerBase *handler) { delete handler; }
 };
 
@@ -17,6 +17,7 @@
 #include <sst_config.h>
 #include <vector>
 #include "coherencemgr/Incoherent.h"
+#include "coherencemgr/coherenceDebug.h"
 
 using namespace SST;
 using namespace SST::MemHierarchy;
@@ -665,8 +666,8 @@ void Incoherent::retry(Addr addr) {
             if (!mshr_->getInProgress(addr))
                 retryBuffer_.push_back(mshr_->getFrontEvent(addr));
         } else { // Pointer -> another request is waiting to evict this address
-            std::list<Addr>* evictPointers = mshr_->getEvictPointers(addr);
-            for (std::list<Addr>::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
+            MSHREvictList* evictPointers = mshr_->getEvictPointers(addr);
+            for (MSHREvictList::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
                 MemEvent * ev = new MemEvent(cachename_, addr, *it, Command::NULLCMD);
                 retryBuffer_.push_back(ev);
             }
@@ -795,6 +796,7 @@ void Incoherent::recordPrefetchResult(PrivateCacheLine * line, Statistic<uint64_
     if (line->getPrefetch()) {
         stat->addData(1);
         line->setPrefetch(false);
+        recordPrefetchOutcome(line->getAddr(), stat == statPrefetchHit || stat == statPrefetchUpgradeMiss);
     }
 }
 
@@ -148,6 +148,7 @@ public:
 
         cacheArray_ = new CacheArray<PrivateCacheLine>(debug, lines, assoc, lineSize_, rmgr, ht);
         cacheArray_->setBanked(params.find<uint64_t>("banks", 0));
+        cacheArray_->setLayout(params.find<std::string>("array_layout", "map"));
 
         stat_eventState[(int)Command::GetS][I] = registerStatistic<uint64_t>("stateEvent_GetS_I");
         stat_eventState[(int)Command::GetS][E] = registerStatistic<uint64_t>("stateEvent_GetS_E");
@@ -267,6 +268,9 @@ public:
     Addr getBank(Addr addr) { return cacheArray_->getBank(addr); }
     void setSliceAware(uint64_t interleaveSize, uint64_t interleaveStep) { cacheArray_->setSliceAware(interleaveSize, interleaveStep); }
 
+    void checkpointArray(FILE* fp) { cacheArray_->checkpoint(fp); }
+    void restoreArray(FILE* fp) { cacheArray_->restore(fp); }
+
     MemEventInitCoherence * getInitCoherenceEvent();
 
     void recordLatency(Command cmd, int type, uint64_t latency);
@@ -16,6 +16,7 @@
 #include <sst_config.h>
 #include <vector>
 #include "coherencemgr/Incoherent_L1.h"
+#include "coherencemgr/coherenceDebug.h"
 
 using namespace SST;
 using namespace SST::MemHierarchy;
@@ -762,8 +763,8 @@ void IncoherentL1::cleanUpAfterRequest(MemEvent* event, bool inMSHR) {
             }
         } else { // Pointer -> either we're waiting for a writeback ACK or another address is waiting for this one
             if (mshr_->getFrontType(addr) == MSHREntryType::Evict) {
-                std::list<Addr>* evictPointers = mshr_->getEvictPointers(addr);
-                for (std::list<Addr>::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
+                MSHREvictList* evictPointers = mshr_->getEvictPointers(addr);
+                for (MSHREvictList::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
                     MemEvent * ev = new MemEvent(cachename_, addr, *it, Command::NULLCMD, getCurrentSimTimeNano());
                     retryBuffer_.push_back(ev);
                 }
@@ -790,8 +791,8 @@ void IncoherentL1::cleanUpAfterResponse(MemEvent* event, bool inMSHR) {
                 retryBuffer_.push_back(mshr_->getFrontEvent(addr));
             }
         } else {
-            std::list<Addr>* evictPointers = mshr_->getEvictPointers(addr);
-            for (std::list<Addr>::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
+            MSHREvictList* evictPointers = mshr_->getEvictPointers(addr);
+            for (MSHREvictList::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
                 MemEvent * ev = new MemEvent(cachename_, addr, *it, Command::NULLCMD, getCurrentSimTimeNano());
                 retryBuffer_.push_back(ev);
             }
@@ -804,8 +805,8 @@ void IncoherentL1::retry(Addr addr) {
         if (mshr_->getFrontType(addr) == MSHREntryType::Event) {
             retryBuffer_.push_back(mshr_->getFrontEvent(addr));
         } else if (!(mshr_->pendingWriteback(addr))) {
-            std::list<Addr>* evictPointers = mshr_->getEvictPointers(addr);
-            for (std::list<Addr>::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
+            MSHREvictList* evictPointers = mshr_->getEvictPointers(addr);
+            for (MSHREvictList::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
                 MemEvent * ev = new MemEvent(cachename_, addr, *it, Command::NULLCMD, getCurrentSimTimeNano());
                 retryBuffer_.push_back(ev);
             }
@@ -966,6 +967,7 @@ void IncoherentL1::recordPrefetchResult(L1CacheLine * line, Statistic<uint64_t>
     if (line->getPrefetch()) {
         stat->addData(1);
         line->setPrefetch(false);
+        recordPrefetchOutcome(line->getAddr(), stat == statPrefetchHit || stat == statPrefetchUpgradeMiss);
     }
 }
 
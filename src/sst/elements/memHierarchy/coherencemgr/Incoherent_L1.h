@@ -138,6 +138,7 @@ public:
 
         cacheArray_ = new CacheArray<L1CacheLine>(debug, lines, assoc, lineSize_, rmgr, ht);
         cacheArray_->setBanked(params.find<uint64_t>("banks", 0));
+        cacheArray_->setLayout(params.find<std::string>("array_layout", "map"));
 
         llscBlockCycles_ = params.find<Cycle_t>("llsc_block_cycles", 0);
 
@@ -246,6 +247,9 @@ public:
     virtual Addr getBank(Addr addr) { return cacheArray_->getBank(addr); }
     virtual void setSliceAware(uint64_t size, uint64_t step) { cacheArray_->setSliceAware(size, step); }
 
+    void checkpointArray(FILE* fp) { cacheArray_->checkpoint(fp); }
+    void restoreArray(FILE* fp) { cacheArray_->restore(fp); }
+
     MemEventInitCoherence * getInitCoherenceEvent();
 
     std::set<Command> getValidReceiveEvents() {
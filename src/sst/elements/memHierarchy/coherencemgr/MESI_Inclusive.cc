@@ -21,6 +21,7 @@
 
 // SST-Elements
 #include "coherencemgr/MESI_Inclusive.h"
+#include "coherencemgr/coherenceDebug.h"
 
 using namespace SST;
 using namespace SST::MemHierarchy;
@@ -1897,8 +1898,8 @@ void MESIInclusive::cleanUpAfterRequest(MemEvent* event, bool inMSHR) {
             }
         } else { // Pointer -> either we're waiting for a writeback ACK or another address is waiting for this one
             if (mshr_->getFrontType(addr) == MSHREntryType::Evict && mshr_->getAcksNeeded(addr) == 0) {
-                std::list<Addr>* evictPointers = mshr_->getEvictPointers(addr);
-                for (std::list<Addr>::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
+                MSHREvictList* evictPointers = mshr_->getEvictPointers(addr);
+                for (MSHREvictList::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
                     MemEvent * ev = new MemEvent(cachename_, addr, *it, Command::NULLCMD);
                     retryBuffer_.push_back(ev);
                 }
@@ -1931,8 +1932,8 @@ void MESIInclusive::cleanUpAfterResponse(MemEvent* event, bool inMSHR) {
             }
         } else {
             if (mshr_->getAcksNeeded(addr) == 0) {
-                std::list<Addr>* evictPointers = mshr_->getEvictPointers(addr);
-                for (std::list<Addr>::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
+                MSHREvictList* evictPointers = mshr_->getEvictPointers(addr);
+                for (MSHREvictList::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
                     MemEvent * ev = new MemEvent(cachename_, addr, *it, Command::NULLCMD);
                     retryBuffer_.push_back(ev);
                 }
@@ -1952,8 +1953,8 @@ void MESIInclusive::retry(Addr addr) {
         } else if (!(mshr_->pendingWriteback(addr))) {
             //if (is_debug_addr(addr))
             //    debug->debug(_L5_, "    Retry: Waiting Evict in MSHR, retrying eviction\n");
-            std::list<Addr>* evictPointers = mshr_->getEvictPointers(addr);
-            for (std::list<Addr>::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
+            MSHREvictList* evictPointers = mshr_->getEvictPointers(addr);
+            for (MSHREvictList::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
                 MemEvent * ev = new MemEvent(cachename_, addr, *it, Command::NULLCMD);
                 retryBuffer_.push_back(ev);
             }
@@ -2293,6 +2294,7 @@ void MESIInclusive::recordPrefetchResult(SharedCacheLine * line, Statistic<uint6
     if (line->getPrefetch()) {
         stat->addData(1);
         line->setPrefetch(false);
+        recordPrefetchOutcome(line->getAddr(), stat == statPrefetchHit || stat == statPrefetchUpgradeMiss);
     }
 }
 
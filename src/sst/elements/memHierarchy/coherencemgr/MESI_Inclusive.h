@@ -261,6 +261,7 @@ public:
         HashFunction * ht = createHashFunction(params);
         cacheArray_ = new CacheArray<SharedCacheLine>(debug, lines, assoc, lineSize_, rmgr, ht);
         cacheArray_->setBanked(params.find<uint64_t>("banks", 0));
+        cacheArray_->setLayout(params.find<std::string>("array_layout", "map"));
 
         /* Statistics */
         stat_evict[I] =         registerStatistic<uint64_t>("evict_I");
@@ -538,6 +539,9 @@ public:
 
     void printStatus(Output &out);
 
+    void checkpointArray(FILE* fp) { cacheArray_->checkpoint(fp); }
+    void restoreArray(FILE* fp) { cacheArray_->restore(fp); }
+
 private:
 
     MemEventStatus processCacheMiss(MemEvent * event, SharedCacheLine * line, bool inMSHR);
@@ -15,19 +15,13 @@
 
 #include <sst_config.h>
 #include <vector>
+#include <algorithm>
 #include "coherencemgr/MESI_L1.h"
+#include "coherencemgr/coherenceDebug.h"
 
 using namespace SST;
 using namespace SST::MemHierarchy;
 
-/* Debug macros */
-#ifdef __SST_DEBUG_OUTPUT__ /* From sst-core, enable with --enable-debug */
-#define is_debug_addr(addr) (DEBUG_ADDR.empty() || DEBUG_ADDR.find(addr) != DEBUG_ADDR.end())
-#define is_debug_event(ev) (DEBUG_ADDR.empty() || ev->doDebug(DEBUG_ADDR))
-#else
-#define is_debug_addr(addr) false
-#define is_debug_event(ev) false
-#endif
 
 /*----------------------------------------------------------------------------------------------------------------------
  * L1 Coherence Controller
@@ -46,6 +40,12 @@ bool MESIL1::handleGetS(MemEvent * event, bool inMSHR) {
     L1CacheLine * line = cacheArray_->lookup(addr, true);
     bool localPrefetch = event->isPrefetch() && (event->getRqstr() == cachename_);
     State state = line ?  line->getState() : I;
+
+    if (!inMSHR && (state == S || state == E || state == M) && !localPrefetch && !event->isLoadLink() && !is_debug_addr(addr)) {
+        handleReadHit(event, line, state);
+        return true;
+    }
+
     uint64_t sendTime = 0;
     MemEventStatus status = MemEventStatus::OK;
     vector<uint8_t> data;
@@ -129,6 +129,58 @@ bool MESIL1::handleGetS(MemEvent * event, bool inMSHR) {
 }
 
 
+/*
+ * GetS hit in S/E/M that was not in the MSHR and is not a local prefetch or LL
+ * Same statistics, timing and response as the hit case in handleGetS, without the
+ * switch or building the returned word in a temporary vector
+ */
+void MESIL1::handleReadHit(MemEvent * event, L1CacheLine * line, State state) {
+    Addr offset = event->getAddr() - event->getBaseAddr();
+
+    recordLatencyType(event->getID(), LatType::HIT);
+    stat_eventState[(int)Command::GetS][state]->addData(1);
+    stat_hit[0][0]->addData(1);
+    stat_hits->addData(1);
+    notifyListenerOfAccess(event, NotifyAccessType::READ, NotifyResultType::HIT);
+    recordPrefetchResult(line, statPrefetchHit);
+
+    MemEvent * responseEvent = event->makeResponse();
+    responseEvent->setPayload(event->getSize(), line->getData()->data() + offset);
+
+    uint64_t deliveryTime = accessLatency_ + std::max(line->getTimestamp(), timestamp_);
+    forwardByDestination(responseEvent, deliveryTime);
+    line->setTimestamp(deliveryTime - 1);
+    cleanUpAfterRequest(event, false);
+}
+
+/*
+ * GetX/Write hit in E/M that was not in the MSHR and is not an SC
+ * Same as the hit case in handleGetX
+ */
+void MESIL1::handleWriteHit(MemEvent * event, L1CacheLine * line, State state) {
+    line->setState(M);
+    recordPrefetchResult(line, statPrefetchHit);
+
+    notifyListenerOfAccess(event, NotifyAccessType::WRITE, NotifyResultType::HIT);
+    recordLatencyType(event->getID(), LatType::HIT);
+    stat_eventState[(int)Command::GetX][state]->addData(1);
+    stat_hit[1][0]->addData(1);
+    stat_hits->addData(1);
+
+    line->setData(event->getPayload(), event->getAddr() - event->getBaseAddr());
+    line->atomicEnd();
+    if (event->queryFlag(MemEvent::F_LOCKED)) {
+        line->decLock();
+    }
+
+    MemEvent * responseEvent = event->makeResponse();
+    uint64_t deliveryTime = tagLatency_ + std::max(line->getTimestamp(), timestamp_);
+    forwardByDestination(responseEvent, deliveryTime);
+    line->setTimestamp(deliveryTime - 1);
+    cleanUpAfterRequest(event, false);
+}
+
+
 /*
  * Handle cacheable Write requests
  * May also be a store-conditional or write-unlock
@@ -146,6 +198,11 @@ bool MESIL1::handleGetX(MemEvent* event, bool inMSHR) {
     L1CacheLine* line = cacheArray_->lookup(addr, true);
     State state = line ? line->getState() : I;
 
+    if (!inMSHR && (state == E || state == M) && !event->isStoreConditional() && !is_debug_addr(addr)) {
+        handleWriteHit(event, line, state);
+        return true;
+    }
+
     if (is_debug_addr(addr))
         eventDI.prefill(event->getID(), event->getThreadID(), Command::GetX, (event->isStoreConditional() ? "-SC" : ""), addr, state);
 
@@ -894,7 +951,7 @@ bool MESIL1::handleGetXResp(MemEvent* event, bool inMSHR) {
     bool localPrefetch = req->isPrefetch() && (req->getRqstr() == cachename_);
 
     if (is_debug_addr(addr)) {
-        std::string mod = localPrefetch ? "-pref" : (req->isLoadLink() ? "-LL" : (req->isStoreConditional() ? "-SC" : ""));
+        const char* mod = localPrefetch ? "-pref" : (req->isLoadLink() ? "-LL" : (req->isStoreConditional() ? "-SC" : ""));
         eventDI.prefill(event->getID(), req->getThreadID(), Command::GetXResp, mod, addr, state);
     }
     req->setMemFlags(event->getMemFlags()); // Copy MemFlags through
@@ -1288,8 +1345,8 @@ void MESIL1::cleanUpAfterRequest(MemEvent * event, bool inMSHR) {
             }
         } else { // Pointer -> either we're waiting for a writeback ACK or another address is waiting to evict this one
             if (mshr_->getFrontType(addr) == MSHREntryType::Evict) {
-                std::list<Addr>* evictPointers = mshr_->getEvictPointers(addr);
-                for (std::list<Addr>::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
+                MSHREvictList* evictPointers = mshr_->getEvictPointers(addr);
+                for (MSHREvictList::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
                     MemEvent * ev = new MemEvent(cachename_, addr, *it, Command::NULLCMD);
                     retryBuffer_.push_back(ev);
                 }
@@ -1322,8 +1379,8 @@ void MESIL1::cleanUpAfterResponse(MemEvent* event, bool inMSHR) {
                 mshr_->addPendingRetry(addr);
             }
         } else { // Pointer to an eviction
-            std::list<Addr>* evictPointers = mshr_->getEvictPointers(addr);
-            for (std::list<Addr>::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
+            MSHREvictList* evictPointers = mshr_->getEvictPointers(addr);
+            for (MSHREvictList::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
                 MemEvent * ev = new MemEvent(cachename_, addr, *it, Command::NULLCMD);
                 retryBuffer_.push_back(ev);
             }
@@ -1339,8 +1396,8 @@ void MESIL1::retry(Addr addr) {
             retryBuffer_.push_back(mshr_->getFrontEvent(addr));
             mshr_->addPendingRetry(addr);
         } else if (!(mshr_->pendingWriteback(addr))) {
-            std::list<Addr>* evictPointers = mshr_->getEvictPointers(addr);
-            for (std::list<Addr>::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
+            MSHREvictList* evictPointers = mshr_->getEvictPointers(addr);
+            for (MSHREvictList::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
                 MemEvent * ev = new MemEvent(cachename_, addr, *it, Command::NULLCMD);
                 retryBuffer_.push_back(ev);
             }
@@ -1530,6 +1587,7 @@ void MESIL1::recordPrefetchResult(L1CacheLine* line, Statistic<uint64_t>* stat)
     if (line->getPrefetch()) {
         stat->addData(1);
         line->setPrefetch(false);
+        recordPrefetchOutcome(line->getAddr(), stat == statPrefetchHit || stat == statPrefetchUpgradeMiss);
     }
 }
 
@@ -27,7 +27,7 @@
 
 namespace SST { namespace MemHierarchy {
 
-class MESIL1 : public CoherenceController {
+class MESIL1 final : public CoherenceController {
 public:
 /* Element Library Info */
     SST_ELI_REGISTER_SUBCOMPONENT(MESIL1, "memHierarchy", "coherence.mesi_l1", SST_ELI_ELEMENT_VERSION(1,0,0),
@@ -208,6 +208,7 @@ public:
 
         cacheArray_ = new CacheArray<L1CacheLine>(debug, lines, assoc, lineSize_, rmgr, ht);
         cacheArray_->setBanked(params.find<uint64_t>("banks", 0));
+        cacheArray_->setLayout(params.find<std::string>("array_layout", "map"));
 
         // Register statistics
         stat_eventState[(int)Command::GetS][I] =      registerStatistic<uint64_t>("stateEvent_GetS_I");
@@ -390,6 +391,9 @@ public:
 
     void printStatus(Output& out);
 
+    void checkpointArray(FILE* fp) { cacheArray_->checkpoint(fp); }
+    void restoreArray(FILE* fp) { cacheArray_->restore(fp); }
+
     Addr getBank(Addr addr);
 
     /* LoadLink wakeup event - not serializable since it only goes over a self link */
@@ -416,6 +420,10 @@ private:
     void retry(Addr addr);
     void handleLoadLinkExpiration(SST::Event* ev);
 
+    /** Hits on a stable line from requests that are not in the MSHR, the common case in an L1 */
+    inline void handleReadHit(MemEvent * event, L1CacheLine * line, State state);
+    inline void handleWriteHit(MemEvent * event, L1CacheLine * line, State state);
+
     /** Event send */
     uint64_t sendResponseUp(MemEvent * event, vector<uint8_t>* data, bool inMSHR, uint64_t time, bool success = true);
     void sendResponseDown(MemEvent * event, L1CacheLine * line, bool data);
@@ -16,18 +16,11 @@
 #include <sst_config.h>
 #include <vector>
 #include "coherencemgr/MESI_Private_Noninclusive.h"
+#include "coherencemgr/coherenceDebug.h"
 
 using namespace SST;
 using namespace SST::MemHierarchy;
 
-/* Debug macros */
-#ifdef __SST_DEBUG_OUTPUT__ /* From sst-core, enable with --enable-debug */
-#define is_debug_addr(addr) (DEBUG_ADDR.empty() || DEBUG_ADDR.find(addr) != DEBUG_ADDR.end())
-#define is_debug_event(ev) (DEBUG_ADDR.empty() || ev->doDebug(DEBUG_ADDR))
-#else
-#define is_debug_addr(addr) false
-#define is_debug_event(ev) false
-#endif
 
 /*----------------------------------------------------------------------------------------------------------------------
  * MESI/MSI Non-Inclusive Coherence Controller for private cache
@@ -2072,8 +2065,8 @@ void MESIPrivNoninclusive::cleanUpAfterRequest(MemEvent* event, bool inMSHR) {
             }
         } else { // Pointer -> either we're waiting for a writeback ACK or another address is waiting for this one
             if (mshr_->getFrontType(addr) == MSHREntryType::Evict && mshr_->getAcksNeeded(addr) == 0) {
-                std::list<Addr>* evictPointers = mshr_->getEvictPointers(addr);
-                for (std::list<Addr>::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
+                MSHREvictList* evictPointers = mshr_->getEvictPointers(addr);
+                for (MSHREvictList::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
                     MemEvent * ev = new MemEvent(cachename_, addr, *it, Command::NULLCMD);
                     retryBuffer_.push_back(ev);
                 }
@@ -2106,8 +2099,8 @@ void MESIPrivNoninclusive::cleanUpAfterResponse(MemEvent* event, bool inMSHR) {
             }
         } else {
             if (mshr_->getAcksNeeded(addr) == 0) {
-                std::list<Addr>* evictPointers = mshr_->getEvictPointers(addr);
-                for (std::list<Addr>::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
+                MSHREvictList* evictPointers = mshr_->getEvictPointers(addr);
+                for (MSHREvictList::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
                     MemEvent * ev = new MemEvent(cachename_, addr, *it, Command::NULLCMD);
                     retryBuffer_.push_back(ev);
                 }
@@ -2123,8 +2116,8 @@ void MESIPrivNoninclusive::retry(Addr addr) {
             retryBuffer_.push_back(mshr_->getFrontEvent(addr));
             mshr_->addPendingRetry(addr);
         } else if (!(mshr_->pendingWriteback(addr))) {
-            std::list<Addr>* evictPointers = mshr_->getEvictPointers(addr);
-            for (std::list<Addr>::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
+            MSHREvictList* evictPointers = mshr_->getEvictPointers(addr);
+            for (MSHREvictList::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
                 MemEvent * ev = new MemEvent(cachename_, addr, *it, Command::NULLCMD);
                 retryBuffer_.push_back(ev);
             }
@@ -231,6 +231,7 @@ public:
         HashFunction * ht = createHashFunction(params);
         cacheArray_ = new CacheArray<PrivateCacheLine>(debug, lines, assoc, lineSize_, rmgr, ht);
         cacheArray_->setBanked(params.find<uint64_t>("banks", 0));
+        cacheArray_->setLayout(params.find<std::string>("array_layout", "map"));
 
         stat_evict[I] =      registerStatistic<uint64_t>("evict_I");
         stat_evict[S] =      registerStatistic<uint64_t>("evict_S");
@@ -480,6 +481,9 @@ public:
 
     //void printStatus(Output &out);
 
+    void checkpointArray(FILE* fp) { cacheArray_->checkpoint(fp); }
+    void restoreArray(FILE* fp) { cacheArray_->restore(fp); }
+
 private:
 
     MemEventStatus allocateLine(MemEvent * event, PrivateCacheLine*& line, bool inMSHR);
@@ -16,6 +16,7 @@
 #include <sst_config.h>
 #include <vector>
 #include "coherencemgr/MESI_Shared_Noninclusive.h"
+#include "coherencemgr/coherenceDebug.h"
 
 using namespace SST;
 using namespace SST::MemHierarchy;
@@ -2712,8 +2713,8 @@ void MESISharNoninclusive::cleanUpAfterRequest(MemEvent* event, bool inMSHR) {
             }
         } else { // Pointer -> either we're waiting for a writeback ACK or another address is waiting for this one
             if (mshr_->getFrontType(addr) == MSHREntryType::Evict && mshr_->getAcksNeeded(addr) == 0) {
-                std::list<Addr>* evictPointers = mshr_->getEvictPointers(addr);
-                for (std::list<Addr>::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
+                MSHREvictList* evictPointers = mshr_->getEvictPointers(addr);
+                for (MSHREvictList::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
                     MemEvent * ev = new MemEvent(cachename_, addr, *it, Command::NULLCMD);
                     retryBuffer_.push_back(ev);
                 }
@@ -2748,8 +2749,8 @@ void MESISharNoninclusive::cleanUpAfterResponse(MemEvent* event, bool inMSHR) {
             }
         } else {
             if (mshr_->getAcksNeeded(addr) == 0) {
-                std::list<Addr>* evictPointers = mshr_->getEvictPointers(addr);
-                for (std::list<Addr>::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
+                MSHREvictList* evictPointers = mshr_->getEvictPointers(addr);
+                for (MSHREvictList::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
                     MemEvent * ev = new MemEvent(cachename_, addr, *it, Command::NULLCMD);
                     retryBuffer_.push_back(ev);
                 }
@@ -2771,8 +2772,8 @@ void MESISharNoninclusive::retry(Addr addr) {
                     eventDI.reason = "retry";
             }
         } else if (!(mshr_->pendingWriteback(addr))) {
-            std::list<Addr>* evictPointers = mshr_->getEvictPointers(addr);
-            for (std::list<Addr>::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
+            MSHREvictList* evictPointers = mshr_->getEvictPointers(addr);
+            for (MSHREvictList::iterator it = evictPointers->begin(); it != evictPointers->end(); it++) {
                 MemEvent * ev = new MemEvent(cachename_, addr, *it, Command::NULLCMD);
                 retryBuffer_.push_back(ev);
             }
@@ -3185,6 +3186,7 @@ void MESISharNoninclusive::recordPrefetchResult(DirectoryLine * tag, Statistic<u
     if (tag->getPrefetch()) {
         stat->addData(1);
         tag->setPrefetch(false);
+        recordPrefetchOutcome(tag->getAddr(), stat == statPrefetchHit || stat == statPrefetchUpgradeMiss);
     }
 }
 
@@ -279,6 +279,7 @@ public:
         HashFunction * ht = createHashFunction(params);
         dataArray_ = new CacheArray<DataLine>(debug, lines, assoc, lineSize_, rmgr, ht);
         dataArray_->setBanked(params.find<uint64_t>("banks", 0));
+        dataArray_->setLayout(params.find<std::string>("array_layout", "map"));
 
         uint64_t dLines = params.find<uint64_t>("dlines");
         uint64_t dAssoc = params.find<uint64_t>("dassoc");
@@ -286,6 +287,7 @@ public:
         ReplacementPolicy *drmgr = createReplacementPolicy(dLines, dAssoc, params, false, 1);
         dirArray_ = new CacheArray<DirectoryLine>(debug, dLines, dAssoc, lineSize_, drmgr, ht);
         dirArray_->setBanked(params.find<uint64_t>("banks", 0));
+        dirArray_->setLayout(params.find<std::string>("array_layout", "map"));
 
         /* Statistics */
         stat_evict[I] =         registerStatistic<uint64_t>("evict_I");
@@ -17,6 +17,7 @@
 #include <sst_config.h>
 
 #include "coherencemgr/coherenceController.h"
+#include "coherencemgr/coherenceDebug.h"
 
 using namespace SST;
 using namespace SST::MemHierarchy;
@@ -34,6 +35,7 @@ CoherenceController::CoherenceController(ComponentId_t id, Params &params, Param
     dlevel = params.find<int>("debug_level", 1);
     if (params.find<int>("debug", SST::Output::NONE) == SST::Output::NONE)
         dlevel = 0;
+    debugTrace_ = dlevel >= 3;
 
     bool found;
 
@@ -83,6 +85,15 @@ CoherenceController::CoherenceController(ComponentId_t id, Params &params, Param
     dropPrefetchLevel_ = ((size_t) - 1);
     maxOutstandingPrefetch_ = ((size_t) - 2);
 
+    batchNotifications_ = false;
+    prefetchAccuracyWindow_ = 0;
+    prefetchAccuracyThreshold_ = 0;
+    prefetchThrottleInterval_ = 1;
+    prefetchUseful_ = 0;
+    prefetchOutcomes_ = 0;
+    prefetchThrottleCount_ = 0;
+    prefetchThrottled_ = false;
+
     // Get parent component's name
     cachename_ = getParentComponentName();
 
@@ -162,7 +173,7 @@ HashFunction* CoherenceController::createHashFunction(Params& params) {
     Params hparams;
     int hashFunc = params.find<int>("hash_function", 0);
     if (hashFunc == 1)  ht = loadAnonymousSubComponent<HashFunction>("memHierarchy.hash.linear", "hash", 0, ComponentInfo::SHARE_NONE, hparams);
-    if (hashFunc == 2)  ht = loadAnonymousSubComponent<HashFunction>("memHierarchy.hash.xor", "hash", 0, ComponentInfo::SHARE_NONE, hparams);
+    else if (hashFunc == 2)  ht = loadAnonymousSubComponent<HashFunction>("memHierarchy.hash.xor", "hash", 0, ComponentInfo::SHARE_NONE, hparams);
     else                ht = loadAnonymousSubComponent<HashFunction>("memHierarchy.hash.none", "hash", 0, ComponentInfo::SHARE_NONE, hparams);
 
     return ht;
@@ -310,6 +321,40 @@ bool CoherenceController::handleAckInv(MemEvent* event, bool inMSHR) {
     return false;
 }
 
+/* Dispatch table for the cache's processEvent, one lookup instead of a switch over every command */
+static std::array<CoherenceController::EventHandler, (int)Command::LAST_CMD> buildEventHandlers() {
+    std::array<CoherenceController::EventHandler, (int)Command::LAST_CMD> handlers;
+    handlers.fill(nullptr);
+    handlers[(int)Command::GetS] = &CoherenceController::handleGetS;
+    handlers[(int)Command::GetX] = &CoherenceController::handleGetX;
+    handlers[(int)Command::Write] = &CoherenceController::handleWrite;
+    handlers[(int)Command::GetSX] = &CoherenceController::handleGetSX;
+    handlers[(int)Command::FlushLine] = &CoherenceController::handleFlushLine;
+    handlers[(int)Command::FlushLineInv] = &CoherenceController::handleFlushLineInv;
+    handlers[(int)Command::GetSResp] = &CoherenceController::handleGetSResp;
+    handlers[(int)Command::WriteResp] = &CoherenceController::handleWriteResp;
+    handlers[(int)Command::GetXResp] = &CoherenceController::handleGetXResp;
+    handlers[(int)Command::FlushLineResp] = &CoherenceController::handleFlushLineResp;
+    handlers[(int)Command::PutS] = &CoherenceController::handlePutS;
+    handlers[(int)Command::PutX] = &CoherenceController::handlePutX;
+    handlers[(int)Command::PutE] = &CoherenceController::handlePutE;
+    handlers[(int)Command::PutM] = &CoherenceController::handlePutM;
+    handlers[(int)Command::FetchInv] = &CoherenceController::handleFetchInv;
+    handlers[(int)Command::FetchInvX] = &CoherenceController::handleFetchInvX;
+    handlers[(int)Command::ForceInv] = &CoherenceController::handleForceInv;
+    handlers[(int)Command::Inv] = &CoherenceController::handleInv;
+    handlers[(int)Command::Fetch] = &CoherenceController::handleFetch;
+    handlers[(int)Command::FetchResp] = &CoherenceController::handleFetchResp;
+    handlers[(int)Command::FetchXResp] = &CoherenceController::handleFetchXResp;
+    handlers[(int)Command::AckInv] = &CoherenceController::handleAckInv;
+    handlers[(int)Command::AckPut] = &CoherenceController::handleAckPut;
+    handlers[(int)Command::NACK] = &CoherenceController::handleNACK;
+    handlers[(int)Command::NULLCMD] = &CoherenceController::handleNULLCMD;
+    return handlers;
+}
+
+const std::array<CoherenceController::EventHandler, (int)Command::LAST_CMD> CoherenceController::eventHandlers_ = buildEventHandlers();
+
 bool CoherenceController::handleNULLCMD(MemEvent* event, bool inMSHR) {
     debug->fatal(CALL_INFO, -1, "%s, Error: NULLCMD events are not handled by this coherence manager. Event: %s. Time: %" PRIu64 "ns.\n",
             getName().c_str(), event->getVerboseString().c_str(), getCurrentSimTimeNano());
@@ -433,9 +478,9 @@ void CoherenceController::forwardByDestination(MemEventBase * event, Cycle_t ts)
     event->setSrc(cachename_);
     Response fwdReq = {event, ts, packetHeaderBytes + event->getPayloadSize()};
     
-    if (linkUp_->isReachable(event->getDst())) {
+    if (linkUp_->isReachable(event->getDstId())) {
         addToOutgoingQueueUp(fwdReq);
-    } else if (linkDown_->isReachable(event->getDst())) {
+    } else if (linkDown_->isReachable(event->getDstId())) {
         addToOutgoingQueue(fwdReq);
     } else {
         output->fatal(CALL_INFO, -1, "%s, Error: Destination %s appears unreachable on both links. Event: %s\n",
@@ -500,6 +545,11 @@ void CoherenceController::notifyListenerOfAccess(MemEvent * event, NotifyAccessT
     CacheListenerNotification notify(event->getAddr(), event->getBaseAddr(), event->getVirtualAddress(),
             event->getInstructionPointer(), event->getSize(), accessT, resultT);
 
+    if (batchNotifications_) {
+        pendingNotifications_.push_back(notify);
+        return;
+    }
+
     for (int i = 0; i < listeners_.size(); i++)
         listeners_[i]->notifyAccess(notify);
 }
@@ -508,12 +558,45 @@ void CoherenceController::notifyListenerOfAccess(MemEvent * event, NotifyAccessT
 void CoherenceController::notifyListenerOfEvict(Addr addr, uint32_t size, Addr ip) {
     CacheListenerNotification notify(addr, addr, 0, ip, size, EVICT, NA);
 
+    if (batchNotifications_) {
+        pendingNotifications_.push_back(notify);
+        return;
+    }
+
     for (int i = 0; i < listeners_.size(); i++) {
         listeners_[i]->notifyAccess(notify);
     }
 }
 
 
+void CoherenceController::flushListenerNotifications() {
+    if (pendingNotifications_.empty())
+        return;
+
+    for (int i = 0; i < listeners_.size(); i++)
+        listeners_[i]->notifyAccessBatch(pendingNotifications_.data(), pendingNotifications_.size());
+    pendingNotifications_.clear();
+}
+
+
+void CoherenceController::recordPrefetchOutcome(Addr addr, bool useful) {
+    for (int i = 0; i < listeners_.size(); i++)
+        listeners_[i]->notifyPrefetchResult(addr, useful);
+
+    if (prefetchAccuracyWindow_ == 0)
+        return;
+
+    prefetchOutcomes_++;
+    if (useful)
+        prefetchUseful_++;
+    if (prefetchOutcomes_ == prefetchAccuracyWindow_) {
+        prefetchThrottled_ = prefetchUseful_ < prefetchAccuracyThreshold_ * prefetchAccuracyWindow_;
+        prefetchOutcomes_ = 0;
+        prefetchUseful_ = 0;
+    }
+}
+
+
 /* Forward a message to a lower level (towards memory) in the hierarchy */
 uint64_t CoherenceController::forwardMessage(MemEvent * event, unsigned int requestSize, uint64_t baseTime, vector<uint8_t>* data, Command fwdCmd) {
     /* Create event to be forwarded */
@@ -687,7 +770,7 @@ void CoherenceController::printDebugInfo(dbgin * diStruct) {
 
     debug->debug(_L5_, "C: %-20" PRIu64 " %-20" PRIu64 " %-20s %-4s %-13s 0x%-16" PRIx64 " %-15s %-6s %-6s %-10s %-15s",
             getCurrentSimCycle(), timestamp_, cachename_.c_str(), thr.str().c_str(), cmd.c_str(), diStruct->addr,
-            id.str().c_str(), StateString[diStruct->oldst], StateString[diStruct->newst], diStruct->action.c_str(), reas.str().c_str());
+            id.str().c_str(), StateString[diStruct->oldst], StateString[diStruct->newst], diStruct->action, reas.str().c_str());
 
     debug->debug(_L6_, " %s", diStruct->verboseline.c_str());
     debug->debug(_L5_, "\n");
@@ -729,6 +812,14 @@ void CoherenceController::printDataValue(Addr addr, vector<uint8_t> * data, bool
     */
 }
 
+void CoherenceController::checkpointArray(FILE* UNUSED(fp)) {
+    output->fatal(CALL_INFO, -1, "%s, Error: this coherence protocol does not support checkpointing the cache array.\n", getName().c_str());
+}
+
+void CoherenceController::restoreArray(FILE* UNUSED(fp)) {
+    output->fatal(CALL_INFO, -1, "%s, Error: this coherence protocol does not support restoring the cache array from a checkpoint.\n", getName().c_str());
+}
+
 void CoherenceController::printStatus(Output& out) {
     out.output("  Begin MemHierarchy::CoherenceController %s\n", getName().c_str());
 
@@ -80,6 +80,10 @@ public:
     virtual bool handleFetchXResp(MemEvent * event, bool inMSHR);
     virtual bool handleNACK(MemEvent * event, bool inMSHR);
 
+    /* Handler for each command, indexed by Command. Null for commands that are not cache coherence events */
+    typedef bool (CoherenceController::*EventHandler)(MemEvent*, bool);
+    static EventHandler getEventHandler(Command cmd) { return eventHandlers_[(int)cmd]; }
+
 
     /*********************************************************************************
      * Send outgoing events
@@ -137,6 +141,27 @@ public:
         maxOutstandingPrefetch_ = maxOutPrefetches;
     }
 
+    /* Deliver listener notifications once per cycle instead of as they occur */
+    void setListenerBatching(bool batch) { batchNotifications_ = batch; }
+
+    /* Throttle prefetches while fewer than 'threshold' of the last 'window' prefetched lines were useful */
+    void setPrefetchThrottle(uint64_t window, double threshold, uint64_t interval) {
+        prefetchAccuracyWindow_ = window;
+        prefetchAccuracyThreshold_ = threshold;
+        prefetchThrottleInterval_ = interval ? interval : 1;
+    }
+
+    /* Send batched listener notifications, called by the cache at the end of each cycle */
+    void flushListenerNotifications();
+
+    /* Whether to drop the next prefetch because recent prefetches have been inaccurate */
+    bool throttlePrefetch() {
+        if (!prefetchThrottled_)
+            return false;
+        prefetchThrottleCount_++;
+        return (prefetchThrottleCount_ % prefetchThrottleInterval_) != 0;
+    }
+
     /* Set MSHR */
     void setMSHR(MSHR* ptr) { mshr_ = ptr; }
 
@@ -184,6 +209,10 @@ public:
     // Called by owner during printStatus/emergencyShutdown
     virtual void printStatus(Output &out);
 
+    // Save/restore the cache array for checkpoint warmup. Protocols that can't restore a consistent state don't implement these
+    virtual void checkpointArray(FILE* fp);
+    virtual void restoreArray(FILE* fp);
+
 protected:
 
     /*********************************************************************************
@@ -194,6 +223,9 @@ protected:
     virtual void notifyListenerOfAccess(MemEvent * event, NotifyAccessType accessT, NotifyResultType resultT);
     virtual void notifyListenerOfEvict(Addr addr, uint32_t size, uint64_t ip);
 
+    /* Record whether a prefetched line was used, for listeners and prefetch throttling */
+    void recordPrefetchOutcome(Addr addr, bool useful);
+
     /* Forward a message to a lower memory level (towards memory) */
     uint64_t forwardMessage(MemEvent * event, unsigned int requestSize, uint64_t baseTime, vector<uint8_t>* data, Command fwdCmd = Command::LAST_CMD);
 
@@ -211,20 +243,20 @@ protected:
         uint32_t thr;
         bool hasThr;
         Command cmd;
-        std::string mod; // Command modifier
+        const char* mod; // Command modifier
         Addr addr;
         State oldst;
         State newst;
-        std::string action;
+        const char* action;
         std::string reason;
         std::string verboseline;
 
-        void prefill(SST::Event::id_type i, Command c, std::string m, Addr a, State o) {
+        void prefill(SST::Event::id_type i, Command c, const char* m, Addr a, State o) {
             prefill(i, 0, c, m, a, o);
             hasThr = false;
         }
 
-        void prefill(SST::Event::id_type i, uint32_t t, Command c, std::string m, Addr a, State o) {
+        void prefill(SST::Event::id_type i, uint32_t t, Command c, const char* m, Addr a, State o) {
             id = i;
             thr = t;
             hasThr = true;
@@ -234,11 +266,11 @@ protected:
             oldst = o;
             newst = o;
             action = "";
-            reason = "";
-            verboseline = "";
+            reason.clear();
+            verboseline.clear();
         }
 
-        void fill(State n, std::string act, std::string rea) {
+        void fill(State n, const char* act, std::string rea) {
             newst = n;
             action = act;
             reason = rea;
@@ -266,6 +298,18 @@ protected:
     size_t dropPrefetchLevel_;
     size_t outstandingPrefetches_;
 
+    bool batchNotifications_;
+    std::vector<CacheListenerNotification> pendingNotifications_;
+
+    /* Prefetch accuracy feedback */
+    uint64_t prefetchAccuracyWindow_;   // Outcomes per accuracy sample, 0 disables throttling
+    double prefetchAccuracyThreshold_;
+    uint64_t prefetchThrottleInterval_; // While throttled, issue one of every this many prefetches
+    uint64_t prefetchUseful_;
+    uint64_t prefetchOutcomes_;
+    uint64_t prefetchThrottleCount_;
+    bool prefetchThrottled_;
+
     /* Cache name - used for identifying where events came from/are going to */
     std::string cachename_;
 
@@ -274,6 +318,7 @@ protected:
     Output* debug;  // Output stream for debug -> SST must be compiled with --enable-debug
     std::set<Addr> DEBUG_ADDR; // Addresses to print debug info for (all if empty)
     uint32_t dlevel;    // Debug level -> used to determine output format/amount of output
+    bool debugTrace_;   // Whether debug output is on at a level that prints event traces (see coherenceDebug.h)
 
     /* Latencies amd timing */
     uint64_t timestamp_;        // Local timestamp (cycles)
@@ -331,6 +376,8 @@ protected:
     std::set<std::string> cpus; // If connected to CPUs or other endpoints (e.g., accelerator), list of CPU names in case we need to broadcast something
 
 private:
+    static const std::array<EventHandler, (int)Command::LAST_CMD> eventHandlers_;
+
     /* Outgoing event queues - events are stalled here to account for access latencies */
     list<Response> outgoingEventQueueDown_;
     list<Response> outgoingEventQueueUp_;
@@ -0,0 +1,38 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+/*
+ * Debug macros for the coherence managers, include after the manager's header.
+ * These replace the util.h versions: a manager also checks debugTrace_, which is
+ * only set when the debug output is on at a level that prints event traces, so a
+ * --enable-debug build with debug off does not fill eventDI/evictDI or format
+ * trace strings for every event. Without --enable-debug they compile away.
+ */
+
+#ifndef MEMHIERARCHY_COHERENCEDEBUG_H
+#define MEMHIERARCHY_COHERENCEDEBUG_H
+
+#undef is_debug_addr
+#undef is_debug_event
+
+#ifdef __SST_DEBUG_OUTPUT__ /* From sst-core, enable with --enable-debug */
+#define is_debug_addr(addr) (debugTrace_ && (DEBUG_ADDR.empty() || DEBUG_ADDR.find(addr) != DEBUG_ADDR.end()))
+#define is_debug_event(ev) (debugTrace_ && (DEBUG_ADDR.empty() || ev->doDebug(DEBUG_ADDR)))
+#else
+#define is_debug_addr(addr) false
+#define is_debug_event(ev) false
+#endif
+
+#endif
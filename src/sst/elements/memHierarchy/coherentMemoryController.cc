@@ -73,7 +73,7 @@ void CoherentMemController::init(unsigned int phase) {
 void CoherentMemController::setup(void) {
     MemController::setup();
 
-    cacheStatus_.resize(memSize_/lineSize_, false); /* Initialize all cache status to false (uncached) */
+    cacheStatus_.resize(memSize_/lineSize_); /* All lines start uncached, pages of status are allocated as lines are cached */
 }
 
 
@@ -103,18 +103,16 @@ void CoherentMemController::processInitEvent(MemEventInit* me) {
  */
 bool CoherentMemController::clock(Cycle_t cycle) {
     timestamp_++;
+    statClockTicksExecuted_->addData(1);
 
     bool debug = false;
-    while (!msgQueue_.empty() && msgQueue_.begin()->first < timestamp_) {
-        MemEventBase * sendEv = msgQueue_.begin()->second;
-
+    msgQueue_.drain(timestamp_ - 1, [&](MemEventBase* sendEv) {
         if (is_debug_event(sendEv)) {
             Debug(_L3_, "E: %-20" PRIu64 " %-20" PRIu64 " %-20s Event:Send    (%s)\n",
                     getCurrentSimCycle(), getNextClockCycle(clockTimeBase_) - 1, getName().c_str(), sendEv->getVerboseString(dlevel).c_str());
         }
         link_->send(sendEv);
-        msgQueue_.erase(msgQueue_.begin());
-    }
+    });
 
     /* Unclock if nothing is in clocked queues anywhere (link, backend, here) */
     bool unclockLink = true;
@@ -123,8 +121,7 @@ bool CoherentMemController::clock(Cycle_t cycle) {
     bool unclockBack = memBackendConvertor_->clock(cycle); /* OK to unclock backend? */
 
     if (unclockLink && unclockBack && msgQueue_.empty()) {
-        memBackendConvertor_->turnClockOff();
-        clockOn_ = false;
+        turnClockOff(cycle);
         return true;
     }
 
@@ -199,7 +196,7 @@ void CoherentMemController::handleRequest(MemEvent * ev) {
     if (mshr_.find(ev->getBaseAddr()) == mshr_.end()) {
         mshr_.insert(std::make_pair(ev->getBaseAddr(), std::list<MSHREntry>(1, MSHREntry(ev->getID(), ev->getCmd()))));
         if (!ev->queryFlag(MemEventBase::F_NONCACHEABLE)) {
-            cacheStatus_.at(ev->getBaseAddr()/lineSize_) = true;
+            cacheStatus_.set(ev->getBaseAddr()/lineSize_, true);
         }
         if (is_debug_event(ev)) {
             Debug(_L4_, "B: %-20" PRIu64 " %-20" PRIu64 " %-20s Bkend:Send    (%s)\n",
@@ -236,7 +233,7 @@ void CoherentMemController::handleReplacement(MemEvent * ev) {
 
     /* Drop clean writebacks after updating the cache */
     if (!ev->getDirty()) {
-        cacheStatus_.at(ev->getBaseAddr()/lineSize_) = directory_; // If directory, writeback does not imply eviction
+        cacheStatus_.set(ev->getBaseAddr()/lineSize_, directory_); // If directory, writeback does not imply eviction
         delete ev;
         return;
     }
@@ -248,7 +245,7 @@ void CoherentMemController::handleReplacement(MemEvent * ev) {
 
     if (mshr_.find(ev->getBaseAddr()) == mshr_.end()) {
         mshr_.insert(std::make_pair(ev->getBaseAddr(), std::list<MSHREntry>(1, MSHREntry(ev->getID(), ev->getCmd()))));
-        cacheStatus_.at(ev->getBaseAddr()/lineSize_) = directory_;
+        cacheStatus_.set(ev->getBaseAddr()/lineSize_, directory_);
         if (is_debug_event(ev)) {
             Debug(_L4_, "B: %-20" PRIu64 " %-20" PRIu64 " %-20s Bkend:Send    (%s)\n",
                     getCurrentSimCycle(), getNextClockCycle(clockTimeBase_) - 1, getName().c_str(), 
@@ -349,7 +346,7 @@ void CoherentMemController::handleFlush(MemEvent * ev) {
     if (mshr_.find(ev->getBaseAddr()) == mshr_.end()) {
         mshr_.insert(std::make_pair(ev->getBaseAddr(), std::list<MSHREntry>(1, MSHREntry(ev->getID(), ev->getCmd()))));
         if (ev->getCmd() == Command::FlushLineInv) {
-            cacheStatus_.at(ev->getBaseAddr()/lineSize_) = false;
+            cacheStatus_.set(ev->getBaseAddr()/lineSize_, false);
             ev->setCmd(Command::FlushLine);
         }
         if (is_debug_event(put)) {
@@ -376,7 +373,7 @@ void CoherentMemController::handleAckInv(MemEvent * ev) {
     delete ev;
 
     /* Update cache status */
-    cacheStatus_.at(baseAddr/lineSize_) = false;
+    cacheStatus_.set(baseAddr/lineSize_, false);
 
     /* Look up request */
     MSHREntry * entry = &(mshr_.find(baseAddr)->second.front());
@@ -403,7 +400,7 @@ void CoherentMemController::handleFetchResp(MemEvent * ev) {
     Addr baseAddr = ev->getBaseAddr();
 
     /* Update cache status */
-    cacheStatus_.at(baseAddr/lineSize_) = false;
+    cacheStatus_.set(baseAddr/lineSize_, false);
 
     /* Look up request */
     MSHREntry * entry = &(mshr_.find(baseAddr)->second.front());
@@ -459,7 +456,7 @@ void CoherentMemController::handleNack(MemEvent * ev) {
         uint64_t backoff = (0x1 << retries);
         nackedEvent->incrementRetries();
 
-        msgQueue_.insert(std::make_pair(timestamp_ + backoff, nackedEvent));
+        msgQueue_.insert(timestamp_ + backoff, nackedEvent);
     } else {
         delete nackedEvent;
     }
@@ -508,13 +505,13 @@ void CoherentMemController::handleCustomCmd(MemEventBase * evb) {
  * Return whether shootdown was needed or not
  */
 bool CoherentMemController::doShootdown(Addr addr, MemEventBase * ev) {
-    if (cacheStatus_.at(addr/lineSize_) == true) {
+    if (cacheStatus_.test(addr/lineSize_)) {
         Addr globalAddr = translateToGlobal(addr);
         MemEvent * inv = new MemEvent(getName(), globalAddr, globalAddr, Command::FetchInv, lineSize_);
         inv->copyMetadata(ev);
         inv->setDst(ev->getSrc());
 
-        msgQueue_.insert(std::make_pair(timestamp_, inv)); /* Send on next clock. TODO timing needed? */
+        msgQueue_.insert(timestamp_, inv); /* Send on next clock. TODO timing needed? */
         return true;
     }
     return false;
@@ -687,16 +684,16 @@ void CoherentMemController::replayMemEvent(MemEvent * ev) {
         case Command::GetX:
         case Command::GetSX:
             if (!ev->queryFlag(MemEvent::F_NONCACHEABLE)) {
-                cacheStatus_.at(ev->getBaseAddr()/lineSize_) = true;
+                cacheStatus_.set(ev->getBaseAddr()/lineSize_, true);
             }
             memBackendConvertor_->handleMemEvent(ev);
             break;
         case Command::PutM:
-            cacheStatus_.at(ev->getBaseAddr()/lineSize_) = directory_;
+            cacheStatus_.set(ev->getBaseAddr()/lineSize_, directory_);
             memBackendConvertor_->handleMemEvent(ev);
             break;
         case Command::FlushLineInv:
-            cacheStatus_.at(ev->getBaseAddr()/lineSize_) = false;
+            cacheStatus_.set(ev->getBaseAddr()/lineSize_, false);
             ev->setCmd(Command::FlushLine);
         case Command::FlushLine:
             memBackendConvertor_->handleMemEvent(ev);
@@ -24,6 +24,9 @@
 
 #include <map>
 #include <list>
+#include <memory>
+#include <stdexcept>
+#include <vector>
 
 #include "sst/elements/memHierarchy/memoryController.h"
 #include "sst/elements/memHierarchy/memEvent.h"
@@ -31,10 +34,56 @@
 #include "sst/elements/memHierarchy/cacheListener.h"
 #include "sst/elements/memHierarchy/memLinkBase.h"
 #include "sst/elements/memHierarchy/membackend/backing.h"
+#include "sst/elements/memHierarchy/timingWheel.h"
 
 namespace SST {
 namespace MemHierarchy {
 
+/*
+ * One bit per line of memory, allocated a page of bits at a time the first time a
+ * line in the page is set. Lines that are never cached cost nothing, so a large
+ * memory does not need its whole bitmap at startup.
+ */
+class LineBitmap {
+public:
+    void resize(size_t lines) {
+        lines_ = lines;
+        pages_.resize((lines + PageBits - 1) / PageBits);
+    }
+
+    bool test(size_t line) const {
+        check(line);
+        const std::unique_ptr<uint64_t[]>& page = pages_[line / PageBits];
+        if (!page) return false;
+        return (page[(line % PageBits) / 64] >> (line % 64)) & 1;
+    }
+
+    void set(size_t line, bool value) {
+        check(line);
+        std::unique_ptr<uint64_t[]>& page = pages_[line / PageBits];
+        if (!page) {
+            if (!value) return;
+            page.reset(new uint64_t[PageBits / 64]());
+        }
+        uint64_t& word = page[(line % PageBits) / 64];
+        if (value)
+            word |= (uint64_t)1 << (line % 64);
+        else
+            word &= ~((uint64_t)1 << (line % 64));
+    }
+
+private:
+    static const size_t PageBits = 1 << 16;
+
+    void check(size_t line) const {
+        if (line >= lines_)
+            throw std::out_of_range("LineBitmap: line out of range");
+    }
+
+    size_t lines_ = 0;
+    std::vector<std::unique_ptr<uint64_t[]> > pages_;
+};
+
 class CoherentMemController : public MemController {
 public:
 /* Element Library Info */
@@ -47,6 +96,8 @@ public:
 
     SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS( MEMCONTROLLER_ELI_SUBCOMPONENTSLOTS )
 
+    SST_ELI_DOCUMENT_STATISTICS( MEMCONTROLLER_ELI_STATISTICS )
+
 /* Begin class definition */
     typedef uint64_t ReqId;
 
@@ -93,11 +144,11 @@ private:
 
     // Outgoing event handling
     Cycle_t timestamp_;
-    std::multimap<uint64_t, MemEventBase*> msgQueue_;
+    TimingWheel<MemEventBase*> msgQueue_;
 
     // Caching information
     bool directory_; /* Whether directory is above us, i.e., whether a PutM indicates block is no longer cached or not */
-    std::vector<bool> cacheStatus_;
+    LineBitmap cacheStatus_;
     Addr lineSize_;
 
     // MSHR
@@ -0,0 +1,170 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _MEMHIERARCHY_RANGECUSTOMCMD_H_
+#define _MEMHIERARCHY_RANGECUSTOMCMD_H_
+
+#include <sstream>
+#include <utility>
+#include <vector>
+
+#include <sst/core/interfaces/stdMem.h>
+
+#include "sst/elements/memHierarchy/memTypes.h"
+
+namespace SST {
+namespace MemHierarchy {
+
+/*
+ * A custom command that operates on a whole region of memory at the
+ * memory controller, so that a CPU can send one request instead of one
+ * per element.
+ *
+ * The region is 'count' elements of 'elemSize' (1, 2, 4 or 8) bytes.
+ * Element i of an operand is at base + i * stride, stride defaulting to
+ * elemSize (a dense region). If indices are given, element i is at
+ * base + indices[i] * stride instead, for the operand being read by Memcpy,
+ * ReduceAdd and ScanAdd (a gather) and the operand being written by Memset
+ * (a scatter).
+ *
+ *  Memset:    every dst element = value
+ *  Memcpy:    dst element i = src element i
+ *  ReduceAdd: result = sum of the src elements
+ *  ScanAdd:   dst element i = src element 0 + ... + src element i, result = the total
+ *
+ * Elements are little-endian unsigned integers and sums wrap at elemSize.
+ * Executed by memHierarchy.rangeCustomCmdHandler; the memory backend is
+ * charged one request per backend burst the command touches.
+ */
+class RangeCustomData : public Interfaces::StandardMem::CustomData {
+public:
+    enum class Op { Memset, Memcpy, ReduceAdd, ScanAdd };
+
+    RangeCustomData(Op op, Addr dst, Addr src, uint32_t elemSize, uint64_t count, uint64_t value = 0, bool posted = false) :
+        CustomData(), op_(op), dst_(dst), src_(src), elemSize_(elemSize), count_(count),
+        dstStride_(elemSize), srcStride_(elemSize), value_(value), result_(0), posted_(posted) { }
+
+    virtual ~RangeCustomData() { }
+
+    /* Send to the controller that owns the region being written (or read, for a reduction) */
+    virtual Addr getRoutingAddress() override { return op_ == Op::ReduceAdd ? src_ : dst_; }
+
+    /* A command message plus its index list */
+    virtual uint64_t getSize() override { return 8 + 8 * indices_.size(); }
+
+    virtual CustomData* makeResponse() override { return new RangeCustomData(*this); }
+
+    virtual bool needsResponse() override { return !posted_; }
+
+    virtual std::string getString() override {
+        std::ostringstream str;
+        static const char* opNames[] = { "Memset", "Memcpy", "ReduceAdd", "ScanAdd" };
+        str << " Op: " << opNames[(int)op_];
+        str << std::hex << " Dst: 0x" << dst_ << " Src: 0x" << src_;
+        str << std::dec << " ElemSize: " << elemSize_ << " Count: " << count_;
+        str << " DstStride: " << dstStride_ << " SrcStride: " << srcStride_;
+        str << " Indices: " << indices_.size() << " Value: " << value_ << " Result: " << result_;
+        return str.str();
+    }
+
+    void setStrides(uint64_t dstStride, uint64_t srcStride) { dstStride_ = dstStride; srcStride_ = srcStride; }
+    void setIndices(const std::vector<uint64_t>& indices) { indices_ = indices; }
+
+    Op getOp() { return op_; }
+    Addr getDst() { return dst_; }
+    Addr getSrc() { return src_; }
+    uint32_t getElemSize() { return elemSize_; }
+    uint64_t getCount() { return count_; }
+    uint64_t getDstStride() { return dstStride_; }
+    uint64_t getSrcStride() { return srcStride_; }
+    const std::vector<uint64_t>& getIndices() { return indices_; }
+    uint64_t getValue() { return value_; }
+
+    /* Result of a ReduceAdd or ScanAdd, valid in the response */
+    uint64_t getResult() { return result_; }
+    void setResult(uint64_t result) { result_ = result; }
+
+    bool readsSrc() { return op_ != Op::Memset; }
+    bool writesDst() { return op_ != Op::ReduceAdd; }
+    bool dstIndexed() { return op_ == Op::Memset && !indices_.empty(); }
+    bool srcIndexed() { return op_ != Op::Memset && !indices_.empty(); }
+
+    Addr dstAddr(uint64_t i) { return dst_ + (dstIndexed() ? indices_[i] : i) * dstStride_; }
+    Addr srcAddr(uint64_t i) { return src_ + (srcIndexed() ? indices_[i] : i) * srcStride_; }
+
+    /*
+     * The burst-aligned accesses the command makes, reads of the source
+     * first and then writes of the destination, as (address, isWrite).
+     * Consecutive elements in the same burst share it; a gather that comes
+     * back to a burst later pays for it again.
+     */
+    void getBursts(uint32_t width, std::vector<std::pair<Addr,bool> >& bursts) {
+        if (readsSrc()) addBursts(width, false, bursts);
+        if (writesDst()) addBursts(width, true, bursts);
+    }
+
+    /* Serialization */
+    // Must be serializable so that CustomMemEvent can be serialized
+    void serialize_order(SST::Core::Serialization::serializer& ser) override {
+        ser & op_;
+        ser & dst_;
+        ser & src_;
+        ser & elemSize_;
+        ser & count_;
+        ser & dstStride_;
+        ser & srcStride_;
+        ser & indices_;
+        ser & value_;
+        ser & result_;
+        ser & posted_;
+    }
+    ImplementSerializable(SST::MemHierarchy::RangeCustomData);
+
+protected:
+    RangeCustomData() { } /* For serialization only */
+
+private:
+    void addBursts(uint32_t width, bool write, std::vector<std::pair<Addr,bool> >& bursts) {
+        bool have = false;
+        Addr last = 0;
+        for (uint64_t i = 0; i < count_; i++) {
+            Addr addr = write ? dstAddr(i) : srcAddr(i);
+            // An element may straddle two bursts
+            for (Addr burst = addr - (addr % width); burst < addr + elemSize_; burst += width) {
+                if (have && burst == last) continue;
+                bursts.push_back(std::make_pair(burst, write));
+                last = burst;
+                have = true;
+            }
+        }
+    }
+
+    Op op_;
+    Addr dst_;
+    Addr src_;
+    uint32_t elemSize_;
+    uint64_t count_;
+    uint64_t dstStride_;
+    uint64_t srcStride_;
+    std::vector<uint64_t> indices_;
+    uint64_t value_;
+    uint64_t result_;
+    bool posted_;
+};
+
+} //namespace MemHierarchy
+} //namespace SST
+
+#endif
@@ -0,0 +1,153 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include <sst_config.h>
+
+#include "customcmd/rangeCustomCmdHandler.h"
+#include "memEventCustom.h"
+
+using namespace std;
+using namespace SST;
+using namespace SST::MemHierarchy;
+
+RangeCustomCmdMemHandler::RangeCustomCmdMemHandler(ComponentId_t id, Params &params, std::function<void(Addr,size_t,std::vector<uint8_t>&)> read, std::function<void(Addr,std::vector<uint8_t>*)> write)
+    : CustomCmdMemHandler(id, params, read, write) {
+    stat_rangeCommands = registerStatistic<uint64_t>("range_commands");
+    stat_rangeElements = registerStatistic<uint64_t>("range_elements");
+}
+
+CustomCmdMemHandler::MemEventInfo RangeCustomCmdMemHandler::receive(MemEventBase* ev){
+    CustomMemEvent * cme = static_cast<CustomMemEvent*>(ev);
+    RangeCustomData * cmd = dynamic_cast<RangeCustomData*>(cme->getCustomData());
+    if (cmd) {
+        uint32_t size = cmd->getElemSize();
+        if (size != 1 && size != 2 && size != 4 && size != 8) {
+            dbg.fatal(CALL_INFO, -1, "%s, Error: range command element size must be 1, 2, 4, or 8 bytes. Command: %s\n",
+                    getName().c_str(), cmd->getString().c_str());
+        }
+        if (!cmd->getIndices().empty() && cmd->getIndices().size() != cmd->getCount()) {
+            dbg.fatal(CALL_INFO, -1, "%s, Error: range command has %zu indices for %" PRIu64 " elements. Command: %s\n",
+                    getName().c_str(), cmd->getIndices().size(), cmd->getCount(), cmd->getString().c_str());
+        }
+    }
+    CustomCmdMemHandler::MemEventInfo MEI(ev->getRoutingAddress(),true);
+    return MEI;
+}
+
+Interfaces::StandardMem::CustomData* RangeCustomCmdMemHandler::ready(MemEventBase* ev){
+    CustomMemEvent * cme = static_cast<CustomMemEvent*>(ev);
+    return cme->getCustomData();
+}
+
+MemEventBase* RangeCustomCmdMemHandler::finish(MemEventBase *ev, uint32_t flags){
+    CustomMemEvent * cme = static_cast<CustomMemEvent*>(ev);
+    RangeCustomData * cmd = dynamic_cast<RangeCustomData*>(cme->getCustomData());
+    if (cmd)
+        execute(cmd);
+
+    if(ev->queryFlag(MemEventBase::F_NORESPONSE)||
+         ((flags & MemEventBase::F_NORESPONSE)>0)){
+        // posted request
+        // We need to delete the CustomData structure
+        if (cme->getCustomData() != nullptr)
+            delete cme->getCustomData();
+        cme->setCustomData(nullptr); // Just in case someone attempts to access it...
+        return nullptr;
+    }
+
+    MemEventBase *MEB = ev->makeResponse();
+    return MEB;
+}
+
+void RangeCustomCmdMemHandler::execute(RangeCustomData* cmd) {
+    uint32_t size = cmd->getElemSize();
+    uint64_t count = cmd->getCount();
+    uint64_t mask = size == 8 ? ~0ULL : (1ULL << (8 * size)) - 1;
+
+    std::vector<uint8_t> data;
+    uint64_t sum = 0;
+
+    switch (cmd->getOp()) {
+        case RangeCustomData::Op::Memset:
+            data.resize(count * size);
+            for (uint64_t i = 0; i < count; i++) {
+                for (uint32_t b = 0; b < size; b++)
+                    data[i * size + b] = (cmd->getValue() >> (8 * b)) & 0xff;
+            }
+            scatter(cmd, true, data);
+            break;
+        case RangeCustomData::Op::Memcpy:
+            gather(cmd, false, data);
+            scatter(cmd, true, data);
+            break;
+        case RangeCustomData::Op::ReduceAdd:
+        case RangeCustomData::Op::ScanAdd:
+            gather(cmd, false, data);
+            for (uint64_t i = 0; i < count; i++) {
+                uint64_t elem = 0;
+                for (uint32_t b = 0; b < size; b++)
+                    elem |= (uint64_t)data[i * size + b] << (8 * b);
+                sum = (sum + elem) & mask;
+                for (uint32_t b = 0; b < size; b++)
+                    data[i * size + b] = (sum >> (8 * b)) & 0xff;
+            }
+            if (cmd->getOp() == RangeCustomData::Op::ScanAdd)
+                scatter(cmd, true, data);
+            cmd->setResult(sum);
+            break;
+    }
+
+    stat_rangeCommands->addData(1);
+    stat_rangeElements->addData(count);
+}
+
+void RangeCustomCmdMemHandler::gather(RangeCustomData* cmd, bool dst, std::vector<uint8_t>& data) {
+    uint32_t size = cmd->getElemSize();
+    uint64_t count = cmd->getCount();
+    bool indexed = dst ? cmd->dstIndexed() : cmd->srcIndexed();
+    uint64_t stride = dst ? cmd->getDstStride() : cmd->getSrcStride();
+
+    if (!indexed && stride == size) {
+        readData(dst ? cmd->getDst() : cmd->getSrc(), count * size, data);
+        return;
+    }
+
+    data.resize(count * size);
+    std::vector<uint8_t> elem;
+    for (uint64_t i = 0; i < count; i++) {
+        readData(dst ? cmd->dstAddr(i) : cmd->srcAddr(i), size, elem);
+        std::copy(elem.begin(), elem.end(), data.begin() + i * size);
+    }
+}
+
+void RangeCustomCmdMemHandler::scatter(RangeCustomData* cmd, bool dst, std::vector<uint8_t>& data) {
+    uint32_t size = cmd->getElemSize();
+    uint64_t count = cmd->getCount();
+    bool indexed = dst ? cmd->dstIndexed() : cmd->srcIndexed();
+    uint64_t stride = dst ? cmd->getDstStride() : cmd->getSrcStride();
+
+    if (!indexed && stride == size) {
+        writeData(dst ? cmd->getDst() : cmd->getSrc(), &data);
+        return;
+    }
+
+    std::vector<uint8_t> elem(size);
+    for (uint64_t i = 0; i < count; i++) {
+        std::copy(data.begin() + i * size, data.begin() + (i + 1) * size, elem.begin());
+        writeData(dst ? cmd->dstAddr(i) : cmd->srcAddr(i), &elem);
+    }
+}
+
+// EOF
@@ -0,0 +1,77 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _MEMHIERARCHY_RANGECUSTOMCMDHANDLER_H_
+#define _MEMHIERARCHY_RANGECUSTOMCMDHANDLER_H_
+
+#include <string>
+
+#include <sst/core/event.h>
+#include <sst/core/output.h>
+#include <sst/core/subcomponent.h>
+#include <sst/core/interfaces/stdMem.h>
+
+#include "sst/elements/memHierarchy/memEventBase.h"
+#include "sst/elements/memHierarchy/customcmd/customCmdMemory.h"
+#include "sst/elements/memHierarchy/customcmd/rangeCustomCmd.h"
+
+namespace SST {
+namespace MemHierarchy {
+
+/*
+ * Custom command handler for near-memory range operations (RangeCustomData).
+ * The backend times the command as the bursts it touches; when the last
+ * burst returns the operation is applied to the backing store in one pass.
+ * Other custom commands are passed to the backend unchanged, as
+ * defCustomCmdHandler does.
+ */
+class RangeCustomCmdMemHandler : public CustomCmdMemHandler {
+public:
+/* Element Library Info */
+    SST_ELI_REGISTER_SUBCOMPONENT(RangeCustomCmdMemHandler, "memHierarchy", "rangeCustomCmdHandler", SST_ELI_ELEMENT_VERSION(1,0,0),
+            "Custom command handler that executes memset, memcpy, reduction and scan commands over memory regions", SST::MemHierarchy::CustomCmdMemHandler)
+
+    SST_ELI_DOCUMENT_STATISTICS(
+        {"range_commands",  "Number of range commands executed", "count", 1},
+        {"range_elements",  "Number of elements operated on by range commands", "count", 1}
+    )
+
+/* Begin class defintion */
+
+  RangeCustomCmdMemHandler(ComponentId_t id, Params &params, std::function<void(Addr,size_t,std::vector<uint8_t>&)> read, std::function<void(Addr,std::vector<uint8_t>*)> write);
+
+  ~RangeCustomCmdMemHandler() {}
+
+  CustomCmdMemHandler::MemEventInfo receive(MemEventBase* ev) override;
+
+  Interfaces::StandardMem::CustomData* ready(MemEventBase* ev) override;
+
+  MemEventBase* finish(MemEventBase *ev, uint32_t flags) override;
+
+protected:
+private:
+    void execute(RangeCustomData* cmd);
+
+    /* Read or write the elements of one operand, as one access if they are dense */
+    void gather(RangeCustomData* cmd, bool dst, std::vector<uint8_t>& data);
+    void scatter(RangeCustomData* cmd, bool dst, std::vector<uint8_t>& data);
+
+    Statistic<uint64_t>* stat_rangeCommands;
+    Statistic<uint64_t>* stat_rangeElements;
+};    // class RangeCustomCmdMemHandler
+}     // namespace MemHierarchy
+}     // namespace SST
+
+#endif
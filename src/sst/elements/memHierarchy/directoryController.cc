@@ -15,6 +15,7 @@
 
 #include <sst_config.h>
 #include "directoryController.h"
+#include <algorithm>
 
 
 #include <sst/core/params.h>
@@ -224,6 +225,7 @@ DirectoryController::DirectoryController(ComponentId_t id, Params &params) :
 
     // Timestamp - aka cycle count
     timestamp = 0;
+    lastActiveClockCycle = 0;
 
     // Coherence protocol configuration
     waitWBAck = false; // Don't expect WB Acks
@@ -293,6 +295,8 @@ DirectoryController::DirectoryController(ComponentId_t id, Params &params) :
     stat_dirEntryReads              = registerStatistic<uint64_t>("eventSent_read_directory_entry");
     stat_dirEntryWrites             = registerStatistic<uint64_t>("eventSent_write_directory_entry");
     stat_MSHROccupancy              = registerStatistic<uint64_t>("MSHR_occupancy");
+    stat_clockTicksExecuted         = registerStatistic<uint64_t>("clock_ticks_executed");
+    stat_clockTicksSkipped          = registerStatistic<uint64_t>("clock_ticks_skipped");
 
     // Coherence part
 
@@ -301,7 +305,6 @@ DirectoryController::DirectoryController(ComponentId_t id, Params &params) :
 
     // TODO implement the cache properly using the cacheArray
     entryCacheMaxSize = params.find<uint64_t>("entry_cache_size", 32768);
-    entryCacheSize = 0;
     entrySize = 4; // Bytes, TODO parameterize
 
     string protstr  = params.find<std::string>("coherence_protocol", "MESI");
@@ -316,6 +319,11 @@ DirectoryController::DirectoryController(ComponentId_t id, Params &params) :
     /* Get latencies */
     accessLatency   = params.find<uint64_t>("access_latency_cycles", 0);
     mshrLatency     = params.find<uint64_t>("mshr_latency_cycles", 0);
+
+    /* Size the outgoing queues so that messages delayed by either latency skip the overflow map */
+    size_t wheelSlots = std::max(accessLatency, mshrLatency) + 2;
+    cpuMsgQueue = TimingWheel<MemEventBase*>(wheelSlots);
+    memMsgQueue = TimingWheel<MemMsg>(wheelSlots);
 }
 
 
@@ -325,6 +333,8 @@ DirectoryController::~DirectoryController(){
         delete i->second;
     }
     directory.clear();
+    for (std::vector<DirEntry*>::iterator it = freeDirEntries.begin(); it != freeDirEntries.end(); it++)
+        delete *it;
 }
 
 
@@ -363,6 +373,7 @@ void DirectoryController::handlePacket(SST::Event *event){
  */
 bool DirectoryController::clock(SST::Cycle_t cycle){
     timestamp = cycle;
+    stat_clockTicksExecuted->addData(1);
     stat_MSHROccupancy->addData(mshr->getSize());
 
     sendOutgoingEvents();
@@ -377,43 +388,37 @@ bool DirectoryController::clock(SST::Cycle_t cycle){
 
     addrsThisCycle.clear();
 
-    size_t entries = retryBuffer.size();
-
-    std::list<MemEvent*>::iterator it = retryBuffer.begin();
-    while (it != retryBuffer.end()) {
+    retryBuffer.scan([&](MemEvent* ev) {
         if (maxRequestsPerCycle != 0 && requestsThisCycle == maxRequestsPerCycle) {
-            break;
+            return MemEventBuffer<MemEvent*>::Scan::Stop;
         }
 #ifdef __SST_DEBUG_OUTPUT__
         dbg.debug(_L3_, "E: %-20" PRIu64 " %-20" PRIu64 " %-20s Event:Retry   (%s)\n",
-                getCurrentSimCycle(), timestamp, getName().c_str(), (*it)->getVerboseString(dlevel).c_str());
+                getCurrentSimCycle(), timestamp, getName().c_str(), ev->getVerboseString(dlevel).c_str());
 #endif
         
-        if (processPacket(*it, true)) {
+        if (processPacket(ev, true)) {
             requestsThisCycle++;
-            it = retryBuffer.erase(it);
-        } else {
-            it++;
+            return MemEventBuffer<MemEvent*>::Scan::Remove;
         }
-    }
+        return MemEventBuffer<MemEvent*>::Scan::Keep;
+    });
 
-    it = eventBuffer.begin();
-    while (it != eventBuffer.end()) {
+    eventBuffer.scan([&](MemEvent* ev) {
         if (maxRequestsPerCycle != 0 && requestsThisCycle == maxRequestsPerCycle)
-            break;
+            return MemEventBuffer<MemEvent*>::Scan::Stop;
 
 #ifdef __SST_DEBUG_OUTPUT__
         dbg.debug(_L3_, "E: %-20" PRIu64 " %-20" PRIu64 " %-20s Event:New     (%s)\n",
-                getCurrentSimCycle(), timestamp, getName().c_str(), (*it)->getVerboseString(dlevel).c_str());
+                getCurrentSimCycle(), timestamp, getName().c_str(), ev->getVerboseString(dlevel).c_str());
 #endif
 
-        if (processPacket(*it, false)) {
+        if (processPacket(ev, false)) {
             requestsThisCycle++;
-            it = eventBuffer.erase(it);
-        } else {
-            it++;
+            return MemEventBuffer<MemEvent*>::Scan::Remove;
         }
-    }
+        return MemEventBuffer<MemEvent*>::Scan::Keep;
+    });
 
     idle &= (eventBuffer.empty() && retryBuffer.empty());
     idle &= (cpuMsgQueue.empty() && memMsgQueue.empty());
@@ -552,7 +557,7 @@ bool DirectoryController::arbitrateAccess(Addr addr) {
 
 void DirectoryController::handleNoncacheableRequest(MemEventBase * ev) {
     if (!(ev->queryFlag(MemEventBase::F_NORESPONSE))) {
-        noncacheMemReqs[ev->getID()] = ev->getSrc();
+        noncacheMemReqs[ev->getID()] = ev->getSrcId();
     }
     stat_noncacheRecv[(int)ev->getCmd()]->addData(1);
 
@@ -566,7 +571,7 @@ void DirectoryController::handleNoncacheableResponse(MemEventBase * ev) {
         dbg.fatal(CALL_INFO, -1, "%s, Error: Received a noncacheable response that does not match a pending request. Event: %s\n. Time: %" PRIu64 "ns\n",
                 getName().c_str(), ev->getVerboseString(dlevel).c_str(), getCurrentSimTimeNano());
     }
-    ev->setDst(noncacheMemReqs[ev->getID()]);
+    ev->setDstId(noncacheMemReqs[ev->getID()]);
     ev->setSrc(getName());
 
     stat_noncacheRecv[(int)ev->getCmd()]->addData(1);
@@ -578,7 +583,7 @@ void DirectoryController::handleNoncacheableResponse(MemEventBase * ev) {
 
 void DirectoryController::printStatus(Output &statusOut) {
     statusOut.output("MemHierarchy::DirectoryController %s\n", getName().c_str());
-    statusOut.output("  Cached entries: %" PRIu64 "\n", entryCacheSize);
+    statusOut.output("  Cached entries: %" PRIu64 "\n", entryCache.size());
     statusOut.output("  Requests waiting to be handled:  %zu\n", eventBuffer.size());
 //    for(std::list<std::pair<MemEvent*,bool> >::iterator i = workQueue.begin() ; i != workQueue.end() ; ++i){
 //        statusOut.output("    %s, %s\n", i->first->getVerboseString(dlevel).c_str(), i->second ? "replay" : "new");
@@ -601,7 +606,7 @@ void DirectoryController::printStatus(Output &statusOut) {
 
     statusOut.output("  Directory entries:\n");
     for (std::unordered_map<Addr, DirEntry*>::iterator it = directory.begin(); it != directory.end(); it++) {
-        statusOut.output("    0x%" PRIx64 " %s\n", it->first, it->second->getString().c_str());
+        statusOut.output("    0x%" PRIx64 " %s\n", it->first, getEntryString(it->second).c_str());
     }
     statusOut.output("End MemHierarchy::DirectoryController\n\n");
 }
@@ -629,6 +634,8 @@ void DirectoryController::turnClockOn() {
     timestamp--; // reregisterClock returns next cycle clock will be enabled, set timestamp to current cycle
     uint64_t inactiveCycles = timestamp - lastActiveClockCycle;
     stat_MSHROccupancy->addDataNTimes(inactiveCycles, mshr->getSize());
+    if (timestamp > lastActiveClockCycle)
+        stat_clockTicksSkipped->addData(inactiveCycles);
 }
 
 
@@ -656,7 +663,7 @@ void DirectoryController::init(unsigned int phase) {
                 if (mEv->getType() == Endpoint::Scratchpad)
                     waitWBAck = true;
                 if (!(mEv->getTracksPresence()) && cpuLink->isSource(mEv->getSrc())) {
-                    incoherentSrc.insert(mEv->getSrc());
+                    incoherentSrc.insert(mEv->getSrcId());
                 }
             } else if (ev->getInitCmd() == MemEventInit::InitCommand::Endpoint) {
                 MemEventInit * mEv = ev->clone();
@@ -736,7 +743,7 @@ bool DirectoryController::handleGetS(MemEvent * event, bool inMSHR) {
         bool ret = retrieveDirEntry(entry, event, inMSHR); 
         if (is_debug_addr(addr)) {
             eventDI.newst = entry->getState();
-            eventDI.verboseline = entry->getString();
+            eventDI.verboseline = getEntryString(entry);
         }
         return ret;
     }
@@ -753,16 +760,16 @@ bool DirectoryController::handleGetS(MemEvent * event, bool inMSHR) {
                 if (!inMSHR)
                     out.output("ALERT (%s): mshr should NOT have data for 0x%" PRIx64 " but it does...\n", getName().c_str(), addr);
                 else {
-                    if (incoherentSrc.find(event->getSrc()) != incoherentSrc.end()) {
+                    if (incoherentSrc.find(event->getSrcId()) != incoherentSrc.end()) {
                         sendDataResponse(event, entry, mshr->getData(addr), Command::GetSResp);
                     } else if (protocol == CoherenceProtocol::MESI) {
                         entry->setState(M);
-                        entry->setOwner(event->getSrc());
+                        entry->setOwner(event->getSrcId());
                         sendDataResponse(event, entry, mshr->getData(addr), Command::GetXResp);
                         mshr->clearData(addr);
                     } else {
                         entry->setState(S);
-                        entry->addSharer(event->getSrc());
+                        entry->addSharer(getSharerIndex(event->getSrcId()));
                         sendDataResponse(event, entry, mshr->getData(addr), Command::GetSResp);
                     }
                     if (is_debug_event(event)) {
@@ -784,8 +791,8 @@ bool DirectoryController::handleGetS(MemEvent * event, bool inMSHR) {
             break;
         case S:
             if (mshr->hasData(addr)) { // saved from earlier request
-                if (incoherentSrc.find(event->getSrc()) == incoherentSrc.end()) {
-                    entry->addSharer(event->getSrc());
+                if (incoherentSrc.find(event->getSrcId()) == incoherentSrc.end()) {
+                    entry->addSharer(getSharerIndex(event->getSrcId()));
                 }
                 sendDataResponse(event, entry, mshr->getData(addr), Command::GetSResp);
                 if (is_debug_event(event)) {
@@ -822,7 +829,7 @@ bool DirectoryController::handleGetS(MemEvent * event, bool inMSHR) {
 
     if (is_debug_addr(addr)) {
         eventDI.newst = entry->getState();
-        eventDI.verboseline = entry->getString();
+        eventDI.verboseline = getEntryString(entry);
     }
 
     return true;
@@ -848,7 +855,7 @@ bool DirectoryController::handleGetX(MemEvent * event, bool inMSHR) {
         bool ret = retrieveDirEntry(entry, event, inMSHR); 
         if (is_debug_addr(addr)) {
             eventDI.newst = entry->getState();
-            eventDI.verboseline = entry->getString();
+            eventDI.verboseline = getEntryString(entry);
         }
         return ret;
     }
@@ -865,9 +872,9 @@ bool DirectoryController::handleGetX(MemEvent * event, bool inMSHR) {
                 if (!inMSHR) {
                     out.output("ALERT (%s): mshr should NOT have data for 0x%" PRIx64 " but it does...\n", getName().c_str(), addr);
                 } else {
-                    if (incoherentSrc.find(event->getSrc()) == incoherentSrc.end()) {
+                    if (incoherentSrc.find(event->getSrcId()) == incoherentSrc.end()) {
                         entry->setState(M);
-                        entry->setOwner(event->getSrc());
+                        entry->setOwner(event->getSrcId());
                     }
                     sendDataResponse(event, entry, mshr->getData(addr), Command::GetXResp);
                     mshr->clearData(addr);
@@ -892,13 +899,13 @@ bool DirectoryController::handleGetX(MemEvent * event, bool inMSHR) {
             // Upgrade request and no other sharers -> respond & M
             // Upgrade request and other sharers -> invalidate other sharers & S_Inv
             // Otherwise need data & invalidate sharers -> invalidate other sharers, request data from Memory, SM_Inv
-            if (entry->isSharer(event->getSrc())) { // Don't need data
+            if (entry->isSharer(getSharerIndex(event->getSrcId()))) { // Don't need data
                 if (entry->getSharerCount() == 1) { // Also don't need to invalidate
                     if (mshr->hasData(addr))
                         mshr->clearData(addr);
                     entry->setState(M);
-                    entry->removeSharer(event->getSrc());
-                    entry->setOwner(event->getSrc());
+                    entry->removeSharer(getSharerIndex(event->getSrcId()));
+                    entry->setOwner(event->getSrcId());
                     sendResponse(event);
                     if (is_debug_event(event)) {
                         eventDI.reason = "hit";
@@ -951,7 +958,7 @@ bool DirectoryController::handleGetX(MemEvent * event, bool inMSHR) {
 
     if (is_debug_addr(addr)) {
         eventDI.newst = entry->getState();
-        eventDI.verboseline = entry->getString();
+        eventDI.verboseline = getEntryString(entry);
     }
 
     if (status == MemEventStatus::Reject)
@@ -976,7 +983,7 @@ bool DirectoryController::handleWrite(MemEvent * event, bool inMSHR) {
         bool ret = retrieveDirEntry(entry, event, inMSHR); 
         if (is_debug_addr(addr)) {
             eventDI.newst = entry->getState();
-            eventDI.verboseline = entry->getString();
+            eventDI.verboseline = getEntryString(entry);
         }
         return ret;
     }
@@ -1041,7 +1048,7 @@ bool DirectoryController::handleWrite(MemEvent * event, bool inMSHR) {
 
     if (is_debug_addr(addr)) {
         eventDI.newst = entry->getState();
-        eventDI.verboseline = entry->getString();
+        eventDI.verboseline = getEntryString(entry);
     }
 
     if (status == MemEventStatus::Reject)
@@ -1064,7 +1071,7 @@ bool DirectoryController::handleFlushLine(MemEvent* event, bool inMSHR) {
         bool ret = retrieveDirEntry(entry, event, inMSHR); 
         if (is_debug_addr(addr)) {
             eventDI.newst = entry->getState();
-            eventDI.verboseline = entry->getString();
+            eventDI.verboseline = getEntryString(entry);
         }
         return ret;
     }
@@ -1090,7 +1097,7 @@ bool DirectoryController::handleFlushLine(MemEvent* event, bool inMSHR) {
             if (status == MemEventStatus::OK) {
                 if (event->getEvict()) {
                     entry->removeOwner();
-                    entry->addSharer(event->getSrc());
+                    entry->addSharer(getSharerIndex(event->getSrcId()));
                     mshr->setData(addr, event->getPayload(), event->getDirty());
                     event->setEvict(false);
                 } else if (entry->hasOwner()) {
@@ -1105,7 +1112,7 @@ bool DirectoryController::handleFlushLine(MemEvent* event, bool inMSHR) {
         case M_Inv:
             if (event->getEvict()) {
                 entry->removeOwner();
-                entry->addSharer(event->getSrc());
+                entry->addSharer(getSharerIndex(event->getSrcId()));
                 mshr->setData(addr, event->getPayload(), event->getDirty());
                 event->setEvict(false);
                 entry->setState(S_Inv);
@@ -1114,11 +1121,11 @@ bool DirectoryController::handleFlushLine(MemEvent* event, bool inMSHR) {
         case M_InvX:
             if (event->getEvict()) {
                 entry->removeOwner();
-                entry->addSharer(event->getSrc());
+                entry->addSharer(getSharerIndex(event->getSrcId()));
                 mshr->setData(addr, event->getPayload(), event->getDirty());
                 entry->setState(S);
                 mshr->decrementAcksNeeded(addr);
-                responses.find(addr)->second.erase(event->getSrc());
+                responses.find(addr)->second.erase(event->getSrcId());
                 if (responses.find(addr)->second.empty()) responses.erase(addr);
                 retryBuffer.push_back(static_cast<MemEvent*>(mshr->getFrontEvent(addr)));
             }
@@ -1132,7 +1139,7 @@ bool DirectoryController::handleFlushLine(MemEvent* event, bool inMSHR) {
 
     if (is_debug_addr(addr)) {
         eventDI.newst = entry->getState();
-        eventDI.verboseline = entry->getString();
+        eventDI.verboseline = getEntryString(entry);
     }
 
     return true;
@@ -1153,7 +1160,7 @@ bool DirectoryController::handleFlushLineInv(MemEvent* event, bool inMSHR) {
         bool ret = retrieveDirEntry(entry, event, inMSHR); 
         if (is_debug_addr(addr)) {
             eventDI.newst = entry->getState();
-            eventDI.verboseline = entry->getString();
+            eventDI.verboseline = getEntryString(entry);
         }
         return ret;
     }
@@ -1171,7 +1178,7 @@ bool DirectoryController::handleFlushLineInv(MemEvent* event, bool inMSHR) {
         case S:
             if (status == MemEventStatus::OK) {
                 if (event->getEvict()) {
-                    entry->removeSharer(event->getSrc());
+                    entry->removeSharer(getSharerIndex(event->getSrcId()));
                     event->setEvict(false);
                 }
 
@@ -1203,7 +1210,7 @@ bool DirectoryController::handleFlushLineInv(MemEvent* event, bool inMSHR) {
             break;
         case S_D:
             if (event->getEvict()) {
-                entry->removeSharer(event->getSrc());
+                entry->removeSharer(getSharerIndex(event->getSrcId()));
                 event->setEvict(false);
                 if (!entry->hasSharers())
                     entry->setState(IS);
@@ -1211,7 +1218,7 @@ bool DirectoryController::handleFlushLineInv(MemEvent* event, bool inMSHR) {
             break;
         case S_B:
             if (event->getEvict()) {
-                entry->removeSharer(event->getSrc());
+                entry->removeSharer(getSharerIndex(event->getSrcId()));
                 event->setEvict(false);
                 if (!entry->hasSharers())
                     entry->setState(I);
@@ -1222,7 +1229,7 @@ bool DirectoryController::handleFlushLineInv(MemEvent* event, bool inMSHR) {
                 entry->removeOwner();
                 mshr->setData(addr, event->getPayload(), event->getDirty());
                 event->setEvict(false);
-                responses.find(addr)->second.erase(event->getSrc());
+                responses.find(addr)->second.erase(event->getSrcId());
                 if (responses.find(addr)->second.empty()) responses.erase(addr);
 
                 if (mshr->decrementAcksNeeded(addr)) {
@@ -1233,9 +1240,9 @@ bool DirectoryController::handleFlushLineInv(MemEvent* event, bool inMSHR) {
             break;
         case SD_Inv:
             if (event->getEvict()) {
-                entry->removeSharer(event->getSrc());
+                entry->removeSharer(getSharerIndex(event->getSrcId()));
                 event->setEvict(false);
-                responses.find(addr)->second.erase(event->getSrc());
+                responses.find(addr)->second.erase(event->getSrcId());
                 if (responses.find(addr)->second.empty()) responses.erase(addr);
                 if (mshr->decrementAcksNeeded(addr)) {
                     entry->hasSharers() ? entry->setState(S_D) : entry->setState(IS);
@@ -1245,9 +1252,9 @@ bool DirectoryController::handleFlushLineInv(MemEvent* event, bool inMSHR) {
             break;
         case SM_Inv:
             if (event->getEvict()) {
-                entry->removeSharer(event->getSrc());
+                entry->removeSharer(getSharerIndex(event->getSrcId()));
                 event->setEvict(false);
-                responses.find(addr)->second.erase(event->getSrc());
+                responses.find(addr)->second.erase(event->getSrcId());
                 if (responses.find(addr)->second.empty()) responses.erase(addr);
                 if (mshr->decrementAcksNeeded(addr)) {
                     entry->setState(IM);
@@ -1256,9 +1263,9 @@ bool DirectoryController::handleFlushLineInv(MemEvent* event, bool inMSHR) {
             break;
         case S_Inv:
             if (event->getEvict()) {
-                entry->removeSharer(event->getSrc());
+                entry->removeSharer(getSharerIndex(event->getSrcId()));
                 event->setEvict(false);
-                responses.find(addr)->second.erase(event->getSrc());
+                responses.find(addr)->second.erase(event->getSrcId());
                 if (responses.find(addr)->second.empty()) responses.erase(addr);
                 if (mshr->decrementAcksNeeded(addr)) {
                     entry->hasSharers() ? entry->setState(S) : entry->setState(I);
@@ -1268,9 +1275,9 @@ bool DirectoryController::handleFlushLineInv(MemEvent* event, bool inMSHR) {
             break;
         case M_Inv:
             if (event->getEvict()) {
-                entry->removeSharer(event->getSrc());
+                entry->removeSharer(getSharerIndex(event->getSrcId()));
                 event->setEvict(false);
-                responses.find(addr)->second.erase(event->getSrc());
+                responses.find(addr)->second.erase(event->getSrcId());
                 if (responses.find(addr)->second.empty()) responses.erase(addr);
                 if (mshr->decrementAcksNeeded(addr)) {
                     entry->setState(I);
@@ -1288,7 +1295,7 @@ bool DirectoryController::handleFlushLineInv(MemEvent* event, bool inMSHR) {
 
     if (is_debug_addr(addr)) {
         eventDI.newst = entry->getState();
-        eventDI.verboseline = entry->getString();
+        eventDI.verboseline = getEntryString(entry);
     }
 
     return true;
@@ -1307,7 +1314,7 @@ bool DirectoryController::handlePutS(MemEvent * event, bool inMSHR) {
         bool ret = retrieveDirEntry(entry, event, inMSHR); 
         if (is_debug_addr(addr)) {
             eventDI.newst = entry->getState();
-            eventDI.verboseline = entry->getString();
+            eventDI.verboseline = getEntryString(entry);
         }
         return ret;
     }
@@ -1315,11 +1322,11 @@ bool DirectoryController::handlePutS(MemEvent * event, bool inMSHR) {
     if (!inMSHR)
         stat_cacheHits->addData(1);
 
-    entry->removeSharer(event->getSrc());
+    entry->removeSharer(getSharerIndex(event->getSrcId()));
     sendAckPut(event);
 
-    if (responses.find(addr) != responses.end() && responses.find(addr)->second.find(event->getSrc()) != responses.find(addr)->second.end()) {
-        responses.find(addr)->second.erase(event->getSrc());
+    if (responses.find(addr) != responses.end() && responses.find(addr)->second.find(event->getSrcId()) != responses.find(addr)->second.end()) {
+        responses.find(addr)->second.erase(event->getSrcId());
         if (responses.find(addr)->second.empty()) responses.erase(addr);
     }
 
@@ -1366,7 +1373,7 @@ bool DirectoryController::handlePutS(MemEvent * event, bool inMSHR) {
 
     if (is_debug_addr(addr)) {
         eventDI.newst = entry->getState();
-        eventDI.verboseline = entry->getString();
+        eventDI.verboseline = getEntryString(entry);
     }
 
     if (update)
@@ -1389,7 +1396,7 @@ bool DirectoryController::handlePutX(MemEvent * event, bool inMSHR) {
         bool ret = retrieveDirEntry(entry, event, inMSHR); 
         if (is_debug_addr(addr)) {
             eventDI.newst = entry->getState();
-            eventDI.verboseline = entry->getString();
+            eventDI.verboseline = getEntryString(entry);
         }
         return ret;
     }
@@ -1398,7 +1405,7 @@ bool DirectoryController::handlePutX(MemEvent * event, bool inMSHR) {
         stat_cacheHits->addData(1);
 
     entry->removeOwner();
-    entry->addSharer(event->getSrc());
+    entry->addSharer(getSharerIndex(event->getSrcId()));
 
     sendAckPut(event);
 
@@ -1417,7 +1424,7 @@ bool DirectoryController::handlePutX(MemEvent * event, bool inMSHR) {
             break;
         case M_InvX:
             mshr->decrementAcksNeeded(addr);
-            responses.find(addr)->second.erase(event->getSrc());
+            responses.find(addr)->second.erase(event->getSrcId());
             if (responses.find(addr)->second.empty()) responses.erase(addr);
             mshr->setData(addr, event->getPayload(), event->getDirty());
             entry->setState(S);
@@ -1429,7 +1436,7 @@ bool DirectoryController::handlePutX(MemEvent * event, bool inMSHR) {
 
     if (is_debug_addr(addr)) {
         eventDI.newst = entry->getState();
-        eventDI.verboseline = entry->getString();
+        eventDI.verboseline = getEntryString(entry);
     }
 
     cleanUpAfterRequest(event, inMSHR);
@@ -1451,7 +1458,7 @@ bool DirectoryController::handlePutE(MemEvent * event, bool inMSHR) {
         bool ret = retrieveDirEntry(entry, event, inMSHR); 
         if (is_debug_addr(addr)) {
             eventDI.newst = entry->getState();
-            eventDI.verboseline = entry->getString();
+            eventDI.verboseline = getEntryString(entry);
         }
         return ret;
     }
@@ -1472,7 +1479,7 @@ bool DirectoryController::handlePutE(MemEvent * event, bool inMSHR) {
         case M_Inv:
         case M_InvX:
             mshr->decrementAcksNeeded(addr);
-            responses.find(addr)->second.erase(event->getSrc());
+            responses.find(addr)->second.erase(event->getSrcId());
             if (responses.find(addr)->second.empty()) responses.erase(addr);
             mshr->setData(addr, event->getPayload(), event->getDirty());
             entry->setState(I);
@@ -1484,7 +1491,7 @@ bool DirectoryController::handlePutE(MemEvent * event, bool inMSHR) {
 
     if (is_debug_addr(addr)) {
         eventDI.newst = entry->getState();
-        eventDI.verboseline = entry->getString();
+        eventDI.verboseline = getEntryString(entry);
     }
 
     cleanUpAfterRequest(event, inMSHR);
@@ -1506,7 +1513,7 @@ bool DirectoryController::handlePutM(MemEvent * event, bool inMSHR) {
         bool ret = retrieveDirEntry(entry, event, inMSHR); 
         if (is_debug_addr(addr)) {
             eventDI.newst = entry->getState();
-            eventDI.verboseline = entry->getString();
+            eventDI.verboseline = getEntryString(entry);
         }
         return ret;
     }
@@ -1528,7 +1535,7 @@ bool DirectoryController::handlePutM(MemEvent * event, bool inMSHR) {
         case M_Inv:
         case M_InvX:
             mshr->decrementAcksNeeded(addr);
-            responses.find(addr)->second.erase(event->getSrc());
+            responses.find(addr)->second.erase(event->getSrcId());
             if (responses.find(addr)->second.empty()) responses.erase(addr);
             mshr->setData(addr, event->getPayload(), event->getDirty());
             entry->setState(I);
@@ -1540,7 +1547,7 @@ bool DirectoryController::handlePutM(MemEvent * event, bool inMSHR) {
 
     if (is_debug_addr(addr)) {
         eventDI.newst = entry->getState();
-        eventDI.verboseline = entry->getString();
+        eventDI.verboseline = getEntryString(entry);
     }
 
     cleanUpAfterRequest(event, inMSHR);
@@ -1564,7 +1571,7 @@ bool DirectoryController::handleFetchInv(MemEvent * event, bool inMSHR) {
         bool ret = retrieveDirEntry(entry, event, inMSHR); 
         if (is_debug_addr(addr)) {
             eventDI.newst = entry->getState();
-            eventDI.verboseline = entry->getString();
+            eventDI.verboseline = getEntryString(entry);
         }
         return ret;
     }
@@ -1654,7 +1661,7 @@ bool DirectoryController::handleFetchInv(MemEvent * event, bool inMSHR) {
 
     if (is_debug_addr(addr)) {
         eventDI.newst = entry->getState();
-        eventDI.verboseline = entry->getString();
+        eventDI.verboseline = getEntryString(entry);
     }
 
     if (status == MemEventStatus::Reject)
@@ -1678,7 +1685,7 @@ bool DirectoryController::handleForceInv(MemEvent * event, bool inMSHR) {
         bool ret = retrieveDirEntry(entry, event, inMSHR); 
         if (is_debug_addr(addr)) {
             eventDI.newst = entry->getState();
-            eventDI.verboseline = entry->getString();
+            eventDI.verboseline = getEntryString(entry);
         }
         return ret;
     }
@@ -1763,7 +1770,7 @@ bool DirectoryController::handleForceInv(MemEvent * event, bool inMSHR) {
         sendNACK(event);
     if (is_debug_addr(addr)) {
         eventDI.newst = entry->getState();
-        eventDI.verboseline = entry->getString();
+        eventDI.verboseline = getEntryString(entry);
     }
 
     return true;
@@ -1786,9 +1793,9 @@ bool DirectoryController::handleGetSResp(MemEvent * event, bool inMSHR) {
         out.fatal(CALL_INFO, -1, "%s, Error: Received GetSResp in unhandled state '%s'. Event: %s. Time: %" PRIu64 "ns\n",
                 getName().c_str(), StateString[state], event->getVerboseString(dlevel).c_str(), getCurrentSimTimeNano());
     }
-    if (incoherentSrc.find(reqEv->getSrc()) == incoherentSrc.end()) {
+    if (incoherentSrc.find(reqEv->getSrcId()) == incoherentSrc.end()) {
         entry->setState(S);
-        entry->addSharer(reqEv->getSrc());
+        entry->addSharer(getSharerIndex(reqEv->getSrcId()));
     } else if (state == IS) {
         entry->setState(I);
     } else {
@@ -1801,7 +1808,7 @@ bool DirectoryController::handleGetSResp(MemEvent * event, bool inMSHR) {
 
     if (is_debug_addr(addr)) {
         eventDI.newst = entry->getState();
-        eventDI.verboseline = entry->getString();
+        eventDI.verboseline = getEntryString(entry);
     }
 
     return true;
@@ -1819,28 +1826,28 @@ bool DirectoryController::handleGetXResp(MemEvent * event, bool inMSHR) {
 
     switch (state) {
         case IS:
-            if (incoherentSrc.find(reqEv->getSrc()) != incoherentSrc.end()) {
+            if (incoherentSrc.find(reqEv->getSrcId()) != incoherentSrc.end()) {
                 entry->setState(I);
                 sendDataResponse(reqEv, entry, event->getPayload(), Command::GetSResp);
                 break;
             } else if (protocol == CoherenceProtocol::MESI) {
                 entry->setState(M);
-                entry->setOwner(reqEv->getSrc());
+                entry->setOwner(reqEv->getSrcId());
                 sendDataResponse(reqEv, entry, event->getPayload(), Command::GetXResp);
                 break;
             }
         case S_D:
             entry->setState(S);
-            if (incoherentSrc.find(reqEv->getSrc()) == incoherentSrc.end()) {
-                entry->addSharer(reqEv->getSrc());
+            if (incoherentSrc.find(reqEv->getSrcId()) == incoherentSrc.end()) {
+                entry->addSharer(getSharerIndex(reqEv->getSrcId()));
             }
             sendDataResponse(reqEv, entry, event->getPayload(), Command::GetSResp);
             mshr->setData(addr, event->getPayload(), false); // So subsequent GetS can get data
             break;
         case IM:
-            if (incoherentSrc.find(reqEv->getSrc()) == incoherentSrc.end()) {
+            if (incoherentSrc.find(reqEv->getSrcId()) == incoherentSrc.end()) {
                 entry->setState(M);
-                entry->setOwner(reqEv->getSrc());
+                entry->setOwner(reqEv->getSrcId());
             } else {
                 entry->setState(I);
             }
@@ -1851,7 +1858,7 @@ bool DirectoryController::handleGetXResp(MemEvent * event, bool inMSHR) {
             mshr->setData(addr, event->getPayload(), false); // Save data for when the invalidations finish
             if (is_debug_addr(addr)) {
                 eventDI.newst = entry->getState();
-                eventDI.verboseline = entry->getString();
+                eventDI.verboseline = getEntryString(entry);
             }
             delete event;
             return true;
@@ -1863,7 +1870,7 @@ bool DirectoryController::handleGetXResp(MemEvent * event, bool inMSHR) {
     cleanUpAfterResponse(event, inMSHR);
     if (is_debug_addr(addr)) {
         eventDI.newst = entry->getState();
-        eventDI.verboseline = entry->getString();
+        eventDI.verboseline = getEntryString(entry);
     }
 
     return true;
@@ -1891,7 +1898,7 @@ bool DirectoryController::handleWriteResp(MemEvent * event, bool inMSHR) {
 
     if (is_debug_addr(addr)) {
         eventDI.newst = entry->getState();
-        eventDI.verboseline = entry->getString();
+        eventDI.verboseline = getEntryString(entry);
     }
 
     return true;
@@ -1924,7 +1931,7 @@ bool DirectoryController::handleFlushLineResp(MemEvent * event, bool inMSHR) {
 
     if (is_debug_addr(addr)) {
         eventDI.newst = entry->getState();
-        eventDI.verboseline = entry->getString();
+        eventDI.verboseline = getEntryString(entry);
     }
 
     sendResponse(reqEv, event->getFlags(), event->getMemFlags());
@@ -1942,7 +1949,7 @@ bool DirectoryController::handleAckPut(MemEvent* event, bool inMSHR) {
 
     if (is_debug_addr(addr)) {
         eventDI.newst = entry->getState();
-        eventDI.verboseline = entry->getString();
+        eventDI.verboseline = getEntryString(entry);
     }
 
     cleanUpAfterResponse(event, inMSHR);
@@ -1958,13 +1965,13 @@ bool DirectoryController::handleAckInv(MemEvent* event, bool inMSHR) {
     if (is_debug_addr(addr))
         eventDI.prefill(event->getID(), Command::AckInv, false, addr, state);
 
-    if (entry->isSharer(event->getSrc()))
-        entry->removeSharer(event->getSrc());
+    if (entry->isSharer(getSharerIndex(event->getSrcId())))
+        entry->removeSharer(getSharerIndex(event->getSrcId()));
     else
         entry->removeOwner();
 
     bool done = mshr->decrementAcksNeeded(addr);
-    responses.find(addr)->second.erase(event->getSrc());
+    responses.find(addr)->second.erase(event->getSrcId());
     if (responses.find(addr)->second.empty()) responses.erase(addr);
 
     if (!done) {
@@ -2000,7 +2007,7 @@ bool DirectoryController::handleAckInv(MemEvent* event, bool inMSHR) {
 
     if (is_debug_addr(addr)) {
         eventDI.newst = entry->getState();
-        eventDI.verboseline = entry->getString();
+        eventDI.verboseline = getEntryString(entry);
     }
 
     return true;
@@ -2019,13 +2026,13 @@ bool DirectoryController::handleFetchXResp(MemEvent* event, bool inMSHR) {
                 getName().c_str(), StateString[state], event->getVerboseString(dlevel).c_str(), getCurrentSimTimeNano());
 
     mshr->decrementAcksNeeded(addr);
-    responses.find(addr)->second.erase(event->getSrc());
+    responses.find(addr)->second.erase(event->getSrcId());
     if (responses.find(addr)->second.empty()) responses.erase(addr);
 
     mshr->setData(addr, event->getPayload(), event->getDirty());       // Save data for retry
 
     entry->removeOwner();
-    entry->addSharer(event->getSrc());
+    entry->addSharer(getSharerIndex(event->getSrcId()));
     entry->setState(S);
     retryBuffer.push_back(static_cast<MemEvent*>(mshr->getFrontEvent(addr)));
 
@@ -2033,7 +2040,7 @@ bool DirectoryController::handleFetchXResp(MemEvent* event, bool inMSHR) {
 
     if (is_debug_addr(addr)) {
         eventDI.newst = entry->getState();
-        eventDI.verboseline = entry->getString();
+        eventDI.verboseline = getEntryString(entry);
     }
 
     return true;
@@ -2054,7 +2061,7 @@ bool DirectoryController::handleFetchResp(MemEvent* event, bool inMSHR) {
     MemEvent * reqEv = static_cast<MemEvent*>(mshr->getFrontEvent(addr));
 
     mshr->decrementAcksNeeded(addr);
-    responses.find(addr)->second.erase(event->getSrc());
+    responses.find(addr)->second.erase(event->getSrcId());
     if (responses.find(addr)->second.empty())
         responses.erase(addr);
     mshr->setData(addr, event->getPayload(), event->getDirty());       // Save data for retry
@@ -2070,7 +2077,7 @@ bool DirectoryController::handleFetchResp(MemEvent* event, bool inMSHR) {
 
     if (is_debug_addr(addr)) {
         eventDI.newst = entry->getState();
-        eventDI.verboseline = entry->getString();
+        eventDI.verboseline = getEntryString(entry);
     }
 
     return true;
@@ -2102,8 +2109,8 @@ bool DirectoryController::handleNACK(MemEvent* event, bool inMSHR) {
         case Command::ForceInv:
             // Only retry if we still need the response)
             if (responses.find(addr) != responses.end()
-                    && responses.find(addr)->second.find(nackedEvent->getDst()) != responses.find(addr)->second.end()
-                    && responses.find(addr)->second.find(nackedEvent->getDst())->second == nackedEvent->getID())
+                    && responses.find(addr)->second.find(nackedEvent->getDstId()) != responses.find(addr)->second.end()
+                    && responses.find(addr)->second.find(nackedEvent->getDstId())->second == nackedEvent->getID())
                 break;
             delete nackedEvent;
             return true;
@@ -2116,7 +2123,7 @@ bool DirectoryController::handleNACK(MemEvent* event, bool inMSHR) {
 
     if (is_debug_addr(addr)) {
         eventDI.newst = entry->getState();
-        eventDI.verboseline = entry->getString();
+        eventDI.verboseline = getEntryString(entry);
     }
 
     return true;
@@ -2155,7 +2162,7 @@ bool DirectoryController::handleDirEntryResponse(MemEvent* event) {
 
     if (is_debug_addr(addr)) {
         eventDI.newst = entry->getState();
-        eventDI.verboseline = entry->getString();
+        eventDI.verboseline = getEntryString(entry);
     }
     return true;
 }
@@ -2168,15 +2175,52 @@ DirectoryController::DirEntry* DirectoryController::getDirEntry(Addr addr) {
     std::unordered_map<Addr,DirEntry*>::iterator i = directory.find(addr);
 
     if (directory.end() == i) {
-        directory[addr] = new DirEntry(addr);
-        i = directory.find(addr);
-        i->second->cacheIter = entryCache.end();
+        i = directory.insert(std::make_pair(addr, allocateDirEntry(addr))).first;
         i->second->setCached(true);
-
     }
     return i->second;
 }
 
+unsigned DirectoryController::getSharerIndex(EndpointId id) {
+    std::unordered_map<EndpointId, unsigned>::iterator it = sharerIndices.find(id);
+    if (it != sharerIndices.end())
+        return it->second;
+    unsigned index = sharerIds.size();
+    sharerIndices.insert(std::make_pair(id, index));
+    sharerIds.push_back(id);
+    return index;
+}
+
+std::string DirectoryController::getEntryString(DirEntry* entry) {
+    std::ostringstream str;
+    str << "State: " << StateString[entry->getState()];
+    str << " Sharers: [";
+    bool comma = false;
+    entry->getSharers().forEach([&](unsigned index) {
+        if (comma)
+            str << ",";
+        str << EndpointRegistry::name(getSharerId(index));
+        comma = true;
+    });
+    str << "] Owner: " << EndpointRegistry::name(entry->getOwner());
+    str << " Cached: " << (entry->isCached() ? "y" : "n");
+    return str.str();
+}
+
+/* Directory entries come and go with every line that is cached and evicted, so recycle them */
+DirectoryController::DirEntry* DirectoryController::allocateDirEntry(Addr addr) {
+    if (freeDirEntries.empty())
+        return new DirEntry(addr);
+    DirEntry* entry = freeDirEntries.back();
+    freeDirEntries.pop_back();
+    entry->reset(addr);
+    return entry;
+}
+
+void DirectoryController::releaseDirEntry(DirEntry* entry) {
+    freeDirEntries.push_back(entry);
+}
+
 bool DirectoryController::retrieveDirEntry(DirEntry* entry, MemEvent* event, bool inMSHR) {
     MemEventStatus status = inMSHR ? MemEventStatus::OK : allocateMSHR(event, false);
     if (status == MemEventStatus::Reject)
@@ -2212,7 +2256,7 @@ bool DirectoryController::retrieveDirEntry(DirEntry* entry, MemEvent* event, boo
     uint64_t deliveryTime = timestamp + accessLatency;
 
     // Bypass destination lookup 
-    memMsgQueue.insert(std::make_pair(deliveryTime, MemMsg(me, true)));
+    memMsgQueue.insert(deliveryTime, MemMsg(me, true));
 
     return true;
 }
@@ -2278,29 +2322,22 @@ void DirectoryController::updateCache(DirEntry * entry) { // TODO replace with a
     if (0 == entryCacheMaxSize) {
         sendEntryToMemory(entry);
     } else {
-        if (entry->cacheIter != entryCache.end()) {
-            entryCache.erase(entry->cacheIter);
-            --entryCacheSize;
-            entry->cacheIter = entryCache.end();
-        }
+        if (entry->inEntryCache)
+            entryCache.remove(entry);
 
         if (entry->getState() == I) {
             directory.erase(entry->getBaseAddr());
-            delete entry;
+            releaseDirEntry(entry);
             return;
         } else  {
-            entryCache.push_front(entry);
-            entry->cacheIter = entryCache.begin();
-            ++entryCacheSize;
+            entryCache.pushFront(entry);
 
-            while (entryCacheSize > entryCacheMaxSize) {
+            while (entryCache.size() > entryCacheMaxSize) {
                 DirEntry * oldEntry = entryCache.back();
                 if (mshr->exists(oldEntry->getBaseAddr()))
                     break;
 
-                entryCache.pop_back();
-                --entryCacheSize;
-                oldEntry->cacheIter = entryCache.end();
+                entryCache.remove(oldEntry);
                 oldEntry->setCached(false);
                 sendEntryToMemory(oldEntry);
             }
@@ -2316,7 +2353,7 @@ void DirectoryController::sendEntryToMemory(DirEntry *entry) {
 
     uint64_t deliveryTime = timestamp + accessLatency;
     me->setDst(memLink->getTargetDestination(0));
-    memMsgQueue.insert(std::make_pair(deliveryTime, MemMsg(me, true)));
+    memMsgQueue.insert(deliveryTime, MemMsg(me, true));
 }
 
 /****************************
@@ -2358,10 +2395,10 @@ void DirectoryController::issueFlush(MemEvent* event) {
 void DirectoryController::issueFetch(MemEvent* event, DirEntry* entry, Command cmd) {
     Addr addr = event->getBaseAddr();
     MemEvent * fetch = new MemEvent(getName(), event->getAddr(), addr, cmd, lineSize);
-    fetch->setDst(entry->getOwner());
+    fetch->setDstId(entry->getOwner());
 
     if (responses.find(addr) == responses.end()) {
-        std::map<std::string,MemEvent::id_type> resp;
+        std::map<EndpointId,MemEvent::id_type> resp;
         resp.insert(std::make_pair(entry->getOwner(), fetch->getID()));
         responses.insert(std::make_pair(addr, resp));
     } else {
@@ -2374,15 +2411,16 @@ void DirectoryController::issueFetch(MemEvent* event, DirEntry* entry, Command c
 }
 
 void DirectoryController::issueInvalidations(MemEvent* event, DirEntry* entry, Command cmd) {
-    std::string rqstr = (event->getSrc());
+    EndpointId rqstr = event->getSrcId();
 
-    for (set<std::string>::iterator it = entry->getSharers()->begin(); it != entry->getSharers()->end(); it++) {
-        if (*it == rqstr) continue;
-        issueInvalidation(*it, event, entry, cmd);
-    }
+    entry->getSharers().forEach([&](unsigned index) {
+        EndpointId sharer = getSharerId(index);
+        if (sharer != rqstr)
+            issueInvalidation(sharer, event, entry, cmd);
+    });
 }
 
-void DirectoryController::issueInvalidation(std::string dst, MemEvent* event, DirEntry* entry, Command cmd) {
+void DirectoryController::issueInvalidation(EndpointId dst, MemEvent* event, DirEntry* entry, Command cmd) {
     Addr addr = entry->getBaseAddr();
     MemEvent* inv = new MemEvent(getName(), addr, addr, cmd, lineSize);
     if (event) {
@@ -2390,12 +2428,12 @@ void DirectoryController::issueInvalidation(std::string dst, MemEvent* event, Di
     } else {
         inv->setRqstr(getName());
     }
-    inv->setDst(dst);
+    inv->setDstId(dst);
 
     mshr->incrementAcksNeeded(addr);
 
     if (responses.find(addr) == responses.end()) {
-        std::map<std::string,MemEvent::id_type> resp;
+        std::map<EndpointId,MemEvent::id_type> resp;
         resp.insert(std::make_pair(entry->getOwner(), inv->getID()));
         responses.insert(std::make_pair(addr, resp));
     } else {
@@ -2489,9 +2527,7 @@ void DirectoryController::sendNACK(MemEvent * event) {
 // Return whether there are pending outgoing events
 void DirectoryController::sendOutgoingEvents() {
 
-    bool debugLine = false;
-    while (!cpuMsgQueue.empty() && cpuMsgQueue.begin()->first <= timestamp) {
-        MemEventBase * ev = cpuMsgQueue.begin()->second;
+    cpuMsgQueue.drain(timestamp, [&](MemEventBase* ev) {
 
         if (is_debug_event(ev)) {
             dbg.debug(_L4_, "E: %-20" PRIu64 " %-20" PRIu64 " %-20s Event:Send    (%s)\n",
@@ -2506,18 +2542,17 @@ void DirectoryController::sendOutgoingEvents() {
         }
         stat_eventSent[(int)ev->getCmd()]->addData(1);
         cpuLink->send(ev);
-        cpuMsgQueue.erase(cpuMsgQueue.begin());
-    }
+    });
 
-    while (!memMsgQueue.empty() && memMsgQueue.begin()->first <= timestamp) {
-        MemEventBase * ev = memMsgQueue.begin()->second.event;
+    memMsgQueue.drain(timestamp, [&](MemMsg& msg) {
+        MemEventBase * ev = msg.event;
 
         if (is_debug_event(ev)) {
             dbg.debug(_L4_, "E: %-20" PRIu64 " %-20" PRIu64 " %-20s Event:Send    (%s)\n",
                     getCurrentSimCycle(), timestamp, getName().c_str(), ev->getBriefString().c_str());
         }
 
-        if (memMsgQueue.begin()->second.dirAccess) {
+        if (msg.dirAccess) {
             if (ev->getCmd() == Command::GetS)
                 stat_dirEntryReads->addData(1);
             else
@@ -2526,8 +2561,7 @@ void DirectoryController::sendOutgoingEvents() {
             stat_eventSent[(int)ev->getCmd()]->addData(1);
         }
         memLink->send(ev);
-        memMsgQueue.erase(memMsgQueue.begin());
-    }
+    });
 
 }
 
@@ -2538,12 +2572,12 @@ void DirectoryController::forwardByAddress(MemEventBase * ev, Cycle_t ts, bool d
     std::string dst = memLink->findTargetDestination(ev->getRoutingAddress());
     if (dst != "") { /* Common case */
         ev->setDst(dst);
-        memMsgQueue.insert(std::make_pair(ts, MemMsg(ev, dirAccess)));
+        memMsgQueue.insert(ts, MemMsg(ev, dirAccess));
     } else {
         dst = cpuLink->findTargetDestination(ev->getRoutingAddress());
         if (dst != "") {
             ev->setDst(dst);
-            cpuMsgQueue.insert(std::make_pair(ts, ev));
+            cpuMsgQueue.insert(ts, ev);
         } else {
             std::string availableDests = "cpulink:\n" + cpuLink->getAvailableDestinationsAsString();
             if (cpuLink != memLink) availableDests = availableDests + "memlink:\n" + memLink->getAvailableDestinationsAsString();
@@ -2557,10 +2591,10 @@ void DirectoryController::forwardByAddress(MemEventBase * ev, Cycle_t ts, bool d
  * dirAccess has default value of false
  */
 void DirectoryController::forwardByDestination(MemEventBase* ev, Cycle_t ts, bool dirAccess) {
-    if (cpuLink->isReachable(ev->getDst())) {
-        cpuMsgQueue.insert(std::make_pair(ts, ev));
-    } else if (memLink->isReachable(ev->getDst())) {
-        memMsgQueue.insert(std::make_pair(ts, MemMsg(ev, dirAccess)));
+    if (cpuLink->isReachable(ev->getDstId())) {
+        cpuMsgQueue.insert(ts, ev);
+    } else if (memLink->isReachable(ev->getDstId())) {
+        memMsgQueue.insert(ts, MemMsg(ev, dirAccess));
     } else {
         out.fatal(CALL_INFO, -1, "%s, Error: Destination %s appears unreachable on both links. Event: %s\n",
                 getName().c_str(), ev->getDst().c_str(), ev->getVerboseString(dlevel).c_str());
@@ -24,6 +24,8 @@
 
 #include <map>
 #include <set>
+#include <unordered_map>
+#include <unordered_set>
 #include <list>
 #include <vector>
 
@@ -37,6 +39,9 @@
 #include "sst/elements/memHierarchy/memEvent.h"
 #include "sst/elements/memHierarchy/util.h"
 #include "sst/elements/memHierarchy/mshr.h"
+#include "sst/elements/memHierarchy/memEventBuffer.h"
+#include "sst/elements/memHierarchy/timingWheel.h"
+#include "sst/elements/memHierarchy/sharerSet.h"
 
 using namespace std;
 
@@ -139,6 +144,8 @@ public:
             {"eventSent_FlushLineInv",  "Event sent: FlushLineInv", "count", 2},
             {"eventSent_FlushLineResp", "Event sent: FlushLineResp", "count", 2},
             {"MSHR_occupancy",          "Number of events in MSHR each cycle",  "events",       1},
+            {"clock_ticks_executed",    "Number of cycles the directory's clock handler ran", "cycles", 1},
+            {"clock_ticks_skipped",     "Number of cycles the directory's clock was off because the directory was idle", "cycles", 1},
             {"default_stat",            "Default statistic. If not 0 then a statistic is missing", "", 1})
 
     SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
@@ -183,11 +190,13 @@ private:
     Statistic<uint64_t> * stat_dirEntryWrites;
 
     Statistic<uint64_t> * stat_MSHROccupancy;
+    Statistic<uint64_t> * stat_clockTicksExecuted;
+    Statistic<uint64_t> * stat_clockTicksSkipped;
 
     /* Queue of packets to work on */
-    std::list<MemEvent*> eventBuffer;
-    std::list<MemEvent*> retryBuffer;
-    std::map<MemEvent::id_type, std::string> noncacheMemReqs;
+    MemEventBuffer<MemEvent*> eventBuffer;
+    MemEventBuffer<MemEvent*> retryBuffer;
+    std::map<MemEvent::id_type, EndpointId> noncacheMemReqs;
 
     std::set<Addr> addrsThisCycle;
 
@@ -295,38 +304,30 @@ private:
 	bool                cached;         // whether block is cached or not
         Addr                addr;           // block address
         State               state;          // state
-        std::list<DirEntry*>::iterator cacheIter;
-	std::set<std::string> sharers;      // set of sharers for block
-        std::string         owner;          // Owner of block
+        DirEntry*           lruPrev;        // Entry cache LRU links, valid when inEntryCache
+        DirEntry*           lruNext;
+        bool                inEntryCache;
+        SharerSet           sharers;        // set of sharers for block, by directory-local sharer index
+        EndpointId          owner;          // Owner of block
 
         DirEntry(Addr a) {
+            reset(a);
+        }
+
+        void reset(Addr a) {
             clearEntry();
             addr = a;
             state = I;
             cached = false;
+            lruPrev = lruNext = nullptr;
+            inEntryCache = false;
         }
 
         void clearEntry(){
             cached = true;
             addr = 0;
             sharers.clear();
-            owner = "";
-        }
-
-        std::string getString() {
-            std::ostringstream str;
-            str << "State: " << StateString[state];
-            str << " Sharers: [";
-            bool comma = false;
-            for (std::set<std::string>::iterator it = sharers.begin(); it != sharers.end(); it++) {
-                if (comma)
-                    str << ",";
-                str << *it;
-                comma = true;
-            }
-            str << "] Owner: " << owner;
-            str << " Cached: " << (cached ? "y" : "n");
-            return str.str();
+            owner = 0;
         }
 
         bool isCached() { return cached; }
@@ -335,37 +336,81 @@ private:
 
         Addr getBaseAddr() { return addr; }
 
-        size_t getSharerCount() { return sharers.size(); }
+        size_t getSharerCount() { return sharers.count(); }
 
         void clearSharers() { sharers.clear(); }
 
-        void addSharer(std::string shr) { sharers.insert(shr); }
+        void addSharer(unsigned shr) { sharers.insert(shr); }
 
-        bool isSharer(std::string shr) { return sharers.find(shr) != sharers.end(); }
+        bool isSharer(unsigned shr) { return sharers.contains(shr); }
 
         bool hasSharers() { return !(sharers.empty()); }
 
-        std::set<std::string>* getSharers() { return &sharers; }
+        const SharerSet& getSharers() { return sharers; }
 
-        void removeSharer(std::string shr) { sharers.erase(shr); }
+        void removeSharer(unsigned shr) { sharers.erase(shr); }
 
-        std::string getOwner() { return owner; }
+        EndpointId getOwner() { return owner; }
 
-        bool hasOwner() { return owner != ""; }
+        bool hasOwner() { return owner != 0; }
 
-        void removeOwner() { owner = ""; }
+        void removeOwner() { owner = 0; }
 
-        void setOwner(std::string own) { owner = own; }
+        void setOwner(EndpointId own) { owner = own; }
 
         void setState(State nState) { state = nState; }
 
         State getState() { return state; }
     };
 
+    /* Intrusive LRU list of the directory entries held in the entry cache, most recently used at the front */
+    class EntryLRU {
+    public:
+        EntryLRU() : head_(nullptr), tail_(nullptr), size_(0) {}
+
+        void pushFront(DirEntry* entry) {
+            entry->lruPrev = nullptr;
+            entry->lruNext = head_;
+            if (head_) head_->lruPrev = entry;
+            else tail_ = entry;
+            head_ = entry;
+            entry->inEntryCache = true;
+            size_++;
+        }
+
+        void remove(DirEntry* entry) {
+            if (entry->lruPrev) entry->lruPrev->lruNext = entry->lruNext;
+            else head_ = entry->lruNext;
+            if (entry->lruNext) entry->lruNext->lruPrev = entry->lruPrev;
+            else tail_ = entry->lruPrev;
+            entry->lruPrev = entry->lruNext = nullptr;
+            entry->inEntryCache = false;
+            size_--;
+        }
+
+        DirEntry* back() { return tail_; }
+        uint64_t size() { return size_; }
+
+    private:
+        DirEntry* head_;
+        DirEntry* tail_;
+        uint64_t size_;
+    };
+
     int dlevel;
     void printDebugInfo();
 
+    /* Sharers are tracked by a dense directory-local index rather than by endpoint so sharer sets stay small */
+    unsigned getSharerIndex(EndpointId id);
+    EndpointId getSharerId(unsigned index) { return sharerIds[index]; }
+    std::unordered_map<EndpointId, unsigned> sharerIndices;
+    std::vector<EndpointId> sharerIds;
+
+    std::string getEntryString(DirEntry* entry);
+
     DirEntry* getDirEntry(Addr addr); // find entry in the master list
+    DirEntry* allocateDirEntry(Addr addr);
+    void releaseDirEntry(DirEntry* entry);
     bool retrieveDirEntry(DirEntry* entry, MemEvent* event, bool inMSHR); // Simulate fetching entry from memory
 
     MemEventStatus allocateMSHR(MemEvent* event, bool fwdReq, int pos = -1);
@@ -380,7 +425,7 @@ private:
     void issueFlush(MemEvent* event);
     void issueFetch(MemEvent* event, DirEntry* entry, Command cmd);
     void issueInvalidations(MemEvent* event, DirEntry* entry, Command cmd);
-    void issueInvalidation(std::string dst, MemEvent* event, DirEntry* entry, Command cmd);
+    void issueInvalidation(EndpointId dst, MemEvent* event, DirEntry* entry, Command cmd);
     void sendDataResponse(MemEvent* event, DirEntry* entry, std::vector<uint8_t>& data, Command cmd, uint32_t flags = 0);
     void sendResponse(MemEvent* event, uint32_t flags = 0, uint32_t memflags = 0);
     void writebackData(MemEvent* event);
@@ -407,20 +452,20 @@ private:
     void forwardByDestination(MemEventBase* ev, Cycle_t timestamp, bool dirAccess = false);
     void forwardByAddress(MemEventBase* ev, Cycle_t timestamp, bool dirAccess = false);
 
-    std::multimap<uint64_t,MemEventBase*>   cpuMsgQueue;
-    std::multimap<uint64_t,MemMsg>   memMsgQueue;
+    TimingWheel<MemEventBase*>  cpuMsgQueue;
+    TimingWheel<MemMsg>         memMsgQueue;
 
     uint64_t    entryCacheMaxSize;
-    uint64_t    entryCacheSize;
     uint32_t    entrySize;
-    std::list<DirEntry*> entryCache;
+    EntryLRU    entryCache;
+    std::vector<DirEntry*> freeDirEntries; // Released entries kept for reuse
 
     uint64_t lineSize;
 
     uint64_t accessLatency;
     uint64_t mshrLatency;
 
-    std::map<Addr, std::map<std::string, MemEvent::id_type> > responses;
+    std::unordered_map<Addr, std::map<EndpointId, MemEvent::id_type> > responses;
     
     std::map<MemEvent::id_type, Addr> dirMemAccesses;
     
@@ -428,7 +473,7 @@ private:
     bool waitWBAck;
     bool sendWBAck;
 
-    std::set<std::string> incoherentSrc;
+    std::unordered_set<EndpointId> incoherentSrc;
 
 };
 
@@ -0,0 +1,150 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef MEMHIERARCHY_FLATHASHMAP_H
+#define MEMHIERARCHY_FLATHASHMAP_H
+
+#include <stddef.h>
+#include <stdint.h>
+#include <vector>
+#include <utility>
+
+namespace SST {
+namespace MemHierarchy {
+
+/*
+ * Open-addressed hash map with linear probing for the small, short-lived
+ * tables a controller keeps per outstanding request. Entries live in one
+ * array so a lookup is a hash and a short scan instead of a tree walk, and
+ * erase shifts the rest of the probe run back so there are no tombstones.
+ *
+ * Pointers returned by find() and operator[] are only good until the next
+ * insert or erase.
+ */
+template<typename K, typename V, typename H>
+class FlatHashMap {
+public:
+    FlatHashMap(size_t capacity = 64) : used_(0) {
+        size_t size = 8;
+        while (size < capacity) size <<= 1;
+        slots_.resize(size);
+        mask_ = size - 1;
+    }
+
+    size_t size() const { return used_; }
+    bool empty() const { return used_ == 0; }
+
+    V* find(const K& key) {
+        for (size_t i = hash_(key) & mask_; slots_[i].used; i = (i + 1) & mask_) {
+            if (slots_[i].key == key)
+                return &slots_[i].value;
+        }
+        return nullptr;
+    }
+
+    /* The value for key, default constructed if key was not in the map */
+    V& operator[](const K& key) {
+        if (4 * (used_ + 1) > 3 * slots_.size())
+            resize(2 * slots_.size());
+
+        size_t i = hash_(key) & mask_;
+        for (; slots_[i].used; i = (i + 1) & mask_) {
+            if (slots_[i].key == key)
+                return slots_[i].value;
+        }
+        slots_[i].used = true;
+        slots_[i].key = key;
+        slots_[i].value = V();
+        used_++;
+        return slots_[i].value;
+    }
+
+    bool erase(const K& key) {
+        size_t i = hash_(key) & mask_;
+        for (; slots_[i].used; i = (i + 1) & mask_) {
+            if (slots_[i].key == key)
+                break;
+        }
+        if (!slots_[i].used)
+            return false;
+
+        /* Move back any later entry of the run that may sit in the hole */
+        size_t hole = i;
+        for (size_t j = (i + 1) & mask_; slots_[j].used; j = (j + 1) & mask_) {
+            size_t home = hash_(slots_[j].key) & mask_;
+            if (((j - home) & mask_) >= ((j - hole) & mask_)) {
+                slots_[hole].key = slots_[j].key;
+                slots_[hole].value = std::move(slots_[j].value);
+                hole = j;
+            }
+        }
+        slots_[hole].used = false;
+        slots_[hole].value = V();
+        used_--;
+        return true;
+    }
+
+    /* Call f(key, value) for every entry, in no particular order */
+    template<typename F>
+    void forEach(F f) {
+        for (size_t i = 0; i < slots_.size(); i++) {
+            if (slots_[i].used)
+                f(slots_[i].key, slots_[i].value);
+        }
+    }
+
+private:
+    struct Slot {
+        Slot() : key(), value(), used(false) { }
+        K key;
+        V value;
+        bool used;
+    };
+
+    void resize(size_t size) {
+        std::vector<Slot> old;
+        old.swap(slots_);
+        slots_.resize(size);
+        mask_ = size - 1;
+        for (size_t i = 0; i < old.size(); i++) {
+            if (!old[i].used) continue;
+            size_t j = hash_(old[i].key) & mask_;
+            while (slots_[j].used) j = (j + 1) & mask_;
+            slots_[j].used = true;
+            slots_[j].key = old[i].key;
+            slots_[j].value = std::move(old[i].value);
+        }
+    }
+
+    std::vector<Slot> slots_;
+    size_t mask_;
+    size_t used_;
+    H hash_;
+};
+
+/* Hashes for the keys controllers usually look up: addresses and request ids, and event ids */
+struct IdHash {
+    size_t operator()(uint64_t id) const { return (id * 0x9E3779B97F4A7C15ULL) >> 16; }
+};
+
+struct EventIdHash {
+    size_t operator()(const std::pair<uint64_t, int>& id) const {
+        return (id.first * 0x9E3779B97F4A7C15ULL) ^ ((uint64_t)id.second * 0xC2B2AE3D27D4EB4FULL);
+    }
+};
+
+}}
+
+#endif
@@ -26,6 +26,9 @@
 #include <sst_config.h>
 #include <stdint.h>
 #include <sst/core/subcomponent.h>
+#include <vector>
+
+#include "sst/elements/memHierarchy/xorHashMatrix.h"
 
 namespace SST {
 namespace MemHierarchy {
@@ -39,6 +42,12 @@ public:
     virtual ~HashFunction() {}
 
     virtual uint64_t hash(uint32_t ID, uint64_t value) = 0;
+
+    /* Hash 'count' values at once */
+    virtual void hashBatch(uint32_t ID, const uint64_t* values, uint64_t* results, size_t count) {
+        for (size_t i = 0; i < count; i++)
+            results[i] = hash(ID, values[i]);
+    }
 };
 
 /* Default hash function - none */
@@ -92,6 +101,42 @@ public:
     }
 };
 
+/* Table-driven XOR hash, each output bit is the parity of a configurable set of input bits */
+class XorMatrixHashFunction : public HashFunction {
+public:
+    SST_ELI_REGISTER_SUBCOMPONENT(XorMatrixHashFunction, "memHierarchy", "hash.xorMatrix", SST_ELI_ELEMENT_VERSION(1,0,0),
+            "XOR hash with a configurable mask per output bit", SST::MemHierarchy::HashFunction)
+
+    SST_ELI_DOCUMENT_PARAMS(
+            {"masks", "(array) Mask of input bits to XOR into each output bit, starting with bit 0. Output bits without a mask are unmodified. For caches, the input is the line number (address / line size).", "[]"},
+            {"first_bit", "(uint) Output bit that the first mask in 'masks' applies to.", "0"} )
+
+    XorMatrixHashFunction(ComponentId_t id, Params& params) : HashFunction(id, params) {
+        std::vector<uint64_t> masks;
+        params.find_array<uint64_t>("masks", masks);
+        uint32_t firstBit = params.find<uint32_t>("first_bit", 0);
+        if (firstBit + masks.size() > 64) {
+            Output out("", 1, 0, Output::STDOUT);
+            out.fatal(CALL_INFO, -1, "%s, Invalid param: 'first_bit' plus the number of 'masks' must be at most 64. You specified %" PRIu32 " and %zu masks.\n",
+                    getName().c_str(), firstBit, masks.size());
+        }
+        for (size_t i = 0; i < masks.size(); i++)
+            matrix_.setMask(firstBit + i, masks[i]);
+        matrix_.compile();
+    }
+
+    inline uint64_t hash(uint32_t ID, uint64_t value) {
+        return matrix_.apply(value);
+    }
+
+    void hashBatch(uint32_t ID, const uint64_t* values, uint64_t* results, size_t count) {
+        matrix_.apply(values, results, count);
+    }
+
+private:
+    XorHashMatrix matrix_;
+};
+
 }}
 #endif
 /* HASH_H */
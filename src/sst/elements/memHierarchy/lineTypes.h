@@ -16,6 +16,7 @@
 #ifndef MEMHIERARCHY_LINETYPES_H
 #define MEMHIERARCHY_LINETYPES_H
 
+#include <cstdio>
 #include <vector>
 
 #include <sst/core/output.h>
@@ -35,6 +36,8 @@ namespace SST { namespace MemHierarchy {
  * - getString() for debug
  * - getAddr() for identifiying a line
  * - getReplacementInfo() for returning the information that a replacement policy might need
+ * Lines in caches that can be checkpointed also need:
+ * - checkpoint()/restore() to write and read back the stable state of a valid line
  */
 
 
@@ -231,6 +234,17 @@ class CacheLine {
 
         virtual ReplacementInfo* getReplacementInfo() = 0;
 
+        // Checkpoint, the array saves the index and address. Return false on a short read/write
+        virtual bool checkpoint(FILE* fp) {
+            return fwrite(&state_, sizeof(state_), 1, fp) == 1 && fwrite(data_.data(), 1, data_.size(), fp) == data_.size();
+        }
+        virtual bool restore(FILE* fp) {
+            if (fread(&state_, sizeof(state_), 1, fp) != 1 || fread(data_.data(), 1, data_.size(), fp) != data_.size())
+                return false;
+            updateReplacement();
+            return true;
+        }
+
         // String-ify for debugging
         std::string getString() {
             std::ostringstream str;
@@ -238,6 +252,18 @@ class CacheLine {
             str << " State: " << StateString[state_];
             return str.str();
         }
+
+    protected:
+        static bool checkpointString(FILE* fp, const std::string &s) {
+            uint32_t len = s.size();
+            return fwrite(&len, sizeof(len), 1, fp) == 1 && fwrite(s.data(), 1, len, fp) == len;
+        }
+        static bool restoreString(FILE* fp, std::string &s) {
+            uint32_t len;
+            if (fread(&len, sizeof(len), 1, fp) != 1) return false;
+            s.resize(len);
+            return fread(&s[0], 1, len, fp) == len;
+        }
 };
 
 /* With atomic/lock flags for L1 caches */
@@ -370,6 +396,29 @@ class SharedCacheLine : public CacheLine {
         // Replacement
         ReplacementInfo * getReplacementInfo() { return info; }
 
+        // Checkpoint
+        bool checkpoint(FILE* fp) {
+            if (!CacheLine::checkpoint(fp) || !checkpointString(fp, owner_)) return false;
+            uint32_t count = sharers_.size();
+            if (fwrite(&count, sizeof(count), 1, fp) != 1) return false;
+            for (std::set<std::string>::iterator it = sharers_.begin(); it != sharers_.end(); it++) {
+                if (!checkpointString(fp, *it)) return false;
+            }
+            return true;
+        }
+        bool restore(FILE* fp) {
+            std::string owner;
+            uint32_t count;
+            if (!CacheLine::restore(fp) || !restoreString(fp, owner) || fread(&count, sizeof(count), 1, fp) != 1) return false;
+            if (!owner.empty()) setOwner(owner);
+            for (uint32_t i = 0; i < count; i++) {
+                std::string sharer;
+                if (!restoreString(fp, sharer)) return false;
+                addSharer(sharer);
+            }
+            return true;
+        }
+
         // String-ify for debugging
         std::string getString() {
             std::ostringstream str;
@@ -416,6 +465,18 @@ class PrivateCacheLine : public CacheLine {
         // Replacement
         ReplacementInfo * getReplacementInfo() { return info; }
 
+        // Checkpoint
+        bool checkpoint(FILE* fp) {
+            return CacheLine::checkpoint(fp) && fwrite(&shared, sizeof(shared), 1, fp) == 1 && fwrite(&owned, sizeof(owned), 1, fp) == 1;
+        }
+        bool restore(FILE* fp) {
+            bool s, o;
+            if (!CacheLine::restore(fp) || fread(&s, sizeof(s), 1, fp) != 1 || fread(&o, sizeof(o), 1, fp) != 1) return false;
+            setShared(s);
+            setOwned(o);
+            return true;
+        }
+
         // String-ify for debugging
         std::string getString() {
             std::string str = "O: ";
@@ -0,0 +1,144 @@
+#!/usr/bin/env python
+#
+# Copyright 2009-2024 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2024, NTESS
+# All rights reserved.
+#
+# Portions are copyright of other developers:
+# See the file CONTRIBUTORS.TXT in the top level directory
+# of the distribution for more information.
+#
+
+# Split a DRAMSim3 or Ramulator memory system into one memHierarchy
+# MemController per channel.
+#
+# The external models simulate every channel of a memory system inside one
+# backend, so one controller and one SST thread carries the whole system.
+# Here each channel gets its own controller with a single channel copy of
+# the model config, and the channels are interleaved through the
+# controllers' address regions (interleave_size/interleave_step), which is
+# what the memNICs steer requests by. Each controller can then land in its
+# own partition.
+#
+# From an SST input deck:
+#
+#   import memChannels
+#   mems = memChannels.build("memory", "dramsim3", "DDR4_8Gb_x16_3200.ini",
+#                            "2GiB", "4KiB", mcParams = { "clock" : "1.2GHz" })
+#   for mem in mems:
+#       nic = mem.setSubComponent("cpulink", "memHierarchy.MemNIC")
+#       ...
+#
+# From a shell, to see the split without building anything:
+#
+#   memChannels.py <dramsim3|ramulator> <config> <mem size> <interleave size> [output dir]
+
+import os
+import re
+import sys
+
+_units = { "" : 1, "B" : 1,
+           "KB" : 1000, "MB" : 1000**2, "GB" : 1000**3, "TB" : 1000**4,
+           "KiB" : 1024, "MiB" : 1024**2, "GiB" : 1024**3, "TiB" : 1024**4 }
+
+def toBytes(size):
+    """Bytes in an int or a string like "512MiB" """
+    if isinstance(size, int):
+        return size
+    m = re.match(r"^\s*(\d+)\s*([KMGT]i?B|B)?\s*$", size)
+    if not m:
+        raise ValueError("memChannels: cannot read size '%s'" % size)
+    return int(m.group(1)) * _units[m.group(2) or ""]
+
+# DRAMSim3 ini files say "channels = N" in [system], ramulator configs say
+# "channels = N" anywhere; both allow comments after the value
+_channelLine = re.compile(r"^(\s*channels\s*=\s*)(\d+)(.*)$")
+
+def readChannels(configFile):
+    """Number of channels the model config describes"""
+    with open(configFile) as f:
+        for line in f:
+            m = _channelLine.match(line)
+            if m:
+                return int(m.group(2))
+    raise ValueError("memChannels: no 'channels' setting in %s" % configFile)
+
+def writeChannelConfig(configFile, outFile):
+    """Copy configFile to outFile with a single channel"""
+    with open(configFile) as f:
+        lines = f.readlines()
+    with open(outFile, "w") as f:
+        for line in lines:
+            m = _channelLine.match(line)
+            if m:
+                line = m.group(1) + "1" + m.group(3) + "\n"
+            f.write(line)
+
+_backends = { "dramsim3" : "config_ini", "ramulator" : "configFile" }
+
+def split(backend, configFile, memSize, interleaveSize, outDir = ".", addrStart = 0):
+    """Write the single channel config and return, per channel, the
+    MemController params and the backend params"""
+    if backend not in _backends:
+        raise ValueError("memChannels: backend must be one of %s" % ", ".join(sorted(_backends)))
+
+    channels = readChannels(configFile)
+    total = toBytes(memSize)
+    interleave = toBytes(interleaveSize)
+    if total % (channels * interleave) != 0:
+        raise ValueError("memChannels: memory size must be a multiple of channels (%d) * interleave size" % channels)
+
+    if not os.path.isdir(outDir):
+        os.makedirs(outDir)
+    base, ext = os.path.splitext(os.path.basename(configFile))
+    channelConfig = os.path.join(outDir, base + "-1ch" + ext)
+    writeChannelConfig(configFile, channelConfig)
+
+    result = []
+    for channel in range(channels):
+        mcParams = {
+            "addr_range_start" : addrStart + channel * interleave,
+            "addr_range_end" : addrStart + total - 1,
+            "interleave_size" : "%dB" % interleave,
+            "interleave_step" : "%dB" % (channels * interleave),
+        }
+        backendParams = {
+            "mem_size" : "%dB" % (total // channels),
+            _backends[backend] : channelConfig,
+        }
+        if backend == "dramsim3":
+            # DRAMSim3 names its output files after the config, give each channel its own directory
+            channelDir = os.path.join(outDir, "channel%d" % channel)
+            if not os.path.isdir(channelDir):
+                os.makedirs(channelDir)
+            backendParams["output_dir"] = channelDir
+        result.append((mcParams, backendParams))
+    return result
+
+def build(name, backend, configFile, memSize, interleaveSize, mcParams = {}, backendParams = {}, outDir = ".", addrStart = 0):
+    """Create one MemController per channel, named name<channel>, and return them"""
+    import sst
+
+    mems = []
+    for channel, (mcp, bep) in enumerate(split(backend, configFile, memSize, interleaveSize, outDir, addrStart)):
+        mem = sst.Component("%s%d" % (name, channel), "memHierarchy.MemController")
+        mem.addParams(mcParams)
+        mem.addParams(mcp)
+        be = mem.setSubComponent("backend", "memHierarchy." + backend)
+        be.addParams(backendParams)
+        be.addParams(bep)
+        mems.append(mem)
+    return mems
+
+if __name__ == "__main__":
+    if len(sys.argv) not in (5, 6):
+        print("Usage: %s <dramsim3|ramulator> <config> <mem size> <interleave size> [output dir]" % sys.argv[0])
+        sys.exit(1)
+    outDir = sys.argv[5] if len(sys.argv) == 6 else "."
+    for channel, (mcp, bep) in enumerate(split(sys.argv[1], sys.argv[2], sys.argv[3], sys.argv[4], outDir)):
+        print("channel %d" % channel)
+        print("  controller: %s" % mcp)
+        print("  backend:    %s" % bep)
@@ -21,6 +21,8 @@
 #include <sst/core/event.h>
 #include <sst/core/warnmacros.h>
 
+#include <algorithm>
+
 #include "sst/elements/memHierarchy/util.h"
 #include "sst/elements/memHierarchy/memEventBase.h"
 #include "sst/elements/memHierarchy/memTypes.h"
@@ -29,6 +31,86 @@ namespace SST { namespace MemHierarchy {
 
 using namespace std;
 
+/**
+ * Per-thread cache of payload buffers.
+ * Most payloads are a single cache line so recycling their storage removes the heap allocation
+ * from nearly every data-carrying event. Buffers larger than maxBufferSize are not kept.
+ */
+class PayloadPool {
+public:
+    /* Make sure an empty buffer has capacity for size bytes, reusing a pooled buffer if possible */
+    static void acquire(MemEventBase::dataVec& vec, size_t size) {
+        if (vec.capacity() >= size) return;
+        std::vector<MemEventBase::dataVec>& list = freelist();
+        if (vec.empty() && !list.empty() && list.back().capacity() >= size) {
+            vec.swap(list.back());
+            list.pop_back();
+        } else {
+            vec.reserve(size);
+        }
+    }
+
+    /* Return a buffer's storage to the pool, leaving it empty */
+    static void release(MemEventBase::dataVec& vec) {
+        if (vec.capacity() == 0) return;
+        std::vector<MemEventBase::dataVec>& list = freelist();
+        if (vec.capacity() > maxBufferSize || list.size() >= maxBuffers) {
+            MemEventBase::dataVec().swap(vec);
+            return;
+        }
+        vec.clear();
+        list.push_back(std::move(vec));
+    }
+
+private:
+    static const size_t maxBuffers = 4096;
+    static const size_t maxBufferSize = 4096;
+
+    // Intentionally never destroyed so events deleted during teardown can still release their buffers
+    static std::vector<MemEventBase::dataVec>& freelist() {
+        thread_local std::vector<MemEventBase::dataVec>* list = new std::vector<MemEventBase::dataVec>();
+        return *list;
+    }
+};
+
+/**
+ * MemEvent payload. Behaves as a dataVec but draws its storage from the PayloadPool
+ * when copied or grown from empty and returns it when destroyed.
+ */
+class MemEventPayload : public MemEventBase::dataVec {
+public:
+    MemEventPayload() : MemEventBase::dataVec() { }
+    MemEventPayload(const MemEventPayload& o) : MemEventBase::dataVec() {
+        PayloadPool::acquire(*this, o.size());
+        assign(o.begin(), o.end());
+    }
+    MemEventPayload(MemEventPayload&& o) = default;
+    ~MemEventPayload() { PayloadPool::release(*this); }
+
+    MemEventPayload& operator=(const MemEventPayload& o) {
+        return operator=(static_cast<const MemEventBase::dataVec&>(o));
+    }
+    MemEventPayload& operator=(const MemEventBase::dataVec& o) {
+        if (this != &o) {
+            clear();
+            PayloadPool::acquire(*this, o.size());
+            assign(o.begin(), o.end());
+        }
+        return *this;
+    }
+    MemEventPayload& operator=(MemEventBase::dataVec&& o) {
+        PayloadPool::release(*this);
+        MemEventBase::dataVec::operator=(std::move(o));
+        return *this;
+    }
+
+    /* Resize, drawing storage from the pool if currently empty */
+    void resize(size_t size, uint8_t value = 0) {
+        PayloadPool::acquire(*this, size);
+        MemEventBase::dataVec::resize(size, value);
+    }
+};
+
 /**
  * Interface Event used to represent Memory-based communication.
  *
@@ -210,16 +292,24 @@ public:
         payload_ = data;
     }
 
+    /** Sets the data payload and payload size.
+     * @param[in] data  Vector whose storage is moved into the payload
+     */
+    void setPayload(std::vector<uint8_t>&& data) {
+        setSize(data.size());
+        payload_ = std::move(data);
+    }
+
     /** Sets the data payload and payload size.
      * @param[in] size  How many bytes to copy from data
      * @param[in] data  Data array to set as payload
      */
     void setPayload(uint32_t size, uint8_t* data) {
         setSize(size);
+        payload_.clear();
+        if (size == 0) return;
         payload_.resize(size);
-        for ( uint32_t i = 0 ; i < size ; i++ ) {
-            payload_[i] = data[i];
-        }
+        std::copy(data, data + size, payload_.begin());
     }
 
     void setZeroPayload(uint32_t size) {
@@ -316,7 +406,7 @@ private:
     bool            addrGlobal_;        // Whether address is a local or global address
     MemEvent*       NACKedEvent_;       // For a NACK, pointer to the NACKed event
     int             retries_;           // For NACKed events, how many times a retry has been sent
-    dataVec         payload_;           // Data
+    MemEventPayload payload_;           // Data
     bool            prefetch_;          // Whether this request came from a prefetcher
     bool            dirty_;             // For a replacement, whether the data is dirty or not
     bool            isEvict_;           // Whether an event is an eviction
@@ -334,7 +424,7 @@ public:
         ser & addrGlobal_;
         ser & NACKedEvent_;
         ser & retries_;
-        ser & payload_;
+        ser & static_cast<dataVec&>(payload_);
         ser & prefetch_;
         ser & dirty_;
         ser & isEvict_;
@@ -18,15 +18,98 @@
 
 #include <sst/core/sst_types.h>
 #include <sst/core/event.h>
+#include <sst/core/output.h>
 #include <sst/core/warnmacros.h>
 
+#include <atomic>
+#include <mutex>
+#include <unordered_map>
+
 #include "sst/elements/memHierarchy/util.h"
 #include "sst/elements/memHierarchy/memTypes.h"
+#include "sst/elements/memHierarchy/memEventPool.h"
 
 namespace SST { namespace MemHierarchy {
 
 using namespace std;
 
+/**
+ * Compact identifier for a named endpoint (a component name used as an event source/destination)
+ * Events carry these instead of name strings; the registry maps them back to names for debug output
+ * and for the paths that still look up endpoints by name. Ids are assigned on first use and are local
+ * to a process, so events crossing a rank boundary still serialize the name.
+ */
+typedef uint32_t EndpointId;
+
+class EndpointRegistry {
+public:
+    /** Return the id for a name, assigning one if the name has not been seen before */
+    static EndpointId intern(const std::string& name) {
+        thread_local std::unordered_map<std::string, EndpointId> cache;
+        std::unordered_map<std::string, EndpointId>::const_iterator it = cache.find(name);
+        if (it != cache.end())
+            return it->second;
+        EndpointId id = instance().insert(name);
+        cache.insert(std::make_pair(name, id));
+        return id;
+    }
+
+    /** Return the name for an id */
+    static const std::string& name(EndpointId id) {
+        return instance().chunks_[id >> chunkBits].load(std::memory_order_acquire)[id & chunkMask];
+    }
+
+    ~EndpointRegistry() {
+        for (uint32_t i = 0; i < maxChunks; i++)
+            delete [] chunks_[i].load();
+    }
+
+private:
+    static const uint32_t chunkBits = 10;
+    static const uint32_t chunkMask = (1 << chunkBits) - 1;
+    static const uint32_t maxChunks = 1 << 12;
+
+    std::mutex lock_;
+    std::unordered_map<std::string, EndpointId> ids_;
+    std::atomic<std::string*> chunks_[maxChunks]; // Names never move once stored so lookups don't need the lock
+    EndpointId next_;
+
+    EndpointRegistry() : next_(0) {
+        for (uint32_t i = 0; i < maxChunks; i++)
+            chunks_[i].store(nullptr);
+        insert(NONE); // Id 0 is always NONE
+    }
+
+    static EndpointRegistry& instance() {
+        static EndpointRegistry registry;
+        return registry;
+    }
+
+    EndpointId insert(const std::string& name) {
+        std::lock_guard<std::mutex> guard(lock_);
+        std::unordered_map<std::string, EndpointId>::const_iterator it = ids_.find(name);
+        if (it != ids_.end())
+            return it->second;
+
+        EndpointId id = next_;
+        if ((id >> chunkBits) >= maxChunks) {
+            Output::getDefaultObject().fatal(CALL_INFO, -1, "EndpointRegistry: Too many endpoint names registered (%" PRIu32 ") while adding '%s'\n",
+                    id, name.c_str());
+        }
+        std::string* chunk = chunks_[id >> chunkBits].load(std::memory_order_relaxed);
+        if (chunk == nullptr) {
+            chunk = new std::string[chunkMask + 1];
+            chunk[id & chunkMask] = name;
+            chunks_[id >> chunkBits].store(chunk, std::memory_order_release);
+        } else {
+            chunk[id & chunkMask] = name;
+        }
+        ids_.insert(std::make_pair(name, id));
+        next_++;
+        return id;
+    }
+};
+
 /**
  * Base class for memH events
  *
@@ -43,20 +126,22 @@ public:
     static const uint32_t F_FAIL            = 0x00001000;
     static const uint32_t F_NORESPONSE      = 0x00010000;
 
+    MEMH_EVENT_POOL_OPERATORS
+
 
     /** Creates a new MemEventBase */
     MemEventBase(std::string src, Command cmd) : SST::Event() {
         setDefaults();
         cmd_ = cmd;
-        src_ = src;
+        src_ = EndpointRegistry::intern(src);
     }
 
     virtual void setDefaults() {
         eventID_        = generateUniqueId();  // Defined in SST::Event
         responseToID_   = NO_ID;
-        dst_            = NONE;
-        src_            = NONE;
-        rqstr_          = NONE;
+        dst_            = 0;    // NONE
+        src_            = 0;
+        rqstr_          = 0;
         cmd_            = Command::NULLCMD;
         flags_          = 0;
         memFlags_       = 0;
@@ -98,19 +183,31 @@ public:
     void setCmd(Command newcmd) { cmd_ = newcmd; }
 
     /** @return the source string - who sent this MemEvent */
-    const std::string& getSrc(void) const { return src_; }
+    const std::string& getSrc(void) const { return EndpointRegistry::name(src_); }
     /** Sets the source string - who sent this MemEvent */
-    void setSrc(const std::string& src) { src_ = src; }
+    void setSrc(const std::string& src) { src_ = EndpointRegistry::intern(src); }
+    /** @return the source endpoint id */
+    EndpointId getSrcId(void) const { return src_; }
+    /** Sets the source endpoint id */
+    void setSrcId(EndpointId src) { src_ = src; }
 
     /** @return the destination string - who receives this MemEvent */
-    const std::string& getDst(void) const { return dst_; }
+    const std::string& getDst(void) const { return EndpointRegistry::name(dst_); }
     /** Sets the destination string - who received this MemEvent */
-    void setDst(const std::string& dst) { dst_ = dst; }
+    void setDst(const std::string& dst) { dst_ = EndpointRegistry::intern(dst); }
+    /** @return the destination endpoint id */
+    EndpointId getDstId(void) const { return dst_; }
+    /** Sets the destination endpoint id */
+    void setDstId(EndpointId dst) { dst_ = dst; }
 
     /** @return the requestor string - whose original request caused this MemEvent */
-    const std::string& getRqstr(void) const { return rqstr_; }
+    const std::string& getRqstr(void) const { return EndpointRegistry::name(rqstr_); }
     /** Sets the requestor string - whose original request caused this MemEvent */
-    void setRqstr(const std::string& rqstr) { rqstr_ = rqstr; }
+    void setRqstr(const std::string& rqstr) { rqstr_ = EndpointRegistry::intern(rqstr); }
+    /** @return the requestor endpoint id */
+    EndpointId getRqstrId(void) const { return rqstr_; }
+    /** Sets the requestor endpoint id */
+    void setRqstrId(EndpointId rqstr) { rqstr_ = rqstr; }
 
     /** @return the thread ID that originated the original request */
     [[deprecated("Use getThreadID() instead (with capital 'D')")]]
@@ -182,7 +279,7 @@ public:
         std::string cmdStr(CommandString[(int)cmd_]);
         std::ostringstream str;
         str << " Flags: " << getFlagString();
-        return idstring.str() + cmdStr + " Src: " + src_ + " Dst: " + dst_ + " Rq: " + rqstr_ + " Tid: " + std::to_string(tid_) + str.str();
+        return idstring.str() + cmdStr + " Src: " + getSrc() + " Dst: " + getDst() + " Rq: " + getRqstr() + " Tid: " + std::to_string(tid_) + str.str();
     }
 
     /** Get brief print of the event */
@@ -190,7 +287,7 @@ public:
         std::string cmdStr(CommandString[(int)cmd_]);
         std::ostringstream idstring;
         idstring << "<" << eventID_.first << "," << eventID_.second << "> ";
-        return idstring.str() + cmdStr + " Src: " + src_ + " Dst: " + dst_ + " Tid: " + std::to_string(tid_);
+        return idstring.str() + cmdStr + " Src: " + getSrc() + " Dst: " + getDst() + " Tid: " + std::to_string(tid_);
     }
     
     /** Get brief print of the event */
@@ -198,7 +295,7 @@ public:
         std::string cmdStr(CommandString[(int)cmd_]);
         std::ostringstream idstring;
         idstring << "<" << eventID_.first << "," << eventID_.second << "> ";
-        return idstring.str() + cmdStr + " Src: " + src_ + " Dst: " + dst_ + " Tid: " + std::to_string(tid_);
+        return idstring.str() + cmdStr + " Src: " + getSrc() + " Dst: " + getDst() + " Tid: " + std::to_string(tid_);
     }
 
     virtual bool doDebug(std::set<Addr> &UNUSED(addr)) {
@@ -220,9 +317,9 @@ public:
 protected:
     id_type         eventID_;           // Unique ID for this event
     id_type         responseToID_;      // For responses, holds the ID to which this event matches
-    string          src_;               // Source ID
-    string          dst_;               // Destination ID
-    string          rqstr_;             // Cache that originated this request
+    EndpointId      src_;               // Source ID
+    EndpointId      dst_;               // Destination ID
+    EndpointId      rqstr_;             // Cache that originated this request
     uint32_t        tid_;               // Thread ID that originated this request
     Command         cmd_;               // Command
     uint32_t        flags_;
@@ -235,9 +332,16 @@ public:
         Event::serialize_order(ser);
         ser & eventID_;
         ser & responseToID_;
-        ser & src_;
-        ser & dst_;
-        ser & rqstr_;
+        // Endpoint ids are process-local so serialize by name
+        std::string src = getSrc();
+        std::string dst = getDst();
+        std::string rqstr = getRqstr();
+        ser & src;
+        ser & dst;
+        ser & rqstr;
+        src_ = EndpointRegistry::intern(src);
+        dst_ = EndpointRegistry::intern(dst);
+        rqstr_ = EndpointRegistry::intern(rqstr);
         ser & tid_;
         ser & cmd_;
         ser & flags_;
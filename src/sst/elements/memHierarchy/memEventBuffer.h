@@ -0,0 +1,80 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef MEMHIERARCHY_MEMEVENTBUFFER_H
+#define MEMHIERARCHY_MEMEVENTBUFFER_H
+
+#include <cstddef>
+#include <deque>
+
+namespace SST { namespace MemHierarchy {
+
+/*
+ * FIFO of events waiting to be handled by a controller's clock
+ *
+ * Controllers walk these every cycle, handling what they can and keeping the rest in order.
+ * scan() does that walk with a single compaction pass over contiguous storage instead of
+ * per-element list erases. Entries appended while a scan is in progress are visited by the
+ * same scan, matching the list-based behavior.
+ */
+template <class T>
+class MemEventBuffer {
+public:
+    enum class Scan { Keep, Remove, Stop };
+
+    typedef typename std::deque<T>::iterator iterator;
+    typedef typename std::deque<T>::const_iterator const_iterator;
+
+    void push_back(const T& entry) { buffer_.push_back(entry); }
+
+    size_t size() const { return buffer_.size(); }
+    bool empty() const { return buffer_.empty(); }
+
+    iterator begin() { return buffer_.begin(); }
+    iterator end() { return buffer_.end(); }
+    const_iterator begin() const { return buffer_.begin(); }
+    const_iterator end() const { return buffer_.end(); }
+
+    /* Call handler(entry) on entries in order until it returns Scan::Stop.
+     * Entries for which it returns Scan::Remove are dropped, all others are kept in order.
+     */
+    template <class F>
+    void scan(F handler) {
+        size_t keep = 0;
+        size_t index = 0;
+        for (; index < buffer_.size(); index++) {
+            Scan action = handler(buffer_[index]);
+            if (action == Scan::Stop)
+                break;
+            if (action == Scan::Keep) {
+                if (keep != index)
+                    buffer_[keep] = buffer_[index];
+                keep++;
+            }
+        }
+        if (keep == index)
+            return; // Nothing removed
+        for (; index < buffer_.size(); index++, keep++)
+            buffer_[keep] = buffer_[index];
+        buffer_.resize(keep);
+    }
+
+private:
+    std::deque<T> buffer_;
+};
+
+}}
+
+#endif
@@ -0,0 +1,37 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef MEMHIERARCHY_MEMEVENTPOOL_H
+#define MEMHIERARCHY_MEMEVENTPOOL_H
+
+#include "sst/elements/pool/objectPool.h"
+
+namespace SST { namespace MemHierarchy {
+
+/*
+ * Element object pool shared by memHierarchy events (see
+ * sst/elements/pool/objectPool.h).
+ *
+ * Event classes opt in with MEMH_EVENT_POOL_OPERATORS. Because deserialization
+ * constructs events with 'new' these also cover events received from other ranks.
+ * Other short-lived, non-serialized objects may call allocate/deallocate directly.
+ */
+class MemEventPool : public SST::ElementPool::ObjectPool<MemEventPool> { };
+
+}}
+
+#define MEMH_EVENT_POOL_OPERATORS SST_ELEMENT_POOL_OPERATORS(SST::MemHierarchy::MemEventPool)
+
+#endif
@@ -149,8 +149,10 @@ MemEventInit * MemLink::recvInitData() {
 }
 
 void MemLink::addRemote(EndpointInfo info) {
+    info.eid = EndpointRegistry::intern(info.name);
     remotes.insert(info);
     remoteNames.insert(info.name);
+    remoteIds.insert(info.eid);
 }
 
 void MemLink::addEndpoint(EndpointInfo info) {
@@ -219,6 +221,10 @@ bool MemLink::isReachable(std::string dst) {
    return remoteNames.find(dst) != remoteNames.end();
 }
 
+bool MemLink::isReachable(EndpointId dst) {
+   return remoteIds.find(dst) != remoteIds.end();
+}
+
 std::string MemLink::getAvailableDestinationsAsString() {
     std::stringstream str;
     for (std::set<EndpointInfo>::const_iterator it = endpoints.begin(); it != endpoints.end(); it++) {
@@ -104,6 +104,7 @@ public:
     virtual std::string findTargetDestination(Addr addr);
     virtual std::string getTargetDestination(Addr addr);
     virtual bool isReachable(std::string dst);
+    virtual bool isReachable(EndpointId dst);
 
     /* Send and receive functions for MemLink */
     virtual void sendInitData(MemEventInit * ev, bool broadcast = true);
@@ -128,6 +129,7 @@ protected:
     std::set<EndpointInfo> remotes;             // Tracks remotes immediately accessible on the other side of our link
     std::set<EndpointInfo> endpoints;           // Tracks endpoints in the system with info on how to get there
     std::set<std::string> remoteNames;          // Tracks remote names for faster lookup than iteratinv via remotes
+    std::unordered_set<EndpointId> remoteIds;   // Same as remoteNames but by endpoint id, for the event path
     
     // For events that require destination names during init
     std::set<MemEventInit*> initSendQ;
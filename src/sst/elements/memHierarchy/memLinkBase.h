@@ -55,6 +55,7 @@ public:
         uint64_t addr;      /* Component address */
         uint32_t id;        /* Which memory level or group this component belongs to - for determining which components are sources or destinations */
         MemRegion region;   /* Address region associated with this component */
+        EndpointId eid = 0; /* Interned name, filled in by the link when the endpoint is recorded. Not part of ordering */
 
         bool operator<(const EndpointInfo &o) const {
             if (region != o.region) {
@@ -188,6 +189,7 @@ public:
     virtual bool isDest(std::string UNUSED(str)) =0;    /* Check whether a component is a destination on this link. May be slow (for init() only) */
     virtual bool isSource(std::string UNUSED(str)) =0;  /* Check whether a component is a soruce on this link. May be slow (for init() only) */
     virtual bool isReachable(std::string dst) =0;       /* Check whether a component is reachable on this link. Should be fast - used during simulation */
+    virtual bool isReachable(EndpointId dst) { return isReachable(EndpointRegistry::name(dst)); } /* As above, by endpoint id */
 
     MemRegion getRegion() { return info.region; }
     void setRegion(MemRegion region) { info.region = region; }
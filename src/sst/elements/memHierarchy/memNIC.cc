@@ -59,6 +59,7 @@ MemNIC::MemNIC(ComponentId_t id, Params &params, TimeConverter* tc) : MemNICBase
 
     clockHandler = new Clock::Handler<MemNIC>(this, &MemNIC::clock);
     clockTC = registerClock(tc, clockHandler);
+    clockOn = true;
 }
 
 void MemNIC::init(unsigned int phase) {
@@ -72,7 +73,10 @@ void MemNIC::init(unsigned int phase) {
  */
 bool MemNIC::clock(SimTime_t cycle) {
     drainQueue(&sendQueue, link_control);
-    if (sendQueue.empty()) return true; /* turn off clock */
+    if (sendQueue.empty()) {
+        clockOn = false;
+        return true; /* turn off clock */
+    }
     return false;
 }
 
@@ -99,10 +103,10 @@ bool MemNIC::recvNotify(int) {
 
 /* Send event to memNIC */
 void MemNIC::send(MemEventBase *ev) {
-    SimpleNetwork::Request *req = new SimpleNetwork::Request();
+    SimpleNetwork::Request *req = requestRecycler.get();
     MemRtrEvent * mre = new MemRtrEvent(ev);
     req->src = info.addr;
-    req->dest = lookupNetworkAddress(ev->getDst());
+    req->dest = lookupNetworkAddress(ev);
     req->size_in_bits = getSizeInBits(ev);
     req->vn = 0;
 
@@ -116,8 +120,10 @@ void MemNIC::send(MemEventBase *ev) {
     //printf("%s, %" PRIu64 ", Receive %s, 0x%" PRIx64 "\n", getName().c_str(), getCurrentSimTime("1ps"), CommandString[(int)ev->getCmd()], ev->getRoutingAddress() );
     if (sendQueue.size() == 1)
         drainQueue(&sendQueue, link_control);
-    if (sendQueue.size() == 1) /* Attempt again in 1 cycle */
+    if (!sendQueue.empty() && !clockOn) { /* Attempt again in 1 cycle */
+        clockOn = true;
         reregisterClock(clockTC, clockHandler);
+    }
 }
 
 
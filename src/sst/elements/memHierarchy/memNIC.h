@@ -111,6 +111,7 @@ private:
     // Clocks
     Clock::Handler<MemNIC>* clockHandler;
     TimeConverter* clockTC;
+    bool clockOn;   // Whether clockHandler is registered; it only runs while sendQueue is non-empty
 };
 
 } //namespace memHierarchy
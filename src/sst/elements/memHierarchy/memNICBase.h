@@ -18,12 +18,16 @@
 
 #include <string>
 #include <unordered_map>
+#include <unordered_set>
 #include <queue>
+#include <vector>
+#include <algorithm>
 
 #include <sst/core/event.h>
 #include <sst/core/output.h>
 #include <sst/core/subcomponent.h>
 #include <sst/core/interfaces/simpleNetwork.h>
+#include <sst/elements/pool/requestRecycler.h>
 
 #include "sst/elements/memHierarchy/memEventBase.h"
 #include "sst/elements/memHierarchy/util.h"
@@ -59,6 +63,8 @@ class MemNICBase : public MemLinkBase {
             protected:
                 MemEventBase * event;
             public:
+                MEMH_EVENT_POOL_OPERATORS
+
                 MemRtrEvent() : Event(), event(nullptr) { }
                 MemRtrEvent(MemEventBase * ev) : Event(), event(ev) { }
                 ~MemRtrEvent() {
@@ -204,10 +210,23 @@ class MemNICBase : public MemLinkBase {
         virtual std::set<EndpointInfo>* getDests() { return &destEndpointInfo; }
         
         virtual std::string findTargetDestination(Addr addr) {
+            const EndpointInfo* dst = findTargetEndpoint(addr);
+            return dst ? dst->name : "";
+        }
+
+        /* Return the destination endpoint owning addr or nullptr if none found.
+         * Once setup() has run this uses the prebuilt route index; before that it scans destEndpointInfo
+         */
+        const EndpointInfo* findTargetEndpoint(Addr addr) {
+            if (routeIndexEnabled) {
+                if (!routeIndexValid)
+                    buildRouteIndex();
+                return lookupRouteIndex(addr);
+            }
             for (std::set<EndpointInfo>::const_iterator it = destEndpointInfo.begin(); it != destEndpointInfo.end(); it++) {
-                if (it->region.contains(addr)) return it->name;
+                if (it->region.contains(addr)) return &(*it);
             }
-            return "";
+            return nullptr;
         }
 
         virtual std::string getTargetDestination(Addr addr) {
@@ -229,6 +248,10 @@ class MemNICBase : public MemLinkBase {
         virtual bool isReachable(std::string dst) {
             return reachableNames.find(dst) != reachableNames.end();
         }
+
+        virtual bool isReachable(EndpointId dst) {
+            return reachableIds.find(dst) != reachableIds.end();
+        }
         
         virtual std::string getAvailableDestinationsAsString() {
             stringstream str;
@@ -241,12 +264,17 @@ class MemNICBase : public MemLinkBase {
 
     protected:
         virtual void addSource(EndpointInfo info) { 
+            info.eid = EndpointRegistry::intern(info.name);
             sourceEndpointInfo.insert(info);
             reachableNames.insert(info.name);
+            reachableIds.insert(info.eid);
         }
         virtual void addDest(EndpointInfo info) { 
+            info.eid = EndpointRegistry::intern(info.name);
             destEndpointInfo.insert(info); 
             reachableNames.insert(info.name);
+            reachableIds.insert(info.eid);
+            routeIndexValid = false;
         }
 
         virtual void addEndpoint(EndpointInfo info) { endpointInfo.insert(info); }
@@ -321,6 +349,7 @@ class MemNICBase : public MemLinkBase {
                 if (imre) {
                     // Record name->address map for all other endpoints
                     networkAddressMap.insert(std::make_pair(imre->info.name, imre->info.addr));
+                    networkAddressIdMap.insert(std::make_pair(EndpointRegistry::intern(imre->info.name), imre->info.addr));
                     processInitMemRtrEvent(imre);
                     delete imre;
                 } else {
@@ -396,6 +425,7 @@ class MemNICBase : public MemLinkBase {
                                 epInfo.name = it->name;
                                 epInfo.addr = it->addr;
                                 epInfo.id = it->id;
+                                epInfo.eid = it->eid;
                                 epInfo.region = (*mt);
                                 newDests.insert(epInfo);
                             }
@@ -406,6 +436,8 @@ class MemNICBase : public MemLinkBase {
                 }
             }
             destEndpointInfo = newDests;
+            routeIndexEnabled = true;
+            buildRouteIndex();
 
             // This algorithm can take an extremely long time for some memory configurations.
             if (range_check > 0) {
@@ -453,6 +485,23 @@ class MemNICBase : public MemLinkBase {
             }
         }
 
+        // Lookup the network address for an event's destination
+        // The route index already knows the network address of the endpoint that owns the event's routing address,
+        // so use that when it is the event's destination and only fall back to the id map otherwise (e.g., responses)
+        uint64_t lookupNetworkAddress(MemEventBase* ev) {
+            EndpointId dst = ev->getDstId();
+            if (routeIndexEnabled) {
+                const EndpointInfo* ep = findTargetEndpoint(ev->getRoutingAddress());
+                if (ep && ep->eid == dst)
+                    return ep->addr;
+            }
+            std::unordered_map<EndpointId,uint64_t>::const_iterator it = networkAddressIdMap.find(dst);
+            if (it == networkAddressIdMap.end()) {
+                dbg.fatal(CALL_INFO, -1, "%s (MemNICBase), Network address for destination '%s' not found in networkAddressMap.\n", getName().c_str(), ev->getDst().c_str());
+            }
+            return it->second;
+        }
+
         // Lookup the network address for a given endpoint
         virtual uint64_t lookupNetworkAddress(const std::string &dst) const {
             std::unordered_map<std::string,uint64_t>::const_iterator it = networkAddressMap.find(dst);
@@ -504,7 +553,7 @@ class MemNICBase : public MemLinkBase {
             SST::Interfaces::SimpleNetwork::Request* req = linkcontrol->recv(0);
             if (req != nullptr) {
                 MemRtrEvent * mre = static_cast<MemRtrEvent*>(req->takePayload());
-                delete req;
+                requestRecycler.recycle(req);
 
                 if (mre->hasClientData()) {
                     return mre;
@@ -531,22 +580,131 @@ class MemNICBase : public MemLinkBase {
 
         // Data structures
         std::unordered_map<std::string,uint64_t> networkAddressMap; // Map of name -> address for each network endpoint
+        std::unordered_map<EndpointId,uint64_t> networkAddressIdMap; // Same as networkAddressMap but keyed by endpoint id
         std::set<EndpointInfo> sourceEndpointInfo;
         std::set<EndpointInfo> destEndpointInfo;
         std::set<EndpointInfo> endpointInfo;
-        std::set<std::string> reachableNames;
+        std::unordered_set<std::string> reachableNames;
+        std::unordered_set<EndpointId> reachableIds;
+
+        /* Route index mapping an address to its destination endpoint, built at the end of init.
+         * Non-interleaved regions are kept sorted by start address and binary searched. Interleaved regions
+         * that share an interleave size and step are collapsed into a group with one slot per interleave chunk
+         * so that the owner is found with a single modulo. Anything that does not fit either form is scanned.
+         * Pointers reference entries in destEndpointInfo so the index is invalidated whenever it changes.
+         */
+        struct RouteGroup {
+            Addr base;      // Lowest start address in the group
+            Addr step;      // Shared interleave step
+            Addr size;      // Shared interleave size
+            std::vector<const EndpointInfo*> slots; // (step / size) slots, nullptr if no endpoint owns the chunk
+        };
+        std::vector<const EndpointInfo*> routeRanges;   // Non-interleaved, sorted by region.start, non-overlapping
+        std::vector<RouteGroup> routeGroups;
+        std::vector<const EndpointInfo*> routeOther;
+        bool routeIndexEnabled = false; // Set once setup() has finalized destEndpointInfo
+        bool routeIndexValid = false;
 
         // Init queues
         std::queue<MemRtrEvent*> initQueue; // Queue for received init events
         std::queue<SST::Interfaces::SimpleNetwork::Request*> initSendQueue; // Queue of events waiting to be sent after network (linkcontrol) initializes
         std::set<MemEventInit*> initWaitForDst; // Set of events with unknown destinations    
 
+        // Requests emptied on receive, reused by send()
+        SST::ElementPool::RequestRecycler requestRecycler;
+
         // Other parameters
         std::unordered_set<uint32_t> sourceIDs, destIDs; // IDs which this endpoint cares about
         uint32_t range_check = true; // Enable overlapping range check
 
     private:
 
+        static const size_t maxRouteGroupSlots = 1 << 16;
+
+        void buildRouteIndex() {
+            routeRanges.clear();
+            routeGroups.clear();
+            routeOther.clear();
+
+            for (std::set<EndpointInfo>::const_iterator it = destEndpointInfo.begin(); it != destEndpointInfo.end(); it++) {
+                const MemRegion& reg = it->region;
+                if (reg.interleaveSize == 0) {
+                    routeRanges.push_back(&(*it));
+                    continue;
+                }
+                if (reg.interleaveSize >= reg.interleaveStep || reg.interleaveStep % reg.interleaveSize != 0
+                        || reg.interleaveStep / reg.interleaveSize > maxRouteGroupSlots) {
+                    routeOther.push_back(&(*it));
+                    continue;
+                }
+                RouteGroup* group = nullptr;
+                for (auto gt = routeGroups.begin(); gt != routeGroups.end(); gt++) {
+                    if (gt->step == reg.interleaveStep && gt->size == reg.interleaveSize) {
+                        group = &(*gt);
+                        break;
+                    }
+                }
+                if (!group) {
+                    routeGroups.push_back(RouteGroup());
+                    group = &routeGroups.back();
+                    group->base = reg.start;
+                    group->step = reg.interleaveStep;
+                    group->size = reg.interleaveSize;
+                } else if (reg.start < group->base) {
+                    group->base = reg.start;
+                }
+                group->slots.push_back(&(*it)); // Placed into slots below once the base is known
+            }
+
+            // Overlapping plain ranges cannot be binary searched, leave those for the scan
+            std::sort(routeRanges.begin(), routeRanges.end(),
+                    [](const EndpointInfo* a, const EndpointInfo* b) { return a->region.start < b->region.start; });
+            std::vector<const EndpointInfo*> ranges;
+            for (auto it = routeRanges.begin(); it != routeRanges.end(); it++) {
+                if (!ranges.empty() && ranges.back()->region.end >= (*it)->region.start) {
+                    routeOther.push_back(*it);
+                } else {
+                    ranges.push_back(*it);
+                }
+            }
+            routeRanges.swap(ranges);
+
+            for (auto gt = routeGroups.begin(); gt != routeGroups.end(); gt++) {
+                std::vector<const EndpointInfo*> members;
+                members.swap(gt->slots);
+                gt->slots.assign(gt->step / gt->size, nullptr);
+                for (auto mt = members.begin(); mt != members.end(); mt++) {
+                    Addr offset = ((*mt)->region.start - gt->base) % gt->step;
+                    if (offset % gt->size != 0 || gt->slots[offset / gt->size] != nullptr) {
+                        routeOther.push_back(*mt);
+                    } else {
+                        gt->slots[offset / gt->size] = *mt;
+                    }
+                }
+            }
+
+            routeIndexValid = true;
+        }
+
+        const EndpointInfo* lookupRouteIndex(Addr addr) const {
+            if (!routeRanges.empty()) {
+                auto it = std::upper_bound(routeRanges.begin(), routeRanges.end(), addr,
+                        [](Addr a, const EndpointInfo* ep) { return a < ep->region.start; });
+                if (it != routeRanges.begin() && (*std::prev(it))->region.end >= addr)
+                    return *std::prev(it);
+            }
+            for (auto gt = routeGroups.begin(); gt != routeGroups.end(); gt++) {
+                if (addr < gt->base) continue;
+                const EndpointInfo* ep = gt->slots[((addr - gt->base) % gt->step) / gt->size];
+                if (ep && ep->region.contains(addr))
+                    return ep;
+            }
+            for (auto it = routeOther.begin(); it != routeOther.end(); it++) {
+                if ((*it)->region.contains(addr)) return *it;
+            }
+            return nullptr;
+        }
+
         void build(Params& params) {
             // Get source/destination parameters
             // Each NIC has a group ID and talks to those with IDs in sources and destinations
@@ -99,13 +99,11 @@ void MemNICFour::setup() {
     MemNICBase::setup();
 
     for (std::set<EndpointInfo>::iterator it = sourceEndpointInfo.begin(); it != sourceEndpointInfo.end(); it++) {
-        recvTags[it->addr] = 0;
-        sendTags[it->addr] = 0;
+        getOrderState(it->addr);
     }
 
     for (std::set<EndpointInfo>::iterator it = destEndpointInfo.begin(); it != destEndpointInfo.end(); it++) {
-        recvTags[it->addr] = 0;
-        sendTags[it->addr] = 0;
+        getOrderState(it->addr);
     }
 }
 
@@ -138,13 +136,12 @@ void MemNICFour::send(MemEventBase *ev) {
         else net = FWD;
     }
 
-    SimpleNetwork::Request * req = new SimpleNetwork::Request();
+    SimpleNetwork::Request * req = requestRecycler.get();
     req->vn = 0;
     req->src = info.addr;
-    req->dest = lookupNetworkAddress(ev->getDst());
+    req->dest = lookupNetworkAddress(ev);
 
-    unsigned int tag = sendTags[req->dest];
-    sendTags[req->dest]++;
+    unsigned int tag = getOrderState(req->dest).sendTag++;
 
     OrderedMemRtrEvent * omre = new OrderedMemRtrEvent(ev, tag);
 
@@ -203,11 +200,12 @@ void MemNICFour::doRecv(SimpleNetwork::Request * req, NetType net) {
         dbg.debug(_L3_, "%s, memNIC received a message: <%" PRIu64 ", %u>\n",
                 getName().c_str(), src, mre->tag);
 
-        stat_oooDepthSrc->addData(orderBuffer[src].size());
+        OrderState& state = getOrderState(src);
+        stat_oooDepthSrc->addData(state.buffered);
         stat_oooDepth->addData(totalOOO);
-        if (mre->tag == recvTags[src]) { // Got the tag we were expecting
+        if (mre->tag == state.recvTag) { // Got the tag we were expecting
             stat_oooEvent[net]->addData(0); // Count total number of events received
-            recvTags[src]++;
+            state.recvTag++;
 
             if (recvQueue.empty())
                 recvNotify(mre);
@@ -218,17 +216,23 @@ void MemNICFour::doRecv(SimpleNetwork::Request * req, NetType net) {
                 recvQueue.pop();
             }
 
-            while (orderBuffer[src].find(recvTags[src]) != orderBuffer[src].end()) {
+            // recvNotify may have sent and grown orderState
+            OrderState& next = orderState[src];
+            while (next.buffered) {
+                std::pair<OrderedMemRtrEvent*,SimTime_t>& slot = next.window[next.recvTag & (next.window.size() - 1)];
+                if (slot.first == nullptr)
+                    break;
                 totalOOO--;
-                recvQueue.push(orderBuffer[src][recvTags[src]].first);
-                stat_orderLatency->addData(getCurrentSimTime() - orderBuffer[src][recvTags[src]].second);
-                orderBuffer[src].erase(recvTags[src]);
-                recvTags[src]++;
+                next.buffered--;
+                recvQueue.push(slot.first);
+                stat_orderLatency->addData(getCurrentSimTime() - slot.second);
+                slot.first = nullptr;
+                next.recvTag++;
             }
         } else {
             totalOOO++;
             stat_oooEvent[net]->addData(1); // Count number of out of order events received
-            orderBuffer[src][mre->tag] = std::make_pair(mre,getCurrentSimTime());
+            bufferOutOfOrder(state, mre);
         }
         if (!clockOn && !recvQueue.empty()) {
             clockOn = true;
@@ -237,6 +241,22 @@ void MemNICFour::doRecv(SimpleNetwork::Request * req, NetType net) {
     }
 }
 
+void MemNICFour::bufferOutOfOrder(OrderState& state, OrderedMemRtrEvent* mre) {
+    size_t size = state.window.size();
+    if (mre->tag - state.recvTag >= size) {
+        while (mre->tag - state.recvTag >= size)
+            size *= 2;
+        std::vector<std::pair<OrderedMemRtrEvent*,SimTime_t> > window(size, std::make_pair(nullptr, 0));
+        for (size_t i = 0; i < state.window.size(); i++) {
+            if (state.window[i].first)
+                window[state.window[i].first->tag & (size - 1)] = state.window[i];
+        }
+        state.window.swap(window);
+    }
+    state.window[mre->tag & (size - 1)] = std::make_pair(mre, getCurrentSimTime());
+    state.buffered++;
+}
+
 void MemNICFour::recvNotify(OrderedMemRtrEvent* mre) {
     MemEventBase * me = static_cast<MemEventBase*>(mre->takeEvent());
     delete mre;
@@ -255,7 +275,7 @@ void MemNICFour::recvNotify(OrderedMemRtrEvent* mre) {
 MemNICFour::OrderedMemRtrEvent* MemNICFour::processRecv(SimpleNetwork::Request * req) {
     if (req != nullptr) {
         MemRtrEvent * mre = static_cast<MemRtrEvent*>(req->takePayload());
-        delete req;
+        requestRecycler.recycle(req);
 
         if (mre->hasClientData()) {
             OrderedMemRtrEvent * smre = static_cast<OrderedMemRtrEvent*>(mre);
@@ -19,6 +19,7 @@
 #include <string>
 #include <map>
 #include <queue>
+#include <vector>
 
 #include <sst/core/event.h>
 #include <sst/core/output.h>
@@ -166,10 +167,24 @@ private:
     std::queue<SST::Interfaces::SimpleNetwork::Request*> sendQueue[4];
     std::queue<MemNICFour::OrderedMemRtrEvent*> recvQueue;
 
-    // Order tag tracking
-    std::map<uint64_t, unsigned int> sendTags;
-    std::map<uint64_t, unsigned int> recvTags;
-    std::map<uint64_t, std::map<unsigned int, std::pair<OrderedMemRtrEvent*,SimTime_t> > > orderBuffer;
+    // Order tag tracking, per network address. Events that arrive ahead of
+    // the tag expected next wait in a ring indexed by tag; the ring covers
+    // the tags from recvTag on and doubles when one lands past its end.
+    struct OrderState {
+        OrderState() : sendTag(0), recvTag(0), buffered(0), window(4, std::make_pair(nullptr, 0)) { }
+        unsigned int sendTag;   // tag of the next event sent to this address
+        unsigned int recvTag;   // tag expected next from this address
+        size_t buffered;        // events in window
+        std::vector<std::pair<OrderedMemRtrEvent*,SimTime_t> > window;
+    };
+    std::vector<OrderState> orderState;
+
+    OrderState& getOrderState(uint64_t addr) {
+        if (addr >= orderState.size())
+            orderState.resize(addr + 1);
+        return orderState[addr];
+    }
+    void bufferOutOfOrder(OrderState& state, OrderedMemRtrEvent* mre);
 
     // Statistics
     Statistic<uint64_t>* stat_oooEvent[4];
@@ -69,6 +69,10 @@ HBMpagedMultiMemory::HBMpagedMultiMemory(ComponentId_t id, Params &params)
         replaceStrat = BiLRU;
     } else if (stratStr == "SCLRU") {
         replaceStrat = SCLRU;
+    } else if (stratStr == "CLOCK") {
+        replaceStrat = CLOCK;
+    } else if (stratStr == "MQ") {
+        replaceStrat = MQ;
     } else {
         dbg.fatal(CALL_INFO, -1, "Invalid page replacement Strategy (page_replace_strategy)\n");
     }
@@ -99,6 +103,21 @@ HBMpagedMultiMemory::HBMpagedMultiMemory(ComponentId_t id, Params &params)
       }
     }
 
+    hotness = NULL;
+    if (replaceStrat == CLOCK || replaceStrat == MQ) {
+        hotness = new PageHotnessQueue<HBMpageInfo>(replaceStrat == CLOCK ? PageHotnessQueue<HBMpageInfo>::CLOCK : PageHotnessQueue<HBMpageInfo>::MQ,
+                                                 params.find<int>("hotness_queues", 8));
+    }
+
+    hotSample = params.find<unsigned int>("hotness_sample", 1);
+    if (hotSample == 0) {
+        dbg.fatal(CALL_INFO, -1, "hotness_sample must be at least 1\n");
+    }
+    hotSampleCount = 0;
+
+    maxMigrations = params.find<unsigned int>("max_migrations", 0);
+    migrating = 0;
+
     dramBackpressure = params.find<bool>("dramBackpressure", 1);
 
     threshold = params.find<unsigned int>("threshold", 4);
@@ -126,6 +145,7 @@ HBMpagedMultiMemory::HBMpagedMultiMemory(ComponentId_t id, Params &params)
     tPages = registerStatistic<uint64_t>("t_pages","1");
     cantSwapOut = registerStatistic<uint64_t>("cant_swap","1");
     swapDelays = registerStatistic<uint64_t>("swap_delays","1");
+    migrationsThrottled = registerStatistic<uint64_t>("migrations_throttled","1");
 
     if (modelSwaps) {
         // use our own callbacks
@@ -145,6 +165,7 @@ HBMpagedMultiMemory::HBMpagedMultiMemory(ComponentId_t id, Params &params)
 bool HBMpagedMultiMemory::checkAdd(HBMpageInfo &page) {
     // only add if the dram isn't too busy
     if (dramBackpressure && dramQ.size() >= 4) return false;
+    if (migrationLimited()) return false;
 
 
     switch (addStrat) {
@@ -156,10 +177,10 @@ bool HBMpagedMultiMemory::checkAdd(HBMpageInfo &page) {
         {
             // based on threshold and if the most recent previous use is
             // more recent than the least recently used page in fast
-            if (pageList.empty()) return (page.lastTouch > threshold); // startup case
+            const HBMpageInfo *victimPage = coldestFastPage();
+            if (NULL == victimPage) return (page.lastTouch > threshold); // startup case
 
             SimTime_t myLastTouch = page.lastTouch;
-            const auto &victimPage = pageList.back();
             if (myLastTouch > victimPage->lastTouch) {
 	      if (addStrat == addMFRPU) {
 		// more recent && more frequent
@@ -176,12 +197,10 @@ bool HBMpagedMultiMemory::checkAdd(HBMpageInfo &page) {
 
     case addSCF:
       {
-            if (pageList.empty()) return (page.lastTouch > threshold); // startup case
+            const HBMpageInfo *victimPage = coldestFastPage();
+            if (NULL == victimPage) return (page.lastTouch > threshold); // startup case
 
             if (page.touched > threshold) {
-	        SimTime_t myLastTouch = page.lastTouch;
-	        const auto &victimPage = pageList.back();
-
 		if (page.touched > victimPage->touched) {
 		  if (page.scanLeng > scanThreshold) {
                     // roughly 1:1000 chance
@@ -321,7 +340,7 @@ void HBMpagedMultiMemory::do_LFU( Addr addr, HBMpageInfo &page, bool &inFast, bo
     swapping = 0;
 
     // if we are hitting it "a lot" see if we can put it in fast
-    if ((0 == page.inFast) && (page.touched > threshold)) {
+    if ((0 == page.inFast) && (page.touched > threshold) && !migrationLimited()) {
         if (pagesInFast < maxFastPages) {
             // put it in
             page.inFast = 1;
@@ -336,13 +355,13 @@ void HBMpagedMultiMemory::do_LFU( Addr addr, HBMpageInfo &page, bool &inFast, bo
 	        const auto endP = pageMap.end();
                 bool found = 0;
                 for (auto p = pageMap.begin(); p != endP; ++p) {
-		  if ((p->second.inFast == 1) && (p->first != pageAddr)) {
-		    lastMin = min(lastMin, p->second.touched);
-		    if((p->second.touched < page.touched) &&
-                       (p->second.swapDir == HBMpageInfo::NONE)) { // make sure we don't bump someone in motion
+		  if ((p->inFast == 1) && (p.pageAddr() != pageAddr)) {
+		    lastMin = min(lastMin, p->touched);
+		    if((p->touched < page.touched) &&
+                       (p->swapDir == HBMpageInfo::NONE)) { // make sure we don't bump someone in motion
                         found = 1;
-                        p->second.inFast = 0; // rm old
-                        if (modelSwaps) {moveToSlow(&(p->second));}
+                        p->inFast = 0; // rm old
+                        if (modelSwaps) {moveToSlow(&*p);}
                         page.inFast = 1; // add new
                         fastSwaps->addData(1);
                         swapping = 1;
@@ -371,6 +390,54 @@ void HBMpagedMultiMemory::do_LFU( Addr addr, HBMpageInfo &page, bool &inFast, bo
     }
 }
 
+void HBMpagedMultiMemory::do_Hotness( HBMpageInfo &page, bool &inFast, bool &swapping) {
+    swapping = 0;
+    if (page.inFast) {
+        hotness->touch(&page);
+    } else if (checkAdd(page)) { // we're hitting it "a lot"
+        if (pagesInFast < maxFastPages) { // there is room to spare!
+            pagesInFast++;
+        } else {
+            // kick the coldest page out
+            HBMpageInfo *victimPage = hotness->victim();
+            if (NULL == victimPage) {
+                // don't move anything.
+                inFast = 0;
+                page.lastTouch = getCurrentSimTimeNano(); // for mrpu
+                dbg.debug(_L10_, "no pages to swap out (%d candidates)\n", (int)hotness->size());
+                cantSwapOut->addData(1);
+                return;
+            }
+
+            victimPage->inFast = 0;
+            if (modelSwaps) {moveToSlow(victimPage);}
+            fastSwaps->addData(1);
+        }
+
+        // put this one in
+        page.inFast = 1;
+        hotness->insert(&page);
+        swapping = 1;
+        if (modelSwaps) {moveToFast(page);}
+    }
+
+    inFast = page.inFast;
+    page.lastTouch = getCurrentSimTimeNano(); // for mrpu
+}
+
+// the page a new page would replace, used by the addition strategies that compare against it
+const HBMpageInfo* HBMpagedMultiMemory::coldestFastPage() {
+    if (hotness) return hotness->coldest();
+    return pageList.empty() ? NULL : pageList.back();
+}
+
+bool HBMpagedMultiMemory::migrationLimited() {
+    if (maxMigrations == 0 || migrating < maxMigrations) return false;
+
+    migrationsThrottled->addData(1);
+    return true;
+}
+
 bool HBMpagedMultiMemory::issueRequest(ReqId id, Addr addr, bool isWrite, unsigned numBytes ){
     uint64_t pageAddr = addr >> pageShift;
     bool inFast = 0;
@@ -378,7 +445,19 @@ bool HBMpagedMultiMemory::issueRequest(ReqId id, Addr addr, bool isWrite, unsign
     SimTime_t extraDelay = 0;
     auto &page = pageMap[pageAddr];
 
-    page.record(addr, isWrite, getRequestor(id), collectStats, pageAddr, replaceStrat == LFU8);
+    // with sampling, one access in hotSample counts for all of them
+    uint32_t weight = 1;
+    if (hotSample > 1) {
+        weight = ((hotSampleCount++ % hotSample) == 0) ? hotSample : 0;
+    }
+
+    // requestor names are only needed for the access pattern stats
+    uint32_t requestor = 0;
+    if (1 == collectStats && !isWrite) {
+        requestor = requestorIDs.lookup(getRequestor(id));
+    }
+
+    page.record(addr, isWrite, requestor, collectStats, pageAddr, replaceStrat == LFU8, weight);
 
     if (maxFastPages > 0) {
         if (modelSwaps && pageIsSwapping(page)) {
@@ -387,6 +466,8 @@ bool HBMpagedMultiMemory::issueRequest(ReqId id, Addr addr, bool isWrite, unsign
         } else {
             if (replaceStrat == LFU || replaceStrat == LFU8) {
                 do_LFU( addr, page, inFast, swapping);
+            } else if (hotness) {
+                do_Hotness( page, inFast, swapping);
             } else {
                 do_FIFO_LRU( page, inFast, swapping);
             }
@@ -470,7 +551,7 @@ void HBMpagedMultiMemory::printAccStats() {
       dbg.fatal(CALL_INFO, -1, "Coulnd't open %s for output\n", buf);
   } else {
       for (auto p = pageMap.begin(); p != pageMap.end(); ++p) {
-          p->second.printAndClearRecord(p->first, pFile);
+          p->printAndClearRecord(p.pageAddr(), pFile);
       }
       fclose(pFile);
   }
@@ -491,28 +572,22 @@ void HBMpagedMultiMemory::handleSelfEvent(SST::Event *event){
     MemCtrlEvent *ev = static_cast<MemCtrlEvent*>(event);
     Req *req = ev->req;
 
-    // check if this is a swap read
-    auto si = swapToSlow_Reads.find(ev);
-    auto si_w = swapToFast_Writes.find(ev);
-    if (modelSwaps && si != swapToSlow_Reads.end()) {
-        // this event is from the fast mem and should be issued as a
-        // read to the slow.
-        // issue to dram
-        req->isWrite = true;
-        //assert(HBMDRAMSimMemory::issueRequest(req));
-        queueRequest(req);
-        swapToSlow_Writes[req] = si->second;
-        swapToSlow_Reads.erase(ev);
+    if (req->stage == Req::FAST_READ) {
+        // the whole page has been read from the fast mem, write it
+        // to the slow a line at a time
+        const uint32_t numTransfers = req->numBytes >> 6;
+        for (uint32_t i = 0; i < numTransfers; ++i) {
+            queueRequest(new Req(0, req->addr + (i << 6), true, 64, req->swapPage, Req::SLOW_WRITE));
+        }
+        delete req;
         delete ev;
-    } else if (modelSwaps && si_w != swapToFast_Writes.end()) {
+    } else if (req->stage == Req::FAST_WRITE) {
         // this is from fast mem, indicating a transfer from slow.
-        HBMpageInfo *page = si_w->second;
+        HBMpageInfo *page = req->swapPage;
         page->swapsOut -= 1;
-	//printf(" got moveToFast write addr:%p ev:%p p:%p sO:%d\n", (void*)(req->baseAddr_ + req->amtInProcess_) ,ev, page, page->swapsOut);
         if (page->swapsOut == 0) {
             swapDone(page, req->addr);
         }
-        swapToFast_Writes.erase(si_w);
         delete req;
         delete ev;
     } else {
@@ -528,9 +603,11 @@ bool HBMpagedMultiMemory::quantaClock(SST::Cycle_t _cycle) {
 
     lastMin = 0;
 
+    if (hotness) hotness->decay();
+
     for (auto p = pageMap.begin(); p != pageMap.end(); ++p) {
-      //p->second.touched = p->second.touched >> 4;
-      p->second.touched = 0;
+      //p->touched = p->touched >> 4;
+      p->touched = 0;
     }
     return false;
 }
@@ -544,18 +621,18 @@ void HBMpagedMultiMemory::moveToFast(HBMpageInfo &page) {
     // mark page as swapping
     page.swapDir = HBMpageInfo::StoF;
     page.swapsOut = numTransfers;
+    migrating++;
 
     dbg.debug(_L10_, "moveToFast(%p addr:%p) sO:%d\n", &page, (void*)(addr),
               page.swapsOut);
 
     // issue reads to slow mem
     for (int i = 0; i < numTransfers; ++i) {
-        Req *nreq = new Req(0, addr, false, 64);
+        Req *nreq = new Req(0, addr, false, 64, &page, Req::SLOW_READ);
 	//printf("  -issued to %p\n", (void*)addr);
         //assert(HBMDRAMSimMemory::issueRequest(nreq));
         queueRequest(nreq);
         addr += 64;
-        swapToFast_Reads[nreq] = &page; // record that this is a swap
     }
 }
 
@@ -570,14 +647,11 @@ void HBMpagedMultiMemory::moveToSlow(HBMpageInfo *page) {
     // mark page as swapping
     page->swapDir = HBMpageInfo::FtoS;
     page->swapsOut = numTransfers;
+    migrating++;
 
-    // issue reads to fast mem
-    for (int i = 0; i < numTransfers; ++i) {
-        MemCtrlEvent *ev = new MemCtrlEvent(new Req( 0, addr, false, 64));
-        addr += 64;
-        self_link->send(1, ev);
-        swapToSlow_Reads[ev] = page; // record that this is a swap
-    }
+    // the fast mem has a fixed latency, so read the whole page with
+    // one transfer rather than one event per line
+    self_link->send(1, new MemCtrlEvent(new Req( 0, addr, false, numTransfers << 6, page, Req::FAST_READ)));
 }
 
 
@@ -593,28 +667,20 @@ void HBMpagedMultiMemory::dramSimDone(unsigned int id, uint64_t addr, uint64_t c
     if(0 == reqs.size())
         dramReqs.erase(addr);
 
-    auto si = swapToSlow_Writes.find(req);
-    auto si_r = swapToFast_Reads.find(req);
-    if (modelSwaps && si != swapToSlow_Writes.end()) {
+    if (req->stage == Req::SLOW_WRITE) {
         // this is a returning write from the DRAM
         // mark the page as having less outstanding
-        HBMpageInfo *page = si->second;
+        HBMpageInfo *page = req->swapPage;
         page->swapsOut -= 1;
         if (page->swapsOut == 0) {
             swapDone(page, addr);
         }
-        swapToSlow_Writes.erase(si);
         delete req;
-    } else if (modelSwaps && si_r != swapToFast_Reads.end()) {
-        //printf(" got moveToFast read: %p  p:%p sO:%d\n", (void*)(req->baseAddr_+req->amtInProcess_), si_r->second, si_r->second->swapsOut);
+    } else if (req->stage == Req::SLOW_READ) {
         // this is a read returning from the DRAM. Issue a write to fast memory
         req->isWrite = true;
-        MemCtrlEvent *ev = new MemCtrlEvent(req);
-        self_link->send(1, ev);
-        swapToFast_Writes[ev] = si_r->second;
-	//printf("  -issued to fast ev:%p\n", ev);
-        swapToFast_Reads.erase(si_r);
-	//printf("  -swapToFast_reads: %d\n", (int)swapToFast_Reads.size());
+        req->stage = Req::FAST_WRITE;
+        self_link->send(1, new MemCtrlEvent(req));
     } else {
         // normal request
         assert(req);
@@ -651,6 +717,7 @@ void HBMpagedMultiMemory::swapDone(HBMpageInfo *page, const uint64_t addr) {
 
     // mark page as ready
     page->swapDir = HBMpageInfo::NONE;
+    migrating--;
 }
 
 
@@ -19,6 +19,9 @@
 #include <fcntl.h>
 #include <unistd.h>
 #include <sys/mman.h>
+#include <cstring>
+#include <algorithm>
+#include <vector>
 #include "sst/elements/memHierarchy/util.h"
 
 namespace SST {
@@ -35,12 +38,91 @@ public:
 
     virtual uint8_t get( Addr addr) = 0;
     virtual void get( Addr addr, size_t size, std::vector<uint8_t>& data) = 0;
+    /* Copy size bytes into data, e.g. straight into part of an event's payload */
+    virtual void get( Addr addr, size_t size, uint8_t* data) = 0;
     virtual void dump( FILE* ) {};
 };
 
+/*
+ * Binary checkpoint format shared by the backing stores
+ *  - BackingCheckpoint::Header
+ *  - pageCount page numbers (uint64_t, ascending)
+ *  - pageCount pages of pageSize bytes, starting at dataOffset
+ * dataOffset is aligned to the system page size so that, when pageSize is also a multiple of it,
+ * pages can be mapped straight out of the file instead of read.
+ */
+class BackingCheckpoint {
+public:
+    struct Header {
+        char magic[8];
+        uint64_t pageSize;
+        uint64_t pageCount;
+        uint64_t dataOffset;
+        uint64_t init;
+    };
+
+    static bool isCheckpoint(FILE* fp) {
+        char magic[sizeof(Header::magic)];
+        bool match = fread(magic, 1, sizeof(magic), fp) == sizeof(magic) && memcmp(magic, Magic(), sizeof(magic)) == 0;
+        rewind(fp);
+        return match;
+    }
+
+    static uint64_t dataOffset(uint64_t pageCount) {
+        uint64_t sysPage = sysconf(_SC_PAGESIZE);
+        uint64_t offset = sizeof(Header) + pageCount * sizeof(uint64_t);
+        return ((offset + sysPage - 1) / sysPage) * sysPage;
+    }
+
+    /* Write header and page index. Caller then writes the pages in index order with writePage */
+    static void writeIndex(FILE* fp, uint64_t pageSize, bool init, const std::vector<uint64_t>& pages) {
+        Header hdr;
+        memcpy(hdr.magic, Magic(), sizeof(hdr.magic));
+        hdr.pageSize = pageSize;
+        hdr.pageCount = pages.size();
+        hdr.dataOffset = dataOffset(pages.size());
+        hdr.init = init;
+        check(fwrite(&hdr, sizeof(hdr), 1, fp) == 1, "write");
+        if (!pages.empty())
+            check(fwrite(pages.data(), sizeof(uint64_t), pages.size(), fp) == pages.size(), "write");
+        check(fseeko(fp, hdr.dataOffset, SEEK_SET) == 0, "seek in");
+    }
+
+    static void writePage(FILE* fp, const uint8_t* data, uint64_t pageSize) {
+        check(fwrite(data, 1, pageSize, fp) == pageSize, "write");
+    }
+
+    /* Read header and page index. Leaves the file positioned at the first page */
+    static Header readIndex(FILE* fp, std::vector<uint64_t>& pages) {
+        Header hdr;
+        check(fread(&hdr, sizeof(hdr), 1, fp) == 1, "read");
+        check(memcmp(hdr.magic, Magic(), sizeof(hdr.magic)) == 0 && hdr.pageSize != 0, "parse");
+        pages.resize(hdr.pageCount);
+        if (!pages.empty())
+            check(fread(pages.data(), sizeof(uint64_t), pages.size(), fp) == pages.size(), "read");
+        check(fseeko(fp, hdr.dataOffset, SEEK_SET) == 0, "seek in");
+        return hdr;
+    }
+
+    static void check(bool ok, const char* what) {
+        if (!ok) {
+            Output out("", 1, 0, Output::STDOUT);
+            out.fatal(CALL_INFO, -1, "Backing: Error - unable to %s checkpoint file.\n", what);
+        }
+    }
+
+private:
+    static const char* Magic() { return "SSTMEMB1"; }
+};
+
+/*
+ * Backing store that maps the whole simulated memory.
+ * Anonymous stores are mapped without reserving swap so untouched regions cost nothing,
+ * and track which pages have been written so that checkpoints only contain those.
+ */
 class BackingMMAP : public Backing {
 public:
-    BackingMMAP(std::string memoryFile, size_t size, size_t offset = 0) : Backing(), m_fd(-1), m_size(size), m_offset(offset) {
+    BackingMMAP(std::string memoryFile, size_t size, size_t offset = 0, size_t pageSize = 0) : Backing(), m_fd(-1), m_size(size), m_offset(offset) {
         int flags = MAP_SHARED;
         if ( ! memoryFile.empty() ) {
             m_fd = open(memoryFile.c_str(), O_RDWR);
@@ -48,13 +130,51 @@ public:
                 throw 1;
             }
         } else {
-            flags  |= MAP_ANON;
+            flags = MAP_PRIVATE | MAP_ANON;
+#ifdef MAP_NORESERVE
+            flags |= MAP_NORESERVE;
+#endif
         }
         m_buffer = (uint8_t*)mmap(NULL, size, PROT_READ|PROT_WRITE, flags, m_fd, 0);
 
         if ( m_buffer == MAP_FAILED) {
             throw 2;
         }
+
+        if (m_fd == -1)
+            initPresence(pageSize);
+    }
+
+    /* Restore an anonymous store from a checkpoint written by dump() */
+    BackingMMAP(FILE* fp, size_t size, size_t offset = 0) : BackingMMAP("", size, offset) {
+        std::vector<uint64_t> pages;
+        BackingCheckpoint::Header hdr = BackingCheckpoint::readIndex(fp, pages);
+        initPresence(hdr.pageSize);
+        BackingCheckpoint::check(m_pageSize == hdr.pageSize, "use (page size does not match memory size)");
+
+        uint64_t sysPage = sysconf(_SC_PAGESIZE);
+        bool canMap = (hdr.pageSize % sysPage == 0);
+        int fd = fileno(fp);
+        size_t i = 0;
+        while (i < pages.size()) {
+            BackingCheckpoint::check(pages[i] * m_pageSize < m_size, "use (page out of range)");
+            // Coalesce runs of consecutive pages into one mapping/read
+            size_t run = 1;
+            while (i + run < pages.size() && pages[i + run] == pages[i] + run) run++;
+
+            uint8_t* dst = m_buffer + pages[i] * m_pageSize;
+            off_t src = hdr.dataOffset + i * m_pageSize;
+            size_t len = run * m_pageSize;
+            if (canMap) {
+                void* ptr = mmap(dst, len, PROT_READ|PROT_WRITE, MAP_PRIVATE | MAP_FIXED, fd, src);
+                BackingCheckpoint::check(ptr != MAP_FAILED, "map");
+            } else {
+                BackingCheckpoint::check(pread(fd, dst, len, src) == (ssize_t)len, "read");
+            }
+            for (size_t p = 0; p < run; p++)
+                m_presence[(pages[i] + p) >> 6] |= (uint64_t)1 << ((pages[i] + p) & 63);
+            i += run;
+        }
     }
 
     ~BackingMMAP() {
@@ -66,11 +186,12 @@ public:
 
     void set( Addr addr, uint8_t value ) {
         m_buffer[addr - m_offset ] = value;
+        markPresent(addr - m_offset, 1);
     }
 
     void set (Addr addr, size_t size, std::vector<uint8_t> &data) {
-        for (size_t i = 0; i < size; i++)
-            m_buffer[addr + i] = data[i];
+        memcpy(m_buffer + (addr - m_offset), data.data(), size);
+        markPresent(addr - m_offset, size);
     }
 
     uint8_t get( Addr addr ) {
@@ -78,15 +199,62 @@ public:
     }
 
     void get( Addr addr, size_t size, std::vector<uint8_t> &data) {
-        for (size_t i = 0; i < size; i++)
-            data[i] = m_buffer[addr + i];
+        memcpy(data.data(), m_buffer + (addr - m_offset), size);
+    }
+
+    void get( Addr addr, size_t size, uint8_t* data) {
+        memcpy(data, m_buffer + (addr - m_offset), size);
+    }
+
+    /* File-backed stores already hold their state in the file; anonymous stores write the touched pages */
+    void dump( FILE* fp ) {
+        if (m_fd != -1) {
+            msync(m_buffer, m_size, MS_SYNC);
+            return;
+        }
+        std::vector<uint64_t> pages;
+        for (size_t word = 0; word < m_presence.size(); word++) {
+            uint64_t bits = m_presence[word];
+            while (bits) {
+                unsigned bit = __builtin_ctzll(bits);
+                pages.push_back(word * 64 + bit);
+                bits &= bits - 1;
+            }
+        }
+        BackingCheckpoint::writeIndex(fp, m_pageSize, true, pages);
+        for (auto it = pages.begin(); it != pages.end(); it++)
+            BackingCheckpoint::writePage(fp, m_buffer + *it * m_pageSize, m_pageSize);
     }
 
 private:
+    void initPresence(size_t pageSize) {
+        m_pageSize = pageSize ? pageSize : sysconf(_SC_PAGESIZE);
+        if (!isPowerOfTwo(m_pageSize)) {
+            Output out("", 1, 0, Output::STDOUT);
+            out.fatal(CALL_INFO, -1, "BackingMMAP: Error - page size must be a power of two. Got: %zu\n", m_pageSize);
+        }
+        // Pages must tile the store; the last one may only run past m_size up to the end of the (system page rounded) mapping
+        size_t sysPage = sysconf(_SC_PAGESIZE);
+        while (m_pageSize > sysPage && m_size % m_pageSize != 0)
+            m_pageSize >>= 1;
+        m_pageShift = log2Of(m_pageSize);
+        size_t numPages = (m_size + m_pageSize - 1) >> m_pageShift;
+        m_presence.assign((numPages + 63) / 64, 0);
+    }
+
+    void markPresent(size_t offset, size_t size) {
+        if (m_presence.empty() || size == 0) return;
+        for (size_t page = offset >> m_pageShift; page <= (offset + size - 1) >> m_pageShift; page++)
+            m_presence[page >> 6] |= (uint64_t)1 << (page & 63);
+    }
+
     uint8_t* m_buffer;
     int m_fd;
-    int m_size;
+    size_t m_size;
     size_t m_offset;
+    size_t m_pageSize = 0;
+    unsigned int m_pageShift = 0;
+    std::vector<uint64_t> m_presence; // One bit per page written, anonymous stores only
 };
 
 #define CHECKPOINT_DBG 0
@@ -102,33 +270,48 @@ public:
         m_shift = log2Of(m_allocUnit);
     }
 
+    /* Restore from a checkpoint. Reads the binary format written by dump() as well as the older text format */
     BackingMalloc( FILE* fp ) {
+        if (BackingCheckpoint::isCheckpoint(fp)) {
+            std::vector<uint64_t> pages;
+            BackingCheckpoint::Header hdr = BackingCheckpoint::readIndex(fp, pages);
+            m_allocUnit = hdr.pageSize;
+            m_init = hdr.init;
+            BackingCheckpoint::check(isPowerOfTwo(m_allocUnit), "parse");
+            m_shift = log2Of(m_allocUnit);
+            for (auto it = pages.begin(); it != pages.end(); it++) {
+                BackingCheckpoint::check(m_buffer.find(*it) == m_buffer.end(), "parse");
+                uint8_t* buf = allocPage(*it);
+                BackingCheckpoint::check(fread(buf, 1, m_allocUnit, fp) == m_allocUnit, "read");
+            }
+            return;
+        }
+
         int num; 
-        char str[80];
+        unsigned int allocUnit, shift;
         fscanf(fp,"Number-of-pages: %d\n", &num );
-        fscanf(fp,"m_allocUnit: %d\n", &m_allocUnit );
+        fscanf(fp,"m_allocUnit: %u\n", &allocUnit );
         int tmpInit;
         fscanf(fp,"m_init: %d\n",  &tmpInit );
         m_init = tmpInit;
-        fscanf(fp,"m_shift: %d\n",  &m_shift );
+        fscanf(fp,"m_shift: %u\n",  &shift );
+        m_allocUnit = allocUnit;
+        m_shift = shift;
         printf("Number-of-pages: %d\n",num);
-        printf("m_allocUnit: %d\n",m_allocUnit);
+        printf("m_allocUnit: %zu\n",m_allocUnit);
         printf("m_init: %d\n",m_init);
-        printf("m_shift: %d\n",m_shift);
+        printf("m_shift: %u\n",m_shift);
         Addr addr;
         while ( 1 == fscanf(fp,"addr: %" PRIx64 "\n",&addr) ) {
             Addr bAddr = addr >> m_shift;
 
             assert( m_buffer.find( bAddr )  == m_buffer.end() );
 
-            auto buf = (uint8_t*) malloc( m_allocUnit );
-            m_buffer[ bAddr ] = buf;
-            //printf("%s() %#lx %#lx %p\n",__func__, addr, bAddr, buf );
-            auto ptr = (uint64_t*) m_buffer[bAddr];
+            auto ptr = (uint64_t*) allocPage(bAddr);
             //printf("addr: %#x %p\n",addr,ptr);
             auto length = ( sizeof(uint8_t) * m_allocUnit ) / sizeof(uint64_t);
 
-            for ( auto i = 0; i < length ; i++ ) {
+            for ( size_t i = 0; i < length ; i++ ) {
 #if CHECKPOINT_DBG 
                 if ( i % 8  == 0 ) {
                     printf("\n%#lx ",addr + i*8);
@@ -143,126 +326,101 @@ public:
         }
     }
 
+    ~BackingMalloc() {
+        for (auto it = m_buffer.begin(); it != m_buffer.end(); it++)
+            free(it->second);
+    }
+
     void set( Addr addr, uint8_t value ) {
 #if CHECKPOINT_DBG 
         printf("%s addr=%#lx\n",__func__,addr);
 #endif
-        Addr bAddr = addr >> m_shift;
-        Addr offset = addr - (bAddr << m_shift);
-        allocIfNeeded(bAddr);
-        m_buffer[bAddr][offset] = value;
+        getPage(addr >> m_shift)[addr & (m_allocUnit - 1)] = value;
     }
 
     void set( Addr addr, size_t size, std::vector<uint8_t> &data ) {
-        /* Account for size exceeding alloc unit size */
-        Addr bAddr = addr >> m_shift;
-        Addr offset = addr - (bAddr << m_shift);
-        size_t dataOffset = 0;
-
-        allocIfNeeded(bAddr);
-
 #if CHECKPOINT_DBG 
-        printf("%s() addr=%#lx size=%zu ",__func__,addr,size);
+        printf("%s() addr=%#lx size=%zu\n",__func__,addr,size);
 #endif
+        /* Account for size exceeding alloc unit size */
+        size_t dataOffset = 0;
         while (dataOffset != size) {
-            m_buffer[bAddr][offset] = data[dataOffset];
-#if CHECKPOINT_DBG 
-            printf("%#x ",data[dataOffset]);
-#endif
-            offset++;
-            dataOffset++;
-
-            if (offset == m_allocUnit) {
-                offset = 0;
-                bAddr++;
-                allocIfNeeded(bAddr);
-            }
+            Addr cur = addr + dataOffset;
+            size_t offset = cur & (m_allocUnit - 1);
+            size_t len = std::min(size - dataOffset, m_allocUnit - offset);
+            memcpy(getPage(cur >> m_shift) + offset, data.data() + dataOffset, len);
+            dataOffset += len;
         }
-#if CHECKPOINT_DBG 
-        printf("\n");
-#endif
     }
 
     void get (Addr addr, size_t size, std::vector<uint8_t> &data) {
 #if CHECKPOINT_DBG 
-        printf("%s() addr=%#lx size=%zu ",__func__,addr,size);
+        printf("%s() addr=%#lx size=%zu\n",__func__,addr,size);
 #endif
-        Addr bAddr = addr >> m_shift;
-        Addr offset = addr - (bAddr << m_shift);
-        size_t dataOffset = 0;
-
-        allocIfNeeded(bAddr);
         assert( data.size() == size );
+        get(addr, size, data.data());
+    }
 
-        assert( m_buffer.find(bAddr) != m_buffer.end() ); 
-        auto buf = m_buffer[bAddr];
+    void get( Addr addr, size_t size, uint8_t* data) {
+        size_t dataOffset = 0;
         while (dataOffset != size) {
-            
-            data[dataOffset] = buf[offset];
-            offset++;
-            dataOffset++;
-            if (offset == m_allocUnit) {
-                bAddr++;
-                offset = 0;
-                allocIfNeeded(bAddr);
-            }
+            Addr cur = addr + dataOffset;
+            size_t offset = cur & (m_allocUnit - 1);
+            size_t len = std::min(size - dataOffset, m_allocUnit - offset);
+            memcpy(data + dataOffset, getPage(cur >> m_shift) + offset, len);
+            dataOffset += len;
         }
-#if CHECKPOINT_DBG 
-        for ( auto i = 0; i < size; i++ ) {
-            printf("%x ",data[i]);
-        }
-        printf("\n");
-#endif
     }
 
     uint8_t get( Addr addr ) {
-        Addr bAddr = addr >> m_shift;
-        Addr offset = addr - (bAddr << m_shift);
-        allocIfNeeded(bAddr);
-        return m_buffer[bAddr][offset];
+        return getPage(addr >> m_shift)[addr & (m_allocUnit - 1)];
     }
 
-
+    /* Write allocated pages in the binary checkpoint format, in address order */
     void dump( FILE* fp ) {
-        fprintf(fp,"Number-of-pages: %zu\n",m_buffer.size());
-        fprintf(fp,"m_allocUnit: %d\n",m_allocUnit);
-        fprintf(fp,"m_init: %d\n",m_init);
-        fprintf(fp,"m_shift: %d\n",m_shift);
-
+        std::vector<uint64_t> pages;
+        pages.reserve(m_buffer.size());
         for ( auto const& x : m_buffer ) {
-            fprintf(fp,"addr: %#llx\n",x.first << m_shift);
-            auto length = sizeof(uint8_t)*m_allocUnit;
-            length /= sizeof(uint64_t);
-            auto ptr = (uint64_t*) x.second;
-            for ( auto i = 0; i < length ; i++ ) {
-                fprintf(fp,"%#" PRIx64 "",ptr[i]); 
-                if ( i + 1 < length ) {
-                    fprintf(fp," ");
-                }
-            }
-            fprintf(fp,"\n");
+            pages.push_back(x.first);
         }
+        std::sort(pages.begin(), pages.end());
+
+        BackingCheckpoint::writeIndex(fp, m_allocUnit, m_init, pages);
+        for (auto it = pages.begin(); it != pages.end(); it++)
+            BackingCheckpoint::writePage(fp, m_buffer[*it], m_allocUnit);
     }
 
 private:
-    void allocIfNeeded(Addr bAddr) {
-        if (m_buffer.find(bAddr) == m_buffer.end()) {
-            uint8_t* data = (uint8_t*) malloc(sizeof(uint8_t)*m_allocUnit);
-            if ( m_init ) {
-                bzero( data, m_allocUnit );
-            }
-            if (!data) {
-                Output out("", 1, 0, Output::STDOUT);
-                out.fatal(CALL_INFO, -1, "BackingMalloc: Error - malloc failed.\n");
-            }
-            m_buffer[bAddr] = data;
+    /* Most accesses hit the same page as the previous one so check that before the map */
+    uint8_t* getPage(Addr bAddr) {
+        if (m_lastBuf && bAddr == m_lastPage)
+            return m_lastBuf;
+        auto it = m_buffer.find(bAddr);
+        uint8_t* data = (it == m_buffer.end()) ? allocPage(bAddr) : it->second;
+        m_lastPage = bAddr;
+        m_lastBuf = data;
+        return data;
+    }
+
+    uint8_t* allocPage(Addr bAddr) {
+        uint8_t* data = (uint8_t*) malloc(sizeof(uint8_t)*m_allocUnit);
+        if (!data) {
+            Output out("", 1, 0, Output::STDOUT);
+            out.fatal(CALL_INFO, -1, "BackingMalloc: Error - malloc failed.\n");
+        }
+        if ( m_init ) {
+            bzero( data, m_allocUnit );
         }
+        m_buffer[bAddr] = data;
+        return data;
     }
 
     std::unordered_map<Addr,uint8_t*> m_buffer;
-    unsigned int m_allocUnit;
+    size_t m_allocUnit;
     unsigned int m_shift;
     bool m_init;
+    Addr m_lastPage = 0;
+    uint8_t* m_lastBuf = nullptr;
 };
 
 }
@@ -46,6 +46,7 @@ public:
     void finish();
     virtual bool clock(Cycle_t cycle);
     virtual bool isClocked() { return backend->isClocked(); }
+    virtual void clockResumed(Cycle_t cycle) { backend->clockResumed(cycle); }
 
 private:
     void handleMemReponse( ReqId id ) {
@@ -25,6 +25,8 @@ DRAMSim3Memory::DRAMSim3Memory(ComponentId_t id, Params &params) : SimpleMemBack
     if(NO_STRING_DEFINED == configIniFilename)
         output->fatal(CALL_INFO, -1, "Model must define a 'config_ini' file parameter\n");
     std::string outputDirname = params.find<std::string>("output_dir", "./");
+    skipIdle = params.find<bool>("skip_idle", false);
+    lastClockCycle = 0;
 
     readCB = std::bind(&DRAMSim3Memory::dramSimDone, this, 0, std::placeholders::_1, 0);
     writeCB = std::bind(&DRAMSim3Memory::dramSimDone, this, 0, std::placeholders::_1, 0);
@@ -47,7 +49,7 @@ bool DRAMSim3Memory::issueRequest(ReqId id, Addr addr, bool isWrite, unsigned ){
 #ifdef __SST_DEBUG_OUTPUT__
     output->debug(_L10_, "Issued transaction for address %" PRIx64 "\n", (Addr)addr);
 #endif
-    dramReqs[addr].push_back(id);
+    dramReqs.push(addr, id);
     return true;
 }
 
@@ -55,7 +57,21 @@ bool DRAMSim3Memory::issueRequest(ReqId id, Addr addr, bool isWrite, unsigned ){
 
 bool DRAMSim3Memory::clock(Cycle_t cycle){
     memSystem->ClockTick();
-    return false;
+    lastClockCycle = cycle;
+
+    // Nothing DRAMSim3 does while idle reaches us, so its cycles can wait for clockResumed()
+    return skipIdle && dramReqs.empty();
+}
+
+
+/*
+ * Parent's clock was off since our last clock() and is back on.
+ * Run the cycles DRAMSim3 missed so refresh and its statistics are where
+ * they would have been. cycle = current cycle; the next clock() is for cycle+1
+ */
+void DRAMSim3Memory::clockResumed(Cycle_t cycle){
+    for ( ; lastClockCycle < cycle; lastClockCycle++)
+        memSystem->ClockTick();
 }
 
 
@@ -67,16 +83,12 @@ void DRAMSim3Memory::finish(){
 
 
 void DRAMSim3Memory::dramSimDone(unsigned int id, uint64_t addr, uint64_t clockcycle){
-    std::deque<ReqId> &reqs = dramReqs[addr];
 #ifdef __SST_DEBUG_OUTPUT__
-    output->debug(_L10_, "Memory Request for %" PRIx64 " Finished [%zu reqs]\n", (Addr)addr, reqs.size());
+    output->debug(_L10_, "Memory Request for %" PRIx64 " Finished\n", (Addr)addr);
 #endif
-    if (reqs.size() == 0) 
+    ReqId reqId;
+    if (!dramReqs.pop(addr, reqId))
         output->fatal(CALL_INFO, -1, "Error: reqs.size() is 0 at DRAMSim3Memory done\n");
-    ReqId reqId = reqs.front();
-    reqs.pop_front();
-    if(0 == reqs.size())
-        dramReqs.erase(addr);
 
     handleMemResponse(reqId);
 }
@@ -18,6 +18,7 @@
 #define _H_SST_MEMH_DRAMSIM3_BACKEND
 
 #include "sst/elements/memHierarchy/membackend/memBackend.h"
+#include "sst/elements/memHierarchy/membackend/pendingReqTable.h"
 
 #ifdef DEBUG
 #define OLD_DEBUG DEBUG
@@ -44,7 +45,8 @@ public:
             /* Own parameters */\
             {"verbose",     "Sets the verbosity of the backend output", "0"},\
             {"config_ini",  "Name of the DRAMSim3 Device config file",   NULL},\
-            {"output_dir",  "Name of the DRAMSim3 output directory",   "./"}
+            {"output_dir",  "Name of the DRAMSim3 output directory",   "./"},\
+            {"skip_idle",   "Let the controller clock stop while no requests are outstanding. The skipped DRAMSim3 cycles, refresh included, are run in a loop when the clock resumes", "false"}
 
     SST_ELI_DOCUMENT_PARAMS( DRAMSIM3_ELI_PARAMS )
 
@@ -53,13 +55,17 @@ public:
 
     virtual bool issueRequest(ReqId, Addr, bool, unsigned );
     virtual bool clock(Cycle_t cycle);
+    virtual void clockResumed(Cycle_t cycle);
     virtual void finish();
 
 protected:
     void dramSimDone(unsigned int id, uint64_t addr, uint64_t clockcycle);
 
     dramsim3::MemorySystem *memSystem;
-    std::map<uint64_t, std::deque<ReqId> > dramReqs;
+    PendingReqTable dramReqs;
+
+    bool skipIdle;
+    Cycle_t lastClockCycle;
 
 private:
     std::function<void(uint64_t)> readCB;
@@ -46,6 +46,15 @@ bool ExtMemBackendConvertor::issue( BaseReq *req ) {
     if( req->isCustCmd() ){
       // issue custom request
       CustomReq * mreq = static_cast<CustomReq*>(req);
+      if( mreq->hasBursts() ){
+        // range command, timed as plain bursts
+        return static_cast<ExtMemBackend*>(m_backend)->issueRequest( mreq->id(),
+                                                                     mreq->burstAddr(),
+                                                                     mreq->burstIsWrite(),
+                                                                     NULLVEC,
+                                                                     0,
+                                                                     m_backendRequestWidth );
+      }
       return static_cast<ExtMemBackend*>(m_backend)->issueCustomRequest( mreq->id(),
                                                                          mreq->getInfo());
     }else{
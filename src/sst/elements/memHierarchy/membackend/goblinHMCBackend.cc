@@ -260,6 +260,11 @@ GOBLINHMCSimBackend::GOBLINHMCSimBackend(ComponentId_t id, Params& params) : Ext
         // CMD = target command to execute; one of "hmc_rqst_t"
         params.find_array<std::string>("cmd_map", cmdmaps);
 
+        skipIdle = params.find<bool>("skip_idle", false);
+        skipIdleDrain = params.find<uint32_t>("skip_idle_drain", 256);
+        lastClockCycle = 0;
+        postedDrainUntil = 0;
+
         // register the SST statistics
         if( (hmc_trace_level & HMC_TRACE_CMD) > 0 ){
           registerStatistics();
@@ -592,11 +597,50 @@ void GOBLINHMCSimBackend::handleCmdMap(){
     }
     
     // add the new mapping to our list
-    CmdMapping.push_back( new HMCSimCmdMap(ctype_int, copc_uint,
-                                           csize_int, rqst) );
+    HMCSimCmdMap *MapCmd = new HMCSimCmdMap(ctype_int, copc_uint,
+                                            csize_int, rqst);
+    CmdMapping.push_back( MapCmd );
+
+    // and to the lookup tables
+    SrcCmdMap[ctype_int].push_back( MapCmd );
+    if( copc_uint < CmdMapDirectOpcodes ){
+      if( copc_uint >= OpcodeCmdMap.size() ){
+        OpcodeCmdMap.resize( copc_uint+1 );
+      }
+      OpcodeCmdMap[copc_uint].push_back( MapCmd );
+    }else{
+      OpcodeCmdMapOverflow.push_back( MapCmd );
+    }
   }
 }
 
+HMCSimCmdMap* GOBLINHMCSimBackend::findSrcMapping( CMCSrcReq Src, unsigned numBytes ){
+  std::vector<HMCSimCmdMap *> &maps = SrcCmdMap[Src];
+  for( unsigned i=0; i<maps.size(); i++ ){
+    if( (unsigned)(maps[i]->getSrcSize()) == numBytes ){
+      return maps[i];
+    }
+  }
+  return NULL;
+}
+
+HMCSimCmdMap* GOBLINHMCSimBackend::findOpcodeMapping( uint32_t opc, unsigned numBytes ){
+  std::vector<HMCSimCmdMap *> *maps = &OpcodeCmdMapOverflow;
+  if( opc < CmdMapDirectOpcodes ){
+    if( opc >= OpcodeCmdMap.size() ){
+      return NULL;
+    }
+    maps = &OpcodeCmdMap[opc];
+  }
+  for( unsigned i=0; i<maps->size(); i++ ){
+    if( ((*maps)[i]->getOpcode() == opc) &&
+        ((unsigned)((*maps)[i]->getSrcSize()) == numBytes) ){
+      return (*maps)[i];
+    }
+  }
+  return NULL;
+}
+
 bool GOBLINHMCSimBackend::isReadRqst( hmc_rqst_t R ){
   switch(R){
   case RD16:
@@ -653,23 +697,16 @@ bool GOBLINHMCSimBackend::issueMappedRequest(ReqId reqId, Addr addr, bool isWrit
     Src = SRC_POSTED;
   }
 
-  // Step 2: walk the CmdMapping table and look for a mapping
-  HMCSimCmdMap *MapCmd = NULL;
-  for( auto itr = CmdMapping.begin(); itr != CmdMapping.end(); ++itr ){
-    MapCmd = *itr;
-    if( (MapCmd->getSrcType() == Src) &&
-        ((unsigned)(MapCmd->getSrcSize()) == numBytes) ){
-      // found a positive map
-      std::string name;
-      if( !HMCRqstToStr(MapCmd->getTargetType(), &name) ){
-        output->fatal(CALL_INFO, -1, "Unable to map hmc_rqst_t to name\n");
-      }
-      output->verbose(CALL_INFO, 8, 0,
-                      "Found mapped request target of %s\n", name.c_str() );
-
-      break;
+  // Step 2: look for a mapping
+  HMCSimCmdMap *MapCmd = findSrcMapping( Src, numBytes );
+  if( MapCmd != NULL ){
+    // found a positive map
+    std::string name;
+    if( !HMCRqstToStr(MapCmd->getTargetType(), &name) ){
+      output->fatal(CALL_INFO, -1, "Unable to map hmc_rqst_t to name\n");
     }
-    MapCmd = NULL;
+    output->verbose(CALL_INFO, 8, 0,
+                    "Found mapped request target of %s\n", name.c_str() );
   }
 
   // if our MapCmd is NULL, then nothing was found
@@ -742,6 +779,9 @@ bool GOBLINHMCSimBackend::issueMappedRequest(ReqId reqId, Addr addr, bool isWrit
 
     // Add the tag and request into our table of pending
     tag_req_map.insert( std::pair<uint16_t, HMCSimBackEndReq*>(req_tag, reqEntry) );
+    if( isPosted ){
+      postedDrainUntil = lastClockCycle + skipIdleDrain;
+    }
 
     // Record the I/O statistics
     if( (hmc_trace_level & HMC_TRACE_CMD) > 0 ){
@@ -779,24 +819,16 @@ bool GOBLINHMCSimBackend::issueCustomRequest(ReqId reqId, Interfaces::StandardMe
         cmd, numBytes);
 
 
-    // Step 2: walk the CmdMapping table and look for a mapping
-    HMCSimCmdMap *MapCmd = NULL;
+    // Step 2: look for a mapping
+    HMCSimCmdMap *MapCmd = findOpcodeMapping( cmd, numBytes );
     std::string name;
-    for( auto itr = CmdMapping.begin(); itr != CmdMapping.end(); ++itr ){
-        MapCmd = *itr;
-        if( (MapCmd->getOpcode() == cmd) &&
-            ((unsigned)(MapCmd->getSrcSize()) == numBytes) ){
-            // found a positive map
-            if( !HMCRqstToStr(MapCmd->getTargetType(), &name) ){
-                std::string tStr;
-                output->fatal(CALL_INFO, -1, "Unable to map hmc_rqst_t=%d to name\n", (int)(MapCmd->getTargetType()));
-            }
-            output->verbose(CALL_INFO, 8, 0,
-                      "Found mapped request target of %s\n", name.c_str() );
-
-            break;
+    if( MapCmd != NULL ){
+        // found a positive map
+        if( !HMCRqstToStr(MapCmd->getTargetType(), &name) ){
+            output->fatal(CALL_INFO, -1, "Unable to map hmc_rqst_t=%d to name\n", (int)(MapCmd->getTargetType()));
         }
-        MapCmd = NULL;
+        output->verbose(CALL_INFO, 8, 0,
+                  "Found mapped request target of %s\n", name.c_str() );
     }
 
     // -- if our MapCmd is NULL, then nothing was found
@@ -888,6 +920,9 @@ bool GOBLINHMCSimBackend::issueCustomRequest(ReqId reqId, Interfaces::StandardMe
 
                     // Add the tag and request into our table of pending
                     tag_req_map.insert( std::pair<uint16_t, HMCSimBackEndReq*>(req_tag, reqEntry) );
+                    if( isPosted ){
+                      postedDrainUntil = lastClockCycle + skipIdleDrain;
+                    }
 
                     // Record the I/O statistics
                     if( (hmc_trace_level & HMC_TRACE_CMD) > 0 ){
@@ -1117,6 +1152,9 @@ bool GOBLINHMCSimBackend::issueRequest(ReqId reqId, Addr addr, bool isWrite,
 
         // Add the tag and request into our table of pending
         tag_req_map.insert( std::pair<uint16_t, HMCSimBackEndReq*>(req_tag, reqEntry) );
+        if( isPosted ){
+          postedDrainUntil = lastClockCycle + skipIdleDrain;
+        }
 
         // Record the I/O statistics
         if( (hmc_trace_level & HMC_TRACE_CMD) > 0 ){
@@ -1199,6 +1237,14 @@ void GOBLINHMCSimBackend::collectStats(){
 }
 
 bool GOBLINHMCSimBackend::clock(Cycle_t cycle) {
+    lastClockCycle = cycle;
+
+    // Nothing is in the cube, so only HMC-Sim's cycle count has to move
+    if(skipIdle && cubeIdle()) {
+        the_hmc.clk++;
+        return true;
+    }
+
     output->verbose(CALL_INFO, 8, 0, "Clocking HMC...\n");
     int rc = hmcsim_clock(&the_hmc);
 
@@ -1212,7 +1258,19 @@ bool GOBLINHMCSimBackend::clock(Cycle_t cycle) {
 
     // Call to process any responses from the HMC
     processResponses();
-    return false;
+    return skipIdle && cubeIdle();
+}
+
+/*
+ * Parent's clock was off since our last clock() and is back on.
+ * The cube was idle the whole time, so move HMC-Sim's clock past the gap
+ * rather than stepping through it. cycle = current cycle; the next clock() is for cycle+1
+ */
+void GOBLINHMCSimBackend::clockResumed(Cycle_t cycle) {
+    if(cycle > lastClockCycle) {
+        the_hmc.clk += cycle - lastClockCycle;
+    }
+    lastClockCycle = cycle;
 }
 
 void GOBLINHMCSimBackend::processResponses() {
@@ -142,7 +142,9 @@ public:
 	    { "tag_count",	         "Sets the number of inflight tags that can be pending at any point in time", "16" },
 	    { "capacity_per_device", "Sets the capacity of the device being simulated in GiB, min=2, max=8, default is 4", "4" },
         { "cmd_config",          "Enables a CMC library command in HMCSim", "NONE" },
-        { "cmd_map",             "Maps an existing HMC or CMC command to the target command type", "NONE" }  )
+        { "cmd_map",             "Maps an existing HMC or CMC command to the target command type", "NONE" },
+        { "skip_idle",           "Let the controller clock stop while no requests are outstanding. HMC-Sim's clock is moved past the idle cycles when the clock resumes instead of stepping through them", "false" },
+        { "skip_idle_drain",     "With skip_idle, cycles HMC-Sim keeps being clocked after a posted request is sent so it can drain from the cube", "256" }  )
 
     SST_ELI_DOCUMENT_STATISTICS(
         {"WR16",            "Operation count for HMC WR16",       "count", 1},
@@ -238,6 +240,7 @@ public:
 	void setup();
 	void finish();
 	virtual bool clock(Cycle_t cycle);
+	virtual void clockResumed(Cycle_t cycle);
 
 private:
 	struct hmcsim_t the_hmc;
@@ -385,6 +388,12 @@ private:
         std::vector<std::string> cmdmaps;
 
         std::list<HMCSimCmdMap *> CmdMapping;
+
+        // CmdMapping indexed by source type and by opcode, each slot in config order so the first match is the same
+        static const uint32_t CmdMapDirectOpcodes = 1024;
+        std::vector<HMCSimCmdMap *> SrcCmdMap[SRC_CUSTOM+1];
+        std::vector<std::vector<HMCSimCmdMap *> > OpcodeCmdMap;
+        std::vector<HMCSimCmdMap *> OpcodeCmdMapOverflow; // opcodes too large to index
         std::list<HMCCMCConfig *> CmcConfig;
 
 	std::string hmc_trace_file;
@@ -400,8 +409,17 @@ private:
 	std::queue<uint16_t> tag_queue;
 	std::map<uint16_t, HMCSimBackEndReq*> tag_req_map;
 
+	bool skipIdle;
+	uint32_t skipIdleDrain;
+	Cycle_t lastClockCycle;
+	Cycle_t postedDrainUntil; // posted requests leave tag_req_map before they leave the cube
+
+	bool cubeIdle() const { return tag_req_map.empty() && lastClockCycle >= postedDrainUntil; }
+
         void handleCMCConfig();
         void handleCmdMap();
+        HMCSimCmdMap* findSrcMapping( CMCSrcReq, unsigned );
+        HMCSimCmdMap* findOpcodeMapping( uint32_t, unsigned );
 
         void splitStr(const string& s,
                       char delim,
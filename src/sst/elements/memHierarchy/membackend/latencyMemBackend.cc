@@ -0,0 +1,85 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#include <sst_config.h>
+#include <sst/core/link.h>
+#include <cmath>
+#include "sst/elements/memHierarchy/util.h"
+#include "membackend/latencyMemBackend.h"
+#include "membackend/simpleMemBackend.h"
+
+using namespace SST;
+using namespace SST::MemHierarchy;
+
+/*------------------------------- Latency Backend ------------------------------- */
+LatencyMemory::LatencyMemory(ComponentId_t id, Params &params) : SimpleMemBackend(id, params){
+    UnitAlgebra access = params.find<UnitAlgebra>("access_time", UnitAlgebra("100ns"));
+    if (!access.hasUnits("s")) {
+        output->fatal(CALL_INFO, -1, "Invalid param(%s): access_time - must have units of 's' (seconds). You specified %s.\n", getName().c_str(), access.toString().c_str());
+    }
+    accessTime = (access / UnitAlgebra("1ps")).getRoundedValue();
+
+    UnitAlgebra bandwidth = params.find<UnitAlgebra>("bandwidth", UnitAlgebra("0B/s"));
+    if (!bandwidth.hasUnits("B/s")) {
+        output->fatal(CALL_INFO, -1, "Invalid param(%s): bandwidth - must have units of 'B/s' (bytes per second). You specified %s.\n", getName().c_str(), bandwidth.toString().c_str());
+    }
+    bytesPerPs = bandwidth.getDoubleValue() / 1e12;
+
+    UnitAlgebra burst = params.find<UnitAlgebra>("burst_size", UnitAlgebra("0B"));
+    if (!burst.hasUnits("B")) {
+        output->fatal(CALL_INFO, -1, "Invalid param(%s): burst_size - must have units of 'B' (bytes). You specified %s.\n", getName().c_str(), burst.toString().c_str());
+    }
+    burstBytes = burst.getRoundedValue();
+    if (burstBytes == 0)
+        burstBytes = m_reqWidth;
+
+    tokens = burstBytes;
+    lastRefill = 0;
+
+    // Every request is accepted at once, so the convertor can hand over its whole queue each cycle
+    m_maxReqPerCycle = params.find<>("max_requests_per_cycle", -1);
+
+    self_link = configureSelfLink("Self", "1ps",
+            new Event::Handler<LatencyMemory>(this, &LatencyMemory::handleSelfEvent));
+    ps_tc = getTimeConverter("1ps");
+}
+
+void LatencyMemory::handleSelfEvent(SST::Event *event){
+    SimpleMemory::MemCtrlEvent *ev = static_cast<SimpleMemory::MemCtrlEvent*>(event);
+#ifdef __SST_DEBUG_OUTPUT__
+    output->debug(_L10_, "%s: Transaction done for id %" PRIx64 "\n", getName().c_str(),ev->reqId);
+#endif
+    handleMemResponse(ev->reqId);
+    delete event;
+}
+
+bool LatencyMemory::issueRequest(ReqId id, Addr addr, bool isWrite, unsigned numBytes ){
+    SimTime_t wait = 0;
+    if (bytesPerPs > 0) {
+        SimTime_t now = getCurrentSimTime(ps_tc);
+        tokens = std::min(burstBytes, tokens + (now - lastRefill) * bytesPerPs);
+        lastRefill = now;
+        tokens -= numBytes;
+        if (tokens < 0)
+            wait = (SimTime_t)std::ceil(-tokens / bytesPerPs);
+    }
+#ifdef __SST_DEBUG_OUTPUT__
+    output->debug(_L10_, "%s: Issued transaction for address %" PRIx64 " id %" PRIx64 ", completes in %" PRIu64 "ps\n",
+            getName().c_str(), (Addr)addr, id, accessTime + wait);
+#endif
+    self_link->send(accessTime + wait, new SimpleMemory::MemCtrlEvent(id));
+    return true;
+}
@@ -0,0 +1,69 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_SST_MEMH_LATENCY_MEM_BACKEND
+#define _H_SST_MEMH_LATENCY_MEM_BACKEND
+
+#include "sst/elements/memHierarchy/membackend/memBackend.h"
+
+namespace SST {
+namespace MemHierarchy {
+
+/*
+ * Event driven latency/bandwidth memory model
+ *
+ * Every request is accepted as soon as it is issued and completes access_time
+ * after it gets through a token bucket: the bucket fills at 'bandwidth' up to
+ * 'burst_size' bytes and a request takes its size from it, waiting for the
+ * bucket to refill if it runs dry. The completion is scheduled on a self link,
+ * so the backend has no clock and the controller's clock stays off between
+ * requests.
+ */
+class LatencyMemory : public SimpleMemBackend {
+public:
+/* Element Library Info */
+    SST_ELI_REGISTER_SUBCOMPONENT(LatencyMemory, "memHierarchy", "latencyMem", SST_ELI_ELEMENT_VERSION(1,0,0),
+            "Clockless latency and token bucket bandwidth memory timing model", SST::MemHierarchy::SimpleMemBackend)
+
+    SST_ELI_DOCUMENT_PARAMS( MEMBACKEND_ELI_PARAMS,
+            /* Own parameters */
+            {"access_time", "(string) Latency of a memory operation once it has bandwidth. With units (SI ok).", "100ns"},
+            {"bandwidth",   "(string) Sustained bandwidth with units (e.g., 25.6GB/s). 0B/s is unlimited.", "0B/s"},
+            {"burst_size",  "(string) Bytes the bandwidth bucket holds, i.e. how much can go at once after an idle period. With units. 0B means one request.", "0B"} )
+
+/* Begin class definition */
+    LatencyMemory(ComponentId_t id, Params &params);
+    bool issueRequest(ReqId, Addr, bool, unsigned );
+    virtual bool isClocked() { return false; }
+
+    void handleSelfEvent(SST::Event *event);
+
+private:
+    Link *self_link;
+    TimeConverter *ps_tc;
+
+    SimTime_t accessTime;   // ps
+    double bytesPerPs;      // 0 if unlimited
+    double burstBytes;
+
+    double tokens;          // bytes; negative while requests wait for bandwidth
+    SimTime_t lastRefill;   // ps
+};
+
+}
+}
+
+#endif
@@ -88,6 +88,9 @@ public:
     /* Called by parent's clock() function */
     virtual bool clock(Cycle_t UNUSED(cycle)) { return true; }
 
+    /* Called when parent's clock is turned back on after clock() allowed it to turn off. cycle = current cycle */
+    virtual void clockResumed(Cycle_t UNUSED(cycle)) { }
+
     /* Interface to parent */
     virtual size_t getMemSize() { return m_memSize; }
     virtual uint32_t getRequestWidth() { return m_reqWidth; }
@@ -119,6 +122,17 @@ class SimpleMemBackend : public MemBackend {
 
     virtual bool issueRequest( ReqId, Addr, bool isWrite, unsigned numBytes ) = 0;
 
+    /* Issue count requests of numBytes each for consecutive addresses starting at addr,
+     * request i has id + i * numBytes. Returns the number accepted; backends that can take
+     * a burst at once may override, the default issues them one at a time and stops at
+     * the first rejection */
+    virtual size_t issueBatch( ReqId id, Addr addr, bool isWrite, unsigned numBytes, size_t count ) {
+        size_t issued = 0;
+        while ( issued < count && issueRequest( id + issued * numBytes, addr + issued * numBytes, isWrite, numBytes ) )
+            issued++;
+        return issued;
+    }
+
     void handleMemResponse( ReqId id ) {
         m_respFunc( id );
     }
@@ -15,10 +15,14 @@
 
 
 #include <sst_config.h>
+
+#include <algorithm>
+
 #include "sst/elements/memHierarchy/util.h"
 #include "sst/elements/memHierarchy/memoryController.h"
 #include "membackend/memBackendConvertor.h"
 #include "membackend/memBackend.h"
+#include "customcmd/rangeCustomCmd.h"
 
 using namespace SST;
 using namespace SST::MemHierarchy;
@@ -90,6 +94,9 @@ void MemBackendConvertor::handleMemEvent(  MemEvent* ev ) {
 void MemBackendConvertor::handleCustomEvent( Interfaces::StandardMem::CustomData * info, Event::id_type evId, std::string rqstr) {
     uint32_t id = genReqId();
     CustomReq* req = new CustomReq( info, evId, rqstr, id );
+    RangeCustomData* range = dynamic_cast<RangeCustomData*>(info);
+    if (range)
+        range->getBursts( m_backendRequestWidth, req->bursts() );
     m_requestQueue.push_back( req );
     m_pendingRequests[id] = req;
 }
@@ -97,27 +104,32 @@ void MemBackendConvertor::handleCustomEvent( Interfaces::StandardMem::CustomData
 bool MemBackendConvertor::clock(Cycle_t cycle) {
     m_cycleCount++;
 
+    int32_t maxReqPerCycle = m_backend->getMaxReqPerCycle();
     int reqsThisCycle = 0;
     bool cycleWithIssue = false;
     while ( !m_requestQueue.empty()) {
-        if ( reqsThisCycle == m_backend->getMaxReqPerCycle() ) {
+        if ( reqsThisCycle == maxReqPerCycle ) {
             break;
         }
 
         BaseReq* req = m_requestQueue.front();
         Debug(_L10_, "Processing request: %s\n", req->getString().c_str());
 
-        if ( issue( req ) ) {
+        uint32_t count = req->issuesLeft( m_backendRequestWidth );
+        if ( maxReqPerCycle > 0 )
+            count = std::min( count, (uint32_t)(maxReqPerCycle - reqsThisCycle) );
+
+        uint32_t issued = issueBatch( req, count );
+        if ( issued )
             cycleWithIssue = true;
-        } else {
+        reqsThisCycle += issued;
+
+        if ( issued < count ) {
             cycleWithIssue = false;
             stat_cyclesAttemptIssueButRejected->addData(1);
             break;
         }
 
-        reqsThisCycle++;
-        req->increment( m_backendRequestWidth );
-
         if ( req->issueDone() ) {
             Debug(_L10_, "Completed issue of request\n");
             m_requestQueue.pop_front();
@@ -151,6 +163,8 @@ void MemBackendConvertor::turnClockOn(Cycle_t cycle) {
     stat_outstandingReqs->addDataNTimes( cyclesOff, m_pendingRequests.size() );
     m_cycleCount = cycle;
     m_clockOn = true;
+    if (m_clockBackend)
+        m_backend->clockResumed(cycle);
 }
 
 /*
@@ -171,11 +185,12 @@ void MemBackendConvertor::doResponse( ReqId reqId, uint32_t flags ) {
     uint32_t id = BaseReq::getBaseId(reqId);
     MemEvent* resp = NULL;
 
-    if ( m_pendingRequests.find( id ) == m_pendingRequests.end() ) {
+    BaseReq** pending = m_pendingRequests.find( id );
+    if ( !pending ) {
         m_dbg.fatal(CALL_INFO, -1, "memory request not found; id=%" PRId32 "\n", id);
     }
 
-    BaseReq* req = m_pendingRequests[id];
+    BaseReq* req = *pending;
 
     req->decrement( );
 
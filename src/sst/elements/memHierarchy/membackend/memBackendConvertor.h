@@ -22,6 +22,7 @@
 #include <sst/core/warnmacros.h>
 
 #include "sst/elements/memHierarchy/memEvent.h"
+#include "sst/elements/memHierarchy/flatHashMap.h"
 #include "sst/elements/memHierarchy/customcmd/customCmdMemory.h"
 
 namespace SST {
@@ -75,6 +76,7 @@ class MemBackendConvertor : public SubComponent {
         virtual void increment( uint32_t UNUSED(bytes) ) { }
         virtual bool isDone() { return true; } /* If we're asking, the answer is yes */
         virtual bool issueDone() { return true; } /* If we're asking, the answer is yes */
+        virtual uint32_t issuesLeft( uint32_t UNUSED(bytes) ) { return 1; } /* Backend requests still to issue */
         virtual std::string getString() {
             std::ostringstream str;
             str << "ID: " << m_reqId << (isMemEv() ? " MemReq " : " CustomReq ");
@@ -91,10 +93,32 @@ class MemBackendConvertor : public SubComponent {
     class CustomReq : public BaseReq {
     public:
         CustomReq(Interfaces::StandardMem::CustomData * info, Event::id_type evId, std::string rqstr, uint32_t reqId) : BaseReq(reqId, BaseReq::ReqType::CUSTOM),
-            m_info(info), m_evId(evId), m_rqstr(rqstr) { }
+            m_info(info), m_evId(evId), m_rqstr(rqstr), m_nextBurst(0), m_numReq(0) { }
         ~CustomReq() { }
 
         Interfaces::StandardMem::CustomData * getInfo() { return m_info; }
+
+        /* A command the convertor times as ordinary backend bursts (e.g., a range command)
+         * instead of handing it to the backend. Empty for everything else. */
+        std::vector<std::pair<Addr,bool> >& bursts() { return m_bursts; }
+        bool hasBursts()        { return !m_bursts.empty(); }
+        Addr burstAddr()        { return m_bursts[m_nextBurst].first; }
+        bool burstIsWrite()     { return m_bursts[m_nextBurst].second; }
+
+        uint64_t id() override { return ((uint64_t)m_reqId << 32) | m_nextBurst; }
+        void increment( uint32_t UNUSED(bytes) ) override {
+            if (!hasBursts()) return;
+            ++m_nextBurst;
+            ++m_numReq;
+        }
+        void decrement() override { if (hasBursts()) --m_numReq; }
+        bool issueDone() override { return m_nextBurst >= m_bursts.size(); }
+        uint32_t issuesLeft( uint32_t UNUSED(bytes) ) override {
+            if ( issueDone() ) return 1;
+            return m_bursts.size() - m_nextBurst;
+        }
+        bool isDone() override { return issueDone() && 0 == m_numReq; }
+
         const std::string getRqstr() override { return m_rqstr; }
         Event::id_type getEvId() { return m_evId; }
         std::string getString() override {
@@ -108,6 +132,9 @@ class MemBackendConvertor : public SubComponent {
         Interfaces::StandardMem::CustomData * m_info;
         std::string m_rqstr;
         Event::id_type m_evId;
+        std::vector<std::pair<Addr,bool> > m_bursts;
+        uint32_t m_nextBurst;
+        uint32_t m_numReq;
 
     };
 
@@ -136,6 +163,10 @@ class MemBackendConvertor : public SubComponent {
         bool issueDone() {
             return m_offset >= m_event->getSize();
         }
+        uint32_t issuesLeft( uint32_t bytes ) {
+            if ( issueDone() ) return 1;
+            return ( m_event->getSize() - m_offset + bytes - 1 ) / bytes;
+        }
         bool isDone( ) {
             return ( m_offset >= m_event->getSize() && 0 == m_numReq );
         }
@@ -168,11 +199,12 @@ class MemBackendConvertor : public SubComponent {
 
     virtual const std::string getRequestor( ReqId reqId ) {
         uint32_t id = BaseReq::getBaseId(reqId);
-        if ( m_pendingRequests.find( id ) == m_pendingRequests.end() ) {
+        BaseReq** req = m_pendingRequests.find( id );
+        if ( !req ) {
             m_dbg.fatal(CALL_INFO, -1, "memory request not found\n");
         }
 
-        return m_pendingRequests[id]->getRqstr();
+        return (*req)->getRqstr();
     }
 
     virtual void setCallbackHandlers(std::function<void(Event::id_type,uint32_t)> responseCB, std::function<Cycle_t()> clockenableCB);
@@ -199,6 +231,18 @@ class MemBackendConvertor : public SubComponent {
   private:
     virtual bool issue(BaseReq*) = 0;
 
+    /* Issue up to count backend requests for req, incrementing req for each one
+     * the backend takes. Returns the number taken, fewer than count means the
+     * backend rejected one. Default issues them one at a time */
+    virtual uint32_t issueBatch( BaseReq* req, uint32_t count ) {
+        uint32_t issued = 0;
+        while ( issued < count && issue( req ) ) {
+            req->increment( m_backendRequestWidth );
+            issued++;
+        }
+        return issued;
+    }
+
 
 
 
@@ -297,7 +341,7 @@ class MemBackendConvertor : public SubComponent {
 
     uint32_t m_reqId;
 
-    typedef std::map<uint32_t,BaseReq*> PendingRequests;
+    typedef FlatHashMap<uint32_t,BaseReq*,IdHash> PendingRequests;
 
     std::deque<BaseReq*>    m_requestQueue;
     PendingRequests         m_pendingRequests;
@@ -0,0 +1,173 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_SST_MEMH_PAGE_HOTNESS
+#define _H_SST_MEMH_PAGE_HOTNESS
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include <list>
+#include <vector>
+
+namespace SST {
+namespace MemHierarchy {
+
+/*
+ * Tracks the hotness of the pages resident in a fast memory tier and picks
+ * the page to migrate out when a hotter page needs the room. Shared by the
+ * paged multi-level backends, any page type works as long as it has:
+ *
+ *   uint32_t touched;          // accesses this quantum
+ *   bool referenced;           // CLOCK reference bit
+ *   int hotLevel;              // queue the page is on, -1 when not tracked
+ *   std::list<T*>::iterator hotEntry;
+ *   swapDir, compared to T::NONE when the page is not migrating
+ *
+ * CLOCK keeps the resident pages on a ring and gives every referenced page a
+ * second chance. MQ (multi-queue) keeps one LRU queue per power of two of
+ * touches, evicts from the coldest queue first and demotes every page one
+ * queue at the end of a quantum. Both pick a victim without scanning every
+ * page in the system.
+ */
+template<typename T>
+class PageHotnessQueue {
+public:
+    typedef std::list<T*> queue_t;
+    typedef typename queue_t::iterator queueIter;
+
+    typedef enum {CLOCK, MQ} policy_t;
+
+    PageHotnessQueue(policy_t policy, int levels = 8) : policy(policy), resident(0) {
+        queues.resize(policy == MQ ? (levels > 0 ? levels : 1) : 1);
+        hand = queues[0].end();
+    }
+
+    size_t size() const { return resident; }
+
+    // A page was just moved into fast memory
+    void insert(T *page) {
+        page->referenced = true;
+        if (policy == CLOCK) {
+            // just behind the hand, so it is the last page the hand reaches
+            page->hotLevel = 0;
+            page->hotEntry = queues[0].insert(hand, page);
+        } else {
+            page->hotLevel = levelOf(page->touched);
+            queues[page->hotLevel].push_front(page);
+            page->hotEntry = queues[page->hotLevel].begin();
+        }
+        resident++;
+    }
+
+    // A page in fast memory was accessed
+    void touch(T *page) {
+        page->referenced = true;
+        if (policy == CLOCK) return;
+
+        int level = levelOf(page->touched);
+        if (level == page->hotLevel && page->hotEntry == queues[level].begin()) return;
+
+        queues[level].splice(queues[level].begin(), queues[page->hotLevel], page->hotEntry);
+        page->hotLevel = level;
+    }
+
+    // A page left fast memory some other way
+    void remove(T *page) {
+        if (page->hotLevel < 0) return;
+
+        if (page->hotEntry == hand) hand++;
+        queues[page->hotLevel].erase(page->hotEntry);
+        page->hotLevel = -1;
+        resident--;
+    }
+
+    // The coldest page, NULL if there is none. Does not change any state
+    const T* coldest() const {
+        if (policy == CLOCK) {
+            if (queues[0].empty()) return NULL;
+            return (hand == queues[0].end()) ? queues[0].front() : *hand;
+        }
+        for (size_t i = 0; i < queues.size(); i++) {
+            if (!queues[i].empty()) return queues[i].back();
+        }
+        return NULL;
+    }
+
+    // Take the page to migrate out of the tracker, NULL if all of them are already migrating
+    T* victim() {
+        T *page = NULL;
+        if (policy == CLOCK) {
+            // two sweeps clear every reference bit, after that only migrating pages are left
+            for (size_t steps = 2 * resident; steps > 0 && page == NULL; steps--) {
+                if (hand == queues[0].end()) hand = queues[0].begin();
+                T *candidate = *hand;
+                if (candidate->swapDir != T::NONE) {
+                    hand++;
+                } else if (candidate->referenced) {
+                    candidate->referenced = false;
+                    hand++;
+                } else {
+                    page = candidate;
+                }
+            }
+        } else {
+            for (size_t i = 0; i < queues.size() && page == NULL; i++) {
+                for (auto it = queues[i].rbegin(); it != queues[i].rend(); ++it) {
+                    if ((*it)->swapDir == T::NONE) {
+                        page = *it;
+                        break;
+                    }
+                }
+            }
+        }
+
+        if (page != NULL) remove(page);
+        return page;
+    }
+
+    // End of a quantum, the touch counts are about to be cleared
+    void decay() {
+        if (policy == CLOCK) return;
+
+        for (size_t i = 1; i < queues.size(); i++) {
+            for (auto it = queues[i].begin(); it != queues[i].end(); ++it) {
+                (*it)->hotLevel = i - 1;
+            }
+            queues[i - 1].splice(queues[i - 1].begin(), queues[i]);
+        }
+    }
+
+private:
+    int levelOf(uint32_t touched) const {
+        int level = 0;
+        while (touched > 1 && level + 1 < (int) queues.size()) {
+            touched >>= 1;
+            level++;
+        }
+        return level;
+    }
+
+    policy_t policy;
+    std::vector<queue_t> queues;
+    queueIter hand; // CLOCK hand, end() means the front of the ring
+    size_t resident;
+};
+
+}
+}
+
+#endif
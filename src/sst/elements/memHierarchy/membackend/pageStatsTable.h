@@ -0,0 +1,138 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_SST_MEMH_PAGE_STATS_TABLE
+#define _H_SST_MEMH_PAGE_STATS_TABLE
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace SST {
+namespace MemHierarchy {
+
+/*
+ * Per-page state of the paged multi-level backends, indexed by page number.
+ *
+ * Pages live in fixed size regions that are allocated the first time one of
+ * their pages is touched, so a lookup is two array indexes instead of a tree
+ * walk and a page never moves once it exists (migration requests and the
+ * hotness queues hold pointers to pages). Iteration visits the pages that
+ * have been touched in ascending page order, the same order as the
+ * std::map this replaces, so policies that scan for a victim pick the same
+ * one.
+ */
+template<class P>
+class PageStatsTable {
+public:
+    static const uint32_t RegionShift = 10;
+    static const uint64_t RegionPages = 1ULL << RegionShift;
+
+    PageStatsTable() : count_(0) { }
+
+    ~PageStatsTable() {
+        for (size_t i = 0; i < regions_.size(); i++) delete regions_[i];
+    }
+
+    /* Page state for page number pageAddr, created if it has not been touched */
+    P& operator[](uint64_t pageAddr) {
+        uint64_t r = pageAddr >> RegionShift;
+        if (r >= regions_.size()) regions_.resize(r + 1, nullptr);
+        if (regions_[r] == nullptr) regions_[r] = new Region();
+
+        Region *region = regions_[r];
+        uint32_t index = pageAddr & (RegionPages - 1);
+        if (!region->present[index]) {
+            region->present[index] = true;
+            count_++;
+        }
+        return region->pages[index];
+    }
+
+    /* Number of pages that have been touched */
+    size_t size() const { return count_; }
+
+    class iterator {
+    public:
+        uint64_t pageAddr() const { return page_; }
+        P& operator*() const { return table_->regions_[page_ >> RegionShift]->pages[page_ & (RegionPages - 1)]; }
+        P* operator->() const { return &**this; }
+        iterator& operator++() { page_++; skip(); return *this; }
+        bool operator!=(const iterator& other) const { return page_ != other.page_; }
+        bool operator==(const iterator& other) const { return page_ == other.page_; }
+
+    private:
+        friend class PageStatsTable;
+        iterator(PageStatsTable *table, uint64_t page) : table_(table), page_(page) { skip(); }
+
+        // Move to the next page that has been touched, or end
+        void skip() {
+            uint64_t end = table_->regions_.size() << RegionShift;
+            while (page_ < end) {
+                Region *region = table_->regions_[page_ >> RegionShift];
+                if (region == nullptr) {
+                    page_ = ((page_ >> RegionShift) + 1) << RegionShift;
+                } else if (!region->present[page_ & (RegionPages - 1)]) {
+                    page_++;
+                } else {
+                    return;
+                }
+            }
+            page_ = end;
+        }
+
+        PageStatsTable *table_;
+        uint64_t page_;
+    };
+
+    iterator begin() { return iterator(this, 0); }
+    iterator end() { return iterator(this, regions_.size() << RegionShift); }
+
+private:
+    struct Region {
+        Region() : present(RegionPages, false), pages(RegionPages) { }
+        std::vector<bool> present;
+        std::vector<P> pages;
+    };
+
+    std::vector<Region*> regions_;
+    size_t count_;
+};
+
+/*
+ * Small integer IDs for requestor names so pages can record who touched
+ * them without keeping strings
+ */
+class RequestorIDs {
+public:
+    uint32_t lookup(const std::string &name) {
+        std::unordered_map<std::string, uint32_t>::iterator it = ids_.find(name);
+        if (it != ids_.end()) return it->second;
+        uint32_t id = ids_.size();
+        ids_.insert(std::make_pair(name, id));
+        return id;
+    }
+
+private:
+    std::unordered_map<std::string, uint32_t> ids_;
+};
+
+}}
+
+#endif
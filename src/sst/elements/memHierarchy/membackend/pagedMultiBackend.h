@@ -18,6 +18,8 @@
 #define _H_SST_MEMH_PAGEDMULTI_BACKEND
 
 #include <queue>
+#include "sst/elements/memHierarchy/membackend/pageHotness.h"
+#include "sst/elements/memHierarchy/membackend/pageStatsTable.h"
 #include "sst/elements/memHierarchy/membackend/dramSimBackend.h"
 #include <sst/core/rng/rng.h>
 
@@ -53,13 +55,19 @@ struct pageInfo {
     swapDir_t swapDir;
     int swapsOut;
 
+    // used by the CLOCK and MQ replacement strategies
+    bool referenced;
+    int hotLevel;
+    pageListIter hotEntry;
+
     // stats
     typedef enum {LT_NEG_ONE, NEG_ONE, ZERO, ONE, GT_ONE, LAST_CASE} AcCases;
     uint64_t accPat[LAST_CASE];
-    set<string> rqstrs; // requestors who have touched this page
+    set<uint32_t> rqstrs; // IDs of the requestors who have touched this page
 
-    void record( Addr addr, bool isWrite, const std::string& requestor,
-                    const bool collectStats, const uint64_t pAddr, const bool limitTouch) {
+    void record( Addr addr, bool isWrite, uint32_t requestor,
+                    const bool collectStats, const uint64_t pAddr, const bool limitTouch,
+                    const uint32_t weight) {
 
         // record the pageAddr
         assert((pageAddr == 0) || (pAddr == pageAddr));
@@ -68,8 +76,8 @@ struct pageInfo {
         //stats ignore writes
         if ((1 == collectStats) && isWrite) return;
 
-        // record that we've been touched
-        touched++;
+        // record that we've been touched, a sampled counter only sees some of the touches
+        touched += weight;
 	if (limitTouch) {
 	  if (touched > 64) touched = 64;
 	}
@@ -94,7 +102,6 @@ struct pageInfo {
         // is modified to send along the requestor info
         if (1 == collectStats) {
             rqstrs.insert(requestor);
-            //printf("%s\n", requestor.c_str());
         }
 
         if (0 == lastRef) {
@@ -138,7 +145,7 @@ struct pageInfo {
     }
 
     pageInfo() : pageAddr(0), touched(0), inFast(0), lastTouch(0), lastRef(0), scanLeng(0),
-                 pageDelay(0), swapDir(NONE), swapsOut(0) {
+                 pageDelay(0), swapDir(NONE), swapsOut(0), referenced(0), hotLevel(-1) {
         for (int i = 0; i < LAST_CASE; ++i) {
             accPat[i] = 0;
         }
@@ -160,11 +167,14 @@ public:
             {"scan_threshold",      "scan Threshold (for SC strategies)", "4"},
             {"seed",                "RNG Seed", "1447"},
             {"page_add_strategy",   "Page Addition Strategy", "T"},
-            {"page_replace_strategy",      "Page Replacement Strategy", "FIFO"},
+            {"page_replace_strategy",      "Page Replacement Strategy (FIFO, LFU, LFU8, LRU, BiLRU, SCLRU, CLOCK or MQ)", "FIFO"},
             {"access_time",         "Constant time memory access for \"fast\" memory", "35ns"},
             {"max_fast_pages",      "Number of \"fast\" (constant time) pages", "256"},
             {"page_shift",          "Size of page (2^x bytes)", "12"},
             {"quantum",             "time period for when page access counts is shifted", "5ms"},
+            {"hotness_sample",      "Count one access in N towards page hotness, modelling sampled access counters", "1"},
+            {"hotness_queues",      "Number of queues of the MQ page replacement strategy", "8"},
+            {"max_migrations",      "Most pages migrating between fast and slow memory at once, 0 for no limit", "0"},
             {"accStatsPrefix",      "File name for acces pattern statistics",""} )
 
     SST_ELI_DOCUMENT_STATISTICS(
@@ -173,7 +183,8 @@ public:
             {"fast_acc", "Number of total accesses to the memory backend", "count", 1},
             {"t_pages", "Number of total pages", "count", 1},
             {"cant_swap", "Number of times a page could not be swapped in because no victim page could be found because all candidates were swapping", "count", 1},
-            {"swap_delays", "Number of an access is delayed because the page is swapping", "count", 1} )
+            {"swap_delays", "Number of an access is delayed because the page is swapping", "count", 1},
+            {"migrations_throttled", "Number of times a page was kept in slow memory because max_migrations pages were already migrating", "count", 1} )
 
 /* Begin class definition */
     pagedMultiMemory(ComponentId_t id, Params &params);
@@ -188,13 +199,18 @@ private:
     RNG::Random*  rng;
 
     struct Req : public SST::Core::Serialization::serializable {
-        Req( ReqId id, Addr addr, bool isWrite, unsigned numBytes ) :
-            id(id), addr(addr), isWrite(isWrite), numBytes(numBytes)
+        // where a page migration transfer is, NORMAL for requests from the memory controller
+        typedef enum {NORMAL, FAST_READ, SLOW_WRITE, SLOW_READ, FAST_WRITE} stage_t;
+
+        Req( ReqId id, Addr addr, bool isWrite, unsigned numBytes, pageInfo *swapPage = NULL, stage_t stage = NORMAL ) :
+            id(id), addr(addr), isWrite(isWrite), numBytes(numBytes), swapPage(swapPage), stage(stage)
         { }
         ReqId id;
         Addr addr;
         bool isWrite;
         unsigned numBytes;
+        pageInfo *swapPage; // the page being migrated
+        stage_t stage;
 		void serialize_order(SST::Core::Serialization::serializer &ser)  override {
 			ser & id;
 			ser & addr;
@@ -224,6 +240,8 @@ private:
                   LRU, // LRU replacement
                   BiLRU, // bimodal LRU
                   SCLRU, // scan aware
+                  CLOCK, // second chance
+                  MQ, // multi-queue
                   LAST_STRAT} pageReplaceStrat_t;
     pageReplaceStrat_t replaceStrat;
 
@@ -232,6 +250,18 @@ private:
     bool checkAdd(pageInfo &page);
     void do_FIFO_LRU( pageInfo &page, bool &inFast, bool &swapping);
     void do_LFU( Addr, pageInfo &page, bool &inFast, bool &swapping);
+    void do_Hotness( pageInfo &page, bool &inFast, bool &swapping);
+    const pageInfo* coldestFastPage();
+    bool migrationLimited();
+
+    // replacement state of the CLOCK and MQ strategies
+    PageHotnessQueue<pageInfo> *hotness;
+    uint32_t hotSample;
+    uint64_t hotSampleCount;
+
+    // page migrations in flight
+    uint32_t maxMigrations;
+    uint32_t migrating;
 
     void printAccStats();
     queue<Req *> dramQ;
@@ -245,15 +275,6 @@ private:
     // swap tracking stuff
     const bool modelSwaps = 1;
     map<uint64_t, list<Req*> > waitingReqs;
-public:
-    class MemCtrlEvent;
-private:
-    typedef map<MemCtrlEvent *, pageInfo*> evToPage_t;
-    typedef map<Req *, pageInfo*> reqToPage_t;
-    evToPage_t swapToSlow_Reads;
-    evToPage_t swapToFast_Writes;
-    reqToPage_t swapToSlow_Writes;
-    reqToPage_t swapToFast_Reads;
 
     void dramSimDone(unsigned int id, uint64_t addr, uint64_t clockcycle);
     void swapDone(pageInfo *, uint64_t);
@@ -281,8 +302,9 @@ public:
         ImplementSerializable(SST::MemHierarchy::pagedMultiMemory::MemCtrlEvent);
     };
 
-    typedef map<uint64_t, pageInfo> pageMap_t;
+    typedef PageStatsTable<pageInfo> pageMap_t;
     pageMap_t pageMap;
+    RequestorIDs requestorIDs; // only used when collect_stats is 1
     uint32_t maxFastPages;
     uint32_t pageShift;
     uint32_t pagesInFast;
@@ -305,6 +327,7 @@ public:
     Statistic<uint64_t> *tPages;
     Statistic<uint64_t> *cantSwapOut;
     Statistic<uint64_t> *swapDelays;
+    Statistic<uint64_t> *migrationsThrottled;
 };
 
 }
@@ -0,0 +1,93 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_SST_MEMH_PENDING_REQ_TABLE
+#define _H_SST_MEMH_PENDING_REQ_TABLE
+
+#include <stdint.h>
+#include <deque>
+
+#include "sst/elements/memHierarchy/flatHashMap.h"
+
+namespace SST {
+namespace MemHierarchy {
+
+/*
+ * Requests a backend has handed to an external DRAM model, by address, for
+ * models that only report an address when a request completes. Requests
+ * to the same address complete in the order they were issued.
+ *
+ * Almost every address has one or two requests outstanding, so those are
+ * kept in the table slot itself and only a longer run spills to a deque.
+ */
+class PendingReqTable {
+public:
+    typedef uint64_t Addr;
+    typedef uint64_t ReqId;
+
+    bool empty() const { return table_.empty(); }
+    size_t size() const { return size_; }
+
+    void push(Addr addr, ReqId id) {
+        Queue& queue = table_[addr];
+        if (queue.count < InlineReqs)
+            queue.inlineReqs[(queue.head + queue.count) % InlineReqs] = id;
+        else
+            queue.spill.push_back(id);
+        queue.count++;
+        size_++;
+    }
+
+    /* Remove the oldest request for addr, false if there is none */
+    bool pop(Addr addr, ReqId &id) {
+        Queue* queue = table_.find(addr);
+        if (!queue)
+            return false;
+        id = queue->inlineReqs[queue->head];
+        queue->count--;
+        size_--;
+        if (queue->count == 0) {
+            table_.erase(addr);
+        } else if (queue->spill.empty()) {
+            queue->head = (queue->head + 1) % InlineReqs;
+        } else {
+            /* Refill the freed inline slot from the spill so order is kept */
+            queue->inlineReqs[queue->head] = queue->spill.front();
+            queue->spill.pop_front();
+            queue->head = (queue->head + 1) % InlineReqs;
+        }
+        return true;
+    }
+
+private:
+    static const unsigned InlineReqs = 2;
+
+    struct Queue {
+        Queue() : head(0), count(0) { }
+        ReqId inlineReqs[InlineReqs];
+        unsigned head;
+        size_t count;
+        std::deque<ReqId> spill;
+    };
+
+    FlatHashMap<Addr, Queue, IdHash> table_;
+    size_t size_ = 0;
+};
+
+}
+}
+
+#endif
@@ -18,6 +18,8 @@
 #include "sst/elements/memHierarchy/util.h"
 #include "membackend/ramulatorBackend.h"
 
+#include <algorithm>
+
 #include "Config.h"
 #include "Request.h"
 
@@ -37,6 +39,9 @@ ramulatorMemory::ramulatorMemory(ComponentId_t id, Params &params) :
     }
     ramulator::Config configs(ramulatorCfg);
 
+    skipIdle = params.find<bool>("skip_idle", false);
+    lastClockCycle = 0;
+
     configs.set_core_num(1); // ?
 
     memSystem = new Gem5Wrapper(configs, m_reqWidth); // default cache line to 64 byte
@@ -61,21 +66,35 @@ bool ramulatorMemory::issueRequest(ReqId reqId, Addr addr, bool isWrite, unsigne
 
     // save this DRAM Request
     if (isWrite)
-        writes.insert(reqId);
+        writes.push_back(reqId);
     else
-        dramReqs[addr].push_back(reqId);
+        dramReqs.push(addr, reqId);
 
     return ok;
 }
 
 bool ramulatorMemory::clock(Cycle_t cycle){
     memSystem->tick();
+    lastClockCycle = cycle;
+
     // Ack writes since ramulator won't
-    while (!writes.empty()) {
-        handleMemResponse(*writes.begin());
-        writes.erase(writes.begin());
-    }
-    return false;
+    std::sort(writes.begin(), writes.end());
+    for (size_t i = 0; i < writes.size(); i++)
+        handleMemResponse(writes[i]);
+    writes.clear();
+
+    // Nothing ramulator does while idle reaches us, so its cycles can wait for clockResumed()
+    return skipIdle && dramReqs.empty();
+}
+
+/*
+ * Parent's clock was off since our last clock() and is back on.
+ * Run the cycles ramulator missed so refresh and its queued writes are where
+ * they would have been. cycle = current cycle; the next clock() is for cycle+1
+ */
+void ramulatorMemory::clockResumed(Cycle_t cycle){
+    for ( ; lastClockCycle < cycle; lastClockCycle++)
+        memSystem->tick();
 }
 
 void ramulatorMemory::finish(){
@@ -85,19 +104,13 @@ void ramulatorMemory::finish(){
 
 void ramulatorMemory::ramulatorDone(ramulator::Request& ramReq) {
     uint64_t addr = ramReq.addr;
-    std::deque<ReqId> &reqs = dramReqs[addr];
-
 #ifdef __SST_DEBUG_OUTPUT__
-    output->debug(_L10_, "RamulatorBackend: Memory Request for %" PRIx64 " Finished [%zu reqs]\n", (Addr)addr, reqs.size());
+    output->debug(_L10_, "RamulatorBackend: Memory Request for %" PRIx64 " Finished\n", (Addr)addr);
 #endif
     // Clean up dramReqs
-    if (reqs.size() < 1)
+    ReqId req;
+    if (!dramReqs.pop(addr, req))
         output->fatal(CALL_INFO, -1, "RamulatorBackend: Error - ramulatorDone called but dramReqs[addr] is empty. Addr: %" PRIx64 "\n", (Addr)addr);
 
-    ReqId req = reqs.front();
-    reqs.pop_front();
-    if(0 == reqs.size())
-        dramReqs.erase(addr);
-
     handleMemResponse(req);
 }
@@ -18,6 +18,7 @@
 #define _H_SST_MEMH_RAMULATOR_BACKEND
 
 #include "sst/elements/memHierarchy/membackend/memBackend.h"
+#include "sst/elements/memHierarchy/membackend/pendingReqTable.h"
 
 #include "Gem5Wrapper.h"
 
@@ -38,13 +39,15 @@ public:
     SST_ELI_DOCUMENT_PARAMS( MEMBACKEND_ELI_PARAMS,
             /* Own parameters */
             {"verbose",     "Sets the verbosity of the backend output", "0"},
-            {"configFile",  "Name of the Ramulator Device config file", NULL} )
+            {"configFile",  "Name of the Ramulator Device config file", NULL},
+            {"skip_idle",   "Let the controller clock stop while no requests are outstanding. The skipped Ramulator cycles, refresh included, are run in a loop when the clock resumes", "false"} )
 
 /* Begin class definition */
     ramulatorMemory(ComponentId_t id, Params &params);
     bool issueRequest(ReqId, Addr, bool, unsigned );
     //virtual bool issueRequest(DRAMReq *req);
     virtual bool clock(Cycle_t cycle);
+    virtual void clockResumed(Cycle_t cycle);
     virtual void finish();
 
 protected:
@@ -52,8 +55,11 @@ protected:
     std::function<void(ramulator::Request&)> callBackFunc;
 
     // Track outstanding requests
-    std::map<uint64_t, std::deque<ReqId> > dramReqs;
-    std::set<ReqId> writes;
+    PendingReqTable dramReqs;
+    std::vector<ReqId> writes;  // acked at the next clock, in ReqId order
+
+    bool skipIdle;
+    Cycle_t lastClockCycle;
 
     void ramulatorDone(ramulator::Request& req);
 
@@ -50,6 +50,7 @@ public:
     void setup();
     void finish();
     bool clock(Cycle_t cycle);
+    void clockResumed(Cycle_t cycle) { backend->clockResumed(cycle); }
 
 private:
 
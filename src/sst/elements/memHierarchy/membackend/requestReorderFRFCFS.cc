@@ -0,0 +1,270 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#include <sst_config.h>
+#include "sst/elements/memHierarchy/util.h"
+#include "membackend/requestReorderFRFCFS.h"
+
+using namespace SST;
+using namespace SST::MemHierarchy;
+
+/*------------------------------- FR-FCFS Backend ------------------------------- */
+RequestReorderFRFCFS::RequestReorderFRFCFS(ComponentId_t id, Params &params) : SimpleMemBackend(id, params){
+
+    fixupParams( params, "clock", "backend.clock" );
+
+    // Get parameters
+    reqsPerCycle = params.find<int>("max_issue_per_cycle", -1);
+
+    unsigned int channels = params.find<unsigned int>("channels", 1);
+    unsigned int ranks = params.find<unsigned int>("ranks", 1);
+    unsigned int banksPerRank = params.find<unsigned int>("banks", 8);
+    UnitAlgebra rowSize(params.find<std::string>("row_size", "8KiB"));
+    UnitAlgebra requestSize(params.find<std::string>("bank_interleave_granularity", "64B"));
+    starvationLimit = params.find<unsigned int>("starvation_limit", 16);
+    maxWaitCycles = params.find<Cycle_t>("max_wait_cycles", 0);
+    writeHighWatermark = params.find<uint64_t>("write_high_watermark", 0);
+    writeLowWatermark = params.find<uint64_t>("write_low_watermark", 0);
+
+    // Check parameters
+    if (channels == 0 || !isPowerOfTwo(channels)) {
+        output->fatal(CALL_INFO, -1, "Invalid param(%s): channels - must be a power of two. You specified '%u'.\n", getName().c_str(), channels);
+    }
+    if (ranks == 0 || !isPowerOfTwo(ranks)) {
+        output->fatal(CALL_INFO, -1, "Invalid param(%s): ranks - must be a power of two. You specified '%u'.\n", getName().c_str(), ranks);
+    }
+    if (banksPerRank == 0 || !isPowerOfTwo(banksPerRank)) {
+        output->fatal(CALL_INFO, -1, "Invalid param(%s): banks - must be a power of two. You specified '%u'.\n", getName().c_str(), banksPerRank);
+    }
+    if (!(rowSize.hasUnits("B"))) {
+        output->fatal(CALL_INFO, -1, "Invalid param(%s): row_size - must have units of 'B' (bytes). You specified %s.\n", getName().c_str(), rowSize.toString().c_str());
+    }
+    if (!isPowerOfTwo(rowSize.getRoundedValue())) {
+        output->fatal(CALL_INFO, -1, "Invalid param(%s): row_size - must be a power of two. You specified %s.\n", getName().c_str(), rowSize.toString().c_str());
+    }
+    if (!(requestSize.hasUnits("B"))) {
+        output->fatal(CALL_INFO, -1, "Invalid param(%s): bank_interleave_granularity - must have units of 'B' (bytes). You specified '%s'.\n", getName().c_str(), requestSize.toString().c_str());
+    }
+    if (!isPowerOfTwo(requestSize.getRoundedValue())) {
+        output->fatal(CALL_INFO, -1, "Invalid param(%s): bank_interleave_granularity - must be a power of two. You specified '%s'.\n", getName().c_str(), requestSize.toString().c_str());
+    }
+    if (writeHighWatermark != 0 && writeLowWatermark >= writeHighWatermark) {
+        output->fatal(CALL_INFO, -1, "Invalid param(%s): write_low_watermark - must be less than write_high_watermark. You specified '%" PRIu64 "' and '%" PRIu64 "'.\n",
+                getName().c_str(), writeLowWatermark, writeHighWatermark);
+    }
+
+    // Create our backend & copy 'mem_size' through for now
+    backend = loadUserSubComponent<SimpleMemBackend>("backend");
+    if (!backend) {
+        std::string backendName = params.find<std::string>("backend", "memHierarchy.simpleDRAM");
+        Params backendParams = params.get_scoped_params("backend");
+        backendParams.insert("mem_size", params.find<std::string>("mem_size"));
+        backend = loadAnonymousSubComponent<SimpleMemBackend>(backendName, "backend", 0, ComponentInfo::INSERT_STATS | ComponentInfo::SHARE_PORTS, backendParams);
+    }
+    using std::placeholders::_1;
+    backend->setResponseHandler( std::bind( &RequestReorderFRFCFS::handleMemResponse, this, _1 )  );
+    m_memSize = backend->getMemSize(); // inherit from backend
+
+    // Set up local variables
+    // Channel, rank, and bank are consecutive address fields above the line offset,
+    // so together they form a single bank index
+    numBanks = channels * ranks * banksPerRank;
+    nextBank = 0;
+    bankMask = numBanks - 1;
+    rowOffset = log2Of(rowSize.getRoundedValue());
+    lineOffset = log2Of(requestSize.getRoundedValue());
+    banks.resize(numBanks);
+    nextSeq = 0;
+    pendingCount[0] = pendingCount[1] = 0;
+    drainingWrites = false;
+    currentCycle = 0;
+
+    statRowHit = registerStatistic<uint64_t>("reorder_row_hits");
+    statRowMiss = registerStatistic<uint64_t>("reorder_row_misses");
+    statBypassedOldest = registerStatistic<uint64_t>("reorder_bypassed_oldest");
+    statStarved = registerStatistic<uint64_t>("reorder_starved");
+    statWriteDrain = registerStatistic<uint64_t>("reorder_write_drains");
+}
+
+bool RequestReorderFRFCFS::issueRequest(ReqId id, Addr addr, bool isWrite, unsigned numBytes ) {
+#ifdef __SST_DEBUG_OUTPUT__
+    output->debug(_L10_, "Reorderer received request for 0x%" PRIx64 "\n", (Addr)addr);
+#endif
+    Bank& bank = banks[(addr >> lineOffset) & bankMask];
+    Addr row = addr >> rowOffset;
+    uint64_t seq = nextSeq++;
+
+    Queue& queue = bank.queue[isWrite];
+    queue.byAge.insert(std::make_pair(seq, Req(id, addr, row, isWrite, numBytes, currentCycle)));
+    queue.byRow[row].insert(seq);
+    pendingCount[isWrite]++;
+    return true;
+}
+
+/*
+ * Pick the request to issue to a bank from the allowed request types
+ * First-ready: the oldest request to the bank's open row, unless the bank's oldest request
+ * has been bypassed starvationLimit times or has waited maxWaitCycles
+ * First-come-first-served: otherwise the bank's oldest request
+ * Returns false if the bank has no request of an allowed type
+ */
+bool RequestReorderFRFCFS::selectRequest(Bank& bank, bool allowRead, bool allowWrite, Cycle_t cycle, bool& isWrite, uint64_t& seq, bool& bypass) {
+    bool allow[2] = { allowRead, allowWrite };
+    bool haveOldest = false;
+    bool oldestIsWrite = false;
+    bool haveHit = false;
+    bool hitIsWrite = false;
+    uint64_t oldestSeq = 0;
+    uint64_t hitSeq = 0;
+
+    for (int type = 0; type < 2; type++) {
+        if (!allow[type] || bank.queue[type].byAge.empty())
+            continue;
+        Queue& queue = bank.queue[type];
+        uint64_t candidate = queue.byAge.begin()->first;
+        if (!haveOldest || candidate < oldestSeq) {
+            haveOldest = true;
+            oldestIsWrite = type;
+            oldestSeq = candidate;
+        }
+        if (!bank.rowOpen)
+            continue;
+        std::unordered_map<Addr, std::set<uint64_t> >::iterator rowIt = queue.byRow.find(bank.openRow);
+        if (rowIt == queue.byRow.end())
+            continue;
+        candidate = *(rowIt->second.begin());
+        if (!haveHit || candidate < hitSeq) {
+            haveHit = true;
+            hitIsWrite = type;
+            hitSeq = candidate;
+        }
+    }
+
+    if (!haveOldest)
+        return false;
+
+    isWrite = oldestIsWrite;
+    seq = oldestSeq;
+    bypass = false;
+    if (!haveHit || hitSeq == oldestSeq)
+        return true;
+
+    bool starved = (starvationLimit != 0 && bank.hitsAheadOfOldest >= starvationLimit);
+    if (maxWaitCycles != 0 && cycle - bank.queue[oldestIsWrite].byAge.begin()->second.arrival >= maxWaitCycles)
+        starved = true;
+
+    if (starved) {
+        statStarved->addData(1);
+        return true;
+    }
+
+    isWrite = hitIsWrite;
+    seq = hitSeq;
+    bypass = true;
+    return true;
+}
+
+void RequestReorderFRFCFS::removeRequest(Bank& bank, bool isWrite, uint64_t seq) {
+    Queue& queue = bank.queue[isWrite];
+    std::map<uint64_t, Req>::iterator it = queue.byAge.find(seq);
+    std::unordered_map<Addr, std::set<uint64_t> >::iterator rowIt = queue.byRow.find(it->second.row);
+    rowIt->second.erase(seq);
+    if (rowIt->second.empty())
+        queue.byRow.erase(rowIt);
+    queue.byAge.erase(it);
+    pendingCount[isWrite]--;
+}
+
+/*
+ * Issue up to one request per bank and up to reqsPerCycle requests in total,
+ * visiting banks round-robin
+ */
+bool RequestReorderFRFCFS::clock(Cycle_t cycle) {
+    currentCycle = cycle;
+
+    if (pendingCount[0] + pendingCount[1] != 0) {
+        // Decide which request types are eligible this cycle
+        bool allowRead = true;
+        bool allowWrite = true;
+        if (writeHighWatermark != 0) {
+            if (drainingWrites && pendingCount[1] <= writeLowWatermark) {
+                drainingWrites = false;
+            } else if (!drainingWrites && pendingCount[1] >= writeHighWatermark) {
+                drainingWrites = true;
+                statWriteDrain->addData(1);
+            }
+            // Outside of a drain, writes only issue when there are no reads to issue
+            allowRead = !drainingWrites;
+            allowWrite = drainingWrites || pendingCount[0] == 0;
+        }
+
+        int reqsIssuedThisCycle = 0;
+        unsigned int bankIndex = nextBank;
+        for (unsigned int i = 0; i < numBanks; i++, bankIndex = (bankIndex + 1) & bankMask) {
+            Bank& bank = banks[bankIndex];
+            bool isWrite;
+            uint64_t seq;
+            bool bypass;
+            if (!selectRequest(bank, allowRead, allowWrite, cycle, isWrite, seq, bypass))
+                continue;
+
+            Req& req = bank.queue[isWrite].byAge.find(seq)->second;
+            // If we're blocked, this bank is busy & move to next bank
+            if (!backend->issueRequest(req.id, req.addr, req.isWrite, req.numBytes))
+                continue;
+
+#ifdef __SST_DEBUG_OUTPUT__
+            output->debug(_L10_, "Reorderer issued request for 0x%" PRIx64 "\n", (Addr)req.addr);
+#endif
+            if (bank.rowOpen && bank.openRow == req.row)
+                statRowHit->addData(1);
+            else
+                statRowMiss->addData(1);
+
+            if (bypass) {
+                bank.hitsAheadOfOldest++;
+                statBypassedOldest->addData(1);
+            } else {
+                bank.hitsAheadOfOldest = 0;
+            }
+            bank.rowOpen = true;
+            bank.openRow = req.row;
+            removeRequest(bank, isWrite, seq);
+
+            reqsIssuedThisCycle++;
+            nextBank = (bankIndex + 1) & bankMask;
+            if (reqsIssuedThisCycle == reqsPerCycle) {
+                break;  // Can't issue any more
+            }
+        }
+    }
+
+    bool unclock = backend->clock(cycle);
+    return unclock && (pendingCount[0] + pendingCount[1] == 0);
+}
+
+
+/*
+ * Call throughs to our backend
+ */
+
+void RequestReorderFRFCFS::setup() {
+    backend->setup();
+}
+
+void RequestReorderFRFCFS::finish() {
+    backend->finish();
+}
@@ -0,0 +1,134 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_SST_MEMH_REQUEST_REORDER_FRFCFS_BACKEND
+#define _H_SST_MEMH_REQUEST_REORDER_FRFCFS_BACKEND
+
+#include "sst/elements/memHierarchy/membackend/memBackend.h"
+#include <map>
+#include <set>
+#include <unordered_map>
+#include <vector>
+
+namespace SST {
+namespace MemHierarchy {
+
+/*
+ * First-ready, first-come-first-served request re-orderer
+ *
+ * Pending requests are indexed per bank by arrival order and by row, so finding
+ * the oldest request and the oldest row hit in a bank are both logarithmic in the
+ * number of pending requests instead of a scan of the queue.
+ */
+class RequestReorderFRFCFS : public SimpleMemBackend {
+public:
+/* Element Library Info */
+    SST_ELI_REGISTER_SUBCOMPONENT(RequestReorderFRFCFS, "memHierarchy", "reorderFRFCFS", SST_ELI_ELEMENT_VERSION(1,0,0),
+            "FR-FCFS request re-orderer, prioritizes requests to open rows with starvation limits and write draining", SST::MemHierarchy::SimpleMemBackend)
+
+    SST_ELI_DOCUMENT_PARAMS( MEMBACKEND_ELI_PARAMS,
+            /* Own parameters */
+            {"verbose",                     "Sets the verbosity of the backend output", "0"},
+            {"max_issue_per_cycle",         "Maximum number of requests to issue per cycle. 0 or negative is unlimited.", "-1"},
+            {"channels",                    "Number of channels. Must be a power of 2.", "1"},
+            {"ranks",                       "Number of ranks per channel. Must be a power of 2.", "1"},
+            {"banks",                       "Number of banks per rank. Must be a power of 2.", "8"},
+            {"bank_interleave_granularity", "Granularity of interleaving in bytes (B), generally a cache line. Must be a power of 2. Channels, then ranks, then banks are interleaved at this granularity.", "64B"},
+            {"row_size",                    "Size of a row in bytes (B). Must be a power of 2.", "8KiB"},
+            {"starvation_limit",            "Maximum number of row hits to issue to a bank ahead of its oldest request. 0 is unlimited.", "16"},
+            {"max_wait_cycles",             "Issue a bank's oldest request ahead of row hits once it has waited this many cycles. 0 is unlimited.", "0"},
+            {"write_high_watermark",        "Start draining writes ahead of reads when this many writes are pending. 0 treats reads and writes alike.", "0"},
+            {"write_low_watermark",         "Stop draining writes once this many or fewer writes are pending.", "0"},
+            {"backend",                     "Backend memory system.", "memHierarchy.simpleDRAM"} )
+
+    SST_ELI_DOCUMENT_STATISTICS(
+            {"reorder_row_hits",        "Number of requests issued to the most recently issued row of their bank", "count", 1},
+            {"reorder_row_misses",      "Number of requests issued to a different row than the most recently issued row of their bank", "count", 1},
+            {"reorder_bypassed_oldest", "Number of row hits issued ahead of an older request to the same bank", "count", 1},
+            {"reorder_starved",         "Number of times a bank's oldest request was issued because of starvation_limit or max_wait_cycles", "count", 1},
+            {"reorder_write_drains",    "Number of times write draining started", "count", 1} )
+
+    SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS( {"backend", "Backend memory model.", "SST::MemHierarchy::SimpleMemBackend"} )
+
+/* Begin class definition */
+    RequestReorderFRFCFS(ComponentId_t id, Params &params);
+
+    virtual bool issueRequest( ReqId, Addr, bool isWrite, unsigned numBytes );
+    void setup();
+    void finish();
+    bool clock(Cycle_t cycle);
+    void clockResumed(Cycle_t cycle) { currentCycle = cycle; backend->clockResumed(cycle); }
+
+private:
+
+    struct Req {
+        Req( ReqId id, Addr addr, Addr row, bool isWrite, unsigned numBytes, Cycle_t arrival ) :
+            id(id), addr(addr), row(row), isWrite(isWrite), numBytes(numBytes), arrival(arrival)
+        { }
+        ReqId id;
+        Addr addr;
+        Addr row;
+        bool isWrite;
+        unsigned numBytes;
+        Cycle_t arrival;
+    };
+
+    /* Pending requests of one type (read or write) to a bank */
+    struct Queue {
+        std::map<uint64_t, Req> byAge;                          // Arrival sequence number -> request
+        std::unordered_map<Addr, std::set<uint64_t> > byRow;    // Row -> arrival sequence numbers
+    };
+
+    struct Bank {
+        Bank() : openRow(0), rowOpen(false), hitsAheadOfOldest(0) { }
+        Queue queue[2];             // Indexed by isWrite
+        Addr openRow;               // Row of the last request issued to this bank
+        bool rowOpen;
+        unsigned hitsAheadOfOldest; // Row hits issued since the bank's oldest request was last issued
+    };
+
+    bool selectRequest(Bank& bank, bool allowRead, bool allowWrite, Cycle_t cycle, bool& isWrite, uint64_t& seq, bool& bypass);
+    void removeRequest(Bank& bank, bool isWrite, uint64_t seq);
+
+    SimpleMemBackend* backend;
+    int reqsPerCycle;           // Number of requests to issue per cycle (max) -> memCtrl limits how many we accept
+    unsigned int numBanks;      // Total banks over all channels and ranks
+    unsigned int nextBank;      // Next bank to issue to
+    unsigned int bankMask;      // Mask for determining request bank
+    unsigned int rowOffset;     // Offset for determining request row
+    unsigned int lineOffset;    // Offset for determining line (needed for finding bank)
+    unsigned int starvationLimit;
+    Cycle_t maxWaitCycles;
+    uint64_t writeHighWatermark;
+    uint64_t writeLowWatermark;
+
+    std::vector<Bank> banks;
+    uint64_t nextSeq;           // Arrival sequence number for the next request
+    uint64_t pendingCount[2];   // Pending reads and writes over all banks
+    bool drainingWrites;
+    Cycle_t currentCycle;
+
+    Statistic<uint64_t>* statRowHit;
+    Statistic<uint64_t>* statRowMiss;
+    Statistic<uint64_t>* statBypassedOldest;
+    Statistic<uint64_t>* statStarved;
+    Statistic<uint64_t>* statWriteDrain;
+};
+
+}
+}
+
+#endif
@@ -37,6 +37,19 @@ bool SimpleMemBackendConvertor::issue( BaseReq* req ) {
         return static_cast<SimpleMemBackend*>(m_backend)->issueRequest( mreq->id(), mreq->addr(), mreq->isWrite(), m_backendRequestWidth );
     } else {
         CustomReq * creq = static_cast<CustomReq*>(req);
+        if (creq->hasBursts())
+            return static_cast<SimpleMemBackend*>(m_backend)->issueRequest( creq->id(), creq->burstAddr(), creq->burstIsWrite(), m_backendRequestWidth );
         return static_cast<SimpleMemBackend*>(m_backend)->issueCustomRequest( creq->id(), creq->getInfo() );
     }
 }
+
+uint32_t SimpleMemBackendConvertor::issueBatch( BaseReq* req, uint32_t count ) {
+    if (!req->isMemEv())
+        return MemBackendConvertor::issueBatch( req, count );
+
+    MemReq * mreq = static_cast<MemReq*>(req);
+    uint32_t issued = static_cast<SimpleMemBackend*>(m_backend)->issueBatch( mreq->id(), mreq->addr(), mreq->isWrite(), m_backendRequestWidth, count );
+    for (uint32_t i = 0; i < issued; i++)
+        req->increment( m_backendRequestWidth );
+    return issued;
+}
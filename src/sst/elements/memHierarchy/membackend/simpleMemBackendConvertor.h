@@ -39,6 +39,7 @@ public:
     SimpleMemBackendConvertor(ComponentId_t id, Params &params, MemBackend* backend, uint32_t);
 
     virtual bool issue( BaseReq* req );
+    virtual uint32_t issueBatch( BaseReq* req, uint32_t count );
 
     virtual void handleMemResponse( ReqId reqId ) {
         doResponse(reqId);
@@ -15,6 +15,8 @@
 
 #include <sst/core/module.h>
 #include "sst/elements/memHierarchy/util.h"
+#include "sst/elements/memHierarchy/xorHashMatrix.h"
+#include <vector>
 
 namespace SST {
 namespace MemHierarchy {
@@ -241,6 +243,97 @@ class SandyBridgeAddrMapper : public AddrMapper {
   private:
 };
 
+/* Simple layout with XOR hashing of the channel, rank, and bank bits */
+class XorAddrMapper : public SimpleAddrMapper {
+  public:
+/* Element Library Info */
+    SST_ELI_REGISTER_MODULE(XorAddrMapper, "memHierarchy", "xorAddrMapper", SST_ELI_ELEMENT_VERSION(1,0,0),
+                            "Address mapper with XOR-hashed channel, rank, and bank bits", SST::MemHierarchy::TimingDRAM_NS::AddrMapper)
+
+    SST_ELI_DOCUMENT_PARAMS(
+            {"channel_masks", "(array) For each channel bit, starting with bit 0, the mask of address bits to XOR together. Bits without a mask use the memHierarchy.simpleAddrMapper layout.", "[]"},
+            {"rank_masks",    "(array) For each rank bit, starting with bit 0, the mask of address bits to XOR together. Bits without a mask use the memHierarchy.simpleAddrMapper layout.", "[]"},
+            {"bank_masks",    "(array) For each bank bit, starting with bit 0, the mask of address bits to XOR together. Bits without a mask use the memHierarchy.simpleAddrMapper layout.", "[]"})
+
+/* Begin class definition */
+    /* Channel, rank, and bank are computed together with one pass through a hash matrix
+     * and the last result is kept since they are requested one at a time for the same address */
+    XorAddrMapper( Params &params ) : SimpleAddrMapper( params ), m_lastAddr(0), m_lastHash(0)
+    {
+        params.find_array<uint64_t>("channel_masks", m_channelMasks);
+        params.find_array<uint64_t>("rank_masks", m_rankMasks);
+        params.find_array<uint64_t>("bank_masks", m_bankMasks);
+    }
+
+    virtual void setNumChannels( unsigned int num ) {
+        SimpleAddrMapper::setNumChannels( num );
+        checkMasks( m_channelMasks, channelWidth(), "channel_masks" );
+        m_hash = XorHashMatrix();
+    }
+
+    virtual void setNumRanks( unsigned int num ) {
+        SimpleAddrMapper::setNumRanks( num );
+        checkMasks( m_rankMasks, rankWidth(), "rank_masks" );
+        m_hash = XorHashMatrix();
+    }
+
+    virtual void setNumBanks( unsigned int num ) {
+        SimpleAddrMapper::setNumBanks( num );
+        checkMasks( m_bankMasks, bankWidth(), "bank_masks" );
+        m_hash = XorHashMatrix();
+    }
+
+    int getChannel( Addr addr ) {
+        return hash( addr ) & channelMask();
+    }
+
+    int getRank( Addr addr ) {
+        return ( hash( addr ) >> channelWidth() ) & rankMask();
+    }
+
+    int getBank( Addr addr ) {
+        return ( hash( addr ) >> ( channelWidth() + rankWidth() ) ) & bankMask();
+    }
+
+  private:
+    void checkMasks( std::vector<uint64_t>& masks, int width, const char* param ) {
+        if (masks.size() > (size_t)width) {
+            Output output("", 1, 0, Output::STDOUT);
+            output.fatal(CALL_INFO, -1, "XorAddrMapper, Invalid param - %s: has %zu masks but there are only %d bits.\n", param, masks.size(), width);
+        }
+    }
+
+    /* Output bits are channel, then rank, then bank, starting at bit 0 */
+    void compile() {
+        unsigned bit = 0;
+        for (int i = 0; i < channelWidth(); i++, bit++)
+            m_hash.setMask( bit, i < (int)m_channelMasks.size() ? m_channelMasks[i] : (uint64_t)1 << (channelShift() + i) );
+        for (int i = 0; i < rankWidth(); i++, bit++)
+            m_hash.setMask( bit, i < (int)m_rankMasks.size() ? m_rankMasks[i] : (uint64_t)1 << (rankShift() + i) );
+        for (int i = 0; i < bankWidth(); i++, bit++)
+            m_hash.setMask( bit, i < (int)m_bankMasks.size() ? m_bankMasks[i] : (uint64_t)1 << (bankShift() + i) );
+        m_hash.compile();
+        m_lastHash = m_hash.apply( m_lastAddr );
+    }
+
+    uint64_t hash( Addr addr ) {
+        if (!m_hash.isCompiled())
+            compile();
+        if (addr != m_lastAddr) {
+            m_lastAddr = addr;
+            m_lastHash = m_hash.apply( addr );
+        }
+        return m_lastHash;
+    }
+
+    std::vector<uint64_t> m_channelMasks;
+    std::vector<uint64_t> m_rankMasks;
+    std::vector<uint64_t> m_bankMasks;
+    XorHashMatrix m_hash;
+    Addr m_lastAddr;
+    uint64_t m_lastHash;
+};
+
 }
 }
 }
@@ -12,6 +12,8 @@
 
 #include <sst_config.h>
 #include <sst/core/timeLord.h>
+#include <algorithm>
+#include <limits>
 #include "membackend/timingDRAMBackend.h"
 
 using namespace SST;
@@ -22,7 +24,7 @@ bool TimingDRAM::Channel::m_printConfig = true;
 bool TimingDRAM::Rank::m_printConfig = true;
 bool TimingDRAM::Bank::m_printConfig = true;
 
-TimingDRAM::TimingDRAM(ComponentId_t id, Params &params) : SimpleMemBackend(id, params), m_cycle(0) { 
+TimingDRAM::TimingDRAM(ComponentId_t id, Params &params) : SimpleMemBackend(id, params), m_cycle(0), m_lastClockCycle(0) { 
 
     int dram_id = params.find<int>("id", -1);
     assert( dram_id != -1 );
@@ -80,11 +82,29 @@ bool TimingDRAM::issueRequest( ReqId id, Addr addr, bool isWrite, unsigned numBy
 bool TimingDRAM::clock(Cycle_t cycle)
 {
     output->verbose(CALL_INFO, 5, DBG_MASK, "cycle %" PRIu64 "\n",m_cycle);
+    bool idle = true;
     for ( unsigned i = 0; i < m_channels.size(); i++ ) {
         m_channels[i]->clock(m_cycle);
+        idle &= m_channels[i]->isIdle();
     }
     ++m_cycle;
-    return false;
+    m_lastClockCycle = cycle;
+
+    // Nothing changes until a new request arrives, which turns the parent's clock back on
+    return idle;
+}
+
+/*
+ * Parent's clock was off since our last clock() and is back on.
+ * Count the skipped cycles so command timing stays relative to real time.
+ * cycle = current cycle; the next clock() is for cycle+1
+ */
+void TimingDRAM::clockResumed(Cycle_t cycle)
+{
+    if ( cycle > m_lastClockCycle ) {
+        m_cycle += cycle - m_lastClockCycle;
+        m_lastClockCycle = cycle;
+    }
 }
 
 //==================================================================================
@@ -92,7 +112,8 @@ bool TimingDRAM::clock(Cycle_t cycle)
 //==================================================================================
 
 TimingDRAM::Channel::Channel( ComponentId_t id, std::function<void(ReqId)> handler, Params& params, unsigned mc, unsigned myNum, Output* output, AddrMapper* mapper ) :
-    ComponentExtension(id), m_responseHandler(handler), m_output( output ), m_mapper( mapper ), m_nextRankUp(0), m_dataBusAvailCycle(0)
+    ComponentExtension(id), m_responseHandler(handler), m_output( output ), m_mapper( mapper ), m_nextRankUp(0), m_dataBusAvailCycle(0),
+    m_nextDoneCycle(0)
 {
     std::ostringstream tmp;
     tmp << "@t:TimingDRAM:Channel:@p():@l:mc=" << mc << ":chan=" << myNum << ": ";
@@ -124,26 +145,28 @@ void TimingDRAM::Channel::clock( SimTime_t cycle )
     if (is_debug)
         m_output->verbosePrefix(prefix(),CALL_INFO, 5, DBG_MASK, "cycle %" PRIu64 "\n",cycle);
 
-    std::list<Cmd*>::iterator iter = m_issuedCmds.begin();
-
     /* Check all outstanding commands to see if anything is finished */
-    while ( iter != m_issuedCmds.end() ) {
-        if ( (*iter)->isDone(cycle) ) {
-            Cmd* cmd = (*iter);
-
-            if (is_debug)
-                m_output->verbosePrefix(prefix(),CALL_INFO, 2, DBG_MASK, "cycle=%" PRIu64 " retire %s for rank=%d bank=%d row=%d\n",
-                        cycle, cmd->getName().c_str(), cmd->getRank(), cmd->getBank(), cmd->getRow());
+    if ( !m_issuedCmds.empty() && cycle >= m_nextDoneCycle ) {
+        size_t keep = 0;
+        m_nextDoneCycle = std::numeric_limits<SimTime_t>::max();
+        for ( size_t i = 0; i < m_issuedCmds.size(); i++ ) {
+            Cmd* cmd = m_issuedCmds[i];
+            if ( cmd->isDone(cycle) ) {
+                if (is_debug)
+                    m_output->verbosePrefix(prefix(),CALL_INFO, 2, DBG_MASK, "cycle=%" PRIu64 " retire %s for rank=%d bank=%d row=%d\n",
+                            cycle, cmd->getName(), cmd->getRank(), cmd->getBank(), cmd->getRow());
+
+                if (cmd->getTrans() != nullptr) {
+                    m_retiredTrans.push(cmd->getTrans());
+                }
 
-            if (cmd->getTrans() != nullptr) {
-                m_retiredTrans.push(cmd->getTrans());
+                delete cmd;
+            } else {
+                m_nextDoneCycle = std::min(m_nextDoneCycle, cmd->getFiniTime());
+                m_issuedCmds[keep++] = cmd;
             }
-
-            delete (*iter);
-            iter = m_issuedCmds.erase(iter);
-        } else {
-            ++iter;
         }
+        m_issuedCmds.resize(keep);
     }
 
     /* Return a response if possible */
@@ -164,14 +187,27 @@ void TimingDRAM::Channel::clock( SimTime_t cycle )
     if ( cmd ) {
         if (is_debug)
             m_output->verbosePrefix(prefix(),CALL_INFO, 2, DBG_MASK, "cycle=%" PRIu64 " issue %s for rank=%d bank=%d row=%d\n",
-                    cycle, cmd->getName().c_str(), cmd->getRank(), cmd->getBank(), cmd->getRow());
+                    cycle, cmd->getName(), cmd->getRank(), cmd->getBank(), cmd->getRow());
 
         m_dataBusAvailCycle = cmd->issue();
 
+        if ( m_issuedCmds.empty() || cmd->getFiniTime() < m_nextDoneCycle )
+            m_nextDoneCycle = cmd->getFiniTime();
         m_issuedCmds.push_back(cmd);
     }
 }
 
+bool TimingDRAM::Channel::isIdle()
+{
+    if ( !m_issuedCmds.empty() || !m_retiredTrans.empty() )
+        return false;
+    for ( unsigned i = 0; i < m_ranks.size(); i++ ) {
+        if ( m_ranks[i]->hasActiveBanks() )
+            return false;
+    }
+    return true;
+}
+
 TimingDRAM::Cmd* TimingDRAM::Channel::popCmd( SimTime_t cycle, SimTime_t dataBusAvailCycle )
 {
     Cmd* cmd = nullptr;
@@ -205,7 +241,7 @@ TimingDRAM::Cmd* TimingDRAM::Channel::popCmd( SimTime_t cycle, SimTime_t dataBus
 //==================================================================================
 
 TimingDRAM::Rank::Rank( ComponentId_t id, Params& params, unsigned mc, unsigned chan, unsigned myNum, Output* output, AddrMapper* mapper ) :
-    ComponentExtension(id), m_output( output ), m_mapper( mapper ), m_nextBankUp(0)
+    ComponentExtension(id), m_output( output ), m_mapper( mapper ), m_nextBankUp(0), m_numBanksActive(0)
 {
     std::ostringstream tmp;
     tmp << "@t:TimingDRAM:Rank:@p():@l:mc=" << mc << ":chan=" << chan << ":rank=" << myNum <<": ";
@@ -226,6 +262,7 @@ TimingDRAM::Rank::Rank( ComponentId_t id, Params& params, unsigned mc, unsigned
     for ( unsigned i=0; i<banks; i++ ) {
         m_banks.push_back( loadComponentExtension<Bank>( tmpParams, mc, chan, myNum, i, output ) );
     }
+    m_banksActive.resize(banks, false);
 }
 
 TimingDRAM::Cmd* TimingDRAM::Rank::popCmd( SimTime_t cycle, SimTime_t dataBusAvailCycle )
@@ -235,11 +272,13 @@ TimingDRAM::Cmd* TimingDRAM::Rank::popCmd( SimTime_t cycle, SimTime_t dataBusAva
 
     unsigned current = m_nextBankUp;
     for ( unsigned i = 0; i < m_banks.size(); i++ ) {
-        if (m_banksActive.find(current) != m_banksActive.end()) {
+        if (m_banksActive[current]) {
             Cmd* cmd = m_banks[current]->popCmd( cycle, dataBusAvailCycle );
 
-            if (m_banks[current]->isIdle())
-                m_banksActive.erase(current);
+            if (m_banks[current]->isIdle()) {
+                m_banksActive[current] = false;
+                m_numBanksActive--;
+            }
 
             if ( cmd ) {
                 if ( current == m_nextBankUp ) {
@@ -308,7 +347,7 @@ TimingDRAM::Cmd* TimingDRAM::Bank::popCmd( SimTime_t cycle, SimTime_t dataBusAva
     if ( ! m_cmdQ.empty() && m_cmdQ.front()->canIssue( cycle, dataBusAvailCycle ) ) {
         cmd = m_cmdQ.front();
         if (is_debug)
-            m_output->verbosePrefix(prefix(),CALL_INFO, 2, DBG_MASK, "%s row=%d\n",cmd->getName().c_str(), cmd->getRow() );
+            m_output->verbosePrefix(prefix(),CALL_INFO, 2, DBG_MASK, "%s row=%d\n",cmd->getName(), cmd->getRow() );
         m_cmdQ.pop_front();
     }
     return cmd;
@@ -22,6 +22,7 @@
 #include "sst/elements/memHierarchy/membackend/timingTransaction.h"
 #include "sst/elements/memHierarchy/membackend/timingPagePolicy.h"
 #include "sst/elements/memHierarchy/util.h"
+#include "sst/elements/memHierarchy/memEventPool.h"
 
 namespace SST {
 namespace MemHierarchy {
@@ -134,22 +135,15 @@ private:
         Cmd( Bank* bank, Op op, unsigned cycles, unsigned row = -1, unsigned dataCycles = 0, Transaction* trans  = NULL  ) :
             m_bank(bank), m_op(op), m_cycles(cycles), m_row(row), m_dataCycles(dataCycles), m_trans(trans)
         {
-            switch( m_op ) {
-              case PRE:
-                m_name = "PRE";
-                break;
-              case ACT:
-                m_name = "ACT";
-                break;
-              case COL:
-                m_name = "COL";
-                break;
-            }
             if (is_debug)
                 m_bank->verbose(__LINE__,__FUNCTION__,"new %s for rank=%d bank=%d row=%d\n",
-                        getName().c_str(), getRank(), getBank(), getRow());
+                        getName(), getRank(), getBank(), getRow());
         }
 
+        // Several commands are created and retired per transaction
+        static void* operator new(std::size_t size) { return MemEventPool::allocate(size); }
+        static void operator delete(void* ptr, std::size_t size) { MemEventPool::deallocate(ptr, size); }
+
         ~Cmd() {
             m_bank->clearLastCmd();
         }
@@ -209,8 +203,13 @@ private:
             return ( now >= m_finiTime );
         }
 
+        SimTime_t getFiniTime() { return m_finiTime; }
+
         // these are used for debugging
-        std::string& getName()  { return m_name; }
+        const char* getName() {
+            static const char* names[] = { "PRE", "ACT", "COL" };
+            return names[m_op];
+        }
         unsigned getRank()      { return m_bank->getRank(); }
         unsigned getBank()      { return m_bank->getBank(); }
         unsigned getRow()       { return m_row; }
@@ -218,7 +217,6 @@ private:
       private:
 
         Bank*           m_bank;
-        std::string     m_name;
         unsigned        m_cycles;
         unsigned        m_row;
         unsigned        m_dataCycles;
@@ -249,11 +247,14 @@ private:
 
             m_banks[bank]->pushTrans( trans );
 
-            m_banksActive.insert(bank);
+            if ( !m_banksActive[bank] ) {
+                m_banksActive[bank] = true;
+                m_numBanksActive++;
+            }
         }
 
         bool hasActiveBanks() {
-            return !m_banksActive.empty();
+            return m_numBanksActive != 0;
         }
 
       private:
@@ -265,7 +266,8 @@ private:
 
         unsigned            m_nextBankUp;
         std::vector<Bank*>  m_banks;
-        std::set<unsigned>  m_banksActive;
+        std::vector<bool>   m_banksActive;
+        unsigned            m_numBanksActive;
     };
 
     class Channel : public ComponentExtension {
@@ -297,6 +299,9 @@ private:
 
         void clock(SimTime_t );
 
+        /* Whether there is nothing in flight, so the parent may stop clocking us */
+        bool isIdle();
+
       private:
         Cmd* popCmd( SimTime_t cycle, SimTime_t dataBusAvailCycle );
         const char* prefix() { return m_pre.c_str(); }
@@ -311,7 +316,8 @@ private:
         unsigned            m_maxPendingTrans;
         unsigned            m_pendingCount;
 
-        std::list<Cmd*>     m_issuedCmds;
+        std::vector<Cmd*>   m_issuedCmds;   // In issue order
+        SimTime_t           m_nextDoneCycle; // Earliest cycle an issued command can retire
         std::queue<Transaction*> m_retiredTrans;
 
         std::function<void(ReqId)> m_responseHandler;
@@ -328,12 +334,14 @@ public:
         handleMemResponse( id );
     }
     virtual bool clock(Cycle_t cycle);
+    virtual void clockResumed(Cycle_t cycle);
     virtual void finish() {}
 
 private:
     std::vector<Channel*> m_channels;
     AddrMapper* m_mapper;
     SimTime_t   m_cycle;
+    Cycle_t     m_lastClockCycle;   // Parent cycle of our last clock(), for catching up m_cycle after idle periods
 
 };
 
@@ -157,7 +157,7 @@ MemCacheController::MemCacheController(ComponentId_t id, Params &params) : Compo
     if (sizeBytes > memBackendConvertor_->getMemSize()) {
         sizeBytes = memBackendConvertor_->getMemSize();
         // Since getMemSize() might not be a power of 2, but malloc store needs it....get a reasonably close power of 2
-        sizeBytes = 1 << log2Of(memBackendConvertor_->getMemSize());
+        sizeBytes = (size_t)1 << log2Of(memBackendConvertor_->getMemSize());
     }
 
     if (backingType == "mmap") {
@@ -193,6 +193,13 @@ MemCacheController::MemCacheController(ComponentId_t id, Params &params) : Compo
                 getName().c_str(), memSize_, lineSize_);
     cache_.resize(cachesize, CacheState(0,I));
 
+    assoc_ = params.find<uint64_t>("associativity", 1);
+    if (assoc_ == 0 || cachesize % assoc_ != 0)
+        out.fatal(CALL_INFO, -1, "%s, Error - Invalid param: associativity. Must be at least 1 and divide the number of lines (%" PRIu64 "). You specified %" PRIu64 "\n",
+                getName().c_str(), cachesize, assoc_);
+    numSets_ = cachesize / assoc_;
+    sramTags_ = params.find<bool>("sram_tags", false);
+
     /* Statistics */
     statReadHit = registerStatistic<uint64_t>("CacheHits_Read");
     statReadMiss = registerStatistic<uint64_t>("CacheMisses_Read");
@@ -257,95 +264,118 @@ void MemCacheController::handleEvent(SST::Event* event) {
 
 
 void MemCacheController::handleRead(MemEvent* event, bool replay) {
-    Addr cacheIndex = toLocalAddr(event->getBaseAddr());
-    if (cacheIndex >= cache_.size())
+    Addr set = getSet(event->getBaseAddr());
+    if (set >= numSets_)
         out.fatal(CALL_INFO, -1, "%s, Error: cache index exceeds cache size, try again!\n", getName().c_str());
-    Addr blockAddr = cache_[cacheIndex].addr;
-    State blockState = cache_[cacheIndex].state;
+
+    if (!replay) {
+        MemAccessRecord& rec = outstandingEvents_[event->getID()];
+        rec.event = event;
+        pushMSHR(set, event->getID());
+    }
+    MemAccessRecord* rec = outstandingEvents_.find(event->getID());
+
+    if (mshr_.find(set)->head != event->getID()) {                          // Transition
+        rec->status = AccessStatus::STALL;
+        if (is_debug_event(event))
+            Debug(_L3_, "%" PRIu64 " (%s) StateTransition %" PRIu64 ", STALL\n", getCurrentSimTimeNano(), getName().c_str(), event->getID().first);
+        return;
+    }
+
+    rec->slot = lookup(set, event->getBaseAddr());
+    Addr blockAddr = cache_[rec->slot].addr;
+    State blockState = cache_[rec->slot].state;
 
     if (is_debug_event(event)) {
         Debug(_L3_, "%" PRIu64 " (%s) handleRead, Line: %" PRIu64 ", 0x%" PRIx64 ", %s\n",
                 getCurrentSimTimeNano(),
                 getName().c_str(),
-                cacheIndex,
+                rec->slot,
                 blockAddr,
                 StateString[blockState]);
     }
 
-    if (!replay) {
-        MemAccessRecord rec;
-        rec.event = event;
-        outstandingEvents_.insert(std::make_pair(event->getID(), rec));
-        mshr_[cacheIndex].push(event->getID());
-    }
-    std::map<SST::Event::id_type, MemAccessRecord>::iterator it = outstandingEvents_.find(event->getID());
-
-    if (mshr_.find(cacheIndex)->second.front() != event->getID()) {         // Transition
-        it->second.status = AccessStatus::STALL;
-        if (is_debug_event(event))
-            Debug(_L3_, "%" PRIu64 " (%s) StateTransition %" PRIu64 ", STALL\n", getCurrentSimTimeNano(), getName().c_str(), event->getID().first);
-        return;
-    } else if (blockState == I || blockAddr != event->getBaseAddr()) {      // MISS
-        it->second.status = (blockState == M) ? AccessStatus::MISS_WB : AccessStatus::MISS;
+    if (blockState == I || blockAddr != event->getBaseAddr()) {             // MISS
+        rec->status = (blockState == M) ? AccessStatus::MISS_WB : AccessStatus::MISS;
         statReadMiss->addData(1);
         if (is_debug_event(event))
             Debug(_L3_, "%" PRIu64 " (%s) StateTransition %" PRIu64 ", %s\n", getCurrentSimTimeNano(), getName().c_str(), event->getID().first, (blockState == M) ? "MISS_WB" : "MISS");
     } else {                                                                // HIT
         statReadHit->addData(1);
-        it->second.status = AccessStatus::HIT;
+        rec->status = AccessStatus::HIT;
         if (is_debug_event(event))
             Debug(_L3_, "%" PRIu64 " (%s) StateTransition %" PRIu64 ", HIT\n", getCurrentSimTimeNano(), getName().c_str(), event->getID().first);
     }
+    touch(rec->slot);
 
-    it->second.reqev = new MemEvent(*event);
-    it->second.reqev->setBaseAddr(cacheIndex);
-    it->second.reqev->setAddr(event->getAddr() - event->getBaseAddr() + cacheIndex);
-    it->second.reqev->setCmd(Command::GetS);
+    /* SRAM tags already said this is a clean miss, no need to read the line */
+    if (sramTags_ && rec->status == AccessStatus::MISS) {
+        requestRemoteData(*rec);
+        return;
+    }
+
+    rec->reqev = new MemEvent(*event);
+    rec->reqev->setBaseAddr(rec->slot);
+    rec->reqev->setAddr(event->getAddr() - event->getBaseAddr() + rec->slot);
+    rec->reqev->setCmd(Command::GetS);
 
-    memBackendConvertor_->handleMemEvent(it->second.reqev);
+    memBackendConvertor_->handleMemEvent(rec->reqev);
 }
 
 void MemCacheController::handleWrite(MemEvent* event, bool replay) {
-    Addr cacheIndex = toLocalAddr(event->getBaseAddr());
-    Addr blockAddr = cache_[cacheIndex].addr;
-    State blockState = cache_[cacheIndex].state;
-
-    if (is_debug_event(event))
-        Debug(_L3_, "\n%" PRIu64 " (%s) handleWrite, Line: %" PRIu64 ", 0x%" PRIx64 ", %s\n", getCurrentSimTimeNano(), getName().c_str(), cacheIndex, blockAddr, StateString[blockState]);
+    Addr set = getSet(event->getBaseAddr());
 
     if (!replay) {
-        MemAccessRecord rec;
+        MemAccessRecord& rec = outstandingEvents_[event->getID()];
         rec.event = event;
-        outstandingEvents_.insert(std::make_pair(event->getID(), rec));
-        mshr_[cacheIndex].push(event->getID());
+        pushMSHR(set, event->getID());
     }
-    std::map<SST::Event::id_type, MemAccessRecord>::iterator it = outstandingEvents_.find(event->getID());
+    MemAccessRecord* rec = outstandingEvents_.find(event->getID());
 
-    if (mshr_.find(cacheIndex)->second.front() != event->getID()) {         // Transition
-        it->second.status = AccessStatus::STALL;
+    if (mshr_.find(set)->head != event->getID()) {                          // Transition
+        rec->status = AccessStatus::STALL;
         if (is_debug_event(event))
             Debug(_L3_, "\n%" PRIu64 " (%s) StateTransition %" PRIu64 ", STALL\n", getCurrentSimTimeNano(), getName().c_str(), event->getID().first);
         return;
-    } else if (blockState == I || blockAddr != event->getBaseAddr()) {      // MISS
+    }
+
+    rec->slot = lookup(set, event->getBaseAddr());
+    Addr blockAddr = cache_[rec->slot].addr;
+    State blockState = cache_[rec->slot].state;
+
+    if (is_debug_event(event))
+        Debug(_L3_, "\n%" PRIu64 " (%s) handleWrite, Line: %" PRIu64 ", 0x%" PRIx64 ", %s\n", getCurrentSimTimeNano(), getName().c_str(), rec->slot, blockAddr, StateString[blockState]);
+
+    if (blockState == I || blockAddr != event->getBaseAddr()) {             // MISS
         // Do a read to time the state lookup
         statWriteMiss->addData(1);
-        it->second.status = (blockState == M ) ? AccessStatus::MISS_WB : AccessStatus::MISS;
+        rec->status = (blockState == M ) ? AccessStatus::MISS_WB : AccessStatus::MISS;
         if (is_debug_event(event))
             Debug(_L3_, "\n%" PRIu64 " (%s) StateTransition %" PRIu64 ", %s\n", getCurrentSimTimeNano(), getName().c_str(), event->getID().first, (blockState == M) ? "MISS_WB" : "MISS");
     } else {                                                                // HIT
         statWriteHit->addData(1);
-        it->second.status = AccessStatus::HIT_TAG;
+        rec->status = AccessStatus::HIT_TAG;
         if (is_debug_event(event))
             Debug(_L3_, "\n%" PRIu64 " (%s) StateTransition %" PRIu64 ", HIT\n", getCurrentSimTimeNano(), getName().c_str(), event->getID().first);
     }
+    touch(rec->slot);
+
+    /* With SRAM tags the tag check is done, only a dirty victim still needs a read */
+    if (sramTags_ && rec->status == AccessStatus::HIT_TAG) {
+        writeLocalData(*rec);
+        return;
+    } else if (sramTags_ && rec->status == AccessStatus::MISS) {
+        requestRemoteData(*rec);
+        return;
+    }
 
     /* Lookup tag data -> required whether or not this is a hit */
-    it->second.reqev = new MemEvent(*event);
-    it->second.reqev->setBaseAddr(cacheIndex);
-    it->second.reqev->setAddr(event->getAddr() - event->getBaseAddr() + cacheIndex);
-    it->second.reqev->setCmd(Command::GetS);
+    rec->reqev = new MemEvent(*event);
+    rec->reqev->setBaseAddr(rec->slot);
+    rec->reqev->setAddr(event->getAddr() - event->getBaseAddr() + rec->slot);
+    rec->reqev->setCmd(Command::GetS);
 
-    memBackendConvertor_->handleMemEvent(it->second.reqev);
+    memBackendConvertor_->handleMemEvent(rec->reqev);
 }
 
 
@@ -357,56 +387,56 @@ void MemCacheController::handleFlush(MemEvent* event) {
 
 /* Response from remote memory */
 void MemCacheController::handleDataResponse(MemEvent* event) {
-    std::map<SST::Event::id_type,MemAccessRecord>::iterator it = outstandingEvents_.find(event->getID());
-    Addr cacheIndex = toLocalAddr(event->getBaseAddr());
-    Addr blockAddr = cache_[cacheIndex].addr;
-    State blockState = cache_[cacheIndex].state;
+    MemAccessRecord* rec = outstandingEvents_.find(event->getID());
+    Addr slot = rec->slot;
+    Addr blockAddr = cache_[slot].addr;
+    State blockState = cache_[slot].state;
 
     if (is_debug_event(event))
         Debug(_L3_, "\n%" PRIu64 " (%s) handleDataResponse, Line: %" PRIu64 ", 0x%" PRIx64 ", %s\n",
-                getCurrentSimTimeNano(), getName().c_str(), cacheIndex, blockAddr, StateString[blockState]);
+                getCurrentSimTimeNano(), getName().c_str(), slot, blockAddr, StateString[blockState]);
 
     // update the backing store from the remote memory response
     if (backing_)
         writeData(event);
 
     // Update local memory
-    it->second.reqev = new MemEvent(*it->second.event);
-    it->second.reqev->setAddr(cacheIndex);
-    it->second.reqev->setBaseAddr(cacheIndex);
-    it->second.reqev->setCmd(Command::PutM);
-    it->second.reqev->setPayload(event->getPayload());
-    it->second.reqev->clearFlag();
-    it->second.reqev->setFlag(MemEvent::F_NORESPONSE);
-    it->second.status = AccessStatus::FIN;
+    rec->reqev = new MemEvent(*rec->event);
+    rec->reqev->setAddr(slot);
+    rec->reqev->setBaseAddr(slot);
+    rec->reqev->setCmd(Command::PutM);
+    rec->reqev->setPayload(event->getPayload());
+    rec->reqev->clearFlag();
+    rec->reqev->setFlag(MemEvent::F_NORESPONSE);
+    rec->status = AccessStatus::FIN;
     if (is_debug_event(event))
-        Debug(_L3_, "\n%" PRIu64 " (%s) StateTransition %" PRIu64 ", FIN\n", getCurrentSimTimeNano(), getName().c_str(), it->second.event->getID().first);
-    memBackendConvertor_->handleMemEvent(it->second.reqev);
+        Debug(_L3_, "\n%" PRIu64 " (%s) StateTransition %" PRIu64 ", FIN\n", getCurrentSimTimeNano(), getName().c_str(), rec->event->getID().first);
+    memBackendConvertor_->handleMemEvent(rec->reqev);
 
     // Update backing store from the request that missed if it was a write
-    if (it->second.event->getCmd() == Command::PutM || it->second.event->getCmd() == Command::Write) {
-        cache_[cacheIndex].state = M;
+    if (rec->event->getCmd() == Command::PutM || rec->event->getCmd() == Command::Write) {
+        cache_[slot].state = M;
         if (backing_)
-            writeData(it->second.event);
+            writeData(rec->event);
     } else {
-        cache_[cacheIndex].state = E;
+        cache_[slot].state = E;
     }
 
     // Respond to requestor
-    if (!(it->second.event->queryFlag(MemEvent::F_NORESPONSE))) {
-        sendResponse(it->second.event, 0);
+    if (!(rec->event->queryFlag(MemEvent::F_NORESPONSE))) {
+        sendResponse(rec->event, 0);
     }
     delete event;
 }
 
 /* Response from memory cache */
 void MemCacheController::handleLocalMemResponse( Event::id_type id, uint32_t flags) {
-    std::map<SST::Event::id_type,MemAccessRecord>::iterator it = outstandingEvents_.find(id);
-    if (it == outstandingEvents_.end())
+    MemAccessRecord* rec = outstandingEvents_.find(id);
+    if (rec == nullptr)
         out.fatal(CALL_INFO, -1, "%s, MemoryCache received unrecognized response ID: %" PRIu64 ", %" PRIu32 "", getName().c_str(), id.first, id.second);
 
-    delete it->second.reqev;
-    MemEventBase * evb = it->second.event;
+    delete rec->reqev;
+    MemEventBase * evb = rec->event;
 
     if (is_debug_event(evb)) {
         Debug(_L3_, "MemoryCache: %s - Response received to (%s)\n", getName().c_str(), evb->getVerboseString(dlevel).c_str());
@@ -425,17 +455,17 @@ void MemCacheController::handleLocalMemResponse( Event::id_type id, uint32_t fla
 
     bool noncacheable  = ev->queryFlag(MemEvent::F_NONCACHEABLE);
 
-    Addr cacheIndex = toLocalAddr(ev->getBaseAddr());
-    Addr blockAddr = cache_[cacheIndex].addr;
-    State blockState = cache_[cacheIndex].state;
+    Addr slot = rec->slot;
+    Addr set = slot / assoc_;
+    Addr blockAddr = cache_[slot].addr;
+    State blockState = cache_[slot].state;
 
     if (is_debug_event(ev))
         Debug(_L3_, "\n%" PRIu64 " (%s) handleLocalResponse, Line: %" PRIu64 ", 0x%" PRIx64 ", %s\n",
-                getCurrentSimTimeNano(), getName().c_str(), cacheIndex, blockAddr, StateString[blockState]);
+                getCurrentSimTimeNano(), getName().c_str(), slot, blockAddr, StateString[blockState]);
 
-    MemEvent * remoteRd, *remoteWr;
-    Addr localIndex;
-    switch (it->second.status) {
+    MemEvent * remoteWr;
+    switch (rec->status) {
         case AccessStatus::MISS_WB:
             /* Write back data to memory */
             remoteWr = new MemEvent(getName(), blockAddr, blockAddr, Command::PutM, lineSize_);
@@ -444,28 +474,10 @@ void MemCacheController::handleLocalMemResponse( Event::id_type id, uint32_t fla
             remoteWr->setDst(link_->getTargetDestination(remoteWr->getBaseAddr()));
             link_->send(remoteWr);
         case AccessStatus::MISS:
-            /* Read new data from memory */
-            remoteRd = new MemEvent(*ev);
-            remoteRd->setCmd(Command::GetS);
-            remoteRd->setSrc(getName());
-            remoteRd->setDst(link_->getTargetDestination(remoteRd->getBaseAddr()));
-            if (remoteRd->queryFlag(MemEvent::F_NORESPONSE))
-                remoteRd->clearFlag(MemEvent::F_NORESPONSE);
-            it->second.reqev = remoteRd;
-            link_->send(remoteRd);
-            it->second.status = AccessStatus::DATA; // We've request data, waiting for response
-            if (is_debug_event(it->second.event))
-                Debug(_L3_, "\n%" PRIu64 " (%s) StateTransition %" PRIu64 ", DATA\n", getCurrentSimTimeNano(), getName().c_str(), it->second.event->getID().first);
-            cache_[cacheIndex].addr = ev->getBaseAddr();
-            cache_[cacheIndex].state = IM;
+            requestRemoteData(*rec);
             break;
         case AccessStatus::HIT_TAG: // tag hit, issue write
-            it->second.reqev = new MemEvent(*ev);
-            it->second.status = AccessStatus::HIT;
-            if (is_debug_event(it->second.event))
-                Debug(_L3_, "\n%" PRIu64 " (%s) StateTransition %" PRIu64 ", HIT\n", getCurrentSimTimeNano(), getName().c_str(), it->second.event->getID().first);
-            memBackendConvertor_->handleMemEvent(ev);
-            cache_[cacheIndex].state = M;
+            writeLocalData(*rec);
             break;
         case AccessStatus::HIT:
             /* Write data. Here instead of receive to try to match backing access order to backend execute order */
@@ -476,15 +488,13 @@ void MemCacheController::handleLocalMemResponse( Event::id_type id, uint32_t fla
                 sendResponse(ev, flags);
             }
         case AccessStatus::FIN: // Just finished updating the cache, ready for new requests now
-            if (is_debug_event(it->second.event))
-                Debug(_L3_, "\n%" PRIu64 " (%s) StateTransition %" PRIu64 ", ERASE\n", getCurrentSimTimeNano(), getName().c_str(), it->second.event->getID().first);
+            if (is_debug_event(rec->event))
+                Debug(_L3_, "\n%" PRIu64 " (%s) StateTransition %" PRIu64 ", ERASE\n", getCurrentSimTimeNano(), getName().c_str(), rec->event->getID().first);
             delete ev;
-            mshr_[cacheIndex].pop();
-            outstandingEvents_.erase(it);
-            if (mshr_[cacheIndex].empty())
-                mshr_.erase(cacheIndex);
-            else
-                retry(cacheIndex);
+            popMSHR(set);
+            outstandingEvents_.erase(id);
+            if (mshr_.find(set) != nullptr)
+                retry(set);
             break;
         default:
             out.fatal(CALL_INFO, -1, "%s, MemoryCache encountered unhandled record status. Event is %s\n",
@@ -492,8 +502,35 @@ void MemCacheController::handleLocalMemResponse( Event::id_type id, uint32_t fla
     }
 }
 
-void MemCacheController::retry(uint64_t cacheIndex) {
-    MemEvent* ev = outstandingEvents_.find(mshr_[cacheIndex].front())->second.event;
+/* Miss, read the line from remote memory */
+void MemCacheController::requestRemoteData(MemAccessRecord& rec) {
+    MemEvent * remoteRd = new MemEvent(*rec.event);
+    remoteRd->setCmd(Command::GetS);
+    remoteRd->setSrc(getName());
+    remoteRd->setDst(link_->getTargetDestination(remoteRd->getBaseAddr()));
+    if (remoteRd->queryFlag(MemEvent::F_NORESPONSE))
+        remoteRd->clearFlag(MemEvent::F_NORESPONSE);
+    rec.reqev = remoteRd;
+    link_->send(remoteRd);
+    rec.status = AccessStatus::DATA; // We've request data, waiting for response
+    if (is_debug_event(rec.event))
+        Debug(_L3_, "\n%" PRIu64 " (%s) StateTransition %" PRIu64 ", DATA\n", getCurrentSimTimeNano(), getName().c_str(), rec.event->getID().first);
+    cache_[rec.slot].addr = rec.event->getBaseAddr();
+    cache_[rec.slot].state = IM;
+}
+
+/* Write hit, the tag is checked so write the data */
+void MemCacheController::writeLocalData(MemAccessRecord& rec) {
+    rec.reqev = new MemEvent(*rec.event);
+    rec.status = AccessStatus::HIT;
+    if (is_debug_event(rec.event))
+        Debug(_L3_, "\n%" PRIu64 " (%s) StateTransition %" PRIu64 ", HIT\n", getCurrentSimTimeNano(), getName().c_str(), rec.event->getID().first);
+    memBackendConvertor_->handleMemEvent(rec.event);
+    cache_[rec.slot].state = M;
+}
+
+void MemCacheController::retry(Addr set) {
+    MemEvent* ev = outstandingEvents_.find(mshr_.find(set)->head)->event;
 
     if (is_debug_event(ev)) {
         Debug(_L3_, "\n%" PRIu64 " (%s) Retrying: %s\n", getCurrentSimTimeNano(), getName().c_str(), ev->getVerboseString(dlevel).c_str());
@@ -513,6 +550,48 @@ void MemCacheController::retry(uint64_t cacheIndex) {
     }
 }
 
+Addr MemCacheController::lookup(Addr set, Addr addr) {
+    Addr first = set * assoc_;
+    Addr victim = first;
+    for (Addr slot = first; slot < first + assoc_; slot++) {
+        if (cache_[slot].state != I && cache_[slot].addr == addr)
+            return slot;
+        if (cache_[victim].state != I && (cache_[slot].state == I || cache_[slot].age > cache_[victim].age))
+            victim = slot;
+    }
+    return victim;
+}
+
+void MemCacheController::touch(Addr slot) {
+    if (assoc_ == 1)
+        return;
+    Addr first = slot - (slot % assoc_);
+    for (Addr way = first; way < first + assoc_; way++) {
+        if (cache_[way].age != UINT32_MAX)
+            cache_[way].age++;
+    }
+    cache_[slot].age = 0;
+}
+
+void MemCacheController::pushMSHR(Addr set, SST::Event::id_type id) {
+    SetQueue& queue = mshr_[set];
+    if (queue.size == 0)
+        queue.head = id;
+    else
+        outstandingEvents_.find(queue.tail)->next = id;
+    queue.tail = id;
+    queue.size++;
+}
+
+/* Remove the oldest access waiting on set, its record must still be outstanding */
+void MemCacheController::popMSHR(Addr set) {
+    SetQueue* queue = mshr_.find(set);
+    if (--queue->size == 0)
+        mshr_.erase(set);
+    else
+        queue->head = outstandingEvents_.find(queue->head)->next;
+}
+
 void MemCacheController::sendResponse(MemEvent* ev, uint32_t flags) {
     MemEvent * resp = ev->makeResponse();
 
@@ -623,7 +702,7 @@ void MemCacheController::readData(MemEvent* event) {
     if (backing_)
         backing_->get(localAddr, event->getSize(), payload);
 
-    event->setPayload(payload);
+    event->setPayload(std::move(payload));
 }
 
 
@@ -26,6 +26,7 @@
 #include "sst/elements/memHierarchy/memLinkBase.h"
 #include "sst/elements/memHierarchy/membackend/backing.h"
 #include "sst/elements/memHierarchy/customcmd/customCmdMemory.h"
+#include "sst/elements/memHierarchy/flatHashMap.h"
 
 namespace SST {
 namespace MemHierarchy {
@@ -42,6 +43,8 @@ public:
             {"num_caches",          "(uint) Total number of memory caches", "1"},\
             {"cache_num",           "(uint) Index of this cache between 0 and num_caches-1", "0"}, \
             {"cache_line_size",     "(uint) Cache line size in bytes", "64"}, \
+            {"associativity",       "(uint) Number of ways in each set of the memory cache. Lines in a set are replaced LRU", "1"}, \
+            {"sram_tags",           "(bool) Model tags held in SRAM on the controller: tags are checked without a memory access, so write hits and clean misses skip the tag read. Otherwise tags are stored with the data in memory", "false"}, \
             {"backing",             "(string) Type of backing store to use. Options: 'none' - no backing store (only use if simulation does not require correct memory values), 'malloc', or 'mmap'", "mmap"},\
             {"backing_size_unit",   "(string) For 'malloc' backing stores, malloc granularity", "1MiB"},\
             {"memory_file",         "(string) Optional backing-store file to pre-load memory, or store resulting state", "N/A"},\
@@ -103,24 +106,45 @@ protected:
         MemEvent* event;
         AccessStatus status;
         MemEvent* reqev;
+        Addr slot;                  // Line of cache_ the access uses, set once it reaches the front of the MSHR
+        SST::Event::id_type next;   // Next access waiting on the same set
 
-        MemAccessRecord() : event(nullptr), status(AccessStatus::MISS), reqev(nullptr) { }
-        MemAccessRecord(MemEvent* ev, AccessStatus stat) : event(ev), status(stat), reqev(nullptr) { }
+        MemAccessRecord() : event(nullptr), status(AccessStatus::MISS), reqev(nullptr), slot(0), next(0,0) { }
+        MemAccessRecord(MemEvent* ev, AccessStatus stat) : event(ev), status(stat), reqev(nullptr), slot(0), next(0,0) { }
     };
 
-    std::map<SST::Event::id_type, MemAccessRecord> outstandingEvents_;
+    /* Accesses waiting on a set, oldest first, linked through MemAccessRecord::next */
+    struct SetQueue {
+        SST::Event::id_type head;
+        SST::Event::id_type tail;
+        uint32_t size;
+        SetQueue() : head(0,0), tail(0,0), size(0) { }
+    };
+
+    FlatHashMap<SST::Event::id_type, MemAccessRecord, EventIdHash> outstandingEvents_;
 
-    std::map<uint64_t, std::queue<SST::Event::id_type> > mshr_;
+    FlatHashMap<Addr, SetQueue, IdHash> mshr_;
 
     struct CacheState {
         Addr addr;
         State state;
-        CacheState(Addr a, State s) : addr(a), state(s) { }
+        uint32_t age;   // Accesses to the set since this way was used, for LRU
+        CacheState(Addr a, State s) : addr(a), state(s), age(0) { }
     };
 
     std::vector<CacheState> cache_;
     Addr lineSize_;
     Addr lineOffset_;
+    uint64_t assoc_;
+    uint64_t numSets_;
+    bool sramTags_;
+
+    Addr getSet(Addr addr) { return toLocalAddr(addr) % numSets_; }
+    Addr lookup(Addr set, Addr addr);   // Line holding addr, or the victim to replace if it is not cached
+    void touch(Addr slot);
+
+    void pushMSHR(Addr set, SST::Event::id_type id);
+    void popMSHR(Addr set);
 
     void notifyListeners( MemEvent* ev ) {
         if (  ! listeners_.empty()) {
@@ -143,7 +167,10 @@ protected:
     void handleWrite(MemEvent* ev, bool replay);
     void handleFlush(MemEvent* ev);
     void handleDataResponse(MemEvent* ev);
-    void retry(Addr cacheIndex);
+    void retry(Addr set);
+
+    void requestRemoteData(MemAccessRecord& rec);
+    void writeLocalData(MemAccessRecord& rec);
 
     void sendResponse(MemEvent* ev, uint32_t flags);
 
@@ -121,6 +121,10 @@ MemController::MemController(ComponentId_t id, Params &params) : Component(id),
     clockHandler_ = new Clock::Handler<MemController>(this, &MemController::clock);
     clockTimeBase_ = registerClock(clockfreq, clockHandler_);
     clockOn_ = true;
+    lastActiveClockCycle_ = 0;
+
+    statClockTicksExecuted_ = registerStatistic<uint64_t>("clock_ticks_executed");
+    statClockTicksSkipped_ = registerStatistic<uint64_t>("clock_ticks_skipped");
 
 
     string link_lat         = params.find<std::string>("direct_link_latency", "10 ns");
@@ -299,7 +303,7 @@ MemController::MemController(ComponentId_t id, Params &params) : Component(id),
     if (sizeBytes > memBackendConvertor_->getMemSize()) {
         sizeBytes = memBackendConvertor_->getMemSize();
         // Since getMemSize() might not be a power of 2, but malloc store needs it....get a reasonably close power of 2
-        sizeBytes = 1 << log2Of(memBackendConvertor_->getMemSize());
+        sizeBytes = (size_t)1 << log2Of(memBackendConvertor_->getMemSize());
     }
 
     if (backingType == "mmap") {
@@ -309,7 +313,16 @@ MemController::MemController(ComponentId_t id, Params &params) : Component(id),
             memoryFile.clear();
         }
         try {
-            backing_ = new Backend::BackingMMAP( memoryFile, memBackendConvertor_->getMemSize() );
+            if ( CHECKPOINT_LOAD == checkpoint_ && memoryFile.empty() ) {
+                stringstream filename;
+                filename << checkpointDir_ << "/" << getName();
+                auto fp = fopen(filename.str().c_str(),"rb");
+                assert(fp);
+                backing_ = new Backend::BackingMMAP( fp, memBackendConvertor_->getMemSize() );
+                fclose(fp);
+            } else {
+                backing_ = new Backend::BackingMMAP( memoryFile, memBackendConvertor_->getMemSize(), 0, sizeBytes );
+            }
         }
         catch ( int e) {
             if (e == 1)
@@ -329,9 +342,10 @@ MemController::MemController(ComponentId_t id, Params &params) : Component(id),
             stringstream filename;
             filename << checkpointDir_ << "/" << getName();
             //printf("%s\n",filename.str().c_str());
-            auto fp = fopen(filename.str().c_str(),"r");
+            auto fp = fopen(filename.str().c_str(),"rb");
             assert(fp);
             backing_ = new Backend::BackingMalloc(fp);
+            fclose(fp);
         } else {
             backing_ = new Backend::BackingMalloc(sizeBytes,initBacking);
         }
@@ -469,6 +483,8 @@ void MemController::handleEvent(SST::Event* event) {
 }
 
 bool MemController::clock(Cycle_t cycle) {
+    statClockTicksExecuted_->addData(1);
+
     bool unclockLink = true;
     if (clockLink_) {
         unclockLink = link_->clock();
@@ -477,8 +493,7 @@ bool MemController::clock(Cycle_t cycle) {
     bool unclockBack = memBackendConvertor_->clock( cycle );
 
     if (unclockLink && unclockBack) {
-        memBackendConvertor_->turnClockOff();
-        clockOn_ = false;
+        turnClockOff(cycle);
         return true;
     }
 
@@ -489,9 +504,18 @@ Cycle_t MemController::turnClockOn() {
     Cycle_t cycle = reregisterClock(clockTimeBase_, clockHandler_);
     cycle--;
     clockOn_ = true;
+    if (cycle > lastActiveClockCycle_)
+        statClockTicksSkipped_->addData(cycle - lastActiveClockCycle_);
     return cycle;
 }
 
+/* Caller's clock handler must return true after calling this */
+void MemController::turnClockOff(Cycle_t cycle) {
+    memBackendConvertor_->turnClockOff();
+    clockOn_ = false;
+    lastActiveClockCycle_ = cycle;
+}
+
 void MemController::handleCustomEvent(MemEventBase * ev) {
     if (!customCommandHandler_)
         out.fatal(CALL_INFO, -1, "%s, Error: Received custom event but no handler loaded. Ev = %s. Time = %" PRIu64 "ns\n",
@@ -606,7 +630,7 @@ void MemController::finish(void) {
     if ( CHECKPOINT_SAVE ==  checkpoint_ ) {
         stringstream filename;
         filename << checkpointDir_ << "/" << getName();
-        auto fp = fopen(filename.str().c_str(),"w+");
+        auto fp = fopen(filename.str().c_str(),"wb+");
         assert(fp);
         printf("Checkpoint component `%s` %s\n",getName().c_str(), filename.str().c_str());
         backing_->dump( fp );
@@ -655,7 +679,7 @@ void MemController::readData(MemEvent* event) {
             printDataValue(localAddr, &(payload), false);
     }
 
-    event->setPayload(payload);
+    event->setPayload(std::move(payload));
 }
 
 
@@ -663,9 +687,7 @@ void MemController::readData(MemEvent* event) {
 void MemController::writeData(Addr addr, std::vector<uint8_t> * data) {
     if (!backing_) return;
 
-    for (size_t i = 0; i < data->size(); i++) {
-        backing_->set(addr + i, data->at(i));
-    }
+    backing_->set(addr, data->size(), *data);
 
     if (is_debug_addr(addr))
         printDataValue(addr, data, true);
@@ -677,8 +699,7 @@ void MemController::readData(Addr addr, size_t bytes, std::vector<uint8_t> &data
 
     if (!backing_) return;
 
-    for (size_t i = 0; i < bytes; i++)
-        data[i] = backing_->get(addr + i);
+    backing_->get(addr, bytes, data);
     
     if (is_debug_addr(addr))
         printDataValue(addr, &data, false);
@@ -51,7 +51,7 @@ public:
             {"listenercount",       "(uint) Counts the number of listeners attached to this controller, these are modules for tracing or components like prefetchers", "0"},\
             {"listener%(listenercount)d", "(string) Loads a listener module into the controller", ""},\
             {"backing",             "(string) Type of backing store to use. Options: 'none' - no backing store (only use if simulation does not require correct memory values), 'malloc', or 'mmap'", "mmap"},\
-            {"backing_size_unit",   "(string) For 'malloc' backing stores, malloc granularity", "1MiB"},\
+            {"backing_size_unit",   "(string) For 'malloc' backing stores, malloc granularity. For 'mmap' backing stores without a memory_file, checkpoint granularity", "1MiB"},\
             {"memory_file",         "(string) Optional backing-store file to pre-load memory, or store resulting state", "N/A"},\
             {"addr_range_start",    "(uint) Lowest address handled by this memory.", "0"},\
             {"addr_range_end",      "(uint) Highest address handled by this memory.", "uint64_t-1"},\
@@ -78,6 +78,11 @@ public:
 
     SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS( MEMCONTROLLER_ELI_SUBCOMPONENTSLOTS )
 
+#define MEMCONTROLLER_ELI_STATISTICS {"clock_ticks_executed", "Number of cycles the controller's clock handler ran", "cycles", 1},\
+            {"clock_ticks_skipped", "Number of cycles the controller's clock was off because the controller and its backend convertor were idle", "cycles", 1}
+
+    SST_ELI_DOCUMENT_STATISTICS( MEMCONTROLLER_ELI_STATISTICS )
+
 /* Begin class definition */
     typedef uint64_t ReqId;
 
@@ -89,6 +94,7 @@ public:
     virtual void handleMemResponse( SST::Event::id_type id, uint32_t flags );
 
     SST::Cycle_t turnClockOn();
+    void turnClockOff(SST::Cycle_t cycle);
 
     /* For updating memory values. CustomMemoryCommand should call this */
     void writeData(Addr addr, std::vector<uint8_t>* data);
@@ -146,6 +152,10 @@ protected:
     size_t memSize_;
 
     bool clockOn_;
+    SST::Cycle_t lastActiveClockCycle_;  // Cycle the clock was turned off at
+
+    Statistic<uint64_t>* statClockTicksExecuted_;
+    Statistic<uint64_t>* statClockTicksSkipped_;
 
     MemRegion region_; // Which address region we are, for translating to local addresses
     Addr privateMemOffset_; // If we reserve any memory locations for ourselves/directories/etc. and they are NOT part of the physical address space, shift regular addresses by this much
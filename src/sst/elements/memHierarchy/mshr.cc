@@ -34,6 +34,111 @@ MSHR::MSHR(ComponentId_t cid, Output* debug, int maxSize, string cacheName, std:
     d2_->init("", 10, 0, (Output::output_location_t)1);
 
     DEBUG_ADDR = debugAddr;
+
+    // Size the table for twice the maximum number of event entries; writebacks & evictions may add more
+    size_t capacity = 16;
+    size_t target = (maxSize_ > 0) ? 2 * (size_t)maxSize_ : 64;
+    while (capacity < target)
+        capacity *= 2;
+    tableUsed_ = 0;
+    tableDeleted_ = 0;
+    resizeTable(capacity);
+}
+
+/*
+ * Register table management
+ * Linear probing over a power-of-two table of pointers to pooled registers.
+ * Removed registers leave a tombstone; the table is rebuilt when tombstones
+ * plus live entries pass 3/4 occupancy.
+ */
+MSHRRegister* MSHR::findRegister(Addr addr) {
+    size_t index = hashAddr(addr);
+    while (true) {
+        Slot& slot = table_[index];
+        if (slot.state == SlotState::Empty)
+            return nullptr;
+        if (slot.state == SlotState::Used && slot.addr == addr)
+            return slot.reg;
+        index = (index + 1) & tableMask_;
+    }
+}
+
+MSHRRegister* MSHR::insertRegister(Addr addr) {
+    MSHRRegister* reg;
+    if (freeRegisters_.empty()) {
+        registers_.emplace_back(&entryPool_);
+        reg = &(registers_.back());
+    } else {
+        reg = freeRegisters_.back();
+        freeRegisters_.pop_back();
+    }
+
+    size_t index = hashAddr(addr);
+    while (table_[index].state == SlotState::Used)
+        index = (index + 1) & tableMask_;
+    if (table_[index].state == SlotState::Deleted)
+        tableDeleted_--;
+    table_[index].addr = addr;
+    table_[index].reg = reg;
+    table_[index].state = SlotState::Used;
+    tableUsed_++;
+
+    if ((tableUsed_ + tableDeleted_) * 4 > table_.size() * 3)
+        resizeTable(tableUsed_ * 2 > table_.size() / 2 ? table_.size() * 2 : table_.size());
+    return reg;
+}
+
+void MSHR::eraseRegister(Addr addr) {
+    size_t index = hashAddr(addr);
+    while (true) {
+        Slot& slot = table_[index];
+        if (slot.state == SlotState::Empty)
+            return;
+        if (slot.state == SlotState::Used && slot.addr == addr) {
+            slot.reg->reset();
+            freeRegisters_.push_back(slot.reg);
+            slot.reg = nullptr;
+            slot.state = SlotState::Deleted;
+            tableUsed_--;
+            tableDeleted_++;
+            return;
+        }
+        index = (index + 1) & tableMask_;
+    }
+}
+
+void MSHR::resizeTable(size_t capacity) {
+    std::vector<Slot> old;
+    old.swap(table_);
+    table_.resize(capacity);
+    tableMask_ = capacity - 1;
+    hashShift_ = 64 - log2Of(capacity);
+    tableDeleted_ = 0;
+
+    for (std::vector<Slot>::iterator it = old.begin(); it != old.end(); it++) {
+        if (it->state != SlotState::Used) continue;
+        size_t index = hashAddr(it->addr);
+        while (table_[index].state == SlotState::Used)
+            index = (index + 1) & tableMask_;
+        table_[index] = *it;
+    }
+}
+
+MSHREvictList* MSHR::allocateEvictList() {
+    if (freeEvictLists_.empty()) {
+        evictLists_.emplace_back(MSHRPoolAllocator<Addr>(&evictPool_));
+        return &(evictLists_.back());
+    }
+    MSHREvictList* list = freeEvictLists_.back();
+    freeEvictLists_.pop_back();
+    return list;
+}
+
+void MSHR::releaseEntry(MSHREntry& entry) {
+    if (entry.getType() == MSHREntryType::Evict) {
+        entry.getPointers()->clear();
+        freeEvictLists_.push_back(entry.getPointers());
+    }
 }
 
 int MSHR::getMaxSize() {
@@ -45,49 +150,52 @@ int MSHR::getSize() {
 }
 
 unsigned int MSHR::getSize(Addr addr) {
-    if (mshr_.find(addr) == mshr_.end())
+    MSHRRegister* reg = findRegister(addr);
+    if (reg == nullptr)
         return 0;
     else
-        return mshr_.find(addr)->second.entries.size();
+        return reg->entries.size();
 }
 
 bool MSHR::exists(Addr addr) {
-    return mshr_.find(addr) != mshr_.end();
+    return findRegister(addr) != nullptr;
 }
 
-MSHREntry MSHR::getEntry(Addr addr, size_t index) {
-    if (mshr_.find(addr) == mshr_.end()) {
+MSHREntry& MSHR::getEntry(Addr addr, size_t index) {
+    MSHRRegister* reg = findRegister(addr);
+    if (reg == nullptr) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getEntry(0x%" PRIx64 ", %zu). Address doesn't exist in MSHR.\n", ownerName_.c_str(), addr, index);
     }
-    if (mshr_.find(addr)->second.entries.size() <= index) {
-        d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getEntry(0x%" PRIx64 ", %zu). Entry list size is %zu.\n", ownerName_.c_str(), addr, index, mshr_.find(addr)->second.entries.size());
+    if (reg->entries.size() <= index) {
+        d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getEntry(0x%" PRIx64 ", %zu). Entry list size is %zu.\n", ownerName_.c_str(), addr, index, reg->entries.size());
     }
-    std::list<MSHREntry>::iterator it = mshr_.find(addr)->second.entries.begin();
+    MSHREntryList::iterator it = reg->entries.begin();
     std::advance(it, index);
     return *it;
 }
 
-MSHREntry MSHR::getFront(Addr addr) {
-    if (mshr_.find(addr) == mshr_.end()) {
+MSHREntry& MSHR::getFront(Addr addr) {
+    MSHRRegister* reg = findRegister(addr);
+    if (reg == nullptr) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getFront(0x%" PRIx64 "). Address doesn't exist in MSHR.\n", ownerName_.c_str(), addr);
     }
 
-    if (mshr_.find(addr)->second.entries.empty()) {
+    if (reg->entries.empty()) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getFront(0x%" PRIx64 "). Entry list is empty.\n", ownerName_.c_str(), addr);
     }
-    return mshr_.find(addr)->second.entries.front();
+    return reg->entries.front();
 }
 
 void MSHR::removeEntry(Addr addr, size_t index) {
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRRegister * reg = findRegister(addr);
+    if (reg == nullptr) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::removeEntry(0x%" PRIx64 ", %zu). Address doesn't exist in MSHR.\n", ownerName_.c_str(), addr, index);
     }
-    MSHRRegister * reg = &(mshr_.find(addr)->second);
     if (reg->entries.size() <= index) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::removeEntry(0x%" PRIx64 ", %zu). Entry list is shorter than requested index.\n", ownerName_.c_str(), addr, index);
     }
 
-    std::list<MSHREntry>::iterator entry = reg->entries.begin();
+    MSHREntryList::iterator entry = reg->entries.begin();
     std::advance(entry, index);
 
     if (entry->getType() == MSHREntryType::Event)
@@ -96,78 +204,69 @@ void MSHR::removeEntry(Addr addr, size_t index) {
     if (is_debug_addr(addr))
         printDebug(10, "Remove", addr, (*entry).getString().c_str());
 
+    releaseEntry(*entry);
     reg->entries.erase(entry);
     if (reg->entries.empty()) {
         if (is_debug_addr(addr))
             printDebug(10, "Erase", addr, "");
-            //d_->debug(_L10_, "M: %-41" PRIu64 " %-20s Erase        0x%-16" PRIx64 " %-10d\n",
-            //        getCurrentSimCycle(), ownerName_.c_str(), addr, size_);
-            //d_->debug(_L10_, "    MSHR: erasing 0x%" PRIx64 " from MSHR\n", addr);
-        mshr_.erase(addr);
+        eraseRegister(addr);
     }
 }
 
 void MSHR::removeFront(Addr addr) {
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRRegister * reg = findRegister(addr);
+    if (reg == nullptr) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::removeFront(0x%" PRIx64 "). Address doesn't exist in MSHR.\n", ownerName_.c_str(), addr);
     }
-    MSHRRegister * reg = &(mshr_.find(addr)->second);
     if (reg->entries.empty()) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::removeFront(0x%" PRIx64 "). Entry list is empty.\n", ownerName_.c_str(), addr);
     }
 
-   // if (is_debug_addr(addr))
-   //     d_->debug(_L10_, "    MSHR::removeFront(0x%" PRIx64 ", %s)\n", addr, reg->entries.front().getString().c_str());
-
-    if (getFrontType(addr) == MSHREntryType::Event)
+    if (reg->entries.front().getType() == MSHREntryType::Event)
         size_--;
 
     if (is_debug_addr(addr))
         printDebug(10, "RemFr", addr, (reg->entries.front()).getString().c_str());
 
+    releaseEntry(reg->entries.front());
     reg->entries.pop_front();
     if (reg->entries.empty()) {
         if (is_debug_addr(addr))
             printDebug(10, "Erase", addr, "");
-            //d_->debug(_L10_, "    MSHR: erasing 0x%" PRIx64 " from MSHR\n", addr);
-        mshr_.erase(addr);
+        eraseRegister(addr);
     }
 }
 
 MSHREntryType MSHR::getEntryType(Addr addr, size_t index) {
-    //if (is_debug_addr(addr))
-    //    d_->debug(_L20_, "    MSHR::getEntryType(0x%" PRIx64 ", %zu)\n", addr, index);
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRRegister* reg = findRegister(addr);
+    if (reg == nullptr) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getEntryType(0x%" PRIx64 ", %zu). Address doesn't exist in MSHR.\n", ownerName_.c_str(), addr, index);
     }
-    if (mshr_.find(addr)->second.entries.size() <= index) {
+    if (reg->entries.size() <= index) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getEntryType(0x%" PRIx64 ", %zu). Entry list is shoerter than index.\n", ownerName_.c_str(), addr, index);
     }
-    std::list<MSHREntry>::iterator it = mshr_.find(addr)->second.entries.begin();
+    MSHREntryList::iterator it = reg->entries.begin();
     std::advance(it, index);
     return it->getType();
 }
 
 MSHREntryType MSHR::getFrontType(Addr addr) {
-    //if (is_debug_addr(addr))
-    //    d_->debug(_L20_, "    MSHR::getFrontType(0x%" PRIx64 ")\n", addr);
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRRegister* reg = findRegister(addr);
+    if (reg == nullptr) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getFrontType(0x%" PRIx64 "). Address doesn't exist in MSHR.\n", ownerName_.c_str(), addr);
     }
-    if (mshr_.find(addr)->second.entries.empty()) {
+    if (reg->entries.empty()) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getFrontType(0x%" PRIx64 "). Entry list is empty.\n", ownerName_.c_str(), addr);
     }
-    return mshr_.find(addr)->second.entries.front().getType();
+    return reg->entries.front().getType();
 }
 
 MemEventBase* MSHR::getEntryEvent(Addr addr, size_t index) {
-    //if (is_debug_addr(addr))
-    //    d_->debug(_L20_, "    MSHR::getEntryEvent(0x%" PRIx64 ", %zu)\n", addr, index);
-
-    if (mshr_.find(addr) == mshr_.end() || mshr_.find(addr)->second.entries.size() <= index)
+    MSHRRegister* reg = findRegister(addr);
+    if (reg == nullptr || reg->entries.size() <= index)
         return nullptr;
 
-    std::list<MSHREntry>::iterator it = mshr_.find(addr)->second.entries.begin();
+    MSHREntryList::iterator it = reg->entries.begin();
     std::advance(it, index);
     if (it->getType() != MSHREntryType::Event)
         return nullptr;
@@ -176,38 +275,37 @@ MemEventBase* MSHR::getEntryEvent(Addr addr, size_t index) {
 
 
 MemEventBase* MSHR::getFrontEvent(Addr addr) {
-    //if (is_debug_addr(addr))
-    //    d_->debug(_L20_, "    MSHR::getFrontEvent(0x%" PRIx64 ")\n", addr);
-    if (getFrontType(addr) != MSHREntryType::Event) {
+    MSHREntry& entry = getFront(addr);
+    if (entry.getType() != MSHREntryType::Event) {
         return nullptr;
     }
-    return mshr_.find(addr)->second.entries.front().getEvent();
+    return entry.getEvent();
 }
 
 MemEventBase* MSHR::getFirstEventEntry(Addr addr, Command cmd) {
-//    if (is_debug_addr(addr))
-//        d_->debug(_L20_, "    MSHR::getFirstEventEntry(0x%" PRIx64 ", %s)\n", addr, CommandString[(int)cmd]);
-
-    if (mshr_.find(addr) == mshr_.end())
+    MSHRRegister* reg = findRegister(addr);
+    if (reg == nullptr)
         return nullptr;
 
-    for (std::list<MSHREntry>::iterator it = mshr_.find(addr)->second.entries.begin(); it != mshr_.find(addr)->second.entries.end(); it++) {
+    for (MSHREntryList::iterator it = reg->entries.begin(); it != reg->entries.end(); it++) {
         if (it->getType() == MSHREntryType::Event && it->getEvent()->getCmd() == cmd)
             return it->getEvent();
     }
     return nullptr;
 }
 
-std::list<Addr>* MSHR::getEvictPointers(Addr addr) {
-    if (getFrontType(addr) != MSHREntryType::Evict)
+MSHREvictList* MSHR::getEvictPointers(Addr addr) {
+    MSHREntry& entry = getFront(addr);
+    if (entry.getType() != MSHREntryType::Evict)
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getEvictPointers(0x%" PRIx64 "). Entry type is not Evict.\n", ownerName_.c_str(), addr);
 
-    return mshr_.find(addr)->second.entries.front().getPointers();
+    return entry.getPointers();
 }
 
 // Return whether we should retry a new event or not
 bool MSHR::removeEvictPointer(Addr addr, Addr addrPtr) {
-    if (getFrontType(addr) == MSHREntryType::Event)
+    MSHREntryType frontType = getFrontType(addr);
+    if (frontType == MSHREntryType::Event)
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::removeEvictPointer(0x%" PRIx64 ", 0x%" PRIx64 "). Front entry type is not Evict or Writeback.\n", ownerName_.c_str(), addr, addrPtr);
 
     if (is_debug_addr(addr) || is_debug_addr(addrPtr)) {
@@ -216,16 +314,18 @@ bool MSHR::removeEvictPointer(Addr addr, Addr addrPtr) {
         printDebug(10, "RemPtr", addr, reason.str());
     }
 
+    MSHRRegister* reg = findRegister(addr);
+
     // Sometimes we insert a WB before the Evict & then remove the Evict pointer, othertimes the Evict is front
-    if (getFrontType(addr) == MSHREntryType::Evict) {
-        MSHREntry * entry = &(mshr_.find(addr)->second.entries.front());
+    if (frontType == MSHREntryType::Evict) {
+        MSHREntry * entry = &(reg->entries.front());
         entry->getPointers()->remove(addrPtr);
         if (entry->getPointers()->empty()) {
             removeFront(addr);
             return true;
         }
     } else {
-        std::list<MSHREntry>::iterator it = mshr_.find(addr)->second.entries.begin();
+        MSHREntryList::iterator it = reg->entries.begin();
         it++;
         if (it->getType() != MSHREntryType::Evict)
             d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::removeEvictPointer(0x%" PRIx64 ", 0x%" PRIx64 "). Entry type is not Evict.\n", ownerName_.c_str(), addr, addrPtr);
@@ -243,7 +343,7 @@ bool MSHR::pendingWriteback(Addr addr) {
 
 bool MSHR::pendingWritebackIsDowngrade(Addr addr) {
     if (pendingWriteback(addr))
-        return mshr_.find(addr)->second.entries.front().getDowngrade();
+        return findRegister(addr)->entries.front().getDowngrade();
     return false;
 }
 
@@ -260,11 +360,11 @@ int MSHR::insertEvent(Addr addr, MemEventBase* event, int pos, bool fwdRequest,
     // Success
     size_++;
 
-    if (mshr_.find(addr) == mshr_.end()) {
-        MSHRRegister reg;
-        reg.entries.push_back(MSHREntry(event, stallEvict, getCurrentSimCycle()));
+    MSHRRegister* reg = findRegister(addr);
+    if (reg == nullptr) {
+        reg = insertRegister(addr);
+        reg->entries.push_back(MSHREntry(event, stallEvict, getCurrentSimCycle()));
 
-        mshr_.insert(std::make_pair(addr, reg));
         if (is_debug_addr(addr)) {
             stringstream reason;
             reason << "<" << event->getID().first << "," << event->getID().second << ">, pos=0";
@@ -274,18 +374,18 @@ int MSHR::insertEvent(Addr addr, MemEventBase* event, int pos, bool fwdRequest,
 
         return 0;
     } else {
-        if (pos == -1 || pos > mshr_.find(addr)->second.entries.size()) {
-            mshr_.find(addr)->second.entries.push_back(MSHREntry(event, stallEvict, getCurrentSimCycle()));
+        if (pos == -1 || pos > reg->entries.size()) {
+            reg->entries.push_back(MSHREntry(event, stallEvict, getCurrentSimCycle()));
             if (is_debug_addr(addr)) {
                 stringstream reason;
-                reason << "<" << event->getID().first << "," << event->getID().second << ">, pos=" << (mshr_.find(addr)->second.entries.size() - 1);
+                reason << "<" << event->getID().first << "," << event->getID().second << ">, pos=" << (reg->entries.size() - 1);
                 printDebug(10, "InsEv", addr, reason.str());
             }
-            return (mshr_.find(addr)->second.entries.size() - 1);
+            return (reg->entries.size() - 1);
         } else {
-            std::list<MSHREntry>::iterator it = mshr_.find(addr)->second.entries.begin();
+            MSHREntryList::iterator it = reg->entries.begin();
             std::advance(it, pos);
-            mshr_.find(addr)->second.entries.insert(it, MSHREntry(event, stallEvict, getCurrentSimCycle()));
+            reg->entries.insert(it, MSHREntry(event, stallEvict, getCurrentSimCycle()));
             if (is_debug_addr(addr)) {
                 stringstream reason;
                 reason << "<" << event->getID().first << "," << event->getID().second << ">, pos=" << pos;
@@ -304,9 +404,10 @@ int MSHR::insertEvent(Addr addr, MemEventBase* event, int pos, bool fwdRequest,
  *      -1 = conflict, not inserted
  */
 int MSHR::insertEventIfConflict(Addr addr, MemEventBase* event) {
-    if (mshr_.find(addr) == mshr_.end())
+    MSHRRegister* reg = findRegister(addr);
+    if (reg == nullptr)
         return 0;
-    
+
     if (size_ == maxSize_-1) { /* Assuming fwdEvent == false */
         if (is_debug_addr(addr)) {
             stringstream reason;
@@ -316,61 +417,56 @@ int MSHR::insertEventIfConflict(Addr addr, MemEventBase* event) {
         return -1;
     }
     size_++;
-    mshr_.find(addr)->second.entries.push_back(MSHREntry(event, false, getCurrentSimCycle()));
+    reg->entries.push_back(MSHREntry(event, false, getCurrentSimCycle()));
     if (is_debug_addr(addr)) {
         stringstream reason;
-        reason << "<" << event->getID().first << "," << event->getID().second << ">, pos=" << (mshr_.find(addr)->second.entries.size() - 1);
+        reason << "<" << event->getID().first << "," << event->getID().second << ">, pos=" << (reg->entries.size() - 1);
         printDebug(10, "InsEv", addr, reason.str());
     }
-    return (mshr_.find(addr)->second.entries.size() - 1);
+    return (reg->entries.size() - 1);
 }
 
 MemEventBase* MSHR::swapFrontEvent(Addr addr, MemEventBase* event) {
     if (is_debug_addr(addr))
         printDebug(10, "SwpEv", addr, "");
 
-    if (mshr_.find(addr)->second.entries.empty())
+    MSHRRegister* reg = findRegister(addr);
+    if (reg == nullptr || reg->entries.empty())
         return nullptr;
 
-    return  mshr_.find(addr)->second.entries.front().swapEvent(event, getCurrentSimCycle());
+    return reg->entries.front().swapEvent(event, getCurrentSimCycle());
 }
 
 void MSHR::moveEntryToFront(Addr addr, unsigned int index) {
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRRegister * reg = findRegister(addr);
+    if (reg == nullptr) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::moveEntryToFront(0x%" PRIx64 ", %u). Address doesn't exist in MSHR.\n", ownerName_.c_str(), addr, index);
     }
-    MSHRRegister * reg = &(mshr_.find(addr)->second);
     if (reg->entries.size() <= index) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::moveEntryToFront(0x%" PRIx64 ", %u). Entry list is shorter than requested index.\n", ownerName_.c_str(), addr, index);
     }
 
-    std::list<MSHREntry>::iterator entry = reg->entries.begin();
+    MSHREntryList::iterator entry = reg->entries.begin();
     std::advance(entry, index);
 
-    MSHREntry tmpEntry = *entry;
-
     if (is_debug_addr(addr))
         printDebug(10, "MvEnt", addr, entry->getString());
-    reg->entries.erase(entry);
-    reg->entries.push_front(tmpEntry);
+    reg->entries.splice(reg->entries.begin(), reg->entries, entry);
 }
 
 bool MSHR::insertWriteback(Addr addr, bool downgrade) {
-//    if (is_debug_addr(addr))
-//        d_->debug(_L10_, "    MSHR::insertWriteback(0x%" PRIx64 ")\n", addr);
-
     if (is_debug_addr(addr)) {
         stringstream reason;
         reason << "Downgrade: " << (downgrade ? "T" : "F");
         printDebug(10, "InsWB", addr, reason.str());
     }
 
-    if (mshr_.find(addr) == mshr_.end()) {
-        MSHRRegister reg;
-        reg.entries.push_back(MSHREntry(downgrade, getCurrentSimCycle()));
-        mshr_.insert(std::make_pair(addr, reg));
+    MSHRRegister* reg = findRegister(addr);
+    if (reg == nullptr) {
+        reg = insertRegister(addr);
+        reg->entries.push_back(MSHREntry(downgrade, getCurrentSimCycle()));
     } else {
-        mshr_.find(addr)->second.entries.push_front(MSHREntry(downgrade, getCurrentSimCycle()));
+        reg->entries.push_front(MSHREntry(downgrade, getCurrentSimCycle()));
     }
 
     return true;
@@ -378,25 +474,22 @@ bool MSHR::insertWriteback(Addr addr, bool downgrade) {
 
 
 bool MSHR::insertEviction(Addr oldAddr, Addr newAddr) {
-//    if (is_debug_addr(oldAddr) || is_debug_addr(newAddr))
-//        d_->debug(_L10_, "    MSHR::insertEviction(0x%" PRIx64 ", 0x%" PRIx64 ")\n", oldAddr, newAddr);
-
     if (is_debug_addr(oldAddr) || is_debug_addr(newAddr)) {
         stringstream reason;
         reason << "to 0x" << std::hex << newAddr;
         printDebug(10, "InsPtr", oldAddr, reason.str());
     }
 
-    if (mshr_.find(oldAddr) == mshr_.end()) {  // No MSHR entry for oldAddr
-        MSHRRegister reg;
-        reg.entries.push_back(MSHREntry(newAddr, getCurrentSimCycle()));
-        mshr_.insert(std::make_pair(oldAddr, reg));
+    MSHRRegister* reg = findRegister(oldAddr);
+    if (reg == nullptr) {  // No MSHR entry for oldAddr
+        reg = insertRegister(oldAddr);
+        reg->entries.push_back(MSHREntry(allocateEvictList(), newAddr, getCurrentSimCycle()));
     } else {
-        list<MSHREntry>* entries = &(mshr_.find(oldAddr)->second.entries);
+        MSHREntryList* entries = &(reg->entries);
         if (!entries->empty() && entries->back().getType() == MSHREntryType::Evict) { // MSHR entry for oldAddr is an Evict
             entries->back().getPointers()->push_back(newAddr);
         } else { // MSHR entry for oldAddr is not an Evict (or no entry exists)
-            entries->push_back(MSHREntry(newAddr, getCurrentSimCycle()));
+            entries->push_back(MSHREntry(allocateEvictList(), newAddr, getCurrentSimCycle()));
         }
     }
     return true;
@@ -406,53 +499,53 @@ void MSHR::addPendingRetry(Addr addr) {
     if (is_debug_addr(addr))
         printDebug(20, "IncRetry", addr, "");
 
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRRegister* reg = findRegister(addr);
+    if (reg == nullptr) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::addPendingRetry(0x%" PRIx64 "). Address does not exist in MSHR.\n", ownerName_.c_str(), addr);
     }
-    mshr_.find(addr)->second.addPendingRetry();
+    reg->addPendingRetry();
 }
 
 void MSHR::removePendingRetry(Addr addr) {
     if (is_debug_addr(addr))
         printDebug(20, "DecRetry", addr, "");
 
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRRegister* reg = findRegister(addr);
+    if (reg == nullptr) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::removePendingRetry(0x%" PRIx64 "). Address does not exist in MSHR.\n", ownerName_.c_str(), addr);
     }
-    mshr_.find(addr)->second.removePendingRetry();
+    reg->removePendingRetry();
 }
 
 uint32_t MSHR::getPendingRetries(Addr addr) {
-    if (mshr_.find(addr) == mshr_.end())
+    MSHRRegister* reg = findRegister(addr);
+    if (reg == nullptr)
         return 0;
 
-    return mshr_.find(addr)->second.getPendingRetries();
+    return reg->getPendingRetries();
 }
 
 
 void MSHR::setInProgress(Addr addr, bool value) {
-//    if (is_debug_addr(addr))
-//        d_->debug(_L10_, "    MSHR::setInProgress(0x%" PRIx64 ")\n", addr);
     if (is_debug_addr(addr))
         printDebug(20, "InProg", addr, "");
 
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRRegister* reg = findRegister(addr);
+    if (reg == nullptr) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::setInProgress(0x%" PRIx64 "). Address does not exist in MSHR.\n", ownerName_.c_str(), addr);
     }
-    if (mshr_.find(addr)->second.entries.empty()) {
+    if (reg->entries.empty()) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::setInProgress(0x%" PRIx64 "). Entry list is empty.\n", ownerName_.c_str(), addr);
     }
-    mshr_.find(addr)->second.entries.front().setInProgress(value);
+    reg->entries.front().setInProgress(value);
 }
 
 bool MSHR::getInProgress(Addr addr) {
-    if (mshr_.find(addr) == mshr_.end()) {
-        return false;
-    }
-    if (mshr_.find(addr)->second.entries.empty()) {
+    MSHRRegister* reg = findRegister(addr);
+    if (reg == nullptr || reg->entries.empty()) {
         return false;
     }
-    return mshr_.find(addr)->second.entries.front().getInProgress();
+    return reg->entries.front().getInProgress();
 }
 
 void MSHR::setStalledForEvict(Addr addr, bool set) {
@@ -463,56 +556,56 @@ void MSHR::setStalledForEvict(Addr addr, bool set) {
             printDebug(20, "Unstall", addr, "");
     }
 
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRRegister* reg = findRegister(addr);
+    if (reg == nullptr) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::setStalledForEvict(0x%" PRIx64 "). Address does not exist in MSHR.\n", ownerName_.c_str(), addr);
     }
-    if (mshr_.find(addr)->second.entries.empty()) {
+    if (reg->entries.empty()) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::setStalledForEvict(0x%" PRIx64 "). Entry list is empty.\n", ownerName_.c_str(), addr);
     }
-    mshr_.find(addr)->second.entries.front().setStalledForEvict(set);
+    reg->entries.front().setStalledForEvict(set);
 }
 
 bool MSHR::getStalledForEvict(Addr addr) {
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRRegister* reg = findRegister(addr);
+    if (reg == nullptr || reg->entries.empty()) {
         return false;
     }
-    if (mshr_.find(addr)->second.entries.empty()) {
-        return false;
-    }
-    return mshr_.find(addr)->second.entries.front().getStalledForEvict();
+    return reg->entries.front().getStalledForEvict();
 }
 
 void MSHR::setProfiled(Addr addr) {
     if (is_debug_addr(addr))
         printDebug(20, "Profile", addr, "");
 
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRRegister* reg = findRegister(addr);
+    if (reg == nullptr) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::setProfiled(0x%" PRIx64 "). Address does not exist in MSHR.\n", ownerName_.c_str(), addr);
     }
-    if (mshr_.find(addr)->second.entries.empty()) {
+    if (reg->entries.empty()) {
         d_->fatal(CALL_INFO, -1, "%s Error: MSHR::setProfiled(0x%" PRIx64 "). Entry list is empty.\n", ownerName_.c_str(), addr);
     }
-    mshr_.find(addr)->second.entries.front().setProfiled();
+    reg->entries.front().setProfiled();
 }
 
 bool MSHR::getProfiled(Addr addr) {
-//    if (is_debug_addr(addr))
-//        d_->debug(_L20_, "    MSHR::getProfiled(0x%" PRIx64 "\n", addr);
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRRegister* reg = findRegister(addr);
+    if (reg == nullptr) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getProfiled(0x%" PRIx64 "). Address does not exist in MSHR.\n", ownerName_.c_str(), addr);
     }
-    if (mshr_.find(addr)->second.entries.empty()) {
+    if (reg->entries.empty()) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getProfiled(0x%" PRIx64 "). Entry list is empty.\n", ownerName_.c_str(), addr);
     }
-    return mshr_.find(addr)->second.entries.front().getProfiled();
+    return reg->entries.front().getProfiled();
 }
 
 bool MSHR::getProfiled(Addr addr, SST::Event::id_type id) {
-    if (mshr_.find(addr) == mshr_.end())
+    MSHRRegister* reg = findRegister(addr);
+    if (reg == nullptr)
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getProfiled(0x%" PRIx64 ", (%" PRIu64 ", %" PRId32 ")). Address does not exist in MSHR.\n", ownerName_.c_str(), addr, id.first, id.second);
-    if (mshr_.find(addr)->second.entries.empty())
+    if (reg->entries.empty())
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getProfiled(0x%" PRIx64 ", (%" PRIu64 ", %" PRId32 ")). Entry list is empty.\n", ownerName_.c_str(), addr, id.first, id.second);
-    for (list<MSHREntry>::iterator jt = mshr_.find(addr)->second.entries.begin(); jt != mshr_.find(addr)->second.entries.end(); jt++) {
+    for (MSHREntryList::iterator jt = reg->entries.begin(); jt != reg->entries.end(); jt++) {
         if (jt->getType() == MSHREntryType::Event && jt->getEvent()->getID() == id) {
             return jt->getProfiled();
         }
@@ -524,13 +617,14 @@ void MSHR::setProfiled(Addr addr, SST::Event::id_type id) {
     if (is_debug_addr(addr))
         printDebug(20, "Profile", addr, "");
 
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRRegister* reg = findRegister(addr);
+    if (reg == nullptr) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::setProfiled(0x%" PRIx64 ", (%" PRIu64 ", %" PRId32 ")). Address does not exist in MSHR.\n", ownerName_.c_str(), addr, id.first, id.second);
     }
-    if (mshr_.find(addr)->second.entries.empty()) {
+    if (reg->entries.empty()) {
         d_->fatal(CALL_INFO, -1, "%s Error: MSHR::setProfiled(0x%" PRIx64 ", (%" PRIu64 ", %" PRId32 ")). Entry list is empty.\n", ownerName_.c_str(), addr, id.first, id.second);
     }
-    for (list<MSHREntry>::iterator jt = mshr_.find(addr)->second.entries.begin(); jt != mshr_.find(addr)->second.entries.end(); jt++) {
+    for (MSHREntryList::iterator jt = reg->entries.begin(); jt != reg->entries.end(); jt++) {
         if (jt->getType() == MSHREntryType::Event && jt->getEvent()->getID() == id) {
             jt->setProfiled();
             return;
@@ -539,17 +633,14 @@ void MSHR::setProfiled(Addr addr, SST::Event::id_type id) {
 }
 
 MSHREntry* MSHR::getOldestEntry() {
-    bool first = false;
     MSHREntry* entry = nullptr;
-    uint64_t time;
+    uint64_t time = 0;
 
-    for (MSHRBlock::iterator it = mshr_.begin(); it != mshr_.end(); it++) {
-        for (list<MSHREntry>::iterator jt = it->second.entries.begin(); jt != it->second.entries.end(); jt++) {
+    for (std::vector<Slot>::iterator it = table_.begin(); it != table_.end(); it++) {
+        if (it->state != SlotState::Used) continue;
+        for (MSHREntryList::iterator jt = it->reg->entries.begin(); jt != it->reg->entries.end(); jt++) {
             if (jt->getType() == MSHREntryType::Event) {
-                if (!first) {
-                    entry = &(*jt);
-                    time = jt->getStartTime();
-                } else if (jt->getStartTime() < time) {
+                if (entry == nullptr || jt->getStartTime() < time) {
                     entry = &(*jt);
                     time = jt->getStartTime();
                 }
@@ -560,110 +651,104 @@ MSHREntry* MSHR::getOldestEntry() {
 }
 
 void MSHR::incrementAcksNeeded(Addr addr) {
-   // if (is_debug_addr(addr))
-   //     d_->debug(_L10_, "    MSHR::incrementAcksNeeded(0x%" PRIx64 ")\n", addr);
-    if (mshr_.find(addr) == mshr_.end()) {
-        MSHRRegister reg;
-        mshr_.insert(std::make_pair(addr, reg));
+    MSHRRegister* reg = findRegister(addr);
+    if (reg == nullptr) {
+        reg = insertRegister(addr);
     }
-    mshr_.find(addr)->second.acksNeeded++;
+    reg->acksNeeded++;
 
     if (is_debug_addr(addr)) {
         std::stringstream reason;
-        reason << mshr_.find(addr)->second.acksNeeded << " acks";
+        reason << reg->acksNeeded << " acks";
         printDebug(10, "IncAck", addr, reason.str());
     }
 }
 
 /* Decrement acks needed and return if we're done waiting (acksNeeded == 0) */
 bool MSHR::decrementAcksNeeded(Addr addr) {
-   // if (is_debug_addr(addr))
-   //     d_->debug(_L10_, "    MSHR::decrementAcksNeeded(0x%" PRIx64 ")\n", addr);
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRRegister* reg = findRegister(addr);
+    if (reg == nullptr) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::decrementAcksNeeded(0x%" PRIx64 "). Address does not exist in MSHR.\n", ownerName_.c_str(), addr);
     }
-    if (mshr_.find(addr)->second.acksNeeded == 0) {
+    if (reg->acksNeeded == 0) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::decrementAcksNeeded(0x%" PRIx64 "). AcksNeeded is already 0.\n", ownerName_.c_str(), addr);
     }
-    mshr_.find(addr)->second.acksNeeded--;
+    reg->acksNeeded--;
 
     if (is_debug_addr(addr)) {
         std::stringstream reason;
-        reason << mshr_.find(addr)->second.acksNeeded << " acks";
+        reason << reg->acksNeeded << " acks";
         printDebug(10, "DecAck", addr, reason.str());
     }
 
-    return (mshr_.find(addr)->second.acksNeeded == 0);
+    return (reg->acksNeeded == 0);
 }
 
 uint32_t MSHR::getAcksNeeded(Addr addr) {
-//    if (is_debug_addr(addr))
-//        d_->debug(_L20_, "    MSHR::getAcksNeeded(0x%" PRIx64 ")\n", addr);
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRRegister* reg = findRegister(addr);
+    if (reg == nullptr) {
         return 0;
     }
-    return (mshr_.find(addr)->second.acksNeeded);
+    return reg->acksNeeded;
 }
 
 void MSHR::setData(Addr addr, vector<uint8_t>& data, bool dirty) {
-//    if (is_debug_addr(addr))
-//        d_->debug(_L10_, "    MSHR::setData(0x%" PRIx64 ")\n", addr);
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRRegister* reg = findRegister(addr);
+    if (reg == nullptr) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::setData(0x%" PRIx64 "). Address does not exist in MSHR.\n", ownerName_.c_str(), addr);
     }
 
     if (is_debug_addr(addr))
         printDebug(10, "SetData", addr, (dirty ? "Dirty" : "Clean"));
 
-    mshr_.find(addr)->second.dataBuffer = data;
-    mshr_.find(addr)->second.dataDirty = dirty;
+    reg->dataBuffer = data;
+    reg->dataDirty = dirty;
 }
 
 void MSHR::clearData(Addr addr) {
-//    if (is_debug_addr(addr))
-//        d_->debug(_L10_, "    MSHR::clearData(0x%" PRIx64 ")\n", addr);
     if (is_debug_addr(addr))
         printDebug(10, "ClrData", addr, "");
 
-    mshr_.find(addr)->second.dataBuffer.clear();
-    mshr_.find(addr)->second.dataDirty = false;
+    MSHRRegister* reg = findRegister(addr);
+    if (reg == nullptr) {
+        d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::clearData(0x%" PRIx64 "). Address does not exist in MSHR.\n", ownerName_.c_str(), addr);
+    }
+    reg->dataBuffer.clear();
+    reg->dataDirty = false;
 }
 
 vector<uint8_t>& MSHR::getData(Addr addr) {
-//    if (is_debug_addr(addr))
-//        d_->debug(_L20_, "    MSHR::getData(0x%" PRIx64 ")\n", addr);
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRRegister* reg = findRegister(addr);
+    if (reg == nullptr) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getData(0x%" PRIx64 "). Address does not exist in MSHR.\n", ownerName_.c_str(), addr);
     }
-    return mshr_.find(addr)->second.dataBuffer;
+    return reg->dataBuffer;
 }
 
 bool MSHR::hasData(Addr addr) {
-    if (mshr_.find(addr) == mshr_.end())
+    MSHRRegister* reg = findRegister(addr);
+    if (reg == nullptr)
         return false;
-    return !(mshr_.find(addr)->second.dataBuffer.empty());
+    return !(reg->dataBuffer.empty());
 }
 
 bool MSHR::getDataDirty(Addr addr) {
-//    if (is_debug_addr(addr))
-//        d_->debug(_L20_, "    MSHR::getDataDirty(0x%" PRIx64 ")\n", addr);
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRRegister* reg = findRegister(addr);
+    if (reg == nullptr) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::getDataDirty(0x%" PRIx64 "). Address does not exist in MSHR.\n", ownerName_.c_str(), addr);
     }
-    return mshr_.find(addr)->second.dataDirty;
+    return reg->dataDirty;
 }
 
 void MSHR::setDataDirty(Addr addr, bool dirty) {
-//    if (is_debug_addr(addr))
-//        d_->debug(_L10_, "    MSHR::setDataDirty(0x%" PRIx64 ")\n", addr);
-
     if (is_debug_addr(addr))
         printDebug(20, "SetDirt", addr, (dirty ? "Dirty" : "Clean"));
 
-    if (mshr_.find(addr) == mshr_.end()) {
+    MSHRRegister* reg = findRegister(addr);
+    if (reg == nullptr) {
         d_->fatal(CALL_INFO, -1, "%s, Error: MSHR::setDataDirty(0x%" PRIx64 "). Address does not exist in MSHR.\n", ownerName_.c_str(), addr);
     }
-    mshr_.find(addr)->second.dataDirty = dirty;
+    reg->dataDirty = dirty;
 
 }
 
@@ -689,12 +774,20 @@ void MSHR::printDebug(uint32_t lev, std::string action, Addr addr, std::string r
 // Print status. Called by cache controller on EmergencyShutdown and printStatus()
 void MSHR::printStatus(Output &out) {
     out.output("    MSHR Status for %s. Size: %u. Prefetches: %u\b", ownerName_.c_str(), size_, prefetchCount_);
-    for (std::map<Addr,MSHRRegister>::iterator it = mshr_.begin(); it != mshr_.end(); it++) {   // Iterate over addresses
+
+    // Print in address order
+    std::vector<std::pair<Addr, MSHRRegister*> > regs;
+    for (std::vector<Slot>::iterator it = table_.begin(); it != table_.end(); it++) {
+        if (it->state == SlotState::Used)
+            regs.push_back(std::make_pair(it->addr, it->reg));
+    }
+    std::sort(regs.begin(), regs.end());
+
+    for (std::vector<std::pair<Addr, MSHRRegister*> >::iterator it = regs.begin(); it != regs.end(); it++) {   // Iterate over addresses
         out.output("      Entry: Addr = 0x%" PRIx64 "\n", (it->first));
-        for (std::list<MSHREntry>::iterator it2 = it->second.entries.begin(); it2 != it->second.entries.end(); it2++) { // Iterate over entries for each address
+        for (MSHREntryList::iterator it2 = it->second->entries.begin(); it2 != it->second->entries.end(); it2++) { // Iterate over entries for each address
             out.output("        %s\n", it2->getString().c_str());
         }
     }
     out.output("    End MSHR Status for %s\n", ownerName_.c_str());
 }
-
@@ -17,6 +17,12 @@
 #define _MSHR_H_
 
 #include <map>
+#include <list>
+#include <deque>
+#include <vector>
+#include <algorithm>
+#include <cstddef>
+#include <type_traits>
 #include <string>
 #include <sstream>
 
@@ -43,6 +49,85 @@ using namespace std;
 
 enum class MSHREntryType { Event, Evict, Writeback };
 
+/*
+ * Freelist of fixed-size nodes backing the MSHR's lists
+ * Nodes are carved from chunks and recycled rather than returned to the heap.
+ * Each pool serves one node size (set by the first allocation); larger requests fall through to the heap.
+ */
+class MSHRNodePool {
+    public:
+        MSHRNodePool() : nodeSize_(0), freeList_(nullptr) { }
+        ~MSHRNodePool() {
+            for (std::vector<char*>::iterator it = chunks_.begin(); it != chunks_.end(); it++)
+                ::operator delete(*it);
+        }
+
+        void* allocate(size_t bytes) {
+            if (nodeSize_ == 0) {
+                size_t align = alignof(std::max_align_t);
+                nodeSize_ = ((std::max(bytes, sizeof(Node)) + align - 1) / align) * align;
+            }
+            if (bytes > nodeSize_)
+                return ::operator new(bytes);
+            if (freeList_ == nullptr)
+                grow();
+            Node* node = freeList_;
+            freeList_ = node->next;
+            return node;
+        }
+
+        void deallocate(void* ptr, size_t bytes) {
+            if (bytes > nodeSize_) {
+                ::operator delete(ptr);
+                return;
+            }
+            Node* node = static_cast<Node*>(ptr);
+            node->next = freeList_;
+            freeList_ = node;
+        }
+
+    private:
+        struct Node { Node* next; };
+
+        void grow() {
+            const size_t count = 64;
+            char* chunk = static_cast<char*>(::operator new(nodeSize_ * count));
+            chunks_.push_back(chunk);
+            for (size_t i = 0; i < count; i++) {
+                Node* node = reinterpret_cast<Node*>(chunk + i * nodeSize_);
+                node->next = freeList_;
+                freeList_ = node;
+            }
+        }
+
+        size_t nodeSize_;
+        Node* freeList_;
+        std::vector<char*> chunks_;
+};
+
+/* Allocator adapter so std::list nodes come from an MSHRNodePool */
+template <typename T>
+class MSHRPoolAllocator {
+    public:
+        typedef T value_type;
+        typedef std::true_type propagate_on_container_copy_assignment;
+        typedef std::true_type propagate_on_container_move_assignment;
+        typedef std::true_type propagate_on_container_swap;
+
+        MSHRPoolAllocator(MSHRNodePool* pool) : pool_(pool) { }
+        template <typename U> MSHRPoolAllocator(const MSHRPoolAllocator<U>& other) : pool_(other.pool_) { }
+
+        T* allocate(size_t n) { return static_cast<T*>(pool_->allocate(n * sizeof(T))); }
+        void deallocate(T* ptr, size_t n) { pool_->deallocate(ptr, n * sizeof(T)); }
+
+        template <typename U> bool operator==(const MSHRPoolAllocator<U>& other) const { return pool_ == other.pool_; }
+        template <typename U> bool operator!=(const MSHRPoolAllocator<U>& other) const { return pool_ != other.pool_; }
+
+        MSHRNodePool* pool_;
+};
+
+typedef std::list<Addr, MSHRPoolAllocator<Addr> > MSHREvictList;
+
 class MSHREntry {
     public:
         // Event entry
@@ -70,11 +155,11 @@ class MSHREntry {
             downgrade = downgr;
         }
 
-        // Evict entry
-    MSHREntry(Addr addr, SimTime_t curr_time) {
+        // Evict entry - pointer list is owned (and recycled) by the MSHR
+    MSHREntry(MSHREvictList* ptrs, Addr addr, SimTime_t curr_time) {
             type = MSHREntryType::Evict;
             event = nullptr;
-            evictPtrs = new std::list<Addr>;
+            evictPtrs = ptrs;
             evictPtrs->push_back(addr);
             time = curr_time;
             inProgress = false;
@@ -108,7 +193,7 @@ class MSHREntry {
 
         SimTime_t getStartTime() { return time; }
 
-        std::list<Addr>* getPointers() {
+        MSHREvictList* getPointers() {
             return evictPtrs;
         }
 
@@ -142,7 +227,7 @@ class MSHREntry {
                 str << " Type: Event" << " (" << event->getBriefString() << ")";
             } else if (type == MSHREntryType::Evict) {
                 str << " Type: Evict (";
-                for (std::list<Addr>::iterator it = evictPtrs->begin(); it != evictPtrs->end(); it++) {
+                for (MSHREvictList::iterator it = evictPtrs->begin(); it != evictPtrs->end(); it++) {
                     str << " 0x" << std::hex << *it;
                 }
                 str << ")";
@@ -154,7 +239,7 @@ class MSHREntry {
 
     private:
         MSHREntryType type;
-        std::list<Addr> *evictPtrs; // Specific to Evict type
+        MSHREvictList *evictPtrs;   // Specific to Evict type
         MemEventBase* event;        // Specific to Event type
         SimTime_t time;
         bool needEvict;
@@ -163,9 +248,11 @@ class MSHREntry {
         bool downgrade;             // Specific to Writeback type
 };
 
+typedef std::list<MSHREntry, MSHRPoolAllocator<MSHREntry> > MSHREntryList;
+
 struct MSHRRegister {
-    MSHRRegister() : acksNeeded(0), dataDirty(false), pendingRetries(0) { }
-    list<MSHREntry> entries;
+    MSHRRegister(MSHRNodePool* pool) : entries(MSHRPoolAllocator<MSHREntry>(pool)), acksNeeded(0), dataDirty(false), pendingRetries(0) { }
+    MSHREntryList entries;
     uint32_t acksNeeded;
     vector<uint8_t> dataBuffer;
     bool dataDirty;
@@ -174,12 +261,25 @@ struct MSHRRegister {
     uint32_t getPendingRetries() { return pendingRetries; }
     void addPendingRetry() { pendingRetries++; }
     void removePendingRetry() { pendingRetries--; }
-};
 
-typedef map<Addr, MSHRRegister> MSHRBlock;
+    /* Return to the just-constructed state, keeping allocated storage for reuse */
+    void reset() {
+        entries.clear();
+        acksNeeded = 0;
+        dataBuffer.clear();
+        dataDirty = false;
+        pendingRetries = 0;
+    }
+};
 
 /**
  *  Implements an MSHR with entries of type mshrEntry
+ *
+ *  Registers are located through an open-addressed (linear probing) hash table
+ *  sized from the MSHR's maximum size. Registers, entry list nodes, and eviction
+ *  pointer lists are drawn from per-MSHR pools and recycled, so steady-state
+ *  operation does not allocate. Registers never move once allocated so pointers
+ *  and references returned by the accessors remain valid until the register is removed.
  */
 class MSHR : public ComponentExtension {
 public:
@@ -193,20 +293,20 @@ public:
     bool exists(Addr addr);
 
     // Accessors for first event since that's most common
-    MSHREntry getFront(Addr addr);
+    MSHREntry& getFront(Addr addr);
     void removeFront(Addr addr);
 
     MSHREntryType getFrontType(Addr addr);
 
     MemEventBase* getFrontEvent(Addr addr);
-    std::list<Addr>* getEvictPointers(Addr addr);
+    MSHREvictList* getEvictPointers(Addr addr);
     bool removeEvictPointer(Addr addr, Addr ptrAddr);
 
     // Special move accessor
     void moveEntryToFront(Addr addr, unsigned int index);
 
     // Generic accessors
-    MSHREntry getEntry(Addr addr, size_t index);
+    MSHREntry& getEntry(Addr addr, size_t index);
     void removeEntry(Addr addr, size_t index);
 
     MSHREntryType getEntryType(Addr addr, size_t index);
@@ -258,7 +358,38 @@ private:
 
     void printDebug(uint32_t level, std::string action, Addr addr, std::string reason);
 
-    MSHRBlock mshr_;
+    /* Register table */
+    enum class SlotState : uint8_t { Empty, Used, Deleted };
+    struct Slot {
+        Slot() : addr(0), reg(nullptr), state(SlotState::Empty) { }
+        Addr addr;
+        MSHRRegister* reg;
+        SlotState state;
+    };
+
+    inline size_t hashAddr(Addr addr) { return (addr * 0x9E3779B97F4A7C15ULL) >> hashShift_; }
+    MSHRRegister* findRegister(Addr addr);
+    MSHRRegister* insertRegister(Addr addr);    // Addr must not already have a register
+    void eraseRegister(Addr addr);
+    void resizeTable(size_t capacity);
+
+    MSHREvictList* allocateEvictList();
+    void releaseEntry(MSHREntry& entry);        // Recycle any resources owned by an entry being removed
+
+    // Pools - declared before anything that allocates from them
+    MSHRNodePool entryPool_;
+    MSHRNodePool evictPool_;
+    std::deque<MSHRRegister> registers_;        // Stable storage for all registers ever allocated
+    std::vector<MSHRRegister*> freeRegisters_;
+    std::deque<MSHREvictList> evictLists_;      // Stable storage for all evict pointer lists
+    std::vector<MSHREvictList*> freeEvictLists_;
+
+    std::vector<Slot> table_;
+    size_t tableMask_;
+    unsigned int hashShift_;
+    size_t tableUsed_;
+    size_t tableDeleted_;
+
     Output* d_;
     Output* d2_;
     int size_;
@@ -19,6 +19,8 @@
 #include <sst/core/params.h>
 #include <sst/core/interfaces/stringEvent.h>
 
+#include <algorithm>
+
 using namespace SST;
 using namespace SST::MemHierarchy;
 using namespace std;
@@ -67,25 +69,79 @@ MultiThreadL1::MultiThreadL1(ComponentId_t id, Params &params) : Component(id) {
 
     /* Setup throughput limiting */
     requestsPerCycle = params.find<uint64_t>("requests_per_cycle", 0);
+    threadRequestsPerCycle = params.find<uint64_t>("thread_requests_per_cycle", 0);
     responsesPerCycle = params.find<uint64_t>("responses_per_cycle", 0);
+
+    std::string arbitration = params.find<std::string>("arbitration", "oldest");
+    if (arbitration == "oldest") {
+        roundRobin = false;
+    } else if (arbitration == "round_robin") {
+        roundRobin = true;
+    } else {
+        output.fatal(CALL_INFO, -1, "%s, Invalid param: arbitration - must be 'oldest' or 'round_robin'. You specified '%s'.\n", getName().c_str(), arbitration.c_str());
+    }
+    nextThread = 0;
+
+    threadQueues.resize(threadLinks.size());
+    threadIssued.resize(threadLinks.size(), 0);
+    threadStalled.resize(threadLinks.size(), false);
+    queuedRequests = 0;
+    nextSeq = 0;
+
+    /* Setup bank conflict modeling */
+    banks = params.find<unsigned int>("banks", 0);
+    UnitAlgebra interleave(params.find<std::string>("bank_interleave_granularity", "64B"));
+    if (!interleave.hasUnits("B")) {
+        output.fatal(CALL_INFO, -1, "%s, Invalid param: bank_interleave_granularity - must have units of 'B' (bytes). You specified '%s'.\n", getName().c_str(), interleave.toString().c_str());
+    }
+    if (!isPowerOfTwo(interleave.getRoundedValue())) {
+        output.fatal(CALL_INFO, -1, "%s, Invalid param: bank_interleave_granularity - must be a power of 2. You specified '%s'.\n", getName().c_str(), interleave.toString().c_str());
+    }
+    bankShift = log2Of(interleave.getRoundedValue());
+    bankMask = isPowerOfTwo(banks) ? banks - 1 : 0;
+    bankBusy.resize(banks, false);
+
+    /* Setup coalescing */
+    coalesceTable.resize(params.find<unsigned int>("coalesce_entries", 0));
+    coalesceInUse = 0;
+
+    statBankConflict = registerStatistic<uint64_t>("bank_conflicts");
+    statThreadLimit = registerStatistic<uint64_t>("thread_limit_stalls");
+    statCoalesced = registerStatistic<uint64_t>("requests_coalesced");
 }
 
 MultiThreadL1::~MultiThreadL1() {
-    while (requestQueue.size()) {
-        delete requestQueue.front();
-        requestQueue.pop();
+    for (unsigned int i = 0; i < threadQueues.size(); i++) {
+        while (!threadQueues[i].empty()) {
+            delete threadQueues[i].front().event;
+            threadQueues[i].pop_front();
+        }
     }
     while (responseQueue.size()) {
         delete responseQueue.front();
         responseQueue.pop();
     }
+    for (unsigned int i = 0; i < coalesceTable.size(); i++) {
+        for (unsigned int j = 0; j < coalesceTable[i].waiters.size(); j++)
+            delete coalesceTable[i].waiters[j].first;
+    }
 }
 
 void MultiThreadL1::handleRequest(SST::Event * ev, unsigned int threadid) {
     MemEventBase *event = static_cast<MemEventBase*>(ev);
+
+    if (!coalesceTable.empty()) {
+        MemEvent* memEvent = dynamic_cast<MemEvent*>(event);
+        if (memEvent && coalesceRequest(memEvent, threadid)) {
+            statCoalesced->addData(1);
+            return;
+        }
+    }
+
     if (!clockOn) enableClock();
     threadRequestMap.insert(std::make_pair(event->getID(), threadid));
-    requestQueue.push(event);
+    threadQueues[threadid].push_back(Request(event, nextSeq++));
+    queuedRequests++;
 }
 
 void MultiThreadL1::handleResponse(SST::Event * ev) {
@@ -94,25 +150,164 @@ void MultiThreadL1::handleResponse(SST::Event * ev) {
     responseQueue.push(event);
 }
 
+/*
+ * Merge a cacheable read with an outstanding read of the same address and size.
+ * Returns true if the request was merged and should not be forwarded.
+ * Otherwise, if the request is a cacheable read, it gets a table entry if one is free.
+ */
+bool MultiThreadL1::coalesceRequest(MemEvent* event, unsigned int threadid) {
+    Addr addr = event->getAddr();
+    uint32_t size = event->getSize();
+
+    if (event->getCmd() != Command::GetS || event->getFlags() != 0) {
+        // Later reads must not merge with reads that were issued before this request
+        for (unsigned int i = 0; i < coalesceTable.size(); i++) {
+            CoalesceEntry& entry = coalesceTable[i];
+            if (entry.open && entry.addr < addr + size && addr < entry.addr + entry.size)
+                entry.open = false;
+        }
+        return false;
+    }
+
+    int freeEntry = -1;
+    for (unsigned int i = 0; i < coalesceTable.size(); i++) {
+        CoalesceEntry& entry = coalesceTable[i];
+        if (entry.open && entry.addr == addr && entry.size == size) {
+            entry.waiters.push_back(std::make_pair(event, threadid));
+            return true;
+        }
+        if (!entry.inUse && freeEntry < 0)
+            freeEntry = i;
+    }
+
+    if (freeEntry >= 0) {
+        CoalesceEntry& entry = coalesceTable[freeEntry];
+        entry.inUse = true;
+        entry.open = true;
+        entry.addr = addr;
+        entry.size = size;
+        entry.id = event->getID();
+        coalesceInUse++;
+    }
+    return false;
+}
+
+/*
+ * Send a copy of a read response to each request that was merged with it.
+ * Returns true if the response was for a request in the coalescing table.
+ */
+bool MultiThreadL1::respondToWaiters(MemEventBase* response) {
+    if (coalesceInUse == 0)
+        return false;
+
+    for (unsigned int i = 0; i < coalesceTable.size(); i++) {
+        CoalesceEntry& entry = coalesceTable[i];
+        if (!entry.inUse || entry.id != response->getResponseToID())
+            continue;
+
+        MemEvent* memResponse = dynamic_cast<MemEvent*>(response);
+        for (unsigned int j = 0; j < entry.waiters.size(); j++) {
+            MemEvent* request = entry.waiters[j].first;
+            MemEvent* copy = request->makeResponse();
+            copy->setCmd(response->getCmd());
+            copy->setFlags(response->getFlags());
+            copy->setMemFlags(response->getMemFlags());
+            if (memResponse)
+                copy->setPayload(memResponse->getPayload());
+            threadLinks[entry.waiters[j].second]->send(copy);
+            delete request;
+        }
+        entry.waiters.clear();
+        entry.inUse = false;
+        entry.open = false;
+        coalesceInUse--;
+        return true;
+    }
+    return false;
+}
+
+/*
+ * Pick the thread whose oldest request is forwarded next, or -1 if no thread can forward one this cycle.
+ * A thread's requests are forwarded in order, so a blocked request also blocks the rest of its thread.
+ */
+int MultiThreadL1::selectThread() {
+    int best = -1;
+    unsigned int numThreads = threadQueues.size();
+    for (unsigned int i = 0; i < numThreads; i++) {
+        unsigned int thread = roundRobin ? (nextThread + i) % numThreads : i;
+        if (threadQueues[thread].empty())
+            continue;
+
+        if (threadRequestsPerCycle != 0 && threadIssued[thread] >= threadRequestsPerCycle) {
+            if (!threadStalled[thread]) {
+                threadStalled[thread] = true;
+                statThreadLimit->addData(1);
+            }
+            continue;
+        }
+
+        if (banks != 0) {
+            Addr line = threadQueues[thread].front().event->getRoutingAddress() >> bankShift;
+            unsigned int bank = bankMask ? (line & bankMask) : (line % banks);
+            if (bankBusy[bank]) {
+                if (!threadStalled[thread]) {
+                    threadStalled[thread] = true;
+                    statBankConflict->addData(1);
+                }
+                continue;
+            }
+        }
+
+        if (roundRobin)
+            return thread;
+        if (best < 0 || threadQueues[thread].front().seq < threadQueues[best].front().seq)
+            best = thread;
+    }
+    return best;
+}
+
 bool MultiThreadL1::tick(SST::Cycle_t cycle) {
     timestamp++;
 
-    uint64_t sendcount = (requestsPerCycle == 0) ? requestQueue.size() : requestsPerCycle;
+    /* Forward requests, up to requestsPerCycle */
+    if (queuedRequests != 0) {
+        std::fill(threadIssued.begin(), threadIssued.end(), 0);
+        std::fill(threadStalled.begin(), threadStalled.end(), false);
+        std::fill(bankBusy.begin(), bankBusy.end(), false);
 
-    /* Drain request queue */
-    while (!requestQueue.empty() && sendcount > 0) {
-        cacheLink->send(requestQueue.front());
-        requestQueue.pop();
-        sendcount--;
+        uint64_t sendcount = (requestsPerCycle == 0) ? queuedRequests : requestsPerCycle;
+        while (sendcount > 0) {
+            int thread = selectThread();
+            if (thread < 0)
+                break;
+
+            MemEventBase* event = threadQueues[thread].front().event;
+            threadQueues[thread].pop_front();
+            queuedRequests--;
+
+            if (banks != 0) {
+                Addr line = event->getRoutingAddress() >> bankShift;
+                bankBusy[bankMask ? (line & bankMask) : (line % banks)] = true;
+            }
+            threadIssued[thread]++;
+            if (roundRobin)
+                nextThread = (thread + 1) % threadQueues.size();
+
+            cacheLink->send(event);
+            sendcount--;
+        }
     }
 
-    sendcount = (responsesPerCycle == 0) ? responseQueue.size() : responsesPerCycle;
+    uint64_t sendcount = (responsesPerCycle == 0) ? responseQueue.size() : responsesPerCycle;
 
     /* Drain response queue */
     while (!responseQueue.empty() && sendcount > 0) {
         MemEventBase * event = responseQueue.front();
         responseQueue.pop();
 
+        // Merged requests are answered along with the original one
+        respondToWaiters(event);
+
         unsigned int linkid = threadRequestMap.find(event->getResponseToID())->second;
         threadRequestMap.erase(event->getResponseToID());
         threadLinks[linkid]->send(event);
@@ -121,7 +316,7 @@ bool MultiThreadL1::tick(SST::Cycle_t cycle) {
     }
 
     /* Turn off clock if queues are empty */
-    if (requestQueue.empty() && responseQueue.empty()) {
+    if (queuedRequests == 0 && responseQueue.empty()) {
         clockOn = false;
         return true;
     }
@@ -16,6 +16,7 @@
 #ifndef _MEMHIERARCHY_MULTITHREADL1_H_
 #define _MEMHIERARCHY_MULTITHREADL1_H_
 
+#include <deque>
 #include <map>
 #include <queue>
 
@@ -27,6 +28,7 @@
 #include <sst/core/output.h>
 
 #include "sst/elements/memHierarchy/memEventBase.h"
+#include "sst/elements/memHierarchy/memEvent.h"
 #include "sst/elements/memHierarchy/util.h"
 
 using namespace std;
@@ -42,11 +44,21 @@ public:
     SST_ELI_DOCUMENT_PARAMS(
             {"clock",               "(string) Clock frequency or period with units (Hz or s; SI units OK).", NULL},
             {"requests_per_cycle",  "(uint) Number of requests to forward to L1 each cycle (for all threads combined). 0 indicates unlimited", "0"},
+            {"thread_requests_per_cycle", "(uint) Number of requests to forward to L1 each cycle from any one thread. 0 indicates unlimited", "0"},
+            {"arbitration",         "(string) How to pick among threads with waiting requests. Options: 'oldest' (oldest request first), 'round_robin'", "oldest"},
+            {"banks",               "(uint) Number of L1 banks. At most one request per bank is forwarded each cycle. 0 disables bank conflict modeling", "0"},
+            {"bank_interleave_granularity", "(string) Granularity of bank interleaving in bytes (B). Must be a power of 2.", "64B"},
+            {"coalesce_entries",    "(uint) Number of outstanding cacheable reads that later reads to the same address and size can be merged with, across threads. 0 disables coalescing", "0"},
             {"responses_per_cycle", "(uint) Number of responses to forward to threads each cycle (for all threads combined). 0 indicates unlimited", "0"},
             {"debug",               "(uint) Where to print debug output. Options: 0[no output], 1[stdout], 2[stderr], 3[file]", "0"},
             {"debug_level",         "(uint) Debug verbosity level. Between 0 and 10", "0"},
             {"debug_addr",          "(comma separated uint) Address(es) to be debugged. Leave empty for all, otherwise specify one or more, comma-separated values. Start and end string with brackets",""} )
 
+    SST_ELI_DOCUMENT_STATISTICS(
+            {"bank_conflicts",      "Number of times a thread's oldest request could not be forwarded because its bank was already used that cycle", "count", 1},
+            {"thread_limit_stalls", "Number of times a thread's oldest request could not be forwarded because the thread reached thread_requests_per_cycle", "count", 1},
+            {"requests_coalesced",  "Number of requests merged with an outstanding request instead of being forwarded to L1", "count", 1} )
+
     SST_ELI_DOCUMENT_PORTS(
           {"cache", "Link to L1 cache", {"memHierarchy.MemEventBase"} },
           {"thread%(port)d", "Links to threads/cores", {"memHierarchy.MemEventBase"} } )
@@ -89,12 +101,55 @@ private:
     /** Track outstanding requests for routing responses correctly */
     std::map<Event::id_type, unsigned int> threadRequestMap;
 
+    /** Per-thread request queues, sequence numbers order requests across threads */
+    struct Request {
+        Request(MemEventBase* event, uint64_t seq) : event(event), seq(seq) { }
+        MemEventBase* event;
+        uint64_t seq;
+    };
+    vector<std::deque<Request> > threadQueues;
+    uint64_t queuedRequests;
+    uint64_t nextSeq;
+
     /** Throughput control */
     uint64_t requestsPerCycle;
+    uint64_t threadRequestsPerCycle;
     uint64_t responsesPerCycle;
-    std::queue<MemEventBase*> requestQueue;
+    bool roundRobin;
+    unsigned int nextThread;            // Round-robin arbitration: first thread to consider
     std::queue<MemEventBase*> responseQueue;
 
+    /** Bank conflict modeling */
+    unsigned int banks;
+    Addr bankMask;
+    unsigned int bankShift;
+
+    /** Per-cycle issue state, reset each tick */
+    vector<uint64_t> threadIssued;      // Requests forwarded from each thread this cycle
+    vector<bool> threadStalled;         // Thread's oldest request was blocked this cycle
+    vector<bool> bankBusy;              // Bank already used this cycle
+
+    /** Coalescing: a small fully-associative table of outstanding reads, searched like a CAM */
+    struct CoalesceEntry {
+        CoalesceEntry() : inUse(false), open(false), addr(0), size(0) { }
+        bool inUse;                     // Waiting for a response
+        bool open;                      // Later requests may still merge with this one
+        Addr addr;
+        uint32_t size;
+        Event::id_type id;              // Request forwarded to L1
+        vector<std::pair<MemEvent*, unsigned int> > waiters;    // Merged requests and their threads
+    };
+    vector<CoalesceEntry> coalesceTable;
+    unsigned int coalesceInUse;
+
+    bool coalesceRequest(MemEvent* event, unsigned int threadid);
+    bool respondToWaiters(MemEventBase* response);
+    int selectThread();
+
+    Statistic<uint64_t>* statBankConflict;
+    Statistic<uint64_t>* statThreadLimit;
+    Statistic<uint64_t>* statCoalesced;
+
     inline void enableClock();
 };
 
@@ -80,18 +80,92 @@ class ReplacementPolicy : public SubComponent{
         // Get replacement candidates
         virtual uint64_t getBestCandidate() = 0;
         virtual uint64_t findBestCandidate(std::vector<ReplacementInfo*> &rInfo) = 0;
+
+        /* Find a candidate among 'ways' contiguous entries for a set.
+         * Policies built on SetReplacementPolicy implement this directly; others fall back to the vector interface. */
+        virtual uint64_t findBestCandidateInSet(ReplacementInfo* const* rInfo, size_t ways) {
+            std::vector<ReplacementInfo*> set(rInfo, rInfo + ways);
+            return findBestCandidate(set);
+        }
+};
+
+/*
+ * Set-at-a-time replacement policies
+ * A policy derived from SetReplacementPolicy computes a 64-bit rank for each way in a set; the way with the
+ * smallest rank is the victim (ties go to the lowest way). Ranks are computed through a statically-dispatched
+ * 'rank()' so the victim search is a single virtual call per set followed by a branch-free argmin over a
+ * contiguous array. A policy may also provide 'resolve()' to post-process the winning way (e.g., random selection).
+ *
+ * Helpers below build ranks so that invalid lines always win, then (for coherence-aware policies)
+ * non-shared lines, then non-owned lines, then the policy-specific ordering.
+ */
+template <class P>
+class SetReplacementPolicy : public ReplacementPolicy {
+    public:
+        SetReplacementPolicy(ComponentId_t id, Params& params, uint64_t lines, uint64_t associativity) :
+            ReplacementPolicy(id, params, lines, associativity), bestCandidate(0) {
+            keys_.resize(associativity, 0);
+        }
+        virtual ~SetReplacementPolicy() { }
+
+        uint64_t findBestCandidate(std::vector<ReplacementInfo*> &rInfo) override {
+            return findBestCandidateInSet(rInfo.data(), rInfo.size());
+        }
+
+        uint64_t findBestCandidateInSet(ReplacementInfo* const* rInfo, size_t ways) override {
+            P* policy = static_cast<P*>(this);
+            if (keys_.size() < ways)
+                keys_.resize(ways);
+            uint64_t* keys = keys_.data();
+
+            for (size_t i = 0; i < ways; i++)
+                keys[i] = policy->rank(i, rInfo[i]);
+
+            size_t best = 0;
+            for (size_t i = 1; i < ways; i++)
+                best = (keys[i] < keys[best]) ? i : best;
+
+            bestCandidate = policy->resolve(rInfo, ways, best, keys[best]);
+            return bestCandidate;
+        }
+
+        uint64_t getBestCandidate() override { return bestCandidate; }
+
+        /* Default: the lowest-ranked way is the victim */
+        inline uint64_t resolve(ReplacementInfo* const* rInfo, size_t ways, size_t best, uint64_t key) {
+            return rInfo[best]->getIndex();
+        }
+
+    protected:
+        static constexpr uint64_t rankMax = (1ULL << 61);
+
+        /* Invalid lines rank 0, everything else is offset by one */
+        static inline uint64_t validRank(uint64_t rank) {
+            return 1 + (rank < rankMax ? rank : rankMax);
+        }
+
+        /* Prefer non-shared, then non-owned lines */
+        static inline uint64_t coherenceRank(ReplacementInfo* rInfo, uint64_t rank) {
+            CoherenceReplacementInfo* info = static_cast<CoherenceReplacementInfo*>(rInfo);
+            return validRank(rank) | ((uint64_t)info->getShared() << 63) | ((uint64_t)info->getOwned() << 62);
+        }
+
+        uint64_t bestCandidate;
+
+    private:
+        std::vector<uint64_t> keys_;
 };
 
 /* ------------------------------------------------------------------------------------------
  *  LRU
  * ------------------------------------------------------------------------------------------*/
-class LRU : public ReplacementPolicy {
+class LRU : public SetReplacementPolicy<LRU> {
 public:
     SST_ELI_REGISTER_SUBCOMPONENT(LRU, "memHierarchy", "replacement.lru", SST_ELI_ELEMENT_VERSION(1,0,0),
             "least-recently-used replacement policy", SST::MemHierarchy::ReplacementPolicy);
 
 
-    LRU(ComponentId_t id, Params& params, uint64_t lines, uint64_t associativity) : ReplacementPolicy(id, params, lines, associativity), timestamp(1), bestCandidate(0) {
+    LRU(ComponentId_t id, Params& params, uint64_t lines, uint64_t associativity) : SetReplacementPolicy<LRU>(id, params, lines, associativity), timestamp(1) {
         ways = associativity;
         array.resize(lines, 0);
     }
@@ -109,35 +183,15 @@ public:
 
     /** Lines are selected for replacement according to the following criteria (and in this order):
      * 1. If invalid (alwasy replace these)
-     * 2. If owned, try to keep
-     * 3. If shared, try to keep
-     * 4. If timestamp is the oldest (smallest), then evict
+     * 2. If timestamp is the oldest (smallest), then evict
      */
-    uint64_t findBestCandidate(std::vector<ReplacementInfo*> &rInfo) {
-        bestCandidate = rInfo[0]->getIndex();
-        uint64_t bestTS = array[rInfo[0]->getIndex()];
-        if (rInfo[0]->getState() == I) {
-            return bestCandidate;
-        }
-        for (int i = 1; i < rInfo.size(); i++) {
-            if (rInfo[i]->getState() == I) {
-                bestCandidate = rInfo[i]->getIndex();
-                return bestCandidate;
-            }
-            uint64_t candTS = array[rInfo[i]->getIndex()];
-            if (candTS < bestTS) {
-                bestTS = candTS;
-                bestCandidate = rInfo[i]->getIndex();
-            }
-        }
-        return bestCandidate;
+    inline uint64_t rank(size_t way, ReplacementInfo* rInfo) {
+        if (rInfo->getState() == I) return 0;
+        return validRank(array[rInfo->getIndex()]);
     }
 
-    uint64_t getBestCandidate() { return bestCandidate; }
-
 private:
     uint64_t timestamp;
-    uint64_t bestCandidate;
     uint64_t ways;
 
     std::vector<uint64_t> array;
@@ -145,13 +199,13 @@ private:
 };
 
 
-class LRUOpt : public ReplacementPolicy {
+class LRUOpt : public SetReplacementPolicy<LRUOpt> {
 public:
     SST_ELI_REGISTER_SUBCOMPONENT(LRUOpt, "memHierarchy", "replacement.lru-opt", SST_ELI_ELEMENT_VERSION(1,0,0),
             "least-recently-used replacement policy with consideration for coherence state", SST::MemHierarchy::ReplacementPolicy);
 
 
-    LRUOpt(ComponentId_t id, Params& params, uint64_t lines, uint64_t associativity) : ReplacementPolicy(id, params, lines, associativity), timestamp(1), bestCandidate(0) {
+    LRUOpt(ComponentId_t id, Params& params, uint64_t lines, uint64_t associativity) : SetReplacementPolicy<LRUOpt>(id, params, lines, associativity), timestamp(1) {
         ways = associativity;
         array.resize(lines, 0);
     }
@@ -169,7 +223,6 @@ public:
     void update(uint64_t id, ReplacementInfo * rInfo) { array[id] = timestamp++; }
 
     /* Record replaced line */
-    //void replaced(uint64_t id) { array[id] = 0; }
     void replaced(uint64_t id) { array[id] = 0; }
 
     /** Lines are selected for replacement according to the following criteria (and in this order):
@@ -178,153 +231,91 @@ public:
      * 3. If shared, try to keep
      * 4. If timestamp is the oldest (smallest), then evict
      */
-    uint64_t findBestCandidate(std::vector<ReplacementInfo*> &rInfo) {
-        bestCandidate = rInfo[0]->getIndex();
-        Rank bestRank = {array[rInfo[0]->getIndex()],
-            static_cast<CoherenceReplacementInfo*>(rInfo[0])->getShared(),
-            static_cast<CoherenceReplacementInfo*>(rInfo[0])->getOwned(),
-            rInfo[0]->getState() };
-        if (rInfo[0]->getState() == I)
-            return bestCandidate;
-
-        for (int i = 1; i < rInfo.size(); i++) {
-            if (rInfo[i]->getState() == I) {
-                bestCandidate = rInfo[i]->getIndex();
-                return bestCandidate;
-            }
-            Rank candRank = {array[rInfo[i]->getIndex()],
-                static_cast<CoherenceReplacementInfo*>(rInfo[i])->getShared(),
-                static_cast<CoherenceReplacementInfo*>(rInfo[i])->getOwned(),
-                rInfo[i]->getState() };
-
-            if (candRank.lessThan(bestRank)) {
-                bestRank = candRank;
-                bestCandidate = rInfo[i]->getIndex();
-            }
-        }
-        return bestCandidate;
+    inline uint64_t rank(size_t way, ReplacementInfo* rInfo) {
+        if (rInfo->getState() == I) return 0;
+        return coherenceRank(rInfo, array[rInfo->getIndex()]);
     }
 
-    uint64_t getBestCandidate() { return bestCandidate; }
-
 private:
     uint64_t timestamp;
-    uint64_t bestCandidate;
     uint64_t ways;
 
     std::vector<uint64_t> array;
-
-    struct Rank {
-        uint64_t    timestamp;
-        bool        shared;
-        bool        owned;
-        State       state;
-
-        void reset() {
-            state       = I;
-            shared      = false;
-            timestamp   = 0;
-            owned       = false;
-        }
-
-        inline bool lessThan(const Rank& other) const {
-            if (!shared && other.shared) return true;
-            else if (shared && !other.shared) return false;
-            else if (!owned && other.owned) return true;
-            else if (owned && !other.owned) return false;
-            else return timestamp < other.timestamp;
-        }
-    };
 };
 
 /* ------------------------------------------------------------------------------------------
  *  LFU
  * ------------------------------------------------------------------------------------------*/
-class LFU : public ReplacementPolicy {
+/* Shared LFU state & ranking
+ * timestamp = (total accesses * timestamp + timestamp) / (accesses + 1)
+ * timestamp increments by 1000 every time to make sure there's sufficient space between timestamps
+ * Lines that have not been accessed are evicted first (latest way wins), then the line with the highest
+ * inverse frequency (lowest way wins).
+ */
+template <class P>
+class LFUBase : public SetReplacementPolicy<P> {
 public:
-    SST_ELI_REGISTER_SUBCOMPONENT(LFU, "memHierarchy", "replacement.lfu", SST_ELI_ELEMENT_VERSION(1,0,0),
-            "least-frequently-used replacement policy, recently used accesses are more heavily weighted", SST::MemHierarchy::ReplacementPolicy);
-
-
-    LFU(ComponentId_t id, Params& params, uint64_t lines, uint64_t associativity) : ReplacementPolicy(id, params, lines, associativity), timestamp(1), bestCandidate(0) {
+    LFUBase(ComponentId_t id, Params& params, uint64_t lines, uint64_t associativity) : SetReplacementPolicy<P>(id, params, lines, associativity), timestamp(1) {
         ways = associativity;
-
         array.resize(lines, (LFUInfo){0,0});
     }
 
-    virtual ~LFU() { }
+    virtual ~LFUBase() { }
 
-    /* Too expensive to constantly dynamic_cast. Check once during construction instead. */
-    bool checkCompatibility(ReplacementInfo * rInfo) { return true; } // No cast
-
-    // timestamp = (total accesses * timestamp + timestamp) / (accesses + 1)
-    // timestamp increments by 1000 every time to make sure there's sufficient space between timestamps
     void update(uint64_t id, ReplacementInfo * rInfo) {
         array[id].ts = (array[id].acc*array[id].ts + timestamp)/(array[id].acc + 1);
         array[id].acc++;
         timestamp += 1000;
     }
 
-    uint64_t findBestCandidate(vector<ReplacementInfo*> &rInfo) {
-        bestCandidate = rInfo[0]->getIndex();
-        LFUInfo bestLFU = array[rInfo[0]->getIndex()];
-
-        if (rInfo[0]->getState() == I) { return bestCandidate; }
-
-        for (int i = 1; i < rInfo.size(); i++) {
-            if (rInfo[i]->getState() == I)  {
-                bestCandidate = rInfo[i]->getIndex();
-                return bestCandidate;
-            }
-            LFUInfo candLFU = array[rInfo[i]->getIndex()];
-
-            if (candLFU.lessThan(bestLFU, timestamp)) {
-                bestLFU = candLFU;
-                bestCandidate = rInfo[i]->getIndex();
-            }
-        }
-        return bestCandidate;
-    }
-
-    uint64_t getBestCandidate() { return bestCandidate; }
-
-    //void replaced(uint64_t id) { array[id].acc = 0; }
     void replaced(uint64_t id) { array[id].acc = 0; }
-private:
 
+protected:
     struct LFUInfo {
         uint64_t ts;    // timestamp, function of accesses with more recent ones being more heavily weighted
         uint64_t acc;   // accesses
-
-        inline bool lessThan(LFUInfo& other, const uint64_t curTs) {
-            if (acc == 0) return true;
-            if (other.acc == 0) return false;
-            uint64_t ownInvFreq = (curTs - ts)/acc; //inverse frequency, lower is better
-            uint64_t otherInvFreq = (curTs - other.ts)/other.acc;
-            return ownInvFreq > otherInvFreq;
-            return false;
-        }
     };
 
+    inline uint64_t lfuRank(size_t way, uint64_t id) {
+        const LFUInfo& info = array[id];
+        if (info.acc == 0)
+            return ways - 1 - way;
+        uint64_t invFreq = (timestamp - info.ts)/info.acc; //inverse frequency, lower is better
+        uint64_t cap = SetReplacementPolicy<P>::rankMax - ways;
+        return ways + (cap - (invFreq < cap ? invFreq : cap));
+    }
+
     std::vector<LFUInfo> array;
     uint64_t ways;
-
     uint64_t timestamp;
-    uint64_t bestCandidate;
+};
+
+class LFU : public LFUBase<LFU> {
+public:
+    SST_ELI_REGISTER_SUBCOMPONENT(LFU, "memHierarchy", "replacement.lfu", SST_ELI_ELEMENT_VERSION(1,0,0),
+            "least-frequently-used replacement policy, recently used accesses are more heavily weighted", SST::MemHierarchy::ReplacementPolicy);
+
 
+    LFU(ComponentId_t id, Params& params, uint64_t lines, uint64_t associativity) : LFUBase<LFU>(id, params, lines, associativity) { }
+
+    virtual ~LFU() { }
+
+    /* Too expensive to constantly dynamic_cast. Check once during construction instead. */
+    bool checkCompatibility(ReplacementInfo * rInfo) { return true; } // No cast
+
+    inline uint64_t rank(size_t way, ReplacementInfo* rInfo) {
+        if (rInfo->getState() == I) return 0;
+        return validRank(lfuRank(way, rInfo->getIndex()));
+    }
 };
 
-class LFUOpt : public ReplacementPolicy {
+class LFUOpt : public LFUBase<LFUOpt> {
 public:
     SST_ELI_REGISTER_SUBCOMPONENT(LFUOpt, "memHierarchy", "replacement.lfu-opt", SST_ELI_ELEMENT_VERSION(1,0,0),
             "least-frequently-used replacement policy, recently used accesses are more heavily weighted. Also considers coherence state in replacement decision", SST::MemHierarchy::ReplacementPolicy);
 
 
-    LFUOpt(ComponentId_t id, Params& params, uint64_t lines, uint64_t associativity) : ReplacementPolicy(id, params, lines, associativity), timestamp(1), bestCandidate(0) {
-        ways = associativity;
-
-        array.resize(lines, (LFUInfo){0,0});
-    }
+    LFUOpt(ComponentId_t id, Params& params, uint64_t lines, uint64_t associativity) : LFUBase<LFUOpt>(id, params, lines, associativity) { }
 
     virtual ~LFUOpt() { }
 
@@ -335,90 +326,10 @@ public:
         return false;
     }
 
-    // timestamp = (total accesses * timestamp + timestamp) / (accesses + 1)
-    // timestamp increments by 1000 every time to make sure there's sufficient space between timestamps
-    void update(uint64_t id, ReplacementInfo * rInfo) {
-        array[id].ts = (array[id].acc*array[id].ts + timestamp)/(array[id].acc + 1);
-        array[id].acc++;
-        timestamp += 1000;
-    }
-
-    uint64_t findBestCandidate(vector<ReplacementInfo*> &rInfo) {
-        bestCandidate = rInfo[0]->getIndex();
-        Rank bestRank = {array[rInfo[0]->getIndex()],
-            static_cast<CoherenceReplacementInfo*>(rInfo[0])->getShared(),
-            static_cast<CoherenceReplacementInfo*>(rInfo[0])->getOwned(),
-            rInfo[0]->getState() };
-        if (rInfo[0]->getState() == I)
-            return bestCandidate;
-
-        for (int i = 1; i < rInfo.size(); i++) {
-            if (rInfo[i]->getState() == I) {
-                bestCandidate = rInfo[i]->getIndex();
-                return bestCandidate;
-            }
-            Rank candRank = {array[rInfo[i]->getIndex()],
-                static_cast<CoherenceReplacementInfo*>(rInfo[i])->getShared(),
-                static_cast<CoherenceReplacementInfo*>(rInfo[i])->getOwned(),
-                rInfo[i]->getState() };
-            if (candRank.lessThan(bestRank, timestamp)) {
-                bestRank = candRank;
-                bestCandidate = rInfo[i]->getIndex();
-            }
-        }
-        return bestCandidate;
+    inline uint64_t rank(size_t way, ReplacementInfo* rInfo) {
+        if (rInfo->getState() == I) return 0;
+        return coherenceRank(rInfo, lfuRank(way, rInfo->getIndex()));
     }
-
-    uint64_t getBestCandidate() { return bestCandidate; }
-
-    //void replaced(uint64_t id) { array[id].acc = 0; }
-    void replaced(uint64_t id) { array[id].acc = 0; }
-private:
-
-    struct LFUInfo {
-        uint64_t ts;    // timestamp, function of accesses with more recent ones being more heavily weighted
-        uint64_t acc;   // accesses
-    };
-
-    std::vector<LFUInfo> array;
-    uint64_t ways;
-
-    uint64_t timestamp;
-    uint64_t bestCandidate;
-
-    struct Rank {
-        LFUInfo lfuInfo;
-        bool shared;
-        bool owned;
-        State state;
-
-        void reset() {
-            state = I;
-            shared = false;
-            owned = false;
-            lfuInfo = (LFUInfo){0, 0};
-        }
-
-        inline bool lessThan(const Rank& other, const uint64_t curTs) const {
-            if(state == I) return true;
-            if (!shared && other.shared) {
-                return true;
-            } else if (shared && !other.shared) {
-                return false;
-            } else if (!owned && other.owned) {
-                return true;
-            } else if (owned && !other.owned) {
-                return false;
-            } else {
-                if (lfuInfo.acc == 0) return true;
-                if (other.lfuInfo.acc == 0) return false;
-                uint64_t ownInvFreq = (curTs - lfuInfo.ts)/lfuInfo.acc; //inverse frequency, lower is better
-                uint64_t otherInvFreq = (curTs - other.lfuInfo.ts)/other.lfuInfo.acc;
-                return ownInvFreq > otherInvFreq;
-            }
-            return false;
-        }
-    };
 };
 
 
@@ -426,36 +337,18 @@ private:
 /* ------------------------------------------------------------------------------------------
  *  MRU
  * ------------------------------------------------------------------------------------------*/
-class MRU : public ReplacementPolicy {
+class MRU : public SetReplacementPolicy<MRU> {
 private:
     uint64_t                timestamp;
-    int32_t                 bestCandidate;
     std::vector<uint64_t>   array;
     uint64_t                ways;
 
-    struct Rank {
-        uint64_t  timestamp;
-        State     state;
-
-        void reset() {
-            state       = I;
-            timestamp   = 0;
-        }
-
-        inline bool biggerThan(const Rank& other) const {
-            if (state == I)
-                return true;
-            else
-                return timestamp > other.timestamp;
-        }
-    };
-
 public:
     SST_ELI_REGISTER_SUBCOMPONENT(MRU, "memHierarchy", "replacement.mru", SST_ELI_ELEMENT_VERSION(1,0,0),
             "most-recently-used replacement policy", SST::MemHierarchy::ReplacementPolicy);
 
 
-    MRU(ComponentId_t id, Params& params, uint64_t lines, uint64_t associativity) : ReplacementPolicy(id, params, lines, associativity), timestamp(1), bestCandidate(0) {
+    MRU(ComponentId_t id, Params& params, uint64_t lines, uint64_t associativity) : SetReplacementPolicy<MRU>(id, params, lines, associativity), timestamp(1) {
         ways = associativity;
 
         array.resize(lines, 0);
@@ -468,72 +361,29 @@ public:
 
     void update(uint64_t id, ReplacementInfo * rInfo) { array[id] = timestamp++; }
 
-    //void replaced(uint64_t id) { array[id] = 0; }
     void replaced(uint64_t id) { array[id] = 0; }
 
-    uint64_t findBestCandidate(vector<ReplacementInfo*> &rInfo) {
-        bestCandidate = rInfo[0]->getIndex();
-        Rank bestRank = {array[rInfo[0]->getIndex()], rInfo[0]->getState() };
-        if (rInfo[0]->getState() == I)
-            return bestCandidate;
-
-        for (int i = 1; i < rInfo.size(); i++) {
-            if (rInfo[i]->getState() == I) {
-                bestCandidate = rInfo[i]->getIndex();
-                return bestCandidate;
-            }
-            Rank candRank = {array[rInfo[i]->getIndex()], rInfo[i]->getState() };
-            if (candRank.biggerThan(bestRank)) {
-                bestRank = candRank;
-                bestCandidate = rInfo[i]->getIndex();
-            }
-        }
-        return bestCandidate;
+    /* Invalid lines first, then the newest (largest) timestamp */
+    inline uint64_t rank(size_t way, ReplacementInfo* rInfo) {
+        if (rInfo->getState() == I) return 0;
+        uint64_t ts = array[rInfo->getIndex()];
+        return validRank(rankMax - (ts < rankMax ? ts : rankMax));
     }
-
-    uint64_t getBestCandidate() { return bestCandidate;}
-
 };
 
 
-class MRUOpt : public ReplacementPolicy {
+class MRUOpt : public SetReplacementPolicy<MRUOpt> {
 private:
     uint64_t                timestamp;
-    int32_t                 bestCandidate;
     std::vector<uint64_t>   array;
     uint64_t                ways;
 
-    struct Rank {
-        uint64_t  timestamp;
-        bool      shared;
-        bool      owned;
-        State     state;
-
-        void reset() {
-            state       = I;
-            shared      = false;
-            owned       = false;
-            timestamp   = 0;
-        }
-
-        inline bool biggerThan(const Rank& other) const {
-            if(state == I) return true;
-            else{
-                if (!shared && other.shared) return true;
-                else if (shared && !other.shared) return false;
-                else if (owned && !other.owned) return false;
-                else if (!owned && other.owned) return true;
-                else return timestamp > other.timestamp;
-            }
-        }
-    };
-
 public:
     SST_ELI_REGISTER_SUBCOMPONENT(MRUOpt, "memHierarchy", "replacement.mru-opt", SST_ELI_ELEMENT_VERSION(1,0,0),
             "most-recently-used replacement policy, with consideration for coherence state", SST::MemHierarchy::ReplacementPolicy);
 
 
-    MRUOpt(ComponentId_t id, Params& params, uint64_t lines, uint64_t associativity) : ReplacementPolicy(id, params, lines, associativity), timestamp(1), bestCandidate(0) {
+    MRUOpt(ComponentId_t id, Params& params, uint64_t lines, uint64_t associativity) : SetReplacementPolicy<MRUOpt>(id, params, lines, associativity), timestamp(1) {
         ways = associativity;
 
         array.resize(lines, 0);
@@ -550,37 +400,14 @@ public:
 
     void update(uint64_t id, ReplacementInfo * rInfo) { array[id] = timestamp++; }
 
-    //void replaced(uint64_t id) { array[id] = 0; }
     void replaced(uint64_t id) { array[id] = 0; }
 
-    uint64_t findBestCandidate(vector<ReplacementInfo*> &rInfo) {
-        bestCandidate = rInfo[0]->getIndex();
-        Rank bestRank = {array[rInfo[0]->getIndex()],
-            static_cast<CoherenceReplacementInfo*>(rInfo[0])->getShared(),
-            static_cast<CoherenceReplacementInfo*>(rInfo[0])->getOwned(),
-            rInfo[0]->getState() };
-        if (rInfo[0]->getState() == I)
-            return bestCandidate;
-
-        for (int i = 1; i < rInfo.size(); i++) {
-            if (rInfo[i]->getState() == I) {
-                bestCandidate = rInfo[i]->getIndex();
-                return bestCandidate;
-            }
-            Rank candRank = {array[rInfo[i]->getIndex()],
-                static_cast<CoherenceReplacementInfo*>(rInfo[i])->getShared(),
-                static_cast<CoherenceReplacementInfo*>(rInfo[i])->getOwned(),
-                rInfo[i]->getState() };
-            if (candRank.biggerThan(bestRank)) {
-                bestRank = candRank;
-                bestCandidate = rInfo[i]->getIndex();
-            }
-        }
-        return bestCandidate;
+    /* Invalid lines first, then non-shared, then non-owned, then the newest (largest) timestamp */
+    inline uint64_t rank(size_t way, ReplacementInfo* rInfo) {
+        if (rInfo->getState() == I) return 0;
+        uint64_t ts = array[rInfo->getIndex()];
+        return coherenceRank(rInfo, rankMax - (ts < rankMax ? ts : rankMax));
     }
-
-    uint64_t getBestCandidate() { return bestCandidate; }
-
 };
 
 
@@ -588,7 +415,7 @@ public:
 /* ------------------------------------------------------------------------------------------
  *  Random
  * ------------------------------------------------------------------------------------------*/
-class Random : public ReplacementPolicy {
+class Random : public SetReplacementPolicy<Random> {
 public:
     SST_ELI_REGISTER_SUBCOMPONENT(Random, "memHierarchy", "replacement.random", SST_ELI_ELEMENT_VERSION(1,0,0),
             "random replacement policy", SST::MemHierarchy::ReplacementPolicy);
@@ -598,7 +425,7 @@ public:
             {"seed_b",  "Seed for random number generator", "1"} )
 
 
-    Random(ComponentId_t id, Params& params, uint64_t lines, uint64_t associativity) : ReplacementPolicy(id, params, lines, associativity), bestCandidate(0) {
+    Random(ComponentId_t id, Params& params, uint64_t lines, uint64_t associativity) : SetReplacementPolicy<Random>(id, params, lines, associativity) {
         ways = associativity;
         uint64_t seeda = params.find<uint64_t>("seed_a", 1);
         uint64_t seedb = params.find<uint64_t>("seed_b", 1);
@@ -619,22 +446,17 @@ public:
     void replaced(uint64_t id){}
 
     // Return an empty slot if one exists, otherwise return a random candidate
-    uint64_t findBestCandidate(std::vector<ReplacementInfo*> &rInfo) {
-        // Check for empty line
-        for (uint64_t i = 0; i < rInfo.size(); i++) {
-            if (rInfo[i]->getState() == I) {
-                bestCandidate = rInfo[i]->getIndex();
-                return bestCandidate;
-            }
-        }
-        bestCandidate = rInfo[(gen->generateNextUInt64() % ways)]->getIndex();
-        return bestCandidate;
+    inline uint64_t rank(size_t way, ReplacementInfo* rInfo) {
+        return (rInfo->getState() == I) ? 0 : 1;
     }
 
-    uint64_t getBestCandidate() { return bestCandidate; }
+    inline uint64_t resolve(ReplacementInfo* const* rInfo, size_t setWays, size_t best, uint64_t key) {
+        if (key == 0)
+            return rInfo[best]->getIndex();
+        return rInfo[(gen->generateNextUInt64() % ways)]->getIndex();
+    }
 
 private:
-    uint64_t bestCandidate;
     uint64_t ways;
     SST::RNG::MarsagliaRNG* gen;
 };
@@ -644,9 +466,8 @@ private:
  *  - Replacement algorithm assumes indices are contiguous for the set
  * ------------------------------------------------------------------------------------------*/
 
-class NMRU : public ReplacementPolicy {
+class NMRU : public SetReplacementPolicy<NMRU> {
 private:
-    uint64_t              bestCandidate;
     std::vector<uint64_t> array;
     uint64_t              ways;
     SST::RNG::MarsagliaRNG* gen;
@@ -660,7 +481,7 @@ public:
             {"seed_b",  "Seed for random number generator", "1"} )
 
 
-    NMRU(ComponentId_t id, Params& params, uint64_t lines, uint64_t associativity) : ReplacementPolicy(id, params, lines, associativity), bestCandidate(0) {
+    NMRU(ComponentId_t id, Params& params, uint64_t lines, uint64_t associativity) : SetReplacementPolicy<NMRU>(id, params, lines, associativity) {
         ways = associativity;
         uint64_t sets = lines/associativity;
         array.resize(sets, 0);
@@ -680,28 +501,24 @@ public:
     }
 
     void update(uint64_t id, ReplacementInfo * rInfo) { array[id/ways] = id % ways; }
-    //void replaced(uint64_t id) {}
     void replaced(uint64_t id) { }
 
     // Return an empty slot if one exists, otherwise return any slot that is not the most-recently used in the set
-    uint64_t findBestCandidate(std::vector<ReplacementInfo*> &rInfo) {
-        for (uint64_t i = 0; i < ways; i++) {
-            if (rInfo[i]->getState() == I) {
-                bestCandidate = rInfo[i]->getIndex();
-                return bestCandidate;
-            }
-        }
+    inline uint64_t rank(size_t way, ReplacementInfo* rInfo) {
+        return (rInfo->getState() == I) ? 0 : 1;
+    }
+
+    inline uint64_t resolve(ReplacementInfo* const* rInfo, size_t setWays, size_t best, uint64_t key) {
+        if (key == 0)
+            return rInfo[best]->getIndex();
+
         uint64_t setBegin = rInfo[0]->getIndex();
         uint64_t index = gen->generateNextUInt64() % (ways-1);
         if (index < array[setBegin/ways])
-            bestCandidate = setBegin + index;
+            return setBegin + index;
         else
-            bestCandidate = setBegin + index + 1;
-
-        return bestCandidate;
+            return setBegin + index + 1;
     }
-
-    uint64_t getBestCandidate() { return bestCandidate; }
 };
 
 
@@ -15,6 +15,7 @@
 
 
 #include <sst_config.h>
+#include <algorithm>
 #include <sst/core/params.h>
 
 #include "scratchpad.h"
@@ -101,6 +102,14 @@ Scratchpad::Scratchpad(ComponentId_t id, Params &params) : Component(id) {
     // Throughput limits
     responsesPerCycle_ = params.find<uint32_t>("response_per_cycle",0);
 
+    // Bulk moves - bursts are whole scratch lines so each line is filled or drained by one burst
+    UnitAlgebra burstSize = UnitAlgebra(params.find<std::string>("move_burst_size", "0B"));
+    if (!burstSize.hasUnits("B")) out.fatal(CALL_INFO, -1, "Invalid param (%s): move_burst_size - units must be bytes ('B'). SI units ok. You specified '%s'\n", getName().c_str(), burstSize.toString().c_str());
+    moveBurstSize_ = burstSize.getRoundedValue();
+    if (moveBurstSize_ % scratchLineSize_ != 0)
+        moveBurstSize_ += scratchLineSize_ - (moveBurstSize_ % scratchLineSize_);
+    moveMaxOutstanding_ = params.find<uint32_t>("move_max_outstanding", 0);
+
     // Remote address computation
     remoteAddrOffset_ = params.find<uint64_t>("memory_addr_offset", scratchSize_);
 
@@ -150,7 +159,7 @@ Scratchpad::Scratchpad(ComponentId_t id, Params &params) : Component(id) {
     size_t sizeBytes = size_ua.getRoundedValue();
     if (sizeBytes > scratch_->getMemSize()) {
         // Since getMemSize() might not be a power of 2, but malloc store needs it....get a reasonably close power of 2
-        sizeBytes = 1 << log2Of(scratch_->getMemSize());
+        sizeBytes = (size_t)1 << log2Of(scratch_->getMemSize());
     }
 
     backing_ = nullptr;
@@ -196,6 +205,7 @@ Scratchpad::Scratchpad(ComponentId_t id, Params &params) : Component(id) {
     stat_ScratchPutReceived       = registerStatistic<uint64_t>("request_received_scratch_put");
     stat_ScratchReadIssued        = registerStatistic<uint64_t>("request_issued_scratch_read");
     stat_ScratchWriteIssued       = registerStatistic<uint64_t>("request_issued_scratch_write");
+    stat_MoveBurstIssued          = registerStatistic<uint64_t>("request_issued_move_burst");
 
     // Figure out port connections and set up links
     // Options: cpu and network; or cpu and memory;
@@ -416,19 +426,20 @@ void Scratchpad::processIncomingRemoteEvent(SST::Event * event) {
                 getCurrentSimCycle(), timestamp_, getName().c_str(), ev->getVerboseString(dlevel).c_str());
 
     // Determine what kind of event spawned this and pass off to handler
-    std::map<SST::Event::id_type,SST::Event::id_type>::iterator it = responseIDMap_.find(ev->getResponseToID());
+    ForwardedRequest * forward = responseIDMap_.find(ev->getResponseToID());
 
-    if (it == responseIDMap_.end()) {
+    if (forward == nullptr) {
         dbg.fatal(CALL_INFO, -1, "(%s) Received data response from remote but no matching request in responseIDMap_, id is (%" PRIu64 ", %" PRIu32 "), timestamp is %" PRIu64 "\n",
                 getName().c_str(), ev->getResponseToID().first, ev->getResponseToID().second, timestamp_);
     }
 
-    SST::Event::id_type requestID = it->second;
-    responseIDMap_.erase(it);
+    SST::Event::id_type requestID = forward->requestID;
+    uint32_t offset = forward->offset;
+    responseIDMap_.erase(ev->getResponseToID());
 
-    MemEventBase * requestBase = outstandingEventList_.find(requestID)->second.request;
+    MemEventBase * requestBase = outstandingEventList_.find(requestID)->request;
 
-    if (requestBase->getCmd() == Command::Get) handleRemoteGetResponse(ev, requestID);
+    if (requestBase->getCmd() == Command::Get) handleRemoteGetResponse(ev, requestID, offset);
     else handleRemoteReadResponse(ev, requestID);
 }
 
@@ -537,13 +548,12 @@ void Scratchpad::handleScratchRead(MemEvent * ev) {
     MemEvent * read = new MemEvent(getName(), ev->getAddr(), ev->getBaseAddr(), Command::GetS, ev->getSize());
     read->copyMetadata(ev);
 
-    responseIDMap_.insert(std::make_pair(read->getID(),ev->getID()));
-    responseIDAddrMap_.insert(std::make_pair(read->getID(),ev->getBaseAddr()));
-    outstandingEventList_.insert(std::make_pair(ev->getID(),OutstandingEvent(ev,response)));
+    responseIDMap_[read->getID()] = ForwardedRequest(ev->getID(), ev->getBaseAddr());
+    outstandingEventList_[ev->getID()] = OutstandingEvent(ev,response);
 
     if (mshr_.find(ev->getBaseAddr()) == mshr_.end()) {
-        std::vector<uint8_t> data = doScratchRead(read);
-        response->setPayload(data);
+        response->setZeroPayload(read->getSize());
+        doScratchRead(read, response->getPayload().data());
         mshr_.insert(std::make_pair(ev->getBaseAddr(), std::list<MSHREntry>(1,MSHREntry(ev->getID(), Command::GetS, true, false))));
         if (caching_ && !ev->queryFlag(MemEvent::F_NONCACHEABLE)) {
             cacheStatus_.at(ev->getBaseAddr()/scratchLineSize_) = true;
@@ -589,11 +599,11 @@ void Scratchpad::handleScratchWrite(MemEvent * ev) {
     /* Check for writeback/invalidation races */
     if (!directory_ && ev->isWriteback() && mshr_.find(ev->getBaseAddr()) != mshr_.end()) {
         MSHREntry * entry = &(mshr_.find(ev->getBaseAddr())->second.front());
-        if (outstandingEventList_.find(entry->id)->second.request->getCmd() == Command::Get) {
+        if (outstandingEventList_.find(entry->id)->request->getCmd() == Command::Get) {
             handleAckInv(ev);
             return;
             // TODO handle corner cases where Get only writes partial line
-        } else if (outstandingEventList_.find(entry->id)->second.request->getCmd() == Command::Put) {
+        } else if (outstandingEventList_.find(entry->id)->request->getCmd() == Command::Put) {
             if (ev->getPayload().empty()) {
                 handleAckInv(ev);
             } else {
@@ -604,7 +614,7 @@ void Scratchpad::handleScratchWrite(MemEvent * ev) {
     } else if (directory_ && ev->isWriteback() && mshr_.find(ev->getBaseAddr()) != mshr_.end()) {
         /* Drop writeback if we're stalled waiting for a ForceInv response */
         MSHREntry * entry = &(mshr_.find(ev->getBaseAddr())->second.front());
-        if (outstandingEventList_.find(entry->id)->second.request->getCmd() == Command::Get) {
+        if (outstandingEventList_.find(entry->id)->request->getCmd() == Command::Get) {
             MemEvent * response = ev->makeResponse();
             sendResponse(response);
             delete ev;
@@ -644,7 +654,7 @@ void Scratchpad::handleScratchWrite(MemEvent * ev) {
                     sendResponse(response); /* Send response when request is sent to scratch, since scratch doesn't respond */
                     delete ev;
                 } else {
-                    outstandingEventList_.insert(std::make_pair(ev->getID(),OutstandingEvent(ev,response)));
+                    outstandingEventList_[ev->getID()] = OutstandingEvent(ev,response);
                     it = entry->insert(it, MSHREntry(ev->getID(), Command::GetX, write));
 
                     if (is_debug_event(ev))
@@ -665,7 +675,7 @@ void Scratchpad::handleScratchWrite(MemEvent * ev) {
             cacheStatus_.at(ev->getBaseAddr()/scratchLineSize_) = directory_;
         }
     } else {
-        outstandingEventList_.insert(std::make_pair(ev->getID(),OutstandingEvent(ev,response)));
+        outstandingEventList_[ev->getID()] = OutstandingEvent(ev,response);
         mshr_.find(ev->getBaseAddr())->second.push_back(MSHREntry(ev->getID(), Command::GetX, write));
 
         if (is_debug_event(ev))
@@ -697,23 +707,11 @@ void Scratchpad::handleScratchGet(MemEventBase * event) {
     stat_ScratchGetReceived->addData(1);
 
     MoveEvent * response = ev->makeResponse();
-    outstandingEventList_.insert(std::make_pair(ev->getID(),OutstandingEvent(ev,response)));
+    outstandingEventList_[ev->getID()] = OutstandingEvent(ev,response);
 
-    // Issue remote read
+    // Issue remote read(s)
     ev->setSrcBaseAddr((ev->getSrcAddr() - remoteAddrOffset_) & ~(remoteLineSize_ - 1));
-    MemEvent * remoteRead = new MemEvent(getName(), ev->getSrcAddr() - remoteAddrOffset_, ev->getSrcBaseAddr(), Command::GetS, ev->getSize());
-    remoteRead->MemEventBase::copyMetadata(ev);
-    remoteRead->setFlag(MemEvent::F_NONCACHEABLE);
-    remoteRead->setVirtualAddress(ev->getSrcVirtualAddress());
-    remoteRead->setInstructionPointer(ev->getInstructionPointer());
-    responseIDMap_.insert(std::make_pair(remoteRead->getID(), ev->getID()));
-
-    if (is_debug_event(remoteRead)) {
-        dbg.debug(_L10_, "C: %-20" PRIu64 " %-20" PRIu64 " %-20s Get           0x%-16" PRIx64 " 0x%-16" PRIx64 " Remote Read (<%" PRIu64 ", %" PRIu32 ">, 0x%" PRIx64 ")\n",
-                getCurrentSimCycle(), timestamp_, getName().c_str(), saddr, daddr, remoteRead->getID().first, remoteRead->getID().second, remoteRead->getBaseAddr());
-    }
-
-    memMsgQueue_.insert(std::make_pair(timestamp_, remoteRead));
+    issueGetBursts(ev, saddr, daddr);
 
     // Insert into mshr and send inv if needed
     // start base addr -> end base addr
@@ -732,7 +730,7 @@ void Scratchpad::handleScratchGet(MemEventBase * event) {
             dbg.debug(_L10_, "M: %-20" PRIu64 " %-20" PRIu64 " %-20s MSHR:InsEv    0x%-16" PRIx64 " %s\n",
                     getCurrentSimCycle(), timestamp_, getName().c_str(), baseAddr, mshr_.find(baseAddr)->second.back().getString().c_str());
 
-        outstandingEventList_.find(ev->getID())->second.incrementCount();
+        outstandingEventList_.find(ev->getID())->incrementCount();
     }
 }
 
@@ -763,7 +761,11 @@ void Scratchpad::handleScratchPut(MemEventBase * event) {
     remoteWrite->setFlag(MemEvent::F_NONCACHEABLE);
     remoteWrite->setFlag(MemEvent::F_NORESPONSE);
 
-    outstandingEventList_.insert(std::make_pair(ev->getID(), OutstandingEvent(ev, response, remoteWrite)));
+    outstandingEventList_[ev->getID()] = OutstandingEvent(ev, response, remoteWrite);
+
+    uint32_t burstCount = moveBurstCount(ev->getSrcAddr(), ev->getSrcBaseAddr(), ev->getSize());
+    if (burstCount > 1)
+        outstandingEventList_.find(ev->getID())->burstLines.resize(burstCount, 0);
 
     Addr addr = ev->getSrcAddr();
     Addr baseAddr = ev->getSrcBaseAddr();
@@ -784,11 +786,14 @@ void Scratchpad::handleScratchPut(MemEventBase * event) {
                     getCurrentSimCycle(), timestamp_, getName().c_str(),
                     baseAddr, mshr_.find(baseAddr)->second.back().getString().c_str());
 
+        if (burstCount > 1)
+            outstandingEventList_.find(ev->getID())->burstLines[(baseAddr - ev->getSrcBaseAddr()) / moveBurstSize_]++;
+
         bytesLeft -= size;
         baseAddr += scratchLineSize_;
         addr = baseAddr;
 
-        outstandingEventList_.find(ev->getID())->second.incrementCount();
+        outstandingEventList_.find(ev->getID())->incrementCount();
     }
 }
 
@@ -801,18 +806,17 @@ void Scratchpad::handleScratchPut(MemEventBase * event) {
  *  All others (regular read responses): call finishRequest()
  */
 void Scratchpad::handleScratchResponse(SST::Event::id_type responseID) {
-    SST::Event::id_type requestID = responseIDMap_.find(responseID)->second;
+    ForwardedRequest * forward = responseIDMap_.find(responseID);
+    SST::Event::id_type requestID = forward->requestID;
+    Addr baseAddr = forward->baseAddr;
     responseIDMap_.erase(responseID);
 
-    Addr baseAddr = responseIDAddrMap_.find(responseID)->second;
-    responseIDAddrMap_.erase(responseID);
-
     if (is_debug_addr(baseAddr))
         dbg.debug(_L5_, "C: %-20" PRIu64 " %-20" PRIu64 " %-20s Scratch:Recv  0x%-16" PRIx64 " <%" PRIu64 ", %" PRIu32 ">\n",
                 getCurrentSimCycle(), timestamp_, getName().c_str(), baseAddr, responseID.first, responseID.second);
 
-    if (outstandingEventList_.find(requestID)->second.request->getCmd() == Command::Put) {
-        updatePut(requestID);
+    if (outstandingEventList_.find(requestID)->request->getCmd() == Command::Put) {
+        updatePut(requestID, baseAddr);
     } else { // Anything else - GetS, GetX, etc.
         finishRequest(requestID);
     }
@@ -836,7 +840,7 @@ void Scratchpad::handleAckInv(MemEventBase * event) {
     /* Look up request in mshr */
     MSHREntry * entry = &(mshr_.find(baseAddr)->second.front());
     SST::Event::id_type requestID = entry->id;
-    MoveEvent * request = static_cast<MoveEvent*>(outstandingEventList_.find(requestID)->second.request);
+    MoveEvent * request = static_cast<MoveEvent*>(outstandingEventList_.find(requestID)->request);
 
     /* Update cache status */
     if (is_debug_addr(baseAddr))
@@ -877,16 +881,9 @@ void Scratchpad::handleAckInv(MemEventBase * event) {
         read->MemEventBase::copyMetadata(request);
         read->setVirtualAddress(request->getSrcVirtualAddress());
         read->setInstructionPointer(request->getInstructionPointer());
-        responseIDMap_.insert(std::make_pair(read->getID(),requestID));
-        responseIDAddrMap_.insert(std::make_pair(read->getID(), baseAddr));
-
-        std::vector<uint8_t> data = doScratchRead(read);
-        std::vector<uint8_t> payload = outstandingEventList_.find(requestID)->second.remoteWrite->getPayload();
-        uint32_t offset = addr - request->getSrcAddr();
-        for (uint32_t i = 0; i < size; i++) {
-            payload[i+offset] = data[i];
-        }
-        outstandingEventList_.find(requestID)->second.remoteWrite->setPayload(payload);
+        responseIDMap_[read->getID()] = ForwardedRequest(requestID, baseAddr);
+
+        doScratchRead(read, remoteWriteData(requestID, addr - request->getSrcAddr()));
     } else {
         dbg.fatal(CALL_INFO, -1, "%s, Error: unhandled case in handleAckInv. Time = %" PRIu64 ", Event = (%s).\n",
                 getName().c_str(), timestamp_, event->getVerboseString(dlevel).c_str());
@@ -911,7 +908,7 @@ void Scratchpad::handleFetchResp(MemEventBase * event) {
     /* Look up request in mshr */
     MSHREntry * entry = &(mshr_.find(baseAddr)->second.front());
     SST::Event::id_type requestID = entry->id;
-    MoveEvent * put = static_cast<MoveEvent*>(outstandingEventList_.find(requestID)->second.request);
+    MoveEvent * put = static_cast<MoveEvent*>(outstandingEventList_.find(requestID)->request);
 
     /* Update cache status */
     cacheStatus_.at(baseAddr/scratchLineSize_) = false;
@@ -933,15 +930,10 @@ void Scratchpad::handleFetchResp(MemEventBase * event) {
     uint32_t size = deriveSize(addr, baseAddr, put->getSrcAddr(), put->getSize());
 
     // Update write payload
-    std::vector<uint8_t> payload = outstandingEventList_.find(requestID)->second.remoteWrite->getPayload();
-    uint32_t offset = addr - put->getSrcAddr();
-    for (uint32_t i = 0; i < size; i++) {
-        payload[i+offset] = response->getPayload()[i];
-    }
-    outstandingEventList_.find(requestID)->second.remoteWrite->setPayload(payload);
+    std::copy(response->getPayload().begin(), response->getPayload().begin() + size, remoteWriteData(requestID, addr - put->getSrcAddr()));
 
     // Clear this mshr entry
-    updatePut(requestID);
+    updatePut(requestID, baseAddr);
     updateMSHR(baseAddr);   // Delete mshr entry
     delete response;        // Delete response
 }
@@ -1001,8 +993,8 @@ void Scratchpad::handleRemoteRead(MemEvent * event) {
     request->setFlag(MemEvent::F_NONCACHEABLE); // Use byte not line address
 
     MemEvent * response = event->makeResponse();
-    outstandingEventList_.insert(std::make_pair(event->getID(), OutstandingEvent(event, response)));
-    responseIDMap_.insert(std::make_pair(request->getID(), event->getID()));
+    outstandingEventList_[event->getID()] = OutstandingEvent(event, response);
+    responseIDMap_[request->getID()] = ForwardedRequest(event->getID());
 
     memMsgQueue_.insert(std::make_pair(timestamp_, request));
 }
@@ -1038,13 +1030,22 @@ void Scratchpad::handleRemoteWrite(MemEvent * event) {
  * If from a ScratchGet, write data to scratchpad and send a response
  * to the processor once all data is written.
  */
-void Scratchpad::handleRemoteGetResponse(MemEvent * response, SST::Event::id_type requestID) {
+void Scratchpad::handleRemoteGetResponse(MemEvent * response, SST::Event::id_type requestID, uint32_t offset) {
+
+    OutstandingEvent * entry = outstandingEventList_.find(requestID);
+    MoveEvent * request = static_cast<MoveEvent*>(entry->request);
 
-    MoveEvent * request = static_cast<MoveEvent*>(outstandingEventList_.find(requestID)->second.request);
+    // Keep the pipeline full before this burst's lines can complete the Get
+    entry->burstsOutstanding--;
+    issueGetBursts(request, request->getSrcBaseAddr(), request->getDstBaseAddr());
 
-    uint32_t bytesLeft = request->getSize();
-    Addr addr = request->getDstAddr();
-    Addr baseAddr = request->getDstBaseAddr();
+    uint32_t burst = (moveBurstSize_ == 0) ? 0 : (request->getDstAddr() + offset - request->getDstBaseAddr()) / moveBurstSize_;
+    uint32_t length;
+    moveBurstRange(request->getDstAddr(), request->getDstBaseAddr(), request->getSize(), burst, offset, length);
+
+    uint32_t bytesLeft = length;
+    Addr addr = request->getDstAddr() + offset;
+    Addr baseAddr = (offset == 0) ? request->getDstBaseAddr() : addr;   // Later bursts start on a line
     uint32_t payloadOffset = 0;
 
     while (bytesLeft != 0) {
@@ -1096,7 +1097,7 @@ void Scratchpad::handleRemoteGetResponse(MemEvent * response, SST::Event::id_typ
 
 void Scratchpad::handleRemoteReadResponse(MemEvent * response, SST::Event::id_type requestID) {
     // Update response with payload and finish request
-    MemEvent * fwdResponse = static_cast<MemEvent*>(outstandingEventList_.find(requestID)->second.response);
+    MemEvent * fwdResponse = static_cast<MemEvent*>(outstandingEventList_.find(requestID)->response);
     fwdResponse->setPayload(response->getPayload());
 
     finishRequest(requestID);
@@ -1114,14 +1115,15 @@ void Scratchpad::updateMSHR(Addr baseAddr) {
         MSHREntry * entry = &(mshr_.find(baseAddr)->second.front());
 
         if (entry->cmd == Command::GetS) {
-            std::vector<uint8_t> readData = doScratchRead(entry->scratch);
-            static_cast<MemEvent*>(outstandingEventList_.find(entry->id)->second.response)->setPayload(readData);
+            MemEvent * response = static_cast<MemEvent*>(outstandingEventList_.find(entry->id)->response);
+            response->setZeroPayload(entry->scratch->getSize());
+            doScratchRead(entry->scratch, response->getPayload().data());
 
             if (is_debug_addr(baseAddr))
                 dbg.debug(_L10_, "M: %-20" PRIu64 " %-20" PRIu64 " %-20s MSHR:Update   0x%-16" PRIx64 " %s\n",
                         getCurrentSimCycle(), timestamp_, getName().c_str(), baseAddr, entry->getString().c_str());
 
-            if (caching_ && (outstandingEventList_.find(entry->id)->second.request->queryFlag(MemEvent::F_NONCACHEABLE))) {
+            if (caching_ && (outstandingEventList_.find(entry->id)->request->queryFlag(MemEvent::F_NONCACHEABLE))) {
                 cacheStatus_.at(baseAddr/scratchLineSize_) = true;
             }
             break;
@@ -1135,7 +1137,7 @@ void Scratchpad::updateMSHR(Addr baseAddr) {
                         getCurrentSimCycle(), timestamp_, getName().c_str(), baseAddr);
 
         } else if (entry->cmd == Command::Get) {
-            entry->needAck = startGet(baseAddr, static_cast<MoveEvent*>(outstandingEventList_.find(entry->id)->second.request));
+            entry->needAck = startGet(baseAddr, static_cast<MoveEvent*>(outstandingEventList_.find(entry->id)->request));
             if (!entry->needData) {
                 doScratchWrite(entry->scratch);
                 entry->scratch = nullptr;
@@ -1155,7 +1157,7 @@ void Scratchpad::updateMSHR(Addr baseAddr) {
                 break; // Still waiting on something
             }
         } else if (entry->cmd == Command::Put) {
-            entry->needAck = startPut(baseAddr, static_cast<MoveEvent*>(outstandingEventList_.find(entry->id)->second.request));
+            entry->needAck = startPut(baseAddr, static_cast<MoveEvent*>(outstandingEventList_.find(entry->id)->request));
             entry->needData = !entry->needAck;
 
             if (is_debug_addr(baseAddr))
@@ -1178,18 +1180,18 @@ void Scratchpad::updateMSHR(Addr baseAddr) {
 }
 
 // Helper methods
-std::vector<uint8_t> Scratchpad::doScratchRead(MemEvent * event) {
+/* Read event's data from the backing store straight into data, which must have room for
+ * event->getSize() bytes and be zeroed if there is no backing store.
+ */
+void Scratchpad::doScratchRead(MemEvent * event, uint8_t * data) {
     stat_ScratchReadIssued->addData(1);
 
-    std::vector<uint8_t> data;
-    data.resize(event->getSize(), 0);
     if (backing_) {
         backing_->get(event->getAddr(), event->getSize(), data);
     }
     dbg.debug(_L5_, "C: %-20" PRIu64 " %-20" PRIu64 " %-20s Scratch:Send  0x%-16" PRIx64 " (%s)\n",
             getCurrentSimCycle(), timestamp_, getName().c_str(), event->getAddr(), event->getBriefString().c_str());
     scratch_->handleMemEvent(event);
-    return data;
 }
 
 void Scratchpad::doScratchWrite(MemEvent * event) {
@@ -1255,58 +1257,144 @@ bool Scratchpad::startPut(Addr baseAddr, MoveEvent * put) {
         read->MemEventBase::copyMetadata(put);
         read->setVirtualAddress(put->getSrcVirtualAddress());
         read->setInstructionPointer(put->getInstructionPointer());
-        responseIDMap_.insert(std::make_pair(read->getID(), put->getID()));
-        responseIDAddrMap_.insert(std::make_pair(read->getID(), baseAddr));
-
-        std::vector<uint8_t> data = doScratchRead(read);
+        responseIDMap_[read->getID()] = ForwardedRequest(put->getID(), baseAddr);
 
-        std::vector<uint8_t> payload = outstandingEventList_.find(put->getID())->second.remoteWrite->getPayload();
-        uint32_t offset = addr - put->getSrcAddr();
-        for (uint32_t i = 0; i < size; i++) {
-            payload[i+offset] = data[i];
-        }
-        outstandingEventList_.find(put->getID())->second.remoteWrite->setPayload(payload);
+        doScratchRead(read, remoteWriteData(put->getID(), addr - put->getSrcAddr()));
         return false;
     }
 }
 
-void Scratchpad::updatePut(SST::Event::id_type putID) {
-    uint32_t count = outstandingEventList_.find(putID)->second.decrementCount();
+void Scratchpad::updatePut(SST::Event::id_type putID, Addr baseAddr) {
+    OutstandingEvent * entry = outstandingEventList_.find(putID);
+    MoveEvent * put = static_cast<MoveEvent*>(entry->request);
+
+    // Write each burst out as soon as all of its lines have been read
+    if (!entry->burstLines.empty()) {
+        uint32_t burst = (baseAddr - put->getSrcBaseAddr()) / moveBurstSize_;
+        if (--entry->burstLines[burst] == 0)
+            sendPutBurst(put, entry->remoteWrite, burst);
+    }
+
+    uint32_t count = entry->decrementCount();
     if (count == 0) {
-        MoveEvent * put = static_cast<MoveEvent*>(outstandingEventList_.find(putID)->second.request);
         dbg.debug(_L10_, "C: %-20" PRIu64 " %-20" PRIu64 " %-20s Put            0x%-16" PRIx64 " 0x%-16" PRIx64 " Scratch Done (<%" PRIu64 ", %" PRIu32 ">, 0x%" PRIx64 ")\n",
                 getCurrentSimCycle(), timestamp_, getName().c_str(),
                 put->getSrcBaseAddr(),
                 put->getDstBaseAddr(),
-                outstandingEventList_.find(putID)->second.remoteWrite->getID().first,
-                outstandingEventList_.find(putID)->second.remoteWrite->getID().second,
-                outstandingEventList_.find(putID)->second.remoteWrite->getBaseAddr());
+                outstandingEventList_.find(putID)->remoteWrite->getID().first,
+                outstandingEventList_.find(putID)->remoteWrite->getID().second,
+                outstandingEventList_.find(putID)->remoteWrite->getBaseAddr());
 //        dbg.debug(_L5_, "C: %-20" PRIu64 " %-20" PRIu64 " %-20s Finish        0x%-16" PRIx64 " <%" PRIu64 ", %" PRIu32 ">\n",
-//                getCurrentSimCycle(), timestamp_, getName().c_str(), outstandingEventList_.find(putID)->second.remoteWrite->getBaseAddr(), baseAddr, responseID.first, responseID.second);
-        memMsgQueue_.insert(std::make_pair(timestamp_, outstandingEventList_.find(putID)->second.remoteWrite));
-        sendResponse(outstandingEventList_.find(putID)->second.response);
-        delete outstandingEventList_.find(putID)->second.request;
+//                getCurrentSimCycle(), timestamp_, getName().c_str(), outstandingEventList_.find(putID)->remoteWrite->getBaseAddr(), baseAddr, responseID.first, responseID.second);
+        if (entry->burstLines.empty())
+            memMsgQueue_.insert(std::make_pair(timestamp_, entry->remoteWrite));
+        else
+            delete entry->remoteWrite;  // All of it went out in bursts
+        sendResponse(outstandingEventList_.find(putID)->response);
+        delete outstandingEventList_.find(putID)->request;
         outstandingEventList_.erase(putID);
     }
 
 }
 
 void Scratchpad::updateGet(SST::Event::id_type getID) {
-    uint32_t count = outstandingEventList_.find(getID)->second.decrementCount();
+    uint32_t count = outstandingEventList_.find(getID)->decrementCount();
     if (count == 0) {
-        sendResponse(outstandingEventList_.find(getID)->second.response);
-        delete outstandingEventList_.find(getID)->second.request;
+        sendResponse(outstandingEventList_.find(getID)->response);
+        delete outstandingEventList_.find(getID)->request;
         outstandingEventList_.erase(getID);
     }
 }
 
 void Scratchpad::finishRequest(SST::Event::id_type requestID) {
-    if (outstandingEventList_.find(requestID)->second.response != nullptr)
-        sendResponse(outstandingEventList_.find(requestID)->second.response);
-    delete outstandingEventList_.find(requestID)->second.request;
+    if (outstandingEventList_.find(requestID)->response != nullptr)
+        sendResponse(outstandingEventList_.find(requestID)->response);
+    delete outstandingEventList_.find(requestID)->request;
     outstandingEventList_.erase(requestID);
 }
 
+/* Where to fill part of a ScratchPut's remote write payload in place.
+ * Puts can span many scratch lines so scratch reads land directly in the payload.
+ */
+uint8_t * Scratchpad::remoteWriteData(SST::Event::id_type putID, uint32_t offset) {
+    return outstandingEventList_.find(putID)->remoteWrite->getPayload().data() + offset;
+}
+
+/* Number of bursts a Get or Put of size bytes at addr is moved in.
+ * Bursts are aligned to moveBurstSize_ from baseAddr, the scratch line holding addr.
+ */
+uint32_t Scratchpad::moveBurstCount(Addr addr, Addr baseAddr, uint32_t size) {
+    if (moveBurstSize_ == 0 || size == 0)
+        return 1;
+    return 1 + (addr + size - 1 - baseAddr) / moveBurstSize_;
+}
+
+/* Offset within the move and length of one of its bursts */
+void Scratchpad::moveBurstRange(Addr addr, Addr baseAddr, uint32_t size, uint32_t burst, uint32_t &offset, uint32_t &length) {
+    if (moveBurstSize_ == 0) {
+        offset = 0;
+        length = size;
+        return;
+    }
+    Addr start = baseAddr + burst * moveBurstSize_;
+    Addr end = start + moveBurstSize_;
+    if (start < addr) start = addr;
+    if (end > addr + size) end = addr + size;
+    offset = start - addr;
+    length = end - start;
+}
+
+/* Send remote reads for a Get's next bursts, up to moveMaxOutstanding_ in flight */
+void Scratchpad::issueGetBursts(MoveEvent * get, Addr saddr, Addr daddr) {
+    OutstandingEvent * entry = outstandingEventList_.find(get->getID());
+    uint32_t burstCount = moveBurstCount(get->getDstAddr(), get->getDstBaseAddr(), get->getSize());
+
+    while (entry->burstsIssued < burstCount && (moveMaxOutstanding_ == 0 || entry->burstsOutstanding < moveMaxOutstanding_)) {
+        uint32_t offset, length;
+        moveBurstRange(get->getDstAddr(), get->getDstBaseAddr(), get->getSize(), entry->burstsIssued, offset, length);
+
+        Addr addr = get->getSrcAddr() - remoteAddrOffset_ + offset;
+        Addr baseAddr = (offset == 0) ? get->getSrcBaseAddr() : (addr & ~(remoteLineSize_ - 1));
+        MemEvent * remoteRead = new MemEvent(getName(), addr, baseAddr, Command::GetS, length);
+        remoteRead->MemEventBase::copyMetadata(get);
+        remoteRead->setFlag(MemEvent::F_NONCACHEABLE);
+        remoteRead->setVirtualAddress(get->getSrcVirtualAddress() + offset);
+        remoteRead->setInstructionPointer(get->getInstructionPointer());
+        responseIDMap_[remoteRead->getID()] = ForwardedRequest(get->getID(), 0, offset);
+
+        if (is_debug_event(remoteRead)) {
+            dbg.debug(_L10_, "C: %-20" PRIu64 " %-20" PRIu64 " %-20s Get           0x%-16" PRIx64 " 0x%-16" PRIx64 " Remote Read (<%" PRIu64 ", %" PRIu32 ">, 0x%" PRIx64 ")\n",
+                    getCurrentSimCycle(), timestamp_, getName().c_str(), saddr, daddr, remoteRead->getID().first, remoteRead->getID().second, remoteRead->getBaseAddr());
+        }
+
+        memMsgQueue_.insert(std::make_pair(timestamp_, remoteRead));
+
+        entry->burstsIssued++;
+        entry->burstsOutstanding++;
+        if (burstCount > 1)
+            stat_MoveBurstIssued->addData(1);
+    }
+}
+
+/* Write one burst of a Put to remote once all of its lines have been read from scratch */
+void Scratchpad::sendPutBurst(MoveEvent * put, MemEvent * remoteWrite, uint32_t burst) {
+    uint32_t offset, length;
+    moveBurstRange(put->getSrcAddr(), put->getSrcBaseAddr(), put->getSize(), burst, offset, length);
+
+    Addr addr = remoteWrite->getAddr() + offset;
+    std::vector<uint8_t> data(remoteWrite->getPayload().begin() + offset, remoteWrite->getPayload().begin() + offset + length);
+    MemEvent * write = new MemEvent(getName(), addr, addr & ~(remoteLineSize_ - 1), Command::GetX, data);
+    write->setFlag(MemEvent::F_NONCACHEABLE);
+    write->setFlag(MemEvent::F_NORESPONSE);
+
+    dbg.debug(_L10_, "C: %-20" PRIu64 " %-20" PRIu64 " %-20s Put            0x%-16" PRIx64 " 0x%-16" PRIx64 " Burst %" PRIu32 " (<%" PRIu64 ", %" PRIu32 ">, 0x%" PRIx64 ")\n",
+            getCurrentSimCycle(), timestamp_, getName().c_str(), put->getSrcBaseAddr(), put->getDstBaseAddr(), burst,
+            write->getID().first, write->getID().second, write->getBaseAddr());
+
+    memMsgQueue_.insert(std::make_pair(timestamp_, write));
+    stat_MoveBurstIssued->addData(1);
+}
+
 uint32_t Scratchpad::deriveSize(Addr addr, Addr baseAddr, Addr requestAddr, uint32_t requestSize) {
     uint32_t size = baseAddr + scratchLineSize_ - addr;
     if (addr + size > requestAddr + requestSize) {
@@ -29,6 +29,7 @@
 #include "sst/elements/memHierarchy/moveEvent.h"
 #include "sst/elements/memHierarchy/memEvent.h"
 #include "sst/elements/memHierarchy/memLinkBase.h"
+#include "sst/elements/memHierarchy/flatHashMap.h"
 
 namespace SST {
 namespace MemHierarchy {
@@ -50,6 +51,8 @@ public:
             {"backing_size_unit",   "(string) For 'malloc' backing stores, malloc granularity", "1MiB"},\
             {"memory_addr_offset",  "(uint) Amount to offset remote addresses by. Default is 'size' so that remote memory addresses start at 0", "size"},
             {"response_per_cycle",  "(uint) Maximum number of responses to return to processor each cycle. 0 is unlimited", "0"},
+            {"move_burst_size",     "(string) Split each Get and Put into remote requests of at most this many bytes, rounded up to a multiple of scratch_line_size. Scratch lines are written as each Get burst returns and each Put burst is written as soon as its lines are read. 0B sends each move as a single remote request", "0B"},
+            {"move_max_outstanding", "(uint) Maximum number of remote read bursts a Get keeps in flight when move_burst_size is set. 0 is unlimited", "0"},
             {"backendConvertor",    "(string) Backend convertor to use for the scratchpad", "memHierarchy.scratchpadBackendConvertor"},
             {"debug",               "(uint) Where to print debug output. Options: 0[no output], 1[stdout], 2[stderr], 3[file]", "0"},
             {"debug_level",         "(uint) Debug verbosity level. Between 0 and 10", "0"} )
@@ -67,7 +70,8 @@ public:
             {"request_received_scratch_get",    "Number of scratchpad Gets received from CPU (copy from memory to scratch)", "count", 1},
             {"request_received_scratch_put",    "Number of scratchpad Puts received from CPU (copy from scratch to memory)", "count", 1},
             {"request_issued_scratch_read",     "Number of scratchpad reads issued to scratchpad", "count", 1},
-            {"request_issued_scratch_write",    "Number of scratchpad writes issued to scratchpad", "count", 1} )
+            {"request_issued_scratch_write",    "Number of scratchpad writes issued to scratchpad", "count", 1},
+            {"request_issued_move_burst",       "Number of remote reads or writes issued for Get/Put bursts", "count", 1} )
 
     SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
             {"backendConvertor", "Convertor to interface to memory timing model (backend)", "SST::MemHierarchy::ScratchBackendConvertor" },
@@ -134,13 +138,13 @@ private:
     void handleFetchResp(MemEventBase * event);
     void handleNack(MemEventBase * event);
 
-    void handleRemoteGetResponse(MemEvent * response, SST::Event::id_type id);
+    void handleRemoteGetResponse(MemEvent * response, SST::Event::id_type id, uint32_t offset);
     void handleRemoteReadResponse(MemEvent * response, SST::Event::id_type id);
 
     // Helper methods
     void updateMSHR(Addr baseAddr);
 
-    std::vector<uint8_t> doScratchRead(MemEvent * read);
+    void doScratchRead(MemEvent * read, uint8_t * data);
     void doScratchWrite(MemEvent * write);
     void sendResponse(MemEventBase * event);
 
@@ -148,10 +152,17 @@ private:
     bool startPut(Addr baseAddr, MoveEvent * put);
 
     void updateGet(SST::Event::id_type id);
-    void updatePut(SST::Event::id_type id);
+    void updatePut(SST::Event::id_type id, Addr baseAddr);
     void finishRequest(SST::Event::id_type id);
 
     uint32_t deriveSize(Addr addr, Addr baseAddr, Addr requestAddr, uint32_t requestSize);
+    uint8_t * remoteWriteData(SST::Event::id_type putID, uint32_t offset);
+
+    // Bulk moves
+    uint32_t moveBurstCount(Addr addr, Addr baseAddr, uint32_t size);
+    void moveBurstRange(Addr addr, Addr baseAddr, uint32_t size, uint32_t burst, uint32_t &offset, uint32_t &length);
+    void issueGetBursts(MoveEvent * get, Addr saddr, Addr daddr);
+    void sendPutBurst(MoveEvent * put, MemEvent * remoteWrite, uint32_t burst);
 
     // Links
     MemLinkBase* linkUp_;     // To cache/cpu
@@ -164,9 +175,13 @@ private:
             MemEvent * remoteWrite;     // For Put requests, collect scratch read responses here
             uint32_t count;             // Number of lines we are waiting on - when 0, the request is complete
                                         // i.e., for a read or write, just 1, for a get or put, the size/lineSize
+            uint32_t burstsIssued;      // For Gets, remote read bursts sent so far
+            uint32_t burstsOutstanding; // For Gets, remote read bursts not yet returned
+            std::vector<uint32_t> burstLines; // For burst Puts, scratch lines each burst is still waiting on
 
-            OutstandingEvent(MemEventBase * request, MemEventBase * response) : request(request), response(response), remoteWrite(nullptr), count(0) { }
-            OutstandingEvent(MemEventBase * request, MemEventBase * response, MemEvent * write) : request(request), response(response), remoteWrite(write), count(0) { }
+            OutstandingEvent() : request(nullptr), response(nullptr), remoteWrite(nullptr), count(0), burstsIssued(0), burstsOutstanding(0) { }
+            OutstandingEvent(MemEventBase * request, MemEventBase * response) : request(request), response(response), remoteWrite(nullptr), count(0), burstsIssued(0), burstsOutstanding(0) { }
+            OutstandingEvent(MemEventBase * request, MemEventBase * response, MemEvent * write) : request(request), response(response), remoteWrite(write), count(0), burstsIssued(0), burstsOutstanding(0) { }
 
             uint32_t decrementCount() { count--; return count; }
             void incrementCount() { count++; }
@@ -226,9 +241,18 @@ private:
         }
     } eventDI;
 
-    std::map<SST::Event::id_type,SST::Event::id_type> responseIDMap_;   // Map a forwarded request ID to a original request ID
-    std::map<SST::Event::id_type,Addr> responseIDAddrMap_;              // Map an outstanding scratch request ID to the request's baseAddr
-    std::map<SST::Event::id_type,OutstandingEvent> outstandingEventList_; // List of all outstanding events
+    // A request sent to scratch or remote memory on behalf of an outstanding event
+    struct ForwardedRequest {
+        SST::Event::id_type requestID;  // Original request ID
+        Addr baseAddr;                  // For scratch requests, the request's baseAddr
+        uint32_t offset;                // For Get bursts, offset of the burst within the move
+
+        ForwardedRequest() : requestID(), baseAddr(0), offset(0) { }
+        ForwardedRequest(SST::Event::id_type id, Addr baseAddr = 0, uint32_t offset = 0) : requestID(id), baseAddr(baseAddr), offset(offset) { }
+    };
+
+    FlatHashMap<SST::Event::id_type,ForwardedRequest,EventIdHash> responseIDMap_;       // Map a forwarded request ID to the original request
+    FlatHashMap<SST::Event::id_type,OutstandingEvent,EventIdHash> outstandingEventList_; // List of all outstanding events
     std::map<Addr,std::list<MSHREntry> > mshr_; // MSHR for scratch accesses
 
 
@@ -239,6 +263,10 @@ private:
     // Throughput limits
     uint32_t responsesPerCycle_;
 
+    // Bulk moves
+    uint64_t moveBurstSize_;        // 0 to move each Get/Put as one remote request
+    uint32_t moveMaxOutstanding_;   // Per Get, 0 is unlimited
+
     // Caching information
     bool caching_;  // Whether or not caching is possible
     bool directory_; // Whether or not a directory is managing the caches - if so we cannot assume on a writeback that the data is not cached
@@ -254,6 +282,7 @@ private:
     Statistic<uint64_t>* stat_ScratchPutReceived;
     Statistic<uint64_t>* stat_ScratchReadIssued;
     Statistic<uint64_t>* stat_ScratchWriteIssued;
+    Statistic<uint64_t>* stat_MoveBurstIssued;
 };
 
 }}
@@ -0,0 +1,108 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef MEMHIERARCHY_SHARERSET_H
+#define MEMHIERARCHY_SHARERSET_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace SST { namespace MemHierarchy {
+
+/*
+ * Bit-vector set of sharers, indexed by a small integer sharer index
+ *
+ * The owner of the set assigns indices (e.g., one per upper-level cache).
+ * The first 64 sharers are stored inline so the common case needs no allocation.
+ */
+class SharerSet {
+public:
+    SharerSet() : low_(0) {}
+
+    void insert(unsigned index) {
+        if (index < 64) {
+            low_ |= bit(index);
+            return;
+        }
+        size_t word = (index / 64) - 1;
+        if (word >= high_.size())
+            high_.resize(word + 1, 0);
+        high_[word] |= bit(index % 64);
+    }
+
+    void erase(unsigned index) {
+        if (index < 64) {
+            low_ &= ~bit(index);
+            return;
+        }
+        size_t word = (index / 64) - 1;
+        if (word < high_.size())
+            high_[word] &= ~bit(index % 64);
+    }
+
+    bool contains(unsigned index) const {
+        if (index < 64)
+            return low_ & bit(index);
+        size_t word = (index / 64) - 1;
+        return word < high_.size() && (high_[word] & bit(index % 64));
+    }
+
+    size_t count() const {
+        size_t num = __builtin_popcountll(low_);
+        for (size_t i = 0; i < high_.size(); i++)
+            num += __builtin_popcountll(high_[i]);
+        return num;
+    }
+
+    bool empty() const {
+        if (low_) return false;
+        for (size_t i = 0; i < high_.size(); i++)
+            if (high_[i]) return false;
+        return true;
+    }
+
+    void clear() {
+        low_ = 0;
+        high_.clear();
+    }
+
+    /* Call f(index) for each sharer in increasing index order */
+    template <class F>
+    void forEach(F f) const {
+        forEachInWord(low_, 0, f);
+        for (size_t i = 0; i < high_.size(); i++)
+            forEachInWord(high_[i], 64 * (i + 1), f);
+    }
+
+private:
+    static uint64_t bit(unsigned index) { return (uint64_t)1 << index; }
+
+    template <class F>
+    static void forEachInWord(uint64_t word, unsigned base, F& f) {
+        while (word) {
+            unsigned index = __builtin_ctzll(word);
+            word &= word - 1;
+            f(base + index);
+        }
+    }
+
+    uint64_t low_;
+    std::vector<uint64_t> high_;
+};
+
+}}
+
+#endif
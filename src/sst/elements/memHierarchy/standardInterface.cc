@@ -41,6 +41,11 @@ StandardInterface::StandardInterface(SST::ComponentId_t id, Params &params, Time
     output.init("", params.find<int>("verbose", 1), 0, Output::STDOUT);
     debug.init("", dlevel, 0, (Output::output_location_t)params.find<int>("debug", 0));
 
+    /* Room for the expected requests in each direction below the tables' 3/4 load limit */
+    size_t maxOutstanding = params.find<size_t>("max_outstanding", 64);
+    requests_ = FlatHashMap<MemEventBase::id_type, std::pair<StandardMem::Request*,Command>, EventIdHash>(2 * maxOutstanding);
+    responses_ = FlatHashMap<StandardMem::Request::id_t, MemEventBase*, IdHash>(2 * maxOutstanding);
+
     rqstr_ = "";
     initDone_ = false;
 
@@ -229,16 +234,16 @@ void StandardInterface::receive(SST::Event* ev) {
     /* Handle responses to requests we sent */
     if (isResponse) {
         MemEventBase::id_type origID = me->getResponseToID();
-        std::map<MemEventBase::id_type,std::pair<StandardMem::Request*,Command>>::iterator reqit = requests_.find(origID);
-        if (reqit == requests_.end()) {
+        std::pair<StandardMem::Request*,Command>* reqit = requests_.find(origID);
+        if (reqit == nullptr) {
             output.fatal(CALL_INFO, -1, "%s, Error: Received response but cannot locate matching request. Response: %s\n",
                 getName().c_str(), me->getVerboseString(dlevel).c_str());
         }
-        StandardMem::Request* origReq = reqit->second.first;
-        Command origCmd = reqit->second.second;
+        StandardMem::Request* origReq = reqit->first;
+        Command origCmd = reqit->second;
         if (origCmd == Command::GetS || origCmd == Command::GetSX)
             cmd = Command::GetSResp;
-        requests_.erase(reqit);
+        requests_.erase(origID);
         response = me;
         switch (cmd) {
             case Command::GetSResp:
@@ -533,11 +538,11 @@ Event* StandardInterface::MemEventConverter::convert(StandardMem::CustomReq* req
 }
 
 SST::Event* StandardInterface::MemEventConverter::convert(StandardMem::ReadResp* resp) { 
-    std::map<StandardMem::Request::id_t, MemEventBase*>::iterator it = iface->responses_.find(resp->getID());
-    if (it == iface->responses_.end())
+    MemEventBase** it = iface->responses_.find(resp->getID());
+    if (it == nullptr)
         iface->output.fatal(CALL_INFO, -1, "%s, Error: Handling a ReadResp but no matching Read found\n", iface->getName().c_str());
-    MemEvent* mereq = static_cast<MemEvent*>(it->second); // Matching memEvent req
-    iface->responses_.erase(it);
+    MemEvent* mereq = static_cast<MemEvent*>(*it); // Matching memEvent req
+    iface->responses_.erase(resp->getID());
     MemEvent* meresp = mereq->makeResponse();
     meresp->setPayload(resp->data);
     if (!resp->getSuccess()) {
@@ -546,11 +551,11 @@ SST::Event* StandardInterface::MemEventConverter::convert(StandardMem::ReadResp*
     return meresp;
 }
 SST::Event* StandardInterface::MemEventConverter::convert(StandardMem::WriteResp* resp) {
-    std::map<StandardMem::Request::id_t, MemEventBase*>::iterator it = iface->responses_.find(resp->getID());
-    if (it == iface->responses_.end())
+    MemEventBase** it = iface->responses_.find(resp->getID());
+    if (it == nullptr)
         iface->output.fatal(CALL_INFO, -1, "%s, Error: Handling a WriteResp but no matching Write found\n", iface->getName().c_str());
-    MemEvent* mereq = static_cast<MemEvent*>(it->second); // Matching memEvent req
-    iface->responses_.erase(it);
+    MemEvent* mereq = static_cast<MemEvent*>(*it); // Matching memEvent req
+    iface->responses_.erase(resp->getID());
     MemEvent* meresp = mereq->makeResponse();
     if (!resp->getSuccess()) {
         meresp->setFail();
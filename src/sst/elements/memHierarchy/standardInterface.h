@@ -29,6 +29,7 @@
 #include <sst/core/output.h>
 
 #include "sst/elements/memHierarchy/memLinkBase.h"
+#include "sst/elements/memHierarchy/flatHashMap.h"
 
 namespace SST {
 
@@ -78,6 +79,7 @@ public:
         {"verbose",     "(uint) Output verbosity for warnings/errors. 0[fatal error only], 1[warnings], 2[full state dump on fatal error]", "1"},
         {"debug",       "(uint) Where to send debug output. Options: 0[none], 1[stdout], 2[stderr], 3[file]", "0"},
         {"debug_level", "(uint) Debugging level: 0 to 10. Must configure sst-core with '--enable-debug'. 1=info, 2-10=debug output", "0"},
+        {"max_outstanding", "(uint) Number of requests the endpoint expects to have outstanding at once, sizes the request tables so they do not grow during simulation. Tables still grow if it is exceeded", "64"},
         {"port",        "(string) port name to use for interfacing to the memory system. This must be provided if this subcomponent is being loaded anonymously. Otherwise this should not be specified and either the 'port' port should be connected or the 'memlink' subcomponent slot should be filled"},
         {"noncacheable_regions", "(string) vector of (start, end) address pairs for noncacheable address ranges. Vector format should be [start0, end0, start1, end1, ...].", "[]"}
     )
@@ -119,8 +121,8 @@ protected:
     Addr        baseAddrMask_;
     Addr        lineSize_;
     std::string rqstr_;
-    std::map<MemEventBase::id_type, std::pair<StandardMem::Request*,Command>> requests_;   /* Map requests sent by the endpoint */
-    std::map<StandardMem::Request::id_t, MemEventBase*> responses_;     /* Map requests received by the endpoint */
+    FlatHashMap<MemEventBase::id_type, std::pair<StandardMem::Request*,Command>, EventIdHash> requests_;   /* Map requests sent by the endpoint */
+    FlatHashMap<StandardMem::Request::id_t, MemEventBase*, IdHash> responses_;     /* Map requests received by the endpoint */
     SST::MemHierarchy::MemLinkBase*  link_;
     bool cacheDst_; // Whether we've got a cache below us to handle certain conversions or we need to 
 
@@ -102,6 +102,39 @@ standardCPU::standardCPU(ComponentId_t id, Params& params) :
     if (maxReqsPerIssue < 1) {
         out.fatal(CALL_INFO, -1, "%s, Error: StandardCPU cannot issue less than one request at a time...fix your input deck\n", getName().c_str());
     }
+    fixedReqsPerIssue = params.find<bool>("fixedReqsPerIssue", false);
+
+    /* Access pattern */
+    UnitAlgebra footprintUA = params.find<UnitAlgebra>("footprint", "0B");
+    if (!(footprintUA.hasUnits("B"))) {
+        out.fatal(CALL_INFO, -1, "%s, Error: footprint parameter requires units of 'B' (SI OK). You provided '%s'\n",
+            getName().c_str(), footprintUA.toString().c_str() );
+    }
+    footprint = footprintUA.getRoundedValue();
+    if (footprint > maxAddr + 1) {
+        out.fatal(CALL_INFO, -1, "%s, Error: footprint (%" PRIu64 "B) is larger than memSize (%" PRIu64 "B)\n",
+            getName().c_str(), footprint, maxAddr + 1);
+    }
+    if (footprint == 0) footprint = maxAddr + 1;
+
+    stride = params.find<uint64_t>("stride", 0);
+    strideAddr = 0;
+
+    locality = params.find<uint32_t>("locality", 0);
+    if (locality > 100) {
+        out.fatal(CALL_INFO, -1, "%s, Error: locality is a percent and must be between 0 and 100. You provided '%" PRIu32 "'\n",
+            getName().c_str(), locality);
+    }
+    UnitAlgebra localityUA = params.find<UnitAlgebra>("locality_range", "4KiB");
+    if (!(localityUA.hasUnits("B"))) {
+        out.fatal(CALL_INFO, -1, "%s, Error: locality_range parameter requires units of 'B' (SI OK). You provided '%s'\n",
+            getName().c_str(), localityUA.toString().c_str() );
+    }
+    localityRange = localityUA.getRoundedValue();
+    if (locality != 0 && (localityRange == 0 || localityRange > footprint)) {
+        out.fatal(CALL_INFO, -1, "%s, Error: locality_range must be greater than 0B and no larger than the footprint\n", getName().c_str());
+    }
+    lastAddr = 0;
 
     // Tell the simulator not to end until we OK it
     registerAsPrimaryComponent();
@@ -159,14 +192,14 @@ void standardCPU::finish() { }
 // incoming events are scanned and deleted
 void standardCPU::handleEvent(StandardMem::Request *req)
 {
-    std::map<uint64_t, std::pair<SimTime_t,std::string>>::iterator i = requests.find(req->getID());
-    if ( requests.end() == i ) {
+    OutstandingReq* i = requests.find(req->getID());
+    if ( nullptr == i ) {
         out.fatal(CALL_INFO, -1, "Event (%" PRIx64 ") not found!\n", req->getID());
     } else {
-        SimTime_t et = getCurrentSimTime() - i->second.first;
-        if (i->second.second == "StoreConditional" && req->getSuccess())
+        SimTime_t et = getCurrentSimTime() - i->issueTime;
+        if (i->storeConditional && req->getSuccess())
             num_llsc_success->addData(1);
-        requests.erase(i);
+        requests.erase(req->getID());
     }
 
     delete req;
@@ -187,13 +220,14 @@ bool standardCPU::clockTic( Cycle_t )
             // create event
             // x4 to prevent splitting blocks
             uint32_t reqsToSend = 1;
-            if (maxReqsPerIssue > 1) reqsToSend += rng.generateNextUInt32() % maxReqsPerIssue;
+            if (fixedReqsPerIssue) reqsToSend = maxReqsPerIssue;
+            else if (maxReqsPerIssue > 1) reqsToSend += rng.generateNextUInt32() % maxReqsPerIssue;
             if (reqsToSend > (maxOutstanding - requests.size())) reqsToSend = maxOutstanding - requests.size();
             if (reqsToSend > ops) reqsToSend = ops;
 
             for (int i = 0; i < reqsToSend; i++) {
 
-                StandardMem::Addr addr = rng.generateNextUInt64();
+                StandardMem::Addr addr = nextAddress(rng.generateNextUInt64());
 
                 std::vector<uint8_t> data;
                 data.resize(4);
@@ -237,7 +271,9 @@ bool standardCPU::clockTic( Cycle_t )
                 }
 
                 if (req->needsResponse()) {
-		    requests[req->getID()] =  std::make_pair(getCurrentSimTime(), cmdString);
+                    OutstandingReq& outstanding = requests[req->getID()];
+                    outstanding.issueTime = getCurrentSimTime();
+                    outstanding.storeConditional = (cmdString == "StoreConditional");
                 }
             
                 memory->send(req);
@@ -258,6 +294,26 @@ bool standardCPU::clockTic( Cycle_t )
     return false;
 }
 
+/*
+ * The default pattern leaves the random address alone (the create* methods
+ * fold it into memory). Otherwise addresses either walk the footprint in
+ * 'stride' steps, or stay near the previous address 'locality' percent of
+ * the time and fall anywhere in the footprint the rest of the time.
+ */
+StandardMem::Addr standardCPU::nextAddress(Addr addr) {
+    if (stride != 0) {
+        addr = strideAddr;
+        strideAddr += stride;
+        if (strideAddr >= footprint) strideAddr = 0;
+    } else if (locality != 0 && (rng.generateNextUInt32() % 100) < locality) {
+        addr = (lastAddr - (lastAddr % localityRange)) + (addr % localityRange);
+    } else if (footprint != maxAddr + 1) {
+        addr = addr % footprint;
+    }
+    lastAddr = addr;
+    return addr;
+}
+
 /* Methods for sending different kinds of requests */
 StandardMem::Request* standardCPU::createWrite(Addr addr) {
     addr = ((addr % maxAddr)>>2) << 2;
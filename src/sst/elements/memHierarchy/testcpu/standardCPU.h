@@ -31,6 +31,7 @@
 #include <sst/core/rng/marsaglia.h>
 
 #include "util.h"
+#include "sst/elements/memHierarchy/flatHashMap.h"
 
 using namespace SST::Statistics;
 
@@ -53,6 +54,11 @@ public:
         {"maxOutstanding",          "(uint) Maximum number of outstanding memory requests at a time.", "10"},
         {"opCount",                 "(uint) Number of operations to issue."},
         {"reqsPerIssue",            "(uint) Maximum number of requests to issue at a time", "1"},
+        {"fixedReqsPerIssue",       "(bool) Issue reqsPerIssue requests every time the CPU issues instead of a random number up to reqsPerIssue", "false"},
+        {"footprint",               "(UnitAlgebra/string) Confine addresses to the first 'footprint' bytes of memory. 0B means all of memSize.", "0B"},
+        {"stride",                  "(uint) Walk the footprint sequentially in steps of 'stride' bytes instead of picking random addresses. 0 means random.", "0"},
+        {"locality",                "(uint) Percent of random addresses that fall in the same 'locality_range' block as the previous address", "0"},
+        {"locality_range",          "(UnitAlgebra/string) Size of the block that 'locality' keeps addresses in", "4KiB"},
         {"write_freq",              "(uint) Relative write frequency", "25"},
         {"read_freq",               "(uint) Relative read frequency", "75"},
         {"flush_freq",              "(uint) Relative flush frequency", "0"},
@@ -106,6 +112,13 @@ private:
     unsigned llsc_mark;
     unsigned mmio_mark;
     uint32_t maxReqsPerIssue;
+    bool fixedReqsPerIssue;
+    uint64_t footprint;
+    uint64_t stride;
+    uint64_t strideAddr;
+    uint32_t locality;
+    uint64_t localityRange;
+    Interfaces::StandardMem::Addr lastAddr;
     uint64_t noncacheableRangeStart, noncacheableRangeEnd, noncacheableSize;
     uint64_t clock_ticks;
     Statistic<uint64_t>* requestsPendingCycle;
@@ -122,7 +135,12 @@ private:
     bool ll_issued;
     Interfaces::StandardMem::Addr ll_addr;
 
-    std::map<Interfaces::StandardMem::Request::id_t, std::pair<SimTime_t, std::string>> requests;
+    struct OutstandingReq {
+        OutstandingReq() : issueTime(0), storeConditional(false) { }
+        SimTime_t issueTime;
+        bool storeConditional;
+    };
+    FlatHashMap<Interfaces::StandardMem::Request::id_t, OutstandingReq, IdHash> requests;
 
     Interfaces::StandardMem *memory;
 
@@ -131,6 +149,9 @@ private:
     TimeConverter *clockTC;
     Clock::HandlerBase *clockHandler;
 
+    /* Apply the configured access pattern to a random address */
+    Interfaces::StandardMem::Addr nextAddress(Interfaces::StandardMem::Addr addr);
+
     /* Functions for creating the requests tested by this CPU */
     Interfaces::StandardMem::Request* createWrite(uint64_t addr);
     Interfaces::StandardMem::Request* createRead(Addr addr);
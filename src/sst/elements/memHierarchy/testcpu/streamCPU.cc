@@ -52,6 +52,17 @@ streamCPU::streamCPU(ComponentId_t id, Params& params) :
     if (maxReqsPerIssue < 1) {
         out.fatal(CALL_INFO, -1, "Cannot issue less than one request per cycle...fix your input deck\n");
     }
+    fixedReqsPerIssue = params.find<bool>("fixedReqsPerIssue", false);
+
+    writeInterval = params.find<uint32_t>("write_interval", 10);
+    if (writeInterval < 1) {
+        out.fatal(CALL_INFO, -1, "write_interval must be at least 1\n");
+    }
+
+    stride = params.find<uint32_t>("stride", 8);
+    if (stride < 1) {
+        out.fatal(CALL_INFO, -1, "stride must be at least 1\n");
+    }
 
     // tell the simulator not to end without us
     registerAsPrimaryComponent();
@@ -78,6 +89,13 @@ streamCPU::streamCPU(ComponentId_t id, Params& params) :
 
     // Start the next address from the offset
     nextAddr = addrOffset;
+
+    // Addresses wrap at whichever comes first, the footprint or the end of memory
+    wrapAddr = maxAddr - 4;
+    uint64_t footprint = params.find<uint64_t>("footprint", 0);
+    if (footprint != 0 && addrOffset + footprint - 1 < wrapAddr) {
+        wrapAddr = addrOffset + footprint - 1;
+    }
 }
 
 streamCPU::streamCPU() :
@@ -96,12 +114,12 @@ void streamCPU::init(unsigned int phase)
 void streamCPU::handleEvent(Interfaces::StandardMem::Request * req)
 {
 	//out.output("recv\n");
-    std::map<uint64_t, SimTime_t>::iterator i = requests.find(req->getID());
-    if (i == requests.end()) {
+    SimTime_t* i = requests.find(req->getID());
+    if (i == nullptr) {
 	out.fatal(CALL_INFO, -1, "Request ID (%" PRIx64 ") not found in outstanding requests!\n", req->getID());
     } else {
-        SimTime_t et = getCurrentSimTime() - i->second;
-        requests.erase(i);
+        SimTime_t et = getCurrentSimTime() - *i;
+        requests.erase(req->getID());
 
         out.verbose(CALL_INFO, 1, 0, "Received Response (%s), Took: %7" PRIu64 "ns, %6zu pending requests.\n",
                     req->getString().c_str(), et, requests.size());
@@ -118,13 +136,14 @@ bool streamCPU::clockTic( Cycle_t )
 	// create event
 	// x8 to prevent splitting blocks
         uint32_t reqsToSend = 1;
-        if (maxReqsPerIssue > 1) reqsToSend += rng.generateNextUInt32() % maxReqsPerIssue;
+        if (fixedReqsPerIssue) reqsToSend = maxReqsPerIssue;
+        else if (maxReqsPerIssue > 1) reqsToSend += rng.generateNextUInt32() % maxReqsPerIssue;
         if (reqsToSend > (maxOutstanding - requests.size())) reqsToSend = maxOutstanding - requests.size();
         if (reqsToSend > numLS) reqsToSend = numLS;
 
         for (int i = 0; i < reqsToSend; i++) {
 
-    	    bool doWrite = do_write && (((rng.generateNextUInt32() % 10) == 0));
+    	    bool doWrite = do_write && (((rng.generateNextUInt32() % writeInterval) == 0));
 
             Interfaces::StandardMem::Request* req;
 
@@ -140,14 +159,14 @@ bool streamCPU::clockTic( Cycle_t )
             }
 
             memory->send(req);
-            requests.insert(std::make_pair(req->getID(), getCurrentSimTime()));
+            requests[req->getID()] = getCurrentSimTime();
 
 	    out.verbose(CALL_INFO, 1, 0, "Issued request %10d: %5s for address %20d.\n", numLS, (doWrite ? "write" : "read"), nextAddr);
 
 	    num_reads_issued++;
-            nextAddr = (nextAddr + 8);
+            nextAddr = (nextAddr + stride);
 
-            if (nextAddr > (maxAddr - 4)) {
+            if (nextAddr > wrapAddr) {
 		nextAddr = addrOffset;
 	    }
 
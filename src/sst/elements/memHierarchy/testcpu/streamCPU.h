@@ -31,6 +31,7 @@
 #include <sst/core/interfaces/stdMem.h>
 #include <sst/core/rng/marsaglia.h>
 #include "memEvent.h"
+#include "sst/elements/memHierarchy/flatHashMap.h"
 
 namespace SST {
 namespace MemHierarchy {
@@ -51,7 +52,11 @@ public:
             {"maxOutstanding",          "(uint) Maximum Number of Outstanding memory requests.", "10"},
             {"num_loadstore",           "(int) Stop after this many reads and writes.", "-1"},
             {"reqsPerIssue",            "(uint) Maximum number of requests to issue at a time", "1"},
+            {"fixedReqsPerIssue",       "(bool) Issue reqsPerIssue requests every time the CPU issues instead of a random number up to reqsPerIssue", "false"},
             {"do_write",                "(bool) Enable writes to memory (versus just reads).", "1"},
+            {"write_interval",          "(uint) If do_write is set, on average one request in this many is a write", "10"},
+            {"stride",                  "(uint) Bytes between consecutive addresses", "8"},
+            {"footprint",               "(uint) Wrap back to addressoffset after this many bytes. 0 means wrap at the end of memory.", "0"},
             {"do_flush",                "(bool) Enable flushes", "0"},
             {"noncacheableRangeStart",  "(uint) Beginning of range of addresses that are noncacheable.", "0x0"},
             {"noncacheableRangeEnd",    "(uint) End of range of addresses that are noncacheable.", "0x0"},
@@ -84,11 +89,15 @@ private:
     uint32_t maxAddr;
     uint32_t maxOutstanding;
     uint32_t maxReqsPerIssue;
+    bool fixedReqsPerIssue;
+    uint32_t writeInterval;
+    uint32_t stride;
+    uint64_t wrapAddr;
     uint32_t nextAddr;
     uint64_t num_reads_issued, num_reads_returned;
     uint64_t addrOffset;
 
-    std::map<uint64_t, SimTime_t> requests;
+    FlatHashMap<uint64_t, SimTime_t, IdHash> requests;
 
     Interfaces::StandardMem * memory;
 
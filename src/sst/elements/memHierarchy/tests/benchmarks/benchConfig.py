@@ -0,0 +1,257 @@
+# Canonical memHierarchy configurations for measuring simulator (host) throughput
+#
+# Run via runBenchmarks.py or directly:
+#   sst benchConfig.py --model-options="--scenario=mesi3 --ops=100000"
+#
+# Scenarios:
+#   l1     - standardCPU -> L1 -> simpleMem
+#   mesi3  - 4x (standardCPU -> L1 -> L2) -> bus -> shared L3 -> timingDRAM
+#   dir64  - 64x (standardCPU -> L1) -> router -> 4 directories -> simpleDRAM
+#   dram   - Miranda STREAM -> L1 -> memController with the selected DRAM backend
+#            (--backend=simpleDRAM|timingDRAM|reorderFRFCFS|hbm)
+#   gups   - 8x (Miranda GUPS -> L1) -> bus -> memController with an HBM-like timingDRAM
+#            (8 channels, 16 banks each)
+#
+# Statistics are limited to the CPU request counters so statistic collection does not
+# dominate the measurement
+import argparse
+import sys
+import sst
+
+parser = argparse.ArgumentParser()
+parser.add_argument("--scenario", default="l1", choices=["l1", "mesi3", "dir64", "dram", "gups"])
+parser.add_argument("--ops", type=int, default=100000, help="Memory operations per CPU (standardCPU) or STREAM elements (Miranda)")
+parser.add_argument("--cores", type=int, default=0, help="Override the scenario's core count")
+parser.add_argument("--backend", default="timingDRAM", choices=["simpleDRAM", "timingDRAM", "reorderFRFCFS", "hbm"])
+parser.add_argument("--stats", default="benchStats.csv", help="CSV file for the CPU request statistics")
+args = parser.parse_args(sys.argv[1:])
+
+clock = "2GHz"
+
+def cpu(name, seed):
+    comp = sst.Component(name, "memHierarchy.standardCPU")
+    comp.addParams({
+        "memFreq" : 1,
+        "memSize" : "256MiB",
+        "verbose" : 0,
+        "clock" : clock,
+        "rngseed" : seed,
+        "maxOutstanding" : 16,
+        "opCount" : args.ops,
+        "reqsPerIssue" : 2,
+        "write_freq" : 40,
+        "read_freq" : 60,
+    })
+    comp.enableStatistics(["reads", "writes"])
+    iface = comp.setSubComponent("memory", "memHierarchy.standardInterface")
+    return iface
+
+def cache(name, size, assoc, latency, l1=False):
+    comp = sst.Component(name, "memHierarchy.Cache")
+    comp.addParams({
+        "cache_frequency" : clock,
+        "coherence_protocol" : "MESI",
+        "replacement_policy" : "lru",
+        "cache_size" : size,
+        "associativity" : assoc,
+        "cache_line_size" : 64,
+        "access_latency_cycles" : latency,
+        "mshr_num_entries" : 32,
+        "L1" : 1 if l1 else 0,
+    })
+    return comp
+
+def memory(name, backend, mem_size="256MiB", extra=None):
+    memctrl = sst.Component(name, "memHierarchy.MemController")
+    memctrl.addParams({ "clock" : "1GHz", "backing" : "none", "addr_range_end" : 256*1024*1024 - 1 })
+    if extra:
+        memctrl.addParams(extra)
+
+    if backend == "simpleMem":
+        mem = memctrl.setSubComponent("backend", "memHierarchy.simpleMem")
+        mem.addParams({ "access_time" : "50ns", "mem_size" : mem_size })
+    elif backend == "simpleDRAM" or backend == "reorderFRFCFS":
+        if backend == "reorderFRFCFS":
+            reorder = memctrl.setSubComponent("backend", "memHierarchy.reorderFRFCFS")
+            reorder.addParams({ "mem_size" : mem_size, "banks" : 8, "row_size" : "4KiB" })
+            mem = reorder.setSubComponent("backend", "memHierarchy.simpleDRAM")
+        else:
+            mem = memctrl.setSubComponent("backend", "memHierarchy.simpleDRAM")
+        mem.addParams({
+            "mem_size" : mem_size,
+            "tCAS" : 3,
+            "tRCD" : 3,
+            "tRP" : 3,
+            "cycle_time" : "1ns",
+            "banks" : 8,
+            "row_size" : "4KiB",
+            "row_policy" : "open",
+        })
+    elif backend == "hbm":
+        # HBM2-like stack: many narrow channels, short bursts, closed pages
+        mem = memctrl.setSubComponent("backend", "memHierarchy.timingDRAM")
+        mem.addParams({
+            "id" : 0,
+            "addrMapper" : "memHierarchy.roundRobinAddrMapper",
+            "addrMapper.interleave_size" : "64B",
+            "addrMapper.row_size" : "1KiB",
+            "clock" : "1GHz",
+            "mem_size" : mem_size,
+            "channels" : 8,
+            "channel.numRanks" : 1,
+            "channel.rank.numBanks" : 16,
+            "channel.transaction_Q_size" : 64,
+            "channel.rank.bank.CL" : 14,
+            "channel.rank.bank.CL_WR" : 4,
+            "channel.rank.bank.RCD" : 14,
+            "channel.rank.bank.TRP" : 14,
+            "channel.rank.bank.dataCycles" : 2,
+            "channel.rank.bank.pagePolicy" : "memHierarchy.simplePagePolicy",
+            "channel.rank.bank.transactionQ" : "memHierarchy.reorderTransactionQ",
+            "channel.rank.bank.pagePolicy.close" : 1,
+        })
+    else:
+        mem = memctrl.setSubComponent("backend", "memHierarchy.timingDRAM")
+        mem.addParams({
+            "id" : 0,
+            "addrMapper" : "memHierarchy.roundRobinAddrMapper",
+            "addrMapper.interleave_size" : "64B",
+            "addrMapper.row_size" : "1KiB",
+            "clock" : "1.2GHz",
+            "mem_size" : mem_size,
+            "channels" : 2,
+            "channel.numRanks" : 2,
+            "channel.rank.numBanks" : 8,
+            "channel.transaction_Q_size" : 32,
+            "channel.rank.bank.CL" : 14,
+            "channel.rank.bank.CL_WR" : 12,
+            "channel.rank.bank.RCD" : 14,
+            "channel.rank.bank.TRP" : 14,
+            "channel.rank.bank.dataCycles" : 2,
+            "channel.rank.bank.pagePolicy" : "memHierarchy.simplePagePolicy",
+            "channel.rank.bank.transactionQ" : "memHierarchy.reorderTransactionQ",
+            "channel.rank.bank.pagePolicy.close" : 0,
+        })
+    return memctrl
+
+def link(name, a, b, latency="1ns"):
+    sst.Link(name).connect( (a[0], a[1], latency), (b[0], b[1], latency) )
+
+
+if args.scenario == "l1":
+    cores = args.cores or 1
+    bus = sst.Component("bus", "memHierarchy.Bus") if cores > 1 else None
+    if bus:
+        bus.addParams({ "bus_frequency" : clock })
+    for i in range(cores):
+        iface = cpu("core%d" % i, 101 + 2 * i)
+        l1 = cache("l1cache%d" % i, "32KiB", 8, 2, True)
+        link("link_cpu_l1_%d" % i, (iface, "port"), (l1, "high_network_0"))
+        if bus:
+            link("link_l1_bus_%d" % i, (l1, "low_network_0"), (bus, "high_network_%d" % i))
+        else:
+            mem = memory("memory", "simpleMem")
+            link("link_l1_mem", (l1, "low_network_0"), (mem, "direct_link"))
+    if bus:
+        mem = memory("memory", "simpleMem")
+        link("link_bus_mem", (bus, "low_network_0"), (mem, "direct_link"))
+
+elif args.scenario == "mesi3":
+    cores = args.cores or 4
+    bus = sst.Component("bus", "memHierarchy.Bus")
+    bus.addParams({ "bus_frequency" : clock })
+    for i in range(cores):
+        iface = cpu("core%d" % i, 101 + 2 * i)
+        l1 = cache("l1cache%d" % i, "16KiB", 4, 2, True)
+        l2 = cache("l2cache%d" % i, "128KiB", 8, 8)
+        link("link_cpu_l1_%d" % i, (iface, "port"), (l1, "high_network_0"))
+        link("link_l1_l2_%d" % i, (l1, "low_network_0"), (l2, "high_network_0"))
+        link("link_l2_bus_%d" % i, (l2, "low_network_0"), (bus, "high_network_%d" % i))
+    l3 = cache("l3cache", "2MiB", 16, 20)
+    link("link_bus_l3", (bus, "low_network_0"), (l3, "high_network_0"))
+    mem = memory("memory", "timingDRAM")
+    link("link_l3_mem", (l3, "low_network_0"), (mem, "direct_link"))
+
+elif args.scenario == "dir64":
+    cores = args.cores or 64
+    dirs = 4
+    network = sst.Component("network", "merlin.hr_router")
+    network.addParams({
+        "id" : 0,
+        "num_ports" : cores + dirs,
+        "xbar_bw" : "50GB/s",
+        "link_bw" : "50GB/s",
+        "flit_size" : "36B",
+        "input_buf_size" : "2KiB",
+        "output_buf_size" : "2KiB",
+    })
+    network.setSubComponent("topology", "merlin.singlerouter")
+
+    for i in range(cores):
+        iface = cpu("core%d" % i, 101 + 2 * i)
+        l1 = cache("l1cache%d" % i, "16KiB", 4, 2, True)
+        l1cpu = l1.setSubComponent("cpulink", "memHierarchy.MemLink")
+        l1nic = l1.setSubComponent("memlink", "memHierarchy.MemNIC")
+        l1nic.addParams({ "group" : 1, "network_bw" : "50GB/s" })
+        link("link_cpu_l1_%d" % i, (iface, "port"), (l1cpu, "port"))
+        link("link_l1_net_%d" % i, (l1nic, "port"), (network, "port%d" % i), "100ps")
+
+    for i in range(dirs):
+        region = {
+            "interleave_size" : "64B",
+            "interleave_step" : str(dirs * 64) + "B",
+            "addr_range_start" : i * 64,
+            "addr_range_end" : 256*1024*1024 - ((dirs - i) * 64) + 63,
+        }
+        dirctrl = sst.Component("directory%d" % i, "memHierarchy.DirectoryController")
+        dirctrl.addParams({ "clock" : "1GHz", "coherence_protocol" : "MESI", "entry_cache_size" : 32768 })
+        dirctrl.addParams(region)
+        dirnic = dirctrl.setSubComponent("cpulink", "memHierarchy.MemNIC")
+        dirnic.addParams({ "group" : 2, "network_bw" : "50GB/s" })
+        dirmem = dirctrl.setSubComponent("memlink", "memHierarchy.MemLink")
+        mem = memory("memory%d" % i, "simpleDRAM", "64MiB", region)
+        memlink = mem.setSubComponent("cpulink", "memHierarchy.MemLink")
+        link("link_dir_net_%d" % i, (dirnic, "port"), (network, "port%d" % (cores + i)), "100ps")
+        link("link_dir_mem_%d" % i, (dirmem, "port"), (memlink, "port"))
+
+elif args.scenario == "dram":
+    cpu0 = sst.Component("core0", "miranda.BaseCPU")
+    cpu0.addParams({ "verbose" : 0, "clock" : clock, "max_reqs_cycle" : 2, "maxmemreqpending" : 16 })
+    cpu0.enableStatistics(["read_reqs", "write_reqs"])
+    gen = cpu0.setSubComponent("generator", "miranda.STREAMBenchGenerator")
+    gen.addParams({
+        "n" : args.ops,
+        "operandwidth" : 8,
+        "start_a" : 0,
+        "start_b" : args.ops * 8,
+        "start_c" : args.ops * 16,
+    })
+    l1 = cache("l1cache", "32KiB", 8, 2, True)
+    mem = memory("memory", args.backend)
+    link("link_cpu_l1", (cpu0, "cache_link"), (l1, "high_network_0"))
+    link("link_l1_mem", (l1, "low_network_0"), (mem, "direct_link"))
+
+elif args.scenario == "gups":
+    cores = args.cores or 8
+    bus = sst.Component("bus", "memHierarchy.Bus")
+    bus.addParams({ "bus_frequency" : clock })
+    for i in range(cores):
+        cpu0 = sst.Component("core%d" % i, "miranda.BaseCPU")
+        cpu0.addParams({ "verbose" : 0, "clock" : clock, "max_reqs_cycle" : 2, "maxmemreqpending" : 32 })
+        cpu0.enableStatistics(["read_reqs", "write_reqs"])
+        gen = cpu0.setSubComponent("generator", "miranda.GUPSGenerator")
+        gen.addParams({
+            "count" : args.ops,
+            "length" : 8,
+            "max_address" : 256*1024*1024,
+            "seed_a" : 11 + 2 * i,
+            "seed_b" : 31 + 2 * i,
+        })
+        l1 = cache("l1cache%d" % i, "32KiB", 8, 2, True)
+        link("link_cpu_l1_%d" % i, (cpu0, "cache_link"), (l1, "high_network_0"))
+        link("link_l1_bus_%d" % i, (l1, "low_network_0"), (bus, "high_network_%d" % i))
+    mem = memory("memory", "hbm")
+    link("link_bus_mem", (bus, "low_network_0"), (mem, "direct_link"))
+
+sst.setStatisticLoadLevel(1)
+sst.setStatisticOutput("sst.statOutputCSV", { "filepath" : args.stats, "separator" : "," })
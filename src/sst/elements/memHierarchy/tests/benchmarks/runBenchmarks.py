@@ -0,0 +1,168 @@
+#!/usr/bin/env python3
+#
+# Measure the host-side throughput of the memHierarchy benchmark configurations
+# in benchConfig.py and report it as JSON
+#
+# For each benchmark this reports:
+#   wall_seconds       - host wall-clock time of the sst run
+#   cpu_seconds        - host user + system time of the sst run
+#   events             - events delivered by the simulator, if --print-timing-info reports them
+#   events_per_second  - events / wall_seconds
+#   mem_ops            - memory operations issued by the CPUs (from the CPU statistics)
+#   mem_ops_per_second - mem_ops / wall_seconds
+#   ns_per_mem_op      - host nanoseconds per simulated memory operation
+#   peak_rss_kb        - peak resident set size of the sst process
+#
+# Usage:
+#   runBenchmarks.py [--sst sst] [--ops N] [--repeat R] [--only l1,dram-timingDRAM] [--output results.json]
+#
+# Compare two result files with:
+#   runBenchmarks.py --compare old.json new.json
+import argparse
+import csv
+import json
+import os
+import platform
+import re
+import subprocess
+import sys
+import tempfile
+import time
+
+BENCHMARKS = [
+    # name,                 model options
+    ("l1",                  ["--scenario=l1"]),
+    ("mesi3",               ["--scenario=mesi3"]),
+    ("dir64",               ["--scenario=dir64"]),
+    ("dram-simpleDRAM",     ["--scenario=dram", "--backend=simpleDRAM"]),
+    ("dram-timingDRAM",     ["--scenario=dram", "--backend=timingDRAM"]),
+    ("dram-reorderFRFCFS",  ["--scenario=dram", "--backend=reorderFRFCFS"]),
+    ("dram-hbm",            ["--scenario=dram", "--backend=hbm"]),
+    ("gups",                ["--scenario=gups"]),
+]
+
+# Per-benchmark op count scaling so each run takes a comparable amount of host time
+OP_SCALE = { "dir64" : 0.125, "gups" : 0.25 }
+
+MEM_OP_STATS = [ "reads", "writes", "read_reqs", "write_reqs" ]
+
+def count_mem_ops(stats_file):
+    ops = 0
+    with open(stats_file) as f:
+        for row in csv.DictReader(f, skipinitialspace=True):
+            if row.get("StatisticName") in MEM_OP_STATS:
+                ops += int(row.get("Sum.u64", 0) or 0)
+    return ops
+
+def parse_timing_info(output):
+    # Event counts are only reported by sst-core versions that track them
+    info = {}
+    match = re.search(r"^\s*(?:Total |Global )?[Ee]vents(?: processed| executed| delivered)?:\s*([0-9]+)\s*$", output, re.MULTILINE)
+    if match:
+        info["events"] = int(match.group(1))
+    return info
+
+def run_benchmark(sst, config, name, options, ops, workdir):
+    stats_file = os.path.join(workdir, name + ".csv")
+    log_file = os.path.join(workdir, name + ".log")
+    model_options = options + ["--ops=%d" % max(1, int(ops * OP_SCALE.get(name, 1))), "--stats=" + stats_file]
+    cmd = [sst, "--print-timing-info", config, "--model-options=" + " ".join(model_options)]
+
+    # wait4() gives the resource usage of this run alone, RUSAGE_CHILDREN would report
+    # the maximum RSS over every run so far
+    with open(log_file, "w") as log:
+        start = time.perf_counter()
+        proc = subprocess.Popen(cmd, stdout=log, stderr=subprocess.STDOUT, cwd=workdir)
+        _, status, usage = os.wait4(proc.pid, 0)
+        wall = time.perf_counter() - start
+        proc.returncode = os.waitstatus_to_exitcode(status) if hasattr(os, "waitstatus_to_exitcode") else status
+    with open(log_file) as log:
+        output = log.read()
+
+    if proc.returncode != 0:
+        sys.stderr.write("Benchmark '%s' failed (%d):\n%s\n" % (name, proc.returncode, output))
+        return { "name" : name, "error" : proc.returncode }
+
+    result = {
+        "name" : name,
+        "wall_seconds" : wall,
+        "cpu_seconds" : usage.ru_utime + usage.ru_stime,
+        "peak_rss_kb" : usage.ru_maxrss,    # KiB on Linux
+    }
+    result.update(parse_timing_info(output))
+    if "events" in result:
+        result["events_per_second"] = result["events"] / wall
+
+    result["mem_ops"] = count_mem_ops(stats_file)
+    if result["mem_ops"]:
+        result["mem_ops_per_second"] = result["mem_ops"] / wall
+        result["ns_per_mem_op"] = wall * 1e9 / result["mem_ops"]
+    return result
+
+def best_of(results):
+    ok = [r for r in results if "error" not in r]
+    if not ok:
+        return results[0]
+    best = dict(min(ok, key=lambda r: r["wall_seconds"]))
+    best["repeats"] = len(results)
+    best["peak_rss_kb"] = max(r["peak_rss_kb"] for r in ok)
+    return best
+
+def compare(old_file, new_file, threshold):
+    with open(old_file) as f:
+        old = { r["name"] : r for r in json.load(f)["benchmarks"] }
+    with open(new_file) as f:
+        new = { r["name"] : r for r in json.load(f)["benchmarks"] }
+
+    regressed = False
+    print("%-22s %14s %14s %8s" % ("benchmark", "old ns/op", "new ns/op", "change"))
+    for name in sorted(set(old) & set(new)):
+        if "ns_per_mem_op" not in old[name] or "ns_per_mem_op" not in new[name]:
+            continue
+        change = new[name]["ns_per_mem_op"] / old[name]["ns_per_mem_op"] - 1
+        flag = " *" if change > threshold else ""
+        regressed = regressed or change > threshold
+        print("%-22s %14.1f %14.1f %+7.1f%%%s" % (name, old[name]["ns_per_mem_op"], new[name]["ns_per_mem_op"], change * 100, flag))
+    return 1 if regressed else 0
+
+def main():
+    parser = argparse.ArgumentParser(description="memHierarchy host throughput benchmarks")
+    parser.add_argument("--sst", default="sst", help="sst executable")
+    parser.add_argument("--ops", type=int, default=100000, help="Memory operations per CPU (scaled down for large configurations)")
+    parser.add_argument("--repeat", type=int, default=3, help="Runs per benchmark, the fastest is reported")
+    parser.add_argument("--only", default="", help="Comma-separated list of benchmarks to run")
+    parser.add_argument("--output", default="", help="JSON output file (default: stdout)")
+    parser.add_argument("--compare", nargs=2, metavar=("OLD", "NEW"), help="Compare two result files instead of running")
+    parser.add_argument("--threshold", type=float, default=0.05, help="Relative ns/op increase reported as a regression by --compare")
+    args = parser.parse_args()
+
+    if args.compare:
+        return compare(args.compare[0], args.compare[1], args.threshold)
+
+    config = os.path.join(os.path.dirname(os.path.abspath(__file__)), "benchConfig.py")
+    selected = [b for b in BENCHMARKS if not args.only or b[0] in args.only.split(",")]
+
+    results = []
+    with tempfile.TemporaryDirectory() as workdir:
+        for name, options in selected:
+            sys.stderr.write("Running %s\n" % name)
+            runs = [run_benchmark(args.sst, config, name, options, args.ops, workdir) for _ in range(args.repeat)]
+            results.append(best_of(runs))
+
+    report = {
+        "host" : platform.node(),
+        "platform" : platform.platform(),
+        "timestamp" : time.strftime("%Y-%m-%dT%H:%M:%S"),
+        "ops" : args.ops,
+        "benchmarks" : results,
+    }
+    text = json.dumps(report, indent=2, sort_keys=True)
+    if args.output:
+        with open(args.output, "w") as f:
+            f.write(text + "\n")
+    else:
+        print(text)
+    return 1 if any("error" in r for r in results) else 0
+
+if __name__ == "__main__":
+    sys.exit(main())
@@ -34,9 +34,11 @@ componentlist = (
     "memHierarchy.hash.linear",
     "memHierarchy.hash.none",
     "memHierarchy.hash.xor",
+    "memHierarchy.hash.xorMatrix",
     "memHierarchy.memInterface",
     "memHierarchy.networkMemoryInspector",
     "memHierarchy.reorderByRow",
+    "memHierarchy.reorderFRFCFS",
     "memHierarchy.reorderSimple",
     "memHierarchy.reorderTransactionQ",
     "memHierarchy.replacement.lfu",
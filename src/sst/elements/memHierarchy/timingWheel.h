@@ -0,0 +1,123 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef MEMHIERARCHY_TIMINGWHEEL_H
+#define MEMHIERARCHY_TIMINGWHEEL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <map>
+#include <utility>
+#include <vector>
+
+namespace SST { namespace MemHierarchy {
+
+/*
+ * Calendar queue for events delayed by a small number of cycles
+ *
+ * Drop-in replacement for a std::multimap<uint64_t, T> that is drained every cycle: entries
+ * come out in time order, and entries with the same time come out in insertion order.
+ * Entries within 'slots' cycles of the last drained cycle go into a ring of per-cycle buckets.
+ * Entries further out wait in an overflow map and move into the ring as it advances.
+ * Entries for a cycle that has already been drained are sent first on the next drain,
+ * which is where a multimap would have sorted them.
+ */
+template <class T>
+class TimingWheel {
+public:
+    TimingWheel(size_t slots = 64) {
+        size_t n = 1;
+        while (n < slots) n <<= 1;
+        buckets_.resize(n);
+        mask_ = n - 1;
+        current_ = 0;
+        size_ = 0;
+        ringSize_ = 0;
+    }
+
+    void insert(uint64_t time, const T& entry) {
+        size_++;
+        if (time <= current_) {
+            // Keep late entries sorted by time, FIFO within a time
+            typename std::vector<std::pair<uint64_t,T> >::iterator it = late_.end();
+            while (it != late_.begin() && (it - 1)->first > time)
+                it--;
+            late_.insert(it, std::make_pair(time, entry));
+        } else if (time - current_ <= mask_ + 1) {
+            buckets_[time & mask_].push_back(entry);
+            ringSize_++;
+        } else {
+            overflow_.insert(std::make_pair(time, entry));
+        }
+    }
+
+    size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+
+    /* Call handler(entry) on every entry with a time <= now, in order.
+     * The handler must not insert into this wheel.
+     */
+    template <class F>
+    void drain(uint64_t now, F handler) {
+        if (now < current_)
+            return;
+        for (size_t i = 0; i < late_.size(); i++)
+            handler(late_[i].second);
+        size_ -= late_.size();
+        late_.clear();
+
+        while (current_ < now) {
+            if (ringSize_ == 0) {
+                // Skip empty cycles, e.g., after the owner's clock was off
+                uint64_t next = overflow_.empty() ? now : overflow_.begin()->first - (mask_ + 1);
+                current_ = next < now ? next : now;
+                refill();
+                continue;
+            }
+            current_++;
+            std::vector<T>& bucket = buckets_[current_ & mask_];
+            for (size_t i = 0; i < bucket.size(); i++)
+                handler(bucket[i]);
+            size_ -= bucket.size();
+            ringSize_ -= bucket.size();
+            bucket.clear();
+            refill();
+        }
+    }
+
+private:
+    /* Move overflow entries that are now within the ring into it.
+     * The bucket for current_ has been drained and holds the cycle at the far end of the ring.
+     */
+    void refill() {
+        while (!overflow_.empty() && overflow_.begin()->first - current_ <= mask_ + 1) {
+            buckets_[overflow_.begin()->first & mask_].push_back(overflow_.begin()->second);
+            overflow_.erase(overflow_.begin());
+            ringSize_++;
+        }
+    }
+
+    std::vector<std::vector<T> > buckets_;
+    std::vector<std::pair<uint64_t,T> > late_;
+    std::multimap<uint64_t,T> overflow_;
+    uint64_t mask_;
+    uint64_t current_;  // Last cycle drained
+    size_t size_;
+    size_t ringSize_;   // Entries in buckets_
+};
+
+}}
+
+#endif
@@ -79,14 +79,14 @@ inline void fixByteUnits(std::string &unitstr) {
     }
 }
 
-inline int log2Of(int x){
-    int temp = x;
+inline int log2Of(uint64_t x){
+    uint64_t temp = x;
     int result = 0;
     while(temp >>= 1) result++;
     return result;
 }
 
-inline bool isPowerOfTwo(unsigned int x) {
+inline bool isPowerOfTwo(uint64_t x) {
     return !(x & (x-1));
 }
 
@@ -0,0 +1,86 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef MEMHIERARCHY_XORHASHMATRIX_H
+#define MEMHIERARCHY_XORHASHMATRIX_H
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace SST { namespace MemHierarchy {
+
+/*
+ * Linear (XOR) hash over GF(2), e.g., for set indices or channel/rank/bank selection
+ *
+ * Output bit i is the parity of the input bits selected by mask i. Bits with no mask
+ * pass through unchanged. compile() folds the masks into one lookup table per input
+ * byte so applying the hash is eight table lookups regardless of the number of masks.
+ */
+class XorHashMatrix {
+public:
+    XorHashMatrix() : compiled_(false) {
+        for (unsigned i = 0; i < 64; i++)
+            masks_[i] = (uint64_t)1 << i;
+    }
+
+    /* Set the input bits whose parity forms output bit 'bit' */
+    void setMask(unsigned bit, uint64_t mask) {
+        masks_[bit] = mask;
+        compiled_ = false;
+    }
+
+    uint64_t getMask(unsigned bit) const { return masks_[bit]; }
+
+    /* Build the lookup tables, must be called after the last setMask() and before apply() */
+    void compile() {
+        table_.assign(8 * 256, 0);
+        for (unsigned bit = 0; bit < 64; bit++) {
+            for (unsigned byte = 0; byte < 8; byte++) {
+                uint64_t select = (masks_[bit] >> (byte * 8)) & 0xff;
+                if (!select) continue;
+                for (unsigned value = 0; value < 256; value++) {
+                    if (__builtin_parity(value & select))
+                        table_[byte * 256 + value] |= (uint64_t)1 << bit;
+                }
+            }
+        }
+        compiled_ = true;
+    }
+
+    bool isCompiled() const { return compiled_; }
+
+    uint64_t apply(uint64_t value) const {
+        const uint64_t* t = table_.data();
+        return t[         (value & 0xff)]         ^ t[256  + ((value >> 8) & 0xff)]  ^
+               t[512  + ((value >> 16) & 0xff)] ^ t[768  + ((value >> 24) & 0xff)] ^
+               t[1024 + ((value >> 32) & 0xff)] ^ t[1280 + ((value >> 40) & 0xff)] ^
+               t[1536 + ((value >> 48) & 0xff)] ^ t[1792 +  (value >> 56)];
+    }
+
+    void apply(const uint64_t* values, uint64_t* results, size_t count) const {
+        for (size_t i = 0; i < count; i++)
+            results[i] = apply(values[i]);
+    }
+
+private:
+    uint64_t masks_[64];
+    std::vector<uint64_t> table_;
+    bool compiled_;
+};
+
+}}
+
+#endif
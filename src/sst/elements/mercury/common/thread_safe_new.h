@@ -16,13 +16,15 @@
 #pragma once
 
 //#include <sst_element_config.h>
+#include <mercury/common/errors.h>
+
+#include <cstdint>
+#include <limits>
+#include <mutex>
 #include <vector>
-#include <set>
 
 #define SSTHG_TLS_OFFSET 64
 
-#define SSTHG_NEW_SUPER_DEBUG 0
-
 namespace SST {
 namespace Hg {
 
@@ -46,20 +48,26 @@ static int inline currentThreadId() {
   }
 }
 
-struct ThreadAllocatorSet {
-#define MAX_NUM_NEW_SAFE_THREADS 128
-  std::vector<char*> allocations[MAX_NUM_NEW_SAFE_THREADS];
-  std::vector<void*> available[MAX_NUM_NEW_SAFE_THREADS];
-  ~ThreadAllocatorSet(){
-    for (int i=0; i < MAX_NUM_NEW_SAFE_THREADS; ++i){
-      auto& vec = allocations[i];
-      for (char* ptr : vec){
-        delete[] ptr;
-      }
+// Chunks a host thread handed back because its free list grew too long,
+// along with every block ever allocated so they can be released at the end
+struct ThreadAllocatorDepot {
+  std::mutex lock;
+  std::vector<char*> allocations;
+  std::vector<std::vector<void*>> batches;
+  ~ThreadAllocatorDepot(){
+    for (char* ptr : allocations){
+      delete[] ptr;
     }
   }
 };
 
+/**
+ * Fixed-size allocator for one type. Every host thread allocates from and
+ * frees to its own free list, so neither takes a lock, whichever thread
+ * allocated the chunk. When one thread frees what another allocates its
+ * list keeps growing, so past 2*increment chunks it moves a batch to the
+ * shared depot, which the allocating thread refills from before it grows.
+ */
 template <class T>
 class thread_safe_new {
 
@@ -79,29 +87,27 @@ class thread_safe_new {
     return new (ptr) T(std::forward<Args>(args)...);
   }
 
-  static void* allocate(int thread){
-    if (alloc_.available[thread].empty()){
-      grow(thread);
+  /** The thread argument is kept for old callers, the calling host thread's list is used */
+  static void* allocate(int  /*thread*/){
+    std::vector<void*>& available = cache();
+    if (available.empty()){
+      refill(available);
     }
-    void* ret = alloc_.available[thread].back();
+    void* ret = available.back();
 #if SST_HG_ENABLE_SANITY_CHECK
-    (uint32_t*) casted = (uint32_t*) ret;
+    uint32_t* casted = (uint32_t*) ret;
     *casted = 0;
 #endif
-    alloc_.available[thread].pop_back();
-#if SPKT_NEW_SUPER_DEBUG
-    all_chunks_.erase(ret);
-#endif
+    available.pop_back();
     return ret;
   }
 
   static void* operator new(size_t sz){
     if (sz != sizeof(T)){
-      spkt_abort_printf("allocating mismatched sizes: %d != %d",
+      sst_hg_abort_printf("allocating mismatched sizes: %d != %d",
                         sz, sizeof(T));
     }
-    int thread = currentThreadId();
-    return allocate(thread);
+    return allocate(0);
   }
 
   static void* operator new(size_t  /*sz*/, void* ptr){
@@ -109,26 +115,22 @@ class thread_safe_new {
   }
 
   static void operator delete(void* ptr){
-    int thread = currentThreadId();
-    alloc_.available[thread].push_back(ptr);
 #if SST_HG_ENABLE_SANITY_CHECK
-    (uint32_t*) casted = (uint32_t*) ptr;
+    uint32_t* casted = (uint32_t*) ptr;
     if (*casted == magic_number){
-      spkt_abort_printf("chunk %p already freed!", ptr);
+      sst_hg_abort_printf("chunk %p already freed!", ptr);
     }
     *casted = magic_number;
 #endif
-#if SPKT_NEW_SUPER_DEBUG
-    auto iter = all_chunks_.find(ptr);
-    if (iter != all_chunks_.end()){
-      spkt_abort_printf("freeing chunk twice-in-a-row: %p", ptr);
+    std::vector<void*>& available = cache();
+    available.push_back(ptr);
+    if (available.size() >= 2*increment){
+      release(available);
     }
-    all_chunks_.insert(ptr);
-#endif
   }
 
 #define SST_HG_CACHE_ALIGNMENT 64
-  static void grow(int thread){
+  static void grow(std::vector<void*>& available){
     size_t unitSize = sizeof(T);
     if (unitSize % SST_HG_CACHE_ALIGNMENT != 0){
       size_t rem = SST_HG_CACHE_ALIGNMENT - unitSize % SST_HG_CACHE_ALIGNMENT;
@@ -144,20 +146,36 @@ class thread_safe_new {
       numElems -= 1;
     }
     for (int i=0; i < numElems; ++i, ptr += unitSize){
-      alloc_.available[thread].push_back(ptr);
-#if SPKT_NEW_SUPER_DEBUG
-      all_chunks_.insert(ptr);
-#endif
+      available.push_back(ptr);
     }
-    alloc_.allocations[thread].push_back(newTs);
+    depot_.allocations.push_back(newTs);
   }
 
  private:
-  static ThreadAllocatorSet alloc_;
+  static std::vector<void*>& cache(){
+    static thread_local std::vector<void*> available;
+    return available;
+  }
+
+  static void refill(std::vector<void*>& available){
+    std::lock_guard<std::mutex> guard(depot_.lock);
+    if (depot_.batches.empty()){
+      grow(available);
+    } else {
+      available.swap(depot_.batches.back());
+      depot_.batches.pop_back();
+    }
+  }
+
+  static void release(std::vector<void*>& available){
+    std::vector<void*> batch(available.end() - increment, available.end());
+    available.resize(available.size() - increment);
+    std::lock_guard<std::mutex> guard(depot_.lock);
+    depot_.batches.push_back(std::move(batch));
+  }
+
+  static ThreadAllocatorDepot depot_;
   static int constexpr increment = 512;
-#if SPKT_NEW_SUPER_DEBUG
-  static std::set<void*> all_chunks_;
-#endif
 
 #else
   //no custom new operators
@@ -173,12 +191,7 @@ class thread_safe_new {
 };
 
 #if SST_HG_CUSTOM_NEW
-template <class T> ThreadAllocatorSet thread_safe_new<T>::alloc_;
-
-#if SPKT_NEW_SUPER_DEBUG
-template <class T> std::set<void*> thread_safe_new<T>::all_chunks_;
-#endif
-
+template <class T> ThreadAllocatorDepot thread_safe_new<T>::depot_;
 #endif
 
 } // end namespace Hg
@@ -119,6 +119,8 @@ OperatingSystem::OperatingSystem(SST::ComponentId_t id, SST::Params& params, Nod
         "hg", params.find<std::string>("compute_scheduler", "simple"),
         params, this, node_ ? node_->ncores() : 1, node_ ? node_->nsockets() : 1);
 
+  roofline_ = new RooflineComputeModel(params);
+
   StackAlloc::init(params);
   initThreading(params);
 }
@@ -139,6 +141,7 @@ OperatingSystem::~OperatingSystem()
     delete des_context_;
   }
   if (compute_sched_) delete compute_sched_;
+  delete roofline_;
 }
 
 void
@@ -32,6 +32,7 @@
 #include <mercury/operating_system/process/mutex.h>
 #include <mercury/operating_system/process/tls.h>
 #include <mercury/operating_system/process/compute_scheduler.h>
+#include <mercury/operating_system/process/roofline_compute_model.h>
 #include <mercury/operating_system/libraries/library.h>
 #include <mercury/hardware/network/network_message.h>
 
@@ -164,6 +165,7 @@ public:
   AppLauncher* app_launcher_;
   std::map<uint32_t, Thread*> running_threads_;
   ComputeScheduler* compute_sched_;
+  RooflineComputeModel* roofline_;
 
   std::unordered_map<std::string, Library*> libs_;
   std::unordered_map<Library*, int> lib_refcounts_;
@@ -239,6 +241,10 @@ public:
     compute_sched_->releaseCores(ncore,thr);
   }
 
+  RooflineComputeModel* roofline() const {
+    return roofline_;
+  }
+
 //  NodeId rankToNode(int rank) {
 //    return NodeId( rank_mapper_->mapRank(rank) );
 //  }
@@ -46,6 +46,7 @@
 #include <mercury/components/operating_system.h>
 #include <inttypes.h>
 #include <dlfcn.h>
+#include <sstream>
 
 //static sprockit::NeedDeletestatics<sstmac::sw::UserAppCxxFullMain> del_app_statics;
 
@@ -62,6 +63,17 @@
 
 void sst_hg_app_loaded(int /*aid*/){}
 
+extern "C" void sst_hg_compute_detailed(uint64_t nflops, uint64_t nintops, uint64_t bytes){
+  SST::Hg::OperatingSystem::currentThread()->parentApp()
+    ->computeDetailed(nflops, nintops, bytes);
+}
+
+extern "C" void sst_hg_compute_detailed_nthr(uint64_t nflops, uint64_t nintops, uint64_t bytes,
+                                        int nthread){
+  SST::Hg::OperatingSystem::currentThread()->parentApp()
+    ->computeDetailed(nflops, nintops, bytes, nthread);
+}
+
 extern "C" FILE* sst_hg_stdout(){
   return SST::Hg::Thread::current()->parentApp()->stdOutFile();
 }
@@ -164,6 +176,10 @@ App::dlopenCheck(int aid, SST::Params& params,  bool check_name)
     apis.push_back("systemAPI:libsystemapi.so");
   }
 
+  // new mains only show up when a library is loaded
+  static bool mains_aliased = false;
+  bool loaded = false;
+
   // parse apis and dlopen the libraries
   for (auto& str : apis){
     std::string name;
@@ -184,6 +200,7 @@ App::dlopenCheck(int aid, SST::Params& params,  bool check_name)
     if (entry.refcount == 0 || !entry.loaded){
       entry.handle = loadExternLibrary(file, loadExternPathStr());
       entry.loaded = true;
+      loaded = true;
     }
 
     ++entry.refcount;
@@ -200,6 +217,7 @@ App::dlopenCheck(int aid, SST::Params& params,  bool check_name)
     if (entry.refcount == 0 || !entry.loaded){
       entry.handle = loadExternLibrary(libname, loadExternPathStr());
       entry.loaded = true;
+      loaded = true;
     }
 
     if (check_name){
@@ -222,8 +240,13 @@ App::dlopenCheck(int aid, SST::Params& params,  bool check_name)
       std::cerr << "no exe in params\n";
   }
 
-  UserAppCxxEmptyMain::aliasMains();
-  UserAppCxxFullMain::aliasMains();
+  dlopen_lock.lock();
+  if (loaded || !mains_aliased){
+    UserAppCxxEmptyMain::aliasMains();
+    UserAppCxxFullMain::aliasMains();
+    mains_aliased = true;
+  }
+  dlopen_lock.unlock();
 }
 
 void
@@ -535,23 +558,18 @@ App::compute(TimeDelta time)
 //          num_loops, nflops_per_loop, nintops_per_loop, bytes_per_loop);
 //}
 
-//void
-//App::computeDetailed(uint64_t flops, uint64_t nintops, uint64_t bytes, int nthread)
-//{
-//  static const uint64_t overflow = 18006744072479883520ull;
-//  if (flops > overflow || bytes > overflow){
-//    spkt_abort_printf("flops/byte counts for compute overflowed");
-//  }
-//  if ((flops+nintops) < min_op_cutoff_){
-//    return;
-//  }
-
-//  debug_printf(sprockit::dbg::app_compute,
-//               "Rank %d for app %d: detailed compute for flops=%" PRIu64 " intops=%" PRIu64 " bytes=%" PRIu64,
-//               sid_.task_, sid_.app_, flops, nintops, bytes);
+void
+App::computeDetailed(uint64_t flops, uint64_t nintops, uint64_t bytes, int nthread)
+{
+  if ((flops+nintops) < min_op_cutoff_){
+    return;
+  }
 
-//  computeLib()->computeDetailed(flops, nintops, bytes, nthread);
-//}
+  RooflineComputeModel* roofline = os_->roofline();
+  TimeDelta time = roofline->startCompute(flops, nintops, bytes, nthread);
+  os_->blockTimeout(time);
+  roofline->endCompute(nthread);
+}
 
 //void
 //App::computeBlockRead(uint64_t bytes)
@@ -795,7 +813,11 @@ UserAppCxxFullMain::initArgv(argv_entry& entry)
   std::string appname = params_.find<std::string>("name");
   std::string argv_str = params_.find<std::string>("argv", "");
   std::deque<std::string> argv_param_dq;
-//  pst::BasicStringTokenizer::tokenize(argv_str, argv_param_dq, std::string(" "));
+  std::istringstream argv_sstr(argv_str);
+  std::string arg;
+  while (argv_sstr >> arg){
+    argv_param_dq.push_back(arg);
+  }
   int argc = argv_param_dq.size() + 1;
   char* argv_buffer = new char[256 * argc];
   char* argv_buffer_ptr = argv_buffer;
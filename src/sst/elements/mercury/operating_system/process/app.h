@@ -73,6 +73,8 @@ class App : public Thread
 
   void compute(TimeDelta time);
 
+  void computeDetailed(uint64_t flops, uint64_t intops, uint64_t bytes, int nthread = 1);
+
 //  void computeInst(ComputeEvent* cmsg);
 
 //  void computeLoop(uint64_t num_loops,
@@ -234,8 +236,6 @@ class App : public Thread
 
   char* allocateDataSegment(bool tls);
 
-  void computeDetailed(uint64_t flops, uint64_t intops, uint64_t bytes, int nthread);
-
 //  LibComputeMemmove* compute_lib_;
   std::string unique_name_;
 
@@ -16,6 +16,8 @@
 #include <mercury/common/errors.h>
 
 #include <dlfcn.h>
+#include <map>
+#include <mutex>
 #include <vector>
 #include <string>
 #include <cstring>
@@ -48,7 +50,25 @@ std::string loadExternPathStr(){
   }
 }
 
+// Libraries are never dlclosed (see unloadExternLibrary), so a library is
+// searched for and opened once per process and every later launch that
+// asks for it again gets the same handle
+static std::mutex loaded_lock;
+static std::map<std::string, void*> loaded_libs;
+
+static void* openExternLibrary(const std::string& libname, const std::string& searchPath);
+
 void* loadExternLibrary(const std::string& libname, const std::string& searchPath)
+{
+  std::lock_guard<std::mutex> guard(loaded_lock);
+  void*& handle = loaded_libs[libname + ":" + searchPath];
+  if (!handle){
+    handle = openExternLibrary(libname, searchPath);
+  }
+  return handle;
+}
+
+static void* openExternLibrary(const std::string& libname, const std::string& searchPath)
 {
   struct stat sbuf;
   int ret = stat(libname.c_str(), &sbuf);
@@ -44,6 +44,7 @@ Questions? Contact sst-macro-help@sandia.gov
 #include <mercury/operating_system/process/progress_queue.h>
 #include <mercury/operating_system/libraries/unblock_event.h>
 #include <mercury/components/operating_system.h>
+#include <mercury/common/events.h>
 
 namespace SST {
 namespace Hg {
@@ -72,6 +73,24 @@ ProgressQueue::unblock(std::list<Thread*>& q){
   os->unblock(thr);
 }
 
+void
+ProgressQueue::unblockLater(std::list<Thread*>& q, bool& pending){
+  if (pending){
+    return;
+  }
+  pending = true;
+  os->sendExecutionEventNow(newCallback(this, &ProgressQueue::unblockPending, &q, &pending));
+}
+
+void
+ProgressQueue::unblockPending(std::list<Thread*>* q, bool* pending){
+  *pending = false;
+  //the thread may have timed out in the meantime
+  if (!q->empty()){
+    unblock(*q);
+  }
+}
+
 void
 PollingQueue::block()
 {
@@ -65,6 +65,17 @@ struct ProgressQueue {
   void block(std::list<Thread*>& q, double timeout);
   void unblock(std::list<Thread*>& q);
 
+  /**
+   * Unblock the first thread of q from an event at the current time
+   * rather than right away, so everything else completing now is queued
+   * for it first. pending is set until that event runs and collapses
+   * further calls into it.
+   */
+  void unblockLater(std::list<Thread*>& q, bool& pending);
+
+ private:
+  void unblockPending(std::list<Thread*>* q, bool* pending);
+
 };
 
 template <class Item>
@@ -188,12 +199,25 @@ struct MultiProgressQueue : public ProgressQueue {
   std::list<Thread*> any_threads;
   std::map<int,std::queue<Item*>> queues;
   std::map<int,std::list<Thread*>> pending_threads;
+  std::map<int,bool> wake_pending;
+  bool any_wake_pending;
+  bool batch;
   OperatingSystem* os;
 
-  MultiProgressQueue(OperatingSystem* os) : ProgressQueue(os)
+  MultiProgressQueue(OperatingSystem* os) : ProgressQueue(os),
+    any_wake_pending(false),
+    batch(false)
   {
   }
 
+  /**
+   * With batching a blocked thread is woken once for all the items that
+   * arrive at the same time instead of once per item
+   */
+  void setBatchDelivery(bool b){
+    batch = b;
+  }
+
   Item* find_any(bool blocking = true, double timeout = -1){
     for (auto& pair : queues){
       if (!pair.second.empty()){
@@ -251,9 +275,17 @@ struct MultiProgressQueue : public ProgressQueue {
   void incoming(int cq, Item* it){
     queues[cq].push(it);
     if (!pending_threads[cq].empty()){
-      unblock(pending_threads[cq]);
+      if (batch){
+        unblockLater(pending_threads[cq], wake_pending[cq]);
+      } else {
+        unblock(pending_threads[cq]);
+      }
     } else if (!any_threads.empty()){
-      unblock(any_threads);
+      if (batch){
+        unblockLater(any_threads, any_wake_pending);
+      } else {
+        unblock(any_threads);
+      }
     } else {
       //pass, nothing to do
     }
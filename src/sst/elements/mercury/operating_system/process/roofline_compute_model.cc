@@ -0,0 +1,46 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include <mercury/operating_system/process/roofline_compute_model.h>
+#include <algorithm>
+
+namespace SST {
+namespace Hg {
+
+RooflineComputeModel::RooflineComputeModel(SST::Params& params) :
+  active_threads_(0)
+{
+  flop_rate_ = params.find<double>("roofline_flop_rate", 1e9);
+  intop_rate_ = params.find<double>("roofline_intop_rate", 1e9);
+  core_mem_bw_ = params.find<double>("roofline_core_mem_bandwidth", 10e9);
+  node_mem_bw_ = params.find<double>("roofline_node_mem_bandwidth", 50e9);
+}
+
+TimeDelta
+RooflineComputeModel::startCompute(uint64_t flops, uint64_t intops, uint64_t bytes, int nthread)
+{
+  active_threads_ += nthread;
+
+  double op_time = (flops / flop_rate_ + intops / intop_rate_) / nthread;
+
+  // each thread gets its fair share of the node, up to what one core can pull
+  double bw = nthread * std::min(core_mem_bw_, node_mem_bw_ / active_threads_);
+  double mem_time = bytes / bw;
+
+  return TimeDelta(std::max(op_time, mem_time));
+}
+
+}
+}
@@ -0,0 +1,63 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#pragma once
+
+#include <sst/core/params.h>
+#include <mercury/common/timestamp.h>
+#include <stdint.h>
+
+namespace SST {
+namespace Hg {
+
+/**
+ * @brief The RooflineComputeModel class
+ * Times a compute block of flops, integer ops and memory bytes as
+ * the slower of its op time and its memory time. The node's memory
+ * bandwidth is shared by the threads computing on it, so the memory
+ * time of a block depends on how many others are running when it starts.
+ */
+class RooflineComputeModel
+{
+ public:
+  RooflineComputeModel(SST::Params& params);
+
+  /**
+   * @brief startCompute Time a block and count its threads as active
+   * @param flops
+   * @param intops
+   * @param bytes
+   * @param nthread The threads the block is split over
+   * @return How long the block takes
+   */
+  TimeDelta startCompute(uint64_t flops, uint64_t intops, uint64_t bytes, int nthread);
+
+  /**
+   * @brief endCompute The block of nthread threads started with startCompute is done
+   */
+  void endCompute(int nthread){
+    active_threads_ -= nthread;
+  }
+
+ private:
+  double flop_rate_;
+  double intop_rate_;
+  double core_mem_bw_;
+  double node_mem_bw_;
+  int active_threads_;
+};
+
+}
+}
@@ -22,6 +22,7 @@
 #include <mercury/operating_system/process/thread.h>
 #include <mercury/operating_system/process/thread_info.h>
 #include <mercury/operating_system/process/app.h>
+#include <mercury/operating_system/threading/stack_alloc.h>
 //#include <sstmac/software/libraries/library.h>
 //#include <sstmac/software/libraries/compute/compute_event.h>
 //#include <sstmac/software/api/api.h>
@@ -159,6 +160,7 @@ Thread::Thread(SST::Params& params, SoftwareId sid, OperatingSystem* os) :
   last_bt_collect_nfxn_(0),
   bt_nfxn_(0),
   timed_out_(false),
+  stack_(nullptr),
   tls_storage_(nullptr),
   thread_id_(Thread::main_thread),
   context_(nullptr),
@@ -276,7 +278,7 @@ Thread::now()
 Thread::~Thread()
 {
   active_cores_.clear();
- // if (stack_) StackAlloc::free(stack_);
+  if (stack_) StackAlloc::free(stack_);
   if (context_) {
     context_->destroyContext();
     delete context_;
@@ -22,6 +22,7 @@
 #include <mercury/operating_system/threading/stack_alloc_chunk.h>
 #include <mercury/operating_system/threading/thread_lock.h>
 
+#include <sys/mman.h>
 #include <unistd.h>
 
 namespace SST {
@@ -31,6 +32,10 @@ StackAlloc::chunk_set StackAlloc::chunks_;
 size_t StackAlloc::suggested_chunk_ = 0;
 size_t StackAlloc::stacksize_ = 0;
 bool StackAlloc::protect_stacks_ = false;
+int StackAlloc::release_advice_ = 0;
+
+// alloc and free share the free list
+static thread_lock stack_lock;
 
 extern "C" {
 int sst_hg_global_stacksize = 0;
@@ -54,6 +59,22 @@ StackAlloc::init(SST::Params& params)
   stacksize_ = sst_hg_global_stacksize;
 
   protect_stacks_ = params.find<bool>("protect_stacks", false);
+
+  std::string release = params.find<std::string>("stack_release", "none");
+  if (release == "none"){
+    release_advice_ = 0;
+  } else if (release == "dontneed"){
+    release_advice_ = MADV_DONTNEED;
+  } else if (release == "free"){
+#ifdef MADV_FREE
+    release_advice_ = MADV_FREE;
+#else
+    release_advice_ = MADV_DONTNEED;
+#endif
+  } else {
+    sst_hg_throw_printf(ValueError, "invalid stack_release %s: must be none, dontneed or free",
+                        release.c_str());
+  }
 }
 
 void
@@ -74,8 +95,7 @@ StackAlloc::chunk_set::clear()
 void*
 StackAlloc::alloc()
 {
-  static thread_lock lock;
-  lock.lock();
+  stack_lock.lock();
   if (stacksize_ == 0) {
     sst_hg_throw_printf(ValueError, "stackalloc::stacksize was not initialized");
   }
@@ -92,7 +112,7 @@ StackAlloc::alloc()
   }
   void *buf = chunks_.available.back();
   chunks_.available.pop_back();
-  lock.unlock();
+  stack_lock.unlock();
   return buf;
 }
 
@@ -101,10 +121,13 @@ StackAlloc::alloc()
 //
 void StackAlloc::free(void* buf)
 {
-  static thread_lock lock; 
-  lock.lock();
+  if (release_advice_){
+    // the pages come back zeroed (or untouched) on the next use
+    madvise(buf, stacksize_, release_advice_);
+  }
+  stack_lock.lock();
   chunks_.available.push_back(buf);
-  lock.unlock();
+  stack_lock.unlock();
 }
 
 
@@ -29,8 +29,10 @@ namespace Hg {
  * which allocates uniform-size chunks (with the NX bit unset)
  * and sets guard pages on each side of the allocated stacks.
  *
- * This allocator does not return memory to the system until it is
- * deleted, but regions can be allocated and free-d repeatedly.
+ * This allocator does not unmap memory until it is deleted, but regions
+ * can be allocated and free-d repeatedly. With stack_release set, the pages
+ * of a free-d stack are handed back with madvise so that idle stacks do not
+ * stay resident.
  */
 class StackAlloc
 {
@@ -52,6 +54,8 @@ class StackAlloc
   static size_t stacksize_;
   /// Optionally added a protected stack between each stack we return
   static bool protect_stacks_;
+  /// madvise advice applied to a stack when it is free-d, 0 for none
+  static int release_advice_;
 
  public:
   static size_t stacksize() {
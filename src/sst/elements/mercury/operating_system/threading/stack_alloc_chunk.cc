@@ -37,7 +37,12 @@ StackAlloc::chunk::chunk(size_t stacksize, size_t suggested_chunk_size, bool pro
   step_size_((protect_) ? 2 * stacksize_ : stacksize_)
 {
   // Now allocate our chunk.
+  // Pages are only committed once a stack touches them, so do not reserve
+  // swap for the whole chunk either
   int mmap_flags = MAP_PRIVATE | MAP_ANON;
+#ifdef MAP_NORESERVE
+  mmap_flags |= MAP_NORESERVE;
+#endif
   addr_ = (char*)mmap(0, size_, PROT_READ | PROT_WRITE,
                       mmap_flags, -1, 0);
   if(addr_ == MAP_FAILED) {
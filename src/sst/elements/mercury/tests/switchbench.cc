@@ -0,0 +1,40 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+// Reports how many context switches per second of host time the threading
+// backend sustains. Every sleep blocks the app thread and the unblock
+// switches back to it, so each iteration is two switches. Select the
+// backend with the os "context" param, see switchbench.py.
+
+#define ssthg_app_name switchbench
+#include <libraries/system/replacements/unistd.h>
+#include <chrono>
+#include <cstdlib>
+#include <iostream>
+#include <mercury/common/skeleton.h>
+int main(int argc, char** argv) {
+  long iterations = argc > 1 ? atol(argv[1]) : 100000;
+
+  auto start = std::chrono::steady_clock::now();
+  for (long i = 0; i < iterations; ++i) {
+    sleep(1);
+  }
+  std::chrono::duration<double> elapsed = std::chrono::steady_clock::now() - start;
+
+  std::cout << "switchbench: " << 2 * iterations << " switches in "
+            << elapsed.count() << " s, "
+            << 2 * iterations / elapsed.count() << " switches/s\n";
+  return 0;
+}
@@ -0,0 +1,23 @@
+import sys
+import sst
+import sst.hg
+
+# sst switchbench.py -- [context] [iterations]
+context = sys.argv[1] if len(sys.argv) > 1 else "fcontext"
+iterations = sys.argv[2] if len(sys.argv) > 2 else "100000"
+
+node0 = sst.Component("Node0", "hg.node")
+node1 = sst.Component("Node1", "hg.node")
+os0 = node0.setSubComponent("os_slot", "hg.operating_system")
+os1 = node1.setSubComponent("os_slot", "hg.operating_system")
+
+link0 = sst.Link("link0")
+link0.connect( (node0,"network","1ns"), (node1,"network","1ns") )
+
+os0.addParams({ "context" : context })
+os0.addParams({ "app1.name" : "switchbench"})
+os0.addParams({ "app1.exe" : "switchbench.so"})
+os0.addParams({ "app1.argv" : iterations})
+os1.addParams({ "context" : context })
+os1.addParams({ "app1.name" : "ostest"})
+os1.addParams({ "app1.exe" : "ostest.so"})
@@ -128,6 +128,7 @@ BackgroundTraffic::init(unsigned int phase) {
         std::string pattern = pattern_params->find<std::string>("pattern_gen");
         // packetDestGen = static_cast<TargetGenerator*>(loadSubComponent(pattern, this, *pattern_params));
         packetDestGen = loadAnonymousSubComponent<TargetGenerator>(pattern, "pattern_gen", 0, ComponentInfo::SHARE_NONE, *pattern_params, id, num_peers);
+        packetDests.setGenerator(packetDestGen);
         delete pattern_params;
 
         // Set up send interval based on bandwidth
@@ -216,7 +217,7 @@ BackgroundTraffic::progress_messages(SimTime_t current_time) {
         // trace.getOutput().output("loop start: %p, %p\n",packetDestGen, link_if);
         background_traffic_event* ev = new background_traffic_event();
         // trace.getOutput().output("  loop middle 1\n");
-        SimpleNetwork::Request* req = new SimpleNetwork::Request(packetDestGen->getNextValue(), id, packet_size, true, true, ev);
+        SimpleNetwork::Request* req = new SimpleNetwork::Request(packetDests.getNextValue(), id, packet_size, true, true, ev);
         // trace.getOutput().output("sending background traffic from %d\n",id);
         link_if->send(req,0);
 
@@ -107,6 +107,7 @@ private:
 
 
     TargetGenerator *packetDestGen;
+    TargetBuffer packetDests;
 
     int id;
     int num_peers;
@@ -24,6 +24,7 @@
 #include <sst/core/interfaces/simpleNetwork.h>
 
 #include <deque>
+#include <vector>
 
 
 namespace SST {
@@ -31,6 +32,80 @@ namespace Merlin {
 
 using SST::Interfaces::SimpleNetwork;
 
+/*
+ * Carries network requests between the two halves of a split bridge. The
+ * halves sit on either side of the chip to chip link, which is the point
+ * where a multi-socket model is partitioned, so the link latency is the
+ * lookahead. During init the remote half also uses it to announce its
+ * endpoint id on its network.
+ */
+class BridgeLinkEvent : public SST::Event {
+public:
+    BridgeLinkEvent() : SST::Event(), endpoint(-1) { }
+
+    std::vector<SimpleNetwork::Request*> reqs;
+    SimpleNetwork::nid_t endpoint;
+
+    void serialize_order(SST::Core::Serialization::serializer &ser)  override {
+        Event::serialize_order(ser);
+        ser & reqs;
+        ser & endpoint;
+    }
+
+    ImplementSerializable(SST::Merlin::BridgeLinkEvent)
+};
+
+/*
+ * Sends requests over the chip to chip link. With a batch window, every
+ * request sent within the window goes out in one event at the end of it
+ * instead of one event each, which cuts the events crossing partitions
+ * at the cost of up to one window of extra latency.
+ */
+class BridgeLinkSender {
+public:
+    BridgeLinkSender() : link(NULL), batchLink(NULL) { }
+
+    void configure(Link* chipLink, Link* windowLink) {
+        link = chipLink;
+        batchLink = windowLink;
+    }
+
+    void send(SimpleNetwork::Request* req) {
+        if ( !batchLink ) {
+            BridgeLinkEvent* ev = new BridgeLinkEvent();
+            ev->reqs.push_back(req);
+            link->send(ev);
+            return;
+        }
+        if ( pending.empty() ) batchLink->send(1, new BridgeLinkEvent());
+        pending.push_back(req);
+    }
+
+    // The batch window closed
+    void flush(SST::Event* ev) {
+        BridgeLinkEvent* batch = static_cast<BridgeLinkEvent*>(ev);
+        batch->reqs.swap(pending);
+        link->send(batch);
+    }
+
+    void sendUntimedData(SimpleNetwork::Request* req) {
+        BridgeLinkEvent* ev = new BridgeLinkEvent();
+        ev->reqs.push_back(req);
+        link->sendUntimedData(ev);
+    }
+
+    void sendEndpoint(SimpleNetwork::nid_t endpoint) {
+        BridgeLinkEvent* ev = new BridgeLinkEvent();
+        ev->endpoint = endpoint;
+        link->sendUntimedData(ev);
+    }
+
+private:
+    Link* link;
+    Link* batchLink;
+    std::vector<SimpleNetwork::Request*> pending;
+};
+
 class Bridge : public SST::Component {
 public:
 
@@ -39,7 +114,7 @@ public:
         "merlin",
         "Bridge",
         SST_ELI_ELEMENT_VERSION(1,0,0),
-        "Bridge between two memory networks.",
+        "Bridge between two memory networks. If the chiplink port is connected, network 1 is the one a merlin.BridgeRemote at the other end of that link is on.",
         COMPONENT_CATEGORY_NETWORK)
 
     SST_ELI_DOCUMENT_PARAMS(
@@ -48,7 +123,8 @@ public:
         {"debug_level",               "Debugging level: 0 to 10", "0"},
         {"network_bw",                "The network link bandwidth.", "80GiB/s"},
         {"network_input_buffer_size", "Size of the network's input buffer.", "1KiB"},
-        {"network_output_buffer_size","Size of the network;s output buffer.", "1KiB"}
+        {"network_output_buffer_size","Size of the network;s output buffer.", "1KiB"},
+        {"chiplink_batch_window",     "With a chiplink, send the requests that cross it within this window as one event at its end. 0 sends each request as it arrives.", "0ns"}
     )
 
     SST_ELI_DOCUMENT_STATISTICS(
@@ -61,6 +137,7 @@ public:
     SST_ELI_DOCUMENT_PORTS(
         {"network0",     "Network Link",  {} },
         {"network1",     "Network Link",  {} },
+        {"chiplink",     "Chip to chip link to a merlin.BridgeRemote that takes the place of network1. Give it the latency of the physical link; it is where the model can be partitioned", {"merlin.BridgeLinkEvent"} },
     )
 
     SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
@@ -85,7 +162,13 @@ public:
         if ( !translator ) dbg.fatal(CALL_INFO, 1, "Must specify a 'translator' subcomponent.");
 
         configureNIC(0, params);
-        configureNIC(1, params);
+        remote = isPortConnected("chiplink");
+        remoteAddr = -1;
+        if ( remote ) {
+            configureChipLink(params);
+        } else {
+            configureNIC(1, params);
+        }
     }
 
     ~Bridge()
@@ -100,12 +183,22 @@ public:
     {
 
         bool ready = true;
-        for ( int i = 0 ; i < 2 ; i++ ) {
+        for ( int i = 0 ; i < (remote ? 1 : 2) ; i++ ) {
             Nic_t &nic = interfaces[i];
             nic.nic->init(phase);
             ready &= nic.nic->isNetworkInitialized();
         }
 
+        if ( remote ) {
+            while ( SST::Event *ev = chipLink->recvUntimedData() ) {
+                BridgeLinkEvent *lev = static_cast<BridgeLinkEvent*>(ev);
+                if ( lev->endpoint != -1 ) remoteAddr = lev->endpoint;
+                remoteInit.insert(remoteInit.end(), lev->reqs.begin(), lev->reqs.end());
+                delete lev;
+            }
+            ready &= remoteAddr != -1;
+        }
+
         translator->init(phase);
 
         dbg.debug(CALL_INFO, 10, 0, "Init Phase %u.  Network %sready\n", phase, ready ? "" : "NOT ");
@@ -114,14 +207,28 @@ public:
 
         for ( int i = 0 ; i < 2 ; i++ ) {
             Nic_t &nic = interfaces[i];
-            Nic_t &otherNic = interfaces[i^1];
 
+            if ( remote && i == 1 ) {
+                for ( auto req : remoteInit ) {
+                    dbg.debug(CALL_INFO, 2, 0, "Received init phase event on chip link\n");
+                    SimpleNetwork::Request *res = translator->initTranslate(req, 1);
+                    if ( res ) {
+                        interfaces[0].nic->sendUntimedData(res);
+                    }
+                }
+                remoteInit.clear();
+                continue;
+            }
 
             while ( SimpleNetwork::Request *req = nic.nic->recvUntimedData() ) {
                 dbg.debug(CALL_INFO, 2, 0, "Received init phase event on interface %d\n", i);
                 SimpleNetwork::Request *res = translator->initTranslate(req, i);
                 if ( res ) {
-                    otherNic.nic->sendUntimedData(res);
+                    if ( remote ) {
+                        chipSender.sendUntimedData(res);
+                    } else {
+                        interfaces[i^1].nic->sendUntimedData(res);
+                    }
                 }
             }
         }
@@ -130,7 +237,7 @@ public:
     void setup(void)
     {   
         interfaces[0].nic->setup();
-        interfaces[1].nic->setup();
+        if ( !remote ) interfaces[1].nic->setup();
     
         translator->setup();
     }
@@ -138,12 +245,15 @@ public:
     void finish(void)
     {   
         interfaces[0].nic->finish();
-        interfaces[1].nic->finish();
+        if ( !remote ) interfaces[1].nic->finish();
     
         translator->finish();
     }
 
-    SimpleNetwork::nid_t getAddrForNetwork(uint8_t netID) { return interfaces[netID].getAddr(); }
+    SimpleNetwork::nid_t getAddrForNetwork(uint8_t netID) {
+        if ( remote && netID == 1 ) return remoteAddr;
+        return interfaces[netID].getAddr();
+    }
 
     class Translator : public SST::SubComponent {
         Bridge* bridge;
@@ -199,6 +309,63 @@ private:
 
     SimpleNetwork::Handler<Bridge, uint8_t>* sendNotify[2];
 
+    // Network 1 is behind a chip link to a BridgeRemote
+    bool remote;
+    Link* chipLink;
+    BridgeLinkSender chipSender;
+    SimpleNetwork::nid_t remoteAddr;
+    std::vector<SimpleNetwork::Request*> remoteInit;
+
+    void configureChipLink(SST::Params &params)
+    {
+        dbg.debug(CALL_INFO, 2, 0, "Initializing chip link in place of network interface 1\n");
+        interfaces[1].nic = NULL;
+        sendNotify[1] = NULL;
+
+        chipLink = configureLink("chiplink", "1ps", new Event::Handler<Bridge>(this, &Bridge::handleChipLink));
+        UnitAlgebra window = params.find<UnitAlgebra>("chiplink_batch_window", "0ns");
+        Link* batchLink = NULL;
+        if ( window.getDoubleValue() > 0 )
+            batchLink = configureSelfLink("chiplink_batch", window.toString(), new Event::Handler<Bridge>(this, &Bridge::flushChipLink));
+        chipSender.configure(chipLink, batchLink);
+
+        interfaces[1].stat_recv = registerStatistic<uint64_t>("pkts_received_net1");
+        interfaces[1].stat_send = registerStatistic<uint64_t>("pkts_sent_net1");
+    }
+
+    void handleChipLink(SST::Event *ev)
+    {
+        BridgeLinkEvent *lev = static_cast<BridgeLinkEvent*>(ev);
+        for ( auto req : lev->reqs ) {
+            interfaces[1].stat_recv->addData(1);
+            dbg.debug(CALL_INFO, 5, 0, "Received event on chip link\n");
+
+            SimpleNetwork::Request *res = translator->translate(req, 1);
+            if ( res ) send(0, res);
+        }
+        delete lev;
+    }
+
+    void flushChipLink(SST::Event *ev)
+    {
+        chipSender.flush(ev);
+    }
+
+    void send(uint8_t id, SimpleNetwork::Request *res)
+    {
+        Nic_t &outNIC = interfaces[id];
+        if ( remote && id == 1 ) {
+            chipSender.send(res);
+            outNIC.stat_send->addData(1);
+        } else if ( outNIC.nic->send(res, 0) ) {
+            outNIC.stat_send->addData(1);
+        } else {
+            /* We failed to send. */
+            outNIC.sendQueue.push_back(res);
+            outNIC.nic->setNotifyOnSend(sendNotify[id]);
+        }
+    }
+
     void configureNIC(uint8_t id, SST::Params &params)
     {
         dbg.debug(CALL_INFO, 2, 0, "Initializing network interface %d\n", id);
@@ -233,7 +400,6 @@ private:
     bool handleIncoming(int vn, uint8_t id)
     {
         Nic_t &inNIC = interfaces[id];
-        Nic_t &outNIC = interfaces[id^1];
 
         SimpleNetwork::Request* req = inNIC.nic->recv(vn);
 
@@ -243,15 +409,7 @@ private:
         dbg.debug(CALL_INFO, 5, 0, "Received event on interface %u\n", id);
 
         SimpleNetwork::Request *res = translator->translate(req, id);
-        if ( res ) {
-            if ( outNIC.nic->send(res, 0) ) {
-                outNIC.stat_send->addData(1);
-            } else {
-                /* We failed to send. */
-                outNIC.sendQueue.push_back(res);
-                outNIC.nic->setNotifyOnSend(sendNotify[id^1]);
-            }
-        }
+        if ( res ) send(id^1, res);
         return true;
     }
 
@@ -272,6 +430,178 @@ private:
 
 };
 
+/*
+ * The far half of a split bridge. Connects one network to a merlin.Bridge
+ * through its chiplink port and forwards every request across unchanged;
+ * the Bridge does all of the translation.
+ */
+class BridgeRemote : public SST::Component {
+public:
+
+    SST_ELI_REGISTER_COMPONENT(
+        BridgeRemote,
+        "merlin",
+        "BridgeRemote",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Far end of a merlin.Bridge whose network 1 is across a chip to chip link.",
+        COMPONENT_CATEGORY_NETWORK)
+
+    SST_ELI_DOCUMENT_PARAMS(
+        {"debug",                     "0 (default): No debugging, 1: STDOUT, 2: STDERR, 3: FILE.", "0"},
+        {"debug_level",               "Debugging level: 0 to 10", "0"},
+        {"network_bw",                "The network link bandwidth.", "80GiB/s"},
+        {"network_input_buffer_size", "Size of the network's input buffer.", "1KiB"},
+        {"network_output_buffer_size","Size of the network's output buffer.", "1KiB"},
+        {"chiplink_batch_window",     "Send the requests that cross the chip link within this window as one event at its end. 0 sends each request as it arrives.", "0ns"}
+    )
+
+    SST_ELI_DOCUMENT_STATISTICS(
+        {"pkts_received",           "Total number of packets recived on the network", "count", 1},
+        {"pkts_sent",               "Total number of packets sent on the network", "count", 1},
+    )
+
+    SST_ELI_DOCUMENT_PORTS(
+        {"network",      "Network Link",  {} },
+        {"chiplink",     "Chip to chip link to the chiplink port of a merlin.Bridge", {"merlin.BridgeLinkEvent"} },
+    )
+
+    SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS(
+        {"networkIF", "Element to interface to the network.", "SST::Interfaces::SimpleNetwork" }
+    )
+
+    BridgeRemote(SST::ComponentId_t id, SST::Params &params) :
+        SST::Component(id), announced(false)
+    {
+        int debugLevel = params.find<int>("debug_level", 0);
+        dbg.init("@t:BridgeRemote::@p():@l " + getName() + ": ",
+                debugLevel, 0, (Output::output_location_t)params.find<int>("debug", 0));
+
+        Params if_params;
+
+        if_params.insert("link_bw",params.find<std::string>("network_bw","80GiB/s"));
+        if_params.insert("input_buf_size",params.find<std::string>("network_input_buffer_size", "1KiB"));
+        if_params.insert("output_buf_size",params.find<std::string>("network_output_buffer_size", "1KiB"));
+        if_params.insert("port_name","network");
+
+        nic = loadAnonymousSubComponent<SST::Interfaces::SimpleNetwork>
+            ("merlin.linkcontrol", "networkIF", 0,
+             ComponentInfo::SHARE_PORTS | ComponentInfo::INSERT_STATS, if_params, 1 /* vns */);
+
+        nic->setNotifyOnReceive(new SimpleNetwork::Handler<BridgeRemote>(this, &BridgeRemote::handleIncoming));
+        sendNotify = new SimpleNetwork::Handler<BridgeRemote>(this, &BridgeRemote::spaceAvailable);
+
+        stat_recv = registerStatistic<uint64_t>("pkts_received");
+        stat_send = registerStatistic<uint64_t>("pkts_sent");
+
+        chipLink = configureLink("chiplink", "1ps", new Event::Handler<BridgeRemote>(this, &BridgeRemote::handleChipLink));
+        UnitAlgebra window = params.find<UnitAlgebra>("chiplink_batch_window", "0ns");
+        Link* batchLink = NULL;
+        if ( window.getDoubleValue() > 0 )
+            batchLink = configureSelfLink("chiplink_batch", window.toString(), new Event::Handler<BridgeRemote>(this, &BridgeRemote::flushChipLink));
+        chipSender.configure(chipLink, batchLink);
+    }
+
+    ~BridgeRemote()
+    {
+        delete nic;
+    }
+
+    void init(unsigned int phase)
+    {
+        nic->init(phase);
+        if ( !nic->isNetworkInitialized() ) return;
+
+        if ( !announced ) {
+            chipSender.sendEndpoint(nic->getEndpointID());
+            announced = true;
+        }
+
+        while ( SimpleNetwork::Request *req = nic->recvUntimedData() ) {
+            dbg.debug(CALL_INFO, 2, 0, "Received init phase event on the network\n");
+            chipSender.sendUntimedData(req);
+        }
+
+        while ( SST::Event *ev = chipLink->recvUntimedData() ) {
+            BridgeLinkEvent *lev = static_cast<BridgeLinkEvent*>(ev);
+            for ( auto req : lev->reqs ) {
+                nic->sendUntimedData(req);
+            }
+            delete lev;
+        }
+    }
+
+    void setup(void)
+    {
+        nic->setup();
+    }
+
+    void finish(void)
+    {
+        nic->finish();
+    }
+
+private:
+    Output dbg;
+
+    SimpleNetwork *nic;
+    std::deque<SimpleNetwork::Request*> sendQueue;
+    SimpleNetwork::Handler<BridgeRemote>* sendNotify;
+
+    Statistic<uint64_t> *stat_recv;
+    Statistic<uint64_t> *stat_send;
+
+    Link* chipLink;
+    BridgeLinkSender chipSender;
+    bool announced;
+
+    bool handleIncoming(int vn)
+    {
+        SimpleNetwork::Request* req = nic->recv(vn);
+
+        if ( NULL == req ) return false;
+        stat_recv->addData(1);
+
+        dbg.debug(CALL_INFO, 5, 0, "Received event on the network\n");
+        chipSender.send(req);
+        return true;
+    }
+
+    void handleChipLink(SST::Event *ev)
+    {
+        BridgeLinkEvent *lev = static_cast<BridgeLinkEvent*>(ev);
+        for ( auto req : lev->reqs ) {
+            if ( sendQueue.empty() && nic->send(req, 0) ) {
+                stat_send->addData(1);
+            } else {
+                /* We failed to send, or would pass the ones that did. */
+                sendQueue.push_back(req);
+                nic->setNotifyOnSend(sendNotify);
+            }
+        }
+        delete lev;
+    }
+
+    void flushChipLink(SST::Event *ev)
+    {
+        chipSender.flush(ev);
+    }
+
+    bool spaceAvailable(int vn)
+    {
+        while ( !sendQueue.empty() ) {
+            if ( nic->send(sendQueue.front(), 0) ) {
+                stat_send->addData(1);
+                sendQueue.pop_front();
+            } else {
+                /* Not enough room yet.  */
+                return true;
+            }
+        }
+        return false;
+    }
+
+};
+
 }}
 
 #endif
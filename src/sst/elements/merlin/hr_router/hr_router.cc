@@ -108,6 +108,9 @@ hr_router::~hr_router()
     delete [] in_port_busy;
     delete [] out_port_busy;
     delete [] progress_vcs;
+    delete [] blocked_stalls;
+    delete [] port_mask;
+    delete [] vc_mask;
 
     for ( int i = 0 ; i < num_ports ; i++ ) {
         delete ports[i];
@@ -265,6 +268,8 @@ hr_router::hr_router(ComponentId_t cid, Params& params) :
         pc_params.insert("input_buf_size", getLogicalGroupParam(params,topo,i,"input_buf_size"));
         pc_params.insert("output_buf_size", getLogicalGroupParam(params,topo,i,"output_buf_size"));
         pc_params.insert("dlink_thresh", getLogicalGroupParam(params,topo,i,"dlink_thresh", "-1"));
+        pc_params.insert("background_load", getLogicalGroupParam(params,topo,i,"background_load", "0"));
+        pc_params.insert("background_occupancy", getLogicalGroupParam(params,topo,i,"background_occupancy", "0"));
         pc_params.insert("vn_remap_shm", vn_remap_shm);
         pc_params.insert("vn_remap_shm_size", std::to_string(vn_remap_shm_size));
         pc_params.insert("num_vns", std::to_string(num_vns));
@@ -287,6 +292,18 @@ hr_router::hr_router(ComponentId_t cid, Params& params) :
     xbar_tc = registerClock( xbar_clock, my_clock_handler);
     num_routers++;
 
+    skip_blocked_cycles = params.find<bool>("skip_blocked_cycles", false);
+    paused_blocked = false;
+    wakeup_link = NULL;
+    blocked_stalls = new uint64_t[num_ports];
+    for ( int i = 0; i < num_ports; i++ ) blocked_stalls[i] = 0;
+#if VERIFY_DECLOCKING
+    skip_blocked_cycles = false;
+#endif
+    if ( skip_blocked_cycles ) {
+        wakeup_link = configureSelfLink("xbar_wakeup", xbar_tc, new Event::Handler<hr_router>(this,&hr_router::handle_wakeup));
+    }
+
 #if VERIFY_DECLOCKING
     clocking = true;
 #endif
@@ -307,6 +324,10 @@ hr_router::hr_router(ComponentId_t cid, Params& params) :
         xbar_stalls[i] = registerStatistic<uint64_t>("xbar_stalls",port_name);
     }
 
+    if ( params.find<bool>("host_profile", false) ) {
+        profile_clock.enable(registerStatistic<uint64_t>("host_ns_clock"), registerStatistic<uint64_t>("host_events_clock"));
+    }
+
     init_vcs();
 }
 
@@ -327,6 +348,21 @@ hr_router::notifyEvent()
 
 
 #if !VERIFY_DECLOCKING
+    if ( paused_blocked ) {
+        // VCs held data while paused, so let the arbitration unit
+        // account for the cycles it would have spent stalled.  This
+        // needs the busy values from before the fix up.
+        setRequestNotifyOnCredit(false);
+        paused_blocked = false;
+        arb->reportBlockedCycles(elapsed_cycles, ports, in_port_busy, blocked_stalls);
+        for ( int i = 0; i < num_ports; i++ ) {
+            if ( blocked_stalls[i] != 0 ) {
+                xbar_stalls[i]->addDataNTimes(blocked_stalls[i], 1);
+                blocked_stalls[i] = 0;
+            }
+        }
+    }
+
     // Fix up the busy variables
     for ( int i = 0; i < num_ports; i++ ) {
     	// Should stop at zero, need to find a clean way to do this
@@ -343,6 +379,14 @@ hr_router::notifyEvent()
     arb->reportSkippedCycles(elapsed_cycles);
 }
 
+void
+hr_router::handle_wakeup(Event* ev)
+{
+    // A VC may have been unblocked early by an arriving event or
+    // credit, in which case the clock is already running
+    if ( getRequestNotifyOnEvent() ) notifyEvent();
+}
+
 void
 hr_router::sigHandler(int signal)
 {
@@ -375,6 +419,8 @@ hr_router::printStatus(Output& out)
 bool
 hr_router::clock_handler(Cycle_t cycle)
 {
+    SST::HostProf::ScopedHandlerTimer profile_timer(profile_clock);
+
     // If there are no events in the input queues, then we can remove
     // ourselves from the clock queue, as long as the arbitration unit
     // says it's okay.
@@ -441,6 +487,24 @@ hr_router::clock_handler(Cycle_t cycle)
         if ( out_port_busy[i] != 0 ) out_port_busy[i]--;
     }
 
+    if ( skip_blocked_cycles && get_vcs_with_data() != 0 ) {
+        // If no VC can progress for a while, pause the clock and
+        // restart it at the first cycle one can.  VCs waiting only on
+        // credits are restarted by the port returning the credits.
+        Cycle_t blocked = arb->getBlockedCycles(ports, in_port_busy, out_port_busy);
+        if ( blocked != 0 && arb->isOkayToPauseClock() ) {
+            setRequestNotifyOnEvent(true);
+            setRequestNotifyOnCredit(true);
+            paused_blocked = true;
+            unclocked_cycle = cycle + 1;
+            if ( blocked != XbarArbitration::BLOCKED_UNTIL_ARRIVAL ) {
+                // The clock restarts on the cycle after the wakeup arrives
+                wakeup_link->send(blocked, NULL);
+            }
+            return true;
+        }
+    }
+
     return false;
 }
 
@@ -453,10 +517,21 @@ void hr_router::setup()
 
 void hr_router::finish()
 {
+    // Count the stalls since the clock was paused
+    if ( paused_blocked ) {
+        Cycle_t elapsed_cycles = getNextClockCycle(xbar_tc) - unclocked_cycle;
+        arb->reportBlockedCycles(elapsed_cycles, ports, in_port_busy, blocked_stalls);
+        for ( int i = 0; i < num_ports; i++ ) {
+            if ( blocked_stalls[i] != 0 ) xbar_stalls[i]->addDataNTimes(blocked_stalls[i], 1);
+        }
+    }
+
     for ( int i = 0; i < num_ports; i++ ) {
     	ports[i]->finish();
     }
 
+    profile_clock.report();
+
 }
 
 void
@@ -613,9 +688,17 @@ hr_router::init_vcs()
     topo->setOutputBufferCreditArray(xbar_in_credits, num_vcs);
     topo->setOutputQueueLengthsArray(output_queue_lengths, num_vcs);
 
+    // Bitmasks of VCs with data, kept up to date by the PortControl
+    // blocks through inc_vcs_with_data() and dec_vcs_with_data()
+    int vc_words = (num_vcs + 63) / 64;
+    port_mask = new uint64_t[(num_ports + 63) / 64]();
+    vc_mask = new uint64_t[num_ports * vc_words]();
+    setDataMasks(port_mask, vc_mask, vc_words);
+
     // Now that we have the number of VCs we can finish initializing
     // arbitration logic
     arb->setPorts(num_ports,num_vcs);
+    arb->setDataMasks(port_mask, vc_mask, vc_words);
 
 
 }
@@ -30,6 +30,7 @@
 #include <queue>
 
 #include "sst/elements/merlin/router.h"
+#include "sst/elements/hostprof/hostProfile.h"
 
 using namespace SST;
 
@@ -62,12 +63,16 @@ public:
         {"output_latency",     "Latency of packets exiting switch from output buffers.  Specified in s (can include SI prefix)."},
         {"input_buf_size",     "Size of input buffers specified in b or B (can include SI prefix)."},
         {"output_buf_size",    "Size of output buffers specified in b or B (can include SI prefix)."},
+        {"background_load",    "Fraction of the output link bandwidth used by modeled background traffic (can be set per logical port group).", "0"},
+        {"background_occupancy", "Fraction of the downstream buffers held by modeled background traffic (can be set per logical port group).", "0"},
         {"network_inspectors", "Comma separated list of network inspectors to put on output ports.", ""},
         {"oql_track_port",     "Set to true to track output queue length for an entire port.  False tracks per VC.", "false"},
         {"oql_track_remote",   "Set to true to track output queue length including remote input queue.  False tracks only local queue.", "false"},
         {"num_vns",            "Number of VNs.","2"},
         {"vn_remap",           "Array that specifies the vn remapping for each node in the systsm."},
         {"vn_remap_shm",       "Name of shared memory region for vn remapping.  If empty, no remapping is done", ""},
+        {"skip_blocked_cycles","Set to true to turn the clock off while every VC with data is waiting on crossbar serialization or output credits, and turn it back on at the earliest cycle any VC can progress.  Requires support from the xbar_arb; it is ignored otherwise.", "false"},
+        {"host_profile",       "Set to true to measure the host time spent in the clock handler and report it in the host_* statistics.", "false"},
         {"debug",              "Turn on debugging for router. Set to 1 for on, 0 for off.", "0"}
     )
 
@@ -77,7 +82,9 @@ public:
         { "output_port_stalls", "Time output port is stalled (in units of core timebase)", "time in stalls", 1},
         { "xbar_stalls",        "Count number of cycles the xbar is stalled", "cycles", 1},
         { "idle_time",          "Amount of time spent idle for a given port", "units of core timebase", 1},
-        { "width_adj_count",    "Number of times that link width was increased or decreased", "width adjustment count", 1}
+        { "width_adj_count",    "Number of times that link width was increased or decreased", "width adjustment count", 1},
+        { "host_ns_clock",      "With host_profile, host nanoseconds spent in the clock handler", "ns", 1},
+        { "host_events_clock",  "With host_profile, number of calls to the clock handler", "count", 1}
     )
 
     SST_ELI_DOCUMENT_PORTS(
@@ -108,6 +115,8 @@ private:
     internal_router_event** vc_heads;
     int* xbar_in_credits;
     int* output_queue_lengths;
+    uint64_t* port_mask;
+    uint64_t* vc_mask;
 
 #if VERIFY_DECLOCKING
     bool clocking;
@@ -125,13 +134,21 @@ private:
     TimeConverter* xbar_tc;
     Clock::Handler<hr_router>* my_clock_handler;
 
+    // Pausing the clock while VCs are blocked
+    bool skip_blocked_cycles;
+    bool paused_blocked;        // Clock is paused with VCs holding data
+    Link* wakeup_link;          // Self link to restart the clock when the first VC is unblocked
+    uint64_t* blocked_stalls;
+
     std::vector<std::string> inspector_names;
 
     bool clock_handler(Cycle_t cycle);
+    void handle_wakeup(Event* ev);
     static void sigHandler(int signal);
 
     void init_vcs();
     Statistic<uint64_t>** xbar_stalls;
+    SST::HostProf::HandlerProfile profile_clock;
 
     Output& output;
 
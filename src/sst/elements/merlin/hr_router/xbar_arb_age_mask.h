@@ -0,0 +1,177 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef COMPONENTS_HR_ROUTER_XBAR_ARB_AGE_MASK_H
+#define COMPONENTS_HR_ROUTER_XBAR_ARB_AGE_MASK_H
+
+#include <sst/core/component.h>
+#include <sst/core/event.h>
+#include <sst/core/link.h>
+#include <sst/core/timeConverter.h>
+
+#include <vector>
+#include <queue>
+
+#include "sst/elements/merlin/router.h"
+#include "sst/elements/merlin/hr_router/xbar_arb_mask.h"
+
+namespace SST {
+namespace Merlin {
+
+/*
+ * Makes the same decisions as xbar_arb_age, but only collects the
+ * VCs that have data using the router's VC data bitmasks.
+ */
+class xbar_arb_age_mask : public xbar_arb_mask_base {
+
+public:
+
+    SST_ELI_REGISTER_SUBCOMPONENT(
+        xbar_arb_age_mask,
+        "merlin",
+        "xbar_arb_age_mask",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Age based arbitration unit for hr_router using bitmasks of VCs with data.  Same decisions as xbar_arb_age.",
+        SST::Merlin::XbarArbitration
+    )
+
+private:
+    struct priority_entry_t {
+        int port;
+        int vc;
+        int next_port;
+        int next_vc;
+        SimTime_t injection_time;
+        int size_in_flits;
+    };
+
+    /** To use with STL priority queues, that order in reverse. */
+    class time_priority {
+    public:
+        inline bool operator()(const priority_entry_t* lhs, const priority_entry_t* rhs) const {
+            return lhs->injection_time > rhs->injection_time;
+        }
+    };
+
+    typedef std::priority_queue<priority_entry_t*, std::vector<priority_entry_t*>, xbar_arb_age_mask::time_priority> age_queue_t;
+    age_queue_t age_queue;
+
+    std::vector<priority_entry_t> entries;
+
+public:
+
+    xbar_arb_age_mask(ComponentId_t cid, Params& params) :
+        xbar_arb_mask_base(cid)
+    {
+    }
+
+    ~xbar_arb_age_mask() {
+    }
+
+    void setPorts(int num_ports_s, int num_vcs_s) {
+        num_ports = num_ports_s;
+        num_vcs = num_vcs_s;
+
+        entries.resize(num_ports * num_vcs);
+        for ( int i = 0; i < num_ports; i++ ) {
+            for ( int j = 0; j < num_vcs; j++ ) {
+                entries[i * num_vcs + j].port = i;
+                entries[i * num_vcs + j].vc = j;
+            }
+        }
+    }
+
+    // Naming convention is from point of view of the xbar.  So,
+    // in_port_busy is >0 if someone is writing to that xbar port and
+    // out_port_busy is >0 if that xbar port being read.
+    void arbitrate(
+#if VERIFY_DECLOCKING
+                   PortInterface** ports, int* in_port_busy, int* out_port_busy, int* progress_vc, bool clocking
+#else
+                   PortInterface** ports, int* in_port_busy, int* out_port_busy, int* progress_vc
+#endif
+                   )
+    {
+        checkMasks();
+
+        for ( int i = 0; i < num_ports; i++ ) progress_vc[i] = -1;
+
+        // Find all VCs with data whose port's input to the xbar isn't
+        // busy, in the same order as xbar_arb_age so ties in age are
+        // broken the same way.  Oldest gets top priority.
+        for ( int i = nextSet(port_mask, num_ports, 0); i != -1; i = nextSet(port_mask, num_ports, i + 1) ) {
+            if ( in_port_busy[i] > 0 ) continue;
+
+            internal_router_event** vc_heads = ports[i]->getVCHeads();
+            const uint64_t* mask = portVCs(i);
+            for ( int j = nextSet(mask, num_vcs, 0); j != -1; j = nextSet(mask, num_vcs, j + 1) ) {
+                priority_entry_t& entry = entries[i * num_vcs + j];
+                entry.next_port = vc_heads[j]->getNextPort();
+                entry.next_vc = vc_heads[j]->getVC();
+                entry.injection_time = vc_heads[j]->getEncapsulatedEvent()->getInjectionTime();
+                entry.size_in_flits = vc_heads[j]->getFlitCount();
+                age_queue.push(&entry);
+            }
+        }
+
+        while ( !age_queue.empty() ) {
+
+            priority_entry_t* entry = age_queue.top();
+            age_queue.pop();
+
+            int port = entry->port;
+
+            // if the input to the xbar for this port is busy, nothing
+            // to do.  This will only happen at this point if a higher
+            // priority VC from this port was satisfied this cycle.
+            if ( in_port_busy[port] <= 0 ) {
+                int next_port = entry->next_port;
+
+                // We can progress if the next port's output from xbar
+                // is not busy and there are enough credits.
+                if ( out_port_busy[next_port] <= 0 &&
+                     ports[next_port]->spaceToSend(entry->next_vc, entry->size_in_flits) ) {
+
+                    // Tell the router what to move
+                    progress_vc[port] = entry->vc;
+
+                    // Need to set the busy values
+                    in_port_busy[port] = entry->size_in_flits;
+                    out_port_busy[next_port] = entry->size_in_flits;
+                }
+                else {
+                    progress_vc[port] = -2;
+                }
+            }
+        }
+
+        return;
+    }
+
+    void reportSkippedCycles(Cycle_t cycles) {
+    }
+
+    // No per-cycle state, so only the stalls need to be accounted for
+    void reportBlockedCycles(Cycle_t cycles, PortInterface** ports, int* in_port_busy, uint64_t* stall_cycles) {
+        addMaskedStalls(cycles, in_port_busy, stall_cycles);
+    }
+
+};
+
+}
+}
+
+#endif // COMPONENTS_HR_ROUTER_XBAR_ARB_AGE_MASK_H
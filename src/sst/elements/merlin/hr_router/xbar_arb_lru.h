@@ -197,6 +197,16 @@ public:
     void reportSkippedCycles(Cycle_t cycles) {
     }
 
+    Cycle_t getBlockedCycles(PortInterface** ports, int* in_port_busy, int* out_port_busy) {
+        return computeBlockedCycles(ports, in_port_busy, out_port_busy, num_ports, num_vcs);
+    }
+
+    // Priorities only change when a VC progresses, so only the stalls
+    // need to be accounted for
+    void reportBlockedCycles(Cycle_t cycles, PortInterface** ports, int* in_port_busy, uint64_t* stall_cycles) {
+        addBlockedStalls(cycles, ports, in_port_busy, stall_cycles, num_ports, num_vcs);
+    }
+
     void dumpState(std::ostream& stream) {
         /* stream << "Current round robin port: " << rr_port << std::endl; */
         /* stream << "  Current round robin VC by port:" << std::endl; */
@@ -185,6 +185,12 @@ public:
     void reportSkippedCycles(Cycle_t cycles) {
     }
 
+    // Busy values are never set, so this only finds VCs with credits
+    // to move
+    Cycle_t getBlockedCycles(PortInterface** ports, int* in_port_busy, int* out_port_busy) {
+        return computeBlockedCycles(ports, in_port_busy, out_port_busy, num_ports, num_vcs);
+    }
+
     void dumpState(std::ostream& stream) {
         /* stream << "Current round robin port: " << rr_port << std::endl; */
         /* stream << "  Current round robin VC by port:" << std::endl; */
@@ -0,0 +1,114 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef COMPONENTS_HR_ROUTER_XBAR_ARB_MASK_H
+#define COMPONENTS_HR_ROUTER_XBAR_ARB_MASK_H
+
+#include <sst/core/subcomponent.h>
+
+#include "sst/elements/merlin/router.h"
+
+namespace SST {
+namespace Merlin {
+
+/*
+ * Common code for arbitration units that use the router's bitmasks
+ * of VCs with data to only visit the ports and VCs that have events
+ * to progress, instead of scanning every port x VC each cycle.
+ */
+class xbar_arb_mask_base : public XbarArbitration {
+
+protected:
+    int num_ports;
+    int num_vcs;
+
+    const uint64_t* port_mask;
+    const uint64_t* vc_mask;
+    int vc_words;
+
+public:
+
+    xbar_arb_mask_base(ComponentId_t cid) :
+        XbarArbitration(cid),
+        port_mask(NULL),
+        vc_mask(NULL),
+        vc_words(0)
+    {
+    }
+
+    void setDataMasks(const uint64_t* port_mask_s, const uint64_t* vc_mask_s, int vc_words_s) {
+        port_mask = port_mask_s;
+        vc_mask = vc_mask_s;
+        vc_words = vc_words_s;
+    }
+
+    Cycle_t getBlockedCycles(PortInterface** ports, int* in_port_busy, int* out_port_busy) {
+        Cycle_t blocked = BLOCKED_UNTIL_ARRIVAL;
+        for ( int port = nextSet(port_mask, num_ports, 0); port != -1; port = nextSet(port_mask, num_ports, port + 1) ) {
+            internal_router_event** heads = ports[port]->getVCHeads();
+            const uint64_t* mask = portVCs(port);
+            for ( int vc = nextSet(mask, num_vcs, 0); vc != -1; vc = nextSet(mask, num_vcs, vc + 1) ) {
+                internal_router_event* ev = heads[vc];
+                int next_port = ev->getNextPort();
+                // Only a credit return can unblock this VC
+                if ( !ports[next_port]->spaceToSend(ev->getVC(), ev->getFlitCount()) ) continue;
+                Cycle_t wait = std::max<int>(in_port_busy[port], out_port_busy[next_port]);
+                if ( wait == 0 ) return 0;
+                if ( wait < blocked ) blocked = wait;
+            }
+        }
+        return blocked;
+    }
+
+protected:
+
+    void checkMasks() {
+        if ( vc_mask == NULL ) {
+            getSimulationOutput().fatal(CALL_INFO_LONG, -1, "%s requires a router that provides VC data masks\n", getName().c_str());
+        }
+    }
+
+    inline const uint64_t* portVCs(int port) const { return &vc_mask[port * vc_words]; }
+
+    // Returns the first set bit at or after from, or -1 if there is none
+    static inline int nextSet(const uint64_t* mask, int bits, int from) {
+        if ( from >= bits ) return -1;
+        int word = from >> 6;
+        uint64_t w = mask[word] & (~(uint64_t)0 << (from & 63));
+        int words = (bits + 63) >> 6;
+        while ( true ) {
+            if ( w ) {
+                int bit = (word << 6) + __builtin_ctzll(w);
+                return bit < bits ? bit : -1;
+            }
+            if ( ++word == words ) return -1;
+            w = mask[word];
+        }
+    }
+
+    // Stalls are reported for every port with data whose xbar input
+    // was idle
+    void addMaskedStalls(Cycle_t cycles, int* in_port_busy, uint64_t* stall_cycles) {
+        for ( int port = nextSet(port_mask, num_ports, 0); port != -1; port = nextSet(port_mask, num_ports, port + 1) ) {
+            stall_cycles[port] += idleInputCycles(cycles, in_port_busy[port]);
+        }
+    }
+};
+
+}
+}
+
+#endif // COMPONENTS_HR_ROUTER_XBAR_ARB_MASK_H
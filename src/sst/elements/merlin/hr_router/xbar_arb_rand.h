@@ -231,6 +231,26 @@ public:
     void reportSkippedCycles(Cycle_t cycles) {
     }
 
+    Cycle_t getBlockedCycles(PortInterface** ports, int* in_port_busy, int* out_port_busy) {
+        return computeBlockedCycles(ports, in_port_busy, out_port_busy, num_ports, num_vcs);
+    }
+
+    // Draw the random priorities arbitrate() would have drawn so the
+    // random stream matches a router that never skips cycles
+    void reportBlockedCycles(Cycle_t cycles, PortInterface** ports, int* in_port_busy, uint64_t* stall_cycles) {
+        for ( int i = 0; i < num_ports; i++ ) {
+            Cycle_t idle = idleInputCycles(cycles, in_port_busy[i]);
+            if ( idle == 0 ) continue;
+            vc_heads = ports[i]->getVCHeads();
+            int heads = 0;
+            for ( int j = 0; j < num_vcs; j++ ) {
+                if ( vc_heads[j] != NULL ) heads++;
+            }
+            for ( Cycle_t draw = 0; draw < idle * heads; draw++ ) rng->nextUniform();
+        }
+        addBlockedStalls(cycles, ports, in_port_busy, stall_cycles, num_ports, num_vcs);
+    }
+
     void dumpState(std::ostream& stream) {
         /* stream << "Current round robin port: " << rr_port << std::endl; */
         /* stream << "  Current round robin VC by port:" << std::endl; */
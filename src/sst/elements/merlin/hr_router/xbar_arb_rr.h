@@ -166,6 +166,18 @@ public:
 #endif
     }
 
+    Cycle_t getBlockedCycles(PortInterface** ports, int* in_port_busy, int* out_port_busy) {
+        return computeBlockedCycles(ports, in_port_busy, out_port_busy, num_ports, num_vcs);
+    }
+
+    // rr_vcs advances every cycle a port's input is idle.  rr_port is
+    // advanced by reportSkippedCycles()
+    void reportBlockedCycles(Cycle_t cycles, PortInterface** ports, int* in_port_busy, uint64_t* stall_cycles) {
+        for ( int i = 0; i < num_ports; i++ ) {
+            rr_vcs[i] = (rr_vcs[i] + idleInputCycles(cycles, in_port_busy[i])) % num_vcs;
+        }
+    }
+
     void dumpState(std::ostream& stream) {
         stream << "Current round robin port: " << rr_port << std::endl;
         stream << "  Current round robin VC by port:" << std::endl;
@@ -0,0 +1,178 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef COMPONENTS_HR_ROUTER_XBAR_ARB_RR_MASK_H
+#define COMPONENTS_HR_ROUTER_XBAR_ARB_RR_MASK_H
+
+#include <sst/core/component.h>
+#include <sst/core/event.h>
+#include <sst/core/link.h>
+#include <sst/core/timeConverter.h>
+
+#include "sst/elements/merlin/router.h"
+#include "sst/elements/merlin/hr_router/xbar_arb_mask.h"
+
+namespace SST {
+namespace Merlin {
+
+/*
+ * Makes the same decisions as xbar_arb_rr, but only visits the VCs
+ * that have data, starting from the round robin VC using the
+ * router's VC data bitmasks.
+ */
+class xbar_arb_rr_mask : public xbar_arb_mask_base {
+
+public:
+
+    SST_ELI_REGISTER_SUBCOMPONENT(
+        xbar_arb_rr_mask,
+        "merlin",
+        "xbar_arb_rr_mask",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Round robin arbitration unit for hr_router using bitmasks of VCs with data.  Same decisions as xbar_arb_rr.",
+        SST::Merlin::XbarArbitration
+    )
+
+
+private:
+    int *rr_vcs;
+    int rr_port;
+
+public:
+
+    xbar_arb_rr_mask(ComponentId_t cid, Params& params) :
+        xbar_arb_mask_base(cid),
+        rr_vcs(NULL)
+    {
+    }
+
+    ~xbar_arb_rr_mask() {
+        if ( rr_vcs != NULL ) delete [] rr_vcs;
+    }
+
+    void setPorts(int num_ports_s, int num_vcs_s) {
+        num_ports = num_ports_s;
+        num_vcs = num_vcs_s;
+
+        rr_vcs = new int[num_ports];
+        for ( int i = 0; i < num_ports; i++ ) {
+            rr_vcs[i] = 0;
+        }
+
+        rr_port = 0;
+    }
+
+    // Naming convention is from point of view of the xbar.  So,
+    // in_port_busy is >0 if someone is writing to that xbar port and
+    // out_port_busy is >0 if that xbar port being read.
+    void arbitrate(
+#if VERIFY_DECLOCKING
+                   PortInterface** ports, int* in_port_busy, int* out_port_busy, int* progress_vc, bool clocking
+#else
+                   PortInterface** ports, int* in_port_busy, int* out_port_busy, int* progress_vc
+#endif
+                   )
+    {
+        checkMasks();
+
+        // Run through each of the ports, giving first pick in a round
+        // robin fashion.  Every port is visited since rr_vcs advances
+        // for each idle port, but only VCs with data are checked.
+        for ( int port = rr_port, pcount = 0; pcount < num_ports; port = ((port != num_ports-1) ? port+1 : 0), pcount++ ) {
+
+            // Overwrite old data
+            progress_vc[port] = -1;
+            // if the output of this port is busy, nothing to do.
+            if ( in_port_busy[port] > 0 ) {
+                continue;
+            }
+
+            if ( port_mask[port >> 6] & ((uint64_t)1 << (port & 63)) ) {
+                internal_router_event** vc_heads = ports[port]->getVCHeads();
+                const uint64_t* mask = portVCs(port);
+                int start = rr_vcs[port];
+
+                // VCs at or after the round robin VC, then the ones before it
+                int vc = nextSet(mask, num_vcs, start);
+                bool wrapped = false;
+                if ( vc == -1 ) {
+                    vc = nextSet(mask, start, 0);
+                    wrapped = true;
+                }
+                while ( vc != -1 ) {
+                    internal_router_event* src_event = vc_heads[vc];
+                    int next_port = src_event->getNextPort();
+
+                    // We can progress if the next port's input is not
+                    // busy and there are enough credits.
+                    if ( out_port_busy[next_port] <= 0 &&
+                         ports[next_port]->spaceToSend(src_event->getVC(), src_event->getFlitCount()) ) {
+
+                        // Tell the router what to move
+                        progress_vc[port] = vc;
+
+                        // Need to set the busy values
+                        in_port_busy[port] = src_event->getFlitCount();
+                        out_port_busy[next_port] = src_event->getFlitCount();
+                        break;  // Go to next port;
+                    }
+
+                    if ( !wrapped ) {
+                        vc = nextSet(mask, num_vcs, vc + 1);
+                        if ( vc == -1 ) {
+                            vc = nextSet(mask, start, 0);
+                            wrapped = true;
+                        }
+                    }
+                    else {
+                        vc = nextSet(mask, start, vc + 1);
+                    }
+                }
+            }
+            // Increment rr_vcs for next time
+            rr_vcs[port] = (rr_vcs[port] + 1) % num_vcs;
+        }
+        rr_port = (rr_port + 1) % num_ports;
+
+        return;
+    }
+
+    void reportSkippedCycles(Cycle_t cycles) {
+        rr_port = (rr_port + cycles) % num_ports;
+    }
+
+    // rr_vcs advances every cycle a port's input is idle.  rr_port is
+    // advanced by reportSkippedCycles()
+    void reportBlockedCycles(Cycle_t cycles, PortInterface** ports, int* in_port_busy, uint64_t* stall_cycles) {
+        for ( int i = 0; i < num_ports; i++ ) {
+            rr_vcs[i] = (rr_vcs[i] + idleInputCycles(cycles, in_port_busy[i])) % num_vcs;
+        }
+    }
+
+    void dumpState(std::ostream& stream) {
+        stream << "Current round robin port: " << rr_port << std::endl;
+        stream << "  Current round robin VC by port:" << std::endl;
+        for ( int i = 0; i < num_ports; i++ ) {
+            stream << i << ": " << rr_vcs[i] << std::endl;
+        }
+    }
+
+};
+
+}
+}
+
+#endif // COMPONENTS_HR_ROUTER_XBAR_ARB_RR_MASK_H
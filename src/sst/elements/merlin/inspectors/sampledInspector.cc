@@ -0,0 +1,149 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include <sst_config.h>
+
+#include "sampledInspector.h"
+
+#include <stdio.h>
+
+#include "sst/elements/merlin/merlin.h"
+
+namespace SST {
+namespace Merlin {
+
+SampledNetworkInspector::SampledNetworkInspector(ComponentId_t id, Params& params, const std::string& sub_id) :
+    SimpleNetwork::NetworkInspector(id),
+    window_start(0),
+    window_bits(0)
+{
+    sample_interval = params.find<uint32_t>("sample_interval", 100);
+    if ( sample_interval == 0 ) {
+        merlin_abort.fatal(CALL_INFO, -1, "SampledNetworkInspector: sample_interval must be at least 1\n");
+    }
+    countdown = sample_interval;
+
+    precision_bits = params.find<int>("latency_precision_bits", 3);
+    if ( precision_bits < 0 || precision_bits > 16 ) {
+        merlin_abort.fatal(CALL_INFO, -1, "SampledNetworkInspector: latency_precision_bits must be between 0 and 16\n");
+    }
+
+    UnitAlgebra period = params.find<UnitAlgebra>("sample_window_period", "0ns");
+    if ( !period.hasUnits("s") ) {
+        merlin_abort.fatal(CALL_INFO, -1, "SampledNetworkInspector: sample_window_period must be specified in units of s\n");
+    }
+    window_period = (period / UnitAlgebra("1ns")).getRoundedValue();
+    window_length = 0;
+    if ( window_period != 0 ) {
+        UnitAlgebra length = params.find<UnitAlgebra>("sample_window_length", "0ns");
+        if ( !length.hasUnits("s") ) {
+            merlin_abort.fatal(CALL_INFO, -1, "SampledNetworkInspector: sample_window_length must be specified in units of s\n");
+        }
+        window_length = (length / UnitAlgebra("1ns")).getRoundedValue();
+        if ( window_length == 0 || window_length > window_period ) {
+            merlin_abort.fatal(CALL_INFO, -1, "SampledNetworkInspector: sample_window_length must be greater than 0 and "
+                               "no longer than sample_window_period\n");
+        }
+    }
+
+    sampled_packets = registerStatistic<uint64_t>("sampled_packets", sub_id);
+    sampled_latency = registerStatistic<uint64_t>("sampled_latency", sub_id);
+    sampled_latency_bucket = registerStatistic<uint64_t>("sampled_latency_bucket", sub_id);
+    window_bits_stat = registerStatistic<uint64_t>("window_bits", sub_id);
+
+    std::vector<std::string> flows;
+    params.find_array<std::string>("flows", flows);
+    for ( auto& flow : flows ) {
+        int src, dest;
+        if ( sscanf(flow.c_str(), "%d:%d", &src, &dest) != 2 ) {
+            merlin_abort.fatal(CALL_INFO, -1, "SampledNetworkInspector: flows must be specified as src:dest, found %s\n", flow.c_str());
+        }
+        std::string flow_id = sub_id + "_" + std::to_string(src) + "_" + std::to_string(dest);
+        flow_latency_bucket[flowKey(src, dest)] = registerStatistic<uint64_t>("flow_latency_bucket", flow_id);
+    }
+}
+
+void
+SampledNetworkInspector::finish()
+{
+    // Record the window we ended in, along with any windows since the
+    // last packet
+    if ( window_period != 0 && inWindow(getCurrentSimTimeNano()) ) {
+        window_bits_stat->addData(window_bits);
+        window_bits = 0;
+    }
+}
+
+void
+SampledNetworkInspector::inspectNetworkData(SimpleNetwork::Request* req)
+{
+    // Generic path for users that don't know the injection time, so
+    // only packet counts and utilization are collected
+    inspect(req, NO_INJECTION_TIME);
+}
+
+uint64_t
+SampledNetworkInspector::getBucket(uint64_t value, int precision_bits)
+{
+    if ( value < (1ULL << precision_bits) ) return value;
+    int exp = (63 - __builtin_clzll(value)) - precision_bits;
+    return ((uint64_t)exp << precision_bits) + (value >> exp);
+}
+
+bool
+SampledNetworkInspector::advanceWindow(SimTime_t now)
+{
+    // The window starting at window_start is over
+    window_bits_stat->addData(window_bits);
+    window_bits = 0;
+
+    SimTime_t current = window_start / window_period;
+    SimTime_t next = now / window_period;
+    if ( next == current ) {
+        // Between windows
+        window_start += window_period;
+        return false;
+    }
+
+    // Windows that saw no packets
+    if ( next - current > 1 ) window_bits_stat->addDataNTimes(next - current - 1, 0);
+
+    window_start = next * window_period;
+    if ( now < window_start + window_length ) return true;
+
+    // The window containing now is already over and was idle
+    window_bits_stat->addData(0);
+    window_start += window_period;
+    return false;
+}
+
+void
+SampledNetworkInspector::recordSample(SimpleNetwork::Request* req, SimTime_t injection_time)
+{
+    sampled_packets->addData(1);
+    if ( injection_time == NO_INJECTION_TIME ) return;
+
+    SimTime_t latency = getCurrentSimTimeNano() - injection_time;
+    uint64_t bucket = getBucket(latency, precision_bits);
+    sampled_latency->addData(latency);
+    sampled_latency_bucket->addData(bucket);
+
+    if ( flow_latency_bucket.empty() ) return;
+    auto it = flow_latency_bucket.find(flowKey(req->src, req->dest));
+    if ( it != flow_latency_bucket.end() ) it->second->addData(bucket);
+}
+
+} // namespace Merlin
+} // namespace SST
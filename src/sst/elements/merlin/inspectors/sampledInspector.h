@@ -0,0 +1,129 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef COMPONENTS_MERLIN_SAMPLEDINSPECTOR_H
+#define COMPONENTS_MERLIN_SAMPLEDINSPECTOR_H
+
+#include <sst/core/subcomponent.h>
+#include <sst/core/interfaces/simpleNetwork.h>
+
+#include <unordered_map>
+
+namespace SST {
+using namespace SST::Interfaces;
+namespace Merlin {
+
+/*
+ * Network inspector that only looks at a sample of the packets leaving
+ * a port, so it can be left on for large runs.  Packets are sampled
+ * every sample_interval packets, optionally only inside periodic time
+ * windows.  Latencies are recorded as HDR histogram bucket indices:
+ * with p = latency_precision_bits, values below 2^p get their own
+ * bucket and larger values share buckets with a relative error of at
+ * most 2^-p.  Bucket b covers latencies starting at
+ * (b - (e << p)) << e, where e = max(0, (b >> p) - 1).
+ *
+ * PortControl recognizes this inspector and calls inspect() directly
+ * with the packet's injection time, so unsampled packets only cost a
+ * counter decrement.  Parameters are passed to inspectors through the
+ * portcontrol "inspector." scope, e.g. portcontrol.inspector.sample_interval.
+ */
+class SampledNetworkInspector : public SimpleNetwork::NetworkInspector {
+
+public:
+
+    SST_ELI_REGISTER_SUBCOMPONENT(
+        SampledNetworkInspector,
+        "merlin",
+        "sampled_network_inspector",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Samples packets leaving a port to collect latency histograms and link utilization with low overhead",
+        SST::Interfaces::SimpleNetwork::NetworkInspector
+    )
+
+    SST_ELI_DOCUMENT_PARAMS(
+        {"sample_interval",        "Sample every Nth packet (inside the sampling windows, if they are enabled).", "100"},
+        {"sample_window_period",   "Period of the sampling windows.  Set to 0 to sample for the whole simulation.", "0ns"},
+        {"sample_window_length",   "Length of each sampling window.  Required if sample_window_period is set."},
+        {"latency_precision_bits", "Number of sub-bucket bits in the latency histograms, which sets their relative precision.", "3"},
+        {"flows",                  "Array of src:dest endpoint pairs to collect separate latency histograms for.", "[]"}
+    )
+
+    SST_ELI_DOCUMENT_STATISTICS(
+        { "sampled_packets",        "Number of packets sampled", "packets", 1},
+        { "sampled_latency",        "Latency from injection to leaving this port for sampled packets", "ns", 1},
+        { "sampled_latency_bucket", "HDR histogram bucket of the latency for sampled packets", "bucket", 1},
+        { "flow_latency_bucket",    "HDR histogram bucket of the latency for sampled packets of a tracked flow", "bucket", 1},
+        { "window_bits",            "Bits sent on the port in each sampling window", "bits", 1}
+    )
+
+    SampledNetworkInspector(ComponentId_t id, Params& params, const std::string& sub_id);
+
+    void finish();
+
+    void inspectNetworkData(SimpleNetwork::Request* req);
+
+    // Fast path used by PortControl
+    inline void inspect(SimpleNetwork::Request* req, SimTime_t injection_time) {
+        if ( window_period != 0 ) {
+            if ( !inWindow(getCurrentSimTimeNano()) ) return;
+            window_bits += req->size_in_bits;
+        }
+        if ( --countdown != 0 ) return;
+        countdown = sample_interval;
+        recordSample(req, injection_time);
+    }
+
+    static uint64_t getBucket(uint64_t value, int precision_bits);
+
+private:
+    // Used when the injection time isn't known
+    static const SimTime_t NO_INJECTION_TIME = ~(SimTime_t)0;
+
+    uint32_t sample_interval;
+    uint32_t countdown;
+    int precision_bits;
+
+    SimTime_t window_period;
+    SimTime_t window_length;
+    // Start of the current window, or of the next one if we are
+    // between windows
+    SimTime_t window_start;
+    uint64_t window_bits;
+
+    Statistic<uint64_t>* sampled_packets;
+    Statistic<uint64_t>* sampled_latency;
+    Statistic<uint64_t>* sampled_latency_bucket;
+    Statistic<uint64_t>* window_bits_stat;
+
+    std::unordered_map<uint64_t, Statistic<uint64_t>*> flow_latency_bucket;
+
+    inline static uint64_t flowKey(SimpleNetwork::nid_t src, SimpleNetwork::nid_t dest) {
+        return ((uint64_t)(uint32_t)src << 32) | (uint32_t)dest;
+    }
+
+    inline bool inWindow(SimTime_t now) {
+        if ( now < window_start ) return false;
+        if ( now < window_start + window_length ) return true;
+        return advanceWindow(now);
+    }
+
+    bool advanceWindow(SimTime_t now);
+    void recordSample(SimpleNetwork::Request* req, SimTime_t injection_time);
+};
+
+} // namespace Merlin
+} // namespace SST
+#endif
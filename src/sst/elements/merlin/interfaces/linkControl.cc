@@ -29,7 +29,7 @@ namespace Merlin {
 
 LinkControl::LinkControl(ComponentId_t cid, Params &params, int vns) :
     SST::Interfaces::SimpleNetwork(cid),
-    rtr_link(nullptr), output_timing(nullptr), congestion_timing(nullptr),
+    rtr_link(nullptr), output_timing(nullptr), congestion_timing(nullptr), train_timing(nullptr),
     req_vns(vns), used_vns(0), total_vns(0), vn_out_map(nullptr),
     vn_remap_out(nullptr), output_queues(nullptr), router_credits(nullptr),
     router_return_credits(nullptr), input_queues(nullptr),
@@ -80,6 +80,10 @@ LinkControl::LinkControl(ComponentId_t cid, Params &params, int vns) :
     output_timing = configureSelfLink(port_name + "_output_timing", "1GHz",
             new Event::Handler<LinkControl>(this,&LinkControl::handle_output));
 
+    // Always configured, since any sender may use packet trains
+    train_timing = configureSelfLink(port_name + "_train_timing", "1GHz",
+            new Event::Handler<LinkControl>(this,&LinkControl::handle_train));
+
     congestion_timing = configureSelfLink(port_name = "_congestion_timing", getCoreTimeBase().toString(),
             new Event::Handler<LinkControl>(this,&LinkControl::handle_congestion));
 
@@ -149,6 +153,15 @@ LinkControl::LinkControl(ComponentId_t cid, Params &params, int vns) :
     idle_time = registerStatistic<uint64_t>("idle_time");
     // recv_bit_count = registerStatistic<uint64_t>("recv_bit_count");
 
+    train_max = params.find<int>("packet_train_max",1);
+    if ( train_max < 1 ) {
+        merlin_abort.fatal(CALL_INFO,1,"LinkControl: packet_train_max must be at least 1\n");
+    }
+    train_max_flits = params.find<int>("packet_train_max_flits",0);
+    packets_per_train = registerStatistic<uint64_t>("packets_per_train");
+    train_splits = registerStatistic<uint64_t>("train_splits");
+    train_packets_received = registerStatistic<uint64_t>("train_packets_received");
+
     last_time = 0;
     last_recv_time = 0;
 }
@@ -164,6 +177,15 @@ LinkControl::~LinkControl()
 
 void LinkControl::setup()
 {
+    // All the router credits have arrived by now, so they are the
+    // size of the router input buffers
+    if ( train_max > 1 && train_max_flits == 0 ) {
+        train_max_flits = 0x7fffffff;
+        for ( int i = 0; i < used_vns; ++i ) {
+            train_max_flits = std::min(train_max_flits, router_credits[output_queues[i].vn]);
+        }
+    }
+
     while ( init_events.size() ) {
         delete init_events.front();
         init_events.pop_front();
@@ -230,6 +252,7 @@ void LinkControl::init(unsigned int phase)
         UnitAlgebra link_clock = link_bw / flit_size_ua;
         TimeConverter* tc = getTimeConverter(link_clock);
         output_timing->setDefaultTimeBase(tc);
+        train_timing->setDefaultTimeBase(tc);
 
         // Initialize links
         // Receive the endpoint ID from PortControl
@@ -595,33 +618,58 @@ void LinkControl::handle_input(Event* ev)
     }
     else {
         RtrEvent* event = static_cast<RtrEvent*>(ev);
-        // Simply put the event into the right virtual network queue
-        // int orig_vn = event->getOriginalVN();
-        int vn = event->getLogicalVN();
-        // event->request->vn = orig_vn;
-
-        input_queues[vn].push(event);
-        if (is_idle) {
-            idle_time->addData(getCurrentSimCycle() - idle_start);
-            is_idle = false;
-        }
-        if ( event->getTraceType() == SimpleNetwork::Request::FULL ) {
-            output.output("TRACE(%d): %" PRIu64 " ns: Received and event on LinkControl in NIC: %s"
-                          " on VN %d from src %" PRIu64 "\n",
-                          event->getTraceID(),
-                          getCurrentSimTimeNano(),
-                          getName().c_str(),
-                          event->getRouteVN(),
-                          event->getTrustedSrc());
+        if ( event->getTrainLength() > 1 ) {
+            // Deliver the rest of the train at the times the packets
+            // would have arrived if sent back-to-back
+            std::vector<SST::Interfaces::SimpleNetwork::Request*> reqs;
+            event->takeTrain(reqs, flit_size);
+            SimTime_t offset = event->getSizeInFlits();
+            for ( auto req : reqs ) {
+                RtrEvent* member = new RtrEvent(req, event->getTrustedSrc(), event->getRouteVN());
+                member->computeSizeInFlits(flit_size);
+                member->setInjectionTime(event->getInjectionTime());
+                train_timing->send(offset, member);
+                offset += member->getSizeInFlits();
+            }
+            train_packets_received->addData(reqs.size());
         }
+        deliverPacket(event);
+    }
+}
 
-        SimTime_t lat = getCurrentSimTimeNano() - event->getInjectionTime();
-        // recv_bit_count->addData(event->getSizeInBits());
-        packet_latency->addData(lat);
-        if ( receiveFunctor != nullptr ) {
-            bool keep = (*receiveFunctor)(vn);
-            if ( !keep) receiveFunctor = nullptr;
-        }
+void LinkControl::handle_train(Event* ev)
+{
+    deliverPacket(static_cast<RtrEvent*>(ev));
+}
+
+void LinkControl::deliverPacket(RtrEvent* event)
+{
+    // Simply put the event into the right virtual network queue
+    // int orig_vn = event->getOriginalVN();
+    int vn = event->getLogicalVN();
+    // event->request->vn = orig_vn;
+
+    input_queues[vn].push(event);
+    if (is_idle) {
+        idle_time->addData(getCurrentSimCycle() - idle_start);
+        is_idle = false;
+    }
+    if ( event->getTraceType() == SimpleNetwork::Request::FULL ) {
+        output.output("TRACE(%d): %" PRIu64 " ns: Received and event on LinkControl in NIC: %s"
+                      " on VN %d from src %" PRIu64 "\n",
+                      event->getTraceID(),
+                      getCurrentSimTimeNano(),
+                      getName().c_str(),
+                      event->getRouteVN(),
+                      event->getTrustedSrc());
+    }
+
+    SimTime_t lat = getCurrentSimTimeNano() - event->getInjectionTime();
+    // recv_bit_count->addData(event->getSizeInBits());
+    packet_latency->addData(lat);
+    if ( receiveFunctor != nullptr ) {
+        bool keep = (*receiveFunctor)(vn);
+        if ( !keep) receiveFunctor = nullptr;
     }
 }
 
@@ -693,6 +741,11 @@ void LinkControl::handle_output(Event* ev)
     }
     // If we found an event to send, go ahead and send it
     if ( found ) {
+        // Throttled destinations are sent one packet at a time
+        if ( train_max > 1 && congestion_state.count(send_event->getDest()) == 0 ) {
+            buildTrain(send_event, output_queues[vn_to_send]);
+        }
+
         // Need to return credits to the output buffer
         int size = send_event->getSizeInFlits();
         output_queues[vn_to_send].credits += size;
@@ -730,7 +783,7 @@ void LinkControl::handle_output(Event* ev)
 
         rtr_link->send(send_event);
         last_recv_time = getCurrentSimCycle();
-        sent++;
+        sent += send_event->getTrainLength();
 
         if ( send_event->getTraceType() == SimpleNetwork::Request::FULL ) {
             output.output("TRACE(%d): %" PRIu64 " ns: Sent an event to router from LinkControl"
@@ -775,6 +828,35 @@ void LinkControl::handle_output(Event* ev)
     }
 }
 
+// Adds the packets queued directly behind head that go to the same
+// destination, as long as the train fits in the router credits.  Only
+// packets that are already queued are used, so a train never waits
+// for more data.
+void LinkControl::buildTrain(RtrEvent* head, output_queue_bundle_t& out_handle)
+{
+    int length = 1;
+    if ( head->getTraceType() == SimpleNetwork::Request::NONE ) {
+        int credits = router_credits[out_handle.vn];
+        while ( length < train_max && !out_handle.queue.empty() ) {
+            RtrEvent* next = out_handle.queue.front();
+            if ( next->getDest() != head->getDest() || next->getLogicalVN() != head->getLogicalVN() ||
+                 next->getTraceType() != SimpleNetwork::Request::NONE ) {
+                break;
+            }
+            int flits = head->getSizeInFlits() + next->getSizeInFlits();
+            if ( flits > credits || flits > train_max_flits ) {
+                train_splits->addData(1);
+                break;
+            }
+            out_handle.queue.pop();
+            head->addToTrain(next);
+            delete next;
+            length++;
+        }
+    }
+    packets_per_train->addData(length);
+}
+
 void LinkControl::handle_congestion(Event* ev)
 {
     if ( waiting ) output_timing->send(0,nullptr);
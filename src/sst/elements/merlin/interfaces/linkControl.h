@@ -69,6 +69,10 @@ public:
         {"use_nid_remap",      "If true, will remap logical nids in job to physical ids", "false" },
         {"nid_map_name",       "Base name of shared region where my NID map will be located.  If empty, no NID map will be used.",""},
         {"vn_remap",           "Remap VNs onto/off of the network.  If empty, no vn remapping is done", "" },
+        {"packet_train_max",   "Maximum number of back-to-back packets to the same destination that are sent through the network "
+                               "as a single event.  1 disables packet trains.", "1" },
+        {"packet_train_max_flits", "Maximum size of a packet train in flits.  Must not be larger than any router buffer on the path.  "
+                               "0 uses the router input buffer size.", "0" },
 
     )
 
@@ -77,6 +81,9 @@ public:
         { "send_bit_count",     "Count number of bits sent on link", "bits", 1},
         { "output_port_stalls", "Time output port is stalled (in units of core timebase)", "time in stalls", 1},
         { "idle_time",          "Number of (in unites of core timebas) that port was idle", "time spent idle", 1},
+        { "packets_per_train",  "Number of packets carried by each event sent to the router when packet trains are enabled", "packets", 1},
+        { "train_splits",       "Number of times a packet train was ended early because of router credits or packet_train_max_flits", "count", 1},
+        { "train_packets_received", "Number of packets received as the trailing part of a packet train", "packets", 1},
         // { "recv_bit_count",     "Count number of bits received on the link", "bits", 1},
     )
 
@@ -106,6 +113,12 @@ private:
     // Self link to use when waiting to send because of a congestion
     // eveng
     Link* congestion_timing;
+    // Self link used to deliver the trailing packets of a packet
+    // train at the times they would have arrived on their own
+    Link* train_timing;
+
+    int train_max;
+    int train_max_flits;
 
     // Perforamne paramters
     UnitAlgebra link_bw;
@@ -211,6 +224,9 @@ private:
     Statistic<uint64_t>* output_port_stalls;
     Statistic<uint64_t>* idle_time;
     Statistic<uint64_t>* recv_bit_count;
+    Statistic<uint64_t>* packets_per_train;
+    Statistic<uint64_t>* train_splits;
+    Statistic<uint64_t>* train_packets_received;
 
     RtrInitEvent* checkInitProtocol(Event* ev, RtrInitEvent::Commands command, uint32_t line, const char* file, const char* func);
 
@@ -267,6 +283,10 @@ private:
     void handle_input(Event* ev);
     void handle_output(Event* ev);
     void handle_congestion(Event* ev);
+    void handle_train(Event* ev);
+
+    void deliverPacket(RtrEvent* event);
+    void buildTrain(RtrEvent* head, output_queue_bundle_t& out_handle);
 
     int sent;
 
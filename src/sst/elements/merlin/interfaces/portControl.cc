@@ -35,8 +35,8 @@ PortControl::recvCtrlEvent(CtrlRtrEvent* ev)
     // sending data.
     CongestionEvent* cev = static_cast<CongestionEvent*>(ev);
     int src = cev->getTarget();
-    auto cs = congestion_map.find(src);
-    if ( cs != congestion_map.end() ) cs->second.reported_done = true;
+    CongestionInfo* cs = findCongestionInfo(src);
+    if ( cs != NULL ) cs->reported_done = true;
 }
 
 void
@@ -121,7 +121,7 @@ PortControl::recv(int vc)
 	// Need to update vc_heads
 	if ( input_buf[vc].empty() ) {
 	    vc_heads[vc] = NULL;
-	    parent->dec_vcs_with_data();
+	    parent->dec_vcs_with_data(port_number, vc);
 	}
 	else {
         auto event = input_buf[vc].front();
@@ -160,8 +160,7 @@ PortControl::reportIncomingEvent(internal_router_event* ev)
 
     // Record the event
     int src = ev->getSrc();
-    auto cs = congestion_map.emplace(src,src);
-    CongestionInfo& info = cs.first->second;
+    CongestionInfo& info = addCongestionInfo(src);
 
     bool new_incast = false;
 
@@ -210,14 +209,14 @@ PortControl::reportIncomingEvent(internal_router_event* ev)
 
         // Send congestion notificaitons
         for ( auto& x : congestion_map ) {
-            if ( current_incast > x.second.throttle && x.second.active ) {
+            if ( x.valid && current_incast > x.throttle && x.active ) {
                 CongestionEvent* cev = new CongestionEvent(0, topo->getEndpointID(port_number), current_incast,
-                                                           // x.second.throttle == 0 ? throttle_time : 0 );
+                                                           // x.throttle == 0 ? throttle_time : 0 );
                                                            throttle_time);
-                if ( x.second.throttle == 0 ) x.second.expiration_time += throttle_time;
-                cev->setEndpointDest(x.first);
+                if ( x.throttle == 0 ) x.expiration_time += throttle_time;
+                cev->setEndpointDest(x.src);
                 parent->sendCtrlEvent(cev);
-                x.second.throttle = current_incast;
+                x.throttle = current_incast;
             }
         }
     }
@@ -428,17 +427,30 @@ PortControl::PortControl(ComponentId_t cid, Params& params,  Router* rif, int rt
     params.find_array<std::string>("network_inspectors",inspector_names);
 
     // Create any NetworkInspectors
+    Params inspector_params = params.get_scoped_params("inspector");
     for ( unsigned int i = 0; i < inspector_names.size(); i++ ) {
-        Params empty;
         SimpleNetwork::NetworkInspector* ni = loadAnonymousSubComponent<SimpleNetwork::NetworkInspector>
-            (inspector_names[i], "inspector_slot", i, ComponentInfo::INSERT_STATS, empty, port_name);
+            (inspector_names[i], "inspector_slot", i, ComponentInfo::INSERT_STATS, inspector_params, port_name);
         if ( ni == NULL ) {
             merlin_abort.fatal(CALL_INFO,1,"NetworkInspector: %s, not found.\n",inspector_names[i].c_str());
         }
-        network_inspectors.push_back(ni);
+        SampledNetworkInspector* sni = dynamic_cast<SampledNetworkInspector*>(ni);
+        if ( sni != NULL ) sampled_inspectors.push_back(sni);
+        else network_inspectors.push_back(ni);
     }
 
     dlink_thresh = params.find<float>("dlink_thresh",-1.0);
+
+    double background_load = params.find<double>("background_load", 0.0);
+    if ( background_load < 0.0 || background_load >= 1.0 ) {
+        merlin_abort.fatal(CALL_INFO,-1,"PortControl: background_load must be at least 0 and less than 1: %f\n",background_load);
+    }
+    background_ratio = background_load / (1.0 - background_load);
+    background_debt = 0;
+    background_occupancy = params.find<double>("background_occupancy", 0.0);
+    if ( background_occupancy < 0.0 || background_occupancy >= 1.0 ) {
+        merlin_abort.fatal(CALL_INFO,-1,"PortControl: background_occupancy must be at least 0 and less than 1: %f\n",background_occupancy);
+    }
     // Unless otherwise stated, we will turn on track port if we are a host port
     oql_track_port = params.find<bool>("oql_track_port",host_port);
     oql_track_remote = params.find<bool>("oql_track_remote",false);
@@ -534,6 +546,14 @@ PortControl::initVCs(int vns, int* vcs_per_vn, internal_router_event** vc_heads_
         port_out_credits[i] = 0;
     }
 
+    // Every event is at least one flit, so the buffer sizes in flits
+    // bound how many events the queues can hold.  Very large buffers
+    // start smaller and grow if they ever fill.
+    for ( int i = 0; i < num_vcs; i++ ) {
+        input_buf[i].reserve(std::min<int64_t>(ibs.getRoundedValue(), max_reserved_events));
+        output_buf[i].reserve(std::min<int64_t>(obs.getRoundedValue(), max_reserved_events));
+    }
+
 
     // Need to start the timer for links that never send data
     idle_start = getCurrentSimCycle();
@@ -552,6 +572,9 @@ PortControl::~PortControl() {
     for ( unsigned int i = 0; i < network_inspectors.size(); i++ ) {
         delete network_inspectors[i];
     }
+    for ( unsigned int i = 0; i < sampled_inspectors.size(); i++ ) {
+        delete sampled_inspectors[i];
+    }
 }
 
 void
@@ -562,6 +585,14 @@ PortControl::setup() {
         output_timing->replaceFunctor(new Event::Handler<PortControl>(this,&PortControl::handle_failed));
     }
 	if (dlink_thresh >= 0) dynlink_timing->send(1,NULL);
+    // All the initial credits have arrived, so hold back the share
+    // used by background traffic.  The credits are never returned, so
+    // the reservation lasts for the whole simulation.
+    if ( background_occupancy > 0 ) {
+        for ( int i = 0; i < num_vcs; i++ ) {
+            port_out_credits[i] -= (int)(port_out_credits[i] * background_occupancy);
+        }
+    }
     while ( init_events.size() ) {
         delete init_events.front();
         init_events.pop_front();
@@ -596,6 +627,9 @@ PortControl::finish() {
     for ( unsigned int i = 0; i < network_inspectors.size(); i++ ) {
         network_inspectors[i]->finish();
     }
+    for ( unsigned int i = 0; i < sampled_inspectors.size(); i++ ) {
+        sampled_inspectors[i]->finish();
+    }
 }
 
 RtrInitEvent* PortControl::checkInitProtocol(Event* ev, RtrInitEvent::Commands command, uint32_t line, const char* file, const char* func)
@@ -960,7 +994,7 @@ PortControl::handle_input_n2r(Event* ev)
 	    if ( vc_heads[curr_vc] == NULL ) {
             topo->route_packet(port_number, rtr_event->getVC(), rtr_event);
             vc_heads[curr_vc] = rtr_event;
-            parent->inc_vcs_with_data();
+            parent->inc_vcs_with_data(port_number, curr_vc);
 	    }
 
 	    if ( event->getTraceType() != SST::Interfaces::SimpleNetwork::Request::NONE ) {
@@ -1043,7 +1077,7 @@ PortControl::handle_input_r2r(Event* ev)
 	    if ( vc_heads[curr_vc] == NULL ) {
             topo->route_packet(port_number, event->getVC(), event);
             vc_heads[curr_vc] = event;
-            parent->inc_vcs_with_data();
+            parent->inc_vcs_with_data(port_number, curr_vc);
 	    }
 
 	    if ( event->getTraceType() != SimpleNetwork::Request::NONE ) {
@@ -1113,6 +1147,7 @@ PortControl::handle_output(Event* ev) {
 	    // Need to return credits to the output buffer
 	    int size = send_event->getFlitCount();
 	    xbar_in_credits[vc_to_send] += size;
+	    if ( parent->getRequestNotifyOnCredit() ) parent->notifyEvent();
         if ( !oql_track_remote ) {
             if ( oql_track_port ) {
                 for ( int i = 0; i < num_vcs; ++i ) {
@@ -1125,7 +1160,7 @@ PortControl::handle_output(Event* ev) {
         }
 
 	    // Send an event to wake up again after this packet is sent.
-	    output_timing->send(size,NULL);
+	    output_timing->send(size + getBackgroundFlits(size),NULL);
 
 	    // Subtract credits
 	    port_out_credits[vc_to_send] -= size;
@@ -1154,6 +1189,10 @@ PortControl::handle_output(Event* ev) {
         for ( unsigned int i = 0; i < network_inspectors.size(); i++ ) {
             network_inspectors[i]->inspectNetworkData(send_event->inspectRequest());
         }
+        for ( unsigned int i = 0; i < sampled_inspectors.size(); i++ ) {
+            sampled_inspectors[i]->inspect(send_event->inspectRequest(),
+                                           send_event->getEncapsulatedEvent()->getInjectionTime());
+        }
 
 	    if ( host_port ) {
             if ( enable_congestion_management ) {
@@ -1314,16 +1353,16 @@ PortControl::updateCongestionState(internal_router_event* send_event)
     // Update the congestion state.  We react slightly differently
     // depending on if cm has been activated or not.
     int src = send_event->getSrc();
-    auto item = congestion_map.find(src);
-    if ( item != congestion_map.end() ) {
-        CongestionInfo& ci = item->second;
+    CongestionInfo* item = findCongestionInfo(src);
+    if ( item != NULL ) {
+        CongestionInfo& ci = *item;
         ci.count--;
         ci.flit_count -= send_event->getFlitCount();
         if ( ci.active ) total_incast_flits -= send_event->getFlitCount();
 
         // If stream is inactive and count is zero, we remove it
         if ( ci.count == 0 && !ci.active ) {
-            congestion_map.erase(src);
+            eraseCongestionInfo(src);
         }
     }
 
@@ -1371,10 +1410,8 @@ PortControl::updateCongestionState(internal_router_event* send_event)
             // reaches zero.
             if ( ci_exp->count == 0 ) {
                 // Really time to go.  Remove this from the
-                // congestion_map.  This will invalidate the reference we
-                // have, so be careful.
-                int src = ci_exp->src;
-                congestion_map.erase(src);
+                // congestion_map.
+                eraseCongestionInfo(ci_exp->src);
             }
             else {
                 ci_exp->active = false;
@@ -1399,11 +1436,11 @@ PortControl::updateCongestionState(internal_router_event* send_event)
         // Need to send updates to the throttle information
         // Send congestion notificaitons
         for ( auto& x : congestion_map ) {
-            if ( x.second.active ) {
+            if ( x.valid && x.active ) {
                 CongestionEvent* cev = new CongestionEvent(0, topo->getEndpointID(port_number), send_incast, 0 );
-                cev->setEndpointDest(x.first);
+                cev->setEndpointDest(x.src);
                 parent->sendCtrlEvent(cev);
-                x.second.throttle = send_incast;
+                x.throttle = send_incast;
             }
         }
     }
@@ -30,8 +30,10 @@
 #include <sst/core/statapi/stataccumulator.h>
 
 #include <cstring>
+#include <deque>
 
 #include "sst/elements/merlin/router.h"
+#include "sst/elements/merlin/inspectors/sampledInspector.h"
 
 using namespace SST;
 
@@ -63,7 +65,10 @@ public:
         {"input_buf_size",     "Size of input buffers specified in b or B (can include SI prefix)."},
         {"output_buf_size",    "Size of output buffers specified in b or B (can include SI prefix)."},
         {"network_inspectors", "Comma separated list of network inspectors to put on output ports.", ""},
+        {"inspector.*",        "Parameters passed to the network inspectors.", ""},
         {"dlink_thresh",       ""},
+        {"background_load",    "Fraction of the link bandwidth used by modeled background traffic.  Packets sent on the port are slowed down to share the link with it.", "0"},
+        {"background_occupancy", "Fraction of the downstream buffers on each VC held by modeled background traffic.", "0"},
         {"num_vns",            "Number of VNs set in router or python file (-1 if not set in the parent router)."},
         {"vn_remap_shm",       "Name of shared memory region for vn remapping.  If empty, no remapping is done", ""},
         {"vn_remap_shm_size",  "Size of shared memory region for vn remapping.  If empty, no remapping is done", "-1"},
@@ -108,6 +113,21 @@ private:
 	// i.e. if (idle > dlink_thresh) then reduce link width.
 	float dlink_thresh;
 
+    // Analytical background traffic.  Its share of the link bandwidth
+    // is charged as extra output cycles per flit sent and its share of
+    // the downstream buffers is held back from the output credits.
+    double background_ratio;
+    double background_debt;
+    double background_occupancy;
+
+    inline int getBackgroundFlits(int flits) {
+        if ( background_ratio == 0 ) return 0;
+        background_debt += flits * background_ratio;
+        int extra = (int)background_debt;
+        background_debt -= extra;
+        return extra;
+    }
+
 	// Self link for disabling a port temporarily
 	Link* disable_timing;
 
@@ -146,6 +166,9 @@ private:
     port_queue_t* input_buf;
     port_queue_t* output_buf;
 
+    // Most entries preallocated in each VC's queue
+    static const int max_reserved_events = 4096;
+
     // Need an output queue for topology events.  Incoming topology
     // events will be directed right to the topolgy object.
     ctrl_queue_t ctrl_queue;
@@ -247,7 +270,7 @@ private:
 
     // For supporting congestion management
     struct CongestionInfo {
-        const int32_t  src;
+        int32_t  src;
         uint32_t  count;
         uint32_t  total_count;
         uint32_t  flit_count;
@@ -256,8 +279,10 @@ private:
         SimTime_t expiration_time;
         bool active;
         bool reported_done;
+        bool valid;
 
-        CongestionInfo(uint32_t src) : src(src), count(0), total_count(0), flit_count(0), throttle(0),last_seen(0), expiration_time(0), active(false), reported_done(false)  {}
+        CongestionInfo() : src(-1), valid(false) {}
+        CongestionInfo(uint32_t src) : src(src), count(0), total_count(0), flit_count(0), throttle(0),last_seen(0), expiration_time(0), active(false), reported_done(false), valid(true)  {}
 
     };
 
@@ -296,7 +321,9 @@ private:
     int cm_pktsize_threshold;
     double cm_window_factor;
 
-    std::map<uint32_t,CongestionInfo> congestion_map;
+    // Indexed by src.  A deque so growing it doesn't move entries
+    // that are referenced from the expiration queue.
+    std::deque<CongestionInfo> congestion_map;
     std::priority_queue<CongestionInfo*, std::vector<CongestionInfo* >, congestion_info_expiration_pq_order> expiration_queue;
     int current_incast;
     int total_flits_incoming;
@@ -304,6 +331,19 @@ private:
     int congestion_events;
     int congestion_count_at_last_throttle;
 
+    inline CongestionInfo* findCongestionInfo(int src) {
+        if ( src < 0 || src >= (int)congestion_map.size() || !congestion_map[src].valid ) return NULL;
+        return &congestion_map[src];
+    }
+
+    inline CongestionInfo& addCongestionInfo(int src) {
+        if ( src >= (int)congestion_map.size() ) congestion_map.resize(src + 1);
+        if ( !congestion_map[src].valid ) congestion_map[src] = CongestionInfo(src);
+        return congestion_map[src];
+    }
+
+    inline void eraseCongestionInfo(int src) { congestion_map[src].valid = false; }
+
 public:
 
     void recvCtrlEvent(CtrlRtrEvent* ev);
@@ -347,6 +387,9 @@ public:
 private:
 
     std::vector<SST::Interfaces::SimpleNetwork::NetworkInspector*> network_inspectors;
+    // Sampled inspectors are called directly, which avoids a virtual
+    // call per packet and gives them the injection time
+    std::vector<SampledNetworkInspector*> sampled_inspectors;
 
     void dumpQueueState(port_queue_t& q, std::ostream& stream);
     void dumpQueueState(port_queue_t& q, Output& out);
@@ -30,6 +30,11 @@ ReorderLinkControl::ReorderLinkControl(ComponentId_t cid, Params &params, int vn
     receiveFunctor(NULL),
     vns(vns)
 {
+    int window = params.find<int>("reorder_window", 64);
+    if ( window < 1 ) window = 1;
+    window_size = 1;
+    while ( window_size < (size_t)window ) window_size <<= 1;
+
     if ( isUser() ) {
         // Need to see if the network_if was loaded as a user subcomponent
         link_control = loadUserSubComponent<SimpleNetwork>("networkIF", ComponentInfo::SHARE_NONE, vns);
@@ -125,13 +130,7 @@ bool ReorderLinkControl::send(SimpleNetwork::Request* req, int vn) {
     delete req;
 
     // Need to put in the sequence number
-
-    // See if we already have reorder_info for this dest
-    if ( reorder_info.find(my_req->dest) == reorder_info.end() ) {
-        ReorderInfo* info = new ReorderInfo();
-        reorder_info[my_req->dest] = info;
-    }
-    ReorderInfo* info = reorder_info[my_req->dest];
+    ReorderInfo* info = getReorderInfo(my_req->dest);
     my_req->seq = info->send++;
 
     // // To test, just going to switch order
@@ -207,25 +206,17 @@ bool ReorderLinkControl::handle_event(int vn) {
 
     // std::cout << id << ": recieved packet with sequence number " << my_req->seq << std::endl;
 
-    if ( reorder_info.find(my_req->src) == reorder_info.end() ) {
-        ReorderInfo* info = new ReorderInfo();
-        reorder_info[my_req->src] = info;
-    }
-
-    ReorderInfo* info = reorder_info[my_req->src];
+    ReorderInfo* info = getReorderInfo(my_req->src);
 
     // See if this is the expected sequence number, if not, put it
-    // into the ReorderInfo.queue.
+    // into the ReorderInfo.window.
     if ( my_req->seq == info->recv ) {
         input_buf[vn].push(my_req);
         info->recv++;
         // Need to also see if we have any other fragments which are
         // now ready to be delivered
-        my_req = info->queue.top();
-        while ( my_req->seq == info->recv ) {
+        while ( (my_req = info->next()) != NULL ) {
             input_buf[vn].push(my_req);
-            info->queue.pop();
-            my_req = info->queue.top();
             info->recv++;
         }
 
@@ -241,12 +232,18 @@ bool ReorderLinkControl::handle_event(int vn) {
 
     }
     else {
-        info->queue.push(my_req);
+        info->buffer(my_req);
     }
 
     return true;
 }
 
+ReorderInfo* ReorderLinkControl::getReorderInfo(SimpleNetwork::nid_t nid) {
+    ReorderInfo*& info = reorder_info[nid];
+    if ( info == NULL ) info = new ReorderInfo(window_size);
+    return info;
+}
+
 // bool ReorderLinkControl::handle_send(int vn) {
 //     if ( sendFunctor != NULL ) {
 //         bool keep = (*sendFunctor)(vn);
@@ -28,6 +28,7 @@
 
 #include <queue>
 #include <unordered_map>
+#include <vector>
 
 namespace SST {
 
@@ -64,19 +65,6 @@ public:
 
     ~ReorderRequest() {}
 
-
-    // This is here just for the priority_queue insertion, so is
-    // sorting based on what comes out of queue first (i.e. lowest
-    // number, which makes this look backwards)
-    class Priority {
-    public:
-        bool operator()(ReorderRequest* const& lhs, ReorderRequest* const& rhs) {
-            return lhs->seq > rhs->seq;
-        }
-    };
-
-    typedef std::priority_queue<ReorderRequest*, std::vector<ReorderRequest*>, Priority> PriorityQueue;
-
     void serialize_order(SST::Core::Serialization::serializer &ser)  override {
         SST::Interfaces::SimpleNetwork::Request::serialize_order(ser);
         ser & seq;
@@ -91,26 +79,49 @@ private:
 struct ReorderInfo {
     uint32_t send;
     uint32_t recv;
-    ReorderRequest::PriorityQueue queue;
 
-    ReorderInfo() :
+    // Fragments that arrived ahead of recv, in slot seq & (size - 1)
+    // with NULL for the ones still missing.  Everything buffered is
+    // within size of recv, so slots can't collide.  The size is a
+    // power of 2 and doubles when a fragment arrives too far ahead.
+    // Sequence numbers are only compared by difference, so they can
+    // wrap.
+    std::vector<ReorderRequest*> window;
+
+    ReorderInfo(size_t window_size) :
         send(0),
-        recv(0)
-    {
-        // Put a dummy entry into queue to avoid checks for NULL later
-        // on when looking for fragments to deliver.  This does mean
-        // we can't handle more than 4 billion fragments to each host
-        // with overflow.
-        ReorderRequest* req = new ReorderRequest();
-        req->seq = 0xffffffff;
-        queue.push(req);
+        recv(0),
+        window(window_size, NULL)
+    {}
+
+    void buffer(ReorderRequest* req) {
+        while ( (uint32_t)(req->seq - recv) >= window.size() ) grow();
+        window[req->seq & (window.size() - 1)] = req;
+    }
+
+    // Removes and returns the fragment with sequence number recv, or
+    // NULL if it hasn't arrived
+    ReorderRequest* next() {
+        ReorderRequest*& slot = window[recv & (window.size() - 1)];
+        ReorderRequest* req = slot;
+        slot = NULL;
+        return req;
+    }
+
+private:
+    void grow() {
+        std::vector<ReorderRequest*> bigger(2 * window.size(), NULL);
+        for ( ReorderRequest* req : window ) {
+            if ( req ) bigger[req->seq & (bigger.size() - 1)] = req;
+        }
+        window.swap(bigger);
     }
 };
 
 // Version of LinkControl that will allow out of order receive, but
 // will make things appear in order to NIC.  The current version will
-// have essentially infinite resources and is here just to get
-// functionality working.
+// have essentially infinite resources, the reorder window for a source
+// grows as needed.
 class ReorderLinkControl : public SST::Interfaces::SimpleNetwork {
 public:
 
@@ -125,7 +136,8 @@ public:
 
     SST_ELI_DOCUMENT_PARAMS(
         {"rlc.networkIF","SimpleNetwork subcomponent to be used for connecting to network", "merlin.linkcontrol"},
-        {"networkIF","SimpleNetwork subcomponent to be used for connecting to network", "merlin.linkcontrol"}
+        {"networkIF","SimpleNetwork subcomponent to be used for connecting to network", "merlin.linkcontrol"},
+        {"reorder_window","Number of out of order packets that can be held per source before the window has to grow. Rounded up to a power of 2.", "64"}
     )
 
     SST_ELI_DOCUMENT_PORTS(
@@ -147,6 +159,7 @@ private:
     int id;
 
     std::unordered_map<SST::Interfaces::SimpleNetwork::nid_t, ReorderInfo*> reorder_info;
+    size_t window_size;
 
     // One buffer for each virtual network.  At the NIC level, we just
     // provide a virtual channel abstraction.  Don't need output
@@ -201,6 +214,7 @@ public:
 private:
 
     bool handle_event(int vn);
+    ReorderInfo* getReorderInfo(SST::Interfaces::SimpleNetwork::nid_t nid);
 };
 
 }
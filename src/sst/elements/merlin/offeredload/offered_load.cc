@@ -210,6 +210,7 @@ OfferedLoad::init(unsigned int phase) {
         id = link_if->getEndpointID();
         std::string pattern = pattern_params->find<std::string>("pattern_gen");
         packetDestGen = loadAnonymousSubComponent<TargetGenerator>(pattern, "pattern_gen", 0, ComponentInfo::SHARE_NONE, *pattern_params, id, num_peers);
+        packetDests.setGenerator(packetDestGen);
         delete pattern_params;
     }
 
@@ -323,7 +324,7 @@ void
 OfferedLoad::progress_messages(SimTime_t current_time) {
     while ( (next_time <= current_time) && link_if->spaceToSend(0,packet_size) ) {
         offered_load_event* ev = new offered_load_event(next_time);
-        SimpleNetwork::Request* req = new SimpleNetwork::Request(packetDestGen->getNextValue(), id, packet_size, true, true, ev);
+        SimpleNetwork::Request* req = new SimpleNetwork::Request(packetDests.getNextValue(), id, packet_size, true, true, ev);
         link_if->send(req,0);
 
         next_time += send_interval;
@@ -176,6 +176,7 @@ private:
 
 
     TargetGenerator *packetDestGen;
+    TargetBuffer packetDests;
 
     Output out;
     int id;
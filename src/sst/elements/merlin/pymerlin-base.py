@@ -597,11 +597,14 @@ class TemplateBase(_AttributeManager):
 
 # Classes implementing topology
 class Topology(TemplateBase):
+    _topology_param_sets = set()
+
     def __init__(self):
         TemplateBase.__init__(self)
-        self._declareClassVariables(["network_name","endPointLinks","built","router"])
+        self._declareClassVariables(["network_name","endPointLinks","built","router","partition_by_locality"])
 
         self.network_name = ""
+        self.partition_by_locality = False
         self._setCallbackOnWrite("network_name",self._network_name_callback)
 
         self._setCallbackOnWrite("router",self._router_callback)
@@ -646,6 +649,26 @@ class Topology(TemplateBase):
         return sst.findComponentByName(self.getRouterNameForId(rtr_id))
     def _instanceRouter(self,radix,rtr_id):
         return self.router.instanceRouter(self.getRouterNameForId(rtr_id), radix, rtr_id)
+    # Give a router's topology subcomponent the "main" params.  They
+    # are the same for every router, so they go into one global param
+    # set the first time and each router only references it, instead
+    # of copying the whole dictionary into every component.
+    def _addTopologyParams(self, sub):
+        set_name = "topo_params_%s"%self._instance_name
+        if set_name not in Topology._topology_param_sets:
+            sst.addGlobalParams(set_name, self._getGroupParams("main"))
+            Topology._topology_param_sets.add(set_name)
+        sub.addGlobalParamSet(set_name)
+    # Locality hints for parallel runs.  When partition_by_locality is
+    # set, builders mark the links inside a locality group (dragonfly
+    # group, fat tree pod, mesh/torus/hyperx slab) and the endpoint
+    # links as no-cut.  The partitioner then keeps each group on one
+    # rank/thread with its endpoints and only cuts the links between
+    # groups, which are usually the longest latency links.
+    def _keepLocal(self, link):
+        if self.partition_by_locality:
+            link.setNoCut()
+        return link
 
 class NetworkInterface(TemplateBase):
     def __init__(self):
@@ -826,7 +849,8 @@ class hr_router(RouterTemplate):
         RouterTemplate.__init__(self)
 
         self._declareParams("params",["link_bw","flit_size","xbar_bw","input_latency","output_latency","input_buf_size","output_buf_size",
-                                      "xbar_arb","network_inspectors","oql_track_port","oql_track_remote","num_vns","vn_remap","vn_remap_shm"])
+                                      "xbar_arb","network_inspectors","oql_track_port","oql_track_remote","num_vns","vn_remap","vn_remap_shm",
+                                      "background_load","background_occupancy"])
 
         self._declareParams("params",["qos_settings"],"portcontrol.arbitration.")
         self._declareParams("params",["output_arb", "enable_congestion_management", "cm_outstanding_threshold", "cm_incast_threshold"],"portcontrol.")
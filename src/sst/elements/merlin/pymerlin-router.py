@@ -23,7 +23,8 @@ class hr_router(RouterTemplate):
     def __init__(self):
         RouterTemplate.__init__(self)
         self._declareParams("params",["link_bw","flit_size","xbar_bw","input_latency","output_latency","input_buf_size","output_buf_size",
-                                      "xbar_arb","network_inspectors","oql_track_port","oql_track_remote","num_vns","vn_remap","vn_remap_shm"])
+                                      "xbar_arb","network_inspectors","oql_track_port","oql_track_remote","num_vns","vn_remap","vn_remap_shm",
+                                      "background_load","background_occupancy"])
 
         self._declareParams("params",["qos_settings"],"portcontrol.arbitration.")
         self._declareParams("params",["output_arb"],"portcontrol.")
@@ -37,9 +38,12 @@ class hr_router(RouterTemplate):
         if not self.output_arb: self.output_arb = "merlin.arb.output.qos.multi"
         
     def instanceRouter(self, name, radix, rtr_id):
+        if self._check_first_build():
+            sst.addGlobalParams("%s_params"%self._instance_name, self._getGroupParams("params"))
+
         rtr = sst.Component(name, "merlin.hr_router")
         self._applyStatisticsSettings(rtr)
-        rtr.addParams(self._getGroupParams("params"))
+        rtr.addGlobalParamSet("%s_params"%self._instance_name)
         rtr.addParam("num_ports",radix)
         rtr.addParam("id",rtr_id)
         return rtr
@@ -26,8 +26,11 @@
 #include <sst/core/timeConverter.h>
 #include <sst/core/unitAlgebra.h>
 #include <sst/core/interfaces/simpleNetwork.h>
+#include <sst/elements/pool/objectPool.h>
 
+#include <algorithm>
 #include <queue>
+#include <vector>
 
 namespace SST {
 namespace Merlin {
@@ -45,29 +48,64 @@ class internal_router_event;
 class Router : public Component {
 private:
     bool requestNotifyOnEvent;
+    bool requestNotifyOnCredit;
 
 protected:
     inline void setRequestNotifyOnEvent(bool state)
     { requestNotifyOnEvent = state; }
+    inline void setRequestNotifyOnCredit(bool state)
+    { requestNotifyOnCredit = state; }
 
     int vcs_with_data;
 
+    // Bitmasks of the VCs holding data, maintained alongside
+    // vcs_with_data once a router sets them up with setDataMasks()
+    uint64_t* port_data_mask;   // One bit per port
+    uint64_t* vc_data_mask;     // vc_mask_words words per port, one bit per VC
+    int vc_mask_words;
+
+    inline void setDataMasks(uint64_t* port_mask, uint64_t* vc_mask, int vc_words)
+    { port_data_mask = port_mask; vc_data_mask = vc_mask; vc_mask_words = vc_words; }
+
 public:
 
     Router(ComponentId_t id) :
         Component(id),
         requestNotifyOnEvent(false),
-        vcs_with_data(0)
+        requestNotifyOnCredit(false),
+        vcs_with_data(0),
+        port_data_mask(NULL),
+        vc_data_mask(NULL),
+        vc_mask_words(0)
     {}
 
     virtual ~Router() {}
 
     inline bool getRequestNotifyOnEvent() { return requestNotifyOnEvent; }
+    // Set while the router is paused waiting for crossbar credits to
+    // be returned by an output buffer
+    inline bool getRequestNotifyOnCredit() { return requestNotifyOnCredit; }
 
     virtual void notifyEvent() {}
 
-    inline void inc_vcs_with_data() { vcs_with_data++; }
-    inline void dec_vcs_with_data() { vcs_with_data--; }
+    inline void inc_vcs_with_data(int port, int vc) {
+        vcs_with_data++;
+        if ( vc_data_mask ) {
+            vc_data_mask[port * vc_mask_words + (vc >> 6)] |= (uint64_t)1 << (vc & 63);
+            port_data_mask[port >> 6] |= (uint64_t)1 << (port & 63);
+        }
+    }
+    inline void dec_vcs_with_data(int port, int vc) {
+        vcs_with_data--;
+        if ( vc_data_mask ) {
+            uint64_t* mask = &vc_data_mask[port * vc_mask_words];
+            mask[vc >> 6] &= ~((uint64_t)1 << (vc & 63));
+            for ( int i = 0; i < vc_mask_words; i++ ) {
+                if ( mask[i] ) return;
+            }
+            port_data_mask[port >> 6] &= ~((uint64_t)1 << (port & 63));
+        }
+    }
     inline int get_vcs_with_data() { return vcs_with_data; }
 
     virtual int const* getOutputBufferCredits() = 0;
@@ -88,6 +126,10 @@ public:
 
     inline RtrEventType getType() const { return type; }
 
+    // Packets, credits and their internal wrappers are created per flit
+    // hop, all router events share one pool
+    SST_ELEMENT_POOL_OPERATORS(SST::Merlin::BaseRtrEvent)
+
     void serialize_order(SST::Core::Serialization::serializer &ser)  override {
         Event::serialize_order(ser);
         ser & type;
@@ -116,7 +158,8 @@ public:
 
     RtrEvent() :
         BaseRtrEvent(BaseRtrEvent::PACKET),
-        injectionTime(0)
+        injectionTime(0),
+        train_bits(0)
     {}
 
     RtrEvent(SST::Interfaces::SimpleNetwork::Request* req, SST::Interfaces::SimpleNetwork::nid_t trusted_src, int route_vn) :
@@ -124,13 +167,15 @@ public:
         request(req),
         trusted_src(trusted_src),
         route_vn(route_vn),
-        injectionTime(0)
+        injectionTime(0),
+        train_bits(0)
     {}
 
 
     ~RtrEvent()
     {
         if (request) delete request;
+        for ( auto req : train ) delete req;
     }
 
     inline void setInjectionTime(SimTime_t time) {injectionTime = time;}
@@ -139,6 +184,7 @@ public:
     virtual RtrEvent* clone(void)  override {
         RtrEvent *ret = new RtrEvent(*this);
         ret->request = this->request->clone();
+        for ( auto& req : ret->train ) req = req->clone();
         return ret;
     }
 
@@ -148,7 +194,7 @@ public:
 
     inline void computeSizeInFlits(int flit_size ) {size_in_flits = (request->size_in_bits + flit_size - 1) / flit_size; }
     inline int getSizeInFlits() { return size_in_flits; }
-    inline int getSizeInBits() { return request->size_in_bits; }
+    inline int getSizeInBits() { return request->size_in_bits + train_bits; }
 
     inline SST::Interfaces::SimpleNetwork::nid_t getDest() const {return request->dest;}
 
@@ -162,6 +208,30 @@ public:
         return ret;
     }
 
+    // Packet trains: back-to-back packets to the same destination can
+    // be carried through the network as one event.  The sizes include
+    // every packet in the train.
+    inline int getTrainLength() const { return 1 + train.size(); }
+
+    // Moves the packet from ev onto the end of this train.  ev no
+    // longer holds a request and can be deleted.
+    void addToTrain(RtrEvent* ev) {
+        train_bits += ev->getSizeInBits();
+        size_in_flits += ev->size_in_flits;
+        train.push_back(ev->takeRequest());
+        for ( auto req : ev->train ) train.push_back(req);
+        ev->train.clear();
+    }
+
+    // Removes the trailing packets of the train, leaving only the
+    // head packet in this event
+    void takeTrain(std::vector<SST::Interfaces::SimpleNetwork::Request*>& reqs, int flit_size) {
+        reqs.swap(train);
+        train.clear();
+        train_bits = 0;
+        computeSizeInFlits(flit_size);
+    }
+
     virtual void print(const std::string& header, Output &out) const  override {
         out.output("%s RtrEvent to be delivered at %" PRI_SIMTIME " with priority %d. src = %" PRI_NID " (logical: %" PRI_NID "), dest = %" PRI_NID "\n",
                    header.c_str(), getDeliveryTime(), getPriority(), trusted_src, request->src, request->dest);
@@ -175,6 +245,8 @@ public:
         ser & route_vn;
         ser & size_in_flits;
         ser & injectionTime;
+        ser & train;
+        ser & train_bits;
     }
 
 private:
@@ -185,6 +257,9 @@ private:
     SimTime_t injectionTime;
     int size_in_flits;
 
+    std::vector<SST::Interfaces::SimpleNetwork::Request*> train;
+    size_t train_bits;
+
     ImplementSerializable(SST::Merlin::RtrEvent)
 
 };
@@ -559,6 +634,58 @@ protected:
 };
 
 
+// FIFO of events for one VC of a port.  Backed by a ring buffer that
+// can be sized up front from the buffer sizes so the steady state
+// does no allocation, but grows if it fills, so it can be used
+// anywhere a std::queue was.
+template <typename T>
+class port_ring_queue {
+public:
+    port_ring_queue() : data(NULL), capacity(0), head(0), count(0) {}
+    ~port_ring_queue() { delete [] data; }
+
+    port_ring_queue(const port_ring_queue&) = delete;
+    port_ring_queue& operator=(const port_ring_queue&) = delete;
+
+    void reserve(size_t entries) { if ( entries > capacity ) grow(entries); }
+
+    inline bool empty() const { return count == 0; }
+    inline size_t size() const { return count; }
+
+    inline T& front() { return data[head]; }
+    inline T& back() { return data[(head + count - 1) & (capacity - 1)]; }
+
+    inline void push(const T& value) {
+        if ( count == capacity ) grow(count + 1);
+        data[(head + count) & (capacity - 1)] = value;
+        count++;
+    }
+
+    inline void pop() {
+        head = (head + 1) & (capacity - 1);
+        count--;
+    }
+
+private:
+    // Capacity is kept a power of two so indexes wrap with a mask
+    void grow(size_t entries) {
+        size_t new_capacity = capacity ? capacity : 4;
+        while ( new_capacity < entries ) new_capacity <<= 1;
+        T* new_data = new T[new_capacity];
+        for ( size_t i = 0; i < count; ++i ) new_data[i] = data[(head + i) & (capacity - 1)];
+        delete [] data;
+        data = new_data;
+        capacity = new_capacity;
+        head = 0;
+    }
+
+    T* data;
+    size_t capacity;
+    size_t head;
+    size_t count;
+};
+
+
 // Class to manage link between NIC and router.  A single NIC can have
 // more than one link_control (and thus link to router).
 class PortInterface : public SubComponent{
@@ -568,7 +695,7 @@ public:
     // params are: parent router, router id, port number, topology object
     SST_ELI_REGISTER_SUBCOMPONENT_API(SST::Merlin::PortInterface, Router*, int, int, Topology*)
 
-    typedef std::queue<internal_router_event*> port_queue_t;
+    typedef port_ring_queue<internal_router_event*> port_queue_t;
     typedef std::queue<CtrlRtrEvent*> ctrl_queue_t;
 
     virtual void recvCtrlEvent(CtrlRtrEvent* ev) = 0;
@@ -652,6 +779,73 @@ public:
     virtual void reportSkippedCycles(Cycle_t cycles) {};
     virtual void dumpState(std::ostream& stream) {};
 
+    // Returned by getBlockedCycles() when no VC can progress until an
+    // event arrives or credits are returned to an output buffer
+    static const Cycle_t BLOCKED_UNTIL_ARRIVAL = ~(Cycle_t)0;
+
+    // Called by hr_router at the end of a cycle, after progressed
+    // events have moved and the busy values have been decremented.
+    // Returns the number of upcoming cycles in which arbitrate()
+    // cannot progress any VC, given the current busy values and
+    // credits.  Returning 0 tells the router not to skip any cycles,
+    // which is the default for arbiters that don't support it.
+    virtual Cycle_t getBlockedCycles(PortInterface** ports, int* in_port_busy, int* out_port_busy) { return 0; }
+
+    // Called by hr_router when it wakes after skipping cycles that
+    // getBlockedCycles() allowed.  in_port_busy holds the values at
+    // the first skipped cycle.  The arbiter updates any per-cycle
+    // state as if arbitrate() had been called for each skipped cycle
+    // and adds the number of cycles each port would have reported a
+    // stall (progress_vc == -2) to stall_cycles.  reportSkippedCycles()
+    // is called afterwards as for any other pause.
+    virtual void reportBlockedCycles(Cycle_t cycles, PortInterface** ports, int* in_port_busy, uint64_t* stall_cycles) {}
+
+    // Called by the router after setPorts() with bitmasks of the VCs
+    // holding data, for arbiters that only visit those VCs.  See
+    // Router::inc_vcs_with_data() for the layout.
+    virtual void setDataMasks(const uint64_t* port_mask, const uint64_t* vc_mask, int vc_words) {}
+
+protected:
+    // Blocked cycles for arbiters that progress a VC head once both
+    // its xbar ports are idle and the output buffer has credits
+    Cycle_t computeBlockedCycles(PortInterface** ports, int* in_port_busy, int* out_port_busy, int num_ports, int num_vcs) {
+        Cycle_t blocked = BLOCKED_UNTIL_ARRIVAL;
+        for ( int port = 0; port < num_ports; port++ ) {
+            internal_router_event** heads = ports[port]->getVCHeads();
+            for ( int vc = 0; vc < num_vcs; vc++ ) {
+                internal_router_event* ev = heads[vc];
+                if ( ev == NULL ) continue;
+                int next_port = ev->getNextPort();
+                // Only a credit return can unblock this VC
+                if ( !ports[next_port]->spaceToSend(ev->getVC(), ev->getFlitCount()) ) continue;
+                Cycle_t wait = std::max<int>(in_port_busy[port], out_port_busy[next_port]);
+                if ( wait == 0 ) return 0;
+                if ( wait < blocked ) blocked = wait;
+            }
+        }
+        return blocked;
+    }
+
+    // Number of skipped cycles in which a port's input to the xbar
+    // was idle, given its busy value at the first skipped cycle
+    static inline Cycle_t idleInputCycles(Cycle_t cycles, int busy) {
+        return (Cycle_t)busy >= cycles ? 0 : cycles - busy;
+    }
+
+    // Stalls for arbiters that report a stall for every port with an
+    // idle xbar input and an event that cannot progress
+    void addBlockedStalls(Cycle_t cycles, PortInterface** ports, int* in_port_busy, uint64_t* stall_cycles, int num_ports, int num_vcs) {
+        for ( int port = 0; port < num_ports; port++ ) {
+            internal_router_event** heads = ports[port]->getVCHeads();
+            for ( int vc = 0; vc < num_vcs; vc++ ) {
+                if ( heads[vc] != NULL ) {
+                    stall_cycles[port] += idleInputCycles(cycles, in_port_busy[port]);
+                    break;
+                }
+            }
+        }
+    }
+
 };
 
 }
@@ -0,0 +1,156 @@
+// -*- mode: c++ -*-
+
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef COMPONENTS_MERLIN_TARGET_GENERATOR_HOTSPOT_H
+#define COMPONENTS_MERLIN_TARGET_GENERATOR_HOTSPOT_H
+
+#include <sst/elements/merlin/target_generator/target_generator.h>
+#include <sst/elements/merlin/target_generator/xoshiro.h>
+
+#include <cmath>
+
+namespace SST {
+namespace Merlin {
+
+
+class HotspotDist : public TargetGenerator {
+
+public:
+
+    SST_ELI_REGISTER_SUBCOMPONENT(
+        HotspotDist,
+        "merlin",
+        "targetgen.hotspot",
+        SST_ELI_ELEMENT_VERSION(0,0,1),
+        "Generates targets with a Zipf distribution.  The hotspot is the most likely target, followed by the endpoints after it.",
+        SST::Merlin::TargetGenerator
+    )
+
+    SST_ELI_DOCUMENT_PARAMS(
+        {"hotspot",   "Endpoint that is the most likely target","0"},
+        {"alpha",     "Exponent of the Zipf distribution.  0 is uniform and larger values concentrate traffic on the hotspot.","1.0"},
+        {"min",       "Minimum address to generate","0"},
+        {"max",       "Maximum address to generate","numpeers - 1"}
+    )
+
+    Xoshiro128 gen;
+
+    int min;
+    int max;
+    int hotspot;
+    double alpha;
+
+    // Constants for rejection-inversion sampling
+    double h_integral_x1;
+    double h_integral_n;
+    double s;
+
+public:
+
+    HotspotDist(ComponentId_t cid, Params &params, int id, int num_peers) :
+        TargetGenerator(cid),
+        gen(id)
+    {
+        min = params.find<int>("min",0);
+        max = params.find<int>("max",num_peers - 1);
+        hotspot = params.find<int>("hotspot",min);
+        alpha = params.find<double>("alpha",1.0);
+
+        if ( max < min ) {
+            fatal(CALL_INFO,1,"ERROR: max must not be less than min in targetgen.hotspot\n");
+        }
+        if ( hotspot < min || hotspot > max ) {
+            fatal(CALL_INFO,1,"ERROR: hotspot must be between min and max in targetgen.hotspot\n");
+        }
+        if ( alpha < 0 ) {
+            fatal(CALL_INFO,1,"ERROR: alpha must not be negative in targetgen.hotspot\n");
+        }
+
+        double n = max - min + 1;
+        h_integral_x1 = hIntegral(1.5) - 1.0;
+        h_integral_n = hIntegral(n + 0.5);
+        s = 2.0 - hIntegralInverse(hIntegral(2.5) - h(2.0));
+    }
+
+    ~HotspotDist() {
+    }
+
+    int getNextValue(void) {
+        int range = max - min + 1;
+        return min + (hotspot - min + sampleRank() - 1) % range;
+    }
+
+    void getNextValues(int* values, int count) {
+        int range = max - min + 1;
+        for ( int i = 0; i < count; ++i ) values[i] = min + (hotspot - min + sampleRank() - 1) % range;
+    }
+
+    void seed(uint32_t val) {
+        gen.setSeed(val);
+    }
+
+private:
+    // Zipf rank in [1, max - min + 1] using the rejection-inversion
+    // method of Hormann and Derflinger, which needs no tables and
+    // rarely rejects
+    inline int sampleRank() {
+        int n = max - min + 1;
+        while ( true ) {
+            double u = h_integral_n + gen.nextDouble() * (h_integral_x1 - h_integral_n);
+            double x = hIntegralInverse(u);
+            int k = (int)(x + 0.5);
+            if ( k < 1 ) k = 1;
+            else if ( k > n ) k = n;
+            if ( k - x <= s || u >= hIntegral(k + 0.5) - h(k) ) return k;
+        }
+    }
+
+    // h(x) = 1/x^alpha and its integral, computed so alpha near 1
+    // stays accurate
+    inline double h(double x) const {
+        return std::exp(-alpha * std::log(x));
+    }
+
+    inline double hIntegral(double x) const {
+        double log_x = std::log(x);
+        return helper2((1.0 - alpha) * log_x) * log_x;
+    }
+
+    inline double hIntegralInverse(double x) const {
+        double t = x * (1.0 - alpha);
+        if ( t < -1.0 ) t = -1.0;
+        return std::exp(helper1(t) * x);
+    }
+
+    // log(1+x)/x
+    static inline double helper1(double x) {
+        if ( std::fabs(x) > 1e-8 ) return std::log1p(x) / x;
+        return 1.0 - x * (0.5 - x * (1.0 / 3.0 - 0.25 * x));
+    }
+
+    // (exp(x)-1)/x
+    static inline double helper2(double x) {
+        if ( std::fabs(x) > 1e-8 ) return std::expm1(x) / x;
+        return 1.0 + x * 0.5 * (1.0 + x * (1.0 / 3.0) * (1.0 + 0.25 * x));
+    }
+};
+
+} //namespace Merlin
+} //namespace SST
+
+#endif
@@ -0,0 +1,115 @@
+// -*- mode: c++ -*-
+
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef COMPONENTS_MERLIN_TARGET_GENERATOR_PERMUTATION_H
+#define COMPONENTS_MERLIN_TARGET_GENERATOR_PERMUTATION_H
+
+#include <sst/elements/merlin/target_generator/target_generator.h>
+
+namespace SST {
+namespace Merlin {
+
+
+class PermutationDist : public TargetGenerator {
+
+public:
+
+    SST_ELI_REGISTER_SUBCOMPONENT(
+        PermutationDist,
+        "merlin",
+        "targetgen.permutation",
+        SST_ELI_ELEMENT_VERSION(0,0,1),
+        "Generates a random permutation pattern.  Each endpoint always sends to the same target and every endpoint is the target of exactly one other.",
+        SST::Merlin::TargetGenerator
+    )
+
+    SST_ELI_DOCUMENT_PARAMS(
+        {"seed",         "Seed for the permutation.  Must be the same on all endpoints.","1"}
+    )
+
+    int dest;
+    uint32_t perm_seed;
+
+public:
+
+    PermutationDist(ComponentId_t cid, Params &params, int id, int num_peers) :
+        TargetGenerator(cid)
+    {
+        perm_seed = params.find<uint32_t>("seed", 1);
+        dest = permute(id, num_peers, perm_seed);
+    }
+
+    ~PermutationDist() {
+    }
+
+    void initialize(int id, int num_peers) {
+        dest = permute(id, num_peers, perm_seed);
+    }
+
+    int getNextValue(void) {
+        return dest;
+    }
+
+    void getNextValues(int* values, int count) {
+        for ( int i = 0; i < count; ++i ) values[i] = dest;
+    }
+
+    void seed(uint32_t val) {
+    }
+
+    // Position of id in a random permutation of [0,num_peers).  Uses a
+    // Feistel network over the next even power of two with cycle
+    // walking, so each endpoint computes its target in constant time
+    // without building the whole permutation.
+    static int permute(int id, int num_peers, uint32_t seed) {
+        if ( num_peers <= 1 ) return 0;
+        int bits = 0;
+        while ( (1ULL << bits) < (uint64_t)num_peers ) bits++;
+        int half = (bits + 1) / 2;
+        uint32_t mask = (1U << half) - 1;
+
+        uint64_t x = id;
+        do {
+            uint32_t left = (x >> half) & mask;
+            uint32_t right = x & mask;
+            for ( uint32_t round = 0; round < 4; ++round ) {
+                uint32_t f = mix(right ^ (seed * 0x9e3779b9U) ^ (round * 0x85ebca6bU)) & mask;
+                uint32_t tmp = right;
+                right = left ^ f;
+                left = tmp;
+            }
+            x = ((uint64_t)left << half) | right;
+        } while ( x >= (uint64_t)num_peers );
+        return (int)x;
+    }
+
+private:
+    static inline uint32_t mix(uint32_t h) {
+        h ^= h >> 16;
+        h *= 0x7feb352dU;
+        h ^= h >> 15;
+        h *= 0x846ca68bU;
+        h ^= h >> 16;
+        return h;
+    }
+};
+
+} //namespace Merlin
+} //namespace SST
+
+#endif
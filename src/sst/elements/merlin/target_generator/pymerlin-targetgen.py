@@ -67,3 +67,39 @@ class ShiftTarget(TargetGenerator):
 
     def getTypeName(self):
         return "merlin.targetgen.shift"
+
+
+class PermutationTarget(TargetGenerator):
+    def __init__(self):
+        TargetGenerator.__init__(self)
+        self._declareParams("params",["seed"])
+
+    def getTypeName(self):
+        return "merlin.targetgen.permutation"
+
+
+class HotspotTarget(TargetGenerator):
+    def __init__(self):
+        TargetGenerator.__init__(self)
+        self._declareParams("params",["hotspot","alpha","min","max"])
+
+    def getTypeName(self):
+        return "merlin.targetgen.hotspot"
+
+
+class TornadoTarget(TargetGenerator):
+    def __init__(self):
+        TargetGenerator.__init__(self)
+        self._declareParams("params",["shape"])
+
+    def getTypeName(self):
+        return "merlin.targetgen.tornado"
+
+
+class TraceTarget(TargetGenerator):
+    def __init__(self):
+        TargetGenerator.__init__(self)
+        self._declareParams("params",["trace_file"])
+
+    def getTypeName(self):
+        return "merlin.targetgen.trace"
@@ -70,6 +70,10 @@ public:
         return dest;
     }
 
+    void getNextValues(int* values, int count) {
+        for ( int i = 0; i < count; ++i ) values[i] = dest;
+    }
+
     void seed(uint32_t val) {
     }
 };
@@ -19,10 +19,56 @@
 #include <sst/elements/merlin/target_generator/uniform.h>
 #include <sst/elements/merlin/target_generator/bit_complement.h>
 #include <sst/elements/merlin/target_generator/shift.h>
+#include <sst/elements/merlin/target_generator/permutation.h>
+#include <sst/elements/merlin/target_generator/hotspot.h>
+#include <sst/elements/merlin/target_generator/tornado.h>
+#include <sst/elements/merlin/target_generator/trace.h>
+
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <sstream>
 
 namespace SST {
 namespace Merlin {
 
+const TraceDist::trace_t*
+TraceDist::loadTrace(const std::string& filename, int num_peers)
+{
+    static std::mutex lock;
+    static std::map<std::string, trace_t*> loaded;
+
+    std::lock_guard<std::mutex> guard(lock);
+    auto it = loaded.find(filename);
+    if ( it != loaded.end() ) return it->second;
+
+    std::ifstream in(filename);
+    if ( !in.is_open() ) {
+        fatal(CALL_INFO,1,"ERROR: unable to open trace file %s in targetgen.trace\n", filename.c_str());
+    }
+
+    trace_t* trace = new trace_t(num_peers);
+    std::string line;
+    int line_num = 0;
+    while ( std::getline(in, line) ) {
+        line_num++;
+        size_t comment = line.find('#');
+        if ( comment != std::string::npos ) line.erase(comment);
+
+        std::istringstream tokens(line);
+        int src, dest;
+        if ( !(tokens >> src) ) continue;
+        if ( !(tokens >> dest) || src < 0 || src >= num_peers || dest < 0 || dest >= num_peers ) {
+            fatal(CALL_INFO,1,"ERROR: %s:%d: expected '<src> <dest>' with ids less than %d\n",
+                  filename.c_str(), line_num, num_peers);
+        }
+        (*trace)[src].push_back(dest);
+    }
+
+    loaded[filename] = trace;
+    return trace;
+}
+
 } //namespace Merlin
 } //namespace SST
 
@@ -21,6 +21,8 @@
 
 #include <sst/core/subcomponent.h>
 
+#include <vector>
+
 namespace SST {
 namespace Merlin {
 
@@ -37,6 +39,42 @@ public:
     virtual void initialize(int id, int num_peers) {}
     virtual int getNextValue(void) = 0;
     virtual void seed(uint32_t val) {}
+
+    // Fills values with the next count targets.  Generators should
+    // override this so a batch costs one virtual call.
+    virtual void getNextValues(int* values, int count) {
+        for ( int i = 0; i < count; ++i ) values[i] = getNextValue();
+    }
+};
+
+
+// Hands out targets from a TargetGenerator, refilling in batches.  The
+// targets are the same sequence getNextValue() would have returned.
+class TargetBuffer {
+public:
+    TargetBuffer(int size = 64) :
+        gen(NULL),
+        values(size),
+        next(size)
+    {}
+
+    void setGenerator(TargetGenerator* generator) {
+        gen = generator;
+        next = values.size();
+    }
+
+    inline int getNextValue() {
+        if ( next == values.size() ) {
+            gen->getNextValues(values.data(), values.size());
+            next = 0;
+        }
+        return values[next++];
+    }
+
+private:
+    TargetGenerator* gen;
+    std::vector<int> values;
+    size_t next;
 };
 
 } //namespace Merlin
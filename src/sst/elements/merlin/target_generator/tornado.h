@@ -0,0 +1,120 @@
+// -*- mode: c++ -*-
+
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef COMPONENTS_MERLIN_TARGET_GENERATOR_TORNADO_H
+#define COMPONENTS_MERLIN_TARGET_GENERATOR_TORNADO_H
+
+#include <sst/elements/merlin/target_generator/target_generator.h>
+
+#include <cstdlib>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace SST {
+namespace Merlin {
+
+
+class TornadoDist : public TargetGenerator {
+
+public:
+
+    SST_ELI_REGISTER_SUBCOMPONENT(
+        TornadoDist,
+        "merlin",
+        "targetgen.tornado",
+        SST_ELI_ELEMENT_VERSION(0,0,1),
+        "Generates a tornado pattern.  In each dimension of size k, the target is ceil(k/2) - 1 positions away.",
+        SST::Merlin::TargetGenerator
+    )
+
+    SST_ELI_DOCUMENT_PARAMS(
+        {"shape",        "Shape of the endpoint ids as dimension sizes separated by x, with the first dimension varying fastest (e.g. 4x4x2).","numpeers"}
+    )
+
+    int dest;
+    std::string shape;
+
+public:
+
+    TornadoDist(ComponentId_t cid, Params &params, int id, int num_peers) :
+        TargetGenerator(cid)
+    {
+        shape = params.find<std::string>("shape", "");
+        dest = computeTarget(id, num_peers);
+    }
+
+    ~TornadoDist() {
+    }
+
+    void initialize(int id, int num_peers) {
+        dest = computeTarget(id, num_peers);
+    }
+
+    int getNextValue(void) {
+        return dest;
+    }
+
+    void getNextValues(int* values, int count) {
+        for ( int i = 0; i < count; ++i ) values[i] = dest;
+    }
+
+    void seed(uint32_t val) {
+    }
+
+private:
+    int computeTarget(int id, int num_peers) {
+        std::vector<int> dims;
+        if ( shape == "" ) {
+            dims.push_back(num_peers);
+        }
+        else {
+            std::stringstream ss(shape);
+            std::string dim;
+            while ( std::getline(ss, dim, 'x') ) {
+                dims.push_back(std::atoi(dim.c_str()));
+            }
+        }
+
+        int size = 1;
+        for ( int d : dims ) {
+            if ( d <= 0 ) fatal(CALL_INFO,1,"ERROR: invalid shape %s in targetgen.tornado\n", shape.c_str());
+            size *= d;
+        }
+        if ( size != num_peers ) {
+            fatal(CALL_INFO,1,"ERROR: shape %s in targetgen.tornado has %d endpoints, but there are %d\n",
+                  shape.c_str(), size, num_peers);
+        }
+
+        int target = 0;
+        int stride = 1;
+        int rem = id;
+        for ( int d : dims ) {
+            int loc = rem % d;
+            rem /= d;
+            target += ((loc + (d + 1) / 2 - 1) % d) * stride;
+            stride *= d;
+        }
+        return target;
+    }
+};
+
+} //namespace Merlin
+} //namespace SST
+
+#endif
@@ -0,0 +1,98 @@
+// -*- mode: c++ -*-
+
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef COMPONENTS_MERLIN_TARGET_GENERATOR_TRACE_H
+#define COMPONENTS_MERLIN_TARGET_GENERATOR_TRACE_H
+
+#include <sst/elements/merlin/target_generator/target_generator.h>
+
+#include <string>
+#include <vector>
+
+namespace SST {
+namespace Merlin {
+
+
+class TraceDist : public TargetGenerator {
+
+public:
+
+    SST_ELI_REGISTER_SUBCOMPONENT(
+        TraceDist,
+        "merlin",
+        "targetgen.trace",
+        SST_ELI_ELEMENT_VERSION(0,0,1),
+        "Replays the targets recorded in a trace file.  Each endpoint cycles through its own targets in file order.",
+        SST::Merlin::TargetGenerator
+    )
+
+    SST_ELI_DOCUMENT_PARAMS(
+        {"trace_file",   "File with one '<src> <dest>' pair per line.  Anything after a '#' is ignored."}
+    )
+
+    // Targets for each endpoint, indexed by src
+    typedef std::vector<std::vector<int> > trace_t;
+
+    const std::vector<int>* targets;
+    size_t next;
+
+public:
+
+    TraceDist(ComponentId_t cid, Params &params, int id, int num_peers) :
+        TargetGenerator(cid),
+        next(0)
+    {
+        std::string filename = params.find<std::string>("trace_file", "");
+        if ( filename == "" ) {
+            fatal(CALL_INFO,1,"ERROR: trace_file must be specified in targetgen.trace\n");
+        }
+        const trace_t* trace = loadTrace(filename, num_peers);
+        if ( id >= (int)trace->size() || (*trace)[id].empty() ) {
+            fatal(CALL_INFO,1,"ERROR: trace file %s has no targets for endpoint %d\n", filename.c_str(), id);
+        }
+        targets = &(*trace)[id];
+    }
+
+    ~TraceDist() {
+    }
+
+    int getNextValue(void) {
+        int dest = (*targets)[next];
+        if ( ++next == targets->size() ) next = 0;
+        return dest;
+    }
+
+    void getNextValues(int* values, int count) {
+        for ( int i = 0; i < count; ++i ) {
+            values[i] = (*targets)[next];
+            if ( ++next == targets->size() ) next = 0;
+        }
+    }
+
+    void seed(uint32_t val) {
+    }
+
+private:
+    // Files are parsed once and shared by all endpoints
+    const trace_t* loadTrace(const std::string& filename, int num_peers);
+};
+
+} //namespace Merlin
+} //namespace SST
+
+#endif
@@ -0,0 +1,84 @@
+// -*- mode: c++ -*-
+
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef COMPONENTS_MERLIN_TARGET_GENERATOR_XOSHIRO_H
+#define COMPONENTS_MERLIN_TARGET_GENERATOR_XOSHIRO_H
+
+#include <stdint.h>
+
+namespace SST {
+namespace Merlin {
+
+/*
+ * xoshiro128** generator.  Small, non-virtual and fast enough to call
+ * per packet, unlike the SST::RNG classes.  Each endpoint gets its own
+ * stream by seeding with its id.
+ */
+class Xoshiro128 {
+public:
+    Xoshiro128(uint64_t seed = 0) { setSeed(seed); }
+
+    void setSeed(uint64_t seed) {
+        // Expand the seed with splitmix64 so nearby seeds give
+        // unrelated streams
+        for ( int i = 0; i < 4; i += 2 ) {
+            uint64_t z = (seed += 0x9e3779b97f4a7c15ULL);
+            z = (z ^ (z >> 30)) * 0xbf58476d1ce4e5b9ULL;
+            z = (z ^ (z >> 27)) * 0x94d049bb133111ebULL;
+            z = z ^ (z >> 31);
+            state[i] = (uint32_t)z;
+            state[i + 1] = (uint32_t)(z >> 32);
+        }
+    }
+
+    inline uint32_t next() {
+        uint32_t result = rotl(state[1] * 5, 7) * 9;
+        uint32_t t = state[1] << 9;
+        state[2] ^= state[0];
+        state[3] ^= state[1];
+        state[1] ^= state[2];
+        state[0] ^= state[3];
+        state[2] ^= t;
+        state[3] = rotl(state[3], 11);
+        return result;
+    }
+
+    // Value in [0,bound)
+    inline uint32_t nextBounded(uint32_t bound) {
+        return (uint32_t)(((uint64_t)next() * bound) >> 32);
+    }
+
+    // Value in [0,1)
+    inline double nextDouble() {
+        uint64_t high = next();
+        uint64_t low = next();
+        return (double)((high << 21) | (low >> 11)) * (1.0 / (double)(1ULL << 53));
+    }
+
+private:
+    uint32_t state[4];
+
+    static inline uint32_t rotl(uint32_t x, int k) {
+        return (x << k) | (x >> (32 - k));
+    }
+};
+
+} //namespace Merlin
+} //namespace SST
+
+#endif
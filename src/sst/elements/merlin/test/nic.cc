@@ -341,7 +341,7 @@ nic::clock_handler(Cycle_t cycle)
             last_target %= num_peers;
 
             MyRtrEvent* ev = new MyRtrEvent(packets_sent/num_peers);
-            SimpleNetwork::Request* req = new SimpleNetwork::Request();
+            SimpleNetwork::Request* req = requests.get();
 
             req->dest = last_target;
             req->src = net_id;
@@ -383,7 +383,7 @@ nic::clock_handler(Cycle_t cycle)
 
         next_seq[src]++;
         delete ev;
-        delete req;
+        requests.recycle(req);
     }
 
     return false;
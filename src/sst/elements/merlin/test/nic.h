@@ -24,6 +24,7 @@
 #include <sst/core/link.h>
 #include <sst/core/timeConverter.h>
 #include <sst/core/interfaces/simpleNetwork.h>
+#include <sst/elements/pool/requestRecycler.h>
 
 
 namespace SST {
@@ -85,6 +86,7 @@ private:
     bool send_untimed_bcast;
 
     SST::Interfaces::SimpleNetwork* link_control;
+    SST::ElementPool::RequestRecycler requests;
 
     int last_target;
 
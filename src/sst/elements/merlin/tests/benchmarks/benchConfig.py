@@ -0,0 +1,123 @@
+# Canonical merlin configurations for measuring simulator (host) throughput
+#
+# Run via runBenchmarks.py or directly:
+#   sst benchConfig.py --model-options="--topology=dragonfly --endpoints=1024 --load=0.5"
+#
+# Each topology is sized to get as close as possible to --endpoints with
+# a balanced configuration:
+#   torus     - 3D torus, 4 endpoints per router
+#   fattree   - 3 level k-ary fat tree, k^3/4 endpoints
+#   dragonfly - balanced (a = 2h) dragonfly with as many groups as needed
+#   hyperx    - 3D hyperx of size k with k endpoints per router
+#   polarfly  - polarfly with (q+1)/2 endpoints per router
+#
+# Every endpoint runs an offered_load job with uniform random traffic.
+# Only the router send_packet_count statistic is enabled, its sum over
+# all ports is the number of packet hops simulated.
+import argparse
+import math
+import sys
+
+import sst
+from sst.merlin.base import *
+from sst.merlin.endpoint import *
+from sst.merlin.interface import *
+from sst.merlin.targetgen import *
+from sst.merlin.topology import *
+
+parser = argparse.ArgumentParser()
+parser.add_argument("--topology", default="torus", choices=["torus", "fattree", "dragonfly", "hyperx", "polarfly"])
+parser.add_argument("--endpoints", type=int, default=1024, help="Approximate number of endpoints")
+parser.add_argument("--load", type=float, default=0.5, help="Offered load as a fraction of the link bandwidth")
+parser.add_argument("--collect-time", default="5us", help="Simulated time to collect over, after a 1us warmup")
+parser.add_argument("--stats", default="benchStats.csv", help="CSV file for the router statistics")
+args = parser.parse_args(sys.argv[1:])
+
+link_bw = "4GB/s"
+
+def nearest(values, target):
+    return min(values, key=lambda v: abs(v - target))
+
+if args.topology == "torus":
+    topo = topoTorus()
+    k = max(2, int(round((args.endpoints / 4.0) ** (1.0 / 3.0))))
+    topo.shape = "%dx%dx%d" % (k, k, k)
+    topo.width = "1x1x1"
+    topo.local_ports = 4
+
+elif args.topology == "fattree":
+    topo = topoFatTree()
+    k = max(4, 2 * int(round((4.0 * args.endpoints) ** (1.0 / 3.0) / 2)))
+    h = k // 2
+    topo.shape = "%d,%d:%d,%d:%d" % (h, h, h, h, k)
+
+elif args.topology == "dragonfly":
+    topo = topoDragonFly()
+    # Smallest balanced dragonfly that is large enough, using only as
+    # many groups as needed
+    h = 1
+    while 2 * h * h * (2 * h * h + 1) < args.endpoints:
+        h += 1
+    a = 2 * h
+    groups = max(2, int(math.ceil(args.endpoints / float(a * h))))
+    topo.hosts_per_router = h
+    topo.routers_per_group = a
+    topo.num_groups = groups
+    topo.intergroup_links = max(1, (a * h) // (groups - 1))
+    topo.algorithm = "ugal"
+
+elif args.topology == "hyperx":
+    topo = topoHyperX()
+    k = max(2, int(round(args.endpoints ** 0.25)))
+    topo.shape = "%dx%dx%d" % (k, k, k)
+    topo.width = "1x1x1"
+    topo.local_ports = k
+    topo.algorithm = "DOR"
+
+elif args.topology == "polarfly":
+    # Prime powers supported by the polarfly construction
+    prime_powers = [3, 4, 5, 7, 8, 9, 11, 13, 16, 17, 19, 23, 25, 27, 29, 31, 32, 37, 41, 43, 47, 49, 53, 59, 61, 64]
+    q = nearest(prime_powers, (2.0 * args.endpoints) ** (1.0 / 3.0))
+    topo = topoPolarFly(q=q)
+    topo.hosts_per_router = (q + 1) // 2
+    topo.algorithm = "UGAL_PF"
+
+router = hr_router()
+router.link_bw = link_bw
+router.flit_size = "8B"
+router.xbar_bw = "6GB/s"
+router.input_latency = "20ns"
+router.output_latency = "20ns"
+router.input_buf_size = "4kB"
+router.output_buf_size = "4kB"
+router.num_vns = 1
+router.xbar_arb = "merlin.xbar_arb_lru"
+
+topo.router = router
+topo.link_latency = "20ns"
+
+networkif = LinkControl()
+networkif.link_bw = link_bw
+networkif.input_buf_size = "1kB"
+networkif.output_buf_size = "1kB"
+
+ep = OfferedLoadJob(0, topo.getNumNodes())
+ep.network_interface = networkif
+ep.pattern = UniformTarget()
+ep.offered_load = args.load
+ep.link_bw = link_bw
+ep.message_size = "64B"
+ep.warmup_time = "1us"
+ep.collect_time = args.collect_time
+ep.drain_time = "1us"
+
+system = System()
+system.setTopology(topo)
+system.allocateNodes(ep, "linear")
+system.build()
+
+sst.setStatisticLoadLevel(1)
+sst.setStatisticOutput("sst.statOutputCSV", { "filepath" : args.stats, "separator" : "," })
+sst.enableStatisticForComponentType("merlin.hr_router", "send_packet_count", { "type" : "sst.AccumulatorStatistic", "rate" : "0ns" })
+
+print("BENCHMARK endpoints=%d" % topo.getNumNodes())
@@ -0,0 +1,209 @@
+#!/usr/bin/env python3
+#
+# Measure the host-side throughput of the merlin benchmark configurations
+# in benchConfig.py and report it as JSON
+#
+# Every combination of topology, endpoint count, offered load and
+# parallelism is run.  For each run this reports:
+#   wall_seconds             - host wall-clock time of the sst run
+#   cpu_seconds              - host user + system time of the sst run
+#   endpoints                - endpoints in the configuration actually built
+#   routers                  - routers in the configuration
+#   packet_hops              - packets sent on router ports (from send_packet_count)
+#   packet_hops_per_second   - packet_hops / wall_seconds
+#   peak_rss_kb              - peak resident set size of the sst process (largest rank)
+#   rss_kb_per_router        - peak_rss_kb * ranks / routers
+#   parallel_efficiency      - speedup over the least parallel run of the same
+#                              configuration, divided by the increase in parallelism
+#
+# Parallelism is given as threads x ranks, e.g. 1x1,4x1,1x4.  Ranks are
+# launched with --mpirun.
+#
+# Usage:
+#   runBenchmarks.py [--sst sst] [--topologies torus,dragonfly] [--endpoints 1024,8192]
+#                    [--loads 0.5] [--parallel 1x1,2x1] [--repeat R] [--output results.json]
+#
+# Compare two result files with:
+#   runBenchmarks.py --compare old.json new.json
+import argparse
+import csv
+import glob
+import itertools
+import json
+import os
+import platform
+import subprocess
+import sys
+import tempfile
+import time
+
+TOPOLOGIES = [ "torus", "fattree", "dragonfly", "hyperx", "polarfly" ]
+
+def count_packet_hops(stats_prefix):
+    # Parallel runs write one file per rank
+    hops = 0
+    routers = set()
+    for stats_file in glob.glob(stats_prefix + "*"):
+        with open(stats_file) as f:
+            for row in csv.DictReader(f, skipinitialspace=True):
+                if row.get("StatisticName") == "send_packet_count":
+                    hops += int(row.get("Sum.u64", 0) or 0)
+                    routers.add(row.get("ComponentName"))
+    return hops, len(routers)
+
+def parse_endpoints(output):
+    for line in output.splitlines():
+        if line.startswith("BENCHMARK endpoints="):
+            return int(line.split("=")[1])
+    return 0
+
+def run_benchmark(args, config, topology, endpoints, load, threads, ranks, workdir):
+    name = "%s-%d-%g-%dx%d" % (topology, endpoints, load, threads, ranks)
+    stats_prefix = os.path.join(workdir, name)
+    log_file = os.path.join(workdir, name + ".log")
+    model_options = [
+        "--topology=" + topology,
+        "--endpoints=%d" % endpoints,
+        "--load=%g" % load,
+        "--collect-time=" + args.collect_time,
+        "--stats=" + stats_prefix + ".csv",
+    ]
+    cmd = [args.sst, "--print-timing-info", "--num-threads=%d" % threads, config, "--model-options=" + " ".join(model_options)]
+    if ranks > 1:
+        cmd = args.mpirun.split() + ["-np", str(ranks)] + cmd
+
+    # wait4() gives the resource usage of this run alone, RUSAGE_CHILDREN would report
+    # the maximum RSS over every run so far
+    with open(log_file, "w") as log:
+        start = time.perf_counter()
+        proc = subprocess.Popen(cmd, stdout=log, stderr=subprocess.STDOUT, cwd=workdir)
+        _, status, usage = os.wait4(proc.pid, 0)
+        wall = time.perf_counter() - start
+        proc.returncode = os.waitstatus_to_exitcode(status) if hasattr(os, "waitstatus_to_exitcode") else status
+    with open(log_file) as log:
+        output = log.read()
+
+    result = {
+        "name" : name,
+        "topology" : topology,
+        "requested_endpoints" : endpoints,
+        "load" : load,
+        "threads" : threads,
+        "ranks" : ranks,
+    }
+    if proc.returncode != 0:
+        sys.stderr.write("Benchmark '%s' failed (%d):\n%s\n" % (name, proc.returncode, output))
+        result["error"] = proc.returncode
+        return result
+
+    hops, routers = count_packet_hops(stats_prefix)
+    result.update({
+        "wall_seconds" : wall,
+        "cpu_seconds" : usage.ru_utime + usage.ru_stime,
+        # KiB on Linux.  With mpirun this is the largest child, so
+        # scale by ranks for the total.
+        "peak_rss_kb" : usage.ru_maxrss,
+        "endpoints" : parse_endpoints(output),
+        "routers" : routers,
+        "packet_hops" : hops,
+    })
+    if hops:
+        result["packet_hops_per_second"] = hops / wall
+    if routers:
+        result["rss_kb_per_router"] = usage.ru_maxrss * ranks / float(routers)
+    return result
+
+def best_of(results):
+    ok = [r for r in results if "error" not in r]
+    if not ok:
+        return results[0]
+    best = dict(min(ok, key=lambda r: r["wall_seconds"]))
+    best["repeats"] = len(results)
+    best["peak_rss_kb"] = max(r["peak_rss_kb"] for r in ok)
+    return best
+
+def add_parallel_efficiency(results):
+    configs = {}
+    for r in results:
+        if "error" in r:
+            continue
+        configs.setdefault((r["topology"], r["requested_endpoints"], r["load"]), []).append(r)
+    for runs in configs.values():
+        base = min(runs, key=lambda r: r["threads"] * r["ranks"])
+        base_work = base["wall_seconds"] * base["threads"] * base["ranks"]
+        for r in runs:
+            r["parallel_efficiency"] = base_work / (r["wall_seconds"] * r["threads"] * r["ranks"])
+
+def compare(old_file, new_file, threshold):
+    with open(old_file) as f:
+        old = { r["name"] : r for r in json.load(f)["benchmarks"] }
+    with open(new_file) as f:
+        new = { r["name"] : r for r in json.load(f)["benchmarks"] }
+
+    regressed = False
+    print("%-32s %14s %14s %8s" % ("benchmark", "old hops/s", "new hops/s", "change"))
+    for name in sorted(set(old) & set(new)):
+        if "packet_hops_per_second" not in old[name] or "packet_hops_per_second" not in new[name]:
+            continue
+        change = new[name]["packet_hops_per_second"] / old[name]["packet_hops_per_second"] - 1
+        flag = " *" if change < -threshold else ""
+        regressed = regressed or change < -threshold
+        print("%-32s %14.0f %14.0f %+7.1f%%%s" % (name, old[name]["packet_hops_per_second"], new[name]["packet_hops_per_second"], change * 100, flag))
+    return 1 if regressed else 0
+
+def parse_parallel(value):
+    parallel = []
+    for item in value.split(","):
+        threads, ranks = item.split("x")
+        parallel.append((int(threads), int(ranks)))
+    return parallel
+
+def main():
+    parser = argparse.ArgumentParser(description="merlin host throughput benchmarks")
+    parser.add_argument("--sst", default="sst", help="sst executable")
+    parser.add_argument("--mpirun", default="mpirun", help="Launcher used for runs with more than one rank")
+    parser.add_argument("--topologies", default=",".join(TOPOLOGIES), help="Comma-separated list of topologies")
+    parser.add_argument("--endpoints", default="1024", help="Comma-separated list of endpoint counts (up to 65536)")
+    parser.add_argument("--loads", default="0.5", help="Comma-separated list of offered loads")
+    parser.add_argument("--parallel", default="1x1", help="Comma-separated list of threadsxranks")
+    parser.add_argument("--collect-time", default="5us", help="Simulated time to collect over")
+    parser.add_argument("--repeat", type=int, default=1, help="Runs per benchmark, the fastest is reported")
+    parser.add_argument("--output", default="", help="JSON output file (default: stdout)")
+    parser.add_argument("--compare", nargs=2, metavar=("OLD", "NEW"), help="Compare two result files instead of running")
+    parser.add_argument("--threshold", type=float, default=0.05, help="Relative hops/s decrease reported as a regression by --compare")
+    args = parser.parse_args()
+
+    if args.compare:
+        return compare(args.compare[0], args.compare[1], args.threshold)
+
+    config = os.path.join(os.path.dirname(os.path.abspath(__file__)), "benchConfig.py")
+    topologies = args.topologies.split(",")
+    endpoints = [int(x) for x in args.endpoints.split(",")]
+    loads = [float(x) for x in args.loads.split(",")]
+    parallel = parse_parallel(args.parallel)
+
+    results = []
+    with tempfile.TemporaryDirectory() as workdir:
+        for topology, count, load, (threads, ranks) in itertools.product(topologies, endpoints, loads, parallel):
+            sys.stderr.write("Running %s with %d endpoints at load %g on %dx%d\n" % (topology, count, load, threads, ranks))
+            runs = [run_benchmark(args, config, topology, count, load, threads, ranks, workdir) for _ in range(args.repeat)]
+            results.append(best_of(runs))
+    add_parallel_efficiency(results)
+
+    report = {
+        "host" : platform.node(),
+        "platform" : platform.platform(),
+        "timestamp" : time.strftime("%Y-%m-%dT%H:%M:%S"),
+        "collect_time" : args.collect_time,
+        "benchmarks" : results,
+    }
+    text = json.dumps(report, indent=2, sort_keys=True)
+    if args.output:
+        with open(args.output, "w") as f:
+            f.write(text + "\n")
+    else:
+        print(text)
+    return 1 if any("error" in r for r in results) else 0
+
+if __name__ == "__main__":
+    sys.exit(main())
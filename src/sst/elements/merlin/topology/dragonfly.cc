@@ -269,6 +269,10 @@ topo_dragonfly::topo_dragonfly(ComponentId_t cid, Params &p, int num_ports, int
     }
 
     adaptive_threshold = p.find<double>("adaptive_threshold",2.0);
+    adaptive_smoothing = p.find<double>("adaptive_smoothing",0.0);
+    if ( adaptive_smoothing < 0.0 || adaptive_smoothing >= 1.0 ) {
+        output.fatal(CALL_INFO, -1, "Invalid adaptive_smoothing specified: %f, must be in [0,1).\n",adaptive_smoothing);
+    }
 
     bool config_failed_links = p.find<bool>("config_failed_links","false");
 
@@ -319,6 +323,12 @@ topo_dragonfly::topo_dragonfly(ComponentId_t cid, Params &p, int num_ports, int
             vns[i].algorithm = MIN_A;
             vns[i].num_vcs = 2;
         }
+        else if ( !vn_route_algos[i].compare("par") ) {
+            // One more VC than ugal for the extra hop in the source
+            // group when the route changes at the second router
+            vns[i].algorithm = PAR;
+            vns[i].num_vcs = 4;
+        }
         else {
             fatal(CALL_INFO_LONG,1,"ERROR: Unknown routing algorithm specified: %s\n",vn_route_algos[i].c_str());
         }
@@ -444,10 +454,10 @@ void topo_dragonfly::route_ugal(int port, int vc, internal_router_event* ev)
             // local_slices, but for now just get the one assigned in
             // process_input.
             int direct_route_port = port_for_router(td_ev->dest.router, td_ev->local_slice);
-            int direct_route_weight = output_queue_lengths[direct_route_port * num_vcs + vc];
+            int direct_route_weight = queue_weight(direct_route_port, vc);
 
             int valiant_route_port = port_for_router(td_ev->dest.mid_group, td_ev->local_slice);
-            int valiant_route_weight = output_queue_lengths[valiant_route_port * num_vcs + vc];
+            int valiant_route_weight = queue_weight(valiant_route_port, vc);
 
             if ( direct_route_weight <= 2 * valiant_route_weight + vns[vn].bias ) {
                 td_ev->setNextPort(direct_route_port);
@@ -470,9 +480,9 @@ void topo_dragonfly::route_ugal(int port, int vc, internal_router_event* ev)
                 // Direct routes
                 for ( int j = 0; j < params.m; ++j ) {
                     int weight;
-                    int port = port_for_group(td_ev->dest.group, i, j);
+                    int port = group_port(td_ev->dest.group, i, j);
                     if ( port != -1 ) {
-                        weight = output_queue_lengths[port * num_vcs + vc];
+                        weight = queue_weight(port, vc);
 
                         if ( weight == min_weight ) {
                             min_ports.emplace_back(port,i);
@@ -485,9 +495,9 @@ void topo_dragonfly::route_ugal(int port, int vc, internal_router_event* ev)
                     }
 
                     // Valiant routes
-                    port = port_for_group(td_ev->dest.mid_group, i, j);
+                    port = group_port(td_ev->dest.mid_group, i, j);
                     if ( port != -1 ) {
-                        weight = 2 * output_queue_lengths[port * num_vcs + vc] + vns[vn].bias;
+                        weight = 2 * queue_weight(port, vc) + vns[vn].bias;
 
                         if ( weight == min_weight ) {
                             min_ports.emplace_back(port,i);
@@ -538,7 +548,7 @@ void topo_dragonfly::route_ugal(int port, int vc, internal_router_event* ev)
             // to port_for_group.
             if ( td_ev->dest.mid_group == group_id ) {
                 // In valiant group, just route out to next group.
-                td_ev->setNextPort( port_for_group(td_ev->dest.group, td_ev->global_slice, td_ev->local_slice) );
+                td_ev->setNextPort( group_port(td_ev->dest.group, td_ev->global_slice, td_ev->local_slice) );
                 return;
             }
 
@@ -549,8 +559,8 @@ void topo_dragonfly::route_ugal(int port, int vc, internal_router_event* ev)
             // exist take the port with the least weight.
 
             // Check direct route first
-            int direct_port = port_for_group(td_ev->dest.group, td_ev->global_slice, td_ev->local_slice);
-            int valiant_port = port_for_group(td_ev->dest.mid_group, td_ev->global_slice, td_ev->local_slice);
+            int direct_port = group_port(td_ev->dest.group, td_ev->global_slice, td_ev->local_slice);
+            int valiant_port = group_port(td_ev->dest.mid_group, td_ev->global_slice, td_ev->local_slice);
 
             // Need to see if these are global ports on this router.
             // If not, then we won't consider them.  At least one of
@@ -566,8 +576,8 @@ void topo_dragonfly::route_ugal(int port, int vc, internal_router_event* ev)
                 }
                 else {
                     // Need to check weights
-                    int direct_weight = output_queue_lengths[direct_port * num_vcs + vc];
-                    int valiant_weight = 2 * output_queue_lengths[valiant_port * num_vcs + vc] + vn[vns].bias;
+                    int direct_weight = queue_weight(direct_port, vc);
+                    int valiant_weight = 2 * queue_weight(valiant_port, vc) + vn[vns].bias;
                     if ( direct_weight > valiant_weight ) {
                         min_port = valiant_port;
                     }
@@ -610,9 +620,9 @@ void topo_dragonfly::route_ugal(int port, int vc, internal_router_event* ev)
         // weight with 1, other weight with 2
         for ( int i = 0; i < params.n; ++i ) {
             for ( int j = 0; j < params.m; ++j ) {
-                int port = port_for_group(td_ev->dest.group, i, j);
+                int port = group_port(td_ev->dest.group, i, j);
                 if ( port == -1 ) continue;
-                int weight = output_queue_lengths[port * num_vcs + vc];
+                int weight = queue_weight(port, vc);
 
                 if ( !is_port_global(port) ) weight *= 2;
 
@@ -634,6 +644,94 @@ void topo_dragonfly::route_ugal(int port, int vc, internal_router_event* ev)
 
 }
 
+// Progressive adaptive routing.  Routes like ugal, except that a packet
+// leaving its group gets a second choice at the second router of the
+// source group: it may still switch between the direct and the valiant
+// group there, at the cost of another hop in the group, which moves it
+// up one VC.  Every later hop is a ugal hop from that VC on.
+void topo_dragonfly::route_par(int port, int vc, internal_router_event* ev)
+{
+    topo_dragonfly_event *td_ev = static_cast<topo_dragonfly_event*>(ev);
+    int vn = ev->getVN();
+
+    if ( port < params.p || port >= global_start || td_ev->src_group != group_id ||
+         td_ev->dest.group == group_id || vc != vns[vn].start_vc ) {
+        return route_ugal(port,vc,ev);
+    }
+
+    // Second router of the source group.  Weigh every way out of the
+    // group, counting a port that needs another local hop twice.
+    int min_weight = std::numeric_limits<int>::max();
+    std::vector<std::pair<int,int> > min_ports;
+    for ( int i = 0; i < params.n; ++i ) {
+        for ( int j = 0; j < params.m; ++j ) {
+            int weight;
+            int port = group_port(td_ev->dest.group, i, j);
+            if ( port != -1 ) {
+                weight = queue_weight(port, vc);
+                if ( !is_port_global(port) ) weight *= 2;
+
+                if ( weight == min_weight ) {
+                    min_ports.emplace_back(port,i);
+                }
+                else if ( weight < min_weight ) {
+                    min_weight = weight;
+                    min_ports.clear();
+                    min_ports.emplace_back(port,i);
+                }
+            }
+
+            port = group_port(td_ev->dest.mid_group, i, j);
+            if ( port != -1 ) {
+                weight = 2 * queue_weight(port, vc) + vns[vn].bias;
+                if ( !is_port_global(port) ) weight *= 2;
+
+                if ( weight == min_weight ) {
+                    min_ports.emplace_back(port,i);
+                }
+                else if ( weight < min_weight ) {
+                    min_weight = weight;
+                    min_ports.clear();
+                    min_ports.emplace_back(port,i);
+                }
+            }
+        }
+    }
+
+    auto& route = min_ports[rng->generateNextUInt32() % min_ports.size()];
+    td_ev->setNextPort(route.first);
+    td_ev->global_slice = route.second;
+    if ( !is_port_global(route.first) ) {
+        // The router with the global link picks between the direct and
+        // valiant groups over this slice again, as in ugal
+        td_ev->setVC(vc+1);
+    }
+}
+
+int topo_dragonfly::queue_weight(int port, int vc)
+{
+    int index = port * num_vcs + vc;
+    if ( adaptive_smoothing == 0.0 ) return output_queue_lengths[index];
+
+    if ( smoothed_queue.empty() ) {
+        smoothed_queue.resize(params.k * num_vcs, 0.0);
+        smoothed_time.resize(params.k * num_vcs, std::numeric_limits<SimTime_t>::max());
+    }
+
+    SimTime_t now = getCurrentSimCycle();
+    if ( smoothed_time[index] != now ) {
+        if ( smoothed_time[index] == std::numeric_limits<SimTime_t>::max() ) {
+            smoothed_queue[index] = output_queue_lengths[index];
+        }
+        else {
+            smoothed_queue[index] = adaptive_smoothing * smoothed_queue[index] +
+                (1.0 - adaptive_smoothing) * output_queue_lengths[index];
+        }
+        smoothed_time[index] = now;
+    }
+    return (int)(smoothed_queue[index] + 0.5);
+}
+
 void topo_dragonfly::route_mina(int port, int vc, internal_router_event* ev)
 {
     topo_dragonfly_event *td_ev = static_cast<topo_dragonfly_event*>(ev);
@@ -864,6 +962,7 @@ void topo_dragonfly::route_adaptive_local(int port, int vc, internal_router_even
 void topo_dragonfly::route_packet(int port, int vc, internal_router_event* ev) {
     int vn = ev->getVN();
     if ( vns[vn].algorithm == UGAL ) return route_ugal(port,vc,ev);
+    if ( vns[vn].algorithm == PAR ) return route_par(port,vc,ev);
     if ( vns[vn].algorithm == MIN_A ) return route_mina(port,vc,ev);
     route_nonadaptive(port,vc,ev);
     route_adaptive_local(port,vc,ev);
@@ -888,6 +987,7 @@ internal_router_event* topo_dragonfly::process_input(RtrEvent* ev)
     case VALIANT:
     case ADAPTIVE_LOCAL:
     case UGAL:
+    case PAR:
         if ( dstAddr.group == group_id ) {
             // staying within group, set mid_group to be an intermediate router within group
             do {
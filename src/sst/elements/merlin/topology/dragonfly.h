@@ -20,6 +20,8 @@
 #define COMPONENTS_MERLIN_TOPOLOGY_DRAGONFLY_H
 
 #include <algorithm>
+#include <limits>
+#include <vector>
 
 #include <sst/core/event.h>
 #include <sst/core/link.h>
@@ -194,7 +196,7 @@ public:
         {"dragonfly.intergroup_links",      "Number of links between each pair of groups."},
         {"dragonfly.intragroup_links",      "Number of links between each pair of routers in a group."},
         {"dragonfly.num_groups",            "Number of groups in network."},
-        {"dragonfly.algorithm",             "Routing algorithm to use [minmal (default) | valiant].", "minimal"},
+        {"dragonfly.algorithm",             "Routing algorithm to use [minmal (default) | valiant | adaptive-local | ugal | min-a | par].", "minimal"},
         {"dragonfly.adaptive_threshold",    "Threshold to use when make adaptive routing decisions.", "2.0"},
         {"dragonfly.global_link_map",       "Array specifying connectivity of global links in each dragonfly group."},
         {"dragonfly.global_route_mode",     "Mode for intepreting global link map [absolute (default) | relative].","absolute"},
@@ -206,8 +208,9 @@ public:
         {"intergroup_links",      "Number of links between each pair of groups."},
         {"intragroup_links",      "Number of links between each pair of of routers in a group."},
         {"num_groups",            "Number of groups in network."},
-        {"algorithm",             "Routing algorithm to use [minmal (default) | valiant].", "minimal"},
+        {"algorithm",             "Routing algorithm to use [minmal (default) | valiant | adaptive-local | ugal | min-a | par].", "minimal"},
         {"adaptive_threshold",    "Threshold to use when make adaptive routing decisions.", "2.0"},
+        {"adaptive_smoothing",    "Weight [0,1) of the old value when ugal and par smooth output queue lengths over time. The estimate of a port moves once per time step, on the first route that looks at it, so packets routed in the same step see the same value. 0 uses the current queue lengths.", "0"},
         {"global_link_map",       "Array specifying connectivity of global links in each dragonfly group."},
         {"global_route_mode",     "Mode for intepreting global link map [absolute (default) | relative].","absolute"},
         {"config_failed_links",   "Controls whether or not failed links are considered","False"},
@@ -219,7 +222,8 @@ public:
         VALIANT,
         ADAPTIVE_LOCAL,
         UGAL,
-        MIN_A
+        MIN_A,
+        PAR
     };
 
     RouteToGroup group_to_global_port;
@@ -287,6 +291,24 @@ private:
     int32_t port_for_group_init(uint32_t group, uint32_t global_slice);
     int32_t hops_to_router(uint32_t group, uint32_t router, uint32_t slice);
 
+    // port_for_group() through a table that is filled in as routes are
+    // looked up; the global links and failed links do not change once
+    // the simulation runs
+    inline int32_t group_port(uint32_t group, uint32_t global_slice, uint32_t local_slice) {
+        size_t index = ((size_t)group * params.n + global_slice) * params.m + local_slice;
+        if ( group_ports.empty() ) group_ports.resize((size_t)params.g * params.n * params.m, (int32_t)unset_port);
+        if ( group_ports[index] == unset_port ) group_ports[index] = port_for_group(group, global_slice, local_slice);
+        return group_ports[index];
+    }
+    static const int32_t unset_port = std::numeric_limits<int32_t>::min();
+    std::vector<int32_t> group_ports;
+
+    // Congestion of an output port/VC as seen by the adaptive routes
+    int queue_weight(int port, int vc);
+    double adaptive_smoothing;
+    std::vector<double> smoothed_queue;
+    std::vector<SimTime_t> smoothed_time;
+
     inline bool is_port_endpoint(uint32_t port) const { return ( port < params.p ); }
     inline bool is_port_local_group(uint32_t port) const { return (port >= params.p && port < (params.p + params.a -1 )); }
     inline bool is_port_global(uint32_t port) const { return ( port >= params.p + params.a - 1 ); }
@@ -304,6 +326,7 @@ private:
     void route_adaptive_local(int port, int vc, internal_router_event* ev);
     void route_ugal(int port, int vc, internal_router_event* ev);
     void route_mina(int port, int vc, internal_router_event* ev);
+    void route_par(int port, int vc, internal_router_event* ev);
 
 };
 
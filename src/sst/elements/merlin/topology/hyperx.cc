@@ -19,6 +19,7 @@
 #include "sst/core/rng/xorshift.h"
 
 #include <algorithm>
+#include <fstream>
 #include <stdlib.h>
 
 
@@ -76,9 +77,24 @@ topo_hyperx::topo_hyperx(ComponentId_t cid, Params& params, int num_ports, int r
         output.fatal(CALL_INFO, -1, "Number of ports should be at least %d for this configuration\n", needed_ports);
     }
 
+    dim_stride = new int[dimensions];
+    dim_stride[0] = 1;
+    for ( int d = 1 ; d < dimensions ; d++ ) {
+        dim_stride[d] = dim_stride[d-1] * dim_size[d-1];
+    }
+
     id_loc = new int[dimensions];
     idToLocation(router_id, id_loc);
 
+    dim_port = new int*[dimensions];
+    for ( int d = 0 ; d < dimensions ; d++ ) {
+        dim_port[d] = new int[dim_size[d]];
+        for ( int coord = 0 ; coord < dim_size[d] ; coord++ ) {
+            if ( coord == id_loc[d] ) dim_port[d][coord] = -1;
+            else dim_port[d][coord] = port_start[d] + (coord - ((coord > id_loc[d]) ? 1 : 0)) * dim_width[d];
+        }
+    }
+
 
     vns = new vn_info[num_vns];
 
@@ -111,6 +127,14 @@ topo_hyperx::topo_hyperx(ComponentId_t cid, Params& params, int num_ports, int r
             vns[i].algorithm = VDAL;
             vns[i].num_vcs = 2 * dimensions;
         }
+        else if ( !vn_route_algos[i].compare("DAL") ) {
+            if ( dimensions > 32 ) {
+                output.fatal(CALL_INFO,-1,"DAL routing supports at most 32 dimensions\n");
+            }
+            // VC 0 is adaptive, VC 1 is the DOR escape VC
+            vns[i].algorithm = DAL;
+            vns[i].num_vcs = 2;
+        }
         else if ( !vn_route_algos[i].compare("DOR-ND") ) {
             vns[i].algorithm = DORND;
             vns[i].num_vcs = 1;
@@ -137,16 +161,25 @@ topo_hyperx::topo_hyperx(ComponentId_t cid, Params& params, int num_ports, int r
         total_routers *= dim_size[i];
     }
 
-    
-    
+    use_routing_table = params.find<bool>("use_routing_table", false);
+    std::string dump_file = params.find<std::string>("dump_routing_table", "");
+    if ( use_routing_table || dump_file != "" ) {
+        buildRoutingTable();
+    }
+    if ( dump_file != "" ) {
+        dumpRoutingTable(dump_file);
+    }
 }
 
 topo_hyperx::~topo_hyperx()
 {
     delete [] vns;
     delete [] id_loc;
+    for ( int d = 0; d < dimensions; d++ ) delete [] dim_port[d];
+    delete [] dim_port;
     delete [] dim_size;
     delete [] dim_width;
+    delete [] dim_stride;
     delete [] port_start;
 }
 
@@ -185,6 +218,10 @@ topo_hyperx::route_packet(int port, int vc, internal_router_event* ev)
     else if ( vns[vn].algorithm == VDAL ) {
         return routeVDAL(port,vc,tt_ev);
     }
+
+    else if ( vns[vn].algorithm == DAL ) {
+        return routeDAL(port,vc,tt_ev);
+    }
     
     // Look for opportunities to adaptively route
 
@@ -288,13 +325,9 @@ void
 topo_hyperx::idToLocation(int rtr_id, int *location) const
 {
 	for ( int i = dimensions - 1; i > 0; i-- ) {
-		int div = 1;
-		for ( int j = 0; j < i; j++ ) {
-			div *= dim_size[j];
-		}
-		int value = (rtr_id / div);
+		int value = (rtr_id / dim_stride[i]);
 		location[i] = value;
-		rtr_id -= (value * div);
+		rtr_id -= (value * dim_stride[i]);
 	}
 	location[0] = rtr_id;
 }
@@ -378,10 +411,7 @@ topo_hyperx::routeDORBase(int* dest_loc) {
     for ( int dim = 0 ; dim < dimensions ; ++dim ) {
         // Find first unaligned dimension and route to align it
         if ( dest_loc[dim] != id_loc[dim] ) {
-            // Get offset to the first unaligned dimension
-            int offset = dest_loc[dim] - ((dest_loc[dim] > id_loc[dim]) ? 1 : 0);
-            offset *= dim_width[dim];
-            return std::make_pair(dim,port_start[dim] + offset);
+            return std::make_pair(dim,dim_port[dim][dest_loc[dim]]);
         }
     }
     return std::make_pair(-1,-1);
@@ -389,6 +419,21 @@ topo_hyperx::routeDORBase(int* dest_loc) {
 
 void
 topo_hyperx::routeDOR(int port, int vc, topo_hyperx_event* ev) {
+    if ( use_routing_table ) {
+        // The first candidate is always the DOR port
+        int dest_router = get_dest_router(ev->getDest());
+        if ( dest_router == router_id ) {
+            ev->setNextPort(get_dest_local_port(ev->getDest()));
+        }
+        else {
+            const RoutingTable::Candidate* cands;
+            routing_table.getCandidates(dest_router, cands);
+            ev->setNextPort(cands[0].port);
+        }
+        ev->setVC(vc);
+        return;
+    }
+
     std::pair<int,int> next_port = routeDORBase(ev->dest_loc);
 
     if ( next_port.first == -1 ) {
@@ -481,15 +526,14 @@ topo_hyperx::routeDOAL(int port, int vc, topo_hyperx_event* ev) {
             // already adaptively routed, if so, then we have to go
             // direct for this dimension
             if ( ( vc - vns[ev->getVN()].start_vc ) == 1 ) {
-                // Get offset in the dimension
-                int offset = ev->dest_loc[dim] - ((ev->dest_loc[dim] > id_loc[dim]) ? 1 : 0);
-                offset *= dim_width[dim];
+                // First minimal port in the dimension
+                int offset = dim_port[dim][ev->dest_loc[dim]];
                 
                 // Choose the least loaded route to the next router
                 int min = 0x7FFFFFFF;
                 int min_port;
                 
-                for ( int p = port_start[dim] + offset; p < port_start[dim] + offset + dim_width[dim]; ++p ) {
+                for ( int p = offset; p < offset + dim_width[dim]; ++p ) {
                     int weight = output_queue_lengths[p * num_vcs + vc];
                     if ( weight < min ) {
                         min = weight;
@@ -511,17 +555,10 @@ topo_hyperx::routeDOAL(int port, int vc, topo_hyperx_event* ev) {
                 int min_port = 0;
                 int min_weight = 0x7fffffff;
                 int min_vc = vc;
+                // Starting port for the minimal link(s)
+                int offset = dim_port[dim][ev->dest_loc[dim]];
                 for ( int curr_port = port_start[dim]; curr_port < port_start[dim] + ((dim_size[dim] - 1) * dim_width[dim]); ++curr_port  ) {
                     // See if this is a minimal route
-                    
-                    // Compute the base offset in this dimension for
-                    // the minimal route (this is essentially what the
-                    // offset would be if the width in this dimension
-                    // is 1).
-                    int offset = ev->dest_loc[dim] - ((ev->dest_loc[dim] > id_loc[dim]) ? 1 : 0);
-                    
-                    // Now get the actual starting port for the minimal link(s)
-                    offset = port_start[dim] + ( offset * dim_width[dim]);
                     if ( curr_port >= offset && curr_port < offset + dim_width[dim] ) {
                         // This is a minimal route.  We would use VC 0
                         // in the VN, which is the VC the packet came
@@ -575,12 +612,29 @@ topo_hyperx::routeMINA(int port, int vc, topo_hyperx_event* ev) {
 
     int min_weight = 0x7fffffff;;
     int min_port = -1;
+    int next_vc = vns[vn].start_vc + vc_in_vn + 1;
+    if ( use_routing_table ) {
+        // Candidates are in the same order as the loop below, so
+        // ties are broken the same way
+        const RoutingTable::Candidate* cands;
+        int count = routing_table.getCandidates(dest_router, cands);
+        for ( int i = 0; i < count; ++i ) {
+            int weight = output_queue_lengths[(cands[i].port * num_vcs) + next_vc];
+            if ( weight < min_weight ) {
+                min_port = cands[i].port;
+                min_weight = weight;
+            }
+        }
+        ev->setNextPort(min_port);
+        ev->setVC(next_vc);
+        return;
+    }
+
     for ( int dim = 0; dim < dimensions; ++dim ) {
         if ( ev->dest_loc[dim] == id_loc[dim] ) continue;
 
         // Find the minimum weight, minimally-routed port
-        int offset = ev->dest_loc[dim] - ((ev->dest_loc[dim] > id_loc[dim]) ? 1 : 0);
-        offset = port_start[dim] + (offset * dim_width[dim]);
+        int offset = dim_port[dim][ev->dest_loc[dim]];
 
         for ( int i = offset; i < offset + dim_width[dim]; ++i ) {
             int weight = output_queue_lengths[(i * num_vcs) + vns[vn].start_vc + vc_in_vn + 1];
@@ -698,3 +752,123 @@ topo_hyperx::routeVDAL(int port, int vc, topo_hyperx_event* ev) {
     ev->setVC(next_vc);
 }
 
+
+void
+topo_hyperx::routeDAL(int port, int vc, topo_hyperx_event* ev) {
+    // Check to see if we made it to the dest router
+    int dest_router = get_dest_router(ev->getDest());
+    if ( dest_router == router_id ) {
+        ev->setNextPort(get_dest_local_port(ev->getDest()));
+        return;
+    }
+
+    int vn = ev->getVN();
+    int adaptive_vc = vns[vn].start_vc;
+    int escape_vc = adaptive_vc + 1;
+
+    // Once on the escape VC the packet stays on the DOR route that
+    // route_packet() already set
+    if ( vc == escape_vc && port < local_port_start ) return;
+
+    // Any port in an unaligned dimension can be taken, but only one
+    // non-minimal hop is allowed in each dimension.  Non-minimal
+    // ports are weighted the same way as in DOAL and VDAL.
+    int min_weight = 0x7fffffff;
+    int min_port = -1;
+    int min_dim = -1;
+    bool min_minimal = true;
+
+    for ( int dim = 0; dim < dimensions; ++dim ) {
+        if ( ev->dest_loc[dim] == id_loc[dim] ) continue;
+        bool derouted = ev->derouted_dims & (1u << dim);
+
+        for ( int coord = 0; coord < dim_size[dim]; ++coord ) {
+            if ( coord == id_loc[dim] ) continue;
+            bool minimal = coord == ev->dest_loc[dim];
+            if ( !minimal && derouted ) continue;
+
+            for ( int p = dim_port[dim][coord]; p < dim_port[dim][coord] + dim_width[dim]; ++p ) {
+                int queue = output_queue_lengths[p * num_vcs + adaptive_vc];
+                int weight = minimal ? queue : 2 * queue + 1;
+                if ( weight < min_weight ) {
+                    min_weight = weight;
+                    min_port = p;
+                    min_dim = dim;
+                    min_minimal = minimal;
+                }
+            }
+        }
+    }
+
+    // Escape to DOR when the adaptive choice can't take the packet
+    if ( output_credits[min_port * num_vcs + adaptive_vc] <= 0 ) {
+        ev->setVC(escape_vc);
+        return;
+    }
+
+    if ( !min_minimal ) ev->derouted_dims |= (1u << min_dim);
+    ev->setNextPort(min_port);
+    ev->setVC(adaptive_vc);
+}
+
+
+// Routing tables
+
+void
+topo_hyperx::buildRoutingTable()
+{
+    // Candidates for each destination are all the minimal ports, in
+    // dimension order.  The first one is the DOR route.
+    int* loc = new int[dimensions];
+    routing_table.init(total_routers);
+    for ( int rtr = 0; rtr < total_routers; ++rtr ) {
+        if ( rtr == router_id ) continue;
+        idToLocation(rtr, loc);
+        for ( int dim = 0; dim < dimensions; ++dim ) {
+            if ( loc[dim] == id_loc[dim] ) continue;
+            int offset = dim_port[dim][loc[dim]];
+            for ( int i = offset; i < offset + dim_width[dim]; ++i ) {
+                routing_table.addCandidate(rtr, i);
+            }
+        }
+    }
+    routing_table.finalize();
+    delete [] loc;
+}
+
+void
+topo_hyperx::dumpRoutingTable(const std::string& filename)
+{
+    std::string name = filename + "." + std::to_string(router_id);
+    std::ofstream out(name);
+    if ( !out.is_open() ) {
+        output.fatal(CALL_INFO, -1, "Unable to open routing table dump file: %s\n", name.c_str());
+    }
+
+    out << "routers " << total_routers << "\n";
+    for ( int i = 0; i < num_local_ports; ++i ) {
+        out << "endpoint " << (router_id * num_local_ports) + i << " " << router_id << " " << local_port_start + i << "\n";
+    }
+
+    // Each link is written by the router with the lower id
+    int* loc = new int[dimensions];
+    for ( int dim = 0; dim < dimensions; ++dim ) {
+        for ( int p = port_start[dim]; p < port_start[dim] + (dim_size[dim] - 1) * dim_width[dim]; ++p ) {
+            int offset = (p - port_start[dim]) / dim_width[dim];
+            int link = (p - port_start[dim]) % dim_width[dim];
+
+            memcpy(loc, id_loc, dimensions * sizeof(int));
+            loc[dim] = offset >= id_loc[dim] ? offset + 1 : offset;
+            int peer = 0;
+            for ( int d = dimensions - 1; d >= 0; --d ) peer = (peer * dim_size[d]) + loc[d];
+            if ( peer < router_id ) continue;
+
+            int peer_offset = id_loc[dim] > loc[dim] ? id_loc[dim] - 1 : id_loc[dim];
+            int peer_port = port_start[dim] + (peer_offset * dim_width[dim]) + link;
+            out << "link " << router_id << " " << p << " " << peer << " " << peer_port << "\n";
+        }
+    }
+    delete [] loc;
+
+    routing_table.write(out, router_id);
+}
@@ -28,6 +28,7 @@
 #include <vector>
 
 #include "sst/elements/merlin/router.h"
+#include "sst/elements/merlin/topology/routingTable.h"
 
 namespace SST {
 namespace Merlin {
@@ -43,13 +44,16 @@ public:
 
     id_type id;
     bool rerouted;
+    // Bit per dimension that DAL has already taken a non-minimal hop in
+    uint32_t derouted_dims;
 
     topo_hyperx_event() : internal_router_event() {}
     topo_hyperx_event(int dim) :
         internal_router_event(),
         dimensions(dim),
         last_routing_dim(-1),
-        val_route_dest(false)
+        val_route_dest(false),
+        derouted_dims(0)
     {
         dest_loc = new int[dim];
         val_loc = new int[dim];
@@ -60,7 +64,9 @@ public:
     {
         topo_hyperx_event* tte = new topo_hyperx_event(*this);
         tte->dest_loc = new int[dimensions];
+        tte->val_loc = new int[dimensions];
         memcpy(tte->dest_loc, dest_loc, dimensions*sizeof(int));
+        memcpy(tte->val_loc, val_loc, dimensions*sizeof(int));
         return tte;
     }
 
@@ -94,6 +100,7 @@ public:
         ser & val_route_dest;
         ser & id;
         ser & rerouted;
+        ser & derouted_dims;
     }
 
 protected:
@@ -170,7 +177,13 @@ public:
         {"width", "Number of links between routers in each dimension, specified in same manner as for shape.  "
                   "For example, 2x2x1 denotes 2 links in the x and y dimensions and one in the z dimension."},
         {"local_ports", "Number of endpoints attached to each router."},
-        {"algorithm", "Routing algorithm to use.", "DOR"}
+        {"algorithm", "Routing algorithm to use: DOR, DOR-ND, MIN-A, valiant, DOAL, VDAL or DAL.  DAL routes adaptively in any "
+                      "unaligned dimension, taking at most one non-minimal hop per dimension, and falls back to DOR on an escape VC "
+                      "when the chosen port has no credits.", "DOR"},
+        {"use_routing_table", "Precompute the minimal next hop ports to every router at setup and use them for DOR and MIN-A "
+                              "routing instead of computing the route for each packet.", "false"},
+        {"dump_routing_table", "If set, write this router's endpoints, links and minimal next hop ports to <file>.<router id>, "
+                               "in the format read by merlin.table.  The files for all routers can be concatenated.", ""}
     )
 
     enum RouteAlgo {
@@ -179,7 +192,8 @@ public:
         MINA,
         VALIANT,
         DOAL,
-        VDAL
+        VDAL,
+        DAL
     };
 
 private:
@@ -189,9 +203,13 @@ private:
     int dimensions;
     int* dim_size;
     int* dim_width;
+    int* dim_stride; // router id step of one hop in each dimension
     int total_routers;
 
     int* port_start; // where does each dimension start
+    // First port to each coordinate in each dimension, -1 for this
+    // router's own coordinate
+    int** dim_port;
 
     int num_local_ports;
     int local_port_start;
@@ -212,6 +230,9 @@ private:
 
     vn_info* vns;
 
+    bool use_routing_table;
+    RoutingTable routing_table;
+
 
 public:
     topo_hyperx(ComponentId_t cid, Params& p, int num_ports, int rtr_id, int num_vns);
@@ -250,7 +271,11 @@ private:
     void routeMINA(int port, int vc, topo_hyperx_event* ev);
     void routeDOAL(int port, int vc, topo_hyperx_event* ev);
     void routeVDAL(int port, int vc, topo_hyperx_event* ev);
+    void routeDAL(int port, int vc, topo_hyperx_event* ev);
     void routeValiant(int port, int vc, topo_hyperx_event* ev);
+
+    void buildRoutingTable();
+    void dumpRoutingTable(const std::string& filename);
 };
 
 }
@@ -0,0 +1,120 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#include <sst_config.h>
+#include "polarGraph.h"
+
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <sstream>
+
+using namespace SST::Merlin;
+
+const uint16_t PolarGraph::NO_ROUTE;
+
+
+const PolarGraph*
+PolarGraph::load(const std::string& filename, Output& output)
+{
+    // Every router in a rank reads the same file, so only parse it once
+    static std::mutex lock;
+    static std::map<std::string, PolarGraph*> loaded;
+
+    std::lock_guard<std::mutex> guard(lock);
+    auto it = loaded.find(filename);
+    if ( it != loaded.end() ) return it->second;
+
+    PolarGraph* graph = new PolarGraph();
+    graph->parse(filename, output);
+    loaded[filename] = graph;
+    return graph;
+}
+
+void
+PolarGraph::parse(const std::string& filename, Output& output)
+{
+    std::ifstream in(filename);
+    if ( !in.is_open() ) {
+        output.fatal(CALL_INFO, -1, "Unable to open topology file: %s\n", filename.c_str());
+    }
+
+    std::string line;
+    int num_routers = 0;
+    int num_links = 0;
+    if ( std::getline(in, line) ) {
+        std::istringstream header(line);
+        header >> num_routers >> num_links;
+    }
+    if ( num_routers <= 0 ) {
+        output.fatal(CALL_INFO, -1, "%s: expected '<num_routers> <num_links>' on the first line\n", filename.c_str());
+    }
+
+    offsets.reserve(num_routers + 1);
+    neighbors.reserve(2 * num_links);
+    offsets.push_back(0);
+    while ( std::getline(in, line) && (int)offsets.size() <= num_routers ) {
+        std::istringstream tokens(line);
+        int v;
+        while ( tokens >> v ) {
+            if ( v < 0 || v >= num_routers ) {
+                output.fatal(CALL_INFO, -1, "%s:%d: router %d is out of range\n", filename.c_str(), (int)offsets.size() + 1, v);
+            }
+            neighbors.push_back(v);
+        }
+        if ( (int)(neighbors.size() - offsets.back()) >= NO_ROUTE ) {
+            output.fatal(CALL_INFO, -1, "%s:%d: router has too many neighbors\n", filename.c_str(), (int)offsets.size() + 1);
+        }
+        offsets.push_back(neighbors.size());
+    }
+
+    if ( (int)offsets.size() != num_routers + 1 ) {
+        output.fatal(CALL_INFO, -1, "%s: expected adjacency lists for %d routers, found %d\n", filename.c_str(), num_routers, (int)offsets.size() - 1);
+    }
+}
+
+void
+PolarGraph::buildRouteTable(int rtr, std::vector<uint16_t>& table) const
+{
+    table.assign(getNumRouters(), NO_ROUTE);
+
+    std::vector<int> frontier;
+    std::vector<int> next;
+
+    const int* adj = getNeighbors(rtr);
+    int degree = getDegree(rtr);
+    for ( int port = 0; port < degree; ++port ) {
+        table[adj[port]] = port;
+        frontier.push_back(adj[port]);
+    }
+
+    while ( !frontier.empty() ) {
+        for ( int v : frontier ) {
+            uint16_t port = table[v];
+            const int* v_adj = getNeighbors(v);
+            int v_degree = getDegree(v);
+            for ( int i = 0; i < v_degree; ++i ) {
+                int u = v_adj[i];
+                if ( table[u] == NO_ROUTE && u != rtr ) {
+                    table[u] = port;
+                    next.push_back(u);
+                }
+            }
+        }
+        frontier.swap(next);
+        next.clear();
+    }
+}
@@ -0,0 +1,68 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef COMPONENTS_MERLIN_TOPOLOGY_POLARGRAPH_H
+#define COMPONENTS_MERLIN_TOPOLOGY_POLARGRAPH_H
+
+#include <sst/core/output.h>
+
+#include <stdint.h>
+#include <string>
+#include <vector>
+
+namespace SST {
+namespace Merlin {
+
+/*
+ * Router graph used by the polarfly and polarstar topologies, read
+ * from the adjacency list files they are generated into.  The first
+ * line holds the number of routers and links, then line i+1 lists the
+ * neighbors of router i in port order.
+ *
+ * Files are parsed once per process and shared read-only by every
+ * router that uses them, so each router only pays for building its
+ * own next hop table.
+ */
+class PolarGraph {
+public:
+    // Next hop entry for the router itself
+    static const uint16_t NO_ROUTE = 0xffff;
+
+    static const PolarGraph* load(const std::string& filename, Output& output);
+
+    inline int getNumRouters() const { return offsets.size() - 1; }
+    inline int getDegree(int rtr) const { return offsets[rtr + 1] - offsets[rtr]; }
+    inline const int* getNeighbors(int rtr) const { return neighbors.data() + offsets[rtr]; }
+
+    // Fills table with the network port (not counting host ports) rtr
+    // uses toward every router, which is the port of the first hop on
+    // a breadth first search from rtr that visits neighbors in port
+    // order
+    void buildRouteTable(int rtr, std::vector<uint16_t>& table) const;
+
+private:
+    PolarGraph() {}
+
+    void parse(const std::string& filename, Output& output);
+
+    std::vector<int> offsets;
+    std::vector<int> neighbors;
+};
+
+}
+}
+
+#endif // COMPONENTS_MERLIN_TOPOLOGY_POLARGRAPH_H
@@ -226,94 +226,38 @@ void topo_polarfly::initPolarGraph() {
     char dir[256];
     getcwd(dir, 256);
     std::string filepath    = std::string(dir) + "/polarfly_data/PolarFly.q_" + std::to_string(this->q) + ".txt";
-    
-    std::fstream fp;
-    fp.open(filepath.c_str(), std::ios::in);
-
-    std::string line;
-    int line_no = 0;
-    int fV, fE, v;
-    while(std::getline(fp, line))
-    {   
-        std::istringstream iss(line);
-        if (line_no == 0)
-        {
-            iss>>fV; 
-            iss>>fE;
-        }
-        else
-        {
-            this->polar.push_back(std::vector<int>());
-            int u   = line_no - 1; 
-            while(iss >> v)
-                this->polar[u].push_back(v);
-        }
-        line_no += 1;
-    } 
-    fp.close();
 
-    assert(fV==this->total_routers);
+    //The graph is shared by all the routers in this process
+    this->polar = PolarGraph::load(filepath, output);
+
+    if (polar->getNumRouters() != this->total_routers)
+        output.fatal(CALL_INFO, -1, "%s has %d routers, but total_routers is %d\n", filepath.c_str(), polar->getNumRouters(), this->total_routers);
 }
 
 
 void topo_polarfly::initRouteTable() {
 
-    int i, j, k, neighbor;
-    int links, neighbor_links, NODES;
+    int i, NODES;
 
     NODES           = this->total_routers;
+    node_links      = polar->getDegree(router_id);
 
-    /* allocate the routing tables */
-    route_table.resize(NODES); // route_table[j] contains the port link from current router to router/node j (could be 1 hop or 2 hop)
-    node_links      = polar[router_id].size();
-  
-    for( i = 0; i < NODES; i++ )
-        route_table[i]          = -1;
-    neighbor_list.resize(node_links);
-    neighbor_list.assign(polar[router_id].begin(), polar[router_id].end());
+    neighbor_list.assign(polar->getNeighbors(router_id), polar->getNeighbors(router_id) + node_links);
 
-    /* initialize the routing table */
-    for( i = 0; i < node_links; i++)
-    {
-        // 1-hop neighbor 
-        neighbor                = polar[router_id][i];
-        route_table[neighbor]   = i;
-        neighbor_links          = polar[neighbor].size();
-    }
-    for( i = 0; i < node_links; i++)
-    {
-        neighbor                = polar[router_id][i];
-        neighbor_links          = polar[neighbor].size();
-        for( j = 0; j < neighbor_links; j++)
-        {
-            // 2-hop neighbors, not already covered
-            int neigh2          = polar[neighbor][j];
-
-            if (route_table[neigh2]<0 && neigh2!=router_id)
-                route_table[neigh2] = i;
-        }
-    }
+    /* route_table[j] contains the port link from current router to router/node j (1 hop or 2 hop) */
+    polar->buildRouteTable(router_id, route_table);
 
     /* make sure the table is properly built */
     for( i = 0; i < NODES; i++ )
     {
 	    if ( i != router_id ) 
         {
-	        assert(route_table[i] >= 0);
+	        assert(route_table[i] != PolarGraph::NO_ROUTE);
             assert(route_table[i] < node_links);
         }
 	    else
-	        assert( route_table[i] == -1 );
+	        assert( route_table[i] == PolarGraph::NO_ROUTE );
     }       
-
-    //Free memory associated with graph topology
-    for( i = 0; i < NODES; i++)
-    {
-        std::vector<int> tmp;
-        polar[i].swap(tmp);
-    } 
-    std::vector<std::vector<int>> tmp;
-    polar.swap(tmp);
 }
 
 
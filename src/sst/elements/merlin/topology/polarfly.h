@@ -24,6 +24,7 @@
 #include <sstream>
 
 #include "sst/elements/merlin/router.h"
+#include "sst/elements/merlin/topology/polarGraph.h"
 
 
 namespace SST {
@@ -149,7 +150,7 @@ public:
 
     //network radix of router
     int node_links;
-    std::vector<int> route_table; //output port for each destination
+    std::vector<uint16_t> route_table; //output port for each destination
     std::vector<int> neighbor_list; //all neighbors of current router
 
     int num_vns;
@@ -161,7 +162,7 @@ public:
     int output_buffer_size;
     int adaptive_bias;
 
-    std::vector<std::vector<int>> polar;
+    const PolarGraph* polar;
 
     //For now, doing this in a very dumb way, need to figure out a right way to do it with an vector array of statistics
     Statistic<uint32_t>* hopcount1;
@@ -66,7 +66,8 @@ topo_polarstar::topo_polarstar(ComponentId_t cid, Params& params, int num_ports,
      nodes and links to set the globals */
     initPolarGraph();
     
-    assert(total_routers == polar.size());
+    if (polar->getNumRouters() != total_routers)
+        output.fatal(CALL_INFO, -1, "PolarStar graph has %d routers, but total_routers is %d\n", polar->getNumRouters(), total_routers);
 
     /* Initialize the routing table*/
     initRouteTable();
@@ -293,101 +294,34 @@ void topo_polarstar::initPolarGraph() {
                             + "_sn_" + this->sn_type +
                             "_snq_" + std::to_string(this->snq) + ".txt";
 
-    std::fstream fp;
-    fp.open(filepath.c_str(), std::ios::in);
-
-    std::string line;
-    int line_no = 0;
-    int fV, fE, v;
-    while(std::getline(fp, line))
-    {
-        std::istringstream iss(line);
-        if (line_no == 0)
-        {
-            iss>>fV; 
-            iss>>fE;
-        }
-        else
-        {
-            this->polar.push_back(std::vector<int>());
-            int u   = line_no - 1;
-            while(iss >> v)
-                this->polar[u].push_back(v);
-        }
-        line_no += 1;
-    }
-    fp.close();
+    //The graph is shared by all the routers in this process
+    this->polar = PolarGraph::load(filepath, output);
 }
 
 
 void topo_polarstar::initRouteTable() {
 
-    int i, j, k, neighbor, links, NODES;
+    int i, NODES;
 
     NODES = this->total_routers;
+    node_links      = polar->getDegree(router_id);
 
-    /* allocate the routing tables */
-    route_table.resize(NODES); // route_table[j] contains the port link from current router to router/node j (could be 1 hop or 2 hop)
-    node_links      = polar[router_id].size();
-  
-    for( i = 0; i < NODES; i++ )
-        route_table[i]  = -1;
-    neighbor_list.resize(node_links);
-    neighbor_list.assign(polar[router_id].begin(), polar[router_id].end());
+    neighbor_list.assign(polar->getNeighbors(router_id), polar->getNeighbors(router_id) + node_links);
 
-    std::vector<int> frontier;
-    std::vector<int> nxt;
-
-    /* initialize the routing table */
-    for (j = 0; j < node_links; j++)
-    {
-        neighbor                = polar[router_id][j];   
-        route_table[neighbor]   = j;
-        frontier.push_back(neighbor);
-    }
-    while(frontier.size()>0)
-    {
-        int fs      = frontier.size();
-        for (i=0; i<fs; i++)
-        {
-            int v       = frontier[i];
-            int pId     = route_table[v]; assert(pId >= 0);
-            links       = polar[v].size();
-           
-            for (j=0; j<links; j++)
-            {
-                neighbor    = polar[v][j];
-                if ((route_table[neighbor] < 0) && (neighbor != router_id))
-                {
-                    route_table[neighbor]   = pId;
-                    nxt.push_back(neighbor);
-                }
-            }
-        }
-        frontier.swap(nxt);
-        nxt.clear();
-    }
+    /* route_table[j] contains the port link from current router to router/node j, found by a BFS over the graph */
+    polar->buildRouteTable(router_id, route_table);
 
     /* make sure the table is properly built */
     for( i = 0; i < NODES; i++ )
     {
 	    if ( i != router_id ) 
         {
-	        assert(route_table[i] >= 0);
+	        assert(route_table[i] != PolarGraph::NO_ROUTE);
             assert(route_table[i] < node_links);
         }
 	    else
-	        assert( route_table[i] == -1 );
+	        assert( route_table[i] == PolarGraph::NO_ROUTE );
     }       
-
-    //Free memory associated with graph topology
-    for( i = 0; i < NODES; i++)
-    {
-        std::vector<int> tmp;
-        polar[i].swap(tmp);
-    } 
-    std::vector<std::vector<int>> tmp;
-    polar.swap(tmp);
 }
 
 //For now, while building the polarstar topology, we assume all local ports of the switch are connected to the endpoints
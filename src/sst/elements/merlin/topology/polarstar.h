@@ -23,6 +23,7 @@
 #include <sstream>
 
 #include "sst/elements/merlin/router.h"
+#include "sst/elements/merlin/topology/polarGraph.h"
 
 namespace SST {
 namespace Merlin {
@@ -152,7 +153,7 @@ public:
     RouteAlgo routing_algo;
 
     int node_links;
-    std::vector<int> route_table;
+    std::vector<uint16_t> route_table;
     std::vector<int> neighbor_list;
 
     int num_vns;
@@ -164,7 +165,7 @@ public:
     int output_buffer_size;
     int adaptive_bias;
 
-    std::vector<std::vector<int>> polar;
+    const PolarGraph* polar;
 
     //For now, doing this in a very dumb way, need to figure out a right way to do it with an vector array of statistics
     Statistic<uint32_t>* hopcount1;
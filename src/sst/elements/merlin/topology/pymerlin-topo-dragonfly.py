@@ -23,7 +23,7 @@ class topoDragonFly(Topology):
 
     def __init__(self):
         Topology.__init__(self)
-        self._declareClassVariables(["link_latency","host_link_latency","global_link_map"])
+        self._declareClassVariables(["link_latency","host_link_latency","global_link_latency","global_link_map"])
         self._declareParams("main",["hosts_per_router","routers_per_group","intergroup_links","intragroup_links",
                                     "num_groups","algorithm","adaptive_threshold","global_routes",
                                     "config_failed_links","failed_links"])
@@ -71,6 +71,10 @@ class topoDragonFly(Topology):
 
         if self.host_link_latency is None:
             self.host_link_latency = self.link_latency
+        # Global links are the only ones cut when partitioning by
+        # locality, so their latency sets the lookahead
+        if self.global_link_latency is None:
+            self.global_link_latency = self.link_latency
 
         num_peers = self.hosts_per_router * self.routers_per_group * self.num_groups
 
@@ -175,7 +179,7 @@ class topoDragonFly(Topology):
 
                 port = 0
                 for p in range(self.hosts_per_router):
-                    link = sst.Link("link_g%dr%dh%d"%(g, r, p), self.host_link_latency)
+                    link = self._keepLocal(sst.Link("link_g%dr%dh%d"%(g, r, p), self.host_link_latency))
 
                     Buildable._instanceBuildableBackCompat(endpoint, rtr, "port%d"%port, nic_num, {}, link)
                     #link.setNoCut()
@@ -188,13 +192,13 @@ class topoDragonFly(Topology):
                         src = min(p,r)
                         dst = max(p,r)
                         for s in range(self.intragroup_links):
-                            rtr.addLink(getLink("link_g%dr%dr%ds%d"%(g, src, dst, s)), "port%d"%port, self.link_latency)
+                            rtr.addLink(self._keepLocal(getLink("link_g%dr%dr%ds%d"%(g, src, dst, s))), "port%d"%port, self.link_latency)
                             port = port + 1
 
                 for p in range(igpr):
                     link = getGlobalLink(g,r,p)
                     if link is not None:
-                        rtr.addLink(link,"port%d"%port, self.link_latency)
+                        rtr.addLink(link,"port%d"%port, self.global_link_latency)
                     port = port +1
 
                 router_num = router_num + 1
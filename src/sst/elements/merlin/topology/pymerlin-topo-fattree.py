@@ -132,7 +132,7 @@ class topoFatTree(Topology):
                     (ep, port_name) = endpoint.build(node_id, {})
                     if ep:
                         hlink = sst.Link("hostlink_%d"%node_id)
-                        if self.bundleEndpoints:
+                        if self.bundleEndpoints or self.partition_by_locality:
                            hlink.setNoCut()
                         ep.addLink(hlink, port_name, self.host_link_latency)
                         host_links.append(hlink)
@@ -143,7 +143,7 @@ class topoFatTree(Topology):
                 
                 topology = rtr.setSubComponent(self.router.getTopologySlotName(),"merlin.fattree")
                 self._applyStatisticsSettings(topology)
-                topology.addParams(self._getGroupParams("main"))
+                self._addTopologyParams(topology)
                 # Add links
                 for l in range(len(host_links)):
                     rtr.addLink(host_links[l],"port%d"%l, self.link_latency)
@@ -156,7 +156,8 @@ class topoFatTree(Topology):
             rtr_links = [ [] for index in range(rtrs_in_group) ]
             for i in range(rtrs_in_group):
                 for j in range(self._downs[level]):
-                    rtr_links[i].append(sst.Link("link_l%d_g%d_r%d_p%d"%(level,group,i,j)));
+                    # Links below the top level stay inside a pod
+                    rtr_links[i].append(self._keepLocal(sst.Link("link_l%d_g%d_r%d_p%d"%(level,group,i,j))));
 
             # Now create group links to pass to lower level groups from router down links
             group_links = [ [] for index in range(self._downs[level]) ]
@@ -178,7 +179,7 @@ class topoFatTree(Topology):
 
                 topology = rtr.setSubComponent(self.router.getTopologySlotName(),"merlin.fattree")
                 self._applyStatisticsSettings(topology)
-                topology.addParams(self._getGroupParams("main"))
+                self._addTopologyParams(topology)
                 # Add links
                 for l in range(len(rtr_links[i])):
                     rtr.addLink(rtr_links[i][l],"port%d"%l, self.link_latency)
@@ -213,7 +214,7 @@ class topoFatTree(Topology):
 
                 topology = rtr.setSubComponent(self.router.getTopologySlotName(),"merlin.fattree",0)
                 self._applyStatisticsSettings(topology)
-                topology.addParams(self._getGroupParams("main"))
+                self._addTopologyParams(topology)
 
                 for l in range(len(rtr_links[i])):
                     rtr.addLink(rtr_links[i][l], "port%d"%l, self.link_latency)
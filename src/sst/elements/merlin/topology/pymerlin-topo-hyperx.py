@@ -128,7 +128,7 @@ class topoHyperX(Topology):
             radix += (self._dim_width[x] * (self._dim_size[x]-1))
         
         links = dict()
-        def getLink(name1, name2, num):
+        def getLink(name1, name2, num, local):
             # Sort name1 and name2 so order doesn't matter
             if str(name1) < str(name2):
                 name = "link_%s_%s_%d"%(name1, name2, num)
@@ -136,6 +136,8 @@ class topoHyperX(Topology):
                 name = "link_%s_%s_%d"%(name2, name1, num)
             if name not in links:
                 links[name] = sst.Link(name)
+                if local:
+                    self._keepLocal(links[name])
             #print("Getting link with name: %s"%name)
             return links[name]
 
@@ -151,12 +153,14 @@ class topoHyperX(Topology):
 
             topology = rtr.setSubComponent(self.router.getTopologySlotName(),"merlin.hyperx")
             self._applyStatisticsSettings(topology)
-            topology.addParams(self._getGroupParams("main"))
+            self._addTopologyParams(topology)
 
             port = 0
             # Connect to all routers that only differ in one location index
             for dim in range(num_dims):
                 theirdims = mydims[:]
+                # Locality groups are slabs along the last dimension
+                local = dim != num_dims - 1
 
                 # We have links to every other router in each dimension
                 for router in range(self._dim_size[dim]):
@@ -165,7 +169,7 @@ class topoHyperX(Topology):
                         theirlocstr = self._formatShape(theirdims)
                         # Hook up "width" number of links for this dimension
                         for num in range(self._dim_width[dim]):
-                            rtr.addLink(getLink(mylocstr, theirlocstr, num), "port%d"%port, self.link_latency)
+                            rtr.addLink(getLink(mylocstr, theirlocstr, num, local), "port%d"%port, self.link_latency)
                             #print("Wired up port %d"%port)
                             port = port + 1
 
@@ -175,7 +179,7 @@ class topoHyperX(Topology):
                 (ep, port_name) = endpoint.build(nodeID, {})
                 if ep:
                     nicLink = sst.Link("nic_%d_%d"%(i, n))
-                    if self.bundleEndpoints:
+                    if self.bundleEndpoints or self.partition_by_locality:
                        nicLink.setNoCut()
                     nicLink.connect( (ep, port_name, self.host_link_latency), (rtr, "port%d"%port, self.host_link_latency) )
                 port = port+1
@@ -129,10 +129,12 @@ class _topoMeshBase(Topology):
             
         
         links = dict()
-        def getLink(leftName, rightName, num):
+        def getLink(leftName, rightName, num, local):
             name = "link_%s_%s_%d"%(leftName, rightName, num)
             if name not in links:
                 links[name] = sst.Link(name)
+                if local:
+                    self._keepLocal(links[name])
             return links[name]
 
         
@@ -145,18 +147,20 @@ class _topoMeshBase(Topology):
             
             topology = rtr.setSubComponent(self.router.getTopologySlotName(),self._getTopologyName())
             self._applyStatisticsSettings(topology)
-            topology.addParams(self._getGroupParams("main"))
+            self._addTopologyParams(topology)
 
             port = 0
             for dim in range(num_dims):
                 theirdims = mydims[:]
+                # Locality groups are slabs along the last dimension
+                local = dim != num_dims - 1
 
                 # Positive direction
                 if mydims[dim]+1 < self._dim_size[dim] or self._includeWrapLinks():
                     theirdims[dim] = (mydims[dim] +1 ) % self._dim_size[dim]
                     theirlocstr = self._formatShape(theirdims)
                     for num in range(self._dim_width[dim]):
-                        rtr.addLink(getLink(mylocstr, theirlocstr, num), "port%d"%port, self.link_latency)
+                        rtr.addLink(getLink(mylocstr, theirlocstr, num, local), "port%d"%port, self.link_latency)
                         port = port+1
                 else:
                     port += self._dim_width[dim]
@@ -166,7 +170,7 @@ class _topoMeshBase(Topology):
                     theirdims[dim] = ((mydims[dim] -1) + self._dim_size[dim]) % self._dim_size[dim]
                     theirlocstr = self._formatShape(theirdims)
                     for num in range(self._dim_width[dim]):
-                        rtr.addLink(getLink(theirlocstr, mylocstr, num), "port%d"%port, self.link_latency)
+                        rtr.addLink(getLink(theirlocstr, mylocstr, num, local), "port%d"%port, self.link_latency)
                         port = port+1
                 else:
                     port += self._dim_width[dim]
@@ -176,7 +180,7 @@ class _topoMeshBase(Topology):
                 (ep, port_name) = endpoint.build(nodeID, {})
                 if ep:
                     nicLink = sst.Link("nic.%d:%d"%(i, n))
-                    if self.bundleEndpoints:
+                    if self.bundleEndpoints or self.partition_by_locality:
                        nicLink.setNoCut()
                     nicLink.connect( (ep, port_name, self.host_link_latency), (rtr, "port%d"%port, self.host_link_latency) )
                 port = port+1
@@ -235,13 +239,13 @@ class topoSingle(Topology):
 
         topo = rtr.setSubComponent(self.router.getTopologySlotName(),"merlin.singlerouter",0)
         self._applyStatisticsSettings(topo)
-        topo.addParams(self._getGroupParams("main"))
+        self._addTopologyParams(topo)
         
         for l in range(self.num_ports):
             (ep, portname) = endpoint.build(l, {})
             if ep:
                 link = sst.Link("link%d"%l)
-                if self.bundleEndpoints:
+                if self.bundleEndpoints or self.partition_by_locality:
                     link.setNoCut()
                 link.connect( (ep, portname, self.link_latency), (rtr, "port%d"%l, self.link_latency) )
 
@@ -451,7 +451,7 @@ class topoPolarFly(Topology):
 
             topology = rtr.setSubComponent(self.router.getTopologySlotName(),"merlin.polarfly")
             self._applyStatisticsSettings(topology)
-            topology.addParams(self._getGroupParams("main"))
+            topology.addGlobalParamSet("params_%s"%self._instance_name)
 
             port = 0
 
@@ -463,7 +463,7 @@ class topoPolarFly(Topology):
 
                 if ep:
                     nicLink = sst.Link("nic_%d_%d"%(router, localnodeID))
-                    if self.bundleEndpoints:
+                    if self.bundleEndpoints or self.partition_by_locality:
                        nicLink.setNoCut()
                     nicLink.connect( (ep, port_name, self.host_link_latency), (rtr, "port%d"%port, self.host_link_latency) )
                 port = port+1
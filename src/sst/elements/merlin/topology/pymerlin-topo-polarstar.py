@@ -644,7 +644,7 @@ class topoPolarStar(Topology):
 
             topology = rtr.setSubComponent(self.router.getTopologySlotName(),"merlin.polarstar")
             self._applyStatisticsSettings(topology)
-            topology.addParams(self._getGroupParams("main"))
+            topology.addGlobalParamSet("params_%s"%self._instance_name)
 
             port = 0
 
@@ -657,7 +657,7 @@ class topoPolarStar(Topology):
                 node_num = node_num+1
                 if ep:
                     nicLink = sst.Link("nic_%d_%d"%(router, localnodeID))
-                    if self.bundleEndpoints:
+                    if self.bundleEndpoints or self.partition_by_locality:
                        nicLink.setNoCut()
                     nicLink.connect( (ep, port_name, self.host_link_latency), (rtr, "port%d"%port, self.host_link_latency) )
                 port = port+1
@@ -0,0 +1,102 @@
+#!/usr/bin/env python
+#
+# Copyright 2009-2024 NTESS. Under the terms
+# of Contract DE-NA0003525 with NTESS, the U.S.
+# Government retains certain rights in this software.
+#
+# Copyright (c) 2009-2024, NTESS
+# All rights reserved.
+#
+# Portions are copyright of other developers:
+# See the file CONTRIBUTORS.TXT in the top level directory
+# of the distribution for more information.
+#
+# This file is part of the SST software package. For license
+# information, see the LICENSE file in the top level directory of the
+# distribution.
+
+import sst
+from sst.merlin.base import *
+
+
+# Topology built from a routing table file.  The same file is read by
+# merlin.table to route packets.  See merlin.table for the format.
+class topoTable(Topology):
+
+    def __init__(self):
+        Topology.__init__(self)
+        self._declareClassVariables(["link_latency","host_link_latency","bundleEndpoints","_num_routers","_endpoints","_links","_radix"])
+        self._declareParams("main",["routing_table","vcs_per_vn","vc_rule","adaptive"])
+        self._setCallbackOnWrite("routing_table",self._table_callback)
+        self._subscribeToPlatformParamSet("topology")
+
+    def _table_callback(self,variable_name,value):
+        self._lockVariable(variable_name)
+
+        self._num_routers = 0
+        self._endpoints = dict()
+        self._links = []
+        self._radix = dict()
+
+        def usePort(rtr, port):
+            self._radix[rtr] = max(self._radix.get(rtr, 0), port + 1)
+            self._num_routers = max(self._num_routers, rtr + 1)
+
+        # Only the connectivity is needed here, routes are read by
+        # the topology subcomponents
+        with open(value) as f:
+            for line in f:
+                fields = line.split('#')[0].split()
+                if not fields:
+                    continue
+                if fields[0] == "routers":
+                    self._num_routers = max(self._num_routers, int(fields[1]))
+                elif fields[0] == "endpoint":
+                    ep_id, rtr, port = [int(x) for x in fields[1:4]]
+                    self._endpoints[ep_id] = (rtr, port)
+                    usePort(rtr, port)
+                elif fields[0] == "link":
+                    rtr_a, port_a, rtr_b, port_b = [int(x) for x in fields[1:5]]
+                    self._links.append((rtr_a, port_a, rtr_b, port_b))
+                    usePort(rtr_a, port_a)
+                    usePort(rtr_b, port_b)
+
+    def getName(self):
+        return "Table"
+
+    def getNumNodes(self):
+        if self._endpoints is None:
+            print("topoTable: calling getNumNodes before routing_table was set.")
+            exit(1)
+        return len(self._endpoints)
+
+    def _build_impl(self, endpoint):
+        if self._endpoints is None:
+            print("topoTable: routing_table must be set before building.")
+            exit(1)
+
+        if self.host_link_latency is None:
+            self.host_link_latency = self.link_latency
+
+        routers = []
+        for i in range(self._num_routers):
+            rtr = self._instanceRouter(self._radix.get(i, 1),i)
+
+            topology = rtr.setSubComponent(self.router.getTopologySlotName(),"merlin.table")
+            self._applyStatisticsSettings(topology)
+            self._addTopologyParams(topology)
+            routers.append(rtr)
+
+        for (rtr_a, port_a, rtr_b, port_b) in self._links:
+            link = sst.Link("link_%d_%d_%d_%d"%(rtr_a, port_a, rtr_b, port_b))
+            routers[rtr_a].addLink(link, "port%d"%port_a, self.link_latency)
+            routers[rtr_b].addLink(link, "port%d"%port_b, self.link_latency)
+
+        for nodeID in sorted(self._endpoints):
+            (rtr, port) = self._endpoints[nodeID]
+            (ep, port_name) = endpoint.build(nodeID, {})
+            if ep:
+                nicLink = sst.Link("nic_%d_%d"%(rtr, port))
+                if self.bundleEndpoints or self.partition_by_locality:
+                   nicLink.setNoCut()
+                nicLink.connect( (ep, port_name, self.host_link_latency), (routers[rtr], "port%d"%port, self.host_link_latency) )
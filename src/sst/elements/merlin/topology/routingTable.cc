@@ -0,0 +1,274 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include <sst_config.h>
+#include "routingTable.h"
+
+#include <stdlib.h>
+
+#include <algorithm>
+#include <fstream>
+#include <map>
+#include <mutex>
+#include <sstream>
+
+using namespace SST::Merlin;
+
+
+void
+RoutingTable::init(int num_dest_routers)
+{
+    num_dests = num_dest_routers;
+    offsets.assign(num_dests + 1, 0);
+    candidates.clear();
+    pending.clear();
+}
+
+void
+RoutingTable::addCandidate(int dest_router, int port, int vc)
+{
+    Candidate c;
+    c.port = port;
+    c.vc = vc;
+    pending.push_back(std::make_pair(dest_router, c));
+}
+
+void
+RoutingTable::finalize()
+{
+    // Counting sort by destination keeps the order candidates were
+    // added in for each destination
+    offsets.assign(num_dests + 1, 0);
+    for ( auto& p : pending ) offsets[p.first + 1]++;
+    for ( int i = 0; i < num_dests; ++i ) offsets[i + 1] += offsets[i];
+
+    candidates.resize(pending.size());
+    std::vector<int> next(offsets.begin(), offsets.end() - 1);
+    for ( auto& p : pending ) candidates[next[p.first]++] = p.second;
+
+    std::vector<std::pair<int,Candidate> >().swap(pending);
+}
+
+int
+RoutingTable::selectMostCredits(const Candidate* cands, int count, const int* vcs, const int* credits, int num_vcs)
+{
+    int best = 0;
+    int best_credits = credits[cands[0].port * num_vcs + vcs[0]];
+    for ( int i = 1; i < count; ++i ) {
+        int c = credits[cands[i].port * num_vcs + vcs[i]];
+        if ( c > best_credits ) {
+            best = i;
+            best_credits = c;
+        }
+    }
+    return best;
+}
+
+void
+RoutingTable::write(std::ostream& out, int rtr_id) const
+{
+    for ( int dest = 0; dest < num_dests; ++dest ) {
+        if ( offsets[dest] == offsets[dest + 1] ) continue;
+        out << "route " << rtr_id << " " << dest;
+        for ( int i = offsets[dest]; i < offsets[dest + 1]; ++i ) {
+            out << " " << candidates[i].port;
+            if ( candidates[i].vc != -1 ) out << "/" << candidates[i].vc;
+        }
+        out << "\n";
+    }
+}
+
+
+const RoutingTableFile*
+RoutingTableFile::load(const std::string& filename, Output& output)
+{
+    // Every router in a rank uses the same file, so only parse it once
+    static std::mutex lock;
+    static std::map<std::string, RoutingTableFile*> loaded;
+
+    std::lock_guard<std::mutex> guard(lock);
+    auto it = loaded.find(filename);
+    if ( it != loaded.end() ) return it->second;
+
+    RoutingTableFile* file = new RoutingTableFile();
+    file->parse(filename, output);
+    file->buildBroadcastTree(filename, output);
+    loaded[filename] = file;
+    return file;
+}
+
+void
+RoutingTableFile::setPort(int rtr, int port, PortKind kind, int peer, int peer_port, const std::string& where, Output& output)
+{
+    if ( rtr < 0 || port < 0 ) {
+        output.fatal(CALL_INFO, -1, "%s: router and port must not be negative\n", where.c_str());
+    }
+    if ( rtr >= (int)ports.size() ) ports.resize(rtr + 1);
+    if ( port >= (int)ports[rtr].size() ) {
+        PortInfo unused = { NONE, -1, -1 };
+        ports[rtr].resize(port + 1, unused);
+    }
+    if ( ports[rtr][port].kind != NONE ) {
+        output.fatal(CALL_INFO, -1, "%s: port %d of router %d is connected more than once\n", where.c_str(), port, rtr);
+    }
+    ports[rtr][port].kind = kind;
+    ports[rtr][port].peer = peer;
+    ports[rtr][port].peer_port = peer_port;
+}
+
+void
+RoutingTableFile::parse(const std::string& filename, Output& output)
+{
+    std::ifstream in(filename);
+    if ( !in.is_open() ) {
+        output.fatal(CALL_INFO, -1, "Unable to open routing table file: %s\n", filename.c_str());
+    }
+
+    struct route_entry_t {
+        int rtr;
+        int dest;
+        int port;
+        int vc;
+    };
+    std::vector<route_entry_t> routes;
+
+    int declared_routers = -1;
+    int max_router = -1;
+    std::string line;
+    int line_num = 0;
+    while ( std::getline(in, line) ) {
+        line_num++;
+        size_t comment = line.find('#');
+        if ( comment != std::string::npos ) line.erase(comment);
+
+        std::istringstream tokens(line);
+        std::string keyword;
+        if ( !(tokens >> keyword) ) continue;
+
+        std::string where = filename + ":" + std::to_string(line_num);
+
+        if ( keyword == "routers" ) {
+            int n;
+            if ( !(tokens >> n) || n <= 0 ) {
+                output.fatal(CALL_INFO, -1, "%s: expected 'routers <num_routers>'\n", where.c_str());
+            }
+            // Files dumped per router can be concatenated, so allow
+            // repeats as long as they agree
+            if ( declared_routers != -1 && declared_routers != n ) {
+                output.fatal(CALL_INFO, -1, "%s: router count %d does not match earlier count of %d\n", where.c_str(), n, declared_routers);
+            }
+            declared_routers = n;
+        }
+        else if ( keyword == "endpoint" ) {
+            int id, rtr, port;
+            if ( !(tokens >> id >> rtr >> port) || id < 0 ) {
+                output.fatal(CALL_INFO, -1, "%s: expected 'endpoint <endpoint_id> <router> <port>'\n", where.c_str());
+            }
+            setPort(rtr, port, HOST, id, -1, where, output);
+            if ( id >= (int)endpoints.size() ) endpoints.resize(id + 1, std::make_pair(-1,-1));
+            if ( endpoints[id].first != -1 ) {
+                output.fatal(CALL_INFO, -1, "%s: endpoint %d is attached more than once\n", where.c_str(), id);
+            }
+            endpoints[id] = std::make_pair(rtr, port);
+            max_router = std::max(max_router, rtr);
+        }
+        else if ( keyword == "link" ) {
+            int rtr_a, port_a, rtr_b, port_b;
+            if ( !(tokens >> rtr_a >> port_a >> rtr_b >> port_b) ) {
+                output.fatal(CALL_INFO, -1, "%s: expected 'link <router_a> <port_a> <router_b> <port_b>'\n", where.c_str());
+            }
+            setPort(rtr_a, port_a, ROUTER, rtr_b, port_b, where, output);
+            setPort(rtr_b, port_b, ROUTER, rtr_a, port_a, where, output);
+            max_router = std::max(max_router, std::max(rtr_a, rtr_b));
+        }
+        else if ( keyword == "route" ) {
+            route_entry_t entry;
+            std::string cand;
+            if ( !(tokens >> entry.rtr >> entry.dest >> cand) || entry.rtr < 0 || entry.dest < 0 ) {
+                output.fatal(CALL_INFO, -1, "%s: expected 'route <router> <dest_router> <port>[/<vc>] ...'\n", where.c_str());
+            }
+            do {
+                char* end;
+                entry.port = strtol(cand.c_str(), &end, 10);
+                entry.vc = -1;
+                if ( *end == '/' ) entry.vc = strtol(end + 1, &end, 10);
+                if ( *end != '\0' || end == cand.c_str() || entry.port < 0 ) {
+                    output.fatal(CALL_INFO, -1, "%s: invalid route candidate '%s'\n", where.c_str(), cand.c_str());
+                }
+                routes.push_back(entry);
+            } while ( tokens >> cand );
+            max_router = std::max(max_router, std::max(entry.rtr, entry.dest));
+        }
+        else {
+            output.fatal(CALL_INFO, -1, "%s: unknown keyword '%s'\n", where.c_str(), keyword.c_str());
+        }
+    }
+
+    num_routers = declared_routers != -1 ? declared_routers : max_router + 1;
+    if ( max_router >= num_routers ) {
+        output.fatal(CALL_INFO, -1, "%s: router %d is out of range for %d routers\n", filename.c_str(), max_router, num_routers);
+    }
+    if ( num_routers <= 0 ) {
+        output.fatal(CALL_INFO, -1, "%s: no routers defined\n", filename.c_str());
+    }
+
+    for ( int i = 0; i < (int)endpoints.size(); ++i ) {
+        if ( endpoints[i].first == -1 ) {
+            output.fatal(CALL_INFO, -1, "%s: endpoint ids must be contiguous, endpoint %d is missing\n", filename.c_str(), i);
+        }
+    }
+
+    ports.resize(num_routers);
+    tables.resize(num_routers);
+    for ( auto& table : tables ) table.init(num_routers);
+    for ( auto& r : routes ) {
+        if ( r.port >= (int)ports[r.rtr].size() || ports[r.rtr][r.port].kind != ROUTER ) {
+            output.fatal(CALL_INFO, -1, "%s: route from router %d to router %d uses port %d, which is not a router link\n",
+                         filename.c_str(), r.rtr, r.dest, r.port);
+        }
+        tables[r.rtr].addCandidate(r.dest, r.port, r.vc);
+    }
+    for ( auto& table : tables ) table.finalize();
+}
+
+void
+RoutingTableFile::buildBroadcastTree(const std::string& filename, Output& output)
+{
+    // Untimed broadcasts are flooded over a spanning tree made from
+    // each router's first route candidate toward router 0
+    bcast_ports.resize(num_routers);
+    std::vector<int> parent(num_routers, -1);
+    for ( int rtr = 1; rtr < num_routers; ++rtr ) {
+        const RoutingTable::Candidate* cands;
+        if ( tables[rtr].getCandidates(0, cands) == 0 ) {
+            output.fatal(CALL_INFO, -1, "%s: router %d has no route to router 0, which is needed for broadcasts\n", filename.c_str(), rtr);
+        }
+        const PortInfo& info = ports[rtr][cands[0].port];
+        parent[rtr] = info.peer;
+        bcast_ports[rtr].push_back(cands[0].port);
+        bcast_ports[info.peer].push_back(info.peer_port);
+    }
+
+    // Make sure the routes toward router 0 don't loop
+    for ( int rtr = 1; rtr < num_routers; ++rtr ) {
+        int curr = rtr;
+        for ( int hops = 0; curr != 0; ++hops ) {
+            if ( hops >= num_routers ) {
+                output.fatal(CALL_INFO, -1, "%s: routes from router %d toward router 0 contain a loop\n", filename.c_str(), rtr);
+            }
+            curr = parent[curr];
+        }
+    }
+}
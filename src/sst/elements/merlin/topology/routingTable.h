@@ -0,0 +1,138 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef COMPONENTS_MERLIN_TOPOLOGY_ROUTINGTABLE_H
+#define COMPONENTS_MERLIN_TOPOLOGY_ROUTINGTABLE_H
+
+#include <sst/core/output.h>
+
+#include <ostream>
+#include <string>
+#include <utility>
+#include <vector>
+
+namespace SST {
+namespace Merlin {
+
+/*
+ * Next hop table for a single router.  For each destination router
+ * the candidate output ports (and optionally the VC to use on each)
+ * are stored contiguously, so a route becomes a lookup followed by
+ * whatever adaptive choice the topology makes among the candidates.
+ *
+ * Candidates are added in any order with addCandidate() and then
+ * compacted with finalize().  Candidates for a destination keep the
+ * order they were added in.
+ */
+class RoutingTable {
+public:
+    struct Candidate {
+        int port;
+        int vc;     // VC within the VN, or -1 to use the topology's VC rules
+    };
+
+    RoutingTable() : num_dests(0) {}
+
+    void init(int num_dest_routers);
+    void addCandidate(int dest_router, int port, int vc = -1);
+    void finalize();
+
+    inline int getNumDestinations() const { return num_dests; }
+
+    // Returns the number of candidates for dest_router and points
+    // cands at the first one
+    inline int getCandidates(int dest_router, const Candidate*& cands) const {
+        if ( dest_router < 0 || dest_router >= num_dests ) return 0;
+        cands = candidates.data() + offsets[dest_router];
+        return offsets[dest_router + 1] - offsets[dest_router];
+    }
+
+    // Index of the candidate with the most output credits on the VC
+    // it would use.  Ties go to the earlier candidate.  vcs[i] is the
+    // VC candidate i would use.
+    static int selectMostCredits(const Candidate* cands, int count, const int* vcs, const int* credits, int num_vcs);
+
+    // Writes a "route" line for every destination with candidates
+    void write(std::ostream& out, int rtr_id) const;
+
+private:
+    int num_dests;
+    std::vector<int> offsets;
+    std::vector<Candidate> candidates;
+
+    std::vector<std::pair<int,Candidate> > pending;
+};
+
+
+/*
+ * Routing tables for a whole network read from a text file, so routes
+ * generated by external tools (e.g. fabric manager dumps) can be
+ * simulated without writing topology code.  Each line is one of:
+ *
+ *   routers <num_routers>
+ *   endpoint <endpoint_id> <router> <port>
+ *   link <router_a> <port_a> <router_b> <port_b>
+ *   route <router> <dest_router> <port>[/<vc>] [<port>[/<vc>] ...]
+ *
+ * Blank lines and anything after a '#' are ignored.  Files are parsed
+ * once per process and shared by every router that uses them.
+ */
+class RoutingTableFile {
+public:
+    enum PortKind { NONE, HOST, ROUTER };
+
+    struct PortInfo {
+        PortKind kind;
+        int peer;       // Endpoint id for HOST ports, peer router for ROUTER ports
+        int peer_port;  // Port on the peer router for ROUTER ports
+    };
+
+    static const RoutingTableFile* load(const std::string& filename, Output& output);
+
+    inline int getNumRouters() const { return num_routers; }
+    inline int getNumEndpoints() const { return endpoints.size(); }
+
+    // Returns (router,port) for the endpoint, or (-1,-1) if unknown
+    inline std::pair<int,int> getEndpoint(int id) const {
+        if ( id < 0 || id >= (int)endpoints.size() ) return std::make_pair(-1,-1);
+        return endpoints[id];
+    }
+
+    inline const std::vector<PortInfo>& getPorts(int rtr) const { return ports[rtr]; }
+    inline const RoutingTable& getTable(int rtr) const { return tables[rtr]; }
+
+    // Ports of rtr that are edges of the spanning tree used for
+    // untimed broadcasts
+    inline const std::vector<int>& getBroadcastPorts(int rtr) const { return bcast_ports[rtr]; }
+
+private:
+    RoutingTableFile() : num_routers(0) {}
+
+    void parse(const std::string& filename, Output& output);
+    void buildBroadcastTree(const std::string& filename, Output& output);
+    void setPort(int rtr, int port, PortKind kind, int peer, int peer_port, const std::string& where, Output& output);
+
+    int num_routers;
+    std::vector<std::pair<int,int> > endpoints;
+    std::vector<std::vector<PortInfo> > ports;
+    std::vector<RoutingTable> tables;
+    std::vector<std::vector<int> > bcast_ports;
+};
+
+}
+}
+
+#endif // COMPONENTS_MERLIN_TOPOLOGY_ROUTINGTABLE_H
@@ -0,0 +1,208 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#include <sst_config.h>
+#include "table.h"
+
+#include <algorithm>
+
+using namespace SST::Merlin;
+
+
+topo_table::topo_table(ComponentId_t cid, Params& params, int num_ports, int rtr_id, int num_vns) :
+    Topology(cid),
+    router_id(rtr_id),
+    num_ports(num_ports),
+    num_vns(num_vns),
+    output_credits(NULL),
+    num_vcs(0)
+{
+    std::string filename = params.find<std::string>("routing_table", "");
+    if ( filename == "" ) {
+        output.fatal(CALL_INFO, -1, "topo_table requires the routing_table parameter\n");
+    }
+
+    vcs_per_vn = params.find<int>("vcs_per_vn", 1);
+    if ( vcs_per_vn < 1 ) {
+        output.fatal(CALL_INFO, -1, "vcs_per_vn must be at least 1\n");
+    }
+
+    std::string rule = params.find<std::string>("vc_rule", "table");
+    if ( rule == "table" ) vc_rule = VC_TABLE;
+    else if ( rule == "hop" ) vc_rule = VC_HOP;
+    else {
+        output.fatal(CALL_INFO, -1, "Unknown vc_rule specified: %s\n", rule.c_str());
+    }
+
+    adaptive = params.find<bool>("adaptive", false);
+
+    file = RoutingTableFile::load(filename, output);
+    if ( router_id >= file->getNumRouters() ) {
+        output.fatal(CALL_INFO, -1, "Router %d is not in routing table %s (%d routers)\n",
+                     router_id, filename.c_str(), file->getNumRouters());
+    }
+    table = &file->getTable(router_id);
+    ports = &file->getPorts(router_id);
+
+    if ( (int)ports->size() > num_ports ) {
+        output.fatal(CALL_INFO, -1, "Routing table %s uses %d ports on router %d, but the router only has %d\n",
+                     filename.c_str(), (int)ports->size(), router_id, num_ports);
+    }
+
+    // Check the VCs in the table against the VN configuration
+    int max_cands = 0;
+    for ( int dest = 0; dest < table->getNumDestinations(); ++dest ) {
+        const RoutingTable::Candidate* cands;
+        int count = table->getCandidates(dest, cands);
+        max_cands = std::max(max_cands, count);
+        for ( int i = 0; i < count; ++i ) {
+            if ( cands[i].vc >= vcs_per_vn ) {
+                output.fatal(CALL_INFO, -1, "Routing table %s uses VC %d from router %d to router %d, but vcs_per_vn is %d\n",
+                             filename.c_str(), cands[i].vc, router_id, dest, vcs_per_vn);
+            }
+        }
+    }
+    cand_vcs.resize(max_cands);
+}
+
+topo_table::~topo_table()
+{
+}
+
+int
+topo_table::getNextVC(int port, int vc, int vn, const RoutingTable::Candidate& cand)
+{
+    int start_vc = vn * vcs_per_vn;
+    if ( vc_rule == VC_HOP ) {
+        // Packets start on the first VC of the VN when injected
+        if ( isHostPort(port) ) return start_vc;
+        int next_vc = vc + 1;
+        if ( next_vc >= start_vc + vcs_per_vn ) {
+            output.fatal(CALL_INFO, -1, "Router %d: packet needs more than the %d VCs per VN allowed by vcs_per_vn\n",
+                         router_id, vcs_per_vn);
+        }
+        return next_vc;
+    }
+    if ( cand.vc == -1 ) return vc;
+    return start_vc + cand.vc;
+}
+
+void
+topo_table::route_packet(int port, int vc, internal_router_event* ev)
+{
+    std::pair<int,int> dest = file->getEndpoint(ev->getDest());
+    if ( dest.first == router_id ) {
+        ev->setNextPort(dest.second);
+        ev->setVC(vc);
+        return;
+    }
+
+    const RoutingTable::Candidate* cands;
+    int count = table->getCandidates(dest.first, cands);
+    if ( count == 0 ) {
+        output.fatal(CALL_INFO, -1, "Router %d has no route to router %d (endpoint %d)\n", router_id, dest.first, ev->getDest());
+    }
+
+    int vn = ev->getVN();
+    int choice = 0;
+    if ( adaptive && count > 1 ) {
+        for ( int i = 0; i < count; ++i ) cand_vcs[i] = getNextVC(port, vc, vn, cands[i]);
+        choice = RoutingTable::selectMostCredits(cands, count, cand_vcs.data(), output_credits, num_vcs);
+        ev->setVC(cand_vcs[choice]);
+    }
+    else {
+        ev->setVC(getNextVC(port, vc, vn, cands[0]));
+    }
+    ev->setNextPort(cands[choice].port);
+}
+
+
+internal_router_event*
+topo_table::process_input(RtrEvent* ev)
+{
+    internal_router_event* ire = new internal_router_event(ev);
+    if ( file->getEndpoint(ire->getDest()).first == -1 ) {
+        output.fatal(CALL_INFO, -1, "Router %d: destination %d is not an endpoint in the routing table\n", router_id, ire->getDest());
+    }
+    ire->setVC(ire->getVN() * vcs_per_vn);
+    return ire;
+}
+
+
+void topo_table::routeUntimedData(int port, internal_router_event* ev, std::vector<int> &outPorts)
+{
+    if ( ev->getDest() == UNTIMED_BROADCAST_ADDR ) {
+        // Send to all the local endpoints and flood the broadcast tree
+        for ( int i = 0; i < (int)ports->size(); ++i ) {
+            if ( i != port && (*ports)[i].kind == RoutingTableFile::HOST ) outPorts.push_back(i);
+        }
+        for ( int p : file->getBroadcastPorts(router_id) ) {
+            if ( p != port ) outPorts.push_back(p);
+        }
+    }
+    else {
+        std::pair<int,int> dest = file->getEndpoint(ev->getDest());
+        if ( dest.first == router_id ) {
+            outPorts.push_back(dest.second);
+            return;
+        }
+        const RoutingTable::Candidate* cands;
+        if ( table->getCandidates(dest.first, cands) == 0 ) {
+            output.fatal(CALL_INFO, -1, "Router %d has no route to router %d (endpoint %d)\n", router_id, dest.first, ev->getDest());
+        }
+        outPorts.push_back(cands[0].port);
+    }
+}
+
+
+internal_router_event* topo_table::process_UntimedData_input(RtrEvent* ev)
+{
+    return new internal_router_event(ev);
+}
+
+
+Topology::PortState
+topo_table::getPortState(int port) const
+{
+    if ( port >= (int)ports->size() ) return UNCONNECTED;
+    switch ( (*ports)[port].kind ) {
+    case RoutingTableFile::HOST:
+        return R2N;
+    case RoutingTableFile::ROUTER:
+        return R2R;
+    default:
+        return UNCONNECTED;
+    }
+}
+
+int
+topo_table::getEndpointID(int port)
+{
+    if ( !isHostPort(port) ) return -1;
+    return (*ports)[port].peer;
+}
+
+std::pair<int,int>
+topo_table::getDeliveryPortForEndpointID(int ep_id)
+{
+    return file->getEndpoint(ep_id);
+}
+
+void
+topo_table::setOutputBufferCreditArray(int const* array, int vcs)
+{
+    output_credits = array;
+    num_vcs = vcs;
+}
@@ -0,0 +1,110 @@
+// -*- mode: c++ -*-
+
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef COMPONENTS_MERLIN_TOPOLOGY_TABLE_H
+#define COMPONENTS_MERLIN_TOPOLOGY_TABLE_H
+
+#include <sst/core/event.h>
+#include <sst/core/link.h>
+#include <sst/core/params.h>
+
+#include "sst/elements/merlin/router.h"
+#include "sst/elements/merlin/topology/routingTable.h"
+
+namespace SST {
+namespace Merlin {
+
+/*
+ * Topology whose connectivity and routes all come from a routing
+ * table file (see RoutingTableFile for the format).  Useful for
+ * studying routes generated by external tools, or tables dumped by
+ * other merlin topologies.
+ */
+class topo_table: public Topology {
+
+public:
+
+    SST_ELI_REGISTER_SUBCOMPONENT(
+        topo_table,
+        "merlin",
+        "table",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Topology object that routes using next hop tables read from a file",
+        SST::Merlin::Topology
+    )
+
+    SST_ELI_DOCUMENT_PARAMS(
+        {"routing_table", "File containing the endpoints, links and next hop candidates for every router.  Lines are "
+                          "'routers <n>', 'endpoint <id> <router> <port>', 'link <router> <port> <router> <port>' and "
+                          "'route <router> <dest_router> <port>[/<vc>] ...'."},
+        {"vcs_per_vn",    "Number of VCs in each VN.", "1"},
+        {"vc_rule",       "How the VC is chosen on each hop: 'table' uses the VC given with the candidate (or keeps the "
+                          "current VC if none was given), 'hop' moves to the next VC on every router to router hop.", "table"},
+        {"adaptive",      "If true, choose the candidate with the most output credits, otherwise always use the first "
+                          "candidate.", "false"}
+    )
+
+    enum VCRule { VC_TABLE, VC_HOP };
+
+private:
+    int router_id;
+    int num_ports;
+    int num_vns;
+    int vcs_per_vn;
+    VCRule vc_rule;
+    bool adaptive;
+
+    const RoutingTableFile* file;
+    const RoutingTable* table;
+    const std::vector<RoutingTableFile::PortInfo>* ports;
+
+    int const* output_credits;
+    int num_vcs;
+
+    std::vector<int> cand_vcs;
+
+public:
+    topo_table(ComponentId_t cid, Params& params, int num_ports, int rtr_id, int num_vns);
+    ~topo_table();
+
+    virtual void route_packet(int port, int vc, internal_router_event* ev);
+    virtual internal_router_event* process_input(RtrEvent* ev);
+
+    virtual void routeUntimedData(int port, internal_router_event* ev, std::vector<int> &outPorts);
+    virtual internal_router_event* process_UntimedData_input(RtrEvent* ev);
+
+    virtual PortState getPortState(int port) const;
+    virtual int getEndpointID(int port);
+    virtual std::pair<int,int> getDeliveryPortForEndpointID(int ep_id);
+
+    virtual void setOutputBufferCreditArray(int const* array, int vcs);
+
+    virtual void getVCsPerVN(std::vector<int>& vcs_per_vn_out) {
+        for ( int i = 0; i < num_vns; ++i ) {
+            vcs_per_vn_out[i] = vcs_per_vn;
+        }
+    }
+
+private:
+    int getNextVC(int port, int vc, int vn, const RoutingTable::Candidate& cand);
+};
+
+}
+}
+
+#endif // COMPONENTS_MERLIN_TOPOLOGY_TABLE_H
@@ -89,6 +89,14 @@ NVM_DIMM::NVM_DIMM(ComponentId_t id, NVM_PARAMS par) : ComponentExtension(id)
     curr_reads = 0;
     curr_writes = 0;
 
+    outstanding = 0;
+
+    bank_hist.resize(params->num_banks, 0);
+
+    // The wheels only need to span the longest read activation and write
+    READS_COMPLETE.resize(params->tCMD + params->tRCD + 1, 0);
+    WRITES_COMPLETE.resize(params->tCMD + params->tCL_W + params->tBURST + 1, 0);
+
     gs = params->group_size;
     lg = group_locked;
 
@@ -134,17 +142,13 @@ bool NVM_DIMM::tick()
     cycles++;
 
 
-    if(READS_COMPLETE.find(cycles)!=READS_COMPLETE.end())
-    {
-        curr_reads = curr_reads - READS_COMPLETE[cycles];
-        READS_COMPLETE.erase(cycles);
-    }
+    int & reads_done = READS_COMPLETE[cycles % READS_COMPLETE.size()];
+    curr_reads = curr_reads - reads_done;
+    reads_done = 0;
 
-    if(WRITES_COMPLETE.find(cycles)!=WRITES_COMPLETE.end())
-    {
-        curr_writes = curr_writes - WRITES_COMPLETE[cycles];
-        WRITES_COMPLETE.erase(cycles);
-    }
+    int & writes_done = WRITES_COMPLETE[cycles % WRITES_COMPLETE.size()];
+    curr_writes = curr_writes - writes_done;
+    writes_done = 0;
 
 
 
@@ -248,7 +252,6 @@ void NVM_DIMM::schedule_delivery()
                 getRank(add)->setBusyUntil(cycles + params->tCMD + params->tCL + params->tBURST);
                 (getBank(add))->setBusyUntil(cycles + params->tCMD + params->tCL + params->tBURST);
                 (getBank(add))->set_last(true);
-                ready_trans[st_1->first] = cycles + params->tCMD + params->tCL + params->tBURST;
                 (st_1->first)->meta_data = EventType::READ_COMPLETION;
                                 m_EventChan->send(params->tCMD + params->tCL + params->tBURST, new MessierEvent(st_1->first, EventType::READ_COMPLETION));
                 ready_at_NVM.erase(st_1);
@@ -296,9 +299,9 @@ bool NVM_DIMM::try_flush_wb()
     {
 
 
-        std::list<NVM_Request *> writes_list = WB->getList();
+        const std::list<NVM_Request *> & writes_list = WB->getList();
 
-        std::list<NVM_Request *>::iterator st_wl, en_wl;
+        std::list<NVM_Request *>::const_iterator st_wl, en_wl;
 
         st_wl = writes_list.begin();
         en_wl = writes_list.end();
@@ -343,7 +346,7 @@ bool NVM_DIMM::try_flush_wb()
                 temp_bank->set_last(false); // setting it to write
                 temp_bank->set_last_address(temp->Address);
                 curr_writes++;
-                WRITES_COMPLETE[cycles + params->tCMD + params->tCL_W + params->tBURST]++;
+                scheduleCompletion(WRITES_COMPLETE, params->tCMD + params->tCL_W + params->tBURST);
 
                 delete temp;
 
@@ -370,14 +373,14 @@ bool NVM_DIMM::find_in_wb(NVM_Request * temp)
     if(WB->find_entry(temp->Address)!=NULL)
     {
         removed = true;
+        MemReqEvent * event = NVM_EVENT_MAP[temp->req_ID];
         MemRespEvent *respEvent = new MemRespEvent(
-                NVM_EVENT_MAP[temp->req_ID]->getReqId(), NVM_EVENT_MAP[temp->req_ID]->getAddr(), NVM_EVENT_MAP[temp->req_ID]->getFlags() );
+                event->getReqId(), event->getAddr(), event->getFlags() );
 
         if(SQUASHED.find(temp->req_ID)==SQUASHED.end())
         {
 
             m_memChan->send(respEvent); //(SST::Event *)NVM_EVENT_MAP[temp]);
-            TIME_STAMP.erase(temp);
 
 
         }
@@ -388,7 +391,7 @@ bool NVM_DIMM::find_in_wb(NVM_Request * temp)
         }
 
         bank_hist[WhichBank(temp->Address)]--;
-        delete NVM_EVENT_MAP[temp->req_ID];
+        delete event;
         NVM_EVENT_MAP.erase(temp->req_ID);
         delete temp;
     }
@@ -445,13 +448,13 @@ bool NVM_DIMM::pop_optimal()
 
         RANK * corresp_rank = getRank(temp->Address);
         BANK * corresp_bank = getBank(temp->Address);
-        if ((!params->adaptive_writes || group_locked!=(WhichBank(temp->Address)/params->group_size)) &&  (HOLD.find(temp->req_ID)==HOLD.end()) && temp->Read && (corresp_rank->getBusyUntil() < cycles) && (corresp_bank->getBusyUntil() < cycles) && !corresp_bank->getLocked() && (outstanding.size() < params->max_outstanding))
+        if ((!params->adaptive_writes || group_locked!=(WhichBank(temp->Address)/params->group_size)) &&  (HOLD.find(temp->req_ID)==HOLD.end()) && temp->Read && (corresp_rank->getBusyUntil() < cycles) && (corresp_bank->getBusyUntil() < cycles) && !corresp_bank->getLocked() && (outstanding < params->max_outstanding))
         {
 
             if ( row_buffer_hit(temp->Address, corresp_bank->getRB()))
             {
                 time_ready = cycles + 1;
-                outstanding.push_back(temp);
+                outstanding++;
                 transactions.erase(st);
                 // Lock the bank so no other request comes in and try to activate another row while waiting for the activation
 
@@ -566,7 +569,7 @@ bool NVM_DIMM::submit_request_opt()
                     BANK * corresp_bank = getBank(temp->Address);
 
                     // Check if the rank is not busy
-                    if ((!params->adaptive_writes || group_locked!=(WhichBank(temp->Address)/params->group_size)) && (HOLD.find(temp->req_ID)==HOLD.end()) &&   (corresp_rank->getBusyUntil() < cycles) && (((corresp_bank->getBusyUntil() < cycles) && !corresp_bank->getLocked()) || (params->write_cancel && !WB->flush() && !corresp_bank->read() &&(corresp_bank->getBusyUntil() - cycles < (100-4*WB->getSize())*1.0*params->tCL_W/100.0 ))) && (outstanding.size() < params->max_outstanding))
+                    if ((!params->adaptive_writes || group_locked!=(WhichBank(temp->Address)/params->group_size)) && (HOLD.find(temp->req_ID)==HOLD.end()) &&   (corresp_rank->getBusyUntil() < cycles) && (((corresp_bank->getBusyUntil() < cycles) && !corresp_bank->getLocked()) || (params->write_cancel && !WB->flush() && !corresp_bank->read() &&(corresp_bank->getBusyUntil() - cycles < (100-4*WB->getSize())*1.0*params->tCL_W/100.0 ))) && (outstanding < params->max_outstanding))
                     {
 
 
@@ -605,13 +608,13 @@ bool NVM_DIMM::submit_request_opt()
                             corresp_bank->set_last(true);
                             time_ready = cycles + params->tRCD + params->tCMD;
                             curr_reads++;
-                            READS_COMPLETE[cycles + params->tRCD + params->tCMD]++;
+                            scheduleCompletion(READS_COMPLETE, params->tRCD + params->tCMD);
                             corresp_bank->setRB(temp->Address/params->row_buffer_size);
                             issued = true;
                         }
                         if(issued)
                         {
-                            outstanding.push_back(temp);
+                            outstanding++;
                             transactions.erase(st);
                             removed=true;
                             // Lock the bank so no other request comes in and try to activate another row while waiting for the activation
@@ -676,16 +679,16 @@ void NVM_DIMM::handleEvent( SST::Event* e )
     {
         NVM_Request * req = tmp.getReq();
 
-        if(NVM_EVENT_MAP.find(req->req_ID)!= NVM_EVENT_MAP.end())
+        std::unordered_map<long long int, MemReqEvent *>::iterator event = NVM_EVENT_MAP.find(req->req_ID);
+        if(event != NVM_EVENT_MAP.end())
         {
             NVM_Request * temp = req;
 
-            histogram_idle->addData((cycles - TIME_STAMP[temp])/1000);
-            TIME_STAMP.erase(temp);
+            histogram_idle->addData((cycles - temp->issue_cycle)/1000);
             if(SQUASHED.find(temp->req_ID)==SQUASHED.end())
             {
                 MemRespEvent *respEvent = new MemRespEvent(
-                        NVM_EVENT_MAP[temp->req_ID]->getReqId(), NVM_EVENT_MAP[temp->req_ID]->getAddr(), NVM_EVENT_MAP[temp->req_ID]->getFlags() );
+                        event->second->getReqId(), event->second->getAddr(), event->second->getFlags() );
 
                 m_memChan->send((SST::Event *) respEvent);
 
@@ -741,15 +744,14 @@ void NVM_DIMM::handleEvent( SST::Event* e )
                         }
                     }
                     bank_hist[WhichBank(temp->Address)]--;
-                    delete NVM_EVENT_MAP[temp->req_ID];
-                    NVM_EVENT_MAP.erase(req->req_ID);
+                    delete event->second;
+                    NVM_EVENT_MAP.erase(event);
                     delete e;
 
                 }
 
             (getBank(req->Address))->setLocked(false, cycles);
-            ready_trans.erase(req);
-            outstanding.remove(req);
+            outstanding--;
             delete req;
 
         }
@@ -790,7 +792,7 @@ void NVM_DIMM::handleEvent( SST::Event* e )
                 if(params->cache_persistent)
                     HOLD.erase(temp->req_ID);
 
-                SQUASHED[temp->req_ID] = 1;
+                SQUASHED.insert(temp->req_ID);
 
 
             }
@@ -979,7 +981,7 @@ void NVM_DIMM::handleRequest(SST::Event* e)
         {
             // Hold servicing the request till we check the cache!
             if(params->cache_persistent)
-                HOLD[tmp2->req_ID] = 1;
+                HOLD.insert(tmp2->req_ID);
 
             tmp2->meta_data = EventType::HIT_MISS;
             m_EventChan->send(params->cache_latency, new MessierEvent(tmp2, EventType::HIT_MISS));
@@ -22,6 +22,9 @@
 
 #include <map>
 #include <list>
+#include <vector>
+#include <unordered_map>
+#include <unordered_set>
 
 #include "rank.h"
 #include "writeBuffer.h"
@@ -51,14 +54,14 @@ namespace MessierComponent{
         // This is the requests buffer, where all transactions are buffered before being processed by the controller
         std::list<NVM_Request *> transactions;
 
-        // This tracks the currently outstanding requests
-        std::list<NVM_Request *> outstanding;
+        // This tracks the number of currently outstanding requests
+        unsigned int outstanding;
 
-        // This is used to quickly track the number of writes complete at a specific cycle to remove them from the currently executed writes
-        std::map<long long int, int> WRITES_COMPLETE;
+        // Timing wheel of the writes completing at each upcoming cycle, indexed by cycle modulo its size, to remove them from the currently executed writes
+        std::vector<int> WRITES_COMPLETE;
 
-        // This is used to quickly track the number of reads complete at a specific cycle to remove them from the currently executed reads
-        std::map<long long int, int> READS_COMPLETE;
+        // Timing wheel of the reads completing at each upcoming cycle, to remove them from the currently executed reads
+        std::vector<int> READS_COMPLETE;
 
                 // Deterministic sort function for NVM_Request pointers
                 struct NVMReqPtrCompare {
@@ -67,10 +70,7 @@ namespace MessierComponent{
                     }
                 };
 
-        // This is the queue of the ready requests
-        std::map<NVM_Request *, long long int, NVMReqPtrCompare> ready_trans;
-
-        // This tracks if a request is expected to be ready at the PCM
+        // This tracks the requests ready at the PCM, in request order so delivery stays deterministic
         std::map<NVM_Request *, long long int, NVMReqPtrCompare> ready_at_NVM;
 
         // This determines the completed requests and when they are completed
@@ -98,20 +98,20 @@ namespace MessierComponent{
 
         SST::Link * m_EventChan;
 
-        std::map<long long int, MemReqEvent *> NVM_EVENT_MAP;
-
-        std::map<NVM_Request *, long long int, NVMReqPtrCompare> TIME_STAMP;
+        // This maps the live request IDs to the events that carried them in
+        std::unordered_map<long long int, MemReqEvent *> NVM_EVENT_MAP;
 
         // This keeps track of the squashed requests, as they hit in the cache
-        std::map<long long int, int> SQUASHED;
+        std::unordered_set<long long int> SQUASHED;
 
         // This structure prevents returning data before checking the cache, to avoid any inconsistency issues
-        std::map<long long int, int> HOLD;
+        std::unordered_set<long long int> HOLD;
 
         // This defines the internal cache of the NVM-based DIMM
         NVM_CACHE * cache;
 
-        std::map<int, int> bank_hist;
+        // The number of pending requests per bank
+        std::vector<int> bank_hist;
 
         int group_locked;
 
@@ -139,7 +139,7 @@ namespace MessierComponent{
 
         //bool push_request(NVM_Request * req) { if(transactions.size() >= params->max_requests) return false; else {transactions.push_back(req); return true; }}
 
-        bool push_request(NVM_Request * req) { transactions.push_back(req);  if(req->Read) TIME_STAMP[req]= cycles; return true;}
+        bool push_request(NVM_Request * req) { transactions.push_back(req);  if(req->Read) req->issue_cycle = cycles; return true;}
 
         // This is the optimized version that basiclly tries to find out if there is any possibility to achieve a row buffer hit from the current transactions
         bool submit_request_opt();
@@ -158,6 +158,9 @@ namespace MessierComponent{
 
         NVM_Request * pop_request();
 
+        // This records a completion 'delay' cycles from now on the given timing wheel
+        void scheduleCompletion(std::vector<int> & wheel, long long int delay) { wheel[(cycles + delay) % wheel.size()]++; }
+
         void setMemChannel(SST::Link * x) { m_memChan = x; }
         void setEventChannel(SST::Link * x) { m_EventChan = x; }
 
@@ -43,6 +43,12 @@ class NVM_Request
         int Size;
         uint64_t Address;
         int meta_data;
+
+        // The cycle a read entered the controller, for the idle histogram
+        long long int issue_cycle;
+
+        // Position in the write buffer list, so it can be erased without a search
+        std::list<NVM_Request *>::iterator wb_pos;
 };
 
 }
@@ -38,7 +38,7 @@ bool NVM_WRITE_BUFFER::insert_write_request(NVM_Request * req)
     {
 
         ADD_REQ[req->Address/entry_size]=req;
-        mem_reqs.push_back(req);
+        req->wb_pos = mem_reqs.insert(mem_reqs.end(), req);
         curr_entries++;
 
 
@@ -64,10 +64,11 @@ NVM_Request * NVM_WRITE_BUFFER::find_entry(long long int address)
 {
 
     // Fast path: note that this is the common case where there is no entry in WB, hence speeding up SST time
-    if(ADD_REQ.find(address/entry_size) == ADD_REQ.end())
+    std::unordered_map<long long int, NVM_Request *>::iterator it = ADD_REQ.find(address/entry_size);
+    if(it == ADD_REQ.end())
         return NULL;
     else
-        return ADD_REQ[address/entry_size];
+        return it->second;
 
 }
 
@@ -97,7 +98,7 @@ void NVM_WRITE_BUFFER::erase_entry(NVM_Request * TEMP)
 {
 
     ADD_REQ.erase(TEMP->Address/entry_size);
-    mem_reqs.remove(TEMP);
+    mem_reqs.erase(TEMP->wb_pos);
     curr_entries--;
 
         if(mem_reqs.size() != curr_entries)
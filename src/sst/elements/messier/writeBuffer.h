@@ -18,8 +18,8 @@
 #include <sst/core/timeConverter.h>
 #include <sst/elements/memHierarchy/memEvent.h>
 
-#include <map>
 #include <list>
+#include <unordered_map>
 
 #include "nvm_request.h"
 
@@ -51,7 +51,7 @@ class NVM_WRITE_BUFFER
 
 
     // This is used to speed up returning the memory requests in case of finding the request in the write buffer
-    std::map<long long int, NVM_Request *> ADD_REQ;
+    std::unordered_map<long long int, NVM_Request *> ADD_REQ;
 
     int entry_size; // this determines the granularity of the write requests, ideally this should be similar to cache line size
 
@@ -93,7 +93,7 @@ class NVM_WRITE_BUFFER
 
     void erase_entry(NVM_Request *);
 
-    std::list<NVM_Request *> getList() { return mem_reqs;}
+    const std::list<NVM_Request *> & getList() { return mem_reqs;}
 
 
 };
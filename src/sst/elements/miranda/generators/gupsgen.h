@@ -51,6 +51,9 @@ public:
 		{ "verbose",          "Sets the verbosity output of the generator", "0" },
    	 	{ "seed_a",           "Sets the seed-a for the random generator", "11" },
         { "seed_b",           "Sets the seed-b for the random generator", "31" },
+        { "rng",              "Random number generator, \"marsaglia\" (seeded by seed_a and seed_b) or \"philox\" (counter-based, keyed by rng_seed and rng_stream)", "marsaglia" },
+        { "rng_seed",         "Key for the philox generator, defaults to the subcomponent ID", "" },
+        { "rng_stream",       "Stream of the philox generator, to give several generators with the same key distinct sequences", "0" },
         { "count",            "Count for number of items being requested", "1024" },
         { "length",           "Length of requests", "8" },
         { "iterations",       "Number of iterations to perform", "1" },
@@ -17,6 +17,7 @@
 #include <sst_config.h>
 #include <sst/core/params.h>
 #include <sst/core/rng/marsaglia.h>
+#include <sst/elements/rng/philox.h>
 #include <sst/elements/miranda/generators/randomgen.h>
 
 using namespace SST::Miranda;
@@ -36,7 +37,17 @@ void RandomGenerator::build(Params& params) {
 	reqLength  = params.find<uint64_t>("length", 8);
 	maxAddr    = params.find<uint64_t>("max_address", 524288);
 
-	rng = new MarsagliaRNG(11, 31);
+	const std::string rngType = params.find<std::string>("rng", "marsaglia");
+	if ( rngType == "marsaglia" ) {
+		rng = new MarsagliaRNG(11, 31);
+	} else if ( rngType == "philox" ) {
+		// Keyed by subcomponent ID so each generator has its own stream
+		// regardless of how the simulation is partitioned
+		rng = new SST::ElementRNG::PhiloxRNG(params.find<uint64_t>("rng_seed", getId()),
+			params.find<uint64_t>("rng_stream", 0));
+	} else {
+		out->fatal(CALL_INFO, -1, "Unknown rng: %s, must be marsaglia or philox\n", rngType.c_str());
+	}
 
 	out->verbose(CALL_INFO, 1, 0, "Will issue %" PRIu64 " operations\n", issueCount);
 	out->verbose(CALL_INFO, 1, 0, "Request lengths: %" PRIu64 " bytes\n", reqLength);
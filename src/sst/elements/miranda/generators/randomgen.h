@@ -52,7 +52,10 @@ public:
         { "count",            "Count for number of items being requested", "1024" },
         { "length",           "Length of requests", "8" },
         { "max_address",	  "Maximum address allowed for generation", "16384" },
-        { "issue_op_fences",  "Issue operation fences, \"yes\" or \"no\", default is yes", "yes" }
+        { "issue_op_fences",  "Issue operation fences, \"yes\" or \"no\", default is yes", "yes" },
+        { "rng",              "Random number generator, \"marsaglia\" (fixed seeds) or \"philox\" (counter-based, keyed by rng_seed and rng_stream)", "marsaglia" },
+        { "rng_seed",         "Key for the philox generator, defaults to the subcomponent ID", "" },
+        { "rng_stream",       "Stream of the philox generator, to give several generators with the same key distinct sequences", "0" }
     )
 private:
 	uint64_t reqLength;
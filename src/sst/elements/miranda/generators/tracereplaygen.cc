@@ -0,0 +1,294 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#include <sst_config.h>
+#include <sst/core/params.h>
+#include <sst/core/unitAlgebra.h>
+#include <sst/elements/miranda/generators/tracereplaygen.h>
+
+#include <cstring>
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace SST::Miranda;
+
+static const char     TRACE_MAGIC[8]  = { 'M', 'I', 'R', 'T', 'R', 'A', 'C', 'E' };
+static const uint32_t TRACE_VERSION   = 1;
+static const size_t   TRACE_HEADER    = 16;
+
+TraceReplayGenerator::TraceReplayGenerator( ComponentId_t id, Params& params ) :
+	RequestGenerator(id, params) {
+            build(params);
+        }
+
+void TraceReplayGenerator::build(Params& params) {
+	const uint32_t verbose = params.find<uint32_t>("verbose", 0);
+
+	out = new Output("TraceReplayGenerator[@p:@l]: ", verbose, 0, Output::STDOUT);
+
+	mapBegin  = nullptr;
+	mapCursor = nullptr;
+	mapEnd    = nullptr;
+	mapBase   = nullptr;
+	mapLength = 0;
+
+#ifdef HAVE_LIBZ
+	traceFileZ = nullptr;
+	zCursor    = 0;
+	zEOF       = false;
+#endif
+
+	pending     = nullptr;
+	lastAddr    = 0;
+	issued      = 0;
+	nextIssuePs = 0;
+	started     = false;
+	traceDone   = false;
+
+	issueLimit = params.find<uint64_t>("count", 0);
+
+	std::string tracePath = params.find<std::string>("trace_file", "");
+	const int32_t shard = params.find<int32_t>("shard", -1);
+
+	if("" == tracePath) {
+		out->fatal(CALL_INFO, -1, "Error: trace_file must be set for the trace replay generator.\n");
+	}
+
+	const size_t shardPos = tracePath.find("%d");
+
+	if(shard >= 0 && std::string::npos != shardPos) {
+		tracePath.replace(shardPos, 2, std::to_string(shard));
+	}
+
+	UnitAlgebra traceClock(params.find<std::string>("clock", "1GHz"));
+	const double timeScale = params.find<double>("time_scale", 1.0);
+
+	if(!traceClock.hasUnits("Hz")) {
+		out->fatal(CALL_INFO, -1, "Error: clock must be given in Hz, e.g. \"2GHz\".\n");
+	}
+
+	if(timeScale < 0) {
+		out->fatal(CALL_INFO, -1, "Error: time_scale (%f) must not be negative.\n", timeScale);
+	}
+
+	// picoseconds per trace cycle, a zero clock means gaps are ignored
+	if(0 == traceClock.getRoundedValue()) {
+		gapPs = 0;
+	} else {
+		gapPs = (1.0e12 / traceClock.getDoubleValue()) * timeScale;
+	}
+
+	psTimeConv = getTimeConverter("1ps");
+
+	openTrace(tracePath);
+
+	out->verbose(CALL_INFO, 1, 0, "Replaying trace: %s\n", tracePath.c_str());
+	out->verbose(CALL_INFO, 1, 0, "Picoseconds per trace cycle: %f\n", gapPs);
+
+	if(issueLimit > 0) {
+		out->verbose(CALL_INFO, 1, 0, "Will issue at most %" PRIu64 " operations\n", issueLimit);
+	}
+}
+
+TraceReplayGenerator::~TraceReplayGenerator() {
+	closeTrace();
+	delete out;
+}
+
+void TraceReplayGenerator::openTrace(const std::string& path) {
+	char header[TRACE_HEADER];
+	uint32_t version = 0;
+
+	const bool compressed = path.size() > 3 && 0 == path.compare(path.size() - 3, 3, ".gz");
+
+	if(compressed) {
+#ifdef HAVE_LIBZ
+		traceFileZ = gzopen(path.c_str(), "rb");
+
+		if(nullptr == traceFileZ) {
+			out->fatal(CALL_INFO, -1, "Error: unable to open compressed trace %s\n", path.c_str());
+		}
+
+		if(gzread(traceFileZ, header, TRACE_HEADER) != (int) TRACE_HEADER) {
+			out->fatal(CALL_INFO, -1, "Error: trace %s is too short to hold a header\n", path.c_str());
+		}
+
+		zBuffer.resize(4096);
+		zBuffer.clear();
+#else
+		out->fatal(CALL_INFO, -1, "Error: trace %s is compressed but Miranda was built without zlib\n", path.c_str());
+#endif
+	} else {
+		const int fd = open(path.c_str(), O_RDONLY);
+
+		if(fd < 0) {
+			out->fatal(CALL_INFO, -1, "Error: unable to open trace %s\n", path.c_str());
+		}
+
+		struct stat traceStat;
+
+		if(0 != fstat(fd, &traceStat) || (size_t) traceStat.st_size < TRACE_HEADER) {
+			out->fatal(CALL_INFO, -1, "Error: trace %s is too short to hold a header\n", path.c_str());
+		}
+
+		mapLength = traceStat.st_size;
+
+		if(0 != ((mapLength - TRACE_HEADER) % sizeof(MirandaTraceRecord))) {
+			out->fatal(CALL_INFO, -1, "Error: trace %s ends part way through a record\n", path.c_str());
+		}
+
+		mapBase = mmap(nullptr, mapLength, PROT_READ, MAP_PRIVATE, fd, 0);
+		close(fd);
+
+		if(MAP_FAILED == mapBase) {
+			out->fatal(CALL_INFO, -1, "Error: unable to map trace %s\n", path.c_str());
+		}
+
+		// the trace is streamed front to back exactly once
+		posix_madvise(mapBase, mapLength, POSIX_MADV_SEQUENTIAL);
+
+		std::memcpy(header, mapBase, TRACE_HEADER);
+
+		mapBegin  = reinterpret_cast<const MirandaTraceRecord*>(static_cast<const char*>(mapBase) + TRACE_HEADER);
+		mapCursor = mapBegin;
+		mapEnd    = mapBegin + ((mapLength - TRACE_HEADER) / sizeof(MirandaTraceRecord));
+	}
+
+	std::memcpy(&version, header + sizeof(TRACE_MAGIC), sizeof(version));
+
+	if(0 != std::memcmp(header, TRACE_MAGIC, sizeof(TRACE_MAGIC))) {
+		out->fatal(CALL_INFO, -1, "Error: %s is not a Miranda trace\n", path.c_str());
+	}
+
+	if(TRACE_VERSION != version) {
+		out->fatal(CALL_INFO, -1, "Error: trace %s is version %" PRIu32 ", only version %" PRIu32 " is supported\n",
+			path.c_str(), version, TRACE_VERSION);
+	}
+}
+
+void TraceReplayGenerator::closeTrace() {
+	if(nullptr != mapBase) {
+		munmap(mapBase, mapLength);
+		mapBase = nullptr;
+	}
+
+#ifdef HAVE_LIBZ
+	if(nullptr != traceFileZ) {
+		gzclose(traceFileZ);
+		traceFileZ = nullptr;
+	}
+#endif
+}
+
+const MirandaTraceRecord* TraceReplayGenerator::nextRecord() {
+	if(nullptr != mapBase) {
+		return (mapCursor < mapEnd) ? mapCursor++ : nullptr;
+	}
+
+#ifdef HAVE_LIBZ
+	if(zCursor == zBuffer.size()) {
+		if(zEOF) {
+			return nullptr;
+		}
+
+		zBuffer.resize(zBuffer.capacity());
+
+		const int bytes = gzread(traceFileZ, zBuffer.data(), zBuffer.size() * sizeof(MirandaTraceRecord));
+
+		if(bytes < 0 || 0 != (bytes % sizeof(MirandaTraceRecord))) {
+			out->fatal(CALL_INFO, -1, "Error: compressed trace is corrupt or ends part way through a record\n");
+		}
+
+		zBuffer.resize(bytes / sizeof(MirandaTraceRecord));
+		zCursor = 0;
+		zEOF    = zBuffer.empty();
+
+		if(zEOF) {
+			return nullptr;
+		}
+	}
+
+	return &zBuffer[zCursor++];
+#else
+	return nullptr;
+#endif
+}
+
+void TraceReplayGenerator::generate(MirandaRequestQueue<GeneratorRequest*>* q) {
+	if(traceDone) {
+		return;
+	}
+
+	const uint64_t now = getCurrentSimTime(psTimeConv);
+
+	if(nullptr == pending) {
+		pending = nextRecord();
+
+		if(nullptr == pending) {
+			out->verbose(CALL_INFO, 1, 0, "Trace complete after %" PRIu64 " operations\n", issued);
+			traceDone = true;
+			return;
+		}
+
+		// gaps are measured from the previous record, the first from the
+		// time the replay starts
+		const uint64_t base = started ? nextIssuePs : now;
+		nextIssuePs = base + (uint64_t) (pending->gap * gapPs);
+		started = true;
+	}
+
+	// hold the record back until its gap has elapsed
+	if(now < nextIssuePs) {
+		return;
+	}
+
+	switch(pending->op) {
+	case 0:
+	case 1:
+		lastAddr += (uint64_t) pending->addrDelta;
+
+		out->verbose(CALL_INFO, 4, 0, "Replaying %s of %" PRIu16 " bytes at 0x%" PRIx64 "\n",
+			(0 == pending->op) ? "read" : "write", pending->size, lastAddr);
+
+		q->push_back(new MemoryOpRequest(lastAddr, pending->size, (0 == pending->op) ? READ : WRITE));
+		break;
+	case 2:
+		q->push_back(new FenceOpRequest());
+		break;
+	default:
+		out->fatal(CALL_INFO, -1, "Error: unknown trace operation %" PRIu8 " in record %" PRIu64 "\n",
+			pending->op, issued);
+	}
+
+	// the next gap counts from when this record was actually issued
+	nextIssuePs = now;
+	pending = nullptr;
+	issued++;
+
+	if(issueLimit > 0 && issued >= issueLimit) {
+		traceDone = true;
+	}
+}
+
+bool TraceReplayGenerator::isFinished() {
+	return traceDone;
+}
+
+void TraceReplayGenerator::completed() {
+
+}
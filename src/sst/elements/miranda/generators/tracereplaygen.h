@@ -0,0 +1,120 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_SST_MIRANDA_TRACE_REPLAY_GEN
+#define _H_SST_MIRANDA_TRACE_REPLAY_GEN
+
+#include <sst/elements/miranda/mirandaGenerator.h>
+#include <sst/core/output.h>
+#include <sst/core/timeConverter.h>
+
+#include <string>
+#include <vector>
+
+#ifdef HAVE_LIBZ
+#include <zlib.h>
+#endif
+
+namespace SST {
+namespace Miranda {
+
+/*
+ * Binary trace format, all fields little endian:
+ *
+ *   header : char magic[8] = "MIRTRACE", uint32_t version = 1, uint32_t reserved
+ *   record : uint8_t op, uint8_t reserved, uint16_t size, uint32_t gap,
+ *            int64_t addr_delta
+ *
+ * op is 0 for a read, 1 for a write and 2 for a fence (size and addr_delta are
+ * ignored). addr_delta is relative to the address of the previous memory
+ * record, starting from zero, and gap is the number of trace clock cycles
+ * between the previous record being issued and this one.
+ */
+struct MirandaTraceRecord {
+	uint8_t  op;
+	uint8_t  reserved;
+	uint16_t size;
+	uint32_t gap;
+	int64_t  addrDelta;
+};
+
+static_assert(sizeof(MirandaTraceRecord) == 16, "Miranda trace records must be 16 bytes");
+
+class TraceReplayGenerator : public RequestGenerator {
+
+public:
+	TraceReplayGenerator( ComponentId_t id, Params& params );
+	void build(Params& params);
+	~TraceReplayGenerator();
+	void generate(MirandaRequestQueue<GeneratorRequest*>* q);
+	bool isFinished();
+	void completed();
+
+	SST_ELI_REGISTER_SUBCOMPONENT(
+        TraceReplayGenerator,
+        "miranda",
+        "TraceReplayGenerator",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Replays a binary memory address trace, files ending in .gz are read through zlib when available",
+        SST::Miranda::RequestGenerator
+    )
+
+	SST_ELI_DOCUMENT_PARAMS(
+		{ "verbose",          "Sets the verbosity output of the generator", "0" },
+        { "trace_file",       "Path of the binary trace, a %d in the path is replaced by the shard number", "" },
+        { "shard",            "Shard (usually the CPU number) substituted into trace_file, -1 for none", "-1" },
+        { "clock",            "Clock the gap field of the trace is counted in, 0 ignores the gaps", "1GHz" },
+        { "time_scale",       "Multiplier applied to every gap", "1.0" },
+        { "count",            "Maximum number of records to replay, 0 replays the whole trace", "0" }
+    )
+
+private:
+	void openTrace(const std::string& path);
+	void closeTrace();
+	const MirandaTraceRecord* nextRecord();
+
+	// memory mapped trace
+	const MirandaTraceRecord* mapBegin;
+	const MirandaTraceRecord* mapCursor;
+	const MirandaTraceRecord* mapEnd;
+	void* mapBase;
+	size_t mapLength;
+
+#ifdef HAVE_LIBZ
+	// compressed trace, records are inflated a block at a time
+	gzFile traceFileZ;
+	std::vector<MirandaTraceRecord> zBuffer;
+	size_t zCursor;
+	bool zEOF;
+#endif
+
+	const MirandaTraceRecord* pending;
+	uint64_t lastAddr;
+	uint64_t issueLimit;
+	uint64_t issued;
+	double gapPs;
+	uint64_t nextIssuePs;
+	bool started;
+	bool traceDone;
+	TimeConverter* psTimeConv;
+	Output*  out;
+
+};
+
+}
+}
+
+#endif
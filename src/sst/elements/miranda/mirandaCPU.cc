@@ -154,6 +154,31 @@ RequestGenCPU::RequestGenCPU(SST::ComponentId_t id, SST::Params& params) :
 
 	reqMaxPerCycle = params.find<uint32_t>("max_reqs_cycle", 2);
 
+	streamCount      = params.find<uint32_t>("streams", 1);
+	maxStreamPending = params.find<uint32_t>("max_reqs_per_stream", 0);
+	nextStream       = 0;
+
+	if(0 == streamCount) {
+		out->fatal(CALL_INFO, -8, "Error: streams must be at least 1.\n");
+	}
+
+	std::string streamMode = params.find<std::string>("stream_mode", "INDEPENDENT");
+
+	if(streamMode == "POINTER_CHASE" || streamMode == "pointer_chase") {
+		// each request consumes the result of the one before it in its stream
+		maxStreamPending = 1;
+	} else if(streamMode != "INDEPENDENT" && streamMode != "independent") {
+		out->fatal(CALL_INFO, -8, "Error: unknown stream mode: \'%s\'\n", streamMode.c_str());
+	}
+
+	streamPending.resize(streamCount, 0);
+
+	statAchievedMLP = registerStatistic<uint64_t>( "achieved_mlp" );
+
+	for(uint32_t i = 0; i < streamCount; ++i) {
+		statStreamLatency.push_back( registerStatistic<uint64_t>( "stream_req_latency", std::to_string(i) ) );
+	}
+
 
 
 	out->verbose(CALL_INFO, 1, 0, "Miranda CPU Configuration:\n");
@@ -164,6 +189,9 @@ RequestGenCPU::RequestGenCPU(SST::ComponentId_t id, SST::Params& params) :
 	out->verbose(CALL_INFO, 1, 0, "- Max Load requests pending:      %" PRIu32 "\n", maxRequestsPending[READ]);
 	out->verbose(CALL_INFO, 1, 0, "- Max Store requests pending:     %" PRIu32 "\n", maxRequestsPending[WRITE]);
 	out->verbose(CALL_INFO, 1, 0, "- Max Custom requests pending:     %" PRIu32 "\n", maxRequestsPending[CUSTOM]);
+	out->verbose(CALL_INFO, 1, 0, "- Issue streams:                  %" PRIu32 "\n", streamCount);
+	out->verbose(CALL_INFO, 1, 0, "- Max requests pending per stream: %" PRIu32 "%s\n", maxStreamPending,
+		(0 == maxStreamPending) ? " (no limit)" : "");
 	out->verbose(CALL_INFO, 1, 0, "Configuration completed.\n");
 }
 
@@ -241,9 +269,16 @@ void RequestGenCPU::handleEvent( Interfaces::StandardMem::Request* ev) {
 			out->verbose(CALL_INFO, 4, 0, "-> Entry has all parts satisfied, removing ID=%" PRIu64 ", total processing time: %" PRIu64 "ns\n",
 				cpuReq->getOriginalReqID(), (getCurrentSimTimeNano() - cpuReq->getIssueTime()));
 
+			streamPending[cpuReq->getStream()]--;
+			statStreamLatency[cpuReq->getStream()]->addData((getCurrentSimTimeNano() - cpuReq->getIssueTime()));
+
 			// Notify every pending request that there may be a satisfied dependency
 			for(uint32_t i = 0; i < pendingRequests.size(); ++i) {
-				pendingRequests.at(i)->satisfyDependency(cpuReq->getOriginalReqID());
+				GeneratorRequest* pendingReq = pendingRequests.at(i);
+
+				if(!pendingReq->canIssue()) {
+					pendingReq->satisfyDependency(cpuReq->getOriginalReqID());
+				}
 			}
 
 			delete cpuReq;
@@ -279,7 +314,7 @@ void RequestGenCPU::issueCustomRequest(CustomOpRequest* req) {
     
     Interfaces::StandardMem::CustomReq* request = new Interfaces::StandardMem::CustomReq(req->getPayload());
         
-    CPURequest* newCPUReq = new CPURequest(req->getRequestID());
+    CPURequest* newCPUReq = new CPURequest(req->getRequestID(), req->getStream());
     newCPUReq->incPartCount();
     newCPUReq->setIssueTime(getCurrentSimTimeNano());
 
@@ -287,6 +322,7 @@ void RequestGenCPU::issueCustomRequest(CustomOpRequest* req) {
     cache_link->send(request);
         
     requestsPending[CUSTOM]++;
+    streamPending[req->getStream()]++;
 
     if (statReqs[CUSTOM] != nullptr)
         statReqs[CUSTOM]->addData(1);
@@ -337,7 +373,7 @@ void RequestGenCPU::issueRequest(MemoryOpRequest* req) {
             reqUpper = new Interfaces::StandardMem::Write(upperAddress, upperLength, data);
         }
 
-        CPURequest* newCPUReq = new CPURequest(req->getRequestID());
+        CPURequest* newCPUReq = new CPURequest(req->getRequestID(), req->getStream());
     	newCPUReq->incPartCount();
         newCPUReq->incPartCount();
     	newCPUReq->setIssueTime(getCurrentSimTimeNano());
@@ -351,6 +387,7 @@ void RequestGenCPU::issueRequest(MemoryOpRequest* req) {
         out->verbose(CALL_INFO, 4, 0, "Completed issue.\n");
 
         requestsPending[operation] += 2;
+        streamPending[req->getStream()]++;
 
     	// Keep track of split requests
         if (statSplitReqs[operation] != nullptr)
@@ -368,7 +405,7 @@ void RequestGenCPU::issueRequest(MemoryOpRequest* req) {
             request = new Interfaces::StandardMem::Write(addr, reqLength, data, false, 0, addr);
         }
 
-        CPURequest* newCPUReq = new CPURequest(req->getRequestID());
+        CPURequest* newCPUReq = new CPURequest(req->getRequestID(), req->getStream());
         newCPUReq->incPartCount();
         newCPUReq->setIssueTime(getCurrentSimTimeNano());
 
@@ -376,6 +413,7 @@ void RequestGenCPU::issueRequest(MemoryOpRequest* req) {
         cache_link->send(request);
 
         requestsPending[operation]++;
+        streamPending[req->getStream()]++;
 
         if (statReqs[operation] != nullptr)
             statReqs[operation]->addData(1);
@@ -390,6 +428,12 @@ bool RequestGenCPU::clockTick(SST::Cycle_t cycle) {
     }
     statCycles->addData(1);
 
+    const uint32_t outstanding = requestsPending[READ] + requestsPending[WRITE] + requestsPending[CUSTOM];
+
+    if(outstanding > 0) {
+        statAchievedMLP->addData(outstanding);
+    }
+
     if (reqGen->isFinished()) {
         if ( (pendingRequests.size() == 0) &&
                 (0 == requestsPending[READ]) &&
@@ -441,12 +485,19 @@ bool RequestGenCPU::clockTick(SST::Cycle_t cycle) {
 
     // We need to generate at least as many requests as can be looked up in the OoO window
     // otherwise the issue will have starvation.
-    for(int i = pendingRequests.size(); i < maxOpLookup; ++i) {
-        if( reqGen->isFinished()) {
-            break;
-    	} else {
-            reqGen->generate(&pendingRequests);
-    	}
+    const uint32_t firstGenerated = pendingRequests.size();
+    reqGen->generateBatch(&pendingRequests, maxOpLookup);
+
+    // Deal the new requests out to the issue streams
+    if(streamCount > 1) {
+        for(uint32_t i = firstGenerated; i < pendingRequests.size(); ++i) {
+            GeneratorRequest* newReq = pendingRequests.at(i);
+
+            if(newReq->getOperation() != REQ_FENCE) {
+                newReq->setStream(nextStream);
+                nextStream = (nextStream + 1) % streamCount;
+            }
+        }
     }
 
     for(uint32_t i = 0; i < pendingRequests.size(); ++i) {
@@ -485,6 +536,12 @@ bool RequestGenCPU::clockTick(SST::Cycle_t cycle) {
             break;
         } else if (nxtRq->getOperation() == CUSTOM) {
             if (requestsPending[CUSTOM] < maxRequestsPending[CUSTOM]) {
+                if(!streamCanIssue(nxtRq->getStream())) {
+                    out->verbose(CALL_INFO, 4, 0, "Request %" PRIu64 " stream %" PRIu32 " is at its outstanding limit, wait.\n",
+                            nxtRq->getRequestID(), nxtRq->getStream());
+                    continue;
+                }
+
                 out->verbose(CALL_INFO, 4, 0, "Will attempt to issue as free slots in the load/store unit.\n");
 
 		if(nxtRq->canIssue()) {
@@ -506,6 +563,12 @@ bool RequestGenCPU::clockTick(SST::Cycle_t cycle) {
             if( requestsPending[memOpReq->getOperation()] < maxRequestsPending[memOpReq->getOperation()] ) {
                 out->verbose(CALL_INFO, 4, 0, "Will attempt to issue as free slots in the load/store unit.\n");
 
+                if(!streamCanIssue(nxtRq->getStream())) {
+                    out->verbose(CALL_INFO, 4, 0, "Request %" PRIu64 " stream %" PRIu32 " is at its outstanding limit, wait.\n",
+                            nxtRq->getRequestID(), nxtRq->getStream());
+                    continue;
+                }
+
 
 		if(nxtRq->canIssue()) {
                     issued = true;
@@ -33,8 +33,8 @@ namespace Miranda {
 
 class CPURequest {
 public:
-    CPURequest(const uint64_t origID) :
-        originalID(origID), issueTime(0), outstandingParts(0) {}
+    CPURequest(const uint64_t origID, const uint32_t origStream = 0) :
+        originalID(origID), issueTime(0), outstandingParts(0), stream(origStream) {}
     void incPartCount() { outstandingParts++; }
     void decPartCount() { outstandingParts--; }
     bool completed() const { return 0 == outstandingParts; }
@@ -42,10 +42,12 @@ public:
     uint64_t getIssueTime() const { return issueTime; }
     uint64_t getOriginalReqID() const { return originalID; }
     uint32_t countParts() const { return outstandingParts; }
+    uint32_t getStream() const { return stream; }
 protected:
     uint64_t originalID;
     uint64_t issueTime;
     uint32_t outstandingParts;
+    uint32_t stream;
 };
 
 class RequestGenCPU : public SST::Component {
@@ -90,6 +92,9 @@ public:
         { "pagesize", "Sets the size of the page in the system, MUST be a multiple of cache_line_size", "4096" },
         { "pagemap", "Mapping scheme, string set to LINEAR or RANDOMIZED, default is LINEAR (virtual==physical), RANDOMIZED randomly shuffles virtual to physical map.", "LINEAR" },
         { "pagemapname", "Name of the shared memory region to keep page mapping in", "miranda"},
+        { "streams", "Number of independent issue streams, requests other than fences are dealt out to them in turn", "1" },
+        { "max_reqs_per_stream", "Maximum number of requests each stream may have outstanding, 0 for no per-stream limit", "0" },
+        { "stream_mode", "Set to INDEPENDENT or POINTER_CHASE, POINTER_CHASE makes every request in a stream wait for the one before it to complete", "INDEPENDENT" },
     	)
 
 	SST_ELI_DOCUMENT_STATISTICS(
@@ -109,7 +114,9 @@ public:
         { "cycles_hit_fence",   "Number of issue cycles which stop issue at a fence",           "cycles",   2 },
         { "cycles_max_reorder", "Number of issue cycles which hit maximum reorder lookup",	"cycles",   2 },
         { "cycles_max_issue",   "Cycles with maximum operation issue",                          "cycles",   2 },
-        { "cycles",             "Cycles executed",                                              "cycles",   1 }
+        { "cycles",             "Cycles executed",                                              "cycles",   1 },
+        { "achieved_mlp",       "Requests outstanding, sampled on every cycle with at least one outstanding; the mean is the memory-level parallelism achieved", "requests", 2 },
+        { "stream_req_latency", "Latency of each completed request, one statistic per stream (use a histogram for the distribution)", "ns", 2 }
     )
 
 	SST_ELI_DOCUMENT_PORTS(
@@ -135,6 +142,9 @@ private:
     void issueRequest(MemoryOpRequest* req);
     void issueCustomRequest(CustomOpRequest* req);
     void handleSrcEvent( SST::Event* );
+    bool streamCanIssue(const uint32_t stream) const {
+        return (0 == maxStreamPending) || (streamPending[stream] < maxStreamPending);
+    }
 
     Output* out;
 
@@ -156,6 +166,11 @@ private:
 	uint64_t cacheLine;
 	uint32_t maxOpLookup;
 
+    uint32_t streamCount;
+    uint32_t maxStreamPending;
+    uint32_t nextStream;
+    std::vector<uint32_t> streamPending;
+
     Statistic<uint64_t>* statReqs[OPCOUNT];
 	Statistic<uint64_t>* statSplitReqs[OPCOUNT];
 	Statistic<uint64_t>* statCyclesWithIssue;
@@ -167,6 +182,8 @@ private:
 	Statistic<uint64_t>* statCyclesHitFence;
 	Statistic<uint64_t>* statCyclesHitReorderLimit;
 	Statistic<uint64_t>* statCycles;
+	Statistic<uint64_t>* statAchievedMLP;
+	std::vector<Statistic<uint64_t>*> statStreamLatency;
 };
 
 }
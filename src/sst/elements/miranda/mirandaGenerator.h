@@ -22,7 +22,12 @@
 #include <sst/core/component.h>
 #include <sst/core/output.h>
 #include <sst/core/interfaces/stdMem.h>
+#include <sst/elements/pool/objectPool.h>
 
+#include <algorithm>
+#include <atomic>
+#include <cstdlib>
+#include <new>
 #include <queue>
 
 namespace SST {
@@ -39,7 +44,7 @@ typedef enum {
 
 class GeneratorRequest {
 public:
-	GeneratorRequest() {
+	GeneratorRequest() : stream(0) {
 		reqID = nextGeneratorRequestID++;
 	}
 
@@ -56,17 +61,23 @@ public:
 	}
 
 	void satisfyDependency(const uint64_t req) {
-		std::vector<uint64_t>::iterator searchDeps;
+		// requests only depend on earlier requests, so anything issued
+		// after us cannot be one of our dependencies
+		if(dependsOn.empty() || req > reqID) {
+			return;
+		}
 
-		for(searchDeps = dependsOn.begin(); searchDeps != dependsOn.end(); searchDeps++) {
-			if( req == (*searchDeps) ) {
-				dependsOn.erase(searchDeps);
+		for(uint32_t i = 0; i < dependsOn.size(); ++i) {
+			if( req == dependsOn[i] ) {
+				// order of the dependencies does not matter
+				dependsOn[i] = dependsOn.back();
+				dependsOn.pop_back();
 				break;
 			}
 		}
 	}
 
-	bool canIssue() {
+	bool canIssue() const {
 		return dependsOn.empty();
 	}
 
@@ -77,9 +88,19 @@ public:
 	void setIssueTime(const uint64_t now) {
 		issueTime = now;
 	}
+
+	// Issue stream the CPU has placed this request in
+	uint32_t getStream() const {
+		return stream;
+	}
+
+	void setStream(const uint32_t newStream) {
+		stream = newStream;
+	}
 protected:
 	uint64_t reqID;
 	uint64_t issueTime;
+	uint32_t stream;
 	std::vector<uint64_t> dependsOn;
 private:
 	static std::atomic<uint64_t> nextGeneratorRequestID;
@@ -128,41 +149,31 @@ public:
                	return theQ[index];
        	}
 
-       	void erase(const std::vector<uint32_t> eraseList) {
+	// eraseList must be in increasing index order, the survivors are
+	// compacted in place so the queue keeps its storage
+       	void erase(const std::vector<uint32_t>& eraseList) {
 		if(0 == eraseList.size()) {
 			return;
 		}
 
-               	QueueType* newQ = (QueueType*) malloc(sizeof(QueueType) * maxCapacity);
-
                	uint32_t nextSkipIndex = 0;
-               	uint32_t nextSkip = eraseList.at(nextSkipIndex);
-                uint32_t nextNewQIndex = 0;
+                uint32_t nextNewQIndex = eraseList.at(0);
 
-               	for(uint32_t i = 0; i < curSize; ++i) {
-                       	if(nextSkip == i) {
+               	for(uint32_t i = eraseList.at(0); i < curSize; ++i) {
+                       	if(nextSkipIndex < eraseList.size() && eraseList[nextSkipIndex] == i) {
                                 nextSkipIndex++;
-
-                                if(nextSkipIndex >= eraseList.size()) {
-                                       	nextSkip = curSize;
-                               	} else {
-                                       	nextSkip = eraseList.at(nextSkipIndex);
-                                }
                        	} else {
-                               	newQ[nextNewQIndex] = theQ[i];
+                               	theQ[nextNewQIndex] = theQ[i];
                                 nextNewQIndex++;
                        	}
                	}
 
-                free(theQ);
-
-               	theQ = newQ;
 		curSize = nextNewQIndex;
         }
 
 	void push_back(QueueType t) {
                 if(curSize == maxCapacity) {
-                        resize(maxCapacity + 16);
+                        resize(maxCapacity * 2);
                 }
 
                 theQ[curSize] = t;
@@ -182,6 +193,12 @@ public:
 		GeneratorRequest(),
 		addr(cAddr), length(cLength), op(cOpType) {}
 	~MemoryOpRequest() {}
+
+	// Generators create (and the CPU deletes) one of these for every memory
+	// operation, recycle them through the element object pool rather than
+	// going to the heap each time
+	SST_ELEMENT_POOL_OPERATORS(SST::Miranda::MemoryOpRequest)
+
 	ReqOperation getOperation() const { return op; }
 	bool isRead() const { return op == READ; }
 	bool isWrite() const { return op == WRITE; }
@@ -223,6 +240,21 @@ public:
 	RequestGenerator( ComponentId_t id, Params& params) : SubComponent(id) {}
 	~RequestGenerator() {}
 	virtual void generate(MirandaRequestQueue<GeneratorRequest*>* q) { }
+
+	// Fill q until it holds at least count requests or the generator is
+	// finished, generators which can produce a block of requests cheaply
+	// may override this rather than being called once per request
+	virtual void generateBatch(MirandaRequestQueue<GeneratorRequest*>* q, const uint32_t count) {
+		while(q->size() < count && !isFinished()) {
+			const uint32_t before = q->size();
+			generate(q);
+
+			// the generator may be holding requests back (e.g. for timing)
+			if(q->size() == before) {
+				break;
+			}
+		}
+	}
 	virtual bool isFinished() { return true; }
 	virtual void completed() { }
 
@@ -74,7 +74,6 @@ Pool::Pool(Params params, SST::OpalComponent::MemType mem_type, int id)
 //Create free frames of size framesize, note that the size is in KB
 void Pool::build_mem()
 {
-	int i=0;
 	num_frames = ceil(size/frsize);
 	real_size = num_frames * frsize;
 
@@ -86,9 +85,10 @@ void Pool::build_mem()
 	//unsigned seed = std::chrono::system_clock::now().time_since_epoch().count();
 	//std::shuffle(numbers.begin(), numbers.end(), std::default_random_engine(seed));
 
-	for(i=0; i< num_frames; i++) {
-		freelist.push_back(((uint64_t) i*frsize*1024) + start);
-	}
+	// All the frames start out never allocated
+	next_fresh = 0;
+	recycled.clear();
+	allocated.assign((num_frames + 63)/64, 0);
 
 	available_frames = num_frames;
 
@@ -96,52 +96,88 @@ void Pool::build_mem()
 
 }
 
-REQRESPONSE Pool::allocate_frames(int pages)
+bool Pool::frameOf(uint64_t address, uint64_t &frame)
 {
+	if(address < start || (address - start) % frameBytes() != 0)
+		return false;
 
-	REQRESPONSE response;
-	response.status =0;
+	frame = (address - start) / frameBytes();
 
-	if(available_frames < pages) {
-		return response;
+	return frame < (uint64_t) num_frames;
+}
+
+uint64_t Pool::popFrame()
+{
+	uint64_t frame;
+
+	if(next_fresh < (uint64_t) num_frames) {
+		frame = next_fresh++;
 	}
+	else {
+		// Skip the frames a contiguous allocation took out of the queue
+		while(testFrame(recycled.front()))
+			recycled.pop_front();
 
-	int frames = pages;
-	std::list<Frame*> frames_allocated;
+		frame = recycled.front();
+		recycled.pop_front();
+	}
 
-	// Fixme: Shuffle memory to make continuous memory available
-	while(frames) {
-		// Make sure pool has free frames in the requested memory pool type. If not deallocate allocated frames (if number of frames to be allocated are > 1)
-		if(freelist.empty()) {
-			while(!frames_allocated.empty()) {
-				Frame *frame = frames_allocated.front();
-				freelist.push_back(frame->starting_address);
-				alloclist.erase(frame->starting_address);
-				frames_allocated.pop_front();
-				available_frames++;
-				delete frame;
-			}
-			break;
+	setFrame(frame);
+	available_frames--;
+
+	return frame;
+}
+
+bool Pool::findContiguous(int N, uint64_t &first)
+{
+	// The never allocated frames are contiguous, use them if there are enough
+	if(next_fresh + N <= (uint64_t) num_frames) {
+		first = next_fresh;
+		next_fresh += N;
+		return true;
+	}
+
+	// Otherwise look for a run of N free frames among the ones allocated before, a whole word at a time where possible
+	uint64_t run = 0;
+	uint64_t frame = 0;
+	while(frame < next_fresh) {
+		if(frame % 64 == 0 && allocated[frame/64] == ~((uint64_t) 0)) {
+			run = 0;
+			frame += 64;
+			continue;
 		}
-		else
-		{
-			uint64_t frameAddr = freelist.front();
-			freelist.erase(freelist.begin());
-			Frame *frame = new Frame(frameAddr,0);
-			alloclist[frame->starting_address] = frame;
-			frames_allocated.push_back(frame);
-			available_frames--;
+
+		if(testFrame(frame))
+			run = 0;
+		else if(++run == (uint64_t) N) {
+			first = frame + 1 - N;
+			return true;
 		}
-		frames--;
 
+		frame++;
 	}
 
-	if(!frames_allocated.empty()) {
-		response.address = (frames_allocated.front())->starting_address;
-		response.pages = pages;
-		response.status = 1;
+	return false;
+}
+
+REQRESPONSE Pool::allocate_frames(int pages)
+{
+
+	REQRESPONSE response;
+	response.status =0;
+
+	if(pages <= 0 || available_frames < pages) {
+		return response;
 	}
 
+	// The frames need not be contiguous, the response holds the first one
+	response.address = (popFrame() * frameBytes()) + start;
+	for(int i = 1; i < pages; i++)
+		popFrame();
+
+	response.pages = pages;
+	response.status = 1;
+
 	return response;
 
 }
@@ -155,28 +191,32 @@ REQRESPONSE Pool::allocate_frame(int N)
 
 
 	// Make sure we have free frames first
-	if(freelist.empty())
-		return response;
-
-	// For now, we will assume you can only allocate 1 frame, TODO: We will implemenet a buddy-allocator style that enables allocating contigous physical spaces
-	if(N>1)
+	if(N <= 0 || available_frames < N)
 		return response;
 
-	else
+	if(N == 1)
 	{
 		// Simply, pop the first free frame and assign it
-		uint64_t frameAddr = freelist.front();
-		freelist.erase(freelist.begin());
-		Frame *temp = new Frame(frameAddr,0);
-		alloclist[temp->starting_address] = temp;
-		available_frames--;
-		response.address = temp->starting_address;
+		response.address = (popFrame() * frameBytes()) + start;
 		response.pages = 1;
 		response.status = 1;
 		return response;
 
 	}
 
+	uint64_t first;
+	if(!findContiguous(N, first))
+		return response;
+
+	for(uint64_t frame = first; frame < first + N; frame++)
+		setFrame(frame);
+
+	available_frames -= N;
+	response.address = (first * frameBytes()) + start;
+	response.pages = N;
+	response.status = 1;
+	return response;
+
 }
 
 /* Deallocate 'size' contigiuous memory of type 'memType' starting from physical address 'starting_pAddress',
@@ -188,20 +228,17 @@ REQRESPONSE Pool::deallocate_frames(int pages, uint64_t starting_pAddress)
 	REQRESPONSE response;
 	int frames = pages;
 	uint64_t pAddress = starting_pAddress;
-	uint64_t frame_number;
+	uint64_t frame;
 
 	while(frames) {
 
-		// If we can find the frame to be free in the allocated list
-		std::map<uint64_t, Frame*>::iterator it;
-		it = alloclist.find(pAddress);
-		if (it != alloclist.end())
+		// If we can find the frame to be free in the allocated frames
+		if (frameOf(pAddress, frame) && testFrame(frame))
 		{
-			//Remove from allocation map and add to free list
-			Frame *temp = it->second;
-			freelist.push_back(temp->starting_address);
-			alloclist.erase(pAddress);
-			delete temp;
+			//Remove from allocated frames and add to free list
+			clearFrame(frame);
+			recycled.push_back(frame);
+			available_frames++;
 		}
 		else
 		{
@@ -211,8 +248,7 @@ REQRESPONSE Pool::deallocate_frames(int pages, uint64_t starting_pAddress)
 			return response;
 		}
 
-		frame_number = (pAddress - start) / frsize * 1024;
-		pAddress += ((uint64_t) (frame_number+1)*frsize*1024) + start; //to get the next frame physical address
+		pAddress += frameBytes(); //to get the next frame physical address
 		frames--;
 	}
 
@@ -227,37 +263,32 @@ REQRESPONSE Pool::deallocate_frame(uint64_t X, int N)
 	REQRESPONSE response;
 	response.status = 0;
 
-
-	// For now, we will assume you can free only 1 frame, TODO: We will implemenet a buddy-allocator style that enables allocating and freeing contigous physical spaces
-	if(N>1)
+	uint64_t first;
+	if(N <= 0 || !frameOf(X, first) || first + N > (uint64_t) num_frames)
 		return response;
-	else
-	{
-		// If we can find the frame to be free in the allocated list
-		if(alloclist.find(X)!=alloclist.end())
-		{
-			// Remove from allocation map and add to free list
-			Frame * temp = alloclist[X];
-			freelist.push_back(temp->starting_address);
-			alloclist.erase(X);
-			delete temp;
-			available_frames++;
-			response.status = 1;
-		}
-		else // Means we couldn't find an allocated frame that is being unmapped
-			response.status = 0;
 
+	// All the frames must be allocated, otherwise nothing is freed
+	for(uint64_t frame = first; frame < first + N; frame++)
+		if(!testFrame(frame))
+			return response; // Means we couldn't find an allocated frame that is being unmapped
+
+	// Mark them free and queue them for reuse
+	for(uint64_t frame = first; frame < first + N; frame++) {
+		clearFrame(frame);
+		recycled.push_back(frame);
 	}
 
+	available_frames += N;
+	response.status = 1;
+
 	return response;
 }
 
 bool Pool::isAllocated(uint64_t address)
 {
-	if(alloclist.find(address)==alloclist.end())
-		return false;
+	uint64_t frame;
 
-	return true;
+	return frameOf(address, frame) && testFrame(frame);
 }
 
 /*REQRESPONSE Pool::allocate_frame_address(uint64_t address)
@@ -13,6 +13,8 @@
 #include "opal_event.h"
 
 #include <list>
+#include <deque>
+#include <vector>
 #include <map>
 #include <cmath>
 
@@ -57,19 +59,7 @@ class Pool{
 		//Constructor for pool
 		Pool(Params parmas, SST::OpalComponent::MemType mem_type, int id);
 
-		~Pool() {
-/*			while(!freelist.empty()) {
-				Frame* frame = freelist.front();
-				freelist.erase(freelist.begin());
-				delete frame;
-			}
-*/
-			std::map<uint64_t, Frame*>::iterator it;
-			for(it=alloclist.begin();it!=alloclist.end();it++) {
-				Frame* frame = it->second;
-				delete frame;
-			}
-		}
+		~Pool() {}
 
 		void finish() {}
 
@@ -96,7 +86,7 @@ class Pool{
 		bool isAllocated(uint64_t address);
 
 		// Current number of free frames
-		int freeframes() { return freelist.size(); }
+		int freeframes() { return available_frames; }
 
 		// Frame size in KBs
 		int frsize;
@@ -139,13 +129,31 @@ class Pool{
 		//Memory technology
 		SST::OpalComponent::MemTech memTech;
 
-		// The list of free frames
-		std::list<uint64_t> freelist;
+		/* The free frames are handed out in the order they became free: first the frames that were never
+		 * allocated, in address order, then the freed ones. The never allocated frames are a single range
+		 * starting at next_fresh, so a pool costs a bit per frame rather than a list node per frame */
+		uint64_t next_fresh;
 
-		//std::map<uint64_t, int> freelist_index;
+		// Frames freed since, oldest first. An entry whose frame was taken by a contiguous allocation is skipped
+		std::deque<uint64_t> recycled;
 
-		// The list of allocated frames --- the key is the starting physical address
-		std::map<uint64_t, Frame*> alloclist;
+		// One bit per frame, set while the frame is allocated
+		std::vector<uint64_t> allocated;
+
+		uint64_t frameBytes() { return (uint64_t) frsize*1024; }
+
+		bool testFrame(uint64_t frame) { return (allocated[frame/64] >> (frame%64)) & 1; }
+		void setFrame(uint64_t frame) { allocated[frame/64] |= ((uint64_t) 1) << (frame%64); }
+		void clearFrame(uint64_t frame) { allocated[frame/64] &= ~(((uint64_t) 1) << (frame%64)); }
+
+		// The frame starting at address, false if address is not the start of a frame of this pool
+		bool frameOf(uint64_t address, uint64_t &frame);
+
+		// Take the next free frame, there must be one
+		uint64_t popFrame();
+
+		// Find N contiguous free frames, returns false if there are none
+		bool findContiguous(int N, uint64_t &first);
 
 };
 
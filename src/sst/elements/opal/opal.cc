@@ -417,17 +417,13 @@ REQRESPONSE Opal::allocateFromReservedMemory(int node, uint64_t reserved_vAddres
 	return response;
 }
 
-bool Opal::processRequest(int node, int coreId, uint64_t vAddress, int fault_level, int size)
+REQRESPONSE Opal::allocatePage(int node, int coreId, uint64_t vAddress, int fault_level)
 {
 
 	REQRESPONSE response;
 	response.status = 0;
 
-	int pages = ceil(size/(nodeInfo[node]->page_size));
-
-	// If multiple pages are requested how are the physical addresses sent to the requester as in future sue to opal parallelization continuous addresses cannot be allocated
-	if(pages != 1)
-		output->fatal(CALL_INFO, -1, "Opal: currently opal does not support multiple page allocations\n");
+	int pages = 1;
 
 	// if the page fault request is for CR3 register allocate the memory from local memory
 	if(4 == fault_level)
@@ -453,15 +449,37 @@ bool Opal::processRequest(int node, int coreId, uint64_t vAddress, int fault_lev
 		}
 	}
 
-	if( response.status ) {
-		OpalEvent *tse = new OpalEvent(EventType::RESPONSE);
-		tse->setResp(vAddress, response.address, response.pages*nodeInfo[node]->page_size);
-		tse->setCoreId(coreId);
-		nodeInfo[node]->coreInfo[coreId].mmuLink->send(tse);
-	}
-	else
+	if( !response.status )
 		output->fatal(CALL_INFO, -1, "Opal(%s): Memory is drained out\n",getName().c_str());
 
+	return response;
+
+}
+
+bool Opal::processRequest(int node, int coreId, uint64_t vAddress, int fault_level, int size)
+{
+
+	int pages = ceil(size/(nodeInfo[node]->page_size));
+
+	if(pages < 1)
+		output->fatal(CALL_INFO, -1, "Opal: page fault request for %d bytes is smaller than a page\n", size);
+
+	// A request for several pages covers consecutive page numbers starting at vAddress. Frames are
+	// allocated page by page, as if each page had faulted on its own, since they need not be contiguous,
+	// and all of them go back in one response
+	std::vector<uint64_t> frames;
+	for(int i = 0; i < pages; i++) {
+		REQRESPONSE response = allocatePage(node, coreId, vAddress + i, fault_level);
+		frames.push_back(response.address);
+	}
+
+	OpalEvent *tse = new OpalEvent(EventType::RESPONSE);
+	tse->setResp(vAddress, frames.front(), pages*nodeInfo[node]->page_size);
+	tse->setCoreId(coreId);
+	if(pages > 1)
+		tse->setFrames(frames);
+	nodeInfo[node]->coreInfo[coreId].mmuLink->send(tse);
+
 	return true;
 
 }
@@ -266,6 +266,8 @@ namespace SST
 
 				REQRESPONSE isAddressReserved(int node, uint64_t vAddress);
 
+				REQRESPONSE allocatePage(int node, int coreId, uint64_t vAddress, int fault_level);
+
 				bool processRequest(int node, int coreId, uint64_t vAddress, int fault_level, int size);
 
 				void processHint(int node, int fileId, uint64_t vAddress, int size);
@@ -70,7 +70,7 @@ void OpalMemNIC::send(MemHierarchy::MemEventBase * ev) {
     SST::Interfaces::SimpleNetwork::Request * req = new SST::Interfaces::SimpleNetwork::Request();
     MemRtrEvent * mre = new MemRtrEvent(ev);
     req->src = info.addr;
-    req->dest = lookupNetworkAddress(ev->getDst());
+    req->dest = lookupNetworkAddress(ev);
     req->size_in_bits = 8 * (packetHeaderBytes + ev->getPayloadSize());
     req->vn = 0;
     req->givePayload(mre);
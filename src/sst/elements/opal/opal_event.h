@@ -20,6 +20,7 @@
 #include <map>
 #include <list>
 #include <string>
+#include <vector>
 
 using namespace SST;
 
@@ -57,6 +58,7 @@ namespace SST{ namespace OpalComponent{
 			int fileId;
 			int memContrlId;
 			bool invalidate;
+			std::vector<uint64_t> frames; // frames of a response to a fault request for several pages, one per page
 
 		public:
 
@@ -112,6 +114,9 @@ namespace SST{ namespace OpalComponent{
 			void setMemContrlId(int id) { memContrlId = id; }
 			int getMemContrlId() { return memContrlId; }
 
+			void setFrames(const std::vector<uint64_t>& pages) { frames = pages; }
+			const std::vector<uint64_t>& getFrames() { return frames; }
+
 			void serialize_order(SST::Core::Serialization::serializer &ser) override {
 				Event::serialize_order(ser);
 				ser & ev;
@@ -126,6 +131,7 @@ namespace SST{ namespace OpalComponent{
 				ser & fileId;
 				ser & memContrlId;
                 ser & invalidate;
+				ser & frames;
 			}
 
 
@@ -43,6 +43,14 @@ PageFaultHandler::PageFaultHandler(ComponentId_t id, Params& params) :
         numPorts++;
         linkname = linkprefix + std::to_string(numPorts);
     }
+
+    faultBatch = params.find<uint32_t>("fault_batch", 1);
+    if (faultBatch < 1)
+        output->fatal(CALL_INFO, -1, "%s, Error: fault_batch must be at least 1\n", getName().c_str());
+    batchedPages.resize(opalLink.size());
+
+    statFaultRequests = registerStatistic<uint64_t>("fault_requests");
+    statBatchedFaults = registerStatistic<uint64_t>("batched_faults");
 }
 
 
@@ -67,15 +75,42 @@ void PageFaultHandler::handleEvent(SST::Event *event) {
     pkt.vAddress = ev->getAddress();
     pkt.pAddress = ev->getPaddress();
     pkt.size = 4096;
+
+    // Keep the rest of a batch for when those pages fault
+    const std::vector<uint64_t>& frames = ev->getFrames();
+    for (size_t i = 1; i < frames.size(); i++) {
+        batchedPages[ev->getCoreId()][ev->getAddress() + i] = frames[i];
+    }
+
     (*(pageFaultHandlerInterface[ev->getCoreId()]))(pkt);
 
     delete ev;
 }
 
 void PageFaultHandler::allocatePage(const uint32_t thread, const uint32_t level, const uint64_t virtualAddress, const uint64_t size) {
+    // Only pages are batched, a level 0 fault names a page number so the
+    // next ones in the batch are the numbers that follow it
+    uint64_t pages = 1;
+    if (0 == level && faultBatch > 1) {
+        std::unordered_map<uint64_t, uint64_t>::iterator batched = batchedPages[thread].find(virtualAddress);
+        if (batched != batchedPages[thread].end()) {
+            PageFaultHandlerPacket pkt;
+            pkt.action = PageFaultHandlerAction::RESPONSE;
+            pkt.vAddress = virtualAddress;
+            pkt.pAddress = batched->second;
+            pkt.size = 4096;
+            batchedPages[thread].erase(batched);
+            statBatchedFaults->addData(1);
+            (*(pageFaultHandlerInterface[thread]))(pkt);
+            return;
+        }
+        pages = faultBatch;
+    }
+
     OpalEvent * tse = new OpalEvent(OpalComponent::EventType::REQUEST);
-    tse->setResp(virtualAddress, 0, size);
+    tse->setResp(virtualAddress, 0, size * pages);
     tse->setFaultLevel(level);
+    statFaultRequests->addData(1);
     opalLink[thread]->send(tse);
 
 }
@@ -46,7 +46,13 @@ class PageFaultHandler : public SambaComponent::PageFaultHandler {
         )
 
         SST_ELI_DOCUMENT_PARAMS(
-                { "opal_latency",   "latency to communicate to the Opal manager", "32ps"}
+                { "opal_latency",   "latency to communicate to the Opal manager", "32ps"},
+                { "fault_batch",    "Number of consecutive pages to request from the Opal manager in one event when a page (not a page table) faults. Pages beyond the faulting one are kept and handed out when they fault, without another request", "1"}
+        )
+
+        SST_ELI_DOCUMENT_STATISTICS(
+            { "fault_requests",  "Page fault requests sent to the Opal manager", "requests", 1},
+            { "batched_faults",  "Page faults served from pages already received in an earlier batch", "faults", 1}
         )
 
         SST_ELI_DOCUMENT_PORTS(
@@ -63,6 +69,12 @@ class PageFaultHandler : public SambaComponent::PageFaultHandler {
     private:
 
         std::vector<SST::Link*> opalLink;
+
+        uint32_t faultBatch;
+        std::vector<std::unordered_map<uint64_t, uint64_t> > batchedPages; // per thread, page number to frame of pages received but not yet faulted
+
+        Statistic<uint64_t>* statFaultRequests;
+        Statistic<uint64_t>* statBatchedFaults;
 };
 
 }
@@ -57,6 +57,25 @@ Rtlmodel::Rtlmodel(SST::ComponentId_t id, SST::Params& params) :
    clock_handler = new Clock::Handler<Rtlmodel>(this, &Rtlmodel::clockTick); 
    timeConverter = registerClock(RTLClk, clock_handler);
    unregisterClock(timeConverter, clock_handler);
+
+   // Nothing talks to memory while the model runs, so several RTL cycles can be evaluated per
+   // callback on a clock that is slower by the same factor. The memory interface keeps the RTL clock.
+   cyclesPerTick = params.find<uint32_t>("cyclesPerTick", 1);
+   if (0 == cyclesPerTick) {
+       output.fatal(CALL_INFO, -1, "Error: cyclesPerTick must be at least 1.\n");
+   }
+   if (1 == cyclesPerTick) {
+       runTimeConverter = timeConverter;
+       run_clock_handler = clock_handler;
+   } else {
+       UnitAlgebra runClk(RTLClk);
+       runClk /= cyclesPerTick;
+       run_clock_handler = new Clock::Handler<Rtlmodel>(this, &Rtlmodel::clockTick);
+       runTimeConverter = registerClock(runClk, run_clock_handler, false);
+       unregisterClock(runTimeConverter, run_clock_handler);
+       output.verbose(CALL_INFO, 1, 0, "Evaluating %" PRIu32 " RTL cycles per tick at %s\n", cyclesPerTick, runClk.toStringBestSI().c_str());
+   }
+
    writePayloads = params.find<int>("writepayloadtrace") == 0 ? false : true;
 
     //Configure and register Event Handler for ArielRtllink
@@ -194,8 +213,12 @@ bool Rtlmodel::clockTick( SST::Cycle_t currentCycle ) {
     //output.verbose(CALL_INFO, 1, 0, "\nSim Done is: %d", ev.sim_done);
 
     if(!isStalled) {
-        dut->eval(ev.update_registers, ev.verbose, ev.done_reset);
-        tickCount++;
+        for(uint32_t i = 0; i < cyclesPerTick; i++) {
+            dut->eval(ev.update_registers, ev.verbose, ev.done_reset);
+            tickCount++;
+            if(tickCount >= sim_cycle)
+                break;
+        }
     }
 	if( tickCount >= sim_cycle) {
         if(ev.sim_done) {
@@ -223,7 +246,7 @@ void Rtlmodel::handleArielEvent(SST::Event *event) {
     * As of now, shared memory is like a scratch-pad or heap which is passive without any intelligent performance improving stuff like TLB, Cache hierarchy, accessing mechanisms(VIPT/PIPT) etc.  
     */
 
-    unregisterClock(timeConverter, clock_handler);
+    unregisterClock(runTimeConverter, run_clock_handler);
     ArielComponent::ArielRtlEvent* ariel_ev = dynamic_cast<ArielComponent::ArielRtlEvent*>(event);
     RtlAckEv->setEventRecvAck(true);
     ArielRtlLink->send(RtlAckEv);
@@ -249,11 +272,11 @@ void Rtlmodel::handleArielEvent(SST::Event *event) {
     if(!mem_allocated) {
         size_t size = ariel_ev->get_updated_rtl_params_size() + ariel_ev->get_rtl_inp_size() + ariel_ev->get_rtl_ctrl_size();
         uint8_t* data = (uint8_t*)malloc(size);
-        VA_VA_map.insert({(uint64_t)ariel_ev->get_updated_rtl_params(), (uint64_t)data});
+        VA_VA_map.insert({(uint64_t)ariel_ev->get_updated_rtl_params(), {(uint64_t)data, ariel_ev->get_updated_rtl_params_size()}});
         uint64_t index = ariel_ev->get_updated_rtl_params_size()/sizeof(uint8_t);
-        VA_VA_map.insert({(uint64_t)ariel_ev->get_rtl_inp_ptr(), (uint64_t)(data+index)});
+        VA_VA_map.insert({(uint64_t)ariel_ev->get_rtl_inp_ptr(), {(uint64_t)(data+index), ariel_ev->get_rtl_inp_size()}});
         index += ariel_ev->get_rtl_inp_size()/sizeof(uint8_t);
-        VA_VA_map.insert({(uint64_t)ariel_ev->get_rtl_ctrl_ptr(), (uint64_t)(data+index)});
+        VA_VA_map.insert({(uint64_t)ariel_ev->get_rtl_ctrl_ptr(), {(uint64_t)(data+index), ariel_ev->get_rtl_ctrl_size()}});
         setBaseDataAddress(data);
         setDataAddress(getBaseDataAddress());
         mem_allocated = true;
@@ -299,9 +322,9 @@ void Rtlmodel::handleMemEvent(StandardMem::Request* event) {
         output.verbose(CALL_INFO, 4, 0, "Correctly identified event in pending transactions, removing from list, before there are: %" PRIu32 " transactions pending.\n", (uint32_t) pendingTransactions->size());
        
         int i;
-        auto DataAddress = VA_VA_map.find(read->vAddr);
-        if(DataAddress != VA_VA_map.end())
-            setDataAddress((uint8_t*)DataAddress->second);
+        uint8_t* DataAddress = translateVA(read->vAddr);
+        if(DataAddress != nullptr)
+            setDataAddress(DataAddress);
         else
             output.fatal(CALL_INFO, -1, "Error: DataAddress corresponding to VA: %" PRIu64, read->vAddr);
 
@@ -321,7 +344,7 @@ void Rtlmodel::handleMemEvent(StandardMem::Request* event) {
         if(isStalled && pending_transaction_count == 0) {
             ev.UpdateRtlSignals((void*)getBaseDataAddress(), dut, sim_cycle);
             tickCount = 0;
-            reregisterClock(timeConverter, clock_handler);
+            reregisterClock(runTimeConverter, run_clock_handler);
             setDataAddress(getBaseDataAddress());
             isStalled = false;
         }
@@ -333,6 +356,22 @@ void Rtlmodel::handleMemEvent(StandardMem::Request* event) {
     delete event;
 }
 
+// Host copy of an address anywhere inside one of the Ariel buffers, so the
+// second half of a split read lands at the right offset. nullptr if the
+// address is not in a buffer.
+uint8_t* Rtlmodel::translateVA(uint64_t virtAddr) {
+    auto region = VA_VA_map.upper_bound(virtAddr);
+    if(region == VA_VA_map.begin())
+        return nullptr;
+
+    --region;
+    const uint64_t offset = virtAddr - region->first;
+    if(offset >= region->second.second)
+        return nullptr;
+
+    return (uint8_t*)(region->second.first + offset);
+}
+
 void Rtlmodel::commitReadEvent(const uint64_t address,
             const uint64_t virtAddress, const uint32_t length) {
     if(length > 0) {
@@ -19,6 +19,7 @@
 #include <sst/core/component.h>
 #include <sst/core/interfaces/stdMem.h>
 #include <sst/core/timeConverter.h>
+#include <map>
 #include <queue>
 
 //Header file will be changed to the RTL C-model under test
@@ -73,6 +74,7 @@ public:
 	SST_ELI_DOCUMENT_PARAMS(
 		{ "ExecFreq", "Clock frequency of RTL design in GHz", "1GHz" },
 		{ "maxCycles", "Number of Clock ticks the simulation must atleast execute before halting", "1000" },
+		{ "cyclesPerTick", "Number of RTL cycles to evaluate in each clock callback while the model runs without memory traffic. The run clock is slowed by the same factor so simulated time is kept, rounded up to a whole tick at the end of a run", "1" },
         {"memoryinterface", "Interface to memory", "memHierarchy.standardInterface"}
 	)
 
@@ -115,6 +117,9 @@ private:
     
     TimeConverter* timeConverter;
     Clock::HandlerBase* clock_handler;
+    TimeConverter* runTimeConverter;    // clock the model runs on, timeConverter slowed by cyclesPerTick
+    Clock::HandlerBase* run_clock_handler;
+    uint32_t cyclesPerTick;
     bool writePayloads;
     bool update_registers, verbose, done_reset, sim_done;
     bool update_inp, update_ctrl, update_eval_args;
@@ -140,7 +145,9 @@ private:
     uint64_t fifo_deq_$old = 0, fifo_deq_$next = 0;
 
     std::unordered_map<Interfaces::StandardMem::Request::id_t, Interfaces::StandardMem::Request*>* pendingTransactions;
-    std::unordered_map<uint64_t, uint64_t> VA_VA_map;
+    // Ariel buffers by starting VA, each maps to its copy in data, {host address, size}
+    std::map<uint64_t, std::pair<uint64_t, uint64_t> > VA_VA_map;
+    uint8_t* translateVA(uint64_t virtAddr);
     uint32_t pending_transaction_count;
 
     bool isStalled;
@@ -0,0 +1,19 @@
+dnl -*- Autoconf -*-
+dnl vim:ft=config
+dnl
+
+AC_DEFUN([SST_pool_CONFIG], [
+	pool_happy="yes"
+
+  AC_ARG_ENABLE([element-pools],
+	AS_HELP_STRING([--disable-element-pools], [Allocate pooled element objects (events, trace entries, requests) from the heap instead of per-thread freelists, e.g. for memory debuggers]))
+  AS_IF([test "x$enable_element_pools" = "xno"],
+	[AC_DEFINE([SST_ELEMENT_POOL_DISABLE], [1], [Allocate pooled element objects from the heap])])
+
+  AC_ARG_ENABLE([element-pool-stats],
+	AS_HELP_STRING([--enable-element-pool-stats], [Count allocations, refills and spills in the element object pools]))
+  AS_IF([test "x$enable_element_pool_stats" = "xyes"],
+	[AC_DEFINE([SST_ELEMENT_POOL_STATS], [1], [Count allocations, refills and spills in the element object pools])])
+
+  AS_IF([test "$pool_happy" = "yes"], [$1], [$2])
+])
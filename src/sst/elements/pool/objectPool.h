@@ -0,0 +1,224 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_SST_ELEMENTS_POOL_OBJECT_POOL
+#define _H_SST_ELEMENTS_POOL_OBJECT_POOL
+
+#include <stdint.h>
+#include <cstddef>
+#include <mutex>
+#include <new>
+
+namespace SST {
+namespace ElementPool {
+
+/*
+ * Pooled allocator for short-lived element objects (events, trace entries,
+ * generator requests).
+ *
+ * Each pool is named by a tag type, normally the base class of the objects
+ * it holds, and keeps its own free lists in 16B size classes up to maxSize
+ * so a base class and its subclasses can share one pool. Larger objects use
+ * the global heap.
+ *
+ * Free blocks are cached per thread. A block may be freed on a different
+ * thread (or by a different element library) than the one that allocated
+ * it, since every block is just heap memory of its size class; it joins the
+ * freeing thread's cache. When a cache grows past cacheLimit it hands a
+ * batch of blocks to a depot shared by all threads, which empty caches
+ * refill from before carving a new slab, so a producer/consumer pair of
+ * threads recycles the same memory instead of growing without bound.
+ * Slabs are never returned to the system.
+ *
+ * Classes opt in with SST_ELEMENT_POOL_OPERATORS(Tag); other objects can
+ * call allocate/deallocate directly. Configuring with --disable-element-pools
+ * defines SST_ELEMENT_POOL_DISABLE and turns every pool back into plain
+ * new/delete, e.g. for running under a memory checker.
+ * --enable-element-pool-stats defines SST_ELEMENT_POOL_STATS and counts
+ * pool activity, see getStats().
+ */
+struct PoolStats {
+    uint64_t allocations;   // requests made of the pool
+    uint64_t heapAllocations; // too large to pool
+    uint64_t slabRefills;   // caches refilled by carving a new slab
+    uint64_t depotRefills;  // caches refilled from the shared depot
+    uint64_t depotSpills;   // batches handed over to the depot
+};
+
+template<class Tag>
+class ObjectPool {
+public:
+    static void* allocate(std::size_t size) {
+        countStat(&PoolStats::allocations);
+        if (!enabled || size > maxSize) {
+            countStat(&PoolStats::heapAllocations);
+            return ::operator new(size);
+        }
+        Cache& cache = caches[sizeClass(size)];
+        if (cache.head == nullptr)
+            refill(sizeClass(size));
+        FreeBlock* block = cache.head;
+        cache.head = block->next;
+        cache.count--;
+        return block;
+    }
+
+    static void deallocate(void* ptr, std::size_t size) {
+        if (ptr == nullptr) return;
+        if (!enabled || size > maxSize) {
+            ::operator delete(ptr);
+            return;
+        }
+        Cache& cache = caches[sizeClass(size)];
+        FreeBlock* block = static_cast<FreeBlock*>(ptr);
+        block->next = cache.head;
+        cache.head = block;
+        if (++cache.count > cacheLimit)
+            spill(sizeClass(size));
+    }
+
+    /* Counters for the calling thread, all zero unless built with SST_ELEMENT_POOL_STATS */
+    static PoolStats getStats() {
+#ifdef SST_ELEMENT_POOL_STATS
+        return stats;
+#else
+        return PoolStats();
+#endif
+    }
+
+#ifdef SST_ELEMENT_POOL_DISABLE
+    static const bool enabled = false;
+#else
+    static const bool enabled = true;
+#endif
+    static const std::size_t granularity = 16;
+    static const std::size_t maxSize = 512;
+    static const uint32_t batchSize = 128;
+    static const uint32_t cacheLimit = 2 * batchSize;
+
+private:
+    struct FreeBlock {
+        FreeBlock* next;
+        FreeBlock* nextBatch;   // links batches in the depot
+    };
+
+    struct Cache {
+        FreeBlock* head;
+        uint32_t count;
+    };
+
+    struct Depot {
+        std::mutex lock;
+        FreeBlock* batches[maxSize / granularity];
+    };
+
+    static const std::size_t numClasses = maxSize / granularity;
+    static const std::size_t slabSize = 64 * 1024;
+
+    static std::size_t sizeClass(std::size_t size) {
+        return size == 0 ? 0 : (size - 1) / granularity;
+    }
+
+    // Intentionally never destroyed so objects deleted during teardown can still be released
+    static Depot& depot() {
+        static Depot* d = new Depot();
+        return *d;
+    }
+
+    static void refill(std::size_t cls) {
+        Cache& cache = caches[cls];
+        {
+            Depot& d = depot();
+            std::lock_guard<std::mutex> guard(d.lock);
+            if (d.batches[cls] != nullptr) {
+                cache.head = d.batches[cls];
+                cache.count = batchSize;
+                d.batches[cls] = cache.head->nextBatch;
+                countStat(&PoolStats::depotRefills);
+                return;
+            }
+        }
+
+        countStat(&PoolStats::slabRefills);
+        std::size_t blockSize = (cls + 1) * granularity;
+        char* slab = static_cast<char*>(::operator new(slabSize));
+        for (std::size_t offset = 0; offset + blockSize <= slabSize; offset += blockSize) {
+            FreeBlock* block = reinterpret_cast<FreeBlock*>(slab + offset);
+            block->next = cache.head;
+            cache.head = block;
+            cache.count++;
+        }
+    }
+
+    // Move the most recently freed batchSize blocks to the depot
+    static void spill(std::size_t cls) {
+        Cache& cache = caches[cls];
+        FreeBlock* first = cache.head;
+        FreeBlock* last = first;
+        for (uint32_t i = 1; i < batchSize; i++)
+            last = last->next;
+        cache.head = last->next;
+        cache.count -= batchSize;
+        last->next = nullptr;
+
+        Depot& d = depot();
+        std::lock_guard<std::mutex> guard(d.lock);
+        first->nextBatch = d.batches[cls];
+        d.batches[cls] = first;
+        countStat(&PoolStats::depotSpills);
+    }
+
+    static void countStat(uint64_t PoolStats::* counter) {
+#ifdef SST_ELEMENT_POOL_STATS
+        stats.*counter += 1;
+#else
+        (void)counter;
+#endif
+    }
+
+    // Plain data so the caches stay usable during thread and program teardown
+    static thread_local Cache caches[numClasses];
+#ifdef SST_ELEMENT_POOL_STATS
+    static thread_local PoolStats stats;
+#endif
+};
+
+template<class Tag>
+thread_local typename ObjectPool<Tag>::Cache ObjectPool<Tag>::caches[ObjectPool<Tag>::numClasses] = {};
+
+#ifdef SST_ELEMENT_POOL_STATS
+template<class Tag>
+thread_local PoolStats ObjectPool<Tag>::stats = {};
+#endif
+
+} //namespace ElementPool
+} //namespace SST
+
+/*
+ * Class-specific operator new/delete drawing on ObjectPool<Tag>. Because
+ * deserialization constructs events with 'new' these also cover events
+ * received from other ranks. The sized delete gets the size of the most
+ * derived object as long as the class has a virtual destructor or is never
+ * deleted through a base pointer.
+ */
+#ifndef SST_ELEMENT_POOL_DISABLE
+#define SST_ELEMENT_POOL_OPERATORS(Tag) \
+    static void* operator new(std::size_t size) { return SST::ElementPool::ObjectPool<Tag>::allocate(size); } \
+    static void operator delete(void* ptr, std::size_t size) { SST::ElementPool::ObjectPool<Tag>::deallocate(ptr, size); }
+#else
+#define SST_ELEMENT_POOL_OPERATORS(Tag)
+#endif
+
+#endif
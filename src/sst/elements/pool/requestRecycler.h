@@ -0,0 +1,96 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_SST_ELEMENTS_POOL_REQUEST_RECYCLER
+#define _H_SST_ELEMENTS_POOL_REQUEST_RECYCLER
+
+#include <cstddef>
+#include <vector>
+
+#include <sst/core/interfaces/simpleNetwork.h>
+
+namespace SST {
+namespace ElementPool {
+
+/*
+ * Free list of SimpleNetwork::Request objects for a network endpoint.
+ *
+ * SimpleNetwork hands requests between endpoints and link controls by
+ * pointer and the receiver owns what recv() returns, so an endpoint that
+ * both sends and receives can hand the requests it has emptied back to
+ * itself for its next send instead of deleting one and allocating another
+ * per packet. Requests stay ordinary heap objects; anything that still
+ * deletes them is unaffected.
+ *
+ * Not thread safe, keep one per endpoint.
+ */
+class RequestRecycler {
+public:
+    typedef SST::Interfaces::SimpleNetwork::Request Request;
+    typedef SST::Interfaces::SimpleNetwork::nid_t nid_t;
+
+    RequestRecycler(size_t limit = 64) : limit(limit) { }
+
+    ~RequestRecycler() {
+        for (size_t i = 0; i < freeList.size(); i++) delete freeList[i];
+    }
+
+    /* A request in the state of a default constructed one */
+    Request* get() {
+        if (freeList.empty()) return new Request();
+        Request* req = freeList.back();
+        freeList.pop_back();
+        return req;
+    }
+
+    Request* get(nid_t dest, nid_t src, size_t size_in_bits, bool head, bool tail, Event* payload = nullptr) {
+        Request* req = get();
+        req->dest = dest;
+        req->src = src;
+        req->size_in_bits = size_in_bits;
+        req->head = head;
+        req->tail = tail;
+        req->givePayload(payload);
+        return req;
+    }
+
+    /* Take back a received request once its payload has been taken */
+    void recycle(Request* req) {
+        if (req == nullptr) return;
+        if (req->inspectPayload() != nullptr || freeList.size() >= limit) {
+            delete req;
+            return;
+        }
+        req->dest = 0;
+        req->src = 0;
+        req->vn = 0;
+        req->size_in_bits = 0;
+        req->head = false;
+        req->tail = false;
+        req->allow_adaptive = true;
+        req->setTraceType(Request::NONE);
+        req->setTraceID(0);
+        freeList.push_back(req);
+    }
+
+private:
+    size_t limit;
+    std::vector<Request*> freeList;
+};
+
+} //namespace ElementPool
+} //namespace SST
+
+#endif
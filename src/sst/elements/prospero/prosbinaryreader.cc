@@ -32,25 +32,20 @@ ProsperoBinaryTraceReader::ProsperoBinaryTraceReader( ComponentId_t id, Params&
 	}
 
 	recordLength = sizeof(uint64_t) + sizeof(char) + sizeof(uint64_t) + sizeof(uint32_t);
-	buffer = (char*) malloc(sizeof(char) * recordLength);
+
+	FILE* input = traceInput;
+	blockReader = new ProsperoBlockReader(
+		[input](char* target, size_t len) { return fread(target, 1, len, input); },
+		params.find<size_t>("buffer_size", 4194304), params.find<bool>("async_read", true));
 }
 
 ProsperoBinaryTraceReader::~ProsperoBinaryTraceReader() {
+	// stop the helper thread before closing the file it reads
+	delete blockReader;
+
 	if(NULL != traceInput) {
 		fclose(traceInput);
 	}
-
-	if(NULL != buffer) {
-		free(buffer);
-	}
-}
-
-void ProsperoBinaryTraceReader::copy(char* target, const char* source,
-	const size_t bufferOffset, const size_t len) {
-
-	for(size_t i = 0; i < len; ++i) {
-		target[i] = source[bufferOffset + i];
-	}
 }
 
 ProsperoTraceEntry* ProsperoBinaryTraceReader::readNextEntry() {
@@ -58,17 +53,14 @@ ProsperoTraceEntry* ProsperoBinaryTraceReader::readNextEntry() {
 	uint64_t reqCycles  = 0;
 	char reqType = 'R';
 	uint32_t reqLength  = 0;
+	char record[sizeof(uint64_t) + sizeof(char) + sizeof(uint64_t) + sizeof(uint32_t)];
 
-	if(feof(traceInput)) {
-		return NULL;
-	}
-
-	if(1 == fread(buffer, (size_t) recordLength, (size_t) 1, traceInput)) {
+	if(blockReader->read(record, recordLength)) {
 		// We DID read an entry
-		copy((char*) &reqCycles,  buffer, (size_t) 0, sizeof(uint64_t));
-		copy((char*) &reqType,    buffer, sizeof(uint64_t), sizeof(char));
-		copy((char*) &reqAddress, buffer, sizeof(uint64_t) + sizeof(char), sizeof(uint64_t));
-		copy((char*) &reqLength,  buffer, sizeof(uint64_t) + sizeof(char) + sizeof(uint64_t), sizeof(uint32_t));
+		memcpy(&reqCycles,  record, sizeof(uint64_t));
+		memcpy(&reqType,    record + sizeof(uint64_t), sizeof(char));
+		memcpy(&reqAddress, record + sizeof(uint64_t) + sizeof(char), sizeof(uint64_t));
+		memcpy(&reqLength,  record + sizeof(uint64_t) + sizeof(char) + sizeof(uint64_t), sizeof(uint32_t));
 
 		return new ProsperoTraceEntry(reqCycles, reqAddress,
 			reqLength,
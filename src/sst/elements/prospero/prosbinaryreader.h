@@ -18,6 +18,7 @@
 #define _H_SST_PROSPERO_BINARY_READER
 
 #include "prosreader.h"
+#include "prosblockreader.h"
 
 namespace SST {
 namespace Prospero {
@@ -39,14 +40,14 @@ public:
     )
 
 	SST_ELI_DOCUMENT_PARAMS(
-		{ "file", "Sets the file for the trace reader to use", "" }
+		{ "file", "Sets the file for the trace reader to use", "" },
+		{ "buffer_size", "Bytes of the trace read in each block", "4194304" },
+		{ "async_read", "Read the next block on a helper thread while the current one is replayed", "true" }
 	)
 
 private:
-	void copy(char* target, const char* source,
-		const size_t offset, const size_t len);
 	FILE* traceInput;
-	char* buffer;
+	ProsperoBlockReader* blockReader;
 	uint32_t recordLength;
 
 };
@@ -32,24 +32,25 @@ ProsperoCompressedBinaryTraceReader::ProsperoCompressedBinaryTraceReader( Compon
 	}
 
 	recordLength = sizeof(uint64_t) + sizeof(char) + sizeof(uint64_t) + sizeof(uint32_t);
-	buffer = (char*) malloc(sizeof(char) * recordLength);
-}
 
-ProsperoCompressedBinaryTraceReader::~ProsperoCompressedBinaryTraceReader() {
-	if(NULL != traceInput) {
-		gzclose(traceInput);
-	}
+	// let zlib read the compressed file in large pieces as well
+	gzbuffer(traceInput, 256 * 1024);
 
-	if(NULL != buffer) {
-		free(buffer);
-	}
+	gzFile input = traceInput;
+	blockReader = new ProsperoBlockReader(
+		[input](char* target, size_t len) {
+			const int bytes = gzread(input, target, (unsigned int) len);
+			return (bytes > 0) ? (size_t) bytes : (size_t) 0;
+		},
+		params.find<size_t>("buffer_size", 4194304), params.find<bool>("async_read", true));
 }
 
-void ProsperoCompressedBinaryTraceReader::copy(char* target, const char* source,
-	const size_t bufferOffset, const size_t len) {
+ProsperoCompressedBinaryTraceReader::~ProsperoCompressedBinaryTraceReader() {
+	// stop the helper thread before closing the file it reads
+	delete blockReader;
 
-	for(size_t i = 0; i < len; ++i) {
-		target[i] = source[bufferOffset + i];
+	if(NULL != traceInput) {
+		gzclose(traceInput);
 	}
 }
 
@@ -60,27 +61,20 @@ ProsperoTraceEntry* ProsperoCompressedBinaryTraceReader::readNextEntry() {
 	uint64_t reqCycles  = 0;
 	char reqType = 'R';
 	uint32_t reqLength  = 0;
+	char record[sizeof(uint64_t) + sizeof(char) + sizeof(uint64_t) + sizeof(uint32_t)];
 
-	if(gzeof(traceInput)) {
-		output->verbose(CALL_INFO, 2, 0, "End of trace file reached, returning empty request.\n");
-		return NULL;
-	}
-
-	unsigned int bytesRead = gzread(traceInput, buffer, (unsigned int) recordLength);
-
-	if(bytesRead == recordLength) {
+	if(blockReader->read(record, recordLength)) {
 		// We DID read an entry
-		copy((char*) &reqCycles,  buffer, (size_t) 0, sizeof(uint64_t));
-		copy((char*) &reqType,    buffer, sizeof(uint64_t), sizeof(char));
-		copy((char*) &reqAddress, buffer, sizeof(uint64_t) + sizeof(char), sizeof(uint64_t));
-		copy((char*) &reqLength,  buffer, sizeof(uint64_t) + sizeof(char) + sizeof(uint64_t), sizeof(uint32_t));
+		memcpy(&reqCycles,  record, sizeof(uint64_t));
+		memcpy(&reqType,    record + sizeof(uint64_t), sizeof(char));
+		memcpy(&reqAddress, record + sizeof(uint64_t) + sizeof(char), sizeof(uint64_t));
+		memcpy(&reqLength,  record + sizeof(uint64_t) + sizeof(char) + sizeof(uint64_t), sizeof(uint32_t));
 
 		return new ProsperoTraceEntry(reqCycles, reqAddress,
 			reqLength,
 			(reqType == 'R' || reqType == 'r') ? READ : WRITE);
 	} else {
-		output->verbose(CALL_INFO, 2, 0, "Did not read a full record from the compressed trace, returning empty request.\n");
-		// Did not get a full read?
+		output->verbose(CALL_INFO, 2, 0, "End of compressed trace reached, returning empty request.\n");
 		return NULL;
 	}
 }
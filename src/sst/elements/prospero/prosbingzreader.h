@@ -18,6 +18,7 @@
 #define _H_SST_PROSPERO_GZ_BINARY_READER
 
 #include "prosreader.h"
+#include "prosblockreader.h"
 #include "zlib.h"
 
 namespace SST {
@@ -40,13 +41,14 @@ public:
 	)
 
     SST_ELI_DOCUMENT_PARAMS(
-        { "file", "Sets the file for the trace reader to use", "" }
+        { "file", "Sets the file for the trace reader to use", "" },
+        { "buffer_size", "Bytes of the decompressed trace read in each block", "4194304" },
+        { "async_read", "Decompress the next block on a helper thread while the current one is replayed", "true" }
     )
 
 private:
-	void copy(char* target, const char* source, const size_t buffOffset, const size_t len);
 	gzFile traceInput;
-	char* buffer;
+	ProsperoBlockReader* blockReader;
 	uint32_t recordLength;
 
 };
@@ -0,0 +1,139 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#include "sst_config.h"
+#include "prosblockreader.h"
+
+#include <algorithm>
+
+using namespace SST::Prospero;
+
+ProsperoBlockReader::ProsperoBlockReader(FillFunction fill, size_t blockBytes, bool async) :
+	fill_(fill), blockBytes_(blockBytes ? blockBytes : 1), async_(async),
+	frontPos(0), eof(false), backReady(false), done_(false) {
+
+	front.reserve(blockBytes_);
+	back.reserve(blockBytes_);
+
+	if(async_) {
+		thread_ = std::thread(&ProsperoBlockReader::run, this);
+	}
+}
+
+ProsperoBlockReader::~ProsperoBlockReader() {
+	if(async_) {
+		{
+			std::lock_guard<std::mutex> lock(mutex_);
+			done_ = true;
+		}
+		cv_.notify_all();
+		thread_.join();
+	}
+}
+
+/* Refill back whenever the consumer has taken it, until the input ends */
+void ProsperoBlockReader::run() {
+	std::unique_lock<std::mutex> lock(mutex_);
+
+	while(true) {
+		cv_.wait(lock, [this] { return done_ || !backReady; });
+
+		if(done_) {
+			return;
+		}
+
+		lock.unlock();
+
+		back.resize(blockBytes_);
+		back.resize(fill_(back.data(), blockBytes_));
+		const bool lastBlock = back.empty();
+
+		lock.lock();
+		backReady = true;
+		cv_.notify_all();
+
+		// an empty block tells the consumer the input has ended
+		if(lastBlock) {
+			return;
+		}
+	}
+}
+
+/* Make the next block current, false when the input is exhausted */
+bool ProsperoBlockReader::nextBlock() {
+	if(eof) {
+		return false;
+	}
+
+	if(async_) {
+		std::unique_lock<std::mutex> lock(mutex_);
+		cv_.wait(lock, [this] { return backReady; });
+
+		front.swap(back);
+		backReady = false;
+		lock.unlock();
+		cv_.notify_all();
+	} else {
+		front.resize(blockBytes_);
+		front.resize(fill_(front.data(), blockBytes_));
+	}
+
+	frontPos = 0;
+	eof = front.empty();
+
+	return !eof;
+}
+
+bool ProsperoBlockReader::readSpanning(char* target, size_t len) {
+	while(len > 0) {
+		if(frontPos == front.size() && !nextBlock()) {
+			return false;
+		}
+
+		const size_t chunk = std::min(len, front.size() - frontPos);
+		memcpy(target, front.data() + frontPos, chunk);
+
+		frontPos += chunk;
+		target   += chunk;
+		len      -= chunk;
+	}
+
+	return true;
+}
+
+bool ProsperoBlockReader::readLine(std::string& line) {
+	line.clear();
+
+	while(true) {
+		if(frontPos == front.size() && !nextBlock()) {
+			// a last line without a newline still counts
+			return !line.empty();
+		}
+
+		const char* start = front.data() + frontPos;
+		const size_t avail = front.size() - frontPos;
+		const char* newline = static_cast<const char*>(memchr(start, '\n', avail));
+
+		if(NULL != newline) {
+			line.append(start, newline - start);
+			frontPos += (newline - start) + 1;
+			return true;
+		}
+
+		line.append(start, avail);
+		frontPos = front.size();
+	}
+}
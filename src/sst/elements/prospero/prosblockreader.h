@@ -0,0 +1,86 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_SST_PROSPERO_BLOCK_READER
+#define _H_SST_PROSPERO_BLOCK_READER
+
+#include <stdint.h>
+#include <string.h>
+
+#include <condition_variable>
+#include <functional>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace SST {
+namespace Prospero {
+
+/*
+ * Reads a trace in large blocks through a fill function (fread, gzread, ...)
+ * and hands it out a record or a line at a time. With async set the next
+ * block is filled on a helper thread while the current one is consumed, so
+ * the simulation only waits on I/O when the helper falls behind.
+ */
+class ProsperoBlockReader {
+public:
+    // Fill up to len bytes at target, returning the number read, 0 at the end
+    typedef std::function<size_t(char*, size_t)> FillFunction;
+
+    ProsperoBlockReader(FillFunction fill, size_t blockBytes, bool async);
+    ~ProsperoBlockReader();
+
+    // Copy the next len bytes to target, false if the input ends first
+    bool read(char* target, const size_t len) {
+        if (frontPos + len <= front.size()) {
+            memcpy(target, front.data() + frontPos, len);
+            frontPos += len;
+            return true;
+        }
+
+        return readSpanning(target, len);
+    }
+
+    // Next line without its newline, false once the input is exhausted
+    bool readLine(std::string& line);
+
+private:
+    bool readSpanning(char* target, size_t len);
+    bool nextBlock();
+    void run();
+
+    FillFunction fill_;
+    const size_t blockBytes_;
+    const bool async_;
+
+    std::vector<char> front;
+    size_t frontPos;
+    bool eof;
+
+    // Shared with the helper thread
+    std::mutex mutex_;
+    std::condition_variable cv_;
+    std::vector<char> back;
+    bool backReady;
+    bool done_;
+    std::thread thread_;
+};
+
+}
+}
+
+#endif
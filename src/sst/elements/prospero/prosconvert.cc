@@ -0,0 +1,365 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+// Converts Prospero traces between the text, binary, compressed and indexed
+// formats, and prints the chunk index of an indexed trace.
+
+#include <sst_config.h>
+
+#include "prostraceindex.h"
+
+#include <inttypes.h>
+#include <unistd.h>
+
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+
+#include <string>
+#include <vector>
+
+using namespace SST::Prospero;
+
+static const size_t BINARY_RECORD = sizeof(uint64_t) + sizeof(char) + sizeof(uint64_t) + sizeof(uint32_t);
+
+void printUsage() {
+	printf("sst-prospero-convert [options] <in-format> <input> <out-format> <output>\n");
+	printf("sst-prospero-convert -i <indexed trace>\n");
+	printf("\n");
+	printf("Formats: text, binary, compressed, indexed\n");
+	printf("\n");
+	printf("Options:\n");
+	printf("  -c <records>  Records per chunk of an indexed trace, default 65536\n");
+	printf("  -z <level>    zlib level for indexed chunks, 0 stores them uncompressed, default 6\n");
+	printf("  -i <file>     Print the chunk index of an indexed trace\n");
+	printf("\n");
+}
+
+class TraceInput {
+public:
+	TraceInput(const std::string& fmt, const char* path) : format(fmt), file(NULL), next(0) {
+#ifdef HAVE_LIBZ
+		fileZ = NULL;
+#endif
+
+		if(format == "text") {
+			file = fopen(path, "rt");
+		} else if(format == "binary") {
+			file = fopen(path, "rb");
+		} else if(format == "compressed") {
+#ifdef HAVE_LIBZ
+			fileZ = gzopen(path, "rb");
+
+			if(NULL == fileZ) {
+				fprintf(stderr, "Error: unable to open %s\n", path);
+				exit(-1);
+			}
+
+			return;
+#else
+			fprintf(stderr, "Error: compressed traces need a build with zlib\n");
+			exit(-1);
+#endif
+		} else if(format == "indexed") {
+			file = fopen(path, "rb");
+
+			if(NULL != file) {
+				readIndex(path);
+			}
+		} else {
+			fprintf(stderr, "Error: unknown trace format %s\n", format.c_str());
+			exit(-1);
+		}
+
+		if(NULL == file) {
+			fprintf(stderr, "Error: unable to open %s\n", path);
+			exit(-1);
+		}
+	}
+
+	~TraceInput() {
+		if(NULL != file) {
+			fclose(file);
+		}
+
+#ifdef HAVE_LIBZ
+		if(NULL != fileZ) {
+			gzclose(fileZ);
+		}
+#endif
+	}
+
+	bool read(ProsperoTraceRecord& record) {
+		char buffer[BINARY_RECORD];
+
+		if(format == "text") {
+			return 4 == fscanf(file, "%" SCNu64 " %c %" SCNu64 " %" SCNu32, &record.cycles, &record.op,
+				&record.address, &record.length);
+		} else if(format == "binary") {
+			if(1 != fread(buffer, BINARY_RECORD, 1, file)) {
+				return false;
+			}
+		} else if(format == "compressed") {
+#ifdef HAVE_LIBZ
+			if((int) BINARY_RECORD != gzread(fileZ, buffer, BINARY_RECORD)) {
+				return false;
+			}
+#endif
+		} else {
+			while(next == records.size()) {
+				if(!readChunk()) {
+					return false;
+				}
+			}
+
+			record = records[next++];
+			return true;
+		}
+
+		memcpy(&record.cycles, buffer, sizeof(uint64_t));
+		memcpy(&record.op, buffer + sizeof(uint64_t), sizeof(char));
+		memcpy(&record.address, buffer + sizeof(uint64_t) + sizeof(char), sizeof(uint64_t));
+		memcpy(&record.length, buffer + sizeof(uint64_t) + sizeof(char) + sizeof(uint64_t), sizeof(uint32_t));
+
+		return true;
+	}
+
+	std::vector<ProsperoTraceChunk> chunks;
+	ProsperoTraceFooter footer;
+
+private:
+	void readIndex(const char* path) {
+		char header[PROSPERO_INDEX_HEADER];
+
+		if(1 != fread(header, sizeof(header), 1, file) ||
+			0 != memcmp(header, PROSPERO_INDEX_MAGIC, sizeof(PROSPERO_INDEX_MAGIC)) ||
+			0 != fseeko(file, -((off_t) sizeof(footer)), SEEK_END) ||
+			1 != fread(&footer, sizeof(footer), 1, file) ||
+			0 != memcmp(footer.magic, PROSPERO_FOOTER_MAGIC, sizeof(footer.magic))) {
+			fprintf(stderr, "Error: %s is not a complete indexed trace\n", path);
+			exit(-1);
+		}
+
+		chunks.resize(footer.chunkCount);
+
+		if(0 != fseeko(file, (off_t) footer.indexOffset, SEEK_SET) ||
+			chunks.size() != fread(chunks.data(), sizeof(ProsperoTraceChunk), chunks.size(), file)) {
+			fprintf(stderr, "Error: unable to read the index of %s\n", path);
+			exit(-1);
+		}
+
+		nextChunk = 0;
+	}
+
+	bool readChunk() {
+		if(nextChunk == chunks.size()) {
+			return false;
+		}
+
+		const ProsperoTraceChunk& chunk = chunks[nextChunk++];
+		std::vector<unsigned char> payload(chunk.bytes);
+
+		if(0 != fseeko(file, (off_t) chunk.offset, SEEK_SET) ||
+			chunk.bytes != fread(payload.data(), 1, chunk.bytes, file)) {
+			fprintf(stderr, "Error: unable to read a trace chunk\n");
+			exit(-1);
+		}
+
+		if(chunk.compressed) {
+#ifdef HAVE_LIBZ
+			uLongf size = ((uLongf) chunk.records) * PROSPERO_COLUMN_BYTES;
+			std::vector<unsigned char> inflated(size);
+
+			if(Z_OK != uncompress(inflated.data(), &size, payload.data(), chunk.bytes)) {
+				fprintf(stderr, "Error: corrupt trace chunk\n");
+				exit(-1);
+			}
+
+			payload.swap(inflated);
+#else
+			fprintf(stderr, "Error: compressed chunks need a build with zlib\n");
+			exit(-1);
+#endif
+		}
+
+		prosperoDecodeChunk(payload.data(), chunk.records, records);
+		next = 0;
+
+		return true;
+	}
+
+	std::string format;
+	FILE* file;
+#ifdef HAVE_LIBZ
+	gzFile fileZ;
+#endif
+	std::vector<ProsperoTraceRecord> records;
+	size_t next;
+	size_t nextChunk;
+};
+
+class TraceOutput {
+public:
+	TraceOutput(const std::string& fmt, const char* path, const uint32_t chunkRecords, const int level) :
+		format(fmt), file(NULL), indexed(NULL) {
+#ifdef HAVE_LIBZ
+		fileZ = NULL;
+#endif
+
+		if(format == "text") {
+			file = fopen(path, "wt");
+		} else if(format == "binary" || format == "indexed") {
+			file = fopen(path, "wb");
+		} else if(format == "compressed") {
+#ifdef HAVE_LIBZ
+			fileZ = gzopen(path, "wb");
+
+			if(NULL == fileZ) {
+				fprintf(stderr, "Error: unable to create %s\n", path);
+				exit(-1);
+			}
+
+			return;
+#else
+			fprintf(stderr, "Error: compressed traces need a build with zlib\n");
+			exit(-1);
+#endif
+		} else {
+			fprintf(stderr, "Error: unknown trace format %s\n", format.c_str());
+			exit(-1);
+		}
+
+		if(NULL == file) {
+			fprintf(stderr, "Error: unable to create %s\n", path);
+			exit(-1);
+		}
+
+		if(format == "indexed") {
+			indexed = new ProsperoIndexedTraceWriter(file, chunkRecords, level);
+		}
+	}
+
+	~TraceOutput() {
+		if(NULL != indexed) {
+			indexed->close();
+			delete indexed;
+		}
+
+		if(NULL != file) {
+			fclose(file);
+		}
+
+#ifdef HAVE_LIBZ
+		if(NULL != fileZ) {
+			gzclose(fileZ);
+		}
+#endif
+	}
+
+	void write(const ProsperoTraceRecord& record) {
+		char buffer[BINARY_RECORD];
+
+		if(format == "text") {
+			fprintf(file, "%" PRIu64 " %c %" PRIu64 " %" PRIu32 "\n", record.cycles, record.op,
+				record.address, record.length);
+			return;
+		} else if(format == "indexed") {
+			indexed->write(record);
+			return;
+		}
+
+		memcpy(buffer, &record.cycles, sizeof(uint64_t));
+		memcpy(buffer + sizeof(uint64_t), &record.op, sizeof(char));
+		memcpy(buffer + sizeof(uint64_t) + sizeof(char), &record.address, sizeof(uint64_t));
+		memcpy(buffer + sizeof(uint64_t) + sizeof(char) + sizeof(uint64_t), &record.length, sizeof(uint32_t));
+
+		if(format == "binary") {
+			fwrite(buffer, BINARY_RECORD, 1, file);
+		} else {
+#ifdef HAVE_LIBZ
+			gzwrite(fileZ, buffer, BINARY_RECORD);
+#endif
+		}
+	}
+
+private:
+	std::string format;
+	FILE* file;
+#ifdef HAVE_LIBZ
+	gzFile fileZ;
+#endif
+	ProsperoIndexedTraceWriter* indexed;
+};
+
+int main(int argc, char* argv[]) {
+	uint32_t chunkRecords = 65536;
+	int level = 6;
+	const char* infoFile = NULL;
+	int opt;
+
+	while((opt = getopt(argc, argv, "c:z:i:h")) != -1) {
+		switch(opt) {
+		case 'c':
+			chunkRecords = (uint32_t) strtoul(optarg, NULL, 10);
+			break;
+		case 'z':
+			level = atoi(optarg);
+			break;
+		case 'i':
+			infoFile = optarg;
+			break;
+		default:
+			printUsage();
+			exit(-1);
+		}
+	}
+
+	if(NULL != infoFile) {
+		TraceInput input("indexed", infoFile);
+
+		printf("%" PRIu64 " records in %" PRIu64 " chunks\n", input.footer.totalRecords, input.footer.chunkCount);
+		printf("%8s %16s %16s %12s %10s %11s\n", "chunk", "first record", "first cycle", "offset", "records", "bytes");
+
+		for(size_t i = 0; i < input.chunks.size(); ++i) {
+			const ProsperoTraceChunk& chunk = input.chunks[i];
+
+			printf("%8zu %16" PRIu64 " %16" PRIu64 " %12" PRIu64 " %10" PRIu32 " %10" PRIu32 "%s\n", i,
+				chunk.firstRecord, chunk.firstCycle, chunk.offset, chunk.records, chunk.bytes,
+				chunk.compressed ? "z" : "");
+		}
+
+		return 0;
+	}
+
+	if(argc - optind != 4) {
+		printUsage();
+		exit(-1);
+	}
+
+	TraceInput input(argv[optind], argv[optind + 1]);
+	TraceOutput output(argv[optind + 2], argv[optind + 3], chunkRecords, level);
+
+	ProsperoTraceRecord record;
+	uint64_t count = 0;
+
+	while(input.read(record)) {
+		output.write(record);
+		count++;
+	}
+
+	printf("Converted %" PRIu64 " records.\n", count);
+
+	return 0;
+}
@@ -51,6 +51,9 @@ ProsperoComponent::ProsperoComponent(ComponentId_t id, Params& params) :
     reader->setOutput(output);
 
 	pageSize = (uint64_t) params.find<uint64_t>("pagesize", 4096);
+	if(params.find<bool>("largepages", false)) {
+		pageSize = 2 * 1024 * 1024;
+	}
 	output->verbose(CALL_INFO, 1, 0, "Configured Prospero page size for %" PRIu64 " bytes.\n", pageSize);
 
     cacheLineSize = (uint64_t) params.find<uint64_t>("cache_line_size", 64);
@@ -85,9 +88,29 @@ ProsperoComponent::ProsperoComponent(ComponentId_t id, Params& params) :
     }
 	output->verbose(CALL_INFO, 1, 0, "Configuration of memory interface completed.\n");
 
-	output->verbose(CALL_INFO, 1, 0, "Reading first entry from the trace reader...\n");
-	currentEntry = reader->readNextEntry();
-	output->verbose(CALL_INFO, 1, 0, "Read of first entry complete.\n");
+	const uint64_t startRecord = params.find<uint64_t>("start_record", 0);
+	const uint64_t startCycle  = params.find<uint64_t>("start_cycle", 0);
+
+	maxRecords    = params.find<uint64_t>("max_records", 0);
+	recordsIssued = 0;
+	cycleOffset   = 0;
+
+	if(0 == startRecord && 0 == startCycle) {
+		output->verbose(CALL_INFO, 1, 0, "Reading first entry from the trace reader...\n");
+		currentEntry = reader->readNextEntry();
+		output->verbose(CALL_INFO, 1, 0, "Read of first entry complete.\n");
+	} else {
+		output->verbose(CALL_INFO, 1, 0, "Seeking trace to record %" PRIu64 ", cycle %" PRIu64 "...\n",
+			startRecord, startCycle);
+		currentEntry = reader->seekEntry(startRecord, startCycle);
+
+		// Replay the region as if it started the trace, rather than idling
+		// until the clock reaches its first cycle
+		if(NULL != currentEntry) {
+			cycleOffset = currentEntry->getIssueAtCycle();
+			output->verbose(CALL_INFO, 1, 0, "Seek complete, replay starts at trace cycle %" PRIu64 ".\n", cycleOffset);
+		}
+	}
 
 	output->verbose(CALL_INFO, 1, 0, "Creating memory manager with page size %" PRIu64 "...\n", pageSize);
 	memMgr = new ProsperoMemoryManager(pageSize, output);
@@ -217,13 +240,19 @@ bool ProsperoComponent::tick(SST::Cycle_t currentCycle) {
 	// Wait to see if the current operation can be issued, if yes then
 	// go ahead and issue it, otherwise we will stall
 	for(uint32_t i = 0; i < maxIssuePerCycle; ++i) {
-		if(currentCycle >= currentEntry->getIssueAtCycle()) {
+		if(currentCycle + cycleOffset >= currentEntry->getIssueAtCycle()) {
 			if(currentOutstanding < maxOutstanding) {
 				// Issue the pending request into the memory subsystem
 				issueRequest(currentEntry);
-
-				// Obtain the next newest request
-				currentEntry = reader->readNextEntry();
+				recordsIssued++;
+
+				// Obtain the next newest request, unless the region of
+				// interest has been replayed
+				if(maxRecords > 0 && recordsIssued >= maxRecords) {
+					currentEntry = NULL;
+				} else {
+					currentEntry = reader->readNextEntry();
+				}
 
 				// Trace reader has read all entries, time to begin draining
 				// the system, caches etc
@@ -61,10 +61,14 @@ public:
 	{ "verbose", "Verbosity for debugging. Increased numbers for increased verbosity.", "0" },
     	{ "cache_line_size", "Sets the length of the cache line in bytes, this should match the L1 cache", "64" },
     	{ "reader",  "The trace reader module to load", "prospero.ProsperoTextTraceReader" },
-    	{ "pagesize", "Sets the page size for the Prospero simple virtual memory manager", "4096"},
+    	{ "pagesize", "Sets the page size for the Prospero simple virtual memory manager, must be a power of two", "4096"},
+    	{ "largepages", "Set to 1 to map the trace with 2MB pages instead of pages of pagesize", "0"},
     	{ "clock", "Sets the clock of the core", "2GHz"} ,
     	{ "max_outstanding", "Sets the maximum number of outstanding transactions that the memory system will allow", "16"},
     	{ "max_issue_per_cycle", "Sets the maximum number of new transactions that the system can issue per cycle", "2"},
+    	{ "start_record", "Trace record to start replaying from", "0"},
+    	{ "start_cycle", "Skip trace records which issue before this cycle", "0"},
+    	{ "max_records", "Stop after replaying this many records, 0 replays to the end of the trace", "0"},
    )
 
    SST_ELI_DOCUMENT_PORTS(
@@ -99,6 +103,9 @@ private:
   uint32_t maxOutstanding;
   uint32_t currentOutstanding;
   uint32_t maxIssuePerCycle;
+  uint64_t maxRecords;
+  uint64_t recordsIssued;
+  uint64_t cycleOffset;
 
   uint64_t readsIssued;
   uint64_t writesIssued;
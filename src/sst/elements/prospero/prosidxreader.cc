@@ -0,0 +1,184 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#include "sst_config.h"
+#include "prosidxreader.h"
+
+#include <algorithm>
+
+using namespace SST::Prospero;
+
+
+ProsperoIndexedTraceReader::ProsperoIndexedTraceReader( ComponentId_t id, Params& params, Output* out ) :
+	ProsperoTraceReader(id, params, out) {
+
+	std::string traceFile = params.find<std::string>("file", "");
+	traceInput = fopen(traceFile.c_str(), "rb");
+
+	if(NULL == traceInput) {
+		output->fatal(CALL_INFO, -1, "%s, Fatal: Error opening trace file: %s in indexed reader.\n",
+			getName().c_str(), traceFile.c_str());
+	}
+
+	char header[PROSPERO_INDEX_HEADER];
+	uint32_t version = 0;
+
+	if(1 != fread(header, sizeof(header), 1, traceInput) ||
+		0 != memcmp(header, PROSPERO_INDEX_MAGIC, sizeof(PROSPERO_INDEX_MAGIC))) {
+		output->fatal(CALL_INFO, -1, "%s, Fatal: %s is not an indexed Prospero trace.\n",
+			getName().c_str(), traceFile.c_str());
+	}
+
+	memcpy(&version, header + sizeof(PROSPERO_INDEX_MAGIC), sizeof(version));
+
+	if(PROSPERO_INDEX_VERSION != version) {
+		output->fatal(CALL_INFO, -1, "%s, Fatal: %s is indexed trace version %" PRIu32 ", expected %" PRIu32 ".\n",
+			getName().c_str(), traceFile.c_str(), version, PROSPERO_INDEX_VERSION);
+	}
+
+	ProsperoTraceFooter footer;
+
+	if(0 != fseeko(traceInput, -((off_t) sizeof(footer)), SEEK_END) ||
+		1 != fread(&footer, sizeof(footer), 1, traceInput) ||
+		0 != memcmp(footer.magic, PROSPERO_FOOTER_MAGIC, sizeof(footer.magic))) {
+		output->fatal(CALL_INFO, -1, "%s, Fatal: %s has no index, the trace may be truncated.\n",
+			getName().c_str(), traceFile.c_str());
+	}
+
+	chunks.resize(footer.chunkCount);
+
+	if(0 != fseeko(traceInput, (off_t) footer.indexOffset, SEEK_SET) ||
+		chunks.size() != fread(chunks.data(), sizeof(ProsperoTraceChunk), chunks.size(), traceInput)) {
+		output->fatal(CALL_INFO, -1, "%s, Fatal: unable to read the index of %s.\n",
+			getName().c_str(), traceFile.c_str());
+	}
+
+	output->verbose(CALL_INFO, 1, 0, "Indexed trace %s holds %" PRIu64 " records in %" PRIu64 " chunks.\n",
+		traceFile.c_str(), footer.totalRecords, footer.chunkCount);
+
+	nextChunk  = 0;
+	nextRecord = 0;
+}
+
+ProsperoIndexedTraceReader::~ProsperoIndexedTraceReader() {
+	if(NULL != traceInput) {
+		fclose(traceInput);
+	}
+}
+
+bool ProsperoIndexedTraceReader::loadChunk(const uint64_t chunkIndex) {
+	if(chunkIndex >= chunks.size()) {
+		records.clear();
+		nextChunk  = chunks.size();
+		nextRecord = 0;
+		return false;
+	}
+
+	const ProsperoTraceChunk& chunk = chunks[chunkIndex];
+
+	payload.resize(chunk.bytes);
+
+	if(0 != fseeko(traceInput, (off_t) chunk.offset, SEEK_SET) ||
+		chunk.bytes != fread(payload.data(), 1, chunk.bytes, traceInput)) {
+		output->fatal(CALL_INFO, -1, "%s, Fatal: unable to read trace chunk %" PRIu64 ".\n",
+			getName().c_str(), chunkIndex);
+	}
+
+	const unsigned char* columns = payload.data();
+
+	if(chunk.compressed) {
+#ifdef HAVE_LIBZ
+		uLongf size = ((uLongf) chunk.records) * PROSPERO_COLUMN_BYTES;
+		inflated.resize(size);
+
+		if(Z_OK != uncompress(inflated.data(), &size, payload.data(), chunk.bytes) ||
+			size != ((uLongf) chunk.records) * PROSPERO_COLUMN_BYTES) {
+			output->fatal(CALL_INFO, -1, "%s, Fatal: trace chunk %" PRIu64 " is corrupt.\n",
+				getName().c_str(), chunkIndex);
+		}
+
+		columns = inflated.data();
+#else
+		output->fatal(CALL_INFO, -1, "%s, Fatal: trace chunk %" PRIu64 " is compressed but Prospero was built without zlib.\n",
+			getName().c_str(), chunkIndex);
+#endif
+	} else if(chunk.bytes != chunk.records * PROSPERO_COLUMN_BYTES) {
+		output->fatal(CALL_INFO, -1, "%s, Fatal: trace chunk %" PRIu64 " is corrupt.\n",
+			getName().c_str(), chunkIndex);
+	}
+
+	prosperoDecodeChunk(columns, chunk.records, records);
+
+	nextChunk  = chunkIndex + 1;
+	nextRecord = 0;
+
+	return true;
+}
+
+ProsperoTraceEntry* ProsperoIndexedTraceReader::makeEntry(const ProsperoTraceRecord& record) {
+	return new ProsperoTraceEntry(record.cycles, record.address, record.length,
+		(record.op == 'R' || record.op == 'r') ? READ : WRITE);
+}
+
+ProsperoTraceEntry* ProsperoIndexedTraceReader::readNextEntry() {
+	while(nextRecord == records.size()) {
+		if(!loadChunk(nextChunk)) {
+			return NULL;
+		}
+	}
+
+	return makeEntry(records[nextRecord++]);
+}
+
+/*
+ * Start from the later of the last chunk beginning at or before record and
+ * the last beginning at or before cycle, then scan forward. This assumes issue
+ * cycles never decrease along the trace, which is how traces are captured.
+ */
+ProsperoTraceEntry* ProsperoIndexedTraceReader::seekEntry(const uint64_t record, const uint64_t cycle) {
+	std::vector<ProsperoTraceChunk>::const_iterator byRecord = std::upper_bound(chunks.begin(), chunks.end(), record,
+		[](const uint64_t value, const ProsperoTraceChunk& chunk) { return value < chunk.firstRecord; });
+	std::vector<ProsperoTraceChunk>::const_iterator byCycle = std::upper_bound(chunks.begin(), chunks.end(), cycle,
+		[](const uint64_t value, const ProsperoTraceChunk& chunk) { return value < chunk.firstCycle; });
+
+	uint64_t startChunk = std::max(byRecord - chunks.begin(), byCycle - chunks.begin());
+	startChunk = (startChunk > 0) ? startChunk - 1 : 0;
+
+	output->verbose(CALL_INFO, 1, 0, "Seeking to record %" PRIu64 ", cycle %" PRIu64 ", starting from chunk %" PRIu64 ".\n",
+		record, cycle, startChunk);
+
+	if(!loadChunk(startChunk)) {
+		return NULL;
+	}
+
+	uint64_t position = chunks[startChunk].firstRecord;
+
+	while(true) {
+		while(nextRecord < records.size()) {
+			const ProsperoTraceRecord& next = records[nextRecord++];
+
+			if(position >= record && next.cycles >= cycle) {
+				return makeEntry(next);
+			}
+
+			position++;
+		}
+
+		if(!loadChunk(nextChunk)) {
+			return NULL;
+		}
+	}
+}
@@ -0,0 +1,64 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_SST_PROSPERO_INDEXED_READER
+#define _H_SST_PROSPERO_INDEXED_READER
+
+#include "prosreader.h"
+#include "prostraceindex.h"
+
+namespace SST {
+namespace Prospero {
+
+class ProsperoIndexedTraceReader : public ProsperoTraceReader {
+
+public:
+    ProsperoIndexedTraceReader( ComponentId_t id, Params& params, Output* out );
+    ~ProsperoIndexedTraceReader();
+    ProsperoTraceEntry* readNextEntry();
+    ProsperoTraceEntry* seekEntry(const uint64_t record, const uint64_t cycle);
+
+	SST_ELI_REGISTER_SUBCOMPONENT(
+        ProsperoIndexedTraceReader,
+        "prospero",
+        "ProsperoIndexedTraceReader",
+        SST_ELI_ELEMENT_VERSION(1,0,0),
+        "Chunk-indexed Trace Reader (see sst-prospero-convert), seeks straight to a record or cycle",
+        SST::Prospero::ProsperoTraceReader
+    )
+
+	SST_ELI_DOCUMENT_PARAMS(
+		{ "file", "Sets the file for the trace reader to use", "" }
+	)
+
+private:
+	bool loadChunk(const uint64_t chunkIndex);
+	ProsperoTraceEntry* makeEntry(const ProsperoTraceRecord& record);
+
+	FILE* traceInput;
+	std::vector<ProsperoTraceChunk> chunks;
+	std::vector<ProsperoTraceRecord> records;
+	std::vector<unsigned char> payload;
+	std::vector<unsigned char> inflated;
+	uint64_t nextChunk;
+	size_t nextRecord;
+
+};
+
+}
+}
+
+#endif
@@ -24,34 +24,39 @@ ProsperoMemoryManager::ProsperoMemoryManager(const uint64_t pgSize, Output* out)
 
 	output = out;
 	nextPageStart = pgSize;
+
+	if(0 == pgSize || 0 != (pgSize & (pgSize - 1))) {
+		output->fatal(CALL_INFO, -1, "Prospero page size must be a power of two, got %" PRIu64 "\n", pgSize);
+	}
+
+	pageShift = 0;
+	while((1ULL << pageShift) < pgSize) {
+		pageShift++;
+	}
+	pageMask = pgSize - 1;
+
+	lastVirtPage = ~0ULL;
+	lastPhysPageStart = 0;
 }
 
 ProsperoMemoryManager::~ProsperoMemoryManager() {
 
 }
 
-uint64_t ProsperoMemoryManager::translate(const uint64_t virtAddr) {
-	const uint64_t pageOffset = virtAddr % pageSize;
-	const uint64_t virtPageStart = virtAddr - pageOffset;
-	uint64_t resolvedPhysPageStart = 0;
-
-	output->verbose(CALL_INFO, 2, 0, "Translating virtual address %" PRIu64 ", page offset=%" PRIu64 ", start virt=%" PRIu64 "\n",
-		virtAddr, pageOffset, virtPageStart);
+uint64_t ProsperoMemoryManager::lookup(const uint64_t virtPage) {
+	std::vector<uint64_t>& leaf = pageTable[virtPage >> LEAF_BITS];
+	if(leaf.empty()) {
+		leaf.resize(LEAF_ENTRIES, 0);
+	}
 
-	std::map<uint64_t, uint64_t>::iterator findEntry = pageTable.find(virtPageStart);
-	if(findEntry == pageTable.end()) {
-		output->verbose(CALL_INFO, 2, 0, "Translation requires new page, creating at physical: %" PRIu64 "\n", nextPageStart);
+	uint64_t& physPageStart = leaf[virtPage & (LEAF_ENTRIES - 1)];
+	if(0 == physPageStart) {
+		output->verbose(CALL_INFO, 2, 0, "Translation of virtual page %" PRIu64 " requires new page, creating at physical: %" PRIu64 "\n",
+			virtPage << pageShift, nextPageStart);
 
-		resolvedPhysPageStart = nextPageStart;
-		pageTable.insert( std::pair<uint64_t, uint64_t>(virtPageStart, nextPageStart) );
+		physPageStart = nextPageStart;
 		nextPageStart += pageSize;
-	} else {
-		resolvedPhysPageStart = findEntry->second;
 	}
 
-	output->verbose(CALL_INFO, 2, 0, "Translated physical page to %" PRIu64 " + offset %" PRIu64 " = final physical %" PRIu64 "\n",
-		resolvedPhysPageStart, pageOffset, (resolvedPhysPageStart + pageOffset));
-
-	// Reapply the offset to the physical page we just located and we are finished
-	return resolvedPhysPageStart + pageOffset;
+	return physPageStart;
 }
@@ -18,21 +18,51 @@
 #define _H_SS_PROSPERO_MEM_MGR
 
 #include <sst/core/output.h>
-#include <map>
+#include <unordered_map>
+#include <vector>
 
 namespace SST {
 namespace Prospero {
 
+/*
+ * Pages are allocated on first touch. The table is a radix tree of two
+ * levels over the virtual page number, a hashed root of leaves that each
+ * cover LEAF_ENTRIES consecutive pages, and the last translation is kept
+ * so runs of accesses to one page skip the table entirely.
+ */
 class ProsperoMemoryManager {
 public:
 	ProsperoMemoryManager(const uint64_t pageSize, Output* output);
 	~ProsperoMemoryManager();
-	uint64_t translate(const uint64_t virtAddr);
+
+	uint64_t translate(const uint64_t virtAddr) {
+		const uint64_t virtPage = virtAddr >> pageShift;
+
+		if(virtPage != lastVirtPage) {
+			lastPhysPageStart = lookup(virtPage);
+			lastVirtPage = virtPage;
+		}
+
+		// Reapply the offset to the physical page we just located and we are finished
+		return lastPhysPageStart + (virtAddr & pageMask);
+	}
 
 private:
-	std::map<uint64_t, uint64_t> pageTable;
+	static const uint64_t LEAF_BITS = 10;
+	static const uint64_t LEAF_ENTRIES = 1ULL << LEAF_BITS;
+
+	uint64_t lookup(const uint64_t virtPage);
+
+	// Physical page starts, 0 marks a page not yet allocated as
+	// physical pages start at pageSize
+	std::unordered_map<uint64_t, std::vector<uint64_t> > pageTable;
 	uint64_t nextPageStart;
 	uint64_t pageSize;
+	uint64_t pageShift;
+	uint64_t pageMask;
+
+	uint64_t lastVirtPage;
+	uint64_t lastPhysPageStart;
 	Output* output;
 };
 
@@ -22,6 +22,8 @@
 #include <sst/core/subcomponent.h>
 #include <sst/core/params.h>
 
+#include "sst/elements/pool/objectPool.h"
+
 namespace SST {
 namespace Prospero {
 
@@ -47,6 +49,11 @@ public:
 	uint32_t getLength() const { return length; }
 	uint64_t getIssueAtCycle() const { return cycles; }
 	ProsperoTraceEntryOperation getOperationType() const { return op; }
+
+	// One entry is created and deleted per trace record, recycle them
+	// through the element object pool rather than the heap
+	SST_ELEMENT_POOL_OPERATORS(SST::Prospero::ProsperoTraceEntry)
+
 private:
 	const uint64_t cycles;
 	const uint64_t address;
@@ -65,6 +72,22 @@ public:
 
 	~ProsperoTraceReader() { };
 	virtual ProsperoTraceEntry* readNextEntry() { return NULL; };
+
+	// First entry at or after trace position record with an issue cycle of
+	// at least cycle. Readers that can index into their trace override this,
+	// the default reads and discards everything before it.
+	virtual ProsperoTraceEntry* seekEntry(const uint64_t record, const uint64_t cycle) {
+		uint64_t position = 0;
+		ProsperoTraceEntry* entry = readNextEntry();
+
+		while(NULL != entry && (position < record || entry->getIssueAtCycle() < cycle)) {
+			delete entry;
+			entry = readNextEntry();
+			position++;
+		}
+
+		return entry;
+	}
 	void setOutput(Output* out) { output = out; }
 
 protected:
@@ -17,6 +17,9 @@
 #include "sst_config.h"
 #include "prostextreader.h"
 
+#include <ctype.h>
+#include <stdlib.h>
+
 using namespace SST::Prospero;
 
 
@@ -31,26 +34,53 @@ ProsperoTextTraceReader::ProsperoTextTraceReader( ComponentId_t id, Params& para
                     getName().c_str(), traceFile.c_str());
 	}
 
+	FILE* input = traceInput;
+	blockReader = new ProsperoBlockReader(
+		[input](char* target, size_t len) { return fread(target, 1, len, input); },
+		params.find<size_t>("buffer_size", 4194304), params.find<bool>("async_read", true));
 }
 
 ProsperoTextTraceReader::~ProsperoTextTraceReader() {
+	// stop the helper thread before closing the file it reads
+	delete blockReader;
+
 	if(NULL != traceInput) {
 		fclose(traceInput);
 	}
 }
 
 ProsperoTraceEntry* ProsperoTextTraceReader::readNextEntry() {
-	uint64_t reqAddress = 0;
-	uint64_t reqCycles  = 0;
-	char reqType = 'R';
-	uint32_t reqLength  = 0;
-
-	if(EOF == fscanf(traceInput, "%" PRIu64 " %c %" PRIu64 " %" PRIu32 "",
-		&reqCycles, &reqType, &reqAddress, &reqLength) ) {
-		return NULL;
-	} else {
+	// Each line is: cycles op address length
+	while(blockReader->readLine(line)) {
+		const char* next = line.c_str();
+		char* end = NULL;
+
+		while(isspace(*next)) {
+			next++;
+		}
+
+		// skip blank lines
+		if('\0' == *next) {
+			continue;
+		}
+
+		const uint64_t reqCycles = strtoull(next, &end, 10);
+
+		for(next = end; isspace(*next); next++) {}
+
+		const char reqType = *next;
+
+		if('\0' == reqType) {
+			output->fatal(CALL_INFO, -1, "%s, Fatal: malformed trace line: %s\n", getName().c_str(), line.c_str());
+		}
+
+		const uint64_t reqAddress = strtoull(next + 1, &end, 10);
+		const uint32_t reqLength  = (uint32_t) strtoul(end, &end, 10);
+
 		return new ProsperoTraceEntry(reqCycles, reqAddress,
 			reqLength,
 			(reqType == 'R' || reqType == 'r') ? READ : WRITE);
 	}
+
+	return NULL;
 }
@@ -18,6 +18,7 @@
 #define _H_SST_PROSPERO_TEXT_READER
 
 #include "prosreader.h"
+#include "prosblockreader.h"
 
 using namespace SST::Prospero;
 
@@ -41,11 +42,15 @@ public:
     )
 
     SST_ELI_DOCUMENT_PARAMS(
-        { "file", "Sets the file for the trace reader to use", "" }
+        { "file", "Sets the file for the trace reader to use", "" },
+        { "buffer_size", "Bytes of the trace read in each block", "4194304" },
+        { "async_read", "Read the next block on a helper thread while the current one is replayed", "true" }
     )
 
 private:
 	FILE* traceInput;
+	ProsperoBlockReader* blockReader;
+	std::string line;
 
 };
 
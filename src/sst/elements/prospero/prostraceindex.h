@@ -0,0 +1,235 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+
+#ifndef _H_SST_PROSPERO_TRACE_INDEX
+#define _H_SST_PROSPERO_TRACE_INDEX
+
+#include <stdint.h>
+#include <stdio.h>
+#include <string.h>
+
+#include <vector>
+
+#ifdef HAVE_LIBZ
+#include <zlib.h>
+#endif
+
+namespace SST {
+namespace Prospero {
+
+/*
+ * Chunk-indexed Prospero trace, shared by ProsperoIndexedTraceReader and
+ * sst-prospero-convert. All fields are in host byte order.
+ *
+ *   header : char magic[8] = "PROSIDX1", uint32_t version, uint32_t recordsPerChunk
+ *   chunks : one ProsperoTraceChunk payload after another
+ *   index  : one ProsperoTraceChunk per chunk
+ *   footer : ProsperoTraceFooter
+ *
+ * A chunk payload is columnar: the cycle deltas (uint64_t), the address deltas
+ * (uint64_t), the lengths (uint32_t) and the operations ('R' or 'W') of its
+ * records, each column stored contiguously. Deltas restart from zero in every
+ * chunk so any chunk decodes on its own. With libz a chunk is compressed when
+ * that makes it smaller.
+ */
+struct ProsperoTraceRecord {
+	uint64_t cycles;
+	uint64_t address;
+	uint32_t length;
+	char     op;
+};
+
+struct ProsperoTraceChunk {
+	uint64_t offset;        // file offset of the payload
+	uint64_t firstRecord;   // trace position of the first record
+	uint64_t firstCycle;    // issue cycle of the first record
+	uint32_t records;
+	uint32_t bytes;         // payload bytes in the file
+	uint32_t compressed;    // 1 if the payload is zlib compressed
+	uint32_t reserved;
+};
+
+struct ProsperoTraceFooter {
+	uint64_t indexOffset;
+	uint64_t chunkCount;
+	uint64_t totalRecords;
+	char     magic[8];      // "PROSIDXE"
+};
+
+static const char     PROSPERO_INDEX_MAGIC[8]  = { 'P', 'R', 'O', 'S', 'I', 'D', 'X', '1' };
+static const char     PROSPERO_FOOTER_MAGIC[8] = { 'P', 'R', 'O', 'S', 'I', 'D', 'X', 'E' };
+static const uint32_t PROSPERO_INDEX_VERSION   = 1;
+static const size_t   PROSPERO_INDEX_HEADER    = 16;
+static const size_t   PROSPERO_COLUMN_BYTES    = sizeof(uint64_t) + sizeof(uint64_t) + sizeof(uint32_t) + sizeof(char);
+
+/* Lay a chunk's records out as delta-encoded columns */
+inline void prosperoEncodeChunk(const std::vector<ProsperoTraceRecord>& records, std::vector<unsigned char>& payload) {
+	const size_t count = records.size();
+	payload.resize(count * PROSPERO_COLUMN_BYTES);
+
+	unsigned char* cycles  = payload.data();
+	unsigned char* address = cycles + count * sizeof(uint64_t);
+	unsigned char* length  = address + count * sizeof(uint64_t);
+	unsigned char* op      = length + count * sizeof(uint32_t);
+
+	uint64_t lastCycles  = 0;
+	uint64_t lastAddress = 0;
+
+	for(size_t i = 0; i < count; ++i) {
+		const uint64_t cycleDelta   = records[i].cycles - lastCycles;
+		const uint64_t addressDelta = records[i].address - lastAddress;
+
+		memcpy(cycles + i * sizeof(uint64_t), &cycleDelta, sizeof(uint64_t));
+		memcpy(address + i * sizeof(uint64_t), &addressDelta, sizeof(uint64_t));
+		memcpy(length + i * sizeof(uint32_t), &records[i].length, sizeof(uint32_t));
+		op[i] = (unsigned char) records[i].op;
+
+		lastCycles  = records[i].cycles;
+		lastAddress = records[i].address;
+	}
+}
+
+inline void prosperoDecodeChunk(const unsigned char* payload, const size_t count, std::vector<ProsperoTraceRecord>& records) {
+	records.resize(count);
+
+	const unsigned char* cycles  = payload;
+	const unsigned char* address = cycles + count * sizeof(uint64_t);
+	const unsigned char* length  = address + count * sizeof(uint64_t);
+	const unsigned char* op      = length + count * sizeof(uint32_t);
+
+	uint64_t lastCycles  = 0;
+	uint64_t lastAddress = 0;
+
+	for(size_t i = 0; i < count; ++i) {
+		uint64_t cycleDelta;
+		uint64_t addressDelta;
+
+		memcpy(&cycleDelta, cycles + i * sizeof(uint64_t), sizeof(uint64_t));
+		memcpy(&addressDelta, address + i * sizeof(uint64_t), sizeof(uint64_t));
+		memcpy(&records[i].length, length + i * sizeof(uint32_t), sizeof(uint32_t));
+		records[i].op = (char) op[i];
+
+		lastCycles  += cycleDelta;
+		lastAddress += addressDelta;
+
+		records[i].cycles  = lastCycles;
+		records[i].address = lastAddress;
+	}
+}
+
+/*
+ * Writes an indexed trace one record at a time, a chunk is encoded and
+ * written every recordsPerChunk records and the index on close()
+ */
+class ProsperoIndexedTraceWriter {
+public:
+	ProsperoIndexedTraceWriter(FILE* file, const uint32_t recordsPerChunk, const int compressionLevel) :
+		file_(file), recordsPerChunk_(recordsPerChunk ? recordsPerChunk : 1),
+		compressionLevel_(compressionLevel), totalRecords_(0), closed_(false) {
+
+		fwrite(PROSPERO_INDEX_MAGIC, 1, sizeof(PROSPERO_INDEX_MAGIC), file_);
+		fwrite(&PROSPERO_INDEX_VERSION, sizeof(uint32_t), 1, file_);
+		fwrite(&recordsPerChunk_, sizeof(uint32_t), 1, file_);
+
+		offset_ = PROSPERO_INDEX_HEADER;
+		current_.reserve(recordsPerChunk_);
+	}
+
+	~ProsperoIndexedTraceWriter() { close(); }
+
+	void write(const ProsperoTraceRecord& record) {
+		current_.push_back(record);
+
+		if(current_.size() == recordsPerChunk_) {
+			writeChunk();
+		}
+	}
+
+	void close() {
+		if(closed_) {
+			return;
+		}
+
+		closed_ = true;
+
+		if(!current_.empty()) {
+			writeChunk();
+		}
+
+		ProsperoTraceFooter footer;
+		footer.indexOffset  = offset_;
+		footer.chunkCount   = index_.size();
+		footer.totalRecords = totalRecords_;
+		memcpy(footer.magic, PROSPERO_FOOTER_MAGIC, sizeof(footer.magic));
+
+		fwrite(index_.data(), sizeof(ProsperoTraceChunk), index_.size(), file_);
+		fwrite(&footer, sizeof(footer), 1, file_);
+	}
+
+private:
+	void writeChunk() {
+		prosperoEncodeChunk(current_, payload_);
+
+		ProsperoTraceChunk chunk;
+		chunk.offset      = offset_;
+		chunk.firstRecord = totalRecords_;
+		chunk.firstCycle  = current_.front().cycles;
+		chunk.records     = current_.size();
+		chunk.bytes       = payload_.size();
+		chunk.compressed  = 0;
+		chunk.reserved    = 0;
+
+		const unsigned char* data = payload_.data();
+
+#ifdef HAVE_LIBZ
+		if(compressionLevel_ != 0) {
+			uLongf size = compressBound(payload_.size());
+			compressed_.resize(size);
+
+			if(compress2(compressed_.data(), &size, payload_.data(), payload_.size(), compressionLevel_) == Z_OK &&
+				size < payload_.size()) {
+				chunk.bytes      = size;
+				chunk.compressed = 1;
+				data             = compressed_.data();
+			}
+		}
+#endif
+
+		fwrite(data, 1, chunk.bytes, file_);
+
+		offset_       += chunk.bytes;
+		totalRecords_ += chunk.records;
+		index_.push_back(chunk);
+		current_.clear();
+	}
+
+	FILE* file_;
+	uint32_t recordsPerChunk_;
+	int compressionLevel_;
+	uint64_t offset_;
+	uint64_t totalRecords_;
+	bool closed_;
+
+	std::vector<ProsperoTraceRecord> current_;
+	std::vector<ProsperoTraceChunk> index_;
+	std::vector<unsigned char> payload_;
+	std::vector<unsigned char> compressed_;
+};
+
+}
+}
+
+#endif
@@ -59,6 +59,12 @@ RdmaNic::RdmaNic(ComponentId_t id, Params &params) : Component(id),
     auto cmdQSize = params.find<int>("cmdQSize", 64);
     assert( cmdQSize );
 
+    // Batching of the index updates the NIC writes to host memory, 1 writes one per command/completion
+    m_cmdQTailBatch = params.find<int>("cmdQTailBatch", 1);
+    assert( m_cmdQTailBatch > 0 );
+    m_compQHeadBatch = params.find<int>("compQHeadBatch", 1);
+    assert( m_compQHeadBatch > 0 );
+
     // make sure a NicCmd is multiple of a ache line
     // Make this more general 
     assert( sizeof( NicCmd) == 64 );
@@ -239,6 +245,10 @@ bool RdmaNic::clock(Cycle_t cycle) {
 	m_recvEngine->process();
 	m_sendEngine->process();
 
+	if ( m_compQHeadBatch > 1 ) {
+		flushCompletions();
+	}
+
     return false;
 }
 
@@ -259,8 +269,14 @@ void RdmaNic::processThreadCmdQs( ) {
 
         ++info.localTailIndex;
         info.localTailIndex %= m_backing->getCmdQSize();
-        dbg.debug( CALL_INFO_LONG,1,DBG_X_FLAG,"write tail=%d at %#" PRIx64 "\n",info.localTailIndex, info.tailAddr );
-        m_memReqQ->write( m_tailWriteQnum, info.tailAddr, 4, info.localTailIndex );
+
+        // the host only reads the tail when its Q is full, if more commands are queued 
+        // the last one of them writes it, that bounds how stale the host's view can get 
+        if ( ++info.unpublished >= m_cmdQTailBatch || m_nicCmdQ.empty() ) {
+            dbg.debug( CALL_INFO_LONG,1,DBG_X_FLAG,"write tail=%d at %#" PRIx64 "\n",info.localTailIndex, info.tailAddr );
+            m_memReqQ->write( m_tailWriteQnum, info.tailAddr, 4, info.localTailIndex );
+            info.unpublished = 0;
+        }
     }
 	if ( m_activeNicCmd ) {
 		if ( m_activeNicCmd->process() ) {
@@ -301,8 +317,30 @@ void RdmaNic::writeCompletionToHost(int thread, int cqId, RdmaCompletion& comp )
 	q.incHeadIndex();
 
 	m_memReqQ->write( m_respQueueMemChannel, data, sizeof(comp), reinterpret_cast<uint8_t*>(&comp) );
+
+	if ( q.unpublished() >= m_compQHeadBatch ) {
+		publishCompletions( q );
+	}
+}
+
+// the fence orders the head index after the completions it covers, one head write publishes all of them
+void RdmaNic::publishCompletions( CompletionQueue& q )
+{
+    dbg.debug( CALL_INFO_LONG,2,DBG_X_FLAG,"headIndex=%d completions=%d\n", q.headIndex(), q.unpublished() );
     m_memReqQ->fence( m_respQueueMemChannel );
 	m_memReqQ->write( m_respQueueMemChannel, q.cmd().data.createCQ.headPtr, sizeof(q.headIndex()), q.headIndex() );
+	q.published();
+}
+
+// publish the comp Qs that went a cycle without a new completion so a partial batch is not held 
+void RdmaNic::flushCompletions()
+{
+	for ( auto& iter : m_compQueueMap ) {
+		CompletionQueue& q = *iter.second;
+		if ( ! q.added() && q.unpublished() ) {
+			publishCompletions( q );
+		}
+	}
 }
 
 void RdmaNic::init(unsigned int phase) {
@@ -123,11 +123,17 @@ class RdmaNic : public SST::Component {
     struct NicCmdQueueInfo { 
         NicCmdQueueInfo( ){} 
         NicCmdQueueInfo( uint64_t  tailAddr ) :
-            tailAddr(tailAddr), localTailIndex(0) {}
+            tailAddr(tailAddr), localTailIndex(0), unpublished(0) {}
 
         uint64_t  tailAddr;
         uint32_t  localTailIndex;
+        // commands consumed since the tail index was last written to the host
+        uint32_t  unpublished;
     };
+    // write the cmd Q tail index every this many commands while more are queued
+    int m_cmdQTailBatch;
+    // write a comp Q head index every this many completions, or when the Q goes a cycle without one
+    int m_compQHeadBatch;
     std::vector<NicCmdQueueInfo> m_nicCmdQueueV;
 
     Output dbg;
@@ -309,7 +315,7 @@ class RdmaNic : public SST::Component {
 	};
 	class CompletionQueue {
 	  public:
-		CompletionQueue( NicCmd * cmd) : m_cmd(cmd), m_headIndex(0) {}
+		CompletionQueue( NicCmd * cmd) : m_cmd(cmd), m_headIndex(0), m_unpublished(0), m_added(false) {}
         ~CompletionQueue() { delete m_cmd; }
 
 		NicCmd& cmd() { return *m_cmd; }	
@@ -317,11 +323,28 @@ class RdmaNic : public SST::Component {
 		void incHeadIndex() { 
 			++m_headIndex; 
 			m_headIndex %= m_cmd->data.createCQ.num;
+			++m_unpublished;
+			m_added = true;
 		};
+
+		// number of completions written whose head index the host has not seen
+		int unpublished() { return m_unpublished; }
+		void published() { m_unpublished = 0; }
+
+		// true if a completion was added since the last call 
+		bool added() {
+			bool tmp = m_added;
+			m_added = false;
+			return tmp;
+		}
 	  private:
 		int m_headIndex;
 		NicCmd* m_cmd;	
+		int m_unpublished;
+		bool m_added;
 	};
+	void publishCompletions( CompletionQueue& );
+	void flushCompletions();
 
 	#include "rdmaNicBarrier.h"
 	#include "rdmaNicNetworkQueue.h"
@@ -73,7 +73,11 @@ class RdmaDestroyCQ_Cmd : public NicCmdEntry {
 
         auto iter = m_nic.m_compQueueMap.find( m_cmd->data.destroyCQ.cqId );
         if ( iter != m_nic.m_compQueueMap.end() ) {
-    	    delete m_nic.m_compQueueMap[ m_cmd->data.destroyCQ.cqId ];
+            if ( iter->second->unpublished() ) {
+                m_nic.publishCompletions( *iter->second );
+            }
+    	    delete iter->second;
+            m_nic.m_compQueueMap.erase( iter );
             m_resp.retval = 0;
         }
 	}
@@ -0,0 +1,170 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_SST_ELEMENTS_RNG_PHILOX
+#define _H_SST_ELEMENTS_RNG_PHILOX
+
+#include <stdint.h>
+#include <stddef.h>
+
+#include <sst/core/rng/rng.h>
+
+namespace SST {
+namespace ElementRNG {
+
+/*
+ * Philox4x32-10 counter-based generator (Salmon et al., "Parallel Random
+ * Numbers: As Easy as 1, 2, 3", SC'11).
+ *
+ * Output block n of a stream is a pure function of (key, stream, n), so a
+ * generator keyed with a component ID gives the same sequence however the
+ * simulation is partitioned across ranks and threads, and different
+ * (key, stream) pairs never need to be seeded apart from one another. Any
+ * position can be reached in constant time with seek(), and the fill()
+ * calls produce whole blocks straight into the caller's buffer.
+ *
+ * The 128-bit counter is (block number, stream) and the 64-bit key is the
+ * key, so each stream has 2^64 blocks of four 32-bit values.
+ */
+class Philox4x32 {
+public:
+    Philox4x32(uint64_t key = 0, uint64_t stream = 0) { setKey(key, stream); }
+
+    /* Select a stream and restart it from the beginning */
+    void setKey(uint64_t key, uint64_t stream = 0) {
+        key_[0] = (uint32_t)key;
+        key_[1] = (uint32_t)(key >> 32);
+        stream_ = stream;
+        seek(0);
+    }
+
+    /* Move to the pos'th 32-bit value of the stream */
+    void seek(uint64_t pos) {
+        block_ = pos >> 2;
+        index_ = pos & 3;
+        if (index_ != 0) generate(block_++, out_);
+    }
+
+    /* Number of 32-bit values consumed so far */
+    uint64_t position() const { return index_ == 0 ? block_ << 2 : ((block_ - 1) << 2) + index_; }
+
+    inline uint32_t next32() {
+        if (index_ == 0) generate(block_++, out_);
+        uint32_t result = out_[index_];
+        index_ = (index_ + 1) & 3;
+        return result;
+    }
+
+    inline uint64_t next64() {
+        uint64_t low = next32();
+        return low | ((uint64_t)next32() << 32);
+    }
+
+    // Value in [0,bound)
+    inline uint32_t nextBounded(uint32_t bound) {
+        return (uint32_t)(((uint64_t)next32() * bound) >> 32);
+    }
+
+    // Value in [0,1)
+    inline double nextDouble() {
+        return (double)(next64() >> 11) * (1.0 / (double)(1ULL << 53));
+    }
+
+    /* Bulk generation, the same values as n calls to next32()/next64()/nextDouble() */
+    void fill(uint32_t* buf, size_t n) {
+        size_t i = 0;
+        while (i < n && index_ != 0) buf[i++] = next32();
+        for (; i + 4 <= n; i += 4) generate(block_++, buf + i);
+        while (i < n) buf[i++] = next32();
+    }
+
+    void fill(uint64_t* buf, size_t n) {
+        size_t i = 0;
+        uint32_t words[4];
+        while (i < n && index_ != 0) buf[i++] = next64();
+        for (; i + 2 <= n; i += 2) {
+            generate(block_++, words);
+            buf[i] = words[0] | ((uint64_t)words[1] << 32);
+            buf[i + 1] = words[2] | ((uint64_t)words[3] << 32);
+        }
+        while (i < n) buf[i++] = next64();
+    }
+
+    void fill(double* buf, size_t n) {
+        uint64_t bits[64];
+        for (size_t i = 0; i < n; i += 64) {
+            size_t len = n - i < 64 ? n - i : 64;
+            fill(bits, len);
+            for (size_t j = 0; j < len; j++)
+                buf[i + j] = (double)(bits[j] >> 11) * (1.0 / (double)(1ULL << 53));
+        }
+    }
+
+    /* The ten-round block function */
+    static void block(const uint32_t ctr[4], const uint32_t key[2], uint32_t out[4]) {
+        uint32_t c0 = ctr[0], c1 = ctr[1], c2 = ctr[2], c3 = ctr[3];
+        uint32_t k0 = key[0], k1 = key[1];
+        for (int round = 0; round < 10; round++) {
+            uint64_t p0 = (uint64_t)0xD2511F53 * c0;
+            uint64_t p1 = (uint64_t)0xCD9E8D57 * c2;
+            c0 = (uint32_t)(p1 >> 32) ^ c1 ^ k0;
+            c1 = (uint32_t)p1;
+            c2 = (uint32_t)(p0 >> 32) ^ c3 ^ k1;
+            c3 = (uint32_t)p0;
+            k0 += 0x9E3779B9;
+            k1 += 0xBB67AE85;
+        }
+        out[0] = c0; out[1] = c1; out[2] = c2; out[3] = c3;
+    }
+
+private:
+    void generate(uint64_t n, uint32_t out[4]) const {
+        uint32_t ctr[4] = { (uint32_t)n, (uint32_t)(n >> 32), (uint32_t)stream_, (uint32_t)(stream_ >> 32) };
+        block(ctr, key_, out);
+    }
+
+    uint32_t key_[2];
+    uint64_t stream_;
+    uint64_t block_;    // next block to generate
+    uint32_t index_;    // next value in out_, 0 when out_ is used up
+    uint32_t out_[4];
+};
+
+/*
+ * Philox4x32 behind the SST::RNG::Random interface, for components that
+ * hold a Random* and choose the generator from their parameters.
+ */
+class PhiloxRNG : public SST::RNG::Random {
+public:
+    PhiloxRNG(uint64_t key, uint64_t stream = 0) : gen_(key, stream), stream_(stream) { }
+
+    double nextUniform() { return gen_.nextDouble(); }
+    uint32_t generateNextUInt32() { return gen_.next32(); }
+    uint64_t generateNextUInt64() { return gen_.next64(); }
+    int32_t generateNextInt32() { return (int32_t)gen_.next32(); }
+    int64_t generateNextInt64() { return (int64_t)gen_.next64(); }
+    void seed(uint64_t newSeed) { gen_.setKey(newSeed, stream_); }
+
+    Philox4x32& generator() { return gen_; }
+
+private:
+    Philox4x32 gen_;
+    uint64_t stream_;
+};
+
+} //namespace ElementRNG
+} //namespace SST
+
+#endif
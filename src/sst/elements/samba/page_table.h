@@ -0,0 +1,167 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_SST_SAMBA_PAGE_TABLE
+#define _H_SST_SAMBA_PAGE_TABLE
+
+#include <stddef.h>
+#include <stdint.h>
+
+#include <unordered_map>
+
+namespace SST {
+namespace SambaComponent {
+
+    // This is a radix tree of 512-entry nodes, laid out like the x86-64 page table levels it models.
+    // A table covering key_bits bits of key has ceil(key_bits/9) levels, the last one holding the values
+    // and a presence bitmap. Keys wider than key_bits (e.g., virtual addresses above 48 bits) go to a
+    // small hash table instead, so any key works, but the common case is a few array lookups
+    template<typename T>
+    class RadixTable
+    {
+        static const int BITS = 9;
+        static const int FANOUT = 1 << BITS;
+        static const uint64_t MASK = FANOUT - 1;
+
+        struct Inner
+        {
+            void * child[FANOUT];
+        };
+
+        struct Leaf
+        {
+            T value[FANOUT];
+            uint64_t present[FANOUT/64];
+        };
+
+        int key_bits;
+        int levels; // number of levels, including the leaf level
+
+        void * root;
+
+        // The last leaf visited and the key bits above it, consecutive lookups mostly land on the same leaf
+        uint64_t last_key;
+        Leaf * last_leaf;
+
+        std::unordered_map<uint64_t, T> overflow;
+
+        bool inRange(uint64_t key) const { return key_bits >= 64 || (key >> key_bits) == 0; }
+
+        // Find the leaf covering key, allocating the missing nodes on the way if create is set
+        Leaf * findLeaf(uint64_t key, bool create)
+        {
+            if(last_leaf != NULL && last_key == (key >> BITS))
+                return last_leaf;
+
+            if(root == NULL)
+            {
+                if(!create)
+                    return NULL;
+                root = (levels == 1) ? (void *) new Leaf() : (void *) new Inner();
+            }
+
+            void * node = root;
+            for(int level = levels - 1; level > 0; level--)
+            {
+                void ** slot = &(((Inner *) node)->child[(key >> (level*BITS)) & MASK]);
+                if(*slot == NULL)
+                {
+                    if(!create)
+                        return NULL;
+                    *slot = (level == 1) ? (void *) new Leaf() : (void *) new Inner();
+                }
+                node = *slot;
+            }
+
+            last_key = key >> BITS;
+            last_leaf = (Leaf *) node;
+            return last_leaf;
+        }
+
+        void release(void * node, int level)
+        {
+            if(node == NULL)
+                return;
+
+            if(level == 0)
+            {
+                delete (Leaf *) node;
+                return;
+            }
+
+            for(int i = 0; i < FANOUT; i++)
+                release(((Inner *) node)->child[i], level - 1);
+
+            delete (Inner *) node;
+        }
+
+        RadixTable(const RadixTable &);
+        RadixTable & operator=(const RadixTable &);
+
+        public:
+
+        // By default a table covers 36 bits, i.e., the 4KB page numbers of a 48-bit virtual address space
+        explicit RadixTable(int Key_bits = 36)
+        {
+            key_bits = Key_bits;
+            levels = (key_bits + BITS - 1)/BITS;
+            if(levels < 1)
+                levels = 1;
+            root = NULL;
+            last_key = 0;
+            last_leaf = NULL;
+        }
+
+        ~RadixTable() { release(root, levels - 1); }
+
+        // Check if an entry exists for this key
+        bool contains(uint64_t key)
+        {
+            if(!inRange(key))
+                return overflow.find(key) != overflow.end();
+
+            Leaf * leaf = findLeaf(key, false);
+            return leaf != NULL && (leaf->present[(key & MASK)/64] >> (key % 64)) & 1;
+        }
+
+        // Access the entry for this key, creating it if missing (same as std::map)
+        T & operator[](uint64_t key)
+        {
+            if(!inRange(key))
+                return overflow[key];
+
+            Leaf * leaf = findLeaf(key, true);
+            leaf->present[(key & MASK)/64] |= ((uint64_t) 1) << (key % 64);
+            return leaf->value[key & MASK];
+        }
+
+        // Remove the entry for this key, the nodes are kept as page tables rarely shrink
+        void erase(uint64_t key)
+        {
+            if(!inRange(key))
+            {
+                overflow.erase(key);
+                return;
+            }
+
+            Leaf * leaf = findLeaf(key, false);
+            if(leaf == NULL)
+                return;
+
+            leaf->present[(key & MASK)/64] &= ~(((uint64_t) 1) << (key % 64));
+            leaf->value[key & MASK] = T();
+        }
+    };
+
+}
+}
+
+#endif
@@ -185,13 +185,13 @@ void PageTableWalker::handleEvent( SST::Event* e )
             //if((*CR3) == -1)
             if(!(*cr3_init))
                 fault_level = 4;
-            else if((*PGD).find(temp_ptr->getAddress()/page_size[3]) == (*PGD).end())
+            else if(!(*PGD).contains(temp_ptr->getAddress()/page_size[3]))
                 fault_level = 3;
-            else if((*PUD).find(temp_ptr->getAddress()/page_size[2]) == (*PUD).end())
+            else if(!(*PUD).contains(temp_ptr->getAddress()/page_size[2]))
                 fault_level = 2;
-            else if((*PMD).find(temp_ptr->getAddress()/page_size[1]) == (*PMD).end())
+            else if(!(*PMD).contains(temp_ptr->getAddress()/page_size[1]))
                 fault_level = 1;
-            else if((*PTE).find(temp_ptr->getAddress()/page_size[0]) == (*PTE).end())
+            else if(!(*PTE).contains(temp_ptr->getAddress()/page_size[0]))
                 fault_level = 0;
             else
                 output->fatal(CALL_INFO, -1, "MMU: DANGER!!\n");
@@ -200,10 +200,10 @@ void PageTableWalker::handleEvent( SST::Event* e )
         {
             uint64_t offset = (uint64_t)512*512*512*512;
             if(!(*cr3_init)) fault_level = 4;
-            else if((*PGD).find((temp_ptr->getAddress()/page_size[3])%512) == (*PGD).end()) fault_level = 3;
-            else if((*PUD).find((temp_ptr->getAddress()/page_size[2])%(512*512)) == (*PUD).end()) fault_level = 2;
-            else if((*PMD).find((temp_ptr->getAddress()/page_size[1])%(512*512*512)) == (*PMD).end()) fault_level = 1;
-            else if((*PTE).find((temp_ptr->getAddress()/page_size[0])%offset) == (*PTE).end()) fault_level = 0;
+            else if(!(*PGD).contains((temp_ptr->getAddress()/page_size[3])%512)) fault_level = 3;
+            else if(!(*PUD).contains((temp_ptr->getAddress()/page_size[2])%(512*512))) fault_level = 2;
+            else if(!(*PMD).contains((temp_ptr->getAddress()/page_size[1])%(512*512*512))) fault_level = 1;
+            else if(!(*PTE).contains((temp_ptr->getAddress()/page_size[0])%offset)) fault_level = 0;
             else output->fatal(CALL_INFO, -1, "MMU: DANGER!!\n");
         }
 
@@ -238,7 +238,7 @@ void PageTableWalker::handleEvent( SST::Event* e )
                 (*PGD)[stall_addr/page_size[3]] = temp_ptr->getPaddress();
             else
             {
-                if((*PGD).find((stall_addr/page_size[3])%512) != (*PGD).end())
+                if((*PGD).contains((stall_addr/page_size[3])%512))
                     output->fatal(CALL_INFO, -1, "MMU: PTW DANGER.. same PGD!!\n");
                 (*PGD)[(stall_addr/page_size[3])%512] = temp_ptr->getPaddress();
                 (*PENDING_PAGE_FAULTS_PGD).erase((stall_addr/page_size[3])%(512));
@@ -253,7 +253,7 @@ void PageTableWalker::handleEvent( SST::Event* e )
                 (*PUD)[stall_addr/page_size[2]] = temp_ptr->getPaddress();
             else
             {
-                if((*PUD).find((stall_addr/page_size[2])%(512*512)) != (*PUD).end())
+                if((*PUD).contains((stall_addr/page_size[2])%(512*512)))
                     output->fatal(CALL_INFO, -1, "MMU: PTW DANGER.. same PUD!!\n");
                 (*PUD)[(stall_addr/page_size[2])%(512*512)] = temp_ptr->getPaddress();
                 (*PENDING_PAGE_FAULTS_PUD).erase((stall_addr/page_size[2])%(512*512));
@@ -279,7 +279,7 @@ void PageTableWalker::handleEvent( SST::Event* e )
             else
             {
                 uint64_t offset = 512*512*512;
-                if((*PMD).find((stall_addr/page_size[1])%offset) != (*PMD).end())
+                if((*PMD).contains((stall_addr/page_size[1])%offset))
                     output->fatal(CALL_INFO, -1, "MMU: PTW DANGER.. same PMD!!\n");
                 (*PMD)[(stall_addr/page_size[1])%offset] = temp_ptr->getPaddress();
                 (*PENDING_PAGE_FAULTS_PMD).erase((stall_addr/page_size[1])%offset);
@@ -304,7 +304,7 @@ void PageTableWalker::handleEvent( SST::Event* e )
             else
             {
                 uint64_t offset = (uint64_t)512*512*512*512;
-                if((*PTE).find((stall_addr/page_size[0])%offset) != (*PTE).end())
+                if((*PTE).contains((stall_addr/page_size[0])%offset))
                     output->fatal(CALL_INFO, -1, "MMU: PTW DANGER.. same PTE!!\n");
                 (*PTE)[(stall_addr/page_size[0])%offset] = temp_ptr->getPaddress();
             }
@@ -359,28 +359,33 @@ void PageTableWalker::recvResp(SST::Event * event)
     MemEvent * ev = static_cast<MemEvent*>(event);
 
 
-    long long int pw_id;
+    // The walk this response belongs to
+    std::unordered_map<id_type, long long int, MemEventIdHash>::iterator req;
     if(!self_connected)
-        pw_id = MEM_REQ[ev->getResponseToID()];
+        req = MEM_REQ.find(ev->getResponseToID());
     else
-        pw_id = MEM_REQ[ev->getID()];
+        req = MEM_REQ.find(ev->getID());
 
-    //WID_Add[] is virtual address, WSR_PT_LEVEL[] is level of page table
-    insert_way(WID_Add[pw_id], find_victim_way(WID_Add[pw_id], WSR_PT_LEVEL[pw_id]), WSR_PT_LEVEL[pw_id]);
+    if(req == MEM_REQ.end())
+        output->fatal(CALL_INFO, -1, "MMU: PTW response for an unknown page walk\n");
 
-    Address_t addr = WID_Add[pw_id];
+    long long int pw_id = req->second;
+    PageWalk & walk = WALKS[pw_id];
 
-    WSR_READY[pw_id]=true;
+    // walk.vaddr is virtual address, walk.level is level of page table
+    insert_way(walk.vaddr, find_victim_way(walk.vaddr, walk.level), walk.level);
+
+    Address_t addr = walk.vaddr;
 
     // Avoiding memory leak by deleting the newly generated dummy requests
-    MEM_REQ.erase(ev->getID());
+    MEM_REQ.erase(req);
     delete ev;
 
-    if(WSR_PT_LEVEL[pw_id]==0)
+    if(walk.level==0)
     {
-        ready_by[WID_EV[pw_id]] =  currTime + latency + 2*upper_link_latency;
+        ready_by[walk.ev] = ReadyTranslation(currTime + latency + 2*upper_link_latency, os_page_size); // FIXME: The size is hardcoded for now assuming the OS maps virtual pages to 4KB pages only
 
-        ready_by_size[WID_EV[pw_id]] = os_page_size; // FIXME: This hardcoded for now assuming the OS maps virtual pages to 4KB pages only
+        WALKS.erase(pw_id);
     }
     else
     {
@@ -394,28 +399,28 @@ void PageTableWalker::recvResp(SST::Event * event)
             if(!ptw_confined)
             {
                 Address_t page_table_start = 0;
-                if(WSR_PT_LEVEL[pw_id]==4)
+                if(walk.level==4)
                     page_table_start = (*PGD)[addr/page_size[3]];
-                else if(WSR_PT_LEVEL[pw_id]==3)
+                else if(walk.level==3)
                     page_table_start = (*PUD) [addr/page_size[2]];
-                else if(WSR_PT_LEVEL[pw_id]==2)
+                else if(walk.level==2)
                     page_table_start = (*PMD) [addr/page_size[1]];
-                else if (WSR_PT_LEVEL[pw_id] == 1)
+                else if (walk.level == 1)
                     page_table_start = (*PTE) [addr/page_size[0]];
 
-                dummy_add = page_table_start + (addr/page_size[WSR_PT_LEVEL[pw_id]-1])%512;
+                dummy_add = page_table_start + (addr/page_size[walk.level-1])%512;
             }
             else
             {
-                if(WSR_PT_LEVEL[pw_id]==4) {
+                if(walk.level==4) {
                     dummy_add = (*CR3) + ((addr/page_size[3])%512)*8;
                 }
-                else if(WSR_PT_LEVEL[pw_id]==3) {
+                else if(walk.level==3) {
                     dummy_add = (*PGD)[(addr/page_size[3])%512] + ((addr/page_size[2])%512)*8;
                 }
-                else if(WSR_PT_LEVEL[pw_id]==2) {
+                else if(walk.level==2) {
                     dummy_add = (*PUD)[(addr/page_size[2])%(512*512)] + ((addr/page_size[1])%512)*8;}
-                else if(WSR_PT_LEVEL[pw_id]==1) {
+                else if(walk.level==1) {
                     uint64_t offset = (uint64_t)512*512*512;
                     dummy_add = (*PMD)[(addr/page_size[1])%offset] + ((addr/page_size[0])%512)*8;
                 }
@@ -427,7 +432,7 @@ void PageTableWalker::recvResp(SST::Event * event)
         MemEvent *e = new MemEvent(getName(), dummy_add, dummy_base_add, Command::GetS);
         e->setVirtualAddress(addr);
 
-        WSR_PT_LEVEL[pw_id]--;
+        walk.level--;
         MEM_REQ[e->getID()]=pw_id;
         to_mem->send(e);
 
@@ -447,7 +452,7 @@ bool PageTableWalker::tick(SST::Cycle_t x)
         if(!ptw_confined)
         {
             //std::cout<< getName().c_str() << " Core: " << coreId << " stalled with stall address: " << stall_addr << std::endl;
-            if((*PENDING_PAGE_FAULTS).find(stall_addr/page_size[0])==(*PENDING_PAGE_FAULTS).end()) {
+            if(!(*PENDING_PAGE_FAULTS).contains(stall_addr/page_size[0])) {
                 stall = false;
                 *hold = 0;
             }
@@ -459,10 +464,10 @@ bool PageTableWalker::tick(SST::Cycle_t x)
             switch(stall_at_levels) {
             case 4:
             {
-                if((*PENDING_PAGE_FAULTS_PGD).find((stall_addr/page_size[3])%(512))==(*PENDING_PAGE_FAULTS_PGD).end() &&
-                    (*PENDING_PAGE_FAULTS_PUD).find((stall_addr/page_size[2])%(512*512))==(*PENDING_PAGE_FAULTS_PUD).end() &&
-                    (*PENDING_PAGE_FAULTS_PMD).find((stall_addr/page_size[1])%(512*512*512))==(*PENDING_PAGE_FAULTS_PMD).end() &&
-                    (*PENDING_PAGE_FAULTS_PTE).find((stall_addr/page_size[0])%(offset))==(*PENDING_PAGE_FAULTS_PTE).end())
+                if(!(*PENDING_PAGE_FAULTS_PGD).contains((stall_addr/page_size[3])%(512)) &&
+                    !(*PENDING_PAGE_FAULTS_PUD).contains((stall_addr/page_size[2])%(512*512)) &&
+                    !(*PENDING_PAGE_FAULTS_PMD).contains((stall_addr/page_size[1])%(512*512*512)) &&
+                    !(*PENDING_PAGE_FAULTS_PTE).contains((stall_addr/page_size[0])%(offset)))
                 {
                     release = 1;
                 }
@@ -471,9 +476,9 @@ bool PageTableWalker::tick(SST::Cycle_t x)
                 break;
             case 3:
             {
-                if((*PENDING_PAGE_FAULTS_PUD).find((stall_addr/page_size[2])%(512*512))==(*PENDING_PAGE_FAULTS_PUD).end() &&
-                    (*PENDING_PAGE_FAULTS_PMD).find((stall_addr/page_size[1])%(512*512*512))==(*PENDING_PAGE_FAULTS_PMD).end() &&
-                    (*PENDING_PAGE_FAULTS_PTE).find((stall_addr/page_size[0])%(offset))==(*PENDING_PAGE_FAULTS_PTE).end())
+                if(!(*PENDING_PAGE_FAULTS_PUD).contains((stall_addr/page_size[2])%(512*512)) &&
+                    !(*PENDING_PAGE_FAULTS_PMD).contains((stall_addr/page_size[1])%(512*512*512)) &&
+                    !(*PENDING_PAGE_FAULTS_PTE).contains((stall_addr/page_size[0])%(offset)))
                 {
                     release = 1;
                 }
@@ -481,8 +486,8 @@ bool PageTableWalker::tick(SST::Cycle_t x)
                 break;
             case 2:
             {
-                if((*PENDING_PAGE_FAULTS_PMD).find((stall_addr/page_size[1])%(512*512*512))==(*PENDING_PAGE_FAULTS_PMD).end() &&
-                    (*PENDING_PAGE_FAULTS_PTE).find((stall_addr/page_size[0])%(offset))==(*PENDING_PAGE_FAULTS_PTE).end())
+                if(!(*PENDING_PAGE_FAULTS_PMD).contains((stall_addr/page_size[1])%(512*512*512)) &&
+                    !(*PENDING_PAGE_FAULTS_PTE).contains((stall_addr/page_size[0])%(offset)))
                 {
                     release = 1;
                 }
@@ -490,10 +495,10 @@ bool PageTableWalker::tick(SST::Cycle_t x)
                 break;
             case 1:
             {
-                if(stall_at_PGD) {if((*PENDING_PAGE_FAULTS_PGD).find((stall_addr/page_size[3])%(512))==(*PENDING_PAGE_FAULTS_PGD).end()) release = 1;}
-                else if(stall_at_PUD) {if((*PENDING_PAGE_FAULTS_PUD).find((stall_addr/page_size[2])%(512*512))==(*PENDING_PAGE_FAULTS_PUD).end()) release = 1;}
-                else if(stall_at_PMD) {if((*PENDING_PAGE_FAULTS_PMD).find((stall_addr/page_size[1])%(512*512*512))==(*PENDING_PAGE_FAULTS_PMD).end()) release = 1;}
-                else if(stall_at_PTE) {if((*PENDING_PAGE_FAULTS_PTE).find((stall_addr/page_size[0])%(offset))==(*PENDING_PAGE_FAULTS_PTE).end()) release = 1;}
+                if(stall_at_PGD) {if(!(*PENDING_PAGE_FAULTS_PGD).contains((stall_addr/page_size[3])%(512))) release = 1;}
+                else if(stall_at_PUD) {if(!(*PENDING_PAGE_FAULTS_PUD).contains((stall_addr/page_size[2])%(512*512))) release = 1;}
+                else if(stall_at_PMD) {if(!(*PENDING_PAGE_FAULTS_PMD).contains((stall_addr/page_size[1])%(512*512*512))) release = 1;}
+                else if(stall_at_PTE) {if(!(*PENDING_PAGE_FAULTS_PTE).contains((stall_addr/page_size[0])%(offset))) release = 1;}
                 else output->fatal(CALL_INFO, -1, "MMU: PTW DANGER!!.. stall at level not recognized..\n");
             }
                 break;
@@ -535,13 +540,13 @@ bool PageTableWalker::tick(SST::Cycle_t x)
             bool fault = true;
             if(!ptw_confined)
             {
-                if((*MAPPED_PAGE_SIZE4KB).find(addr/page_size[0])!=(*MAPPED_PAGE_SIZE4KB).end() || (*MAPPED_PAGE_SIZE2MB).find(addr/page_size[1])!=(*MAPPED_PAGE_SIZE2MB).end() || (*MAPPED_PAGE_SIZE1GB).find(addr/page_size[2])!=(*MAPPED_PAGE_SIZE1GB).end())
+                if((*MAPPED_PAGE_SIZE4KB).contains(addr/page_size[0]) || (*MAPPED_PAGE_SIZE2MB).contains(addr/page_size[1]) || (*MAPPED_PAGE_SIZE1GB).contains(addr/page_size[2]))
                     fault = false;
 
                 if(fault)
                 {
                     stall_addr = addr;
-                    if((*PENDING_PAGE_FAULTS).find(addr/page_size[0])==(*PENDING_PAGE_FAULTS).end()) {
+                    if(!(*PENDING_PAGE_FAULTS).contains(addr/page_size[0])) {
                         (*PENDING_PAGE_FAULTS)[addr/page_size[0]] = 0;
                         SambaEvent * tse = new SambaEvent(EventType::PAGE_FAULT);
                         //std::cout<< getName().c_str() << " Core id: " << coreId << " Fault at address "<<addr<<std::endl;
@@ -559,20 +564,20 @@ bool PageTableWalker::tick(SST::Cycle_t x)
             else
             {
                 uint64_t offset = (uint64_t)512*512*512*512;
-                if((*MAPPED_PAGE_SIZE4KB).find((addr/page_size[0])%offset)!=(*MAPPED_PAGE_SIZE4KB).end() || (*MAPPED_PAGE_SIZE2MB).find((addr/page_size[1])%(512*512*512))!=(*MAPPED_PAGE_SIZE2MB).end() || (*MAPPED_PAGE_SIZE1GB).find((addr/page_size[2])%(512*512))!=(*MAPPED_PAGE_SIZE1GB).end())
+                if((*MAPPED_PAGE_SIZE4KB).contains((addr/page_size[0])%offset) || (*MAPPED_PAGE_SIZE2MB).contains((addr/page_size[1])%(512*512*512)) || (*MAPPED_PAGE_SIZE1GB).contains((addr/page_size[2])%(512*512)))
                     fault = false;
 
                 if(fault)
                 {
                     stall_addr = addr;
                     if(to_mem!=NULL) {
-                    if((*PGD).find((addr/page_size[3])%512) == (*PGD).end()) {
+                    if(!(*PGD).contains((addr/page_size[3])%512)) {
                         stall_at_levels = 1;
                         stall_at_PGD = 1;
                         stall_at_PUD = 0;
                         stall_at_PMD = 0;
                         stall_at_PTE = 0;
-                        if((*PENDING_PAGE_FAULTS_PGD).find((addr/page_size[3])%(512))==(*PENDING_PAGE_FAULTS_PGD).end()) {
+                        if(!(*PENDING_PAGE_FAULTS_PGD).contains((addr/page_size[3])%(512))) {
                             (*PENDING_PAGE_FAULTS_PGD)[(addr/page_size[3])%512] = 0;
                             (*PENDING_PAGE_FAULTS_PUD)[(addr/page_size[2])%(512*512)] = 0;
                             (*PENDING_PAGE_FAULTS_PMD)[(addr/page_size[1])%(512*512*512)] = 0;
@@ -586,13 +591,13 @@ bool PageTableWalker::tick(SST::Cycle_t x)
                             return false;
                         }
                     }
-                    else if((*PUD).find((addr/page_size[2])%(512*512)) == (*PUD).end()) {
+                    else if(!(*PUD).contains((addr/page_size[2])%(512*512))) {
                         stall_at_levels = 1;
                         stall_at_PGD = 0;
                         stall_at_PUD = 1;
                         stall_at_PMD = 0;
                         stall_at_PTE = 0;
-                        if((*PENDING_PAGE_FAULTS_PUD).find((addr/page_size[2])%(512*512))==(*PENDING_PAGE_FAULTS_PUD).end()) {
+                        if(!(*PENDING_PAGE_FAULTS_PUD).contains((addr/page_size[2])%(512*512))) {
                             (*PENDING_PAGE_FAULTS_PUD)[(addr/page_size[2])%(512*512)] = 0;
                             (*PENDING_PAGE_FAULTS_PMD)[(addr/page_size[1])%(512*512*512)] = 0;
                             (*PENDING_PAGE_FAULTS_PTE)[(addr/page_size[0])%(offset)] = 0;
@@ -605,13 +610,13 @@ bool PageTableWalker::tick(SST::Cycle_t x)
                             return false;
                         }
                     }
-                    else if((*PMD).find((addr/page_size[1])%(512*512*512)) == (*PMD).end()) {
+                    else if(!(*PMD).contains((addr/page_size[1])%(512*512*512))) {
                         stall_at_levels = 1;
                         stall_at_PGD = 0;
                         stall_at_PUD = 0;
                         stall_at_PMD = 1;
                         stall_at_PTE = 0;
-                        if((*PENDING_PAGE_FAULTS_PMD).find((addr/page_size[1])%(512*512*512))==(*PENDING_PAGE_FAULTS_PMD).end()) {
+                        if(!(*PENDING_PAGE_FAULTS_PMD).contains((addr/page_size[1])%(512*512*512))) {
                             (*PENDING_PAGE_FAULTS_PMD)[(addr/page_size[1])%(512*512*512)] = 0;
                             (*PENDING_PAGE_FAULTS_PTE)[(addr/page_size[0])%(offset)] = 0;
                             stall_at_levels += 1;
@@ -623,13 +628,13 @@ bool PageTableWalker::tick(SST::Cycle_t x)
                             return false;
                         }
                     }
-                    else if((*PTE).find((addr/page_size[0])%(offset)) == (*PTE).end()) {
+                    else if(!(*PTE).contains((addr/page_size[0])%(offset))) {
                         stall_at_levels = 1;
                         stall_at_PGD = 0;
                         stall_at_PUD = 0;
                         stall_at_PMD = 0;
                         stall_at_PTE = 1;
-                        if((*PENDING_PAGE_FAULTS_PTE).find((addr/page_size[0])%(offset))==(*PENDING_PAGE_FAULTS_PTE).end()) {
+                        if(!(*PENDING_PAGE_FAULTS_PTE).contains((addr/page_size[0])%(offset))) {
                             (*PENDING_PAGE_FAULTS_PTE)[(addr/page_size[0])%(offset)] = 0;
                             SambaEvent * tse = new SambaEvent(EventType::PAGE_FAULT);
                             tse->setResp(addr,0,4096);
@@ -649,7 +654,7 @@ bool PageTableWalker::tick(SST::Cycle_t x)
                         stall_at_PUD = 0;
                         stall_at_PMD = 0;
                         stall_at_PTE = 1;
-                        if((*PENDING_PAGE_FAULTS_PTE).find((addr/page_size[0])%(offset))==(*PENDING_PAGE_FAULTS_PTE).end()) {
+                        if(!(*PENDING_PAGE_FAULTS_PTE).contains((addr/page_size[0])%(offset))) {
                             (*PENDING_PAGE_FAULTS_PTE)[(addr/page_size[0])%(offset)] = 0;
                             SambaEvent * tse = new SambaEvent(EventType::PAGE_FAULT);
                             tse->setResp(addr,0,4096);
@@ -685,13 +690,11 @@ bool PageTableWalker::tick(SST::Cycle_t x)
             update_lru(addr, hit_id);
             hits++;
             statPageTableWalkerHits->addData(1);
+            // Tracking the hit request size
             if(parallel_mode)
-                ready_by[ev] = x;
+                ready_by[ev] = ReadyTranslation(x, os_page_size); //page_size[hit_id]/1024;
             else
-                ready_by[ev] = x + latency;
-
-            // Tracking the hit request size
-            ready_by_size[ev] = os_page_size; //page_size[hit_id]/1024;
+                ready_by[ev] = ReadyTranslation(x + latency, os_page_size);
 
             st_1 = not_serviced.erase(st_1);
         }
@@ -715,7 +718,8 @@ bool PageTableWalker::tick(SST::Cycle_t x)
                 if(to_mem!=nullptr)
                 {
 
-                    WID_EV[++mmu_id] = (*st_1);
+                    PageWalk & walk = WALKS[++mmu_id];
+                    walk.ev = (*st_1);
 
                     Address_t dummy_add = rand()%10000000;
 
@@ -747,12 +751,10 @@ bool PageTableWalker::tick(SST::Cycle_t x)
                     Address_t dummy_base_add = dummy_add & ~(line_size - 1);
                     MemEvent *e = new MemEvent(getName(), dummy_add, dummy_base_add, Command::GetS);
 
-                    // Record this walk request into WSR_ and WID_ structs
-                    WSR_PT_LEVEL[mmu_id] = k-1;
-                    //		WID_EV[mmu_id] = e;
-                    WID_Add[mmu_id] = addr;
+                    // Record this walk request into WALKS
+                    walk.level = k-1;
+                    walk.vaddr = addr;
                     e->setVirtualAddress(addr);
-                    WSR_READY[mmu_id] = false;
 
                     // Add it to the tracking structure
                     MEM_REQ[e->getID()]=mmu_id;
@@ -771,9 +773,8 @@ bool PageTableWalker::tick(SST::Cycle_t x)
                     // JVOROBY: We don't actually have a memory link, so instead just wait for an appropriate latency
 
 
-                    ready_by[ev] = x + latency + 2*upper_link_latency + page_walk_latency;  // the upper link latency is substituted for sending the miss request and reciving it, Note this is hard coded for the last-level as memory access walk latency, this ****definitely**** needs to change
-
-                    ready_by_size[ev] = os_page_size; // FIXME: This hardcoded for now assuming the OS maps virtual pages to 4KB pages only
+                    // the upper link latency is substituted for sending the miss request and reciving it, Note this is hard coded for the last-level as memory access walk latency, this ****definitely**** needs to change
+                    ready_by[ev] = ReadyTranslation(x + latency + 2*upper_link_latency + page_walk_latency, os_page_size); // FIXME: The size is hardcoded for now assuming the OS maps virtual pages to 4KB pages only
 
                     st_1 = not_serviced.erase(st_1);
                 }
@@ -788,15 +789,13 @@ bool PageTableWalker::tick(SST::Cycle_t x)
     }
 
 
-    std::map<MemHierarchy::MemEventBase *, SST::Cycle_t, MemEventPtrCompare>::iterator st, en;
+    std::map<MemHierarchy::MemEventBase *, ReadyTranslation, MemEventPtrCompare>::iterator st;
     st = ready_by.begin();
-    en = ready_by.end();
 
-    while(st!=en)
+    while(st!=ready_by.end())
     {
 
-        bool deleted=false;
-        if(st->second <= x) // if this event is ready
+        if(st->second.ready <= x) // if this event is ready
         {
 
             Address_t addr = ((MemEvent*) st->first)->getVirtualAddress();
@@ -812,14 +811,14 @@ bool PageTableWalker::tick(SST::Cycle_t x)
                 update_lru(addr, 0);
 
 
-            service_back->push_back(st->first);
+            service_back->push_back(TranslationRequest(st->first, st->second.size));
 
 
             if(emulate_faults)
             {
                 if(!ptw_confined)
                 {
-                    if((*PTE).find(addr/4096)==(*PTE).end())
+                    if(!(*PTE).contains(addr/4096))
                     {
                         std::cout << "******* Major issue is in Page Table Walker **** " << std::endl;
                         std::cout << "The address is "<< hex << addr << " (" << addr / 4096 << ")" << std::endl;
@@ -828,7 +827,7 @@ bool PageTableWalker::tick(SST::Cycle_t x)
                 else
                 {
                     uint64_t offset = (uint64_t)512*512*512*512;
-                    if((*PTE).find((addr/4096)%offset)==(*PTE).end())
+                    if(!(*PTE).contains((addr/4096)%offset))
                     {
                         std::cout << "******* Major issue is in Page Table Walker **** " << std::endl;
                         std::cout << "The address is "<< hex << addr << " (" << addr / 4096 << ")" << std::endl;
@@ -836,16 +835,6 @@ bool PageTableWalker::tick(SST::Cycle_t x)
                 }
             }
 
-            (*service_back_size)[st->first]=ready_by_size[st->first];
-
-
-            ready_by_size.erase(st->first);
-
-
-
-
-            deleted = true;
-
 
             // Deleting it from pending requests
             std::vector<MemHierarchy::MemEventBase *>::iterator st2, en2;
@@ -863,11 +852,10 @@ bool PageTableWalker::tick(SST::Cycle_t x)
                 st2++;
             }
 
-            ready_by.erase(st);
+            // The requests before this one were not ready, so carry on from the next one
+            st = ready_by.erase(st);
 
         }
-        if(deleted)
-            st=ready_by.begin();
         else
             st++;
 
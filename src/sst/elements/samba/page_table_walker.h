@@ -24,8 +24,10 @@
 
 #include <map>
 #include <vector>
+#include <unordered_map>
 
 #include "utils.h"
+#include "page_table.h"
 #include "page_fault_handler.h"
 
 // This file defines the page table walker
@@ -106,21 +108,21 @@ class PageTableWalker : public ComponentExtension
 
     // Holds the PGD, PUD, PMT, PTE physical pointers
     // PTE should give you the exact physical address of the page
-    std::map<Address_t, Address_t> * PGD; // key is 9 bits 39-47, i.e., VA/(4096*512*512*512)
-    std::map<Address_t, Address_t> * PUD; // key is 9 bits 30-38, i.e., VA/(4096*512*512)
-    std::map<Address_t, Address_t> * PMD; // key is 9 bits 21-29, i.e., VA/(4096*512)
-    std::map<Address_t, Address_t> * PTE; // key is 9 bits 12-20, i.e., VA/(4096)
+    RadixTable<Address_t> * PGD; // key is 9 bits 39-47, i.e., VA/(4096*512*512*512)
+    RadixTable<Address_t> * PUD; // key is 9 bits 30-38, i.e., VA/(4096*512*512)
+    RadixTable<Address_t> * PMD; // key is 9 bits 21-29, i.e., VA/(4096*512)
+    RadixTable<Address_t> * PTE; // key is 9 bits 12-20, i.e., VA/(4096)
 
     // The structures below are used to quickly check if the page is mapped or not
-    std::map<Address_t,int> * MAPPED_PAGE_SIZE4KB;
-    std::map<Address_t,int> * MAPPED_PAGE_SIZE2MB;
-    std::map<Address_t,int> * MAPPED_PAGE_SIZE1GB;
+    RadixTable<int> * MAPPED_PAGE_SIZE4KB;
+    RadixTable<int> * MAPPED_PAGE_SIZE2MB;
+    RadixTable<int> * MAPPED_PAGE_SIZE1GB;
 
-    std::map<Address_t,int> *PENDING_PAGE_FAULTS;
-    std::map<Address_t,int> *PENDING_PAGE_FAULTS_PGD;
-    std::map<Address_t,int> *PENDING_PAGE_FAULTS_PUD;
-    std::map<Address_t,int> *PENDING_PAGE_FAULTS_PMD;
-    std::map<Address_t,int> *PENDING_PAGE_FAULTS_PTE;
+    RadixTable<int> *PENDING_PAGE_FAULTS;
+    RadixTable<int> *PENDING_PAGE_FAULTS_PGD;
+    RadixTable<int> *PENDING_PAGE_FAULTS_PUD;
+    RadixTable<int> *PENDING_PAGE_FAULTS_PMD;
+    RadixTable<int> *PENDING_PAGE_FAULTS_PTE;
 
     // This link is used to send internal events within the page table walker
     SST::Link * s_EventChan;
@@ -137,12 +139,10 @@ class PageTableWalker : public ComponentExtension
 
     // === Holds incoming requests, "input queue"
     std::vector<MemHierarchy::MemEventBase *> not_serviced;
-    std::vector<MemHierarchy::MemEventBase *> * service_back; // This is used to pass ready requests back to the previous level
-    std::map<MemHierarchy::MemEventBase *, long long int, MemEventPtrCompare> * service_back_size; // This is used to pass the size of the  requests back to the previous level
+    std::vector<TranslationRequest> * service_back; // This is used to pass ready requests and their sizes back to the previous level
 
     // === Holds requests that have gotten the data they need, but we need to wait the duration of the latency before returning
-    std::map<MemHierarchy::MemEventBase *, SST::Cycle_t, MemEventPtrCompare> ready_by;
-    std::map<MemHierarchy::MemEventBase *, long long int, MemEventPtrCompare> ready_by_size; // keeps track of requests' sizes inside this structure
+    std::map<MemHierarchy::MemEventBase *, ReadyTranslation, MemEventPtrCompare> ready_by; // ready cycle and size of each request
     std::vector<MemHierarchy::MemEventBase *> pending_misses; // This the number of pending misses, only erased when pushed back from next level
 
     SST::Cycle_t currTime;
@@ -156,9 +156,9 @@ class PageTableWalker : public ComponentExtension
     PageTableWalker(ComponentId_t id, int page_size, int assoc, PageTableWalker * next_level, int size);
     PageTableWalker(ComponentId_t id, int tlb_id, PageTableWalker * Next_level,int level, SST::Params& params);
 
-    void setPageTablePointers( Address_t * cr3, std::map<Address_t, Address_t> * pgd,  std::map<Address_t, Address_t> * pud,  std::map<Address_t, Address_t> * pmd, std::map<Address_t, Address_t> * pte,
-            std::map<Address_t,int> * gb,  std::map<Address_t,int> * mb,  std::map<Address_t,int> * kb, std::map<Address_t,int> * pr, int *cr3I, std::map<Address_t,int> *pf_pgd,  std::map<Address_t,int> *pf_pud,
-            std::map<Address_t,int> *pf_pmd, std::map<Address_t,int> * pf_pte)
+    void setPageTablePointers( Address_t * cr3, RadixTable<Address_t> * pgd,  RadixTable<Address_t> * pud,  RadixTable<Address_t> * pmd, RadixTable<Address_t> * pte,
+            RadixTable<int> * gb,  RadixTable<int> * mb,  RadixTable<int> * kb, RadixTable<int> * pr, int *cr3I, RadixTable<int> *pf_pgd,  RadixTable<int> *pf_pud,
+            RadixTable<int> *pf_pmd, RadixTable<int> * pf_pte)
     {
         CR3 = cr3;
         PGD = pgd;
@@ -201,7 +201,7 @@ class PageTableWalker : public ComponentExtension
     // ====== Wire-up methods
     // (for parent obj to set out pointers to their versions of the objects)
 
-    void setServiceBack( std::vector<MemHierarchy::MemEventBase *> * x) { service_back = x;}
+    void setServiceBack( std::vector<TranslationRequest> * x) { service_back = x;}
     void setHold(int * tmp) { hold = tmp; }
     void setShootDownEvents(int * sd, int *iva, std::vector<std::pair<Address_t, int> > * x)
             { shootdown = sd; hasInvalidAddrs = iva; invalid_addrs = x;}
@@ -223,8 +223,6 @@ class PageTableWalker : public ComponentExtension
 
     bool recvPageFaultResp(PageFaultHandler::PageFaultHandlerPacket pkt);
 
-    void setServiceBackSize( std::map<MemHierarchy::MemEventBase *, long long int, MemEventPtrCompare> * x) { service_back_size = x;}
-
 
     //==== JVOROBY: these appear to be unused? There's no lower-level TLB below the PTW, so noone to push-back to us
     //std::vector<MemHierarchy::MemEventBase *> * getPushedBack(){return & pushed_back;}
@@ -236,19 +234,22 @@ class PageTableWalker : public ComponentExtension
     // which
     //
 
-    //Autoincrementing ID, used to index events held in the `WSR_` and `WID_` maps
+    //Autoincrementing ID, used to index the walks held in `WALKS`
     long long int mmu_id=0;
 
     // For a given page-walk memory request:
-    std::map<long long int, int> WSR_PT_LEVEL; // what level of the PT does it refer to (0 = PTE, 3 = PGD)
-    std::map<long long int, bool> WSR_READY;
+    struct PageWalk {
+        int level; // what level of the PT does it refer to (0 = PTE, 3 = PGD)
+        Address_t vaddr; // the virtual address being translated
+        MemHierarchy::MemEventBase * ev; // the translation request that started the walk
+    };
 
-    std::map<long long int, Address_t> WID_Add;
-    std::map<long long int, MemHierarchy::MemEventBase*> WID_EV;
+    // The walks in flight, erased once the leaf level returns
+    std::unordered_map<long long int, PageWalk> WALKS;
 
     // Each Walk request generates a MemEvent that is sent out;
-    // This maps `memevent->getID()` to the corresponding `mmu_id`  used in the WSR_ and WID_ objects
-    std::map<id_type, long long int> MEM_REQ;
+    // This maps `memevent->getID()` to the corresponding `mmu_id`  used in `WALKS`
+    std::unordered_map<id_type, long long int, MemEventIdHash> MEM_REQ;
 
     //=== Etc
     Statistic<uint64_t>* statPageTableWalkerHits;
@@ -263,6 +264,9 @@ class PageTableWalker : public ComponentExtension
     void push_request(MemHierarchy::MemEventBase * x) {not_serviced.push_back(x);}
     bool tick(SST::Cycle_t x);
 
+    // True when no request is queued or being walked and no page fault is being serviced
+    bool isIdle() { return not_serviced.empty() && ready_by.empty() && pending_misses.empty() && WALKS.empty() && !stall; }
+
 };
 
 } // namespace SambaComponent
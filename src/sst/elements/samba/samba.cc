@@ -24,7 +24,11 @@ using namespace SST::SambaComponent;
 
 // Here we do the initialization of the Samba units of the system, connecting them to the cores and instantiating TLB hierachy objects for each one
 
-Samba::Samba(SST::ComponentId_t id, SST::Params& params): Component(id) {
+Samba::Samba(SST::ComponentId_t id, SST::Params& params): Component(id),
+    // Each table is keyed on the virtual address bits above its level, 9 bits per level of a 48-bit address space
+    PGD(9), PUD(18), PMD(27), PTE(36),
+    MAPPED_PAGE_SIZE4KB(36), MAPPED_PAGE_SIZE2MB(27), MAPPED_PAGE_SIZE1GB(18),
+    PENDING_PAGE_FAULTS(36), PENDING_PAGE_FAULTS_PGD(9), PENDING_PAGE_FAULTS_PUD(18), PENDING_PAGE_FAULTS_PMD(27), PENDING_PAGE_FAULTS_PTE(36) {
 
     int verbosity = params.find<int>("verbose", 0);
     output = new SST::Output("SambaComponent[@f:@l:@p] ", verbosity, 0, SST::Output::STDOUT);
@@ -84,7 +88,7 @@ Samba::Samba(SST::ComponentId_t id, SST::Params& params): Component(id) {
 		TLB.push_back(loadComponentExtension<TLBhierarchy>(i, levels /* level */, params));
 
 
-		SST::Link * link2 = configureLink(link_buffer, "0ps", new Event::Handler<TLBhierarchy>(TLB[i], &TLBhierarchy::handleEvent_CPU));
+		SST::Link * link2 = configureLink(link_buffer, "0ps", new Event::Handler<Samba, uint32_t>(this, &Samba::handleEvent_CPU, i));
 		cpu_to_mmu[i] = link2;
 
 
@@ -130,7 +134,10 @@ Samba::Samba(SST::ComponentId_t id, SST::Params& params): Component(id) {
 	std::cout<<"After initialization "<<std::endl;
 
 	std::string cpu_clock = params.find<std::string>("clock", "1GHz");
-	registerClock( cpu_clock, new Clock::Handler<Samba>(this, &Samba::tick ) );
+	clockHandler = new Clock::Handler<Samba>(this, &Samba::tick );
+	clockTC = registerClock( cpu_clock, clockHandler );
+	clockOn = true;
+	lastActiveCycle = 0;
 
 
 
@@ -178,9 +185,37 @@ bool Samba::tick(SST::Cycle_t x)
 {
 
 	// We tick the MMU hierarchy of each core
+	bool idle = true;
 	for(uint32_t i = 0; i < core_count; ++i)
+	{
 		TLB[i]->tick(x);
+		idle = idle && TLB[i]->isIdle();
+	}
 
+	lastActiveCycle = x;
+
+	// Nothing left to translate in any core, stop the clock until the next request arrives
+	if(idle)
+	{
+		clockOn = false;
+		return true;
+	}
 
 	return false;
 }
+
+
+// Restart the clock for a new request, the hierarchies account for the cycles skipped while idle
+void Samba::handleEvent_CPU(SST::Event* event, uint32_t core)
+{
+	if(!clockOn)
+	{
+		SST::Cycle_t next = reregisterClock(clockTC, clockHandler);
+		clockOn = true;
+
+		for(uint32_t i = 0; i < core_count; ++i)
+			TLB[i]->skipIdleCycles(next - 1, next - 1 - lastActiveCycle);
+	}
+
+	TLB[core]->handleEvent_CPU(event);
+}
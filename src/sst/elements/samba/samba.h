@@ -99,24 +99,25 @@ class Samba : public SST::Component {
         void finish() {for(int i=0; i<(int) core_count; i++) TLB[i]->finish();};
         void handleEvent(SST::Event* event) {};
         bool tick(SST::Cycle_t x);
+        void handleEvent_CPU(SST::Event* event, uint32_t core);
 
         // Following are the page table components of the application running on the Ariel instance that owns this Samba unit
         // Note, the application might be multi-threaded, however, all threads will share the sambe page table components below
 
         Address_t CR3;
-        std::map<Address_t, Address_t> PGD;
-        std::map<Address_t, Address_t> PUD;
-        std::map<Address_t, Address_t> PMD;
-        std::map<Address_t, Address_t> PTE;
-        std::map<Address_t,int>  MAPPED_PAGE_SIZE4KB;
-        std::map<Address_t,int>  MAPPED_PAGE_SIZE2MB;
-        std::map<Address_t,int>  MAPPED_PAGE_SIZE1GB;
-
-        std::map<Address_t,int> PENDING_PAGE_FAULTS;
-        std::map<Address_t,int> PENDING_PAGE_FAULTS_PGD;
-        std::map<Address_t,int> PENDING_PAGE_FAULTS_PUD;
-        std::map<Address_t,int> PENDING_PAGE_FAULTS_PMD;
-        std::map<Address_t,int> PENDING_PAGE_FAULTS_PTE;
+        RadixTable<Address_t> PGD;
+        RadixTable<Address_t> PUD;
+        RadixTable<Address_t> PMD;
+        RadixTable<Address_t> PTE;
+        RadixTable<int>  MAPPED_PAGE_SIZE4KB;
+        RadixTable<int>  MAPPED_PAGE_SIZE2MB;
+        RadixTable<int>  MAPPED_PAGE_SIZE1GB;
+
+        RadixTable<int> PENDING_PAGE_FAULTS;
+        RadixTable<int> PENDING_PAGE_FAULTS_PGD;
+        RadixTable<int> PENDING_PAGE_FAULTS_PUD;
+        RadixTable<int> PENDING_PAGE_FAULTS_PMD;
+        RadixTable<int> PENDING_PAGE_FAULTS_PTE;
         int cr3I;
         std::map<Address_t,int> PENDING_SHOOTDOWN_EVENTS;
 
@@ -131,6 +132,12 @@ class Samba : public SST::Component {
         SST::Link*  event_link; // Note that this is a self-link for events
         SST::Link** cpu_to_mmu;
 
+        // The clock is turned off while every TLB hierarchy is idle
+        TimeConverter* clockTC;
+        Clock::HandlerBase* clockHandler;
+        bool clockOn;
+        SST::Cycle_t lastActiveCycle;
+
         std::vector<TLBhierarchy*> TLB;
 
         int emulate_faults; // This indicates if pafe fault handler is used or not
@@ -123,21 +123,17 @@ TLBhierarchy::TLBhierarchy(ComponentId_t id, int tlb_id, int Levels, Params& par
 		for(int level=2; level <=levels; level++)
 		{
 			TLB_CACHE[level]->setServiceBack(TLB_CACHE[level-1]->getPushedBack());
-			TLB_CACHE[level]->setServiceBackSize(TLB_CACHE[level-1]->getPushedBackSize());
 
 		}
 
 		timeStamp = 0;
 		PTW->setServiceBack(TLB_CACHE[levels]->getPushedBack());
-		PTW->setServiceBackSize(TLB_CACHE[levels]->getPushedBackSize());
 
 		TLB_CACHE[1]->setServiceBack(&mem_reqs);
-		TLB_CACHE[1]->setServiceBackSize(&mem_reqs_sizes);
 	}
 	else
 	{
 		PTW->setServiceBack(&mem_reqs);
-		PTW->setServiceBackSize(&mem_reqs_sizes);
 	}
 
 	PTW->setHold(&hold);
@@ -237,12 +233,11 @@ bool TLBhierarchy::tick(SST::Cycle_t x)
 	// Step 1, check if not empty, then propogate it to L1 cache
 	while(!mem_reqs.empty() && !shootdown && !hold)
 	{
-            MemHierarchy::MemEventBase * event= mem_reqs.back();
+            MemHierarchy::MemEventBase * event= mem_reqs.back().ev;
 
 		if(time_tracker.find(event) == time_tracker.end())
 		{
 			std::cout << "Danger! Something is terribly wrong..." << std::endl;
-			mem_reqs_sizes.erase(event);
 			mem_reqs.pop_back();
 			continue;
 		}
@@ -253,7 +248,7 @@ bool TLBhierarchy::tick(SST::Cycle_t x)
 			Address_t vaddr = ((MemEvent*) event)->getVirtualAddress();
 			if(!ptw_confined)
 			{
-				if((*PTE).find(vaddr/4096)==(*PTE).end())
+				if(!(*PTE).contains(vaddr/4096))
 					std::cout<<"Error: That page has never been mapped:  " << vaddr / 4096 << std::endl;
 
 				((MemEvent*) event)->setAddr((((*PTE)[vaddr / 4096] + vaddr % 4096) / 64) * 64);
@@ -262,7 +257,7 @@ bool TLBhierarchy::tick(SST::Cycle_t x)
 			else
 			{
 				uint64_t offset = (uint64_t)512*512*512*512;
-				if((*PTE).find((vaddr/4096)%offset)==(*PTE).end())
+				if(!(*PTE).contains((vaddr/4096)%offset))
 				std::cout<<"Error: That page has never been mapped:  " << vaddr / 4096 << std::endl;
 
 				((MemEvent*) event)->setAddr((((*PTE)[(vaddr / 4096)%offset] + vaddr % 4096)));
@@ -290,8 +285,7 @@ bool TLBhierarchy::tick(SST::Cycle_t x)
 
 		to_cache->send(event);
 
-		// We remove the size of that translation, we might for future versions use the translation size to obtain statistics
-		mem_reqs_sizes.erase(event);
+		// We remove the translation and its size, we might for future versions use the translation size to obtain statistics
 		mem_reqs.pop_back();
 	}
 
@@ -299,6 +293,19 @@ bool TLBhierarchy::tick(SST::Cycle_t x)
 }
 
 
+bool TLBhierarchy::isIdle()
+{
+	if(!mem_reqs.empty() || hold || shootdown || !PTW->isIdle())
+		return false;
+
+	for(int level = levels; level >= 1; level--)
+		if(!TLB_CACHE[level]->isIdle())
+			return false;
+
+	return true;
+}
+
+
 void TLBhierarchy::finish()
 {
       for(int level=1; level<=levels;level++)
@@ -104,10 +104,10 @@ TLB::TLB(ComponentId_t id, int tlb_id, TLB * Next_level, int Level, SST::Params&
 	page_size = new uint64_t[sizes];
 	sets = new int[sizes];
 
-    // data arrays `foo[page_sizes][set][way]`
-	tags  = new Address_t**[sizes];
-	valid = new bool**[sizes];
-	lru   = new int **[sizes];
+    // data arrays `foo[page_sizes][set*assoc + way]`
+	tags  = new Address_t*[sizes];
+	valid = new bool*[sizes];
+	lru   = new int *[sizes];
 
     //Loop over each supported page size, getting params
 	for(int i=0; i < sizes; i++)
@@ -131,21 +131,18 @@ TLB::TLB(ComponentId_t id, int tlb_id, TLB * Next_level, int Level, SST::Params&
 	for(int id=0; id< sizes; id++)
 	{
 
-		tags[id]  = new Address_t*[sets[id]];
-		valid[id] = new bool*[sets[id]];
-		lru[id]   = new int*[sets[id]];
+		// One contiguous array per structure, so the tag compare of a set scans adjacent words
+		tags[id]  = new Address_t[sets[id]*assoc[id]];
+		valid[id] = new bool[sets[id]*assoc[id]];
+		lru[id]   = new int[sets[id]*assoc[id]];
 
 		for(int i=0; i < sets[id]; i++)
 		{
-			tags[id][i]  = new Address_t[assoc[id]];
-			valid[id][i] = new bool[assoc[id]];
-			lru[id][i]   = new int[assoc[id]];
-
 			for(int j=0; j<assoc[id];j++)
 			{
-				tags [id][i][j] = -1;
-				valid[id][i][j] = true;
-				lru  [id][i][j] = j;
+				tags [id][i*assoc[id] + j] = -1;
+				valid[id][i*assoc[id] + j] = true;
+				lru  [id][i*assoc[id] + j] = j;
 			}
 		}
 
@@ -174,7 +171,8 @@ bool TLB::tick(SST::Cycle_t x)
 	{
 
 
-        MemHierarchy::MemEventBase * ev = pushed_back.back();
+        MemHierarchy::MemEventBase * ev = pushed_back.back().ev;
+		long long int ev_size = pushed_back.back().size;
 
 		Address_t addr = ((MemEvent*) ev)->getVirtualAddress();
 
@@ -187,7 +185,7 @@ bool TLB::tick(SST::Cycle_t x)
 		lu_en=SIZE_LOOKUP.end();
 		while(lu_st!=lu_en)
 		{
-			if(pushed_back_size[ev] >= lu_st->first)
+			if(ev_size >= lu_st->first)
 			{
 				if(!check_hit(addr, lu_st->second))
 				{
@@ -218,31 +216,30 @@ bool TLB::tick(SST::Cycle_t x)
 
 		// Note that here we are substituting for latency of checking the tag before proceeding 
         // to the next level, we also add the upper link latency for the round trip
-		ready_by[ev]= x + latency + 2*upper_link_latency;
-
-		// We also track the size of tthe ready request
-		ready_by_size[ev]= pushed_back_size[ev];
+		// We also track the size of the ready request
+		ready_by[ev]= ReadyTranslation(x + latency + 2*upper_link_latency, ev_size);
 
 
 		// Check if there are other misses that were going to the same translation and waiting for the response of this miss
-		if((level==1) && (SAME_MISS.find(addr/4096)!=SAME_MISS.end()))
+		std::unordered_map< Address_t, std::vector< MemHierarchy::MemEventBase*>>::iterator same = SAME_MISS.end();
+		if(level==1)
+			same = SAME_MISS.find(addr/4096);
+		if(same!=SAME_MISS.end())
 		{
-		  std::map< MemHierarchy::MemEventBase*, int>::iterator same_st, same_en;
-		  same_st = SAME_MISS[addr/4096].begin();
-    		  same_en = SAME_MISS[addr/4096].end();
+		  std::vector< MemHierarchy::MemEventBase*>::iterator same_st, same_en;
+		  same_st = same->second.begin();
+    		  same_en = same->second.end();
    		   while(same_st!=same_en)
 		    {
 
-	    		ready_by[same_st->first] = x + latency + 2*upper_link_latency;
-	    		ready_by_size[same_st->first] = pushed_back_size[ev];
+	    		ready_by[*same_st] = ReadyTranslation(x + latency + 2*upper_link_latency, ev_size);
 			same_st++;
 		    }
-		  SAME_MISS.erase(addr/4096);
+		  SAME_MISS.erase(same);
 		 // PENDING_MISS.erase(addr/4096);
 		}
 		PENDING_MISS.erase(addr/4096);
 
-		pushed_back_size.erase(ev);
 		pushed_back.pop_back();
 
 	}
@@ -290,13 +287,11 @@ bool TLB::tick(SST::Cycle_t x)
 			update_lru(addr, hit_id);
 			hits++;
 			statTLBHits->addData(1);
+			// Tracking the hit request size
 			if(parallel_mode)
-				ready_by[ev] = x;
+				ready_by[ev] = ReadyTranslation(x, page_size[hit_id]/1024);
 			else
-				ready_by[ev] = x + latency;
-
-			// Tracking the hit request size
-			ready_by_size[ev] = page_size[hit_id]/1024;
+				ready_by[ev] = ReadyTranslation(x + latency, page_size[hit_id]/1024);
 
 			st_1 = not_serviced.erase(st_1);
 		}
@@ -312,13 +307,13 @@ bool TLB::tick(SST::Cycle_t x)
 				if((level==1) && (PENDING_MISS.find(addr/4096) != PENDING_MISS.end()))
 				{
 
-					SAME_MISS[addr/4096][ev]=1; // Just adding it to the 2D map, so we later hand it back once the master miss is complete
+					SAME_MISS[addr/4096].push_back(ev); // Just adding it to the miss list, so we later hand it back once the master miss is complete
 					currently_handled = true;
 				}
 				else if(level==1)
 				{
 
-					PENDING_MISS[addr/4096]=1;
+					PENDING_MISS.insert(addr/4096);
 
 				}
 
@@ -357,46 +352,38 @@ bool TLB::tick(SST::Cycle_t x)
 	}
 
 
-	std::map<MemHierarchy::MemEventBase *, SST::Cycle_t>::iterator st, en;
+	std::map<MemHierarchy::MemEventBase *, ReadyTranslation, MemEventPtrCompare>::iterator st;
 	st = ready_by.begin();
-	en = ready_by.end();
 
 	// We iterate over the list of being serviced request to see if any has finished by this cycle
-	while(st!=en)
+	while(st!=ready_by.end())
 	{
 
-		bool deleted=false;
-		if(st->second <= x)
+		if(st->second.ready <= x)
 		{
 
 			//	std::cout<<"The request was read at "<<st->second<<" The time now is "<<x<<std::endl;
 
 			Address_t addr = ((MemEvent*) st->first)->getVirtualAddress();
+			long long int ev_size = st->second.size;
 
 
-			if(SIZE_LOOKUP.find(ready_by_size[st->first])!= SIZE_LOOKUP.end())
+			std::map<long long int, int>::iterator lookup = SIZE_LOOKUP.find(ev_size);
+			if(lookup != SIZE_LOOKUP.end())
 			{
 				// Double checking that we actually still don't have it inserted
-				if(!check_hit(addr, SIZE_LOOKUP[ready_by_size[st->first]]))
+				if(!check_hit(addr, lookup->second))
 				{
-					insert_way(addr, find_victim_way(addr, SIZE_LOOKUP[ready_by_size[st->first]]), SIZE_LOOKUP[ready_by_size[st->first]]);
-					update_lru(addr, SIZE_LOOKUP[ready_by_size[st->first]]);
+					insert_way(addr, find_victim_way(addr, lookup->second), lookup->second);
+					update_lru(addr, lookup->second);
 				}
 				else
-					update_lru(addr, SIZE_LOOKUP[ready_by_size[st->first]]);
+					update_lru(addr, lookup->second);
 			}
 
 
 
-			service_back->push_back(st->first);
-
-			(*service_back_size)[st->first]=ready_by_size[st->first];
-
-
-
-			ready_by_size.erase(st->first);
-
-			deleted = true;
+			service_back->push_back(TranslationRequest(st->first, ev_size));
 
 
 			// Deleting it from pending requests
@@ -415,11 +402,10 @@ bool TLB::tick(SST::Cycle_t x)
 				st2++;
 			}
 
-			ready_by.erase(st);
+			// The requests before this one were not ready, so carry on from the next one
+			st = ready_by.erase(st);
 
 		}
-		if(deleted)
-			st=ready_by.begin();
 		else
 			st++;
 
@@ -436,8 +422,8 @@ void TLB::insert_way(Address_t vaddr, int way, int struct_id)
 {
 
 	int set=abs_int((vaddr/page_size[struct_id])%sets[struct_id]);
-	tags[struct_id][set][way]=vaddr/page_size[struct_id];
-	valid[struct_id][set][way]=true;
+	tags[struct_id][set*assoc[struct_id] + way]=vaddr/page_size[struct_id];
+	valid[struct_id][set*assoc[struct_id] + way]=true;
 
 }
 
@@ -461,9 +447,9 @@ void TLB::invalidate(Address_t vadd, int id)
 		//std::cout << getName().c_str() << " TLB " << coreId << " id: " << id << " invalidate address: " << vadd << " index: " << vadd*page_size[0]/page_size[id] << std::endl;
 		int set= abs_int((vadd*page_size[0]/page_size[id])%sets[id]);
 		for(int i=0; i<assoc[id]; i++) {
-			if(tags[id][set][i]==vadd*page_size[0]/page_size[id] && valid[id][set][i]) {
+			if(tags[id][set*assoc[id] + i]==vadd*page_size[0]/page_size[id] && valid[id][set*assoc[id] + i]) {
 				//std::cout << getName().c_str() << " TLB " << coreId << " invalidate address: " << vadd << " index: " << vadd*page_size[0]/page_size[id] << " found" << std::endl;
-				valid[id][set][i] = false;
+				valid[id][set*assoc[id] + i] = false;
 				break;
 			}
 		}
@@ -478,11 +464,12 @@ void TLB::invalidate(Address_t vadd, int id)
 bool TLB::check_hit(Address_t vadd, int struct_id)
 {
 
-
-	int set= abs_int((vadd/page_size[struct_id])%sets[struct_id]);
+	Address_t tag = vadd/page_size[struct_id];
+	int set= abs_int(tag%sets[struct_id]);
+	Address_t * set_tags = tags[struct_id] + set*assoc[struct_id];
 	for(int i=0; i<assoc[struct_id];i++)
-		if(tags[struct_id][set][i]==vadd/page_size[struct_id])
-			return valid[struct_id][set][i];
+		if(set_tags[i]==tag)
+			return valid[struct_id][set*assoc[struct_id] + i];
 
 	return false;
 }
@@ -492,9 +479,10 @@ int TLB::find_victim_way(Address_t vadd, int struct_id)
 {
 
 	int set= abs_int((vadd/page_size[struct_id])%sets[struct_id]);
+	int * set_lru = lru[struct_id] + set*assoc[struct_id];
 
 	for(int i=0; i<assoc[struct_id]; i++)
-		if(lru[struct_id][set][i]==(assoc[struct_id]-1))
+		if(set_lru[i]==(assoc[struct_id]-1))
 			return i;
 
 
@@ -507,22 +495,23 @@ void TLB::update_lru(Address_t vaddr, int struct_id)
 
 	int lru_place=assoc[struct_id]-1;
 
-	int set= abs_int((vaddr/page_size[struct_id])%sets[struct_id]);
+	Address_t tag = vaddr/page_size[struct_id];
+	int set= abs_int(tag%sets[struct_id]);
+	Address_t * set_tags = tags[struct_id] + set*assoc[struct_id];
+	int * set_lru = lru[struct_id] + set*assoc[struct_id];
 	for(int i=0; i<assoc[struct_id];i++)
-		if(tags[struct_id][set][i]==vaddr/page_size[struct_id])
+		if(set_tags[i]==tag)
 		{
-			lru_place = lru[struct_id][set][i];
+			lru_place = set_lru[i];
 			break;
 		}
 	for(int i=0; i<assoc[struct_id];i++)
 	{
-		if(lru[struct_id][set][i]==lru_place)
-			lru[struct_id][set][i]=0;
-		else if(lru[struct_id][set][i]<lru_place)
-			lru[struct_id][set][i]++;
+		if(set_lru[i]==lru_place)
+			set_lru[i]=0;
+		else if(set_lru[i]<lru_place)
+			set_lru[i]++;
 	}
 
 
 }
-
-
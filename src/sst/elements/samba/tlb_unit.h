@@ -20,6 +20,8 @@
 #include "page_table_walker.h"
 #include <map>
 #include <vector>
+#include <unordered_map>
+#include <unordered_set>
 #include "utils.h"
 
 // This file defines a TLB structure
@@ -55,10 +57,10 @@ class TLB : public ComponentExtension
 
     // === Cache data for TLB entries
     // - separate cache for each size of page
-    // - accessed as `tags[page_size][set][way]`
-	Address_t *** tags;
-	bool ***valid; // status of the tags
-	int *** lru;   // lru positions
+    // - the ways of a set are contiguous, accessed as `tags[page_size][set*assoc + way]`
+	Address_t ** tags;
+	bool **valid; // status of the tags
+	int ** lru;   // lru positions
 
 
     // === Counters
@@ -74,8 +76,8 @@ class TLB : public ComponentExtension
     // === ???
 	std::map<long long int, int> SIZE_LOOKUP; // This structure checks if a size is supported inside the structure, and its index structure
 
-	std::map< Address_t, std::map< MemHierarchy::MemEventBase *, int, MemEventPtrCompare>> SAME_MISS; // This tracks the misses for the same location and deduplicates them
-	std::map<Address_t, int> PENDING_MISS; // This tracks the addresses of the current master misses (other contained misses are tracked in SAME_MISS)
+	std::unordered_map< Address_t, std::vector< MemHierarchy::MemEventBase *>> SAME_MISS; // This tracks the misses for the same location and deduplicates them
+	std::unordered_set<Address_t> PENDING_MISS; // This tracks the addresses of the current master misses (other contained misses are tracked in SAME_MISS)
 
 
     //=======================================================================
@@ -95,8 +97,7 @@ class TLB : public ComponentExtension
 	std::vector<MemHierarchy::MemEventBase *> pending_misses; 
 
     // === Holds requests that have gotten the data they need, but we need to wait the duration of the latency before returning
-	std::map<MemHierarchy::MemEventBase *, SST::Cycle_t, MemEventPtrCompare> ready_by; 
-	std::map<MemHierarchy::MemEventBase *, long long int, MemEventPtrCompare> ready_by_size; // keeps track of requests' sizes inside this structure
+	std::map<MemHierarchy::MemEventBase *, ReadyTranslation, MemEventPtrCompare> ready_by; // ready cycle and page size of each request
 
 
     // === Buffers for sending requests up/down TLB hierarchy:
@@ -104,13 +105,11 @@ class TLB : public ComponentExtension
     // When we miss, we send requests to next level down through `next_level->push_request()` or `PTW->push_request()`
     
     // completed requests from deeper in TLB hierarchy will be returned into `this->pushed_back`
-	std::vector<MemHierarchy::MemEventBase *> pushed_back; // translation for requests, returned from lower-level structures
-	std::map<MemHierarchy::MemEventBase *, long long int, MemEventPtrCompare> pushed_back_size; // page_sizes of the returned translations
+	std::vector<TranslationRequest> pushed_back; // translation for requests, returned from lower-level structures with their page sizes
 
     // when we're finished with a request, we send it back up the hierarchy by inserting into `service_back`
     // - pointer is wired up to `pushed_back` buffers of the next level up at TLB in constructor of TLBHierarchy
-	std::vector<MemHierarchy::MemEventBase *> * service_back; // used to pass ready requests back to the previous level
-	std::map<MemHierarchy::MemEventBase *, long long int, MemEventPtrCompare> * service_back_size; // page_size of ready requests for next level up
+	std::vector<TranslationRequest> * service_back; // used to pass ready requests and their page sizes back to the previous level
 
 
 
@@ -138,12 +137,10 @@ class TLB : public ComponentExtension
 
     // === Called by parent to wire up TLB levels to each other
     // this TLB will push completed requests into service_back (sending them back up the levels towards core)
-	void setServiceBack( std::vector<MemHierarchy::MemEventBase *> * x) { service_back = x;}
-	void setServiceBackSize( std::map<MemHierarchy::MemEventBase *, long long int, MemEventPtrCompare> * x) { service_back_size = x;}
+	void setServiceBack( std::vector<TranslationRequest> * x) { service_back = x;}
 
     // lower-levels will return answered requests into this->pushed_back
-	std::vector<MemHierarchy::MemEventBase *> * getPushedBack(){return & pushed_back;}
-	std::map<MemHierarchy::MemEventBase *, long long int, MemEventPtrCompare> * getPushedBackSize(){return & pushed_back_size;}
+	std::vector<TranslationRequest> * getPushedBack(){return & pushed_back;}
 
 	void update_lru(Address_t vaddr, int struct_id);
 
@@ -165,6 +162,9 @@ class TLB : public ComponentExtension
 
 	bool tick(SST::Cycle_t x);
 
+	// True when no request is queued, in flight or waiting out the latency at this level
+	bool isIdle() { return not_serviced.empty() && pushed_back.empty() && ready_by.empty() && pending_misses.empty(); }
+
 
 };
 
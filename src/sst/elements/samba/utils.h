@@ -16,6 +16,8 @@
 #include <sst/core/event.h>
 #include <sst/elements/memHierarchy/memEventBase.h>
 
+#include <functional>
+
 namespace SST {
 namespace SambaComponent {
 
@@ -29,6 +31,28 @@ namespace SambaComponent {
             }
         }
     };
+
+    // A translation passed back up to the previous level, with the size (in KB) of the page it was translated with
+    struct TranslationRequest {
+        MemHierarchy::MemEventBase * ev;
+        long long int size;
+        TranslationRequest(MemHierarchy::MemEventBase * x, long long int Size) : ev(x), size(Size) {}
+    };
+
+    // A translation waiting out the latency of a level: the cycle it is ready by and its page size (in KB)
+    struct ReadyTranslation {
+        SST::Cycle_t ready;
+        long long int size;
+        ReadyTranslation() : ready(0), size(0) {}
+        ReadyTranslation(SST::Cycle_t Ready, long long int Size) : ready(Ready), size(Size) {}
+    };
+
+    // Hash for MemEvent IDs, so tables keyed on them can be unordered
+    struct MemEventIdHash {
+        size_t operator()(const std::pair<uint64_t, int>& id) const {
+            return std::hash<uint64_t>()(id.first ^ ((uint64_t) id.second << 48));
+        }
+    };
 }
 }
 
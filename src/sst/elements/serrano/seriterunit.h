@@ -145,7 +145,7 @@ protected:
 
 		if( (*t_current_value) < (*t_max_value) ) {
 			if( ! output_qs[0]->full() ) {
-				output_qs[0]->push( new SerranoMessage( sizeof(T), t_current_value ) );
+				output_qs[0]->push( SerranoMessage::allocate( sizeof(T), t_current_value ) );
 				(*t_current_value) += (*t_step_value);
 			}
 		} else {
@@ -90,7 +90,7 @@ protected:
 				break;
 			}
 
-			delete msg;
+			SerranoMessage::release( msg );
 		}
 	}
 
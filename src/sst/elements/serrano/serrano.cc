@@ -20,7 +20,9 @@
 #include "seriterunit.h"
 #include "serprintunit.h"
 
+#include <algorithm>
 #include <limits>
+#include <map>
 
 using namespace SST::Serrano;
 
@@ -38,6 +40,13 @@ SerranoComponent::SerranoComponent( SST::ComponentId_t id, SST::Params& params )
 	output->verbose(CALL_INFO, 2, 0, "Configuring Serrano for clock of %s...\n", clock.c_str());
 	registerClock( clock, new Clock::Handler<SerranoComponent>( this, &SerranoComponent::tick ) );
 
+	max_kernels = params.find<size_t>("max_kernels", 1);
+	if( 0 == max_kernels ) {
+		output->fatal(CALL_INFO, -1, "Error: max_kernels must be at least 1.\n");
+	}
+
+	// Every kernel is built up front, so the next can take the place of one that completes
+	// on the following cycle with no parsing or unit construction in between.
 	constexpr int kernel_name_len = 128;
 	char* kernel_name = new char[kernel_name_len];
 	for( int i = 0; i < std::numeric_limits<int>::max(); ++i ) {
@@ -46,16 +55,15 @@ SerranoComponent::SerranoComponent( SST::ComponentId_t id, SST::Params& params )
 
 		if( "" != kernel_name_file) {
 			output->verbose(CALL_INFO, 4, 0, "Found Kernel (%s): %s\n", kernel_name, kernel_name_file.c_str());
-			kernel_queue.push_back( kernel_name_file );
+			kernels.push_back( constructGraph( output, kernel_name_file.c_str() ) );
 		} else {
 			break;
 		}
 	}
 	delete[] kernel_name;
 
-	if( kernel_queue.size() > 0 ) {
-		constructGraph( output, kernel_queue.front().c_str() );
-		kernel_queue.pop_front();
+	for( next_kernel = 0; next_kernel < std::min( max_kernels, kernels.size() ); ++next_kernel ) {
+		active_kernels.push_back( kernels[next_kernel] );
 	}
 
 	registerAsPrimaryComponent();
@@ -70,43 +78,65 @@ bool SerranoComponent::tick( SST::Cycle_t currentCycle ) {
 
 	output->verbose(CALL_INFO, 4, 0, "Clocking Serrano cycle %" PRIu64 "...\n", currentCycle );
 
-	// Tick all units
-	for( auto next_unit : units ) {
-		next_unit.second->execute( currentCycle );
+	// Tick all units of every kernel in flight
+	for( SerranoKernel* kernel : active_kernels ) {
+		for( SerranoCoarseUnit* next_unit : kernel->units ) {
+			next_unit->execute( currentCycle );
+		}
+	}
+
+	// Retire the kernels that are done and start waiting kernels in their place
+	for( size_t i = 0; i < active_kernels.size(); ) {
+		if( stillProcessing( active_kernels[i] ) ) {
+			++i;
+		} else {
+			output->verbose(CALL_INFO, 2, 0, "Kernel %s is complete.\n", active_kernels[i]->kernel_file.c_str());
+			active_kernels.erase( active_kernels.begin() + i );
+		}
 	}
 
+	while( ( active_kernels.size() < max_kernels ) && ( next_kernel < kernels.size() ) ) {
+		output->verbose(CALL_INFO, 2, 0, "Starting kernel %s.\n", kernels[next_kernel]->kernel_file.c_str());
+		active_kernels.push_back( kernels[next_kernel++] );
+	}
+
+	if( active_kernels.empty() ) {
+		output->verbose(CALL_INFO, 4, 0, "No kernels have work left, no need to continue processing.\n");
+		primaryComponentOKToEndSim();
+		return true;
+	}
+
+	return false;
+}
+
+bool SerranoComponent::stillProcessing( SerranoKernel* kernel ) {
 	bool units_continue  = false;
 	bool queues_continue = false;
 
 	// Do we have any units which want to continue processing
-	for( auto next_unit : units ) {
-		output->verbose(CALL_INFO, 16, 0, "Unit-ID: %" PRIu64 " status: %s\n", next_unit.first,
-			( next_unit.second->stillProcessing() ? "keep-processing" : "completed" ) );
-		units_continue |= next_unit.second->stillProcessing();
+	for( size_t i = 0; i < kernel->units.size(); ++i ) {
+		output->verbose(CALL_INFO, 16, 0, "Unit-ID: %" PRIu64 " status: %s\n", (uint64_t) i,
+			( kernel->units[i]->stillProcessing() ? "keep-processing" : "completed" ) );
+		units_continue |= kernel->units[i]->stillProcessing();
 	}
 
 	// Check that any queue is not empty
-	for( auto next_q : msg_queues ) {
-		queues_continue |= ( ! next_q.second->empty() );
+	for( auto next_q : kernel->msg_queues ) {
+		queues_continue |= ( ! next_q->empty() );
 	}
 
 	if( units_continue ) {
 		output->verbose(CALL_INFO, 4, 0, "Work units are still processing, continue for another cycle\n");
-		return false;
-	} else {
-		if( queues_continue ) {
-			output->verbose(CALL_INFO, 4, 0, "Queues contain entries that may need processing, continue for another cycle.\n");
-			return false;
-		} else {
-			output->verbose(CALL_INFO, 4, 0, "Neither queues or units have no work, no need to continue processing.\n");
-			primaryComponentOKToEndSim();
-			return true;
-		}
+		return true;
+	} else if( queues_continue ) {
+		output->verbose(CALL_INFO, 4, 0, "Queues contain entries that may need processing, continue for another cycle.\n");
+		return true;
 	}
 
+	return false;
 }
 
-void SerranoComponent::constructGraph( SST::Output* output, const char* kernel_file ) {
+SerranoKernel* SerranoComponent::constructGraph( SST::Output* output, const char* kernel_file ) {
 	output->verbose(CALL_INFO, 4, 0, "Parsing kernel at: %s...\n", kernel_file);
 	FILE* graph_file = fopen( kernel_file, "rt" );
 
@@ -120,6 +150,12 @@ void SerranoComponent::constructGraph( SST::Output* output, const char* kernel_f
 
 	Params empty_params;
 
+	SerranoKernel* kernel = new SerranoKernel();
+	kernel->kernel_file = kernel_file;
+
+	// node ids in the file only matter while linking, units are kept densely in file order
+	std::map< uint64_t, SerranoCoarseUnit* > units;
+
 	while( ! feof( graph_file ) ) {
 		read_line( graph_file, line, buff_max);
 		printf("Line[%s]\n", line);
@@ -194,6 +230,7 @@ void SerranoComponent::constructGraph( SST::Output* output, const char* kernel_f
 			}
 
 			units.insert( std::pair< uint64_t, SerranoCoarseUnit* >( id, new_unit ) );
+			kernel->units.push_back( new_unit );
 		} else if( 0 == strcmp( token, "LINK" ) ) {
 			char* in_unit      = strtok( nullptr, " " );
 			char* out_unit     = strtok( nullptr, " " );
@@ -209,6 +246,7 @@ void SerranoComponent::constructGraph( SST::Output* output, const char* kernel_f
 				// These are swapped, input to the link is the output of a unit and vice versa
 				units[ u64_in_unit  ]->addOutputQueue( new_q );
 				units[ u64_out_unit ]->addInputQueue( new_q );
+				kernel->msg_queues.push_back( new_q );
 			} else {
 				output->fatal(CALL_INFO, -1, "Error: link does not connect an existing input or output component.\n");
 			}
@@ -221,9 +259,11 @@ void SerranoComponent::constructGraph( SST::Output* output, const char* kernel_f
 	fclose( graph_file );
 
 	/* cycle over and check queues are good, these will fatal */
-	for( auto next_unit : units ) {
-		next_unit.second->checkRequiredQueues( output );
-	}	
+	for( auto next_unit : kernel->units ) {
+		next_unit->checkRequiredQueues( output );
+	}
+
+	return kernel;
 }
 
 int SerranoComponent::read_line( FILE* file_h, char* buffer, const size_t buffer_max ) {
@@ -251,20 +291,20 @@ int SerranoComponent::read_line( FILE* file_h, char* buffer, const size_t buffer
 	return status;
 }
 
-void SerranoComponent::clearGraph() {
-	output->verbose(CALL_INFO, 2, 0, "Clearing current graph...\n");
+void SerranoComponent::clearGraph( SerranoKernel* kernel ) {
+	output->verbose(CALL_INFO, 2, 0, "Clearing graph for %s...\n", kernel->kernel_file.c_str());
 
-	for( auto next_q : msg_queues ) {
-		delete next_q.second;;
+	for( auto next_q : kernel->msg_queues ) {
+		delete next_q;
 	}
 
-	msg_queues.clear();
+	kernel->msg_queues.clear();
 
-	for( auto next_unit : units ) {
-		delete next_unit.second;
+	for( auto next_unit : kernel->units ) {
+		delete next_unit;
 	}
 
-	units.clear();
+	kernel->units.clear();
 
 	output->verbose(CALL_INFO, 2, 0, "Graph clear done. Reset is complete\n");
 }
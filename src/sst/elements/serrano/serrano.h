@@ -21,6 +21,7 @@
 #include <sst/core/output.h>
 
 #include <cstdio>
+#include <vector>
 
 #include "smsg.h"
 #include "scircq.h"
@@ -30,6 +31,14 @@
 namespace SST {
 namespace Serrano {
 
+// The units and links built from one kernel file. Kernels never share units so
+// several of them can be resident and clocked at once.
+struct SerranoKernel {
+	std::string kernel_file;
+	std::vector< SerranoCoarseUnit* > units;
+	std::vector< SerranoCircularQueue<SerranoMessage*>* > msg_queues;
+};
+
 class SerranoComponent : public SST::Component {
 
 public:
@@ -48,24 +57,28 @@ public:
 		)
 
 	SST_ELI_DOCUMENT_PARAMS(
-
+		{ "verbose",      "Level of output verbosity, higher is more output, 0 is no output", "0" },
+		{ "clock",        "Clock frequency", "1GHz" },
+		{ "kernel%(kernels)d", "Graph file for each kernel, kernels run in the order kernel0, kernel1, ...", "" },
+		{ "max_kernels",  "Number of kernels which can execute concurrently, a kernel starts the cycle after one ahead of it completes", "1" }
 		)
 
 	SST_ELI_DOCUMENT_STATISTICS(
 
 		)
 
-	void clearGraph();
-	void constructGraph( SST::Output* output, const char* kernel_file );
+	void clearGraph( SerranoKernel* kernel );
+	SerranoKernel* constructGraph( SST::Output* output, const char* kernel_file );
 
 private:
 	int read_line( FILE* file_h, char* buffer, const size_t buffer_max );
+	bool stillProcessing( SerranoKernel* kernel );
 
 	SST::Output* output;
-	std::list< std::string > kernel_queue;
-	std::map< uint64_t, SerranoCoarseUnit* > units;
-	std::map< uint64_t, SerranoCircularQueue<SerranoMessage*>* > msg_queues;
-	
+	std::vector< SerranoKernel* > kernels;
+	std::vector< SerranoKernel* > active_kernels;
+	size_t next_kernel;
+	size_t max_kernels;
 
 };
 
@@ -121,9 +121,9 @@ public:
 			// Execute the function
 			unit_func( output, msgs_in );
 
-			// Delete the messages from the incoming queues to free memory
+			// Release the messages from the incoming queues so they can be reused
 			for( SerranoMessage* in_msg : msgs_in ) {
-				delete in_msg;
+				SerranoMessage::release( in_msg );
 			}
 
 			// Clear the vector this cycle
@@ -18,6 +18,8 @@
 
 #include <cstdint>
 #include <cinttypes>
+#include <map>
+#include <vector>
 
 namespace SST {
 namespace Serrano {
@@ -58,14 +60,43 @@ public:
 		}
 	}
 
+	// Units make and consume a message per value every cycle, so released messages are kept
+	// on a free list for their payload size and handed out again instead of reallocating.
+	static SerranoMessage* allocate( const size_t size ) {
+		std::vector<SerranoMessage*>& free_list = freeList( size );
+
+		if( free_list.empty() ) {
+			return new SerranoMessage( size );
+		}
+
+		SerranoMessage* msg = free_list.back();
+		free_list.pop_back();
+		return msg;
+	}
+
+	static SerranoMessage* allocate( const size_t size, void* ptr ) {
+		SerranoMessage* msg = allocate( size );
+		msg->setPayload( (uint8_t*) ptr );
+		return msg;
+	}
+
+	static void release( SerranoMessage* msg ) {
+		freeList( msg->getSize() ).push_back( msg );
+	}
+
 protected:
+	static std::vector<SerranoMessage*>& freeList( const size_t size ) {
+		static std::map< size_t, std::vector<SerranoMessage*> > free_lists;
+		return free_lists[size];
+	}
+
 	const size_t msg_size;
 	uint8_t* payload;
 
 };
 
 template<class T> SerranoMessage* constructMessage( T value ) {
-	SerranoMessage* new_msg = new SerranoMessage( sizeof(T) );
+	SerranoMessage* new_msg = SerranoMessage::allocate( sizeof(T) );
 	new_msg->setPayload( (uint8_t*) &value );
 
 	return new_msg;
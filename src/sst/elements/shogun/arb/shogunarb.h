@@ -17,6 +17,7 @@
 #define _H_SHOGUN_ARB_H
 
 #include "shogun_event.h"
+#include "shogun_port_set.h"
 #include "shogun_q.h"
 
 using namespace SST::Shogun;
@@ -32,11 +33,16 @@ namespace Shogun {
         ShogunArbitrator() {}
         virtual ~ShogunArbitrator() {}
 
+    // Only ports in occupiedInputs have events waiting.  Arbitrators
+    // must clear a port from occupiedInputs when its queue empties, and
+    // add the destination to pendingOutputs for every event moved.
     virtual void moveEvents(const int num_events,
                             const int port_count,
                             ShogunQueue<ShogunEvent*>** inputQueues,
                             int32_t output_slots,
                             ShogunEvent*** outputEvents,
+                            ShogunPortSet& occupiedInputs,
+                            ShogunPortSet& pendingOutputs,
                             uint64_t cycle )
                             = 0;
 
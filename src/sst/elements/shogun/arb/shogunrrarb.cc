@@ -33,16 +33,27 @@ void ShogunRoundRobinArbitrator::moveEvents(const int num_events,
                                             ShogunQueue<ShogunEvent*>** inputQueues,
                                             int32_t output_slots,
                                             ShogunEvent*** outputEvents,
+                                            ShogunPortSet& occupiedInputs,
+                                            ShogunPortSet& pendingOutputs,
                                             uint64_t cycle ) {
 
     output->verbose(CALL_INFO, 4, 0, "BEGIN: Arbitration --------------------------------------------------\n");
     output->verbose(CALL_INFO, 4, 0, "-> start: %" PRIi32 "\n", lastStart);
 
-    int32_t currentPort = lastStart;
     int32_t moved_count = 0;
 
-    // RR, so iterate through the ports one at a time and process num_events from the queue
-    for (int32_t i = 0; i < port_count; ++i) {
+    // RR, so iterate through the ports one at a time starting at lastStart and
+    // process num_events from the queue.  Empty queues would not move anything,
+    // so only the occupied ports are visited, in the same order.
+    int32_t currentPort = occupiedInputs.next(lastStart, port_count);
+    bool wrapped = false;
+
+    if (currentPort == port_count) {
+        currentPort = occupiedInputs.next(0, lastStart);
+        wrapped = true;
+    }
+
+    while (currentPort < (wrapped ? lastStart : port_count)) {
         auto nextQ = inputQueues[currentPort];
         output->verbose(CALL_INFO, 4, 0, "-> processing port: %" PRIi32 ", event-count: %" PRIi32 " out of %" PRIi32 "\n", currentPort,
                         nextQ->count(), num_events);
@@ -67,6 +78,7 @@ void ShogunRoundRobinArbitrator::moveEvents(const int num_events,
                         output->verbose(CALL_INFO, 4, 0, "  (%" PRIi32 ")-> moving event to remote queue\n", j);
                         pendingEv = inputQueues[currentPort]->pop();
                         outputEvents[pendingEv->getDestination()][k] = pendingEv;
+                        pendingOutputs.set(pendingEv->getDestination());
                         moved_count++;
 
                         break;
@@ -83,8 +95,22 @@ void ShogunRoundRobinArbitrator::moveEvents(const int num_events,
 
             ++j;
         }
-        // Increment to next port in sequence
-        currentPort = nextPort(port_count, currentPort);
+
+        if (inputQueues[currentPort]->empty()) {
+            occupiedInputs.clear(currentPort);
+        }
+
+        // Increment to next occupied port in sequence
+        if (wrapped) {
+            currentPort = occupiedInputs.next(currentPort + 1, lastStart);
+        } else {
+            currentPort = occupiedInputs.next(currentPort + 1, port_count);
+
+            if (currentPort == port_count) {
+                currentPort = occupiedInputs.next(0, lastStart);
+                wrapped = true;
+            }
+        }
     }
 
     lastStart = nextPort(port_count, lastStart);
@@ -33,6 +33,8 @@ namespace Shogun {
                         ShogunQueue<ShogunEvent*>** inputQueues,
                         int32_t output_slots,
                         ShogunEvent*** outputEvents,
+                        ShogunPortSet& occupiedInputs,
+                        ShogunPortSet& pendingOutputs,
                         uint64_t cycle ) override;
 
     private:
@@ -85,11 +85,17 @@ ShogunComponent::ShogunComponent(ComponentId_t id, Params& params)
     output->verbose(CALL_INFO, 1, 0, "Allocating pending input/output queues...\n" );
     inputQueues = (ShogunQueue<ShogunEvent*>**) malloc( sizeof(ShogunQueue<ShogunEvent*>*) * port_count );
     remote_output_slots = (int*) malloc( sizeof(int) * port_count );
+    pending_credits = new int32_t[port_count];
     pendingOutputs = new ShogunEvent**[port_count];
 
+    occupiedInputs.resize(port_count);
+    occupiedOutputs.resize(port_count);
+    creditPorts.resize(port_count);
+
     for (int32_t i = 0; i < port_count; ++i) {
         inputQueues[i] = new ShogunQueue<ShogunEvent*>( queue_slots );
         remote_output_slots[i] = 2;
+        pending_credits[i] = 0;
 
         pendingOutputs[i] = new ShogunEvent*[output_message_slots];
     }
@@ -122,6 +128,7 @@ ShogunComponent::~ShogunComponent()
     }
 
     delete [] pendingOutputs;
+    delete [] pending_credits;
 
     //TODO add accumulation of remainder of zero cycles
 }
@@ -145,7 +152,8 @@ bool ShogunComponent::tick(SST::Cycle_t currentCycle)
     printStatus();
 
     // Migrate events across the cross-bar
-    arb->moveEvents( input_message_slots, port_count, inputQueues, output_message_slots, pendingOutputs, static_cast<uint64_t>( currentCycle ) );
+    arb->moveEvents( input_message_slots, port_count, inputQueues, output_message_slots, pendingOutputs,
+        occupiedInputs, occupiedOutputs, static_cast<uint64_t>( currentCycle ) );
 
     printStatus();
 
@@ -214,8 +222,10 @@ void ShogunComponent::emitOutputs()
 {
     output->verbose(CALL_INFO, 4, 0, "BEGIN: emitOutputs -----------------------------------------------\n");
 
-    for (int32_t i = 0; i < port_count; ++i) {
+    // Only visit ports the arbitrator has moved events to
+    for (int32_t i = occupiedOutputs.next(0, port_count); i < port_count; i = occupiedOutputs.next(i + 1, port_count)) {
         output->verbose(CALL_INFO, 4, 0, "-> Processing port %" PRIi32 ":\n", i);
+        bool stillPending = false;
 
         for (uint32_t j = 0; j < output_message_slots; ++j) {
             if( nullptr != pendingOutputs[i][j] ) {
@@ -226,16 +236,30 @@ void ShogunComponent::emitOutputs()
                     output->verbose(CALL_INFO, 4, 0, "    -> sending event (has entry and free %" PRIi32 " slots)\n", remote_output_slots[i]);
                     stats->getOutputPacketCount(i)->addData(1);
 
+                    const int32_t src = pendingOutputs[i][j]->getSource();
                     links[i]->send( pendingOutputs[i][j] );
-                    links[ pendingOutputs[i][j]->getSource() ]->send( new ShogunCreditEvent() );
+                    pending_credits[src]++;
+                    creditPorts.set(src);
                     pendingOutputs[i][j] = nullptr;
                     remote_output_slots[i]--;
                     pending_events--;
                 } else {
                     output->verbose(CALL_INFO, 4, 0, "    -> no free slots, event send disabled for this round (slots: %" PRIi32 ")\n", remote_output_slots[i]);
+                    stillPending = true;
                 }
             }
         }
+
+        if (!stillPending) {
+            occupiedOutputs.clear(i);
+        }
+    }
+
+    // Return the input queue slots freed this cycle, one event per port
+    for (int32_t i = creditPorts.next(0, port_count); i < port_count; i = creditPorts.next(i + 1, port_count)) {
+        links[i]->send( new ShogunCreditEvent(i, pending_credits[i]) );
+        pending_credits[i] = 0;
+        creditPorts.clear(i);
     }
 
     output->verbose(CALL_INFO, 4, 0, "END: emitOutputs -------------------------------------------------\n");
@@ -250,6 +274,8 @@ void ShogunComponent::clearOutputs()
 
         remote_output_slots[i] = inputQueues[i]->capacity();
     }
+
+    occupiedOutputs.resize(port_count);
 }
 
 void ShogunComponent::clearInputs()
@@ -257,10 +283,17 @@ void ShogunComponent::clearInputs()
     for (int32_t i = 0; i < port_count; ++i) {
         inputQueues[i]->clear();
     }
+
+    occupiedInputs.resize(port_count);
 }
 
 void ShogunComponent::printStatus()
 {
+    // Every line is at verbose level 4, so skip the walk over all the ports
+    if (output->getVerboseLevel() < 4) {
+        return;
+    }
+
     output->verbose(CALL_INFO, 4, 0, "BEGIN: processing x-bar inputs -----------------------------------------------\n");
     output->verbose(CALL_INFO, 4, 0, "BEGIN X-BAR STATUS REPORT ====================================================\n");
 
@@ -296,6 +329,7 @@ void ShogunComponent::handleIncoming(SST::Event* event)
             incomingShogunEv->getPayload()->dest);
 
         inputQueues[src_port]->push(incomingShogunEv);
+        occupiedInputs.set(src_port);
         pending_events++;
         stats->getInputPacketCount(src_port)->addData(1);
 
@@ -312,7 +346,7 @@ void ShogunComponent::handleIncoming(SST::Event* event)
             const int src_port = creditEv->getSrc();
 
             output->verbose(CALL_INFO, 4, 0, "-> recv-credit from %" PRIi32 "\n", src_port);
-            remote_output_slots[src_port]++;
+            remote_output_slots[src_port] += creditEv->getCredits();
         } else {
             output->fatal(CALL_INFO, -1, "Error: received a non-shogun compatible event.\n");
         }
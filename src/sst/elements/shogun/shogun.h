@@ -23,6 +23,7 @@
 
 #include "arb/shogunarb.h"
 #include "shogun_event.h"
+#include "shogun_port_set.h"
 #include "shogun_q.h"
 
 namespace SST {
@@ -110,6 +111,13 @@ private:
     int32_t* remote_output_slots;
     ShogunArbitrator* arb;
 
+    // Ports with events in their input queue, ports with events waiting in
+    // pendingOutputs, and ports owed credits from this cycle's sends
+    ShogunPortSet occupiedInputs;
+    ShogunPortSet occupiedOutputs;
+    ShogunPortSet creditPorts;
+    int32_t* pending_credits;
+
     SST::Output* output;
     Statistic<uint64_t>* zeroEventCycles;
     Statistic<uint64_t>* eventCycles;
@@ -17,6 +17,7 @@
 #define _H_SHOGUN_INC_CREDIT_EVENT
 
 #include <sst/core/event.h>
+#include <sst/elements/pool/objectPool.h>
 
 namespace SST {
 namespace Shogun {
@@ -26,30 +27,43 @@ namespace Shogun {
     public:
         ShogunCreditEvent()
             : sourcePort(0)
+            , credits(1)
         {
         }
-        ShogunCreditEvent(const int source)
+        ShogunCreditEvent(const int source, const int creditCount = 1)
             : sourcePort(source)
+            , credits(creditCount)
         {
         }
         ~ShogunCreditEvent() {}
 
+        SST_ELEMENT_POOL_OPERATORS(SST::Shogun::ShogunCreditEvent)
+
         int getSrc() const
         {
             return sourcePort;
         }
 
+        // The crossbar returns all the credits for a port freed in a
+        // cycle with a single event
+        int getCredits() const
+        {
+            return credits;
+        }
+
         void serialize_order(SST::Core::Serialization::serializer& ser) override
         {
             Event::serialize_order(ser);
 
             ser& sourcePort;
+            ser& credits;
         }
 
         ImplementSerializable(SST::Shogun::ShogunCreditEvent);
 
     protected:
         int sourcePort;
+        int credits;
     };
 
 }
@@ -18,6 +18,7 @@
 
 #include <sst/core/event.h>
 #include <sst/core/interfaces/simpleNetwork.h>
+#include <sst/elements/pool/objectPool.h>
 
 using namespace SST::Interfaces;
 
@@ -55,6 +56,9 @@ namespace Shogun {
             }
         }
 
+        // Created for every packet crossing the crossbar
+        SST_ELEMENT_POOL_OPERATORS(SST::Shogun::ShogunEvent)
+
         ShogunEvent* clone() override
         {
             ShogunEvent* newEv = new ShogunEvent(dest, src);
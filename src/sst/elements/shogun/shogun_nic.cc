@@ -246,11 +246,15 @@ void ShogunNIC::recvLinkEvent(SST::Event* ev)
                 onRecvFunctor = nullptr;
             }
         }
+
+        // The request now belongs to reqQ
+        inEv->unlinkPayload();
+        delete inEv;
     } else {
         ShogunCreditEvent* creditEv = dynamic_cast<ShogunCreditEvent*>(ev);
 
         if (nullptr != creditEv) {
-            remote_input_slots++;
+            remote_input_slots += creditEv->getCredits();
             output->verbose(CALL_INFO, 8, 0, "Recv link credit event, remote_input_slots now set to: %5" PRIi32 "\n", remote_input_slots);
         } else {
             ShogunInitEvent* initEv = dynamic_cast<ShogunInitEvent*>(ev);
@@ -0,0 +1,102 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_SHOGUN_PORT_SET
+#define _H_SHOGUN_PORT_SET
+
+#include <stdint.h>
+#include <vector>
+
+namespace SST {
+namespace Shogun {
+
+    // Bitset over the crossbar ports, used to track which input queues
+    // and output slots have events so each cycle only visits those
+    // ports instead of all of them.
+    class ShogunPortSet {
+
+    public:
+        ShogunPortSet()
+            : port_count(0)
+        {
+        }
+
+        void resize(const int ports)
+        {
+            port_count = ports;
+            words.assign((ports + 63) / 64, 0);
+        }
+
+        void set(const int port)
+        {
+            words[port >> 6] |= (uint64_t)1 << (port & 63);
+        }
+
+        void clear(const int port)
+        {
+            words[port >> 6] &= ~((uint64_t)1 << (port & 63));
+        }
+
+        bool test(const int port) const
+        {
+            return (words[port >> 6] >> (port & 63)) & 1;
+        }
+
+        bool empty() const
+        {
+            for (uint64_t w : words) {
+                if (w != 0) {
+                    return false;
+                }
+            }
+            return true;
+        }
+
+        // First port in [from, end) which is set, or end if there is
+        // none
+        int next(const int from, const int end) const
+        {
+            if (from >= end) {
+                return end;
+            }
+
+            int w = from >> 6;
+            uint64_t bits = words[w] & (~(uint64_t)0 << (from & 63));
+
+            while (bits == 0) {
+                if (++w >= (int)words.size()) {
+                    return end;
+                }
+                bits = words[w];
+            }
+
+            const int port = (w << 6) + __builtin_ctzll(bits);
+            return port < end ? port : end;
+        }
+
+        int size() const
+        {
+            return port_count;
+        }
+
+    private:
+        int port_count;
+        std::vector<uint64_t> words;
+    };
+
+}
+}
+
+#endif
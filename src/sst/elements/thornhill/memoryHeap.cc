@@ -17,11 +17,13 @@
 #include "sst_config.h"
 #include <sst/core/link.h>
 
+#include <map>
 #include <sstream>
 
 #include "sst/elements/thornhill/memoryHeapEvent.h"
 
 #include "memoryHeap.h"
+#include "sst/elements/thornhill/nodeMemoryHeap.h"
 
 using namespace SST;
 using namespace SST::Thornhill;
@@ -77,3 +79,16 @@ void MemoryHeap::eventHandler( Event* ev, int src ) {
 
 	m_links[src]->send(0,event);
 }
+
+NodeMemoryHeap* NodeMemoryHeap::get( int nid )
+{
+	static std::mutex mutex;
+	static std::map< int, NodeMemoryHeap* > heaps;
+
+	std::lock_guard<std::mutex> lock( mutex );
+	NodeMemoryHeap*& heap = heaps[nid];
+	if ( ! heap ) {
+		heap = new NodeMemoryHeap;
+	}
+	return heap;
+}
@@ -21,6 +21,7 @@
 #include "sst/core/subcomponent.h"
 #include "sst/core/link.h"
 #include "sst/elements/thornhill/memoryHeapEvent.h"
+#include "sst/elements/thornhill/nodeMemoryHeap.h"
 
 namespace SST {
 namespace Thornhill {
@@ -37,6 +38,14 @@ class MemoryHeapLink : public SubComponent {
         "",
 		SST::Thornhill::MemoryHeapLink
     )
+	SST_ELI_DOCUMENT_PARAMS(
+		{"local","Allocate from a heap shared by the node's links instead of a MemoryHeap component","false"},
+		{"nid","Sets the node ID, required when local","-1"},
+		{"latency","Sets the latency of a local allocation","0ps"},
+	)
+    SST_ELI_DOCUMENT_PORTS(
+        {"memoryHeap", "Port connected to the Memory Heap, unused when local", {}},
+    )
 
 	struct Entry {
 		Entry( std::function<void(uint64_t)> _fini ) : fini( _fini ) {}
@@ -44,11 +53,24 @@ class MemoryHeapLink : public SubComponent {
 	};
 
   public:
-    MemoryHeapLink( ComponentId_t id, Params& params ) : SubComponent(id)
+    MemoryHeapLink( ComponentId_t id, Params& params ) : SubComponent(id), m_heap(NULL)
 	{
-		m_link = configureLink( "memoryHeap", "0ps",
-            new Event::Handler<MemoryHeapLink>(
-                    this,&MemoryHeapLink::eventHandler ) );
+		if ( params.find<bool>("local", false) ) {
+			int nid = params.find<int>("nid", -1);
+			if ( -1 == nid ) {
+				getSimulationOutput().fatal(CALL_INFO,-1,"MemoryHeapLink: local requires nid\n");
+			}
+			m_heap = NodeMemoryHeap::get( nid );
+
+			// the one event left per allocation is the return to the caller
+			m_link = configureSelfLink( "memoryHeapLocal", params.find<std::string>("latency", "0ps"),
+				new Event::Handler<MemoryHeapLink>(
+						this,&MemoryHeapLink::eventHandler ) );
+		} else {
+			m_link = configureLink( "memoryHeap", "0ps",
+				new Event::Handler<MemoryHeapLink>(
+						this,&MemoryHeapLink::eventHandler ) );
+		}
         assert(m_link);
 	}
 
@@ -64,6 +86,9 @@ class MemoryHeapLink : public SubComponent {
 		event->type = MemoryHeapEvent::Alloc;
 		event->length = length;
 
+		if ( m_heap ) {
+			event->addr = m_heap->alloc( length );
+		}
 		m_link->send(0, event );
 	}
 
@@ -75,6 +100,9 @@ class MemoryHeapLink : public SubComponent {
 		event->type = MemoryHeapEvent::Free;
 		event->addr = addr;
 
+		if ( m_heap ) {
+			getSimulationOutput().fatal(CALL_INFO,-1,"MemoryHeapLink: free is not supported\n");
+		}
 		m_link->send(0, event );
 	}
 
@@ -89,6 +117,7 @@ class MemoryHeapLink : public SubComponent {
 		delete ev;
 	}
     Link*  m_link;
+	NodeMemoryHeap* m_heap;
 };
 
 
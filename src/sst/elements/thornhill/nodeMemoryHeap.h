@@ -0,0 +1,51 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_THORNHILL_NODE_MEMORY_HEAP
+#define _H_THORNHILL_NODE_MEMORY_HEAP
+
+#include <stddef.h>
+#include <mutex>
+
+#include "sst/elements/thornhill/types.h"
+
+namespace SST {
+namespace Thornhill {
+
+// The heap of one node as a plain object, for MemoryHeapLinks that allocate
+// locally instead of sending to a MemoryHeap component. All the links of a
+// node share it, so they must be in the same process. It hands out
+// addresses the same way as MemoryHeap.
+class NodeMemoryHeap {
+  public:
+	static NodeMemoryHeap* get( int nid );
+
+	SimVAddr alloc( size_t length ) {
+		std::lock_guard<std::mutex> lock( m_mutex );
+		SimVAddr addr = m_currentVaddr;
+		m_currentVaddr += length;
+		return addr;
+	}
+
+  private:
+	NodeMemoryHeap() : m_currentVaddr( 0x1000 ) {}
+
+	std::mutex  m_mutex;
+	SimVAddr    m_currentVaddr;
+};
+
+}
+}
+#endif
@@ -18,18 +18,23 @@
 
 #include <cassert>
 #include <cstddef>
+#include <cstdint>
 #include <deque>
 #include <bitset>
 
 namespace SST {
 namespace Vanadis {
 
+// Each slot also carries a 64bit tag, zeroed when an item is pushed into it,
+// which the owner can use to keep state of the item packed alongside it so
+// that walking the queue does not have to touch every item
 template <typename T>
 class VanadisCircularQueue
 {
 public:
     VanadisCircularQueue(const int size) : max_capacity(size) {
         data = new T[size];
+        tags = new uint64_t[size];
         clear();
 
         std::bitset<32> size_bits(size);
@@ -39,6 +44,7 @@ public:
 
     ~VanadisCircularQueue() {
         delete[] data;
+        delete[] tags;
     }
 
     bool empty() const { return 0 == count; }
@@ -48,6 +54,7 @@ public:
         assert(count < max_capacity);
 
         data[tail] = item;
+        tags[tail] = 0;
         tail = incrementIndex(tail);
         count++;
     }
@@ -64,6 +71,16 @@ public:
         return data[calculateIndex(index)];
     }
 
+    uint64_t tagAt(const size_t index) const {
+        assert(index < count);
+        return tags[calculateIndex(index)];
+    }
+
+    void setTagAt(const size_t index, const uint64_t tag) {
+        assert(index < count);
+        tags[calculateIndex(index)] = tag;
+    }
+
     T pop()
     {
         assert(count > 0);
@@ -99,6 +116,7 @@ private:
     int count;
 
     T* data;
+    uint64_t* tags;
 
     bool max_power_two;
     int bit_mask;
@@ -0,0 +1,337 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_VANADIS_ISSUE_QUEUE
+#define _H_VANADIS_ISSUE_QUEUE
+
+#include "datastruct/cqueue.h"
+#include "inst/vinst.h"
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <deque>
+#include <vector>
+
+namespace SST {
+namespace Vanadis {
+
+/*
+ * Wakeup-based issue queue for one hardware thread.
+ *
+ * Mirrors the thread's ROB and keeps, for every un-issued instruction, the
+ * hazards that the ROB scan in performIssue would find against it:
+ *
+ *  - RAW/WAW: an older instruction still in the ROB writes one of its ISA
+ *    registers. Only the youngest such writer matters because the ROB
+ *    retires in order, so the instruction sits on that writer's consumer
+ *    list until it retires.
+ *  - WAR: an older instruction which had not issued at the start of the
+ *    cycle reads one of its output registers. Readers wake the writers
+ *    behind them on each register at the start of the cycle after they
+ *    issue.
+ *  - Memory ordering: loads, stores and fences issue in program order, so
+ *    only the oldest un-issued memory operation can be ready.
+ *
+ * Hazards are tracked on ISA registers because that is what the issue
+ * tables lock until retirement; physical registers are only assigned at
+ * issue. Instructions with no hazards left are marked in a ready bitmap
+ * indexed by ROB slot, so selection walks only ready instructions, oldest
+ * first, and the caller applies the per-cycle checks (free physical
+ * registers, functional units).
+ *
+ * The decoders push into the ROB directly, so new entries are picked up by
+ * beginCycle(). The core must call retire() for every instruction popped
+ * from the ROB head and clear() whenever the ROB is cleared.
+ */
+class VanadisIssueQueue
+{
+public:
+    static constexpr uint64_t NONE = UINT64_MAX;
+
+    VanadisIssueQueue(const uint32_t rob_capacity, const uint16_t isa_int_regs, const uint16_t isa_fp_regs) :
+        capacity(rob_capacity),
+        int_reg_count(isa_int_regs),
+        entries(rob_capacity),
+        ready((rob_capacity + 63) / 64, 0),
+        last_writer(isa_int_regs + isa_fp_regs, 0),
+        unissued_readers(isa_int_regs + isa_fp_regs, 0),
+        writers(isa_int_regs + isa_fp_regs)
+    {
+        head_seq = 1;
+        next_seq = 1;
+    }
+
+    size_t size() const { return next_seq - head_seq; }
+
+    // Release the readers issued last cycle and pick up the instructions the
+    // decoder has pushed into the ROB since the last call
+    void beginCycle(VanadisCircularQueue<VanadisInstruction*>* rob)
+    {
+        for ( const uint64_t seq : woken_readers ) {
+            Entry& e = entry(seq);
+            if ( e.seq == seq && e.wake_pending ) { wakeWriters(e); }
+        }
+        woken_readers.clear();
+
+        assert(rob->size() >= size());
+
+        for ( size_t i = size(); i < rob->size(); ++i ) {
+            dispatch(rob->peekAt(i));
+        }
+    }
+
+    // The instruction at the ROB head has retired
+    void retire()
+    {
+        assert(head_seq < next_seq);
+
+        Entry& e = entry(head_seq);
+        assert(e.issued);
+
+        if ( e.wake_pending ) { wakeWriters(e); }
+
+        for ( const uint16_t reg : e.regs_out ) {
+            assert(!writers[reg].empty() && writers[reg].front() == e.seq);
+            writers[reg].pop_front();
+        }
+
+        head_seq++;
+
+        for ( const uint64_t consumer : e.consumers ) {
+            Entry& c = entry(consumer);
+            if ( c.seq == consumer ) {
+                c.raw_ready = true;
+                updateReady(c);
+            }
+        }
+
+        e.consumers.clear();
+    }
+
+    // The ROB has been cleared (pipeline flush or thread reset)
+    void clear()
+    {
+        head_seq = next_seq;
+
+        std::fill(ready.begin(), ready.end(), 0);
+        std::fill(last_writer.begin(), last_writer.end(), 0);
+        std::fill(unissued_readers.begin(), unissued_readers.end(), 0);
+
+        for ( auto& next_writers : writers ) {
+            next_writers.clear();
+        }
+
+        for ( auto& next_entry : entries ) {
+            next_entry.consumers.clear();
+            next_entry.seq = 0;
+        }
+
+        memory_order.clear();
+        woken_readers.clear();
+    }
+
+    // Oldest ready instruction, or NONE
+    uint64_t firstReady() const { return findReady(head_seq); }
+
+    // Next ready instruction younger than seq, or NONE
+    uint64_t nextReady(const uint64_t seq) const { return findReady(seq + 1); }
+
+    VanadisInstruction* getInstruction(const uint64_t seq) { return entry(seq).ins; }
+
+    void markIssued(const uint64_t seq)
+    {
+        Entry& e = entry(seq);
+        assert(e.seq == seq && !e.issued);
+
+        e.issued = true;
+        clearReady(seq);
+
+        if ( e.memory ) {
+            assert(memory_order.front() == seq);
+            memory_order.pop_front();
+
+            if ( !memory_order.empty() ) { updateReady(entry(memory_order.front())); }
+        }
+
+        // the scan still sees this instruction as an un-issued reader for the
+        // rest of the cycle, so writers behind it are only woken next cycle
+        if ( !e.regs_in.empty() ) {
+            e.wake_pending = true;
+            woken_readers.push_back(seq);
+        }
+    }
+
+private:
+    struct Entry
+    {
+        VanadisInstruction* ins = nullptr;
+        uint64_t            seq = 0;
+
+        // youngest older writer of any register this instruction uses
+        uint64_t raw_dep     = 0;
+        uint32_t war_pending = 0;
+
+        bool raw_ready    = false;
+        bool memory       = false;
+        bool issued       = false;
+        bool wake_pending = false;
+
+        // distinct registers, FP registers are offset by the int register count
+        std::vector<uint16_t> regs_in;
+        std::vector<uint16_t> regs_out;
+
+        // instructions waiting for this one to retire
+        std::vector<uint64_t> consumers;
+    };
+
+    Entry& entry(const uint64_t seq) { return entries[seq % capacity]; }
+
+    void dispatch(VanadisInstruction* ins)
+    {
+        const uint64_t seq = next_seq++;
+        Entry&         e   = entry(seq);
+
+        e.ins          = ins;
+        e.seq          = seq;
+        e.raw_dep      = 0;
+        e.war_pending  = 0;
+        e.issued       = false;
+        e.wake_pending = false;
+        e.consumers.clear();
+
+        const auto func_type = ins->getInstFuncType();
+        e.memory = (func_type == INST_LOAD || func_type == INST_STORE || func_type == INST_FENCE);
+
+        e.regs_in.clear();
+        for ( uint16_t i = 0; i < ins->countISAIntRegIn(); ++i ) {
+            addDistinct(e.regs_in, ins->getISAIntRegIn(i));
+        }
+        for ( uint16_t i = 0; i < ins->countISAFPRegIn(); ++i ) {
+            addDistinct(e.regs_in, int_reg_count + ins->getISAFPRegIn(i));
+        }
+
+        e.regs_out.clear();
+        for ( uint16_t i = 0; i < ins->countISAIntRegOut(); ++i ) {
+            addDistinct(e.regs_out, ins->getISAIntRegOut(i));
+        }
+        for ( uint16_t i = 0; i < ins->countISAFPRegOut(); ++i ) {
+            addDistinct(e.regs_out, int_reg_count + ins->getISAFPRegOut(i));
+        }
+
+        for ( const uint16_t reg : e.regs_in ) {
+            e.raw_dep = std::max(e.raw_dep, last_writer[reg]);
+        }
+
+        for ( const uint16_t reg : e.regs_out ) {
+            e.raw_dep = std::max(e.raw_dep, last_writer[reg]);
+            e.war_pending += unissued_readers[reg];
+        }
+
+        for ( const uint16_t reg : e.regs_in ) {
+            unissued_readers[reg]++;
+        }
+
+        for ( const uint16_t reg : e.regs_out ) {
+            last_writer[reg] = seq;
+            writers[reg].push_back(seq);
+        }
+
+        e.raw_ready = (e.raw_dep < head_seq);
+        if ( !e.raw_ready ) { entry(e.raw_dep).consumers.push_back(seq); }
+
+        if ( e.memory ) { memory_order.push_back(seq); }
+
+        updateReady(e);
+    }
+
+    void wakeWriters(Entry& e)
+    {
+        e.wake_pending = false;
+
+        for ( const uint16_t reg : e.regs_in ) {
+            unissued_readers[reg]--;
+
+            // every writer younger than the reader counted it when dispatched
+            const auto& reg_writers = writers[reg];
+            for ( auto it = reg_writers.rbegin(); it != reg_writers.rend() && (*it) > e.seq; ++it ) {
+                Entry& w = entry(*it);
+                assert(w.war_pending > 0);
+                w.war_pending--;
+                updateReady(w);
+            }
+        }
+    }
+
+    void updateReady(Entry& e)
+    {
+        if ( !e.issued && e.raw_ready && (0 == e.war_pending) &&
+             (!e.memory || memory_order.front() == e.seq) ) {
+            const uint64_t slot = e.seq % capacity;
+            ready[slot / 64] |= (UINT64_C(1) << (slot % 64));
+        }
+    }
+
+    void clearReady(const uint64_t seq)
+    {
+        const uint64_t slot = seq % capacity;
+        ready[slot / 64] &= ~(UINT64_C(1) << (slot % 64));
+    }
+
+    uint64_t findReady(uint64_t seq) const
+    {
+        while ( seq < next_seq ) {
+            const uint64_t slot = seq % capacity;
+            const uint64_t bit  = slot % 64;
+            const uint64_t bits = ready[slot / 64] >> bit;
+
+            if ( bits != 0 ) {
+                seq += __builtin_ctzll(bits);
+                return (seq < next_seq) ? seq : NONE;
+            }
+
+            // move to the next word, or wrap to slot 0
+            seq += std::min<uint64_t>(64 - bit, capacity - slot);
+        }
+
+        return NONE;
+    }
+
+    static void addDistinct(std::vector<uint16_t>& regs, const uint16_t reg)
+    {
+        if ( std::find(regs.begin(), regs.end(), reg) == regs.end() ) { regs.push_back(reg); }
+    }
+
+    const uint64_t capacity;
+    const uint16_t int_reg_count;
+
+    uint64_t head_seq;
+    uint64_t next_seq;
+
+    std::vector<Entry>    entries;
+    std::vector<uint64_t> ready;
+
+    std::vector<uint64_t>             last_writer;
+    std::vector<uint32_t>             unissued_readers;
+    std::vector<std::deque<uint64_t>> writers;
+
+    std::deque<uint64_t> memory_order;
+    std::vector<uint64_t> woken_readers;
+};
+
+} // namespace Vanadis
+} // namespace SST
+
+#endif
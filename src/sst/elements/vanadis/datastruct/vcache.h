@@ -16,10 +16,11 @@
 #ifndef _H_VANADIS_CACHE
 #define _H_VANADIS_CACHE
 
+#include <algorithm>
 #include <cstdint>
-#include <list>
+#include <functional>
 #include <type_traits>
-#include <unordered_map>
+#include <vector>
 
 namespace SST {
 namespace Vanadis {
@@ -30,116 +31,213 @@ enum class VanadisCacheRecordDeletion {
     VANADIS_PERFORM_DELETE_ARRAY
 };
 
+/*
+ * Fixed capacity LRU cache. Entries live in a pool allocated up front and are
+ * linked into the LRU order by index, keys are found through an open
+ * addressed table of pool indices. find, store and touch are constant time
+ * and nothing is allocated after construction.
+ */
 template <typename I, typename T, SST::Vanadis::VanadisCacheRecordDeletion D> class VanadisCache {
 public:
-    VanadisCache(const size_t cache_entries) : max_entries(cache_entries) { reset(); }
+    VanadisCache(const size_t cache_entries) : max_entries(cache_entries) {
+        size_t slot_count = 1;
+
+        // keep the table at most half full so probe sequences stay short
+        while (slot_count < (2 * max_entries)) {
+            slot_count <<= 1;
+        }
+
+        entries.resize(max_entries);
+        slots.resize(slot_count, NIL);
+        slot_mask = slot_count - 1;
+        used = 0;
+        head = NIL;
+        tail = NIL;
+
+        reset();
+    }
 
     ~VanadisCache() {
         clear();
     }
 
     void clear() {
-        for (auto val_itr = data_values.begin(); val_itr != data_values.end(); val_itr++ ) {
-            switch(D) {
-                case SST::Vanadis::VanadisCacheRecordDeletion::VANADIS_PERFORM_DELETE: 
-                {
-                    delete val_itr->second;
-                } break;
-                case SST::Vanadis::VanadisCacheRecordDeletion::VANADIS_PERFORM_DELETE_ARRAY:
-                {
-                    delete[] val_itr->second;
-                } break;
-                case SST::Vanadis::VanadisCacheRecordDeletion::VANADIS_NO_DELETION:
-                {} break;
-            }
+        for (uint32_t i = head; i != NIL; i = entries[i].next) {
+            delete_value(entries[i].value);
         }
 
-        ordering_q.clear();
-        data_values.clear();
+        std::fill(slots.begin(), slots.end(), NIL);
+
+        head = NIL;
+        tail = NIL;
+        used = 0;
     }
 
     void reset() {
         clear();
-        data_values.reserve(max_entries);
     }
 
-    bool contains(const I& value) const { return (data_values.find(value) != data_values.end()); }
+    bool contains(const I& value) const { return (NIL != slots[find_slot(value)]); }
 
     T find(const I& key) {
-        send_key_to_front(key);
-        return data_values.find(key)->second;
+        const uint32_t index = slots[find_slot(key)];
+        send_to_front(index);
+        return entries[index].value;
     }
 
     void store(const I& key, T value) {
-        if (LIKELY(contains(key))) {
-            send_key_to_front(key);
-	        data_values[key] = value;
+        const size_t slot = find_slot(key);
+
+        if (LIKELY(NIL != slots[slot])) {
+            send_to_front(slots[slot]);
+            entries[slots[slot]].value = value;
         } else {
-            kill_lru_key();
-            data_values.insert(std::pair<I, T>(key, value));
-            ordering_q.push_front(key);
+            if (UNLIKELY(0 == max_entries)) {
+                delete_value(value);
+                return;
+            }
+
+            uint32_t index;
+
+            // if we aren't full yet take the next unused entry, otherwise
+            // the least recently used one is thrown away and reused
+            if (LIKELY(used == max_entries)) {
+                index = tail;
+                delete_value(entries[index].value);
+                unlink(index);
+                erase_slot(find_slot(entries[index].key));
+            } else {
+                index = static_cast<uint32_t>(used++);
+            }
+
+            entries[index].key   = key;
+            entries[index].value = value;
+            push_front(index);
+
+            // erasing may have moved entries, look the slot up again
+            slots[find_slot(key)] = index;
         }
     }
 
     void touch(const I& key) {
-        if (LIKELY(contains(key))) {
-            send_key_to_front(key);
+        const uint32_t index = slots[find_slot(key)];
+
+        if (LIKELY(NIL != index)) {
+            send_to_front(index);
         }
     }
 
-    size_t size() const { return data_values.size(); }
+    size_t size() const { return used; }
     size_t capacity() const { return max_entries; }
 
 private:
-    void kill_lru_key() {
-        // if we aren't full yet, then keep entries otherwise we will
-        // throw away
-        if (UNLIKELY(ordering_q.size() < max_entries)) {
-            return;
-        }
+    static constexpr uint32_t NIL = UINT32_MAX;
 
-        const I remove_key = ordering_q.back();
-        ordering_q.pop_back();
-
-        auto find_key = data_values.find(remove_key);
+    struct Entry {
+        I        key;
+        T        value;
+        uint32_t prev;
+        uint32_t next;
+    };
 
+    static void delete_value(T value) {
         switch(D) {
             case SST::Vanadis::VanadisCacheRecordDeletion::VANADIS_PERFORM_DELETE: 
             {
-                delete find_key->second;
+                delete value;
             } break;
             case SST::Vanadis::VanadisCacheRecordDeletion::VANADIS_PERFORM_DELETE_ARRAY:
             {
-                delete[] find_key->second;
+                delete[] value;
             } break;
             case SST::Vanadis::VanadisCacheRecordDeletion::VANADIS_NO_DELETION:
             {} break;
         }
+    }
+
+    // slot holding key, or the empty slot where it would be inserted
+    size_t find_slot(const I& key) const {
+        size_t slot = hash_slot(key);
+
+        while ((NIL != slots[slot]) && !(entries[slots[slot]].key == key)) {
+            slot = (slot + 1) & slot_mask;
+        }
 
-        data_values.erase(find_key);
+        return slot;
     }
 
-    void send_key_to_front(const I& key) {
-        bool found_key = false;
+    size_t hash_slot(const I& key) const {
+        // mix the bits, std::hash of an integer is the identity and the keys
+        // here are aligned addresses
+        uint64_t h = static_cast<uint64_t>(std::hash<I>()(key));
+        h ^= h >> 33;
+        h *= 0xff51afd7ed558ccdULL;
+        h ^= h >> 33;
+        return static_cast<size_t>(h) & slot_mask;
+    }
 
-        for (auto order_itr = ordering_q.begin(); order_itr != ordering_q.end();) {
-            if (UNLIKELY(key == (*order_itr))) {
-                ordering_q.erase(order_itr);
-                found_key = true;
-                break;
-            } else {
-                order_itr++;
+    // linear probing deletion, shift later members of the probe run back so
+    // no lookup stops early at the hole
+    void erase_slot(size_t slot) {
+        size_t next = (slot + 1) & slot_mask;
+
+        while (NIL != slots[next]) {
+            const size_t home = hash_slot(entries[slots[next]].key);
+
+            if (((next - home) & slot_mask) >= ((next - slot) & slot_mask)) {
+                slots[slot] = slots[next];
+                slot        = next;
             }
+
+            next = (next + 1) & slot_mask;
+        }
+
+        slots[slot] = NIL;
+    }
+
+    void unlink(const uint32_t index) {
+        Entry& entry = entries[index];
+
+        if (NIL != entry.prev) {
+            entries[entry.prev].next = entry.next;
+        } else {
+            head = entry.next;
         }
 
-        if (LIKELY(found_key)) {
-            ordering_q.push_front(key);
+        if (NIL != entry.next) {
+            entries[entry.next].prev = entry.prev;
+        } else {
+            tail = entry.prev;
+        }
+    }
+
+    void push_front(const uint32_t index) {
+        entries[index].prev = NIL;
+        entries[index].next = head;
+
+        if (NIL != head) {
+            entries[head].prev = index;
+        } else {
+            tail = index;
+        }
+
+        head = index;
+    }
+
+    void send_to_front(const uint32_t index) {
+        if (head != index) {
+            unlink(index);
+            push_front(index);
         }
     }
 
-    const size_t max_entries;
-    std::list<I> ordering_q;
-    std::unordered_map<I, T> data_values;
+    const size_t          max_entries;
+    std::vector<Entry>    entries;
+    std::vector<uint32_t> slots;
+    size_t                slot_mask;
+    size_t                used;
+    uint32_t              head;
+    uint32_t              tail;
 };
 
 } // namespace Vanadis
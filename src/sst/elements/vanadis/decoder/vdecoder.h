@@ -24,6 +24,9 @@
 #include "lsq/vlsq.h"
 #include "os/vcpuos.h"
 #include "vbranch/vbranchbasic.h"
+#include "vbranch/vbranchgshare.h"
+#include "vbranch/vbranchperceptron.h"
+#include "vbranch/vbranchtage.h"
 #include "vbranch/vbranchunit.h"
 #include "velf/velfinfo.h"
 #include "vinsloader.h"
@@ -49,7 +52,11 @@
           "micro-ops",                                                                                \
           "uops", 1 },                                                                                \
         { "ins_bytes_loaded", "Count the number of bytes loaded for decode operations", "bytes", 1 }, \
+        { "uop_block_cache_hit", "Count number of lookups which find a decoded basic block in the block cache (loader_mode 2)", "hits", 1 }, \
+        { "uop_block_cache_miss", "Count number of basic blocks which are decoded into the block cache (loader_mode 2)", "misses", 1 }, \
+        { "uop_block_cache_evict", "Count number of decoded basic blocks evicted from the block cache (loader_mode 2)", "blocks", 1 }, \
         { "uop_delayed_rob_full", "Number of times a micro-op cannot be added to the ROB because it is full.", "cycles", 1 }, \
+        { "ins_pairs_fused", "Count number of instruction pairs decoded into a single fused micro-op (fuse_ins_pairs)", "pairs", 1 }, \
     {                                                                                                 \
         "uops_generated",                                                                             \
             "Count number of micro-ops generated by decoder that are transfered to "                  \
@@ -79,7 +86,15 @@ public:
                               "Number of cache lines to store in the local L0 cache for instructions "
                               "pending decoding.", "4" },
                             { "loader_mode",
-                              "Operation of the loader, 0 = LRU (more accurate), 1 = INFINITE cache (faster simulation)", "0"})
+                              "Operation of the loader, 0 = LRU (more accurate), 1 = INFINITE cache (faster simulation), "
+                              "2 = set-associative cache of decoded basic blocks", "0"},
+                            { "block_cache_sets", "Number of sets in the decoded block cache (loader_mode 2)", "64" },
+                            { "block_cache_ways", "Number of ways per set in the decoded block cache, at least 2 (loader_mode 2)", "4" },
+                            { "block_cache_max_length",
+                              "Maximum number of instructions in one decoded block, blocks also end at a branch (loader_mode 2)", "16" },
+                            { "fuse_ins_pairs",
+                              "Decode common pairs of instructions which build one result (such as a load-upper-immediate "
+                              "followed by an add-immediate) into a single fused micro-op when both are in the predecode cache", "0" })
 
     SST_ELI_DOCUMENT_STATISTICS( 
 				VANADIS_DECODER_ELI_STATISTICS
@@ -91,9 +106,11 @@ public:
         tls_ptr = 0;
 
         thread_rob = nullptr;
+        ins_ring   = nullptr;
 		  fpflags = nullptr;
 
         icache_line_width = params.find<uint64_t>("icache_line_width", 64);
+        fuse_ins_pairs    = params.find<bool>("fuse_ins_pairs", false);
 
         const size_t uop_cache_size          = params.find<size_t>("uop_cache_entries", 128);
         const size_t predecode_cache_entries = params.find<size_t>("predecode_cache_entries", 4);
@@ -108,6 +125,21 @@ public:
         case 1:
             ins_loader->setLoaderMode(VanadisInstructionLoaderMode::INFINITE_CACHE_MODE);
             break;
+        case 2:
+        {
+            const uint32_t block_sets       = params.find<uint32_t>("block_cache_sets", 64);
+            const uint32_t block_ways       = params.find<uint32_t>("block_cache_ways", 4);
+            const uint32_t block_max_length = params.find<uint32_t>("block_cache_max_length", 16);
+
+            if ( (0 == block_sets) || (block_ways < 2) || (0 == block_max_length) ) {
+                getSimulationOutput().fatal(CALL_INFO, -1,
+                    "Error: decoded block cache needs at least one set, two ways and a block length of one "
+                    "(sets=%" PRIu32 ", ways=%" PRIu32 ", max-length=%" PRIu32 ")\n",
+                    block_sets, block_ways, block_max_length);
+            }
+
+            ins_loader->setBlockCacheMode(block_sets, block_ways, block_max_length);
+        } break;
         default:
             ins_loader->setLoaderMode(VanadisInstructionLoaderMode::LRU_CACHE_MODE);
             break;
@@ -130,6 +162,11 @@ public:
         stat_decode_fault     = registerStatistic<uint64_t>("decode_faults", "1");
         stat_ins_bytes_loaded = registerStatistic<uint64_t>("ins_bytes_loaded", "1");
         stat_uop_delayed_rob_full = registerStatistic<uint64_t>("uop_delayed_rob_full", "1");
+        stat_ins_pairs_fused  = registerStatistic<uint64_t>("ins_pairs_fused", "1");
+
+        ins_loader->setBlockCacheStatistics(registerStatistic<uint64_t>("uop_block_cache_hit", "1"),
+                                            registerStatistic<uint64_t>("uop_block_cache_miss", "1"),
+                                            registerStatistic<uint64_t>("uop_block_cache_evict", "1"));
     }
 
     virtual ~VanadisDecoder()
@@ -222,6 +259,8 @@ public:
 
     virtual void setThreadROB(VanadisCircularQueue<VanadisInstruction*>* thr_rob) { thread_rob = thr_rob; }
 
+    void setInstructionRing(VanadisInstructionRing* ring) { ins_ring = ring; }
+
     void     setCore(const uint32_t num ) { core = num; }
     uint32_t getCore() const { return core; }
 
@@ -236,8 +275,16 @@ public:
 protected:
     virtual void clearDecoderAfterMisspeculate(SST::Output* output) {};
 
+    // Copy of a cached micro-op for the ROB, carved from the thread's instruction ring
+    VanadisInstruction* cloneForROB(VanadisInstruction* cached_ins)
+    {
+        VanadisInstructionRingScope ring_scope(ins_ring);
+        return cached_ins->clone();
+    }
+
     uint64_t ip;
     uint64_t icache_line_width;
+    bool     fuse_ins_pairs;
     uint32_t hw_thr;
     uint32_t core;
 
@@ -246,6 +293,7 @@ protected:
 
     bool                                       wantDelegatedLoad;
     VanadisCircularQueue<VanadisInstruction*>* thread_rob;
+    VanadisInstructionRing*                    ins_ring;
 
     // VanadisCircularQueue<VanadisInstruction*>* decoded_q;
 
@@ -264,6 +312,7 @@ protected:
     Statistic<uint64_t>* stat_decode_fault;
     Statistic<uint64_t>* stat_uop_generated;
     Statistic<uint64_t>* stat_ins_bytes_loaded;
+    Statistic<uint64_t>* stat_ins_pairs_fused;
 };
 
 } // namespace Vanadis
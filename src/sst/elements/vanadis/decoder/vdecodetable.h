@@ -0,0 +1,97 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_VANADIS_DECODE_TABLE
+#define _H_VANADIS_DECODE_TABLE
+
+#include <cstddef>
+#include <cstdint>
+#include <initializer_list>
+
+namespace SST {
+namespace Vanadis {
+
+/*
+ * Direct-indexed decode table built at compile time from a short list of
+ * {encoding field value, handler} entries. Decoders use one table per level
+ * of the instruction encoding (major opcode, then function codes) so that
+ * supporting new encodings means adding entries rather than extending a
+ * switch. Slots without an entry hold a null handler, which the decoder
+ * treats as a decode fault.
+ *
+ * Handler is normally a pointer to a decoder member function, e.g.
+ *
+ *   static constexpr auto table = makeVanadisDecodeTable<Handler, 128>({
+ *       { 0x03, &MyDecoder::decodeLoad }, { 0x23, &MyDecoder::decodeStore } });
+ *
+ * which must be written inside a member function body of the decoder so the
+ * class is complete when the table is evaluated.
+ */
+template <typename Handler>
+struct VanadisDecodeTableEntry
+{
+    uint32_t key;
+    Handler  handler;
+};
+
+template <typename Handler, size_t Size>
+class VanadisDecodeTable
+{
+public:
+    constexpr VanadisDecodeTable() : handlers {}
+    {
+        for ( size_t i = 0; i < Size; ++i ) {
+            handlers[i] = nullptr;
+        }
+    }
+
+    constexpr Handler operator[](const size_t key) const { return (key < Size) ? handlers[key] : nullptr; }
+
+    constexpr bool contains(const size_t key) const { return (key < Size) && (nullptr != handlers[key]); }
+
+    static constexpr size_t size() { return Size; }
+
+    constexpr void set(const size_t key, const Handler handler)
+    {
+        // a key outside the table or a duplicate key is not a constant
+        // expression, so a bad table fails to compile
+        if ( (key >= Size) || (nullptr != handlers[key]) ) { invalidEntry(); }
+
+        handlers[key] = handler;
+    }
+
+private:
+    static void invalidEntry() {}
+
+    Handler handlers[Size];
+};
+
+template <typename Handler, size_t Size>
+constexpr VanadisDecodeTable<Handler, Size>
+makeVanadisDecodeTable(std::initializer_list<VanadisDecodeTableEntry<Handler>> entries)
+{
+    VanadisDecodeTable<Handler, Size> table;
+
+    for ( const auto& next_entry : entries ) {
+        table.set(next_entry.key, next_entry.handler);
+    }
+
+    return table;
+}
+
+} // namespace Vanadis
+} // namespace SST
+
+#endif
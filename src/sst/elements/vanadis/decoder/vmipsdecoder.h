@@ -475,13 +475,34 @@ public:
                             "-----> Last instruction in the bundle causes potential "
                             "branch, checking on branch delay slot\n");
 
-                        VanadisInstructionBundle* delay_bundle = nullptr;
-                        uint32_t                  temp_delay   = 0;
+                        VanadisInstructionBundle* delay_bundle       = nullptr;
+                        bool                      delay_bundle_owned = false;
+                        uint32_t                  temp_delay         = 0;
 
                         if ( ins_loader->hasBundleAt(ip + 4) ) {
                             // We have also decoded the branch-delay
                             delay_bundle = ins_loader->getBundleAt(ip + 4);
                             stat_uop_hit->addData(1);
+
+                            // A fused pair would also execute the instruction after the
+                            // delay slot, so decode the slot on its own for this issue and
+                            // keep the fused bundle for when it is reached in sequence
+                            if ( 4 != delay_bundle->pcIncrement() ) {
+                                delay_bundle = nullptr;
+
+                                if ( ins_loader->hasPredecodeAt(ip + 4, 4) &&
+                                     ins_loader->getPredecodeBytes(
+                                         output, ip + 4, (uint8_t*)&temp_delay, sizeof(temp_delay)) ) {
+                                    delay_bundle = new VanadisInstructionBundle(ip + 4);
+                                    decode(output, ip + 4, temp_delay, delay_bundle);
+                                    delay_bundle_owned = true;
+                                }
+                                else {
+                                    ins_loader->requestLoadAt(output, ip + 4, 4);
+                                    stat_ins_bytes_loaded->addData(4);
+                                    stat_predecode_miss->addData(1);
+                                }
+                            }
                         }
                         else {
                             output->verbose(
@@ -533,7 +554,7 @@ public:
                                     "delay slot...\n");
 
                                 for ( uint32_t i = 0; i < bundle->getInstructionCount(); ++i ) {
-                                    VanadisInstruction* next_ins = bundle->getInstructionByIndex(i)->clone();
+                                    VanadisInstruction* next_ins = cloneForROB(bundle->getInstructionByIndex(i));
 
                                     output->verbose(
                                         CALL_INFO, 16, VANADIS_DBG_DECODER_FLG, "---> --> issuing ins addr: 0x0%" PRI_ADDR ", %s...\n",
@@ -601,7 +622,7 @@ public:
                                 }
 
                                 for ( uint32_t i = 0; i < delay_bundle->getInstructionCount(); ++i ) {
-                                    VanadisInstruction* next_ins = delay_bundle->getInstructionByIndex(i)->clone();
+                                    VanadisInstruction* next_ins = cloneForROB(delay_bundle->getInstructionByIndex(i));
 
                                     output->verbose(
                                         CALL_INFO, 16, VANADIS_DBG_DECODER_FLG, "---> --> issuing ins addr: 0x0%" PRI_ADDR ", %s...\n",
@@ -610,6 +631,8 @@ public:
                                 }
 
                                 uop_bundles_used += 2;
+
+                                if ( delay_bundle_owned ) { delete delay_bundle; }
                             }
                             else {
                                 output->verbose(
@@ -617,6 +640,8 @@ public:
                                     "---> --> micro-op for branch and delay exceed "
                                     "decode-q space. Cannot issue this cycle.\n");
                                 stat_uop_delayed_rob_full->addData(1);
+
+                                if ( delay_bundle_owned ) { delete delay_bundle; }
                                 break;
                             }
                         }
@@ -636,13 +661,13 @@ public:
                                 output->verbose(
                                     CALL_INFO, 16, VANADIS_DBG_DECODER_FLG, "---> --> issuing ins addr: 0x0%" PRI_ADDR ", %s...\n",
                                     next_ins->getInstructionAddress(), next_ins->getInstCode());
-                                thread_rob->push(next_ins->clone());
+                                thread_rob->push(cloneForROB(next_ins));
                             }
 
                             uop_bundles_used++;
 
-                            // Push the instruction pointer along by the standard amount
-                            ip += 4;
+                            // Push the instruction pointer past the instructions in the bundle
+                            ip += bundle->pcIncrement();
                         }
                         else {
                             output->verbose(
@@ -680,6 +705,10 @@ public:
                             temp_ins);
                         decode(output, ip, temp_ins, decoded_bundle);
 
+                        if ( fuse_ins_pairs && (1 == decoded_bundle->getInstructionCount()) ) {
+                            fuseNextInstruction(output, ip, temp_ins, decoded_bundle);
+                        }
+
                         output->verbose(
                             CALL_INFO, 16, VANADIS_DBG_DECODER_FLG,
                             "---> performing a decode of the bytes found "
@@ -743,6 +772,54 @@ protected:
         (*fd) = (ins & MIPS_FD_MASK) >> 6;
     }
 
+    // Fuse a LUI with the ORI or ADDIU after it which completes the same
+    // register, the usual way of loading a 32bit constant, into one set of
+    // the whole value. The bundle then covers both instructions; when its LUI
+    // is found in a branch-delay slot the slot is decoded on its own instead.
+    void fuseNextInstruction(
+        SST::Output* output, const uint64_t ins_addr, const uint32_t ins, VanadisInstructionBundle* bundle)
+    {
+        const uint16_t rt = (ins & MIPS_RT_MASK) >> 16;
+
+        if ( (MIPS_SPEC_OP_MASK_LUI != (ins & MIPS_OP_MASK)) || (0 == rt) ) { return; }
+
+        uint32_t next_ins = 0;
+
+        if ( !ins_loader->hasPredecodeAt(ins_addr + 4, 4) ||
+             !ins_loader->getPredecodeBytes(output, ins_addr + 4, (uint8_t*)&next_ins, sizeof(next_ins)) ) {
+            return;
+        }
+
+        const uint16_t next_rt = (next_ins & MIPS_RT_MASK) >> 16;
+        const uint16_t next_rs = (next_ins & MIPS_RS_MASK) >> 21;
+
+        if ( (next_rt != rt) || (next_rs != rt) ) { return; }
+
+        const uint32_t upper_imm = (ins & MIPS_IMM_MASK) << 16;
+        int32_t        value     = 0;
+
+        switch ( next_ins & MIPS_OP_MASK ) {
+        case MIPS_SPEC_OP_MASK_ORI:
+            value = static_cast<int32_t>(upper_imm | (next_ins & MIPS_IMM_MASK));
+            break;
+        case MIPS_SPEC_OP_MASK_ADDIU:
+            value = static_cast<int32_t>(upper_imm + static_cast<uint32_t>(vanadis_sign_extend_offset_16(next_ins)));
+            break;
+        default:
+            return;
+        }
+
+        output->verbose(
+            CALL_INFO, 16, VANADIS_DBG_DECODER_FLG, "[decode] > fused 0x%08x / 0x%08x at 0x%" PRI_ADDR " into SETREG %" PRId32 "\n",
+            ins, next_ins, ins_addr, value);
+
+        bundle->clear();
+        bundle->addInstruction(
+            new VanadisSetRegisterInstruction<int32_t>(ins_addr, getHardwareThread(), options, rt, value));
+        bundle->setPCIncrement(8);
+        stat_ins_pairs_fused->addData(1);
+    }
+
     void decode(SST::Output* output, const uint64_t ins_addr, const uint32_t next_ins, VanadisInstructionBundle* bundle)
     {
         output->verbose(CALL_INFO, 16, VANADIS_DBG_DECODER_FLG, "[decode] > addr: 0x%" PRI_ADDR " ins: 0x%08x\n", ins_addr, next_ins);
@@ -17,6 +17,7 @@
 #define _H_VANADIS_RISCV64_DECODER
 
 #include "decoder/vdecoder.h"
+#include "decoder/vdecodetable.h"
 #include "inst/vinstall.h"
 #include "os/vriscvcpuos.h"
 
@@ -202,7 +203,7 @@ public:
                                 }
                             }
 
-                            thread_rob->push(next_ins->clone());
+                            thread_rob->push(cloneForROB(next_ins));
                         }
 
                         // Move to the next address, if we had a branch we should have
@@ -244,6 +245,11 @@ public:
                         output->verbose(CALL_INFO, 16, 0, "---> performing a decode for ip=0x%" PRI_ADDR "\n", ip);
                         decode(output, ip, temp_ins, decoded_bundle);
 
+                        if ( fuse_ins_pairs && (4 == decoded_bundle->pcIncrement()) &&
+                             (1 == decoded_bundle->getInstructionCount()) ) {
+                            fuseNextInstruction(output, ip, temp_ins, decoded_bundle);
+                        }
+
                         if(output->getVerboseLevel() >= 16) {
                             output->verbose(
                                 CALL_INFO, 16, 0, "---> bundle generates %" PRIu32 " micro-ops\n",
@@ -305,6 +311,86 @@ protected:
     uint16_t                     max_decodes_per_cycle;
     uint16_t                     decode_buffer_max_entries;
 
+    typedef void (VanadisRISCV64Decoder::*DecodeHandler)(
+        SST::Output* output, const uint64_t ins_address, const uint32_t ins, VanadisInstructionBundle* bundle,
+        bool& decode_fault);
+
+    // Fuse the instruction just decoded with the one after it when the pair
+    // leaves a single architectural result, so nothing is lost by dropping the
+    // first uop: lui/addi(w) and auipc/addi build a constant or address in rd
+    // and auipc/jalr through the same rd is a call. The bundle then covers both
+    // instructions (pc-increment of 8) and holds just the fused uop. The second
+    // instruction keeps its own bundle for anything branching straight to it.
+    void fuseNextInstruction(
+        SST::Output* output, const uint64_t ins_address, const uint32_t ins, VanadisInstructionBundle* bundle)
+    {
+        uint32_t op_code = extract_opcode(ins);
+        uint16_t rd      = extract_rd(ins);
+
+        if ( ((0x37 != op_code) && (0x17 != op_code)) || (0 == rd) ) { return; }
+
+        // only fuse with what is already fetched, never wait on the icache for it
+        uint32_t next_ins = 0;
+
+        if ( !ins_loader->hasPredecodeAt(ins_address + 4, 4) ||
+             !ins_loader->getPredecodeBytes(output, ins_address + 4, (uint8_t*)&next_ins, sizeof(next_ins)) ) {
+            return;
+        }
+
+        uint32_t next_op_code = 0;
+        uint16_t next_rd      = 0;
+        uint16_t next_rs1     = 0;
+        uint32_t next_func3   = 0;
+        int64_t  next_imm     = 0;
+
+        processI<int64_t>(next_ins, next_op_code, next_rd, next_rs1, next_func3, next_imm);
+
+        if ( ((next_ins & 0x3) != 0x3) || (next_rd != rd) || (next_rs1 != rd) || (0 != next_func3) ) { return; }
+
+        int64_t upper_imm = 0;
+        processU<int64_t>(ins, op_code, rd, upper_imm);
+
+        VanadisInstruction* fused_ins = nullptr;
+
+        if ( 0x37 == op_code ) {
+            if ( 0x13 == next_op_code ) {
+                // LUI + ADDI
+                fused_ins = new VanadisSetRegisterInstruction<int64_t>(
+                    ins_address, hw_thr, options, rd, upper_imm + next_imm);
+            }
+            else if ( 0x1B == next_op_code ) {
+                // LUI + ADDIW
+                fused_ins = new VanadisSetRegisterInstruction<int64_t>(
+                    ins_address, hw_thr, options, rd,
+                    static_cast<int64_t>(static_cast<int32_t>(static_cast<uint32_t>(upper_imm + next_imm))));
+            }
+        }
+        else {
+            if ( 0x13 == next_op_code ) {
+                // AUIPC + ADDI
+                fused_ins = new VanadisPCAddImmInstruction<int64_t>(
+                    ins_address, hw_thr, options, rd, upper_imm + next_imm);
+            }
+            else if ( 0x67 == next_op_code ) {
+                // AUIPC + JALR, the link is taken from the end of the pair
+                const uint64_t target = (ins_address + upper_imm + next_imm) & ~(static_cast<uint64_t>(1));
+                fused_ins = new VanadisJumpLinkInstruction(
+                    ins_address, hw_thr, options, 8, rd, target, VANADIS_NO_DELAY_SLOT);
+            }
+        }
+
+        if ( nullptr == fused_ins ) { return; }
+
+        output->verbose(
+            CALL_INFO, 16, 0, "[decode] -> fused 0x%08x / 0x%08x at 0x%" PRI_ADDR " into %s\n", ins, next_ins,
+            ins_address, fused_ins->getInstCode());
+
+        bundle->clear();
+        bundle->addInstruction(fused_ins);
+        bundle->setPCIncrement(8);
+        stat_ins_pairs_fused->addData(1);
+    }
+
     void decode(SST::Output* output, const uint64_t ins_address, const uint32_t ins, VanadisInstructionBundle* bundle)
     {
         output->verbose(CALL_INFO, 16, 0, "[decode] -> addr: 0x%" PRI_ADDR " / ins: 0x%08x\n", ins_address, ins);
@@ -316,21 +402,43 @@ protected:
             return;
         }
 
-        uint32_t op_code = extract_opcode(ins);
-
-        uint16_t rd  = 0;
-        uint16_t rs1 = 0;
-        uint16_t rs2 = 0;
-        uint16_t rs3 = 0;
-
-        uint32_t func_code  = 0;
-        uint32_t func_code3 = 0;
-        uint32_t func_code7 = 0;
-        uint64_t uimm64     = 0;
-        int64_t  simm64     = 0;
+        const uint32_t op_code = extract_opcode(ins);
 
         bool decode_fault = true;
 
+        // Major opcode (bits 6:0) of the 32bit formats, each handler decodes
+        // the function codes of its opcode family
+        static constexpr auto riscv_opcode_table = makeVanadisDecodeTable<DecodeHandler, 128>({
+            { 0x03, &VanadisRISCV64Decoder::decodeLoad },
+            { 0x07, &VanadisRISCV64Decoder::decodeLoadFP },
+            { 0x0F, &VanadisRISCV64Decoder::decodeMiscMem },
+            { 0x13, &VanadisRISCV64Decoder::decodeOpImm },
+            { 0x17, &VanadisRISCV64Decoder::decodeAUIPC },
+            { 0x1B, &VanadisRISCV64Decoder::decodeOpImm32 },
+            { 0x23, &VanadisRISCV64Decoder::decodeStore },
+            { 0x27, &VanadisRISCV64Decoder::decodeStoreFP },
+            { 0x2F, &VanadisRISCV64Decoder::decodeAMO },
+            { 0x33, &VanadisRISCV64Decoder::decodeOp },
+            { 0x37, &VanadisRISCV64Decoder::decodeLUI },
+            { 0x3B, &VanadisRISCV64Decoder::decodeOp32 },
+            { 0x43, &VanadisRISCV64Decoder::decodeFMAdd },
+            { 0x47, &VanadisRISCV64Decoder::decodeFMSub },
+            { 0x4B, &VanadisRISCV64Decoder::decodeFNMSub },
+            { 0x4F, &VanadisRISCV64Decoder::decodeFNMAdd },
+            { 0x53, &VanadisRISCV64Decoder::decodeOpFP },
+            { 0x63, &VanadisRISCV64Decoder::decodeBranch },
+            { 0x67, &VanadisRISCV64Decoder::decodeJALR },
+            { 0x6F, &VanadisRISCV64Decoder::decodeJAL },
+            { 0x73, &VanadisRISCV64Decoder::decodeSystem }
+        });
+
+        // RVC quadrant (bits 1:0) of the 16bit formats, quadrant 3 is the 32bit formats
+        static constexpr auto riscv_rvc_quadrant_table = makeVanadisDecodeTable<DecodeHandler, 4>({
+            { 0x0, &VanadisRISCV64Decoder::decodeRVCQuadrant0 },
+            { 0x1, &VanadisRISCV64Decoder::decodeRVCQuadrant1 },
+            { 0x2, &VanadisRISCV64Decoder::decodeRVCQuadrant2 }
+        });
+
 
         // if the last two bits that are set are 11, then we are performing at least 32bit instruction formats,
         // otherwise we are performing decodes on the C-extension (16b) formats
@@ -339,2676 +447,2905 @@ protected:
                 CALL_INFO, 16, 0, "[decode] -> 32bit format / ins-op-code-family: %" PRIu32 " / 0x%x\n", op_code,
                 op_code);
 
-            switch ( op_code ) {
-            case 0x3:
-            {
-                // Load data
-                processI<int64_t>(ins, op_code, rd, rs1, func_code, simm64);
+            const DecodeHandler handler = riscv_opcode_table[op_code];
 
-                switch ( func_code ) {
-                case 0:
-                {
-                    // LB
-                    output->verbose(
-                        CALL_INFO, 16, 0, "----> LB %" PRIu16 " <- %" PRIu16 " %" PRId64 "\n", rd, rs1, simm64);
+            // op_code did not match an expected value, leave the decode fault set
+            if ( nullptr != handler ) { (this->*handler)(output, ins_address, ins, bundle, decode_fault); }
+        }
+        else {
+            const uint32_t c_op_code = ins & 0x3;
 
-                    bundle->addInstruction(new VanadisLoadInstruction(
-                        ins_address, hw_thr, options, rs1, simm64, rd, 1, true, MEM_TRANSACTION_NONE,
-                        LOAD_INT_REGISTER));
-                    decode_fault = false;
-                } break;
-                case 1:
-                {
-                    // LH
-                    output->verbose(
-                        CALL_INFO, 16, 0, "----> LH %" PRIu16 " <- %" PRIu16 " %" PRId64 "\n", rd, rs1, simm64);
+            // this bundle only increments the PC by 2, not 4 in 32bit decodes
+            bundle->setPCIncrement(2);
 
-                    bundle->addInstruction(new VanadisLoadInstruction(
-                        ins_address, hw_thr, options, rs1, simm64, rd, 2, true, MEM_TRANSACTION_NONE,
-                        LOAD_INT_REGISTER));
-                    decode_fault = false;
-                } break;
-                case 2:
-                {
-                    // LW
-                    output->verbose(
-                        CALL_INFO, 16, 0, "----> LW %" PRIu16 " <- %" PRIu16 " %" PRId64 "\n", rd, rs1, simm64);
+            output->verbose(CALL_INFO, 16, 0, "-----> RVC op_code: %" PRIu32 "\n", c_op_code);
 
-                    bundle->addInstruction(new VanadisLoadInstruction(
-                        ins_address, hw_thr, options, rs1, simm64, rd, 4, true, MEM_TRANSACTION_NONE,
-                        LOAD_INT_REGISTER));
-                    decode_fault = false;
-                } break;
-                case 3:
-                {
-                    // LD
-                    output->verbose(
-                        CALL_INFO, 16, 0, "----> LD %" PRIu16 " <- %" PRIu16 " %" PRId64 "\n", rd, rs1, simm64);
+            const DecodeHandler handler = riscv_rvc_quadrant_table[c_op_code];
 
-                    bundle->addInstruction(new VanadisLoadInstruction(
-                        ins_address, hw_thr, options, rs1, simm64, rd, 8, true, MEM_TRANSACTION_NONE,
-                        LOAD_INT_REGISTER));
-                    decode_fault = false;
-                } break;
-                case 4:
-                {
-                    // LBU
-                    output->verbose(
-                        CALL_INFO, 16, 0, "----> LBU %" PRIu16 " <- %" PRIu16 " %" PRId64 "\n", rd, rs1, simm64);
+            if ( nullptr != handler ) { (this->*handler)(output, ins_address, ins, bundle, decode_fault); }
 
-                    bundle->addInstruction(new VanadisLoadInstruction(
-                        ins_address, hw_thr, options, rs1, simm64, rd, 1, false, MEM_TRANSACTION_NONE,
-                        LOAD_INT_REGISTER));
-                    decode_fault = false;
-                } break;
-                case 5:
-                {
-                    // LHU
-                    output->verbose(
-                        CALL_INFO, 16, 0, "----> LHU %" PRIu16 " <- %" PRIu16 " %" PRId64 "\n", rd, rs1, simm64);
+            output->verbose(
+                CALL_INFO, 16, 0, "[decode] -> 16bit RVC format / ins-op-code-family: %" PRIu32 " / 0x%x\n", op_code,
+                op_code);
+            //            if ( decode_fault ) { output->fatal(CALL_INFO, -1, "STOP\n"); }
+        }
 
-                    bundle->addInstruction(new VanadisLoadInstruction(
-                        ins_address, hw_thr, options, rs1, simm64, rd, 2, false, MEM_TRANSACTION_NONE,
-                        LOAD_INT_REGISTER));
-                    decode_fault = false;
-                } break;
-                case 6:
-                {
-                    // LWU
-                    output->verbose(
-                        CALL_INFO, 16, 0, "----> LWU %" PRIu16 " <- %" PRIu16 " %" PRId64 "\n", rd, rs1, simm64);
 
-                    bundle->addInstruction(new VanadisLoadInstruction(
-                        ins_address, hw_thr, options, rs1, simm64, rd, 4, false, MEM_TRANSACTION_NONE,
-                        LOAD_INT_REGISTER));
-                    decode_fault = false;
-                } break;
-                }
-            } break;
-            case 0x7:
-            {
-                processI<int64_t>(ins, op_code, rd, rs1, func_code3, simm64);
+        if ( decode_fault ) {
+            if ( fatal_decode_fault ) {
+                output->fatal(
+                    CALL_INFO, -1,
+                    "[decode] -> decode fault detected at 0x%" PRI_ADDR " / thr: %" PRIu32 ", set to fatal on detect\n",
+                    ins_address, hw_thr);
+            }
+            bundle->addInstruction(new VanadisInstructionDecodeFault(ins_address, hw_thr, options));
+        }
+    }
 
-                // Floating point load
-                switch ( func_code3 ) {
-                case 0x2:
-                {
-                    // FLW
-                    output->verbose(
-                        CALL_INFO, 16, 0, "----> FLW %" PRIu16 " <- memory[ %" PRIu16 " + %" PRId64 " ]\n", rd, rs1,
-                        simm64);
-                    bundle->addInstruction(new VanadisLoadInstruction(
-                        ins_address, hw_thr, options, rs1, simm64, rd, 4, true, MEM_TRANSACTION_NONE,
-                        LOAD_FP_REGISTER));
-                    decode_fault = false;
-                } break;
-                case 0x3:
-                {
-                    // FLD
-                    output->verbose(
-                        CALL_INFO, 16, 0, "----> FLD %" PRIu16 " <- memory[ %" PRIu16 " + %" PRId64 " ]\n", rd, rs1,
-                        simm64);
-                    bundle->addInstruction(new VanadisLoadInstruction(
-                        ins_address, hw_thr, options, rs1, simm64, rd, 8, true, MEM_TRANSACTION_NONE,
-                        LOAD_FP_REGISTER));
-                    decode_fault = false;
-                } break;
-                }
-            } break;
-            case 0x23:
-            {
-                // Store data
-                processS<int64_t>(ins, op_code, rs1, rs2, func_code3, simm64);
+    // LOAD (major opcode 0x3)
+    void decodeLoad(
+        SST::Output* output, const uint64_t ins_address, const uint32_t ins, VanadisInstructionBundle* bundle,
+        bool& decode_fault)
+    {
+        uint32_t op_code = extract_opcode(ins);
+        uint16_t rd  = 0;
+        uint16_t rs1 = 0;
+        uint32_t func_code  = 0;
+        int64_t  simm64     = 0;
 
-                if ( func_code < 4 ) {
-                    // shift to get the power of 2 number of bytes to store
-                    const uint32_t store_bytes = 1 << func_code3;
+        // Load data
+        processI<int64_t>(ins, op_code, rd, rs1, func_code, simm64);
 
-                    output->verbose(
-                        CALL_INFO, 16, 0,
-                        "----> STORE width: %" PRIu32 " bytes == (1 << %" PRIu32 ") %" PRIu16 " -> memory[ %" PRIu16
-                        " + %" PRId64 " / (0x%" PRI_ADDR ")]\n",
-                        store_bytes, func_code3, rs2, rs1, simm64, simm64);
+        switch ( func_code ) {
+        case 0:
+        {
+            // LB
+            output->verbose(
+                CALL_INFO, 16, 0, "----> LB %" PRIu16 " <- %" PRIu16 " %" PRId64 "\n", rd, rs1, simm64);
+
+            bundle->addInstruction(new VanadisLoadInstruction(
+                ins_address, hw_thr, options, rs1, simm64, rd, 1, true, MEM_TRANSACTION_NONE,
+                LOAD_INT_REGISTER));
+            decode_fault = false;
+        } break;
+        case 1:
+        {
+            // LH
+            output->verbose(
+                CALL_INFO, 16, 0, "----> LH %" PRIu16 " <- %" PRIu16 " %" PRId64 "\n", rd, rs1, simm64);
+
+            bundle->addInstruction(new VanadisLoadInstruction(
+                ins_address, hw_thr, options, rs1, simm64, rd, 2, true, MEM_TRANSACTION_NONE,
+                LOAD_INT_REGISTER));
+            decode_fault = false;
+        } break;
+        case 2:
+        {
+            // LW
+            output->verbose(
+                CALL_INFO, 16, 0, "----> LW %" PRIu16 " <- %" PRIu16 " %" PRId64 "\n", rd, rs1, simm64);
+
+            bundle->addInstruction(new VanadisLoadInstruction(
+                ins_address, hw_thr, options, rs1, simm64, rd, 4, true, MEM_TRANSACTION_NONE,
+                LOAD_INT_REGISTER));
+            decode_fault = false;
+        } break;
+        case 3:
+        {
+            // LD
+            output->verbose(
+                CALL_INFO, 16, 0, "----> LD %" PRIu16 " <- %" PRIu16 " %" PRId64 "\n", rd, rs1, simm64);
+
+            bundle->addInstruction(new VanadisLoadInstruction(
+                ins_address, hw_thr, options, rs1, simm64, rd, 8, true, MEM_TRANSACTION_NONE,
+                LOAD_INT_REGISTER));
+            decode_fault = false;
+        } break;
+        case 4:
+        {
+            // LBU
+            output->verbose(
+                CALL_INFO, 16, 0, "----> LBU %" PRIu16 " <- %" PRIu16 " %" PRId64 "\n", rd, rs1, simm64);
+
+            bundle->addInstruction(new VanadisLoadInstruction(
+                ins_address, hw_thr, options, rs1, simm64, rd, 1, false, MEM_TRANSACTION_NONE,
+                LOAD_INT_REGISTER));
+            decode_fault = false;
+        } break;
+        case 5:
+        {
+            // LHU
+            output->verbose(
+                CALL_INFO, 16, 0, "----> LHU %" PRIu16 " <- %" PRIu16 " %" PRId64 "\n", rd, rs1, simm64);
+
+            bundle->addInstruction(new VanadisLoadInstruction(
+                ins_address, hw_thr, options, rs1, simm64, rd, 2, false, MEM_TRANSACTION_NONE,
+                LOAD_INT_REGISTER));
+            decode_fault = false;
+        } break;
+        case 6:
+        {
+            // LWU
+            output->verbose(
+                CALL_INFO, 16, 0, "----> LWU %" PRIu16 " <- %" PRIu16 " %" PRId64 "\n", rd, rs1, simm64);
 
-                    bundle->addInstruction(new VanadisStoreInstruction(
-                        ins_address, hw_thr, options, rs1, simm64, rs2, store_bytes, MEM_TRANSACTION_NONE,
-                        STORE_INT_REGISTER));
-                    decode_fault = false;
-                }
-            } break;
-            case 0x13:
-            {
-                // Immediate arithmetic
-                func_code = extract_func3(ins);
+            bundle->addInstruction(new VanadisLoadInstruction(
+                ins_address, hw_thr, options, rs1, simm64, rd, 4, false, MEM_TRANSACTION_NONE,
+                LOAD_INT_REGISTER));
+            decode_fault = false;
+        } break;
+        }
+    }
 
-                output->verbose(CALL_INFO, 16, 0, "----> immediate-arith func: %" PRIu32 "\n", func_code);
+    // LOAD-FP (major opcode 0x7)
+    void decodeLoadFP(
+        SST::Output* output, const uint64_t ins_address, const uint32_t ins, VanadisInstructionBundle* bundle,
+        bool& decode_fault)
+    {
+        uint32_t op_code = extract_opcode(ins);
+        uint16_t rd  = 0;
+        uint16_t rs1 = 0;
+        uint32_t func_code3 = 0;
+        int64_t  simm64     = 0;
 
-                switch ( func_code ) {
-                case 0:
-                {
-                    // ADDI
-                    processI<int64_t>(ins, op_code, rd, rs1, func_code3, simm64);
+        processI<int64_t>(ins, op_code, rd, rs1, func_code3, simm64);
 
-                    output->verbose(
-                        CALL_INFO, 16, 0, "------> ADDI %" PRIu16 " <- %" PRIu16 " + %" PRId64 "\n", rd, rs1, simm64);
+        // Floating point load
+        switch ( func_code3 ) {
+        case 0x2:
+        {
+            // FLW
+            output->verbose(
+                CALL_INFO, 16, 0, "----> FLW %" PRIu16 " <- memory[ %" PRIu16 " + %" PRId64 " ]\n", rd, rs1,
+                simm64);
+            bundle->addInstruction(new VanadisLoadInstruction(
+                ins_address, hw_thr, options, rs1, simm64, rd, 4, true, MEM_TRANSACTION_NONE,
+                LOAD_FP_REGISTER));
+            decode_fault = false;
+        } break;
+        case 0x3:
+        {
+            // FLD
+            output->verbose(
+                CALL_INFO, 16, 0, "----> FLD %" PRIu16 " <- memory[ %" PRIu16 " + %" PRId64 " ]\n", rd, rs1,
+                simm64);
+            bundle->addInstruction(new VanadisLoadInstruction(
+                ins_address, hw_thr, options, rs1, simm64, rd, 8, true, MEM_TRANSACTION_NONE,
+                LOAD_FP_REGISTER));
+            decode_fault = false;
+        } break;
+        }
+    }
 
-                    bundle->addInstruction(new VanadisAddImmInstruction<int64_t>(
-                        ins_address, hw_thr, options, rd, rs1, simm64));
-                    decode_fault = false;
-                } break;
-                case 1:
-                {
-                    // SLLI
-                    rd  = extract_rd(ins);
-                    rs1 = extract_rs1(ins);
+    // STORE (major opcode 0x23)
+    void decodeStore(
+        SST::Output* output, const uint64_t ins_address, const uint32_t ins, VanadisInstructionBundle* bundle,
+        bool& decode_fault)
+    {
+        uint32_t op_code = extract_opcode(ins);
+        uint16_t rs1 = 0;
+        uint16_t rs2 = 0;
+        uint32_t func_code  = 0;
+        uint32_t func_code3 = 0;
+        int64_t  simm64     = 0;
 
-                    uint32_t func_code6 = (ins & 0xFC000000);
-                    uint32_t shift_by   = (ins & 0x3F00000) >> 20;
+        // Store data
+        processS<int64_t>(ins, op_code, rs1, rs2, func_code3, simm64);
 
-                    output->verbose(
-                        CALL_INFO, 16, 0, "------> func_code6 = %" PRIu32 " / shift = %" PRIu32 " (0x%" PRIx32 ")\n",
-                        func_code6, shift_by, shift_by);
+        if ( func_code < 4 ) {
+            // shift to get the power of 2 number of bytes to store
+            const uint32_t store_bytes = 1 << func_code3;
 
-                    switch ( func_code6 ) {
-                    case 0x0:
-                    {
-                        bundle->addInstruction(
-                            new VanadisShiftLeftLogicalImmInstruction<uint64_t>(
-                                ins_address, hw_thr, options, rd, rs1, shift_by));
-                        decode_fault = false;
-                    } break;
-                    };
-                } break;
-                case 2:
-                {
-                    // SLTI
-                    processI<int64_t>(ins, op_code, rd, rs1, func_code3, simm64);
-                    bundle->addInstruction(new VanadisSetRegCompareImmInstruction<
-                                           REG_COMPARE_LT, int64_t>(
-                        ins_address, hw_thr, options, rd, rs1, simm64));
-                    decode_fault = false;
-                } break;
-                case 3:
-                {
-                    // SLTIU
-                    processI<int64_t>(ins, op_code, rd, rs1, func_code3, simm64);
-                    bundle->addInstruction(new VanadisSetRegCompareImmInstruction<
-                                           REG_COMPARE_LT, uint64_t>(
-                        ins_address, hw_thr, options, rd, rs1, simm64));
-                    decode_fault = false;
-                } break;
-                case 4:
-                {
-                    // XORI
-                    processI<int64_t>(ins, op_code, rd, rs1, func_code3, simm64);
-                    bundle->addInstruction(new VanadisXorImmInstruction(ins_address, hw_thr, options, rd, rs1, simm64));
-                    decode_fault = false;
-                } break;
-                case 5:
-                {
-                    // CHECK SRLI / SRAI
-                    rd  = extract_rd(ins);
-                    rs1 = extract_rs1(ins);
+            output->verbose(
+                CALL_INFO, 16, 0,
+                "----> STORE width: %" PRIu32 " bytes == (1 << %" PRIu32 ") %" PRIu16 " -> memory[ %" PRIu16
+                " + %" PRId64 " / (0x%" PRI_ADDR ")]\n",
+                store_bytes, func_code3, rs2, rs1, simm64, simm64);
+
+            bundle->addInstruction(new VanadisStoreInstruction(
+                ins_address, hw_thr, options, rs1, simm64, rs2, store_bytes, MEM_TRANSACTION_NONE,
+                STORE_INT_REGISTER));
+            decode_fault = false;
+        }
+    }
+
+    // OP-IMM (major opcode 0x13)
+    void decodeOpImm(
+        SST::Output* output, const uint64_t ins_address, const uint32_t ins, VanadisInstructionBundle* bundle,
+        bool& decode_fault)
+    {
+        uint32_t op_code = extract_opcode(ins);
+        uint16_t rd  = 0;
+        uint16_t rs1 = 0;
+        uint32_t func_code  = 0;
+        uint32_t func_code3 = 0;
+        int64_t  simm64     = 0;
 
-                    uint32_t func_code6 = (ins & 0xFC000000);
-                    uint32_t shift_by   = (ins & 0x3F00000) >> 20;
+        // Immediate arithmetic
+        func_code = extract_func3(ins);
 
-                    output->verbose(
-                        CALL_INFO, 16, 0, "------> func_code6 = %" PRIu32 " / shift = %" PRIu32 " (0x%" PRIx32 ")\n",
-                        func_code6, shift_by, shift_by);
+        output->verbose(CALL_INFO, 16, 0, "----> immediate-arith func: %" PRIu32 "\n", func_code);
 
-                    switch ( func_code6 ) {
-                    case 0x0:
-                    {
-                        output->verbose(
-                            CALL_INFO, 16, 0, "--------> SRLI %" PRIu16 " <- %" PRIu16 " >> %" PRIu32 "\n", rd, rs1,
-                            shift_by);
-                        bundle->addInstruction(
-                            new VanadisShiftRightLogicalImmInstruction<VanadisRegisterFormat::VANADIS_FORMAT_INT64>(
-                                ins_address, hw_thr, options, rd, rs1, shift_by));
-                        decode_fault = false;
-                    } break;
-                    case 0x40000000:
-                    {
-                        output->verbose(
-                            CALL_INFO, 16, 0, "--------> SRAI %" PRIu16 " <- %" PRIu16 " >> %" PRIu32 "\n", rd, rs1,
-                            shift_by);
-                        bundle->addInstruction(
-                            new VanadisShiftRightArithmeticImmInstruction<VanadisRegisterFormat::VANADIS_FORMAT_INT64>(
-                                ins_address, hw_thr, options, rd, rs1, shift_by));
-                        decode_fault = false;
-                    } break;
-                    };
-                } break;
-                case 6:
-                {
-                    // ORI
-                    processI<int64_t>(ins, op_code, rd, rs1, func_code3, simm64);
-                    bundle->addInstruction(new VanadisOrImmInstruction(ins_address, hw_thr, options, rd, rs1, simm64));
-                    decode_fault = false;
-                } break;
-                case 7:
-                {
-                    // ANDI
-                    processI<int64_t>(ins, op_code, rd, rs1, func_code3, simm64);
-                    bundle->addInstruction(new VanadisAndImmInstruction(ins_address, hw_thr, options, rd, rs1, simm64));
-                    decode_fault = false;
-                } break;
-                };
+        switch ( func_code ) {
+        case 0:
+        {
+            // ADDI
+            processI<int64_t>(ins, op_code, rd, rs1, func_code3, simm64);
+
+            output->verbose(
+                CALL_INFO, 16, 0, "------> ADDI %" PRIu16 " <- %" PRIu16 " + %" PRId64 "\n", rd, rs1, simm64);
+
+            bundle->addInstruction(new VanadisAddImmInstruction<int64_t>(
+                ins_address, hw_thr, options, rd, rs1, simm64));
+            decode_fault = false;
+        } break;
+        case 1:
+        {
+            // SLLI
+            rd  = extract_rd(ins);
+            rs1 = extract_rs1(ins);
+
+            uint32_t func_code6 = (ins & 0xFC000000);
+            uint32_t shift_by   = (ins & 0x3F00000) >> 20;
+
+            output->verbose(
+                CALL_INFO, 16, 0, "------> func_code6 = %" PRIu32 " / shift = %" PRIu32 " (0x%" PRIx32 ")\n",
+                func_code6, shift_by, shift_by);
+
+            switch ( func_code6 ) {
+            case 0x0:
+            {
+                bundle->addInstruction(
+                    new VanadisShiftLeftLogicalImmInstruction<uint64_t>(
+                        ins_address, hw_thr, options, rd, rs1, shift_by));
+                decode_fault = false;
+            } break;
+            };
+        } break;
+        case 2:
+        {
+            // SLTI
+            processI<int64_t>(ins, op_code, rd, rs1, func_code3, simm64);
+            bundle->addInstruction(new VanadisSetRegCompareImmInstruction<
+                                   REG_COMPARE_LT, int64_t>(
+                ins_address, hw_thr, options, rd, rs1, simm64));
+            decode_fault = false;
+        } break;
+        case 3:
+        {
+            // SLTIU
+            processI<int64_t>(ins, op_code, rd, rs1, func_code3, simm64);
+            bundle->addInstruction(new VanadisSetRegCompareImmInstruction<
+                                   REG_COMPARE_LT, uint64_t>(
+                ins_address, hw_thr, options, rd, rs1, simm64));
+            decode_fault = false;
+        } break;
+        case 4:
+        {
+            // XORI
+            processI<int64_t>(ins, op_code, rd, rs1, func_code3, simm64);
+            bundle->addInstruction(new VanadisXorImmInstruction(ins_address, hw_thr, options, rd, rs1, simm64));
+            decode_fault = false;
+        } break;
+        case 5:
+        {
+            // CHECK SRLI / SRAI
+            rd  = extract_rd(ins);
+            rs1 = extract_rs1(ins);
+
+            uint32_t func_code6 = (ins & 0xFC000000);
+            uint32_t shift_by   = (ins & 0x3F00000) >> 20;
+
+            output->verbose(
+                CALL_INFO, 16, 0, "------> func_code6 = %" PRIu32 " / shift = %" PRIu32 " (0x%" PRIx32 ")\n",
+                func_code6, shift_by, shift_by);
+
+            switch ( func_code6 ) {
+            case 0x0:
+            {
+                output->verbose(
+                    CALL_INFO, 16, 0, "--------> SRLI %" PRIu16 " <- %" PRIu16 " >> %" PRIu32 "\n", rd, rs1,
+                    shift_by);
+                bundle->addInstruction(
+                    new VanadisShiftRightLogicalImmInstruction<VanadisRegisterFormat::VANADIS_FORMAT_INT64>(
+                        ins_address, hw_thr, options, rd, rs1, shift_by));
+                decode_fault = false;
             } break;
-            case 0x33:
+            case 0x40000000:
             {
-                // integer arithmetic/logical
-                processR(ins, op_code, rd, rs1, rs2, func_code3, func_code7);
+                output->verbose(
+                    CALL_INFO, 16, 0, "--------> SRAI %" PRIu16 " <- %" PRIu16 " >> %" PRIu32 "\n", rd, rs1,
+                    shift_by);
+                bundle->addInstruction(
+                    new VanadisShiftRightArithmeticImmInstruction<VanadisRegisterFormat::VANADIS_FORMAT_INT64>(
+                        ins_address, hw_thr, options, rd, rs1, shift_by));
+                decode_fault = false;
+            } break;
+            };
+        } break;
+        case 6:
+        {
+            // ORI
+            processI<int64_t>(ins, op_code, rd, rs1, func_code3, simm64);
+            bundle->addInstruction(new VanadisOrImmInstruction(ins_address, hw_thr, options, rd, rs1, simm64));
+            decode_fault = false;
+        } break;
+        case 7:
+        {
+            // ANDI
+            processI<int64_t>(ins, op_code, rd, rs1, func_code3, simm64);
+            bundle->addInstruction(new VanadisAndImmInstruction(ins_address, hw_thr, options, rd, rs1, simm64));
+            decode_fault = false;
+        } break;
+        };
+    }
+
+    // OP (major opcode 0x33)
+    void decodeOp(
+        SST::Output* output, const uint64_t ins_address, const uint32_t ins, VanadisInstructionBundle* bundle,
+        bool& decode_fault)
+    {
+        uint32_t op_code = extract_opcode(ins);
+        uint16_t rd  = 0;
+        uint16_t rs1 = 0;
+        uint16_t rs2 = 0;
+        uint32_t func_code3 = 0;
+        uint32_t func_code7 = 0;
+
+        // integer arithmetic/logical
+        processR(ins, op_code, rd, rs1, rs2, func_code3, func_code7);
 
+        output->verbose(
+            CALL_INFO, 16, 0, "-----> decode R-type, func_code3=%" PRIu32 " / func_code7=%" PRIu32 "\n",
+            func_code3, func_code7);
+
+        switch ( func_code3 ) {
+        case 0:
+        {
+            switch ( func_code7 ) {
+            case 0:
+            {
+                output->verbose(
+                    CALL_INFO, 16, 0, "-------> ADD %" PRIu16 " <- %" PRIu16 " + %" PRIu16 "\n", rd, rs1, rs2);
+                // ADD
+                bundle->addInstruction(
+                    new VanadisAddInstruction<int64_t>(
+                        ins_address, hw_thr, options, rd, rs1, rs2));
+                decode_fault = false;
+            } break;
+            case 1:
+            {
+                // MUL
+                // TODO - check register ordering
                 output->verbose(
-                    CALL_INFO, 16, 0, "-----> decode R-type, func_code3=%" PRIu32 " / func_code7=%" PRIu32 "\n",
-                    func_code3, func_code7);
+                    CALL_INFO, 16, 0, "-------> MUL %" PRIu16 " <- %" PRIu16 " + %" PRIu16 "\n", rd, rs1, rs2);
 
-                switch ( func_code3 ) {
-                case 0:
-                {
-                    switch ( func_code7 ) {
-                    case 0:
-                    {
-                        output->verbose(
-                            CALL_INFO, 16, 0, "-------> ADD %" PRIu16 " <- %" PRIu16 " + %" PRIu16 "\n", rd, rs1, rs2);
-                        // ADD
-                        bundle->addInstruction(
-                            new VanadisAddInstruction<int64_t>(
-                                ins_address, hw_thr, options, rd, rs1, rs2));
-                        decode_fault = false;
-                    } break;
-                    case 1:
-                    {
-                        // MUL
-                        // TODO - check register ordering
-                        output->verbose(
-                            CALL_INFO, 16, 0, "-------> MUL %" PRIu16 " <- %" PRIu16 " + %" PRIu16 "\n", rd, rs1, rs2);
-
-                        bundle->addInstruction(
-                            new VanadisMultiplyInstruction<int64_t>(
-                                ins_address, hw_thr, options, rd, rs1, rs2));
-                        decode_fault = false;
-                    } break;
-                    case 0x20:
-                    {
-                        output->verbose(
-                            CALL_INFO, 16, 0, "-------> SUB %" PRIu16 " <- %" PRIu16 " - %" PRIu16 "\n", rd, rs1, rs2);
-                        // SUB
-                        bundle->addInstruction(new VanadisSubInstruction<int64_t>(
-                            ins_address, hw_thr, options, rd, rs1, rs2, false));
-                        decode_fault = false;
-                    } break;
-                    };
-                } break;
-                case 1:
-                {
-                    switch ( func_code7 ) {
-                    case 0:
-                    {
-                        // SLL
-                        output->verbose(
-                            CALL_INFO, 16, 0, "-------> SLL %" PRIu16 " <- %" PRIu16 " << %" PRIu16 "\n", rd, rs1, rs2);
-                        bundle->addInstruction(
-                            new VanadisShiftLeftLogicalInstruction<VanadisRegisterFormat::VANADIS_FORMAT_INT64>(
-                                ins_address, hw_thr, options, rd, rs1, rs2));
-                        decode_fault = false;
-                    } break;
-                    case 1:
-                    {
-                        // MULH
-                        output->verbose(
-                            CALL_INFO, 16, 0, "-------> MULH %" PRIu16 " <- %" PRIu16 " + %" PRIu16 "\n", rd, rs1, rs2);
-
-                        bundle->addInstruction(
-                            new VanadisMultiplyHighInstruction<int64_t,int64_t>( ins_address, hw_thr, options, rd, rs1, rs2));
-                        decode_fault = false;
-                    } break;
-                    };
-                } break;
-                case 2:
-                {
-                    switch ( func_code7 ) {
-                    case 0:
-                    {
-                        output->verbose(
-                            CALL_INFO, 16, 0, "-------> SLT %" PRIu16 " <-  %" PRIu16 " < %" PRIu16 "\n", rd, rs1,
-                            rs2);
-                        // SLT
-                        bundle->addInstruction(
-                            new VanadisSetRegCompareInstruction<
-                                VanadisRegisterCompareType::REG_COMPARE_LT, int64_t>(ins_address, hw_thr, options, rd, rs1, rs2));
-                        decode_fault = false;
-                    } break;
-                    case 1:
-                    {
-                        // MULHSU
-                        output->verbose(
-                            CALL_INFO, 16, 0, "-------> MULHSU %" PRIu16 " <- %" PRIu16 " + %" PRIu16 "\n", rd, rs1, rs2);
-
-                        bundle->addInstruction(
-                            new VanadisMultiplyHighInstruction<int64_t,uint64_t>( ins_address, hw_thr, options, rd, rs1, rs2));
-                        decode_fault = false;
-                    } break;
-                    };
-                } break;
-                case 3:
-                {
-                    switch ( func_code7 ) {
-                    case 0x0:
-                    {
-                        output->verbose(
-                            CALL_INFO, 16, 0, "-------> SLTU %" PRIu16 " <-  %" PRIu16 " < %" PRIu16 "\n", rd, rs1,
-                            rs2);
-                        // SLTU
-                        bundle->addInstruction(
-                            new VanadisSetRegCompareInstruction<
-                                VanadisRegisterCompareType::REG_COMPARE_LT, uint64_t>(ins_address, hw_thr, options, rd, rs1, rs2));
-                        decode_fault = false;
-                    } break;
-                    case 0x1:
-                    {
-                        // MULHU mul und place in upper XLEN bits, unsigned
-                        // need to check the register order
-                        output->verbose(
-                            CALL_INFO, 16, 0, "-------> MULHU %" PRIu16 " <- %" PRIu16 " + %" PRIu16 "\n", rd, rs1, rs2);
-
-                        bundle->addInstruction(
-                            new VanadisMultiplyHighInstruction<uint64_t,uint64_t>( ins_address, hw_thr, options, rd, rs1, rs2));
-                        decode_fault = false;
-                    } break;
-                    };
-                } break;
-                case 4:
-                {
-                    switch ( func_code7 ) {
-                    case 0x0:
-                    {
-                        // XOR
-                        output->verbose(
-                            CALL_INFO, 16, 0, "-------> XOR %" PRIu16 " <-  %" PRIu16 " ^ %" PRIu16 "\n", rd, rs1, rs2);
-                        bundle->addInstruction(new VanadisXorInstruction(ins_address, hw_thr, options, rd, rs1, rs2));
-                        decode_fault = false;
-                    } break;
-                    case 1:
-                    {
-                        // DIV
-                        output->verbose(
-                            CALL_INFO, 16, 0, "-------> DIV %" PRIu16 " <-  %" PRIu16 " / %" PRIu16 "\n", rd, rs1, rs2);
-                        bundle->addInstruction(
-                            new VanadisDivideInstruction<int64_t>(
-                                ins_address, hw_thr, options, rd, rs1, rs2));
-                        decode_fault = false;
-                    } break;
-                    };
-                } break;
-                case 5:
-                {
-                    switch ( func_code7 ) {
-                    case 0:
-                    {
-                        // SRL
-                        output->verbose(
-                            CALL_INFO, 16, 0, "-------> SRL %" PRIu16 " <-  %" PRIu16 " >> %" PRIu16 "\n", rd, rs1,
-                            rs2);
-                        bundle->addInstruction(
-                            new VanadisShiftRightLogicalInstruction<VanadisRegisterFormat::VANADIS_FORMAT_INT64>(
-                                ins_address, hw_thr, options, rd, rs1, rs2));
-                        decode_fault = false;
-                    } break;
-                    case 1:
-                    {
-                        // DIVU
-                        output->verbose(
-                            CALL_INFO, 16, 0, "-------> DIVU %" PRIu16 " <-  %" PRIu16 " / %" PRIu16 "\n", rd, rs1,
-                            rs2);
-                        bundle->addInstruction(
-                            new VanadisDivideInstruction<uint64_t>(
-                                ins_address, hw_thr, options, rd, rs1, rs2));
-                        decode_fault = false;
-                    } break;
-                    case 32:
-                    {
-                        // SRA
-                        output->verbose(
-                            CALL_INFO, 16, 0, "-------> SRA %" PRIu16 " <- %" PRIu16 " >> %" PRIu16 "\n", rd, rs1, rs2);
-                        bundle->addInstruction(
-                            new VanadisShiftRightArithmeticInstruction<VanadisRegisterFormat::VANADIS_FORMAT_INT64>(
-                                ins_address, hw_thr, options, rd, rs1, rs2));
-                        decode_fault = false;
-                    } break;
-                    };
-                } break;
-                case 6:
-                {
-                    switch ( func_code7 ) {
-                    case 0x0:
-                    {
-                        // OR
-                        output->verbose(
-                            CALL_INFO, 16, 0, "-----> OR %" PRIu16 " <- %" PRIu16 " | %" PRIu16 "\n", rd, rs1, rs2);
-
-                        bundle->addInstruction(new VanadisOrInstruction(ins_address, hw_thr, options, rd, rs1, rs2));
-                        decode_fault = false;
-                    } break;
-                    case 0x1:
-                    {
-                        // REM
-                        output->verbose(
-                            CALL_INFO, 16, 0, "-----> REM %" PRIu16 " <- %" PRIu16 " %% %" PRIu16 "\n", rd, rs1, rs2);
-                        bundle->addInstruction(
-                            new VanadisModuloInstruction<int64_t>(
-                                ins_address, hw_thr, options, rd, rs1, rs2));
-                        decode_fault = false;
-                    } break;
-                    }
-                } break;
-                case 7:
-                {
-                    switch ( func_code7 ) {
-                    case 0x0:
-                    {
-                        // AND
-                        output->verbose(
-                            CALL_INFO, 16, 0, "-----> AND %" PRIu16 " <- %" PRIu16 " & %" PRIu16 "\n", rd, rs1, rs2);
-                        bundle->addInstruction(new VanadisAndInstruction(ins_address, hw_thr, options, rd, rs1, rs2));
-                        decode_fault = false;
-                    } break;
-                    case 0x1:
-                    {
-                        // REMU
-                        output->verbose(
-                            CALL_INFO, 16, 0, "-----> REMU %" PRIu16 " <- %" PRIu16 " %% %" PRIu16 "\n", rd, rs1, rs2);
-                        bundle->addInstruction(
-                            new VanadisModuloInstruction<uint64_t>(
-                                ins_address, hw_thr, options, rd, rs1, rs2));
-                        decode_fault = false;
-                    } break;
-                    }
-                } break;
-                };
+                bundle->addInstruction(
+                    new VanadisMultiplyInstruction<int64_t>(
+                        ins_address, hw_thr, options, rd, rs1, rs2));
+                decode_fault = false;
             } break;
-            case 0x37:
+            case 0x20:
             {
-                // LUI
-		int32_t uimm32 = 0;
-                processU<int32_t>(ins, op_code, rd, uimm32);;
-
-		output->verbose(CALL_INFO, 16, 0, "----> LUI %" PRIu16 " <- %#" PRIx32 "\n", rd, uimm32);
-
-                bundle->addInstruction(new VanadisSetRegisterInstruction<int32_t>(
-                    ins_address, hw_thr, options, rd, uimm32));
+                output->verbose(
+                    CALL_INFO, 16, 0, "-------> SUB %" PRIu16 " <- %" PRIu16 " - %" PRIu16 "\n", rd, rs1, rs2);
+                // SUB
+                bundle->addInstruction(new VanadisSubInstruction<int64_t>(
+                    ins_address, hw_thr, options, rd, rs1, rs2, false));
                 decode_fault = false;
             } break;
-            case 0x17:
+            };
+        } break;
+        case 1:
+        {
+            switch ( func_code7 ) {
+            case 0:
             {
-                // AUIPC
-                processU<int64_t>(ins, op_code, rd, simm64);
-
-                bundle->addInstruction(new VanadisPCAddImmInstruction<int64_t>(
-                    ins_address, hw_thr, options, rd, simm64));
+                // SLL
+                output->verbose(
+                    CALL_INFO, 16, 0, "-------> SLL %" PRIu16 " <- %" PRIu16 " << %" PRIu16 "\n", rd, rs1, rs2);
+                bundle->addInstruction(
+                    new VanadisShiftLeftLogicalInstruction<VanadisRegisterFormat::VANADIS_FORMAT_INT64>(
+                        ins_address, hw_thr, options, rd, rs1, rs2));
                 decode_fault = false;
             } break;
-
-            case 0x1B:
+            case 1:
             {
-                processR(ins, op_code, rd, rs1, rs2, func_code3, func_code7);
-
+                // MULH
                 output->verbose(
-                    CALL_INFO, 16, 0, "-----> decode R-type, func_code3=%" PRIu32 " / func_code7=%" PRIu32 "\n",
-                    func_code3, func_code7);
-
-                switch ( func_code3 ) {
-                case 0x0:
-                {
-                    // ADDIW?
-                    int64_t addiw_imm = 0;
-                    processI(ins, op_code, rd, rs1, func_code3, addiw_imm);
-
-                    output->verbose(
-                        CALL_INFO, 16, 0, "-------> ADDIW %" PRIu16 " <- %" PRIu16 " + %" PRId64 "\n", rd, rs1,
-                        addiw_imm);
-
-                    bundle->addInstruction(new VanadisAddImmInstruction<int32_t>(
-                        ins_address, hw_thr, options, rd, rs1, static_cast<int32_t>(addiw_imm)));
-                    decode_fault = false;
-                } break;
-                case 0x1:
-                {
-                    switch ( func_code7 ) {
-                    case 0x0:
-                    {
-                        // RS2 acts as an immediate
-                        // SLLIW (32bit result generated)
-                        output->verbose(
-                            CALL_INFO, 16, 0, "-------> SLLIW %" PRIu16 " <- %" PRIu16 " << %" PRIu16 " (%#" PRIx16 ")\n", rd,
-                            rs1, rs2, rs2);
-                        bundle->addInstruction(
-                            new VanadisShiftLeftLogicalImmInstruction<uint32_t>(
-                                ins_address, hw_thr, options, rd, rs1, rs2));
-                        decode_fault = false;
-                    } break;
-                    }
-                } break;
-                case 0x5:
-                {
-                    switch ( func_code7 ) {
-                    case 0x0:
-                    {
-                        // RS2 acts as an immediate
-                        // SRLIW (32bit result generated)
-                        output->verbose(
-                            CALL_INFO, 16, 0, "-------> SRLIW %" PRIu16 " <- %" PRIu16 " << %" PRIu16 " (%#" PRIx16 ")\n", rd,
-                            rs1, rs2, rs2);
-                        bundle->addInstruction(
-                            new VanadisShiftRightLogicalImmInstruction<VanadisRegisterFormat::VANADIS_FORMAT_INT32>(
-                                ins_address, hw_thr, options, rd, rs1, rs2));
-                        decode_fault = false;
+                    CALL_INFO, 16, 0, "-------> MULH %" PRIu16 " <- %" PRIu16 " + %" PRIu16 "\n", rd, rs1, rs2);
 
-                    } break;
-                    case 32:
-                    {
-                        // RS2 acts as an immediate
-                        // SRAIW
-                        output->verbose(
-                            CALL_INFO, 16, 0, "-------> SRAIW %" PRIu16 " <- %" PRIu16 " << %" PRIu16 " (%#" PRIx16 ")\n", rd,
-                            rs1, rs2, rs2);
-                        bundle->addInstruction(
-                            new VanadisShiftRightArithmeticImmInstruction<VanadisRegisterFormat::VANADIS_FORMAT_INT32>(
-                                ins_address, hw_thr, options, rd, rs1, rs2));
-                        decode_fault = false;
-                    } break;
-                    }
-                } break;
-                }
+                bundle->addInstruction(
+                    new VanadisMultiplyHighInstruction<int64_t,int64_t>( ins_address, hw_thr, options, rd, rs1, rs2));
+                decode_fault = false;
             } break;
-            case 0x6F:
+            };
+        } break;
+        case 2:
+        {
+            switch ( func_code7 ) {
+            case 0:
             {
-                // JAL
-                processJ<int64_t>(ins, op_code, rd, simm64);
-                // Immediate specifies jump in multiples of 2 byts per RISCV spec
-                const int64_t jump_to = static_cast<int64_t>(ins_address) + simm64;
-
                 output->verbose(
-                    CALL_INFO, 16, 0,
-                    "-----> JAL link-reg: %" PRIu16 " / jump-address: 0x%" PRI_ADDR " + %" PRId64 " = 0x%" PRI_ADDR "\n", rd, ins_address,
-                    simm64, jump_to);
+                    CALL_INFO, 16, 0, "-------> SLT %" PRIu16 " <-  %" PRIu16 " < %" PRIu16 "\n", rd, rs1,
+                    rs2);
+                // SLT
+                bundle->addInstruction(
+                    new VanadisSetRegCompareInstruction<
+                        VanadisRegisterCompareType::REG_COMPARE_LT, int64_t>(ins_address, hw_thr, options, rd, rs1, rs2));
+                decode_fault = false;
+            } break;
+            case 1:
+            {
+                // MULHSU
+                output->verbose(
+                    CALL_INFO, 16, 0, "-------> MULHSU %" PRIu16 " <- %" PRIu16 " + %" PRIu16 "\n", rd, rs1, rs2);
 
-                bundle->addInstruction(new VanadisJumpLinkInstruction(
-                    ins_address, hw_thr, options, 4, rd, jump_to, VANADIS_NO_DELAY_SLOT));
+                bundle->addInstruction(
+                    new VanadisMultiplyHighInstruction<int64_t,uint64_t>( ins_address, hw_thr, options, rd, rs1, rs2));
+                decode_fault = false;
+            } break;
+            };
+        } break;
+        case 3:
+        {
+            switch ( func_code7 ) {
+            case 0x0:
+            {
+                output->verbose(
+                    CALL_INFO, 16, 0, "-------> SLTU %" PRIu16 " <-  %" PRIu16 " < %" PRIu16 "\n", rd, rs1,
+                    rs2);
+                // SLTU
+                bundle->addInstruction(
+                    new VanadisSetRegCompareInstruction<
+                        VanadisRegisterCompareType::REG_COMPARE_LT, uint64_t>(ins_address, hw_thr, options, rd, rs1, rs2));
                 decode_fault = false;
             } break;
-            case 0x67:
+            case 0x1:
             {
-                // JALR
-                processI<int64_t>(ins, op_code, rd, rs1, func_code3, simm64);
+                // MULHU mul und place in upper XLEN bits, unsigned
+                // need to check the register order
+                output->verbose(
+                    CALL_INFO, 16, 0, "-------> MULHU %" PRIu16 " <- %" PRIu16 " + %" PRIu16 "\n", rd, rs1, rs2);
 
-                switch ( func_code3 ) {
-                case 0:
-                {
-                    // TODO - may need to zero bit 1 with an AND microop?
-                    bundle->addInstruction(new VanadisJumpRegLinkInstruction(
-                        ins_address, hw_thr, options, 4, rd, rs1, simm64, VANADIS_NO_DELAY_SLOT));
-                    decode_fault = false;
-                } break;
-                };
+                bundle->addInstruction(
+                    new VanadisMultiplyHighInstruction<uint64_t,uint64_t>( ins_address, hw_thr, options, rd, rs1, rs2));
+                decode_fault = false;
+            } break;
+            };
+        } break;
+        case 4:
+        {
+            switch ( func_code7 ) {
+            case 0x0:
+            {
+                // XOR
+                output->verbose(
+                    CALL_INFO, 16, 0, "-------> XOR %" PRIu16 " <-  %" PRIu16 " ^ %" PRIu16 "\n", rd, rs1, rs2);
+                bundle->addInstruction(new VanadisXorInstruction(ins_address, hw_thr, options, rd, rs1, rs2));
+                decode_fault = false;
+            } break;
+            case 1:
+            {
+                // DIV
+                output->verbose(
+                    CALL_INFO, 16, 0, "-------> DIV %" PRIu16 " <-  %" PRIu16 " / %" PRIu16 "\n", rd, rs1, rs2);
+                bundle->addInstruction(
+                    new VanadisDivideInstruction<int64_t>(
+                        ins_address, hw_thr, options, rd, rs1, rs2));
+                decode_fault = false;
+            } break;
+            };
+        } break;
+        case 5:
+        {
+            switch ( func_code7 ) {
+            case 0:
+            {
+                // SRL
+                output->verbose(
+                    CALL_INFO, 16, 0, "-------> SRL %" PRIu16 " <-  %" PRIu16 " >> %" PRIu16 "\n", rd, rs1,
+                    rs2);
+                bundle->addInstruction(
+                    new VanadisShiftRightLogicalInstruction<VanadisRegisterFormat::VANADIS_FORMAT_INT64>(
+                        ins_address, hw_thr, options, rd, rs1, rs2));
+                decode_fault = false;
+            } break;
+            case 1:
+            {
+                // DIVU
+                output->verbose(
+                    CALL_INFO, 16, 0, "-------> DIVU %" PRIu16 " <-  %" PRIu16 " / %" PRIu16 "\n", rd, rs1,
+                    rs2);
+                bundle->addInstruction(
+                    new VanadisDivideInstruction<uint64_t>(
+                        ins_address, hw_thr, options, rd, rs1, rs2));
+                decode_fault = false;
+            } break;
+            case 32:
+            {
+                // SRA
+                output->verbose(
+                    CALL_INFO, 16, 0, "-------> SRA %" PRIu16 " <- %" PRIu16 " >> %" PRIu16 "\n", rd, rs1, rs2);
+                bundle->addInstruction(
+                    new VanadisShiftRightArithmeticInstruction<VanadisRegisterFormat::VANADIS_FORMAT_INT64>(
+                        ins_address, hw_thr, options, rd, rs1, rs2));
+                decode_fault = false;
             } break;
-            case 0x63:
+            };
+        } break;
+        case 6:
+        {
+            switch ( func_code7 ) {
+            case 0x0:
             {
-                // Branch
-                processB<int64_t>(ins, op_code, rs1, rs2, func_code, simm64);
+                // OR
+                output->verbose(
+                    CALL_INFO, 16, 0, "-----> OR %" PRIu16 " <- %" PRIu16 " | %" PRIu16 "\n", rd, rs1, rs2);
 
-                switch ( func_code ) {
-                case 0:
-                {
-                    // BEQ
-                    output->verbose(
-                        CALL_INFO, 16, 0, "-----> BEQ %" PRIu16 " == %" PRIu16 " / offset: %" PRId64 "\n", rs1, rs2,
-                        simm64);
-                    bundle->addInstruction(new VanadisBranchRegCompareInstruction<int64_t, REG_COMPARE_EQ>(
-                        ins_address, hw_thr, options, 4, rs1, rs2, simm64, VANADIS_NO_DELAY_SLOT));
-                    decode_fault = false;
-                } break;
-                case 1:
-                {
-                    // BNE
-                    output->verbose(
-                        CALL_INFO, 16, 0,
-                        "-----> BNE %" PRIu16 " != %" PRIu16 " / offset: %" PRId64 " (ip+offset %" PRIu64 ")\n", rs1,
-                        rs2, simm64, ins_address + simm64);
-                    bundle->addInstruction(new VanadisBranchRegCompareInstruction<int64_t, REG_COMPARE_NEQ>(
-                        ins_address, hw_thr, options, 4, rs1, rs2, simm64, VANADIS_NO_DELAY_SLOT));
-                    decode_fault = false;
-                } break;
-                case 4:
-                {
-                    // BLT
-                    output->verbose(
-                        CALL_INFO, 16, 0, "-----> BLT %" PRIu16 " < %" PRIu16 " / offset: %" PRId64 "\n", rs1, rs2,
-                        simm64);
-                    bundle->addInstruction(new VanadisBranchRegCompareInstruction<int64_t, REG_COMPARE_LT>(
-                        ins_address, hw_thr, options, 4, rs1, rs2, simm64, VANADIS_NO_DELAY_SLOT));
-                    decode_fault = false;
-                } break;
-                case 5:
-                {
-                    // BGE
-                    output->verbose(
-                        CALL_INFO, 16, 0, "-----> BGE %" PRIu16 " >= %" PRIu16 " / offset: %" PRId64 "\n", rs1, rs2,
-                        simm64);
-                    bundle->addInstruction(new VanadisBranchRegCompareInstruction<int64_t, REG_COMPARE_GTE>(
-                        ins_address, hw_thr, options, 4, rs1, rs2, simm64, VANADIS_NO_DELAY_SLOT));
-                    decode_fault = false;
-                } break;
-                case 6:
-                {
-                    // BLTU
-                    bundle->addInstruction(new VanadisBranchRegCompareInstruction<uint64_t, REG_COMPARE_LT>(
-                        ins_address, hw_thr, options, 4, rs1, rs2, simm64, VANADIS_NO_DELAY_SLOT));
-                    decode_fault = false;
-                } break;
-                case 7:
-                {
-                    // BGEU
-                    bundle->addInstruction(new VanadisBranchRegCompareInstruction<uint64_t, REG_COMPARE_GTE>(
-                        ins_address, hw_thr, options, 4, rs1, rs2, simm64, VANADIS_NO_DELAY_SLOT));
-                    decode_fault = false;
-                } break;
-                };
+                bundle->addInstruction(new VanadisOrInstruction(ins_address, hw_thr, options, rd, rs1, rs2));
+                decode_fault = false;
+            } break;
+            case 0x1:
+            {
+                // REM
+                output->verbose(
+                    CALL_INFO, 16, 0, "-----> REM %" PRIu16 " <- %" PRIu16 " %% %" PRIu16 "\n", rd, rs1, rs2);
+                bundle->addInstruction(
+                    new VanadisModuloInstruction<int64_t>(
+                        ins_address, hw_thr, options, rd, rs1, rs2));
+                decode_fault = false;
+            } break;
+            }
+        } break;
+        case 7:
+        {
+            switch ( func_code7 ) {
+            case 0x0:
+            {
+                // AND
+                output->verbose(
+                    CALL_INFO, 16, 0, "-----> AND %" PRIu16 " <- %" PRIu16 " & %" PRIu16 "\n", rd, rs1, rs2);
+                bundle->addInstruction(new VanadisAndInstruction(ins_address, hw_thr, options, rd, rs1, rs2));
+                decode_fault = false;
             } break;
-            case 0x73:
+            case 0x1:
             {
-                // Syscall/ECALL and EBREAK
-                // Control registers
+                // REMU
+                output->verbose(
+                    CALL_INFO, 16, 0, "-----> REMU %" PRIu16 " <- %" PRIu16 " %% %" PRIu16 "\n", rd, rs1, rs2);
+                bundle->addInstruction(
+                    new VanadisModuloInstruction<uint64_t>(
+                        ins_address, hw_thr, options, rd, rs1, rs2));
+                decode_fault = false;
+            } break;
+            }
+        } break;
+        };
+    }
 
-                processI<uint64_t>(ins, op_code, rd, rs1, func_code, uimm64);
+    // LUI (major opcode 0x37)
+    void decodeLUI(
+        SST::Output* output, const uint64_t ins_address, const uint32_t ins, VanadisInstructionBundle* bundle,
+        bool& decode_fault)
+    {
+        uint32_t op_code = extract_opcode(ins);
+        uint16_t rd  = 0;
 
-                if ( (0 == rd) && (0 == rs1) && (0 == func_code) ) {
-                    uint32_t func_code12 = (ins & 0xFFF00000);
+        // LUI
+int32_t uimm32 = 0;
+        processU<int32_t>(ins, op_code, rd, uimm32);;
 
-                    switch ( func_code12 ) {
-                    case 0x0: // SCALL
-                    {
-                        output->verbose(CALL_INFO, 16, 0, "------> ECALL/SYSCALL\n");
-						bundle->addInstruction(new VanadisFenceInstruction(ins_address, hw_thr, options, VANADIS_LOAD_STORE_FENCE));
-                        bundle->addInstruction(new VanadisSysCallInstruction(ins_address, hw_thr, options));
-                        decode_fault = false;
-                    } break;
-                    case 0x1: // SBREAK
-                    {
-                        printf("%#llx %#x SBREAK\n",ins_address,ins);
-                        assert(0);
-                    } break;
-                    } 
-                } else { 
-                    // CSRRW(I) atomic reaad/write
-                    // CSRRS(I) atomic read and set bits
-                    // CSRRC(I) atomic read and clear bit
-                    output->verbose(
-                            CALL_INFO, 16, 0, "-----> %s: ins: 0x%" PRI_ADDR " / %#" PRIx64 " / rd: %" PRIu16 " / rs1: %" PRIu16 "\n", 
-                                        getCSR_name(func_code).c_str(),ins_address, uimm64, rd, rs1);
+output->verbose(CALL_INFO, 16, 0, "----> LUI %" PRIu16 " <- %#" PRIx32 "\n", rd, uimm32);
 
-                    switch ( uimm64 ) 
-                    {
-                        case 0x1: // FSFLAGS
-                        {
-                            output->verbose( CALL_INFO, 16, 0, "----->  FFLAGS: %" PRIu64 " / rd: %" PRIu16 " / rs1: %" PRIu16 "\n", uimm64, rd, rs1);
+        bundle->addInstruction(new VanadisSetRegisterInstruction<int32_t>(
+            ins_address, hw_thr, options, rd, uimm32));
+        decode_fault = false;
+    }
 
-                            if ( ! ( ( 0x1 == func_code || 0x3 == func_code ) && 0 == rd ) ) {
-                                bundle->addInstruction(new VanadisFPFlagsReadInstruction<false, false, true>(ins_address, hw_thr, options, fpflags, rd));
-                            }
-                            if ( ! ( 0x2 == func_code && rs1 == 0 ) ) {
-                                if ( func_code & 0x4 ) {
-                                    bundle->addInstruction(
-                                       new VanadisFPFlagsSetImmInstruction<false,true>(ins_address, hw_thr, options, fpflags, static_cast<uint64_t>(rs1), func_code & 0x3));
-                                } else {
-                                    bundle->addInstruction(
-                                        new VanadisFPFlagsSetInstruction<false,true>(ins_address, hw_thr, options, fpflags, rs1, func_code & 0x3 ));
-                                }
-                            }
-                            decode_fault = false;
-                        } break;
-                        case 0x2: // FSRM
-                        {
-                            output->verbose( CALL_INFO, 16, 0, "----->  FRM: %" PRIu64 " / rd: %" PRIu16 " / rs1: %" PRIu16 "\n", uimm64, rd, rs1);
+    // AUIPC (major opcode 0x17)
+    void decodeAUIPC(
+        SST::Output* output, const uint64_t ins_address, const uint32_t ins, VanadisInstructionBundle* bundle,
+        bool& decode_fault)
+    {
+        uint32_t op_code = extract_opcode(ins);
+        uint16_t rd  = 0;
+        int64_t  simm64     = 0;
 
-                            if ( ! ( ( 0x1 == func_code || 0x3 == func_code ) && 0 == rd ) ) {
-                                bundle->addInstruction(new VanadisFPFlagsReadInstruction<true, false, false>(ins_address, hw_thr, options, fpflags, rd));
-                            }
-                            if ( ! ( 0x2 == func_code && rs1 == 0 ) ) {
-                                 if ( func_code & 0x4 ) {
-                                    bundle->addInstruction(
-                                        new VanadisFPFlagsSetImmInstruction<true,false>(ins_address, hw_thr, options, fpflags, static_cast<uint64_t>(rs1), func_code & 0x3));
-                                } else {
-                                    bundle->addInstruction(
-                                        new VanadisFPFlagsSetInstruction<true,false>(ins_address, hw_thr, options, fpflags, rs1, func_code & 0x3));
-                                }
-                            }
-                            decode_fault = false;
-                        } break;
-                        case 0x3: // FCSR
-                        {
-                            output->verbose( CALL_INFO, 16, 0, "-----> FCSR: %" PRIu64 " / rd: %" PRIu16 " / rs1: %" PRIu16 "\n", uimm64, rd, rs1);
-
-                            if ( ! ( ( 0x1 == func_code || 0x3 == func_code ) && 0 == rd ) ) {
-                                bundle->addInstruction(new VanadisFPFlagsReadInstruction<true, true, true>(ins_address, hw_thr, options, fpflags, rd));
-                            } 
-                            if ( ! ( 0x2 == func_code && rs1 == 0 ) ) {
-                                if ( func_code & 0x4 ) {
-                                    bundle->addInstruction(
-                                        new VanadisFPFlagsSetImmInstruction<true,true>(ins_address, hw_thr, options, fpflags, static_cast<uint64_t>(rs1), func_code & 0x3));
-                                } else {
-                                    bundle->addInstruction(
-                                        new VanadisFPFlagsSetInstruction<true,true>(ins_address, hw_thr, options, fpflags, rs1, func_code & 0x3));
-                                }
-                            }
-                            decode_fault = false;
-                      } break;
-                      default:
-                      {
-                        uint64_t csrNum = uimm64 & 0xfff;
-                        switch ( csrNum ) {
-                            case 0xc00:
-                            {
-                                if ( 0 == rs1 ) {
-                                    auto thread_call = std::bind(&VanadisRISCV64Decoder::getCycleCount, this);
-                                    bundle->addInstruction( new VanadisSetRegisterByCallInstruction<int64_t>( ins_address, hw_thr, options, rd, thread_call));
-                                    decode_fault = false;
-                                }
-                            } break;
-                        }
+        // AUIPC
+        processU<int64_t>(ins, op_code, rd, simm64);
 
-                      } break;
-                    }
-                }
-            } break; // end of  0x73:
-            case 0x3B:
-            {
-                // 64b integer arithmetic-W
-                processR(ins, op_code, rd, rs1, rs2, func_code3, func_code7);
+        bundle->addInstruction(new VanadisPCAddImmInstruction<int64_t>(
+            ins_address, hw_thr, options, rd, simm64));
+        decode_fault = false;
+    }
 
-                switch ( func_code3 ) {
-                case 0:
-                {
-                    switch ( func_code7 ) {
-                    case 0x0:
-                    {
-                        // ADDW
-                        // TODO - check register ordering
-                        bundle->addInstruction(
-                            new VanadisAddInstruction<int32_t>(
-                                ins_address, hw_thr, options, rd, rs1, rs2));
-                        decode_fault = false;
-                    } break;
-                    case 0x1:
-                    {
-                        // MULW
-                        // TODO - check register ordering
-                        bundle->addInstruction(
-                            new VanadisMultiplyInstruction<int32_t>(
-                                ins_address, hw_thr, options, rd, rs1, rs2));
-                        decode_fault = false;
-                    } break;
-                    case 0x20:
-                    {
-                        // SUBW
-                        // TODO - check register ordering
-                        bundle->addInstruction(new VanadisSubInstruction<int32_t>(
-                            ins_address, hw_thr, options, rd, rs1, rs2, true));
-                        decode_fault = false;
-                    } break;
-                    };
-                } break;
-                case 1:
-                {
-                    switch ( func_code7 ) {
-                    case 0x0:
-                    {
-                        // SLLW
-                        // TODO - check register ordering
-                        bundle->addInstruction(
-                            new VanadisShiftLeftLogicalInstruction<VanadisRegisterFormat::VANADIS_FORMAT_INT32>(
-                                ins_address, hw_thr, options, rd, rs1, rs2));
-                        decode_fault = false;
-                    } break;
-                    };
-                } break;
-                case 4:
-                {
-                    switch ( func_code7 ) {
-                    case 0x1:
-                    {
-                        // DIVW
-                        bundle->addInstruction(
-                            new VanadisDivideInstruction<int32_t>(
-                                ins_address, hw_thr, options, rd, rs1, rs2));
-                        decode_fault = false;
-                    } break;
-                    };
-                } break;
-                case 5:
-                {
-                    switch ( func_code7 ) {
-                    case 0x0:
-                    {
-                        // SRLW
-                        // TODO - check register ordering
-                        bundle->addInstruction(
-                            new VanadisShiftRightLogicalInstruction<VanadisRegisterFormat::VANADIS_FORMAT_INT32>(
-                                ins_address, hw_thr, options, rd, rs1, rs2));
-                        decode_fault = false;
-                    } break;
-                    case 0x1:
-                    {
-                        // DIVUW
-                        bundle->addInstruction(
-                            new VanadisDivideInstruction<uint32_t>(
-                                ins_address, hw_thr, options, rd, rs1, rs2));
-                        decode_fault = false;
-                    } break;
-                    case 0x20:
-                    {
-                        // SRAW
-                        // TODO - check register ordering
-                        bundle->addInstruction(
-                            new VanadisShiftRightArithmeticInstruction<VanadisRegisterFormat::VANADIS_FORMAT_INT32>(
-                                ins_address, hw_thr, options, rd, rs1, rs2));
-                        decode_fault = false;
-                    } break;
-                    };
-                } break;
-                case 6:
-                {
-                    switch ( func_code7 ) {
-                    case 0x1:
-                    {
-                        // REMW
-                        output->verbose(
-                            CALL_INFO, 16, 0, "----> REMW %" PRIu16 " <- %" PRIu16 " %% %" PRIu16 "\n", rd, rs1, rs2);
-                        bundle->addInstruction(
-                            new VanadisModuloInstruction<int32_t>(
-                                ins_address, hw_thr, options, rd, rs1, rs2));
-                        decode_fault = false;
-                    } break;
-                    };
-                } break;
-                case 7:
-                {
-                    switch ( func_code7 ) {
-                    case 0x1:
-                    {
-                        // REMUW
-                        output->verbose(
-                            CALL_INFO, 16, 0, "----> REMUW %" PRIu16 " <- %" PRIu16 " %% %" PRIu16 "\n", rd, rs1, rs2);
-                        bundle->addInstruction(
-                            new VanadisModuloInstruction<uint32_t>(
-                                ins_address, hw_thr, options, rd, rs1, rs2));
-                        decode_fault = false;
-                    } break;
-                    }
-                }; break;
-                };
-            } break;
-				case 0xF:
-			   {
-                    processR(ins, op_code, rd, rs1, rs2, func_code3, func_code7);
-                    switch ( func_code3 ) {
-                        case 0x0:
-                        {
-					        // Fence operations
-					        // For now, we conduct a heavy fence
-				            // could optimize this to be more efficient
-					        output->verbose(CALL_INFO, 16, 0, "----> FENCE\n");
-					        bundle->addInstruction(
-								    new VanadisFenceInstruction(ins_address, hw_thr, options, VANADIS_LOAD_STORE_FENCE));
-                            decode_fault = false;
-                        } break;
-                    }
-				} break;
-            case 0x2F:
+    // OP-IMM-32 (major opcode 0x1B)
+    void decodeOpImm32(
+        SST::Output* output, const uint64_t ins_address, const uint32_t ins, VanadisInstructionBundle* bundle,
+        bool& decode_fault)
+    {
+        uint32_t op_code = extract_opcode(ins);
+        uint16_t rd  = 0;
+        uint16_t rs1 = 0;
+        uint16_t rs2 = 0;
+        uint32_t func_code3 = 0;
+        uint32_t func_code7 = 0;
+
+        processR(ins, op_code, rd, rs1, rs2, func_code3, func_code7);
+
+        output->verbose(
+            CALL_INFO, 16, 0, "-----> decode R-type, func_code3=%" PRIu32 " / func_code7=%" PRIu32 "\n",
+            func_code3, func_code7);
+
+        switch ( func_code3 ) {
+        case 0x0:
+        {
+            // ADDIW?
+            int64_t addiw_imm = 0;
+            processI(ins, op_code, rd, rs1, func_code3, addiw_imm);
+
+            output->verbose(
+                CALL_INFO, 16, 0, "-------> ADDIW %" PRIu16 " <- %" PRIu16 " + %" PRId64 "\n", rd, rs1,
+                addiw_imm);
+
+            bundle->addInstruction(new VanadisAddImmInstruction<int32_t>(
+                ins_address, hw_thr, options, rd, rs1, static_cast<int32_t>(addiw_imm)));
+            decode_fault = false;
+        } break;
+        case 0x1:
+        {
+            switch ( func_code7 ) {
+            case 0x0:
+            {
+                // RS2 acts as an immediate
+                // SLLIW (32bit result generated)
+                output->verbose(
+                    CALL_INFO, 16, 0, "-------> SLLIW %" PRIu16 " <- %" PRIu16 " << %" PRIu16 " (%#" PRIx16 ")\n", rd,
+                    rs1, rs2, rs2);
+                bundle->addInstruction(
+                    new VanadisShiftLeftLogicalImmInstruction<uint32_t>(
+                        ins_address, hw_thr, options, rd, rs1, rs2));
+                decode_fault = false;
+            } break;
+            }
+        } break;
+        case 0x5:
+        {
+            switch ( func_code7 ) {
+            case 0x0:
             {
-                // Atomic operations (A extension)
-                processR(ins, op_code, rd, rs1, rs2, func_code3, func_code7);
+                // RS2 acts as an immediate
+                // SRLIW (32bit result generated)
+                output->verbose(
+                    CALL_INFO, 16, 0, "-------> SRLIW %" PRIu16 " <- %" PRIu16 " << %" PRIu16 " (%#" PRIx16 ")\n", rd,
+                    rs1, rs2, rs2);
+                bundle->addInstruction(
+                    new VanadisShiftRightLogicalImmInstruction<VanadisRegisterFormat::VANADIS_FORMAT_INT32>(
+                        ins_address, hw_thr, options, rd, rs1, rs2));
+                decode_fault = false;
 
-                const bool perform_aq = func_code7 & 0x2;
-                const bool perform_rl = func_code7 & 0x1;
+            } break;
+            case 32:
+            {
+                // RS2 acts as an immediate
+                // SRAIW
+                output->verbose(
+                    CALL_INFO, 16, 0, "-------> SRAIW %" PRIu16 " <- %" PRIu16 " << %" PRIu16 " (%#" PRIx16 ")\n", rd,
+                    rs1, rs2, rs2);
+                bundle->addInstruction(
+                    new VanadisShiftRightArithmeticImmInstruction<VanadisRegisterFormat::VANADIS_FORMAT_INT32>(
+                        ins_address, hw_thr, options, rd, rs1, rs2));
+                decode_fault = false;
+            } break;
+            }
+        } break;
+        }
+    }
 
-                uint32_t op_width = 0;
+    // JAL (major opcode 0x6F)
+    void decodeJAL(
+        SST::Output* output, const uint64_t ins_address, const uint32_t ins, VanadisInstructionBundle* bundle,
+        bool& decode_fault)
+    {
+        uint32_t op_code = extract_opcode(ins);
+        uint16_t rd  = 0;
+        int64_t  simm64     = 0;
 
-                switch(func_code3) {
-                case 0x2:
-                    op_width = 4;
-                    break;
-                case 0x3:
-                    op_width = 8;
-                    break;
-                default:
-                    op_width = 0;
-                    break;
-                }
+        // JAL
+        processJ<int64_t>(ins, op_code, rd, simm64);
+        // Immediate specifies jump in multiples of 2 byts per RISCV spec
+        const int64_t jump_to = static_cast<int64_t>(ins_address) + simm64;
 
+        output->verbose(
+            CALL_INFO, 16, 0,
+            "-----> JAL link-reg: %" PRIu16 " / jump-address: 0x%" PRI_ADDR " + %" PRId64 " = 0x%" PRI_ADDR "\n", rd, ins_address,
+            simm64, jump_to);
 
-#define AMO_W 0x2
-#define AMO_D 0x3
+        bundle->addInstruction(new VanadisJumpLinkInstruction(
+            ins_address, hw_thr, options, 4, rd, jump_to, VANADIS_NO_DELAY_SLOT));
+        decode_fault = false;
+    }
 
-#define LR 0x2
-#define SC 0x3
-#define AMO_SWAP 0x1
-#define AMO_ADD  0x0
-#define AMO_XOR  0x4 
-#define AMO_AND  0xc
-#define AMO_OR   0x8
-#define AMO_MIN  0x10
-#define AMO_MAX  0x14
-#define AMO_MINU 0x18
-#define AMO_MAXU 0x1c
+    // JALR (major opcode 0x67)
+    void decodeJALR(
+        SST::Output* output, const uint64_t ins_address, const uint32_t ins, VanadisInstructionBundle* bundle,
+        bool& decode_fault)
+    {
+        uint32_t op_code = extract_opcode(ins);
+        uint16_t rd  = 0;
+        uint16_t rs1 = 0;
+        uint32_t func_code3 = 0;
+        int64_t  simm64     = 0;
 
-                // need to mask out AQ and RL bits, these are used for deciding on fence operations
-                auto amo_op = (func_code7 & 0x7C) >> 2;
+        // JALR
+        processI<int64_t>(ins, op_code, rd, rs1, func_code3, simm64);
+
+        switch ( func_code3 ) {
+        case 0:
+        {
+            // TODO - may need to zero bit 1 with an AND microop?
+            bundle->addInstruction(new VanadisJumpRegLinkInstruction(
+                ins_address, hw_thr, options, 4, rd, rs1, simm64, VANADIS_NO_DELAY_SLOT));
+            decode_fault = false;
+        } break;
+        };
+    }
 
-                switch ( amo_op ) {
-                case AMO_SWAP:
-                {
-                    if(LIKELY(op_width != 0)) {
-                        // AMO.SWAP
-                        output->verbose(CALL_INFO, 16, 0,
-                            "-----> AMOSWAP 0x%" PRI_ADDR " / thr: %" PRIu32 " / %" PRIu16 " <- memory[ %" PRIu16 " ] <- %" PRIu16
-                            " / width: %" PRIu32 " / aq: %s / rl: %s\n",
-                            ins_address, hw_thr, rd, rs1, rs2, op_width, perform_aq ?  "yes" : "no", perform_rl ? "yes" : "no");
-
-                        if(LIKELY(perform_aq)) {
-                            bundle->addInstruction(new VanadisFenceInstruction(ins_address, hw_thr, options, VANADIS_LOAD_STORE_FENCE));
-                        }
+    // BRANCH (major opcode 0x63)
+    void decodeBranch(
+        SST::Output* output, const uint64_t ins_address, const uint32_t ins, VanadisInstructionBundle* bundle,
+        bool& decode_fault)
+    {
+        uint32_t op_code = extract_opcode(ins);
+        uint16_t rs1 = 0;
+        uint16_t rs2 = 0;
+        uint32_t func_code  = 0;
+        int64_t  simm64     = 0;
 
-                        // implement a micro-op sequence for AMOSWAP (yuck)
-                        bundle->addInstruction(new VanadisLoadInstruction(
-                                    ins_address, hw_thr, options, rs1, 0, /* place in r34 */ 34, op_width,
-                                    true, MEM_TRANSACTION_LLSC_LOAD,
-                                    LOAD_INT_REGISTER));
-
-                        // 0 is a success, 1 is a failure
-                        bundle->addInstruction(new VanadisStoreConditionalInstruction(
-                                ins_address, hw_thr, options, rs1, 0, rs2, /* place in r33 */ 33, op_width,
-                                STORE_INT_REGISTER, 0, 1));
-
-                        // conditionally copy the loaded value into rd IF the store-conditional was successful
-                        // copy r32 into rd if r33 == 0
-                        bundle->addInstruction(new VanadisConditionalMoveImmInstruction<int64_t, int64_t, REG_COMPARE_EQ>(
-                                ins_address, hw_thr, options, rd, 34, 33, 0
-                        ));
-
-                        // branch back to this instruction address IF r33 == 1 (which means the store failed)
-                        bundle->addInstruction(new VanadisBranchRegCompareImmInstruction<int64_t, REG_COMPARE_EQ>(
-                            ins_address, hw_thr, options, 4, 33, 1,
-                            /* offset is 0 so we replay this instruction */ 0, VANADIS_NO_DELAY_SLOT
-                        ));
-
-                        if(LIKELY(perform_rl)) {
-                            bundle->addInstruction(new VanadisFenceInstruction(ins_address, hw_thr, options, VANADIS_LOAD_STORE_FENCE));
-                        }
+        // Branch
+        processB<int64_t>(ins, op_code, rs1, rs2, func_code, simm64);
 
-                        decode_fault = false;
-                    }
-                } break;
-                case AMO_ADD:
-                case AMO_XOR:
-                case AMO_OR:
-                case AMO_AND:
-                case AMO_MIN:
-                case AMO_MAX:
-                case AMO_MINU:
-                case AMO_MAXU:
-                {
-                    if(LIKELY(op_width != 0)) {
-                        output->verbose(CALL_INFO, 16, 0,
-                            "-----> %s.%s 0x%llx / thr: %" PRIu32 " / %" PRIu16 " <- memory[ %" PRIu16 " ] <- %" PRIu16
-                            " / width: %" PRIu32 " / aq: %s / rl: %s\n",
-                            getAMO_name(amo_op).c_str(), getAMO_type( func_code3 ).c_str(),
-                            ins_address, hw_thr, rd, rs1, rs2, op_width, perform_aq ?  "yes" : "no", perform_rl ? "yes" : "no");
-
-                        if(LIKELY(perform_aq)) {
-                            bundle->addInstruction(new VanadisFenceInstruction(ins_address, hw_thr, options, VANADIS_LOAD_STORE_FENCE));
-                        }
+        switch ( func_code ) {
+        case 0:
+        {
+            // BEQ
+            output->verbose(
+                CALL_INFO, 16, 0, "-----> BEQ %" PRIu16 " == %" PRIu16 " / offset: %" PRId64 "\n", rs1, rs2,
+                simm64);
+            bundle->addInstruction(new VanadisBranchRegCompareInstruction<int64_t, REG_COMPARE_EQ>(
+                ins_address, hw_thr, options, 4, rs1, rs2, simm64, VANADIS_NO_DELAY_SLOT));
+            decode_fault = false;
+        } break;
+        case 1:
+        {
+            // BNE
+            output->verbose(
+                CALL_INFO, 16, 0,
+                "-----> BNE %" PRIu16 " != %" PRIu16 " / offset: %" PRId64 " (ip+offset %" PRIu64 ")\n", rs1,
+                rs2, simm64, ins_address + simm64);
+            bundle->addInstruction(new VanadisBranchRegCompareInstruction<int64_t, REG_COMPARE_NEQ>(
+                ins_address, hw_thr, options, 4, rs1, rs2, simm64, VANADIS_NO_DELAY_SLOT));
+            decode_fault = false;
+        } break;
+        case 4:
+        {
+            // BLT
+            output->verbose(
+                CALL_INFO, 16, 0, "-----> BLT %" PRIu16 " < %" PRIu16 " / offset: %" PRId64 "\n", rs1, rs2,
+                simm64);
+            bundle->addInstruction(new VanadisBranchRegCompareInstruction<int64_t, REG_COMPARE_LT>(
+                ins_address, hw_thr, options, 4, rs1, rs2, simm64, VANADIS_NO_DELAY_SLOT));
+            decode_fault = false;
+        } break;
+        case 5:
+        {
+            // BGE
+            output->verbose(
+                CALL_INFO, 16, 0, "-----> BGE %" PRIu16 " >= %" PRIu16 " / offset: %" PRId64 "\n", rs1, rs2,
+                simm64);
+            bundle->addInstruction(new VanadisBranchRegCompareInstruction<int64_t, REG_COMPARE_GTE>(
+                ins_address, hw_thr, options, 4, rs1, rs2, simm64, VANADIS_NO_DELAY_SLOT));
+            decode_fault = false;
+        } break;
+        case 6:
+        {
+            // BLTU
+            bundle->addInstruction(new VanadisBranchRegCompareInstruction<uint64_t, REG_COMPARE_LT>(
+                ins_address, hw_thr, options, 4, rs1, rs2, simm64, VANADIS_NO_DELAY_SLOT));
+            decode_fault = false;
+        } break;
+        case 7:
+        {
+            // BGEU
+            bundle->addInstruction(new VanadisBranchRegCompareInstruction<uint64_t, REG_COMPARE_GTE>(
+                ins_address, hw_thr, options, 4, rs1, rs2, simm64, VANADIS_NO_DELAY_SLOT));
+            decode_fault = false;
+        } break;
+        };
+    }
 
-                        // (r1) -> rd
-                        bundle->addInstruction(new VanadisLoadInstruction(
-                                    ins_address, hw_thr, options, rs1, 0, 34, op_width,
-                                    true, MEM_TRANSACTION_LLSC_LOAD,
-                                    LOAD_INT_REGISTER));
-
-                        // r34 OP rs2 => r32
-                        switch( amo_op ) { 
-                        case AMO_ADD:
-                            bundle->addInstruction( new VanadisAddInstruction<int64_t>( ins_address, hw_thr, options, 32, 34, rs2));
-                            break;
-                        case AMO_XOR:
-                            bundle->addInstruction( new VanadisXorInstruction( ins_address, hw_thr, options, 32, 34, rs2)); 
-                            break;
-                        case AMO_OR:
-                            bundle->addInstruction( new VanadisOrInstruction( ins_address, hw_thr, options, 32, 34, rs2)); 
-                            break;
-                        case AMO_AND:
-                            bundle->addInstruction( new VanadisAndInstruction( ins_address, hw_thr, options, 32, 34, rs2));
-                            break;
-                        case AMO_MIN:
-                            if ( AMO_W == func_code3 ) {
-                                bundle->addInstruction( new VanadisMinInstruction<int32_t,true>( ins_address, hw_thr, options, 32, 34, rs2));
-                            } else {
-                                bundle->addInstruction( new VanadisMinInstruction<int64_t,true>( ins_address, hw_thr, options, 32, 34, rs2));
-                            }
-                            break;
-                        case AMO_MAX:
-                            if ( AMO_W == func_code3 ) {
-                                bundle->addInstruction( new VanadisMinInstruction<int32_t,false>( ins_address, hw_thr, options, 32, 34, rs2));
-                            } else {
-                                bundle->addInstruction( new VanadisMinInstruction<int64_t,false>( ins_address, hw_thr, options, 32, 34, rs2));
-                            }
-                            break;
-                        case AMO_MINU:
-                            if ( AMO_W == func_code3 ) {
-                                bundle->addInstruction( new VanadisMinInstruction<uint32_t,true>( ins_address, hw_thr, options, 32, 34, rs2));
-                            } else {
-                                bundle->addInstruction( new VanadisMinInstruction<uint64_t,true>( ins_address, hw_thr, options, 32, 34, rs2));
-                            }
-                            break;
-                        case AMO_MAXU:
-                            if ( AMO_W == func_code3 ) {
-                                bundle->addInstruction( new VanadisMinInstruction<uint32_t,false>( ins_address, hw_thr, options, 32, 34, rs2));
-                            } else {
-                                bundle->addInstruction( new VanadisMinInstruction<uint64_t,false>( ins_address, hw_thr, options, 32, 34, rs2));
-                            }
-                            break;
-                        default: assert(0);
-                        }
+    // SYSTEM (major opcode 0x73)
+    void decodeSystem(
+        SST::Output* output, const uint64_t ins_address, const uint32_t ins, VanadisInstructionBundle* bundle,
+        bool& decode_fault)
+    {
+        uint32_t op_code = extract_opcode(ins);
+        uint16_t rd  = 0;
+        uint16_t rs1 = 0;
+        uint32_t func_code  = 0;
+        uint64_t uimm64     = 0;
 
-                        // r32 -> (rs1) and place success code in r33
-                        // 0 is a success, 1 is a failure
-                        bundle->addInstruction(new VanadisStoreConditionalInstruction(
-                                ins_address, hw_thr, options, rs1, 0, 32, /* success code */ 33, op_width,
-                                STORE_INT_REGISTER, 0, 1));
-
-                        // conditionally copy the loaded value into rd IF the store-conditional was successful
-                        // copy r34 into rd if r33 == 0
-                        bundle->addInstruction(new VanadisConditionalMoveImmInstruction<int64_t, int64_t, REG_COMPARE_EQ>(
-                                ins_address, hw_thr, options, rd, 34, 33, 0
-                        ));
-
-                        // branch back to this instruction address IF r33 == 1 (which means the store failed)
-                        bundle->addInstruction(new VanadisBranchRegCompareImmInstruction<int64_t, REG_COMPARE_EQ>(
-                            ins_address, hw_thr, options, 4, 33, 1,
-                            /* offset is 0 so we replay this instruction */ 0, VANADIS_NO_DELAY_SLOT
-                        ));
-
-                        if(LIKELY(perform_rl)) {
-                            bundle->addInstruction(new VanadisFenceInstruction(ins_address, hw_thr, options, VANADIS_LOAD_STORE_FENCE));
-                        }
+        // Syscall/ECALL and EBREAK
+        // Control registers
 
-                        decode_fault = false;
-                    }
-                } break;
-                case LR:
-                {
-                    if ( rs2 == 0 ) {
-                        // LR.?.AQ.RL
-                        if(LIKELY(op_width != 0)) {
-                            output->verbose(
-                                CALL_INFO, 16, 0, "-----> LR 0x%" PRI_ADDR " / thr: %" PRIu32 " / (LLSC_LOAD) %" PRIu16 " <- memory[ %" PRIu16 " ] / width: %" PRIu32 " / aq: %s / rl: %s\n",
-                                    ins_address, hw_thr, rd, rs1, op_width, perform_aq ?  "yes" : "no", perform_rl ? "yes" : "no");
+        processI<uint64_t>(ins, op_code, rd, rs1, func_code, uimm64);
 
-                            if(LIKELY(perform_aq)) {
-                                bundle->addInstruction(new VanadisFenceInstruction(ins_address, hw_thr, options, VANADIS_LOAD_STORE_FENCE));
-                            }
+        if ( (0 == rd) && (0 == rs1) && (0 == func_code) ) {
+            uint32_t func_code12 = (ins & 0xFFF00000);
 
-                            bundle->addInstruction(new VanadisLoadInstruction(
-                                ins_address, hw_thr, options, rs1, 0, rd, op_width, true, MEM_TRANSACTION_LLSC_LOAD,
-                                LOAD_INT_REGISTER));
+            switch ( func_code12 ) {
+            case 0x0: // SCALL
+            {
+                output->verbose(CALL_INFO, 16, 0, "------> ECALL/SYSCALL\n");
+                bundle->addInstruction(new VanadisFenceInstruction(ins_address, hw_thr, options, VANADIS_LOAD_STORE_FENCE));
+                bundle->addInstruction(new VanadisSysCallInstruction(ins_address, hw_thr, options));
+                decode_fault = false;
+            } break;
+            case 0x1: // SBREAK
+            {
+                printf("%#llx %#x SBREAK\n",ins_address,ins);
+                assert(0);
+            } break;
+            } 
+        } else { 
+            // CSRRW(I) atomic reaad/write
+            // CSRRS(I) atomic read and set bits
+            // CSRRC(I) atomic read and clear bit
+            output->verbose(
+                    CALL_INFO, 16, 0, "-----> %s: ins: 0x%" PRI_ADDR " / %#" PRIx64 " / rd: %" PRIu16 " / rs1: %" PRIu16 "\n", 
+                                getCSR_name(func_code).c_str(),ins_address, uimm64, rd, rs1);
 
-                            if(LIKELY(perform_rl)) {
-                                bundle->addInstruction(new VanadisFenceInstruction(ins_address, hw_thr, options, VANADIS_LOAD_STORE_FENCE));
-                            }
+            switch ( uimm64 ) 
+            {
+                case 0x1: // FSFLAGS
+                {
+                    output->verbose( CALL_INFO, 16, 0, "----->  FFLAGS: %" PRIu64 " / rd: %" PRIu16 " / rs1: %" PRIu16 "\n", uimm64, rd, rs1);
 
-                            decode_fault = false;
-                        }
+                    if ( ! ( ( 0x1 == func_code || 0x3 == func_code ) && 0 == rd ) ) {
+                        bundle->addInstruction(new VanadisFPFlagsReadInstruction<false, false, true>(ins_address, hw_thr, options, fpflags, rd));
                     }
-                    else {
-                        // ?
+                    if ( ! ( 0x2 == func_code && rs1 == 0 ) ) {
+                        if ( func_code & 0x4 ) {
+                            bundle->addInstruction(
+                               new VanadisFPFlagsSetImmInstruction<false,true>(ins_address, hw_thr, options, fpflags, static_cast<uint64_t>(rs1), func_code & 0x3));
+                        } else {
+                            bundle->addInstruction(
+                                new VanadisFPFlagsSetInstruction<false,true>(ins_address, hw_thr, options, fpflags, rs1, func_code & 0x3 ));
+                        }
                     }
+                    decode_fault = false;
                 } break;
-                case SC:
+                case 0x2: // FSRM
                 {
-                    if(LIKELY(op_width != 0)) {
-                        output->verbose(
-                            CALL_INFO, 16, 0,
-                            "-----> SC 0x%" PRI_ADDR " / thr: %" PRIu32 " / (LLSC_STORE) %" PRIu16 " -> memory[ %" PRIu16 " ] / result: %" PRIu16 " / width: %" PRIu32 " / aq: %s / rl: %s\n",
-                            ins_address, hw_thr, rs2, rs1, rd, op_width, perform_aq ?  "yes" : "no", perform_rl ? "yes" : "no");
+                    output->verbose( CALL_INFO, 16, 0, "----->  FRM: %" PRIu64 " / rd: %" PRIu16 " / rs1: %" PRIu16 "\n", uimm64, rd, rs1);
 
-                        if(LIKELY(perform_aq)) {
-                            bundle->addInstruction(new VanadisFenceInstruction(ins_address, hw_thr, options, VANADIS_LOAD_STORE_FENCE));
+                    if ( ! ( ( 0x1 == func_code || 0x3 == func_code ) && 0 == rd ) ) {
+                        bundle->addInstruction(new VanadisFPFlagsReadInstruction<true, false, false>(ins_address, hw_thr, options, fpflags, rd));
+                    }
+                    if ( ! ( 0x2 == func_code && rs1 == 0 ) ) {
+                         if ( func_code & 0x4 ) {
+                            bundle->addInstruction(
+                                new VanadisFPFlagsSetImmInstruction<true,false>(ins_address, hw_thr, options, fpflags, static_cast<uint64_t>(rs1), func_code & 0x3));
+                        } else {
+                            bundle->addInstruction(
+                                new VanadisFPFlagsSetInstruction<true,false>(ins_address, hw_thr, options, fpflags, rs1, func_code & 0x3));
                         }
+                    }
+                    decode_fault = false;
+                } break;
+                case 0x3: // FCSR
+                {
+                    output->verbose( CALL_INFO, 16, 0, "-----> FCSR: %" PRIu64 " / rd: %" PRIu16 " / rs1: %" PRIu16 "\n", uimm64, rd, rs1);
 
-                        bundle->addInstruction(new VanadisStoreConditionalInstruction(
-                            ins_address, hw_thr, options, rs1, 0, rs2, rd, op_width, STORE_INT_REGISTER, 0, 1));
-
-                        if(LIKELY(perform_rl)) {
-                            bundle->addInstruction(new VanadisFenceInstruction(ins_address, hw_thr, options, VANADIS_LOAD_STORE_FENCE));
+                    if ( ! ( ( 0x1 == func_code || 0x3 == func_code ) && 0 == rd ) ) {
+                        bundle->addInstruction(new VanadisFPFlagsReadInstruction<true, true, true>(ins_address, hw_thr, options, fpflags, rd));
+                    } 
+                    if ( ! ( 0x2 == func_code && rs1 == 0 ) ) {
+                        if ( func_code & 0x4 ) {
+                            bundle->addInstruction(
+                                new VanadisFPFlagsSetImmInstruction<true,true>(ins_address, hw_thr, options, fpflags, static_cast<uint64_t>(rs1), func_code & 0x3));
+                        } else {
+                            bundle->addInstruction(
+                                new VanadisFPFlagsSetInstruction<true,true>(ins_address, hw_thr, options, fpflags, rs1, func_code & 0x3));
                         }
-
-                        decode_fault = false;
                     }
-                } break;
+                    decode_fault = false;
+              } break;
+              default:
+              {
+                uint64_t csrNum = uimm64 & 0xfff;
+                switch ( csrNum ) {
+                    case 0xc00:
+                    {
+                        if ( 0 == rs1 ) {
+                            auto thread_call = std::bind(&VanadisRISCV64Decoder::getCycleCount, this);
+                            bundle->addInstruction( new VanadisSetRegisterByCallInstruction<int64_t>( ins_address, hw_thr, options, rd, thread_call));
+                            decode_fault = false;
+                        }
+                    } break;
                 }
-            } break;
-            case 0x27:
-            {
-                // Floating point store
-					 processS<int64_t>(ins, op_code, rs1, rs2, func_code3, simm64);
 
-					 output->verbose(CALL_INFO, 16, 0, "---> STORE-FP func_code3=%" PRIu32 " imm=%" PRId64 " / rs1: %" PRIu16 " / rs2: %" PRIu16 "\n",
-						func_code3, simm64, rs1, rs2);
+              } break;
+            }
+        }
+    }
 
-					switch(func_code3) {
-					case 0x2:
-						{
-							output->verbose(CALL_INFO, 16, 0, "-------> FSW imm=%" PRId64 " / rs1: %" PRIu16 " / rs2: %" PRIu16 "\n", simm64, rs1, rs2);
-							bundle->addInstruction(new VanadisStoreInstruction(
-                        ins_address, hw_thr, options, rs1, simm64, rs2, 4, MEM_TRANSACTION_NONE, STORE_FP_REGISTER));
-                        decode_fault = false;
-						} break;
-					case 0x3:
-						{
-							output->verbose(CALL_INFO, 16, 0, "-------> FSD imm=%" PRId64 " / rs1: %" PRIu16 " / rs2: %" PRIu16 "\n", simm64, rs1, rs2);
-							bundle->addInstruction(new VanadisStoreInstruction(
-                        ins_address, hw_thr, options, rs1, simm64, rs2, 8, MEM_TRANSACTION_NONE, STORE_FP_REGISTER));
-                        decode_fault = false;
-						} break;
-					}
-            } break;
-            case 0x53:
-            {
-                // floating point arithmetic
-                processR(ins, op_code, rd, rs1, rs2, func_code3, func_code7);
+    // OP-32 (major opcode 0x3B)
+    void decodeOp32(
+        SST::Output* output, const uint64_t ins_address, const uint32_t ins, VanadisInstructionBundle* bundle,
+        bool& decode_fault)
+    {
+        uint32_t op_code = extract_opcode(ins);
+        uint16_t rd  = 0;
+        uint16_t rs1 = 0;
+        uint16_t rs2 = 0;
+        uint32_t func_code3 = 0;
+        uint32_t func_code7 = 0;
 
-                output->verbose(
-                    CALL_INFO, 16, 0, "---> func_code3=%" PRIu32 " / func_code7=%" PRIu32 "\n", func_code3, func_code7);
+        // 64b integer arithmetic-W
+        processR(ins, op_code, rd, rs1, rs2, func_code3, func_code7);
 
-                switch ( func_code7 ) {
-                case 44:
-                {
-                    //FSQRT.S
-                    output->verbose(
-                        CALL_INFO, 16, 0, "-----> FSQRT.S %" PRIu16 " <- %" PRIu16 "\n", rd, rs1);
-                    bundle->addInstruction(
-                        new VanadisFPSquareRootInstruction<float>(ins_address, hw_thr, options, fpflags, rd, rs1));
-                    decode_fault = false;
-                } break;
-                case 45:
-                {
-                    //FSQRT.D
-                    output->verbose(
-                        CALL_INFO, 16, 0, "-----> FSQRT.D %" PRIu16 " <- %" PRIu16 "\n", rd, rs1);
-                    bundle->addInstruction(
-                        new VanadisFPSquareRootInstruction<double>(ins_address, hw_thr, options, fpflags, rd, rs1));
-                    decode_fault = false;
-                } break;
-                case 0:
-                {
-                    // FADD.S
+        switch ( func_code3 ) {
+        case 0:
+        {
+            switch ( func_code7 ) {
+            case 0x0:
+            {
+                // ADDW
+                // TODO - check register ordering
+                bundle->addInstruction(
+                    new VanadisAddInstruction<int32_t>(
+                        ins_address, hw_thr, options, rd, rs1, rs2));
+                decode_fault = false;
+            } break;
+            case 0x1:
+            {
+                // MULW
+                // TODO - check register ordering
+                bundle->addInstruction(
+                    new VanadisMultiplyInstruction<int32_t>(
+                        ins_address, hw_thr, options, rd, rs1, rs2));
+                decode_fault = false;
+            } break;
+            case 0x20:
+            {
+                // SUBW
+                // TODO - check register ordering
+                bundle->addInstruction(new VanadisSubInstruction<int32_t>(
+                    ins_address, hw_thr, options, rd, rs1, rs2, true));
+                decode_fault = false;
+            } break;
+            };
+        } break;
+        case 1:
+        {
+            switch ( func_code7 ) {
+            case 0x0:
+            {
+                // SLLW
+                // TODO - check register ordering
+                bundle->addInstruction(
+                    new VanadisShiftLeftLogicalInstruction<VanadisRegisterFormat::VANADIS_FORMAT_INT32>(
+                        ins_address, hw_thr, options, rd, rs1, rs2));
+                decode_fault = false;
+            } break;
+            };
+        } break;
+        case 4:
+        {
+            switch ( func_code7 ) {
+            case 0x1:
+            {
+                // DIVW
+                bundle->addInstruction(
+                    new VanadisDivideInstruction<int32_t>(
+                        ins_address, hw_thr, options, rd, rs1, rs2));
+                decode_fault = false;
+            } break;
+            };
+        } break;
+        case 5:
+        {
+            switch ( func_code7 ) {
+            case 0x0:
+            {
+                // SRLW
+                // TODO - check register ordering
+                bundle->addInstruction(
+                    new VanadisShiftRightLogicalInstruction<VanadisRegisterFormat::VANADIS_FORMAT_INT32>(
+                        ins_address, hw_thr, options, rd, rs1, rs2));
+                decode_fault = false;
+            } break;
+            case 0x1:
+            {
+                // DIVUW
+                bundle->addInstruction(
+                    new VanadisDivideInstruction<uint32_t>(
+                        ins_address, hw_thr, options, rd, rs1, rs2));
+                decode_fault = false;
+            } break;
+            case 0x20:
+            {
+                // SRAW
+                // TODO - check register ordering
+                bundle->addInstruction(
+                    new VanadisShiftRightArithmeticInstruction<VanadisRegisterFormat::VANADIS_FORMAT_INT32>(
+                        ins_address, hw_thr, options, rd, rs1, rs2));
+                decode_fault = false;
+            } break;
+            };
+        } break;
+        case 6:
+        {
+            switch ( func_code7 ) {
+            case 0x1:
+            {
+                // REMW
+                output->verbose(
+                    CALL_INFO, 16, 0, "----> REMW %" PRIu16 " <- %" PRIu16 " %% %" PRIu16 "\n", rd, rs1, rs2);
+                bundle->addInstruction(
+                    new VanadisModuloInstruction<int32_t>(
+                        ins_address, hw_thr, options, rd, rs1, rs2));
+                decode_fault = false;
+            } break;
+            };
+        } break;
+        case 7:
+        {
+            switch ( func_code7 ) {
+            case 0x1:
+            {
+                // REMUW
+                output->verbose(
+                    CALL_INFO, 16, 0, "----> REMUW %" PRIu16 " <- %" PRIu16 " %% %" PRIu16 "\n", rd, rs1, rs2);
+                bundle->addInstruction(
+                    new VanadisModuloInstruction<uint32_t>(
+                        ins_address, hw_thr, options, rd, rs1, rs2));
+                decode_fault = false;
+            } break;
+            }
+        }; break;
+        };
+    }
+
+    // MISC-MEM (major opcode 0xF)
+    void decodeMiscMem(
+        SST::Output* output, const uint64_t ins_address, const uint32_t ins, VanadisInstructionBundle* bundle,
+        bool& decode_fault)
+    {
+        uint32_t op_code = extract_opcode(ins);
+        uint16_t rd  = 0;
+        uint16_t rs1 = 0;
+        uint16_t rs2 = 0;
+        uint32_t func_code3 = 0;
+        uint32_t func_code7 = 0;
+
+         processR(ins, op_code, rd, rs1, rs2, func_code3, func_code7);
+         switch ( func_code3 ) {
+             case 0x0:
+             {
+                 // Fence operations
+                 // For now, we conduct a heavy fence
+                 // could optimize this to be more efficient
+                 output->verbose(CALL_INFO, 16, 0, "----> FENCE\n");
+                 bundle->addInstruction(
+                         new VanadisFenceInstruction(ins_address, hw_thr, options, VANADIS_LOAD_STORE_FENCE));
+                 decode_fault = false;
+             } break;
+         }
+    }
+
+    // AMO (major opcode 0x2F)
+    void decodeAMO(
+        SST::Output* output, const uint64_t ins_address, const uint32_t ins, VanadisInstructionBundle* bundle,
+        bool& decode_fault)
+    {
+        uint32_t op_code = extract_opcode(ins);
+        uint16_t rd  = 0;
+        uint16_t rs1 = 0;
+        uint16_t rs2 = 0;
+        uint32_t func_code3 = 0;
+        uint32_t func_code7 = 0;
+
+        // Atomic operations (A extension)
+        processR(ins, op_code, rd, rs1, rs2, func_code3, func_code7);
+
+        const bool perform_aq = func_code7 & 0x2;
+        const bool perform_rl = func_code7 & 0x1;
+
+        uint32_t op_width = 0;
+
+        switch(func_code3) {
+        case 0x2:
+            op_width = 4;
+            break;
+        case 0x3:
+            op_width = 8;
+            break;
+        default:
+            op_width = 0;
+            break;
+        }
+
+
+#define AMO_W 0x2
+#define AMO_D 0x3
+
+#define LR 0x2
+#define SC 0x3
+#define AMO_SWAP 0x1
+#define AMO_ADD  0x0
+#define AMO_XOR  0x4 
+#define AMO_AND  0xc
+#define AMO_OR   0x8
+#define AMO_MIN  0x10
+#define AMO_MAX  0x14
+#define AMO_MINU 0x18
+#define AMO_MAXU 0x1c
+
+        // need to mask out AQ and RL bits, these are used for deciding on fence operations
+        auto amo_op = (func_code7 & 0x7C) >> 2;
+
+        switch ( amo_op ) {
+        case AMO_SWAP:
+        {
+            if(LIKELY(op_width != 0)) {
+                // AMO.SWAP
+                output->verbose(CALL_INFO, 16, 0,
+                    "-----> AMOSWAP 0x%" PRI_ADDR " / thr: %" PRIu32 " / %" PRIu16 " <- memory[ %" PRIu16 " ] <- %" PRIu16
+                    " / width: %" PRIu32 " / aq: %s / rl: %s\n",
+                    ins_address, hw_thr, rd, rs1, rs2, op_width, perform_aq ?  "yes" : "no", perform_rl ? "yes" : "no");
+
+                if(LIKELY(perform_aq)) {
+                    bundle->addInstruction(new VanadisFenceInstruction(ins_address, hw_thr, options, VANADIS_LOAD_STORE_FENCE));
+                }
+
+                // implement a micro-op sequence for AMOSWAP (yuck)
+                bundle->addInstruction(new VanadisLoadInstruction(
+                            ins_address, hw_thr, options, rs1, 0, /* place in r34 */ 34, op_width,
+                            true, MEM_TRANSACTION_LLSC_LOAD,
+                            LOAD_INT_REGISTER));
+
+                // 0 is a success, 1 is a failure
+                bundle->addInstruction(new VanadisStoreConditionalInstruction(
+                        ins_address, hw_thr, options, rs1, 0, rs2, /* place in r33 */ 33, op_width,
+                        STORE_INT_REGISTER, 0, 1));
+
+                // conditionally copy the loaded value into rd IF the store-conditional was successful
+                // copy r32 into rd if r33 == 0
+                bundle->addInstruction(new VanadisConditionalMoveImmInstruction<int64_t, int64_t, REG_COMPARE_EQ>(
+                        ins_address, hw_thr, options, rd, 34, 33, 0
+                ));
+
+                // branch back to this instruction address IF r33 == 1 (which means the store failed)
+                bundle->addInstruction(new VanadisBranchRegCompareImmInstruction<int64_t, REG_COMPARE_EQ>(
+                    ins_address, hw_thr, options, 4, 33, 1,
+                    /* offset is 0 so we replay this instruction */ 0, VANADIS_NO_DELAY_SLOT
+                ));
+
+                if(LIKELY(perform_rl)) {
+                    bundle->addInstruction(new VanadisFenceInstruction(ins_address, hw_thr, options, VANADIS_LOAD_STORE_FENCE));
+                }
+
+                decode_fault = false;
+            }
+        } break;
+        case AMO_ADD:
+        case AMO_XOR:
+        case AMO_OR:
+        case AMO_AND:
+        case AMO_MIN:
+        case AMO_MAX:
+        case AMO_MINU:
+        case AMO_MAXU:
+        {
+            if(LIKELY(op_width != 0)) {
+                output->verbose(CALL_INFO, 16, 0,
+                    "-----> %s.%s 0x%llx / thr: %" PRIu32 " / %" PRIu16 " <- memory[ %" PRIu16 " ] <- %" PRIu16
+                    " / width: %" PRIu32 " / aq: %s / rl: %s\n",
+                    getAMO_name(amo_op).c_str(), getAMO_type( func_code3 ).c_str(),
+                    ins_address, hw_thr, rd, rs1, rs2, op_width, perform_aq ?  "yes" : "no", perform_rl ? "yes" : "no");
+
+                if(LIKELY(perform_aq)) {
+                    bundle->addInstruction(new VanadisFenceInstruction(ins_address, hw_thr, options, VANADIS_LOAD_STORE_FENCE));
+                }
+
+                // (r1) -> rd
+                bundle->addInstruction(new VanadisLoadInstruction(
+                            ins_address, hw_thr, options, rs1, 0, 34, op_width,
+                            true, MEM_TRANSACTION_LLSC_LOAD,
+                            LOAD_INT_REGISTER));
+
+                // r34 OP rs2 => r32
+                switch( amo_op ) { 
+                case AMO_ADD:
+                    bundle->addInstruction( new VanadisAddInstruction<int64_t>( ins_address, hw_thr, options, 32, 34, rs2));
+                    break;
+                case AMO_XOR:
+                    bundle->addInstruction( new VanadisXorInstruction( ins_address, hw_thr, options, 32, 34, rs2)); 
+                    break;
+                case AMO_OR:
+                    bundle->addInstruction( new VanadisOrInstruction( ins_address, hw_thr, options, 32, 34, rs2)); 
+                    break;
+                case AMO_AND:
+                    bundle->addInstruction( new VanadisAndInstruction( ins_address, hw_thr, options, 32, 34, rs2));
+                    break;
+                case AMO_MIN:
+                    if ( AMO_W == func_code3 ) {
+                        bundle->addInstruction( new VanadisMinInstruction<int32_t,true>( ins_address, hw_thr, options, 32, 34, rs2));
+                    } else {
+                        bundle->addInstruction( new VanadisMinInstruction<int64_t,true>( ins_address, hw_thr, options, 32, 34, rs2));
+                    }
+                    break;
+                case AMO_MAX:
+                    if ( AMO_W == func_code3 ) {
+                        bundle->addInstruction( new VanadisMinInstruction<int32_t,false>( ins_address, hw_thr, options, 32, 34, rs2));
+                    } else {
+                        bundle->addInstruction( new VanadisMinInstruction<int64_t,false>( ins_address, hw_thr, options, 32, 34, rs2));
+                    }
+                    break;
+                case AMO_MINU:
+                    if ( AMO_W == func_code3 ) {
+                        bundle->addInstruction( new VanadisMinInstruction<uint32_t,true>( ins_address, hw_thr, options, 32, 34, rs2));
+                    } else {
+                        bundle->addInstruction( new VanadisMinInstruction<uint64_t,true>( ins_address, hw_thr, options, 32, 34, rs2));
+                    }
+                    break;
+                case AMO_MAXU:
+                    if ( AMO_W == func_code3 ) {
+                        bundle->addInstruction( new VanadisMinInstruction<uint32_t,false>( ins_address, hw_thr, options, 32, 34, rs2));
+                    } else {
+                        bundle->addInstruction( new VanadisMinInstruction<uint64_t,false>( ins_address, hw_thr, options, 32, 34, rs2));
+                    }
+                    break;
+                default: assert(0);
+                }
+
+                // r32 -> (rs1) and place success code in r33
+                // 0 is a success, 1 is a failure
+                bundle->addInstruction(new VanadisStoreConditionalInstruction(
+                        ins_address, hw_thr, options, rs1, 0, 32, /* success code */ 33, op_width,
+                        STORE_INT_REGISTER, 0, 1));
+
+                // conditionally copy the loaded value into rd IF the store-conditional was successful
+                // copy r34 into rd if r33 == 0
+                bundle->addInstruction(new VanadisConditionalMoveImmInstruction<int64_t, int64_t, REG_COMPARE_EQ>(
+                        ins_address, hw_thr, options, rd, 34, 33, 0
+                ));
+
+                // branch back to this instruction address IF r33 == 1 (which means the store failed)
+                bundle->addInstruction(new VanadisBranchRegCompareImmInstruction<int64_t, REG_COMPARE_EQ>(
+                    ins_address, hw_thr, options, 4, 33, 1,
+                    /* offset is 0 so we replay this instruction */ 0, VANADIS_NO_DELAY_SLOT
+                ));
+
+                if(LIKELY(perform_rl)) {
+                    bundle->addInstruction(new VanadisFenceInstruction(ins_address, hw_thr, options, VANADIS_LOAD_STORE_FENCE));
+                }
+
+                decode_fault = false;
+            }
+        } break;
+        case LR:
+        {
+            if ( rs2 == 0 ) {
+                // LR.?.AQ.RL
+                if(LIKELY(op_width != 0)) {
                     output->verbose(
-                        CALL_INFO, 16, 0, "-----> FADD.S %" PRIu16 " <- %" PRIu16 " + %" PRIu16 "\n", rd, rs1, rs2);
-                    bundle->addInstruction(
-                        new VanadisFPAddInstruction<float>(ins_address, hw_thr, options, fpflags, rd, rs1, rs2));
+                        CALL_INFO, 16, 0, "-----> LR 0x%" PRI_ADDR " / thr: %" PRIu32 " / (LLSC_LOAD) %" PRIu16 " <- memory[ %" PRIu16 " ] / width: %" PRIu32 " / aq: %s / rl: %s\n",
+                            ins_address, hw_thr, rd, rs1, op_width, perform_aq ?  "yes" : "no", perform_rl ? "yes" : "no");
+
+                    if(LIKELY(perform_aq)) {
+                        bundle->addInstruction(new VanadisFenceInstruction(ins_address, hw_thr, options, VANADIS_LOAD_STORE_FENCE));
+                    }
+
+                    bundle->addInstruction(new VanadisLoadInstruction(
+                        ins_address, hw_thr, options, rs1, 0, rd, op_width, true, MEM_TRANSACTION_LLSC_LOAD,
+                        LOAD_INT_REGISTER));
+
+                    if(LIKELY(perform_rl)) {
+                        bundle->addInstruction(new VanadisFenceInstruction(ins_address, hw_thr, options, VANADIS_LOAD_STORE_FENCE));
+                    }
+
                     decode_fault = false;
-                } break;
-                case 0x1:
+                }
+            }
+            else {
+                // ?
+            }
+        } break;
+        case SC:
+        {
+            if(LIKELY(op_width != 0)) {
+                output->verbose(
+                    CALL_INFO, 16, 0,
+                    "-----> SC 0x%" PRI_ADDR " / thr: %" PRIu32 " / (LLSC_STORE) %" PRIu16 " -> memory[ %" PRIu16 " ] / result: %" PRIu16 " / width: %" PRIu32 " / aq: %s / rl: %s\n",
+                    ins_address, hw_thr, rs2, rs1, rd, op_width, perform_aq ?  "yes" : "no", perform_rl ? "yes" : "no");
+
+                if(LIKELY(perform_aq)) {
+                    bundle->addInstruction(new VanadisFenceInstruction(ins_address, hw_thr, options, VANADIS_LOAD_STORE_FENCE));
+                }
+
+                bundle->addInstruction(new VanadisStoreConditionalInstruction(
+                    ins_address, hw_thr, options, rs1, 0, rs2, rd, op_width, STORE_INT_REGISTER, 0, 1));
+
+                if(LIKELY(perform_rl)) {
+                    bundle->addInstruction(new VanadisFenceInstruction(ins_address, hw_thr, options, VANADIS_LOAD_STORE_FENCE));
+                }
+
+                decode_fault = false;
+            }
+        } break;
+        }
+    }
+
+    // STORE-FP (major opcode 0x27)
+    void decodeStoreFP(
+        SST::Output* output, const uint64_t ins_address, const uint32_t ins, VanadisInstructionBundle* bundle,
+        bool& decode_fault)
+    {
+        uint32_t op_code = extract_opcode(ins);
+        uint16_t rs1 = 0;
+        uint16_t rs2 = 0;
+        uint32_t func_code3 = 0;
+        int64_t  simm64     = 0;
+
+        // Floating point store
+             processS<int64_t>(ins, op_code, rs1, rs2, func_code3, simm64);
+
+             output->verbose(CALL_INFO, 16, 0, "---> STORE-FP func_code3=%" PRIu32 " imm=%" PRId64 " / rs1: %" PRIu16 " / rs2: %" PRIu16 "\n",
+                func_code3, simm64, rs1, rs2);
+
+            switch(func_code3) {
+            case 0x2:
                 {
-                    // FADD.D
-                    output->verbose(
-                        CALL_INFO, 16, 0, "-----> FADD.D %" PRIu16 " <- %" PRIu16 " + %" PRIu16 "\n", rd, rs1, rs2);
-                    bundle->addInstruction(
-                        new VanadisFPAddInstruction<double>(ins_address, hw_thr, options, fpflags, rd, rs1, rs2));
-                    decode_fault = false;
+                    output->verbose(CALL_INFO, 16, 0, "-------> FSW imm=%" PRId64 " / rs1: %" PRIu16 " / rs2: %" PRIu16 "\n", simm64, rs1, rs2);
+                    bundle->addInstruction(new VanadisStoreInstruction(
+                ins_address, hw_thr, options, rs1, simm64, rs2, 4, MEM_TRANSACTION_NONE, STORE_FP_REGISTER));
+                decode_fault = false;
                 } break;
-                case 4:
+            case 0x3:
                 {
-                    // FSUB.S
-                    output->verbose(
-                        CALL_INFO, 16, 0, "-----> FSUB.S %" PRIu16 " <- %" PRIu16 " + %" PRIu16 "\n", rd, rs1, rs2);
-                    bundle->addInstruction(
-                        new VanadisFPSubInstruction<float>(ins_address, hw_thr, options, fpflags, rd, rs1, rs2));
-                    decode_fault = false;
+                    output->verbose(CALL_INFO, 16, 0, "-------> FSD imm=%" PRId64 " / rs1: %" PRIu16 " / rs2: %" PRIu16 "\n", simm64, rs1, rs2);
+                    bundle->addInstruction(new VanadisStoreInstruction(
+                ins_address, hw_thr, options, rs1, simm64, rs2, 8, MEM_TRANSACTION_NONE, STORE_FP_REGISTER));
+                decode_fault = false;
                 } break;
-                case 5:
+            }
+    }
+
+    // OP-FP (major opcode 0x53)
+    void decodeOpFP(
+        SST::Output* output, const uint64_t ins_address, const uint32_t ins, VanadisInstructionBundle* bundle,
+        bool& decode_fault)
+    {
+        uint32_t op_code = extract_opcode(ins);
+        uint16_t rd  = 0;
+        uint16_t rs1 = 0;
+        uint16_t rs2 = 0;
+        uint32_t func_code3 = 0;
+        uint32_t func_code7 = 0;
+
+        // floating point arithmetic
+        processR(ins, op_code, rd, rs1, rs2, func_code3, func_code7);
+
+        output->verbose(
+            CALL_INFO, 16, 0, "---> func_code3=%" PRIu32 " / func_code7=%" PRIu32 "\n", func_code3, func_code7);
+
+        switch ( func_code7 ) {
+        case 44:
+        {
+            //FSQRT.S
+            output->verbose(
+                CALL_INFO, 16, 0, "-----> FSQRT.S %" PRIu16 " <- %" PRIu16 "\n", rd, rs1);
+            bundle->addInstruction(
+                new VanadisFPSquareRootInstruction<float>(ins_address, hw_thr, options, fpflags, rd, rs1));
+            decode_fault = false;
+        } break;
+        case 45:
+        {
+            //FSQRT.D
+            output->verbose(
+                CALL_INFO, 16, 0, "-----> FSQRT.D %" PRIu16 " <- %" PRIu16 "\n", rd, rs1);
+            bundle->addInstruction(
+                new VanadisFPSquareRootInstruction<double>(ins_address, hw_thr, options, fpflags, rd, rs1));
+            decode_fault = false;
+        } break;
+        case 0:
+        {
+            // FADD.S
+            output->verbose(
+                CALL_INFO, 16, 0, "-----> FADD.S %" PRIu16 " <- %" PRIu16 " + %" PRIu16 "\n", rd, rs1, rs2);
+            bundle->addInstruction(
+                new VanadisFPAddInstruction<float>(ins_address, hw_thr, options, fpflags, rd, rs1, rs2));
+            decode_fault = false;
+        } break;
+        case 0x1:
+        {
+            // FADD.D
+            output->verbose(
+                CALL_INFO, 16, 0, "-----> FADD.D %" PRIu16 " <- %" PRIu16 " + %" PRIu16 "\n", rd, rs1, rs2);
+            bundle->addInstruction(
+                new VanadisFPAddInstruction<double>(ins_address, hw_thr, options, fpflags, rd, rs1, rs2));
+            decode_fault = false;
+        } break;
+        case 4:
+        {
+            // FSUB.S
+            output->verbose(
+                CALL_INFO, 16, 0, "-----> FSUB.S %" PRIu16 " <- %" PRIu16 " + %" PRIu16 "\n", rd, rs1, rs2);
+            bundle->addInstruction(
+                new VanadisFPSubInstruction<float>(ins_address, hw_thr, options, fpflags, rd, rs1, rs2));
+            decode_fault = false;
+        } break;
+        case 5:
+        {
+            // FSUB.D
+            output->verbose(
+                CALL_INFO, 16, 0, "-----> FSUB.D %" PRIu16 " <- %" PRIu16 " + %" PRIu16 "\n", rd, rs1, rs2);
+            bundle->addInstruction(
+                new VanadisFPSubInstruction<double>(ins_address, hw_thr, options, fpflags, rd, rs1, rs2));
+            decode_fault = false;
+        } break;
+             case 8:
+             {
+                    // FMUL.S
+            output->verbose(
+                CALL_INFO, 16, 0, "-----> FMUL.S %" PRIu16 " <- %" PRIu16 " * %" PRIu16 "\n", rd, rs1, rs2);
+            bundle->addInstruction(
+                new VanadisFPMultiplyInstruction<float>(ins_address, hw_thr, options, fpflags, rd, rs1, rs2));
+            decode_fault = false;
+             } break;
+        case 9:
+        {
+            // FMUL.D
+            output->verbose(
+                CALL_INFO, 16, 0, "-----> FMUL.D %" PRIu16 " <- %" PRIu16 " * %" PRIu16 "\n", rd, rs1, rs2);
+            bundle->addInstruction(
+                new VanadisFPMultiplyInstruction<double>(ins_address, hw_thr, options, fpflags, rd, rs1, rs2));
+            decode_fault = false;
+        } break;
+        case 16:
+        {
+            switch ( func_code3 ) {
+            case 0:
+            {
+                output->verbose(
+                    CALL_INFO, 16, 0, "-----> FSGNJ.S %" PRIu16 " <- %" PRIu16 " / %" PRIu16 "\n", rd, rs1,
+                    rs2);
+                bundle->addInstruction(
+                    new VanadisFPSignLogicInstruction<float, VanadisFPSignLogicOperation::SIGN_COPY>(
+                        ins_address, hw_thr, options, fpflags, rd, rs1, rs2));
+                decode_fault = false;
+            } break;
+            case 1:
+            {
+                output->verbose(
+                    CALL_INFO, 16, 0, "-----> FSGNJN.S %" PRIu16 " <- %" PRIu16 " / %" PRIu16 "\n", rd, rs1,
+                    rs2);
+                bundle->addInstruction(
+                    new VanadisFPSignLogicInstruction<float, VanadisFPSignLogicOperation::SIGN_NEG>(
+                        ins_address, hw_thr, options, fpflags, rd, rs1, rs2));
+                decode_fault = false;
+            } break;
+            case 2:
+            {
+                output->verbose(
+                    CALL_INFO, 16, 0, "-----> FSGNJX.S %" PRIu16 " <- %" PRIu16 " / %" PRIu16 "\n", rd, rs1,
+                    rs2);
+                bundle->addInstruction(
+                    new VanadisFPSignLogicInstruction<float, VanadisFPSignLogicOperation::SIGN_XOR>(
+                        ins_address, hw_thr, options, fpflags, rd, rs1, rs2));
+                decode_fault = false;
+            } break;
+            }
+        } break;
+        case 17:
+        {
+            switch ( func_code3 ) {
+            case 0:
+            {
+                output->verbose(
+                    CALL_INFO, 16, 0, "-----> FSGNJ.D %" PRIu16 " <- %" PRIu16 " / %" PRIu16 "\n", rd, rs1,
+                    rs2);
+                bundle->addInstruction(
+                    new VanadisFPSignLogicInstruction<double, VanadisFPSignLogicOperation::SIGN_COPY>(
+                        ins_address, hw_thr, options, fpflags, rd, rs1, rs2));
+                decode_fault = false;
+            } break;
+            case 1:
+            {
+                output->verbose(
+                    CALL_INFO, 16, 0, "-----> FSGNJN.D %" PRIu16 " <- %" PRIu16 " / %" PRIu16 "\n", rd, rs1,
+                    rs2);
+                bundle->addInstruction(
+                    new VanadisFPSignLogicInstruction<double, VanadisFPSignLogicOperation::SIGN_NEG>(
+                        ins_address, hw_thr, options, fpflags, rd, rs1, rs2));
+                decode_fault = false;
+            } break;
+            case 2:
+            {
+                output->verbose(
+                    CALL_INFO, 16, 0, "-----> FSGNJX.D %" PRIu16 " <- %" PRIu16 " / %" PRIu16 "\n", rd, rs1,
+                    rs2);
+                bundle->addInstruction(
+                    new VanadisFPSignLogicInstruction<double, VanadisFPSignLogicOperation::SIGN_XOR>(
+                        ins_address, hw_thr, options, fpflags, rd, rs1, rs2));
+                decode_fault = false;
+            } break;
+            }
+        } break;
+             case 12:
+             {
+            output->verbose(
+                CALL_INFO, 16, 0, "---> FDIV.S %" PRIu16 " <- %" PRIu16 " / %" PRIu16 "\n", rd, rs1, rs2);
+            bundle->addInstruction(new VanadisFPDivideInstruction<float>(
+                ins_address, hw_thr, options, fpflags, rd, rs1, rs2));
+            decode_fault = false;
+             } break;
+        case 0xD:
+        {
+            output->verbose(
+                CALL_INFO, 16, 0, "---> FDIV.D %" PRIu16 " <- %" PRIu16 " / %" PRIu16 "\n", rd, rs1, rs2);
+            bundle->addInstruction(new VanadisFPDivideInstruction<double>(
+                ins_address, hw_thr, options, fpflags, rd, rs1, rs2));
+            decode_fault = false;
+        } break;
+        case 20:
+        {
+            switch ( func_code3 ) { 
+                case 0:
                 {
-                    // FSUB.D
                     output->verbose(
-                        CALL_INFO, 16, 0, "-----> FSUB.D %" PRIu16 " <- %" PRIu16 " + %" PRIu16 "\n", rd, rs1, rs2);
-                    bundle->addInstruction(
-                        new VanadisFPSubInstruction<double>(ins_address, hw_thr, options, fpflags, rd, rs1, rs2));
+                        CALL_INFO, 16, 0, "---> FMIN.S %" PRIu16 " <- %" PRIu16 " / %" PRIu16 "\n", rd, rs1, rs2);
+                    bundle->addInstruction(new VanadisFPMinimumInstruction<float,true>(
+                        ins_address, hw_thr, options, fpflags, rd, rs1, rs2));
                     decode_fault = false;
                 } break;
-					 case 8:
-					 {
-							// FMUL.S
-                    output->verbose(
-                        CALL_INFO, 16, 0, "-----> FMUL.S %" PRIu16 " <- %" PRIu16 " * %" PRIu16 "\n", rd, rs1, rs2);
-                    bundle->addInstruction(
-                        new VanadisFPMultiplyInstruction<float>(ins_address, hw_thr, options, fpflags, rd, rs1, rs2));
-                    decode_fault = false;
-					 } break;
-                case 9:
+                case 1:
                 {
-                    // FMUL.D
                     output->verbose(
-                        CALL_INFO, 16, 0, "-----> FMUL.D %" PRIu16 " <- %" PRIu16 " * %" PRIu16 "\n", rd, rs1, rs2);
-                    bundle->addInstruction(
-                        new VanadisFPMultiplyInstruction<double>(ins_address, hw_thr, options, fpflags, rd, rs1, rs2));
+                        CALL_INFO, 16, 0, "---> FMAX.S %" PRIu16 " <- %" PRIu16 " / %" PRIu16 "\n", rd, rs1, rs2);
+                    bundle->addInstruction(new VanadisFPMinimumInstruction<float,false>(
+                        ins_address, hw_thr, options, fpflags, rd, rs1, rs2));
                     decode_fault = false;
                 } break;
-                case 16:
-                {
-                    switch ( func_code3 ) {
-                    case 0:
-                    {
-                        output->verbose(
-                            CALL_INFO, 16, 0, "-----> FSGNJ.S %" PRIu16 " <- %" PRIu16 " / %" PRIu16 "\n", rd, rs1,
-                            rs2);
-                        bundle->addInstruction(
-                            new VanadisFPSignLogicInstruction<float, VanadisFPSignLogicOperation::SIGN_COPY>(
-                                ins_address, hw_thr, options, fpflags, rd, rs1, rs2));
-                        decode_fault = false;
-                    } break;
-                    case 1:
-                    {
-                        output->verbose(
-                            CALL_INFO, 16, 0, "-----> FSGNJN.S %" PRIu16 " <- %" PRIu16 " / %" PRIu16 "\n", rd, rs1,
-                            rs2);
-                        bundle->addInstruction(
-                            new VanadisFPSignLogicInstruction<float, VanadisFPSignLogicOperation::SIGN_NEG>(
-                                ins_address, hw_thr, options, fpflags, rd, rs1, rs2));
-                        decode_fault = false;
-                    } break;
-                    case 2:
-                    {
-                        output->verbose(
-                            CALL_INFO, 16, 0, "-----> FSGNJX.S %" PRIu16 " <- %" PRIu16 " / %" PRIu16 "\n", rd, rs1,
-                            rs2);
-                        bundle->addInstruction(
-                            new VanadisFPSignLogicInstruction<float, VanadisFPSignLogicOperation::SIGN_XOR>(
-                                ins_address, hw_thr, options, fpflags, rd, rs1, rs2));
-                        decode_fault = false;
-                    } break;
-                    }
-                } break;
-                case 17:
+            }
+        } break;
+        case 21:
+        {
+            switch ( func_code3 ) { 
+                case 0:
                 {
-                    switch ( func_code3 ) {
-                    case 0:
-                    {
-                        output->verbose(
-                            CALL_INFO, 16, 0, "-----> FSGNJ.D %" PRIu16 " <- %" PRIu16 " / %" PRIu16 "\n", rd, rs1,
-                            rs2);
-                        bundle->addInstruction(
-                            new VanadisFPSignLogicInstruction<double, VanadisFPSignLogicOperation::SIGN_COPY>(
-                                ins_address, hw_thr, options, fpflags, rd, rs1, rs2));
-                        decode_fault = false;
-                    } break;
-                    case 1:
-                    {
-                        output->verbose(
-                            CALL_INFO, 16, 0, "-----> FSGNJN.D %" PRIu16 " <- %" PRIu16 " / %" PRIu16 "\n", rd, rs1,
-                            rs2);
-                        bundle->addInstruction(
-                            new VanadisFPSignLogicInstruction<double, VanadisFPSignLogicOperation::SIGN_NEG>(
-                                ins_address, hw_thr, options, fpflags, rd, rs1, rs2));
-                        decode_fault = false;
-                    } break;
-                    case 2:
-                    {
-                        output->verbose(
-                            CALL_INFO, 16, 0, "-----> FSGNJX.D %" PRIu16 " <- %" PRIu16 " / %" PRIu16 "\n", rd, rs1,
-                            rs2);
-                        bundle->addInstruction(
-                            new VanadisFPSignLogicInstruction<double, VanadisFPSignLogicOperation::SIGN_XOR>(
-                                ins_address, hw_thr, options, fpflags, rd, rs1, rs2));
-                        decode_fault = false;
-                    } break;
-                    }
-                } break;
-					 case 12:
-					 {
                     output->verbose(
-                        CALL_INFO, 16, 0, "---> FDIV.S %" PRIu16 " <- %" PRIu16 " / %" PRIu16 "\n", rd, rs1, rs2);
-                    bundle->addInstruction(new VanadisFPDivideInstruction<float>(
+                        CALL_INFO, 16, 0, "---> FMIN.D %" PRIu16 " <- %" PRIu16 " / %" PRIu16 "\n", rd, rs1, rs2);
+                    bundle->addInstruction(new VanadisFPMinimumInstruction<double,true>(
                         ins_address, hw_thr, options, fpflags, rd, rs1, rs2));
                     decode_fault = false;
-					 } break;
-                case 0xD:
+                } break;
+                case 1:
                 {
                     output->verbose(
-                        CALL_INFO, 16, 0, "---> FDIV.D %" PRIu16 " <- %" PRIu16 " / %" PRIu16 "\n", rd, rs1, rs2);
-                    bundle->addInstruction(new VanadisFPDivideInstruction<double>(
+                        CALL_INFO, 16, 0, "---> FMAX.D %" PRIu16 " <- %" PRIu16 " / %" PRIu16 "\n", rd, rs1, rs2);
+                    bundle->addInstruction(new VanadisFPMinimumInstruction<double,false>(
                         ins_address, hw_thr, options, fpflags, rd, rs1, rs2));
                     decode_fault = false;
                 } break;
-                case 20:
-                {
-                    switch ( func_code3 ) { 
-                        case 0:
-                        {
-                            output->verbose(
-                                CALL_INFO, 16, 0, "---> FMIN.S %" PRIu16 " <- %" PRIu16 " / %" PRIu16 "\n", rd, rs1, rs2);
-                            bundle->addInstruction(new VanadisFPMinimumInstruction<float,true>(
-                                ins_address, hw_thr, options, fpflags, rd, rs1, rs2));
-                            decode_fault = false;
-                        } break;
-                        case 1:
-                        {
-                            output->verbose(
-                                CALL_INFO, 16, 0, "---> FMAX.S %" PRIu16 " <- %" PRIu16 " / %" PRIu16 "\n", rd, rs1, rs2);
-                            bundle->addInstruction(new VanadisFPMinimumInstruction<float,false>(
-                                ins_address, hw_thr, options, fpflags, rd, rs1, rs2));
-                            decode_fault = false;
-                        } break;
-                    }
-                } break;
-                case 21:
-                {
-                    switch ( func_code3 ) { 
-                        case 0:
-                        {
-                            output->verbose(
-                                CALL_INFO, 16, 0, "---> FMIN.D %" PRIu16 " <- %" PRIu16 " / %" PRIu16 "\n", rd, rs1, rs2);
-                            bundle->addInstruction(new VanadisFPMinimumInstruction<double,true>(
-                                ins_address, hw_thr, options, fpflags, rd, rs1, rs2));
-                            decode_fault = false;
-                        } break;
-                        case 1:
-                        {
-                            output->verbose(
-                                CALL_INFO, 16, 0, "---> FMAX.D %" PRIu16 " <- %" PRIu16 " / %" PRIu16 "\n", rd, rs1, rs2);
-                            bundle->addInstruction(new VanadisFPMinimumInstruction<double,false>(
-                                ins_address, hw_thr, options, fpflags, rd, rs1, rs2));
-                            decode_fault = false;
-                        } break;
-                    }
-                } break;
-					case 32:
-                    {
-                      processR(ins, op_code, rd, rs1, rs2, func_code3, func_code7);
-
-                      output->verbose( CALL_INFO, 16, 0, "---> func_code3=%" PRIu32 " / func_code7=%" PRIu32 "\n", func_code3, func_code7);
-
-                      switch ( rs2 ) {
-                        case 1:
-                        {
-                            // double to float
-                            output->verbose(CALL_INFO, 16, 0, "-----> FCVT.S.D %" PRIu16 " <- %" PRIu16 "\n", rs1, rd);
-                            bundle->addInstruction(
-                                new VanadisFPConvertInstruction<double,float>(ins_address, hw_thr, options, fpflags, rd, rs1));
-                            decode_fault = false;
-                        } break;
-                      }
-                    } break;
-					 case 33:
-					 {
-                    processR(ins, op_code, rd, rs1, rs2, func_code3, func_code7);
-
-                    output->verbose(
-                        CALL_INFO, 16, 0, "---> func_code3=%" PRIu32 " / func_code7=%" PRIu32 "\n", func_code3,
-                        func_code7);
-
-                    // rs2 dictates the signed nature of the operands
-						  // we use FP convert here because these are FP to FP regiser modifications
-                    switch ( rs2 ) {
-                    case 0:
-                    {
-                        // float to double
-                        output->verbose(CALL_INFO, 16, 0, "-----> FCVT.D.S %" PRIu16 " <- %" PRIu16 "\n", rs1, rd);
-                        bundle->addInstruction(
-                            new VanadisFPConvertInstruction<float, double>(ins_address, hw_thr, options, fpflags, rd, rs1));
-                        decode_fault = false;
-                    } break;
-                    }
-
-					} break;
-                case 104:
-                {
-                    processR(ins, op_code, rd, rs1, rs2, func_code3, func_code7);
-
-                    output->verbose(
-                        CALL_INFO, 16, 0, "---> func_code3=%" PRIu32 " / func_code7=%" PRIu32 "\n", func_code3,
-                        func_code7);
+            }
+        } break;
+            case 32:
+            {
+              processR(ins, op_code, rd, rs1, rs2, func_code3, func_code7);
 
-                    // rs2 dictates the signed nature of the operands
-                    switch ( rs2 ) {
-                    case 0:
-                    {
-                        // int32 to float
-                        output->verbose(CALL_INFO, 16, 0, "-----> FCVT.S.W %" PRIu16 " <- %" PRIu16 "\n", rs1, rd);
-                        bundle->addInstruction(
-                            new VanadisGPR2FPInstruction<int32_t, float, false>(ins_address, hw_thr, options, fpflags, rd, rs1));
-                        decode_fault = false;
-                    } break;
-                    case 1:
-                    {
-                        // uint32 to float
-                        output->verbose(CALL_INFO, 16, 0, "-----> FCVT.S.WU %" PRIu16 " <- %" PRIu16 "\n", rs1, rd);
-                        bundle->addInstruction(
-                            new VanadisGPR2FPInstruction<uint32_t, float, false>(ins_address, hw_thr, options, fpflags, rd, rs1));
-                        decode_fault = false;
-                    } break;
-                    case 2:
-                    {
-                        // int64 to float
-                        output->verbose(CALL_INFO, 16, 0, "-----> FCVT.S.L %" PRIu16 " <- %" PRIu16 "\n", rs1, rd);
-                        bundle->addInstruction(
-                            new VanadisGPR2FPInstruction<int64_t, float, false>(ins_address, hw_thr, options, fpflags, rd, rs1));
-                        decode_fault = false;
-                    } break;
-                    case 3:
-                    {
-                        // uint64 to float
-                        output->verbose(CALL_INFO, 16, 0, "-----> FCVT.S.LU %" PRIu16 " <- %" PRIu16 "\n", rs1, rd);
-                        bundle->addInstruction(
-                            new VanadisGPR2FPInstruction<uint64_t, float, false>(ins_address, hw_thr, options, fpflags, rd, rs1));
-                        decode_fault = false;
-                    } break;
-                    }
-                } break;
-                case 96:
-                {
-                    processR(ins, op_code, rd, rs1, rs2, func_code3, func_code7);
-                    output->verbose(
-                        CALL_INFO, 16, 0, "---> func_code3=%" PRIu32 " / func_code7=%" PRIu32 "\n", func_code3,
-                        func_code7);
+              output->verbose( CALL_INFO, 16, 0, "---> func_code3=%" PRIu32 " / func_code7=%" PRIu32 "\n", func_code3, func_code7);
 
-                    // rs2 dictates the signed nature of the operands
-                    switch ( rs2 ) {
-                    case 0:
-                    {
-                        // float to int32
-                        output->verbose(CALL_INFO, 16, 0, "-----> FCVT.W.S %" PRIu16 " <- %" PRIu16 "\n", rs1, rd);
-                        bundle->addInstruction(
-                            new VanadisFP2GPRInstruction<float, int32_t, false>(ins_address, hw_thr, options, fpflags, rd, rs1));
-                        decode_fault = false;
-                    } break;
-                    case 1:
-                    {
-                        // float to uint32
-                        output->verbose(CALL_INFO, 16, 0, "-----> FCVT.WU.S %" PRIu16 " <- %" PRIu16 "\n", rs1, rd);
-                        bundle->addInstruction(
-                            new VanadisFP2GPRInstruction<float, uint32_t, false>(ins_address, hw_thr, options, fpflags, rd, rs1));
-                        decode_fault = false;
-                    } break;
-                    case 2:
-                    {
-                        // float to int64
-                        output->verbose(CALL_INFO, 16, 0, "-----> FCVT.L.S %" PRIu16 " <- %" PRIu16 "\n", rs1, rd);
-                        bundle->addInstruction(
-                            new VanadisFP2GPRInstruction<float, int64_t, false>(ins_address, hw_thr, options, fpflags, rd, rs1));
-                        decode_fault = false;
-                    } break;
-                    case 3:
-                    {
-                        // float to uint64
-                        output->verbose(CALL_INFO, 16, 0, "-----> FCVT.L.S %" PRIu16 " <- %" PRIu16 "\n", rs1, rd);
-                        bundle->addInstruction(
-                            new VanadisFP2GPRInstruction<float, uint64_t, false>(ins_address, hw_thr, options, fpflags, rd, rs1));
-                        decode_fault = false;
-                    } break;
-                    }
-                } break;
-                case 97:
+              switch ( rs2 ) {
+                case 1:
                 {
-                    processR(ins, op_code, rd, rs1, rs2, func_code3, func_code7);
-                    output->verbose(
-                        CALL_INFO, 16, 0, "---> func_code3=%" PRIu32 " / func_code7=%" PRIu32 "\n", func_code3,
-                        func_code7);
-
-                    // rs2 dictates the signed nature of the operands
-                    switch ( rs2 ) {
-                    case 0:
-                    {
-                        // double to int32
-                        output->verbose(CALL_INFO, 16, 0, "-----> FCVT.W.D %" PRIu16 " <- %" PRIu16 "\n", rs1, rd);
-                        bundle->addInstruction(
-                            new VanadisFP2GPRInstruction<double, int32_t, false>(ins_address, hw_thr, options, fpflags, rd, rs1));
-                        decode_fault = false;
-                    } break;
-                    case 1:
-                    {
-                        // double to uint32
-                        output->verbose(CALL_INFO, 16, 0, "-----> FCVT.WU.D %" PRIu16 " <- %" PRIu16 "\n", rs1, rd);
-                        bundle->addInstruction(
-                            new VanadisFP2GPRInstruction<double, uint32_t, false>(ins_address, hw_thr, options, fpflags, rd, rs1));
-                        decode_fault = false;
-                    } break;
-                    case 2:
-                    {
-                        // double to int64
-                        output->verbose(CALL_INFO, 16, 0, "-----> FCVT.L.D %" PRIu16 " <- %" PRIu16 "\n", rs1, rd);
-                        bundle->addInstruction(
-                            new VanadisFP2GPRInstruction<double, int64_t, false>(ins_address, hw_thr, options, fpflags, rd, rs1));
-                        decode_fault = false;
-                    }break;
-                    case 3:
-                    {
-                        // double to uint64
-                        output->verbose(CALL_INFO, 16, 0, "-----> FCVT.LU.D %" PRIu16 " <- %" PRIu16 "\n", rs1, rd);
-                        bundle->addInstruction(
-                            new VanadisFP2GPRInstruction<double, uint64_t, false>(ins_address, hw_thr, options, fpflags, rd, rs1));
-                        decode_fault = false;
-                    }break;
-                    }
+                    // double to float
+                    output->verbose(CALL_INFO, 16, 0, "-----> FCVT.S.D %" PRIu16 " <- %" PRIu16 "\n", rs1, rd);
+                    bundle->addInstruction(
+                        new VanadisFPConvertInstruction<double,float>(ins_address, hw_thr, options, fpflags, rd, rs1));
+                    decode_fault = false;
                 } break;
-                case 105:
-                {
-                    processR(ins, op_code, rd, rs1, rs2, func_code3, func_code7);
-
-                    output->verbose(
-                        CALL_INFO, 16, 0, "---> func_code3=%" PRIu32 " / func_code7=%" PRIu32 "\n", func_code3,
-                        func_code7);
+              }
+            } break;
+             case 33:
+             {
+            processR(ins, op_code, rd, rs1, rs2, func_code3, func_code7);
 
-                    // rs2 dictates the signed nature of the operands
-                    switch ( rs2 ) {
-                    case 0:
-                    {
-                        // int32 to double
-                        output->verbose(CALL_INFO, 16, 0, "-----> FCVT.D.W %" PRIu16 " <- %" PRIu16 "\n", rs1, rd);
-                        bundle->addInstruction(
-                            new VanadisGPR2FPInstruction<int32_t, double, false>(ins_address, hw_thr, options, fpflags, rd, rs1));
-                        decode_fault = false;
-                    } break;
-                    case 1:
-                    {
-                        // uint32 to double
-                        output->verbose(CALL_INFO, 16, 0, "-----> FCVT.D.WU %" PRIu16 " <- %" PRIu16 "\n", rs1, rd);
-                        bundle->addInstruction(
-                            new VanadisGPR2FPInstruction<uint32_t, double, false>(ins_address, hw_thr, options, fpflags, rd, rs1));
-                        decode_fault = false;
-                    } break;
-                    case 2:
-                    {
-                        // int64 to double
-                        output->verbose(CALL_INFO, 16, 0, "-----> FCVT.D.L %" PRIu16 " <- %" PRIu16 "\n", rs1, rd);
-                        bundle->addInstruction(
-                            new VanadisGPR2FPInstruction<int64_t, double, false>(ins_address, hw_thr, options, fpflags, rd, rs1));
-                        decode_fault = false;
-                    } break;
-                    case 3:
-                    {
-                        // uint64 to double
-                        output->verbose(CALL_INFO, 16, 0, "-----> FCVT.D.LU %" PRIu16 " <- %" PRIu16 "\n", rs1, rd);
-                        bundle->addInstruction(
-                            new VanadisGPR2FPInstruction<uint64_t, double, false>(ins_address, hw_thr, options, fpflags, rd, rs1));
-                        decode_fault = false;
-                    } break;
-                    }
-                } break;
-				 case 0x70:
-				 {
-                    processR(ins, op_code, rd, rs1, rs2, func_code3, func_code7);
+            output->verbose(
+                CALL_INFO, 16, 0, "---> func_code3=%" PRIu32 " / func_code7=%" PRIu32 "\n", func_code3,
+                func_code7);
 
-                    output->verbose(
-                        CALL_INFO, 16, 0, "---> func_code3=%" PRIu32 " / func_code7=%" PRIu32 "\n", func_code3,
-                        func_code7);
+            // rs2 dictates the signed nature of the operands
+                  // we use FP convert here because these are FP to FP regiser modifications
+            switch ( rs2 ) {
+            case 0:
+            {
+                // float to double
+                output->verbose(CALL_INFO, 16, 0, "-----> FCVT.D.S %" PRIu16 " <- %" PRIu16 "\n", rs1, rd);
+                bundle->addInstruction(
+                    new VanadisFPConvertInstruction<float, double>(ins_address, hw_thr, options, fpflags, rd, rs1));
+                decode_fault = false;
+            } break;
+            }
 
-                    // rs2 dictates the signed nature of the operands
-                    switch ( rs2 ) {
-                    case 0:
-                    {
-						switch(func_code3) {
-							case 0: {
-								output->verbose(CALL_INFO, 16, 0, "-----> FMV.X.W %" PRIu16 " <- %" PRIu16 "\n", rd, rs1);
-                                bundle->addInstruction(
-                                new VanadisFP2GPRInstruction<uint32_t, uint32_t, true>(ins_address, hw_thr, options, fpflags, rd, rs1));
-                                decode_fault = false;
-							} break;
-                            case 1:
-                            {
-								output->verbose(CALL_INFO, 16, 0, "-----> FCLASS.S %" PRIu16 " <- %" PRIu16 "\n", rd, rs1);
-                                bundle->addInstruction(
-                                new VanadisFPClassInstruction<uint64_t,float>(ins_address, hw_thr, options, fpflags, rd, rs1));
-                                decode_fault = false;
-                            } break;
-						}
-                    } break;
-                   }
-				} break;
-				 case 120:
-				 {
-                    processR(ins, op_code, rd, rs1, rs2, func_code3, func_code7);
+            } break;
+        case 104:
+        {
+            processR(ins, op_code, rd, rs1, rs2, func_code3, func_code7);
 
-                    output->verbose(
-                        CALL_INFO, 16, 0, "---> func_code3=%" PRIu32 " / func_code7=%" PRIu32 "\n", func_code3,
-                        func_code7);
+            output->verbose(
+                CALL_INFO, 16, 0, "---> func_code3=%" PRIu32 " / func_code7=%" PRIu32 "\n", func_code3,
+                func_code7);
 
-                    // rs2 dictates the signed nature of the operands
-                    switch ( rs2 ) {
-                    case 0:
-                    {
-								switch(func_code3) {
-								case 0: {
-							output->verbose(CALL_INFO, 16, 0, "-----> FMV.W.X %" PRIu16 " <- %" PRIu16 "\n", rd, rs1);
-                         bundle->addInstruction(
-                              new VanadisGPR2FPInstruction<uint32_t, uint32_t, true>(ins_address, hw_thr, options, fpflags, rd, rs1));
-                           decode_fault = false;
-								} break;
-								}
-                    } break;
-                   }
-				} break;
-                case 0x50:
-                {
-                    switch ( func_code3 ) {
-                    case 0x0:
-                    {
-                        // FLE.S
-                        output->verbose(
-                            CALL_INFO, 16, 0, "-----> FLE.S %" PRIu16 " <- %" PRIu16 " <= %" PRIu16 "\n", rd, rs1, rs2);
-                        bundle->addInstruction(new VanadisFPSetRegCompareInstruction<REG_COMPARE_LTE, float>(
-                            ins_address, hw_thr, options, fpflags, rd, rs1, rs2));
-                        decode_fault = false;
-                    } break;
-                    case 0x1:
-                    {
-                        // FLT.S
-                        output->verbose(
-                            CALL_INFO, 16, 0, "-----> FLT.S %" PRIu16 " <- %" PRIu16 " <= %" PRIu16 "\n", rd, rs1, rs2);
-                        bundle->addInstruction(new VanadisFPSetRegCompareInstruction<REG_COMPARE_LT, float>(
-                            ins_address, hw_thr, options, fpflags, rd, rs1, rs2));
-                        decode_fault = false;
-                    } break;
-                    case 0x2:
-                    {
-                        // FEQ.S
-                        output->verbose(
-                            CALL_INFO, 16, 0, "-----> FEQ.S %" PRIu16 " <- %" PRIu16 " < %" PRIu16 "\n", rd, rs1, rs2);
-                        bundle->addInstruction(new VanadisFPSetRegCompareInstruction<REG_COMPARE_EQ, float>(
-                            ins_address, hw_thr, options, fpflags, rd, rs1, rs2));
-                        decode_fault = false;
-                    } break;
-                    }
-                } break;
-                case 0x51:
-                {
-                    switch ( func_code3 ) {
-                    case 0x0:
-                    {
-                        // FLE.D
-                        output->verbose(
-                            CALL_INFO, 16, 0, "-----> FLE.D %" PRIu16 " <- %" PRIu16 " <= %" PRIu16 "\n", rd, rs1, rs2);
-                        bundle->addInstruction(new VanadisFPSetRegCompareInstruction<REG_COMPARE_LTE, double>(
-                            ins_address, hw_thr, options, fpflags, rd, rs1, rs2));
-                        decode_fault = false;
-                    } break;
-                    case 0x1:
-                    {
-                        // FLT.D
-                        output->verbose(
-                            CALL_INFO, 16, 0, "-----> FLT.D %" PRIu16 " <- %" PRIu16 " < %" PRIu16 "\n", rd, rs1, rs2);
-                        bundle->addInstruction(new VanadisFPSetRegCompareInstruction<REG_COMPARE_LT, double>(
-                            ins_address, hw_thr, options, fpflags, rd, rs1, rs2));
-                        decode_fault = false;
-                    } break;
-                    case 0x2:
-                    {
-                        // FEQ.D
-                        output->verbose(
-                            CALL_INFO, 16, 0, "-----> FEQ.D %" PRIu16 " <- %" PRIu16 " < %" PRIu16 "\n", rd, rs1, rs2);
-                        bundle->addInstruction(new VanadisFPSetRegCompareInstruction<REG_COMPARE_EQ, double>(
-                            ins_address, hw_thr, options, fpflags, rd, rs1, rs2));
-                        decode_fault = false;
-                    } break;
-                    }
-                } break;
-                case 0x71:
-                {
-                    processR(ins, op_code, rd, rs1, rs2, func_code3, func_code7);
+            // rs2 dictates the signed nature of the operands
+            switch ( rs2 ) {
+            case 0:
+            {
+                // int32 to float
+                output->verbose(CALL_INFO, 16, 0, "-----> FCVT.S.W %" PRIu16 " <- %" PRIu16 "\n", rs1, rd);
+                bundle->addInstruction(
+                    new VanadisGPR2FPInstruction<int32_t, float, false>(ins_address, hw_thr, options, fpflags, rd, rs1));
+                decode_fault = false;
+            } break;
+            case 1:
+            {
+                // uint32 to float
+                output->verbose(CALL_INFO, 16, 0, "-----> FCVT.S.WU %" PRIu16 " <- %" PRIu16 "\n", rs1, rd);
+                bundle->addInstruction(
+                    new VanadisGPR2FPInstruction<uint32_t, float, false>(ins_address, hw_thr, options, fpflags, rd, rs1));
+                decode_fault = false;
+            } break;
+            case 2:
+            {
+                // int64 to float
+                output->verbose(CALL_INFO, 16, 0, "-----> FCVT.S.L %" PRIu16 " <- %" PRIu16 "\n", rs1, rd);
+                bundle->addInstruction(
+                    new VanadisGPR2FPInstruction<int64_t, float, false>(ins_address, hw_thr, options, fpflags, rd, rs1));
+                decode_fault = false;
+            } break;
+            case 3:
+            {
+                // uint64 to float
+                output->verbose(CALL_INFO, 16, 0, "-----> FCVT.S.LU %" PRIu16 " <- %" PRIu16 "\n", rs1, rd);
+                bundle->addInstruction(
+                    new VanadisGPR2FPInstruction<uint64_t, float, false>(ins_address, hw_thr, options, fpflags, rd, rs1));
+                decode_fault = false;
+            } break;
+            }
+        } break;
+        case 96:
+        {
+            processR(ins, op_code, rd, rs1, rs2, func_code3, func_code7);
+            output->verbose(
+                CALL_INFO, 16, 0, "---> func_code3=%" PRIu32 " / func_code7=%" PRIu32 "\n", func_code3,
+                func_code7);
 
-                    if ( 0 == rs2 ) {
-                        switch( func_code3 ) {
-                        case 0:
-                        {
-                            output->verbose(CALL_INFO, 16, 0, "-----> FMV.X.D %" PRIu16 " <- %" PRIu16 "\n", rd, rs1);
-                            bundle->addInstruction(
-                                new VanadisFP2GPRInstruction<uint64_t, uint64_t, true>(ins_address, hw_thr, options, fpflags, rd, rs1));
-                            decode_fault = false;
-                        } break;
-                        case 1:
-                        {
-                            output->verbose(CALL_INFO, 16, 0, "-----> FCLASS.D %" PRIu16 " <- %" PRIu16 "\n", rd, rs1);
-                            bundle->addInstruction(
-                            new VanadisFPClassInstruction<uint64_t,double>(ins_address, hw_thr, options, fpflags, rd, rs1));
-                            decode_fault = false;
-                        } break;
-                        }
-                    }
-                } break;
-                case 0x79:
-                {
-                    processR(ins, op_code, rd, rs1, rs2, func_code3, func_code7);
+            // rs2 dictates the signed nature of the operands
+            switch ( rs2 ) {
+            case 0:
+            {
+                // float to int32
+                output->verbose(CALL_INFO, 16, 0, "-----> FCVT.W.S %" PRIu16 " <- %" PRIu16 "\n", rs1, rd);
+                bundle->addInstruction(
+                    new VanadisFP2GPRInstruction<float, int32_t, false>(ins_address, hw_thr, options, fpflags, rd, rs1));
+                decode_fault = false;
+            } break;
+            case 1:
+            {
+                // float to uint32
+                output->verbose(CALL_INFO, 16, 0, "-----> FCVT.WU.S %" PRIu16 " <- %" PRIu16 "\n", rs1, rd);
+                bundle->addInstruction(
+                    new VanadisFP2GPRInstruction<float, uint32_t, false>(ins_address, hw_thr, options, fpflags, rd, rs1));
+                decode_fault = false;
+            } break;
+            case 2:
+            {
+                // float to int64
+                output->verbose(CALL_INFO, 16, 0, "-----> FCVT.L.S %" PRIu16 " <- %" PRIu16 "\n", rs1, rd);
+                bundle->addInstruction(
+                    new VanadisFP2GPRInstruction<float, int64_t, false>(ins_address, hw_thr, options, fpflags, rd, rs1));
+                decode_fault = false;
+            } break;
+            case 3:
+            {
+                // float to uint64
+                output->verbose(CALL_INFO, 16, 0, "-----> FCVT.L.S %" PRIu16 " <- %" PRIu16 "\n", rs1, rd);
+                bundle->addInstruction(
+                    new VanadisFP2GPRInstruction<float, uint64_t, false>(ins_address, hw_thr, options, fpflags, rd, rs1));
+                decode_fault = false;
+            } break;
+            }
+        } break;
+        case 97:
+        {
+            processR(ins, op_code, rd, rs1, rs2, func_code3, func_code7);
+            output->verbose(
+                CALL_INFO, 16, 0, "---> func_code3=%" PRIu32 " / func_code7=%" PRIu32 "\n", func_code3,
+                func_code7);
 
-                    if ( 0 == rs2 ) {
-                        if ( 0 == func_code3 ) {
-                            output->verbose(CALL_INFO, 16, 0, "-----> FMV.D.X %" PRIu16 " <- %" PRIu16 "\n", rd, rs1);
-                            bundle->addInstruction(
-                                new VanadisGPR2FPInstruction<uint64_t, uint64_t, true>(ins_address, hw_thr, options, fpflags, rd, rs1));
-                            decode_fault = false;
-                        }
-                    }
-                } break;
-                }
+            // rs2 dictates the signed nature of the operands
+            switch ( rs2 ) {
+            case 0:
+            {
+                // double to int32
+                output->verbose(CALL_INFO, 16, 0, "-----> FCVT.W.D %" PRIu16 " <- %" PRIu16 "\n", rs1, rd);
+                bundle->addInstruction(
+                    new VanadisFP2GPRInstruction<double, int32_t, false>(ins_address, hw_thr, options, fpflags, rd, rs1));
+                decode_fault = false;
             } break;
-            case 0x43:
+            case 1:
+            {
+                // double to uint32
+                output->verbose(CALL_INFO, 16, 0, "-----> FCVT.WU.D %" PRIu16 " <- %" PRIu16 "\n", rs1, rd);
+                bundle->addInstruction(
+                    new VanadisFP2GPRInstruction<double, uint32_t, false>(ins_address, hw_thr, options, fpflags, rd, rs1));
+                decode_fault = false;
+            } break;
+            case 2:
+            {
+                // double to int64
+                output->verbose(CALL_INFO, 16, 0, "-----> FCVT.L.D %" PRIu16 " <- %" PRIu16 "\n", rs1, rd);
+                bundle->addInstruction(
+                    new VanadisFP2GPRInstruction<double, int64_t, false>(ins_address, hw_thr, options, fpflags, rd, rs1));
+                decode_fault = false;
+            }break;
+            case 3:
             {
-                uint32_t fmt;
-                processR(ins, op_code, rd, rs1, rs2, func_code3, func_code7);
-                fmt = func_code7 & 0x3;
-                rs3 = func_code7 >> 2;
+                // double to uint64
+                output->verbose(CALL_INFO, 16, 0, "-----> FCVT.LU.D %" PRIu16 " <- %" PRIu16 "\n", rs1, rd);
+                bundle->addInstruction(
+                    new VanadisFP2GPRInstruction<double, uint64_t, false>(ins_address, hw_thr, options, fpflags, rd, rs1));
+                decode_fault = false;
+            }break;
+            }
+        } break;
+        case 105:
+        {
+            processR(ins, op_code, rd, rs1, rs2, func_code3, func_code7);
 
-                switch( fmt ) {
-                    case 0:
-                    {
-                        // FMADD.S
-                        output->verbose(
-                            CALL_INFO, 16, 0, "-----> FMADD.S %" PRIu16 " <- ( %" PRIu16 " *  %" PRIu16 " ) + %" PRIu16 "\n", rd, rs1, rs2, rs3);
-                        bundle->addInstruction(
-                            new VanadisFPFusedMultiplyAddInstruction<float,false>(ins_address, hw_thr, options, fpflags, rd, rs1, rs2, rs3 ));
-                        decode_fault = false;
-                    } break;
-                    case 1:
-                    {
-                        // FMADD.D
-                        output->verbose(
-                            CALL_INFO, 16, 0, "-----> FMADD.D %" PRIu16 " <- ( %" PRIu16 " *  %" PRIu16 " ) + %" PRIu16 "\n", rd, rs1, rs2, rs3);
-                        bundle->addInstruction(
-                            new VanadisFPFusedMultiplyAddInstruction<double,false>(ins_address, hw_thr, options, fpflags, rd, rs1, rs2, rs3 ));
-                        decode_fault = false;
-                    } break;
-                }
+            output->verbose(
+                CALL_INFO, 16, 0, "---> func_code3=%" PRIu32 " / func_code7=%" PRIu32 "\n", func_code3,
+                func_code7);
+
+            // rs2 dictates the signed nature of the operands
+            switch ( rs2 ) {
+            case 0:
+            {
+                // int32 to double
+                output->verbose(CALL_INFO, 16, 0, "-----> FCVT.D.W %" PRIu16 " <- %" PRIu16 "\n", rs1, rd);
+                bundle->addInstruction(
+                    new VanadisGPR2FPInstruction<int32_t, double, false>(ins_address, hw_thr, options, fpflags, rd, rs1));
+                decode_fault = false;
             } break;
-            case 0x47:
+            case 1:
             {
-                // FMSUB
-                uint32_t fmt;
-                processR(ins, op_code, rd, rs1, rs2, func_code3, func_code7);
-                fmt = func_code7 & 0x3;
-                rs3 = func_code7 >> 2;
-
-                switch( fmt ) {
-                    case 0:
-                    {
-                        // FMSUB.S
-                        output->verbose(
-                            CALL_INFO, 16, 0, "-----> FMSUB.S %" PRIu16 " <- ( %" PRIu16 " *  %" PRIu16 " ) -  %" PRIu16 "\n", rd, rs1, rs2, rs3);
-                        bundle->addInstruction(
-                            new VanadisFPFusedMultiplySubInstruction<float,false>(ins_address, hw_thr, options, fpflags, rd, rs1, rs2, rs3 ));
-                        decode_fault = false;
-                    } break;
-                    case 1:
-                    {
-                        // FMSUB.D
-                        output->verbose(
-                            CALL_INFO, 16, 0, "-----> FMSUB.D %" PRIu16 " <- ( %" PRIu16 " *  %" PRIu16 " ) -  %" PRIu16 "\n", rd, rs1, rs2, rs3);
-                        bundle->addInstruction(
-                            new VanadisFPFusedMultiplySubInstruction<double,false>(ins_address, hw_thr, options, fpflags, rd, rs1, rs2, rs3 ));
-                        decode_fault = false;
-                    } break;
-                }
+                // uint32 to double
+                output->verbose(CALL_INFO, 16, 0, "-----> FCVT.D.WU %" PRIu16 " <- %" PRIu16 "\n", rs1, rd);
+                bundle->addInstruction(
+                    new VanadisGPR2FPInstruction<uint32_t, double, false>(ins_address, hw_thr, options, fpflags, rd, rs1));
+                decode_fault = false;
             } break;
-            case 0x4B:
+            case 2:
             {
-                uint32_t fmt;
-                processR(ins, op_code, rd, rs1, rs2, func_code3, func_code7);
-                fmt = func_code7 & 0x3;
-                rs3 = func_code7 >> 2;
+                // int64 to double
+                output->verbose(CALL_INFO, 16, 0, "-----> FCVT.D.L %" PRIu16 " <- %" PRIu16 "\n", rs1, rd);
+                bundle->addInstruction(
+                    new VanadisGPR2FPInstruction<int64_t, double, false>(ins_address, hw_thr, options, fpflags, rd, rs1));
+                decode_fault = false;
+            } break;
+            case 3:
+            {
+                // uint64 to double
+                output->verbose(CALL_INFO, 16, 0, "-----> FCVT.D.LU %" PRIu16 " <- %" PRIu16 "\n", rs1, rd);
+                bundle->addInstruction(
+                    new VanadisGPR2FPInstruction<uint64_t, double, false>(ins_address, hw_thr, options, fpflags, rd, rs1));
+                decode_fault = false;
+            } break;
+            }
+        } break;
+         case 0x70:
+         {
+            processR(ins, op_code, rd, rs1, rs2, func_code3, func_code7);
 
-                output->verbose(CALL_INFO, 16, 0, "-----> fmt: %" PRIu32 " rs3: %" PRIu32 "\n", fmt, rs3);
+            output->verbose(
+                CALL_INFO, 16, 0, "---> func_code3=%" PRIu32 " / func_code7=%" PRIu32 "\n", func_code3,
+                func_code7);
 
-                switch( fmt ) {
-                    case 0:
-                    {
-                        // FNMSUB.S
-                        output->verbose(
-                            CALL_INFO, 16, 0, "-----> FNMSUB.S %" PRIu16 " <- ( - %" PRIu16 " *  %" PRIu16 " ) -  %" PRIu16 "\n", rd, rs1, rs2, rs3);
+            // rs2 dictates the signed nature of the operands
+            switch ( rs2 ) {
+            case 0:
+            {
+                switch(func_code3) {
+                    case 0: {
+                        output->verbose(CALL_INFO, 16, 0, "-----> FMV.X.W %" PRIu16 " <- %" PRIu16 "\n", rd, rs1);
                         bundle->addInstruction(
-                            new VanadisFPFusedMultiplySubInstruction<float,true>(ins_address, hw_thr, options, fpflags, rd, rs1, rs2, rs3 ));
+                        new VanadisFP2GPRInstruction<uint32_t, uint32_t, true>(ins_address, hw_thr, options, fpflags, rd, rs1));
                         decode_fault = false;
                     } break;
                     case 1:
                     {
-                        // FNMSUB.D
-                        output->verbose(
-                            CALL_INFO, 16, 0, "-----> FNMSUB.D %" PRIu16 " <- ( - %" PRIu16 " *  %" PRIu16 " ) -  %" PRIu16 "\n", rd, rs1, rs2, rs3);
+                        output->verbose(CALL_INFO, 16, 0, "-----> FCLASS.S %" PRIu16 " <- %" PRIu16 "\n", rd, rs1);
                         bundle->addInstruction(
-                            new VanadisFPFusedMultiplySubInstruction<double,true>(ins_address, hw_thr, options, fpflags, rd, rs1, rs2, rs3 ));
+                        new VanadisFPClassInstruction<uint64_t,float>(ins_address, hw_thr, options, fpflags, rd, rs1));
                         decode_fault = false;
                     } break;
                 }
             } break;
-            case 0x4F:
-            {
-                uint32_t fmt;
-                processR(ins, op_code, rd, rs1, rs2, func_code3, func_code7);
-                fmt = func_code7 & 0x3;
-                rs3 = func_code7 >> 2;
+           }
+        } break;
+         case 120:
+         {
+            processR(ins, op_code, rd, rs1, rs2, func_code3, func_code7);
 
-                output->verbose(CALL_INFO, 16, 0, "-----> fmt: %" PRIu32 " rs3: %" PRIu32 "\n", fmt, rs3);
+            output->verbose(
+                CALL_INFO, 16, 0, "---> func_code3=%" PRIu32 " / func_code7=%" PRIu32 "\n", func_code3,
+                func_code7);
 
-                switch( fmt ) {
-                    case 0:
-                    {
-                        // FNMADD.S
-                        output->verbose(
-                            CALL_INFO, 16, 0, "-----> FNMADD.S %" PRIu16 " <- ( - %" PRIu16 " *  %" PRIu16 " ) -  %" PRIu16 "\n", rd, rs1, rs2, rs3);
-                        bundle->addInstruction(
-                            new VanadisFPFusedMultiplyAddInstruction<float,true>(ins_address, hw_thr, options, fpflags, rd, rs1, rs2, rs3 ));
-                        decode_fault = false;
-                    } break;
-                    case 1:
-                    {
-                        // FNMADD.D
-                        output->verbose(
-                            CALL_INFO, 16, 0, "-----> FNMADD.D %" PRIu16 " <- ( - %" PRIu16 " *  %" PRIu16 " ) -  %" PRIu16 "\n", rd, rs1, rs2, rs3);
-                        bundle->addInstruction(
-                            new VanadisFPFusedMultiplyAddInstruction<double,true>(ins_address, hw_thr, options, fpflags, rd, rs1, rs2, rs3 ));
-                        decode_fault = false;
-                    } break;
-                }
+            // rs2 dictates the signed nature of the operands
+            switch ( rs2 ) {
+            case 0:
+            {
+                        switch(func_code3) {
+                        case 0: {
+                    output->verbose(CALL_INFO, 16, 0, "-----> FMV.W.X %" PRIu16 " <- %" PRIu16 "\n", rd, rs1);
+                 bundle->addInstruction(
+                      new VanadisGPR2FPInstruction<uint32_t, uint32_t, true>(ins_address, hw_thr, options, fpflags, rd, rs1));
+                   decode_fault = false;
+                        } break;
+                        }
+            } break;
+           }
+        } break;
+        case 0x50:
+        {
+            switch ( func_code3 ) {
+            case 0x0:
+            {
+                // FLE.S
+                output->verbose(
+                    CALL_INFO, 16, 0, "-----> FLE.S %" PRIu16 " <- %" PRIu16 " <= %" PRIu16 "\n", rd, rs1, rs2);
+                bundle->addInstruction(new VanadisFPSetRegCompareInstruction<REG_COMPARE_LTE, float>(
+                    ins_address, hw_thr, options, fpflags, rd, rs1, rs2));
+                decode_fault = false;
+            } break;
+            case 0x1:
+            {
+                // FLT.S
+                output->verbose(
+                    CALL_INFO, 16, 0, "-----> FLT.S %" PRIu16 " <- %" PRIu16 " <= %" PRIu16 "\n", rd, rs1, rs2);
+                bundle->addInstruction(new VanadisFPSetRegCompareInstruction<REG_COMPARE_LT, float>(
+                    ins_address, hw_thr, options, fpflags, rd, rs1, rs2));
+                decode_fault = false;
+            } break;
+            case 0x2:
+            {
+                // FEQ.S
+                output->verbose(
+                    CALL_INFO, 16, 0, "-----> FEQ.S %" PRIu16 " <- %" PRIu16 " < %" PRIu16 "\n", rd, rs1, rs2);
+                bundle->addInstruction(new VanadisFPSetRegCompareInstruction<REG_COMPARE_EQ, float>(
+                    ins_address, hw_thr, options, fpflags, rd, rs1, rs2));
+                decode_fault = false;
+            } break;
+            }
+        } break;
+        case 0x51:
+        {
+            switch ( func_code3 ) {
+            case 0x0:
+            {
+                // FLE.D
+                output->verbose(
+                    CALL_INFO, 16, 0, "-----> FLE.D %" PRIu16 " <- %" PRIu16 " <= %" PRIu16 "\n", rd, rs1, rs2);
+                bundle->addInstruction(new VanadisFPSetRegCompareInstruction<REG_COMPARE_LTE, double>(
+                    ins_address, hw_thr, options, fpflags, rd, rs1, rs2));
+                decode_fault = false;
+            } break;
+            case 0x1:
+            {
+                // FLT.D
+                output->verbose(
+                    CALL_INFO, 16, 0, "-----> FLT.D %" PRIu16 " <- %" PRIu16 " < %" PRIu16 "\n", rd, rs1, rs2);
+                bundle->addInstruction(new VanadisFPSetRegCompareInstruction<REG_COMPARE_LT, double>(
+                    ins_address, hw_thr, options, fpflags, rd, rs1, rs2));
+                decode_fault = false;
             } break;
-            default:
+            case 0x2:
             {
-                // op_code did not match an expected value
+                // FEQ.D
+                output->verbose(
+                    CALL_INFO, 16, 0, "-----> FEQ.D %" PRIu16 " <- %" PRIu16 " < %" PRIu16 "\n", rd, rs1, rs2);
+                bundle->addInstruction(new VanadisFPSetRegCompareInstruction<REG_COMPARE_EQ, double>(
+                    ins_address, hw_thr, options, fpflags, rd, rs1, rs2));
+                decode_fault = false;
             } break;
             }
+        } break;
+        case 0x71:
+        {
+            processR(ins, op_code, rd, rs1, rs2, func_code3, func_code7);
+
+            if ( 0 == rs2 ) {
+                switch( func_code3 ) {
+                case 0:
+                {
+                    output->verbose(CALL_INFO, 16, 0, "-----> FMV.X.D %" PRIu16 " <- %" PRIu16 "\n", rd, rs1);
+                    bundle->addInstruction(
+                        new VanadisFP2GPRInstruction<uint64_t, uint64_t, true>(ins_address, hw_thr, options, fpflags, rd, rs1));
+                    decode_fault = false;
+                } break;
+                case 1:
+                {
+                    output->verbose(CALL_INFO, 16, 0, "-----> FCLASS.D %" PRIu16 " <- %" PRIu16 "\n", rd, rs1);
+                    bundle->addInstruction(
+                    new VanadisFPClassInstruction<uint64_t,double>(ins_address, hw_thr, options, fpflags, rd, rs1));
+                    decode_fault = false;
+                } break;
+                }
+            }
+        } break;
+        case 0x79:
+        {
+            processR(ins, op_code, rd, rs1, rs2, func_code3, func_code7);
+
+            if ( 0 == rs2 ) {
+                if ( 0 == func_code3 ) {
+                    output->verbose(CALL_INFO, 16, 0, "-----> FMV.D.X %" PRIu16 " <- %" PRIu16 "\n", rd, rs1);
+                    bundle->addInstruction(
+                        new VanadisGPR2FPInstruction<uint64_t, uint64_t, true>(ins_address, hw_thr, options, fpflags, rd, rs1));
+                    decode_fault = false;
+                }
+            }
+        } break;
         }
-        else {
-            const uint32_t c_op_code = ins & 0x3;
+    }
 
-            // this bundle only increments the PC by 2, not 4 in 32bit decodes
-            bundle->setPCIncrement(2);
+    // MADD (major opcode 0x43)
+    void decodeFMAdd(
+        SST::Output* output, const uint64_t ins_address, const uint32_t ins, VanadisInstructionBundle* bundle,
+        bool& decode_fault)
+    {
+        uint32_t op_code = extract_opcode(ins);
+        uint16_t rd  = 0;
+        uint16_t rs1 = 0;
+        uint16_t rs2 = 0;
+        uint16_t rs3 = 0;
+        uint32_t func_code3 = 0;
+        uint32_t func_code7 = 0;
 
-            output->verbose(CALL_INFO, 16, 0, "-----> RVC op_code: %" PRIu32 "\n", c_op_code);
+        uint32_t fmt;
+        processR(ins, op_code, rd, rs1, rs2, func_code3, func_code7);
+        fmt = func_code7 & 0x3;
+        rs3 = func_code7 >> 2;
 
-            switch ( c_op_code ) {
-            case 0x0:
+        switch( fmt ) {
+            case 0:
+            {
+                // FMADD.S
+                output->verbose(
+                    CALL_INFO, 16, 0, "-----> FMADD.S %" PRIu16 " <- ( %" PRIu16 " *  %" PRIu16 " ) + %" PRIu16 "\n", rd, rs1, rs2, rs3);
+                bundle->addInstruction(
+                    new VanadisFPFusedMultiplyAddInstruction<float,false>(ins_address, hw_thr, options, fpflags, rd, rs1, rs2, rs3 ));
+                decode_fault = false;
+            } break;
+            case 1:
+            {
+                // FMADD.D
+                output->verbose(
+                    CALL_INFO, 16, 0, "-----> FMADD.D %" PRIu16 " <- ( %" PRIu16 " *  %" PRIu16 " ) + %" PRIu16 "\n", rd, rs1, rs2, rs3);
+                bundle->addInstruction(
+                    new VanadisFPFusedMultiplyAddInstruction<double,false>(ins_address, hw_thr, options, fpflags, rd, rs1, rs2, rs3 ));
+                decode_fault = false;
+            } break;
+        }
+    }
+
+    // MSUB (major opcode 0x47)
+    void decodeFMSub(
+        SST::Output* output, const uint64_t ins_address, const uint32_t ins, VanadisInstructionBundle* bundle,
+        bool& decode_fault)
+    {
+        uint32_t op_code = extract_opcode(ins);
+        uint16_t rd  = 0;
+        uint16_t rs1 = 0;
+        uint16_t rs2 = 0;
+        uint16_t rs3 = 0;
+        uint32_t func_code3 = 0;
+        uint32_t func_code7 = 0;
+
+        // FMSUB
+        uint32_t fmt;
+        processR(ins, op_code, rd, rs1, rs2, func_code3, func_code7);
+        fmt = func_code7 & 0x3;
+        rs3 = func_code7 >> 2;
+
+        switch( fmt ) {
+            case 0:
+            {
+                // FMSUB.S
+                output->verbose(
+                    CALL_INFO, 16, 0, "-----> FMSUB.S %" PRIu16 " <- ( %" PRIu16 " *  %" PRIu16 " ) -  %" PRIu16 "\n", rd, rs1, rs2, rs3);
+                bundle->addInstruction(
+                    new VanadisFPFusedMultiplySubInstruction<float,false>(ins_address, hw_thr, options, fpflags, rd, rs1, rs2, rs3 ));
+                decode_fault = false;
+            } break;
+            case 1:
             {
-                const uint32_t c_func_code = ins & 0xE000;
+                // FMSUB.D
+                output->verbose(
+                    CALL_INFO, 16, 0, "-----> FMSUB.D %" PRIu16 " <- ( %" PRIu16 " *  %" PRIu16 " ) -  %" PRIu16 "\n", rd, rs1, rs2, rs3);
+                bundle->addInstruction(
+                    new VanadisFPFusedMultiplySubInstruction<double,false>(ins_address, hw_thr, options, fpflags, rd, rs1, rs2, rs3 ));
+                decode_fault = false;
+            } break;
+        }
+    }
 
-                switch ( c_func_code ) {
-                case 0x0:
-                {
-                    if ( (ins & 0xFFFF) == 0 ) {
-                        // This is an illegal instruction (all zeroes)
-                    }
-                    else {
-                        // ADDI4SPN
-                        uint16_t rvc_rd = expand_rvc_int_register(extract_rs2_rvc(ins));
+    // NMSUB (major opcode 0x4B)
+    void decodeFNMSub(
+        SST::Output* output, const uint64_t ins_address, const uint32_t ins, VanadisInstructionBundle* bundle,
+        bool& decode_fault)
+    {
+        uint32_t op_code = extract_opcode(ins);
+        uint16_t rd  = 0;
+        uint16_t rs1 = 0;
+        uint16_t rs2 = 0;
+        uint16_t rs3 = 0;
+        uint32_t func_code3 = 0;
+        uint32_t func_code7 = 0;
 
-                        uint32_t imm_3  = (ins & 0x20) >> 2;
-                        uint32_t imm_2  = (ins & 0x40) >> 4;
-                        uint32_t imm_96 = (ins & 0x780) >> 1;
-                        uint32_t imm_54 = (ins & 0x1800) >> 7;
+        uint32_t fmt;
+        processR(ins, op_code, rd, rs1, rs2, func_code3, func_code7);
+        fmt = func_code7 & 0x3;
+        rs3 = func_code7 >> 2;
 
-                        uint32_t imm = (imm_2 | imm_3 | imm_54 | imm_96);
+        output->verbose(CALL_INFO, 16, 0, "-----> fmt: %" PRIu32 " rs3: %" PRIu32 "\n", fmt, rs3);
 
-                        output->verbose(
-                            CALL_INFO, 16, 0, "-------> RVC ADDI4SPN %" PRIu16 " <- r2 (stack-ptr) + %" PRIu32 "\n",
-                            rvc_rd, imm);
+        switch( fmt ) {
+            case 0:
+            {
+                // FNMSUB.S
+                output->verbose(
+                    CALL_INFO, 16, 0, "-----> FNMSUB.S %" PRIu16 " <- ( - %" PRIu16 " *  %" PRIu16 " ) -  %" PRIu16 "\n", rd, rs1, rs2, rs3);
+                bundle->addInstruction(
+                    new VanadisFPFusedMultiplySubInstruction<float,true>(ins_address, hw_thr, options, fpflags, rd, rs1, rs2, rs3 ));
+                decode_fault = false;
+            } break;
+            case 1:
+            {
+                // FNMSUB.D
+                output->verbose(
+                    CALL_INFO, 16, 0, "-----> FNMSUB.D %" PRIu16 " <- ( - %" PRIu16 " *  %" PRIu16 " ) -  %" PRIu16 "\n", rd, rs1, rs2, rs3);
+                bundle->addInstruction(
+                    new VanadisFPFusedMultiplySubInstruction<double,true>(ins_address, hw_thr, options, fpflags, rd, rs1, rs2, rs3 ));
+                decode_fault = false;
+            } break;
+        }
+    }
 
-                        bundle->addInstruction(
-                            new VanadisAddImmInstruction<int64_t>(
-                                ins_address, hw_thr, options, rvc_rd, 2, imm));
-                        decode_fault = false;
-                    }
-                } break;
-                case 0x2000:
-                {
-                    // FLD
-                    uint16_t rvc_rd  = expand_rvc_int_register(extract_rs2_rvc(ins));
-                    uint16_t rvc_rs1 = expand_rvc_int_register(extract_rs1_rvc(ins));
+    // NMADD (major opcode 0x4F)
+    void decodeFNMAdd(
+        SST::Output* output, const uint64_t ins_address, const uint32_t ins, VanadisInstructionBundle* bundle,
+        bool& decode_fault)
+    {
+        uint32_t op_code = extract_opcode(ins);
+        uint16_t rd  = 0;
+        uint16_t rs1 = 0;
+        uint16_t rs2 = 0;
+        uint16_t rs3 = 0;
+        uint32_t func_code3 = 0;
+        uint32_t func_code7 = 0;
 
-                    uint32_t imm_53 = (ins & 0x1C00) >> 7;
-                    uint32_t imm_76 = (ins & 0x60) << 1;
+        uint32_t fmt;
+        processR(ins, op_code, rd, rs1, rs2, func_code3, func_code7);
+        fmt = func_code7 & 0x3;
+        rs3 = func_code7 >> 2;
 
-                    uint32_t imm = (imm_53 | imm_76);
+        output->verbose(CALL_INFO, 16, 0, "-----> fmt: %" PRIu32 " rs3: %" PRIu32 "\n", fmt, rs3);
 
-                    output->verbose(
-                        CALL_INFO, 16, 0, "-------> RVC FLD %" PRIu16 " <- memory[ %" PRIu16 " + %" PRIu32 " ]\n",
-                        rvc_rd, rvc_rs1, imm);
+        switch( fmt ) {
+            case 0:
+            {
+                // FNMADD.S
+                output->verbose(
+                    CALL_INFO, 16, 0, "-----> FNMADD.S %" PRIu16 " <- ( - %" PRIu16 " *  %" PRIu16 " ) -  %" PRIu16 "\n", rd, rs1, rs2, rs3);
+                bundle->addInstruction(
+                    new VanadisFPFusedMultiplyAddInstruction<float,true>(ins_address, hw_thr, options, fpflags, rd, rs1, rs2, rs3 ));
+                decode_fault = false;
+            } break;
+            case 1:
+            {
+                // FNMADD.D
+                output->verbose(
+                    CALL_INFO, 16, 0, "-----> FNMADD.D %" PRIu16 " <- ( - %" PRIu16 " *  %" PRIu16 " ) -  %" PRIu16 "\n", rd, rs1, rs2, rs3);
+                bundle->addInstruction(
+                    new VanadisFPFusedMultiplyAddInstruction<double,true>(ins_address, hw_thr, options, fpflags, rd, rs1, rs2, rs3 ));
+                decode_fault = false;
+            } break;
+        }
+    }
 
-                    bundle->addInstruction(new VanadisLoadInstruction(
-                        ins_address, hw_thr, options, rvc_rs1, imm, rvc_rd, 8, true, MEM_TRANSACTION_NONE,
-                        LOAD_FP_REGISTER));
-                    decode_fault = false;
-                } break;
-                case 0x4000:
-                {
-                    // LW
-                    uint64_t imm_address = extract_uimm_rcv_t2(ins);
-                    uint16_t rvc_rd      = expand_rvc_int_register(extract_rs2_rvc(ins));
-                    uint16_t rvc_rs1     = expand_rvc_int_register(extract_rs1_rvc(ins));
+    // RVC quadrant 0
+    void decodeRVCQuadrant0(
+        SST::Output* output, const uint64_t ins_address, const uint32_t ins, VanadisInstructionBundle* bundle,
+        bool& decode_fault)
+    {
+        const uint32_t c_func_code = ins & 0xE000;
 
-                    output->verbose(
-                        CALL_INFO, 16, 0, "-----> RVC LW rd=%" PRIu16 " <- rs1=%" PRIu16 " + imm=%" PRIu64 "\n", rvc_rd,
-                        rvc_rs1, imm_address);
+        switch ( c_func_code ) {
+        case 0x0:
+        {
+            if ( (ins & 0xFFFF) == 0 ) {
+                // This is an illegal instruction (all zeroes)
+            }
+            else {
+                // ADDI4SPN
+                uint16_t rvc_rd = expand_rvc_int_register(extract_rs2_rvc(ins));
 
-                    bundle->addInstruction(new VanadisLoadInstruction(
-                        ins_address, hw_thr, options, rvc_rs1, imm_address, rvc_rd, 4, true, MEM_TRANSACTION_NONE,
-                        LOAD_INT_REGISTER));
-                    decode_fault = false;
-                } break;
-                case 0x6000:
-                {
-                    // LD
-                    uint64_t imm_address = extract_uimm_rvc_t1(ins);
-                    uint16_t rvc_rd      = expand_rvc_int_register(extract_rs2_rvc(ins));
-                    uint16_t rvc_rs1     = expand_rvc_int_register(extract_rs1_rvc(ins));
+                uint32_t imm_3  = (ins & 0x20) >> 2;
+                uint32_t imm_2  = (ins & 0x40) >> 4;
+                uint32_t imm_96 = (ins & 0x780) >> 1;
+                uint32_t imm_54 = (ins & 0x1800) >> 7;
 
-                    output->verbose(
-                        CALL_INFO, 16, 0, "-----> RVC LD rd=%" PRIu16 " <- rs1=%" PRIu16 " + imm=%" PRIu64 "\n", rvc_rd,
-                        rvc_rs1, imm_address);
+                uint32_t imm = (imm_2 | imm_3 | imm_54 | imm_96);
 
-                    bundle->addInstruction(new VanadisLoadInstruction(
-                        ins_address, hw_thr, options, rvc_rs1, imm_address, rvc_rd, 8, true, MEM_TRANSACTION_NONE,
-                        LOAD_INT_REGISTER));
-                    decode_fault = false;
-                } break;
-                case 0x8000:
-                {
-                    // Reserved, this is a decode fault
-                } break;
-                case 0xA000:
-                {
-                    // FSD
-                    uint16_t rvc_rs2  = expand_rvc_int_register(extract_rs2_rvc(ins));
-                    uint16_t rvc_rs1 = expand_rvc_int_register(extract_rs1_rvc(ins));
+                output->verbose(
+                    CALL_INFO, 16, 0, "-------> RVC ADDI4SPN %" PRIu16 " <- r2 (stack-ptr) + %" PRIu32 "\n",
+                    rvc_rd, imm);
 
-                    uint32_t imm_53 = (ins & 0x1C00) >> 7;
-                    uint32_t imm_76 = (ins & 0x60) << 1;
+                bundle->addInstruction(
+                    new VanadisAddImmInstruction<int64_t>(
+                        ins_address, hw_thr, options, rvc_rd, 2, imm));
+                decode_fault = false;
+            }
+        } break;
+        case 0x2000:
+        {
+            // FLD
+            uint16_t rvc_rd  = expand_rvc_int_register(extract_rs2_rvc(ins));
+            uint16_t rvc_rs1 = expand_rvc_int_register(extract_rs1_rvc(ins));
 
-                    uint32_t imm = (imm_53 | imm_76);
+            uint32_t imm_53 = (ins & 0x1C00) >> 7;
+            uint32_t imm_76 = (ins & 0x60) << 1;
 
-                    output->verbose(
-                        CALL_INFO, 16, 0, "-------> RVC FSD %" PRIu16 " -> memory[ %" PRIu16 " + %" PRIu32 " ]\n",
-                        rvc_rs2, rvc_rs1, imm);
+            uint32_t imm = (imm_53 | imm_76);
 
-                    bundle->addInstruction(new VanadisStoreInstruction(
-                        ins_address, hw_thr, options, rvc_rs1, imm, rvc_rs2, 8, MEM_TRANSACTION_NONE,
-                        STORE_FP_REGISTER));
-                    decode_fault = false;
-                } break;
-                case 0xC000:
-                {
-                    // SW
-                    uint16_t rvc_rs2 = expand_rvc_int_register(extract_rs2_rvc(ins));
-                    uint16_t rvc_rs1 = expand_rvc_int_register(extract_rs1_rvc(ins));
+            output->verbose(
+                CALL_INFO, 16, 0, "-------> RVC FLD %" PRIu16 " <- memory[ %" PRIu16 " + %" PRIu32 " ]\n",
+                rvc_rd, rvc_rs1, imm);
+
+            bundle->addInstruction(new VanadisLoadInstruction(
+                ins_address, hw_thr, options, rvc_rs1, imm, rvc_rd, 8, true, MEM_TRANSACTION_NONE,
+                LOAD_FP_REGISTER));
+            decode_fault = false;
+        } break;
+        case 0x4000:
+        {
+            // LW
+            uint64_t imm_address = extract_uimm_rcv_t2(ins);
+            uint16_t rvc_rd      = expand_rvc_int_register(extract_rs2_rvc(ins));
+            uint16_t rvc_rs1     = expand_rvc_int_register(extract_rs1_rvc(ins));
 
-                    uint32_t offset_53 = (ins & 0x1C00) >> 7;
-                    uint32_t offset_6  = (ins & 0x20) << 1;
-                    uint32_t offset_2  = (ins & 0x40) >> 4;
+            output->verbose(
+                CALL_INFO, 16, 0, "-----> RVC LW rd=%" PRIu16 " <- rs1=%" PRIu16 " + imm=%" PRIu64 "\n", rvc_rd,
+                rvc_rs1, imm_address);
+
+            bundle->addInstruction(new VanadisLoadInstruction(
+                ins_address, hw_thr, options, rvc_rs1, imm_address, rvc_rd, 4, true, MEM_TRANSACTION_NONE,
+                LOAD_INT_REGISTER));
+            decode_fault = false;
+        } break;
+        case 0x6000:
+        {
+            // LD
+            uint64_t imm_address = extract_uimm_rvc_t1(ins);
+            uint16_t rvc_rd      = expand_rvc_int_register(extract_rs2_rvc(ins));
+            uint16_t rvc_rs1     = expand_rvc_int_register(extract_rs1_rvc(ins));
 
-                    uint64_t offset = (offset_2 | offset_6 | offset_53);
+            output->verbose(
+                CALL_INFO, 16, 0, "-----> RVC LD rd=%" PRIu16 " <- rs1=%" PRIu16 " + imm=%" PRIu64 "\n", rvc_rd,
+                rvc_rs1, imm_address);
+
+            bundle->addInstruction(new VanadisLoadInstruction(
+                ins_address, hw_thr, options, rvc_rs1, imm_address, rvc_rd, 8, true, MEM_TRANSACTION_NONE,
+                LOAD_INT_REGISTER));
+            decode_fault = false;
+        } break;
+        case 0x8000:
+        {
+            // Reserved, this is a decode fault
+        } break;
+        case 0xA000:
+        {
+            // FSD
+            uint16_t rvc_rs2  = expand_rvc_int_register(extract_rs2_rvc(ins));
+            uint16_t rvc_rs1 = expand_rvc_int_register(extract_rs1_rvc(ins));
+
+            uint32_t imm_53 = (ins & 0x1C00) >> 7;
+            uint32_t imm_76 = (ins & 0x60) << 1;
+
+            uint32_t imm = (imm_53 | imm_76);
 
-                    output->verbose(
-                        CALL_INFO, 16, 0, "-----> RVC SW %" PRIu16 " -> %" PRIu16 " + %" PRIu64 "\n", rvc_rs2, rvc_rs1,
-                        offset);
+            output->verbose(
+                CALL_INFO, 16, 0, "-------> RVC FSD %" PRIu16 " -> memory[ %" PRIu16 " + %" PRIu32 " ]\n",
+                rvc_rs2, rvc_rs1, imm);
+
+            bundle->addInstruction(new VanadisStoreInstruction(
+                ins_address, hw_thr, options, rvc_rs1, imm, rvc_rs2, 8, MEM_TRANSACTION_NONE,
+                STORE_FP_REGISTER));
+            decode_fault = false;
+        } break;
+        case 0xC000:
+        {
+            // SW
+            uint16_t rvc_rs2 = expand_rvc_int_register(extract_rs2_rvc(ins));
+            uint16_t rvc_rs1 = expand_rvc_int_register(extract_rs1_rvc(ins));
+
+            uint32_t offset_53 = (ins & 0x1C00) >> 7;
+            uint32_t offset_6  = (ins & 0x20) << 1;
+            uint32_t offset_2  = (ins & 0x40) >> 4;
+
+            uint64_t offset = (offset_2 | offset_6 | offset_53);
 
-                    bundle->addInstruction(new VanadisStoreInstruction(
-                        ins_address, hw_thr, options, rvc_rs1, offset, rvc_rs2, 4, MEM_TRANSACTION_NONE,
-                        STORE_INT_REGISTER));
-                    decode_fault = false;
-                } break;
-                case 0xE000:
-                {
-                    // SD
-                    uint16_t rvc_rs2 = expand_rvc_int_register(extract_rs2_rvc(ins));
-                    uint16_t rvc_rs1 = expand_rvc_int_register(extract_rs1_rvc(ins));
+            output->verbose(
+                CALL_INFO, 16, 0, "-----> RVC SW %" PRIu16 " -> %" PRIu16 " + %" PRIu64 "\n", rvc_rs2, rvc_rs1,
+                offset);
+
+            bundle->addInstruction(new VanadisStoreInstruction(
+                ins_address, hw_thr, options, rvc_rs1, offset, rvc_rs2, 4, MEM_TRANSACTION_NONE,
+                STORE_INT_REGISTER));
+            decode_fault = false;
+        } break;
+        case 0xE000:
+        {
+            // SD
+            uint16_t rvc_rs2 = expand_rvc_int_register(extract_rs2_rvc(ins));
+            uint16_t rvc_rs1 = expand_rvc_int_register(extract_rs1_rvc(ins));
+
+            uint32_t offset_53 = (ins & 0x1C00) >> 7;
+            uint32_t offset_6  = (ins & 0x20) << 1;
+            uint32_t offset_7  = (ins & 0x40) << 1;
+
+            uint64_t offset = (offset_7 | offset_6 | offset_53);
+
+            output->verbose(
+                CALL_INFO, 16, 0, "-----> RVC SD %" PRIu16 " -> %" PRIu16 " + %" PRIu64 "\n", rvc_rs2, rvc_rs1,
+                offset);
+
+            bundle->addInstruction(new VanadisStoreInstruction(
+                ins_address, hw_thr, options, rvc_rs1, offset, rvc_rs2, 8, MEM_TRANSACTION_NONE,
+                STORE_INT_REGISTER));
+            decode_fault = false;
+        } break;
+        }
+    }
 
-                    uint32_t offset_53 = (ins & 0x1C00) >> 7;
-                    uint32_t offset_6  = (ins & 0x20) << 1;
-                    uint32_t offset_7  = (ins & 0x40) << 1;
+    // RVC quadrant 1
+    void decodeRVCQuadrant1(
+        SST::Output* output, const uint64_t ins_address, const uint32_t ins, VanadisInstructionBundle* bundle,
+        bool& decode_fault)
+    {
+        const uint32_t c_func_code = ins & 0xE000;
+
+        switch ( c_func_code ) {
+        case 0x0:
+        {
+            // NOP // ADDI
+            uint16_t rvc_rs1 = static_cast<uint16_t>((ins & 0xF80) >> 7);
+
+            if ( 0 == rvc_rs1 ) {
+                // This is a no-op?
+                output->verbose(CALL_INFO, 16, 0, "-----> creates a no-op.\n");
+                bundle->addInstruction(
+                    new VanadisAddImmInstruction<int64_t>(
+                        ins_address, hw_thr, options, 0, 0, 0));
+                decode_fault = false;
+            }
+            else {
+                uint32_t imm_40 = (ins & 0x7C) >> 2;
+                uint32_t imm_5  = (ins & 0x1000) >> 7;
 
-                    uint64_t offset = (offset_7 | offset_6 | offset_53);
+                int64_t imm = (imm_40 | imm_5);
 
-                    output->verbose(
-                        CALL_INFO, 16, 0, "-----> RVC SD %" PRIu16 " -> %" PRIu16 " + %" PRIu64 "\n", rvc_rs2, rvc_rs1,
-                        offset);
+                if ( imm_5 != 0 ) { imm |= 0xFFFFFFFFFFFFFFC0; }
 
-                    bundle->addInstruction(new VanadisStoreInstruction(
-                        ins_address, hw_thr, options, rvc_rs1, offset, rvc_rs2, 8, MEM_TRANSACTION_NONE,
-                        STORE_INT_REGISTER));
-                    decode_fault = false;
-                } break;
+                if ( imm_5 == 0 ) {
+                    // Tehcnicall this is a HINT, now what do we do?
                 }
-            } break;
-            case 0x1:
-            {
-                const uint32_t c_func_code = ins & 0xE000;
 
-                switch ( c_func_code ) {
-                case 0x0:
-                {
-                    // NOP // ADDI
-                    uint16_t rvc_rs1 = static_cast<uint16_t>((ins & 0xF80) >> 7);
+                output->verbose(
+                    CALL_INFO, 16, 0, "-----> RVC ADDI %" PRIu16 " = %" PRIu16 " + %" PRId64 "\n", rvc_rs1,
+                    rvc_rs1, imm);
+
+                bundle->addInstruction(
+                    new VanadisAddImmInstruction<int64_t>(
+                        ins_address, hw_thr, options, rvc_rs1, rvc_rs1, imm));
+                decode_fault = false;
+            }
+        } break;
+        case 0x2000:
+        {
+            // ADDIW
+            uint16_t rd     = static_cast<uint16_t>((ins & 0xF80) >> 7);
+            uint32_t imm_40 = (ins & 0x7C) >> 2;
+            uint32_t imm_5  = (ins & 0x1000) >> 7;
+
+            int32_t imm = (imm_40 | imm_5);
 
-                    if ( 0 == rvc_rs1 ) {
-                        // This is a no-op?
-                        output->verbose(CALL_INFO, 16, 0, "-----> creates a no-op.\n");
-                        bundle->addInstruction(
-                            new VanadisAddImmInstruction<int64_t>(
-                                ins_address, hw_thr, options, 0, 0, 0));
-                        decode_fault = false;
-                    }
-                    else {
-                        uint32_t imm_40 = (ins & 0x7C) >> 2;
-                        uint32_t imm_5  = (ins & 0x1000) >> 7;
+            if ( imm_5 != 0 ) { imm |= 0xFFFFFFC0; }
 
-                        int64_t imm = (imm_40 | imm_5);
+            output->verbose(CALL_INFO, 16, 0, "-----> RVC ADDIW  reg: %" PRIu16 ", imm=%" PRId32 "\n", rd, imm);
 
-                        if ( imm_5 != 0 ) { imm |= 0xFFFFFFFFFFFFFFC0; }
+            // This really is a W-clipping instruction, so make INT32
+            bundle->addInstruction(new VanadisAddImmInstruction<int32_t>(
+                ins_address, hw_thr, options, rd, rd, static_cast<int32_t>(imm)));
+            decode_fault = false;
+        } break;
+        case 0x4000:
+        {
+            // LI
+            uint16_t rd     = static_cast<uint16_t>((ins & 0xF80) >> 7);
+            uint32_t imm_40 = (ins & 0x7C) >> 2;
+            uint32_t imm_5  = (ins & 0x1000) >> 7;
 
-                        if ( imm_5 == 0 ) {
-                            // Tehcnicall this is a HINT, now what do we do?
-                        }
+            int64_t imm = (imm_40 | imm_5);
 
-                        output->verbose(
-                            CALL_INFO, 16, 0, "-----> RVC ADDI %" PRIu16 " = %" PRIu16 " + %" PRId64 "\n", rvc_rs1,
-                            rvc_rs1, imm);
+            if ( imm_5 != 0 ) { imm |= 0xFFFFFFFFFFFFFFC0; }
 
-                        bundle->addInstruction(
-                            new VanadisAddImmInstruction<int64_t>(
-                                ins_address, hw_thr, options, rvc_rs1, rvc_rs1, imm));
-                        decode_fault = false;
-                    }
-                } break;
-                case 0x2000:
-                {
-                    // ADDIW
-                    uint16_t rd     = static_cast<uint16_t>((ins & 0xF80) >> 7);
-                    uint32_t imm_40 = (ins & 0x7C) >> 2;
-                    uint32_t imm_5  = (ins & 0x1000) >> 7;
+            output->verbose(
+                CALL_INFO, 16, 0, "-----> RVC load imediate (LI) reg: %" PRIu16 ", imm=%" PRId64 "\n", rd, imm);
+
+            bundle->addInstruction(
+                new VanadisSetRegisterInstruction<int64_t>(
+                    ins_address, hw_thr, options, rd, imm));
+            decode_fault = false;
+        } break;
+        case 0x6000:
+        {
+            // ADDI16SP / LUI
+            uint16_t rd = static_cast<uint16_t>((ins & 0xF80) >> 7);
+
+            if ( rd != 2 ) {
+                // LUI
+                uint32_t imm_1612 = (ins & 0x7C) << 10;
+                uint32_t imm_17   = (ins & 0x1000) << 5;
 
-                    int32_t imm = (imm_40 | imm_5);
+                int32_t imm = (imm_17 | imm_1612);
 
-                    if ( imm_5 != 0 ) { imm |= 0xFFFFFFC0; }
+                        if(imm_17 != 0) {
+                            imm = imm | 0xFFFC0000;
+                        }
 
-                    output->verbose(CALL_INFO, 16, 0, "-----> RVC ADDIW  reg: %" PRIu16 ", imm=%" PRId32 "\n", rd, imm);
+                output->verbose(
+                    CALL_INFO, 16, 0,
+                    "-----> RVC load imediate (LUI) reg: %" PRIu16 ", imm=%" PRId32 " (%#" PRIx32 ")\n", rd, imm,
+                    imm);
 
-                    // This really is a W-clipping instruction, so make INT32
-                    bundle->addInstruction(new VanadisAddImmInstruction<int32_t>(
-                        ins_address, hw_thr, options, rd, rd, static_cast<int32_t>(imm)));
-                    decode_fault = false;
-                } break;
-                case 0x4000:
-                {
-                    // LI
-                    uint16_t rd     = static_cast<uint16_t>((ins & 0xF80) >> 7);
-                    uint32_t imm_40 = (ins & 0x7C) >> 2;
-                    uint32_t imm_5  = (ins & 0x1000) >> 7;
+                bundle->addInstruction(
+                    new VanadisSetRegisterInstruction<int32_t>(
+                        ins_address, hw_thr, options, rd, imm));
+                decode_fault = false;
+            }
+            else {
+                // ADDI16SP
+                output->verbose(CALL_INFO, 16, 0, "----> RVC ADDI16SP\n");
 
-                    int64_t imm = (imm_40 | imm_5);
+                const uint32_t imm_5  = (ins & 0x4) << 3;
+                const uint32_t imm_87 = (ins & 0x18) << 4;
+                const uint32_t imm_6  = (ins & 0x20) << 1;
+                const uint32_t imm_4  = (ins & 0x40) >> 2;
+                const uint32_t imm_9  = (ins & 0x1000) >> 3;
 
-                    if ( imm_5 != 0 ) { imm |= 0xFFFFFFFFFFFFFFC0; }
+                int64_t imm = imm_5 | imm_87 | imm_6 | imm_4 | imm_9;
 
-                    output->verbose(
-                        CALL_INFO, 16, 0, "-----> RVC load imediate (LI) reg: %" PRIu16 ", imm=%" PRId64 "\n", rd, imm);
+                if ( imm_9 != 0 ) { imm |= 0xFFFFFFFFFFFFFC00; }
 
-                    bundle->addInstruction(
-                        new VanadisSetRegisterInstruction<int64_t>(
-                            ins_address, hw_thr, options, rd, imm));
-                    decode_fault = false;
-                } break;
-                case 0x6000:
-                {
-                    // ADDI16SP / LUI
-                    uint16_t rd = static_cast<uint16_t>((ins & 0xF80) >> 7);
+                output->verbose(CALL_INFO, 16, 0, "-----> RVC ADDI16SP r2 <- %" PRId64 "\n", imm);
 
-                    if ( rd != 2 ) {
-                        // LUI
-                        uint32_t imm_1612 = (ins & 0x7C) << 10;
-                        uint32_t imm_17   = (ins & 0x1000) << 5;
+                bundle->addInstruction(
+                    new VanadisAddImmInstruction<int64_t>(
+                        ins_address, hw_thr, options, 2, 2, imm));
+                decode_fault = false;
+            }
+        } break;
+        case 0x8000:
+        {
+            const uint32_t c_func2_code = ins & 0xC00;
 
-                        int32_t imm = (imm_17 | imm_1612);
+            output->verbose(CALL_INFO, 16, 0, "------> RCV arith code: %" PRIu32 "\n", c_func2_code);
 
-								if(imm_17 != 0) {
-									imm = imm | 0xFFFC0000;
-								}
+            switch ( c_func2_code ) {
+            case 0x0:
+            {
+                // SRLI
+                uint32_t shamt_5  = (ins & 0x1000) >> 7;
+                uint32_t shamt_40 = (ins & 0x7C) >> 2;
 
-                        output->verbose(
-                            CALL_INFO, 16, 0,
-                            "-----> RVC load imediate (LUI) reg: %" PRIu16 ", imm=%" PRId32 " (%#" PRIx32 ")\n", rd, imm,
-                            imm);
+                uint64_t shift_by = shamt_5 | shamt_40;
 
-                        bundle->addInstruction(
-                            new VanadisSetRegisterInstruction<int32_t>(
-                                ins_address, hw_thr, options, rd, imm));
-                        decode_fault = false;
-                    }
-                    else {
-                        // ADDI16SP
-                        output->verbose(CALL_INFO, 16, 0, "----> RVC ADDI16SP\n");
+                uint16_t rvc_rs1 = expand_rvc_int_register(extract_rs1_rvc(ins));
+
+                output->verbose(
+                    CALL_INFO, 16, 0, "--------> RVC SRLI %" PRIu16 " = %" PRIu16 " >> %" PRIu64 " (0x%" PRI_ADDR ")\n",
+                    rvc_rs1, rvc_rs1, shift_by, shift_by);
+                bundle->addInstruction(
+                    new VanadisShiftRightLogicalImmInstruction<VanadisRegisterFormat::VANADIS_FORMAT_INT64>(
+                        ins_address, hw_thr, options, rvc_rs1, rvc_rs1, shift_by));
+                decode_fault = false;
+            } break;
+            case 0x400:
+            {
+                // SRAI
+                uint32_t shamt_5  = (ins & 0x1000) >> 7;
+                uint32_t shamt_40 = (ins & 0x7C) >> 2;
 
-                        const uint32_t imm_5  = (ins & 0x4) << 3;
-                        const uint32_t imm_87 = (ins & 0x18) << 4;
-                        const uint32_t imm_6  = (ins & 0x20) << 1;
-                        const uint32_t imm_4  = (ins & 0x40) >> 2;
-                        const uint32_t imm_9  = (ins & 0x1000) >> 3;
+                uint64_t shift_by = shamt_5 | shamt_40;
 
-                        int64_t imm = imm_5 | imm_87 | imm_6 | imm_4 | imm_9;
+                uint16_t rvc_rs1 = expand_rvc_int_register(extract_rs1_rvc(ins));
 
-                        if ( imm_9 != 0 ) { imm |= 0xFFFFFFFFFFFFFC00; }
+                output->verbose(
+                    CALL_INFO, 16, 0, "--------> RVC SRAI %" PRIu16 " = %" PRIu16 " >> %" PRIu64 " (0x%" PRI_ADDR ")\n",
+                    rvc_rs1, rvc_rs1, shift_by, shift_by);
+                bundle->addInstruction(
+                    new VanadisShiftRightArithmeticImmInstruction<VanadisRegisterFormat::VANADIS_FORMAT_INT64>(
+                        ins_address, hw_thr, options, rvc_rs1, rvc_rs1, shift_by));
+                decode_fault = false;
+            } break;
+            case 0x800:
+            {
+                // ANDI
+                uint32_t imm_5  = (ins & 0x1000) >> 7;
+                uint32_t imm_40 = (ins & 0x7C) >> 2;
 
-                        output->verbose(CALL_INFO, 16, 0, "-----> RVC ADDI16SP r2 <- %" PRId64 "\n", imm);
+                uint64_t imm = imm_5 | imm_40;
 
-                        bundle->addInstruction(
-                            new VanadisAddImmInstruction<int64_t>(
-                                ins_address, hw_thr, options, 2, 2, imm));
-                        decode_fault = false;
-                    }
-                } break;
-                case 0x8000:
-                {
-                    const uint32_t c_func2_code = ins & 0xC00;
+                if ( imm_5 != 0 ) { imm |= 0xFFFFFFFFFFFFFFC0; }
 
-                    output->verbose(CALL_INFO, 16, 0, "------> RCV arith code: %" PRIu32 "\n", c_func2_code);
+                uint16_t rvc_rs1 = expand_rvc_int_register(extract_rs1_rvc(ins));
 
-                    switch ( c_func2_code ) {
-                    case 0x0:
-                    {
-                        // SRLI
-                        uint32_t shamt_5  = (ins & 0x1000) >> 7;
-                        uint32_t shamt_40 = (ins & 0x7C) >> 2;
+                output->verbose(
+                    CALL_INFO, 16, 0, "--------> RVC ANDI %" PRIu16 " = %" PRIu16 " & %" PRIu64 " (0x%" PRI_ADDR ")\n",
+                    rvc_rs1, rvc_rs1, imm, imm);
 
-                        uint64_t shift_by = shamt_5 | shamt_40;
+                bundle->addInstruction(
+                    new VanadisAndImmInstruction(ins_address, hw_thr, options, rvc_rs1, rvc_rs1, imm));
+                decode_fault = false;
+            } break;
+            case 0xC00:
+            {
+                // Arith
+                uint16_t rvc_rs2 = expand_rvc_int_register(extract_rs2_rvc(ins));
+                uint16_t rvc_rs1 = expand_rvc_int_register(extract_rs1_rvc(ins));
 
-                        uint16_t rvc_rs1 = expand_rvc_int_register(extract_rs1_rvc(ins));
+                switch ( ins & 0x1000 ) {
+                case 0x0:
+                {
+                    output->verbose(CALL_INFO, 16, 0, "------> RVC arith check zero family\n");
 
+                    switch ( ins & 0x60 ) {
+                    case 0x0:
+                    {
+                        // SUB
                         output->verbose(
-                            CALL_INFO, 16, 0, "--------> RVC SRLI %" PRIu16 " = %" PRIu16 " >> %" PRIu64 " (0x%" PRI_ADDR ")\n",
-                            rvc_rs1, rvc_rs1, shift_by, shift_by);
+                            CALL_INFO, 16, 0, "--------> RVC SUB %" PRIu16 " <- %" PRIu16 " - %" PRIu16 "\n",
+                            rvc_rs1, rvc_rs1, rvc_rs2);
                         bundle->addInstruction(
-                            new VanadisShiftRightLogicalImmInstruction<VanadisRegisterFormat::VANADIS_FORMAT_INT64>(
-                                ins_address, hw_thr, options, rvc_rs1, rvc_rs1, shift_by));
+                            new VanadisSubInstruction<int64_t>(
+                                ins_address, hw_thr, options, rvc_rs1, rvc_rs1, rvc_rs2, true));
                         decode_fault = false;
                     } break;
-                    case 0x400:
+                    case 0x20:
                     {
-                        // SRAI
-                        uint32_t shamt_5  = (ins & 0x1000) >> 7;
-                        uint32_t shamt_40 = (ins & 0x7C) >> 2;
-
-                        uint64_t shift_by = shamt_5 | shamt_40;
-
-                        uint16_t rvc_rs1 = expand_rvc_int_register(extract_rs1_rvc(ins));
-
+                        // XOR
                         output->verbose(
-                            CALL_INFO, 16, 0, "--------> RVC SRAI %" PRIu16 " = %" PRIu16 " >> %" PRIu64 " (0x%" PRI_ADDR ")\n",
-                            rvc_rs1, rvc_rs1, shift_by, shift_by);
+                            CALL_INFO, 16, 0, "--------> RVC XOR %" PRIu16 " <- %" PRIu16 " ^ %" PRIu16 "\n",
+                            rvc_rs1, rvc_rs1, rvc_rs2);
                         bundle->addInstruction(
-                            new VanadisShiftRightArithmeticImmInstruction<VanadisRegisterFormat::VANADIS_FORMAT_INT64>(
-                                ins_address, hw_thr, options, rvc_rs1, rvc_rs1, shift_by));
+                            new VanadisXorInstruction(ins_address, hw_thr, options, rvc_rs1, rvc_rs1, rvc_rs2));
                         decode_fault = false;
                     } break;
-                    case 0x800:
+                    case 0x40:
                     {
-                        // ANDI
-                        uint32_t imm_5  = (ins & 0x1000) >> 7;
-                        uint32_t imm_40 = (ins & 0x7C) >> 2;
-
-                        uint64_t imm = imm_5 | imm_40;
-
-                        if ( imm_5 != 0 ) { imm |= 0xFFFFFFFFFFFFFFC0; }
+                        // OR
+                        output->verbose(
+                            CALL_INFO, 16, 0, "--------> RVC OR %" PRIu16 " <- %" PRIu16 " | %" PRIu16 "\n",
+                            rvc_rs1, rvc_rs1, rvc_rs2);
+                        bundle->addInstruction(
+                            new VanadisOrInstruction(ins_address, hw_thr, options, rvc_rs1, rvc_rs1, rvc_rs2));
+                        decode_fault = false;
+                    } break;
+                    case 0x60:
+                    {
+                        // AND
+                        output->verbose(
+                            CALL_INFO, 16, 0, "--------> RVC AND %" PRIu16 " <- %" PRIu16 " & %" PRIu16 "\n",
+                            rvc_rs1, rvc_rs1, rvc_rs2);
+                        bundle->addInstruction(
+                            new VanadisAndInstruction(ins_address, hw_thr, options, rvc_rs1, rvc_rs1, rvc_rs2));
+                        decode_fault = false;
+                    } break;
+                    }
+                } break;
+                case 0x1000:
+                {
+                    output->verbose(CALL_INFO, 16, 0, "------> RVC arith check one family\n");
 
+                    switch ( ins & 0x60 ) {
+                    case 0x0:
+                    {
+                        // SUBW
+                        uint16_t rvc_rs2 = expand_rvc_int_register(extract_rs2_rvc(ins));
                         uint16_t rvc_rs1 = expand_rvc_int_register(extract_rs1_rvc(ins));
 
                         output->verbose(
-                            CALL_INFO, 16, 0, "--------> RVC ANDI %" PRIu16 " = %" PRIu16 " & %" PRIu64 " (0x%" PRI_ADDR ")\n",
-                            rvc_rs1, rvc_rs1, imm, imm);
+                            CALL_INFO, 16, 0, "------> RVC SUBW %" PRIu16 " <- %" PRIu16 " + %" PRIu16 "\n",
+                            rvc_rs1, rvc_rs1, rvc_rs2);
 
                         bundle->addInstruction(
-                            new VanadisAndImmInstruction(ins_address, hw_thr, options, rvc_rs1, rvc_rs1, imm));
+                            new VanadisSubInstruction<int32_t>(
+                                ins_address, hw_thr, options, rvc_rs1, rvc_rs1, rvc_rs2, false));
                         decode_fault = false;
+
                     } break;
-                    case 0xC00:
+                    case 0x20:
                     {
-                        // Arith
+                        // ADDW
                         uint16_t rvc_rs2 = expand_rvc_int_register(extract_rs2_rvc(ins));
                         uint16_t rvc_rs1 = expand_rvc_int_register(extract_rs1_rvc(ins));
 
-                        switch ( ins & 0x1000 ) {
-                        case 0x0:
-                        {
-                            output->verbose(CALL_INFO, 16, 0, "------> RVC arith check zero family\n");
-
-                            switch ( ins & 0x60 ) {
-                            case 0x0:
-                            {
-                                // SUB
-                                output->verbose(
-                                    CALL_INFO, 16, 0, "--------> RVC SUB %" PRIu16 " <- %" PRIu16 " - %" PRIu16 "\n",
-                                    rvc_rs1, rvc_rs1, rvc_rs2);
-                                bundle->addInstruction(
-                                    new VanadisSubInstruction<int64_t>(
-                                        ins_address, hw_thr, options, rvc_rs1, rvc_rs1, rvc_rs2, true));
-                                decode_fault = false;
-                            } break;
-                            case 0x20:
-                            {
-                                // XOR
-                                output->verbose(
-                                    CALL_INFO, 16, 0, "--------> RVC XOR %" PRIu16 " <- %" PRIu16 " ^ %" PRIu16 "\n",
-                                    rvc_rs1, rvc_rs1, rvc_rs2);
-                                bundle->addInstruction(
-                                    new VanadisXorInstruction(ins_address, hw_thr, options, rvc_rs1, rvc_rs1, rvc_rs2));
-                                decode_fault = false;
-                            } break;
-                            case 0x40:
-                            {
-                                // OR
-                                output->verbose(
-                                    CALL_INFO, 16, 0, "--------> RVC OR %" PRIu16 " <- %" PRIu16 " | %" PRIu16 "\n",
-                                    rvc_rs1, rvc_rs1, rvc_rs2);
-                                bundle->addInstruction(
-                                    new VanadisOrInstruction(ins_address, hw_thr, options, rvc_rs1, rvc_rs1, rvc_rs2));
-                                decode_fault = false;
-                            } break;
-                            case 0x60:
-                            {
-                                // AND
-                                output->verbose(
-                                    CALL_INFO, 16, 0, "--------> RVC AND %" PRIu16 " <- %" PRIu16 " & %" PRIu16 "\n",
-                                    rvc_rs1, rvc_rs1, rvc_rs2);
-                                bundle->addInstruction(
-                                    new VanadisAndInstruction(ins_address, hw_thr, options, rvc_rs1, rvc_rs1, rvc_rs2));
-                                decode_fault = false;
-                            } break;
-                            }
-                        } break;
-                        case 0x1000:
-                        {
-                            output->verbose(CALL_INFO, 16, 0, "------> RVC arith check one family\n");
-
-                            switch ( ins & 0x60 ) {
-                            case 0x0:
-                            {
-                                // SUBW
-                                uint16_t rvc_rs2 = expand_rvc_int_register(extract_rs2_rvc(ins));
-                                uint16_t rvc_rs1 = expand_rvc_int_register(extract_rs1_rvc(ins));
-
-                                output->verbose(
-                                    CALL_INFO, 16, 0, "------> RVC SUBW %" PRIu16 " <- %" PRIu16 " + %" PRIu16 "\n",
-                                    rvc_rs1, rvc_rs1, rvc_rs2);
-
-                                bundle->addInstruction(
-                                    new VanadisSubInstruction<int32_t>(
-                                        ins_address, hw_thr, options, rvc_rs1, rvc_rs1, rvc_rs2, false));
-                                decode_fault = false;
-
-                            } break;
-                            case 0x20:
-                            {
-                                // ADDW
-                                uint16_t rvc_rs2 = expand_rvc_int_register(extract_rs2_rvc(ins));
-                                uint16_t rvc_rs1 = expand_rvc_int_register(extract_rs1_rvc(ins));
-
-                                output->verbose(
-                                    CALL_INFO, 16, 0, "------> RVC ADDW %" PRIu16 " <- %" PRIu16 " + %" PRIu16 "\n",
-                                    rvc_rs1, rvc_rs1, rvc_rs2);
-
-                                bundle->addInstruction(
-                                    new VanadisAddInstruction<int32_t>(
-                                        ins_address, hw_thr, options, rvc_rs1, rvc_rs1, rvc_rs2));
-                                decode_fault = false;
-
-                            } break;
-                            case 0x40:
-                            {
-                                // Reserved, not used
-                            } break;
-                            case 0x60:
-                            {
-                                // Reserved, not used
-                            } break;
-                            }
-                        } break;
-                        }
+                        output->verbose(
+                            CALL_INFO, 16, 0, "------> RVC ADDW %" PRIu16 " <- %" PRIu16 " + %" PRIu16 "\n",
+                            rvc_rs1, rvc_rs1, rvc_rs2);
+
+                        bundle->addInstruction(
+                            new VanadisAddInstruction<int32_t>(
+                                ins_address, hw_thr, options, rvc_rs1, rvc_rs1, rvc_rs2));
+                        decode_fault = false;
+
+                    } break;
+                    case 0x40:
+                    {
+                        // Reserved, not used
+                    } break;
+                    case 0x60:
+                    {
+                        // Reserved, not used
                     } break;
                     }
                 } break;
-                case 0xA000:
-                {
-                    // JUMP
-                    const uint32_t imm_11 = (ins & 0x1000) >> 1;
-                    const uint32_t imm_4  = (ins & 0x800) >> 7;
-                    const uint32_t imm_98 = (ins & 0x600) >> 1;
-                    const uint32_t imm_10 = (ins & 0x100) << 2;
-                    const uint32_t imm_6  = (ins & 0x80) >> 1;
-                    const uint32_t imm_7  = (ins & 0x40) << 1;
-                    const uint32_t imm_31 = (ins & 0x38) >> 2;
-                    const uint32_t imm_5  = (ins & 0x4) << 3;
-
-                    int64_t imm_final =
-                        static_cast<int64_t>(imm_11 | imm_4 | imm_98 | imm_10 | imm_6 | imm_7 | imm_31 | imm_5);
+                }
+            } break;
+            }
+        } break;
+        case 0xA000:
+        {
+            // JUMP
+            const uint32_t imm_11 = (ins & 0x1000) >> 1;
+            const uint32_t imm_4  = (ins & 0x800) >> 7;
+            const uint32_t imm_98 = (ins & 0x600) >> 1;
+            const uint32_t imm_10 = (ins & 0x100) << 2;
+            const uint32_t imm_6  = (ins & 0x80) >> 1;
+            const uint32_t imm_7  = (ins & 0x40) << 1;
+            const uint32_t imm_31 = (ins & 0x38) >> 2;
+            const uint32_t imm_5  = (ins & 0x4) << 3;
+
+            int64_t imm_final =
+                static_cast<int64_t>(imm_11 | imm_4 | imm_98 | imm_10 | imm_6 | imm_7 | imm_31 | imm_5);
+
+            // sign-extend the immediate if needed (is MSB 1, indicates negative)
+            if ( imm_11 != 0 ) { imm_final |= 0xFFFFFFFFFFFFF800; }
+
+            const int64_t  pc_i64      = static_cast<int64_t>(ins_address);
+            const uint64_t jump_target = static_cast<uint64_t>(pc_i64 + imm_final);
 
-                    // sign-extend the immediate if needed (is MSB 1, indicates negative)
-                    if ( imm_11 != 0 ) { imm_final |= 0xFFFFFFFFFFFFF800; }
+            output->verbose(
+                CALL_INFO, 16, 0, "----> decode RVC JUMP pc=0x%" PRI_ADDR " + imm=%" PRId64 " = 0x%" PRI_ADDR "\n", ins_address,
+                imm_final, jump_target);
 
-                    const int64_t  pc_i64      = static_cast<int64_t>(ins_address);
-                    const uint64_t jump_target = static_cast<uint64_t>(pc_i64 + imm_final);
+            bundle->addInstruction(new VanadisJumpInstruction(
+                ins_address, hw_thr, options, 2, jump_target, VANADIS_NO_DELAY_SLOT));
+            decode_fault = false;
+        } break;
+        case 0xC000:
+        {
+            // BEQZ
+            uint16_t rvc_rs1 = expand_rvc_int_register(extract_rs1_rvc(ins));
 
-                    output->verbose(
-                        CALL_INFO, 16, 0, "----> decode RVC JUMP pc=0x%" PRI_ADDR " + imm=%" PRId64 " = 0x%" PRI_ADDR "\n", ins_address,
-                        imm_final, jump_target);
+            const uint32_t imm_8  = (ins & 0x1000) >> 4;
+            const uint32_t imm_43 = (ins & 0xC00) >> 7;
+            const uint32_t imm_76 = (ins & 0x60) << 1;
+            const uint32_t imm_21 = (ins & 0x18) >> 2;
+            const uint32_t imm_5  = (ins & 0x4) << 3;
 
-                    bundle->addInstruction(new VanadisJumpInstruction(
-                        ins_address, hw_thr, options, 2, jump_target, VANADIS_NO_DELAY_SLOT));
-                    decode_fault = false;
-                } break;
-                case 0xC000:
-                {
-                    // BEQZ
-                    uint16_t rvc_rs1 = expand_rvc_int_register(extract_rs1_rvc(ins));
+            int64_t imm_final = static_cast<int64_t>(imm_8 | imm_76 | imm_5 | imm_43 | imm_21);
 
-                    const uint32_t imm_8  = (ins & 0x1000) >> 4;
-                    const uint32_t imm_43 = (ins & 0xC00) >> 7;
-                    const uint32_t imm_76 = (ins & 0x60) << 1;
-                    const uint32_t imm_21 = (ins & 0x18) >> 2;
-                    const uint32_t imm_5  = (ins & 0x4) << 3;
+            if ( imm_8 != 0 ) { imm_final |= 0xFFFFFFFFFFFFFE00; }
 
-                    int64_t imm_final = static_cast<int64_t>(imm_8 | imm_76 | imm_5 | imm_43 | imm_21);
+            output->verbose(
+                CALL_INFO, 16, 0, "----> decode RVC BEQZ %" PRIu16 " jump to: 0x%" PRI_ADDR " + 0x%" PRI_ADDR " = 0x%" PRI_ADDR "\n",
+                rvc_rs1, ins_address, imm_final, ins_address + imm_final);
 
-                    if ( imm_8 != 0 ) { imm_final |= 0xFFFFFFFFFFFFFE00; }
+            bundle->addInstruction(new VanadisBranchRegCompareImmInstruction<
+                                   int64_t, REG_COMPARE_EQ>(
+                ins_address, hw_thr, options, 2, rvc_rs1, 0, imm_final, VANADIS_NO_DELAY_SLOT));
+            decode_fault = false;
+        } break;
+        case 0xE000:
+        {
+            // BNEZ
+            uint16_t rvc_rs1 = expand_rvc_int_register(extract_rs1_rvc(ins));
 
-                    output->verbose(
-                        CALL_INFO, 16, 0, "----> decode RVC BEQZ %" PRIu16 " jump to: 0x%" PRI_ADDR " + 0x%" PRI_ADDR " = 0x%" PRI_ADDR "\n",
-                        rvc_rs1, ins_address, imm_final, ins_address + imm_final);
+            const uint32_t imm_8  = (ins & 0x1000) >> 4;
+            const uint32_t imm_43 = (ins & 0xC00) >> 7;
+            const uint32_t imm_76 = (ins & 0x60) << 1;
+            const uint32_t imm_21 = (ins & 0x18) >> 2;
+            const uint32_t imm_5  = (ins & 0x4) << 3;
 
-                    bundle->addInstruction(new VanadisBranchRegCompareImmInstruction<
-                                           int64_t, REG_COMPARE_EQ>(
-                        ins_address, hw_thr, options, 2, rvc_rs1, 0, imm_final, VANADIS_NO_DELAY_SLOT));
-                    decode_fault = false;
-                } break;
-                case 0xE000:
-                {
-                    // BNEZ
-                    uint16_t rvc_rs1 = expand_rvc_int_register(extract_rs1_rvc(ins));
+            int64_t imm_final = static_cast<int64_t>(imm_8 | imm_76 | imm_5 | imm_43 | imm_21);
 
-                    const uint32_t imm_8  = (ins & 0x1000) >> 4;
-                    const uint32_t imm_43 = (ins & 0xC00) >> 7;
-                    const uint32_t imm_76 = (ins & 0x60) << 1;
-                    const uint32_t imm_21 = (ins & 0x18) >> 2;
-                    const uint32_t imm_5  = (ins & 0x4) << 3;
+            if ( imm_8 != 0 ) { imm_final |= 0xFFFFFFFFFFFFFE00; }
 
-                    int64_t imm_final = static_cast<int64_t>(imm_8 | imm_76 | imm_5 | imm_43 | imm_21);
+            output->verbose(
+                CALL_INFO, 16, 0, "----> decode RVC BNEZ %" PRIu16 " jump to: 0x%" PRI_ADDR " + 0x%" PRI_ADDR " = 0x%" PRI_ADDR "\n",
+                rvc_rs1, ins_address, imm_final, ins_address + imm_final);
+
+            bundle->addInstruction(new VanadisBranchRegCompareImmInstruction<
+                                   int64_t, REG_COMPARE_NEQ>(
+                ins_address, hw_thr, options, 2, rvc_rs1, 0, imm_final, VANADIS_NO_DELAY_SLOT));
+            decode_fault = false;
+        } break;
+        }
+    }
 
-                    if ( imm_8 != 0 ) { imm_final |= 0xFFFFFFFFFFFFFE00; }
+    // RVC quadrant 2
+    void decodeRVCQuadrant2(
+        SST::Output* output, const uint64_t ins_address, const uint32_t ins, VanadisInstructionBundle* bundle,
+        bool& decode_fault)
+    {
+        const uint32_t c_func_code = ins & 0xE000;
 
-                    output->verbose(
-                        CALL_INFO, 16, 0, "----> decode RVC BNEZ %" PRIu16 " jump to: 0x%" PRI_ADDR " + 0x%" PRI_ADDR " = 0x%" PRI_ADDR "\n",
-                        rvc_rs1, ins_address, imm_final, ins_address + imm_final);
+        output->verbose(
+            CALL_INFO, 16, 0, "---> RVC function code = %" PRIu32 " / 0x%" PRIx32 "\n", c_func_code, c_func_code);
 
-                    bundle->addInstruction(new VanadisBranchRegCompareImmInstruction<
-                                           int64_t, REG_COMPARE_NEQ>(
-                        ins_address, hw_thr, options, 2, rvc_rs1, 0, imm_final, VANADIS_NO_DELAY_SLOT));
-                    decode_fault = false;
-                } break;
-                }
-            } break;
-            case 0x2:
-            {
-                const uint32_t c_func_code = ins & 0xE000;
+        switch ( c_func_code ) {
+        case 0x0:
+        {
+            // SLLI
+            uint32_t shamt_5  = (ins & 0x1000) >> 7;
+            uint32_t shamt_40 = (ins & 0x7C) >> 2;
 
-                output->verbose(
-                    CALL_INFO, 16, 0, "---> RVC function code = %" PRIu32 " / 0x%" PRIx32 "\n", c_func_code, c_func_code);
+            uint64_t shift_by = shamt_5 | shamt_40;
 
-                switch ( c_func_code ) {
-                case 0x0:
-                {
-                    // SLLI
-                    uint32_t shamt_5  = (ins & 0x1000) >> 7;
-                    uint32_t shamt_40 = (ins & 0x7C) >> 2;
+            uint16_t rvc_rs1 = (ins & 0xF80) >> 7;
 
-                    uint64_t shift_by = shamt_5 | shamt_40;
+            output->verbose(
+                CALL_INFO, 16, 0, "--------> RVC SLLI %" PRIu16 " = %" PRIu16 " >> %" PRIu64 " (0x%" PRIx64 ")\n",
+                rvc_rs1, rvc_rs1, shift_by, shift_by);
+            bundle->addInstruction(
+                new VanadisShiftLeftLogicalImmInstruction<uint64_t>(
+                    ins_address, hw_thr, options, rvc_rs1, rvc_rs1, shift_by));
+            decode_fault = false;
 
-                    uint16_t rvc_rs1 = (ins & 0xF80) >> 7;
+        } break;
+        case 0x2000:
+        {
+            // FLDSP
+            uint32_t imm_86 = (ins & 0x1C) << 4;
+            uint32_t imm_43 = (ins & 0x60) >> 2;
+            uint32_t imm_5  = (ins & 0x1000) >> 7;
 
-                    output->verbose(
-                        CALL_INFO, 16, 0, "--------> RVC SLLI %" PRIu16 " = %" PRIu16 " >> %" PRIu64 " (0x%" PRIx64 ")\n",
-                        rvc_rs1, rvc_rs1, shift_by, shift_by);
-                    bundle->addInstruction(
-                        new VanadisShiftLeftLogicalImmInstruction<uint64_t>(
-                            ins_address, hw_thr, options, rvc_rs1, rvc_rs1, shift_by));
-                    decode_fault = false;
+            uint32_t offset = imm_5 | imm_43 | imm_86;
 
-                } break;
-                case 0x2000:
-                {
-                    // FLDSP
-                    uint32_t imm_86 = (ins & 0x1C) << 4;
-                    uint32_t imm_43 = (ins & 0x60) >> 2;
-                    uint32_t imm_5  = (ins & 0x1000) >> 7;
+            uint16_t rvc_rd = static_cast<uint16_t>((ins & 0xF80) >> 7);
 
-                    uint32_t offset = imm_5 | imm_43 | imm_86;
+            output->verbose(
+                CALL_INFO, 16, 0, "--------> RVC FLDSP %" PRIu16 " <- memory[sp (r2) + %" PRIu32 "]\n", rvc_rd,
+                offset);
+            bundle->addInstruction(new VanadisLoadInstruction(
+                ins_address, hw_thr, options, 2, offset, rvc_rd, 8, false, MEM_TRANSACTION_NONE,
+                LOAD_FP_REGISTER));
+            decode_fault = false;
 
-                    uint16_t rvc_rd = static_cast<uint16_t>((ins & 0xF80) >> 7);
+        } break;
+        case 0x4000:
+        {
+            // LWSP
+            uint32_t imm_76 = (ins & 0xC) << 4;
+            uint32_t imm_42 = (ins & 0x70) >> 2;
+            uint32_t imm_5  = (ins & 0x1000) >> 7;
 
-                    output->verbose(
-                        CALL_INFO, 16, 0, "--------> RVC FLDSP %" PRIu16 " <- memory[sp (r2) + %" PRIu32 "]\n", rvc_rd,
-                        offset);
-                    bundle->addInstruction(new VanadisLoadInstruction(
-                        ins_address, hw_thr, options, 2, offset, rvc_rd, 8, false, MEM_TRANSACTION_NONE,
-                        LOAD_FP_REGISTER));
-                    decode_fault = false;
+            uint32_t offset = imm_5 | imm_42 | imm_76;
 
-                } break;
-                case 0x4000:
-                {
-                    // LWSP
-                    uint32_t imm_76 = (ins & 0xC) << 4;
-                    uint32_t imm_42 = (ins & 0x70) >> 2;
-                    uint32_t imm_5  = (ins & 0x1000) >> 7;
+            uint16_t rvc_rd = static_cast<uint16_t>((ins & 0xF80) >> 7);
 
-                    uint32_t offset = imm_5 | imm_42 | imm_76;
+            output->verbose(
+                CALL_INFO, 16, 0, "--------> RVC LWSP %" PRIu16 " <- memory[sp (r2) + %" PRIu32 "]\n", rvc_rd,
+                offset);
+
+            bundle->addInstruction(new VanadisLoadInstruction(
+                ins_address, hw_thr, options, 2, offset, rvc_rd, 4, true, MEM_TRANSACTION_NONE,
+                LOAD_INT_REGISTER));
+            decode_fault = false;
+
+        } break;
+        case 0x6000:
+        {
+            // FLWSP
+            uint16_t rvc_rd = (ins & 0xF80) >> 7;
+
+            if ( 0 == rvc_rd ) {
+                // FLWSP
+                output->verbose(CALL_INFO, 16, 0, "-----> RVC FLWSP STOP\n");
+            }
+            else {
+                // LDSP
+                uint32_t offset_86 = (ins & 0x1C) << 4;
+                uint32_t offset_43 = (ins & 0x60) >> 2;
+                uint32_t offset_5  = (ins & 0x1000) >> 7;
 
-                    uint16_t rvc_rd = static_cast<uint16_t>((ins & 0xF80) >> 7);
+                int64_t offset = offset_43 | offset_5 | offset_86;
 
-                    output->verbose(
-                        CALL_INFO, 16, 0, "--------> RVC LWSP %" PRIu16 " <- memory[sp (r2) + %" PRIu32 "]\n", rvc_rd,
-                        offset);
+                output->verbose(
+                    CALL_INFO, 16, 0, "-----> RVC LDSP rd=%" PRIu16 " <- %d + %" PRId64 "\n", rvc_rd,
+                    2, offset);
 
-                    bundle->addInstruction(new VanadisLoadInstruction(
-                        ins_address, hw_thr, options, 2, offset, rvc_rd, 4, true, MEM_TRANSACTION_NONE,
-                        LOAD_INT_REGISTER));
-                    decode_fault = false;
+                bundle->addInstruction(new VanadisLoadInstruction(
+                    ins_address, hw_thr, options, 2, offset, rvc_rd, 8, true, MEM_TRANSACTION_NONE,
+                    LOAD_INT_REGISTER));
+                decode_fault = false;
+            }
+        } break;
+        case 0x8000:
+        {
+            // Jumps
+            const uint32_t c_func_12     = ins & 0x1000;
+            const uint32_t c_func_12_rs2 = (ins & 0x7C) >> 2;
+            const uint32_t c_func_12_rs1 = (ins & 0xF80) >> 7;
 
-                } break;
-                case 0x6000:
-                {
-                    // FLWSP
-                    uint16_t rvc_rd = (ins & 0xF80) >> 7;
+            output->verbose(
+                CALL_INFO, 16, 0, "------> RVC 12b: %" PRIu32 " / rs1=%" PRIu32 " / rs2=%" PRIu32 "\n",
+                c_func_12, c_func_12_rs1, c_func_12_rs2);
 
-                    if ( 0 == rvc_rd ) {
-                        // FLWSP
-                        output->verbose(CALL_INFO, 16, 0, "-----> RVC FLWSP STOP\n");
+            if ( c_func_12 == 0 ) {
+                if ( c_func_12_rs2 == 0 ) {
+                    // JR unless rs1 = 0
+                    output->verbose(
+                        CALL_INFO, 16, 0, "--------> (generates) RVC JR %" PRIu32 "\n", c_func_12_rs1);
+                    bundle->addInstruction(new VanadisJumpRegInstruction(
+                        ins_address, hw_thr, options, 2, c_func_12_rs1, VANADIS_NO_DELAY_SLOT));
+                    decode_fault = false;
+                }
+                else {
+                    if ( c_func_12_rs1 == 0 ) {
+                        // HINT (turns into a NOP?)
                     }
                     else {
-                        // LDSP
-                        uint32_t offset_86 = (ins & 0x1C) << 4;
-                        uint32_t offset_43 = (ins & 0x60) >> 2;
-                        uint32_t offset_5  = (ins & 0x1000) >> 7;
-
-                        int64_t offset = offset_43 | offset_5 | offset_86;
-
                         output->verbose(
-                            CALL_INFO, 16, 0, "-----> RVC LDSP rd=%" PRIu16 " <- %d + %" PRId64 "\n", rvc_rd,
-                            2, offset);
+                            CALL_INFO, 16, 0, "--------> (generates) RVC MV %" PRIu32 " <- %" PRIu32 "\n",
+                            c_func_12_rs1, c_func_12_rs2);
 
-                        bundle->addInstruction(new VanadisLoadInstruction(
-                            ins_address, hw_thr, options, 2, offset, rvc_rd, 8, true, MEM_TRANSACTION_NONE,
-                            LOAD_INT_REGISTER));
+                        bundle->addInstruction(
+                            new VanadisAddInstruction<int64_t>(
+                                ins_address, hw_thr, options, static_cast<uint16_t>(c_func_12_rs1),
+                                static_cast<uint16_t>(c_func_12_rs2), options->getRegisterIgnoreWrites()));
                         decode_fault = false;
                     }
-                } break;
-                case 0x8000:
-                {
-                    // Jumps
-                    const uint32_t c_func_12     = ins & 0x1000;
-                    const uint32_t c_func_12_rs2 = (ins & 0x7C) >> 2;
-                    const uint32_t c_func_12_rs1 = (ins & 0xF80) >> 7;
-
-                    output->verbose(
-                        CALL_INFO, 16, 0, "------> RVC 12b: %" PRIu32 " / rs1=%" PRIu32 " / rs2=%" PRIu32 "\n",
-                        c_func_12, c_func_12_rs1, c_func_12_rs2);
-
-                    if ( c_func_12 == 0 ) {
-                        if ( c_func_12_rs2 == 0 ) {
-                            // JR unless rs1 = 0
-                            output->verbose(
-                                CALL_INFO, 16, 0, "--------> (generates) RVC JR %" PRIu32 "\n", c_func_12_rs1);
-                            bundle->addInstruction(new VanadisJumpRegInstruction(
-                                ins_address, hw_thr, options, 2, c_func_12_rs1, VANADIS_NO_DELAY_SLOT));
-                            decode_fault = false;
-                        }
-                        else {
-                            if ( c_func_12_rs1 == 0 ) {
-                                // HINT (turns into a NOP?)
-                            }
-                            else {
-                                output->verbose(
-                                    CALL_INFO, 16, 0, "--------> (generates) RVC MV %" PRIu32 " <- %" PRIu32 "\n",
-                                    c_func_12_rs1, c_func_12_rs2);
-
-                                bundle->addInstruction(
-                                    new VanadisAddInstruction<int64_t>(
-                                        ins_address, hw_thr, options, static_cast<uint16_t>(c_func_12_rs1),
-                                        static_cast<uint16_t>(c_func_12_rs2), options->getRegisterIgnoreWrites()));
-                                decode_fault = false;
-                            }
-                        }
+                }
+            }
+            else {
+                if ( c_func_12_rs2 == 0 ) {
+                    if ( c_func_12_rs1 != 0 ) {
+                        // RVC JALR
+                        output->verbose(
+                            CALL_INFO, 16, 0,
+                            "--------> (generates) RVC JALR link-reg: 1 / jump-to: %" PRIu16 "\n",
+                            static_cast<uint16_t>(c_func_12_rs1));
+                        bundle->addInstruction(new VanadisJumpRegLinkInstruction(
+                            ins_address, hw_thr, options, 2, 1, c_func_12_rs1, 0, VANADIS_NO_DELAY_SLOT));
+                        decode_fault = false;
                     }
                     else {
-                        if ( c_func_12_rs2 == 0 ) {
-                            if ( c_func_12_rs1 != 0 ) {
-                                // RVC JALR
-                                output->verbose(
-                                    CALL_INFO, 16, 0,
-                                    "--------> (generates) RVC JALR link-reg: 1 / jump-to: %" PRIu16 "\n",
-                                    static_cast<uint16_t>(c_func_12_rs1));
-                                bundle->addInstruction(new VanadisJumpRegLinkInstruction(
-                                    ins_address, hw_thr, options, 2, 1, c_func_12_rs1, 0, VANADIS_NO_DELAY_SLOT));
-                                decode_fault = false;
-                            }
-                            else {
-                                // RVC EBREAK - fault?
-                                output->verbose(
-                                    CALL_INFO, 16, 0,
-                                    "--------> (generates) RVC EBREAK -> pipeline fault if executed\n");
-                                bundle->addInstruction(new VanadisInstructionFault(
-                                    ins_address, hw_thr, options, "EBREAK executed, pipeline halt/stop.\n"));
-                                decode_fault = false;
-                            }
-                        }
-                        else {
-                            if ( c_func_12_rs1 == 0 ) {
-                                // RVC ADD HINT - fault?
-                                output->verbose(CALL_INFO, 16, 0, "--------> (generates) RVC ADD HINT\n");
-                                bundle->addInstruction(
-                                    new VanadisAddInstruction<int64_t>(
-                                        ins_address, hw_thr, options, 0, 0, 0));
-                                decode_fault = false;
-                            }
-                            else {
-                                // ADD
-                                output->verbose(
-                                    CALL_INFO, 16, 0,
-                                    "--------> (generates) RVC ADD %" PRIu32 " <- %" PRIu32 " + %" PRIu32 "\n",
-                                    c_func_12_rs1, c_func_12_rs1, c_func_12_rs2);
-
-                                bundle->addInstruction(
-                                    new VanadisAddInstruction<int64_t>(
-                                        ins_address, hw_thr, options, static_cast<uint16_t>(c_func_12_rs1),
-                                        static_cast<uint16_t>(c_func_12_rs1), static_cast<uint16_t>(c_func_12_rs2)));
-                                decode_fault = false;
-                            }
-                        }
+                        // RVC EBREAK - fault?
+                        output->verbose(
+                            CALL_INFO, 16, 0,
+                            "--------> (generates) RVC EBREAK -> pipeline fault if executed\n");
+                        bundle->addInstruction(new VanadisInstructionFault(
+                            ins_address, hw_thr, options, "EBREAK executed, pipeline halt/stop.\n"));
+                        decode_fault = false;
                     }
-                } break;
-                case 0xA000:
-                {
-                    // FSDSP
-                    uint16_t rvc_src = (ins & 0x7C) >> 2;
-
-                    uint32_t offset_53 = (ins & 0x1C00) >> 7;
-                    uint32_t offset_86 = (ins & 0x380) >> 1;
-
-                    uint32_t offset = offset_86 | offset_53;
-
-                    output->verbose(
-                        CALL_INFO, 16, 0, "-----> RVC FSDSP %" PRIu16 " -> memory[ sp + %" PRIu32 " ]\n", rvc_src,
-                        offset);
-                    bundle->addInstruction(new VanadisStoreInstruction(
-                        ins_address, hw_thr, options, 2, offset, rvc_src, 8, MEM_TRANSACTION_NONE, STORE_FP_REGISTER));
-                    decode_fault = false;
-                } break;
-                case 0xC000:
-                {
-                    // SWSP
-                    uint16_t rvc_src = (ins & 0x7C) >> 2;
+                }
+                else {
+                    if ( c_func_12_rs1 == 0 ) {
+                        // RVC ADD HINT - fault?
+                        output->verbose(CALL_INFO, 16, 0, "--------> (generates) RVC ADD HINT\n");
+                        bundle->addInstruction(
+                            new VanadisAddInstruction<int64_t>(
+                                ins_address, hw_thr, options, 0, 0, 0));
+                        decode_fault = false;
+                    }
+                    else {
+                        // ADD
+                        output->verbose(
+                            CALL_INFO, 16, 0,
+                            "--------> (generates) RVC ADD %" PRIu32 " <- %" PRIu32 " + %" PRIu32 "\n",
+                            c_func_12_rs1, c_func_12_rs1, c_func_12_rs2);
 
-                    uint32_t offset_52 = (ins & 0x1E00) >> 7;
-                    uint32_t offset_76 = (ins & 0x180) >> 1;
+                        bundle->addInstruction(
+                            new VanadisAddInstruction<int64_t>(
+                                ins_address, hw_thr, options, static_cast<uint16_t>(c_func_12_rs1),
+                                static_cast<uint16_t>(c_func_12_rs1), static_cast<uint16_t>(c_func_12_rs2)));
+                        decode_fault = false;
+                    }
+                }
+            }
+        } break;
+        case 0xA000:
+        {
+            // FSDSP
+            uint16_t rvc_src = (ins & 0x7C) >> 2;
 
-                    uint32_t offset = offset_76 | offset_52;
+            uint32_t offset_53 = (ins & 0x1C00) >> 7;
+            uint32_t offset_86 = (ins & 0x380) >> 1;
 
-                    output->verbose(
-                        CALL_INFO, 16, 0, "-----> RVC SWSP %" PRIu16 " -> %" PRIu16 " + %" PRIu32 "\n", rvc_src, (uint16_t)2,
-                        offset);
+            uint32_t offset = offset_86 | offset_53;
 
-                    bundle->addInstruction(new VanadisStoreInstruction(
-                        ins_address, hw_thr, options, 2, offset, rvc_src, 4, MEM_TRANSACTION_NONE, STORE_INT_REGISTER));
-                    decode_fault = false;
-                } break;
-                case 0xE000:
-                {
-                    // SDSP
-                    uint16_t rvc_src = (ins & 0x7C) >> 2;
-                    ;
+            output->verbose(
+                CALL_INFO, 16, 0, "-----> RVC FSDSP %" PRIu16 " -> memory[ sp + %" PRIu32 " ]\n", rvc_src,
+                offset);
+            bundle->addInstruction(new VanadisStoreInstruction(
+                ins_address, hw_thr, options, 2, offset, rvc_src, 8, MEM_TRANSACTION_NONE, STORE_FP_REGISTER));
+            decode_fault = false;
+        } break;
+        case 0xC000:
+        {
+            // SWSP
+            uint16_t rvc_src = (ins & 0x7C) >> 2;
+
+            uint32_t offset_52 = (ins & 0x1E00) >> 7;
+            uint32_t offset_76 = (ins & 0x180) >> 1;
+
+            uint32_t offset = offset_76 | offset_52;
 
-                    uint32_t offset_53 = (ins & 0x1C00) >> 7;
-                    uint32_t offset_86 = (ins & 0x380) >> 1;
+            output->verbose(
+                CALL_INFO, 16, 0, "-----> RVC SWSP %" PRIu16 " -> %" PRIu16 " + %" PRIu32 "\n", rvc_src, (uint16_t)2,
+                offset);
 
-                    uint32_t offset = offset_86 | offset_53;
+            bundle->addInstruction(new VanadisStoreInstruction(
+                ins_address, hw_thr, options, 2, offset, rvc_src, 4, MEM_TRANSACTION_NONE, STORE_INT_REGISTER));
+            decode_fault = false;
+        } break;
+        case 0xE000:
+        {
+            // SDSP
+            uint16_t rvc_src = (ins & 0x7C) >> 2;
+            ;
 
-                    output->verbose(
-                        CALL_INFO, 16, 0, "-----> RVC SDSP %" PRIu16 " -> %" PRIu16 " + %" PRIu32 "\n", rvc_src, (uint16_t)2,
-                        offset);
+            uint32_t offset_53 = (ins & 0x1C00) >> 7;
+            uint32_t offset_86 = (ins & 0x380) >> 1;
 
-                    bundle->addInstruction(new VanadisStoreInstruction(
-                        ins_address, hw_thr, options, 2, offset, rvc_src, 8, MEM_TRANSACTION_NONE, STORE_INT_REGISTER));
-                    decode_fault = false;
-                } break;
-                }
-            } break;
-            }
+            uint32_t offset = offset_86 | offset_53;
 
             output->verbose(
-                CALL_INFO, 16, 0, "[decode] -> 16bit RVC format / ins-op-code-family: %" PRIu32 " / 0x%x\n", op_code,
-                op_code);
-            //            if ( decode_fault ) { output->fatal(CALL_INFO, -1, "STOP\n"); }
-        }
-
+                CALL_INFO, 16, 0, "-----> RVC SDSP %" PRIu16 " -> %" PRIu16 " + %" PRIu32 "\n", rvc_src, (uint16_t)2,
+                offset);
 
-        if ( decode_fault ) {
-            if ( fatal_decode_fault ) {
-                output->fatal(
-                    CALL_INFO, -1,
-                    "[decode] -> decode fault detected at 0x%" PRI_ADDR " / thr: %" PRIu32 ", set to fatal on detect\n",
-                    ins_address, hw_thr);
-            }
-            bundle->addInstruction(new VanadisInstructionDecodeFault(ins_address, hw_thr, options));
+            bundle->addInstruction(new VanadisStoreInstruction(
+                ins_address, hw_thr, options, 2, offset, rvc_src, 8, MEM_TRANSACTION_NONE, STORE_INT_REGISTER));
+            decode_fault = false;
+        } break;
         }
     }
 
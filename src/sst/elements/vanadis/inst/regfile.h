@@ -82,22 +82,14 @@ public:
         assert(reg < count_fp_regs);
         assert((offset + len) <= fp_reg_width);
 
-        uint8_t* reg_ptr = (uint8_t*) &fp_reg_storage[reg * fp_reg_width];
-
-        for(auto i = 0; i < len; ++i) {
-            values[i] = reg_ptr[offset + i];
-        }
+        std::memcpy(values, &fp_reg_storage[(reg * fp_reg_width) + offset], len);
     }
 
     void copyFromIntRegister(uint16_t reg, uint32_t offset, uint8_t* values, uint32_t len) {
         assert(reg < count_int_regs);
         assert((offset + len) <= int_reg_width);
 
-        uint8_t* reg_ptr = (uint8_t*) &int_reg_storage[reg * int_reg_width];
-
-        for(auto i = 0; i < len; ++i) {
-            values[i] = reg_ptr[offset + i];
-        }
+        std::memcpy(values, &int_reg_storage[(reg * int_reg_width) + offset], len);
     }
 
     void copyToRegister(uint16_t reg, uint32_t offset, uint8_t* values, uint32_t len, bool is_fp) {
@@ -112,20 +104,14 @@ public:
         assert((offset + len) <= int_reg_width);
         assert(reg < count_int_regs);
 
-        uint8_t* reg_ptr = (uint8_t*) &int_reg_storage[reg * int_reg_width];
-        for(auto i = 0; i < len; ++i) {
-            reg_ptr[offset + i] = values[i];
-        }
+        std::memcpy(&int_reg_storage[(reg * int_reg_width) + offset], values, len);
     }
 
     void copyToFPRegister(uint16_t reg, uint32_t offset, uint8_t* values, uint32_t len) {
         assert((offset + len) <= fp_reg_width);
         assert(reg < count_fp_regs);
 
-        uint8_t* reg_ptr = (uint8_t*) &fp_reg_storage[reg * fp_reg_width];
-        for(auto i = 0; i < len; ++i) {
-            reg_ptr[offset + i] = values[i];
-        }
+        std::memcpy(&fp_reg_storage[(reg * fp_reg_width) + offset], values, len);
     }
 
     template <typename T>
@@ -134,14 +120,16 @@ public:
         assert(reg < count_int_regs);
         assert(sizeof(T) <= int_reg_width);
 
+        T value = T();
+
+        // memcpy rather than a cast so a narrower or differently typed read
+        // of the register bytes is well defined, compilers lower this to a
+        // single load
         if ( reg != decoder_opts->getRegisterIgnoreWrites() ) {
-            char* reg_start   = &int_reg_storage[reg * int_reg_width];
-            T*    reg_start_T = (T*)reg_start;
-            return *(reg_start_T);
-        }
-        else {
-            return T();
+            std::memcpy(&value, &int_reg_storage[reg * int_reg_width], sizeof(T));
         }
+
+        return value;
     }
 
     template <typename T>
@@ -150,9 +138,9 @@ public:
         assert(reg < count_fp_regs);
         assert(sizeof(T) <= fp_reg_width);
 
-        char* reg_start   = &fp_reg_storage[reg * fp_reg_width];
-        T*    reg_start_T = (T*)reg_start;
-        return *(reg_start_T);
+        T value;
+        std::memcpy(&value, &fp_reg_storage[reg * fp_reg_width], sizeof(T));
+        return value;
     }
 
     template <typename T>
@@ -161,10 +149,9 @@ public:
         assert(reg < count_int_regs);
 
         if ( LIKELY(reg != decoder_opts->getRegisterIgnoreWrites()) ) {
-            T*    reg_ptr_t = (T*)(&int_reg_storage[int_reg_width * reg]);
-            char* reg_ptr_c = (char*)(reg_ptr_t);
+            char* reg_ptr_c = &int_reg_storage[int_reg_width * reg];
 
-            reg_ptr_t[0] = val;
+            std::memcpy(reg_ptr_c, &val, sizeof(T));
 
             // if we need to sign extend, check if the most-significant bit is a 1, if yes then
             // fill with 0xFF, otherwise fill with 0x00
@@ -181,16 +168,12 @@ public:
         assert(reg < count_fp_regs);
         assert(sizeof(T) <= fp_reg_width);
 
-        uint8_t* val_ptr = (uint8_t*) &val;
+        char* reg_ptr_c = &fp_reg_storage[fp_reg_width * reg];
 
-        for(auto i = 0; i < sizeof(T); ++i) {
-            fp_reg_storage[fp_reg_width * reg + i] = val_ptr[i];
-        }
+        std::memcpy(reg_ptr_c, &val, sizeof(T));
 
         // Pad with extra zeros if needed
-        for(auto i = sizeof(T); i < fp_reg_width; ++i) {
-            fp_reg_storage[fp_reg_width * reg + i] = 0;
-        }
+        std::memset(&reg_ptr_c[sizeof(T)], 0, fp_reg_width - sizeof(T));
     }
 
     uint32_t getHWThread() const { return hw_thread; }
@@ -238,7 +221,9 @@ private:
         val_string[64]   = '\0';
         int index        = 0;
 
-        const long long int v = ((long long int*)ptr)[0];
+        // FP32 registers are only 4 bytes wide, do not read past the last one
+        long long int v = 0;
+        std::memcpy(&v, ptr, isInt ? int_reg_width : fp_reg_width);
 
         for( auto i = 0; i < 64; ++i) {
             val_string[i] = '0';
@@ -20,10 +20,16 @@
 #include "inst/regfile.h"
 #include "inst/regstack.h"
 #include "inst/vinsttype.h"
+#include "inst/vinstarena.h"
 #include "inst/vregfmt.h"
 
+#include <algorithm>
 #include <cstring>
 #include <sst/core/output.h>
+#include <vector>
+
+// Register slots held inside the instruction before the arrays move to the heap
+#define VANADIS_INST_INLINE_REG_SLOTS 12
 
 namespace SST {
 namespace Vanadis {
@@ -48,49 +54,18 @@ public:
         count_isa_fp_reg_in(c_isa_fp_reg_in),
         count_isa_fp_reg_out(c_isa_fp_reg_out)
     {
-        phys_int_regs_in = (count_phys_int_reg_in > 0) ? new uint16_t[count_phys_int_reg_in] : nullptr;
-        std::memset(phys_int_regs_in, 0, count_phys_int_reg_in * sizeof( uint16_t ));
-
-        phys_int_regs_out = (count_phys_int_reg_out > 0) ? new uint16_t[count_phys_int_reg_out] : nullptr;
-        std::memset(phys_int_regs_out, 0, count_phys_int_reg_out * sizeof( uint16_t ) );
-  
-        isa_int_regs_in = (count_isa_int_reg_in > 0) ? new uint16_t[count_isa_int_reg_in] : nullptr;
-        std::memset(isa_int_regs_in, 0, count_isa_int_reg_in * sizeof( uint16_t ));
- 
-        isa_int_regs_out = (count_isa_int_reg_out > 0) ? new uint16_t[count_isa_int_reg_out] : nullptr;
-        std::memset(isa_int_regs_out, 0, count_isa_int_reg_out * sizeof( uint16_t ) );
-
-        phys_fp_regs_in = (count_phys_fp_reg_in > 0) ? new uint16_t[count_phys_fp_reg_in] : nullptr;
-        std::memset(phys_fp_regs_in, 0, count_phys_fp_reg_in * sizeof( uint16_t ));
-
-        phys_fp_regs_out = (count_phys_fp_reg_out > 0) ? new uint16_t[count_phys_fp_reg_out] : nullptr;
-        std::memset(phys_fp_regs_out, 0, count_phys_fp_reg_out * sizeof( uint16_t ));
-
-        isa_fp_regs_in = (count_isa_fp_reg_in > 0) ? new uint16_t[count_isa_fp_reg_in] : nullptr;
-        std::memset(isa_fp_regs_in, 0, count_isa_fp_reg_in * sizeof( uint16_t ) );
-
-        isa_fp_regs_out = (count_isa_fp_reg_out > 0) ? new uint16_t[count_isa_fp_reg_out] : nullptr;
-        std::memset(isa_fp_regs_out, 0, count_isa_fp_reg_out * sizeof( uint16_t ));
-  
+        allocateRegisters();
+
         trapError             = false;
         hasExecuted           = false;
         hasIssued             = false;
         enduOpGroup           = false;
         isFrontOfROB          = false;
         hasROBSlot            = false;
+        issueCycle            = 0;
     }
 
-    virtual ~VanadisInstruction()
-    {
-        if ( phys_int_regs_in != nullptr ) delete[] phys_int_regs_in;
-        if ( phys_int_regs_out != nullptr ) delete[] phys_int_regs_out;
-        if ( isa_int_regs_in != nullptr ) delete[] isa_int_regs_in;
-        if ( isa_int_regs_out != nullptr ) delete[] isa_int_regs_out;
-        if ( phys_fp_regs_in != nullptr ) delete[] phys_fp_regs_in;
-        if ( phys_fp_regs_out != nullptr ) delete[] phys_fp_regs_out;
-        if ( isa_fp_regs_in != nullptr ) delete[] isa_fp_regs_in;
-        if ( isa_fp_regs_out != nullptr ) delete[] isa_fp_regs_out;
-    }
+    virtual ~VanadisInstruction() { releaseRegisters(); }
 
     VanadisInstruction(const VanadisInstruction& copy_me) :
         ins_address(copy_me.ins_address),
@@ -111,52 +86,17 @@ public:
         enduOpGroup           = copy_me.enduOpGroup;
         isFrontOfROB          = false;
         hasROBSlot            = false;
+        issueCycle            = 0;
 
-        phys_int_regs_in  = (count_phys_int_reg_in > 0) ? new uint16_t[count_phys_int_reg_in] : nullptr;
-        phys_int_regs_out = (count_phys_int_reg_out > 0) ? new uint16_t[count_phys_int_reg_out] : nullptr;
-
-        isa_int_regs_in  = (count_isa_int_reg_in > 0) ? new uint16_t[count_isa_int_reg_in] : nullptr;
-        isa_int_regs_out = (count_isa_int_reg_out > 0) ? new uint16_t[count_isa_int_reg_out] : nullptr;
-
-        phys_fp_regs_in  = (count_phys_fp_reg_in > 0) ? new uint16_t[count_phys_fp_reg_in] : nullptr;
-        phys_fp_regs_out = (count_phys_fp_reg_out > 0) ? new uint16_t[count_phys_fp_reg_out] : nullptr;
-
-        isa_fp_regs_in  = (count_isa_fp_reg_in > 0) ? new uint16_t[count_isa_fp_reg_in] : nullptr;
-        isa_fp_regs_out = (count_isa_fp_reg_out > 0) ? new uint16_t[count_isa_fp_reg_out] : nullptr;
-
-        for ( uint16_t i = 0; i < count_phys_int_reg_in; ++i ) {
-            phys_int_regs_in[i] = copy_me.phys_int_regs_in[i];
-        }
-
-        for ( uint16_t i = 0; i < count_phys_int_reg_out; ++i ) {
-            phys_int_regs_out[i] = copy_me.phys_int_regs_out[i];
-        }
-
-        for ( uint16_t i = 0; i < count_isa_int_reg_in; ++i ) {
-            isa_int_regs_in[i] = copy_me.isa_int_regs_in[i];
-        }
-
-        for ( uint16_t i = 0; i < count_isa_int_reg_out; ++i ) {
-            isa_int_regs_out[i] = copy_me.isa_int_regs_out[i];
-        }
-
-        for ( uint16_t i = 0; i < count_phys_fp_reg_in; ++i ) {
-            phys_fp_regs_in[i] = copy_me.phys_fp_regs_in[i];
-        }
-
-        for ( uint16_t i = 0; i < count_phys_fp_reg_out; ++i ) {
-            phys_fp_regs_out[i] = copy_me.phys_fp_regs_out[i];
-        }
-
-        for ( uint16_t i = 0; i < count_isa_fp_reg_in; ++i ) {
-            isa_fp_regs_in[i] = copy_me.isa_fp_regs_in[i];
-        }
-
-        for ( uint16_t i = 0; i < count_isa_fp_reg_out; ++i ) {
-            isa_fp_regs_out[i] = copy_me.isa_fp_regs_out[i];
-        }
+        allocateRegisters();
+        std::memcpy(reg_storage, copy_me.reg_storage, countRegisterSlots() * sizeof(uint16_t));
     }
 
+    // Pooled allocation, instructions are created and destroyed for every
+    // decoded micro-op so reuse their memory rather than going to the heap
+    static void* operator new(const size_t size) { return VanadisInstructionArena::allocate(size); }
+    static void  operator delete(void* ptr) { VanadisInstructionArena::release(ptr); }
+
     void writeIntRegs(char* buffer, size_t max_buff_size)
     {
         size_t index_so_far = 0;
@@ -323,6 +263,10 @@ public:
     void markExecuted() { hasExecuted = true; }
     void markIssued() { hasIssued = true; }
 
+    // cycle the core issued the instruction, kept for the pipeline trace
+    uint64_t getIssueCycle() const { return issueCycle; }
+    void setIssueCycle(const uint64_t cycle) { issueCycle = cycle; }
+
     bool checkFrontOfROB() const { return isFrontOfROB; }
     void markFrontOfROB() { isFrontOfROB = true; }
 
@@ -349,6 +293,82 @@ public:
     }
 
 protected:
+    uint32_t countRegisterSlots() const
+    {
+        return (uint32_t)count_phys_int_reg_in + count_phys_int_reg_out + count_isa_int_reg_in +
+               count_isa_int_reg_out + count_phys_fp_reg_in + count_phys_fp_reg_out + count_isa_fp_reg_in +
+               count_isa_fp_reg_out;
+    }
+
+    // All eight register arrays are carved out of one block, which is held
+    // inline when the instruction uses only a few registers
+    void allocateRegisters()
+    {
+        const uint32_t slots = countRegisterSlots();
+        reg_storage          = (slots <= VANADIS_INST_INLINE_REG_SLOTS) ? inline_regs : new uint16_t[slots];
+        std::memset(reg_storage, 0, slots * sizeof(uint16_t));
+
+        uint16_t* next_slot = reg_storage;
+        auto      carve     = [&next_slot](const uint16_t count) {
+            uint16_t* regs = (count > 0) ? next_slot : nullptr;
+            next_slot += count;
+            return regs;
+        };
+
+        phys_int_regs_in  = carve(count_phys_int_reg_in);
+        phys_int_regs_out = carve(count_phys_int_reg_out);
+        isa_int_regs_in   = carve(count_isa_int_reg_in);
+        isa_int_regs_out  = carve(count_isa_int_reg_out);
+        phys_fp_regs_in   = carve(count_phys_fp_reg_in);
+        phys_fp_regs_out  = carve(count_phys_fp_reg_out);
+        isa_fp_regs_in    = carve(count_isa_fp_reg_in);
+        isa_fp_regs_out   = carve(count_isa_fp_reg_out);
+    }
+
+    void releaseRegisters()
+    {
+        if ( reg_storage != inline_regs ) { delete[] reg_storage; }
+        reg_storage = nullptr;
+    }
+
+    // Change the integer register counts after construction, registers which
+    // are already set keep their values
+    void resizeIntRegisters(
+        const uint16_t c_phys_int_reg_in, const uint16_t c_phys_int_reg_out, const uint16_t c_isa_int_reg_in,
+        const uint16_t c_isa_int_reg_out)
+    {
+        std::vector<uint16_t> old_regs[8];
+        uint16_t*             old_arrays[8] = { phys_int_regs_in, phys_int_regs_out, isa_int_regs_in,
+                                                isa_int_regs_out, phys_fp_regs_in,  phys_fp_regs_out,
+                                                isa_fp_regs_in,   isa_fp_regs_out };
+        const uint16_t        old_counts[8] = { count_phys_int_reg_in, count_phys_int_reg_out, count_isa_int_reg_in,
+                                                count_isa_int_reg_out, count_phys_fp_reg_in,  count_phys_fp_reg_out,
+                                                count_isa_fp_reg_in,   count_isa_fp_reg_out };
+
+        for ( int i = 0; i < 8; ++i ) {
+            old_regs[i].assign(old_arrays[i], old_arrays[i] + old_counts[i]);
+        }
+
+        releaseRegisters();
+
+        count_phys_int_reg_in  = c_phys_int_reg_in;
+        count_phys_int_reg_out = c_phys_int_reg_out;
+        count_isa_int_reg_in   = c_isa_int_reg_in;
+        count_isa_int_reg_out  = c_isa_int_reg_out;
+
+        allocateRegisters();
+
+        uint16_t*      new_arrays[8] = { phys_int_regs_in, phys_int_regs_out, isa_int_regs_in, isa_int_regs_out,
+                                         phys_fp_regs_in,  phys_fp_regs_out,  isa_fp_regs_in,  isa_fp_regs_out };
+        const uint16_t new_counts[8] = { count_phys_int_reg_in, count_phys_int_reg_out, count_isa_int_reg_in,
+                                         count_isa_int_reg_out, count_phys_fp_reg_in,  count_phys_fp_reg_out,
+                                         count_isa_fp_reg_in,   count_isa_fp_reg_out };
+
+        for ( int i = 0; i < 8; ++i ) {
+            std::copy_n(old_regs[i].begin(), std::min<size_t>(old_regs[i].size(), new_counts[i]), new_arrays[i]);
+        }
+    }
+
     const uint64_t ins_address;
     const uint32_t hw_thread;
 
@@ -372,6 +392,9 @@ protected:
     uint16_t* phys_fp_regs_in;
     uint16_t* phys_fp_regs_out;
 
+    uint16_t* reg_storage;
+    uint16_t  inline_regs[VANADIS_INST_INLINE_REG_SLOTS];
+
     bool trapError;
     bool hasExecuted;
     bool hasIssued;
@@ -379,6 +402,8 @@ protected:
     bool isFrontOfROB;
     bool hasROBSlot;
 
+    uint64_t issueCycle;
+
     const VanadisDecoderOptions* isa_options;
 };
 
@@ -0,0 +1,267 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_VANADIS_INST_ARENA
+#define _H_VANADIS_INST_ARENA
+
+#include <cassert>
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+namespace SST {
+namespace Vanadis {
+
+class VanadisInstructionRing;
+
+/*
+ * Header in front of every instruction allocation, records where the block
+ * came from so operator delete can hand it back without any lookup
+ */
+struct alignas(16) VanadisInstructionBlockHeader
+{
+    VanadisInstructionRing* ring;
+    uint32_t                bytes;
+    uint32_t                released;
+};
+
+/*
+ * Ring arena for the instructions of one hardware thread. Micro-ops enter
+ * the ROB in program order and leave it from the head at retire, or all at
+ * once on a pipeline clear, so their storage can be carved from a ring:
+ * allocation bumps the tail and releasing the oldest block advances the
+ * head. Blocks released out of order (the MIPS delay slot retires with its
+ * branch) are marked and reclaimed when the head reaches them. When the ring
+ * is full allocations fall back to the size-class arena.
+ */
+class VanadisInstructionRing
+{
+public:
+    VanadisInstructionRing(const size_t ring_bytes)
+    {
+        capacity = (ring_bytes + sizeof(VanadisInstructionBlockHeader) - 1) & ~(sizeof(VanadisInstructionBlockHeader) - 1);
+        buffer   = static_cast<uint8_t*>(::operator new(capacity, std::align_val_t(alignof(VanadisInstructionBlockHeader))));
+
+        reset();
+    }
+
+    ~VanadisInstructionRing()
+    {
+        ::operator delete(buffer, std::align_val_t(alignof(VanadisInstructionBlockHeader)));
+    }
+
+    // Returns nullptr if the ring does not have bytes contiguous bytes free
+    VanadisInstructionBlockHeader* allocate(const size_t bytes)
+    {
+        size_t offset = tail;
+
+        if ( !wrapped ) {
+            // live blocks are [head, tail), the space is the end of the buffer
+            // or, after wrapping, the start of the buffer up to the head
+            if ( (tail + bytes) > capacity ) {
+                if ( bytes > head ) { return nullptr; }
+
+                wrapped = true;
+                wrap_at = tail;
+                offset  = 0;
+            }
+        }
+        else {
+            // live blocks are [head, wrap_at) and [0, tail)
+            if ( (tail + bytes) > head ) { return nullptr; }
+        }
+
+        VanadisInstructionBlockHeader* block = reinterpret_cast<VanadisInstructionBlockHeader*>(&buffer[offset]);
+        block->ring     = this;
+        block->bytes    = static_cast<uint32_t>(bytes);
+        block->released = 0;
+
+        tail = offset + bytes;
+        blocks++;
+
+        return block;
+    }
+
+    void release(VanadisInstructionBlockHeader* block)
+    {
+        assert(block->ring == this);
+        block->released = 1;
+
+        while ( blocks > 0 ) {
+            VanadisInstructionBlockHeader* head_block = reinterpret_cast<VanadisInstructionBlockHeader*>(&buffer[head]);
+
+            if ( 0 == head_block->released ) { break; }
+
+            head += head_block->bytes;
+            blocks--;
+
+            if ( wrapped && (head == wrap_at) ) {
+                head    = 0;
+                wrapped = false;
+            }
+        }
+
+        // an empty ring starts again from the beginning of the buffer
+        if ( 0 == blocks ) { reset(); }
+    }
+
+    bool   empty() const { return 0 == blocks; }
+    size_t size() const { return blocks; }
+
+    size_t bytesInUse() const
+    {
+        if ( 0 == blocks ) { return 0; }
+        return wrapped ? ((wrap_at - head) + tail) : (tail - head);
+    }
+
+    size_t bytesCapacity() const { return capacity; }
+
+private:
+    void reset()
+    {
+        head    = 0;
+        tail    = 0;
+        wrap_at = 0;
+        wrapped = false;
+        blocks  = 0;
+    }
+
+    uint8_t* buffer;
+    size_t   capacity;
+    size_t   head;
+    size_t   tail;
+    size_t   wrap_at;
+    bool     wrapped;
+    size_t   blocks;
+};
+
+/*
+ * Allocator for instructions. Every micro-op pushed into the ROB is cloned
+ * from the prototype held in the micro-op cache and deleted at retire or on a
+ * pipeline clear. While a ring is selected (see VanadisInstructionRingScope)
+ * clones are carved from that hardware thread's ring. Everything else, and
+ * clones which do not fit in the ring, come from free lists recycled by size
+ * class. Free-list blocks are kept per SST thread (a core and its
+ * instructions live on one thread) and are never released, so the arena only
+ * grows to the peak number of instructions in flight.
+ */
+class VanadisInstructionArena
+{
+public:
+    static void* allocate(const size_t size)
+    {
+        const size_t bytes = blockBytes(size);
+
+        if ( nullptr != current_ring ) {
+            VanadisInstructionBlockHeader* block = current_ring->allocate(bytes);
+            if ( nullptr != block ) { return block + 1; }
+        }
+
+        VanadisInstructionBlockHeader* block = nullptr;
+        const size_t                   size_class = classOf(bytes);
+
+        if ( size_class >= VANADIS_ARENA_CLASSES ) {
+            block = static_cast<VanadisInstructionBlockHeader*>(::operator new(bytes));
+        }
+        else if ( nullptr != free_lists[size_class] ) {
+            block                  = reinterpret_cast<VanadisInstructionBlockHeader*>(free_lists[size_class]);
+            free_lists[size_class] = free_lists[size_class]->next;
+        }
+        else {
+            block = static_cast<VanadisInstructionBlockHeader*>(::operator new(bytes));
+        }
+
+        block->ring     = nullptr;
+        block->bytes    = static_cast<uint32_t>(bytes);
+        block->released = 0;
+
+        return block + 1;
+    }
+
+    static void release(void* ptr)
+    {
+        if ( nullptr == ptr ) { return; }
+
+        VanadisInstructionBlockHeader* block = static_cast<VanadisInstructionBlockHeader*>(ptr) - 1;
+
+        if ( nullptr != block->ring ) {
+            block->ring->release(block);
+            return;
+        }
+
+        const size_t size_class = classOf(block->bytes);
+
+        if ( size_class >= VANADIS_ARENA_CLASSES ) {
+            ::operator delete(block);
+            return;
+        }
+
+        FreeBlock* free_block  = reinterpret_cast<FreeBlock*>(block);
+        free_block->next       = free_lists[size_class];
+        free_lists[size_class] = free_block;
+    }
+
+    static VanadisInstructionRing* getRing() { return current_ring; }
+    static void setRing(VanadisInstructionRing* ring) { current_ring = ring; }
+
+private:
+    struct FreeBlock
+    {
+        FreeBlock* next;
+    };
+
+    static constexpr size_t VANADIS_ARENA_GRANULE = sizeof(VanadisInstructionBlockHeader);
+    static constexpr size_t VANADIS_ARENA_CLASSES = 64;
+
+    // header plus the object, rounded up to the granule
+    static size_t blockBytes(const size_t size)
+    {
+        return sizeof(VanadisInstructionBlockHeader) + ((size + VANADIS_ARENA_GRANULE - 1) & ~(VANADIS_ARENA_GRANULE - 1));
+    }
+
+    static size_t classOf(const size_t bytes) { return (bytes - 1) / VANADIS_ARENA_GRANULE; }
+
+    // plain pointers so the lists stay usable during thread and program teardown
+    static thread_local FreeBlock*              free_lists[VANADIS_ARENA_CLASSES];
+    static thread_local VanadisInstructionRing* current_ring;
+};
+
+inline thread_local VanadisInstructionArena::FreeBlock*
+    VanadisInstructionArena::free_lists[VanadisInstructionArena::VANADIS_ARENA_CLASSES] = {};
+
+inline thread_local VanadisInstructionRing* VanadisInstructionArena::current_ring = nullptr;
+
+/*
+ * Selects a ring for the instructions allocated while it is in scope, used
+ * by the decoders when cloning micro-ops into the ROB
+ */
+class VanadisInstructionRingScope
+{
+public:
+    VanadisInstructionRingScope(VanadisInstructionRing* ring) : previous(VanadisInstructionArena::getRing())
+    {
+        VanadisInstructionArena::setRing(ring);
+    }
+
+    ~VanadisInstructionRingScope() { VanadisInstructionArena::setRing(previous); }
+
+private:
+    VanadisInstructionRing* previous;
+};
+
+} // namespace Vanadis
+} // namespace SST
+
+#endif
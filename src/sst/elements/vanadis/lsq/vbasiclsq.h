@@ -22,6 +22,7 @@
 
 #include "lsq/vlsq.h"
 #include "lsq/vbasiclsqentry.h"
+#include "lsq/vlsqstoreindex.h"
 #include "util/vsignx.h"
 #include "inst/vstorecond.h"
 
@@ -30,6 +31,7 @@
 #include <cstdint>
 #include <vector>
 #include <queue>
+#include <utility>
 
 using namespace SST::Interfaces;
 
@@ -96,6 +98,12 @@ public:
         stores_pending_index = 0;
         stores_pending_size = 0;
 
+        // a few buckets per store buffer slot keeps collisions rare
+        store_index.resize(hw_threads);
+        for(auto& next_index : store_index) {
+            next_index.resize(max_stores * 8);
+        }
+
         stat_loads_issued = registerStatistic<uint64_t>("loads_issued", "1");
         stat_stores_issued = registerStatistic<uint64_t>("stores_issued", "1");
         stat_fences_issued = registerStatistic<uint64_t>("fences_issued", "1");
@@ -175,6 +183,7 @@ public:
             delete (*store_itr);
             store_itr = stores_pending[thread].erase(store_itr);
         }
+        store_index[thread].clear();
     }
 
     // must be implemented to allow the memory system to initialize itself during
@@ -504,16 +513,14 @@ protected:
                     }
 
                     store_entry->getInstruction()->markExecuted();
-                    lsq->stores_pending[thr].erase(lsq->stores_pending[thr].begin());
-                    lsq->stores_pending_size--;
+                    lsq->popStorePending(thr);
                     delete store_entry;
                     delete ev;
                 } break;
                 case MEM_TRANSACTION_LOCK:
                 {
                     store_entry->getInstruction()->markExecuted();
-                    lsq->stores_pending[thr].erase(lsq->stores_pending[thr].begin());
-                    lsq->stores_pending_size--;
+                    lsq->popStorePending(thr);
                     delete store_entry;
                     delete ev;
                 } break;
@@ -576,8 +583,7 @@ protected:
 
                 // this was a standard store (not LLSC/LOCK) and we issued into system successfully
                 if(LIKELY(issue_result)) {
-                    stores_pending[thr].pop_front();
-                    stores_pending_size--;
+                    popStorePending(thr);
                     delete current_store;
 
                     if(output->getVerboseLevel() >= 16) {
@@ -669,7 +675,7 @@ protected:
                     store_ins->getPhysFPRegIn(0) : store_ins->getPhysIntRegIn(1), store_ins->getRegisterOffset(), &payload[0], store_width_left,
                     store_ins->getValueRegisterType() == STORE_FP_REGISTER);
 
-                store_req = new StandardMem::Write(store_address & address_mask, payload.size(), payload,
+                store_req = new StandardMem::Write(store_address & address_mask, store_width_left, std::move(payload),
                     false, 0, store_address, store_ins->getInstructionAddress(), store_ins->getHWThread());
 
                 std_stores_in_flight.insert(store_req->getID());
@@ -683,7 +689,7 @@ protected:
                     store_width_right,
                     store_ins->getValueRegisterType() == STORE_FP_REGISTER);
 
-                store_req = new StandardMem::Write(store_address_right & address_mask, payload.size(), payload,
+                store_req = new StandardMem::Write(store_address_right & address_mask, store_width_right, std::move(payload),
                     false, 0, store_address_right, store_ins->getInstructionAddress(), store_ins->getHWThread());
                 memInterface->send(store_req);
                 std_stores_in_flight.insert(store_req->getID());
@@ -703,7 +709,7 @@ protected:
                     output->verbose(CALL_INFO, 9, VANADIS_DBG_LSQ_STORE_FLG, "}\n");
                 }
 
-                store_req = new StandardMem::Write(store_address & address_mask, payload.size(), payload,
+                store_req = new StandardMem::Write(store_address & address_mask, store_width, std::move(payload),
                     false, 0, store_address, store_ins->getInstructionAddress(), store_ins->getHWThread());
                 std_stores_in_flight.insert(store_req->getID());
                 memInterface->send(store_req);
@@ -723,7 +729,7 @@ protected:
                 output->verbose(CALL_INFO, 9, VANADIS_DBG_LSQ_STORE_FLG, "---> [memory-transaction]: LLSC-store store-at: 0x%" PRI_ADDR " width: %" PRIu64 "\n",
                     store_address, store_width);
 
-                store_req = new StandardMem::StoreConditional(store_address & address_mask, payload.size(), payload,
+                store_req = new StandardMem::StoreConditional(store_address & address_mask, store_width, std::move(payload),
                             0, store_address, store_ins->getInstructionAddress(), store_ins->getHWThread() );
             }
         } break;
@@ -735,7 +741,7 @@ protected:
                 output->verbose(CALL_INFO, 9, VANADIS_DBG_LSQ_STORE_FLG, "---> [memory-transaction]: LOCK-store store-at: 0x%" PRI_ADDR " width: %" PRIu64 "\n",
                     store_address, store_width);
 
-                store_req = new StandardMem::WriteUnlock(store_address & address_mask, payload.size(), payload,
+                store_req = new StandardMem::WriteUnlock(store_address & address_mask, store_width, std::move(payload),
                             0, store_address, store_ins->getInstructionAddress(), store_ins->getHWThread());
             }
         } break;
@@ -1010,8 +1016,7 @@ protected:
                         store_ins, store_address, store_width, store_ins->getValueRegisterType(),
                         store_ins->getValueRegister());
 
-                    stores_pending[store_ins->getHWThread()].push_back(new_pending_store);
-                    stores_pending_size++;
+                    pushStorePending(store_ins->getHWThread(), new_pending_store);
                 }
 
                 // clear the front entry as we have just processed it
@@ -1105,7 +1110,27 @@ protected:
         return matchID;
     }
 
+    void pushStorePending(const uint32_t thr, VanadisBasicStorePendingEntry* store_entry) {
+        stores_pending[thr].push_back(store_entry);
+        stores_pending_size++;
+        store_index[thr].insert(store_entry->getStoreAddress(), store_entry->getStoreWidth());
+    }
+
+    // removes (but does not delete) the oldest pending store of the thread
+    void popStorePending(const uint32_t thr) {
+        VanadisBasicStorePendingEntry* store_entry = stores_pending[thr].front();
+        store_index[thr].remove(store_entry->getStoreAddress(), store_entry->getStoreWidth());
+        stores_pending[thr].pop_front();
+        stores_pending_size--;
+    }
+
     bool checkStoreConflict(const uint32_t thread, const uint64_t address, const uint64_t width) {
+        // most loads touch no granule with a pending store, only walk the
+        // store queue when the index says an overlap is possible
+        if(LIKELY(!store_index[thread].mayOverlap(address, width))) {
+            return false;
+        }
+
         bool conflicts = false;
 
         for(auto store_itr = stores_pending[thread].begin(); store_itr != stores_pending[thread].end(); store_itr++) {
@@ -1123,6 +1148,7 @@ protected:
     // Per-hardware-thread queues
     std::vector< std::deque<VanadisBasicLoadStoreEntry*> > op_q;
     std::vector< std::deque<VanadisBasicStorePendingEntry*> > stores_pending;
+    std::vector< VanadisStoreAddressIndex > store_index;
     std::deque<VanadisBasicLoadPendingEntry*> loads_pending;
     std::set<StandardMem::Request::id_t> std_stores_in_flight;
     int op_q_index; // Next hw_thread to check in op_q queues
@@ -0,0 +1,94 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_VANADIS_LSQ_STORE_INDEX
+#define _H_VANADIS_LSQ_STORE_INDEX
+
+#include <algorithm>
+#include <cassert>
+#include <cstdint>
+#include <vector>
+
+namespace SST {
+namespace Vanadis {
+
+/*
+ * Address-hashed count of the pending stores touching each 8-byte granule.
+ * A load whose granules all count zero cannot overlap any pending store, so
+ * the common no-conflict case is answered without walking the store queue.
+ * A non-zero count may be a neighbouring store in the same granule or a hash
+ * collision, the caller must then confirm with an exact check.
+ */
+class VanadisStoreAddressIndex {
+public:
+    VanadisStoreAddressIndex() : mask(0) {}
+
+    // buckets is rounded up to a power of 2
+    explicit VanadisStoreAddressIndex(const size_t buckets) { resize(buckets); }
+
+    void resize(const size_t buckets) {
+        size_t size = 1;
+
+        while (size < buckets) {
+            size <<= 1;
+        }
+
+        counts.assign(size, 0);
+        mask = size - 1;
+    }
+
+    void insert(const uint64_t address, const uint64_t width) {
+        for (uint64_t granule = first(address); granule <= last(address, width); ++granule) {
+            counts[bucket(granule)]++;
+        }
+    }
+
+    void remove(const uint64_t address, const uint64_t width) {
+        for (uint64_t granule = first(address); granule <= last(address, width); ++granule) {
+            assert(counts[bucket(granule)] > 0);
+            counts[bucket(granule)]--;
+        }
+    }
+
+    bool mayOverlap(const uint64_t address, const uint64_t width) const {
+        for (uint64_t granule = first(address); granule <= last(address, width); ++granule) {
+            if (0 != counts[bucket(granule)]) {
+                return true;
+            }
+        }
+
+        return false;
+    }
+
+    void clear() { std::fill(counts.begin(), counts.end(), 0); }
+
+private:
+    static uint64_t first(const uint64_t address) { return address >> 3; }
+
+    // zero-width operations touch only their first granule
+    static uint64_t last(const uint64_t address, const uint64_t width) {
+        return (width > 0) ? ((address + width - 1) >> 3) : (address >> 3);
+    }
+
+    size_t bucket(const uint64_t granule) const { return (granule ^ (granule >> 16)) & mask; }
+
+    std::vector<uint32_t> counts;
+    size_t                mask;
+};
+
+} // namespace Vanadis
+} // namespace SST
+
+#endif
@@ -16,9 +16,11 @@
 #ifndef _H_VANADIS_NODE_OS_INCLUDE_FUTEX
 #define _H_VANADIS_NODE_OS_INCLUDE_FUTEX
 
-#include <string>
+#include <cassert>
+#include <cinttypes>
+#include <cstddef>
+#include <vector>
 
-#include <map>
 namespace SST {
 namespace Vanadis {
 
@@ -33,54 +35,146 @@ class VanadisSyscall;
 
 namespace OS {
 
+// The link a waiting syscall embeds to sit on a futex wait list, so waiting
+// and waking never allocate
+struct FutexWaiter {
+    FutexWaiter( VanadisSyscall* syscall ) : syscall(syscall), addr(0), prev(nullptr), next(nullptr), queued(false) {}
+
+    VanadisSyscall* syscall;
+    uint64_t        addr;
+    FutexWaiter*    prev;
+    FutexWaiter*    next;
+    bool            queued;
+};
+
+// Waiters are kept the way the kernel keeps them: a futex address hashes to
+// one of a fixed number of buckets and each bucket chains the waiters of all
+// its addresses oldest first, so the waiters of one address stay in order
 class Futex {
 public:
-    void addWait( uint64_t addr, VanadisSyscall* syscall ) {
-        OSFutexDbg("Futex::%s() addr=%#" PRIx64 " syscall=%p\n", addr,syscall );
+    Futex() : m_buckets( NumBuckets ), m_numWaiters(0) {}
 
-        auto& tmp = m_futexMap[addr]; 
+    void addWait( uint64_t addr, FutexWaiter* waiter ) {
+        OSFutexDbg("Futex::%s() addr=%#" PRIx64 " syscall=%p\n", addr, waiter->syscall );
+        assert( ! waiter->queued );
 
-        for ( auto iter = tmp.begin(); iter != tmp.end(); ++iter ) {
-            assert( *iter != syscall );
-        }
-
-        tmp.push_back( syscall );
-        OSFutexDbg("Futex::%s() %p %zu\n",this,tmp.size());
+        waiter->addr = addr;
+        append( getBucket( addr ), waiter );
+        OSFutexDbg("Futex::%s() %p %zu\n",this,m_numWaiters);
     }
 
     size_t getNumWaiters( uint64_t addr ) {
         OSFutexDbg("Futex::%s() addr=%#" PRIx64 "\n", addr );
-        if ( m_futexMap.find( addr ) == m_futexMap.end() ) {
-            return 0;
+        size_t count = 0;
+        for ( FutexWaiter* waiter = getBucket( addr ).head; waiter; waiter = waiter->next ) {
+            if ( waiter->addr == addr ) { ++count; }
         }
-        auto& tmp = m_futexMap[addr]; 
-        OSFutexDbg("Futex::%s() %p %zu\n",this,tmp.size());
-        return tmp.size();
+        return count;
     }
+
     VanadisSyscall* findWait( uint64_t addr ) {
         OSFutexDbg("Futex::%s() addr=%#" PRIx64 "\n", addr );
-        if (  m_futexMap.find( addr ) == m_futexMap.end() ) {
-            return nullptr;
+        Bucket& bucket = getBucket( addr );
+        for ( FutexWaiter* waiter = bucket.head; waiter; waiter = waiter->next ) {
+            if ( waiter->addr == addr ) {
+                unlink( bucket, waiter );
+                OSFutexDbg("Futex::%s() found addr=%#" PRIx64 " syscall=%p\n", addr, waiter->syscall );
+                return waiter->syscall;
+            }
         }
-        
-        auto& tmp = m_futexMap[addr]; 
-
-        OSFutexDbg("Futex::%s() %p %zu\n",this,tmp.size());
-        assert( ! tmp.empty() );
+        return nullptr;
+    }
 
-        auto syscall = tmp.front();
+    // Removes up to max of the oldest waiters on addr in one walk of its bucket
+    size_t takeWaiters( uint64_t addr, size_t max, std::vector<VanadisSyscall*>& woken ) {
+        OSFutexDbg("Futex::%s() addr=%#" PRIx64 " max=%zu\n", addr, max );
+        Bucket& bucket = getBucket( addr );
+        size_t count = 0;
+        FutexWaiter* waiter = bucket.head;
+        while ( waiter && count < max ) {
+            FutexWaiter* next = waiter->next;
+            if ( waiter->addr == addr ) {
+                unlink( bucket, waiter );
+                woken.push_back( waiter->syscall );
+                ++count;
+            }
+            waiter = next;
+        }
+        return count;
+    }
 
-        tmp.pop_front( );
-        if ( tmp.empty() ) {
-            m_futexMap.erase( addr );
+    // Moves up to max of the oldest waiters on addr behind those waiting on addr2
+    size_t requeue( uint64_t addr, uint64_t addr2, size_t max ) {
+        OSFutexDbg("Futex::%s() addr=%#" PRIx64 " addr2=%#" PRIx64 " max=%zu\n", addr, addr2, max );
+        Bucket& bucket = getBucket( addr );
+        Bucket& bucket2 = getBucket( addr2 );
+        size_t count = 0;
+        FutexWaiter* waiter = bucket.head;
+
+        // stop at the first waiter moved, when both addresses share a bucket it
+        // was appended behind all the others
+        FutexWaiter* first_moved = nullptr;
+        while ( waiter && waiter != first_moved && count < max ) {
+            FutexWaiter* next = waiter->next;
+            if ( waiter->addr == addr ) {
+                unlink( bucket, waiter );
+                waiter->addr = addr2;
+                append( bucket2, waiter );
+                if ( nullptr == first_moved ) { first_moved = waiter; }
+                ++count;
+            }
+            waiter = next;
         }
-        OSFutexDbg("Futex::%s() found addr=%#" PRIx64 " syscall=%p\n", addr,syscall );
-        return syscall;
+        return count;
     }
-    bool isEmpty() { return m_futexMap.empty(); } 
+
+    bool isEmpty() { return 0 == m_numWaiters; } 
 
 private:
-    std::map< uint64_t, std::deque<VanadisSyscall* > > m_futexMap;
+    static constexpr size_t NumBuckets = 256;
+
+    struct Bucket {
+        Bucket() : head(nullptr), tail(nullptr) {}
+        FutexWaiter* head;
+        FutexWaiter* tail;
+    };
+
+    Bucket& getBucket( uint64_t addr ) {
+        // futex words are 4 byte aligned
+        return m_buckets[ ( ( addr >> 2 ) * 0x9E3779B97F4A7C15ULL ) >> 56 ];
+    }
+
+    void append( Bucket& bucket, FutexWaiter* waiter ) {
+        waiter->prev = bucket.tail;
+        waiter->next = nullptr;
+        if ( bucket.tail ) {
+            bucket.tail->next = waiter;
+        } else {
+            bucket.head = waiter;
+        }
+        bucket.tail = waiter;
+        waiter->queued = true;
+        ++m_numWaiters;
+    }
+
+    void unlink( Bucket& bucket, FutexWaiter* waiter ) {
+        if ( waiter->prev ) {
+            waiter->prev->next = waiter->next;
+        } else {
+            bucket.head = waiter->next;
+        }
+        if ( waiter->next ) {
+            waiter->next->prev = waiter->prev;
+        } else {
+            bucket.tail = waiter->prev;
+        }
+        waiter->prev = waiter->next = nullptr;
+        waiter->queued = false;
+        --m_numWaiters;
+    }
+
+    std::vector<Bucket> m_buckets;
+    size_t              m_numWaiters;
 };
 
 }
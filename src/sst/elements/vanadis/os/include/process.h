@@ -315,9 +315,9 @@ class ProcessInfo {
     }
 
 
-    void addFutexWait( uint64_t addr, VanadisSyscall* syscall ) {
+    void addFutexWait( uint64_t addr, FutexWaiter* waiter ) {
         m_dbg.verbose(CALL_INFO,1,0,"addr=%#" PRIx64 "\n",addr);
-        m_futex->addWait( addr, syscall );
+        m_futex->addWait( addr, waiter );
     }
 
     VanadisSyscall* findFutex( uint64_t addr ) {
@@ -330,6 +330,16 @@ class ProcessInfo {
         return m_futex->getNumWaiters( addr );
     }
 
+    size_t futexTakeWaiters( uint64_t addr, size_t max, std::vector<VanadisSyscall*>& woken ) {
+        m_dbg.verbose(CALL_INFO,1,0,"addr=%#" PRIx64 " max=%zu\n",addr,max);
+        return m_futex->takeWaiters( addr, max, woken );
+    }
+
+    size_t futexRequeue( uint64_t addr, uint64_t addr2, size_t max ) {
+        m_dbg.verbose(CALL_INFO,1,0,"addr=%#" PRIx64 " addr2=%#" PRIx64 " max=%zu\n",addr,addr2,max);
+        return m_futex->requeue( addr, addr2, max );
+    }
+
     void mapVirtToPage( unsigned vpn, OS::Page* page ) {
         m_dbg.verbose(CALL_INFO,1,0,"vpn=%d ppn=%d virtAddr=%#" PRIx64 "\n", vpn, page->getPPN(), (uint64_t) vpn << m_pageShift );
         auto region = findMemRegion( vpn << m_pageShift );
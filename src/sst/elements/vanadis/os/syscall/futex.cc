@@ -56,7 +56,7 @@
 using namespace SST::Vanadis;
 
 VanadisFutexSyscall::VanadisFutexSyscall( VanadisNodeOSComponent* os, SST::Link* coreLink, OS::ProcessInfo* process, VanadisSyscallFutexEvent* event )
-        : VanadisSyscall( os, coreLink, process, event, "futex" ), m_state(ReadAddr), m_numWokeup(0), m_waitStoreConditional(false)
+        : VanadisSyscall( os, coreLink, process, event, "futex" ), m_state(ReadAddr), m_numWokeup(0), m_waitStoreConditional(false), m_waiter(this)
 {
     m_output->verbose(CALL_INFO, 2, VANADIS_OS_DBG_SYSCALL,
             "[syscall-futex] addr=%#" PRIx64 " op=%#x val=%#" PRIx32 " timeAddr=%#" PRIx64 " callStackAddr=%#" PRIx64 
@@ -121,54 +121,32 @@ VanadisFutexSyscall::VanadisFutexSyscall( VanadisNodeOSComponent* os, SST::Link*
     }
 }
 
-void VanadisFutexSyscall::wakeWaiter(VanadisSyscallFutexEvent* event) const
+// Wakes up to max of the waiters on addr, taking them off the wait list in one pass
+int VanadisFutexSyscall::wakeWaiters(uint64_t addr, uint32_t max) const
 {
-    auto syscall = m_process->findFutex(event->getAddr());
-    if( !syscall )
-    {
-        m_output->fatal(CALL_INFO, 1, "syscall should not be null here. "
-                        "wakeWaiter() should not be called when no threads are waiting.\n");
-    }
-    m_output->verbose(CALL_INFO, 3, VANADIS_OS_DBG_SYSCALL,
-                      "[syscall-futex] FUTEX_WAKE tid=%d addr=%#" PRIx64 " found waiter, wakeup tid=%d\n",
-                      m_process->gettid(), event->getAddr(),syscall->getTid());
-    dynamic_cast<VanadisFutexSyscall*>( syscall )->wakeup();
-    delete syscall;
-}
+    std::vector<VanadisSyscall*> woken;
+    m_process->futexTakeWaiters(addr, max, woken);
 
-int VanadisFutexSyscall::getNumWaitersToWake(VanadisSyscallFutexEvent* event) const
-{
-    uint32_t numWaiters = m_process->futexGetNumWaiters(event->getAddr());
-    uint32_t numWaitersToWake = std::min(numWaiters, event->getVal());
-    if( numWaiters == 0 )
+    if( woken.empty() )
     {
         m_output->verbose(CALL_INFO, 3, VANADIS_OS_DBG_SYSCALL,
-                          "[syscall-futex] FUTEX_WAKE tid=%d addr=%#" PRIx64 " no waiter\n", m_process->gettid(), event->getAddr());
+                          "[syscall-futex] FUTEX_WAKE tid=%d addr=%#" PRIx64 " no waiter\n", m_process->gettid(), addr);
     }
-    else
-    {
-        m_output->verbose(CALL_INFO, 3, VANADIS_OS_DBG_SYSCALL,
-                          "[syscall-futex] FUTEX_WAKE tid=%d addr=%#" PRIx64 " %u waiters, "
-                          " val is %u, will wake %u threads \n", 
-                          m_process->gettid(), event->getAddr(), numWaiters, event->getVal(), numWaitersToWake);
 
-    }
-    return numWaitersToWake;
-}
-
-int VanadisFutexSyscall::wakeWaiters(VanadisSyscallFutexEvent* event) const
-{
-    auto numWaiters = getNumWaitersToWake(event);
-    for(int curWaiter=0;curWaiter<numWaiters;curWaiter++)
+    for( auto syscall : woken )
     {
-        wakeWaiter(event);
+        m_output->verbose(CALL_INFO, 3, VANADIS_OS_DBG_SYSCALL,
+                          "[syscall-futex] FUTEX_WAKE tid=%d addr=%#" PRIx64 " found waiter, wakeup tid=%d\n",
+                          m_process->gettid(), addr, syscall->getTid());
+        dynamic_cast<VanadisFutexSyscall*>( syscall )->wakeup();
+        delete syscall;
     }
-    return numWaiters;
+    return woken.size();
 }
 
 void VanadisFutexSyscall::futexWake(VanadisSyscallFutexEvent* event)
 {
-    setReturnSuccess(wakeWaiters(event));
+    setReturnSuccess(wakeWaiters(event->getAddr(), event->getVal()));
 }
 
 void VanadisFutexSyscall::wakeup() 
@@ -215,7 +193,7 @@ void VanadisFutexSyscall::memReqIsDone(bool failed )
                     m_output->verbose(CALL_INFO, 3, VANADIS_OS_DBG_SYSCALL,
                         "[syscall-futex] FUTEX_WAIT tid=%d addr=%#" PRIx64 " vals match go to sleep\n",
                         m_process->gettid(), getEvent<VanadisSyscallFutexEvent*>()->getAddr());
-                    m_process->addFutexWait( getEvent<VanadisSyscallFutexEvent*>()->getAddr(), this );
+                    m_process->addFutexWait( getEvent<VanadisSyscallFutexEvent*>()->getAddr(), &m_waiter );
                 }
             }
         } break;
@@ -229,16 +207,7 @@ void VanadisFutexSyscall::memReqIsDone(bool failed )
                 m_output->verbose(CALL_INFO, 3, VANADIS_OS_DBG_SYSCALL, "[syscall-futex] FUTEX_REQUEUE numWaiters %d\n",numWaiters);
 
                 // wakeup at most val number of waiters
-                for ( int i = 0; i < val && i < numWaiters; i++ ) { 
-                    VanadisSyscall* syscall = m_process->findFutex( getEvent<VanadisSyscallFutexEvent*>()->getAddr() );
-                    if ( syscall ) {
-                        ++m_numWokeup;
-                        m_output->verbose(CALL_INFO, 3, VANADIS_OS_DBG_SYSCALL, "[syscall-futex] FUTEX_REQUEUE tid=%d addr=%#" PRIx64 " wakeup tid=%d\n",
-                                    m_process->gettid(), getEvent<VanadisSyscallFutexEvent*>()->getAddr(), syscall->getTid());
-                        dynamic_cast<VanadisFutexSyscall*>( syscall )->wakeup();
-                        delete syscall;
-                    }
-                }
+                m_numWokeup = wakeWaiters( getEvent<VanadisSyscallFutexEvent*>()->getAddr(), val );
                 m_output->verbose(CALL_INFO, 3, VANADIS_OS_DBG_SYSCALL, "[syscall-futex] FUTEX_REQUEUE numWokeup %d\n",m_numWokeup);
                 
                 // if there are no more waiters, we are done
@@ -271,16 +240,9 @@ void VanadisFutexSyscall::finish( uint32_t val2, uint64_t addr2 )
 {
     m_output->verbose(CALL_INFO, 3, VANADIS_OS_DBG_SYSCALL, "[syscall-futex] FUTEX_REQUEUE read val2=%d addr2=%#" PRIx64 "\n",val2,addr2);
 
-    int numWaiters = m_process->futexGetNumWaiters( getEvent<VanadisSyscallFutexEvent*>()->getAddr() );
-    m_output->verbose(CALL_INFO, 3, VANADIS_OS_DBG_SYSCALL, "[syscall-futex] FUTEX_REQUEUE numWaiters %d\n",numWaiters);
-
-    for ( int i = 0; i < val2 && i < numWaiters; i++ ) { 
-        VanadisSyscall* syscall = m_process->findFutex( getEvent<VanadisSyscallFutexEvent*>()->getAddr() );
-        if ( syscall ) {
-            m_output->verbose(CALL_INFO, 3, VANADIS_OS_DBG_SYSCALL,"[syscall-futex] FUTEX_REQUEUE tid=%d addr=%#" PRIx64 " move to %#" PRIx64 "\n",m_process->gettid(),
-                getEvent<VanadisSyscallFutexEvent*>()->getAddr(),addr2); m_process->addFutexWait( addr2, syscall );
-        }
-    }
+    size_t numMoved = m_process->futexRequeue( getEvent<VanadisSyscallFutexEvent*>()->getAddr(), addr2, val2 );
+    m_output->verbose(CALL_INFO, 3, VANADIS_OS_DBG_SYSCALL,"[syscall-futex] FUTEX_REQUEUE tid=%d addr=%#" PRIx64 " moved %zu to %#" PRIx64 "\n",m_process->gettid(),
+        getEvent<VanadisSyscallFutexEvent*>()->getAddr(),numMoved,addr2);
 
     setReturnSuccess( m_numWokeup );
 }
@@ -30,6 +30,8 @@ public:
     void wakeup();
  private:  
 
+    OS::FutexWaiter m_waiter;
+
     enum State { ReadAddr, ReadArgs } m_state;
     void memReqIsDone(bool);
     void finish( uint32_t val2, uint64_t addr2 );
@@ -41,9 +43,7 @@ public:
     int m_numWokeup;
 
     void futexWake(VanadisSyscallFutexEvent* event);
-    int wakeWaiters(VanadisSyscallFutexEvent* event) const;
-    void wakeWaiter(VanadisSyscallFutexEvent* event) const;
-    int getNumWaitersToWake(VanadisSyscallFutexEvent* event) const;
+    int wakeWaiters(uint64_t addr, uint32_t max) const;
 };
 
 } // namespace Vanadis
@@ -41,13 +41,19 @@ public:
         } else if (event->getBufferCount() == 0) {
             setReturnSuccess(0);
         } else {
-            // get the length of the first memory access, it cannot span a cacheline  
-            uint64_t length = vanadis_line_remainder(event->getBufferAddress(),64);
-            length = event->getBufferCount() < length ? event->getBufferCount() : length;
-            readChunk( length ); 
+            readChunk( calcChunkLength() ); 
         }
     }
 
+    // the host file is read a page of the buffer at a time, the memory
+    // handler splits each chunk into cache line writes
+    size_t calcChunkLength() {
+        VanadisSyscallReadEvent* event = getEvent<VanadisSyscallReadEvent*>();
+        uint64_t length = vanadis_line_remainder( event->getBufferAddress() + m_numRead, m_pageSize );
+        uint64_t left = event->getBufferCount() - m_numRead;
+        return left < length ? left : length;
+    }
+
     void readChunk(size_t length) {
 
         m_data.resize(length);
@@ -71,17 +77,12 @@ public:
         }
     }
 
-    bool handleMemResp( StandardMem::Request* req ) {
-        delete req; // we don't use the request
-
+    void memReqIsDone(bool) {
         if ( m_eof || m_numRead == getEvent<VanadisSyscallReadEvent*>()->getBufferCount() ) {
             setReturnSuccess( m_numRead );
         } else {
-            size_t length = getEvent<VanadisSyscallReadEvent*>()->getBufferCount() - m_numRead;  
-            if ( length > 64 ) { length = 64; }
-            readChunk( length );
+            readChunk( calcChunkLength() );
         }
-        return false;
     } 
 
  private:
@@ -25,6 +25,9 @@ VanadisSyscall::VanadisSyscall( VanadisNodeOSComponent* os, SST::Link* coreLink,
             m_complete(false), m_memHandler(nullptr),  m_pageFaultAddr(0)
 {
     m_output = m_os->getOutput();
+    m_pageSize = m_os->getPageSize();
+    m_memWindow = m_os->getSyscallMemoryWindow();
+    m_startTime = m_os->syscallStart();
     m_os->setSyscall( getCoreId(), getThreadId(), this);
 }
 
@@ -41,6 +44,7 @@ VanadisSyscall::~VanadisSyscall() {
         resp->getReturnCode() );
 
     m_coreLink->send( resp );
+    m_os->syscallFinish( m_startTime );
 
     m_os->clearSyscall( getCoreId(), getThreadId() );
 
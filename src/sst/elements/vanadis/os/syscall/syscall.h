@@ -50,6 +50,10 @@ private:
         virtual bool isDone() = 0;
         virtual StandardMem::Request* generateMemReq() = 0;
 
+        // Whether the next request can go out before the ones in flight have
+        // returned, it must not need a page fault while they are outstanding
+        virtual bool canOverlap( uint64_t pageSize ) { return false; }
+
         VanadisSyscall* obj;
     };
 
@@ -96,7 +100,7 @@ private:
     class BlockMemoryHandler : public MemoryHandler {
     public:
         BlockMemoryHandler( VanadisSyscall* obj, SST::Output* out, uint64_t addr, std::vector<uint8_t>& data, bool lock )
-            : MemoryHandler(obj,out), m_addr(addr), m_data(data),  m_offset(0), m_lock(lock) {
+            : MemoryHandler(obj,out), m_addr(addr), m_data(data),  m_offset(0), m_issued(0), m_lock(lock) {
         }
 
         virtual ~BlockMemoryHandler() {}
@@ -105,21 +109,30 @@ private:
             return m_offset == m_data.size(); 
         }
 
+        // the page of the next line has already been translated if the line
+        // before it is on the same page
+        bool canOverlap( uint64_t pageSize ) override {
+            return ! m_lock && m_issued > 0 && m_issued < m_data.size() &&
+                ( getAddress() / pageSize ) == ( ( getAddress() - 1 ) / pageSize );
+        }
+
     protected:
         size_t calcLength() {
             uint64_t length;
-            if ( 0 == m_offset ) {
+            if ( 0 == m_issued ) {
                 length = vanadis_line_remainder( getAddress(), 64 );
             } else {
                 length = 64;
             }
-            length = m_data.size() - m_offset < length ? m_data.size() - m_offset : length;
+            length = m_data.size() - m_issued < length ? m_data.size() - m_issued : length;
             return length;
         }
-        uint64_t getAddress() { return m_addr + m_offset; };        
+        // address of the next line to request, m_offset counts the bytes which have completed
+        uint64_t getAddress() { return m_addr + m_issued; };        
         std::vector<uint8_t>& m_data;
         uint64_t m_addr;
         size_t m_offset;
+        size_t m_issued;
         int m_lock;
     };
 
@@ -129,7 +142,8 @@ private:
             : BlockMemoryHandler(obj,out,addr,data,lock) {}
 
         void handle(StandardMem::ReadResp* req ) override {
-            memcpy( m_data.data() + m_offset, req->data.data(), req->size );
+            // several lines may be in flight, each carries the virtual address it was read for
+            memcpy( m_data.data() + ( req->vAddr - m_addr ), req->data.data(), req->size );
             m_offset += req->size; 
         }
         StandardMem::Request* generateMemReq() override {
@@ -139,6 +153,7 @@ private:
             if ( -1 == physAddr ) {
                 return nullptr;
             } else {
+                m_issued += length;
 
                 if ( m_lock ) {
                     auto req =  new StandardMem::LoadLink( physAddr, length, 0, virtAddr, 0, 0 );
@@ -166,13 +181,14 @@ private:
             uint64_t length = calcLength();
 
             std::vector<uint8_t> payload( length );
-            memcpy( payload.data(), m_data.data() + m_offset, length );
+            memcpy( payload.data(), m_data.data() + m_issued, length );
             
             auto physAddr = obj->virtToPhys( getAddress(), true, process ); 
 
             if ( -1 == physAddr ) {
                 return nullptr;
             } else {
+                m_issued += length;
                 if ( m_lock ) {
                     return new StandardMem::StoreConditional( physAddr, payload.size(), payload, 0);
                 } else {
@@ -224,10 +240,14 @@ private:
         return physAddr;
     } 
 
+    // Returns the next memory request of the current transfer, or nullptr if
+    // there is none or it has to wait for the requests already in flight
     StandardMem::Request* getMemoryRequest() {
         m_output->verbose(CALL_INFO, 16, 0,"\n");
         StandardMem::Request* req = nullptr;
-        if ( m_memHandler ) {
+        m_pageFaultAddr = 0;
+        if ( m_memHandler && ( m_pendingMem.empty() ||
+                ( m_pendingMem.size() < m_memWindow && m_memHandler->canOverlap( m_pageSize ) ) ) ) {
             req = m_memHandler->generateMemReq();
             if ( req ) {
                 m_pendingMem.insert(req->getID());
@@ -281,6 +301,7 @@ private:
     OS::ProcessInfo*        m_process;
     VanadisSyscallEvent*    m_event;
     VanadisNodeOSComponent* m_os;
+    uint64_t                m_pageSize;
 
   private:
 
@@ -290,6 +311,8 @@ private:
 
     uint64_t            m_pageFaultAddr;
     uint64_t            m_pageFaultIsWrite;
+    size_t              m_memWindow;
+    uint64_t            m_startTime;
     std::string         m_name;
     ReturnInfo          m_returnInfo;
     MemoryHandler*      m_memHandler;
@@ -41,16 +41,20 @@ public:
         } else if (event->getBufferCount() == 0) {
             setReturnSuccess(0);
         } else {
-
-            // get the length of the first memory access, it cannot span a cacheline  
-            uint64_t length = vanadis_line_remainder(event->getBufferAddress(),64);
-            length = event->getBufferCount() < length ? event->getBufferCount() : length;
-
-            m_data.resize( length );
+            m_data.resize( calcChunkLength() );
             readMemory( event->getBufferAddress(), m_data );
         }
     }
 
+    // the buffer is gathered a page at a time, the memory handler splits
+    // each chunk into cache line reads, and written to the host file at once
+    size_t calcChunkLength() {
+        VanadisSyscallWriteEvent* event = getEvent<VanadisSyscallWriteEvent*>();
+        uint64_t length = vanadis_line_remainder( event->getBufferAddress() + m_numWritten, m_pageSize );
+        uint64_t left = event->getBufferCount() - m_numWritten;
+        return left < length ? left : length;
+    }
+
     void memReqIsDone(bool) {
 
         int retval = write( m_fd, m_data.data(), m_data.size() );
@@ -60,10 +64,7 @@ public:
         if ( m_numWritten == getEvent<VanadisSyscallWriteEvent*>()->getBufferCount() ) {
             setReturnSuccess( m_numWritten );
         } else {
-            size_t length = getEvent<VanadisSyscallWriteEvent*>()->getBufferCount() - m_numWritten;
-            if ( length > 64 ) { length = 64; }
-
-            m_data.resize(length);
+            m_data.resize( calcChunkLength() );
             readMemory( getEvent<VanadisSyscallWriteEvent*>()->getBufferAddress() + m_numWritten, m_data );
         }
     } 
@@ -115,11 +115,12 @@ void loadElfFile( Output* output, Interfaces::StandardMem* mem_if, MMU_Lib::MMU*
 }
 
 uint8_t* readElfPage( Output* output, VanadisELFInfo* elf_info, int vpn, int page_size ) {
-    uint64_t virtAddr = vpn<<12;  
+    uint64_t virtAddr = (uint64_t) vpn * page_size;
     auto path = elf_info->getBinaryPath();
     output->verbose( CALL_INFO, 2, VANADIS_OS_DBG_READ_ELF, "-> Loading %s, to locate program sections ...\n", path);
     output->verbose( CALL_INFO, 2, VANADIS_OS_DBG_READ_ELF,"%s vpn=%d addr=%#" PRIx64 " page_size=%d\n",path,vpn,virtAddr,page_size);
-    FILE* exec_file = fopen(elf_info->getBinaryPath(), "rb");
+    // shared by every fault on this binary, it stays open
+    FILE* exec_file = elf_info->getBinaryFile();
     if ( nullptr == exec_file ) {
         output->fatal(CALL_INFO, -1, "Error: unable to open %s\n", path);
     }
@@ -163,7 +164,6 @@ uint8_t* readElfPage( Output* output, VanadisELFInfo* elf_info, int vpn, int pag
         fread( data + dataOffset, numBytes, 1, exec_file);
     }
 
-    fclose(exec_file);
     return data; 
 }
 
@@ -51,16 +51,16 @@ void loadPages( SST::Output* output, SST::Interfaces::StandardMem* mem_if, MMU_L
         std::vector< uint8_t > pageBuffer( buffer.begin() + offset, buffer.begin() + offset + page_size );
 #endif
 
-        printf( "pageVirtAddr=%#" PRIx64 " physPageNum=%d physAddr=%#" PRIx64 "\n", pageVirtAddr, physPageNum, physAddr );
         output->verbose( CALL_INFO, 2, 0, "pageVirtAddr=%#" PRIx64 " physPageNum=%d physAddr=%#" PRIx64 "\n", pageVirtAddr, physPageNum, physAddr );
 
 #if 1
-        uint64_t offset = 0;
-        for ( int num = 0; num < page_size/64; num++ ) {
-            std::vector< uint8_t > tmp( buffer.begin() + offset, buffer.begin() + offset + 64  );
-            Interfaces::StandardMem::Request* req = new SST::Interfaces::StandardMem::Write( physAddr + offset, tmp.size(), tmp );
-            printf("%s() %s\n",__func__,req->getString().c_str());
-            offset += 64;
+        // the whole page is sent back to back, the writes have no ordering
+        // requirement between them so there is no need to wait for responses
+        const uint64_t pageOffset = (uint64_t) i * page_size;
+        for ( uint64_t offset = 0; offset < page_size; offset += 64 ) {
+            std::vector< uint8_t > tmp( buffer.begin() + pageOffset + offset, buffer.begin() + pageOffset + offset + 64 );
+            Interfaces::StandardMem::Request* req = new SST::Interfaces::StandardMem::Write( physAddr + offset, tmp.size(), std::move(tmp) );
+            output->verbose( CALL_INFO, 16, 0, "%s\n", req->getString().c_str() );
             mem_if->send(req);
         }
 
@@ -69,7 +69,6 @@ void loadPages( SST::Output* output, SST::Interfaces::StandardMem* mem_if, MMU_L
         mem_if->sendUntimedData(new SST::Interfaces::StandardMem::Write( physAddr, page_size, pageBuffer ) );
 #endif
         pageVirtAddr += page_size;
-        offset += page_size; 
     }
 }
 
@@ -35,7 +35,7 @@
 using namespace SST::Vanadis;
 
 VanadisNodeOSComponent::VanadisNodeOSComponent(SST::ComponentId_t id, SST::Params& params) 
-    : SST::Component(id), m_mmu(nullptr), m_physMemMgr(nullptr), m_currentTid(100) 
+    : SST::Component(id), m_mmu(nullptr), m_physMemMgr(nullptr), m_currentTid(100), m_activeBlockXfers(0) 
 {
 
     const uint32_t verbosity = params.find<uint32_t>("dbgLevel", 0);
@@ -62,6 +62,7 @@ VanadisNodeOSComponent::VanadisNodeOSComponent(SST::ComponentId_t id, SST::Param
     } else {
         m_checkpoint = NO_CHECKPOINT;
     }
+    m_checkpointFormat = vanadis_checkpoint_format(output, params.find<std::string>("checkpointFormat", "text"));
     const uint32_t core_count = params.find<uint32_t>("cores", 0);
     const uint32_t hardwareThreadCount = params.find<uint32_t>("hardwareThreadCount", 1);
     
@@ -97,6 +98,21 @@ VanadisNodeOSComponent::VanadisNodeOSComponent(SST::ComponentId_t id, SST::Param
     m_pageSize = params.find<uint64_t>("page_size", 4096);
     m_pageShift = log2( m_pageSize );
 
+    m_maxBlockXfers = params.find<uint32_t>("maxPageTransfers", 4);
+    if ( 0 == m_maxBlockXfers ) {
+        output->fatal(CALL_INFO, -1, "Error: maxPageTransfers must be at least 1\n");
+    }
+
+    m_syscallMemWindow = params.find<uint32_t>("syscallMemoryWindow", 1);
+    if ( 0 == m_syscallMemWindow ) {
+        output->fatal(CALL_INFO, -1, "Error: syscallMemoryWindow must be at least 1\n");
+    }
+
+    stat_syscall_latency = registerStatistic<uint64_t>("syscall_latency", "1");
+    stat_page_fault_latency = registerStatistic<uint64_t>("page_fault_latency", "1");
+    stat_page_faults_queued = registerStatistic<uint64_t>("page_faults_queued", "1");
+    stat_page_xfers_queued = registerStatistic<uint64_t>("page_transfers_queued", "1");
+
     if ( params.find<bool>("useMMU",false) ) { ;
         m_mmu = loadUserSubComponent<SST::MMU_Lib::MMU>("mmu");
         if ( nullptr == m_mmu ) {
@@ -259,7 +275,11 @@ VanadisNodeOSComponent::checkpoint( std::string dir )
     assert(fp);
 
     m_mmu->checkpoint( dir );
-    m_physMemMgr->checkpoint( output, dir );
+    if ( VANADIS_CHECKPOINT_BINARY == m_checkpointFormat ) {
+        m_physMemMgr->checkpointBinary( output, dir );
+    } else {
+        m_physMemMgr->checkpoint( output, dir );
+    }
 
     // dump ELF map
     fprintf(fp,"m_elfMap.size() %zu\n",m_elfMap.size());
@@ -327,7 +347,11 @@ int VanadisNodeOSComponent::checkpointLoad( std::string dir )
     assert(fp);
 
     m_mmu->checkpointLoad( dir );
-    m_physMemMgr->checkpointLoad( output, dir );
+    if ( VANADIS_CHECKPOINT_BINARY == m_checkpointFormat ) {
+        m_physMemMgr->checkpointLoadBinary( output, dir );
+    } else {
+        m_physMemMgr->checkpointLoad( output, dir );
+    }
 
     // load ELF map
     assert( 1 == fscanf(fp,"m_elfMap.size() %zu\n",&size) );
@@ -478,26 +502,28 @@ void VanadisNodeOSComponent::handleIncomingMemory(StandardMem::Request* ev) {
     auto lookup_result = m_memRespMap.find(ev->getID());
 
     if ( lookup_result == m_memRespMap.end() )  {
-        if ( ! m_blockMemoryWriteReqQ.empty( ) ) {
-            auto req = m_blockMemoryWriteReqQ.front();
-            try {
-                if ( req->handleResp( ev ) ) {
-                    delete req;
-                    m_blockMemoryWriteReqQ.pop();
-                    if ( ! m_blockMemoryWriteReqQ.empty() ) {
-                        startBlockXfer( m_blockMemoryWriteReqQ.front());
-                    }
-                }
-            } catch ( int e ) {
-                output->fatal(CALL_INFO, -1, "Error - received StandardMem response that does not match PageWrite request\n");
+        auto xfer = m_blockMemoryRespMap.find(ev->getID());
+        if ( xfer != m_blockMemoryRespMap.end() ) {
+            auto req = xfer->second;
+            m_blockMemoryRespMap.erase( xfer );
+
+            req->handleResp( ev );
+            // keep the transfer's window full
+            sendBlockReq( req );
+
+            if ( req->isDone() ) {
+                finishBlockXfer( req );
             }
-        } else {
+        } else if ( ! m_flushPages.empty() ) {
 //            output->fatal(CALL_INFO, -1, "Error - received StandardMem response that does not belong to a core\n");
             m_flushPages.pop_front();
             if ( m_flushPages.empty() ) {
                 primaryComponentOKToEndSim();
             }
 
+        } else {
+            // the writes loadPages() streams out are not tracked
+            delete ev;
         }
     } else if (lookup_result != m_memRespMap.end()) {
         handleIncomingMemory( lookup_result->second, ev );
@@ -664,6 +690,7 @@ void VanadisNodeOSComponent::processSyscallPost( VanadisSyscall* syscall ) {
         if ( ev ) {
             output->verbose(CALL_INFO, 16, VANADIS_OS_DBG_SYSCALL,"syscall '%s' for core %d has a memory request\n",syscall->getName().c_str(),core);
             sendMemoryEvent(syscall, ev );
+            fillSyscallMemoryWindow( syscall );
         } else if ( syscall->causedPageFault() ) {
             uint64_t virtAddr;
             bool isWrite;
@@ -675,6 +702,14 @@ void VanadisNodeOSComponent::processSyscallPost( VanadisSyscall* syscall ) {
     }
 }
 
+// Keep issuing while the syscall's transfer can have more lines in flight
+void VanadisNodeOSComponent::fillSyscallMemoryWindow( VanadisSyscall* syscall ) {
+    StandardMem::Request* ev;
+    while ( ( ev = syscall->getMemoryRequest() ) ) {
+        sendMemoryEvent( syscall, ev );
+    }
+}
+
 void VanadisNodeOSComponent::processOsPageFault( VanadisSyscall* syscall, uint64_t virtAddr, bool isWrite ) {
     output->verbose(CALL_INFO, 1, VANADIS_OS_DBG_PAGE_FAULT, "virtAddr=%#" PRIx64 " isWrite=%d\n",virtAddr, isWrite);
 
@@ -691,10 +726,16 @@ void VanadisNodeOSComponent::pageFaultHandler2( MMU_Lib::RequestID reqId, unsign
             reqId, link, pid, vpn, faultPerms, instPtr, syscall ); 
 
     auto tmp = new PageFault( reqId, link, core, hwThread, pid, vpn, faultPerms, instPtr, memVirtAddr, syscall );
-    m_pendingFault.push( tmp );
-    if ( 1 == m_pendingFault.size() ) {
+    tmp->startTime = getCurrentSimTimeNano();
+
+    // a second fault on a page must see the result of the first (shared ELF
+    // pages, copy-on-write after fork), so faults on the same vpn wait
+    auto& pending = m_pendingFault[vpn];
+    pending.push( tmp );
+    if ( 1 == pending.size() ) {
         pageFault( tmp );
     } else { 
+        stat_page_faults_queued->addData(1);
         output->verbose(CALL_INFO, 1, VANADIS_OS_DBG_PAGE_FAULT, "queue page fault\n" ); 
     }
 }
@@ -708,15 +749,21 @@ void VanadisNodeOSComponent::pageFaultFini( PageFault* info, bool success )
         auto ev = info->syscall->getMemoryRequest();
         assert(ev);
         sendMemoryEvent(info->syscall, ev ); 
+        fillSyscallMemoryWindow( info->syscall );
     } else {
         m_mmu->faultHandled( info->reqId, info->link, info->pid, info->vpn, success );
     }
+    stat_page_fault_latency->addData( getCurrentSimTimeNano() - info->startTime );
+
+    auto pending = m_pendingFault.find( info->vpn );
+    assert( pending != m_pendingFault.end() && pending->second.front() == info );
     delete info;
 
-    m_pendingFault.pop();
-    if ( m_pendingFault.size() ) {
-        auto tmp = m_pendingFault.front();
-        pageFault( tmp );
+    pending->second.pop();
+    if ( pending->second.empty() ) {
+        m_pendingFault.erase( pending );
+    } else {
+        pageFault( pending->second.front() );
     }
 }
 
@@ -870,8 +917,9 @@ void VanadisNodeOSComponent::pageFault( PageFault *info )
         // map this physical page into the MMU for this process 
         m_mmu->map( thread->getpid(), vpn, page->getPPN(), m_pageSize, region->perms );
         
-        // if there's elfInfo for this region is mapped to a file update the page cache 
-        if ( region->backing && region->backing->elfInfo && 0 == region->name.compare("text") ) {
+        // if there's elfInfo for this region is mapped to a file update the page cache,
+        // any read-only segment (text, rodata) is shared by all processes of the binary
+        if ( region->backing && region->backing->elfInfo && 0 == ( region->perms & 0x2 ) ) {
             if ( nullptr != data ) { 
                 updatePageCache( region->backing->elfInfo, vpn, page );
             } else {
@@ -901,7 +949,7 @@ void VanadisNodeOSComponent::pageFault( PageFault *info )
     } 
 }
 
-bool VanadisNodeOSComponent::PageMemReadReq::handleResp( StandardMem::Request* ev ) {
+void VanadisNodeOSComponent::PageMemReadReq::handleResp( StandardMem::Request* ev ) {
     
     //printf("PageMemReadReq::%s()\n",__func__);
     auto iter = reqMap.find( ev->getID() ); 
@@ -915,46 +963,37 @@ bool VanadisNodeOSComponent::PageMemReadReq::handleResp( StandardMem::Request* e
     reqMap.erase( iter );
 
     delete ev;
-
-    if ( offset < length ) {
-        sendReq();
-    }
-
-    return reqMap.empty();
 }
 
-void VanadisNodeOSComponent::PageMemReadReq::sendReq() {
+StandardMem::Request* VanadisNodeOSComponent::PageMemReadReq::nextReq() {
 
     //printf("PageMemReadReq::%s()\n",__func__);
     if ( m_currentReqOffset < length ) {
         StandardMem::Request* req = new SST::Interfaces::StandardMem::Read( addr + m_currentReqOffset, 64 );
         reqMap[req->getID()] = m_currentReqOffset;
         m_currentReqOffset += 64;
-        mem_if->send(req);
+        return req;
     }
+    return nullptr;
 }
 
-bool VanadisNodeOSComponent::PageMemWriteReq::handleResp( StandardMem::Request* ev ) {
+void VanadisNodeOSComponent::PageMemWriteReq::handleResp( StandardMem::Request* ev ) {
     //printf("PageMemWriteReq::%s()\n",__func__);
     auto iter = reqMap.find( ev->getID() ); 
     assert ( iter != reqMap.end() );
     reqMap.erase( iter );
     delete ev;
-    if ( offset < length ) {
-        sendReq();
-    }
-    return reqMap.empty();
 }
 
-void VanadisNodeOSComponent::PageMemWriteReq::sendReq() {
+StandardMem::Request* VanadisNodeOSComponent::PageMemWriteReq::nextReq() {
     //printf("PageMemWriteReq::%s()\n",__func__);
     if ( offset < length ) {
-        std::vector< uint8_t > buffer( 64);  
+        std::vector< uint8_t > buffer( data + offset, data + offset + 64 );
 
-        memcpy( buffer.data(), data + offset, buffer.size() );
-        StandardMem::Request* req = new SST::Interfaces::StandardMem::Write( addr + offset, buffer.size(), buffer );
+        StandardMem::Request* req = new SST::Interfaces::StandardMem::Write( addr + offset, buffer.size(), std::move(buffer) );
         reqMap[req->getID()] = offset;
-        offset += buffer.size();
-        mem_if->send(req);
+        offset += 64;
+        return req;
     }
+    return nullptr;
 }
@@ -57,6 +57,9 @@ public:
                             { "physMemSize", "Size of available physical memory in bytes, with units. Ex: 2GiB", NULL },
                             { "page_size", "Size of a page, in bytes", "4096" },
                             { "useMMU", "Whether an MMU subcomponent is being used.", "False" },
+                            { "maxPageTransfers", "Number of page reads and writes the OS keeps in flight to memory at once", "4" },
+                            { "syscallMemoryWindow", "Number of line requests a system call (such as read or write) keeps in flight to memory at once, "
+                              "the lines in flight are all on one page", "1" },
                             { "process%(processnum)d.env_count", "Number of environment variables to pass to the process", "0"},
                             { "process%(processnum)d.env%(argnum)d", "Environment variable to pass to the process. Example: 'OMPNUMTHREADS=64'. 'argnum' should be contiguous starting at 0 and ending at env_count-1", ""},
                             { "proccess%(processnum)d.exe", "Name of executable, including path", NULL},
@@ -65,6 +68,11 @@ public:
                             { "process%(processnum)d.arg%(argnum)d", "Arguments for the executable. Each argument should be specified in a separate parameter and 'argnum' should be contigous starting at 1 to argc-1", ""},
                             )
 
+    SST_ELI_DOCUMENT_STATISTICS({ "syscall_latency", "Time from a system call arriving at the OS until its response is sent", "nanoseconds", 1 },
+                                { "page_fault_latency", "Time from a page fault arriving at the OS until it is resolved", "nanoseconds", 1 },
+                                { "page_faults_queued", "Page faults that had to wait for an earlier fault on the same page", "faults", 1 },
+                                { "page_transfers_queued", "Page reads and writes that had to wait for a free transfer slot", "transfers", 1 })
+
     SST_ELI_DOCUMENT_PORTS({ "core%(cores)d", "Connects to a CPU core", {} })
 
     SST_ELI_DOCUMENT_SUBCOMPONENT_SLOTS({ "mem_interface", "Interface to memory system for data access",
@@ -86,8 +94,10 @@ private:
             (*callback)();
             delete callback;
         }
-        virtual bool handleResp( StandardMem::Request* ev = nullptr ) = 0;
-        virtual void sendReq() = 0;
+        virtual void handleResp( StandardMem::Request* ev ) = 0;
+        // the next request of this transfer, nullptr once all have been issued
+        virtual StandardMem::Request* nextReq() = 0;
+        bool isDone() { return reqMap.empty(); }
       protected:
         StandardMem* mem_if;
         size_t offset;
@@ -107,8 +117,8 @@ private:
             delete[] data;
         }
 
-        bool handleResp( StandardMem::Request* ev );
-        void sendReq();
+        void handleResp( StandardMem::Request* ev );
+        StandardMem::Request* nextReq();
     };
 
     class PageMemReadReq : public PageMemReq {
@@ -118,8 +128,8 @@ private:
 
         virtual ~PageMemReadReq() { }
 
-        bool handleResp( StandardMem::Request* ev );
-        void sendReq();
+        void handleResp( StandardMem::Request* ev );
+        StandardMem::Request* nextReq();
       private:
         size_t m_currentReqOffset;
     };
@@ -128,7 +138,7 @@ private:
         PageFault(MMU_Lib::RequestID reqId, unsigned link, unsigned core,unsigned hwThread, unsigned pid,  uint32_t vpn,
                             uint32_t faultPerms, uint64_t instPtr, uint64_t memVirtAddr, VanadisSyscall* syscall )
             : reqId(reqId), link(link), core(core), hwThread(hwThread), pid(pid), vpn(vpn), faultPerms(faultPerms),
-                instPtr(instPtr), memVirtAddr(memVirtAddr), syscall(syscall) {}
+                instPtr(instPtr), memVirtAddr(memVirtAddr), syscall(syscall), startTime(0) {}
         MMU_Lib::RequestID reqId;
         unsigned link;
         unsigned core;
@@ -139,6 +149,7 @@ private:
         uint64_t instPtr;
         uint64_t memVirtAddr;
         VanadisSyscall* syscall;
+        uint64_t startTime;
     };
 
 
@@ -152,6 +163,7 @@ private:
     void handleIncomingSyscall(SST::Event* ev);
     VanadisSyscall* handleIncomingSyscall( OS::ProcessInfo*, VanadisSyscallEvent*, SST::Link* core_link );
     void processSyscallPost( VanadisSyscall* syscall );
+    void fillSyscallMemoryWindow( VanadisSyscall* syscall );
 
     void handleIncomingMemory(StandardMem::Request* ev);
 
@@ -188,19 +200,43 @@ private:
         queueBlockMemoryReq( new PageMemReadReq( mem_if, physAddr, page_size, data, callback ) );
     }
 
+    // page transfers touch distinct pages, up to m_maxBlockXfers of them are
+    // streamed to memory at once and the rest wait in arrival order
     void queueBlockMemoryReq( PageMemReq* req ) {
-        m_blockMemoryWriteReqQ.push( req );
-        if ( 1 == m_blockMemoryWriteReqQ.size() ) {
-            startBlockXfer( m_blockMemoryWriteReqQ.front() );    
+        if ( m_activeBlockXfers < m_maxBlockXfers ) {
+            startBlockXfer( req );
+        } else {
+            stat_page_xfers_queued->addData(1);
+            m_blockMemoryWriteReqQ.push( req );
         }
     } 
 
     void startBlockXfer( PageMemReq* req ) {
+        ++m_activeBlockXfers;
         // this specfies how many requests should be initially sent before waiting for a response 
         // this value was choose because hight does not increase performance, for the configuration used to test
         unsigned startWithNum = 6;
         for ( int i = 0; i < startWithNum; i++ ) {  
-            req->sendReq();
+            sendBlockReq( req );
+        }
+    }
+
+    void sendBlockReq( PageMemReq* req ) {
+        auto ev = req->nextReq();
+        if ( ev ) {
+            m_blockMemoryRespMap[ev->getID()] = req;
+            mem_if->send( ev );
+        }
+    }
+
+    void finishBlockXfer( PageMemReq* req ) {
+        --m_activeBlockXfers;
+        // runs the transfer's callback, which may queue the next transfer of the same fault
+        delete req;
+        while ( m_activeBlockXfers < m_maxBlockXfers && ! m_blockMemoryWriteReqQ.empty() ) {
+            auto next = m_blockMemoryWriteReqQ.front();
+            m_blockMemoryWriteReqQ.pop();
+            startBlockXfer( next );
         }
     }
 
@@ -301,6 +337,10 @@ public:
 
     Output* getOutput() { return output; }
 
+    // system calls stamp themselves on creation and report when they respond
+    uint64_t syscallStart() { return getCurrentSimTimeNano(); }
+    void syscallFinish( uint64_t startTime ) { stat_syscall_latency->addData( getCurrentSimTimeNano() - startTime ); }
+
     void setSyscall( int core, int hwThread, VanadisSyscall* syscall) {
         output->verbose(CALL_INFO, 16, VANADIS_OS_DBG_SYSCALL,"core=%d hwThread=%d\n",core,hwThread);
         m_coreInfoMap[core].setSyscall( hwThread, syscall ); 
@@ -357,6 +397,7 @@ public:
     int getNodeNum() { return m_nodeNum; }
     int getPageSize() { return m_pageSize; }
     int getPageShift() { return m_pageShift; }
+    unsigned getSyscallMemoryWindow() { return m_syscallMemWindow; }
 
 private:
 
@@ -375,10 +416,16 @@ private:
     int                         m_nodeNum;
     uint64_t                    m_osStartTimeNano;
 
-    std::queue<PageFault*>                          m_pendingFault;
+    // faults are serialized per virtual page number, faults on different
+    // pages, from any process, are handled concurrently
+    std::unordered_map<uint32_t, std::queue<PageFault*> > m_pendingFault;
     std::map<std::string, VanadisELFInfo* >         m_elfMap; 
     std::unordered_map<uint32_t,OS::ProcessInfo*>   m_threadMap;
     std::queue<PageMemReq*>                         m_blockMemoryWriteReqQ;
+    std::unordered_map<StandardMem::Request::id_t, PageMemReq*> m_blockMemoryRespMap;
+    unsigned                                        m_activeBlockXfers;
+    unsigned                                        m_maxBlockXfers;
+    unsigned                                        m_syscallMemWindow;
 
     std::map< VanadisELFInfo*, std::map<int,OS::Page*> >            m_elfPageCache;
     std::unordered_map<StandardMem::Request::id_t, VanadisSyscall*> m_memRespMap;
@@ -389,6 +436,11 @@ private:
 
     int m_currentTid;
 
+    Statistic<uint64_t>* stat_syscall_latency;
+    Statistic<uint64_t>* stat_page_fault_latency;
+    Statistic<uint64_t>* stat_page_faults_queued;
+    Statistic<uint64_t>* stat_page_xfers_queued;
+
     OS::Page* allocPage() {
         auto page = new OS::Page(m_physMemMgr);
         output->verbose(CALL_INFO, 1, VANADIS_OS_DBG_PAGE_FAULT,"ppn=%d\n",page->getPPN());
@@ -397,6 +449,7 @@ private:
 
     std::string m_checkpointDir;
     enum { NO_CHECKPOINT, CHECKPOINT_LOAD, CHECKPOINT_SAVE }  m_checkpoint;
+    VanadisCheckpointFormat m_checkpointFormat;
 
     void checkpoint( std::string dir );
     int checkpointLoad( std::string dir );
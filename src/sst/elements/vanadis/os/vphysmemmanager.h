@@ -16,6 +16,7 @@
 #ifndef _PHYSMEMMANAGER_H
 #define _PHYSMEMMANAGER_H
 
+#include <algorithm>
 #include <stddef.h>
 #include <vector>
 #include <stdint.h>
@@ -25,6 +26,7 @@
 #include <sstream>
 
 #include "output.h"
+#include "util/vcheckpointio.h"
 #include "vanadisDbgFlags.h"
 
 #define FOUR_KB 4096
@@ -33,10 +35,14 @@
     
 class PhysMemManager {
   public:
+    // Two level bitmap, one bit per 4KB page. A summary bit per 64-bit word
+    // says the word is full, free pages are found by skipping full words in
+    // the summary and then counting trailing zeros, 4096 pages per summary word
     class BitMap {
       public:
-        BitMap( int size ) {
+        BitMap( size_t size ) {
              m_bitMap.resize( size/64, 0 );
+             rebuildSummary();
         }
         void print() {
             for ( size_t i = 0; i < m_bitMap.size(); i++ ) {
@@ -44,30 +50,71 @@ class PhysMemManager {
             }
             printf("\n");
         }
-        bool getBit( int pos ) { return ( m_bitMap.at( pos/64 ) >> ( pos % 64 ) ) & 1; }
-        void setBit( int pos ) { m_bitMap.at( pos/64 ) |= ( 1UL << ( pos % 64 ) ); }
-        void clearBit( int pos ) { m_bitMap.at( pos/64 ) &= ~( 1UL << ( pos % 64 ) ); }
+        size_t size() const { return m_bitMap.size() * 64; }
+
+        bool getBit( size_t pos ) { return ( m_bitMap.at( pos/64 ) >> ( pos % 64 ) ) & 1; }
+        void setBit( size_t pos ) { setWordBits( pos/64, 1ULL << ( pos % 64 ) ); }
+        void clearBit( size_t pos ) { clearWordBits( pos/64, 1ULL << ( pos % 64 ) ); }
 
         size_t findFirstEmptyBit( size_t start ) {
-            for ( size_t i = start/64; i < m_bitMap.size(); i++ ) {
-                if ( m_bitMap[i] != 0xffffffffffff ) {
-
-                    for ( int j = i == start/64 ? start % 64: 0; j < 64; j++ ) {
-                        if ( ! getBit( i * 64 + j ) ) {
-                            return i * 64 + j; 
-                        }
-                    }
-                } 
+            size_t word = start/64;
+            if ( word >= m_bitMap.size() ) {
+                throw -1;
+            }
+
+            // the first word may have free bits before start
+            uint64_t free = ~m_bitMap[word] & ( ~0ULL << ( start % 64 ) );
+            if ( free ) {
+                return word * 64 + __builtin_ctzll( free );
+            }
+
+            ++word;
+            for ( size_t i = word/64; i < m_full.size(); i++ ) {
+                uint64_t notFull = ~m_full[i];
+                if ( i == word/64 ) {
+                    notFull &= ~0ULL << ( word % 64 );
+                }
+                if ( notFull ) {
+                    // summary bits past the end of the map are kept set
+                    size_t pos = i * 64 + __builtin_ctzll( notFull );
+                    return pos * 64 + __builtin_ctzll( ~m_bitMap[pos] );
+                }
             }
             throw -1; 
         }
 
-        bool findEmptyBits( size_t start, int numBits ) {
-            assert(0);
+        // true if all of [start, start + numBits) are clear
+        bool findEmptyBits( size_t start, size_t numBits ) {
+            if ( start + numBits > size() ) {
+                return false;
+            }
+            for ( size_t pos = start; pos < start + numBits; ) {
+                size_t   word = pos/64;
+                uint64_t mask = wordMask( pos, start + numBits );
+                if ( m_bitMap[word] & mask ) {
+                    return false;
+                }
+                pos = ( word + 1 ) * 64;
+            }
+            return true;
         }
 
-        void setBits( int start, int numBits ) {
-            assert(0);
+        void setBits( size_t start, size_t numBits ) {
+            assert( start + numBits <= size() );
+            for ( size_t pos = start; pos < start + numBits; ) {
+                size_t word = pos/64;
+                setWordBits( word, wordMask( pos, start + numBits ) );
+                pos = ( word + 1 ) * 64;
+            }
+        }
+
+        void clearBits( size_t start, size_t numBits ) {
+            assert( start + numBits <= size() );
+            for ( size_t pos = start; pos < start + numBits; ) {
+                size_t word = pos/64;
+                clearWordBits( word, wordMask( pos, start + numBits ) );
+                pos = ( word + 1 ) * 64;
+            }
         }
 
         void checkpoint( FILE* fp ) {
@@ -90,19 +137,59 @@ class PhysMemManager {
                 output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"%d %#018" PRIx64 "\n",index,value);
                 m_bitMap[index] = value;
             }
+            rebuildSummary();
         }
 
-      private:
+        void checkpoint( SST::Vanadis::VanadisCheckpointWriter& writer ) {
+            writer.write<uint64_t>( m_bitMap.size() );
+            writer.writeBytes( m_bitMap.data(), m_bitMap.size() * sizeof(uint64_t) );
+        }
+
+        void checkpointLoad( SST::Vanadis::VanadisCheckpointReader& reader ) {
+            m_bitMap.resize( reader.read<uint64_t>() );
+            reader.readBytes( m_bitMap.data(), m_bitMap.size() * sizeof(uint64_t) );
+            rebuildSummary();
+        }
 
       private:
+        // bits [pos % 64, end) of the word holding pos, end is clipped to the word
+        static uint64_t wordMask( size_t pos, size_t end ) {
+            size_t lo = pos % 64;
+            size_t hi = std::min<size_t>( end - ( pos - lo ), 64 );
+            uint64_t mask = ( 64 == hi ) ? ~0ULL : ( ( 1ULL << hi ) - 1 );
+            return mask & ( ~0ULL << lo );
+        }
+
+        void setWordBits( size_t word, uint64_t mask ) {
+            m_bitMap.at( word ) |= mask;
+            if ( ~0ULL == m_bitMap[word] ) {
+                m_full[word/64] |= 1ULL << ( word % 64 );
+            }
+        }
+
+        void clearWordBits( size_t word, uint64_t mask ) {
+            m_bitMap.at( word ) &= ~mask;
+            m_full[word/64] &= ~( 1ULL << ( word % 64 ) );
+        }
+
+        void rebuildSummary() {
+            m_full.assign( ( m_bitMap.size() + 63 ) / 64, 0 );
+            for ( size_t i = 0; i < m_full.size() * 64; i++ ) {
+                if ( i >= m_bitMap.size() || ~0ULL == m_bitMap[i] ) {
+                    m_full[i/64] |= 1ULL << ( i % 64 );
+                }
+            }
+        }
+
         std::vector<uint64_t> m_bitMap;
+        std::vector<uint64_t> m_full;
     };
 
   public:
 
     typedef std::vector<uint32_t> PageList;
     enum PageSize { FourKB, TwoMB, OneGB }; 
-    PhysMemManager( size_t memSize ) : m_bitMap( memSize/4096), m_numAllocated(0) { }
+    PhysMemManager( size_t memSize ) : m_bitMap( memSize/FOUR_KB ), m_numAllocated(0) { }
     ~PhysMemManager() {
 #if 0
         if ( m_numAllocated > 1 ) { 
@@ -129,13 +216,12 @@ class PhysMemManager {
         }
     }
 
-    void freePage( size_t pageSize, size_t pageNum ) {
-        if ( FourKB == pageSize ) {
-            --m_numAllocated;
-            m_bitMap.clearBit( pageNum );
-        } else {
-            assert(0);
-        }
+    // pageNum is the first 4KB page of the page, as returned by allocPage()
+    void freePage( PageSize pageSize, size_t pageNum ) {
+        size_t numPages = calcNumNeeded( pageSize );
+        assert( 0 == pageNum % numPages );
+        m_numAllocated -= numPages;
+        m_bitMap.clearBits( pageNum, numPages );
     }
 
     void checkpoint( SST::Output* output, std::string dir ) {
@@ -159,6 +245,26 @@ class PhysMemManager {
         m_bitMap.checkpointLoad(output,fp);
     }
 
+    void checkpointBinary( SST::Output* output, std::string dir ) {
+        std::stringstream filename;
+        filename << dir << "/" << "PhysMemManager";
+
+        output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"PhysMemManager %s\n", filename.str().c_str());
+
+        SST::Vanadis::VanadisCheckpointWriter writer( output, filename.str(), SST::Vanadis::VANADIS_CHECKPOINT_PHYS_MEM );
+        writer.write<uint64_t>( m_numAllocated );
+        m_bitMap.checkpoint( writer );
+    }
+    void checkpointLoadBinary( SST::Output* output, std::string dir ) {
+        std::stringstream filename;
+        filename << dir << "/" << "PhysMemManager";
+
+        SST::Vanadis::VanadisCheckpointReader reader( output, filename.str(), SST::Vanadis::VANADIS_CHECKPOINT_PHYS_MEM );
+        m_numAllocated = reader.read<uint64_t>();
+        output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"m_numAllocated %" PRIu64 "\n",m_numAllocated);
+        m_bitMap.checkpointLoad( reader );
+    }
+
   private:
     int calcNumNeeded( PageSize pageSize ) {
         switch( pageSize ) {
@@ -169,35 +275,37 @@ class PhysMemManager {
         }
     }
 
+    // returns the first 4KB page of a naturally aligned run of free pages
+    // covering pageSize, throws if there is none
     int findFreePage( PageSize pageSize ) {
-        if ( FourKB == pageSize ) {
+        size_t numNeeded = calcNumNeeded( pageSize );
+
+        if ( 1 == numNeeded ) {
             size_t page = m_bitMap.findFirstEmptyBit(0);
             m_bitMap.setBit( page );
             ++m_numAllocated;
             return page;
         }   
-        assert(0);
 
-        int startPage = 0;
-        int numNeeded = calcNumNeeded( pageSize );
+        size_t startPage = 0;
 
         while ( 1 ) {
+            // skip to the first free page and round up to the alignment
             startPage = m_bitMap.findFirstEmptyBit( startPage );
+            startPage = ( ( startPage + numNeeded - 1 ) / numNeeded ) * numNeeded;
 
-            // if the page is aligned 
-            if ( 0 == startPage % numNeeded ) {
-                // check to see if there are enough empty 4K pages to cover this page size
-                if ( m_bitMap.findEmptyBits( startPage, numNeeded ) ) {
-                    m_bitMap.setBits( startPage, numNeeded );
-                    return startPage;
-                } else {
-                    // move the start page enough 4K pages to keep aligned
-                    startPage += numNeeded;
-                }
-            } else {
-                // was not aligned, move the start page by one
-                startPage += 1;
+            if ( startPage + numNeeded > m_bitMap.size() ) {
+                throw -1;
             }
+
+            // check to see if there are enough empty 4K pages to cover this page size
+            if ( m_bitMap.findEmptyBits( startPage, numNeeded ) ) {
+                m_bitMap.setBits( startPage, numNeeded );
+                m_numAllocated += numNeeded;
+                return startPage;
+            }
+
+            startPage += numNeeded;
         }
     }
 
@@ -82,6 +82,7 @@ rob_slots = os.getenv("VANADIS_ROB_SLOTS", 64)
 retires_per_cycle = os.getenv("VANADIS_RETIRES_PER_CYCLE", 4)
 issues_per_cycle = os.getenv("VANADIS_ISSUES_PER_CYCLE", 4)
 decodes_per_cycle = os.getenv("VANADIS_DECODES_PER_CYCLE", 4)
+issue_queue = os.getenv("VANADIS_ISSUE_QUEUE", "0") == "1"
 
 integer_arith_cycles = int(os.getenv("VANADIS_INTEGER_ARITH_CYCLES", 2))
 integer_arith_units = int(os.getenv("VANADIS_INTEGER_ARITH_UNITS", 2))
@@ -104,6 +105,11 @@ if (verbosity > 0):
 
 app_args = os.getenv("VANADIS_EXE_ARGS", "")
 
+# Optional private L3 per core (e.g. "4MB") and DRAM timing instead of the
+# fixed-latency memory, used by the system benchmarks
+l3_size = os.getenv("VANADIS_L3_SIZE", "")
+mem_backend = os.getenv("VANADIS_MEM_BACKEND", "simpleMem")
+
 app_params = {}
 if app_args != "":
     app_args_list = app_args.split(" ")
@@ -261,6 +267,7 @@ cpuParams = {
     "reorder_slots" : rob_slots,
     "decodes_per_cycle" : decodes_per_cycle,
     "issues_per_cycle" :  issues_per_cycle,
+    "issue_queue" : issue_queue,
     "retires_per_cycle" : retires_per_cycle,
     "pause_when_retire_address" : os.getenv("VANADIS_HALT_AT_ADDRESS", 0),
     "start_verbose_when_issue_address": dbgAddr,
@@ -317,6 +324,18 @@ l2cacheParams = {
     "debug" : mh_debug,
     "debug_level" : mh_debug_level,
 }
+l3cacheParams = {
+    "access_latency_cycles" : "30",
+    "cache_frequency" : cpu_clock,
+    "replacement_policy" : "lru",
+    "coherence_protocol" : protocol,
+    "associativity" : "16",
+    "cache_line_size" : "64",
+    "cache_size" : l3_size,
+    "mshr_latency_cycles": 3,
+    "debug" : mh_debug,
+    "debug_level" : mh_debug_level,
+}
 busParams = { 
     "bus_frequency" : cpu_clock, 
 }
@@ -395,7 +414,20 @@ class CPU_Builder:
         l2cache_2_l1caches = cpu_l2cache.setSubComponent("cpulink", "memHierarchy.MemLink")
 
         # L2 cache mem interface
-        l2cache_2_mem = cpu_l2cache.setSubComponent("memlink", "memHierarchy.MemNIC")
+        if l3_size:
+            l2cache_2_l3cache = cpu_l2cache.setSubComponent("memlink", "memHierarchy.MemLink")
+
+            # L3 cache
+            cpu_l3cache = sst.Component(prefix+".l3cache", "memHierarchy.Cache")
+            cpu_l3cache.addParams( l3cacheParams )
+            l3cache_2_l2cache = cpu_l3cache.setSubComponent("cpulink", "memHierarchy.MemLink")
+            l2cache_2_mem = cpu_l3cache.setSubComponent("memlink", "memHierarchy.MemNIC")
+
+            link_l2cache_l3cache_link = sst.Link(prefix+".link_l2cache_l3cache_link")
+            link_l2cache_l3cache_link.connect( (l2cache_2_l3cache, "port", "1ns"), (l3cache_2_l2cache, "port", "1ns") )
+            link_l2cache_l3cache_link.setNoCut()
+        else:
+            l2cache_2_mem = cpu_l2cache.setSubComponent("memlink", "memHierarchy.MemNIC")
         l2cache_2_mem.addParams( l2memLinkParams )
 
         # L1 to L2 buss
@@ -517,8 +549,31 @@ memctrl.addParams( memCtrlParams )
 memToDir = memctrl.setSubComponent("cpulink", "memHierarchy.MemLink")
 
 # node memory controller backend 
-memory = memctrl.setSubComponent("backend", "memHierarchy.simpleMem")
-memory.addParams(memParams)
+if mem_backend == "timingDRAM":
+    memory = memctrl.setSubComponent("backend", "memHierarchy.timingDRAM")
+    memory.addParams({
+        "id" : 0,
+        "addrMapper" : "memHierarchy.roundRobinAddrMapper",
+        "addrMapper.interleave_size" : "64B",
+        "addrMapper.row_size" : "1KiB",
+        "clock" : "1.2GHz",
+        "mem_size" : memParams["mem_size"],
+        "channels" : 2,
+        "channel.numRanks" : 2,
+        "channel.rank.numBanks" : 8,
+        "channel.transaction_Q_size" : 32,
+        "channel.rank.bank.CL" : 14,
+        "channel.rank.bank.CL_WR" : 12,
+        "channel.rank.bank.RCD" : 14,
+        "channel.rank.bank.TRP" : 14,
+        "channel.rank.bank.dataCycles" : 2,
+        "channel.rank.bank.pagePolicy" : "memHierarchy.simplePagePolicy",
+        "channel.rank.bank.transactionQ" : "memHierarchy.reorderTransactionQ",
+        "channel.rank.bank.pagePolicy.close" : 0,
+    })
+else:
+    memory = memctrl.setSubComponent("backend", "memHierarchy.simpleMem")
+    memory.addParams(memParams)
 
 # node OS data TLB
 #ostlbWrapper = sst.Component("ostlb", "mmu.tlb_wrapper")
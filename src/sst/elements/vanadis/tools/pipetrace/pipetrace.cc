@@ -0,0 +1,236 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+// Converts a binary Vanadis pipeline trace (pipeline_trace_format=binary) to
+// Konata, Chrome trace event JSON or the text trace the core writes by
+// default, so it can be compared with sst-vanadis-tracediff.
+
+#include "util/vpipetraceformat.h"
+
+#include <algorithm>
+#include <cinttypes>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+#include <vector>
+
+using namespace SST::Vanadis;
+
+struct TraceEntry {
+    VanadisPipelineTraceRecord record;
+    uint64_t                   id;
+};
+
+static void
+usage() {
+    fprintf(stderr, "usage: sst-vanadis-pipetrace [--konata|--chrome|--text] <trace> [<output>]\n");
+    exit(1);
+}
+
+static bool
+read_trace(FILE* input, std::vector<std::string>& names, std::vector<TraceEntry>& entries) {
+    char     magic[sizeof(VANADIS_PIPE_TRACE_MAGIC)];
+    uint32_t version;
+
+    if ( (1 != fread(magic, sizeof(magic), 1, input)) || (0 != memcmp(magic, VANADIS_PIPE_TRACE_MAGIC, sizeof(magic))) ) {
+        fprintf(stderr, "Error: not a Vanadis binary pipeline trace.\n");
+        return false;
+    }
+
+    if ( (1 != fread(&version, sizeof(version), 1, input)) || (VANADIS_PIPE_TRACE_VERSION != version) ) {
+        fprintf(stderr, "Error: unsupported pipeline trace version.\n");
+        return false;
+    }
+
+    uint8_t tag;
+
+    while ( 1 == fread(&tag, sizeof(tag), 1, input) ) {
+        if ( VANADIS_PIPE_TRACE_NAME == tag ) {
+            uint16_t id;
+            uint16_t length;
+
+            if ( (1 != fread(&id, sizeof(id), 1, input)) || (1 != fread(&length, sizeof(length), 1, input)) ) {
+                fprintf(stderr, "Error: truncated name entry.\n");
+                return false;
+            }
+
+            std::string name(length, '\0');
+
+            if ( (length > 0) && (1 != fread(&name[0], length, 1, input)) ) {
+                fprintf(stderr, "Error: truncated name entry.\n");
+                return false;
+            }
+
+            if ( id >= names.size() ) { names.resize(id + 1); }
+            names[id] = name;
+        }
+        else if ( VANADIS_PIPE_TRACE_RETIRE == tag ) {
+            TraceEntry entry;
+
+            if ( 1 != fread(&entry.record, sizeof(entry.record), 1, input) ) {
+                fprintf(stderr, "Error: truncated retire entry.\n");
+                return false;
+            }
+
+            if ( entry.record.code >= names.size() ) {
+                fprintf(stderr, "Error: retire entry refers to an unknown instruction code.\n");
+                return false;
+            }
+
+            entry.id = entries.size();
+            entries.push_back(entry);
+        }
+        else {
+            fprintf(stderr, "Error: unknown entry tag %" PRIu8 ".\n", tag);
+            return false;
+        }
+    }
+
+    return true;
+}
+
+static void
+write_text(FILE* output, const std::vector<std::string>& names, const std::vector<TraceEntry>& entries) {
+    for ( const TraceEntry& entry : entries ) {
+        fprintf(output, "0x%08" PRIx64 " %s\n", entry.record.address, names[entry.record.code].c_str());
+    }
+}
+
+static void
+write_chrome(FILE* output, const std::vector<std::string>& names, const std::vector<TraceEntry>& entries) {
+    // one cycle is shown as one microsecond
+    fprintf(output, "{\"traceEvents\":[\n");
+
+    for ( size_t i = 0; i < entries.size(); ++i ) {
+        const VanadisPipelineTraceRecord& record = entries[i].record;
+        const uint64_t duration = (record.retire_cycle > record.issue_cycle) ? (record.retire_cycle - record.issue_cycle) : 1;
+
+        fprintf(output,
+            "{\"name\":\"%s\",\"cat\":\"uop\",\"ph\":\"X\",\"ts\":%" PRIu64 ",\"dur\":%" PRIu64 ",\"pid\":0,\"tid\":%" PRIu32
+            ",\"args\":{\"address\":\"0x%" PRIx64 "\"}}%s\n",
+            names[record.code].c_str(), record.issue_cycle, duration, record.hw_thread, record.address,
+            (i + 1 < entries.size()) ? "," : "");
+    }
+
+    fprintf(output, "]}\n");
+}
+
+struct KonataEvent {
+    uint64_t cycle;
+    uint64_t id;
+    int      kind;
+};
+
+enum { KONATA_ISSUE = 0, KONATA_RETIRE = 1, KONATA_REMOVE = 2 };
+
+static void
+write_konata(FILE* output, const std::vector<std::string>& names, const std::vector<TraceEntry>& entries) {
+    std::vector<KonataEvent> events;
+    events.reserve(entries.size() * 3);
+
+    for ( const TraceEntry& entry : entries ) {
+        events.push_back({ entry.record.issue_cycle, entry.id, KONATA_ISSUE });
+        events.push_back({ entry.record.retire_cycle, entry.id, KONATA_RETIRE });
+        events.push_back({ entry.record.retire_cycle + 1, entry.id, KONATA_REMOVE });
+    }
+
+    // Konata wants the log in cycle order, the trace is in retire order
+    std::stable_sort(events.begin(), events.end(), [](const KonataEvent& l, const KonataEvent& r) {
+        return (l.cycle != r.cycle) ? (l.cycle < r.cycle) : (l.kind < r.kind);
+    });
+
+    fprintf(output, "Kanata\t0004\n");
+
+    if ( events.empty() ) { return; }
+
+    uint64_t cycle = events.front().cycle;
+    fprintf(output, "C=\t%" PRIu64 "\n", cycle);
+
+    for ( const KonataEvent& event : events ) {
+        if ( event.cycle != cycle ) {
+            fprintf(output, "C\t%" PRIu64 "\n", event.cycle - cycle);
+            cycle = event.cycle;
+        }
+
+        const VanadisPipelineTraceRecord& record = entries[event.id].record;
+
+        switch ( event.kind ) {
+        case KONATA_ISSUE:
+            fprintf(output, "I\t%" PRIu64 "\t%" PRIu64 "\t%" PRIu32 "\n", event.id, event.id, record.hw_thread);
+            fprintf(output, "L\t%" PRIu64 "\t0\t0x%08" PRIx64 " %s\n", event.id, record.address, names[record.code].c_str());
+            fprintf(output, "S\t%" PRIu64 "\t0\tIs\n", event.id);
+            break;
+        case KONATA_RETIRE:
+            fprintf(output, "S\t%" PRIu64 "\t0\tCm\n", event.id);
+            break;
+        case KONATA_REMOVE:
+            fprintf(output, "R\t%" PRIu64 "\t%" PRIu64 "\t0\n", event.id, event.id);
+            break;
+        }
+    }
+}
+
+int
+main(int argc, char* argv[]) {
+    std::string format = "konata";
+    int         arg    = 1;
+
+    if ( (arg < argc) && (0 == strncmp(argv[arg], "--", 2)) ) {
+        format = std::string(argv[arg] + 2);
+        arg++;
+    }
+
+    if ( (format != "konata") && (format != "chrome") && (format != "text") ) { usage(); }
+    if ( (arg >= argc) || (argc - arg > 2) ) { usage(); }
+
+    FILE* input = fopen(argv[arg], "rb");
+
+    if ( nullptr == input ) {
+        fprintf(stderr, "File: %s cannot be opened.\n", argv[arg]);
+        exit(1);
+    }
+
+    FILE* output = stdout;
+
+    if ( argc - arg == 2 ) {
+        output = fopen(argv[arg + 1], "wt");
+
+        if ( nullptr == output ) {
+            fprintf(stderr, "File: %s cannot be opened.\n", argv[arg + 1]);
+            exit(1);
+        }
+    }
+
+    std::vector<std::string> names;
+    std::vector<TraceEntry>  entries;
+
+    const bool success = read_trace(input, names, entries);
+    fclose(input);
+
+    if ( success ) {
+        if ( format == "konata" ) { write_konata(output, names, entries); }
+        else if ( format == "chrome" ) {
+            write_chrome(output, names, entries);
+        }
+        else {
+            write_text(output, names, entries);
+        }
+    }
+
+    if ( output != stdout ) { fclose(output); }
+
+    return success ? 0 : 1;
+}
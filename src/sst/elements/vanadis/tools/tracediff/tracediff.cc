@@ -13,11 +13,31 @@
 // information, see the LICENSE file in the top level directory of the
 // distribution.
 
+// Compares two Vanadis traces. Text traces are compared line by line.
+// Commit traces (pipeline_trace_format=commit) are compared record by
+// record in parallel chunks, and after a divergence the comparison is
+// resynchronized by looking the next matching run of records up in an
+// index of instruction addresses.
+
+#include "util/vpipetraceformat.h"
+
+#include <algorithm>
 #include <cassert>
+#include <cinttypes>
 #include <cstdio>
 #include <cstdlib>
 #include <cstring>
 #include <string>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace SST::Vanadis;
 
 void
 read_line(FILE* input_file, char* buffer) {
@@ -48,19 +68,286 @@ generate_error(int left_line, int right_line, const char* error_msg) {
     fprintf(stderr, "Error left-line: %d, right-line: %d, cause: %s\n", left_line, right_line, error_msg);
 }
 
+struct CommitTrace {
+    const VanadisCommitTraceRecord* records;
+    size_t                          count;
+    void*                           map;
+    size_t                          map_length;
+};
+
+static const size_t COMMIT_TRACE_HEADER =
+    sizeof(VANADIS_COMMIT_TRACE_MAGIC) + sizeof(VANADIS_COMMIT_TRACE_VERSION) + sizeof(uint32_t);
+
+static bool
+is_commit_trace(const char* path) {
+    char magic[sizeof(VANADIS_COMMIT_TRACE_MAGIC)];
+    FILE* fp = fopen(path, "rb");
+
+    if (fp == NULL) {
+        return false;
+    }
+
+    const bool found = (1 == fread(magic, sizeof(magic), 1, fp)) &&
+                       (0 == memcmp(magic, VANADIS_COMMIT_TRACE_MAGIC, sizeof(magic)));
+    fclose(fp);
+    return found;
+}
+
+static void
+open_commit_trace(const char* path, CommitTrace& trace) {
+    int fd = open(path, O_RDONLY);
+    struct stat info;
+
+    if (fd < 0 || fstat(fd, &info) != 0 || (size_t) info.st_size < COMMIT_TRACE_HEADER) {
+        fprintf(stderr, "File: %s cannot be opened as a commit trace.\n", path);
+        exit(1);
+    }
+
+    trace.map_length = info.st_size;
+    trace.map = mmap(NULL, trace.map_length, PROT_READ, MAP_PRIVATE, fd, 0);
+    close(fd);
+
+    if (trace.map == MAP_FAILED) {
+        fprintf(stderr, "File: %s cannot be mapped.\n", path);
+        exit(1);
+    }
+
+    const char* bytes = static_cast<const char*>(trace.map);
+    uint32_t version;
+    uint32_t record_size;
+    memcpy(&version, bytes + sizeof(VANADIS_COMMIT_TRACE_MAGIC), sizeof(version));
+    memcpy(&record_size, bytes + sizeof(VANADIS_COMMIT_TRACE_MAGIC) + sizeof(version), sizeof(record_size));
+
+    if (version != VANADIS_COMMIT_TRACE_VERSION || record_size != sizeof(VanadisCommitTraceRecord)) {
+        fprintf(stderr, "File: %s has an unsupported commit trace version.\n", path);
+        exit(1);
+    }
+
+    trace.records = reinterpret_cast<const VanadisCommitTraceRecord*>(bytes + COMMIT_TRACE_HEADER);
+    trace.count = (trace.map_length - COMMIT_TRACE_HEADER) / sizeof(VanadisCommitTraceRecord);
+}
+
+static bool
+same_record(const VanadisCommitTraceRecord& l, const VanadisCommitTraceRecord& r) {
+    return 0 == memcmp(&l, &r, sizeof(VanadisCommitTraceRecord));
+}
+
+static void
+print_record(const char* side, size_t index, const VanadisCommitTraceRecord& rec) {
+    fprintf(stderr, "%s %zu: thr %" PRIu32 " 0x%08" PRIx64 " %-16.16s", side, index, rec.hw_thread, rec.address,
+            rec.code);
+
+    if (rec.reg != VANADIS_COMMIT_TRACE_NO_REG) {
+        fprintf(stderr, " r%" PRIu16 "=0x%" PRIx64, rec.reg, rec.reg_value);
+    }
+
+    if (rec.mem_kind != VANADIS_COMMIT_TRACE_NO_MEM) {
+        fprintf(stderr, " %s 0x%" PRIx64 "/%" PRIu8, rec.mem_kind == VANADIS_COMMIT_TRACE_LOAD ? "load" : "store",
+                rec.mem_address, rec.mem_width);
+    }
+
+    fprintf(stderr, "\n");
+}
+
+// First position in [0, count) where left[i] and right[i] differ, or count.
+// The range is split into one chunk per thread.
+static size_t
+first_mismatch(const VanadisCommitTraceRecord* left, const VanadisCommitTraceRecord* right, size_t count,
+               unsigned threads) {
+    const size_t chunk = std::max((size_t) 1 << 16, (count + threads - 1) / threads);
+    std::vector<size_t> found;
+    std::vector<std::thread> workers;
+
+    for (size_t start = 0; start < count; start += chunk) {
+        found.push_back(count);
+    }
+
+    for (size_t c = 0; c < found.size(); c++) {
+        workers.emplace_back([&, c]() {
+            const size_t end = std::min(count, (c + 1) * chunk);
+            for (size_t i = c * chunk; i < end; i++) {
+                if (!same_record(left[i], right[i])) {
+                    found[c] = i;
+                    break;
+                }
+            }
+        });
+    }
+
+    for (std::thread& worker : workers) {
+        worker.join();
+    }
+
+    for (size_t f : found) {
+        if (f < count) {
+            return f;
+        }
+    }
+
+    return count;
+}
+
+// After a divergence at (li, ri), find the closest pair of positions within
+// window records where run records match again. The right side of the
+// window is indexed by instruction address.
+static bool
+resync(const CommitTrace& left, const CommitTrace& right, size_t li, size_t ri, size_t window, size_t run,
+       size_t& new_li, size_t& new_ri) {
+    std::unordered_map<uint64_t, std::vector<size_t>> index;
+    const size_t right_end = std::min(right.count, ri + window);
+
+    for (size_t r = ri; r < right_end; r++) {
+        index[right.records[r].address].push_back(r);
+    }
+
+    size_t best = window * 2;
+    const size_t left_end = std::min(left.count, li + window);
+
+    for (size_t l = li; l < left_end && (l - li) < best; l++) {
+        auto candidates = index.find(left.records[l].address);
+
+        if (candidates == index.end()) {
+            continue;
+        }
+
+        for (size_t r : candidates->second) {
+            if ((l - li) + (r - ri) >= best) {
+                break;
+            }
+
+            size_t matched = 0;
+            while (matched < run && (l + matched) < left.count && (r + matched) < right.count &&
+                   same_record(left.records[l + matched], right.records[r + matched])) {
+                matched++;
+            }
+
+            // a match that reaches the end of both traces also counts
+            if (matched == run || ((l + matched) == left.count && (r + matched) == right.count)) {
+                best   = (l - li) + (r - ri);
+                new_li = l;
+                new_ri = r;
+            }
+        }
+    }
+
+    return best < window * 2;
+}
+
+static int
+diff_commit_traces(const char* left_path, const char* right_path, unsigned threads, size_t max_diffs,
+                   size_t window, size_t run) {
+    CommitTrace left;
+    CommitTrace right;
+
+    open_commit_trace(left_path, left);
+    open_commit_trace(right_path, right);
+
+    size_t li = 0;
+    size_t ri = 0;
+    size_t diffs = 0;
+
+    while (li < left.count && ri < right.count) {
+        const size_t count = std::min(left.count - li, right.count - ri);
+        const size_t offset = first_mismatch(&left.records[li], &right.records[ri], count, threads);
+
+        li += offset;
+        ri += offset;
+
+        if (offset == count) {
+            break;
+        }
+
+        diffs++;
+        fprintf(stderr, "Error left-record: %zu, right-record: %zu, cause: Records do not match.\n", li, ri);
+        print_record("left", li, left.records[li]);
+        print_record("right", ri, right.records[ri]);
+
+        if (diffs == max_diffs) {
+            fprintf(stderr, "Stopping after %zu differences.\n", diffs);
+            break;
+        }
+
+        size_t new_li = 0;
+        size_t new_ri = 0;
+
+        if (!resync(left, right, li, ri, window, run, new_li, new_ri)) {
+            fprintf(stderr, "Unable to resynchronize within %zu records, stopping.\n", window);
+            break;
+        }
+
+        fprintf(stderr, "Resynchronized at left-record: %zu, right-record: %zu (skipped %zu left, %zu right).\n",
+                new_li, new_ri, new_li - li, new_ri - ri);
+        li = new_li;
+        ri = new_ri;
+    }
+
+    if (diffs < max_diffs && (li < left.count || ri < right.count) && (left.count - li) != (right.count - ri)) {
+        diffs++;
+        fprintf(stderr, "Error left-record: %zu, right-record: %zu, cause: %s file is longer.\n", li, ri,
+                (left.count - li) > (right.count - ri) ? "left" : "right");
+    }
+
+    if (diffs == 0) {
+        printf("Traces match, %zu records.\n", left.count);
+    }
+
+    munmap(left.map, left.map_length);
+    munmap(right.map, right.map_length);
+
+    return diffs == 0 ? 0 : 1;
+}
+
+static void
+usage() {
+    fprintf(stderr, "usage: tracediff [--threads <n>] [--max-diffs <n>] [--window <n>] [--run <n>] <file1> <file2>\n");
+    fprintf(stderr, "       the options apply to commit traces, which also exit with 1 if they differ\n");
+    exit(1);
+}
+
 int
 main(int argc, char* argv[]) {
 
     char* left_file_path = NULL;
     char* right_file_path = NULL;
 
-    if (argc < 3) {
-        fprintf(stderr, "usage: tracediff <file1> <file2>\n");
-        exit(1);
+    unsigned threads = std::max(1u, std::thread::hardware_concurrency());
+    size_t max_diffs = 16;
+    size_t window = 1 << 20;
+    size_t run = 16;
+
+    int arg = 1;
+    while (arg + 1 < argc && 0 == strncmp(argv[arg], "--", 2)) {
+        const std::string opt(argv[arg]);
+        const long value = atol(argv[arg + 1]);
+
+        if (value <= 0) {
+            usage();
+        }
+
+        if (opt == "--threads") {
+            threads = value;
+        } else if (opt == "--max-diffs") {
+            max_diffs = value;
+        } else if (opt == "--window") {
+            window = value;
+        } else if (opt == "--run") {
+            run = value;
+        } else {
+            usage();
+        }
+        arg += 2;
+    }
+
+    if (argc - arg != 2) {
+        usage();
     }
 
-    left_file_path = argv[1];
-    right_file_path = argv[2];
+    left_file_path = argv[arg];
+    right_file_path = argv[arg + 1];
+
+    if (is_commit_trace(left_file_path) && is_commit_trace(right_file_path)) {
+        return diff_commit_traces(left_file_path, right_file_path, threads, max_diffs, window, run);
+    }
 
     FILE* left_file = fopen(left_file_path, "rt");
     FILE* right_file = fopen(right_file_path, "rt");
@@ -0,0 +1,205 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_VANADIS_UTIL_CHECKPOINT_IO
+#define _H_VANADIS_UTIL_CHECKPOINT_IO
+
+#include <sst/core/output.h>
+
+#include <cerrno>
+#include <cinttypes>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <type_traits>
+
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+namespace SST {
+namespace Vanadis {
+
+// Binary checkpoint files start with this tag followed by a format version
+// and a per-file kind (core, physical memory manager, ...) so that restoring
+// from the wrong file fails at once instead of mis-reading values
+static constexpr char     VANADIS_CHECKPOINT_MAGIC[8] = { 'V', 'A', 'N', 'C', 'K', 'P', 'T', '\0' };
+static constexpr uint32_t VANADIS_CHECKPOINT_VERSION  = 1;
+
+enum VanadisCheckpointKind : uint32_t { VANADIS_CHECKPOINT_CORE = 1, VANADIS_CHECKPOINT_PHYS_MEM = 2 };
+
+enum VanadisCheckpointFormat { VANADIS_CHECKPOINT_TEXT, VANADIS_CHECKPOINT_BINARY };
+
+// Parse the checkpointFormat parameter shared by the core and the node OS
+static VanadisCheckpointFormat
+vanadis_checkpoint_format(SST::Output* output, const std::string& format) {
+    if (format.empty() || (0 == format.compare("text"))) {
+        return VANADIS_CHECKPOINT_TEXT;
+    } else if (0 == format.compare("binary")) {
+        return VANADIS_CHECKPOINT_BINARY;
+    }
+
+    output->fatal(CALL_INFO, -1, "Error: unknown checkpointFormat \"%s\", expected \"text\" or \"binary\".\n",
+        format.c_str());
+    return VANADIS_CHECKPOINT_TEXT;
+}
+
+/*
+ * Fixed-width values in host byte order, written through one buffered stream
+ * per file. Each component writes its own file from finish(), so the files
+ * of a node are produced independently of each other.
+ */
+class VanadisCheckpointWriter {
+public:
+    VanadisCheckpointWriter(SST::Output* out, const std::string& file_path, const VanadisCheckpointKind kind) :
+        output(out), path(file_path) {
+        fp = fopen(path.c_str(), "wb");
+
+        if (nullptr == fp) {
+            output->fatal(CALL_INFO, -1, "Error: unable to open checkpoint file %s for writing (%s).\n", path.c_str(),
+                strerror(errno));
+        }
+
+        writeBytes(VANADIS_CHECKPOINT_MAGIC, sizeof(VANADIS_CHECKPOINT_MAGIC));
+        write<uint32_t>(VANADIS_CHECKPOINT_VERSION);
+        write<uint32_t>(kind);
+    }
+
+    ~VanadisCheckpointWriter() {
+        if (0 != fclose(fp)) {
+            output->fatal(CALL_INFO, -1, "Error: failed to complete checkpoint file %s (%s).\n", path.c_str(),
+                strerror(errno));
+        }
+    }
+
+    template <typename T>
+    void write(const T value) {
+        static_assert(std::is_arithmetic<T>::value, "checkpoint values must be fixed-width scalars");
+        writeBytes(&value, sizeof(T));
+    }
+
+    void writeBytes(const void* data, const size_t length) {
+        if (length != fwrite(data, 1, length, fp)) {
+            output->fatal(CALL_INFO, -1, "Error: failed writing %zu bytes to checkpoint file %s (%s).\n", length,
+                path.c_str(), strerror(errno));
+        }
+    }
+
+private:
+    SST::Output*      output;
+    const std::string path;
+    FILE*             fp;
+};
+
+/*
+ * Maps a binary checkpoint file read-only and hands out values from it in
+ * the order they were written. Nothing is copied until a value is read, so
+ * restoring large arrays (the physical page bitmap) costs one memcpy.
+ */
+class VanadisCheckpointReader {
+public:
+    VanadisCheckpointReader(SST::Output* out, const std::string& file_path, const VanadisCheckpointKind kind) :
+        output(out), path(file_path), base(nullptr), length(0), offset(0) {
+        const int fd = open(path.c_str(), O_RDONLY);
+
+        if (fd < 0) {
+            output->fatal(CALL_INFO, -1, "Error: unable to open checkpoint file %s (%s).\n", path.c_str(),
+                strerror(errno));
+        }
+
+        struct stat file_stat;
+
+        if (0 != fstat(fd, &file_stat)) {
+            output->fatal(CALL_INFO, -1, "Error: unable to stat checkpoint file %s (%s).\n", path.c_str(),
+                strerror(errno));
+        }
+
+        length = static_cast<size_t>(file_stat.st_size);
+
+        if (length > 0) {
+            void* mapped = mmap(nullptr, length, PROT_READ, MAP_PRIVATE, fd, 0);
+
+            if (MAP_FAILED == mapped) {
+                output->fatal(CALL_INFO, -1, "Error: unable to map checkpoint file %s (%s).\n", path.c_str(),
+                    strerror(errno));
+            }
+
+            base = static_cast<const uint8_t*>(mapped);
+        }
+
+        close(fd);
+
+        char magic[sizeof(VANADIS_CHECKPOINT_MAGIC)];
+        readBytes(magic, sizeof(magic));
+
+        if (0 != memcmp(magic, VANADIS_CHECKPOINT_MAGIC, sizeof(magic))) {
+            output->fatal(CALL_INFO, -1, "Error: %s is not a binary Vanadis checkpoint.\n", path.c_str());
+        }
+
+        const uint32_t version = read<uint32_t>();
+
+        if (VANADIS_CHECKPOINT_VERSION != version) {
+            output->fatal(CALL_INFO, -1, "Error: checkpoint %s has version %" PRIu32 ", expected %" PRIu32 ".\n",
+                path.c_str(), version, VANADIS_CHECKPOINT_VERSION);
+        }
+
+        const uint32_t file_kind = read<uint32_t>();
+
+        if (kind != file_kind) {
+            output->fatal(CALL_INFO, -1, "Error: checkpoint %s holds kind %" PRIu32 ", expected %" PRIu32 ".\n",
+                path.c_str(), file_kind, static_cast<uint32_t>(kind));
+        }
+    }
+
+    ~VanadisCheckpointReader() {
+        if (nullptr != base) {
+            munmap(const_cast<uint8_t*>(base), length);
+        }
+    }
+
+    template <typename T>
+    T read() {
+        static_assert(std::is_arithmetic<T>::value, "checkpoint values must be fixed-width scalars");
+        T value;
+        readBytes(&value, sizeof(T));
+        return value;
+    }
+
+    void readBytes(void* data, const size_t count) {
+        if (count > (length - offset)) {
+            output->fatal(CALL_INFO, -1, "Error: checkpoint file %s is truncated (need %zu bytes at offset %zu of %zu).\n",
+                path.c_str(), count, offset, length);
+        }
+
+        std::memcpy(data, base + offset, count);
+        offset += count;
+    }
+
+    bool atEnd() const { return offset == length; }
+
+private:
+    SST::Output*      output;
+    const std::string path;
+    const uint8_t*    base;
+    size_t            length;
+    size_t            offset;
+};
+
+} // namespace Vanadis
+} // namespace SST
+
+#endif
@@ -0,0 +1,194 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_VANADIS_UTIL_PIPE_TRACE
+#define _H_VANADIS_UTIL_PIPE_TRACE
+
+#include "util/vpipetraceformat.h"
+
+#include <sst/core/output.h>
+
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+namespace SST {
+namespace Vanadis {
+
+/*
+ * Writes the binary pipeline trace. Entries are packed into a large buffer
+ * that is handed to fwrite only when full, so tracing costs a few stores per
+ * retired instruction instead of a formatted fprintf.
+ */
+class VanadisPipelineTraceWriter {
+public:
+    VanadisPipelineTraceWriter(SST::Output* out, const std::string& file_path) :
+        output(out), path(file_path), used(0) {
+        fp = fopen(path.c_str(), "wb");
+
+        if (nullptr == fp) {
+            output->fatal(CALL_INFO, -1, "Error: unable to open pipeline trace file %s (%s).\n", path.c_str(),
+                strerror(errno));
+        }
+
+        buffer.resize(1024 * 1024);
+
+        put(VANADIS_PIPE_TRACE_MAGIC, sizeof(VANADIS_PIPE_TRACE_MAGIC));
+        put(&VANADIS_PIPE_TRACE_VERSION, sizeof(VANADIS_PIPE_TRACE_VERSION));
+    }
+
+    ~VanadisPipelineTraceWriter() {
+        flush();
+
+        if (0 != fclose(fp)) {
+            output->fatal(CALL_INFO, -1, "Error: failed to complete pipeline trace file %s (%s).\n", path.c_str(),
+                strerror(errno));
+        }
+    }
+
+    void retire(const uint32_t hw_thread, const uint64_t address, const char* code, const uint64_t issue_cycle,
+        const uint64_t retire_cycle) {
+        VanadisPipelineTraceRecord record;
+
+        record.address      = address;
+        record.issue_cycle  = issue_cycle;
+        record.retire_cycle = retire_cycle;
+        record.hw_thread    = hw_thread;
+        record.code         = codeID(code);
+        record.reserved     = 0;
+
+        const uint8_t tag = VANADIS_PIPE_TRACE_RETIRE;
+        put(&tag, sizeof(tag));
+        put(&record, sizeof(record));
+    }
+
+private:
+    // instruction codes are string literals, so the pointer identifies them
+    uint16_t codeID(const char* code) {
+        auto found = code_ids.find(code);
+
+        if (found != code_ids.end()) {
+            return found->second;
+        }
+
+        const uint16_t id     = static_cast<uint16_t>(code_ids.size());
+        const uint16_t length = static_cast<uint16_t>(strlen(code));
+        const uint8_t  tag    = VANADIS_PIPE_TRACE_NAME;
+
+        put(&tag, sizeof(tag));
+        put(&id, sizeof(id));
+        put(&length, sizeof(length));
+        put(code, length);
+
+        code_ids.insert(std::make_pair(code, id));
+        return id;
+    }
+
+    void put(const void* data, const size_t length) {
+        if ((used + length) > buffer.size()) {
+            flush();
+        }
+
+        std::memcpy(&buffer[used], data, length);
+        used += length;
+    }
+
+    void flush() {
+        if (used != fwrite(buffer.data(), 1, used, fp)) {
+            output->fatal(CALL_INFO, -1, "Error: failed writing pipeline trace file %s (%s).\n", path.c_str(),
+                strerror(errno));
+        }
+
+        used = 0;
+    }
+
+    SST::Output*                              output;
+    const std::string                         path;
+    FILE*                                     fp;
+    std::vector<uint8_t>                      buffer;
+    size_t                                    used;
+    std::unordered_map<const char*, uint16_t> code_ids;
+};
+
+/*
+ * Writes the commit trace, one fixed width record per retired instruction,
+ * buffered the same way as the pipeline trace.
+ */
+class VanadisCommitTraceWriter {
+public:
+    VanadisCommitTraceWriter(SST::Output* out, const std::string& file_path) :
+        output(out), path(file_path), used(0) {
+        fp = fopen(path.c_str(), "wb");
+
+        if (nullptr == fp) {
+            output->fatal(CALL_INFO, -1, "Error: unable to open commit trace file %s (%s).\n", path.c_str(),
+                strerror(errno));
+        }
+
+        buffer.resize(1024 * 1024);
+
+        const uint32_t record_size = sizeof(VanadisCommitTraceRecord);
+        put(VANADIS_COMMIT_TRACE_MAGIC, sizeof(VANADIS_COMMIT_TRACE_MAGIC));
+        put(&VANADIS_COMMIT_TRACE_VERSION, sizeof(VANADIS_COMMIT_TRACE_VERSION));
+        put(&record_size, sizeof(record_size));
+    }
+
+    ~VanadisCommitTraceWriter() {
+        flush();
+
+        if (0 != fclose(fp)) {
+            output->fatal(CALL_INFO, -1, "Error: failed to complete commit trace file %s (%s).\n", path.c_str(),
+                strerror(errno));
+        }
+    }
+
+    void commit(const VanadisCommitTraceRecord& record) {
+        put(&record, sizeof(record));
+    }
+
+private:
+    void put(const void* data, const size_t length) {
+        if ((used + length) > buffer.size()) {
+            flush();
+        }
+
+        std::memcpy(&buffer[used], data, length);
+        used += length;
+    }
+
+    void flush() {
+        if (used != fwrite(buffer.data(), 1, used, fp)) {
+            output->fatal(CALL_INFO, -1, "Error: failed writing commit trace file %s (%s).\n", path.c_str(),
+                strerror(errno));
+        }
+
+        used = 0;
+    }
+
+    SST::Output*         output;
+    const std::string    path;
+    FILE*                fp;
+    std::vector<uint8_t> buffer;
+    size_t               used;
+};
+
+} // namespace Vanadis
+} // namespace SST
+
+#endif
@@ -0,0 +1,81 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_VANADIS_UTIL_PIPE_TRACE_FORMAT
+#define _H_VANADIS_UTIL_PIPE_TRACE_FORMAT
+
+#include <cstdint>
+
+// Layout of the binary pipeline trace, shared by the core and the offline
+// converter (tools/pipetrace). Values are in host byte order.
+//
+// The file starts with the magic and a version, then holds a sequence of
+// entries each led by a one byte tag:
+//   NAME   : uint16 id, uint16 length, length bytes of instruction code
+//   RETIRE : one VanadisPipelineTraceRecord
+// A NAME entry is written the first time an instruction code is seen, later
+// RETIRE entries refer to it by id.
+
+namespace SST {
+namespace Vanadis {
+
+static constexpr char     VANADIS_PIPE_TRACE_MAGIC[8] = { 'V', 'A', 'N', 'P', 'I', 'P', 'E', '\0' };
+static constexpr uint32_t VANADIS_PIPE_TRACE_VERSION  = 1;
+
+enum VanadisPipelineTraceTag : uint8_t { VANADIS_PIPE_TRACE_NAME = 1, VANADIS_PIPE_TRACE_RETIRE = 2 };
+
+struct VanadisPipelineTraceRecord {
+    uint64_t address;
+    uint64_t issue_cycle;
+    uint64_t retire_cycle;
+    uint32_t hw_thread;
+    uint16_t code;
+    uint16_t reserved;
+};
+
+static_assert(sizeof(VanadisPipelineTraceRecord) == 32, "pipeline trace records must stay packed");
+
+// Layout of the commit trace (pipeline_trace_format=commit) compared by
+// sst-vanadis-tracediff. After the magic, version and record size every
+// retired instruction is one fixed width record, so record N sits at a
+// known offset and traces can be split into chunks without parsing them.
+
+static constexpr char     VANADIS_COMMIT_TRACE_MAGIC[8] = { 'V', 'A', 'N', 'C', 'O', 'M', 'I', 'T' };
+static constexpr uint32_t VANADIS_COMMIT_TRACE_VERSION  = 1;
+static constexpr uint16_t VANADIS_COMMIT_TRACE_NO_REG   = 0xFFFF;
+
+enum VanadisCommitTraceMemKind : uint8_t {
+    VANADIS_COMMIT_TRACE_NO_MEM = 0,
+    VANADIS_COMMIT_TRACE_LOAD   = 1,
+    VANADIS_COMMIT_TRACE_STORE  = 2
+};
+
+struct VanadisCommitTraceRecord {
+    uint64_t address;
+    uint64_t reg_value;   // value written to reg
+    uint64_t mem_address;
+    uint32_t hw_thread;
+    uint16_t reg;         // first ISA integer register written or VANADIS_COMMIT_TRACE_NO_REG
+    uint8_t  mem_width;
+    uint8_t  mem_kind;
+    char     code[16];    // instruction code, zero padded and truncated
+};
+
+static_assert(sizeof(VanadisCommitTraceRecord) == 48, "commit trace records must stay packed");
+
+} // namespace Vanadis
+} // namespace SST
+
+#endif
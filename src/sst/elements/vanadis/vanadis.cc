@@ -21,18 +21,61 @@
 
 #include "os/resp/vosexitresp.h"
 
+#include <algorithm>
 #include <cstdio>
 #include <sst/core/output.h>
 #include <vector>
 
 using namespace SST::Vanadis;
 
+// The issue scan keeps a summary of each ROB entry in its queue tag so entries
+// which have issued are passed over without loading the instruction: whether
+// it is known to have issued and up to three of each kind of register it
+// writes, an entry with more (or a register number over 255) is marked to be
+// read from the instruction
+#define VANADIS_ROB_TAG_VALID    0x1ULL
+#define VANADIS_ROB_TAG_ISSUED   0x2ULL
+#define VANADIS_ROB_TAG_OVERFLOW 0x4ULL
+#define VANADIS_ROB_TAG_INT_OUT  8
+#define VANADIS_ROB_TAG_FP_OUT   32
+
+static uint64_t
+summarizeROBEntry(VanadisInstruction* ins)
+{
+    uint64_t tag = VANADIS_ROB_TAG_VALID;
+
+    if ( ins->completedIssue() ) { tag |= VANADIS_ROB_TAG_ISSUED; }
+
+    const uint16_t int_out = ins->countISAIntRegOut();
+    const uint16_t fp_out  = ins->countISAFPRegOut();
+
+    if ( (int_out > 3) || (fp_out > 3) ) { return tag | VANADIS_ROB_TAG_OVERFLOW; }
+
+    tag |= ((uint64_t)int_out << 3) | ((uint64_t)fp_out << 5);
+
+    for ( uint16_t k = 0; k < int_out; ++k ) {
+        const uint16_t reg = ins->getISAIntRegOut(k);
+        if ( reg > 255 ) { return tag | VANADIS_ROB_TAG_OVERFLOW; }
+        tag |= (uint64_t)reg << (VANADIS_ROB_TAG_INT_OUT + 8 * k);
+    }
+
+    for ( uint16_t k = 0; k < fp_out; ++k ) {
+        const uint16_t reg = ins->getISAFPRegOut(k);
+        if ( reg > 255 ) { return tag | VANADIS_ROB_TAG_OVERFLOW; }
+        tag |= (uint64_t)reg << (VANADIS_ROB_TAG_FP_OUT + 8 * k);
+    }
+
+    return tag;
+}
+
 VANADIS_COMPONENT::VANADIS_COMPONENT(SST::ComponentId_t id, SST::Params& params) : Component(id), current_cycle(0),
     m_curRetireHwThread(0), m_curIssueHwThread(0), m_checkpointing(nullptr)
 {
 
     instPrintBuffer = new char[1024];
     pipelineTrace   = nullptr;
+    pipelineTraceBinary = nullptr;
+    commitTrace     = nullptr;
 
     max_cycle = params.find<uint64_t>("max_cycle", std::numeric_limits<uint64_t>::max());
 
@@ -69,6 +112,7 @@ VANADIS_COMPONENT::VANADIS_COMPONENT(SST::ComponentId_t id, SST::Params& params)
     } else {
         m_checkpoint = NO_CHECKPOINT;
     }
+    m_checkpointFormat = vanadis_checkpoint_format(output, params.find<std::string>("checkpointFormat", "text"));
 
     std::string clock_rate = params.find<std::string>("clock", "1GHz");
     output->verbose(CALL_INFO, 2, 0, "Registering clock at %s.\n", clock_rate.c_str());
@@ -76,6 +120,10 @@ VANADIS_COMPONENT::VANADIS_COMPONENT(SST::ComponentId_t id, SST::Params& params)
     cpuClockTC      = registerClock(clock_rate, cpuClockHandler);
 
     const uint32_t rob_count = params.find<uint32_t>("reorder_slots", 64);
+
+    // most instructions take under 256 bytes, the ones which don't fit overflow to the pool
+    uint64_t instruction_ring_bytes = params.find<uint64_t>("instruction_ring_bytes", 0);
+    if ( 0 == instruction_ring_bytes ) { instruction_ring_bytes = static_cast<uint64_t>(rob_count) * 256; }
     dCacheLineWidth          = params.find<uint64_t>("dcache_line_width", 64);
     iCacheLineWidth          = params.find<uint64_t>("icache_line_width", 64);
 
@@ -193,6 +241,9 @@ VANADIS_COMPONENT::VANADIS_COMPONENT(SST::ComponentId_t id, SST::Params& params)
 
         thread_decoders[i]->setThreadROB(rob[i]);
 
+        instruction_rings.push_back(new VanadisInstructionRing(instruction_ring_bytes));
+        thread_decoders[i]->setInstructionRing(instruction_rings[i]);
+
         for ( uint16_t j = 0; j < thread_decoders[i]->countISAIntReg(); ++j ) {
             issue_isa_tables[i]->setIntPhysReg(j, int_register_stack->pop());
         }
@@ -231,6 +282,15 @@ VANADIS_COMPONENT::VANADIS_COMPONENT(SST::ComponentId_t id, SST::Params& params)
 
     resetRegisterUseTemps(max_int_regs, max_fp_regs);
 
+    if ( params.find<bool>("issue_queue", false) ) {
+        output->verbose(CALL_INFO, 2, 0, "Issue will select from a wakeup-based issue queue.\n");
+
+        for ( uint32_t i = 0; i < hw_threads; ++i ) {
+            issue_queues.push_back(new VanadisIssueQueue(
+                rob_count, thread_decoders[i]->countISAIntReg(), thread_decoders[i]->countISAFPReg()));
+        }
+    }
+
     //	memDataInterface =
     // loadUserSubComponent<Interfaces::SimpleMem>("mem_interface_data",
     // ComponentInfo::SHARE_NONE, cpuClockTC, 		new
@@ -335,6 +395,27 @@ VANADIS_COMPONENT::VANADIS_COMPONENT(SST::ComponentId_t id, SST::Params& params)
 
     fetches_per_cycle = params.find<uint32_t>("fetches_per_cycle", 2);
     decodes_per_cycle = params.find<uint32_t>("decodes_per_cycle", 2);
+
+    const std::string fetch_policy_name = params.find<std::string>("fetch_policy", "all");
+
+    if ( fetch_policy_name == "all" ) { fetch_policy = VANADIS_FETCH_POLICY_ALL; }
+    else if ( fetch_policy_name == "round_robin" ) {
+        fetch_policy = VANADIS_FETCH_POLICY_ROUND_ROBIN;
+    }
+    else if ( fetch_policy_name == "icount" ) {
+        fetch_policy = VANADIS_FETCH_POLICY_ICOUNT;
+    }
+    else if ( fetch_policy_name == "priority" ) {
+        fetch_policy = VANADIS_FETCH_POLICY_PRIORITY;
+    }
+    else {
+        output->fatal(CALL_INFO, -1,
+            "Error: unknown fetch_policy \"%s\", expected all, round_robin, icount or priority.\n",
+            fetch_policy_name.c_str());
+    }
+
+    fetch_next_thread = 0;
+    fetch_order.resize(hw_threads);
     issues_per_cycle  = params.find<uint32_t>("issues_per_cycle", 2);
     retires_per_cycle = params.find<uint32_t>("retires_per_cycle", 2);
 
@@ -349,15 +430,50 @@ VANADIS_COMPONENT::VANADIS_COMPONENT(SST::ComponentId_t id, SST::Params& params)
         output->verbose(CALL_INFO, 8, 0, "Pipeline trace output not specified, disabling.\n");
     }
     else {
-        output->verbose(CALL_INFO, 8, 0, "Opening a pipeline trace output at: %s\n", pipeline_trace_path.c_str());
-        pipelineTrace = fopen(pipeline_trace_path.c_str(), "wt");
+        const std::string pipeline_trace_format = params.find<std::string>("pipeline_trace_format", "text");
+
+        output->verbose(CALL_INFO, 8, 0, "Opening a %s pipeline trace output at: %s\n", pipeline_trace_format.c_str(),
+            pipeline_trace_path.c_str());
+
+        if ( pipeline_trace_format == "binary" ) {
+            pipelineTraceBinary = new VanadisPipelineTraceWriter(output, pipeline_trace_path);
+        }
+        else if ( pipeline_trace_format == "commit" ) {
+            commitTrace = new VanadisCommitTraceWriter(output, pipeline_trace_path);
+        }
+        else if ( pipeline_trace_format == "text" ) {
+            pipelineTrace = fopen(pipeline_trace_path.c_str(), "wt");
 
-        if ( pipelineTrace == nullptr ) { output->fatal(CALL_INFO, -1, "Failed to open pipeline trace file.\n"); }
+            if ( pipelineTrace == nullptr ) { output->fatal(CALL_INFO, -1, "Failed to open pipeline trace file.\n"); }
+        }
+        else {
+            output->fatal(CALL_INFO, -1, "Error: unknown pipeline_trace_format \"%s\", expected \"text\", \"binary\" or \"commit\".\n",
+                pipeline_trace_format.c_str());
+        }
     }
 
     pause_on_retire_address = params.find<uint64_t>("pause_when_retire_address", 0);
     stop_verbose_when_retire_address = params.find<uint64_t>("stop_verbose_when_retire_address", 0);
 
+    fast_forward_instructions   = params.find<uint64_t>("fast_forward_instructions", 0);
+    fast_forward_until_address  = params.find<uint64_t>("fast_forward_until_address", 0);
+    fast_forward_width          = params.find<uint32_t>("fast_forward_width", 64);
+    fast_forward_warm_predictor = params.find<bool>("fast_forward_warm_branch_predictor", true);
+    fast_forwarding             = (fast_forward_instructions > 0) || (fast_forward_until_address > 0);
+    ins_fast_forwarded          = 0;
+
+    if ( fast_forwarding ) {
+        if ( 0 == fast_forward_width ) {
+            output->fatal(CALL_INFO, -1, "Error: fast_forward_width must be at least 1.\n");
+        }
+
+        output->verbose(
+            CALL_INFO, 1, 0,
+            "Fast-forwarding until %" PRIu64 " instructions retire or address 0x%" PRI_ADDR
+            " retires (0 = not used), width: %" PRIu32 "\n",
+            fast_forward_instructions, fast_forward_until_address, fast_forward_width);
+    }
+
     setVerboseWhenIssueAddress( params.find<std::string>("start_verbose_when_issue_address", "") );
 
     // Register statistics ///////////////////////////////////////////////////////
@@ -374,6 +490,11 @@ VANADIS_COMPONENT::VANADIS_COMPONENT(SST::ComponentId_t id, SST::Params& params)
     stat_syscall_cycles       = registerStatistic<uint64_t>("syscall-cycles", "1");
     stat_int_phys_regs_in_use = registerStatistic<uint64_t>("phys_int_reg_in_use", "1");
     stat_fp_phys_regs_in_use  = registerStatistic<uint64_t>("phys_fp_reg_in_use", "1");
+    stat_ins_fast_forwarded   = registerStatistic<uint64_t>("instructions_fast_forwarded", "1");
+
+    if ( params.find<bool>("host_profile", false) ) {
+        profile_clock.enable(registerStatistic<uint64_t>("host_ns_clock", "1"), registerStatistic<uint64_t>("host_events_clock", "1"));
+    }
 
     //registerAsPrimaryComponent();
     //primaryComponentDoNotEndSim();
@@ -389,6 +510,8 @@ VANADIS_COMPONENT::~VANADIS_COMPONENT()
     }
 
     if ( pipelineTrace != nullptr ) { fclose(pipelineTrace); }
+    delete pipelineTraceBinary;
+    delete commitTrace;
 
 	for( VanadisFloatingPointFlags* next_fp_flags : fp_flags ) {
 		delete next_fp_flags;
@@ -400,6 +523,15 @@ VANADIS_COMPONENT::~VANADIS_COMPONENT()
         delete[] tmp_not_issued_fp_reg_read[i];
         delete[] tmp_fp_reg_write[i];
     }
+
+    for ( VanadisIssueQueue* next_queue : issue_queues ) {
+        delete next_queue;
+    }
+
+    // instructions still in the ROBs are not deleted, so nothing refers to the rings
+    for ( VanadisInstructionRing* next_ring : instruction_rings ) {
+        delete next_ring;
+    }
 }
 
 void
@@ -477,20 +609,56 @@ int
 VANADIS_COMPONENT::performDecode(const uint64_t cycle)
 {
 
+    if ( VANADIS_FETCH_POLICY_ALL == fetch_policy ) {
+        for ( uint32_t i = 0; i < hw_threads; ++i ) {
+            // If thread is not masked then decode from it
+            if ( !halted_masks[i] ) { decodeThread(i, cycle); }
+        }
+
+        return 0;
+    }
+
+    // Otherwise the slot goes to one thread, candidates are tried in the
+    // policy's order until one of them decodes something (a thread waiting
+    // on an icache miss or with a full ROB does not waste the slot)
     for ( uint32_t i = 0; i < hw_threads; ++i ) {
-        const int64_t rob_before_decode = (int64_t)rob[i]->size();
+        fetch_order[i] = (VANADIS_FETCH_POLICY_PRIORITY == fetch_policy) ? i : (fetch_next_thread + i) % hw_threads;
+    }
+
+    if ( VANADIS_FETCH_POLICY_ICOUNT == fetch_policy ) {
+        // fewest in-flight instructions first, ties keep the round-robin order
+        std::stable_sort(fetch_order.begin(), fetch_order.end(), [this](const uint32_t l, const uint32_t r) {
+            return rob[l]->size() < rob[r]->size();
+        });
+    }
 
-        // If thread is not masked then decode from it
-        if ( !halted_masks[i] ) { thread_decoders[i]->tick(output, (uint64_t)cycle); }
+    for ( const uint32_t thr : fetch_order ) {
+        if ( halted_masks[thr] ) { continue; }
 
-        const int64_t rob_after_decode = (int64_t)rob[i]->size();
-        const int64_t decoded_cycle    = (rob_after_decode - rob_before_decode);
-        ins_decoded_this_cycle += (decoded_cycle > 0) ? static_cast<uint64_t>(decoded_cycle) : 0;
+        if ( decodeThread(thr, cycle) > 0 ) {
+            fetch_next_thread = (thr + 1) % hw_threads;
+            break;
+        }
     }
 
     return 0;
 }
 
+uint32_t
+VANADIS_COMPONENT::decodeThread(const uint32_t hw_thr, const uint64_t cycle)
+{
+    const int64_t rob_before_decode = (int64_t)rob[hw_thr]->size();
+
+    thread_decoders[hw_thr]->tick(output, (uint64_t)cycle);
+
+    const int64_t rob_after_decode = (int64_t)rob[hw_thr]->size();
+    const int64_t decoded_cycle    = (rob_after_decode - rob_before_decode);
+    const uint32_t decoded = (decoded_cycle > 0) ? static_cast<uint32_t>(decoded_cycle) : 0;
+
+    ins_decoded_this_cycle += decoded;
+    return decoded;
+}
+
 void
 VANADIS_COMPONENT::resetRegisterUseTemps(const uint16_t int_reg_count, const uint16_t fp_reg_count)
 {
@@ -527,9 +695,27 @@ VANADIS_COMPONENT::performIssue(const uint64_t cycle, int hwThr, uint32_t& rob_s
             const auto rob_size = rob[i]->size();
 
             for ( auto j = rob_start; j < rob_size; ++j ) {
-                VanadisInstruction* ins = rob[i]->peekAt(j);
+                uint64_t rob_tag = rob[i]->tagAt(j);
+
+                if ( 0 == rob_tag ) {
+                    rob_tag = summarizeROBEntry(rob[i]->peekAt(j));
+                    rob[i]->setTagAt(j, rob_tag);
+                }
+
+                VanadisInstruction* ins = nullptr;
+
+                // an entry not known to have issued may have been issued somewhere
+                // else since (fast-forward), the instruction has the final say
+                if ( 0 == (rob_tag & VANADIS_ROB_TAG_ISSUED) ) {
+                    ins = rob[i]->peekAt(j);
+
+                    if ( ins->completedIssue() ) {
+                        rob_tag |= VANADIS_ROB_TAG_ISSUED;
+                        rob[i]->setTagAt(j, rob_tag);
+                    }
+                }
 
-                if ( ! ins->completedIssue() ) {
+                if ( 0 == (rob_tag & VANADIS_ROB_TAG_ISSUED) ) {
 #ifdef VANADIS_BUILD_DEBUG
                     if ( output_verbosity >= 8 ) {
                         if ( j == 0 ) {
@@ -599,8 +785,12 @@ VANADIS_COMPONENT::performIssue(const uint64_t cycle, int hwThr, uint32_t& rob_s
                             }
 #endif
                             ins->markIssued();
+                            ins->setIssueCycle(current_cycle);
                             ins_issued_this_cycle++;
                             issued_an_ins = true;
+
+                            rob_tag |= VANADIS_ROB_TAG_ISSUED;
+                            rob[i]->setTagAt(j, rob_tag);
                         } else {
                             if(ins_type == INST_LOAD || ins_type == INST_STORE || ins_type == INST_FENCE) {
                                 // we have seen a memory operation which is not issued, downstream operations
@@ -627,14 +817,30 @@ VANADIS_COMPONENT::performIssue(const uint64_t cycle, int hwThr, uint32_t& rob_s
                     }
                 }
 
-                // Collect up all integer registers we write to
-                for ( auto k = 0; k < ins->countISAIntRegOut(); ++k ) {
-                    tmp_int_reg_write[i][ins->getISAIntRegOut(k)] = 1;
+                if ( rob_tag & VANADIS_ROB_TAG_OVERFLOW ) {
+                    if ( nullptr == ins ) { ins = rob[i]->peekAt(j); }
+
+                    // Collect up all integer registers we write to
+                    for ( auto k = 0; k < ins->countISAIntRegOut(); ++k ) {
+                        tmp_int_reg_write[i][ins->getISAIntRegOut(k)] = 1;
+                    }
+
+                    // Collect up all fp registers we write to
+                    for ( auto k = 0; k < ins->countISAFPRegOut(); ++k ) {
+                        tmp_fp_reg_write[i][ins->getISAFPRegOut(k)] = 1;
+                    }
                 }
+                else {
+                    const uint32_t int_out = (rob_tag >> 3) & 0x3;
+                    const uint32_t fp_out  = (rob_tag >> 5) & 0x3;
 
-                // Collect up all fp registers we write to
-                for ( auto k = 0; k < ins->countISAFPRegOut(); ++k ) {
-                    tmp_fp_reg_write[i][ins->getISAFPRegOut(k)] = 1;
+                    for ( uint32_t k = 0; k < int_out; ++k ) {
+                        tmp_int_reg_write[i][(rob_tag >> (VANADIS_ROB_TAG_INT_OUT + 8 * k)) & 0xFF] = 1;
+                    }
+
+                    for ( uint32_t k = 0; k < fp_out; ++k ) {
+                        tmp_fp_reg_write[i][(rob_tag >> (VANADIS_ROB_TAG_FP_OUT + 8 * k)) & 0xFF] = 1;
+                    }
                 }
 
                 // We issued an instruction this cycle, so exit
@@ -670,6 +876,56 @@ VANADIS_COMPONENT::performIssue(const uint64_t cycle, int hwThr, uint32_t& rob_s
     return issued_an_ins ? 0 : 1;
 }
 
+int
+VANADIS_COMPONENT::performQueueIssue(const uint64_t cycle, int hwThr)
+{
+    if ( UNLIKELY(halted_masks[hwThr]) ) { return 1; }
+
+    VanadisIssueQueue* issue_queue = issue_queues[hwThr];
+
+    // Only instructions with no register or memory ordering hazards left are
+    // in the ready set, walk them oldest first like the ROB scan does
+    for ( uint64_t seq = issue_queue->firstReady(); seq != VanadisIssueQueue::NONE;
+          seq       = issue_queue->nextReady(seq) ) {
+        VanadisInstruction* ins = issue_queue->getInstruction(seq);
+
+        // We need places to store our output registers
+        if ( (int_register_stack->unused() < ins->countISAIntRegOut()) ||
+             (fp_register_stack->unused() < ins->countISAFPRegOut()) ) {
+            continue;
+        }
+
+        if ( 0 != allocateFunctionalUnit(ins) ) { continue; }
+
+        const int status = assignRegistersToInstruction(
+            thread_decoders[hwThr]->countISAIntReg(), thread_decoders[hwThr]->countISAFPReg(), ins,
+            int_register_stack, fp_register_stack, issue_isa_tables[hwThr]);
+
+#ifdef VANADIS_BUILD_DEBUG
+        if ( checkVerboseAddr( ins->getInstructionAddress() ) ) {
+            output->setVerboseLevel(8);
+        }
+        if ( output->getVerboseLevel() >= 8 ) {
+            ins->printToBuffer(instPrintBuffer, 1024);
+            output->verbose(
+                CALL_INFO, 8, VANADIS_DBG_ISSUE_FLG, "%d: ----> Issued for: %s / 0x%" PRI_ADDR " / status: %d\n",
+                hwThr, instPrintBuffer, ins->getInstructionAddress(), status);
+            if ( print_rob ) {
+                printRob(hwThr,rob[hwThr]);
+            }
+        }
+#endif
+        ins->markIssued();
+        ins->setIssueCycle(current_cycle);
+        issue_queue->markIssued(seq);
+        ins_issued_this_cycle++;
+
+        return 0;
+    }
+
+    return 1;
+}
+
 int
 VANADIS_COMPONENT::performExecute(const uint64_t cycle)
 {
@@ -877,8 +1133,10 @@ VANADIS_COMPONENT::performRetire(int rob_num, VanadisCircularQueue<VanadisInstru
                 }
                 }
 #endif
-                thread_decoders[ins_thread]->getBranchPredictor()->push(
-                    spec_ins->getInstructionAddress(), pipeline_reset_addr);
+                if ( LIKELY(!fast_forwarding) || fast_forward_warm_predictor ) {
+                    thread_decoders[ins_thread]->getBranchPredictor()->push(
+                        spec_ins->getInstructionAddress(), pipeline_reset_addr);
+                }
 
                 if ( stop_verbose_when_retire_address > 0 && (rob_front->getInstructionAddress() == stop_verbose_when_retire_address) ) {
                     output->setVerboseLevel(0);
@@ -915,6 +1173,8 @@ VANADIS_COMPONENT::performRetire(int rob_num, VanadisCircularQueue<VanadisInstru
         if ( perform_cleanup ) {
             rob->pop();
 
+            if ( !issue_queues.empty() ) { issue_queues[ins_thread]->retire(); }
+
 #ifdef VANADIS_BUILD_DEBUG
             if ( output->getVerboseLevel() >= 8 ) {
                 char* inst_asm_buffer = new char[32768];
@@ -933,6 +1193,14 @@ VANADIS_COMPONENT::performRetire(int rob_num, VanadisCircularQueue<VanadisInstru
             if ( pipelineTrace != nullptr ) {
                 fprintf(pipelineTrace, "0x%08" PRI_ADDR " %s\n", rob_front->getInstructionAddress(), rob_front->getInstCode());
             }
+            else if ( pipelineTraceBinary != nullptr ) {
+                pipelineTraceBinary->retire(
+                    rob_front->getHWThread(), rob_front->getInstructionAddress(), rob_front->getInstCode(),
+                    rob_front->getIssueCycle(), current_cycle);
+            }
+            else if ( commitTrace != nullptr ) {
+                traceCommit(rob_front);
+            }
 
 			if(UNLIKELY(rob_front->updatesFPFlags())) {
                 output->verbose(CALL_INFO, 16, VANADIS_DBG_RETIRE_FLG, "------> updating floating-point flags.\n");
@@ -962,6 +1230,8 @@ VANADIS_COMPONENT::performRetire(int rob_num, VanadisCircularQueue<VanadisInstru
             if ( perform_delay_cleanup ) {
 
                 VanadisInstruction* delay_ins = rob->pop();
+
+                if ( !issue_queues.empty() ) { issue_queues[ins_thread]->retire(); }
 #ifdef VANADIS_BUILD_DEBUG
                 output->verbose(
                     CALL_INFO, 8, VANADIS_DBG_RETIRE_FLG, "----> Retire delay: 0x%" PRI_ADDR " / %s\n", delay_ins->getInstructionAddress(),
@@ -971,6 +1241,14 @@ VANADIS_COMPONENT::performRetire(int rob_num, VanadisCircularQueue<VanadisInstru
                     fprintf(
                         pipelineTrace, "0x%08" PRI_ADDR " %s\n", delay_ins->getInstructionAddress(), delay_ins->getInstCode());
                 }
+                else if ( pipelineTraceBinary != nullptr ) {
+                    pipelineTraceBinary->retire(
+                        delay_ins->getHWThread(), delay_ins->getInstructionAddress(), delay_ins->getInstCode(),
+                        delay_ins->getIssueCycle(), current_cycle);
+                }
+                else if ( commitTrace != nullptr ) {
+                    traceCommit(delay_ins);
+                }
 
 				if(UNLIKELY(rob_front->updatesFPFlags())) {
                     output->verbose(CALL_INFO, 16, VANADIS_DBG_RETIRE_FLG, "------> updating floating-point flags.\n");
@@ -1095,6 +1373,151 @@ VANADIS_COMPONENT::performRetire(int rob_num, VanadisCircularQueue<VanadisInstru
     return 0;
 }
 
+// Functional (fast-forward) execution: every hardware thread runs one
+// instruction at a time through the same decoder, register files and retire
+// logic as the detailed pipeline, so the switch to detailed simulation needs
+// no state transfer. Arithmetic and branches execute on the spot instead of
+// waiting in the functional units; loads, stores, fences and syscalls still go
+// through the LSQ and the memory hierarchy, which keeps the caches warm.
+// Returns 0 if the thread made progress, 1 if it must wait for the next cycle.
+int
+VANADIS_COMPONENT::performFastForward(const uint64_t cycle, const uint32_t hw_thr)
+{
+    if ( UNLIKELY(halted_masks[hw_thr]) ) { return 1; }
+
+    VanadisCircularQueue<VanadisInstruction*>* thr_rob = rob[hw_thr];
+    bool progress = false;
+
+    if ( !thr_rob->full() ) {
+        const size_t rob_before_decode = thr_rob->size();
+        thread_decoders[hw_thr]->tick(output, cycle);
+
+        if ( thr_rob->size() > rob_before_decode ) {
+            ins_decoded_this_cycle += thr_rob->size() - rob_before_decode;
+            progress = true;
+        }
+    }
+
+    if ( !issue_queues.empty() ) { issue_queues[hw_thr]->beginCycle(thr_rob); }
+
+    // only the oldest instruction which has not executed is in flight, anything
+    // ahead of it which has executed is waiting on a delay slot
+    for ( size_t i = 0; i < thr_rob->size(); ++i ) {
+        VanadisInstruction* ins = thr_rob->peekAt(i);
+
+        if ( ins->completedExecution() ) { continue; }
+
+        if ( !ins->completedIssue() ) {
+            progress = (0 == fastForwardIssue(hw_thr, ins)) || progress;
+        }
+        else {
+            switch ( ins->getInstFuncType() ) {
+            case INST_INT_ARITH:
+            case INST_INT_DIV:
+            case INST_FP_ARITH:
+            case INST_FP_DIV:
+            case INST_BRANCH:
+                // did not mark itself executed on the first attempt
+                ins->execute(output, register_files[hw_thr]);
+                break;
+            default:
+                // waiting on the LSQ or the OS
+                break;
+            }
+        }
+
+        break;
+    }
+
+    if ( !thr_rob->empty() ) {
+        const uint64_t retire_addr    = thr_rob->peek()->getInstructionAddress();
+        const uint32_t retired_before = ins_retired_this_cycle;
+
+        performRetire(hw_thr, thr_rob, cycle);
+
+        if ( ins_retired_this_cycle > retired_before ) {
+            ins_fast_forwarded += ins_retired_this_cycle - retired_before;
+            progress = true;
+
+            checkFastForwardEnd(retire_addr);
+        }
+    }
+
+    return progress ? 0 : 1;
+}
+
+int
+VANADIS_COMPONENT::fastForwardIssue(const uint32_t hw_thr, VanadisInstruction* ins)
+{
+    if ( 0 != checkInstructionResources(ins, int_register_stack, fp_register_stack, issue_isa_tables[hw_thr]) ) {
+        return 1;
+    }
+
+    uint64_t queue_seq = VanadisIssueQueue::NONE;
+
+    if ( !issue_queues.empty() ) {
+        VanadisIssueQueue* issue_queue = issue_queues[hw_thr];
+
+        for ( uint64_t seq = issue_queue->firstReady(); seq != VanadisIssueQueue::NONE;
+              seq       = issue_queue->nextReady(seq) ) {
+            if ( issue_queue->getInstruction(seq) == ins ) {
+                queue_seq = seq;
+                break;
+            }
+        }
+
+        // hazards are released at the start of the next step
+        if ( VanadisIssueQueue::NONE == queue_seq ) { return 1; }
+    }
+
+    bool execute_now = false;
+
+    switch ( ins->getInstFuncType() ) {
+    case INST_INT_ARITH:
+    case INST_INT_DIV:
+    case INST_FP_ARITH:
+    case INST_FP_DIV:
+    case INST_BRANCH:
+        execute_now = true;
+        break;
+    default:
+        // memory operations, syscalls, no-ops and faults are handled exactly
+        // as in the detailed pipeline
+        if ( 0 != allocateFunctionalUnit(ins) ) { return 1; }
+        break;
+    }
+
+    assignRegistersToInstruction(
+        thread_decoders[hw_thr]->countISAIntReg(), thread_decoders[hw_thr]->countISAFPReg(), ins, int_register_stack,
+        fp_register_stack, issue_isa_tables[hw_thr]);
+
+    ins->markIssued();
+    ins->setIssueCycle(current_cycle);
+
+    if ( VanadisIssueQueue::NONE != queue_seq ) { issue_queues[hw_thr]->markIssued(queue_seq); }
+
+    if ( execute_now ) { ins->execute(output, register_files[hw_thr]); }
+
+    return 0;
+}
+
+void
+VANADIS_COMPONENT::checkFastForwardEnd(const uint64_t retired_addr)
+{
+    const bool reached_address = (fast_forward_until_address > 0) && (retired_addr == fast_forward_until_address);
+    const bool reached_count   = (fast_forward_instructions > 0) && (ins_fast_forwarded >= fast_forward_instructions);
+
+    if ( reached_address || reached_count ) {
+        fast_forwarding = false;
+
+        output->verbose(
+            CALL_INFO, 1, 0,
+            "Fast-forward complete at cycle %" PRIu64 " after %" PRIu64 " instructions (retired 0x%" PRI_ADDR
+            "), switching to detailed simulation.\n",
+            current_cycle, ins_fast_forwarded, retired_addr);
+    }
+}
+
 bool
 VANADIS_COMPONENT::mapInstructiontoFunctionalUnit(
     VanadisInstruction* ins, std::vector<VanadisFunctionalUnit*>& functional_units)
@@ -1205,6 +1628,8 @@ VANADIS_COMPONENT::allocateFunctionalUnit(VanadisInstruction* ins)
 bool
 VANADIS_COMPONENT::tick(SST::Cycle_t cycle)
 {
+    SST::HostProf::ScopedHandlerTimer profile_timer(profile_clock);
+
     if ( current_cycle >= max_cycle ) {
         output->verbose(CALL_INFO, 1, 0, "Reached maximum cycle %" PRIu64 ". Core stops processing.\n", current_cycle);
         primaryComponentOKToEndSim();
@@ -1273,6 +1698,23 @@ VANADIS_COMPONENT::tick(SST::Cycle_t cycle)
         }
     }
 
+    if ( UNLIKELY(fast_forwarding) ) {
+        for ( uint32_t i = 0; i < hw_threads; ++i ) {
+            for ( uint32_t j = 0; (j < fast_forward_width) && fast_forwarding; ++j ) {
+                if ( 0 != performFastForward(cycle, i) ) { break; }
+            }
+        }
+
+        // drains the LSQ, the functional units are idle
+        performExecute(cycle);
+
+        stat_ins_fast_forwarded->addData(ins_retired_this_cycle);
+        stat_ins_decoded->addData(ins_decoded_this_cycle);
+
+        current_cycle++;
+        return false;
+    }
+
     #ifdef VANADIS_BUILD_DEBUG
     if(output_verbosity >= 9) {
         output->verbose(
@@ -1335,8 +1777,15 @@ VANADIS_COMPONENT::tick(SST::Cycle_t cycle)
     }
 #endif
     // Clear our temps on a per-thread basis
-    for ( uint32_t i = 0; i < hw_threads; ++i ) {
-        resetRegisterUseTemps(thread_decoders[i]->countISAIntReg(), thread_decoders[i]->countISAFPReg());
+    if ( issue_queues.empty() ) {
+        for ( uint32_t i = 0; i < hw_threads; ++i ) {
+            resetRegisterUseTemps(thread_decoders[i]->countISAIntReg(), thread_decoders[i]->countISAFPReg());
+        }
+    } else {
+        // Bring the instructions decoded last cycle into the issue queues
+        for ( uint32_t i = 0; i < hw_threads; ++i ) {
+            issue_queues[i]->beginCycle(rob[i]);
+        }
     }
 
 {
@@ -1358,7 +1807,11 @@ VANADIS_COMPONENT::tick(SST::Cycle_t cycle)
         // we found a unblocked hardware thread
         if ( cnt ) {
             auto thr = m_curIssueHwThread;
-            rc[thr] = performIssue(cycle, thr, rob_start[thr], unallocated_memory_op_seen[thr]);
+            if ( issue_queues.empty() ) {
+                rc[thr] = performIssue(cycle, thr, rob_start[thr], unallocated_memory_op_seen[thr]);
+            } else {
+                rc[thr] = performQueueIssue(cycle, thr);
+            }
             ++m_curIssueHwThread;
             m_curIssueHwThread %= hw_threads;
             cnt = hw_threads;
@@ -1697,6 +2150,54 @@ VANADIS_COMPONENT::assignRegistersToInstruction(
     return 0;
 }
 
+// Called before the registers of ins are recovered, so its inputs and
+// outputs still hold the values it executed with
+void
+VANADIS_COMPONENT::traceCommit(VanadisInstruction* ins)
+{
+    VanadisRegisterFile*     reg_file = register_files[ins->getHWThread()];
+    VanadisCommitTraceRecord record;
+
+    std::memset(&record, 0, sizeof(record));
+    record.address   = ins->getInstructionAddress();
+    record.hw_thread = ins->getHWThread();
+    record.reg       = VANADIS_COMMIT_TRACE_NO_REG;
+    strncpy(record.code, ins->getInstCode(), sizeof(record.code));
+
+    if ( ins->countPhysIntRegOut() > 0 ) {
+        record.reg       = ins->getISAIntRegOut(0);
+        record.reg_value = (reg_file->getIntRegWidth() >= sizeof(uint64_t))
+                               ? reg_file->getIntReg<uint64_t>(ins->getPhysIntRegOut(0))
+                               : reg_file->getIntReg<uint32_t>(ins->getPhysIntRegOut(0));
+    }
+
+    uint16_t width = 0;
+
+    switch ( ins->getInstFuncType() ) {
+    case INST_LOAD:
+    {
+        VanadisLoadInstruction* load = dynamic_cast<VanadisLoadInstruction*>(ins);
+        if ( load != nullptr ) {
+            load->computeLoadAddress(reg_file, &record.mem_address, &width);
+            record.mem_kind = VANADIS_COMMIT_TRACE_LOAD;
+        }
+    } break;
+    case INST_STORE:
+    {
+        VanadisStoreInstruction* store = dynamic_cast<VanadisStoreInstruction*>(ins);
+        if ( store != nullptr ) {
+            store->computeStoreAddress(output, reg_file, &record.mem_address, &width);
+            record.mem_kind = VANADIS_COMMIT_TRACE_STORE;
+        }
+    } break;
+    default:
+        break;
+    }
+
+    record.mem_width = static_cast<uint8_t>(width);
+    commitTrace->commit(record);
+}
+
 int
 VANADIS_COMPONENT::recoverRetiredRegisters(
     VanadisInstruction* ins, VanadisRegisterStack* int_regs, VanadisRegisterStack* fp_regs,
@@ -1800,15 +2301,20 @@ VANADIS_COMPONENT::setup()
         std::stringstream filename;
         filename << m_checkpointDir << "/" << getName();
         output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"checkpoint file %s\n",filename.str().c_str());
-        auto fp = fopen(filename.str().c_str(),"r");
-        assert(fp);
-        checkpointLoad(fp);
+        if ( VANADIS_CHECKPOINT_BINARY == m_checkpointFormat ) {
+            checkpointLoadBinary(filename.str());
+        } else {
+            auto fp = fopen(filename.str().c_str(),"r");
+            assert(fp);
+            checkpointLoad(fp);
+        }
     } 
 }
 
 void
 VANADIS_COMPONENT::finish()
 {
+    profile_clock.report();
 
     if ( LIKELY( nullptr == m_checkpointing ) ) return;
 
@@ -1817,12 +2323,16 @@ VANADIS_COMPONENT::finish()
 
         std::stringstream filename;
         filename << m_checkpointDir << "/" << getName();
-        auto fp = fopen(filename.str().c_str(),"w+");
-        assert(fp);
 
         output->verbose(CALL_INFO, 0, VANADIS_DBG_CHECKPOINT,"Checkpoint component `%s` %s\n",getName().c_str(), filename.str().c_str());
 
-        checkpoint(fp); 
+        if ( VANADIS_CHECKPOINT_BINARY == m_checkpointFormat ) {
+            checkpointBinary(filename.str());
+        } else {
+            auto fp = fopen(filename.str().c_str(),"w+");
+            assert(fp);
+            checkpoint(fp);
+        }
     }
 }
 
@@ -1969,6 +2479,8 @@ VANADIS_COMPONENT::clearROBMisspeculate(const uint32_t hw_thr)
 
     // clear the ROB entries and reset
     thr_rob->clear();
+
+    if ( !issue_queues.empty() ) { issue_queues[hw_thr]->clear(); }
 }
 
 void
@@ -2255,6 +2767,103 @@ VANADIS_COMPONENT::checkpointLoad(FILE* fp)
     }
 }
 
+// Binary form of checkpoint(): per hardware thread an active flag, the
+// address to resume at, the TLS pointer and the retired value of every ISA
+// register. Register counts are recorded so a restore into a core configured
+// for another ISA is rejected instead of shifting every value.
+void
+VANADIS_COMPONENT::checkpointBinary(const std::string& path)
+{
+    VanadisCheckpointWriter writer(output, path, VANADIS_CHECKPOINT_CORE);
+
+    writer.write<uint32_t>(hw_threads);
+
+    for ( uint32_t i = 0; i < hw_threads; i++ ) {
+        writer.write<uint8_t>(m_checkpointing[i] ? 1 : 0);
+
+        if ( !m_checkpointing[i] ) { continue; }
+
+        auto isa_table   = retire_isa_tables[i];
+        auto reg_file    = register_files[i];
+        auto thr_decoder = thread_decoders[i];
+
+        // the thread halted on its checkpoint syscall, resume after it
+        writer.write<uint64_t>(rob[i]->peekAt(0)->getInstructionAddress() + 4);
+        writer.write<uint64_t>(thr_decoder->getThreadLocalStoragePointer());
+
+        writer.write<uint32_t>(isa_table->getNumIntRegs());
+        writer.write<uint32_t>(isa_table->getNumFpRegs());
+
+        for ( int j = 0; j < isa_table->getNumIntRegs(); j++ ) {
+            writer.write<uint64_t>(reg_file->getIntReg<uint64_t>(isa_table->getIntPhysReg(j)));
+        }
+
+        for ( int j = 0; j < isa_table->getNumFpRegs(); j++ ) {
+            if ( thr_decoder->getFPRegisterMode() == VANADIS_REGISTER_MODE_FP32 ) {
+                writer.write<uint64_t>(reg_file->getFPReg<uint32_t>(isa_table->getFPPhysReg(j)));
+            } else {
+                writer.write<uint64_t>(reg_file->getFPReg<uint64_t>(isa_table->getFPPhysReg(j)));
+            }
+        }
+    }
+}
+
+void
+VANADIS_COMPONENT::checkpointLoadBinary(const std::string& path)
+{
+    VanadisCheckpointReader reader(output, path, VANADIS_CHECKPOINT_CORE);
+
+    const uint32_t ckpt_threads = reader.read<uint32_t>();
+
+    if ( ckpt_threads != hw_threads ) {
+        output->fatal(
+            CALL_INFO, -1, "Error: checkpoint %s holds %" PRIu32 " hardware threads, core has %" PRIu32 ".\n",
+            path.c_str(), ckpt_threads, hw_threads);
+    }
+
+    for ( uint32_t hw_thr = 0; hw_thr < hw_threads; hw_thr++ ) {
+        if ( 0 == reader.read<uint8_t>() ) { continue; }
+
+        auto isa_table   = retire_isa_tables[hw_thr];
+        auto reg_file    = register_files[hw_thr];
+        auto thr_decoder = thread_decoders[hw_thr];
+
+        const uint64_t start_addr = reader.read<uint64_t>();
+        thr_decoder->setThreadLocalStoragePointer(reader.read<uint64_t>());
+
+        const uint32_t int_regs = reader.read<uint32_t>();
+        const uint32_t fp_regs  = reader.read<uint32_t>();
+
+        if ( (int_regs != (uint32_t)isa_table->getNumIntRegs()) || (fp_regs != (uint32_t)isa_table->getNumFpRegs()) ) {
+            output->fatal(
+                CALL_INFO, -1,
+                "Error: checkpoint %s thread %" PRIu32 " has %" PRIu32 " int / %" PRIu32 " fp registers, core expects %d / %d.\n",
+                path.c_str(), hw_thr, int_regs, fp_regs, isa_table->getNumIntRegs(), isa_table->getNumFpRegs());
+        }
+
+        for ( uint32_t j = 0; j < int_regs; j++ ) {
+            reg_file->setIntReg<uint64_t>(isa_table->getIntPhysReg(j), reader.read<uint64_t>());
+        }
+
+        for ( uint32_t j = 0; j < fp_regs; j++ ) {
+            const uint64_t value = reader.read<uint64_t>();
+
+            if ( VANADIS_REGISTER_MODE_FP32 == thr_decoder->getFPRegisterMode() ) {
+                reg_file->setFPReg<uint32_t>(isa_table->getFPPhysReg(j), static_cast<uint32_t>(value));
+            } else {
+                reg_file->setFPReg<uint64_t>(isa_table->getFPPhysReg(j), value);
+            }
+        }
+
+        output->verbose(
+            CALL_INFO, 0, VANADIS_DBG_CHECKPOINT, "set thread %" PRIu32 " start address %#" PRIx64 "\n", hw_thr,
+            start_addr);
+
+        halted_masks[hw_thr] = false;
+        handleMisspeculate(hw_thr, start_addr);
+    }
+}
+
 void VANADIS_COMPONENT::getThreadState( VanadisGetThreadStateReq* req )
 {
     int hw_thr = req->getThread();
@@ -2319,6 +2928,8 @@ VANADIS_COMPONENT::resetHwThread(uint32_t thr)
 
     thr_rob->clear();
 
+    if ( !issue_queues.empty() ) { issue_queues[thr]->clear(); }
+
 #if 0
     output->setVerboseLevel( 16 );
     output->verbose(CALL_INFO, 0, 0,"%s() issue isa table\n",__func__);
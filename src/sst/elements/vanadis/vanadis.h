@@ -17,6 +17,7 @@
 #define _VANADIS_COMPONENT_H
 
 #include "datastruct/cqueue.h"
+#include "datastruct/issuequeue.h"
 #include "decoder/vdecoder.h"
 #include "inst/isatable.h"
 #include "inst/regfile.h"
@@ -24,6 +25,8 @@
 #include "inst/vinst.h"
 #include "lsq/vlsq.h"
 #include "lsq/vbasiclsq.h"
+#include "util/vcheckpointio.h"
+#include "util/vpipetrace.h"
 #include "velf/velfinfo.h"
 #include "vfpflags.h"
 #include "vfuncunit.h"
@@ -40,6 +43,7 @@
 #include <sst/core/link.h>
 #include <sst/core/output.h>
 #include <sst/core/params.h>
+#include <sst/elements/hostprof/hostProfile.h>
 
 namespace SST {
 namespace Vanadis {
@@ -50,46 +54,6 @@ namespace Vanadis {
 #define VANADIS_COMPONENT VanadisComponent
 #endif
 
-class VanadisInsCacheLoadRecord
-{
-public:
-    VanadisInsCacheLoadRecord(const uint32_t thr, const uint64_t addrStart, const uint16_t len) :
-        hw_thr(thr),
-        addr(addrStart),
-        width(len),
-        hasPayload(false)
-    {
-
-        data = new uint8_t[len];
-
-        for ( uint16_t i = 0; i < width; ++i ) {
-            data[i] = 0;
-        }
-    }
-
-    uint64_t getAddress() const { return addr; }
-    uint32_t getHWThread() const { return hw_thr; }
-    uint16_t getWidth() const { return width; }
-    bool     hasData() const { return hasPayload; }
-    uint8_t* getPayload() { return data; }
-
-    void setPayload(uint8_t* ptr)
-    {
-        hasPayload = true;
-
-        for ( uint16_t i = 0; i < width; ++i ) {
-            data[i] = ptr[i];
-        }
-    }
-
-private:
-    bool           hasPayload;
-    uint8_t*       data;
-    const uint64_t addr;
-    const uint16_t width;
-    const uint32_t hw_thr;
-};
-
 #ifdef VANADIS_BUILD_DEBUG
 class VanadisDebugComponent : public SST::Component
 {
@@ -118,13 +82,25 @@ public:
         { "stop_verbose_when_retire_address", "When the specified instruction "
                                         "address is retired, set verbose to 0", ""},
         { "pause_when_retire_address", "If specified, the simulation will stop when this address is retired.", "0"},
+        { "host_profile", "Measure the host time spent in the clock handler and report it in the host_* statistics", "false" },
+        { "fast_forward_instructions", "Execute functionally until this many instructions have retired, then switch to "
+                                       "detailed simulation, 0 does not fast-forward on a count", "0" },
+        { "fast_forward_until_address", "Execute functionally until the instruction at this address retires, then switch "
+                                        "to detailed simulation, 0 does not fast-forward to an address", "0" },
+        { "fast_forward_width", "Instructions each hardware thread may retire per cycle while fast-forwarding", "64" },
+        { "fast_forward_warm_branch_predictor", "Train the branch predictors with branches retired while fast-forwarding", "true" },
         { "pipeline_trace_file", "If specified, a trace of the pipeline activity will be generated to this file.", ""},
+        { "pipeline_trace_format", "Format of the pipeline trace, text (one line per retired instruction) or binary (compact, with issue and retire cycles, see sst-vanadis-pipetrace) or commit (fixed width records with register writes and memory addresses, see sst-vanadis-tracediff)", "text"},
         { "max_cycle", "Maximum number of cycles to execute. The core will halt after this many cycles." , "std::numeric_limits<uint64_t>::max()"},
         { "node_id", "Identifier for the node this core belongs to. Each node in the system needs a unique ID between 0 and (number of nodes) - 1. Used to tag output.", "0"},
         { "core_id", "Identifier for this core. Each core in the system needs a unique ID between 0 and (number of cores) - 1.", 0 },
         { "hardware_threads", "Number of hardware threads in this core", "1" },
         { "clock", "Core clock frequency", "1GHz" },
         { "reorder_slots", "Number of slots in the reorder buffer", "64"}, 
+        { "issue_queue", "Select instructions for issue from a wakeup-based issue queue instead of scanning the "
+                         "reorder buffer every cycle. Both pick the same instructions, the scan is kept for validation", "false" },
+        { "instruction_ring_bytes", "Bytes per hardware thread of the ring arena holding in-flight instructions, 0 sizes it "
+                                    "from reorder_slots. Instructions which do not fit are allocated from a pool", "0" },
         { "physical_integer_registers", "Number of physical integer registers per hardware thread", "128" },
         { "physical_fp_registers", "Number of physical floating point registers per hardware thread", "128" },
         { "integer_arith_units", "Number of integer arithemetic units", "2" },
@@ -141,6 +117,9 @@ public:
         { "fetches_per_cycle", "Number of instruction fetches per cycle", "2" },
         { "retires_per_cycle", "Number of instruction retires per cycle", "2" },
         { "decodes_per_cycle", "Number of instruction decodes per cycle", "2" },
+        { "fetch_policy", "How hardware threads share the decode slots of a cycle: all (every thread decodes in every slot), "
+                          "round_robin, icount (thread with the fewest instructions in its ROB first) or priority (lowest thread first). "
+                          "Except for all, a slot goes to one thread and passes to the next candidate if that thread decodes nothing.", "all" },
         { "dcache_line_width", "Width of a line for the data cache, in bytes. (Currently not used but may be in the future).", "64"},
         { "icache_line_width", "Width of a line for the instruction cache, in bytes", "64"},
         { "print_retire_tables", "Print registers during retirement step (default is yes)", "true" },
@@ -163,11 +142,15 @@ public:
         { "instructions_decoded", "Number of instructions decoded", "instructions", 1 },
         { "branch_mispredicts", "Number of retired branches which were mis-predicted", "instructions", 1 },
         { "branches", "Number of retired branches", "instructions", 1 },
+        { "instructions_fast_forwarded", "Number of instructions retired while fast-forwarding, these are not counted in "
+                                         "instructions_retired", "instructions", 1 },
         { "loads_issued", "Number of load instructions issued to the LSQ", "instructions", 1 },
         { "stores_issued", "Number of store instructions issued to the LSQ", "instructions", 1 },
         { "phys_int_reg_in_use", "Number of physical integer registers that are in use each cycle", "registers", 1 },
         { "phys_fp_reg_in_use", "Number of physical floating point registers than are in use each cycle", "registers",
-          1 })
+          1 },
+        { "host_ns_clock", "With host_profile, host nanoseconds spent in the clock handler", "ns", 1 },
+        { "host_events_clock", "With host_profile, number of calls to the clock handler", "count", 1 })
 
     SST_ELI_DOCUMENT_PORTS({ "icache_link", "Connects the CPU to the instruction cache", {} },
                            { "dcache_link", "Connects the CPU to the data cache", {} },
@@ -237,11 +220,18 @@ private:
         VanadisInstruction* ins, VanadisRegisterStack* int_regs, VanadisRegisterStack* fp_regs,
         VanadisISATable* issue_isa_table, VanadisISATable* retire_isa_table);
 
+    void traceCommit(VanadisInstruction* ins);
+
     int  performFetch(const uint64_t cycle);
     int  performDecode(const uint64_t cycle);
+    uint32_t decodeThread(const uint32_t hw_thr, const uint64_t cycle);
     int  performIssue(const uint64_t cycle, int hwThr, uint32_t& rob_start, int& unallocated_memory_op_seen);
+    int  performQueueIssue(const uint64_t cycle, int hwThr);
     int  performExecute(const uint64_t cycle);
     int  performRetire(int rob_num, VanadisCircularQueue<VanadisInstruction*>* rob, const uint64_t cycle);
+    int  performFastForward(const uint64_t cycle, const uint32_t hw_thr);
+    int  fastForwardIssue(const uint32_t hw_thr, VanadisInstruction* ins);
+    void checkFastForwardEnd(const uint64_t retired_addr);
     int  allocateFunctionalUnit(VanadisInstruction* ins);
     bool mapInstructiontoFunctionalUnit(VanadisInstruction* ins, std::vector<VanadisFunctionalUnit*>& functional_units);
     void printRob(int rob_num, VanadisCircularQueue<VanadisInstruction*>* rob);
@@ -279,6 +269,17 @@ private:
 
     uint32_t fetches_per_cycle;
     uint32_t decodes_per_cycle;
+
+    enum VanadisFetchPolicy {
+        VANADIS_FETCH_POLICY_ALL,
+        VANADIS_FETCH_POLICY_ROUND_ROBIN,
+        VANADIS_FETCH_POLICY_ICOUNT,
+        VANADIS_FETCH_POLICY_PRIORITY
+    };
+
+    VanadisFetchPolicy    fetch_policy;
+    uint32_t              fetch_next_thread;
+    std::vector<uint32_t> fetch_order;
     uint32_t issues_per_cycle;
     uint32_t retires_per_cycle;
 
@@ -307,7 +308,11 @@ private:
     std::vector<uint8_t*> tmp_not_issued_fp_reg_read;
     std::vector<uint8_t*> tmp_fp_reg_write;
 
-    std::list<VanadisInsCacheLoadRecord*>* icache_load_records;
+    // empty unless issue_queue is set
+    std::vector<VanadisIssueQueue*> issue_queues;
+
+    // storage for each thread's in-flight instructions, in ROB order
+    std::vector<VanadisInstructionRing*> instruction_rings;
 
     VanadisLoadStoreQueue* lsq;
     StandardMem*           memInstInterface;
@@ -328,6 +333,8 @@ private:
     Clock::Handler<VANADIS_COMPONENT>* cpuClockHandler;
 
     FILE*           pipelineTrace;
+    VanadisPipelineTraceWriter* pipelineTraceBinary;
+    VanadisCommitTraceWriter*   commitTrace;
 
     Statistic<uint64_t>* stat_ins_retired;
     Statistic<uint64_t>* stat_ins_decoded;
@@ -342,11 +349,22 @@ private:
     Statistic<uint64_t>* stat_syscall_cycles;
     Statistic<uint64_t>* stat_int_phys_regs_in_use;
     Statistic<uint64_t>* stat_fp_phys_regs_in_use;
+    Statistic<uint64_t>* stat_ins_fast_forwarded;
+    SST::HostProf::HandlerProfile profile_clock;
 
     uint32_t ins_issued_this_cycle;
     uint32_t ins_retired_this_cycle;
     uint32_t ins_decoded_this_cycle;
 
+    // functional execution until the switch to detailed simulation, see
+    // performFastForward
+    bool     fast_forwarding;
+    bool     fast_forward_warm_predictor;
+    uint32_t fast_forward_width;
+    uint64_t fast_forward_instructions;
+    uint64_t fast_forward_until_address;
+    uint64_t ins_fast_forwarded;
+
     uint64_t pause_on_retire_address;
     std::deque<uint64_t> start_verbose_when_issue_address;
     uint64_t stop_verbose_when_retire_address;
@@ -358,8 +376,11 @@ private:
     bool* m_checkpointing;
     std::string m_checkpointDir;
     enum { NO_CHECKPOINT, CHECKPOINT_LOAD, CHECKPOINT_SAVE } m_checkpoint;
+    VanadisCheckpointFormat m_checkpointFormat;
     void checkpoint(FILE*);
     void checkpointLoad(FILE*);
+    void checkpointBinary(const std::string& path);
+    void checkpointLoadBinary(const std::string& path);
 };
 
 } // namespace Vanadis
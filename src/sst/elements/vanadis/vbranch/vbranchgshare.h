@@ -0,0 +1,106 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_VANADIS_BRANCH_UNIT_GSHARE
+#define _H_VANADIS_BRANCH_UNIT_GSHARE
+
+#include "vbranch/vbranchtable.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace SST {
+namespace Vanadis {
+
+class VanadisGShareBranchUnit : public VanadisTableBranchUnit {
+
+public:
+    SST_ELI_REGISTER_SUBCOMPONENT(VanadisGShareBranchUnit, "vanadis", "VanadisGShareBranchUnit",
+                                          SST_ELI_ELEMENT_VERSION(1, 0, 0),
+                                          "Implements gshare branch direction prediction with a branch target buffer",
+                                          SST::Vanadis::VanadisBranchUnit)
+
+    SST_ELI_DOCUMENT_PARAMS({ "btb_sets", "Number of sets in the branch target buffer", "128" },
+                            { "btb_ways", "Number of ways in each branch target buffer set", "4" },
+                            { "pht_entries", "Number of two-bit counters in the pattern history table, must be a power of 2", "4096" },
+                            { "history_bits", "Number of global history bits hashed with the branch address", "12" })
+
+    SST_ELI_DOCUMENT_STATISTICS({ "branch_cache_hit", "Counts the number of times a speculated "
+                                                      "address is found in the branch target buffer", "hits", 1 },
+                                { "branch_cache_miss", "Counts the number of times a speculated "
+                                                       "address is not found in the branch target buffer", "misses", 1 },
+                                { "branch_cache_castout", "Counts the number of entries that are thrown "
+                                                          "out because of capacity limits", "entries", 1 },
+                                { "direction_mispredict", "Counts the number of retired branches whose direction "
+                                                          "was predicted wrongly", "branches", 1 })
+
+    VanadisGShareBranchUnit(ComponentId_t id, Params& params) : VanadisTableBranchUnit(id, params) {
+        const uint32_t pht_entries  = params.find<uint32_t>("pht_entries", 4096);
+        const uint32_t history_bits = params.find<uint32_t>("history_bits", 12);
+
+        if (!isPowerOfTwo(pht_entries)) {
+            getSimulationOutput().fatal(CALL_INFO, -1, "Error: pht_entries (%" PRIu32 ") must be a power of 2.\n",
+                pht_entries);
+        }
+
+        if (history_bits > 32) {
+            getSimulationOutput().fatal(CALL_INFO, -1, "Error: history_bits (%" PRIu32 ") must be at most 32.\n",
+                history_bits);
+        }
+
+        // weakly not-taken
+        pht.resize(pht_entries, 1);
+        pht_mask     = pht_entries - 1;
+        history_mask = (history_bits == 32) ? UINT32_MAX : ((UINT32_C(1) << history_bits) - 1);
+        history      = 0;
+    }
+
+    virtual ~VanadisGShareBranchUnit() {}
+
+protected:
+    virtual bool predictTaken(const uint64_t pc) { return pht[index(pc)] >= 2; }
+
+    virtual bool train(const uint64_t pc, const bool taken) {
+        uint8_t&   counter   = pht[index(pc)];
+        const bool predicted = (counter >= 2);
+
+        if (taken) {
+            if (counter < 3) {
+                counter++;
+            }
+        } else {
+            if (counter > 0) {
+                counter--;
+            }
+        }
+
+        history = ((history << 1) | (taken ? 1 : 0)) & history_mask;
+
+        return predicted == taken;
+    }
+
+private:
+    uint32_t index(const uint64_t pc) const { return (static_cast<uint32_t>(pc >> 1) ^ history) & pht_mask; }
+
+    std::vector<uint8_t> pht;
+    uint32_t             pht_mask;
+    uint32_t             history_mask;
+    uint32_t             history;
+};
+
+} // namespace Vanadis
+} // namespace SST
+
+#endif
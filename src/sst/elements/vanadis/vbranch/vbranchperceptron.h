@@ -0,0 +1,137 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_VANADIS_BRANCH_UNIT_PERCEPTRON
+#define _H_VANADIS_BRANCH_UNIT_PERCEPTRON
+
+#include "vbranch/vbranchtable.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace SST {
+namespace Vanadis {
+
+/*
+ * Perceptron direction predictor (Jimenez and Lin): each branch hashes to a
+ * row of signed weights, one per global history bit plus a bias, and the
+ * branch is predicted taken when the dot product with the history (taken as
+ * +1, not-taken as -1) is not negative. Weights are trained on a wrong
+ * prediction or when the output is within the training threshold.
+ */
+class VanadisPerceptronBranchUnit : public VanadisTableBranchUnit {
+
+public:
+    SST_ELI_REGISTER_SUBCOMPONENT(VanadisPerceptronBranchUnit, "vanadis", "VanadisPerceptronBranchUnit",
+                                          SST_ELI_ELEMENT_VERSION(1, 0, 0),
+                                          "Implements perceptron branch direction prediction with a branch target buffer",
+                                          SST::Vanadis::VanadisBranchUnit)
+
+    SST_ELI_DOCUMENT_PARAMS({ "btb_sets", "Number of sets in the branch target buffer", "128" },
+                            { "btb_ways", "Number of ways in each branch target buffer set", "4" },
+                            { "perceptron_entries", "Number of perceptrons (rows of weights)", "256" },
+                            { "history_bits", "Number of global history bits each perceptron weighs, at most 64", "32" })
+
+    SST_ELI_DOCUMENT_STATISTICS({ "branch_cache_hit", "Counts the number of times a speculated "
+                                                      "address is found in the branch target buffer", "hits", 1 },
+                                { "branch_cache_miss", "Counts the number of times a speculated "
+                                                       "address is not found in the branch target buffer", "misses", 1 },
+                                { "branch_cache_castout", "Counts the number of entries that are thrown "
+                                                          "out because of capacity limits", "entries", 1 },
+                                { "direction_mispredict", "Counts the number of retired branches whose direction "
+                                                          "was predicted wrongly", "branches", 1 })
+
+    VanadisPerceptronBranchUnit(ComponentId_t id, Params& params) : VanadisTableBranchUnit(id, params) {
+        rows         = params.find<uint32_t>("perceptron_entries", 256);
+        history_bits = params.find<uint32_t>("history_bits", 32);
+
+        if (0 == rows) {
+            getSimulationOutput().fatal(CALL_INFO, -1, "Error: perceptron_entries must be at least 1.\n");
+        }
+
+        if ((0 == history_bits) || (history_bits > 64)) {
+            getSimulationOutput().fatal(CALL_INFO, -1, "Error: history_bits (%" PRIu32 ") must be between 1 and 64.\n",
+                history_bits);
+        }
+
+        // training threshold from the original paper, 1.93 * h + 14
+        threshold = static_cast<int32_t>((193 * history_bits) / 100 + 14);
+        weights.resize(static_cast<size_t>(rows) * (history_bits + 1), 0);
+        history = 0;
+    }
+
+    virtual ~VanadisPerceptronBranchUnit() {}
+
+protected:
+    virtual bool predictTaken(const uint64_t pc) { return dotProduct(pc) >= 0; }
+
+    virtual bool train(const uint64_t pc, const bool taken) {
+        const int32_t y         = dotProduct(pc);
+        const bool    predicted = (y >= 0);
+
+        if ((predicted != taken) || (y <= threshold && y >= -threshold)) {
+            int8_t* row = rowOf(pc);
+
+            adjust(row[0], taken);
+
+            for (uint32_t i = 0; i < history_bits; ++i) {
+                adjust(row[i + 1], taken == historyBit(i));
+            }
+        }
+
+        history = (history << 1) | (taken ? 1 : 0);
+
+        return predicted == taken;
+    }
+
+private:
+    int8_t* rowOf(const uint64_t pc) { return &weights[((pc >> 1) % rows) * (history_bits + 1)]; }
+
+    bool historyBit(const uint32_t i) const { return 0 != ((history >> i) & 1); }
+
+    int32_t dotProduct(const uint64_t pc) {
+        const int8_t* row = rowOf(pc);
+        int32_t       y   = row[0];
+
+        for (uint32_t i = 0; i < history_bits; ++i) {
+            y += historyBit(i) ? row[i + 1] : -row[i + 1];
+        }
+
+        return y;
+    }
+
+    static void adjust(int8_t& weight, const bool increase) {
+        if (increase) {
+            if (weight < INT8_MAX) {
+                weight++;
+            }
+        } else {
+            if (weight > INT8_MIN) {
+                weight--;
+            }
+        }
+    }
+
+    uint32_t            rows;
+    uint32_t            history_bits;
+    int32_t             threshold;
+    std::vector<int8_t> weights;
+    uint64_t            history;
+};
+
+} // namespace Vanadis
+} // namespace SST
+
+#endif
@@ -0,0 +1,248 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_VANADIS_BRANCH_UNIT_TABLE
+#define _H_VANADIS_BRANCH_UNIT_TABLE
+
+#include "vbranch/vbranchunit.h"
+
+#include <cstdint>
+#include <vector>
+
+namespace SST {
+namespace Vanadis {
+
+/*
+ * Set-associative branch target buffer held in fixed arrays. Each entry keeps
+ * the last taken target and the fall-through address seen for a branch so a
+ * direction prediction can be turned into a next instruction address.
+ */
+class VanadisBranchTargetBuffer {
+public:
+    struct Entry {
+        uint64_t pc              = 0;
+        uint64_t target          = 0;
+        uint64_t fallthrough     = 0;
+        uint64_t last_use        = 0;
+        bool     valid           = false;
+        bool     has_target      = false;
+        bool     has_fallthrough = false;
+    };
+
+    VanadisBranchTargetBuffer(const uint32_t btb_sets, const uint32_t btb_ways) :
+        sets(btb_sets), ways(btb_ways), entries(btb_sets * btb_ways), use_clock(0) {}
+
+    Entry* find(const uint64_t pc) {
+        Entry* set = &entries[setOf(pc) * ways];
+
+        for (uint32_t i = 0; i < ways; ++i) {
+            if (set[i].valid && (set[i].pc == pc)) {
+                set[i].last_use = ++use_clock;
+                return &set[i];
+            }
+        }
+
+        return nullptr;
+    }
+
+    // Claim the least recently used way of the set, evicted is set if a
+    // valid entry had to be thrown out
+    Entry* allocate(const uint64_t pc, bool& evicted) {
+        Entry* set    = &entries[setOf(pc) * ways];
+        Entry* victim = &set[0];
+
+        for (uint32_t i = 0; i < ways; ++i) {
+            if (!set[i].valid) {
+                victim = &set[i];
+                break;
+            }
+
+            if (set[i].last_use < victim->last_use) {
+                victim = &set[i];
+            }
+        }
+
+        evicted = victim->valid;
+
+        *victim          = Entry();
+        victim->pc       = pc;
+        victim->valid    = true;
+        victim->last_use = ++use_clock;
+
+        return victim;
+    }
+
+private:
+    uint32_t setOf(const uint64_t pc) const {
+        // instructions are at least 2-byte aligned (RISC-V compressed)
+        return (pc >> 1) % sets;
+    }
+
+    const uint32_t     sets;
+    const uint32_t     ways;
+    std::vector<Entry> entries;
+    uint64_t           use_clock;
+};
+
+/*
+ * Common part of the table-based predictors: a branch target buffer supplies
+ * addresses and a direction predictor, implemented by the subclass, chooses
+ * between the taken target and the fall-through.
+ *
+ * The branch unit interface only reports the address each branch resolved to,
+ * so the direction is inferred: a resolved address just past the branch (at
+ * most 8 bytes, covering compressed instructions and MIPS delay slots) is the
+ * fall-through when it is the smallest such address seen, anything else is
+ * taken. Predictors are trained, and their histories advanced, when branches
+ * retire, which is also when push() is called.
+ */
+class VanadisTableBranchUnit : public VanadisBranchUnit {
+public:
+    VanadisTableBranchUnit(ComponentId_t id, Params& params) :
+        VanadisBranchUnit(id, params),
+        btb(params.find<uint32_t>("btb_sets", 128), params.find<uint32_t>("btb_ways", 4)) {
+        if ((0 == params.find<uint32_t>("btb_sets", 128)) || (0 == params.find<uint32_t>("btb_ways", 4))) {
+            getSimulationOutput().fatal(CALL_INFO, -1, "Error: btb_sets and btb_ways must be at least 1.\n");
+        }
+
+        lookup_addr  = 0;
+        lookup_next  = 0;
+        lookup_valid = false;
+
+        stat_branch_hits          = registerStatistic<uint64_t>("branch_cache_hit", "1");
+        stat_branch_misses        = registerStatistic<uint64_t>("branch_cache_miss", "1");
+        stat_branch_cache_castout = registerStatistic<uint64_t>("branch_cache_castout", "1");
+        stat_direction_mispredict = registerStatistic<uint64_t>("direction_mispredict", "1");
+    }
+
+    virtual ~VanadisTableBranchUnit() {}
+
+    virtual void push(const uint64_t ins_addr, const uint64_t pred_addr) {
+        VanadisBranchTargetBuffer::Entry* entry = btb.find(ins_addr);
+
+        if (nullptr == entry) {
+            bool evicted = false;
+            entry        = btb.allocate(ins_addr, evicted);
+
+            if (evicted) {
+                stat_branch_cache_castout->addData(1);
+            }
+        }
+
+        bool taken = true;
+
+        if ((pred_addr > ins_addr) && (pred_addr <= (ins_addr + 8))) {
+            if (!entry->has_fallthrough || (pred_addr <= entry->fallthrough)) {
+                entry->fallthrough     = pred_addr;
+                entry->has_fallthrough = true;
+            }
+
+            taken = (pred_addr != entry->fallthrough);
+        }
+
+        if (taken) {
+            entry->target     = pred_addr;
+            entry->has_target = true;
+        }
+
+        if (!train(ins_addr, taken)) {
+            stat_direction_mispredict->addData(1);
+        }
+
+        lookup_valid = false;
+    }
+
+    virtual uint64_t predictAddress(const uint64_t addr) {
+        if (lookup_valid && (lookup_addr == addr)) {
+            return lookup_next;
+        }
+
+        uint64_t next_addr = 0;
+        return lookup(addr, next_addr) ? next_addr : 0;
+    }
+
+    virtual bool contains(const uint64_t addr) {
+        uint64_t   next_addr = 0;
+        const bool found     = lookup(addr, next_addr);
+
+        lookup_addr  = addr;
+        lookup_next  = next_addr;
+        lookup_valid = found;
+
+        if (found) {
+            stat_branch_hits->addData(1);
+        } else {
+            stat_branch_misses->addData(1);
+        }
+
+        return found;
+    }
+
+protected:
+    // Direction for the branch at pc with the current history
+    virtual bool predictTaken(const uint64_t pc) = 0;
+
+    // Update with the resolved direction and advance the history, returns
+    // whether the direction predicted before the update was correct
+    virtual bool train(const uint64_t pc, const bool taken) = 0;
+
+    static uint32_t log2Of(uint32_t value) {
+        uint32_t bits = 0;
+
+        while (value > 1) {
+            value >>= 1;
+            bits++;
+        }
+
+        return bits;
+    }
+
+    static bool isPowerOfTwo(const uint64_t value) { return (0 != value) && (0 == (value & (value - 1))); }
+
+private:
+    bool lookup(const uint64_t addr, uint64_t& next_addr) {
+        VanadisBranchTargetBuffer::Entry* entry = btb.find(addr);
+
+        if (nullptr == entry) {
+            return false;
+        }
+
+        if (predictTaken(addr)) {
+            next_addr = entry->target;
+            return entry->has_target;
+        }
+
+        next_addr = entry->fallthrough;
+        return entry->has_fallthrough;
+    }
+
+    VanadisBranchTargetBuffer btb;
+
+    // the decoders call contains() and then predictAddress() for the same
+    // branch, keep the answer rather than predicting twice
+    uint64_t lookup_addr;
+    uint64_t lookup_next;
+    bool     lookup_valid;
+
+    Statistic<uint64_t>* stat_branch_hits;
+    Statistic<uint64_t>* stat_branch_misses;
+    Statistic<uint64_t>* stat_branch_cache_castout;
+    Statistic<uint64_t>* stat_direction_mispredict;
+};
+
+} // namespace Vanadis
+} // namespace SST
+
+#endif
@@ -0,0 +1,384 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_VANADIS_BRANCH_UNIT_TAGE
+#define _H_VANADIS_BRANCH_UNIT_TAGE
+
+#include "vbranch/vbranchtable.h"
+
+#include <cmath>
+#include <cstdint>
+#include <vector>
+
+namespace SST {
+namespace Vanadis {
+
+static constexpr uint32_t VANADIS_TAGE_MAX_TABLES = 16;
+
+/*
+ * TAGE direction predictor (Seznec): a bimodal base table plus tagged tables
+ * indexed with geometrically increasing lengths of global history. The
+ * longest matching table provides the prediction, falling back to the next
+ * match when the provider entry is newly allocated and that has been the
+ * better choice. Mispredictions allocate an entry in a longer table.
+ *
+ * Histories are folded into index and tag sized values incrementally, so a
+ * prediction costs one hash per table whatever the history length.
+ */
+class VanadisTAGEBranchUnit : public VanadisTableBranchUnit {
+
+public:
+    SST_ELI_REGISTER_SUBCOMPONENT(VanadisTAGEBranchUnit, "vanadis", "VanadisTAGEBranchUnit",
+                                          SST_ELI_ELEMENT_VERSION(1, 0, 0),
+                                          "Implements TAGE branch direction prediction with a branch target buffer",
+                                          SST::Vanadis::VanadisBranchUnit)
+
+    SST_ELI_DOCUMENT_PARAMS({ "btb_sets", "Number of sets in the branch target buffer", "128" },
+                            { "btb_ways", "Number of ways in each branch target buffer set", "4" },
+                            { "bimodal_bits", "Log2 of the number of entries in the bimodal base table", "12" },
+                            { "tagged_tables", "Number of tagged tables", "4" },
+                            { "tagged_table_bits", "Log2 of the number of entries in each tagged table", "10" },
+                            { "tag_bits", "Width of the tags in the tagged tables", "9" },
+                            { "min_history", "Global history length used by the first tagged table", "5" },
+                            { "max_history", "Global history length used by the last tagged table", "64" })
+
+    SST_ELI_DOCUMENT_STATISTICS({ "branch_cache_hit", "Counts the number of times a speculated "
+                                                      "address is found in the branch target buffer", "hits", 1 },
+                                { "branch_cache_miss", "Counts the number of times a speculated "
+                                                       "address is not found in the branch target buffer", "misses", 1 },
+                                { "branch_cache_castout", "Counts the number of entries that are thrown "
+                                                          "out because of capacity limits", "entries", 1 },
+                                { "direction_mispredict", "Counts the number of retired branches whose direction "
+                                                          "was predicted wrongly", "branches", 1 })
+
+    VanadisTAGEBranchUnit(ComponentId_t id, Params& params) : VanadisTableBranchUnit(id, params) {
+        const uint32_t bimodal_bits = params.find<uint32_t>("bimodal_bits", 12);
+        const uint32_t table_count  = params.find<uint32_t>("tagged_tables", 4);
+        table_bits                  = params.find<uint32_t>("tagged_table_bits", 10);
+        tag_bits                    = params.find<uint32_t>("tag_bits", 9);
+        const uint32_t min_history  = params.find<uint32_t>("min_history", 5);
+        const uint32_t max_history  = params.find<uint32_t>("max_history", 64);
+
+        if ((bimodal_bits == 0) || (bimodal_bits > 24) || (table_bits == 0) || (table_bits > 20)) {
+            getSimulationOutput().fatal(CALL_INFO, -1,
+                "Error: bimodal_bits and tagged_table_bits must be between 1 and 24 / 20.\n");
+        }
+
+        if ((tag_bits < 2) || (tag_bits > 16)) {
+            getSimulationOutput().fatal(CALL_INFO, -1, "Error: tag_bits (%" PRIu32 ") must be between 2 and 16.\n",
+                tag_bits);
+        }
+
+        if ((table_count == 0) || (table_count > VANADIS_TAGE_MAX_TABLES) || (min_history == 0) ||
+            (max_history < min_history)) {
+            getSimulationOutput().fatal(CALL_INFO, -1,
+                "Error: tagged_tables must be between 1 and %" PRIu32 " and 0 < min_history <= max_history.\n",
+                VANADIS_TAGE_MAX_TABLES);
+        }
+
+        bimodal.resize(static_cast<size_t>(1) << bimodal_bits, 0);
+        bimodal_mask = (UINT32_C(1) << bimodal_bits) - 1;
+
+        tables.resize(table_count);
+
+        for (uint32_t i = 0; i < table_count; ++i) {
+            TaggedTable& table = tables[i];
+
+            // geometric series of history lengths between min and max
+            if (table_count == 1) {
+                table.history_length = min_history;
+            } else {
+                const double ratio   = static_cast<double>(max_history) / static_cast<double>(min_history);
+                table.history_length = static_cast<uint32_t>(
+                    std::lround(min_history * std::pow(ratio, static_cast<double>(i) / (table_count - 1))));
+            }
+
+            table.entries.resize(static_cast<size_t>(1) << table_bits);
+            table.index_fold.init(table.history_length, table_bits);
+            table.tag_fold[0].init(table.history_length, tag_bits);
+            table.tag_fold[1].init(table.history_length, tag_bits - 1);
+        }
+
+        history.resize(max_history + 1, 0);
+        history_head = 0;
+        use_alt      = 8;
+        branch_count = 0;
+        alloc_seed   = 1;
+    }
+
+    virtual ~VanadisTAGEBranchUnit() {}
+
+protected:
+    virtual bool predictTaken(const uint64_t pc) {
+        Prediction pred;
+        predict(pc, pred);
+        return pred.taken;
+    }
+
+    virtual bool train(const uint64_t pc, const bool taken) {
+        Prediction pred;
+        predict(pc, pred);
+
+        const int32_t table_count = static_cast<int32_t>(tables.size());
+
+        if (pred.provider >= 0) {
+            TaggedEntry& provider = tables[pred.provider].entries[pred.indices[pred.provider]];
+
+            // a weak, newly allocated entry disagreeing with the alternate
+            // tells us which of the two to trust for new entries
+            if (isWeak(provider.counter) && (pred.provider_taken != pred.alt_taken)) {
+                if (pred.alt_taken == taken) {
+                    if (use_alt < 15) {
+                        use_alt++;
+                    }
+                } else {
+                    if (use_alt > 0) {
+                        use_alt--;
+                    }
+                }
+            }
+
+            updateCounter(provider.counter, taken, 3);
+
+            if (pred.provider_taken != pred.alt_taken) {
+                if (pred.provider_taken == taken) {
+                    if (provider.useful < 3) {
+                        provider.useful++;
+                    }
+                } else {
+                    if (provider.useful > 0) {
+                        provider.useful--;
+                    }
+                }
+            }
+        } else {
+            updateBimodal(bimodal[bimodalIndex(pc)], taken);
+        }
+
+        // mispredicted, claim an entry in a longer history table
+        if ((pred.taken != taken) && (pred.provider < (table_count - 1))) {
+            int32_t start = pred.provider + 1;
+
+            // occasionally skip a table so allocations spread out
+            if ((start < (table_count - 1)) && (0 == (nextRandom() & 3))) {
+                start++;
+            }
+
+            bool allocated = false;
+
+            for (int32_t i = start; i < table_count; ++i) {
+                TaggedEntry& candidate = tables[i].entries[pred.indices[i]];
+
+                if (0 == candidate.useful) {
+                    candidate.tag     = pred.tags[i];
+                    candidate.counter = taken ? 0 : -1;
+                    allocated         = true;
+                    break;
+                }
+            }
+
+            if (!allocated) {
+                for (int32_t i = start; i < table_count; ++i) {
+                    TaggedEntry& candidate = tables[i].entries[pred.indices[i]];
+
+                    if (candidate.useful > 0) {
+                        candidate.useful--;
+                    }
+                }
+            }
+        }
+
+        // periodically age the useful bits so stale entries can be replaced
+        if (0 == (++branch_count & ((UINT64_C(1) << 18) - 1))) {
+            for (TaggedTable& table : tables) {
+                for (TaggedEntry& entry : table.entries) {
+                    entry.useful >>= 1;
+                }
+            }
+        }
+
+        pushHistory(taken);
+
+        return pred.taken == taken;
+    }
+
+private:
+    // history of orig_length bits folded into comp_length bits, updated as
+    // each bit enters and the oldest leaves the window
+    struct FoldedHistory {
+        uint32_t value       = 0;
+        uint32_t orig_length = 0;
+        uint32_t comp_length = 0;
+        uint32_t out_point   = 0;
+
+        void init(const uint32_t original, const uint32_t compressed) {
+            value       = 0;
+            orig_length = original;
+            comp_length = compressed;
+            out_point   = original % compressed;
+        }
+
+        void update(const uint32_t in_bit, const uint32_t out_bit) {
+            value = (value << 1) | in_bit;
+            value ^= out_bit << out_point;
+            value ^= value >> comp_length;
+            value &= (UINT32_C(1) << comp_length) - 1;
+        }
+    };
+
+    struct TaggedEntry {
+        int8_t   counter = 0;
+        uint8_t  useful  = 0;
+        uint16_t tag     = 0;
+    };
+
+    struct TaggedTable {
+        uint32_t                 history_length = 0;
+        FoldedHistory            index_fold;
+        FoldedHistory            tag_fold[2];
+        std::vector<TaggedEntry> entries;
+    };
+
+    struct Prediction {
+        bool    taken          = false;
+        bool    provider_taken = false;
+        bool    alt_taken      = false;
+        int32_t provider       = -1;
+
+        uint32_t indices[VANADIS_TAGE_MAX_TABLES];
+        uint16_t tags[VANADIS_TAGE_MAX_TABLES];
+    };
+
+    void predict(const uint64_t pc, Prediction& pred) {
+        const int32_t table_count = static_cast<int32_t>(tables.size());
+
+        int32_t alt = -1;
+
+        for (int32_t i = 0; i < table_count; ++i) {
+            pred.indices[i] = taggedIndex(pc, tables[i]);
+            pred.tags[i]    = taggedTag(pc, tables[i]);
+        }
+
+        for (int32_t i = table_count - 1; i >= 0; --i) {
+            if (tables[i].entries[pred.indices[i]].tag == pred.tags[i]) {
+                if (pred.provider < 0) {
+                    pred.provider = i;
+                } else {
+                    alt = i;
+                    break;
+                }
+            }
+        }
+
+        const bool base_taken = bimodal[bimodalIndex(pc)] >= 2;
+
+        if (pred.provider < 0) {
+            pred.taken = pred.provider_taken = pred.alt_taken = base_taken;
+            return;
+        }
+
+        const TaggedEntry& provider = tables[pred.provider].entries[pred.indices[pred.provider]];
+
+        pred.provider_taken = (provider.counter >= 0);
+        pred.alt_taken      = (alt >= 0) ? (tables[alt].entries[pred.indices[alt]].counter >= 0) : base_taken;
+
+        pred.taken = (isWeak(provider.counter) && (use_alt >= 8)) ? pred.alt_taken : pred.provider_taken;
+    }
+
+    uint32_t bimodalIndex(const uint64_t pc) const { return static_cast<uint32_t>(pc >> 1) & bimodal_mask; }
+
+    uint32_t taggedIndex(const uint64_t pc, const TaggedTable& table) const {
+        const uint32_t addr = static_cast<uint32_t>(pc >> 1);
+        return (addr ^ (addr >> table_bits) ^ table.index_fold.value) & ((UINT32_C(1) << table_bits) - 1);
+    }
+
+    uint16_t taggedTag(const uint64_t pc, const TaggedTable& table) const {
+        const uint32_t addr = static_cast<uint32_t>(pc >> 1);
+        return static_cast<uint16_t>(
+            (addr ^ table.tag_fold[0].value ^ (table.tag_fold[1].value << 1)) & ((UINT32_C(1) << tag_bits) - 1));
+    }
+
+    void pushHistory(const bool taken) {
+        const size_t length = history.size();
+
+        history_head          = (history_head + length - 1) % length;
+        history[history_head] = taken ? 1 : 0;
+
+        for (TaggedTable& table : tables) {
+            const uint32_t out_bit = history[(history_head + table.history_length) % length];
+
+            table.index_fold.update(history[history_head], out_bit);
+            table.tag_fold[0].update(history[history_head], out_bit);
+            table.tag_fold[1].update(history[history_head], out_bit);
+        }
+    }
+
+    static bool isWeak(const int8_t counter) { return (counter == 0) || (counter == -1); }
+
+    // signed counters in [-2^(bits-1), 2^(bits-1) - 1]
+    static void updateCounter(int8_t& counter, const bool taken, const uint32_t bits) {
+        const int8_t max = static_cast<int8_t>((1 << (bits - 1)) - 1);
+        const int8_t min = static_cast<int8_t>(-(1 << (bits - 1)));
+
+        if (taken) {
+            if (counter < max) {
+                counter++;
+            }
+        } else {
+            if (counter > min) {
+                counter--;
+            }
+        }
+    }
+
+    static void updateBimodal(uint8_t& counter, const bool taken) {
+        if (taken) {
+            if (counter < 3) {
+                counter++;
+            }
+        } else {
+            if (counter > 0) {
+                counter--;
+            }
+        }
+    }
+
+    uint32_t nextRandom() {
+        // xorshift, only used to spread allocations
+        alloc_seed ^= alloc_seed << 13;
+        alloc_seed ^= alloc_seed >> 17;
+        alloc_seed ^= alloc_seed << 5;
+        return alloc_seed;
+    }
+
+    std::vector<uint8_t>     bimodal;
+    uint32_t                 bimodal_mask;
+    std::vector<TaggedTable> tables;
+    uint32_t                 table_bits;
+    uint32_t                 tag_bits;
+
+    // global history, newest bit at history_head
+    std::vector<uint8_t> history;
+    size_t               history_head;
+
+    uint32_t use_alt;
+    uint64_t branch_count;
+    uint32_t alloc_seed;
+};
+
+} // namespace Vanadis
+} // namespace SST
+
+#endif
@@ -431,6 +431,7 @@ class VanadisELFInfo {
 public:
     VanadisELFInfo() {
         bin_path = nullptr;
+        bin_file = nullptr;
         elf_class = UINT8_MAX;
         elf_endian = VANADIS_LITTLE_ENDIAN;
         elf_os_abi = UINT8_MAX;
@@ -570,6 +571,16 @@ public:
     const char* getBinaryPath() const { return bin_path; }
     const char* getBinaryPathShort() const { return bin_path_short; }
 
+    // Pages are read from the binary on demand as they fault, keep one handle
+    // open for all of them rather than reopening the file on every fault.
+    // Returns nullptr if the binary cannot be opened.
+    FILE* getBinaryFile() {
+        if ( nullptr == bin_file && nullptr != bin_path ) {
+            bin_file = fopen(bin_path, "rb");
+        }
+        return bin_file;
+    }
+
     uint64_t getEntryPoint() const { return elf_entry_point; }
     VanadisELFEndianness getEndian() const { return elf_endian; }
     uint64_t getProgramHeaderOffset() const { return elf_prog_header_start; }
@@ -629,6 +640,10 @@ public:
     }
 
     ~VanadisELFInfo() {
+        if (nullptr != bin_file) {
+            fclose(bin_file);
+        }
+
         if (nullptr != bin_path) {
             delete[] bin_path;
         }
@@ -653,6 +668,7 @@ public:
 protected:
     char* bin_path;
     char* bin_path_short;
+    FILE* bin_file;
     uint8_t elf_class;
     VanadisELFEndianness elf_endian;
     uint8_t elf_os_abi;
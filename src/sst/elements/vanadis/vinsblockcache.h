@@ -0,0 +1,250 @@
+// Copyright 2009-2024 NTESS. Under the terms
+// of Contract DE-NA0003525 with NTESS, the U.S.
+// Government retains certain rights in this software.
+//
+// Copyright (c) 2009-2024, NTESS
+// All rights reserved.
+//
+// Portions are copyright of other developers:
+// See the file CONTRIBUTORS.TXT in the top level directory
+// of the distribution for more information.
+//
+// This file is part of the SST software package. For license
+// information, see the LICENSE file in the top level directory of the
+// distribution.
+
+#ifndef _H_VANADIS_INST_BLOCK_CACHE
+#define _H_VANADIS_INST_BLOCK_CACHE
+
+#include <sst/core/statapi/statbase.h>
+
+#include <cinttypes>
+#include <cstdint>
+#include <vector>
+
+#include "vinsbundle.h"
+
+namespace SST {
+namespace Vanadis {
+
+/*
+ * Set-associative cache of decoded basic blocks. Each entry is keyed by the
+ * address of the block's first instruction and holds the bundles of the
+ * instructions that follow it sequentially, up to and including the first
+ * bundle with a branch (or until the block reaches its maximum length).
+ *
+ * Lookups by address only go to the sets at the start of a block; while the
+ * decoder walks through a block a cursor supplies the next bundle without a
+ * search. Blocks are filled as the decoder produces bundles, and a full set
+ * evicts its least recently used block together with all of its bundles, so
+ * the cache never holds more than sets * ways * block-length bundles.
+ */
+class VanadisDecodedBlockCache {
+public:
+    VanadisDecodedBlockCache(const uint32_t block_sets, const uint32_t block_ways, const uint32_t max_length) :
+        sets(block_sets), ways(block_ways), max_block_length(max_length), blocks(block_sets * block_ways) {
+        use_clock  = 0;
+        read_block = nullptr;
+        read_index = 0;
+        fill_block = nullptr;
+
+        stat_block_hit   = nullptr;
+        stat_block_miss  = nullptr;
+        stat_block_evict = nullptr;
+    }
+
+    ~VanadisDecodedBlockCache() { clear(); }
+
+    void setStatistics(Statistic<uint64_t>* hit, Statistic<uint64_t>* miss, Statistic<uint64_t>* evict) {
+        stat_block_hit   = hit;
+        stat_block_miss  = miss;
+        stat_block_evict = evict;
+    }
+
+    void clear() {
+        for (Block& next_block : blocks) {
+            release(next_block);
+        }
+
+        read_block = nullptr;
+        fill_block = nullptr;
+    }
+
+    // Is there a bundle for this address, either next in the block being
+    // read or at the start of a cached block
+    bool contains(const uint64_t addr) {
+        if (nullptr != read_block) {
+            if (bundleAt(read_block, read_index, addr)) {
+                return true;
+            }
+
+            if (bundleAt(read_block, read_index + 1, addr)) {
+                read_index++;
+                return true;
+            }
+        }
+
+        Block* found = findBlock(addr);
+
+        if (nullptr != found) {
+            found->last_use = ++use_clock;
+            read_block      = found;
+            read_index      = 0;
+            recordStat(stat_block_hit);
+            return true;
+        }
+
+        // the cursor is kept, the bundle it points to may still be in use
+        return false;
+    }
+
+    // Only valid after contains(addr) returned true
+    VanadisInstructionBundle* find(const uint64_t addr) { return read_block->bundles[read_index]; }
+
+    void store(VanadisInstructionBundle* bundle) {
+        const uint64_t addr = bundle->getInstructionAddress();
+
+        if ((nullptr == fill_block) || fill_block->closed || (fill_block->next_addr != addr) ||
+            (fill_block->bundles.size() >= max_block_length)) {
+            fill_block = allocateBlock(addr);
+        }
+
+        fill_block->bundles.push_back(bundle);
+        fill_block->next_addr = addr + bundle->pcIncrement();
+        fill_block->closed    = bundle->containsBranch();
+
+        // the decoder asks for this bundle straight after storing it
+        read_block = fill_block;
+        read_index = fill_block->bundles.size() - 1;
+    }
+
+    // Number of bundles held
+    size_t size() const {
+        size_t count = 0;
+
+        for (const Block& next_block : blocks) {
+            count += next_block.bundles.size();
+        }
+
+        return count;
+    }
+
+    size_t capacity() const { return blocks.size() * max_block_length; }
+    size_t blockCapacity() const { return blocks.size(); }
+
+private:
+    struct Block {
+        bool     valid     = false;
+        bool     closed    = false;
+        uint64_t start     = 0;
+        uint64_t next_addr = 0;
+        uint64_t last_use  = 0;
+
+        std::vector<VanadisInstructionBundle*> bundles;
+    };
+
+    uint32_t setOf(const uint64_t addr) const {
+        // instructions are at least 2-byte aligned (RISC-V compressed)
+        return (addr >> 1) % sets;
+    }
+
+    bool bundleAt(const Block* block, const size_t index, const uint64_t addr) const {
+        return (index < block->bundles.size()) && (block->bundles[index]->getInstructionAddress() == addr);
+    }
+
+    Block* findBlock(const uint64_t addr) {
+        Block* set = &blocks[setOf(addr) * ways];
+
+        for (uint32_t i = 0; i < ways; ++i) {
+            if (set[i].valid && (set[i].start == addr)) {
+                return &set[i];
+            }
+        }
+
+        return nullptr;
+    }
+
+    Block* allocateBlock(const uint64_t addr) {
+        Block* victim = findBlock(addr);
+
+        if (nullptr == victim) {
+            Block* set = &blocks[setOf(addr) * ways];
+
+            for (uint32_t i = 0; i < ways; ++i) {
+                Block* candidate = &set[i];
+
+                if (!candidate->valid) {
+                    victim = candidate;
+                    break;
+                }
+
+                // never evict the block the decoder is reading from, it may
+                // still hold a bundle (MIPS decodes the delay slot of a cached
+                // branch), the decoder requires at least two ways
+                if (candidate != read_block) {
+                    if ((nullptr == victim) || (candidate->last_use < victim->last_use)) {
+                        victim = candidate;
+                    }
+                }
+            }
+
+            if (victim->valid) {
+                recordStat(stat_block_evict);
+            }
+        }
+
+        release(*victim);
+
+        victim->valid    = true;
+        victim->start    = addr;
+        victim->last_use = ++use_clock;
+        victim->bundles.reserve(max_block_length);
+
+        recordStat(stat_block_miss);
+        return victim;
+    }
+
+    static void recordStat(Statistic<uint64_t>* stat) {
+        if (nullptr != stat) {
+            stat->addData(1);
+        }
+    }
+
+    void release(Block& block) {
+        for (VanadisInstructionBundle* next_bundle : block.bundles) {
+            delete next_bundle;
+        }
+
+        block.bundles.clear();
+        block.valid  = false;
+        block.closed = false;
+
+        if (read_block == &block) {
+            read_block = nullptr;
+        }
+
+        if (fill_block == &block) {
+            fill_block = nullptr;
+        }
+    }
+
+    const uint32_t sets;
+    const uint32_t ways;
+    const uint32_t max_block_length;
+
+    std::vector<Block> blocks;
+    uint64_t           use_clock;
+
+    Block* read_block;
+    size_t read_index;
+    Block* fill_block;
+
+    Statistic<uint64_t>* stat_block_hit;
+    Statistic<uint64_t>* stat_block_miss;
+    Statistic<uint64_t>* stat_block_evict;
+};
+
+} // namespace Vanadis
+} // namespace SST
+
+#endif
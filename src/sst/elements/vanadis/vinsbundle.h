@@ -42,8 +42,20 @@ public:
 
     uint32_t getInstructionCount() const { return inst_bundle.size(); }
 
+    // The bundle takes ownership of the decoded instruction, which is the
+    // prototype cloned into the ROB each time the bundle is used
     void addInstruction(VanadisInstruction* newIns) {
-        inst_bundle.push_back(newIns->clone());
+        inst_bundle.push_back(newIns);
+    }
+
+    bool containsBranch() const {
+        for (VanadisInstruction* next_ins : inst_bundle) {
+            if (next_ins->getInstFuncType() == INST_BRANCH) {
+                return true;
+            }
+        }
+
+        return false;
     }
 
     VanadisInstruction* getInstructionByIndex(const uint32_t index) {
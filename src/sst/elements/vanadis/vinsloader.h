@@ -27,6 +27,7 @@
 #include "vanadisDbgFlags.h"
 
 #include "datastruct/vcache.h"
+#include "vinsblockcache.h"
 #include "vinsbundle.h"
 
 namespace SST {
@@ -34,7 +35,8 @@ namespace Vanadis {
 
 enum class VanadisInstructionLoaderMode {
     INFINITE_CACHE_MODE,
-    LRU_CACHE_MODE
+    LRU_CACHE_MODE,
+    BLOCK_CACHE_MODE
 };
 
 class VanadisInstructionLoader {
@@ -47,6 +49,7 @@ public:
         predecode_cache = new VanadisCache<uint64_t, uint8_t*, SST::Vanadis::VanadisCacheRecordDeletion::VANADIS_PERFORM_DELETE_ARRAY>(predecode_cache_entries);
 
         mem_if = nullptr;
+        block_cache = nullptr;
 
         loader_mode = VanadisInstructionLoaderMode::LRU_CACHE_MODE;
         switchLoaderMode();
@@ -55,6 +58,7 @@ public:
     ~VanadisInstructionLoader() {
         delete uop_cache;
         delete predecode_cache;
+        delete block_cache;
     }
 
     void setLoaderMode(const VanadisInstructionLoaderMode new_loader_mode) {
@@ -62,6 +66,21 @@ public:
         switchLoaderMode();
     }
 
+    // Switches the loader to the decoded block cache, blocks hold at most
+    // max_length bundles
+    void setBlockCacheMode(const uint32_t sets, const uint32_t ways, const uint32_t max_length) {
+        delete block_cache;
+        block_cache = new VanadisDecodedBlockCache(sets, ways, max_length);
+
+        setLoaderMode(VanadisInstructionLoaderMode::BLOCK_CACHE_MODE);
+    }
+
+    void setBlockCacheStatistics(Statistic<uint64_t>* hit, Statistic<uint64_t>* miss, Statistic<uint64_t>* evict) {
+        if (nullptr != block_cache) {
+            block_cache->setStatistics(hit, miss, evict);
+        }
+    }
+
     VanadisInstructionLoaderMode getLoaderMode() const {
         return loader_mode;
     }
@@ -215,6 +234,10 @@ public:
         {
             infinite_uop_cache.insert(std::pair<uint64_t, VanadisInstructionBundle*>(bundle->getInstructionAddress(), bundle));
         } break;
+        case VanadisInstructionLoaderMode::BLOCK_CACHE_MODE:
+        {
+            block_cache->store(bundle);
+        } break;
         }
     }
 
@@ -222,9 +245,13 @@ public:
         uop_cache->clear();
         predecode_cache->clear();
         infinite_uop_cache.clear();
+
+        if (nullptr != block_cache) {
+            block_cache->clear();
+        }
     }
 
-    bool hasBundleAt(const uint64_t addr) const {
+    bool hasBundleAt(const uint64_t addr) {
         switch(loader_mode) {
         case VanadisInstructionLoaderMode::LRU_CACHE_MODE:
         {
@@ -234,6 +261,10 @@ public:
         {
             return !(infinite_uop_cache.find(addr) == infinite_uop_cache.end());
         } break;
+        case VanadisInstructionLoaderMode::BLOCK_CACHE_MODE:
+        {
+            return block_cache->contains(addr);
+        } break;
         }
         assert(0);
     }
@@ -260,6 +291,10 @@ public:
         {
             return infinite_uop_cache.find(addr)->second;
         } break;
+        case VanadisInstructionLoaderMode::BLOCK_CACHE_MODE:
+        {
+            return block_cache->find(addr);
+        } break;
         }
         assert(0);
     }
@@ -340,6 +375,11 @@ public:
 
         output->verbose(CALL_INFO, 8, VANADIS_DBG_INS_LDR_FLG, "--> uop Cache Entries:         %" PRIu32 " / %" PRIu32 "\n",
                         (uint32_t)uop_cache->size(), (uint32_t)uop_cache->capacity());
+
+        if (nullptr != block_cache) {
+            output->verbose(CALL_INFO, 8, VANADIS_DBG_INS_LDR_FLG, "--> Decoded Block Cache:       %" PRIu32 " / %" PRIu32 " bundles in %" PRIu32 " blocks\n",
+                            (uint32_t)block_cache->size(), (uint32_t)block_cache->capacity(), (uint32_t)block_cache->blockCapacity());
+        }
         output->verbose(CALL_INFO, 8, VANADIS_DBG_INS_LDR_FLG, "--> Predecode Cache Entries:   %" PRIu32 " / %" PRIu32 "\n",
                         (uint32_t)predecode_cache->size(), (uint32_t)predecode_cache->capacity());
     }
@@ -371,6 +411,11 @@ private:
         } break;
         case VanadisInstructionLoaderMode::LRU_CACHE_MODE:
         {} break;
+        case VanadisInstructionLoaderMode::BLOCK_CACHE_MODE:
+        {
+            uop_cache->clear();
+            block_cache->clear();
+        } break;
         }
     }
 
@@ -381,6 +426,7 @@ private:
     VanadisCache<uint64_t, uint8_t*, SST::Vanadis::VanadisCacheRecordDeletion::VANADIS_PERFORM_DELETE_ARRAY>* predecode_cache;
 
     std::unordered_map<uint64_t, VanadisInstructionBundle*> infinite_uop_cache;
+    VanadisDecodedBlockCache* block_cache;
 
     std::unordered_map<SST::Interfaces::StandardMem::Request::id_t, SST::Interfaces::StandardMem::Read*> pending_loads;
 
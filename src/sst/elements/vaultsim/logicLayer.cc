@@ -60,6 +60,8 @@ logicLayer::logicLayer( ComponentId_t id, Params& params ) :
 
   bool terminal = params.find("terminal", 0);
 
+  aggregate = params.find<bool>("aggregate", false);
+
   int numVaults = params.find("vaults", -1);
   if ( -1 != numVaults) {
     // connect up our vaults
@@ -76,6 +78,7 @@ logicLayer::logicLayer( ComponentId_t id, Params& params ) :
       }
     }
     printf(" Connected %d Vaults\n", numVaults);
+    vaultBatches.resize(numVaults, NULL);
   } else {
     dbg.fatal(CALL_INFO, -1,
         " no <vaults> tag defined for LogicLayer\n");
@@ -201,7 +204,14 @@ bool logicLayer::clock( Cycle_t current )
 
       dbg.output(CALL_INFO, "ll%d sends %p to vault @ %" PRIu64 "\n", llID, event,
         current);
-      m_memChans[vaultID]->send(event);
+      if (aggregate) {
+        if (NULL == vaultBatches[vaultID]) {
+          vaultBatches[vaultID] = new MemReqBatchEvent();
+        }
+        vaultBatches[vaultID]->getReqs().push_back(event);
+      } else {
+        m_memChans[vaultID]->send(event);
+      }
     } else {
       // it is not ours
       if (toMem) {
@@ -212,6 +222,23 @@ bool logicLayer::clock( Cycle_t current )
     }
   }
 
+  // a vault with a single request this cycle gets it on its own
+  if (aggregate) {
+    for (size_t i = 0; i < vaultBatches.size(); ++i) {
+      MemReqBatchEvent *batch = vaultBatches[i];
+      if (NULL == batch) {
+        continue;
+      }
+      if (1 == batch->getReqs().size()) {
+        m_memChans[i]->send(batch->getReqs()[0]);
+        delete batch;
+      } else {
+        m_memChans[i]->send(batch);
+      }
+      vaultBatches[i] = NULL;
+    }
+  }
+
   // check for events from the memory chain
   if (toMem) {
     while((tm[0] < bwlimit) && (e = toMem->recv())) {
@@ -234,18 +261,20 @@ bool logicLayer::clock( Cycle_t current )
        i != m_memChans.end(); ++i) {
     memChan_t *m_memChan = *i;
     while ((e = m_memChan->recv())) {
-      MemRespEvent *event  = dynamic_cast<MemRespEvent*>(e);
-      if (event == NULL) {
-        dbg.fatal(CALL_INFO, -1, "logic layer got bad event from vaults\n");
+      if (MemRespBatchEvent *batch = dynamic_cast<MemRespBatchEvent*>(e)) {
+        // the CPU side only takes single responses
+        std::vector<MemRespEvent*> &resps = batch->getResps();
+        for (size_t j = 0; j < resps.size(); ++j) {
+          sendToCPU(resps[j], tc[1]);
+        }
+        delete batch;
+        continue;
       }
 
       dbg.output(CALL_INFO, "ll%d got an event %p from vault @ %" PRIu64 ", sends "
-        "towards cpu\n", llID, event, current);
+        "towards cpu\n", llID, e, current);
 
-      // send to CPU
-      memOps++;
-      toCPU->send( event );
-      tc[1]++;
+      sendToCPU(e, tc[1]);
     }
   }
 
@@ -264,3 +293,16 @@ bool logicLayer::clock( Cycle_t current )
 
   return false;
 }
+
+void logicLayer::sendToCPU(SST::Event *e, int &sent)
+{
+  MemRespEvent *event  = dynamic_cast<MemRespEvent*>(e);
+  if (event == NULL) {
+    dbg.fatal(CALL_INFO, -1, "logic layer got bad event from vaults\n");
+  }
+
+  // send to CPU
+  memOps++;
+  toCPU->send( event );
+  sent++;
+}
@@ -24,6 +24,7 @@
 #include <sst/core/statapi/stathistogram.h>
 
 #include "globals.h"
+#include "memReqEvent.h"
 
 using namespace std;
 
@@ -51,7 +52,8 @@ public: // functions
                             {"LL_MASK",            "Bitmask to determine 'ownership' of an address by a cube. A cube 'owns' an address if ((((addr >> LL_SHIFT) & LL_MASK) == llID) || (LL_MASK == 0)). LL_SHIFT is set in vaultGlobals.h and is 8 by default."},
                             {"terminal",           "Is this the last cube in the chain?"},
                             {"vaults",             "Number of vaults per cube."},
-                            {"debug",              "0 (default): No debugging, 1: STDOUT, 2: STDERR, 3: FILE."}
+                            {"debug",              "0 (default): No debugging, 1: STDOUT, 2: STDERR, 3: FILE."},
+                            {"aggregate",          "0 (default): send each request to its vault as its own event, 1: send the requests for a vault from one cycle as a single batch event."}
                                 );
 
    SST_ELI_DOCUMENT_STATISTICS(
@@ -80,6 +82,7 @@ private:
 
   logicLayer( const logicLayer& c );
   bool clock( Cycle_t );
+  void sendToCPU(SST::Event *e, int &sent);
   // determine if we 'own' a given address
   bool isOurs(unsigned int addr) {
     return ((((addr >> LL_SHIFT) & LL_MASK) == llID)
@@ -91,6 +94,8 @@ private:
   SST::Link *toMem;
   SST::Link *toCPU;
   int bwlimit;
+  bool aggregate;
+  vector<MemReqBatchEvent*> vaultBatches;  // requests for each vault this cycle
   unsigned int LL_MASK;
   unsigned int llID;
   unsigned long long memOps;
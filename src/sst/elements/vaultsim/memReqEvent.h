@@ -18,6 +18,8 @@
 
 #include <sst/core/event.h>
 
+#include <vector>
+
 namespace SST {
 namespace VaultSim {
 
@@ -95,6 +97,45 @@ class MemRespEvent : public SST::Event {
 
     ImplementSerializable(MemRespEvent);
 };
+
+// Requests for one vault from one logic layer cycle, carried as a single
+// event on the link. The vault answers with a MemRespBatchEvent holding the
+// responses in the same order.
+class MemReqBatchEvent : public SST::Event {
+  public:
+    MemReqBatchEvent() : SST::Event() {}
+
+    std::vector<MemReqEvent*>& getReqs() { return reqs; }
+
+  private:
+    std::vector<MemReqEvent*> reqs;
+
+  public:
+    void serialize_order(SST::Core::Serialization::serializer &ser)  override {
+        Event::serialize_order(ser);
+        ser & reqs;
+    }
+
+    ImplementSerializable(MemReqBatchEvent);
+};
+
+class MemRespBatchEvent : public SST::Event {
+  public:
+    MemRespBatchEvent() : SST::Event() {}
+
+    std::vector<MemRespEvent*>& getResps() { return resps; }
+
+  private:
+    std::vector<MemRespEvent*> resps;
+
+  public:
+    void serialize_order(SST::Core::Serialization::serializer &ser)  override {
+        Event::serialize_order(ser);
+        ser & resps;
+    }
+
+    ImplementSerializable(MemRespBatchEvent);
+};
 }
 }
 
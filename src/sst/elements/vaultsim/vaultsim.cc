@@ -48,7 +48,14 @@ VaultSim::VaultSim( ComponentId_t id, Params& params ) :
 
     //DBG("new id=%lu\n",id);
 
-    m_memChan = configureLink( "bus", "1 ns" );
+    // event driven vaults only do work when a request arrives or completes
+    bool eventDriven = params.find<bool>("event_driven", false);
+    if ( eventDriven ) {
+        m_memChan = configureLink( "bus", "1 ns",
+                                   new Event::Handler<VaultSim>(this, &VaultSim::handleRequest) );
+    } else {
+        m_memChan = configureLink( "bus", "1 ns" );
+    }
 
     int vid = params.find("VaultID", -1);
     if ( -1 == vid) {
@@ -59,12 +66,22 @@ VaultSim::VaultSim( ComponentId_t id, Params& params ) :
 
     // Configuration if we're not using Phx Library
 
-    registerClock( frequency,
-                   new Clock::Handler<VaultSim>(this, &VaultSim::clock) );
+    if ( eventDriven ) {
+        // keep the clock period as the time base so the delay line timing matches
+        registerTimeBase( frequency, true );
+    } else {
+        registerClock( frequency,
+                       new Clock::Handler<VaultSim>(this, &VaultSim::clock) );
+    }
 
     std::string delay = "40ns";
     delay = params.find<std::string>("delay", "40ns");
-    delayLine = configureSelfLink( "delayLine", delay);
+    if ( eventDriven ) {
+        delayLine = configureSelfLink( "delayLine", delay,
+                                       new Event::Handler<VaultSim>(this, &VaultSim::handleDelayed) );
+    } else {
+        delayLine = configureSelfLink( "delayLine", delay);
+    }
 
     // setup backing store
     size_t memSize = MEMSIZE;
@@ -111,33 +128,66 @@ void VaultSim::init(unsigned int phase)
     }
 }
 
+// A request, or a batch of them from the logic layer, goes down the delay
+// line as is so a batch also comes back as one event
+void VaultSim::acceptRequest( SST::Event *e ) {
+    if (MemReqEvent *event = dynamic_cast<MemReqEvent*>(e)) {
+        delayLine->send(1, event);
+        numOutstanding++;
+    } else if (MemReqBatchEvent *batch = dynamic_cast<MemReqBatchEvent*>(e)) {
+        delayLine->send(1, batch);
+        numOutstanding += batch->getReqs().size();
+    } else {
+        dbg.fatal(CALL_INFO, -1, "vault got bad event\n");
+    }
+}
+
+void VaultSim::completeRequest( SST::Event *e ) {
+    if (MemReqEvent *event = dynamic_cast<MemReqEvent*>(e)) {
+        MemRespEvent *respEvent = new MemRespEvent(
+            event->getReqId(), event->getAddr(), event->getFlags() );
+
+        m_memChan->send(respEvent);
+        numOutstanding--;
+        delete event;
+    } else if (MemReqBatchEvent *batch = dynamic_cast<MemReqBatchEvent*>(e)) {
+        MemRespBatchEvent *respBatch = new MemRespBatchEvent();
+        std::vector<MemReqEvent*> &reqs = batch->getReqs();
+        for (size_t i = 0; i < reqs.size(); ++i) {
+            respBatch->getResps().push_back( new MemRespEvent(
+                reqs[i]->getReqId(), reqs[i]->getAddr(), reqs[i]->getFlags() ) );
+            delete reqs[i];
+        }
+
+        m_memChan->send(respBatch);
+        numOutstanding -= reqs.size();
+        delete batch;
+    } else {
+        dbg.fatal(CALL_INFO, -1, "vault got bad event from delay line\n");
+    }
+}
+
+void VaultSim::handleRequest( SST::Event *e ) {
+    acceptRequest(e);
+    memOutStat->addData(numOutstanding);
+}
+
+void VaultSim::handleDelayed( SST::Event *e ) {
+    completeRequest(e);
+    memOutStat->addData(numOutstanding);
+}
+
 bool VaultSim::clock( Cycle_t current ) {
     SST::Event *e = 0;
     while (NULL != (e = m_memChan->recv())) {
         // process incoming events
-        MemReqEvent *event  = dynamic_cast<MemReqEvent*>(e);
-        if (NULL == event) {
-            dbg.fatal(CALL_INFO, -1, "vault got bad event\n");
-        }
-        // handle event...
-        delayLine->send(1, event);
-        numOutstanding++;
+        acceptRequest(e);
     }
 
     e = 0;
     while (NULL != (e = delayLine->recv())) {
         // process returned events
-        MemReqEvent *event  = dynamic_cast<MemReqEvent*>(e);
-        if (NULL == event) {
-            dbg.fatal(CALL_INFO, -1, "vault got bad event from delay line\n");
-        } else {
-            MemRespEvent *respEvent = new MemRespEvent(
-				event->getReqId(), event->getAddr(), event->getFlags() );
-
-            m_memChan->send(respEvent);
-            numOutstanding--;
-            delete event;
-        }
+        completeRequest(e);
     }
 
     memOutStat->addData(numOutstanding);
@@ -47,6 +47,8 @@ public: // functions
                             {"numVaults2",         "Number of bits to determine vault address (i.e. log_2(number of vaults per cube))"},
                             {"VaultID",            "Vault Unique ID (Unique to cube)."},
                             {"debug",              "0 (default): No debugging, 1: STDOUT, 2: STDERR, 3: FILE."},
+                            {"delay",              "Access latency of the vault.", "40ns"},
+                            {"event_driven",       "0 (default): poll the bus every cycle, 1: handle requests and responses as they arrive and leave the vault unclocked. Requests are not held to the next clock edge, and Mem_Outstanding is sampled on every change instead of every cycle.", "0"},
                            )
 
     SST_ELI_DOCUMENT_PORTS(
@@ -71,6 +73,11 @@ private: // functions
     VaultSim( const VaultSim& c );
 
     bool clock( Cycle_t );
+    void handleRequest( SST::Event *e );
+    void handleDelayed( SST::Event *e );
+    void acceptRequest( SST::Event *e );
+    void completeRequest( SST::Event *e );
+
     Link *delayLine;
     uint8_t *memBuffer;
     memChan_t* m_memChan;
@@ -43,6 +43,9 @@
 #define SIRIUS_MPI_MAX 16
 #define SIRIUS_MPI_MIN 17
 
+// Must match siriusglobals.h in ember/sirius
+#define SIRIUS_TRACE_V2_MAGIC 0x32535253
+
 ///////////////////////////////////////////////
 
 #endif
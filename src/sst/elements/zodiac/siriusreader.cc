@@ -15,6 +15,9 @@
 
 #include <sst_config.h>
 
+#include <string.h>
+#include <algorithm>
+
 #include "siriusreader.h"
 
 using namespace std;
@@ -46,8 +49,30 @@ SiriusReader::SiriusReader(char* file, uint32_t focusOnRank, uint32_t maxQLen, s
 		exit(-1);
 	}
 
+	// Records are a few bytes each, so read the trace a block at a time
+	// and parse them out of memory instead of calling fread per field
+	readBuffer.resize(1024 * 1024);
+	readPos = 0;
+	readLen = 0;
+
 	prevEventTime = 0;
+	traceTimeNs = 0;
+	traceVersion = 1;
+
+	// Version 1 traces start straight away with the MPI_Init record
+	fillBuffer();
+	if(readLen >= sizeof(uint32_t)) {
+		uint32_t traceMagic;
+		memcpy(&traceMagic, &readBuffer[0], sizeof(traceMagic));
+
+		if(SIRIUS_TRACE_V2_MAGIC == traceMagic) {
+			traceVersion = 2;
+			readPos += sizeof(traceMagic);
+		}
+	}
+
 	output = new Output("SiriusReader", verbose, 0, Output::STDOUT);
+	output->verbose(CALL_INFO, 4, 0, "Reading a version %" PRIu32 " Sirius trace.\n", traceVersion);
 	readInit();
 }
 
@@ -129,7 +154,7 @@ void SiriusReader::generateNextEvent() {
 
 	default:
 		std::cout << "Unknown MPI command in trace (" << call_type << ") position: " <<
-			ftell(trace) << std::endl;
+			tracePosition() << std::endl;
 		exit(-1);
 		break;
 	}
@@ -241,34 +266,78 @@ void SiriusReader::readBarrier() {
 
 uint32_t SiriusReader::readUINT32() {
 	uint32_t temp;
-	fread(&temp, 1, sizeof(uint32_t), trace);
+	readBytes(&temp, sizeof(uint32_t));
 	return temp;
 }
 
 uint64_t SiriusReader::readUINT64() {
 	uint64_t temp;
-	fread(&temp, 1, sizeof(uint64_t), trace);
+	readBytes(&temp, sizeof(uint64_t));
 	return temp;
 }
 
 double SiriusReader::readTime() {
+	if(2 == traceVersion) {
+		traceTimeNs += readDelta();
+		return traceTimeNs * 1.0e-9;
+	}
+
 	double temp;
-	fread(&temp, 1, sizeof(double), trace);
+	readBytes(&temp, sizeof(double));
 	return temp;
 }
 
+uint64_t SiriusReader::readDelta() {
+	uint64_t delta = 0;
+	uint8_t next;
+	uint32_t shift = 0;
+
+	do {
+		readBytes(&next, sizeof(next));
+		delta |= ((uint64_t) (next & 0x7F)) << shift;
+		shift += 7;
+	} while((next & 0x80) && shift < 64);
+
+	return delta;
+}
+
 int32_t SiriusReader::readINT32() {
 	int32_t temp;
-	fread(&temp, 1, sizeof(int32_t), trace);
+	readBytes(&temp, sizeof(int32_t));
 	return temp;
 }
 
 int64_t SiriusReader::readINT64() {
 	int64_t temp;
-	fread(&temp, 1, sizeof(int64_t), trace);
+	readBytes(&temp, sizeof(int64_t));
 	return temp;
 }
 
+void SiriusReader::fillBuffer() {
+	// keep the bytes not read yet at the front
+	readLen -= readPos;
+	memmove(&readBuffer[0], &readBuffer[readPos], readLen);
+	readPos = 0;
+
+	readLen += fread(&readBuffer[readLen], 1, readBuffer.size() - readLen, trace);
+}
+
+void SiriusReader::readBytes(void* dest, size_t len) {
+	if(readLen - readPos < len) {
+		fillBuffer();
+	}
+
+	size_t avail = std::min(len, readLen - readPos);
+	memcpy(dest, &readBuffer[readPos], avail);
+	// past the end of the trace, as fread would leave it unfilled
+	memset((char*) dest + avail, 0, len - avail);
+	readPos += avail;
+}
+
+long SiriusReader::tracePosition() {
+	return ftell(trace) - (long) (readLen - readPos);
+}
+
 PayloadDataType SiriusReader::convertToHermesType(uint32_t dtype) {
 	PayloadDataType hType = CHAR;
 
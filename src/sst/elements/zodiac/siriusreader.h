@@ -25,6 +25,7 @@
 #include <string>
 #include <iostream>
 #include <queue>
+#include <vector>
 
 #include "sst/core/output.h"
 #include "sst/elements/hermes/msgapi.h"
@@ -66,11 +67,20 @@ class SiriusReader {
 	bool foundFinalize;
 	std::queue<ZodiacEvent*>* eventQ;
 	FILE* trace;
+	std::vector<char> readBuffer;
+	size_t readPos;
+	size_t readLen;
 	double prevEventTime;
+	uint32_t traceVersion;
+	uint64_t traceTimeNs;
+	inline void readBytes(void* dest, size_t len);
+	void fillBuffer();
+	long tracePosition();
 	void generateNextEvent();
 	inline uint32_t readUINT32();
 	inline uint64_t readUINT64();
 	inline double readTime();
+	inline uint64_t readDelta();
 	inline int32_t readINT32();
 	inline int64_t readINT64();
 	void readSend();
@@ -18,6 +18,7 @@
 #define _H_ZODIAC_EVENT_BASE
 
 #include "sst/elements/hermes/msgapi.h"
+#include "sst/elements/pool/objectPool.h"
 
 namespace SST {
 namespace Zodiac {
@@ -42,6 +43,8 @@ class ZodiacEvent : public SST::Event {
 		ZodiacEvent();
 		virtual ZodiacEventType getEventType() = 0;
 
+		SST_ELEMENT_POOL_OPERATORS(SST::Zodiac::ZodiacEvent)
+
 		NotSerializable(ZodiacEvent)
 };
 
@@ -0,0 +1,223 @@
+#!/usr/bin/env python3
+#
+# End-to-end benchmarks of canonical full-system configurations built from
+# several element libraries, reported as JSON.  The per-element benchmarks in
+# memHierarchy/tests/benchmarks and merlin/tests/benchmarks measure one
+# library in isolation; these measure how the libraries perform together.
+#
+# Systems (configurations live with the elements they exercise, run at a
+# fixed size):
+#   vanadis-riscv   - Vanadis RISC-V STREAM, L1 -> L2 -> L3 per core, directory, timingDRAM
+#                     (vanadis/tests/basic_vanadis.py)
+#   ariel-cramsim   - Ariel (PIN) STREAM, L1 -> L2 -> shared L3 -> cramSim DDR4
+#                     (cramSim/tests/ariel_cramsim.py, needs PIN and a C compiler with OpenMP)
+#   ember-dragonfly - ember Halo3D over firefly on a 256-node merlin dragonfly
+#                     (ember/test/emberLoad.py)
+#   miranda-gups    - 8x Miranda GUPS -> L1 -> bus -> HBM-like timingDRAM
+#                     (memHierarchy/tests/benchmarks/benchConfig.py)
+#
+# Each system is run at every thread count in --threads.  For each run this reports:
+#   wall_seconds       - host wall-clock time of the sst run
+#   cpu_seconds        - host user + system time of the sst run
+#   events             - events delivered by the simulator, if --print-timing-info reports them
+#   events_per_second  - events / wall_seconds
+#   peak_rss_kb        - peak resident set size of the sst process
+#   speedup            - wall_seconds of the fewest-thread run of the system / wall_seconds
+#
+# Usage:
+#   runSystemBenchmarks.py [--sst sst] [--only miranda-gups,ember-dragonfly] [--threads 1,2,4]
+#                          [--repeat R] [--output results.json]
+#
+# Compare two result files with:
+#   runSystemBenchmarks.py --compare old.json new.json
+import argparse
+import json
+import os
+import platform
+import re
+import shutil
+import subprocess
+import sys
+import tempfile
+import time
+
+ELEMENTS = os.path.join(os.path.dirname(os.path.abspath(__file__)), "..", "..", "src", "sst", "elements")
+
+def elements_path(*parts):
+    return os.path.abspath(os.path.join(ELEMENTS, *parts))
+
+def prepare_ariel(workdir):
+    # ariel_cramsim.py runs ./stream from the working directory
+    compiler = shutil.which("cc") or shutil.which("gcc")
+    if not compiler:
+        return "no C compiler found to build the STREAM binary"
+    src = elements_path("cramSim", "tests", "stream.c")
+    if subprocess.call([compiler, "-O2", "-fopenmp", src, "-o", os.path.join(workdir, "stream")]) != 0:
+        return "failed to build the STREAM binary"
+    return None
+
+SYSTEMS = [
+    {
+        "name" : "vanadis-riscv",
+        "config" : elements_path("vanadis", "tests", "basic_vanadis.py"),
+        "env" : {
+            "VANADIS_ISA" : "RISCV64",
+            "VANADIS_CPU_ELEMENT_NAME" : "VanadisCPU",
+            "VANADIS_EXE" : elements_path("vanadis", "tests", "small", "misc", "stream", "riscv64", "stream"),
+            "VANADIS_NUM_CORES" : "2",
+            "VANADIS_L3_SIZE" : "2MB",
+            "VANADIS_MEM_BACKEND" : "timingDRAM",
+        },
+    },
+    {
+        "name" : "ariel-cramsim",
+        "config" : elements_path("cramSim", "tests", "ariel_cramsim.py"),
+        "args" : [ "--configfile=" + elements_path("cramSim", "ddr4_verimem.cfg") ],
+        "prepare" : prepare_ariel,
+    },
+    {
+        "name" : "ember-dragonfly",
+        "config" : elements_path("ember", "test", "emberLoad.py"),
+        "options" : [
+            "--topo=dragonfly",
+            "--shape=4:8:4:8",
+            "--cmdLine=\"Init\"",
+            "--cmdLine=\"Halo3D nx=64 ny=64 nz=64 pex=8 pey=8 pez=4 iterations=10\"",
+            "--cmdLine=\"Fini\"",
+        ],
+    },
+    {
+        "name" : "miranda-gups",
+        "config" : elements_path("memHierarchy", "tests", "benchmarks", "benchConfig.py"),
+        "options" : [ "--scenario=gups", "--ops=25000", "--stats=gupsStats.csv" ],
+    },
+]
+
+def parse_timing_info(output):
+    # Event counts are only reported by sst-core versions that track them
+    info = {}
+    match = re.search(r"^\s*(?:Total |Global )?[Ee]vents(?: processed| executed| delivered)?:\s*([0-9]+)\s*$", output, re.MULTILINE)
+    if match:
+        info["events"] = int(match.group(1))
+    return info
+
+def run_system(sst, system, threads, workdir):
+    name = "%s-%dt" % (system["name"], threads)
+    log_file = os.path.join(workdir, name + ".log")
+    cmd = [sst, "--print-timing-info", "--num-threads=%d" % threads, system["config"]]
+    cmd += system.get("args", [])
+    if system.get("options"):
+        cmd.append("--model-options=" + " ".join(system["options"]))
+    env = dict(os.environ)
+    env.update(system.get("env", {}))
+
+    # wait4() gives the resource usage of this run alone, RUSAGE_CHILDREN would report
+    # the maximum RSS over every run so far
+    with open(log_file, "w") as log:
+        start = time.perf_counter()
+        proc = subprocess.Popen(cmd, stdout=log, stderr=subprocess.STDOUT, cwd=workdir, env=env)
+        _, status, usage = os.wait4(proc.pid, 0)
+        wall = time.perf_counter() - start
+        proc.returncode = os.waitstatus_to_exitcode(status) if hasattr(os, "waitstatus_to_exitcode") else status
+    with open(log_file) as log:
+        output = log.read()
+
+    result = { "name" : name, "system" : system["name"], "threads" : threads }
+    if proc.returncode != 0:
+        sys.stderr.write("Benchmark '%s' failed (%d):\n%s\n" % (name, proc.returncode, output[-4000:]))
+        result["error"] = proc.returncode
+        return result
+
+    result.update({
+        "wall_seconds" : wall,
+        "cpu_seconds" : usage.ru_utime + usage.ru_stime,
+        "peak_rss_kb" : usage.ru_maxrss,    # KiB on Linux
+    })
+    result.update(parse_timing_info(output))
+    if "events" in result:
+        result["events_per_second"] = result["events"] / wall
+    return result
+
+def best_of(results):
+    ok = [r for r in results if "error" not in r]
+    if not ok:
+        return results[0]
+    best = dict(min(ok, key=lambda r: r["wall_seconds"]))
+    best["repeats"] = len(results)
+    best["peak_rss_kb"] = max(r["peak_rss_kb"] for r in ok)
+    return best
+
+def add_speedup(results):
+    systems = {}
+    for r in results:
+        if "error" not in r:
+            systems.setdefault(r["system"], []).append(r)
+    for runs in systems.values():
+        base = min(runs, key=lambda r: r["threads"])
+        for r in runs:
+            r["speedup"] = base["wall_seconds"] / r["wall_seconds"]
+
+def compare(old_file, new_file, threshold):
+    with open(old_file) as f:
+        old = { r["name"] : r for r in json.load(f)["benchmarks"] }
+    with open(new_file) as f:
+        new = { r["name"] : r for r in json.load(f)["benchmarks"] }
+
+    regressed = False
+    print("%-24s %12s %12s %8s" % ("benchmark", "old wall s", "new wall s", "change"))
+    for name in sorted(set(old) & set(new)):
+        if "wall_seconds" not in old[name] or "wall_seconds" not in new[name]:
+            continue
+        change = new[name]["wall_seconds"] / old[name]["wall_seconds"] - 1
+        flag = " *" if change > threshold else ""
+        regressed = regressed or change > threshold
+        print("%-24s %12.2f %12.2f %+7.1f%%%s" % (name, old[name]["wall_seconds"], new[name]["wall_seconds"], change * 100, flag))
+    return 1 if regressed else 0
+
+def main():
+    parser = argparse.ArgumentParser(description="Full-system host performance benchmarks")
+    parser.add_argument("--sst", default="sst", help="sst executable")
+    parser.add_argument("--only", default="", help="Comma-separated list of systems to run")
+    parser.add_argument("--threads", default="1,2,4", help="Comma-separated list of thread counts")
+    parser.add_argument("--repeat", type=int, default=1, help="Runs per benchmark, the fastest is reported")
+    parser.add_argument("--output", default="", help="JSON output file (default: stdout)")
+    parser.add_argument("--compare", nargs=2, metavar=("OLD", "NEW"), help="Compare two result files instead of running")
+    parser.add_argument("--threshold", type=float, default=0.05, help="Relative wall time increase reported as a regression by --compare")
+    args = parser.parse_args()
+
+    if args.compare:
+        return compare(args.compare[0], args.compare[1], args.threshold)
+
+    selected = [s for s in SYSTEMS if not args.only or s["name"] in args.only.split(",")]
+    thread_counts = [int(t) for t in args.threads.split(",")]
+
+    results = []
+    with tempfile.TemporaryDirectory() as workdir:
+        for system in selected:
+            problem = system["prepare"](workdir) if "prepare" in system else None
+            if problem:
+                sys.stderr.write("Skipping %s: %s\n" % (system["name"], problem))
+                results.append({ "name" : system["name"], "system" : system["name"], "skipped" : problem })
+                continue
+            for threads in thread_counts:
+                sys.stderr.write("Running %s with %d thread(s)\n" % (system["name"], threads))
+                runs = [run_system(args.sst, system, threads, workdir) for _ in range(args.repeat)]
+                results.append(best_of(runs))
+    add_speedup(results)
+
+    report = {
+        "host" : platform.node(),
+        "platform" : platform.platform(),
+        "timestamp" : time.strftime("%Y-%m-%dT%H:%M:%S"),
+        "benchmarks" : results,
+    }
+    text = json.dumps(report, indent=2, sort_keys=True)
+    if args.output:
+        with open(args.output, "w") as f:
+            f.write(text + "\n")
+    else:
+        print(text)
+    return 1 if any("error" in r for r in results) else 0
+
+if __name__ == "__main__":
+    sys.exit(main())